@@ -30,7 +30,7 @@ set(BROTLI_VERSION "v0.6.0")
 set(LZ4_VERSION "1.7.5")
 set(ZSTD_VERSION "1.2.0")
 set(PROTOBUF_VERSION "2.6.0")
-set(GRPC_VERSION "94582910ad7f82ad447ecc72e6548cb669e4f7a9") # v1.6.5
+set(GRPC_VERSION "1.51.1") # minimum, not vendored
 set(ORC_VERSION "cf00b67795717ab3eb04e950780ed6d104109017")
 
 string(TOUPPER ${CMAKE_BUILD_TYPE} UPPERCASE_BUILD_TYPE)
@@ -848,48 +848,29 @@ endif()
 if (ARROW_WITH_GRPC)
 # ----------------------------------------------------------------------
 # GRPC
-  if ("${GRPC_HOME}" STREQUAL "")
-    set(GRPC_VENDORED 1)
-    set(GRPC_BUILD_DIR "${CMAKE_CURRENT_BINARY_DIR}/grpc_ep-prefix/src/grpc_ep-build")
-    set(GRPC_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/grpc_ep/src/grpc_ep-install")
-    set(GRPC_HOME "${GRPC_PREFIX}")
-    set(GRPC_INCLUDE_DIR "${GRPC_PREFIX}/include")
-    set(GRPC_STATIC_LIBRARY_GPR "${GRPC_BUILD_DIR}/${CMAKE_CFG_INTDIR}/${CMAKE_STATIC_LIBRARY_PREFIX}gpr${CMAKE_STATIC_LIBRARY_SUFFIX}")
-    set(GRPC_STATIC_LIBRARY_GRPC "${GRPC_BUILD_DIR}/${CMAKE_CFG_INTDIR}/${CMAKE_STATIC_LIBRARY_PREFIX}grpc${CMAKE_STATIC_LIBRARY_SUFFIX}")
-    set(GRPC_STATIC_LIBRARY_GRPCPP "${GRPC_BUILD_DIR}/${CMAKE_CFG_INTDIR}/${CMAKE_STATIC_LIBRARY_PREFIX}grpc++${CMAKE_STATIC_LIBRARY_SUFFIX}")
-    set(GRPC_CMAKE_ARGS -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}
-                          "-DCMAKE_CXX_FLAGS=${EP_CXX_FLAGS}"
-                          "-DCMAKE_C_FLAGS=${EP_C_FLAGS}"
-                          -DCMAKE_INSTALL_PREFIX=${GRPC_PREFIX}
-                          -DBUILD_SHARED_LIBS=OFF)
-
-    ExternalProject_Add(grpc_ep
-      GIT_REPOSITORY "https://github.com/grpc/grpc"
-      GIT_TAG ${GRPC_VERSION}
-      BUILD_BYPRODUCTS "${GRPC_STATIC_LIBRARY_GPR}" "${GRPC_STATIC_LIBRARY_GRPC}" "${GRPC_STATIC_LIBRARY_GRPCPP}"
-      ${GRPC_BUILD_BYPRODUCTS}
-      ${EP_LOG_OPTIONS}
-      CMAKE_ARGS ${GRPC_CMAKE_ARGS}
-      ${EP_LOG_OPTIONS})
-  else()
-    find_package(gRPC CONFIG REQUIRED)
-    set(GRPC_VENDORED 0)
-  endif()
 
-  include_directories(SYSTEM ${GRPC_INCLUDE_DIR})
-  ADD_THIRDPARTY_LIB(grpc_grp
-    STATIC_LIB ${GRPC_STATIC_LIBRARY_GPR})
-  ADD_THIRDPARTY_LIB(grpc_grpc
-    STATIC_LIB ${GRPC_STATIC_LIBRARY_GRPC})
-  ADD_THIRDPARTY_LIB(grpc_grpcpp
-    STATIC_LIB ${GRPC_STATIC_LIBRARY_GRPCPP})
-
-  if (GRPC_VENDORED)
-    add_dependencies(grpc_grp grpc_ep)
-    add_dependencies(grpc_grpc grpc_ep)
-    add_dependencies(grpc_grpcpp grpc_ep)
-  endif()
+  # gRPC is not vendored: its static libraries need abseil, upb, re2, c-ares,
+  # address_sorting, OpenSSL and zlib. Its CMake package config provides the
+  # gRPC::grpc++ target, which carries all of them.
+  #
+  # The package config finds zlib and protobuf with the stock CMake modules,
+  # which define the imported targets it links to. It is loaded in a function
+  # scope, without the find modules of this project and their results, such
+  # as the include directory of a vendored zlib
+  function(ARROW_FIND_GRPC)
+    set(CMAKE_MODULE_PATH "")
+    set(ZLIB_FOUND FALSE)
+    unset(ZLIB_INCLUDE_DIR)
+    set(PROTOBUF_FOUND FALSE)
+    set(Protobuf_FOUND FALSE)
+    if (NOT "${GRPC_HOME}" STREQUAL "")
+      list(APPEND CMAKE_PREFIX_PATH "${GRPC_HOME}")
+    endif()
+    find_package(gRPC ${GRPC_VERSION} CONFIG REQUIRED)
+    message(STATUS "Found gRPC ${gRPC_VERSION}")
+  endfunction()
 
+  ARROW_FIND_GRPC()
 endif()
 
 if (ARROW_ORC)
@@ -967,3 +948,12 @@ if (ARROW_ORC)
   add_dependencies(orc_ep protobuf lz4_static snappy zlib)
   add_dependencies(orc orc_ep)
 endif()
+
+if (ARROW_S3)
+# ----------------------------------------------------------------------
+# libcurl and OpenSSL, used by the S3 client
+
+  find_package(CURL REQUIRED)
+  find_package(OpenSSL REQUIRED)
+  include_directories(SYSTEM ${CURL_INCLUDE_DIRS} ${OPENSSL_INCLUDE_DIR})
+endif()
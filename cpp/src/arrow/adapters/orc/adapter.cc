@@ -19,13 +19,16 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/io/interfaces.h"
@@ -39,9 +42,12 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/OrcFile.hh"
+#include "orc/Statistics.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -217,7 +223,7 @@ constexpr int64_t kOneSecondNanos = 1000000000LL;
 
 class ORCFileReader::Impl {
  public:
-  Impl() {}
+  Impl() : use_threads_(false) {}
   ~Impl() {}
 
   Status Open(const std::shared_ptr<io::ReadableFileInterface>& file, MemoryPool* pool) {
@@ -247,6 +253,8 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
   int64_t NumberOfStripes() { return stripes_.size(); }
 
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
@@ -294,6 +302,14 @@ class ORCFileReader::Impl {
     return ReadTable(opts, out);
   }
 
+  Status ReadStripes(const std::vector<int64_t>& stripes,
+                     const std::vector<int>& include_indices,
+                     std::shared_ptr<Table>* out) {
+    liborc::RowReaderOptions opts;
+    RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    return ReadTable(opts, stripes, out);
+  }
+
   Status ReadStripe(int64_t stripe, std::shared_ptr<RecordBatch>* out) {
     liborc::RowReaderOptions opts;
     RETURN_NOT_OK(SelectStripe(&opts, stripe));
@@ -333,20 +349,99 @@ class ORCFileReader::Impl {
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
-    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
+    std::vector<int64_t> stripes(stripes_.size());
     for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
-      opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, stripes_[stripe].num_rows, &batches[stripe]));
+      stripes[stripe] = static_cast<int64_t>(stripe);
+    }
+    return ReadTable(row_opts, stripes, out);
+  }
+
+  Status ReadTable(const liborc::RowReaderOptions& row_opts,
+                   const std::vector<int64_t>& stripes, std::shared_ptr<Table>* out) {
+    for (int64_t stripe : stripes) {
+      liborc::RowReaderOptions opts(row_opts);
+      RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    }
+    std::vector<std::shared_ptr<RecordBatch>> batches(stripes.size());
+    // Each stripe gets its own row reader, so that they can be read in parallel
+    auto read_stripe = [&](int i) -> Status {
+      liborc::RowReaderOptions opts(row_opts);
+      RETURN_NOT_OK(SelectStripe(&opts, stripes[i]));
+      return ReadBatch(opts, stripes_[stripes[i]].num_rows, &batches[i]);
+    };
+    const int num_threads = use_threads_ ? GetCpuThreadPoolCapacity() : 1;
+    const int num_stripes = static_cast<int>(stripes.size());
+    RETURN_NOT_OK(ParallelFor(num_threads, num_stripes, read_stripe));
+    if (batches.empty()) {
+      std::shared_ptr<Schema> schema;
+      RETURN_NOT_OK(GetSelectedSchema(row_opts, &schema));
+      return Table::FromRecordBatches(schema, batches, out);
     }
     return Table::FromRecordBatches(batches, out);
   }
 
+  // The schema of the fields selected by the options
+  Status GetSelectedSchema(const liborc::RowReaderOptions& opts,
+                           std::shared_ptr<Schema>* out) {
+    std::unique_ptr<liborc::RowReader> rowreader;
+    try {
+      std::lock_guard<std::mutex> lock(reader_mutex_);
+      rowreader = reader_->createRowReader(opts);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    return GetArrowSchema(rowreader->getSelectedType(), out);
+  }
+
+  template <typename StatisticsType, typename T>
+  Status SelectStripes(int field_index, T min, T max, std::vector<int64_t>* out) {
+    const liborc::Type& type = reader_->getType();
+    if (field_index < 0 || field_index >= static_cast<int>(type.getSubtypeCount())) {
+      std::stringstream ss;
+      ss << "Out of bounds field index: " << field_index;
+      return Status::Invalid(ss.str());
+    }
+    const uint32_t column_id =
+        static_cast<uint32_t>(type.getSubtype(field_index)->getColumnId());
+    const uint64_t num_statistics = reader_->getNumberOfStripeStatistics();
+    out->clear();
+    for (int64_t stripe = 0; stripe < NumberOfStripes(); ++stripe) {
+      if (static_cast<uint64_t>(stripe) < num_statistics) {
+        std::unique_ptr<liborc::StripeStatistics> statistics;
+        try {
+          statistics = reader_->getStripeStatistics(stripe);
+        } catch (const liborc::ParseError& e) {
+          return Status::IOError(e.what());
+        }
+        auto column_statistics = dynamic_cast<const StatisticsType*>(
+            statistics->getColumnStatistics(column_id));
+        if (column_statistics != nullptr) {
+          if (column_statistics->getNumberOfValues() == 0) {
+            // Only nulls
+            continue;
+          }
+          const bool below = column_statistics->hasMaximum() &&
+                             column_statistics->getMaximum() < min;
+          const bool above = column_statistics->hasMinimum() &&
+                             column_statistics->getMinimum() > max;
+          if (below || above) {
+            continue;
+          }
+        }
+      }
+      out->push_back(stripe);
+    }
+    return Status::OK();
+  }
+
   Status ReadBatch(const liborc::RowReaderOptions& opts, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::RowReader> rowreader;
     std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
+      // The row readers then only share the input file, which supports
+      // concurrent reads
+      std::lock_guard<std::mutex> lock(reader_mutex_);
       rowreader = reader_->createRowReader(opts);
       batch = rowreader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
@@ -362,11 +457,15 @@ class ORCFileReader::Impl {
     // The top-level type must be a struct to read into an arrow table
     const auto& struct_batch = static_cast<liborc::StructVectorBatch&>(*batch);
 
-    while (rowreader->next(*batch)) {
-      for (int i = 0; i < builder->num_fields(); i++) {
-        RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
-                                  batch->numElements, builder->GetField(i)));
+    try {
+      while (rowreader->next(*batch)) {
+        for (int i = 0; i < builder->num_fields(); i++) {
+          RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
+                                    batch->numElements, builder->GetField(i)));
+        }
       }
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
     }
     RETURN_NOT_OK(builder->Flush(out));
     return Status::OK();
@@ -554,13 +653,16 @@ class ORCFileReader::Impl {
     const int64_t* source = batch->data.data() + offset;
     uint8_t* target = reinterpret_cast<uint8_t*>(builder->data()->mutable_data());
 
+    internal::BitmapWriter writer(target, start, length);
     for (int64_t i = 0; i < length; i++) {
       if (source[i]) {
-        BitUtil::SetBit(target, start + i);
+        writer.Set();
       } else {
-        BitUtil::ClearBit(target, start + i);
+        writer.Clear();
       }
+      writer.Next();
     }
+    writer.Finish();
     return Status::OK();
   }
 
@@ -598,13 +700,61 @@ class ORCFileReader::Impl {
     auto builder = static_cast<builder_type*>(abuilder);
     auto batch = static_cast<liborc::StringVectorBatch*>(cbatch);
 
+    if (length == 0) {
+      return Status::OK();
+    }
     const bool has_nulls = batch->hasNulls;
-    for (int64_t i = offset; i < length + offset; i++) {
-      if (!has_nulls || batch->notNull[i]) {
-        RETURN_NOT_OK(
-            builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+    const char* const* values = batch->data.data() + offset;
+    const int64_t* lengths = batch->length.data() + offset;
+    const uint8_t* valid_bytes = nullptr;
+    if (has_nulls) {
+      valid_bytes = reinterpret_cast<const uint8_t*>(batch->notNull.data()) + offset;
+    }
+
+    // The offsets of the values, nulls being empty. With the direct encoding
+    // the values are contiguous, and then appended at once
+    std::vector<int32_t> offsets(length + 1);
+    offsets[0] = 0;
+    const char* first = nullptr;
+    const char* next = nullptr;
+    bool contiguous = true;
+    int64_t data_length = 0;
+    for (int64_t i = 0; i < length; i++) {
+      const int64_t value_length = (!has_nulls || valid_bytes[i]) ? lengths[i] : 0;
+      if (value_length > 0) {
+        if (first == nullptr) {
+          first = values[i];
+        } else if (values[i] != next) {
+          contiguous = false;
+        }
+        next = values[i] + value_length;
+      }
+      data_length += value_length;
+      if (data_length > std::numeric_limits<int32_t>::max()) {
+        return Status::Invalid("ORC string data of a batch too large for an array");
+      }
+      offsets[i + 1] = static_cast<int32_t>(data_length);
+    }
+
+    if (contiguous) {
+      std::vector<uint8_t> valid_bitmap;
+      if (has_nulls) {
+        valid_bitmap.resize(BitUtil::BytesForBits(length));
+        BytesToBitmap(valid_bytes, length, valid_bitmap.data(), 0);
+      }
+      const uint8_t* data = reinterpret_cast<const uint8_t*>(first ? first : "");
+      return builder->Append(offsets.data(), data, length,
+                             has_nulls ? valid_bitmap.data() : nullptr);
+    }
+
+    // Values from a dictionary
+    RETURN_NOT_OK(builder->Reserve(length));
+    RETURN_NOT_OK(builder->ReserveData(data_length));
+    for (int64_t i = 0; i < length; i++) {
+      if (!has_nulls || valid_bytes[i]) {
+        builder->UnsafeAppend(values[i], offsets[i + 1] - offsets[i]);
       } else {
-        RETURN_NOT_OK(builder->AppendNull());
+        builder->UnsafeAppendNull();
       }
     }
     return Status::OK();
@@ -615,7 +765,24 @@ class ORCFileReader::Impl {
     auto builder = static_cast<FixedSizeBinaryBuilder*>(abuilder);
     auto batch = static_cast<liborc::StringVectorBatch*>(cbatch);
 
+    if (length == 0) {
+      return Status::OK();
+    }
     const bool has_nulls = batch->hasNulls;
+    if (!has_nulls) {
+      // Padded values laid out one after the other are appended at once
+      const int64_t byte_width =
+          static_cast<const FixedSizeBinaryType&>(*builder->type()).byte_width();
+      const char* first = batch->data[offset];
+      bool contiguous = true;
+      for (int64_t i = 0; i < length && contiguous; i++) {
+        contiguous = batch->length[offset + i] == byte_width &&
+                     batch->data[offset + i] == first + i * byte_width;
+      }
+      if (contiguous) {
+        return builder->Append(reinterpret_cast<const uint8_t*>(first), length);
+      }
+    }
     for (int64_t i = offset; i < length + offset; i++) {
       if (!has_nulls || batch->notNull[i]) {
         RETURN_NOT_OK(builder->Append(batch->data[i]));
@@ -657,7 +824,45 @@ class ORCFileReader::Impl {
  private:
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
+  // Held while creating row readers from reader_
+  std::mutex reader_mutex_;
   std::vector<StripeInformation> stripes_;
+  bool use_threads_;
+};
+
+// Reads the selected stripes in order, one at a time
+class StripeRecordBatchReader : public RecordBatchReader {
+ public:
+  StripeRecordBatchReader(ORCFileReader* reader, const std::vector<int64_t>& stripes,
+                          const std::vector<int>* include_indices,
+                          const std::shared_ptr<Schema>& schema)
+      : reader_(reader), stripes_(stripes), next_stripe_(0), schema_(schema) {
+    if (include_indices != nullptr) {
+      include_indices_.reset(new std::vector<int>(*include_indices));
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (next_stripe_ == stripes_.size()) {
+      *batch = nullptr;
+      return Status::OK();
+    }
+    const int64_t stripe = stripes_[next_stripe_++];
+    if (include_indices_) {
+      return reader_->ReadStripe(stripe, *include_indices_, batch);
+    }
+    return reader_->ReadStripe(stripe, batch);
+  }
+
+ private:
+  ORCFileReader* reader_;
+  std::vector<int64_t> stripes_;
+  size_t next_stripe_;
+  // All fields are read if null
+  std::unique_ptr<std::vector<int>> include_indices_;
+  std::shared_ptr<Schema> schema_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -683,6 +888,12 @@ Status ORCFileReader::Read(const std::vector<int>& include_indices,
   return impl_->Read(include_indices, out);
 }
 
+Status ORCFileReader::ReadStripes(const std::vector<int64_t>& stripes,
+                                  const std::vector<int>& include_indices,
+                                  std::shared_ptr<Table>* out) {
+  return impl_->ReadStripes(stripes, include_indices, out);
+}
+
 Status ORCFileReader::ReadStripe(int64_t stripe, std::shared_ptr<RecordBatch>* out) {
   return impl_->ReadStripe(stripe, out);
 }
@@ -692,10 +903,449 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::GetRecordBatchReader(std::shared_ptr<RecordBatchReader>* out) {
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(impl_->ReadSchema(&schema));
+  std::vector<int64_t> stripes(static_cast<size_t>(impl_->NumberOfStripes()));
+  for (size_t stripe = 0; stripe < stripes.size(); ++stripe) {
+    stripes[stripe] = static_cast<int64_t>(stripe);
+  }
+  *out = std::make_shared<StripeRecordBatchReader>(this, stripes, nullptr, schema);
+  return Status::OK();
+}
+
+Status ORCFileReader::GetRecordBatchReader(const std::vector<int64_t>& stripes,
+                                           const std::vector<int>& include_indices,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  RETURN_NOT_OK(impl_->SelectIndices(&opts, include_indices));
+  for (int64_t stripe : stripes) {
+    RETURN_NOT_OK(impl_->SelectStripe(&opts, stripe));
+  }
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(impl_->GetSelectedSchema(opts, &schema));
+  *out =
+      std::make_shared<StripeRecordBatchReader>(this, stripes, &include_indices, schema);
+  return Status::OK();
+}
+
+Status ORCFileReader::SelectStripes(int field_index, int64_t min, int64_t max,
+                                    std::vector<int64_t>* out) {
+  return impl_->SelectStripes<liborc::IntegerColumnStatistics>(field_index, min, max,
+                                                               out);
+}
+
+Status ORCFileReader::SelectStripes(int field_index, double min, double max,
+                                    std::vector<int64_t>* out) {
+  return impl_->SelectStripes<liborc::DoubleColumnStatistics>(field_index, min, max,
+                                                              out);
+}
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+// ----------------------------------------------------------------------
+// ORCFileWriter
+
+class ArrowOutputFile : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputFile(const std::shared_ptr<io::OutputStream>& file)
+      : file_(file), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(file_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<uint64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  void close() override { ORC_THROW_NOT_OK(file_->Close()); }
+
+ private:
+  std::shared_ptr<io::OutputStream> file_;
+  uint64_t length_;
+};
+
+Status GetOrcType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = static_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::LIST: {
+      std::unique_ptr<liborc::Type> element_type;
+      RETURN_NOT_OK(
+          GetOrcType(*static_cast<const ListType&>(type).value_type(), &element_type));
+      *out = liborc::createListType(std::move(element_type));
+      break;
+    }
+    case Type::STRUCT: {
+      *out = liborc::createStructType();
+      for (const auto& field : type.children()) {
+        std::unique_ptr<liborc::Type> field_type;
+        RETURN_NOT_OK(GetOrcType(*field->type(), &field_type));
+        (*out)->addStructField(field->name(), std::move(field_type));
+      }
+      break;
+    }
+    default: {
+      std::stringstream ss;
+      ss << "Writing " << type.ToString() << " to ORC";
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+Status GetOrcCompression(Compression::type compression,
+                         liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::NotImplemented("Compression codec not supported by ORC");
+  }
+  return Status::OK();
+}
+
+template <typename ArrayType, typename BatchType>
+void FillNumericBatch(const Array& array, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch) {
+  const auto values = static_cast<const ArrayType&>(array).raw_values() + offset;
+  auto batch = static_cast<BatchType*>(cbatch);
+  std::copy(values, values + length, batch->data.data());
+}
+
+void FillBooleanBatch(const Array& array, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch) {
+  const auto& boolean_array = static_cast<const BooleanArray&>(array);
+  auto batch = static_cast<liborc::LongVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; ++i) {
+    batch->data[i] = boolean_array.Value(offset + i);
+  }
+}
+
+// The values are not copied, the ORC vector points into the Arrow buffers
+void FillBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = static_cast<const BinaryArray&>(array);
+  auto batch = static_cast<liborc::StringVectorBatch*>(cbatch);
+  for (int64_t i = 0; i < length; ++i) {
+    int32_t value_length = 0;
+    const uint8_t* value = binary_array.GetValue(offset + i, &value_length);
+    batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+    batch->length[i] = value_length;
+  }
+}
+
+void FillFixedSizeBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                              liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = static_cast<const FixedSizeBinaryArray&>(array);
+  auto batch = static_cast<liborc::StringVectorBatch*>(cbatch);
+  const int32_t byte_width = binary_array.byte_width();
+  for (int64_t i = 0; i < length; ++i) {
+    const uint8_t* value = binary_array.GetValue(offset + i);
+    batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+    batch->length[i] = byte_width;
+  }
+}
+
+void FillTimestampBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& timestamp_array = static_cast<const TimestampArray&>(array);
+  const auto& type = static_cast<const TimestampType&>(*array.type());
+  auto batch = static_cast<liborc::TimestampVectorBatch*>(cbatch);
+  int64_t units_per_second = 1;
+  switch (type.unit()) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+  const int64_t* values = timestamp_array.raw_values() + offset;
+  for (int64_t i = 0; i < length; ++i) {
+    // The nanoseconds are non-negative, so the seconds are rounded down
+    int64_t seconds = values[i] / units_per_second;
+    int64_t units = values[i] % units_per_second;
+    if (units < 0) {
+      --seconds;
+      units += units_per_second;
+    }
+    batch->data[i] = seconds;
+    batch->nanoseconds[i] = units * nanos_per_unit;
+  }
+}
+
+void FillDecimalBatch(const Array& array, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch) {
+  const auto& decimal_array = static_cast<const Decimal128Array&>(array);
+  const auto& type = static_cast<const Decimal128Type&>(*array.type());
+  if (type.precision() <= 18) {
+    auto batch = static_cast<liborc::Decimal64VectorBatch*>(cbatch);
+    for (int64_t i = 0; i < length; ++i) {
+      Decimal128 value(decimal_array.GetValue(offset + i));
+      batch->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+  } else {
+    auto batch = static_cast<liborc::Decimal128VectorBatch*>(cbatch);
+    for (int64_t i = 0; i < length; ++i) {
+      Decimal128 value(decimal_array.GetValue(offset + i));
+      batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+  }
+}
+
+// Convert the values [offset, offset + length) of an array
+Status FillBatch(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch) {
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    batch->resize(static_cast<uint64_t>(length));
+  }
+  batch->numElements = static_cast<uint64_t>(length);
+  batch->hasNulls = array.null_count() > 0;
+  if (batch->hasNulls) {
+    for (int64_t i = 0; i < length; ++i) {
+      batch->notNull[i] = array.IsValid(offset + i);
+    }
+  }
+
+  switch (array.type_id()) {
+    case Type::BOOL:
+      FillBooleanBatch(array, offset, length, batch);
+      break;
+    case Type::INT8:
+      FillNumericBatch<Int8Array, liborc::LongVectorBatch>(array, offset, length, batch);
+      break;
+    case Type::INT16:
+      FillNumericBatch<Int16Array, liborc::LongVectorBatch>(array, offset, length, batch);
+      break;
+    case Type::INT32:
+      FillNumericBatch<Int32Array, liborc::LongVectorBatch>(array, offset, length, batch);
+      break;
+    case Type::INT64:
+      FillNumericBatch<Int64Array, liborc::LongVectorBatch>(array, offset, length, batch);
+      break;
+    case Type::DATE32:
+      FillNumericBatch<Date32Array, liborc::LongVectorBatch>(array, offset, length,
+                                                             batch);
+      break;
+    case Type::FLOAT:
+      FillNumericBatch<FloatArray, liborc::DoubleVectorBatch>(array, offset, length,
+                                                              batch);
+      break;
+    case Type::DOUBLE:
+      FillNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(array, offset, length,
+                                                               batch);
+      break;
+    case Type::STRING:
+    case Type::BINARY:
+      FillBinaryBatch(array, offset, length, batch);
+      break;
+    case Type::FIXED_SIZE_BINARY:
+      FillFixedSizeBinaryBatch(array, offset, length, batch);
+      break;
+    case Type::TIMESTAMP:
+      FillTimestampBatch(array, offset, length, batch);
+      break;
+    case Type::DECIMAL:
+      FillDecimalBatch(array, offset, length, batch);
+      break;
+    case Type::STRUCT: {
+      const auto& struct_array = static_cast<const StructArray&>(array);
+      auto struct_batch = static_cast<liborc::StructVectorBatch*>(batch);
+      for (int i = 0; i < struct_array.num_fields(); ++i) {
+        RETURN_NOT_OK(
+            FillBatch(*struct_array.field(i), offset, length, struct_batch->fields[i]));
+      }
+      break;
+    }
+    case Type::LIST: {
+      const auto& list_array = static_cast<const ListArray&>(array);
+      auto list_batch = static_cast<liborc::ListVectorBatch*>(batch);
+      const int64_t values_offset = list_array.value_offset(offset);
+      for (int64_t i = 0; i <= length; ++i) {
+        list_batch->offsets[i] = list_array.value_offset(offset + i) - values_offset;
+      }
+      const int64_t values_length = list_batch->offsets[length];
+      RETURN_NOT_OK(FillBatch(*list_array.values(), values_offset, values_length,
+                              list_batch->elements.get()));
+      break;
+    }
+    default: {
+      std::stringstream ss;
+      ss << "Writing " << array.type()->ToString() << " to ORC";
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema,
+              const std::shared_ptr<io::OutputStream>& file,
+              const ORCWriterOptions& options) {
+    if (options.batch_size <= 0) {
+      return Status::Invalid("ORC writer batch size must be positive");
+    }
+    schema_ = schema;
+    batch_size_ = options.batch_size;
+    RETURN_NOT_OK(GetOrcType(*struct_(schema->fields()), &orc_type_));
+
+    liborc::WriterOptions orc_options;
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetOrcCompression(options.compression, &compression));
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompression(compression);
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+
+    output_.reset(new ArrowOutputFile(file));
+    try {
+      writer_ = liborc::createWriter(*orc_type_, output_.get(), orc_options);
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(batch_size_));
+      auto metadata = schema->metadata();
+      if (metadata) {
+        for (int64_t i = 0; i < metadata->size(); ++i) {
+          writer_->addUserMetadata(metadata->key(i), metadata->value(i));
+        }
+      }
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_)) {
+      return Status::Invalid("Record batch schema differs from the ORC writer schema");
+    }
+    auto struct_batch = static_cast<liborc::StructVectorBatch*>(batch_.get());
+    for (int64_t start = 0; start < batch.num_rows(); start += batch_size_) {
+      const int64_t length = std::min(batch_size_, batch.num_rows() - start);
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        RETURN_NOT_OK(
+            FillBatch(*batch.column(i), start, length, struct_batch->fields[i]));
+      }
+      struct_batch->numElements = static_cast<uint64_t>(length);
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  std::unique_ptr<liborc::Type> orc_type_;
+  std::unique_ptr<ArrowOutputFile> output_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           const std::shared_ptr<io::OutputStream>& file,
+                           const ORCWriterOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, file, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -70,6 +71,18 @@ class ARROW_EXPORT ORCFileReader {
   /// \param[out] out the returned RecordBatch
   Status Read(const std::vector<int>& include_indices, std::shared_ptr<Table>* out);
 
+  /// \brief Read some of the stripes as a Table
+  ///
+  /// The table will be composed of one record batch per stripe, in the given
+  /// order.
+  ///
+  /// \param[in] stripes the stripe indices, for instance from SelectStripes
+  /// \param[in] include_indices the selected field indices to read
+  /// \param[out] out the returned Table
+  Status ReadStripes(const std::vector<int64_t>& stripes,
+                     const std::vector<int>& include_indices,
+                     std::shared_ptr<Table>* out);
+
   /// \brief Read a single stripe as a RecordBatch
   ///
   /// \param[in] stripe the stripe index
@@ -84,6 +97,54 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Read the stripes one record batch at a time
+  ///
+  /// Only one stripe is in memory at once, unlike with Read. The reader must
+  /// not outlive this ORCFileReader.
+  ///
+  /// \param[out] out the returned reader of one record batch per stripe
+  Status GetRecordBatchReader(std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Read some of the stripes one record batch at a time
+  ///
+  /// \param[in] stripes the stripe indices, for instance from SelectStripes
+  /// \param[in] include_indices the selected field indices to read
+  /// \param[out] out the returned reader of one record batch per stripe
+  Status GetRecordBatchReader(const std::vector<int64_t>& stripes,
+                              const std::vector<int>& include_indices,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Select the stripes which may hold values of an integer field in
+  /// the range [min, max], from the statistics of the stripes
+  ///
+  /// Stripes without statistics for the field are always selected.
+  ///
+  /// \param[in] field_index the index of a top-level integer field
+  /// \param[in] min the smallest value of the range
+  /// \param[in] max the largest value of the range
+  /// \param[out] out the indices of the selected stripes, in order
+  Status SelectStripes(int field_index, int64_t min, int64_t max,
+                       std::vector<int64_t>* out);
+
+  /// \brief Select the stripes which may hold values of a floating point
+  /// field in the range [min, max], from the statistics of the stripes
+  ///
+  /// Stripes without statistics for the field are always selected.
+  ///
+  /// \param[in] field_index the index of a top-level floating point field
+  /// \param[in] min the smallest value of the range
+  /// \param[in] max the largest value of the range
+  /// \param[out] out the indices of the selected stripes, in order
+  Status SelectStripes(int field_index, double min, double max,
+                       std::vector<int64_t>* out);
+
+  /// \brief Set whether Read and ReadStripes read the stripes in parallel
+  ///
+  /// The stripes are then read on the CPU thread pool, with one ORC row
+  /// reader each. The input file must support concurrent ReadAt calls.
+  /// Default false.
+  void set_use_threads(bool use_threads);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -96,6 +157,68 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options of an ORCFileWriter
+struct ARROW_EXPORT ORCWriterOptions {
+  ORCWriterOptions()
+      : stripe_size(64 << 20),
+        compression(Compression::GZIP),
+        compression_block_size(64 << 10),
+        batch_size(1 << 16) {}
+
+  /// The size of the stripes in bytes, before compression
+  int64_t stripe_size;
+
+  /// The codec of the streams: UNCOMPRESSED, GZIP (ORC's ZLIB), SNAPPY, LZO,
+  /// LZ4 or ZSTD
+  Compression::type compression;
+
+  /// The size of the compressed chunks in bytes
+  int64_t compression_block_size;
+
+  /// The number of rows converted to ORC column vectors at once
+  int64_t batch_size;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow RecordBatches to an ORC file.
+///
+/// Boolean, integer, floating point, date32, timestamp, decimal, string,
+/// binary and fixed size binary columns are supported, as well as lists and
+/// structs of them. Fixed size binary values are written as ORC binary.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Create a new ORC writer
+  ///
+  /// \param[in] schema the schema of the record batches to write. Its
+  /// metadata is written as the user metadata of the file
+  /// \param[in] file the output stream, closed by Close
+  /// \param[in] options the writer options
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     const std::shared_ptr<io::OutputStream>& file,
+                     const ORCWriterOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Append the rows of a record batch to the file
+  ///
+  /// Stripes are written as they fill up, not one per record batch.
+  ///
+  /// \param[in] batch a record batch of the schema of the writer
+  /// \return Status
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write the last stripe and the file footer, and close the file
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
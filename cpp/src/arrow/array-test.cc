@@ -17,6 +17,7 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <vector>
@@ -26,9 +27,11 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/compare.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
@@ -65,6 +68,101 @@ TEST_F(TestArray, TestLength) {
   ASSERT_EQ(arr->length(), 100);
 }
 
+// Arrays of 1000 slots, with nulls scattered and in long stretches, sliced
+// after `prefix` leading slots. The valid slot at `changed` differs from the
+// other arrays, and the data under the null slots depends on the prefix.
+void MakeEqualsTestArrays(int64_t prefix, int64_t changed,
+                          std::vector<std::shared_ptr<Array>>* out) {
+  const int64_t length = prefix + 1000;
+  Int32Builder ints;
+  StringBuilder strings;
+  ListBuilder lists(default_memory_pool(),
+                    std::unique_ptr<ArrayBuilder>(new Int32Builder()));
+  auto& list_values = static_cast<Int32Builder&>(*lists.value_builder());
+  vector<uint8_t> valid_bytes;
+  for (int64_t j = 0; j < length; ++j) {
+    const int64_t i = j - prefix;
+    const bool is_valid = i < 0 || (i % 7 != 3 && (i < 300 || i >= 420));
+    const auto value = static_cast<int32_t>(is_valid ? i + (i == changed) : j);
+    valid_bytes.push_back(is_valid);
+    if (is_valid) {
+      ASSERT_OK(ints.Append(value));
+      ASSERT_OK(strings.Append(std::to_string(value)));
+      ASSERT_OK(lists.Append());
+      for (int32_t k = 0; k < value % 4; ++k) {
+        ASSERT_OK(list_values.Append(value + k));
+      }
+    } else {
+      ASSERT_OK(ints.Append(value));
+      ASSERT_OK(strings.AppendNull());
+      ASSERT_OK(lists.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> int_array, string_array, list_array;
+  ASSERT_OK(ints.Finish(&int_array));
+  ASSERT_OK(strings.Finish(&string_array));
+  ASSERT_OK(lists.Finish(&list_array));
+  // Give the ints the nulls of the others
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(BitUtil::BytesToBits(valid_bytes, default_memory_pool(), &null_bitmap));
+  int_array = std::make_shared<Int32Array>(length, int_array->data()->buffers[1],
+                                           null_bitmap, string_array->null_count());
+
+  auto type =
+      struct_({field("i", int32()), field("s", utf8()), field("l", list(int32()))});
+  std::shared_ptr<Array> struct_array = std::make_shared<StructArray>(
+      type, length, ArrayVector{int_array, string_array, list_array}, null_bitmap,
+      string_array->null_count());
+  out->clear();
+  for (const std::shared_ptr<Array>& array :
+       {int_array, string_array, list_array, struct_array}) {
+    out->push_back(array->Slice(prefix));
+  }
+}
+
+TEST_F(TestArray, EqualsWithNulls) {
+  vector<std::shared_ptr<Array>> arrays, sliced, changed, changed_late;
+  MakeEqualsTestArrays(0, -1, &arrays);
+  MakeEqualsTestArrays(13, -1, &sliced);
+  MakeEqualsTestArrays(5, 600, &changed);
+  MakeEqualsTestArrays(0, 999, &changed_late);
+
+  for (size_t k = 0; k < arrays.size(); ++k) {
+    ASSERT_TRUE(arrays[k]->Equals(sliced[k])) << k;
+    ASSERT_FALSE(arrays[k]->Equals(changed[k])) << k;
+    ASSERT_FALSE(arrays[k]->Equals(changed_late[k])) << k;
+    ASSERT_TRUE(arrays[k]->RangeEquals(0, 600, 0, changed[k])) << k;
+    ASSERT_TRUE(arrays[k]->RangeEquals(601, 1000, 601, changed[k])) << k;
+    ASSERT_FALSE(arrays[k]->RangeEquals(550, 700, 550, changed[k])) << k;
+    ASSERT_TRUE(arrays[k]->RangeEquals(70, 900, 70, sliced[k])) << k;
+    ASSERT_TRUE(arrays[k]->Slice(5, 990)->Equals(sliced[k]->Slice(5, 990))) << k;
+    // The validity bitmaps differ once shifted
+    ASSERT_FALSE(arrays[k]->RangeEquals(100, 200, 101, sliced[k])) << k;
+  }
+}
+
+TEST_F(TestArray, HashWithNulls) {
+  vector<std::shared_ptr<Array>> arrays, sliced, changed;
+  MakeEqualsTestArrays(0, -1, &arrays);
+  MakeEqualsTestArrays(13, -1, &sliced);
+  MakeEqualsTestArrays(5, 600, &changed);
+
+  for (size_t k = 0; k < arrays.size(); ++k) {
+    uint64_t hash, sliced_hash, changed_hash;
+    ASSERT_OK(ArrayHash(*arrays[k], &hash));
+    ASSERT_OK(ArrayHash(*sliced[k], &sliced_hash));
+    ASSERT_OK(ArrayHash(*changed[k], &changed_hash));
+    ASSERT_EQ(hash, sliced_hash) << k;
+    ASSERT_NE(hash, changed_hash) << k;
+
+    // Chunks of the same values hash like the array
+    ChunkedArray chunked({arrays[k]->Slice(0, 300), arrays[k]->Slice(300, 0),
+                          sliced[k]->Slice(300)});
+    ASSERT_OK(ChunkedArrayHash(chunked, &sliced_hash));
+    ASSERT_EQ(hash, sliced_hash) << k;
+  }
+}
+
 Status MakeArrayFromValidBytes(const vector<uint8_t>& v, MemoryPool* pool,
                                std::shared_ptr<Array>* out) {
   int64_t null_count = v.size() - std::accumulate(v.begin(), v.end(), 0);
@@ -148,6 +246,43 @@ TEST_F(TestArray, NullArraySliceNullCount) {
   ASSERT_EQ(6, null_arr_sliced->null_count());
 }
 
+TEST_F(TestArray, ArrayView) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true, true, false, true},
+                                      {0, 1, 2, 3, 4, 5}, &array);
+  std::shared_ptr<Array> sliced = array->Slice(1);
+
+  ArrayView view(*sliced, 1, 3);
+  ASSERT_EQ(1, view.offset());
+  ASSERT_EQ(3, view.length());
+  ASSERT_EQ(&view.data(), sliced->data().get());
+  ASSERT_FALSE(view.IsNull(0));
+  ASSERT_TRUE(view.IsNull(2));
+  ASSERT_EQ(2, view.GetValues<int32_t>(1)[0]);
+  ASSERT_EQ(3, view.GetValues<int32_t>(1)[1]);
+  ASSERT_TRUE(view.ToArray()->Equals(array->Slice(2, 3)));
+
+  // Ranges are clamped like slices
+  ASSERT_EQ(2, view.Slice(1, 10).length());
+  ASSERT_EQ(0, view.Slice(5, 1).length());
+  ASSERT_EQ(1, ArrayView(*array, 5, 10).length());
+  ASSERT_EQ(0, ArrayView(*array, 7, 1).length());
+
+  std::shared_ptr<Array> other;
+  ArrayFromVector<Int32Type, int32_t>({false, true, true, false}, {9, 2, 3, 9}, &other);
+  ASSERT_TRUE(ArrayEquals(view, ArrayView(*other, 1, 3)));
+  ASSERT_FALSE(ArrayEquals(view, ArrayView(*other, 1, 2)));
+  ASSERT_FALSE(ArrayEquals(view, ArrayView(*other, 0, 3)));
+  // Different windows of the same array
+  ASSERT_TRUE(ArrayEquals(view, ArrayView(*array, 2, 3)));
+  ASSERT_FALSE(ArrayEquals(view, ArrayView(*array, 1, 3)));
+  ASSERT_TRUE(ArrayEquals(view.Slice(1, 0), ArrayView(*array, 0, 0)));
+
+  std::shared_ptr<Array> floats;
+  ArrayFromVector<FloatType, float>({true, true, true}, {2, 3, 4}, &floats);
+  ASSERT_FALSE(ArrayEquals(ArrayView(*array, 2, 2), ArrayView(*floats, 0, 2)));
+}
+
 TEST_F(TestArray, TestIsNullIsValid) {
   // clang-format off
   vector<uint8_t> null_bitmap = {1, 0, 1, 1, 0, 1, 0, 0,
@@ -208,6 +343,64 @@ TEST_F(TestBuilder, TestReserve) {
   ASSERT_EQ(4, builder.null_bitmap()->size());
 }
 
+TEST_F(TestBuilder, AppendArraySlice) {
+  std::vector<std::shared_ptr<RecordBatch>> batches(7);
+  ASSERT_OK(ipc::MakeBooleanBatch(&batches[0]));
+  ASSERT_OK(ipc::MakeStringTypesRecordBatch(&batches[1]));
+  ASSERT_OK(ipc::MakeStruct(&batches[2]));
+  ASSERT_OK(ipc::MakeTimestamps(&batches[3]));
+  ASSERT_OK(ipc::MakeFWBinary(&batches[4]));
+  ASSERT_OK(ipc::MakeDecimal(&batches[5]));
+  ASSERT_OK(ipc::MakeNullRecordBatch(&batches[6]));
+
+  for (const auto& batch : batches) {
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      // Append a sliced array in two ranges, the offsets of the second one
+      // being rebased onto the values of the first
+      auto array = batch->column(i)->Slice(3);
+      const int64_t half = array->length() / 2;
+      std::unique_ptr<ArrayBuilder> builder;
+      ASSERT_OK(MakeBuilder(pool_, array->type(), &builder));
+      ASSERT_OK(builder->AppendArraySlice(*array->data(), 1, half));
+      ASSERT_OK(builder->AppendArraySlice(*array->data(), half + 1,
+                                          array->length() - half - 1));
+      std::shared_ptr<Array> result;
+      ASSERT_OK(builder->Finish(&result));
+      ASSERT_OK(ValidateArray(*result));
+      auto expected = array->Slice(1);
+      ASSERT_ARRAYS_EQUAL(*expected, *result);
+    }
+  }
+}
+
+TEST_F(TestBuilder, AppendArraySliceLargeTypes) {
+  LargeListBuilder list_builder(pool_, std::unique_ptr<ArrayBuilder>(
+                                           new LargeStringBuilder(pool_)));
+  auto value_builder = static_cast<LargeStringBuilder*>(list_builder.value_builder());
+  for (int i = 0; i < 10; ++i) {
+    const bool is_valid = i % 4 != 0;
+    ASSERT_OK(list_builder.Append(is_valid));
+    for (int j = 0; is_valid && j < i % 3; ++j) {
+      ASSERT_OK(value_builder->Append(std::string(i + j, static_cast<char>('a' + j))));
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(list_builder.Finish(&array));
+
+  ASSERT_OK(list_builder.AppendArraySlice(*array->data(), 2, 5));
+  ASSERT_OK(list_builder.AppendArraySlice(*array->data(), 9, 1));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(list_builder.Finish(&result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_TRUE(result->Slice(0, 5)->Equals(array->Slice(2, 5)));
+  ASSERT_TRUE(result->Slice(5)->Equals(array->Slice(9)));
+
+  ASSERT_RAISES(Invalid, list_builder.AppendArraySlice(*array->data(), 8, 3));
+  ASSERT_RAISES(Invalid, list_builder.AppendArraySlice(*array->data(), -1, 1));
+  Int32Builder int_builder(pool_);
+  ASSERT_RAISES(Invalid, int_builder.AppendArraySlice(*array->data(), 0, 1));
+}
+
 template <typename Attrs>
 class TestPrimitiveBuilder : public TestBuilder {
  public:
@@ -707,6 +900,43 @@ TYPED_TEST(TestPrimitiveBuilder, TestReserve) {
   ASSERT_EQ(BitUtil::NextPower2(kMinBuilderCapacity + 100), this->builder_->capacity());
 }
 
+TEST(TestPrimitiveBuilderAdopting, FinishAdopting) {
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  auto values_buffer = std::make_shared<Buffer>(
+      reinterpret_cast<const uint8_t*>(values.data()), values.size() * sizeof(int32_t));
+  std::shared_ptr<Buffer> null_bitmap;
+  std::vector<bool> is_valid = {true, false, true, true, false};
+  ASSERT_OK(test::GetBitmapFromVector(is_valid, &null_bitmap));
+
+  // Nothing appended yet: the buffers are adopted as they are
+  Int32Builder builder;
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder.FinishAdopting(values_buffer, 5, null_bitmap, &out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_EQ(2, out->null_count());
+  ASSERT_EQ(values_buffer.get(), out->data()->buffers[1].get());
+  ASSERT_EQ(null_bitmap.get(), out->null_bitmap().get());
+  ASSERT_EQ(0, builder.length());
+
+  ASSERT_OK(builder.FinishAdopting(values_buffer, 3, nullptr, &out));
+  ASSERT_EQ(0, out->null_count());
+  ASSERT_EQ(values_buffer.get(), out->data()->buffers[1].get());
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *out);
+
+  // Pending values: the buffers are appended
+  ASSERT_OK(builder.Append(0));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.FinishAdopting(values_buffer, 5, null_bitmap, &out));
+  ArrayFromVector<Int32Type, int32_t>({true, false, true, false, true, true, false},
+                                      {0, 0, 1, 2, 3, 4, 5}, &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *out);
+  ASSERT_EQ(0, builder.length());
+
+  ASSERT_RAISES(Invalid, builder.FinishAdopting(values_buffer, 6, nullptr, &out));
+}
+
 TEST(TestBooleanBuilder, TestStdBoolVectorAppend) {
   BooleanBuilder builder;
   BooleanBuilder builder_nn;
@@ -994,6 +1224,56 @@ TEST_F(TestStringBuilder, TestZeroLength) {
   Done();
 }
 
+TEST_F(TestStringBuilder, TestUnsafeAppend) {
+  vector<string> strings = {"", "bb", "a", "", "ccc"};
+  vector<bool> is_valid = {true, true, true, false, true};
+
+  ASSERT_OK(builder_->Reserve(5));
+  ASSERT_OK(builder_->ReserveData(6));
+  const int64_t data_capacity = builder_->value_data_capacity();
+  for (size_t i = 0; i < strings.size(); ++i) {
+    if (is_valid[i]) {
+      builder_->UnsafeAppend(strings[i]);
+    } else {
+      builder_->UnsafeAppendNull();
+    }
+  }
+  ASSERT_EQ(data_capacity, builder_->value_data_capacity());
+  Done();
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<StringType, string>(is_valid, strings, &expected);
+  ASSERT_TRUE(result_->Equals(*expected));
+}
+
+TEST_F(TestStringBuilder, TestAppendBulk) {
+  vector<string> strings = {"a", "bb", "", "ccc", "dddd", "", "e", "ff", "ggg", "h"};
+  vector<bool> is_valid = {true, true, false, true, true, true, false, true, true, true};
+
+  std::shared_ptr<Array> values;
+  ArrayFromVector<StringType, string>(is_valid, strings, &values);
+
+  // Bulk append a slice at unaligned offsets, after scalar appends
+  std::shared_ptr<Array> sliced = values->Slice(3, 6);
+  const auto& slice = static_cast<const StringArray&>(*sliced);
+  ASSERT_OK(builder_->Append("xyz"));
+  ASSERT_OK(builder_->AppendNull());
+  ASSERT_OK(builder_->Append(slice.raw_value_offsets(), slice.value_data()->data(),
+                             slice.length(), slice.null_bitmap_data(), slice.offset()));
+  // Without a validity bitmap
+  ASSERT_OK(builder_->Append(slice.raw_value_offsets(), slice.value_data()->data(), 2));
+  Done();
+
+  vector<string> expected_strings = {"xyz", "", "ccc", "dddd", "", "", "ff", "ggg",
+                                     "ccc", "dddd"};
+  vector<bool> expected_valid = {true, false, true, true, true, false,
+                                 true, true,  true, true};
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<StringType, string>(expected_valid, expected_strings, &expected);
+  ASSERT_EQ(2, result_->null_count());
+  ASSERT_TRUE(result_->Equals(*expected));
+}
+
 // Binary container type
 // TODO(emkornfield) there should be some way to refactor these to avoid code duplicating
 // with String
@@ -1570,6 +1850,48 @@ TEST_F(TestAdaptiveIntBuilder, TestAppendVector) {
   ASSERT_TRUE(expected_->Equals(result_));
 }
 
+TEST_F(TestAdaptiveIntBuilder, TestAppendVectorWidths) {
+  // The bounds of each width, then the values just past them
+  std::vector<int64_t> bounds = {127, -128, 32767, -32768, 2147483647, -2147483648LL};
+  std::vector<int64_t> past_bounds = {128, -129, 32768, -32769, 2147483648LL,
+                                      -2147483649LL};
+  std::vector<std::shared_ptr<DataType>> types = {int8(), int16(), int32(), int64()};
+
+  auto value = [](const Array& array, int64_t i) -> int64_t {
+    switch (array.type_id()) {
+      case Type::INT8:
+        return static_cast<const Int8Array&>(array).Value(i);
+      case Type::INT16:
+        return static_cast<const Int16Array&>(array).Value(i);
+      case Type::INT32:
+        return static_cast<const Int32Array&>(array).Value(i);
+      default:
+        return static_cast<const Int64Array&>(array).Value(i);
+    }
+  };
+
+  for (size_t width = 0; width < types.size(); ++width) {
+    for (size_t sign = 0; sign < 2; ++sign) {
+      std::vector<int64_t> block(bounds.begin(), bounds.begin() + 2 * width);
+      if (width > 0) {
+        block.push_back(past_bounds[2 * (width - 1) + sign]);
+      }
+      // Nulls never widen, whatever their values
+      block.push_back(std::numeric_limits<int64_t>::min());
+      std::vector<uint8_t> valid_bytes(block.size(), 1);
+      valid_bytes.back() = 0;
+
+      ASSERT_OK(builder_->Append(block.data(), block.size(), valid_bytes.data()));
+      Done();
+      ASSERT_TRUE(result_->type()->Equals(*types[width]));
+      ASSERT_EQ(1, result_->null_count());
+      for (size_t i = 0; i + 1 < block.size(); ++i) {
+        ASSERT_EQ(block[i], value(*result_, i));
+      }
+    }
+  }
+}
+
 class TestAdaptiveUIntBuilder : public TestBuilder {
  public:
   void SetUp() {
@@ -1655,6 +1977,24 @@ TEST_F(TestAdaptiveUIntBuilder, TestUInt64) {
   ASSERT_TRUE(expected_->Equals(result_));
 }
 
+TEST_F(TestAdaptiveUIntBuilder, TestAppendVectorWidths) {
+  const uint64_t kNullValue = std::numeric_limits<uint64_t>::max();
+  std::vector<uint8_t> valid_bytes = {1, 1, 0};
+  std::vector<std::pair<uint64_t, std::shared_ptr<DataType>>> cases = {
+      {255, uint8()},
+      {256, uint16()},
+      {65536, uint32()},
+      {static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1, uint64()}};
+
+  for (const auto& c : cases) {
+    std::vector<uint64_t> block = {0, c.first, kNullValue};
+    ASSERT_OK(builder_->Append(block.data(), block.size(), valid_bytes.data()));
+    Done();
+    ASSERT_TRUE(result_->type()->Equals(*c.second));
+    ASSERT_EQ(1, result_->null_count());
+  }
+}
+
 TEST_F(TestAdaptiveUIntBuilder, TestAppendVector) {
   std::vector<uint64_t> expected_values(
       {0, static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1});
@@ -2129,6 +2469,63 @@ TEST(TestStringDictionaryBuilder, BigDeltaDictionary) {
   ASSERT_TRUE(expected3.Equals(result3));
 }
 
+// Decode the strings of successive dictionary batches, each carrying a delta
+// of the memo accumulated in the given dictionary
+static void DecodeDeltaBatch(const Array& batch, std::vector<std::string>* memo,
+                             std::vector<std::string>* out) {
+  const auto& dict_array = static_cast<const DictionaryArray&>(batch);
+  const auto& delta = static_cast<const StringArray&>(*dict_array.dictionary());
+  for (int64_t i = 0; i < delta.length(); ++i) {
+    memo->push_back(delta.GetString(i));
+  }
+  const Array& indices = *dict_array.indices();
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    int64_t index;
+    switch (indices.type_id()) {
+      case Type::INT8:
+        index = static_cast<const Int8Array&>(indices).Value(i);
+        break;
+      case Type::INT16:
+        index = static_cast<const Int16Array&>(indices).Value(i);
+        break;
+      default:
+        index = static_cast<const Int32Array&>(indices).Value(i);
+        break;
+    }
+    out->push_back(memo->at(index));
+  }
+}
+
+TEST(TestStringDictionaryBuilder, DeltaDictionaryGrowsMemo) {
+  StringDictionaryBuilder builder(default_memory_pool());
+  std::vector<std::string> memo;
+
+  std::vector<std::string> batch1;
+  for (int i = 0; i < 100; ++i) {
+    batch1.push_back("a" + std::to_string(i));
+  }
+  // Previous entries interleaved with enough new ones to grow the hash table
+  std::vector<std::string> batch2;
+  for (int i = 0; i < 3000; ++i) {
+    batch2.push_back("b" + std::to_string(i));
+    batch2.push_back(batch1[i % batch1.size()]);
+  }
+
+  for (const auto& batch : {batch1, batch2, batch2}) {
+    for (const auto& value : batch) {
+      ASSERT_OK(builder.Append(value));
+    }
+    std::shared_ptr<Array> result;
+    ASSERT_OK(builder.Finish(&result));
+
+    std::vector<std::string> decoded;
+    DecodeDeltaBatch(*result, &memo, &decoded);
+    ASSERT_EQ(batch, decoded);
+  }
+  // Each distinct value was sent once
+  ASSERT_EQ(3100, memo.size());
+}
+
 TEST(TestFixedSizeBinaryDictionaryBuilder, Basic) {
   // Build the dictionary Array
   DictionaryBuilder<FixedSizeBinaryType> builder(arrow::fixed_size_binary(4),
@@ -2611,6 +3008,362 @@ TEST_F(TestListArray, TestZeroLength) {
   // All buffers are null
   Done();
   ASSERT_OK(ValidateArray(*result_));
+  ASSERT_EQ(0, result_->Flatten()->length());
+}
+
+TEST_F(TestListArray, Flatten) {
+  std::shared_ptr<Array> offsets, values, out;
+  ArrayFromVector<Int32Type, int32_t>({0, 2, 2, 3, 5}, &offsets);
+  ArrayFromVector<Int16Type, int16_t>({1, 2, 3, 4, 5, 6}, &values);
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, pool_, &out));
+  const auto& lists = static_cast<const ListArray&>(*out);
+
+  // The values past the last list are sliced off, the others shared
+  std::shared_ptr<Array> flattened = lists.Flatten();
+  ASSERT_TRUE(flattened->Equals(values->Slice(0, 5)));
+  ASSERT_EQ(values->data()->buffers[1], flattened->data()->buffers[1]);
+
+  std::shared_ptr<Array> sliced = lists.Slice(2, 1);
+  const auto& slice = static_cast<const ListArray&>(*sliced);
+  ASSERT_TRUE(slice.Flatten()->Equals(values->Slice(2, 1)));
+  ASSERT_EQ(0, static_cast<const ListArray&>(*lists.Slice(1, 1)).Flatten()->length());
+}
+
+// ----------------------------------------------------------------------
+// Large binary, string and list tests
+
+TEST(TestLargeBinaryArray, Basics) {
+  LargeStringBuilder builder;
+  ASSERT_OK(builder.Append("foo"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(""));
+  ASSERT_OK(builder.Reserve(1));
+  ASSERT_OK(builder.ReserveData(4));
+  builder.UnsafeAppend(reinterpret_cast<const uint8_t*>("quux"), 4);
+  int64_t length = 0;
+  ASSERT_EQ(0, std::memcmp(builder.GetValue(0, &length), "foo", 3));
+  ASSERT_EQ(3, length);
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_TRUE(out->type()->Equals(large_utf8()));
+  const auto& strings = static_cast<const LargeStringArray&>(*out);
+  ASSERT_EQ(4, strings.length());
+  ASSERT_EQ(1, strings.null_count());
+  ASSERT_EQ("foo", strings.GetString(0));
+  ASSERT_EQ("quux", strings.GetString(3));
+  ASSERT_EQ(3, strings.value_offset(2));
+  ASSERT_EQ(4, strings.value_length(3));
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<LargeStringType, std::string>({true, false, true, true},
+                                                {"foo", "", "", "quux"}, &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *out);
+  ASSERT_TRUE(out->Slice(1)->Equals(expected->Slice(1)));
+  ASSERT_TRUE(out->RangeEquals(1, 4, 1, expected));
+
+  // Same values, other type
+  std::shared_ptr<Array> binary_values;
+  ArrayFromVector<LargeBinaryType, std::string>({true, false, true, true},
+                                                {"foo", "", "", "quux"}, &binary_values);
+  ASSERT_FALSE(out->Equals(binary_values));
+  ArrayFromVector<LargeStringType, std::string>({true, false, true, true},
+                                                {"foo", "", "", "quuz"}, &expected);
+  ASSERT_FALSE(out->Equals(expected));
+  ASSERT_TRUE(out->RangeEquals(0, 3, 0, expected));
+
+  uint64_t hash = 0, expected_hash = 0;
+  ASSERT_OK(ArrayHash(*out->Slice(1, 2), &hash));
+  ASSERT_OK(ArrayHash(*expected->Slice(1, 2), &expected_hash));
+  ASSERT_EQ(expected_hash, hash);
+}
+
+TEST(TestLargeListArray, Basics) {
+  LargeListBuilder builder(default_memory_pool(),
+                           std::unique_ptr<ArrayBuilder>(new Int32Builder()));
+  auto values = static_cast<Int32Builder*>(builder.value_builder());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(values->Append(1));
+  ASSERT_OK(values->Append(2));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(builder.Append());
+  ASSERT_OK(values->Append(3));
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_TRUE(out->type()->Equals(large_list(int32())));
+
+  const auto& lists = static_cast<const LargeListArray&>(*out);
+  ASSERT_EQ(4, lists.length());
+  ASSERT_EQ(1, lists.null_count());
+  ASSERT_EQ(2, lists.value_length(0));
+  ASSERT_EQ(0, lists.value_length(2));
+  ASSERT_EQ(2, lists.value_offset(3));
+  ASSERT_TRUE(lists.value_type()->Equals(int32()));
+
+  // Null offsets are replaced by the next valid one
+  std::shared_ptr<Array> offsets, list_values, from_arrays;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true, true, true}, {0, 0, 2, 2, 3},
+                                      &offsets);
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &list_values);
+  ASSERT_OK(LargeListArray::FromArrays(*offsets, *list_values, default_memory_pool(),
+                                       &from_arrays));
+  ASSERT_OK(ValidateArray(*from_arrays));
+  ASSERT_ARRAYS_EQUAL(*out, *from_arrays);
+  ASSERT_TRUE(out->Slice(2)->Equals(from_arrays->Slice(2)));
+
+  std::shared_ptr<Array> int32_offsets;
+  ArrayFromVector<Int32Type, int32_t>({0, 2, 2, 2, 3}, &int32_offsets);
+  ASSERT_RAISES(Invalid, LargeListArray::FromArrays(*int32_offsets, *list_values,
+                                                    default_memory_pool(), &from_arrays));
+
+  // Same lists, other values
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 4}, &list_values);
+  ASSERT_OK(LargeListArray::FromArrays(*offsets, *list_values, default_memory_pool(),
+                                       &from_arrays));
+  ASSERT_FALSE(out->Equals(from_arrays));
+  ASSERT_TRUE(out->RangeEquals(0, 3, 0, from_arrays));
+
+  std::shared_ptr<Array> concatenated;
+  ASSERT_OK(Concatenate({out->Slice(0, 1), out->Slice(1)}, default_memory_pool(),
+                        &concatenated));
+  ASSERT_OK(ValidateArray(*concatenated));
+  ASSERT_ARRAYS_EQUAL(*out, *concatenated);
+}
+
+TEST(TestStringViewArray, Basics) {
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append("foo"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append("a string of over 12 bytes"));
+  ASSERT_OK(builder.Append("twelve bytes"));
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_TRUE(out->type()->Equals(utf8_view()));
+
+  const auto& strings = static_cast<const StringViewArray&>(*out);
+  ASSERT_EQ(4, strings.length());
+  ASSERT_EQ(1, strings.null_count());
+  ASSERT_EQ(1, strings.num_data_buffers());
+  ASSERT_EQ("foo", strings.GetString(0));
+  ASSERT_EQ("a string of over 12 bytes", strings.GetString(2));
+  ASSERT_EQ("twelve bytes", strings.GetString(3));
+  ASSERT_TRUE(strings.GetView(0).is_inline());
+  ASSERT_FALSE(strings.GetView(2).is_inline());
+  ASSERT_TRUE(strings.GetView(3).is_inline());
+  ASSERT_EQ(0, std::memcmp(strings.GetView(2).ref.prefix, "a st", 4));
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<StringViewType, std::string>(
+      {true, false, true, true}, {"foo", "", "a string of over 12 bytes", "twelve bytes"},
+      &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *out);
+  ASSERT_TRUE(out->Slice(1)->Equals(expected->Slice(1)));
+  ASSERT_TRUE(out->RangeEquals(1, 4, 1, expected));
+
+  // Same prefixes, other strings
+  ArrayFromVector<StringViewType, std::string>(
+      {true, false, true, true}, {"foo", "", "a string of over 13 bytes", "twelve bytez"},
+      &expected);
+  ASSERT_FALSE(out->Equals(expected));
+  ASSERT_FALSE(out->RangeEquals(2, 3, 2, expected));
+  ASSERT_FALSE(out->RangeEquals(3, 4, 3, expected));
+  ASSERT_TRUE(out->RangeEquals(0, 2, 0, expected));
+
+  uint64_t hash = 0, expected_hash = 0;
+  ASSERT_OK(ArrayHash(*out->Slice(0, 2), &hash));
+  ASSERT_OK(ArrayHash(*expected->Slice(0, 2), &expected_hash));
+  ASSERT_EQ(expected_hash, hash);
+
+  // Entries pointing past their data buffer
+  auto data = out->data()->Copy();
+  data->buffers.resize(2);
+  ASSERT_RAISES(Invalid, ValidateArray(*MakeArray(data)));
+}
+
+TEST(TestStringViewArray, DataBlocks) {
+  const std::string long_string(StringViewBuilder::kDataBlockSize / 2 + 1, 'x');
+  StringViewBuilder builder;
+  ASSERT_OK(builder.Append(long_string));
+  ASSERT_OK(builder.Append("short"));
+  ASSERT_OK(builder.Append(long_string + "y"));
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+
+  const auto& strings = static_cast<const StringViewArray&>(*out);
+  ASSERT_EQ(2, strings.num_data_buffers());
+  ASSERT_EQ(1, strings.GetView(2).ref.buffer_index);
+  ASSERT_EQ(long_string + "y", strings.GetString(2));
+
+  // The data buffers are shared, the buffer indices shifted
+  std::shared_ptr<Array> concatenated;
+  ASSERT_OK(Concatenate({out->Slice(1), out}, default_memory_pool(), &concatenated));
+  ASSERT_OK(ValidateArray(*concatenated));
+  const auto& result = static_cast<const StringViewArray&>(*concatenated);
+  ASSERT_EQ(4, result.num_data_buffers());
+  ASSERT_EQ(5, result.length());
+  ASSERT_EQ(long_string + "y", result.GetString(1));
+  ASSERT_EQ(long_string, result.GetString(2));
+  ASSERT_EQ(long_string + "y", result.GetString(4));
+  ASSERT_TRUE(concatenated->Slice(2)->Equals(out));
+}
+
+// ----------------------------------------------------------------------
+// Run-length encoded tests
+
+class TestRunLengthEncodedArray : public TestBuilder {
+ public:
+  void SetUp() {
+    TestBuilder::SetUp();
+
+    type_ = run_length_encoded(int32());
+
+    std::unique_ptr<ArrayBuilder> tmp;
+    ASSERT_OK(MakeBuilder(pool_, type_, &tmp));
+    builder_.reset(static_cast<RunLengthEncodedBuilder*>(tmp.release()));
+  }
+
+  // Runs of 5 times 1, 3 nulls and 2 times 7
+  void AppendRuns() {
+    auto vb = static_cast<Int32Builder*>(builder_->value_builder());
+    ASSERT_OK(vb->Append(1));
+    ASSERT_OK(builder_->AppendRun(5));
+    ASSERT_OK(vb->AppendNull());
+    ASSERT_OK(builder_->AppendRun(3));
+    ASSERT_OK(vb->Append(7));
+    ASSERT_OK(builder_->AppendRun(2));
+  }
+
+ protected:
+  std::shared_ptr<RunLengthEncodedBuilder> builder_;
+};
+
+TEST_F(TestRunLengthEncodedArray, TestBasics) {
+  AppendRuns();
+  ASSERT_EQ(10, builder_->length());
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder_->Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  const auto& result = static_cast<const RunLengthEncodedArray&>(*out);
+
+  ASSERT_EQ(10, result.length());
+  ASSERT_EQ(0, result.null_count());
+  ASSERT_EQ(3, result.num_runs());
+  ASSERT_EQ(0, result.first_run());
+  ASSERT_TRUE(result.value_type()->Equals(int32()));
+
+  std::shared_ptr<Array> expected_values;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {1, 0, 7}, &expected_values);
+  test::AssertArraysEqual(*expected_values, *result.values());
+
+  ASSERT_EQ(0, result.FindRun(0));
+  ASSERT_EQ(0, result.FindRun(4));
+  ASSERT_EQ(1, result.FindRun(5));
+  ASSERT_EQ(2, result.FindRun(9));
+  ASSERT_EQ(5, result.run_length(0));
+  ASSERT_EQ(3, result.run_length(1));
+
+  // Slices clip the runs they cut
+  auto slice = std::static_pointer_cast<RunLengthEncodedArray>(result.Slice(3, 4));
+  ASSERT_OK(ValidateArray(*slice));
+  ASSERT_EQ(0, slice->first_run());
+  ASSERT_EQ(2, slice->num_runs());
+  ASSERT_EQ(2, slice->run_length(0));
+  ASSERT_EQ(2, slice->run_length(1));
+  ASSERT_EQ(1, slice->FindRun(3));
+
+  // Each run must have exactly one value
+  ASSERT_RAISES(Invalid, builder_->AppendRun(1));
+  ASSERT_RAISES(Invalid, builder_->AppendRun(0));
+}
+
+TEST_F(TestRunLengthEncodedArray, TestFromArrays) {
+  std::shared_ptr<Array> run_ends, values, out;
+  ArrayFromVector<Int32Type, int32_t>({5, 8, 10}, &run_ends);
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {1, 0, 7}, &values);
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values, &out));
+  ASSERT_OK(ValidateArray(*out));
+
+  AppendRuns();
+  std::shared_ptr<Array> built;
+  ASSERT_OK(builder_->Finish(&built));
+  test::AssertArraysEqual(*built, *out);
+
+  std::shared_ptr<Array> bad_run_ends, int64_run_ends;
+  ArrayFromVector<Int32Type, int32_t>({5, 5, 10}, &bad_run_ends);
+  ASSERT_RAISES(Invalid, RunLengthEncodedArray::FromArrays(*bad_run_ends, *values, &out));
+  ASSERT_RAISES(Invalid,
+                RunLengthEncodedArray::FromArrays(*run_ends->Slice(1), *values, &out));
+  ArrayFromVector<Int64Type, int64_t>({5, 8, 10}, &int64_run_ends);
+  ASSERT_RAISES(Invalid,
+                RunLengthEncodedArray::FromArrays(*int64_run_ends, *values, &out));
+}
+
+TEST_F(TestRunLengthEncodedArray, Equality) {
+  AppendRuns();
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder_->Finish(&array));
+
+  // The same values split into other runs
+  auto vb = static_cast<Int32Builder*>(builder_->value_builder());
+  for (int32_t length : {2, 3}) {
+    ASSERT_OK(vb->Append(1));
+    ASSERT_OK(builder_->AppendRun(length));
+  }
+  ASSERT_OK(vb->AppendNull());
+  ASSERT_OK(builder_->AppendRun(3));
+  ASSERT_OK(vb->Append(7));
+  ASSERT_OK(builder_->AppendRun(2));
+  std::shared_ptr<Array> equal_array;
+  ASSERT_OK(builder_->Finish(&equal_array));
+
+  ASSERT_OK(vb->Append(1));
+  ASSERT_OK(builder_->AppendRun(5));
+  ASSERT_OK(vb->Append(0));
+  ASSERT_OK(builder_->AppendRun(3));
+  ASSERT_OK(vb->Append(7));
+  ASSERT_OK(builder_->AppendRun(2));
+  std::shared_ptr<Array> unequal_array;
+  ASSERT_OK(builder_->Finish(&unequal_array));
+
+  EXPECT_TRUE(array->Equals(equal_array));
+  EXPECT_TRUE(equal_array->Equals(array));
+  EXPECT_FALSE(array->Equals(unequal_array));
+
+  EXPECT_TRUE(array->RangeEquals(0, 5, 0, unequal_array));
+  EXPECT_FALSE(array->RangeEquals(4, 6, 4, unequal_array));
+  EXPECT_TRUE(array->RangeEquals(8, 10, 8, unequal_array));
+  EXPECT_TRUE(array->Slice(1, 3)->Equals(equal_array->Slice(2, 3)));
+  EXPECT_TRUE(array->Slice(6)->Equals(equal_array->Slice(6)));
+}
+
+TEST_F(TestRunLengthEncodedArray, Concatenate) {
+  AppendRuns();
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder_->Finish(&array));
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Concatenate({array->Slice(3, 4), array->Slice(8)}, pool_, &out));
+  ASSERT_OK(ValidateArray(*out));
+
+  std::shared_ptr<Array> run_ends, values, expected;
+  ArrayFromVector<Int32Type, int32_t>({2, 4, 6}, &run_ends);
+  ArrayFromVector<Int32Type, int32_t>({true, false, true}, {1, 0, 7}, &values);
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values, &expected));
+  test::AssertArraysEqual(*expected, *out);
+  ASSERT_EQ(3, static_cast<const RunLengthEncodedArray&>(*out).num_runs());
+}
+
+TEST_F(TestRunLengthEncodedArray, TestZeroLength) {
+  std::shared_ptr<Array> out;
+  ASSERT_OK(builder_->Finish(&out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_EQ(0, out->length());
 }
 
 // ----------------------------------------------------------------------
@@ -3112,6 +3865,58 @@ TEST_F(TestStructBuilder, TestZeroLength) {
   ASSERT_OK(ValidateArray(*result_));
 }
 
+TEST(TestStructArray, Flatten) {
+  std::shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true, true}, {1, 2, 3, 4, 5},
+                                      &ints);
+  ArrayFromVector<StringType, std::string>({"a", "b", "c", "d", "e"}, &strings);
+  auto type = struct_({field("ints", int32()), field("strings", utf8())});
+
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(test::GetBitmapFromVector(vector<bool>{true, false, true, true, false},
+                                      &null_bitmap));
+  StructArray array(type, 5, {ints, strings}, null_bitmap, 2);
+
+  vector<std::shared_ptr<Array>> fields;
+  ASSERT_OK(array.Flatten(default_memory_pool(), &fields));
+  ASSERT_EQ(2, fields.size());
+  std::shared_ptr<Array> expected_ints, expected_strings;
+  ArrayFromVector<Int32Type, int32_t>({true, false, false, true, false}, {1, 0, 0, 4, 0},
+                                      &expected_ints);
+  const auto& string_values = static_cast<const StringArray&>(*strings);
+  expected_strings = std::make_shared<StringArray>(5, string_values.value_offsets(),
+                                                   string_values.value_data(),
+                                                   null_bitmap, 2);
+  ASSERT_ARRAYS_EQUAL(*expected_ints, *fields[0]);
+  ASSERT_ARRAYS_EQUAL(*expected_strings, *fields[1]);
+  // A field without nulls takes the validity of the struct
+  ASSERT_EQ(null_bitmap, fields[1]->null_bitmap());
+
+  // Slices, and fields with offsets of their own
+  std::shared_ptr<Array> slice = array.Slice(1, 3);
+  ASSERT_OK(
+      static_cast<const StructArray&>(*slice).Flatten(default_memory_pool(), &fields));
+  ASSERT_ARRAYS_EQUAL(*expected_ints->Slice(1, 3), *fields[0]);
+  ASSERT_ARRAYS_EQUAL(*expected_strings->Slice(1, 3), *fields[1]);
+
+  ASSERT_OK(
+      test::GetBitmapFromVector(vector<bool>{true, true, false, true}, &null_bitmap));
+  StructArray shifted(type, 4, {ints->Slice(1), strings->Slice(1)}, null_bitmap, 1);
+  ASSERT_OK(shifted.Flatten(default_memory_pool(), &fields));
+  ASSERT_EQ(1, fields[1]->offset());
+  ASSERT_EQ(1, fields[1]->null_count());
+  ASSERT_TRUE(fields[1]->IsNull(2));
+  ASSERT_EQ(2, fields[0]->null_count());
+  ASSERT_TRUE(fields[0]->IsNull(1));
+  ASSERT_TRUE(fields[0]->IsNull(2));
+  ASSERT_FALSE(fields[0]->IsNull(3));
+
+  // Without nulls, the fields are returned as they are
+  StructArray valid(type, 5, {ints, strings});
+  ASSERT_OK(valid.Flatten(default_memory_pool(), &fields));
+  ASSERT_EQ(valid.field(0), fields[0]);
+}
+
 TEST_F(TestStructBuilder, TestSlice) {
   std::shared_ptr<Array> array, equal_array;
   std::shared_ptr<Array> unequal_bitmap_array, unequal_offsets_array,
@@ -3221,6 +4026,68 @@ TEST(TestUnionArrayAdHoc, TestSliceEquals) {
   CheckUnion(batch->column(2));
 }
 
+TEST(TestDenseUnionBuilder, Basics) {
+  auto type = union_({field("i", int32()), field("s", utf8())}, {5, 10},
+                     UnionMode::DENSE);
+  std::unique_ptr<ArrayBuilder> tmp;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), type, &tmp));
+  auto builder = static_cast<DenseUnionBuilder*>(tmp.get());
+  auto ints = static_cast<Int32Builder*>(builder->child_builder(0));
+  auto strings = static_cast<StringBuilder*>(builder->child_builder(1));
+
+  ASSERT_OK(builder->Append(1));
+  ASSERT_OK(strings->Append("a"));
+  ASSERT_OK(builder->AppendNull());
+
+  // Slots of both children in a single pass, their values in bulk
+  const std::vector<int8_t> children = {0, 1, 0, 1, 0};
+  const std::vector<uint8_t> valid_bytes = {1, 1, 0, 1, 1};
+  ASSERT_OK(builder->Append(children.data(), 5, valid_bytes.data()));
+  const std::vector<int32_t> int_values = {1, 2};
+  ASSERT_OK(ints->Append(int_values.data(), 2));
+  ASSERT_OK(strings->Append("bc"));
+  ASSERT_OK(strings->Append("def"));
+
+  std::shared_ptr<Array> more_ints;
+  ArrayFromVector<Int32Type, int32_t>({7, 8, 9}, &more_ints);
+  ASSERT_OK(builder->AppendChildValues(0, *more_ints->data(), 1, 2));
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder->Finish(&result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_TRUE(result->type()->Equals(type));
+  ASSERT_EQ(9, result->length());
+  ASSERT_EQ(2, result->null_count());
+
+  // Null slots point to the first value of the first child
+  const auto& array = static_cast<const UnionArray&>(*result);
+  const std::vector<uint8_t> ex_type_ids = {10, 5, 5, 10, 5, 10, 5, 5, 5};
+  const std::vector<int32_t> ex_offsets = {0, 0, 0, 1, 0, 2, 1, 2, 3};
+  ASSERT_EQ(ex_type_ids,
+            std::vector<uint8_t>(array.raw_type_ids(), array.raw_type_ids() + 9));
+  ASSERT_EQ(ex_offsets, std::vector<int32_t>(array.raw_value_offsets(),
+                                             array.raw_value_offsets() + 9));
+  ASSERT_TRUE(array.IsNull(1));
+  ASSERT_FALSE(array.IsNull(2));
+  ASSERT_TRUE(array.IsNull(4));
+
+  std::shared_ptr<Array> ex_ints, ex_strings;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 8, 9}, &ex_ints);
+  ArrayFromVector<StringType, std::string>({"a", "bc", "def"}, &ex_strings);
+  ASSERT_ARRAYS_EQUAL(*ex_ints, *array.child(0));
+  ASSERT_ARRAYS_EQUAL(*ex_strings, *array.child(1));
+
+  // The child values must be appended for the slots
+  ASSERT_OK(builder->Append(0));
+  ASSERT_RAISES(Invalid, builder->Finish(&result));
+  const std::vector<int8_t> bad_children = {0, 2};
+  ASSERT_RAISES(Invalid, builder->Append(bad_children.data(), 2));
+  ASSERT_RAISES(Invalid, builder->AppendChildValues(2, *more_ints->data(), 0, 1));
+
+  ASSERT_RAISES(NotImplemented, MakeBuilder(default_memory_pool(),
+                                            union_({field("i", int32())}, {0}), &tmp));
+}
+
 using DecimalVector = std::vector<Decimal128>;
 
 class DecimalTest : public ::testing::TestWithParam<int> {
@@ -3260,6 +4127,9 @@ class DecimalTest : public ::testing::TestWithParam<int> {
 
     std::shared_ptr<Array> out;
     ASSERT_OK(builder->Finish(&out));
+    // The builder is reset for the next array
+    ASSERT_EQ(0, builder->length());
+    ASSERT_EQ(nullptr, builder->null_bitmap());
 
     std::vector<uint8_t> raw_bytes;
 
@@ -3312,6 +4182,107 @@ TEST_P(DecimalTest, WithNulls) {
 
 INSTANTIATE_TEST_CASE_P(DecimalTest, DecimalTest, ::testing::Range(1, 38));
 
+// ----------------------------------------------------------------------
+// Full validation tests
+
+template <typename T>
+std::shared_ptr<Buffer> WrapVector(const vector<T>& values) {
+  return std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(values.data()),
+                                  static_cast<int64_t>(values.size() * sizeof(T)));
+}
+
+TEST(TestValidateArrayFull, Strings) {
+  const std::string data = "a\xc3\xa9" "bc";
+  auto data_buffer = std::make_shared<Buffer>(data);
+  vector<int32_t> offsets = {0, 1, 3, 3, 5};
+  StringArray strings(4, WrapVector(offsets), data_buffer);
+  ASSERT_OK(ValidateArrayFull(strings));
+  ASSERT_OK(ValidateArrayFull(*strings.Slice(1)));
+
+  // Decreasing offsets, offsets past the data and too few offsets
+  vector<int32_t> decreasing = {0, 3, 1, 3, 5};
+  ASSERT_RAISES(Invalid,
+                ValidateArrayFull(StringArray(4, WrapVector(decreasing), data_buffer)));
+  vector<int32_t> past_end = {0, 1, 3, 3, 6};
+  ASSERT_RAISES(Invalid,
+                ValidateArrayFull(StringArray(4, WrapVector(past_end), data_buffer)));
+  ASSERT_RAISES(Invalid,
+                ValidateArrayFull(StringArray(5, WrapVector(offsets), data_buffer)));
+
+  // A value splitting a character is not UTF-8, though the data is
+  vector<int32_t> split = {0, 2, 3, 3, 5};
+  ASSERT_OK(ValidateArrayFull(BinaryArray(4, WrapVector(split), data_buffer)));
+  ASSERT_RAISES(Invalid,
+                ValidateArrayFull(StringArray(4, WrapVector(split), data_buffer)));
+
+  // Invalid UTF-8 under a null slot is not checked
+  const std::string bad_data = "a\xff" "bc";
+  auto bad_buffer = std::make_shared<Buffer>(bad_data);
+  vector<int32_t> bad_offsets = {0, 1, 2, 4};
+  vector<uint8_t> null_bitmap = {0x05};
+  ASSERT_RAISES(Invalid,
+                ValidateArrayFull(StringArray(3, WrapVector(bad_offsets), bad_buffer)));
+  ASSERT_OK(ValidateArrayFull(StringArray(3, WrapVector(bad_offsets), bad_buffer,
+                                          WrapVector(null_bitmap), 1)));
+}
+
+TEST(TestValidateArrayFull, LongStrings) {
+  // Errors are found in any block of values
+  StringBuilder builder;
+  for (int i = 0; i < 3000; ++i) {
+    ASSERT_OK(builder.Append(i % 7 == 0 ? "\xc3\xa9" : "x"));
+  }
+  std::shared_ptr<Array> strings;
+  ASSERT_OK(builder.Finish(&strings));
+  ASSERT_OK(ValidateArrayFull(*strings));
+
+  for (int64_t position : {5, 1500, 2999}) {
+    auto data = strings->data()->Copy();
+    const int32_t* raw_offsets =
+        static_cast<const StringArray&>(*strings).raw_value_offsets();
+    vector<int32_t> offsets(raw_offsets, raw_offsets + strings->length() + 1);
+    offsets[position] = offsets[position + 1] + 1;
+    data->buffers[1] = WrapVector(offsets);
+    ASSERT_RAISES(Invalid, ValidateArrayFull(*MakeArray(data)));
+  }
+}
+
+TEST(TestValidateArrayFull, Dictionary) {
+  vector<std::string> dict_values = {"a", "b"};
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<StringType, std::string>(dict_values, &dict);
+  auto type = dictionary(int8(), dict);
+
+  std::shared_ptr<Array> indices, out_of_range, null_out_of_range, negative;
+  ArrayFromVector<Int8Type, int8_t>({0, 1, 1, 0}, &indices);
+  ArrayFromVector<Int8Type, int8_t>({0, 1, 2, 0}, &out_of_range);
+  ArrayFromVector<Int8Type, int8_t>({true, true, false, true}, {0, 1, 2, 0},
+                                    &null_out_of_range);
+  ArrayFromVector<Int8Type, int8_t>({0, -1, 1, 0}, &negative);
+
+  ASSERT_OK(ValidateArrayFull(DictionaryArray(type, indices)));
+  ASSERT_OK(ValidateArrayFull(DictionaryArray(type, null_out_of_range)));
+  ASSERT_RAISES(Invalid, ValidateArrayFull(DictionaryArray(type, out_of_range)));
+  ASSERT_RAISES(Invalid, ValidateArrayFull(DictionaryArray(type, negative)));
+}
+
+TEST(TestValidateArrayFull, Nested) {
+  // A list of strings, the strings being checked with the list
+  const std::string data = "ab\xc3";
+  vector<int32_t> string_offsets = {0, 1, 3};
+  auto strings = std::make_shared<StringArray>(2, WrapVector(string_offsets),
+                                               std::make_shared<Buffer>(data));
+  vector<int32_t> list_offsets = {0, 2};
+  ListArray lists(list(utf8()), 1, WrapVector(list_offsets), strings);
+  ASSERT_OK(ValidateArray(lists));
+  ASSERT_RAISES(Invalid, ValidateArrayFull(lists));
+
+  // Values buffers too small for the length
+  vector<int32_t> values = {1, 2};
+  ASSERT_OK(ValidateArrayFull(Int32Array(2, WrapVector(values))));
+  ASSERT_RAISES(Invalid, ValidateArrayFull(Int32Array(3, WrapVector(values))));
+}
+
 // ----------------------------------------------------------------------
 // Test rechunking
 
@@ -3376,4 +4347,111 @@ TEST(TestRechunkArraysConsistently, Plain) {
   ASSERT_ARRAYS_EQUAL(*rb[4], *expected);
 }
 
+// ----------------------------------------------------------------------
+// Concatenate tests
+
+// Concatenating slices of an array, including an empty one, gives it back
+void CheckConcatenateSlices(const std::shared_ptr<Array>& array) {
+  const int64_t length = array->length();
+  ArrayVector slices = {array->Slice(0, 3), array->Slice(3, 0),
+                        array->Slice(3, length - 5), array->Slice(length - 2, 2)};
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Concatenate(slices, default_memory_pool(), &out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_EQ(array->null_count(), out->null_count());
+  ASSERT_ARRAYS_EQUAL(*array, *out);
+
+  ASSERT_OK(Concatenate({array->Slice(1, 4)}, default_memory_pool(), &out));
+  ASSERT_ARRAYS_EQUAL(*array->Slice(1, 4), *out);
+}
+
+TEST(TestConcatenate, Primitive) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int32Type, int32_t>(
+      {true, false, true, true, true, false, true, true, true, false},
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, &array);
+  CheckConcatenateSlices(array);
+
+  ArrayFromVector<Int64Type, int64_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, &array);
+  CheckConcatenateSlices(array);
+
+  ArrayFromVector<BooleanType, bool>(
+      {true, false, true, true, true, false, true, true, true, false},
+      {true, true, false, true, false, false, true, true, false, true}, &array);
+  CheckConcatenateSlices(array);
+
+  CheckConcatenateSlices(std::make_shared<NullArray>(10));
+}
+
+TEST(TestConcatenate, Binary) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>(
+      {true, true, false, true, true, true, true, false, true, true},
+      {"a", "bb", "", "", "ccc", "d", "ee", "", "ffff", "g"}, &array);
+  CheckConcatenateSlices(array);
+}
+
+TEST(TestConcatenate, LargeBinary) {
+  std::shared_ptr<Array> array;
+  ArrayFromVector<LargeBinaryType, std::string>(
+      {true, true, false, true, true, true, true, false, true, true},
+      {"a", "bb", "", "", "ccc", "d", "ee", "", "ffff", "g"}, &array);
+  CheckConcatenateSlices(array);
+}
+
+TEST(TestConcatenate, Nested) {
+  ListBuilder list_builder(default_memory_pool(),
+                           std::unique_ptr<ArrayBuilder>(new Int16Builder()));
+  auto value_builder = static_cast<Int16Builder*>(list_builder.value_builder());
+  for (int16_t i = 0; i < 10; ++i) {
+    if (i % 4 == 1) {
+      ASSERT_OK(list_builder.AppendNull());
+      continue;
+    }
+    ASSERT_OK(list_builder.Append());
+    for (int16_t j = 0; j < i % 3; ++j) {
+      ASSERT_OK(value_builder->Append(i));
+    }
+  }
+  std::shared_ptr<Array> list;
+  ASSERT_OK(list_builder.Finish(&list));
+  CheckConcatenateSlices(list);
+
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>(
+      {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"}, &strings);
+  std::shared_ptr<Buffer> null_bitmap;
+  std::vector<bool> is_valid = {true, false, true, true, true,
+                                true, false, true, true, true};
+  ASSERT_OK(test::GetBitmapFromVector(is_valid, &null_bitmap));
+  auto type = struct_({field("list", list->type()), field("string", utf8())});
+  auto array = std::make_shared<StructArray>(type, 10, ArrayVector{list, strings},
+                                             null_bitmap, 2);
+  CheckConcatenateSlices(array);
+}
+
+TEST(TestConcatenate, Dictionary) {
+  std::shared_ptr<Array> dict, indices, array;
+  ArrayFromVector<StringType, std::string>({"foo", "bar", "baz"}, &dict);
+  ArrayFromVector<Int8Type, int8_t>(
+      {true, true, false, true, true, true, true, true, true, true},
+      {1, 2, 0, 0, 2, 0, 1, 1, 2, 0}, &indices);
+  ASSERT_OK(DictionaryArray::FromArrays(dictionary(int8(), dict), indices, &array));
+  CheckConcatenateSlices(array);
+
+  std::shared_ptr<Array> other_dict, other;
+  ArrayFromVector<StringType, std::string>({"foo", "bar", "qux"}, &other_dict);
+  ASSERT_OK(DictionaryArray::FromArrays(dictionary(int8(), other_dict), indices, &other));
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, Concatenate({array, other}, default_memory_pool(), &out));
+}
+
+TEST(TestConcatenate, Errors) {
+  std::shared_ptr<Array> ints, strings, out;
+  ArrayFromVector<Int32Type, int32_t>({1, 2}, &ints);
+  ArrayFromVector<StringType, std::string>({"a", "b"}, &strings);
+  ASSERT_RAISES(Invalid, Concatenate({ints, strings}, default_memory_pool(), &out));
+  ASSERT_RAISES(Invalid, Concatenate({}, default_memory_pool(), &out));
+}
+
 }  // namespace arrow
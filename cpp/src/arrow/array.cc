@@ -34,6 +34,8 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor.h"
 #include "arrow/visitor_inline.h"
 
@@ -146,7 +148,9 @@ PrimitiveArray::PrimitiveArray(const std::shared_ptr<DataType>& type, int64_t le
                                const std::shared_ptr<Buffer>& data,
                                const std::shared_ptr<Buffer>& null_bitmap,
                                int64_t null_count, int64_t offset) {
-  SetData(ArrayData::Make(type, length, {null_bitmap, data}, null_count, offset));
+  SetData(ArrayData::Make(
+      type, length, internal::MakeVector<std::shared_ptr<Buffer>>(null_bitmap, data),
+      null_count, offset));
 }
 
 template <typename T>
@@ -181,32 +185,45 @@ ListArray::ListArray(const std::shared_ptr<DataType>& type, int64_t length,
                      const std::shared_ptr<Array>& values,
                      const std::shared_ptr<Buffer>& null_bitmap, int64_t null_count,
                      int64_t offset) {
-  auto internal_data =
-      ArrayData::Make(type, length, {null_bitmap, value_offsets}, null_count, offset);
+  auto internal_data = ArrayData::Make(
+      type, length,
+      internal::MakeVector<std::shared_ptr<Buffer>>(null_bitmap, value_offsets),
+      null_count, offset);
   internal_data->child_data.emplace_back(values->data());
   SetData(internal_data);
 }
 
-Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
-                             std::shared_ptr<Array>* out) {
+namespace {
+
+// Build a list array of offsets of type OffsetArrowType, replacing null
+// offsets by the next valid one
+template <typename ListArrayType, typename OffsetArrowType>
+Status ListArrayFromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                           const std::shared_ptr<DataType>& list_type,
+                           std::shared_ptr<Array>* out) {
+  using offset_type = typename OffsetArrowType::c_type;
+
   if (offsets.length() == 0) {
     return Status::Invalid("List offsets must have non-zero length");
   }
 
-  if (offsets.type_id() != Type::INT32) {
-    return Status::Invalid("List offsets must be signed int32");
+  if (offsets.type_id() != OffsetArrowType::type_id) {
+    std::stringstream ss;
+    ss << "List offsets must be signed " << OffsetArrowType().ToString();
+    return Status::Invalid(ss.str());
   }
 
   BufferVector buffers = {};
 
-  const auto& typed_offsets = static_cast<const Int32Array&>(offsets);
+  const auto& typed_offsets = static_cast<const NumericArray<OffsetArrowType>&>(offsets);
 
   const int64_t num_offsets = offsets.length();
 
   if (offsets.null_count() > 0) {
     std::shared_ptr<Buffer> clean_offsets, clean_valid_bits;
 
-    RETURN_NOT_OK(AllocateBuffer(pool, num_offsets * sizeof(int32_t), &clean_offsets));
+    RETURN_NOT_OK(
+        AllocateBuffer(pool, num_offsets * sizeof(offset_type), &clean_offsets));
 
     // Copy valid bits, zero out the bit for the final offset
     RETURN_NOT_OK(offsets.null_bitmap()->Copy(0, BitUtil::BytesForBits(num_offsets - 1),
@@ -214,12 +231,13 @@ Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPo
     BitUtil::ClearBit(clean_valid_bits->mutable_data(), num_offsets);
     buffers.emplace_back(std::move(clean_valid_bits));
 
-    const int32_t* raw_offsets = typed_offsets.raw_values();
-    auto clean_raw_offsets = reinterpret_cast<int32_t*>(clean_offsets->mutable_data());
+    const offset_type* raw_offsets = typed_offsets.raw_values();
+    auto clean_raw_offsets =
+        reinterpret_cast<offset_type*>(clean_offsets->mutable_data());
 
     // Must work backwards so we can tell how many values were in the last non-null value
     DCHECK(offsets.IsValid(num_offsets - 1));
-    int32_t current_offset = raw_offsets[num_offsets - 1];
+    offset_type current_offset = raw_offsets[num_offsets - 1];
     for (int64_t i = num_offsets - 1; i >= 0; --i) {
       if (offsets.IsValid(i)) {
         current_offset = raw_offsets[i];
@@ -233,15 +251,22 @@ Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPo
     buffers.emplace_back(typed_offsets.values());
   }
 
-  auto list_type = list(values.type());
   auto internal_data = ArrayData::Make(list_type, num_offsets - 1, std::move(buffers),
                                        offsets.null_count(), offsets.offset());
   internal_data->child_data.push_back(values.data());
 
-  *out = std::make_shared<ListArray>(internal_data);
+  *out = std::make_shared<ListArrayType>(internal_data);
   return Status::OK();
 }
 
+}  // namespace
+
+Status ListArray::FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                             std::shared_ptr<Array>* out) {
+  return ListArrayFromArrays<ListArray, Int32Type>(offsets, values, pool,
+                                                   list(values.type()), out);
+}
+
 void ListArray::SetData(const std::shared_ptr<ArrayData>& data) {
   this->Array::SetData(data);
   DCHECK_EQ(data->buffers.size(), 2);
@@ -259,6 +284,70 @@ std::shared_ptr<DataType> ListArray::value_type() const {
 
 std::shared_ptr<Array> ListArray::values() const { return values_; }
 
+namespace {
+
+template <typename ListArrayType>
+std::shared_ptr<Array> FlattenList(const ListArrayType& array) {
+  const std::shared_ptr<Array>& values = array.values();
+  if (array.value_offsets() == nullptr) {
+    return values->Slice(0, 0);
+  }
+  const int64_t first = array.value_offset(0);
+  const int64_t length = array.value_offset(array.length()) - first;
+  if (first == 0 && length == values->length()) {
+    return values;
+  }
+  return values->Slice(first, length);
+}
+
+}  // namespace
+
+std::shared_ptr<Array> ListArray::Flatten() const { return FlattenList(*this); }
+
+// ----------------------------------------------------------------------
+// LargeListArray
+
+LargeListArray::LargeListArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_LIST);
+  SetData(data);
+}
+
+LargeListArray::LargeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                               const std::shared_ptr<Buffer>& value_offsets,
+                               const std::shared_ptr<Array>& values,
+                               const std::shared_ptr<Buffer>& null_bitmap,
+                               int64_t null_count, int64_t offset) {
+  auto internal_data = ArrayData::Make(
+      type, length,
+      internal::MakeVector<std::shared_ptr<Buffer>>(null_bitmap, value_offsets),
+      null_count, offset);
+  internal_data->child_data.emplace_back(values->data());
+  SetData(internal_data);
+}
+
+Status LargeListArray::FromArrays(const Array& offsets, const Array& values,
+                                  MemoryPool* pool, std::shared_ptr<Array>* out) {
+  return ListArrayFromArrays<LargeListArray, Int64Type>(offsets, values, pool,
+                                                        large_list(values.type()), out);
+}
+
+void LargeListArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  DCHECK_EQ(data->buffers.size(), 2);
+
+  auto value_offsets = data->buffers[1];
+  raw_value_offsets_ = value_offsets == nullptr
+                           ? nullptr
+                           : reinterpret_cast<const int64_t*>(value_offsets->data());
+  values_ = MakeArray(data_->child_data[0]);
+}
+
+std::shared_ptr<DataType> LargeListArray::value_type() const {
+  return static_cast<const LargeListType&>(*type()).value_type();
+}
+
+std::shared_ptr<Array> LargeListArray::Flatten() const { return FlattenList(*this); }
+
 // ----------------------------------------------------------------------
 // String and binary
 
@@ -290,8 +379,10 @@ BinaryArray::BinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
                          const std::shared_ptr<Buffer>& data,
                          const std::shared_ptr<Buffer>& null_bitmap, int64_t null_count,
                          int64_t offset) {
-  SetData(ArrayData::Make(type, length, {null_bitmap, value_offsets, data}, null_count,
-                          offset));
+  SetData(ArrayData::Make(
+      type, length,
+      internal::MakeVector<std::shared_ptr<Buffer>>(null_bitmap, value_offsets, data),
+      null_count, offset));
 }
 
 StringArray::StringArray(const std::shared_ptr<ArrayData>& data) {
@@ -305,6 +396,84 @@ StringArray::StringArray(int64_t length, const std::shared_ptr<Buffer>& value_of
                          int64_t offset)
     : BinaryArray(utf8(), length, value_offsets, data, null_bitmap, null_count, offset) {}
 
+LargeBinaryArray::LargeBinaryArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_BINARY);
+  SetData(data);
+}
+
+void LargeBinaryArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->buffers.size(), 3);
+  auto value_offsets = data->buffers[1];
+  auto value_data = data->buffers[2];
+  this->Array::SetData(data);
+  raw_data_ = value_data == nullptr ? nullptr : value_data->data();
+  raw_value_offsets_ = value_offsets == nullptr
+                           ? nullptr
+                           : reinterpret_cast<const int64_t*>(value_offsets->data());
+}
+
+LargeBinaryArray::LargeBinaryArray(int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset)
+    : LargeBinaryArray(large_binary(), length, value_offsets, data, null_bitmap,
+                       null_count, offset) {}
+
+LargeBinaryArray::LargeBinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset) {
+  SetData(ArrayData::Make(
+      type, length,
+      internal::MakeVector<std::shared_ptr<Buffer>>(null_bitmap, value_offsets, data),
+      null_count, offset));
+}
+
+LargeStringArray::LargeStringArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::LARGE_STRING);
+  SetData(data);
+}
+
+LargeStringArray::LargeStringArray(int64_t length,
+                                   const std::shared_ptr<Buffer>& value_offsets,
+                                   const std::shared_ptr<Buffer>& data,
+                                   const std::shared_ptr<Buffer>& null_bitmap,
+                                   int64_t null_count, int64_t offset)
+    : LargeBinaryArray(large_utf8(), length, value_offsets, data, null_bitmap,
+                       null_count, offset) {}
+
+// ----------------------------------------------------------------------
+// String views
+
+StringViewArray::StringViewArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::STRING_VIEW);
+  SetData(data);
+}
+
+StringViewArray::StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                                 const BufferVector& data_buffers,
+                                 const std::shared_ptr<Buffer>& null_bitmap,
+                                 int64_t null_count, int64_t offset) {
+  BufferVector buffers = {null_bitmap, views};
+  buffers.insert(buffers.end(), data_buffers.begin(), data_buffers.end());
+  SetData(ArrayData::Make(utf8_view(), length, std::move(buffers), null_count, offset));
+}
+
+void StringViewArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_GE(data->buffers.size(), 2);
+  this->Array::SetData(data);
+  const auto& views = data->buffers[1];
+  raw_views_ = views == nullptr ? nullptr
+                                : reinterpret_cast<const StringViewEntry*>(views->data());
+  raw_data_buffers_.clear();
+  for (size_t i = 2; i < data->buffers.size(); ++i) {
+    const auto& buffer = data->buffers[i];
+    raw_data_buffers_.push_back(buffer == nullptr ? nullptr : buffer->data());
+  }
+}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -351,7 +520,10 @@ StructArray::StructArray(const std::shared_ptr<DataType>& type, int64_t length,
                          const std::vector<std::shared_ptr<Array>>& children,
                          std::shared_ptr<Buffer> null_bitmap, int64_t null_count,
                          int64_t offset) {
-  SetData(ArrayData::Make(type, length, {null_bitmap}, null_count, offset));
+  SetData(ArrayData::Make(
+      type, length, internal::MakeVector<std::shared_ptr<Buffer>>(std::move(null_bitmap)),
+      null_count, offset));
+  data_->child_data.reserve(children.size());
   for (const auto& child : children) {
     data_->child_data.push_back(child->data());
   }
@@ -372,6 +544,43 @@ std::shared_ptr<Array> StructArray::field(int i) const {
   return boxed_fields_[i];
 }
 
+Status StructArray::Flatten(MemoryPool* pool,
+                            std::vector<std::shared_ptr<Array>>* out) const {
+  out->clear();
+  out->reserve(num_fields());
+  const std::shared_ptr<Buffer>& bitmap = data_->buffers[0];
+  for (int i = 0; i < num_fields(); ++i) {
+    std::shared_ptr<Array> child = field(i);
+    if (null_count() == 0 || bitmap == nullptr || child->type_id() == Type::NA) {
+      out->push_back(child);
+      continue;
+    }
+    std::shared_ptr<ArrayData> child_data = child->data()->Copy();
+    const std::shared_ptr<Buffer> child_bitmap = child_data->buffers[0];
+    if (child_data->null_count == 0 || child_bitmap == nullptr) {
+      if (child_data->offset == data_->offset) {
+        // The validity of the struct is that of the field
+        child_data->buffers[0] = bitmap;
+        child_data->null_count = data_->null_count;
+        out->push_back(MakeArray(child_data));
+        continue;
+      }
+      // Copy it to the offset of the field
+      RETURN_NOT_OK(BitmapAnd(pool, bitmap->data(), data_->offset, bitmap->data(),
+                              data_->offset, data_->length, child_data->offset,
+                              &child_data->buffers[0]));
+      child_data->null_count = data_->null_count;
+    } else {
+      RETURN_NOT_OK(BitmapAnd(pool, child_bitmap->data(), child_data->offset,
+                              bitmap->data(), data_->offset, data_->length,
+                              child_data->offset, &child_data->buffers[0]));
+      child_data->null_count = kUnknownNullCount;
+    }
+    out->push_back(MakeArray(child_data));
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // UnionArray
 
@@ -402,7 +611,10 @@ UnionArray::UnionArray(const std::shared_ptr<DataType>& type, int64_t length,
                        const std::shared_ptr<Buffer>& null_bitmap, int64_t null_count,
                        int64_t offset) {
   auto internal_data = ArrayData::Make(
-      type, length, {null_bitmap, type_ids, value_offsets}, null_count, offset);
+      type, length,
+      internal::MakeVector<std::shared_ptr<Buffer>>(null_bitmap, type_ids, value_offsets),
+      null_count, offset);
+  internal_data->child_data.reserve(children.size());
   for (const auto& child : children) {
     internal_data->child_data.push_back(child->data());
   }
@@ -428,12 +640,13 @@ Status UnionArray::MakeDense(const Array& type_ids, const Array& value_offsets,
     return Status::Invalid("MakeDense does not allow NAs in value_offsets");
   }
 
-  BufferVector buffers = {type_ids.null_bitmap(),
-                          static_cast<const UInt8Array&>(type_ids).values(),
-                          static_cast<const Int32Array&>(value_offsets).values()};
+  auto buffers = internal::MakeVector<std::shared_ptr<Buffer>>(
+      type_ids.null_bitmap(), static_cast<const UInt8Array&>(type_ids).values(),
+      static_cast<const Int32Array&>(value_offsets).values());
   auto union_type = union_(children, UnionMode::DENSE);
   auto internal_data = ArrayData::Make(union_type, type_ids.length(), std::move(buffers),
                                        type_ids.null_count(), type_ids.offset());
+  internal_data->child_data.reserve(children.size());
   for (const auto& child : children) {
     internal_data->child_data.push_back(child->data());
   }
@@ -447,11 +660,12 @@ Status UnionArray::MakeSparse(const Array& type_ids,
   if (type_ids.type_id() != Type::INT8) {
     return Status::Invalid("UnionArray type_ids must be signed int8");
   }
-  BufferVector buffers = {type_ids.null_bitmap(),
-                          static_cast<const UInt8Array&>(type_ids).values(), nullptr};
+  auto buffers = internal::MakeVector<std::shared_ptr<Buffer>>(
+      type_ids.null_bitmap(), static_cast<const UInt8Array&>(type_ids).values(), nullptr);
   auto union_type = union_(children, UnionMode::SPARSE);
   auto internal_data = ArrayData::Make(union_type, type_ids.length(), std::move(buffers),
                                        type_ids.null_count(), type_ids.offset());
+  internal_data->child_data.reserve(children.size());
   for (const auto& child : children) {
     internal_data->child_data.push_back(child->data());
     if (child->length() != type_ids.length()) {
@@ -585,6 +799,84 @@ std::shared_ptr<Array> DictionaryArray::dictionary() const {
   return dict_type_->dictionary();
 }
 
+// ----------------------------------------------------------------------
+// RunLengthEncodedArray
+
+RunLengthEncodedArray::RunLengthEncodedArray(const std::shared_ptr<ArrayData>& data) {
+  DCHECK_EQ(data->type->id(), Type::RUN_LENGTH_ENCODED);
+  SetData(data);
+}
+
+RunLengthEncodedArray::RunLengthEncodedArray(const std::shared_ptr<DataType>& type,
+                                             int64_t length,
+                                             const std::shared_ptr<Buffer>& run_ends,
+                                             const std::shared_ptr<Array>& values,
+                                             int64_t offset) {
+  auto internal_data =
+      ArrayData::Make(type, length, {nullptr, run_ends}, /*null_count=*/0, offset);
+  internal_data->child_data.emplace_back(values->data());
+  SetData(internal_data);
+}
+
+Status RunLengthEncodedArray::FromArrays(const Array& run_ends, const Array& values,
+                                         std::shared_ptr<Array>* out) {
+  if (run_ends.type_id() != Type::INT32) {
+    return Status::Invalid("Run ends must be signed int32");
+  }
+  if (run_ends.null_count() > 0) {
+    return Status::Invalid("Run ends must not have nulls");
+  }
+  if (run_ends.length() != values.length()) {
+    return Status::Invalid("Run ends and values must have the same length");
+  }
+
+  const auto& typed_run_ends = static_cast<const Int32Array&>(run_ends);
+  const int32_t* raw_run_ends = typed_run_ends.raw_values();
+  int32_t last_end = 0;
+  for (int64_t i = 0; i < run_ends.length(); ++i) {
+    if (raw_run_ends[i] <= last_end) {
+      return Status::Invalid("Run ends must be positive and strictly increasing");
+    }
+    last_end = raw_run_ends[i];
+  }
+
+  std::shared_ptr<Buffer> run_ends_buffer = typed_run_ends.values();
+  if (run_ends.offset() != 0) {
+    run_ends_buffer = SliceBuffer(run_ends_buffer, run_ends.offset() * sizeof(int32_t),
+                                  run_ends.length() * sizeof(int32_t));
+  }
+  *out = std::make_shared<RunLengthEncodedArray>(run_length_encoded(values.type()),
+                                                 last_end, run_ends_buffer,
+                                                 MakeArray(values.data()));
+  return Status::OK();
+}
+
+void RunLengthEncodedArray::SetData(const std::shared_ptr<ArrayData>& data) {
+  this->Array::SetData(data);
+  DCHECK_EQ(data->buffers.size(), 2);
+
+  auto run_ends = data->buffers[1];
+  raw_run_ends_ =
+      run_ends == nullptr ? nullptr : reinterpret_cast<const int32_t*>(run_ends->data());
+  values_ = MakeArray(data_->child_data[0]);
+
+  if (data_->length > 0) {
+    first_run_ = FindRun(0);
+    num_runs_ = FindRun(data_->length - 1) - first_run_ + 1;
+  } else {
+    first_run_ = num_runs_ = 0;
+  }
+}
+
+std::shared_ptr<DataType> RunLengthEncodedArray::value_type() const {
+  return static_cast<const RunLengthEncodedType&>(*type()).value_type();
+}
+
+int64_t RunLengthEncodedArray::FindRun(int64_t i) const {
+  const int32_t* end = raw_run_ends_ + values_->length();
+  return std::upper_bound(raw_run_ends_, end, data_->offset + i) - raw_run_ends_;
+}
+
 // ----------------------------------------------------------------------
 // Implement Array::Accept as inline visitor
 
@@ -609,7 +901,49 @@ struct ValidateVisitor {
     return Status::OK();
   }
 
-  Status Visit(const ListArray& array) {
+  Status Visit(const LargeBinaryArray&) { return Status::OK(); }
+
+  Status Visit(const StringViewArray& array) {
+    if (array.length() > 0 && !array.views()) {
+      return Status::Invalid("views buffer was null");
+    }
+    if (array.views() &&
+        array.views()->size() <
+            (array.offset() + array.length()) *
+                static_cast<int64_t>(sizeof(StringViewEntry))) {
+      return Status::Invalid("views buffer too small for the array length");
+    }
+    for (int64_t i = 0; i < array.length(); ++i) {
+      const StringViewEntry& view = array.GetView(i);
+      if (view.size < 0) {
+        std::stringstream ss;
+        ss << "Negative string length at index " << i;
+        return Status::Invalid(ss.str());
+      }
+      if (view.is_inline()) {
+        continue;
+      }
+      const int32_t buffer_index = view.ref.buffer_index;
+      if (buffer_index < 0 || buffer_index >= array.num_data_buffers() ||
+          !array.data_buffer(buffer_index) || view.ref.offset < 0 ||
+          view.ref.offset + static_cast<int64_t>(view.size) >
+              array.data_buffer(buffer_index)->size()) {
+        std::stringstream ss;
+        ss << "String at index " << i << " out of the bounds of its data buffer";
+        return Status::Invalid(ss.str());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ListArray& array) { return ValidateList(array); }
+
+  Status Visit(const LargeListArray& array) { return ValidateList(array); }
+
+  template <typename ListArrayType>
+  Status ValidateList(const ListArrayType& array) {
+    using offset_type = typename ListArrayType::TypeClass::offset_type;
+
     if (array.length() < 0) {
       return Status::Invalid("Length was negative");
     }
@@ -618,13 +952,13 @@ struct ValidateVisitor {
     if (array.length() && !value_offsets) {
       return Status::Invalid("value_offsets_ was null");
     }
-    if (value_offsets->size() / static_cast<int>(sizeof(int32_t)) < array.length()) {
+    if (value_offsets->size() / static_cast<int>(sizeof(offset_type)) < array.length()) {
       std::stringstream ss;
       ss << "offset buffer size (bytes): " << value_offsets->size()
          << " isn't large enough for length: " << array.length();
       return Status::Invalid(ss.str());
     }
-    const int32_t last_offset = array.value_offset(array.length());
+    const offset_type last_offset = array.value_offset(array.length());
     if (last_offset > 0) {
       if (!array.values()) {
         return Status::Invalid("last offset was non-zero and values was null");
@@ -644,12 +978,12 @@ struct ValidateVisitor {
       }
     }
 
-    int32_t prev_offset = array.value_offset(0);
+    offset_type prev_offset = array.value_offset(0);
     if (prev_offset != 0) {
       return Status::Invalid("The first offset wasn't zero");
     }
     for (int64_t i = 1; i <= array.length(); ++i) {
-      int32_t current_offset = array.value_offset(i);
+      offset_type current_offset = array.value_offset(i);
       if (array.IsNull(i - 1) && current_offset != prev_offset) {
         std::stringstream ss;
         ss << "Offset invariant failure at: " << i
@@ -719,6 +1053,45 @@ struct ValidateVisitor {
     return Status::OK();
   }
 
+  Status Visit(const RunLengthEncodedArray& array) {
+    if (array.length() < 0) {
+      return Status::Invalid("Length was negative");
+    }
+    if (array.null_count() != 0) {
+      return Status::Invalid("Run-length encoded arrays have no validity bitmap");
+    }
+
+    const int64_t num_runs = array.values()->length();
+    if (num_runs > 0 && !array.raw_run_ends()) {
+      return Status::Invalid("run_ends was null");
+    }
+    if (array.run_ends() &&
+        array.run_ends()->size() / static_cast<int64_t>(sizeof(int32_t)) < num_runs) {
+      return Status::Invalid("Run ends buffer smaller than the number of values");
+    }
+
+    const int32_t* run_ends = array.raw_run_ends();
+    for (int64_t i = 0; i < num_runs; ++i) {
+      if (run_ends[i] <= (i == 0 ? 0 : run_ends[i - 1])) {
+        std::stringstream ss;
+        ss << "Run end at position " << i << " is not greater than the previous one";
+        return Status::Invalid(ss.str());
+      }
+    }
+    const int64_t last_end = num_runs == 0 ? 0 : run_ends[num_runs - 1];
+    if (array.offset() + array.length() > last_end) {
+      return Status::Invalid("Array extends past the last run end");
+    }
+
+    const Status child_valid = ValidateArray(*array.values());
+    if (!child_valid.ok()) {
+      std::stringstream ss;
+      ss << "Child array invalid: " << child_valid.ToString();
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
   Status Visit(const DictionaryArray& array) {
     Type::type index_type_id = array.indices()->type()->id();
     if (!is_integer(index_type_id)) {
@@ -735,6 +1108,243 @@ Status ValidateArray(const Array& array) {
   return VisitArrayInline(array, &validate_visitor);
 }
 
+// ----------------------------------------------------------------------
+// Implement ValidateArrayFull as inline visitor
+
+namespace internal {
+
+// Number of values checked by the branch-free loops below, which only look
+// for the failing value once a block is known to hold one
+constexpr int64_t kValidateBlockSize = 1024;
+
+// Check that offsets[0..length] increase and lie within [0, data_size]
+template <typename offset_type>
+Status ValidateOffsets(const offset_type* offsets, int64_t length, int64_t data_size) {
+  if (offsets[0] < 0 || offsets[length] > data_size) {
+    std::stringstream ss;
+    ss << "Offsets from " << offsets[0] << " to " << offsets[length]
+       << " out of the bounds of data of " << data_size << " bytes";
+    return Status::Invalid(ss.str());
+  }
+  for (int64_t start = 0; start < length; start += kValidateBlockSize) {
+    const int64_t block_length = std::min(kValidateBlockSize, length - start);
+    const offset_type* block = offsets + start;
+    bool decreasing = false;
+    for (int64_t i = 0; i < block_length; ++i) {
+      decreasing |= block[i + 1] < block[i];
+    }
+    if (ARROW_PREDICT_FALSE(decreasing)) {
+      int64_t i = 0;
+      while (block[i + 1] >= block[i]) {
+        ++i;
+      }
+      std::stringstream ss;
+      ss << "Offset at position " << start + i + 1 << " smaller than the previous one";
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+// Check that the values of a binary array with valid offsets are UTF-8
+template <typename offset_type>
+Status ValidateUTF8Values(const Array& array, const offset_type* offsets,
+                          const uint8_t* data) {
+  const int64_t length = array.length();
+  const offset_type begin = offsets[0];
+  const offset_type end = offsets[length];
+  if (begin == end) {
+    return Status::OK();
+  }
+  if (array.null_count() == 0) {
+    // The data is checked at once, then each value is checked to start a
+    // character, so that no character spans two values
+    bool valid = ValidateUTF8(data + begin, end - begin);
+    for (int64_t start = 1; valid && start < length; start += kValidateBlockSize) {
+      const int64_t block_end = std::min(start + kValidateBlockSize, length);
+      bool split = false;
+      for (int64_t i = start; i < block_end; ++i) {
+        const offset_type position = offsets[i] < end ? offsets[i] : begin;
+        split |= !IsUTF8CharacterStart(data[position]);
+      }
+      valid = !split;
+    }
+    if (valid) {
+      return Status::OK();
+    }
+  }
+  // Values under null slots are not checked
+  for (int64_t i = 0; i < length; ++i) {
+    if (!array.IsNull(i) &&
+        !ValidateUTF8(data + offsets[i], offsets[i + 1] - offsets[i])) {
+      std::stringstream ss;
+      ss << "Invalid UTF-8 string at position " << i;
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+template <typename IndexType>
+Status ValidateDictionaryIndices(const Array& indices, int64_t dictionary_length) {
+  using c_type = typename IndexType::c_type;
+  const c_type* values =
+      reinterpret_cast<const c_type*>(indices.data()->buffers[1]->data()) +
+      indices.offset();
+  const int64_t length = indices.length();
+  const uint64_t bound = static_cast<uint64_t>(dictionary_length);
+  for (int64_t start = 0; start < length; start += kValidateBlockSize) {
+    const int64_t block_length = std::min(kValidateBlockSize, length - start);
+    const c_type* block = values + start;
+    // Negative indices are out of range as unsigned values
+    bool out_of_range = false;
+    for (int64_t i = 0; i < block_length; ++i) {
+      out_of_range |= static_cast<uint64_t>(static_cast<int64_t>(block[i])) >= bound;
+    }
+    if (ARROW_PREDICT_FALSE(out_of_range)) {
+      // Indices under null slots may be anything
+      for (int64_t i = 0; i < block_length; ++i) {
+        if (static_cast<uint64_t>(static_cast<int64_t>(block[i])) >= bound &&
+            !indices.IsNull(start + i)) {
+          std::stringstream ss;
+          ss << "Dictionary index " << static_cast<int64_t>(block[i]) << " at position "
+             << start + i << " out of the bounds of a dictionary of "
+             << dictionary_length << " values";
+          return Status::Invalid(ss.str());
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status ValidateBufferSize(const Array& array, int i, int64_t min_size,
+                          const char* name) {
+  const auto& buffer = array.data()->buffers[i];
+  if (min_size > 0 && (buffer == nullptr || buffer->size() < min_size)) {
+    std::stringstream ss;
+    ss << name << " buffer of " << (buffer == nullptr ? 0 : buffer->size())
+       << " bytes too small for " << array.length() << " values at offset "
+       << array.offset();
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+struct ValidateFullVisitor {
+  Status Visit(const NullArray&) { return Status::OK(); }
+
+  Status Visit(const PrimitiveArray& array) {
+    const int bit_width = static_cast<const FixedWidthType&>(*array.type()).bit_width();
+    const int64_t end = array.offset() + array.length();
+    return ValidateBufferSize(array, 1, BitUtil::BytesForBits(end * bit_width), "Values");
+  }
+
+  Status Visit(const BinaryArray& array) { return ValidateBinary(array, false); }
+
+  Status Visit(const StringArray& array) { return ValidateBinary(array, true); }
+
+  Status Visit(const LargeBinaryArray& array) { return ValidateBinary(array, false); }
+
+  Status Visit(const LargeStringArray& array) { return ValidateBinary(array, true); }
+
+  Status Visit(const StringViewArray& array) {
+    for (int64_t i = 0; i < array.length(); ++i) {
+      int32_t length;
+      const uint8_t* value = array.GetValue(i, &length);
+      if (!array.IsNull(i) && !ValidateUTF8(value, length)) {
+        std::stringstream ss;
+        ss << "Invalid UTF-8 string at position " << i;
+        return Status::Invalid(ss.str());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ListArray& array) { return ValidateArrayFull(*array.values()); }
+
+  Status Visit(const LargeListArray& array) { return ValidateArrayFull(*array.values()); }
+
+  Status Visit(const StructArray& array) {
+    for (int i = 0; i < array.num_fields(); ++i) {
+      RETURN_NOT_OK(ValidateArrayFull(*array.field(i)));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const UnionArray& array) {
+    for (int i = 0; i < array.type()->num_children(); ++i) {
+      RETURN_NOT_OK(ValidateArrayFull(*array.child(i)));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) {
+    return ValidateArrayFull(*array.values());
+  }
+
+  Status Visit(const DictionaryArray& array) {
+    const Array& indices = *array.indices();
+    const int64_t dictionary_length = array.dictionary()->length();
+    RETURN_NOT_OK(ValidateArrayFull(*array.dictionary()));
+    RETURN_NOT_OK(ValidateArrayFull(indices));
+    switch (indices.type_id()) {
+      case Type::INT8:
+        return ValidateDictionaryIndices<Int8Type>(indices, dictionary_length);
+      case Type::INT16:
+        return ValidateDictionaryIndices<Int16Type>(indices, dictionary_length);
+      case Type::INT32:
+        return ValidateDictionaryIndices<Int32Type>(indices, dictionary_length);
+      case Type::INT64:
+        return ValidateDictionaryIndices<Int64Type>(indices, dictionary_length);
+      case Type::UINT8:
+        return ValidateDictionaryIndices<UInt8Type>(indices, dictionary_length);
+      case Type::UINT16:
+        return ValidateDictionaryIndices<UInt16Type>(indices, dictionary_length);
+      case Type::UINT32:
+        return ValidateDictionaryIndices<UInt32Type>(indices, dictionary_length);
+      case Type::UINT64:
+        return ValidateDictionaryIndices<UInt64Type>(indices, dictionary_length);
+      default:
+        return Status::Invalid("Dictionary indices must be integer type");
+    }
+  }
+
+ protected:
+  template <typename BinaryArrayType>
+  Status ValidateBinary(const BinaryArrayType& array, bool is_utf8) {
+    using offset_type = typename BinaryArrayType::TypeClass::offset_type;
+    if (array.length() == 0) {
+      return Status::OK();
+    }
+    const int64_t num_offsets = array.offset() + array.length() + 1;
+    RETURN_NOT_OK(ValidateBufferSize(
+        array, 1, num_offsets * static_cast<int64_t>(sizeof(offset_type)), "Offsets"));
+
+    const auto& data = array.value_data();
+    const int64_t data_size = data == nullptr ? 0 : data->size();
+    const offset_type* offsets = array.raw_value_offsets();
+    RETURN_NOT_OK(ValidateOffsets(offsets, array.length(), data_size));
+    if (is_utf8) {
+      return ValidateUTF8Values(array, offsets, data == nullptr ? nullptr : data->data());
+    }
+    return Status::OK();
+  }
+};
+
+}  // namespace internal
+
+Status ValidateArrayFull(const Array& array) {
+  RETURN_NOT_OK(ValidateArray(array));
+  const ArrayData& data = *array.data();
+  if (!data.buffers.empty() && data.buffers[0] != nullptr) {
+    RETURN_NOT_OK(internal::ValidateBufferSize(
+        array, 0, BitUtil::BytesForBits(data.offset + data.length), "Validity"));
+  }
+  internal::ValidateFullVisitor validate_visitor;
+  return VisitArrayInline(array, &validate_visitor);
+}
+
 // ----------------------------------------------------------------------
 // Loading from ArrayData
 
@@ -846,6 +1456,272 @@ std::vector<ArrayVector> RechunkArraysConsistently(
 
 }  // namespace internal
 
+// ----------------------------------------------------------------------
+// Concatenate arrays
+
+namespace {
+
+// Copy the values of arrays of the same type into newly allocated buffers,
+// sized upfront for all of them
+class ConcatenateImpl {
+ public:
+  ConcatenateImpl(const ArrayVector& arrays, MemoryPool* pool)
+      : arrays_(arrays), pool_(pool) {}
+
+  Status Concatenate(std::shared_ptr<ArrayData>* out) {
+    int64_t length = 0, null_count = 0;
+    for (const auto& array : arrays_) {
+      length += array->length();
+      null_count += array->null_count();
+    }
+    out_ = ArrayData::Make(arrays_[0]->type(), length, {nullptr}, null_count);
+    if (null_count > 0 && out_->type->id() != Type::NA) {
+      RETURN_NOT_OK(ConcatenateBitmaps(&out_->buffers[0]));
+    }
+    RETURN_NOT_OK(VisitTypeInline(*out_->type, this));
+    *out = std::move(out_);
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const FixedWidthType& type) {
+    const int bit_width = type.bit_width();
+    std::shared_ptr<Buffer> values;
+    if (bit_width == 1) {
+      RETURN_NOT_OK(ConcatenateBitmaps(&values, 1));
+    } else {
+      const int64_t byte_width = bit_width / 8;
+      RETURN_NOT_OK(AllocateBuffer(pool_, out_->length * byte_width, &values));
+      uint8_t* dest = values->mutable_data();
+      for (const auto& array : arrays_) {
+        if (array->length() > 0) {
+          const int64_t nbytes = array->length() * byte_width;
+          const uint8_t* src = array->data()->buffers[1]->data();
+          std::memcpy(dest, src + array->offset() * byte_width,
+                      static_cast<size_t>(nbytes));
+          dest += nbytes;
+        }
+      }
+    }
+    out_->buffers.push_back(values);
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) { return ConcatenateBinary<int32_t>(); }
+
+  Status Visit(const LargeBinaryType&) { return ConcatenateBinary<int64_t>(); }
+
+  Status Visit(const ListType&) { return ConcatenateList<ListArray>(); }
+
+  Status Visit(const LargeListType&) { return ConcatenateList<LargeListArray>(); }
+
+  // The entries are copied, their buffer indices shifted past the data buffers
+  // of the preceding arrays, whose data buffers are shared as they are
+  Status Visit(const StringViewType&) {
+    std::shared_ptr<Buffer> views;
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_->length * sizeof(StringViewEntry), &views));
+    auto dest = reinterpret_cast<StringViewEntry*>(views->mutable_data());
+    BufferVector data_buffers;
+    for (const auto& array : arrays_) {
+      const auto& view_array = static_cast<const StringViewArray&>(*array);
+      const auto buffer_base = static_cast<int32_t>(data_buffers.size());
+      for (int64_t i = 0; i < array->length(); ++i) {
+        *dest = view_array.GetView(i);
+        if (!dest->is_inline()) {
+          dest->ref.buffer_index += buffer_base;
+        }
+        ++dest;
+      }
+      for (int i = 0; i < view_array.num_data_buffers(); ++i) {
+        data_buffers.push_back(view_array.data_buffer(i));
+      }
+    }
+    out_->buffers.push_back(views);
+    out_->buffers.insert(out_->buffers.end(), data_buffers.begin(), data_buffers.end());
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    for (int i = 0; i < type.num_children(); ++i) {
+      ArrayVector fields(arrays_.size());
+      for (size_t j = 0; j < arrays_.size(); ++j) {
+        fields[j] = static_cast<const StructArray&>(*arrays_[j]).field(i);
+      }
+      std::shared_ptr<ArrayData> child;
+      RETURN_NOT_OK(ConcatenateImpl(fields, pool_).Concatenate(&child));
+      out_->child_data.push_back(child);
+    }
+    return Status::OK();
+  }
+
+  // The dictionary is part of the type, hence shared by all the arrays
+  Status Visit(const DictionaryType&) {
+    ArrayVector indices(arrays_.size());
+    for (size_t i = 0; i < arrays_.size(); ++i) {
+      indices[i] = static_cast<const DictionaryArray&>(*arrays_[i]).indices();
+    }
+    std::shared_ptr<ArrayData> indices_data;
+    RETURN_NOT_OK(ConcatenateImpl(indices, pool_).Concatenate(&indices_data));
+    out_->buffers = std::move(indices_data->buffers);
+    return Status::OK();
+  }
+
+  // Concatenate the runs spanned by the arrays, clipping those cut by a slice
+  Status Visit(const RunLengthEncodedType&) {
+    if (out_->length > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("Concatenated array too large for int32 run ends");
+    }
+    int64_t num_runs = 0;
+    for (const auto& array : arrays_) {
+      num_runs += static_cast<const RunLengthEncodedArray&>(*array).num_runs();
+    }
+    std::shared_ptr<Buffer> run_ends;
+    RETURN_NOT_OK(AllocateBuffer(pool_, num_runs * sizeof(int32_t), &run_ends));
+    auto dest = reinterpret_cast<int32_t*>(run_ends->mutable_data());
+    ArrayVector values(arrays_.size());
+    int32_t position = 0;
+    for (size_t i = 0; i < arrays_.size(); ++i) {
+      const auto& array = static_cast<const RunLengthEncodedArray&>(*arrays_[i]);
+      const int64_t first_run = array.first_run();
+      for (int64_t run = first_run; run < first_run + array.num_runs(); ++run) {
+        position += static_cast<int32_t>(array.run_length(run));
+        *dest++ = position;
+      }
+      values[i] = array.values()->Slice(first_run, array.num_runs());
+    }
+    std::shared_ptr<ArrayData> child;
+    RETURN_NOT_OK(ConcatenateImpl(values, pool_).Concatenate(&child));
+    out_->buffers.push_back(run_ends);
+    out_->child_data.push_back(child);
+    return Status::OK();
+  }
+
+  Status Visit(const UnionType&) {
+    return Status::NotImplemented("Concatenating union arrays");
+  }
+
+ private:
+  // Copy the validity bitmaps, or the values of boolean arrays (buffer_index 1)
+  Status ConcatenateBitmaps(std::shared_ptr<Buffer>* out, int buffer_index = 0) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, BitUtil::BytesForBits(out_->length), out));
+    uint8_t* dest = (*out)->mutable_data();
+    if ((*out)->size() > 0) {
+      // Zero the padding bits of the last byte
+      dest[(*out)->size() - 1] = 0;
+    }
+    int64_t position = 0;
+    for (const auto& array : arrays_) {
+      const auto& bitmap = array->data()->buffers[buffer_index];
+      if (bitmap) {
+        CopyBitmap(bitmap->data(), array->offset(), array->length(), dest, position);
+      } else {
+        FillBitmap(dest, position, array->length(), array->null_count() == 0);
+      }
+      position += array->length();
+    }
+    return Status::OK();
+  }
+
+  template <typename offset_type>
+  Status ConcatenateBinary() {
+    std::shared_ptr<Buffer> offsets, data;
+    std::vector<std::pair<offset_type, offset_type>> ranges;
+    RETURN_NOT_OK(ConcatenateOffsets(&offsets, &ranges));
+    const offset_type data_length =
+        reinterpret_cast<const offset_type*>(offsets->data())[out_->length];
+    RETURN_NOT_OK(AllocateBuffer(pool_, data_length, &data));
+    uint8_t* dest = data->mutable_data();
+    for (size_t i = 0; i < arrays_.size(); ++i) {
+      const offset_type nbytes = ranges[i].second - ranges[i].first;
+      if (nbytes > 0) {
+        std::memcpy(dest, arrays_[i]->data()->buffers[2]->data() + ranges[i].first,
+                    static_cast<size_t>(nbytes));
+        dest += nbytes;
+      }
+    }
+    out_->buffers.push_back(offsets);
+    out_->buffers.push_back(data);
+    return Status::OK();
+  }
+
+  template <typename ListArrayType>
+  Status ConcatenateList() {
+    using offset_type = typename ListArrayType::TypeClass::offset_type;
+    std::shared_ptr<Buffer> offsets;
+    std::vector<std::pair<offset_type, offset_type>> ranges;
+    RETURN_NOT_OK(ConcatenateOffsets(&offsets, &ranges));
+    ArrayVector values(arrays_.size());
+    for (size_t i = 0; i < arrays_.size(); ++i) {
+      values[i] = static_cast<const ListArrayType&>(*arrays_[i])
+                      .values()
+                      ->Slice(ranges[i].first, ranges[i].second - ranges[i].first);
+    }
+    std::shared_ptr<ArrayData> child;
+    RETURN_NOT_OK(ConcatenateImpl(values, pool_).Concatenate(&child));
+    out_->buffers.push_back(offsets);
+    out_->child_data.push_back(child);
+    return Status::OK();
+  }
+
+  // Rebase the offsets of binary and list arrays, and return the range of
+  // values each array spans
+  template <typename offset_type>
+  Status ConcatenateOffsets(std::shared_ptr<Buffer>* out,
+                            std::vector<std::pair<offset_type, offset_type>>* ranges) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, (out_->length + 1) * sizeof(offset_type), out));
+    auto dest = reinterpret_cast<offset_type*>((*out)->mutable_data());
+    int64_t values_length = 0;
+    dest[0] = 0;
+    for (const auto& array : arrays_) {
+      if (array->length() == 0) {
+        ranges->emplace_back(0, 0);
+        continue;
+      }
+      const offset_type* offsets =
+          reinterpret_cast<const offset_type*>(array->data()->buffers[1]->data()) +
+          array->offset();
+      const offset_type first = offsets[0];
+      if (values_length - first + offsets[array->length()] >
+          std::numeric_limits<offset_type>::max()) {
+        return Status::Invalid("Concatenated array too large for its offsets");
+      }
+      for (int64_t i = 1; i <= array->length(); ++i) {
+        dest[i] = static_cast<offset_type>(values_length + offsets[i] - first);
+      }
+      ranges->emplace_back(first, offsets[array->length()]);
+      values_length += offsets[array->length()] - first;
+      dest += array->length();
+    }
+    return Status::OK();
+  }
+
+  const ArrayVector& arrays_;
+  MemoryPool* pool_;
+  std::shared_ptr<ArrayData> out_;
+};
+
+}  // namespace
+
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out) {
+  if (arrays.size() == 0) {
+    return Status::Invalid("Must pass at least one array");
+  }
+  for (const auto& array : arrays) {
+    if (!array->type()->Equals(*arrays[0]->type())) {
+      std::stringstream ss;
+      ss << "Cannot concatenate arrays of types " << arrays[0]->type()->ToString()
+         << " and " << array->type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(ConcatenateImpl(arrays, pool).Concatenate(&data));
+  *out = MakeArray(data);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Instantiate templates
 
@@ -18,6 +18,7 @@
 #ifndef ARROW_ARRAY_H
 #define ARROW_ARRAY_H
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
@@ -280,9 +281,72 @@ class ARROW_EXPORT Array {
   }
 
  private:
+  friend class ArrayView;
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(Array);
 };
 
+/// \brief A non-owning window over a range of elements of an Array
+///
+/// Unlike Array::Slice, making a view allocates nothing and leaves the
+/// reference counts alone, so that streaming code can cut millions of small
+/// windows per second. The viewed array must outlive its views. ArrayEquals
+/// and PrettyPrint accept views; ToArray() makes an owning slice otherwise.
+class ARROW_EXPORT ArrayView {
+ public:
+  /// \brief View the whole array
+  explicit ArrayView(const Array& array)
+      : array_(&array), offset_(0), length_(array.length()) {}
+
+  /// \brief View length elements from offset, clamped to the end of the
+  /// array like Array::Slice
+  ArrayView(const Array& array, int64_t offset, int64_t length)
+      : array_(&array),
+        offset_(std::min(offset, array.length())),
+        length_(std::min(length, array.length() - offset_)) {}
+
+  const Array& array() const { return *array_; }
+
+  /// The position of the first element in the viewed array
+  int64_t offset() const { return offset_; }
+
+  int64_t length() const { return length_; }
+
+  const DataType& type() const { return *array_->data_->type; }
+
+  const ArrayData& data() const { return *array_->data_; }
+
+  /// \brief Return true if value at index of the view is null. Does not
+  /// boundscheck
+  bool IsNull(int64_t i) const { return array_->IsNull(offset_ + i); }
+
+  /// \brief Return true if value at index of the view is valid. Does not
+  /// boundscheck
+  bool IsValid(int64_t i) const { return !IsNull(i); }
+
+  /// \brief Return the values of buffer i starting at the first element of
+  /// the view, for buffers of fixed-width values
+  template <typename T>
+  const T* GetValues(int i) const {
+    const ArrayData& data = *array_->data_;
+    return reinterpret_cast<const T*>(data.buffers[i]->data()) + data.offset + offset_;
+  }
+
+  /// \brief View a range of this view, clamped to its end
+  ArrayView Slice(int64_t offset, int64_t length) const {
+    offset = std::min(offset, length_);
+    return ArrayView(*array_, offset_ + offset, std::min(length, length_ - offset));
+  }
+
+  /// \brief Make an owning zero-copy slice of the viewed range
+  std::shared_ptr<Array> ToArray() const { return array_->Slice(offset_, length_); }
+
+ private:
+  const Array* array_;
+  int64_t offset_;
+  int64_t length_;
+};
+
 using ArrayVector = std::vector<std::shared_ptr<Array>>;
 
 namespace internal {
@@ -431,6 +495,14 @@ class ARROW_EXPORT ListArray : public Array {
   /// \brief Return array object containing the list's values
   std::shared_ptr<Array> values() const;
 
+  /// \brief Return the values spanned by the lists of the array, without
+  /// copying
+  ///
+  /// The values are sliced from the first offset to the last one, so that
+  /// the offsets of the lists minus value_offset(0) index into them. Null
+  /// lists may still span values, which are kept.
+  std::shared_ptr<Array> Flatten() const;
+
   /// Note that this buffer does not account for any slice offset
   std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
 
@@ -454,6 +526,70 @@ class ARROW_EXPORT ListArray : public Array {
   std::shared_ptr<Array> values_;
 };
 
+// ----------------------------------------------------------------------
+// LargeListArray
+
+/// \brief Array of lists with 64-bit offsets into the child values
+class ARROW_EXPORT LargeListArray : public Array {
+ public:
+  using TypeClass = LargeListType;
+
+  explicit LargeListArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeListArray(const std::shared_ptr<DataType>& type, int64_t length,
+                 const std::shared_ptr<Buffer>& value_offsets,
+                 const std::shared_ptr<Array>& values,
+                 const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                 int64_t null_count = 0, int64_t offset = 0);
+
+  /// \brief Construct LargeListArray from array of offsets and child value
+  /// array
+  ///
+  /// \see ListArray::FromArrays
+  ///
+  /// \param[in] offsets Array containing n + 1 offsets encoding length and
+  /// size. Must be of int64 type
+  /// \param[in] values Array containing the values of the lists
+  /// \param[in] pool MemoryPool in case new offsets array needs to be
+  /// allocated because of null values
+  /// \param[out] out Will have length equal to offsets.length() - 1
+  static Status FromArrays(const Array& offsets, const Array& values, MemoryPool* pool,
+                           std::shared_ptr<Array>* out);
+
+  /// \brief Return array object containing the list's values
+  std::shared_ptr<Array> values() const { return values_; }
+
+  /// \brief Return the values spanned by the lists of the array, without
+  /// copying
+  ///
+  /// The values are sliced from the first offset to the last one, so that
+  /// the offsets of the lists minus value_offset(0) index into them. Null
+  /// lists may still span values, which are kept.
+  std::shared_ptr<Array> Flatten() const;
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
+
+  std::shared_ptr<DataType> value_type() const;
+
+  /// Return pointer to raw value offsets accounting for any slice offset
+  const int64_t* raw_value_offsets() const { return raw_value_offsets_ + data_->offset; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return raw_value_offsets_[i + data_->offset]; }
+  int64_t value_length(int64_t i) const {
+    i += data_->offset;
+    return raw_value_offsets_[i + 1] - raw_value_offsets_[i];
+  }
+
+ protected:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+  const int64_t* raw_value_offsets_;
+
+ private:
+  std::shared_ptr<Array> values_;
+};
+
 // ----------------------------------------------------------------------
 // Binary and String
 
@@ -544,6 +680,145 @@ class ARROW_EXPORT StringArray : public BinaryArray {
   }
 };
 
+/// \brief Array of variable-length bytes with 64-bit offsets into the data
+class ARROW_EXPORT LargeBinaryArray : public FlatArray {
+ public:
+  using TypeClass = LargeBinaryType;
+
+  explicit LargeBinaryArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeBinaryArray(int64_t length, const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+
+  // Return the pointer to the given elements bytes
+  const uint8_t* GetValue(int64_t i, int64_t* out_length) const {
+    // Account for base offset
+    i += data_->offset;
+
+    const int64_t pos = raw_value_offsets_[i];
+    *out_length = raw_value_offsets_[i + 1] - pos;
+    return raw_data_ + pos;
+  }
+
+  /// \brief Get binary value as a std::string
+  ///
+  /// \param i the value index
+  /// \return the value copied into a std::string
+  std::string GetString(int64_t i) const {
+    int64_t length = 0;
+    const uint8_t* bytes = GetValue(i, &length);
+    return std::string(reinterpret_cast<const char*>(bytes), static_cast<size_t>(length));
+  }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_offsets() const { return data_->buffers[1]; }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> value_data() const { return data_->buffers[2]; }
+
+  const int64_t* raw_value_offsets() const { return raw_value_offsets_ + data_->offset; }
+
+  // Neither of these functions will perform boundschecking
+  int64_t value_offset(int64_t i) const { return raw_value_offsets_[i + data_->offset]; }
+  int64_t value_length(int64_t i) const {
+    i += data_->offset;
+    return raw_value_offsets_[i + 1] - raw_value_offsets_[i];
+  }
+
+ protected:
+  // For subclasses
+  LargeBinaryArray() {}
+
+  /// Protected method for constructors
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  // Constructor that allows sub-classes/builders to propagate there logical type up the
+  // class hierarchy.
+  LargeBinaryArray(const std::shared_ptr<DataType>& type, int64_t length,
+                   const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+
+  const int64_t* raw_value_offsets_;
+  const uint8_t* raw_data_;
+};
+
+/// \brief Array of UTF-8 strings with 64-bit offsets into the data
+class ARROW_EXPORT LargeStringArray : public LargeBinaryArray {
+ public:
+  using TypeClass = LargeStringType;
+
+  explicit LargeStringArray(const std::shared_ptr<ArrayData>& data);
+
+  LargeStringArray(int64_t length, const std::shared_ptr<Buffer>& value_offsets,
+                   const std::shared_ptr<Buffer>& data,
+                   const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                   int64_t null_count = 0, int64_t offset = 0);
+};
+
+// ----------------------------------------------------------------------
+// String views
+
+/// \brief Array of UTF-8 strings stored as 16-byte StringViewEntry values
+///
+/// The buffers are the validity bitmap, the entries, then any number of data
+/// buffers holding the strings too long to be inlined in their entries.
+class ARROW_EXPORT StringViewArray : public FlatArray {
+ public:
+  using TypeClass = StringViewType;
+
+  explicit StringViewArray(const std::shared_ptr<ArrayData>& data);
+
+  StringViewArray(int64_t length, const std::shared_ptr<Buffer>& views,
+                  const BufferVector& data_buffers,
+                  const std::shared_ptr<Buffer>& null_bitmap = NULLPTR,
+                  int64_t null_count = 0, int64_t offset = 0);
+
+  const StringViewEntry& GetView(int64_t i) const {
+    return raw_views_[i + data_->offset];
+  }
+
+  // Return the pointer to the given elements bytes
+  const uint8_t* GetValue(int64_t i, int32_t* out_length) const {
+    const StringViewEntry& view = GetView(i);
+    *out_length = view.size;
+    return view.is_inline() ? view.inlined
+                            : raw_data_buffers_[view.ref.buffer_index] + view.ref.offset;
+  }
+
+  /// \brief Get the value as a std::string
+  ///
+  /// \param i the value index
+  /// \return the value copied into a std::string
+  std::string GetString(int64_t i) const {
+    int32_t length = 0;
+    const uint8_t* bytes = GetValue(i, &length);
+    return std::string(reinterpret_cast<const char*>(bytes), static_cast<size_t>(length));
+  }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> views() const { return data_->buffers[1]; }
+
+  const StringViewEntry* raw_views() const { return raw_views_ + data_->offset; }
+
+  int num_data_buffers() const { return static_cast<int>(raw_data_buffers_.size()); }
+
+  std::shared_ptr<Buffer> data_buffer(int i) const { return data_->buffers[i + 2]; }
+
+  /// \brief The data of all the data buffers, indexed like them
+  const uint8_t* const* raw_data_buffers() const { return raw_data_buffers_.data(); }
+
+ protected:
+  /// Protected method for constructors
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  const StringViewEntry* raw_views_;
+  std::vector<const uint8_t*> raw_data_buffers_;
+};
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -610,6 +885,17 @@ class ARROW_EXPORT StructArray : public Array {
   // count adjusted.
   std::shared_ptr<Array> field(int pos) const;
 
+  /// \brief Return the fields of the array, null where the struct is null
+  ///
+  /// Unlike field(), which ignores the validity of the struct, the validity
+  /// of each field is combined with it. Fields are returned without copying
+  /// when the struct has no nulls, or when they have none and share the
+  /// offset of the struct; otherwise only their validity is allocated.
+  ///
+  /// \param[in] pool the memory pool to allocate the validity from
+  /// \param[out] out the fields, sliced like the array
+  Status Flatten(MemoryPool* pool, std::vector<std::shared_ptr<Array>>* out) const;
+
  private:
   // For caching boxed child data
   mutable std::vector<std::shared_ptr<Array>> boxed_fields_;
@@ -741,6 +1027,74 @@ class ARROW_EXPORT DictionaryArray : public Array {
   std::shared_ptr<Array> indices_;
 };
 
+// ----------------------------------------------------------------------
+// Run-length encoded
+
+/// \brief Array of runs of equal values
+///
+/// The values child array holds one value per run and the run ends buffer
+/// the logical index past the last value of each run. Nulls are null values
+/// of the runs, the array itself has no validity bitmap. The offset and
+/// length of the array are logical, a slice shares the runs of its parent.
+class ARROW_EXPORT RunLengthEncodedArray : public Array {
+ public:
+  using TypeClass = RunLengthEncodedType;
+
+  explicit RunLengthEncodedArray(const std::shared_ptr<ArrayData>& data);
+
+  RunLengthEncodedArray(const std::shared_ptr<DataType>& type, int64_t length,
+                        const std::shared_ptr<Buffer>& run_ends,
+                        const std::shared_ptr<Array>& values, int64_t offset = 0);
+
+  /// \brief Construct RunLengthEncodedArray from run ends and run values
+  ///
+  /// \param[in] run_ends int32 array of strictly increasing, positive run
+  /// ends without nulls
+  /// \param[in] values Array with the value of each run
+  /// \param[out] out Will have length equal to the last run end
+  static Status FromArrays(const Array& run_ends, const Array& values,
+                           std::shared_ptr<Array>* out);
+
+  /// \brief Return array object containing the value of each run
+  std::shared_ptr<Array> values() const { return values_; }
+
+  /// Note that this buffer does not account for any slice offset
+  std::shared_ptr<Buffer> run_ends() const { return data_->buffers[1]; }
+
+  std::shared_ptr<DataType> value_type() const;
+
+  /// Return pointer to the raw run ends, which do not account for any slice offset
+  const int32_t* raw_run_ends() const { return raw_run_ends_; }
+
+  /// \brief Return the index of the run holding logical value i
+  ///
+  /// The index is relative to values(), and found by binary search
+  int64_t FindRun(int64_t i) const;
+
+  /// \brief The index of the first run spanned by the array
+  int64_t first_run() const { return first_run_; }
+
+  /// \brief The number of runs spanned by the array
+  int64_t num_runs() const { return num_runs_; }
+
+  /// \brief The number of values of run i within the array, i being relative
+  /// to values(). Does not perform boundschecking
+  int64_t run_length(int64_t i) const {
+    const int64_t begin = i == 0 ? 0 : raw_run_ends_[i - 1];
+    const int64_t end = raw_run_ends_[i];
+    return std::min(end, data_->offset + data_->length) -
+           std::max(begin, data_->offset);
+  }
+
+ private:
+  void SetData(const std::shared_ptr<ArrayData>& data);
+
+  const int32_t* raw_run_ends_;
+  int64_t first_run_;
+  int64_t num_runs_;
+  std::shared_ptr<Array> values_;
+};
+
 // ----------------------------------------------------------------------
 // extern templates and other details
 
@@ -772,6 +1126,37 @@ ARROW_EXTERN_TEMPLATE NumericArray<TimestampType>;
 ARROW_EXPORT
 Status ValidateArray(const Array& array);
 
+/// \brief Perform the checks of ValidateArray, then check the values of the
+/// array against its buffers
+///
+/// The buffers must be large enough for the values, binary offsets must
+/// increase within the bounds of their data, strings must be well-formed UTF-8
+/// and dictionary indices must lie within the dictionary. Children and
+/// dictionaries are checked recursively. The checks run without branches over
+/// blocks of values, so that compilers vectorize them, and only blocks found
+/// invalid are searched for the first invalid value.
+///
+/// Unlike ValidateArray, this makes accessing the values of the array safe,
+/// as required for data read from untrusted sources such as IPC peers.
+///
+/// \param array an Array instance
+/// \return Status
+ARROW_EXPORT
+Status ValidateArrayFull(const Array& array);
+
+/// \brief Concatenate arrays of the same type into a single contiguous array
+///
+/// The buffers of the result are allocated once for all the arrays. Union
+/// arrays are not supported.
+///
+/// \param[in] arrays the arrays to concatenate, at least one
+/// \param[in] pool memory pool to allocate the result from
+/// \param[out] out the concatenated array
+/// \return Status
+ARROW_EXPORT
+Status Concatenate(const ArrayVector& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out);
+
 }  // namespace arrow
 
 #endif  // ARROW_ARRAY_H
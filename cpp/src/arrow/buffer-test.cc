@@ -122,6 +122,68 @@ TEST(TestBuffer, ResizeOOM) {
 #endif
 }
 
+bool IsZero(const uint8_t* data, int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    if (data[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(TestBuffer, ResizeZeroed) {
+  PoolBuffer buf;
+  ASSERT_OK(buf.ResizeZeroed(100));
+  ASSERT_EQ(100, buf.size());
+  ASSERT_EQ(128, buf.capacity());
+  ASSERT_TRUE(IsZero(buf.data(), buf.capacity()));
+
+  std::memset(buf.mutable_data(), 0xFF, static_cast<size_t>(buf.capacity()));
+  ASSERT_OK(buf.ResizeZeroed(50));
+  ASSERT_EQ(128, buf.capacity());
+  ASSERT_TRUE(IsZero(buf.data() + 100, 28));
+  ASSERT_EQ(0xFF, buf.data()[99]);
+
+  // Zeroes from the previous size
+  ASSERT_OK(buf.ResizeZeroed(1000));
+  ASSERT_EQ(0xFF, buf.data()[49]);
+  ASSERT_TRUE(IsZero(buf.data() + 50, buf.capacity() - 50));
+}
+
+TEST(TestBuffer, ZeroPadding) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), 10, &buffer));
+  ASSERT_EQ(64, buffer->capacity());
+  ASSERT_TRUE(IsZero(buffer->data() + 10, 54));
+
+  PoolBuffer buf;
+  ASSERT_OK(buf.Resize(100));
+  std::memset(buf.mutable_data(), 0xFF, static_cast<size_t>(buf.capacity()));
+  buf.ZeroPadding();
+  ASSERT_EQ(0xFF, buf.data()[99]);
+  ASSERT_TRUE(IsZero(buf.data() + 100, 28));
+}
+
+TEST(TestBuffer, AllocateZeroedBuffer) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateZeroedBuffer(default_memory_pool(), 1000, &buffer));
+  ASSERT_EQ(1000, buffer->size());
+  ASSERT_TRUE(IsZero(buffer->data(), buffer->capacity()));
+
+  // Large enough to be mapped from the system and remapped when growing
+  const int64_t kLarge = 48 << 20;
+  PoolBuffer large;
+  ASSERT_OK(large.ResizeZeroed(kLarge));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large.data()) % 64);
+  ASSERT_TRUE(IsZero(large.data(), large.capacity()));
+  large.mutable_data()[0] = 1;
+  large.mutable_data()[kLarge - 1] = 2;
+  ASSERT_OK(large.ResizeZeroed(2 * kLarge));
+  ASSERT_EQ(1, large.data()[0]);
+  ASSERT_EQ(2, large.data()[kLarge - 1]);
+  ASSERT_TRUE(IsZero(large.data() + kLarge, kLarge));
+}
+
 TEST(TestBuffer, EqualsWithSameContent) {
   MemoryPool* pool = default_memory_pool();
   const int32_t bufferSize = 128 * 1024;
@@ -236,4 +298,28 @@ TEST(TestBufferBuilder, ResizeReserve) {
   ASSERT_EQ(128, builder.capacity());
 }
 
+TEST(TestBufferBuilder, Finish) {
+  const std::string data = "some data";
+  BufferBuilder builder;
+  std::shared_ptr<Buffer> out;
+
+  // The unused capacity is kept by default
+  ASSERT_OK(builder.Resize(1024));
+  ASSERT_OK(builder.Append(data.c_str(), 9));
+  const uint8_t* built = builder.data();
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_EQ(9, out->size());
+  ASSERT_EQ(1024, out->capacity());
+  ASSERT_EQ(built, out->data());
+  ASSERT_EQ(0, builder.length());
+  ASSERT_EQ(0, builder.capacity());
+
+  ASSERT_OK(builder.Resize(1024));
+  ASSERT_OK(builder.Append(data.c_str(), 9));
+  ASSERT_OK(builder.Finish(&out, true /* shrink_to_fit */));
+  ASSERT_EQ(9, out->size());
+  ASSERT_EQ(64, out->capacity());
+  ASSERT_EQ(0, memcmp(data.c_str(), out->data(), 9));
+}
+
 }  // namespace arrow
@@ -101,6 +101,23 @@ Status PoolBuffer::Reserve(const int64_t capacity) {
   return Status::OK();
 }
 
+Status PoolBuffer::ResizeZeroed(const int64_t new_size) {
+  if (!mutable_data_ && new_size > 0) {
+    const int64_t new_capacity = BitUtil::RoundUpToMultipleOf64(new_size);
+    RETURN_NOT_OK(pool_->AllocateZeroed(new_capacity, &mutable_data_));
+    data_ = mutable_data_;
+    capacity_ = new_capacity;
+    size_ = new_size;
+    return Status::OK();
+  }
+  const int64_t old_size = size_;
+  RETURN_NOT_OK(Resize(new_size, false));
+  if (old_size < capacity_) {
+    memset(mutable_data_ + old_size, 0, static_cast<size_t>(capacity_ - old_size));
+  }
+  return Status::OK();
+}
+
 Status PoolBuffer::Resize(const int64_t new_size, bool shrink_to_fit) {
   if (!shrink_to_fit || (new_size > size_)) {
     RETURN_NOT_OK(Reserve(new_size));
@@ -142,6 +159,15 @@ Status AllocateBuffer(MemoryPool* pool, const int64_t size,
                       std::shared_ptr<Buffer>* out) {
   auto buffer = std::make_shared<PoolBuffer>(pool);
   RETURN_NOT_OK(buffer->Resize(size));
+  buffer->ZeroPadding();
+  *out = buffer;
+  return Status::OK();
+}
+
+Status AllocateZeroedBuffer(MemoryPool* pool, const int64_t size,
+                            std::shared_ptr<Buffer>* out) {
+  auto buffer = std::make_shared<PoolBuffer>(pool);
+  RETURN_NOT_OK(buffer->ResizeZeroed(size));
   *out = buffer;
   return Status::OK();
 }
@@ -150,6 +176,7 @@ Status AllocateResizableBuffer(MemoryPool* pool, const int64_t size,
                                std::shared_ptr<ResizableBuffer>* out) {
   auto buffer = std::make_shared<PoolBuffer>(pool);
   RETURN_NOT_OK(buffer->Resize(size));
+  buffer->ZeroPadding();
   *out = buffer;
   return Status::OK();
 }
@@ -192,6 +192,14 @@ class ARROW_EXPORT ResizableBuffer : public MutableBuffer {
   /// It does not change buffer's reported size.
   virtual Status Reserve(const int64_t new_capacity) = 0;
 
+  /// Zero the padding between the size and the capacity, leaving the data
+  /// itself as it is
+  void ZeroPadding() {
+    if (capacity_ > size_) {
+      memset(mutable_data_ + size_, 0, static_cast<size_t>(capacity_ - size_));
+    }
+  }
+
   template <class T>
   Status TypedResize(const int64_t new_nb_elements, bool shrink_to_fit = true) {
     return Resize(sizeof(T) * new_nb_elements, shrink_to_fit);
@@ -215,6 +223,11 @@ class ARROW_EXPORT PoolBuffer : public ResizableBuffer {
   Status Resize(const int64_t new_size, bool shrink_to_fit = true) override;
   Status Reserve(const int64_t new_capacity) override;
 
+  /// Like Resize without shrinking, but zero the bytes from the previous size
+  /// up to the new capacity. A new buffer is allocated zeroed from the pool,
+  /// which may cost nothing for large ones.
+  Status ResizeZeroed(const int64_t new_size);
+
  private:
   MemoryPool* pool_;
 };
@@ -298,10 +311,15 @@ class ARROW_EXPORT BufferBuilder {
     size_ += length;
   }
 
-  Status Finish(std::shared_ptr<Buffer>* out) {
-    // Do not shrink to fit to avoid unneeded realloc
+  /// \brief Transfer the ownership of the built buffer and reset the builder
+  ///
+  /// \param[out] out the buffer, of size length()
+  /// \param shrink_to_fit reallocate the buffer to its size. By default the
+  /// unused capacity is kept, which avoids a final reallocation and copy
+  /// \return Status
+  Status Finish(std::shared_ptr<Buffer>* out, bool shrink_to_fit = false) {
     if (size_ > 0) {
-      RETURN_NOT_OK(buffer_->Resize(size_, false));
+      RETURN_NOT_OK(buffer_->Resize(size_, shrink_to_fit));
     }
     *out = buffer_;
     Reset();
@@ -357,6 +375,18 @@ class ARROW_EXPORT TypedBufferBuilder : public BufferBuilder {
                                 num_elements * sizeof(T));
   }
 
+  /// \brief Append values each increased by delta, as offsets rebased onto
+  /// the data appended so far, in a single vectorizable pass
+  void UnsafeAppendWithDelta(const T* arithmetic_values, int64_t num_elements, T delta) {
+    static_assert(std::is_arithmetic<T>::value,
+                  "Convenience buffer append only supports arithmetic types");
+    T* out = reinterpret_cast<T*>(data_ + size_);
+    for (int64_t i = 0; i < num_elements; ++i) {
+      out[i] = arithmetic_values[i] + delta;
+    }
+    size_ += num_elements * sizeof(T);
+  }
+
   const T* data() const { return reinterpret_cast<const T*>(data_); }
   int64_t length() const { return size_ / sizeof(T); }
   int64_t capacity() const { return capacity_ / sizeof(T); }
@@ -368,10 +398,27 @@ class ARROW_EXPORT TypedBufferBuilder : public BufferBuilder {
 /// \param[in] size size of buffer to allocate
 /// \param[out] out the allocated buffer (contains padding)
 ///
+/// Only the padding after size is zeroed, the data is left uninitialized.
+///
 /// \return Status message
 ARROW_EXPORT
 Status AllocateBuffer(MemoryPool* pool, const int64_t size, std::shared_ptr<Buffer>* out);
 
+/// \brief Allocate a fixed size mutable buffer from a memory pool, zeroed
+/// including the padding
+///
+/// Prefer it to AllocateBuffer followed by memset: pools can hand out pages
+/// fresh from the operating system, which are zero already.
+///
+/// \param[in] pool a memory pool
+/// \param[in] size size of buffer to allocate
+/// \param[out] out the allocated buffer (contains padding)
+///
+/// \return Status message
+ARROW_EXPORT
+Status AllocateZeroedBuffer(MemoryPool* pool, const int64_t size,
+                            std::shared_ptr<Buffer>* out);
+
 /// Allocate resizeable buffer from a memory pool
 ///
 /// \param[in] pool a memory pool
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/test-util.h"
+
+// Count the heap allocations, to report them per finished array. The global
+// allocation functions are replaced for the whole binary, so the benchmarks
+// counting allocations live here, apart from the builder benchmarks.
+static std::atomic<int64_t> num_heap_allocations(0);
+
+static void* CountedAllocate(size_t size) {
+  ++num_heap_allocations;
+  // malloc(0) may return nullptr, while operator new must not
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new(size_t size) { return CountedAllocate(size); }
+
+void* operator new[](size_t size) { return CountedAllocate(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return CountedAllocate(size);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+  return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+#endif
+
+namespace arrow {
+
+// Finish many small arrays into record batches and read their columns back, as
+// when streaming small batches
+static void BM_FinishSmallArrays(benchmark::State& state) {  // NOLINT non-const reference
+  const int kNumColumns = 4;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < kNumColumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+  }
+  auto schema = ::arrow::schema(fields);
+  std::vector<int64_t> data(16, 100);
+  Int64Builder builder;
+
+  int64_t num_allocations = 0;
+  while (state.KeepRunning()) {
+    const int64_t start_allocations = num_heap_allocations.load();
+    std::vector<std::shared_ptr<Array>> columns(kNumColumns);
+    for (auto& column : columns) {
+      ABORT_NOT_OK(builder.Append(data.data(), data.size(), nullptr));
+      ABORT_NOT_OK(builder.Finish(&column));
+    }
+    auto batch = RecordBatch::Make(schema, data.size(), std::move(columns));
+    for (int i = 0; i < kNumColumns; ++i) {
+      benchmark::DoNotOptimize(batch->column(i));
+    }
+    num_allocations += num_heap_allocations.load() - start_allocations;
+  }
+  state.SetItemsProcessed(state.iterations() * kNumColumns);
+  state.counters["allocations_per_array"] =
+      static_cast<double>(num_allocations) /
+      static_cast<double>(state.iterations() * kNumColumns);
+}
+
+BENCHMARK(BM_FinishSmallArrays);
+
+}  // namespace arrow
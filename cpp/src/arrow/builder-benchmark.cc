@@ -42,6 +42,43 @@ static void BM_BuildPrimitiveArrayNoNulls(
                           kFinalSize);
 }
 
+static void BM_BuildPrimitiveArrayValidBytes(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // 2 MiB block, one null every 16 values
+  std::vector<int64_t> data(256 * 1024, 100);
+  std::vector<uint8_t> valid_bytes(data.size());
+  for (size_t i = 0; i < valid_bytes.size(); ++i) {
+    valid_bytes[i] = i % 16 != 0;
+  }
+  while (state.KeepRunning()) {
+    Int64Builder builder;
+    for (int i = 0; i < kFinalSize; i++) {
+      ABORT_NOT_OK(builder.Append(data.data(), data.size(), valid_bytes.data()));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t) *
+                          kFinalSize);
+}
+
+static void BM_BuildBooleanArrayBytes(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<uint8_t> values(256 * 1024);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = i % 3 == 0;
+  }
+  while (state.KeepRunning()) {
+    BooleanBuilder builder;
+    for (int i = 0; i < kFinalSize; i++) {
+      ABORT_NOT_OK(builder.Append(values.data(), values.size()));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * kFinalSize);
+}
+
 static void BM_BuildVectorNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
   // 2 MiB block
@@ -77,6 +114,29 @@ static void BM_BuildAdaptiveIntNoNulls(
   state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t));
 }
 
+// Small integer IDs with some nulls, into a presized builder
+static void BM_BuildAdaptiveIntValidBytes(
+    benchmark::State& state) {  // NOLINT non-const reference
+  int64_t size = static_cast<int64_t>(std::numeric_limits<int16_t>::max()) * 256;
+  int64_t chunk_size = size / 8;
+  std::vector<int64_t> data;
+  std::vector<uint8_t> valid_bytes;
+  for (int64_t i = 0; i < size; i++) {
+    data.push_back(i % 30000);
+    valid_bytes.push_back(i % 16 != 0);
+  }
+  while (state.KeepRunning()) {
+    AdaptiveIntBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(size));
+    for (int64_t i = 0; i < size; i += chunk_size) {
+      ABORT_NOT_OK(builder.Append(data.data() + i, chunk_size, valid_bytes.data() + i));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(int64_t));
+}
+
 static void BM_BuildAdaptiveIntNoNullsScalarAppend(
     benchmark::State& state) {  // NOLINT non-const reference
   int64_t size = static_cast<int64_t>(std::numeric_limits<int16_t>::max()) * 256;
@@ -131,14 +191,184 @@ static void BM_BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * iterations * value.size());
 }
 
+static void BM_BuildBinaryArrayUnsafeAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+
+  std::string value = "1234567890";
+  while (state.KeepRunning()) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(iterations));
+    ABORT_NOT_OK(builder.ReserveData(iterations * value.size()));
+    for (int64_t i = 0; i < iterations; i++) {
+      builder.UnsafeAppend(value);
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+// Copy the strings of an existing array, as when concatenating batches
+static void BM_BuildBinaryArrayBulkAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+
+  std::string value = "1234567890";
+  BinaryBuilder source_builder;
+  for (int64_t i = 0; i < iterations; i++) {
+    ABORT_NOT_OK(source_builder.Append(value));
+  }
+  std::shared_ptr<Array> source;
+  ABORT_NOT_OK(source_builder.Finish(&source));
+  const auto& values = static_cast<const BinaryArray&>(*source);
+
+  while (state.KeepRunning()) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Append(values.raw_value_offsets(), values.value_data()->data(),
+                                values.length()));
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+// Strings of state.range(0) characters, state.range(1) percent of which are null
+static void BM_BuildStringArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const std::string value(static_cast<size_t>(state.range(0)), 'x');
+  const int64_t null_percent = state.range(1);
+
+  while (state.KeepRunning()) {
+    StringBuilder builder;
+    for (int64_t i = 0; i < iterations; i++) {
+      if (i % 100 < null_percent) {
+        ABORT_NOT_OK(builder.AppendNull());
+      } else {
+        ABORT_NOT_OK(builder.Append(value));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * iterations);
+}
+
+// Strings drawn from state.range(0) distinct values, as for low and high
+// cardinality categorical columns
+static void BM_BuildStringDictionaryArray(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const int64_t cardinality = state.range(0);
+  std::vector<std::string> values;
+  for (int64_t i = 0; i < cardinality; i++) {
+    values.push_back("value-" + std::to_string(i));
+  }
+
+  while (state.KeepRunning()) {
+    StringDictionaryBuilder builder(default_memory_pool());
+    for (int64_t i = 0; i < iterations; i++) {
+      // Visit the values in a scattered order
+      ABORT_NOT_OK(builder.Append(values[(i * 7919) % cardinality]));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * iterations);
+}
+
+// Lists of 0 to 7 int64 values, state.range(0) percent of which are null
+static void BM_BuildListArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const int64_t null_percent = state.range(0);
+  const std::vector<int64_t> data(8, 100);
+  int64_t num_values = 0;
+
+  while (state.KeepRunning()) {
+    ListBuilder builder(default_memory_pool(),
+                        std::unique_ptr<ArrayBuilder>(new Int64Builder()));
+    auto value_builder = static_cast<Int64Builder*>(builder.value_builder());
+    for (int64_t i = 0; i < iterations; i++) {
+      if (i % 100 < null_percent) {
+        ABORT_NOT_OK(builder.AppendNull());
+      } else {
+        ABORT_NOT_OK(builder.Append());
+        ABORT_NOT_OK(value_builder->Append(data.data(), i % 8, nullptr));
+        num_values += i % 8;
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * iterations);
+  const double num_lists = static_cast<double>(state.iterations() * iterations);
+  state.counters["values_per_list"] = static_cast<double>(num_values) / num_lists;
+}
+
+// Structs of an int64, a double and a string field, state.range(0) percent of
+// which are null
+static void BM_BuildStructArray(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 18;
+  const int64_t null_percent = state.range(0);
+  auto type = struct_({field("i", int64()), field("d", float64()), field("s", utf8())});
+  const std::string value = "1234567890";
+
+  while (state.KeepRunning()) {
+    std::unique_ptr<ArrayBuilder> tmp;
+    ABORT_NOT_OK(MakeBuilder(default_memory_pool(), type, &tmp));
+    auto builder = static_cast<StructBuilder*>(tmp.get());
+    auto int_builder = static_cast<Int64Builder*>(builder->field_builder(0));
+    auto double_builder = static_cast<DoubleBuilder*>(builder->field_builder(1));
+    auto string_builder = static_cast<StringBuilder*>(builder->field_builder(2));
+    for (int64_t i = 0; i < iterations; i++) {
+      const bool is_valid = i % 100 >= null_percent;
+      ABORT_NOT_OK(builder->Append(is_valid));
+      if (is_valid) {
+        ABORT_NOT_OK(int_builder->Append(i));
+        ABORT_NOT_OK(double_builder->Append(0.5));
+        ABORT_NOT_OK(string_builder->Append(value));
+      } else {
+        ABORT_NOT_OK(int_builder->AppendNull());
+        ABORT_NOT_OK(double_builder->AppendNull());
+        ABORT_NOT_OK(string_builder->AppendNull());
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder->Finish(&out));
+  }
+  state.SetItemsProcessed(state.iterations() * iterations);
+}
+
 BENCHMARK(BM_BuildPrimitiveArrayNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildPrimitiveArrayValidBytes)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBooleanArrayBytes)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildVectorNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildAdaptiveIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildAdaptiveIntValidBytes)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildAdaptiveIntNoNullsScalarAppend)
     ->Repetitions(3)
     ->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildAdaptiveUIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_BuildBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayUnsafeAppend)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayBulkAppend)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BuildStringArray)
+    ->ArgPair(4, 0)
+    ->ArgPair(32, 0)
+    ->ArgPair(256, 0)
+    ->ArgPair(32, 90)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildStringDictionaryArray)
+    ->Arg(16)
+    ->Arg(64 << 10)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildListArray)->Arg(0)->Arg(90)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildStructArray)->Arg(0)->Arg(90)->Unit(benchmark::kMicrosecond);
 
 }  // namespace arrow
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <limits>
 #include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -34,13 +35,19 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/cpu-info.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/hash-util.h"
 #include "arrow/util/hash.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/string-view-util.h"
+#include "arrow/visitor_inline.h"
 
 namespace arrow {
 
 using internal::AdaptiveIntBuilderBase;
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
 
 Status ArrayBuilder::AppendToBitmap(bool is_valid) {
   if (length_ == capacity_) {
@@ -64,12 +71,10 @@ Status ArrayBuilder::AppendToBitmap(const uint8_t* valid_bytes, int64_t length)
 Status ArrayBuilder::Init(int64_t capacity) {
   int64_t to_alloc = BitUtil::CeilByte(capacity) / 8;
   null_bitmap_ = std::make_shared<PoolBuffer>(pool_);
-  RETURN_NOT_OK(null_bitmap_->Resize(to_alloc));
-  // Buffers might allocate more then necessary to satisfy padding requirements
-  const int64_t byte_capacity = null_bitmap_->capacity();
+  // Zeroes the padding too
+  RETURN_NOT_OK(null_bitmap_->ResizeZeroed(to_alloc));
   capacity_ = capacity;
   null_bitmap_data_ = null_bitmap_->mutable_data();
-  memset(null_bitmap_data_, 0, static_cast<size_t>(byte_capacity));
   return Status::OK();
 }
 
@@ -79,15 +84,15 @@ Status ArrayBuilder::Resize(int64_t new_bits) {
   }
   int64_t new_bytes = BitUtil::CeilByte(new_bits) / 8;
   int64_t old_bytes = null_bitmap_->size();
-  RETURN_NOT_OK(null_bitmap_->Resize(new_bytes));
-  null_bitmap_data_ = null_bitmap_->mutable_data();
-  // The buffer might be overpadded to deal with padding according to the spec
-  const int64_t byte_capacity = null_bitmap_->capacity();
-  capacity_ = new_bits;
   if (old_bytes < new_bytes) {
-    memset(null_bitmap_data_ + old_bytes, 0,
-           static_cast<size_t>(byte_capacity - old_bytes));
+    // The buffer might be overpadded to deal with padding according to the
+    // spec, so the padding is zeroed too
+    RETURN_NOT_OK(null_bitmap_->ResizeZeroed(new_bytes));
+  } else {
+    RETURN_NOT_OK(null_bitmap_->Resize(new_bytes));
   }
+  null_bitmap_data_ = null_bitmap_->mutable_data();
+  capacity_ = new_bits;
   return Status::OK();
 }
 
@@ -131,90 +136,30 @@ void ArrayBuilder::UnsafeAppendToBitmap(const uint8_t* valid_bytes, int64_t leng
     UnsafeSetNotNull(length);
     return;
   }
-
-  int64_t byte_offset = length_ / 8;
-  int64_t bit_offset = length_ % 8;
-  uint8_t bitset = null_bitmap_data_[byte_offset];
-
-  for (int64_t i = 0; i < length; ++i) {
-    if (bit_offset == 8) {
-      bit_offset = 0;
-      null_bitmap_data_[byte_offset] = bitset;
-      byte_offset++;
-      // TODO: Except for the last byte, this shouldn't be needed
-      bitset = null_bitmap_data_[byte_offset];
-    }
-
-    if (valid_bytes[i]) {
-      bitset |= BitUtil::kBitmask[bit_offset];
-    } else {
-      bitset &= BitUtil::kFlippedBitmask[bit_offset];
-      ++null_count_;
-    }
-
-    bit_offset++;
-  }
-  if (bit_offset != 0) {
-    null_bitmap_data_[byte_offset] = bitset;
-  }
+  null_count_ += length - BytesToBitmap(valid_bytes, length, null_bitmap_data_, length_);
   length_ += length;
 }
 
 void ArrayBuilder::UnsafeAppendToBitmap(const std::vector<bool>& is_valid) {
-  int64_t byte_offset = length_ / 8;
-  int64_t bit_offset = length_ % 8;
-  uint8_t bitset = null_bitmap_data_[byte_offset];
-
   const int64_t length = static_cast<int64_t>(is_valid.size());
-
-  for (int64_t i = 0; i < length; ++i) {
-    if (bit_offset == 8) {
-      bit_offset = 0;
-      null_bitmap_data_[byte_offset] = bitset;
-      byte_offset++;
-      // TODO: Except for the last byte, this shouldn't be needed
-      bitset = null_bitmap_data_[byte_offset];
-    }
-
-    if (is_valid[i]) {
-      bitset |= BitUtil::kBitmask[bit_offset];
-    } else {
-      bitset &= BitUtil::kFlippedBitmask[bit_offset];
-      ++null_count_;
-    }
-
-    bit_offset++;
-  }
-  if (bit_offset != 0) {
-    null_bitmap_data_[byte_offset] = bitset;
-  }
+  null_count_ += length - BoolsToBitmap(is_valid, null_bitmap_data_, length_);
   length_ += length;
 }
 
 void ArrayBuilder::UnsafeSetNotNull(int64_t length) {
-  const int64_t new_length = length + length_;
-
-  // Fill up the bytes until we have a byte alignment
-  int64_t pad_to_byte = std::min<int64_t>(8 - (length_ % 8), length);
-
-  if (pad_to_byte == 8) {
-    pad_to_byte = 0;
-  }
-  for (int64_t i = length_; i < length_ + pad_to_byte; ++i) {
-    BitUtil::SetBit(null_bitmap_data_, i);
-  }
-
-  // Fast bitsetting
-  int64_t fast_length = (length - pad_to_byte) / 8;
-  memset(null_bitmap_data_ + ((length_ + pad_to_byte) / 8), 0xFF,
-         static_cast<size_t>(fast_length));
+  FillBitmap(null_bitmap_data_, length_, length, true);
+  length_ += length;
+}
 
-  // Trailing bytes
-  for (int64_t i = length_ + pad_to_byte + (fast_length * 8); i < new_length; ++i) {
-    BitUtil::SetBit(null_bitmap_data_, i);
+void ArrayBuilder::UnsafeAppendBitmap(const uint8_t* bitmap, int64_t offset,
+                                      int64_t length) {
+  if (bitmap == nullptr) {
+    UnsafeSetNotNull(length);
+    return;
   }
-
-  length_ = new_length;
+  CopyBitmap(bitmap, offset, length, null_bitmap_data_, length_);
+  null_count_ += length - CountSetBits(bitmap, offset, length);
+  length_ += length;
 }
 
 // ----------------------------------------------------------------------
@@ -234,9 +179,8 @@ Status PrimitiveBuilder<T>::Init(int64_t capacity) {
   data_ = std::make_shared<PoolBuffer>(pool_);
 
   int64_t nbytes = TypeTraits<T>::bytes_required(capacity);
-  RETURN_NOT_OK(data_->Resize(nbytes));
-  // TODO(emkornfield) valgrind complains without this
-  memset(data_->mutable_data(), 0, static_cast<size_t>(nbytes));
+  // TODO(emkornfield) valgrind complains without zeroing
+  RETURN_NOT_OK(data_->ResizeZeroed(nbytes));
 
   raw_data_ = reinterpret_cast<value_type*>(data_->mutable_data());
   return Status::OK();
@@ -308,6 +252,36 @@ Status PrimitiveBuilder<T>::Append(const std::vector<value_type>& values) {
   return Append(values.data(), static_cast<int64_t>(values.size()));
 }
 
+template <typename T>
+Status PrimitiveBuilder<T>::FinishAdopting(const std::shared_ptr<Buffer>& values,
+                                           int64_t length,
+                                           const std::shared_ptr<Buffer>& null_bitmap,
+                                           std::shared_ptr<Array>* out) {
+  if (values->size() < TypeTraits<T>::bytes_required(length) ||
+      (null_bitmap && null_bitmap->size() < BitUtil::BytesForBits(length))) {
+    std::stringstream ss;
+    ss << "Buffers too small for " << length << " values";
+    return Status::Invalid(ss.str());
+  }
+  if (length_ > 0) {
+    RETURN_NOT_OK(Reserve(length));
+    std::memcpy(raw_data_ + length_, values->data(),
+                static_cast<std::size_t>(TypeTraits<T>::bytes_required(length)));
+    UnsafeAppendBitmap(null_bitmap ? null_bitmap->data() : nullptr, 0, length);
+    return Finish(out);
+  }
+
+  const int64_t null_count =
+      null_bitmap ? length - CountSetBits(null_bitmap->data(), 0, length) : 0;
+  *out = MakeArray(ArrayData::Make(type_, length, {null_count > 0 ? null_bitmap : nullptr,
+                                                   values},
+                                   null_count));
+  data_ = nullptr;
+  raw_data_ = nullptr;
+  Reset();
+  return Status::OK();
+}
+
 template <typename T>
 Status PrimitiveBuilder<T>::FinishInternal(std::shared_ptr<ArrayData>* out) {
   const int64_t bytes_required = TypeTraits<T>::bytes_required(length_);
@@ -315,7 +289,10 @@ Status PrimitiveBuilder<T>::FinishInternal(std::shared_ptr<ArrayData>* out) {
     // Trim buffers
     RETURN_NOT_OK(data_->Resize(bytes_required));
   }
-  *out = ArrayData::Make(type_, length_, {null_bitmap_, data_}, null_count_);
+  *out = ArrayData::Make(type_, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(data_)),
+                         null_count_);
 
   data_ = null_bitmap_ = nullptr;
   capacity_ = length_ = null_count_ = 0;
@@ -339,6 +316,144 @@ template class PrimitiveBuilder<HalfFloatType>;
 template class PrimitiveBuilder<FloatType>;
 template class PrimitiveBuilder<DoubleType>;
 
+namespace {
+
+// ----------------------------------------------------------------------
+// Vectorizable loops of the adaptive integer builders
+//
+// Like the compute kernels, these are compiled for each instruction set
+// supported by DynamicDispatch. The width needed by a block of values comes
+// from a single OR reduction: a signed value fits in N bits when its magnitude
+// bits, v ^ (v >> 63), fit in N - 1 bits. Nulls are masked out.
+
+#define ADAPTIVE_INT_LOOPS(SUFFIX, TARGET_ATTR)                                      \
+  TARGET_ATTR uint64_t IntMagnitudeBits##SUFFIX(                                     \
+      const int64_t* values, const uint8_t* valid_bytes, int64_t length) {           \
+    uint64_t bits = 0;                                                               \
+    if (valid_bytes == nullptr) {                                                    \
+      for (int64_t i = 0; i < length; ++i) {                                         \
+        bits |= static_cast<uint64_t>(values[i] ^ (values[i] >> 63));                \
+      }                                                                              \
+    } else {                                                                         \
+      for (int64_t i = 0; i < length; ++i) {                                         \
+        const uint64_t mask = 0 - static_cast<uint64_t>(valid_bytes[i] != 0);        \
+        bits |= static_cast<uint64_t>(values[i] ^ (values[i] >> 63)) & mask;         \
+      }                                                                              \
+    }                                                                                \
+    return bits;                                                                     \
+  }                                                                                  \
+                                                                                     \
+  TARGET_ATTR uint64_t UIntBits##SUFFIX(const uint64_t* values,                      \
+                                        const uint8_t* valid_bytes, int64_t length) { \
+    uint64_t bits = 0;                                                               \
+    if (valid_bytes == nullptr) {                                                    \
+      for (int64_t i = 0; i < length; ++i) {                                         \
+        bits |= values[i];                                                           \
+      }                                                                              \
+    } else {                                                                         \
+      for (int64_t i = 0; i < length; ++i) {                                         \
+        bits |= values[i] & (0 - static_cast<uint64_t>(valid_bytes[i] != 0));        \
+      }                                                                              \
+    }                                                                                \
+    return bits;                                                                     \
+  }                                                                                  \
+                                                                                     \
+  template <typename Out, typename In>                                               \
+  TARGET_ATTR void NarrowValues##SUFFIX(const In* values, int64_t length, Out* out) { \
+    for (int64_t i = 0; i < length; ++i) {                                           \
+      out[i] = static_cast<Out>(values[i]);                                          \
+    }                                                                                \
+  }
+
+ADAPTIVE_INT_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ADAPTIVE_INT_LOOPS(Sse42, ARROW_TARGET_SSE4_2)
+ADAPTIVE_INT_LOOPS(Avx2, ARROW_TARGET_AVX2)
+ADAPTIVE_INT_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef ADAPTIVE_INT_LOOPS
+
+template <typename T>
+struct IntBitsDynamic {
+  using FunctionType = uint64_t (*)(const T*, const uint8_t*, int64_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations();
+};
+
+template <>
+std::vector<std::pair<DispatchLevel, IntBitsDynamic<int64_t>::FunctionType>>
+IntBitsDynamic<int64_t>::implementations() {
+  return {
+      {DispatchLevel::NONE, IntMagnitudeBitsDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+      {DispatchLevel::SSE4_2, IntMagnitudeBitsSse42},
+      {DispatchLevel::AVX2, IntMagnitudeBitsAvx2},
+      {DispatchLevel::AVX512, IntMagnitudeBitsAvx512},
+#endif
+  };
+}
+
+template <>
+std::vector<std::pair<DispatchLevel, IntBitsDynamic<uint64_t>::FunctionType>>
+IntBitsDynamic<uint64_t>::implementations() {
+  return {
+      {DispatchLevel::NONE, UIntBitsDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+      {DispatchLevel::SSE4_2, UIntBitsSse42},
+      {DispatchLevel::AVX2, UIntBitsAvx2},
+      {DispatchLevel::AVX512, UIntBitsAvx512},
+#endif
+  };
+}
+
+template <typename Out, typename In>
+struct NarrowValuesDynamic {
+  using FunctionType = void (*)(const In*, int64_t, Out*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, NarrowValuesDefault<Out, In>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, NarrowValuesSse42<Out, In>},
+        {DispatchLevel::AVX2, NarrowValuesAvx2<Out, In>},
+        {DispatchLevel::AVX512, NarrowValuesAvx512<Out, In>},
+#endif
+    };
+  }
+};
+
+// The OR of the magnitude bits of the valid values (their bits if unsigned)
+template <typename T>
+uint64_t IntBits(const T* values, const uint8_t* valid_bytes, int64_t length) {
+  static DynamicDispatch<IntBitsDynamic<T>> int_bits;
+  return int_bits.func(values, valid_bytes, length);
+}
+
+// The smallest integer size holding values whose IntBits are bits
+template <typename T>
+uint8_t IntSizeForBits(uint64_t bits) {
+  // Signed values have one bit less for their magnitude
+  const int shift = std::is_signed<T>::value ? 1 : 0;
+  if (bits <= (0xFFULL >> shift)) {
+    return 1;
+  } else if (bits <= (0xFFFFULL >> shift)) {
+    return 2;
+  } else if (bits <= (0xFFFFFFFFULL >> shift)) {
+    return 4;
+  }
+  return 8;
+}
+
+template <typename Out, typename In>
+void NarrowValues(const In* values, int64_t length, Out* out) {
+  static DynamicDispatch<NarrowValuesDynamic<Out, In>> narrow_values;
+  narrow_values.func(values, length, out);
+}
+
+}  // namespace
+
 AdaptiveIntBuilderBase::AdaptiveIntBuilderBase(MemoryPool* pool)
     : ArrayBuilder(int64(), pool), data_(nullptr), raw_data_(nullptr), int_size_(1) {}
 
@@ -347,9 +462,8 @@ Status AdaptiveIntBuilderBase::Init(int64_t capacity) {
   data_ = std::make_shared<PoolBuffer>(pool_);
 
   int64_t nbytes = capacity * int_size_;
-  RETURN_NOT_OK(data_->Resize(nbytes));
-  // TODO(emkornfield) valgrind complains without this
-  memset(data_->mutable_data(), 0, static_cast<size_t>(nbytes));
+  // TODO(emkornfield) valgrind complains without zeroing
+  RETURN_NOT_OK(data_->ResizeZeroed(nbytes));
 
   raw_data_ = reinterpret_cast<uint8_t*>(data_->mutable_data());
   return Status::OK();
@@ -404,7 +518,10 @@ Status AdaptiveIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
       return Status::NotImplemented("Only ints of size 1,2,4,8 are supported");
   }
 
-  *out = ArrayData::Make(output_type, length_, {null_bitmap_, data_}, null_count_);
+  *out = ArrayData::Make(output_type, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(data_)),
+                         null_count_);
 
   data_ = null_bitmap_ = nullptr;
   capacity_ = length_ = null_count_ = 0;
@@ -415,51 +532,31 @@ Status AdaptiveIntBuilder::Append(const int64_t* values, int64_t length,
                                   const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
-  if (length > 0) {
-    if (int_size_ < 8) {
-      uint8_t new_int_size = int_size_;
-      for (int64_t i = 0; i < length; i++) {
-        if (valid_bytes == nullptr || valid_bytes[i]) {
-          new_int_size = internal::ExpandedIntSize(values[i], new_int_size);
-        }
-      }
-      if (new_int_size != int_size_) {
-        RETURN_NOT_OK(ExpandIntSize(new_int_size));
-      }
+  if (length > 0 && int_size_ < 8) {
+    // Widen once for the whole block
+    const uint8_t new_int_size = std::max(
+        int_size_, IntSizeForBits<int64_t>(IntBits(values, valid_bytes, length)));
+    if (new_int_size != int_size_) {
+      RETURN_NOT_OK(ExpandIntSize(new_int_size));
     }
   }
 
-  if (int_size_ == 8) {
-    std::memcpy(reinterpret_cast<int64_t*>(raw_data_) + length_, values,
-                sizeof(int64_t) * length);
-  } else {
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif
-    // int_size_ may have changed, so we need to recheck
-    switch (int_size_) {
-      case 1: {
-        int8_t* data_ptr = reinterpret_cast<int8_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](int64_t x) { return static_cast<int8_t>(x); });
-      } break;
-      case 2: {
-        int16_t* data_ptr = reinterpret_cast<int16_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](int64_t x) { return static_cast<int16_t>(x); });
-      } break;
-      case 4: {
-        int32_t* data_ptr = reinterpret_cast<int32_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](int64_t x) { return static_cast<int32_t>(x); });
-      } break;
-      default:
-        DCHECK(false);
-    }
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+  switch (int_size_) {
+    case 1:
+      NarrowValues(values, length, reinterpret_cast<int8_t*>(raw_data_) + length_);
+      break;
+    case 2:
+      NarrowValues(values, length, reinterpret_cast<int16_t*>(raw_data_) + length_);
+      break;
+    case 4:
+      NarrowValues(values, length, reinterpret_cast<int32_t*>(raw_data_) + length_);
+      break;
+    case 8:
+      std::memcpy(reinterpret_cast<int64_t*>(raw_data_) + length_, values,
+                  sizeof(int64_t) * length);
+      break;
+    default:
+      DCHECK(false);
   }
 
   // length_ is update by these
@@ -560,7 +657,10 @@ Status AdaptiveUIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
       return Status::NotImplemented("Only ints of size 1,2,4,8 are supported");
   }
 
-  *out = ArrayData::Make(output_type, length_, {null_bitmap_, data_}, null_count_);
+  *out = ArrayData::Make(output_type, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(data_)),
+                         null_count_);
 
   data_ = null_bitmap_ = nullptr;
   capacity_ = length_ = null_count_ = 0;
@@ -571,51 +671,31 @@ Status AdaptiveUIntBuilder::Append(const uint64_t* values, int64_t length,
                                    const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
 
-  if (length > 0) {
-    if (int_size_ < 8) {
-      uint8_t new_int_size = int_size_;
-      for (int64_t i = 0; i < length; i++) {
-        if (valid_bytes == nullptr || valid_bytes[i]) {
-          new_int_size = internal::ExpandedUIntSize(values[i], new_int_size);
-        }
-      }
-      if (new_int_size != int_size_) {
-        RETURN_NOT_OK(ExpandIntSize(new_int_size));
-      }
+  if (length > 0 && int_size_ < 8) {
+    // Widen once for the whole block
+    const uint8_t new_int_size = std::max(
+        int_size_, IntSizeForBits<uint64_t>(IntBits(values, valid_bytes, length)));
+    if (new_int_size != int_size_) {
+      RETURN_NOT_OK(ExpandIntSize(new_int_size));
     }
   }
 
-  if (int_size_ == 8) {
-    std::memcpy(reinterpret_cast<uint64_t*>(raw_data_) + length_, values,
-                sizeof(uint64_t) * length);
-  } else {
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#endif
-    // int_size_ may have changed, so we need to recheck
-    switch (int_size_) {
-      case 1: {
-        uint8_t* data_ptr = reinterpret_cast<uint8_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](uint64_t x) { return static_cast<uint8_t>(x); });
-      } break;
-      case 2: {
-        uint16_t* data_ptr = reinterpret_cast<uint16_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](uint64_t x) { return static_cast<uint16_t>(x); });
-      } break;
-      case 4: {
-        uint32_t* data_ptr = reinterpret_cast<uint32_t*>(raw_data_) + length_;
-        std::transform(values, values + length, data_ptr,
-                       [](uint64_t x) { return static_cast<uint32_t>(x); });
-      } break;
-      default:
-        DCHECK(false);
-    }
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+  switch (int_size_) {
+    case 1:
+      NarrowValues(values, length, reinterpret_cast<uint8_t*>(raw_data_) + length_);
+      break;
+    case 2:
+      NarrowValues(values, length, reinterpret_cast<uint16_t*>(raw_data_) + length_);
+      break;
+    case 4:
+      NarrowValues(values, length, reinterpret_cast<uint32_t*>(raw_data_) + length_);
+      break;
+    case 8:
+      std::memcpy(reinterpret_cast<uint64_t*>(raw_data_) + length_, values,
+                  sizeof(uint64_t) * length);
+      break;
+    default:
+      DCHECK(false);
   }
 
   // length_ is update by these
@@ -701,9 +781,8 @@ Status BooleanBuilder::Init(int64_t capacity) {
   data_ = std::make_shared<PoolBuffer>(pool_);
 
   int64_t nbytes = BitUtil::BytesForBits(capacity);
-  RETURN_NOT_OK(data_->Resize(nbytes));
-  // TODO(emkornfield) valgrind complains without this
-  memset(data_->mutable_data(), 0, static_cast<size_t>(nbytes));
+  // TODO(emkornfield) valgrind complains without zeroing
+  RETURN_NOT_OK(data_->ResizeZeroed(nbytes));
 
   raw_data_ = reinterpret_cast<uint8_t*>(data_->mutable_data());
   return Status::OK();
@@ -737,7 +816,10 @@ Status BooleanBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
     // Trim buffers
     RETURN_NOT_OK(data_->Resize(bytes_required));
   }
-  *out = ArrayData::Make(boolean(), length_, {null_bitmap_, data_}, null_count_);
+  *out = ArrayData::Make(boolean(), length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(data_)),
+                         null_count_);
 
   data_ = null_bitmap_ = nullptr;
   capacity_ = length_ = null_count_ = 0;
@@ -747,10 +829,7 @@ Status BooleanBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
 Status BooleanBuilder::Append(const uint8_t* values, int64_t length,
                               const uint8_t* valid_bytes) {
   RETURN_NOT_OK(Reserve(length));
-
-  for (int64_t i = 0; i < length; ++i) {
-    BitUtil::SetBitTo(raw_data_, length_ + i, values[i] != 0);
-  }
+  BytesToBitmap(values, length, raw_data_, length_);
 
   // this updates length_
   ArrayBuilder::UnsafeAppendToBitmap(valid_bytes, length);
@@ -761,10 +840,7 @@ Status BooleanBuilder::Append(const uint8_t* values, int64_t length,
                               const std::vector<bool>& is_valid) {
   RETURN_NOT_OK(Reserve(length));
   DCHECK_EQ(length, static_cast<int64_t>(is_valid.size()));
-
-  for (int64_t i = 0; i < length; ++i) {
-    BitUtil::SetBitTo(raw_data_, length_ + i, values[i] != 0);
-  }
+  BytesToBitmap(values, length, raw_data_, length_);
 
   // this updates length_
   ArrayBuilder::UnsafeAppendToBitmap(is_valid);
@@ -785,10 +861,7 @@ Status BooleanBuilder::Append(const std::vector<bool>& values,
   const int64_t length = static_cast<int64_t>(values.size());
   RETURN_NOT_OK(Reserve(length));
   DCHECK_EQ(length, static_cast<int64_t>(is_valid.size()));
-
-  for (int64_t i = 0; i < length; ++i) {
-    BitUtil::SetBitTo(raw_data_, length_ + i, values[i]);
-  }
+  BoolsToBitmap(values, raw_data_, length_);
 
   // this updates length_
   ArrayBuilder::UnsafeAppendToBitmap(is_valid);
@@ -798,10 +871,7 @@ Status BooleanBuilder::Append(const std::vector<bool>& values,
 Status BooleanBuilder::Append(const std::vector<bool>& values) {
   const int64_t length = static_cast<int64_t>(values.size());
   RETURN_NOT_OK(Reserve(length));
-
-  for (int64_t i = 0; i < length; ++i) {
-    BitUtil::SetBitTo(raw_data_, length_ + i, values[i]);
-  }
+  BoolsToBitmap(values, raw_data_, length_);
 
   ArrayBuilder::UnsafeSetNotNull(length);
   return Status::OK();
@@ -860,8 +930,8 @@ Status DictionaryBuilder<T>::Init(int64_t elements) {
   hash_table_size_ = kInitialHashTableSize;
   entry_id_offset_ = 0;
   mod_bitmask_ = kInitialHashTableSize - 1;
-  hash_table_load_threshold_ =
-      static_cast<int64_t>(static_cast<double>(elements) * kMaxHashTableLoad);
+  hash_table_load_threshold_ = static_cast<int64_t>(
+      static_cast<double>(kInitialHashTableSize) * kMaxHashTableLoad);
 
   return values_builder_.Init(elements);
 }
@@ -919,7 +989,8 @@ Status DictionaryBuilder<T>::Append(const Scalar& value) {
     hash_slots_[j] = index;
     RETURN_NOT_OK(AppendDictionary(value));
 
-    if (ARROW_PREDICT_FALSE(static_cast<int32_t>(dict_builder_.length()) >
+    // The table holds the entries of the previous dictionaries too
+    if (ARROW_PREDICT_FALSE(dict_builder_.length() + entry_id_offset_ >
                             hash_table_load_threshold_)) {
       RETURN_NOT_OK(DoubleTableSize());
     }
@@ -976,8 +1047,8 @@ Status DictionaryBuilder<NullType>::AppendNull() { return values_builder_.Append
 
 template <typename T>
 Status DictionaryBuilder<T>::DoubleTableSize() {
-#define INNER_LOOP                                                               \
-  Scalar value = GetDictionaryValue(dict_builder_, static_cast<int64_t>(index)); \
+#define INNER_LOOP                                            \
+  Scalar value = GetMemoValue(static_cast<int64_t>(index)); \
   int64_t j = HashValue(value) & new_mod_bitmask;
 
   DOUBLE_TABLE_SIZE(, INNER_LOOP);
@@ -992,6 +1063,14 @@ typename DictionaryBuilder<T>::Scalar DictionaryBuilder<T>::GetDictionaryValue(
   return data[index];
 }
 
+template <typename T>
+typename DictionaryBuilder<T>::Scalar DictionaryBuilder<T>::GetMemoValue(int64_t index) {
+  if (index < entry_id_offset_) {
+    return GetDictionaryValue(overflow_dict_builder_, index);
+  }
+  return GetDictionaryValue(dict_builder_, index - entry_id_offset_);
+}
+
 template <typename T>
 Status DictionaryBuilder<T>::FinishInternal(std::shared_ptr<ArrayData>* out) {
   entry_id_offset_ += dict_builder_.length();
@@ -1059,34 +1138,14 @@ int64_t DictionaryBuilder<FixedSizeBinaryType>::HashValue(const Scalar& value) {
 
 template <typename T>
 bool DictionaryBuilder<T>::SlotDifferent(hash_slot_t index, const Scalar& value) {
-  const bool value_found =
-      index >= entry_id_offset_ &&
-      GetDictionaryValue(dict_builder_, static_cast<int64_t>(index - entry_id_offset_)) ==
-          value;
-  const bool value_found_overflow =
-      entry_id_offset_ > 0 &&
-      GetDictionaryValue(overflow_dict_builder_, static_cast<int64_t>(index)) == value;
-  return !(value_found || value_found_overflow);
+  return !(GetMemoValue(static_cast<int64_t>(index)) == value);
 }
 
 template <>
 bool DictionaryBuilder<FixedSizeBinaryType>::SlotDifferent(hash_slot_t index,
                                                            const Scalar& value) {
-  int32_t width = static_cast<const FixedSizeBinaryType&>(*type_).byte_width();
-  bool value_found = false;
-  if (index >= entry_id_offset_) {
-    const Scalar other =
-        GetDictionaryValue(dict_builder_, static_cast<int64_t>(index - entry_id_offset_));
-    value_found = memcmp(other, value, width) == 0;
-  }
-
-  bool value_found_overflow = false;
-  if (entry_id_offset_ > 0) {
-    const Scalar other_overflow =
-        GetDictionaryValue(overflow_dict_builder_, static_cast<int64_t>(index));
-    value_found_overflow = memcmp(other_overflow, value, width) == 0;
-  }
-  return !(value_found || value_found_overflow);
+  const Scalar other = GetMemoValue(static_cast<int64_t>(index));
+  return memcmp(other, value, byte_width_) != 0;
 }
 
 template <typename T>
@@ -1099,8 +1158,7 @@ Status DictionaryBuilder<T>::AppendDictionary(const Scalar& value) {
   WrappedBinary DictionaryBuilder<Type>::GetDictionaryValue(                           \
       typename TypeTraits<Type>::BuilderType& dictionary_builder, int64_t index) {     \
     int32_t v_len;                                                                     \
-    const uint8_t* v = dictionary_builder.GetValue(                                    \
-        static_cast<int64_t>(index - entry_id_offset_), &v_len);                       \
+    const uint8_t* v = dictionary_builder.GetValue(index, &v_len);                     \
     return WrappedBinary(v, v_len);                                                    \
   }                                                                                    \
                                                                                        \
@@ -1132,24 +1190,9 @@ Status DictionaryBuilder<T>::AppendDictionary(const Scalar& value) {
   template <>                                                                          \
   bool DictionaryBuilder<Type>::SlotDifferent(hash_slot_t index,                       \
                                               const WrappedBinary& value) {            \
-    int32_t other_length;                                                              \
-    bool value_found = false;                                                          \
-    if (index >= entry_id_offset_) {                                                   \
-      const uint8_t* other_value = dict_builder_.GetValue(                             \
-          static_cast<int64_t>(index - entry_id_offset_), &other_length);              \
-      value_found = other_length == value.length_ &&                                   \
-                    memcmp(other_value, value.ptr_, value.length_) == 0;               \
-    }                                                                                  \
-                                                                                       \
-    bool value_found_overflow = false;                                                 \
-    if (entry_id_offset_ > 0) {                                                        \
-      const uint8_t* other_value_overflow =                                            \
-          overflow_dict_builder_.GetValue(static_cast<int64_t>(index), &other_length); \
-      value_found_overflow =                                                           \
-          other_length == value.length_ &&                                             \
-          memcmp(other_value_overflow, value.ptr_, value.length_) == 0;                \
-    }                                                                                  \
-    return !(value_found || value_found_overflow);                                     \
+    const WrappedBinary other = GetMemoValue(static_cast<int64_t>(index));             \
+    return other.length_ != value.length_ ||                                           \
+           memcmp(other.ptr_, value.ptr_, value.length_) != 0;                         \
   }                                                                                    \
                                                                                        \
   template <>                                                                          \
@@ -1210,7 +1253,12 @@ Status Decimal128Builder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> data;
   RETURN_NOT_OK(byte_builder_.Finish(&data));
 
-  *out = ArrayData::Make(type_, length_, {null_bitmap_, data}, null_count_);
+  *out = ArrayData::Make(type_, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(data)),
+                         null_count_);
+
+  capacity_ = length_ = null_count_ = 0;
   return Status::OK();
 }
 
@@ -1278,7 +1326,10 @@ Status ListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
     RETURN_NOT_OK(value_builder_->FinishInternal(&items));
   }
 
-  *out = ArrayData::Make(type_, length_, {null_bitmap_, offsets}, null_count_);
+  *out = ArrayData::Make(type_, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(offsets)),
+                         null_count_);
   (*out)->child_data.emplace_back(std::move(items));
   Reset();
   return Status::OK();
@@ -1294,6 +1345,116 @@ ArrayBuilder* ListBuilder::value_builder() const {
   return value_builder_.get();
 }
 
+// ----------------------------------------------------------------------
+// LargeListBuilder
+
+LargeListBuilder::LargeListBuilder(MemoryPool* pool,
+                                   std::unique_ptr<ArrayBuilder> value_builder,
+                                   const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type ? type
+                        : std::static_pointer_cast<DataType>(
+                              std::make_shared<LargeListType>(value_builder->type())),
+                   pool),
+      offsets_builder_(pool),
+      value_builder_(std::move(value_builder)) {}
+
+Status LargeListBuilder::Append(const int64_t* offsets, int64_t length,
+                                const uint8_t* valid_bytes) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  offsets_builder_.UnsafeAppend(offsets, length);
+  return Status::OK();
+}
+
+Status LargeListBuilder::Append(bool is_valid) {
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(is_valid);
+  return AppendNextOffset();
+}
+
+Status LargeListBuilder::Init(int64_t elements) {
+  RETURN_NOT_OK(ArrayBuilder::Init(elements));
+  // one more then requested for offsets
+  return offsets_builder_.Resize((elements + 1) * sizeof(int64_t));
+}
+
+Status LargeListBuilder::Resize(int64_t capacity) {
+  // one more then requested for offsets
+  RETURN_NOT_OK(offsets_builder_.Resize((capacity + 1) * sizeof(int64_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status LargeListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(AppendNextOffset());
+
+  std::shared_ptr<Buffer> offsets;
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+
+  std::shared_ptr<ArrayData> items;
+  RETURN_NOT_OK(value_builder_->FinishInternal(&items));
+
+  *out = ArrayData::Make(type_, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(offsets)),
+                         null_count_);
+  (*out)->child_data.emplace_back(std::move(items));
+  ArrayBuilder::Reset();
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// RunLengthEncodedBuilder
+
+RunLengthEncodedBuilder::RunLengthEncodedBuilder(
+    MemoryPool* pool, std::unique_ptr<ArrayBuilder> value_builder,
+    const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type ? type : run_length_encoded(value_builder->type()), pool),
+      run_ends_builder_(pool),
+      value_builder_(std::move(value_builder)) {}
+
+Status RunLengthEncodedBuilder::Init(int64_t elements) {
+  // No validity bitmap, the nulls are those of the run values. The run ends
+  // grow with the runs, whose number isn't known from the logical capacity
+  return Resize(elements);
+}
+
+Status RunLengthEncodedBuilder::Resize(int64_t capacity) {
+  DCHECK_LE(capacity, std::numeric_limits<int32_t>::max());
+  capacity_ = capacity;
+  return Status::OK();
+}
+
+Status RunLengthEncodedBuilder::AppendRun(int64_t run_length) {
+  if (ARROW_PREDICT_FALSE(run_length <= 0)) {
+    return Status::Invalid("Runs must have a positive length");
+  }
+  if (ARROW_PREDICT_FALSE(value_builder_->length() != run_ends_builder_.length() + 1)) {
+    return Status::Invalid("Append exactly one value to the value builder per run");
+  }
+  if (ARROW_PREDICT_FALSE(length_ + run_length > std::numeric_limits<int32_t>::max())) {
+    return Status::Invalid("Run-length encoded arrays cannot exceed INT32_MAX values");
+  }
+  length_ += run_length;
+  capacity_ = std::max(capacity_, length_);
+  return run_ends_builder_.Append(static_cast<int32_t>(length_));
+}
+
+Status RunLengthEncodedBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  if (value_builder_->length() != run_ends_builder_.length()) {
+    return Status::Invalid("The last value appended to the value builder has no run");
+  }
+  std::shared_ptr<Buffer> run_ends;
+  RETURN_NOT_OK(run_ends_builder_.Finish(&run_ends));
+
+  std::shared_ptr<ArrayData> values;
+  RETURN_NOT_OK(value_builder_->FinishInternal(&values));
+
+  *out = ArrayData::Make(type_, length_, {nullptr, std::move(run_ends)}, 0);
+  (*out)->child_data.emplace_back(std::move(values));
+  Reset();
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // String and binary
 
@@ -1345,6 +1506,21 @@ Status BinaryBuilder::Append(const uint8_t* value, int32_t length) {
   return Status::OK();
 }
 
+Status BinaryBuilder::Append(const int32_t* offsets, const uint8_t* data,
+                             int64_t length, const uint8_t* valid_bitmap,
+                             int64_t bitmap_offset) {
+  const int32_t data_length = offsets[length] - offsets[0];
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(data_length));
+
+  // Offsets from the start of the appended data
+  const int64_t shift = value_data_length() - offsets[0];
+  offsets_builder_.UnsafeAppendWithDelta(offsets, length, static_cast<int32_t>(shift));
+  value_data_builder_.UnsafeAppend(data + offsets[0], data_length);
+  UnsafeAppendBitmap(valid_bitmap, bitmap_offset, length);
+  return Status::OK();
+}
+
 Status BinaryBuilder::AppendNull() {
   RETURN_NOT_OK(AppendNextOffset());
   RETURN_NOT_OK(Reserve(1));
@@ -1360,8 +1536,11 @@ Status BinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
   RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
 
-  *out = ArrayData::Make(type_, length_, {null_bitmap_, offsets, value_data}, null_count_,
-                         0);
+  *out = ArrayData::Make(
+      type_, length_,
+      internal::MakeVector<std::shared_ptr<Buffer>>(
+          std::move(null_bitmap_), std::move(offsets), std::move(value_data)),
+      null_count_, 0);
   Reset();
   return Status::OK();
 }
@@ -1385,6 +1564,156 @@ const uint8_t* BinaryBuilder::GetValue(int64_t i, int32_t* out_length) const {
 
 StringBuilder::StringBuilder(MemoryPool* pool) : BinaryBuilder(utf8(), pool) {}
 
+LargeBinaryBuilder::LargeBinaryBuilder(const std::shared_ptr<DataType>& type,
+                                       MemoryPool* pool)
+    : ArrayBuilder(type, pool), offsets_builder_(pool), value_data_builder_(pool) {}
+
+LargeBinaryBuilder::LargeBinaryBuilder(MemoryPool* pool)
+    : LargeBinaryBuilder(large_binary(), pool) {}
+
+Status LargeBinaryBuilder::Init(int64_t elements) {
+  RETURN_NOT_OK(ArrayBuilder::Init(elements));
+  // one more then requested for offsets
+  return offsets_builder_.Resize((elements + 1) * sizeof(int64_t));
+}
+
+Status LargeBinaryBuilder::Resize(int64_t capacity) {
+  // one more then requested for offsets
+  RETURN_NOT_OK(offsets_builder_.Resize((capacity + 1) * sizeof(int64_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status LargeBinaryBuilder::ReserveData(int64_t elements) {
+  if (value_data_length() + elements > value_data_capacity()) {
+    RETURN_NOT_OK(value_data_builder_.Reserve(elements));
+  }
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::Append(const uint8_t* value, int64_t length) {
+  RETURN_NOT_OK(Reserve(1));
+  RETURN_NOT_OK(offsets_builder_.Append(value_data_builder_.length()));
+  RETURN_NOT_OK(value_data_builder_.Append(value, length));
+  UnsafeAppendToBitmap(true);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::AppendNull() {
+  RETURN_NOT_OK(Reserve(1));
+  RETURN_NOT_OK(offsets_builder_.Append(value_data_builder_.length()));
+  UnsafeAppendToBitmap(false);
+  return Status::OK();
+}
+
+Status LargeBinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  // Write final offset (values length)
+  RETURN_NOT_OK(offsets_builder_.Append(value_data_builder_.length()));
+  std::shared_ptr<Buffer> offsets, value_data;
+
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+  RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
+
+  *out = ArrayData::Make(
+      type_, length_,
+      internal::MakeVector<std::shared_ptr<Buffer>>(
+          std::move(null_bitmap_), std::move(offsets), std::move(value_data)),
+      null_count_, 0);
+  Reset();
+  return Status::OK();
+}
+
+void LargeBinaryBuilder::Reset() {
+  ArrayBuilder::Reset();
+  offsets_builder_.Reset();
+  value_data_builder_.Reset();
+}
+
+const uint8_t* LargeBinaryBuilder::GetValue(int64_t i, int64_t* out_length) const {
+  const int64_t* offsets = offsets_builder_.data();
+  const int64_t offset = offsets[i];
+  if (i == (length_ - 1)) {
+    *out_length = value_data_builder_.length() - offset;
+  } else {
+    *out_length = offsets[i + 1] - offset;
+  }
+  return value_data_builder_.data() + offset;
+}
+
+LargeStringBuilder::LargeStringBuilder(MemoryPool* pool)
+    : LargeBinaryBuilder(large_utf8(), pool) {}
+
+// ----------------------------------------------------------------------
+// String views
+
+StringViewBuilder::StringViewBuilder(const std::shared_ptr<DataType>& type,
+                                     MemoryPool* pool)
+    : ArrayBuilder(type, pool), views_builder_(pool), data_builder_(pool) {}
+
+StringViewBuilder::StringViewBuilder(MemoryPool* pool)
+    : StringViewBuilder(utf8_view(), pool) {}
+
+Status StringViewBuilder::Init(int64_t elements) {
+  RETURN_NOT_OK(ArrayBuilder::Init(elements));
+  return views_builder_.Resize(elements * sizeof(StringViewEntry));
+}
+
+Status StringViewBuilder::Resize(int64_t capacity) {
+  RETURN_NOT_OK(views_builder_.Resize(capacity * sizeof(StringViewEntry)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status StringViewBuilder::Append(const uint8_t* value, int32_t length) {
+  RETURN_NOT_OK(Reserve(1));
+  StringViewEntry view;
+  if (length <= StringViewEntry::kInlineSize) {
+    view = internal::MakeStringView(value, length, 0, 0);
+  } else {
+    if (data_builder_.length() > 0 && data_builder_.length() + length > kDataBlockSize) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(data_builder_.Finish(&block));
+      data_buffers_.push_back(block);
+    }
+    view = internal::MakeStringView(value, length,
+                                    static_cast<int32_t>(data_buffers_.size()),
+                                    static_cast<int32_t>(data_builder_.length()));
+    RETURN_NOT_OK(data_builder_.Append(value, length));
+  }
+  views_builder_.UnsafeAppend(reinterpret_cast<const uint8_t*>(&view), sizeof(view));
+  UnsafeAppendToBitmap(true);
+  return Status::OK();
+}
+
+Status StringViewBuilder::AppendNull() {
+  RETURN_NOT_OK(Reserve(1));
+  const StringViewEntry view = internal::MakeStringView(nullptr, 0, 0, 0);
+  views_builder_.UnsafeAppend(reinterpret_cast<const uint8_t*>(&view), sizeof(view));
+  UnsafeAppendToBitmap(false);
+  return Status::OK();
+}
+
+Status StringViewBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> views;
+  RETURN_NOT_OK(views_builder_.Finish(&views));
+  if (data_builder_.length() > 0) {
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(data_builder_.Finish(&block));
+    data_buffers_.push_back(block);
+  }
+  std::vector<std::shared_ptr<Buffer>> buffers = {std::move(null_bitmap_),
+                                                   std::move(views)};
+  buffers.insert(buffers.end(), data_buffers_.begin(), data_buffers_.end());
+  *out = ArrayData::Make(type_, length_, std::move(buffers), null_count_, 0);
+  Reset();
+  return Status::OK();
+}
+
+void StringViewBuilder::Reset() {
+  ArrayBuilder::Reset();
+  views_builder_.Reset();
+  data_builder_.Reset();
+  data_buffers_.clear();
+}
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -1431,7 +1760,10 @@ Status FixedSizeBinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> data;
   RETURN_NOT_OK(byte_builder_.Finish(&data));
 
-  *out = ArrayData::Make(type_, length_, {null_bitmap_, data}, null_count_);
+  *out = ArrayData::Make(type_, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_), std::move(data)),
+                         null_count_);
 
   null_bitmap_ = nullptr;
   capacity_ = length_ = null_count_ = 0;
@@ -1453,7 +1785,10 @@ StructBuilder::StructBuilder(const std::shared_ptr<DataType>& type, MemoryPool*
 }
 
 Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
-  *out = ArrayData::Make(type_, length_, {null_bitmap_}, null_count_);
+  *out = ArrayData::Make(type_, length_,
+                         internal::MakeVector<std::shared_ptr<Buffer>>(
+                             std::move(null_bitmap_)),
+                         null_count_);
 
   (*out)->child_data.resize(field_builders_.size());
   for (size_t i = 0; i < field_builders_.size(); ++i) {
@@ -1465,6 +1800,317 @@ Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// DenseUnionBuilder
+
+namespace {
+
+std::shared_ptr<DataType> DenseUnionOf(
+    const std::vector<std::unique_ptr<ArrayBuilder>>& child_builders) {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<uint8_t> type_codes;
+  for (size_t i = 0; i < child_builders.size(); ++i) {
+    fields.push_back(field(std::to_string(i), child_builders[i]->type()));
+    type_codes.push_back(static_cast<uint8_t>(i));
+  }
+  return union_(fields, type_codes, UnionMode::DENSE);
+}
+
+}  // namespace
+
+DenseUnionBuilder::DenseUnionBuilder(
+    MemoryPool* pool, std::vector<std::unique_ptr<ArrayBuilder>>&& child_builders,
+    const std::shared_ptr<DataType>& type)
+    : ArrayBuilder(type ? type : DenseUnionOf(child_builders), pool),
+      types_builder_(pool),
+      offsets_builder_(pool) {
+  const auto& union_type = static_cast<const UnionType&>(*type_);
+  DCHECK_EQ(union_type.mode(), UnionMode::DENSE);
+  DCHECK_EQ(union_type.num_children(), static_cast<int>(child_builders.size()));
+  children_ = std::move(child_builders);
+  type_codes_ = union_type.type_codes();
+  child_lengths_.resize(children_.size(), 0);
+}
+
+Status DenseUnionBuilder::Init(int64_t elements) {
+  DCHECK_LE(elements, std::numeric_limits<int32_t>::max());
+  RETURN_NOT_OK(ArrayBuilder::Init(elements));
+  RETURN_NOT_OK(types_builder_.Resize(elements * sizeof(uint8_t)));
+  return offsets_builder_.Resize(elements * sizeof(int32_t));
+}
+
+Status DenseUnionBuilder::Resize(int64_t capacity) {
+  // The offsets into a child cannot exceed the number of slots
+  DCHECK_LE(capacity, std::numeric_limits<int32_t>::max());
+  RETURN_NOT_OK(types_builder_.Resize(capacity * sizeof(uint8_t)));
+  RETURN_NOT_OK(offsets_builder_.Resize(capacity * sizeof(int32_t)));
+  return ArrayBuilder::Resize(capacity);
+}
+
+Status DenseUnionBuilder::Append(int8_t child) {
+  DCHECK(child >= 0 && child < num_children());
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(true);
+  types_builder_.UnsafeAppend(type_codes_[child]);
+  offsets_builder_.UnsafeAppend(child_lengths_[child]++);
+  return Status::OK();
+}
+
+Status DenseUnionBuilder::AppendNull() {
+  DCHECK_GT(num_children(), 0);
+  RETURN_NOT_OK(Reserve(1));
+  UnsafeAppendToBitmap(false);
+  types_builder_.UnsafeAppend(type_codes_[0]);
+  offsets_builder_.UnsafeAppend(0);
+  return Status::OK();
+}
+
+Status DenseUnionBuilder::Append(const int8_t* children, int64_t length,
+                                 const uint8_t* valid_bytes) {
+  const int8_t num_children = static_cast<int8_t>(children_.size());
+  for (int64_t i = 0; i < length; ++i) {
+    const bool is_valid = valid_bytes == nullptr || valid_bytes[i] != 0;
+    if (ARROW_PREDICT_FALSE(is_valid &&
+                            (children[i] < 0 || children[i] >= num_children))) {
+      std::stringstream ss;
+      ss << "Union child index " << static_cast<int>(children[i]) << " out of range";
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(valid_bytes, length);
+  // The type ids and the offsets of all the slots in a single pass
+  for (int64_t i = 0; i < length; ++i) {
+    if (valid_bytes == nullptr || valid_bytes[i] != 0) {
+      types_builder_.UnsafeAppend(type_codes_[children[i]]);
+      offsets_builder_.UnsafeAppend(child_lengths_[children[i]]++);
+    } else {
+      types_builder_.UnsafeAppend(type_codes_[0]);
+      offsets_builder_.UnsafeAppend(0);
+    }
+  }
+  return Status::OK();
+}
+
+Status DenseUnionBuilder::AppendChildValues(int8_t child, const ArrayData& values,
+                                            int64_t offset, int64_t length) {
+  if (ARROW_PREDICT_FALSE(child < 0 || child >= num_children())) {
+    std::stringstream ss;
+    ss << "Union child index " << static_cast<int>(child) << " out of range";
+    return Status::Invalid(ss.str());
+  }
+  RETURN_NOT_OK(children_[child]->AppendArraySlice(values, offset, length));
+
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeSetNotNull(length);
+  const uint8_t type_code = type_codes_[child];
+  const int32_t first_offset = child_lengths_[child];
+  for (int64_t i = 0; i < length; ++i) {
+    types_builder_.UnsafeAppend(type_code);
+    offsets_builder_.UnsafeAppend(first_offset + static_cast<int32_t>(i));
+  }
+  child_lengths_[child] += static_cast<int32_t>(length);
+  return Status::OK();
+}
+
+Status DenseUnionBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
+  for (int i = 0; i < num_children(); ++i) {
+    if (children_[i]->length() < child_lengths_[i]) {
+      std::stringstream ss;
+      ss << "Union child " << i << " has " << children_[i]->length() << " values for "
+         << child_lengths_[i] << " slots";
+      return Status::Invalid(ss.str());
+    }
+  }
+  std::shared_ptr<Buffer> types;
+  RETURN_NOT_OK(types_builder_.Finish(&types));
+  std::shared_ptr<Buffer> offsets;
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+
+  *out = ArrayData::Make(type_, length_,
+                         {std::move(null_bitmap_), std::move(types), std::move(offsets)},
+                         null_count_);
+  (*out)->child_data.resize(children_.size());
+  for (int i = 0; i < num_children(); ++i) {
+    RETURN_NOT_OK(children_[i]->FinishInternal(&(*out)->child_data[i]));
+  }
+  std::fill(child_lengths_.begin(), child_lengths_.end(), 0);
+  Reset();
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Appending slices of arrays
+
+namespace internal {
+
+// Appends a range of the values of an array to a builder of its type,
+// dispatched on the type
+class ArraySliceAppender {
+ public:
+  ArraySliceAppender(ArrayBuilder* builder, const ::arrow::ArrayData& array,
+                     int64_t offset, int64_t length)
+      : builder_(builder),
+        array_(array),
+        offset_(array.offset + offset),
+        length_(length) {}
+
+  Status Append() { return VisitTypeInline(*array_.type, this); }
+
+  Status Visit(const NullType&) {
+    builder_->length_ += length_;
+    builder_->null_count_ += length_;
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    auto builder = static_cast<BooleanBuilder*>(builder_);
+    RETURN_NOT_OK(builder->Reserve(length_));
+    CopyBitmap(array_.buffers[1]->data(), offset_, length_, builder->raw_data_,
+               builder->length_);
+    AppendValidity();
+    return Status::OK();
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_base_of<PrimitiveCType, T>::value ||
+                              std::is_base_of<DateType, T>::value ||
+                              std::is_base_of<TimeType, T>::value ||
+                              std::is_same<TimestampType, T>::value,
+                          Status>::type
+  Visit(const T&) {
+    using c_type = typename T::c_type;
+    auto builder = static_cast<PrimitiveBuilder<T>*>(builder_);
+    RETURN_NOT_OK(builder->Reserve(length_));
+    const auto values = reinterpret_cast<const c_type*>(array_.buffers[1]->data());
+    std::memcpy(builder->raw_data_ + builder->length_, values + offset_,
+                static_cast<size_t>(length_) * sizeof(c_type));
+    AppendValidity();
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) {
+    return static_cast<BinaryBuilder*>(builder_)->Append(
+        GetOffsets<int32_t>(), GetValueData(), length_, GetValidity(), offset_);
+  }
+
+  Status Visit(const LargeBinaryType&) {
+    auto builder = static_cast<LargeBinaryBuilder*>(builder_);
+    const int64_t* offsets = GetOffsets<int64_t>();
+    const int64_t data_length = offsets[length_] - offsets[0];
+    RETURN_NOT_OK(builder->Reserve(length_));
+    RETURN_NOT_OK(builder->ReserveData(data_length));
+    builder->offsets_builder_.UnsafeAppendWithDelta(
+        offsets, length_, builder->value_data_length() - offsets[0]);
+    if (data_length > 0) {
+      builder->value_data_builder_.UnsafeAppend(GetValueData() + offsets[0], data_length);
+    }
+    AppendValidity();
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType&) {
+    auto builder = static_cast<FixedSizeBinaryBuilder*>(builder_);
+    const int64_t byte_width = builder->byte_width_;
+    RETURN_NOT_OK(builder->Reserve(length_));
+    if (byte_width > 0) {
+      RETURN_NOT_OK(builder->byte_builder_.Append(
+          array_.buffers[1]->data() + offset_ * byte_width, length_ * byte_width));
+    }
+    AppendValidity();
+    return Status::OK();
+  }
+
+  Status Visit(const ListType&) {
+    auto builder = static_cast<ListBuilder*>(builder_);
+    const int32_t* offsets = GetOffsets<int32_t>();
+    const int64_t values_length = offsets[length_] - offsets[0];
+    const int64_t values_start = builder->value_builder_->length();
+    if (values_start + values_length > kListMaximumElements) {
+      return Status::Invalid(
+          "ListArray cannot contain more then INT32_MAX - 1 child elements");
+    }
+    RETURN_NOT_OK(builder->Reserve(length_));
+    builder->offsets_builder_.UnsafeAppendWithDelta(
+        offsets, length_, static_cast<int32_t>(values_start - offsets[0]));
+    AppendValidity();
+    return builder->value_builder_->AppendArraySlice(*array_.child_data[0], offsets[0],
+                                                     values_length);
+  }
+
+  Status Visit(const LargeListType&) {
+    auto builder = static_cast<LargeListBuilder*>(builder_);
+    const int64_t* offsets = GetOffsets<int64_t>();
+    const int64_t values_start = builder->value_builder_->length();
+    RETURN_NOT_OK(builder->Reserve(length_));
+    builder->offsets_builder_.UnsafeAppendWithDelta(offsets, length_,
+                                                    values_start - offsets[0]);
+    AppendValidity();
+    return builder->value_builder_->AppendArraySlice(*array_.child_data[0], offsets[0],
+                                                     offsets[length_] - offsets[0]);
+  }
+
+  Status Visit(const StructType&) {
+    auto builder = static_cast<StructBuilder*>(builder_);
+    RETURN_NOT_OK(builder->Reserve(length_));
+    AppendValidity();
+    // The children are not sliced with their parent
+    for (int i = 0; i < builder->num_fields(); ++i) {
+      RETURN_NOT_OK(builder->field_builder(i)->AppendArraySlice(*array_.child_data[i],
+                                                                offset_, length_));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Appending slices of " + type.ToString() + " arrays");
+  }
+
+ private:
+  template <typename OffsetType>
+  const OffsetType* GetOffsets() const {
+    return reinterpret_cast<const OffsetType*>(array_.buffers[1]->data()) + offset_;
+  }
+
+  const uint8_t* GetValueData() const {
+    return array_.buffers[2] ? array_.buffers[2]->data() : nullptr;
+  }
+
+  const uint8_t* GetValidity() const {
+    return array_.null_count != 0 && array_.buffers[0] ? array_.buffers[0]->data()
+                                                        : nullptr;
+  }
+
+  // Copy the validity bits, advancing the builder past the appended values
+  void AppendValidity() { builder_->UnsafeAppendBitmap(GetValidity(), offset_, length_); }
+
+  ArrayBuilder* builder_;
+  const ::arrow::ArrayData& array_;
+  const int64_t offset_;
+  const int64_t length_;
+};
+
+}  // namespace internal
+
+Status ArrayBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                      int64_t length) {
+  if (!array.type->Equals(*type_)) {
+    return Status::Invalid("Cannot append " + array.type->ToString() +
+                           " values to a builder of " + type_->ToString());
+  }
+  if (offset < 0 || length < 0 || offset > array.length - length) {
+    std::stringstream ss;
+    ss << "Slice of " << length << " values at " << offset
+       << " out of bounds for an array of " << array.length;
+    return Status::Invalid(ss.str());
+  }
+  if (length == 0) {
+    return Status::OK();
+  }
+  return internal::ArraySliceAppender(this, array, offset, length).Append();
+}
+
   // ----------------------------------------------------------------------
   // Helper functions
 
@@ -1503,6 +2149,9 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       BUILDER_CASE(DOUBLE, DoubleBuilder);
       BUILDER_CASE(STRING, StringBuilder);
       BUILDER_CASE(BINARY, BinaryBuilder);
+      BUILDER_CASE(LARGE_STRING, LargeStringBuilder);
+      BUILDER_CASE(LARGE_BINARY, LargeBinaryBuilder);
+      BUILDER_CASE(STRING_VIEW, StringViewBuilder);
       BUILDER_CASE(FIXED_SIZE_BINARY, FixedSizeBinaryBuilder);
       BUILDER_CASE(DECIMAL, Decimal128Builder);
     case Type::LIST: {
@@ -1514,6 +2163,24 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       return Status::OK();
     }
 
+    case Type::LARGE_LIST: {
+      std::unique_ptr<ArrayBuilder> value_builder;
+      std::shared_ptr<DataType> value_type =
+          static_cast<LargeListType*>(type.get())->value_type();
+      RETURN_NOT_OK(MakeBuilder(pool, value_type, &value_builder));
+      out->reset(new LargeListBuilder(pool, std::move(value_builder), type));
+      return Status::OK();
+    }
+
+    case Type::RUN_LENGTH_ENCODED: {
+      std::unique_ptr<ArrayBuilder> value_builder;
+      std::shared_ptr<DataType> value_type =
+          static_cast<RunLengthEncodedType*>(type.get())->value_type();
+      RETURN_NOT_OK(MakeBuilder(pool, value_type, &value_builder));
+      out->reset(new RunLengthEncodedBuilder(pool, std::move(value_builder)));
+      return Status::OK();
+    }
+
     case Type::STRUCT: {
       const std::vector<std::shared_ptr<Field>>& fields = type->children();
       std::vector<std::unique_ptr<ArrayBuilder>> values_builder;
@@ -1527,6 +2194,20 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
       return Status::OK();
     }
 
+    case Type::UNION: {
+      if (static_cast<const UnionType&>(*type).mode() != UnionMode::DENSE) {
+        return Status::NotImplemented("MakeBuilder: sparse unions have no builder");
+      }
+      std::vector<std::unique_ptr<ArrayBuilder>> child_builders;
+      for (const auto& child : type->children()) {
+        std::unique_ptr<ArrayBuilder> builder;
+        RETURN_NOT_OK(MakeBuilder(pool, child->type(), &builder));
+        child_builders.emplace_back(std::move(builder));
+      }
+      out->reset(new DenseUnionBuilder(pool, std::move(child_builders), type));
+      return Status::OK();
+    }
+
     default: {
       std::stringstream ss;
       ss << "MakeBuilder: cannot construct builder for type " << type->ToString();
@@ -1535,4 +2216,46 @@ Status MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
   }
 }
 
+Status ReserveLike(const Array& array, ArrayBuilder* builder) {
+  if (!array.type()->Equals(*builder->type())) {
+    return Status::Invalid("ReserveLike: the array type does not match the builder");
+  }
+  // Resize rather than Reserve, which would round to a power of 2
+  const int64_t capacity = builder->length() + array.length();
+  if (capacity > builder->capacity()) {
+    RETURN_NOT_OK(builder->Resize(capacity));
+  }
+  if (array.length() == 0) {
+    return Status::OK();
+  }
+
+  switch (array.type_id()) {
+    case Type::BINARY:
+    case Type::STRING: {
+      const int32_t* offsets =
+          static_cast<const BinaryArray&>(array).raw_value_offsets();
+      return static_cast<BinaryBuilder*>(builder)->ReserveData(offsets[array.length()] -
+                                                               offsets[0]);
+    }
+    case Type::LIST: {
+      const auto& list_array = static_cast<const ListArray&>(array);
+      const int32_t values_start = list_array.value_offset(0);
+      const int32_t values_end = list_array.value_offset(array.length());
+      auto values = list_array.values()->Slice(values_start, values_end - values_start);
+      return ReserveLike(*values, static_cast<ListBuilder*>(builder)->value_builder());
+    }
+    case Type::STRUCT: {
+      const auto& struct_array = static_cast<const StructArray&>(array);
+      auto struct_builder = static_cast<StructBuilder*>(builder);
+      for (int i = 0; i < struct_builder->num_fields(); ++i) {
+        RETURN_NOT_OK(
+            ReserveLike(*struct_array.field(i), struct_builder->field_builder(i)));
+      }
+      return Status::OK();
+    }
+    default:
+      return Status::OK();
+  }
+}
+
 }  // namespace arrow
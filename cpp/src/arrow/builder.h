@@ -46,6 +46,7 @@ constexpr int64_t kListMaximumElements = std::numeric_limits<int32_t>::max() - 1
 
 namespace internal {
 
+class ArraySliceAppender;
 struct ArrayData;
 
 }  // namespace internal
@@ -90,6 +91,21 @@ class ARROW_EXPORT ArrayBuilder {
   /// Set the next length bits to not null (i.e. valid).
   Status SetNotNull(int64_t length);
 
+  /// \brief Append a range of the values of an array of the builder's type
+  ///
+  /// The values are copied in bulk rather than one by one: value buffers are
+  /// copied at once, offsets are rebased onto the values appended so far in a
+  /// single pass and validity bitmaps are copied as by CopyBitmap. The
+  /// children of list and struct values are appended recursively.
+  ///
+  /// \param[in] array the data of an array of the builder's type
+  /// \param[in] offset the index of the first value to append
+  /// \param[in] length the number of values to append
+  /// \return Status, Invalid if the type differs or the range is out of the
+  /// array, NotImplemented for dictionary, union, run-length encoded and
+  /// string view values
+  Status AppendArraySlice(const ArrayData& array, int64_t offset, int64_t length);
+
   /// Allocates initial capacity requirements for the builder.  In most
   /// cases subclasses should override and call their parent class's
   /// method as well.
@@ -168,7 +184,13 @@ class ARROW_EXPORT ArrayBuilder {
   // Set the next length bits to not null (i.e. valid).
   void UnsafeSetNotNull(int64_t length);
 
+  // Vector append from a validity bitmap, starting at bit offset. If bitmap is
+  // null assume all of length bits are valid.
+  void UnsafeAppendBitmap(const uint8_t* bitmap, int64_t offset, int64_t length);
+
  private:
+  friend class internal::ArraySliceAppender;
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(ArrayBuilder);
 };
 
@@ -241,6 +263,20 @@ class ARROW_EXPORT PrimitiveBuilder : public ArrayBuilder {
   /// \return Status
   Status Append(const std::vector<value_type>& values);
 
+  /// \brief Append the values of existing buffers and finish the array
+  ///
+  /// When nothing was appended to the builder yet, the array adopts the
+  /// buffers without copying them, as for values received in a network frame.
+  /// Otherwise their contents are appended as by the bulk Append.
+  /// \param[in] values a buffer of at least length values
+  /// \param[in] length the number of values
+  /// \param[in] null_bitmap an optional validity bitmap of at least length bits
+  /// \param[out] out the finished array
+  /// \return Status
+  Status FinishAdopting(const std::shared_ptr<Buffer>& values, int64_t length,
+                        const std::shared_ptr<Buffer>& null_bitmap,
+                        std::shared_ptr<Array>* out);
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
   Status Init(int64_t capacity) override;
 
@@ -251,6 +287,9 @@ class ARROW_EXPORT PrimitiveBuilder : public ArrayBuilder {
  protected:
   std::shared_ptr<PoolBuffer> data_;
   value_type* raw_data_;
+
+ private:
+  friend class internal::ArraySliceAppender;
 };
 
 /// Base class for all Builders that emit an Array of a scalar numerical type.
@@ -542,6 +581,16 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
   /// Scalar append
   Status Append(const bool val) {
     RETURN_NOT_OK(Reserve(1));
+    UnsafeAppend(val);
+    return Status::OK();
+  }
+
+  /// Append a single scalar under the assumption that the underlying Buffer is
+  /// large enough.
+  ///
+  /// This method does not capacity-check; make sure to call Reserve
+  /// beforehand.
+  void UnsafeAppend(const bool val) {
     BitUtil::SetBit(null_bitmap_data_, length_);
     if (val) {
       BitUtil::SetBit(raw_data_, length_);
@@ -549,7 +598,6 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
       BitUtil::ClearBit(raw_data_, length_);
     }
     ++length_;
-    return Status::OK();
   }
 
   Status Append(const uint8_t val) { return Append(val != 0); }
@@ -605,6 +653,9 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
  protected:
   std::shared_ptr<PoolBuffer> data_;
   uint8_t* raw_data_;
+
+ private:
+  friend class internal::ArraySliceAppender;
 };
 
 // ----------------------------------------------------------------------
@@ -659,6 +710,79 @@ class ARROW_EXPORT ListBuilder : public ArrayBuilder {
   Status AppendNextOffset();
 
   void Reset();
+
+ private:
+  friend class internal::ArraySliceAppender;
+};
+
+/// \class LargeListBuilder
+/// \brief Builder class for list arrays with 64-bit offsets
+///
+/// \see ListBuilder
+class ARROW_EXPORT LargeListBuilder : public ArrayBuilder {
+ public:
+  LargeListBuilder(MemoryPool* pool, std::unique_ptr<ArrayBuilder> value_builder,
+                   const std::shared_ptr<DataType>& type = NULLPTR);
+
+  Status Init(int64_t elements) override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \brief Vector append
+  ///
+  /// If passed, valid_bytes is of equal length to values, and any zero byte
+  /// will be considered as a null for that slot
+  Status Append(const int64_t* offsets, int64_t length,
+                const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Start a new variable-length list slot
+  ///
+  /// This function should be called before beginning to append elements to the
+  /// value builder
+  Status Append(bool is_valid = true);
+
+  Status AppendNull() { return Append(false); }
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+ protected:
+  TypedBufferBuilder<int64_t> offsets_builder_;
+  std::unique_ptr<ArrayBuilder> value_builder_;
+
+  Status AppendNextOffset() {
+    return offsets_builder_.Append(value_builder_->length());
+  }
+
+ private:
+  friend class internal::ArraySliceAppender;
+};
+
+// ----------------------------------------------------------------------
+// Run-length encoded builder
+
+/// \class RunLengthEncodedBuilder
+/// \brief Builder class for run-length encoded arrays
+///
+/// The value of each run is appended to the value builder, then the run is
+/// closed with AppendRun. The length and capacity of the builder are logical.
+class ARROW_EXPORT RunLengthEncodedBuilder : public ArrayBuilder {
+ public:
+  RunLengthEncodedBuilder(MemoryPool* pool, std::unique_ptr<ArrayBuilder> value_builder,
+                          const std::shared_ptr<DataType>& type = NULLPTR);
+
+  Status Init(int64_t elements) override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \brief Close a run of run_length values equal to the last value
+  /// appended to the value builder
+  Status AppendRun(int64_t run_length);
+
+  ArrayBuilder* value_builder() const { return value_builder_.get(); }
+
+ protected:
+  TypedBufferBuilder<int32_t> run_ends_builder_;
+  std::unique_ptr<ArrayBuilder> value_builder_;
 };
 
 // ----------------------------------------------------------------------
@@ -682,8 +806,46 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
     return Append(value.c_str(), static_cast<int32_t>(value.size()));
   }
 
+  /// \brief Append a sequence of values laid out as in a BinaryArray
+  ///
+  /// The value data is copied at once, and the offsets rebased onto the end
+  /// of the data appended so far.
+  ///
+  /// \param[in] offsets length + 1 offsets into data
+  /// \param[in] data the value data the offsets point into
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bitmap an optional validity bitmap. If null, all the
+  /// values are valid
+  /// \param[in] bitmap_offset the bit offset of the first value in valid_bitmap
+  /// \return Status
+  Status Append(const int32_t* offsets, const uint8_t* data, int64_t length,
+                const uint8_t* valid_bitmap = NULLPTR, int64_t bitmap_offset = 0);
+
   Status AppendNull();
 
+  /// \brief Append without checking capacity
+  ///
+  /// Reserve and ReserveData must have been called beforehand for the number
+  /// of values and bytes to append.
+  void UnsafeAppend(const uint8_t* value, int32_t length) {
+    UnsafeAppendNextOffset();
+    value_data_builder_.UnsafeAppend(value, length);
+    UnsafeAppendToBitmap(true);
+  }
+
+  void UnsafeAppend(const char* value, int32_t length) {
+    UnsafeAppend(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  void UnsafeAppend(const std::string& value) {
+    UnsafeAppend(value.c_str(), static_cast<int32_t>(value.size()));
+  }
+
+  void UnsafeAppendNull() {
+    UnsafeAppendNextOffset();
+    UnsafeAppendToBitmap(false);
+  }
+
   Status Init(int64_t elements) override;
   Status Resize(int64_t capacity) override;
   /// \brief Ensures there is enough allocated capacity to append the indicated
@@ -707,6 +869,11 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
 
   Status AppendNextOffset();
   void Reset();
+
+  // ReserveData enforces the memory limit for the unsafe appends
+  void UnsafeAppendNextOffset() {
+    offsets_builder_.UnsafeAppend(static_cast<int32_t>(value_data_builder_.length()));
+  }
 };
 
 /// \class StringBuilder
@@ -721,6 +888,117 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
   Status Append(const std::vector<std::string>& values, uint8_t* null_bytes);
 };
 
+/// \class LargeBinaryBuilder
+/// \brief Builder class for variable-length binary data with 64-bit offsets,
+/// which is not limited to 2GB of data
+class ARROW_EXPORT LargeBinaryBuilder : public ArrayBuilder {
+ public:
+  explicit LargeBinaryBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  LargeBinaryBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+  Status Append(const uint8_t* value, int64_t length);
+
+  Status Append(const char* value, int64_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(const std::string& value) {
+    return Append(value.c_str(), static_cast<int64_t>(value.size()));
+  }
+
+  Status AppendNull();
+
+  /// \brief Append without checking capacity
+  ///
+  /// Reserve and ReserveData must have been called beforehand for the number
+  /// of values and bytes to append.
+  void UnsafeAppend(const uint8_t* value, int64_t length) {
+    offsets_builder_.UnsafeAppend(value_data_builder_.length());
+    value_data_builder_.UnsafeAppend(value, length);
+    UnsafeAppendToBitmap(true);
+  }
+
+  void UnsafeAppendNull() {
+    offsets_builder_.UnsafeAppend(value_data_builder_.length());
+    UnsafeAppendToBitmap(false);
+  }
+
+  Status Init(int64_t elements) override;
+  Status Resize(int64_t capacity) override;
+  /// \brief Ensures there is enough allocated capacity to append the indicated
+  /// number of bytes to the value data buffer without additional allocations
+  Status ReserveData(int64_t elements);
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \return size of values buffer so far
+  int64_t value_data_length() const { return value_data_builder_.length(); }
+  /// \return capacity of values buffer
+  int64_t value_data_capacity() const { return value_data_builder_.capacity(); }
+
+  /// Temporary access to a value.
+  ///
+  /// This pointer becomes invalid on the next modifying operation.
+  const uint8_t* GetValue(int64_t i, int64_t* out_length) const;
+
+ protected:
+  TypedBufferBuilder<int64_t> offsets_builder_;
+  TypedBufferBuilder<uint8_t> value_data_builder_;
+
+  void Reset();
+
+ private:
+  friend class internal::ArraySliceAppender;
+};
+
+/// \class LargeStringBuilder
+/// \brief Builder class for UTF8 strings with 64-bit offsets
+class ARROW_EXPORT LargeStringBuilder : public LargeBinaryBuilder {
+ public:
+  using LargeBinaryBuilder::LargeBinaryBuilder;
+  explicit LargeStringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+};
+
+// ----------------------------------------------------------------------
+// StringViewBuilder
+
+/// \class StringViewBuilder
+/// \brief Builder class for arrays of string views
+///
+/// Strings too long to be inlined are appended to a data buffer, a new one
+/// being started once it holds kDataBlockSize bytes.
+class ARROW_EXPORT StringViewBuilder : public ArrayBuilder {
+ public:
+  static constexpr int64_t kDataBlockSize = 1 << 20;
+
+  explicit StringViewBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  StringViewBuilder(const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+  Status Append(const uint8_t* value, int32_t length);
+
+  Status Append(const char* value, int32_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(const std::string& value) {
+    return Append(value.c_str(), static_cast<int32_t>(value.size()));
+  }
+
+  Status AppendNull();
+
+  Status Init(int64_t elements) override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+ protected:
+  TypedBufferBuilder<uint8_t> views_builder_;
+  TypedBufferBuilder<uint8_t> data_builder_;
+  std::vector<std::shared_ptr<Buffer>> data_buffers_;
+
+  void Reset();
+};
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
@@ -758,6 +1036,9 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
  protected:
   int32_t byte_width_;
   BufferBuilder byte_builder_;
+
+ private:
+  friend class internal::ArraySliceAppender;
 };
 
 class ARROW_EXPORT Decimal128Builder : public FixedSizeBinaryBuilder {
@@ -817,6 +1098,69 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
   std::vector<std::unique_ptr<ArrayBuilder>> field_builders_;
 };
 
+// ----------------------------------------------------------------------
+// Dense union builder
+
+/// \class DenseUnionBuilder
+/// \brief Builder class for dense union arrays
+///
+/// A slot is appended with the index of its child, and its value to the
+/// builder of that child separately; the type ids and the offsets into the
+/// children are built here. Slots of several children are appended in a
+/// single pass, and values of a child in bulk with AppendChildValues. Null
+/// slots have no value, they point to the first value of the first child.
+class ARROW_EXPORT DenseUnionBuilder : public ArrayBuilder {
+ public:
+  /// \param[in] pool a memory pool
+  /// \param[in] child_builders the builders of the values of each child
+  /// \param[in] type a dense union type of the children, by default with
+  /// fields named and type codes numbered by the index of the child
+  DenseUnionBuilder(MemoryPool* pool,
+                    std::vector<std::unique_ptr<ArrayBuilder>>&& child_builders,
+                    const std::shared_ptr<DataType>& type = NULLPTR);
+
+  Status Init(int64_t elements) override;
+  Status Resize(int64_t capacity) override;
+  Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+
+  /// \brief Append a slot of a child, whose value is appended to the child
+  /// builder separately
+  Status Append(int8_t child);
+
+  Status AppendNull();
+
+  /// \brief Append slots of several children, whose values are appended to
+  /// the child builders separately
+  ///
+  /// \param[in] children the index of the child of each slot
+  /// \param[in] length the number of slots
+  /// \param[in] valid_bytes zero for null slots, which have no value, or null
+  /// if all slots are valid
+  /// \return Status, Invalid if a child index is out of range
+  Status Append(const int8_t* children, int64_t length,
+                const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Append a range of values of an array as slots of a child, the
+  /// values copied to the child builder in bulk as by AppendArraySlice
+  ///
+  /// \param[in] child the index of the child
+  /// \param[in] values the data of an array of the type of the child
+  /// \param[in] offset the index of the first value to append
+  /// \param[in] length the number of values to append
+  /// \return Status
+  Status AppendChildValues(int8_t child, const ArrayData& values, int64_t offset,
+                           int64_t length);
+
+  ArrayBuilder* child_builder(int i) const { return children_[i].get(); }
+
+ protected:
+  TypedBufferBuilder<uint8_t> types_builder_;
+  TypedBufferBuilder<int32_t> offsets_builder_;
+  std::vector<uint8_t> type_codes_;
+  // The number of slots of each child so far, the offset of its next slot
+  std::vector<int32_t> child_lengths_;
+};
+
 // ----------------------------------------------------------------------
 // Dictionary builder
 
@@ -894,6 +1238,9 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   Status DoubleTableSize();
   Scalar GetDictionaryValue(typename TypeTraits<T>::BuilderType& dictionary_builder,
                             int64_t index);
+  // Value of a memo entry, which is either in the dictionary being built or in
+  // the ones finished before
+  Scalar GetMemoValue(int64_t index);
   int64_t HashValue(const Scalar& value);
   bool SlotDifferent(hash_slot_t slot, const Scalar& value);
   Status AppendDictionary(const Scalar& value);
@@ -992,6 +1339,21 @@ class ARROW_EXPORT StringDictionaryBuilder : public DictionaryBuilder<StringType
 Status ARROW_EXPORT MakeBuilder(MemoryPool* pool, const std::shared_ptr<DataType>& type,
                                 std::unique_ptr<ArrayBuilder>* out);
 
+/// \brief Reserve the capacity to append an array of the same shape
+///
+/// Meant for builders making batch after batch of similar sizes: reserving
+/// like the previous batch replaces the successive doublings of capacity with
+/// a single allocation per buffer. Besides the number of elements, the value
+/// data of binary builders and the children of list and struct builders are
+/// reserved, recursively.
+///
+/// \param[in] array an array of the builder's type, typically the last one
+/// finished
+/// \param[in] builder a builder as made by MakeBuilder
+/// \return Status
+ARROW_EXPORT
+Status ReserveLike(const Array& array, ArrayBuilder* builder);
+
 }  // namespace arrow
 
 #endif  // ARROW_BUILDER_H_
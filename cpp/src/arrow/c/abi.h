@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The Arrow C data interface: plain C structures describing the type and the
+// data of an array, to hand arrays between libraries, and between languages,
+// without copying nor serializing them. See arrow/c/bridge.h for their export
+// from and import into C++ Arrow data.
+//
+// The structures are part of the ABI of every library exchanging them, and
+// are never changed: ARROW_C_DATA_INTERFACE is the version of the interface.
+// New types are described with new format strings rather than new members.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE 1
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The dictionary indices of the values are ordered.
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+/// The field may hold nulls.
+#define ARROW_FLAG_NULLABLE 2
+/// The keys of each map value are sorted.
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+/// \brief The type of an array, a field or a schema
+///
+/// The producer allocates all members and frees them in release, which the
+/// consumer calls once it no longer needs the structure. A released structure
+/// has a null release callback.
+struct ArrowSchema {
+  /// The type, encoded as a format string such as "i" for int32 or "+l" for
+  /// a list, whose children give the types of the child arrays. Mandatory.
+  const char* format;
+  /// The field name, or null.
+  const char* name;
+  /// The field metadata, or null: an int32 number of pairs followed by each
+  /// key and value as an int32 length and the bytes, in native endianness.
+  const char* metadata;
+  /// ARROW_FLAG_* bits.
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  /// The type of the dictionary values, if the array is dictionary-encoded,
+  /// format being that of the indices. Null otherwise.
+  struct ArrowSchema* dictionary;
+
+  /// Release the members of the structure, including the children and the
+  /// dictionary, and set release to null.
+  void (*release)(struct ArrowSchema*);
+  /// Opaque data of the producer.
+  void* private_data;
+};
+
+/// \brief The data of an array
+///
+/// The buffers follow the Arrow columnar format, of the type described by an
+/// ArrowSchema exchanged alongside. They must stay valid and unmodified until
+/// release is called. Release is only called on the top-level structure,
+/// which releases the children and the dictionary.
+struct ArrowArray {
+  int64_t length;
+  /// The number of nulls, or -1 if not computed.
+  int64_t null_count;
+  /// The logical offset in values into the buffers.
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  /// The buffers of the array, of the layout of its type. A null validity
+  /// bitmap means there are no nulls.
+  const void** buffers;
+  struct ArrowArray** children;
+  /// The dictionary values, if the array holds dictionary indices.
+  struct ArrowArray* dictionary;
+
+  /// Release the buffers of the structure, including those of the children
+  /// and of the dictionary, and set release to null.
+  void (*release)(struct ArrowArray*);
+  /// Opaque data of the producer.
+  void* private_data;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ARROW_C_DATA_INTERFACE
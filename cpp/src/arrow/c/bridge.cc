@@ -0,0 +1,902 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/c/bridge.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Type formats
+
+Status FormatTimeUnit(TimeUnit::type unit, char* out) {
+  switch (unit) {
+    case TimeUnit::SECOND:
+      *out = 's';
+      break;
+    case TimeUnit::MILLI:
+      *out = 'm';
+      break;
+    case TimeUnit::MICRO:
+      *out = 'u';
+      break;
+    case TimeUnit::NANO:
+      *out = 'n';
+      break;
+  }
+  return Status::OK();
+}
+
+// The format string of a type, that of the indices for dictionary types
+Status FormatType(const DataType& type, std::string* out) {
+  char unit;
+  switch (type.id()) {
+    case Type::NA:
+      *out = "n";
+      break;
+    case Type::BOOL:
+      *out = "b";
+      break;
+    case Type::INT8:
+      *out = "c";
+      break;
+    case Type::UINT8:
+      *out = "C";
+      break;
+    case Type::INT16:
+      *out = "s";
+      break;
+    case Type::UINT16:
+      *out = "S";
+      break;
+    case Type::INT32:
+      *out = "i";
+      break;
+    case Type::UINT32:
+      *out = "I";
+      break;
+    case Type::INT64:
+      *out = "l";
+      break;
+    case Type::UINT64:
+      *out = "L";
+      break;
+    case Type::HALF_FLOAT:
+      *out = "e";
+      break;
+    case Type::FLOAT:
+      *out = "f";
+      break;
+    case Type::DOUBLE:
+      *out = "g";
+      break;
+    case Type::BINARY:
+      *out = "z";
+      break;
+    case Type::LARGE_BINARY:
+      *out = "Z";
+      break;
+    case Type::STRING:
+      *out = "u";
+      break;
+    case Type::LARGE_STRING:
+      *out = "U";
+      break;
+    case Type::FIXED_SIZE_BINARY:
+      *out = "w:" +
+             std::to_string(static_cast<const FixedSizeBinaryType&>(type).byte_width());
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = static_cast<const DecimalType&>(type);
+      *out = "d:" + std::to_string(decimal_type.precision()) + "," +
+             std::to_string(decimal_type.scale());
+      break;
+    }
+    case Type::DATE32:
+      *out = "tdD";
+      break;
+    case Type::DATE64:
+      *out = "tdm";
+      break;
+    case Type::TIME32:
+    case Type::TIME64:
+      RETURN_NOT_OK(FormatTimeUnit(static_cast<const TimeType&>(type).unit(), &unit));
+      *out = std::string("tt") + unit;
+      break;
+    case Type::TIMESTAMP: {
+      const auto& timestamp_type = static_cast<const TimestampType&>(type);
+      RETURN_NOT_OK(FormatTimeUnit(timestamp_type.unit(), &unit));
+      *out = std::string("ts") + unit + ":" + timestamp_type.timezone();
+      break;
+    }
+    case Type::LIST:
+      *out = "+l";
+      break;
+    case Type::LARGE_LIST:
+      *out = "+L";
+      break;
+    case Type::STRUCT:
+      *out = "+s";
+      break;
+    case Type::DICTIONARY:
+      return FormatType(*static_cast<const DictionaryType&>(type).index_type(), out);
+    default:
+      return Status::NotImplemented("Type " + type.ToString() +
+                                    " has no format in the C data interface");
+  }
+  return Status::OK();
+}
+
+bool ParseInt32(const std::string& s, int32_t* out) {
+  if (s.empty() || s.size() > 9) {
+    return false;
+  }
+  *out = 0;
+  for (char c : s) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    *out = *out * 10 + (c - '0');
+  }
+  return true;
+}
+
+Status ParseTimeUnit(char unit, TimeUnit::type* out) {
+  switch (unit) {
+    case 's':
+      *out = TimeUnit::SECOND;
+      return Status::OK();
+    case 'm':
+      *out = TimeUnit::MILLI;
+      return Status::OK();
+    case 'u':
+      *out = TimeUnit::MICRO;
+      return Status::OK();
+    case 'n':
+      *out = TimeUnit::NANO;
+      return Status::OK();
+    default:
+      return Status::Invalid(std::string("Invalid time unit in format: ") + unit);
+  }
+}
+
+// The type of a format string, given the fields of the children
+Status ParseFormat(const std::string& format,
+                   const std::vector<std::shared_ptr<Field>>& children,
+                   std::shared_ptr<DataType>* out) {
+  auto invalid = [&format]() {
+    return Status::Invalid("Invalid or unsupported format string: '" + format + "'");
+  };
+  if (format.size() == 1) {
+    switch (format[0]) {
+      case 'n':
+        *out = null();
+        break;
+      case 'b':
+        *out = boolean();
+        break;
+      case 'c':
+        *out = int8();
+        break;
+      case 'C':
+        *out = uint8();
+        break;
+      case 's':
+        *out = int16();
+        break;
+      case 'S':
+        *out = uint16();
+        break;
+      case 'i':
+        *out = int32();
+        break;
+      case 'I':
+        *out = uint32();
+        break;
+      case 'l':
+        *out = int64();
+        break;
+      case 'L':
+        *out = uint64();
+        break;
+      case 'e':
+        *out = float16();
+        break;
+      case 'f':
+        *out = float32();
+        break;
+      case 'g':
+        *out = float64();
+        break;
+      case 'z':
+        *out = binary();
+        break;
+      case 'Z':
+        *out = large_binary();
+        break;
+      case 'u':
+        *out = utf8();
+        break;
+      case 'U':
+        *out = large_utf8();
+        break;
+      default:
+        return invalid();
+    }
+    return Status::OK();
+  }
+  if (format.compare(0, 2, "w:") == 0) {
+    int32_t byte_width;
+    if (!ParseInt32(format.substr(2), &byte_width)) {
+      return invalid();
+    }
+    *out = fixed_size_binary(byte_width);
+    return Status::OK();
+  }
+  if (format.compare(0, 2, "d:") == 0) {
+    // d:precision,scale[,bitwidth], only 128-bit decimals being supported
+    std::vector<int32_t> parameters;
+    std::stringstream ss(format.substr(2));
+    std::string parameter;
+    while (std::getline(ss, parameter, ',')) {
+      parameters.emplace_back();
+      if (!ParseInt32(parameter, &parameters.back())) {
+        return invalid();
+      }
+    }
+    if (parameters.size() < 2 || parameters.size() > 3 ||
+        (parameters.size() == 3 && parameters[2] != 128)) {
+      return invalid();
+    }
+    *out = decimal(parameters[0], parameters[1]);
+    return Status::OK();
+  }
+  if (format == "tdD") {
+    *out = date32();
+    return Status::OK();
+  }
+  if (format == "tdm") {
+    *out = date64();
+    return Status::OK();
+  }
+  TimeUnit::type unit;
+  if (format.size() == 3 && format.compare(0, 2, "tt") == 0) {
+    RETURN_NOT_OK(ParseTimeUnit(format[2], &unit));
+    *out = unit == TimeUnit::SECOND || unit == TimeUnit::MILLI ? time32(unit)
+                                                               : time64(unit);
+    return Status::OK();
+  }
+  if (format.size() >= 4 && format.compare(0, 2, "ts") == 0 && format[3] == ':') {
+    RETURN_NOT_OK(ParseTimeUnit(format[2], &unit));
+    *out = timestamp(unit, format.substr(4));
+    return Status::OK();
+  }
+  if ((format == "+l" || format == "+L") && children.size() == 1) {
+    *out = format == "+l" ? list(children[0]) : large_list(children[0]);
+    return Status::OK();
+  }
+  if (format == "+s") {
+    *out = struct_(children);
+    return Status::OK();
+  }
+  return invalid();
+}
+
+// ----------------------------------------------------------------------
+// Field metadata, encoded as an int32 number of pairs followed by the length
+// and bytes of each key and value
+
+void AppendInt32(int32_t value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(int32_t));
+}
+
+std::string EncodeMetadata(const KeyValueMetadata& metadata) {
+  std::string out;
+  AppendInt32(static_cast<int32_t>(metadata.size()), &out);
+  for (int64_t i = 0; i < metadata.size(); ++i) {
+    const std::string key = metadata.key(i);
+    const std::string value = metadata.value(i);
+    AppendInt32(static_cast<int32_t>(key.size()), &out);
+    out += key;
+    AppendInt32(static_cast<int32_t>(value.size()), &out);
+    out += value;
+  }
+  return out;
+}
+
+std::shared_ptr<const KeyValueMetadata> DecodeMetadata(const char* metadata) {
+  if (metadata == nullptr) {
+    return nullptr;
+  }
+  auto read_int32 = [&metadata]() {
+    int32_t value;
+    memcpy(&value, metadata, sizeof(int32_t));
+    metadata += sizeof(int32_t);
+    return value;
+  };
+  auto read_string = [&]() {
+    const int32_t length = read_int32();
+    std::string value(metadata, length);
+    metadata += length;
+    return value;
+  };
+  auto out = std::make_shared<KeyValueMetadata>();
+  const int32_t num_pairs = read_int32();
+  for (int32_t i = 0; i < num_pairs; ++i) {
+    std::string key = read_string();
+    out->Append(key, read_string());
+  }
+  return out;
+}
+
+// ----------------------------------------------------------------------
+// Export
+
+// The storage of the members of an exported ArrowSchema
+struct ExportedSchema {
+  std::string format;
+  std::string name;
+  std::string metadata;
+  std::vector<struct ArrowSchema> children;
+  std::vector<struct ArrowSchema*> child_pointers;
+  struct ArrowSchema dictionary;
+};
+
+void ReleaseExportedSchema(struct ArrowSchema* schema) {
+  if (schema->release == nullptr) {
+    return;
+  }
+  for (int64_t i = 0; i < schema->n_children; ++i) {
+    struct ArrowSchema* child = schema->children[i];
+    if (child->release != nullptr) {
+      child->release(child);
+    }
+  }
+  if (schema->dictionary != nullptr && schema->dictionary->release != nullptr) {
+    schema->dictionary->release(schema->dictionary);
+  }
+  delete reinterpret_cast<ExportedSchema*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+Status ExportSchemaImpl(const DataType& type, const std::string& name, int64_t flags,
+                        const KeyValueMetadata* metadata, struct ArrowSchema* out) {
+  std::unique_ptr<ExportedSchema> exported(new ExportedSchema());
+  RETURN_NOT_OK(FormatType(type, &exported->format));
+  exported->name = name;
+  if (metadata != nullptr) {
+    exported->metadata = EncodeMetadata(*metadata);
+  }
+  const auto& children = type.id() == Type::DICTIONARY
+                             ? std::vector<std::shared_ptr<Field>>()
+                             : type.children();
+  exported->children.resize(children.size());
+  for (auto& child : exported->children) {
+    child.release = nullptr;
+    exported->child_pointers.push_back(&child);
+  }
+  exported->dictionary.release = nullptr;
+
+  out->format = exported->format.c_str();
+  out->name = exported->name.c_str();
+  out->metadata = metadata != nullptr ? exported->metadata.data() : nullptr;
+  out->flags = flags;
+  out->n_children = static_cast<int64_t>(children.size());
+  out->children = exported->child_pointers.data();
+  out->dictionary = nullptr;
+  out->release = ReleaseExportedSchema;
+  ExportedSchema* storage = exported.release();
+  out->private_data = storage;
+
+  // Children exported so far are released along with out on failure
+  Status status;
+  for (size_t i = 0; i < children.size() && status.ok(); ++i) {
+    status = ExportField(*children[i], &storage->children[i]);
+  }
+  if (status.ok() && type.id() == Type::DICTIONARY) {
+    const auto& dictionary_type = static_cast<const DictionaryType&>(type);
+    if (dictionary_type.ordered()) {
+      out->flags |= ARROW_FLAG_DICTIONARY_ORDERED;
+    }
+    out->dictionary = &storage->dictionary;
+    status = ExportType(*dictionary_type.dictionary()->type(), out->dictionary);
+  }
+  if (!status.ok()) {
+    out->release(out);
+  }
+  return status;
+}
+
+// The storage of the members of an exported ArrowArray, which keeps the
+// exported data alive
+struct ExportedArray {
+  std::shared_ptr<ArrayData> data;
+  std::vector<const void*> buffers;
+  std::vector<struct ArrowArray> children;
+  std::vector<struct ArrowArray*> child_pointers;
+  struct ArrowArray dictionary;
+};
+
+void ReleaseExportedArray(struct ArrowArray* array) {
+  if (array->release == nullptr) {
+    return;
+  }
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    struct ArrowArray* child = array->children[i];
+    if (child->release != nullptr) {
+      child->release(child);
+    }
+  }
+  if (array->dictionary != nullptr && array->dictionary->release != nullptr) {
+    array->dictionary->release(array->dictionary);
+  }
+  delete reinterpret_cast<ExportedArray*>(array->private_data);
+  array->release = nullptr;
+}
+
+void ExportArrayData(const std::shared_ptr<ArrayData>& data, struct ArrowArray* out) {
+  std::unique_ptr<ExportedArray> exported(new ExportedArray());
+  exported->data = data;
+  // Null arrays have no buffers in the C data interface
+  if (data->type->id() != Type::NA) {
+    for (const auto& buffer : data->buffers) {
+      exported->buffers.push_back(buffer ? buffer->data() : nullptr);
+    }
+  }
+  exported->children.resize(data->child_data.size());
+  for (size_t i = 0; i < data->child_data.size(); ++i) {
+    ExportArrayData(data->child_data[i], &exported->children[i]);
+    exported->child_pointers.push_back(&exported->children[i]);
+  }
+
+  out->length = data->length;
+  out->null_count = data->null_count;
+  out->offset = data->offset;
+  out->n_buffers = static_cast<int64_t>(exported->buffers.size());
+  out->n_children = static_cast<int64_t>(exported->children.size());
+  out->buffers = exported->buffers.data();
+  out->children = exported->child_pointers.data();
+  out->dictionary = nullptr;
+  if (data->type->id() == Type::DICTIONARY) {
+    const auto& dictionary_type = static_cast<const DictionaryType&>(*data->type);
+    out->dictionary = &exported->dictionary;
+    ExportArrayData(dictionary_type.dictionary()->data(), out->dictionary);
+  }
+  out->release = ReleaseExportedArray;
+  out->private_data = exported.release();
+}
+
+// Export data, checking that its type can be exported, and the type if
+// out_schema is given
+Status ExportArrayDataWithType(const std::shared_ptr<ArrayData>& data,
+                               const Status& type_status, struct ArrowSchema* schema,
+                               struct ArrowArray* out, struct ArrowSchema* out_schema) {
+  RETURN_NOT_OK(type_status);
+  ExportArrayData(data, out);
+  if (out_schema != nullptr) {
+    *out_schema = *schema;
+  } else {
+    schema->release(schema);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Import
+
+// The owner of an imported ArrowArray, which releases it once no imported
+// buffer uses it anymore
+class ImportedArray {
+ public:
+  explicit ImportedArray(struct ArrowArray* array) : array_(*array) {
+    // The structure is moved
+    array->release = nullptr;
+  }
+
+  ~ImportedArray() {
+    if (array_.release != nullptr) {
+      array_.release(&array_);
+      DCHECK(array_.release == nullptr);
+    }
+  }
+
+  const struct ArrowArray& array() const { return array_; }
+
+ private:
+  struct ArrowArray array_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ImportedArray);
+};
+
+class ImportedBuffer : public Buffer {
+ public:
+  ImportedBuffer(const void* data, int64_t size, std::shared_ptr<ImportedArray> owner)
+      : Buffer(reinterpret_cast<const uint8_t*>(data), size), owner_(std::move(owner)) {}
+
+ private:
+  std::shared_ptr<ImportedArray> owner_;
+};
+
+// Release an imported ArrowSchema when going out of scope
+class SchemaReleaser {
+ public:
+  explicit SchemaReleaser(struct ArrowSchema* schema) : schema_(schema) {}
+
+  ~SchemaReleaser() {
+    if (schema_->release != nullptr) {
+      schema_->release(schema_);
+    }
+  }
+
+ private:
+  struct ArrowSchema* schema_;
+};
+
+Status CheckNotReleased(const struct ArrowSchema* schema) {
+  if (schema->release == nullptr) {
+    return Status::Invalid("Cannot import a released ArrowSchema");
+  }
+  return Status::OK();
+}
+
+Status CheckNotReleased(const struct ArrowArray* array) {
+  if (array->release == nullptr) {
+    return Status::Invalid("Cannot import a released ArrowArray");
+  }
+  return Status::OK();
+}
+
+Status ImportFieldImpl(const struct ArrowSchema& schema, std::shared_ptr<Field>* out);
+
+Status ImportTypeImpl(const struct ArrowSchema& schema, std::shared_ptr<DataType>* out) {
+  if (schema.dictionary != nullptr) {
+    return Status::NotImplemented(
+        "Dictionary-encoded types can only be imported along with their data");
+  }
+  std::vector<std::shared_ptr<Field>> children(schema.n_children);
+  for (int64_t i = 0; i < schema.n_children; ++i) {
+    RETURN_NOT_OK(ImportFieldImpl(*schema.children[i], &children[i]));
+  }
+  return ParseFormat(schema.format, children, out);
+}
+
+std::shared_ptr<Field> MakeField(const struct ArrowSchema& schema,
+                                 const std::shared_ptr<DataType>& type) {
+  return field(schema.name != nullptr ? schema.name : "", type,
+               (schema.flags & ARROW_FLAG_NULLABLE) != 0,
+               DecodeMetadata(schema.metadata));
+}
+
+Status ImportFieldImpl(const struct ArrowSchema& schema, std::shared_ptr<Field>* out) {
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(ImportTypeImpl(schema, &type));
+  *out = MakeField(schema, type);
+  return Status::OK();
+}
+
+// Make an imported buffer of the given size, or a null buffer
+std::shared_ptr<Buffer> ImportBuffer(const struct ArrowArray& array, int64_t i,
+                                     int64_t size,
+                                     const std::shared_ptr<ImportedArray>& owner) {
+  const void* data = array.buffers[i];
+  if (data == nullptr) {
+    return nullptr;
+  }
+  return std::make_shared<ImportedBuffer>(data, size, owner);
+}
+
+template <typename OffsetType>
+Status ImportBinaryBuffers(const struct ArrowArray& array, bool has_data,
+                           const std::shared_ptr<ImportedArray>& owner,
+                           std::vector<std::shared_ptr<Buffer>>* buffers) {
+  const int64_t num_offsets = array.length + array.offset + 1;
+  const auto offsets = reinterpret_cast<const OffsetType*>(array.buffers[1]);
+  if (offsets == nullptr && array.length > 0) {
+    return Status::Invalid("Imported array has no offsets");
+  }
+  buffers->push_back(
+      ImportBuffer(array, 1, num_offsets * static_cast<int64_t>(sizeof(OffsetType)),
+                   owner));
+  if (has_data) {
+    const int64_t data_size = offsets != nullptr ? offsets[num_offsets - 1] : 0;
+    buffers->push_back(ImportBuffer(array, 2, data_size, owner));
+  }
+  return Status::OK();
+}
+
+// Import the data of an array. The type is built from schema if given, so
+// that dictionary-encoded types can be imported with their dictionary, and
+// is type otherwise
+Status ImportArrayData(const struct ArrowArray& array, const struct ArrowSchema* schema,
+                       std::shared_ptr<DataType> type,
+                       const std::shared_ptr<ImportedArray>& owner,
+                       std::shared_ptr<ArrayData>* out) {
+  std::vector<std::shared_ptr<ArrayData>> child_data(array.n_children);
+  if (schema != nullptr) {
+    if (schema->n_children != array.n_children) {
+      std::stringstream ss;
+      ss << "Imported array has " << array.n_children << " children, its type "
+         << schema->n_children;
+      return Status::Invalid(ss.str());
+    }
+    std::vector<std::shared_ptr<Field>> children(array.n_children);
+    for (int64_t i = 0; i < array.n_children; ++i) {
+      RETURN_NOT_OK(ImportArrayData(*array.children[i], schema->children[i], nullptr,
+                                    owner, &child_data[i]));
+      children[i] = MakeField(*schema->children[i], child_data[i]->type);
+    }
+    RETURN_NOT_OK(ParseFormat(schema->format, children, &type));
+    if (schema->dictionary != nullptr) {
+      if (array.dictionary == nullptr) {
+        return Status::Invalid("Imported dictionary-encoded array has no dictionary");
+      }
+      if (!is_integer(type->id())) {
+        return Status::Invalid("Dictionary indices must be integers, not " +
+                               type->ToString());
+      }
+      std::shared_ptr<ArrayData> dictionary;
+      RETURN_NOT_OK(
+          ImportArrayData(*array.dictionary, schema->dictionary, nullptr, owner,
+                          &dictionary));
+      type = arrow::dictionary(type, MakeArray(dictionary),
+                               (schema->flags & ARROW_FLAG_DICTIONARY_ORDERED) != 0);
+    }
+  } else {
+    if (type->id() == Type::DICTIONARY) {
+      return Status::NotImplemented(
+          "Dictionary-encoded arrays can only be imported along with their type");
+    }
+    if (type->num_children() != array.n_children) {
+      std::stringstream ss;
+      ss << "Imported array has " << array.n_children << " children, its type "
+         << type->num_children();
+      return Status::Invalid(ss.str());
+    }
+    for (int64_t i = 0; i < array.n_children; ++i) {
+      RETURN_NOT_OK(ImportArrayData(*array.children[i], nullptr,
+                                    type->child(static_cast<int>(i))->type(), owner,
+                                    &child_data[i]));
+    }
+  }
+
+  // The C data interface gives no sizes of buffers, they follow from the type
+  const Type::type storage_id = type->id() == Type::DICTIONARY
+                                    ? static_cast<const DictionaryType&>(*type)
+                                          .index_type()
+                                          ->id()
+                                    : type->id();
+  int64_t num_buffers;
+  switch (storage_id) {
+    case Type::NA:
+      num_buffers = 0;
+      break;
+    case Type::STRUCT:
+      num_buffers = 1;
+      break;
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      num_buffers = 3;
+      break;
+    default:
+      num_buffers = 2;
+      break;
+  }
+  if (array.n_buffers != num_buffers) {
+    std::stringstream ss;
+    ss << "Imported array of type " << type->ToString() << " has " << array.n_buffers
+       << " buffers, expected " << num_buffers;
+    return Status::Invalid(ss.str());
+  }
+  const int64_t num_slots = array.length + array.offset;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  if (storage_id == Type::NA) {
+    buffers.push_back(nullptr);
+  } else {
+    if (array.buffers[0] == nullptr && array.null_count != 0 && array.null_count != -1) {
+      return Status::Invalid("Imported array has nulls but no validity bitmap");
+    }
+    buffers.push_back(ImportBuffer(array, 0, BitUtil::BytesForBits(num_slots), owner));
+  }
+  switch (storage_id) {
+    case Type::NA:
+    case Type::STRUCT:
+      break;
+    case Type::BINARY:
+    case Type::STRING:
+      RETURN_NOT_OK(ImportBinaryBuffers<int32_t>(array, true, owner, &buffers));
+      break;
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      RETURN_NOT_OK(ImportBinaryBuffers<int64_t>(array, true, owner, &buffers));
+      break;
+    case Type::LIST:
+      RETURN_NOT_OK(ImportBinaryBuffers<int32_t>(array, false, owner, &buffers));
+      break;
+    case Type::LARGE_LIST:
+      RETURN_NOT_OK(ImportBinaryBuffers<int64_t>(array, false, owner, &buffers));
+      break;
+    case Type::BOOL:
+      buffers.push_back(ImportBuffer(array, 1, BitUtil::BytesForBits(num_slots), owner));
+      break;
+    default: {
+      const auto& index_or_value_type =
+          type->id() == Type::DICTIONARY
+              ? *static_cast<const DictionaryType&>(*type).index_type()
+              : *type;
+      const int64_t byte_width =
+          static_cast<const FixedWidthType&>(index_or_value_type).bit_width() / 8;
+      buffers.push_back(ImportBuffer(array, 1, num_slots * byte_width, owner));
+      break;
+    }
+  }
+  *out = ArrayData::Make(type, array.length, std::move(buffers),
+                         storage_id == Type::NA ? array.length : array.null_count,
+                         array.offset);
+  (*out)->child_data = std::move(child_data);
+  return Status::OK();
+}
+
+Status MakeRecordBatch(const std::shared_ptr<Schema>& schema,
+                       const std::shared_ptr<ArrayData>& data,
+                       std::shared_ptr<RecordBatch>* out) {
+  if (data->type->id() != Type::STRUCT) {
+    return Status::Invalid("Record batches are imported from struct arrays");
+  }
+  if (data->null_count != 0 && data->buffers[0] != nullptr) {
+    return Status::Invalid("Imported record batch has null rows");
+  }
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  for (const auto& child : data->child_data) {
+    // The children of struct arrays are sliced by the offset of the parent
+    columns.push_back(data->offset == 0 && child->length == data->length
+                          ? child
+                          : MakeArray(child)->Slice(data->offset, data->length)->data());
+  }
+  *out = RecordBatch::Make(schema, data->length, std::move(columns));
+  return Status::OK();
+}
+
+}  // namespace
+
+Status ExportType(const DataType& type, struct ArrowSchema* out) {
+  return ExportSchemaImpl(type, "", ARROW_FLAG_NULLABLE, nullptr, out);
+}
+
+Status ExportField(const Field& field, struct ArrowSchema* out) {
+  return ExportSchemaImpl(*field.type(), field.name(),
+                          field.nullable() ? ARROW_FLAG_NULLABLE : 0,
+                          field.metadata().get(), out);
+}
+
+Status ExportSchema(const Schema& schema, struct ArrowSchema* out) {
+  const StructType type(schema.fields());
+  return ExportSchemaImpl(type, "", 0, schema.metadata().get(), out);
+}
+
+Status ExportArray(const Array& array, struct ArrowArray* out,
+                   struct ArrowSchema* out_schema) {
+  struct ArrowSchema schema;
+  const Status type_status = ExportType(*array.type(), &schema);
+  return ExportArrayDataWithType(array.data(), type_status, &schema, out, out_schema);
+}
+
+Status ExportRecordBatch(const RecordBatch& batch, struct ArrowArray* out,
+                         struct ArrowSchema* out_schema) {
+  struct ArrowSchema schema;
+  const Status type_status = ExportSchema(*batch.schema(), &schema);
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back(batch.column_data(i));
+  }
+  auto data = ArrayData::Make(struct_(batch.schema()->fields()), batch.num_rows(),
+                              {nullptr}, 0);
+  data->child_data = std::move(columns);
+  return ExportArrayDataWithType(data, type_status, &schema, out, out_schema);
+}
+
+Status ImportType(struct ArrowSchema* schema, std::shared_ptr<DataType>* out) {
+  RETURN_NOT_OK(CheckNotReleased(schema));
+  SchemaReleaser releaser(schema);
+  return ImportTypeImpl(*schema, out);
+}
+
+Status ImportField(struct ArrowSchema* schema, std::shared_ptr<Field>* out) {
+  RETURN_NOT_OK(CheckNotReleased(schema));
+  SchemaReleaser releaser(schema);
+  return ImportFieldImpl(*schema, out);
+}
+
+Status ImportSchema(struct ArrowSchema* schema, std::shared_ptr<Schema>* out) {
+  RETURN_NOT_OK(CheckNotReleased(schema));
+  SchemaReleaser releaser(schema);
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(ImportTypeImpl(*schema, &type));
+  if (type->id() != Type::STRUCT) {
+    return Status::Invalid("Schemas are imported from struct types, not " +
+                           type->ToString());
+  }
+  *out = arrow::schema(type->children(), DecodeMetadata(schema->metadata));
+  return Status::OK();
+}
+
+Status ImportArray(struct ArrowArray* array, const std::shared_ptr<DataType>& type,
+                   std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckNotReleased(array));
+  auto owner = std::make_shared<ImportedArray>(array);
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(ImportArrayData(owner->array(), nullptr, type, owner, &data));
+  *out = MakeArray(data);
+  return Status::OK();
+}
+
+Status ImportArray(struct ArrowArray* array, struct ArrowSchema* type,
+                   std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckNotReleased(type));
+  SchemaReleaser releaser(type);
+  RETURN_NOT_OK(CheckNotReleased(array));
+  auto owner = std::make_shared<ImportedArray>(array);
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(ImportArrayData(owner->array(), type, nullptr, owner, &data));
+  *out = MakeArray(data);
+  return Status::OK();
+}
+
+Status ImportRecordBatch(struct ArrowArray* array, const std::shared_ptr<Schema>& schema,
+                         std::shared_ptr<RecordBatch>* out) {
+  RETURN_NOT_OK(CheckNotReleased(array));
+  auto owner = std::make_shared<ImportedArray>(array);
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(ImportArrayData(owner->array(), nullptr, struct_(schema->fields()),
+                                owner, &data));
+  return MakeRecordBatch(schema, data, out);
+}
+
+Status ImportRecordBatch(struct ArrowArray* array, struct ArrowSchema* schema,
+                         std::shared_ptr<RecordBatch>* out) {
+  RETURN_NOT_OK(CheckNotReleased(schema));
+  SchemaReleaser releaser(schema);
+  RETURN_NOT_OK(CheckNotReleased(array));
+  auto owner = std::make_shared<ImportedArray>(array);
+  std::shared_ptr<ArrayData> data;
+  RETURN_NOT_OK(ImportArrayData(owner->array(), schema, nullptr, owner, &data));
+  if (data->type->id() != Type::STRUCT) {
+    return Status::Invalid("Record batches are imported from struct arrays");
+  }
+  return MakeRecordBatch(
+      arrow::schema(data->type->children(), DecodeMetadata(schema->metadata)), data, out);
+}
+
+}  // namespace arrow
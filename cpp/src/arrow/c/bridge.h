@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_C_BRIDGE_H
+#define ARROW_C_BRIDGE_H
+
+#include <memory>
+
+#include "arrow/c/abi.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Field;
+class RecordBatch;
+class Schema;
+
+/// \defgroup c-data-interface Exchange through the Arrow C data interface
+///
+/// Export functions fill a caller-allocated structure that the consumer
+/// releases once done, the exported data being kept alive until then. Import
+/// functions take over a structure, which is marked released, and release it
+/// once the imported data is no longer used. No data is copied either way.
+///
+/// The dictionary of a dictionary-encoded array is part of its type in C++,
+/// but travels with the data in the C interface: dictionary-encoded types are
+/// only imported along with their data, with ImportArray and
+/// ImportRecordBatch from an ArrowSchema.
+///
+/// @{
+
+/// \brief Export a type
+///
+/// \param[in] type the type to export
+/// \param[out] out the C structure to fill
+ARROW_EXPORT
+Status ExportType(const DataType& type, struct ArrowSchema* out);
+
+/// \brief Export a field, with its name, nullability and metadata
+ARROW_EXPORT
+Status ExportField(const Field& field, struct ArrowSchema* out);
+
+/// \brief Export a schema as a struct type whose children are its fields
+ARROW_EXPORT
+Status ExportSchema(const Schema& schema, struct ArrowSchema* out);
+
+/// \brief Export an array, and optionally its type
+///
+/// \param[in] array the array to export
+/// \param[out] out the C structure to fill with the data
+/// \param[out] out_schema the C structure to fill with the type, or null
+ARROW_EXPORT
+Status ExportArray(const Array& array, struct ArrowArray* out,
+                   struct ArrowSchema* out_schema = NULLPTR);
+
+/// \brief Export a record batch as a struct array, and optionally its schema
+ARROW_EXPORT
+Status ExportRecordBatch(const RecordBatch& batch, struct ArrowArray* out,
+                         struct ArrowSchema* out_schema = NULLPTR);
+
+/// \brief Import a type
+///
+/// \param[in,out] schema the C structure, released by the call
+/// \param[out] out the imported type
+ARROW_EXPORT
+Status ImportType(struct ArrowSchema* schema, std::shared_ptr<DataType>* out);
+
+/// \brief Import a field
+ARROW_EXPORT
+Status ImportField(struct ArrowSchema* schema, std::shared_ptr<Field>* out);
+
+/// \brief Import a schema from a struct type
+ARROW_EXPORT
+Status ImportSchema(struct ArrowSchema* schema, std::shared_ptr<Schema>* out);
+
+/// \brief Import an array of a known type
+///
+/// \param[in,out] array the C structure, taken over by the imported array
+/// \param[in] type the type of the array, which may not be dictionary-encoded
+/// \param[out] out the imported array
+ARROW_EXPORT
+Status ImportArray(struct ArrowArray* array, const std::shared_ptr<DataType>& type,
+                   std::shared_ptr<Array>* out);
+
+/// \brief Import an array along with its type
+///
+/// \param[in,out] array the C structure, taken over by the imported array
+/// \param[in,out] type the C structure of the type, released by the call
+/// \param[out] out the imported array
+ARROW_EXPORT
+Status ImportArray(struct ArrowArray* array, struct ArrowSchema* type,
+                   std::shared_ptr<Array>* out);
+
+/// \brief Import a record batch from a struct array of a known schema
+ARROW_EXPORT
+Status ImportRecordBatch(struct ArrowArray* array, const std::shared_ptr<Schema>& schema,
+                         std::shared_ptr<RecordBatch>* out);
+
+/// \brief Import a record batch from a struct array along with its schema
+ARROW_EXPORT
+Status ImportRecordBatch(struct ArrowArray* array, struct ArrowSchema* schema,
+                         std::shared_ptr<RecordBatch>* out);
+
+/// @}
+
+}  // namespace arrow
+
+#endif  // ARROW_C_BRIDGE_H
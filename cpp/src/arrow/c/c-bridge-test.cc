@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/c/bridge.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+// Export a type and import it back
+static void CheckTypeRoundtrip(const std::shared_ptr<DataType>& type,
+                               const std::string& format) {
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportType(*type, &c_schema));
+  ASSERT_EQ(format, c_schema.format);
+  std::shared_ptr<DataType> imported;
+  ASSERT_OK(ImportType(&c_schema, &imported));
+  ASSERT_EQ(nullptr, c_schema.release);
+  ASSERT_TRUE(imported->Equals(*type)) << imported->ToString();
+}
+
+TEST(TestCBridge, TypeRoundtrip) {
+  CheckTypeRoundtrip(null(), "n");
+  CheckTypeRoundtrip(boolean(), "b");
+  CheckTypeRoundtrip(int8(), "c");
+  CheckTypeRoundtrip(uint64(), "L");
+  CheckTypeRoundtrip(float64(), "g");
+  CheckTypeRoundtrip(utf8(), "u");
+  CheckTypeRoundtrip(large_binary(), "Z");
+  CheckTypeRoundtrip(fixed_size_binary(3), "w:3");
+  CheckTypeRoundtrip(decimal(12, 2), "d:12,2");
+  CheckTypeRoundtrip(date32(), "tdD");
+  CheckTypeRoundtrip(time64(TimeUnit::NANO), "ttn");
+  CheckTypeRoundtrip(timestamp(TimeUnit::MICRO), "tsu:");
+  CheckTypeRoundtrip(timestamp(TimeUnit::SECOND, "Europe/Paris"), "tss:Europe/Paris");
+  CheckTypeRoundtrip(list(field("x", int32(), false)), "+l");
+  CheckTypeRoundtrip(struct_({field("a", utf8()), field("b", large_list(int16()))}),
+                     "+s");
+
+  struct ArrowSchema c_schema;
+  ASSERT_RAISES(NotImplemented, ExportType(*run_length_encoded(int32()), &c_schema));
+}
+
+TEST(TestCBridge, SchemaRoundtrip) {
+  auto metadata = std::make_shared<KeyValueMetadata>(
+      std::vector<std::string>{"key", "empty"}, std::vector<std::string>{"value", ""});
+  auto schema = arrow::schema(
+      {field("ints", int32(), false), field("strings", utf8(), true, metadata)},
+      metadata);
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportSchema(*schema, &c_schema));
+  ASSERT_EQ(2, c_schema.n_children);
+  ASSERT_EQ(std::string("ints"), c_schema.children[0]->name);
+  ASSERT_EQ(0, c_schema.children[0]->flags);
+  ASSERT_EQ(ARROW_FLAG_NULLABLE, c_schema.children[1]->flags);
+  std::shared_ptr<Schema> imported;
+  ASSERT_OK(ImportSchema(&c_schema, &imported));
+  ASSERT_TRUE(imported->Equals(*schema));
+  ASSERT_TRUE(imported->metadata()->Equals(*metadata));
+  ASSERT_TRUE(imported->field(1)->metadata()->Equals(*metadata));
+
+  ASSERT_RAISES(Invalid, ImportSchema(&c_schema, &imported));
+}
+
+TEST(TestCBridge, ArrayRoundtrip) {
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>({true, false, true, true},
+                                           {"foo", "", "quux", "z"}, &strings);
+  strings = strings->Slice(1);
+  const uint8_t* data = strings->data()->buffers[2]->data();
+
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportArray(*strings, &c_array, &c_schema));
+  ASSERT_EQ(3, c_array.length);
+  ASSERT_EQ(1, c_array.offset);
+  ASSERT_EQ(3, c_array.n_buffers);
+  std::weak_ptr<ArrayData> exported_data = strings->data();
+  strings.reset();
+  // The exported structure keeps the data alive
+  ASSERT_FALSE(exported_data.expired());
+
+  std::shared_ptr<Array> imported;
+  ASSERT_OK(ImportArray(&c_array, &c_schema, &imported));
+  ASSERT_EQ(nullptr, c_array.release);
+  ASSERT_OK(ValidateArrayFull(*imported));
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<StringType, std::string>({false, true, true}, {"", "quux", "z"},
+                                           &expected);
+  ASSERT_ARRAYS_EQUAL(*expected, *imported);
+  // No copies are made
+  ASSERT_EQ(data, imported->data()->buffers[2]->data());
+  imported.reset();
+  ASSERT_TRUE(exported_data.expired());
+}
+
+TEST(TestCBridge, NestedArrayRoundtrip) {
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int16Type, int16_t>({1, 2, 3, 4, 5}, &values);
+  std::shared_ptr<Array> offsets;
+  ArrayFromVector<Int32Type, int32_t>({0, 2, 2, 5}, &offsets);
+  std::shared_ptr<Array> lists;
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, default_memory_pool(), &lists));
+
+  struct ArrowArray c_array;
+  ASSERT_OK(ExportArray(*lists, &c_array));
+  ASSERT_EQ(1, c_array.n_children);
+  std::shared_ptr<Array> imported;
+  ASSERT_OK(ImportArray(&c_array, lists->type(), &imported));
+  ASSERT_OK(ValidateArrayFull(*imported));
+  ASSERT_ARRAYS_EQUAL(*lists, *imported);
+
+  ASSERT_OK(ExportArray(*lists, &c_array));
+  ASSERT_RAISES(Invalid, ImportArray(&c_array, utf8(), &imported));
+  // The structure is released even if it cannot be imported
+  ASSERT_EQ(nullptr, c_array.release);
+}
+
+TEST(TestCBridge, DictionaryRoundtrip) {
+  std::shared_ptr<Array> dictionary;
+  ArrayFromVector<StringType, std::string>({"a", "b"}, &dictionary);
+  std::shared_ptr<Array> indices;
+  ArrayFromVector<Int8Type, int8_t>({1, 0, 1}, &indices);
+  auto type = arrow::dictionary(int8(), dictionary, true);
+  auto array = std::make_shared<DictionaryArray>(type, indices);
+
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportArray(*array, &c_array, &c_schema));
+  ASSERT_EQ(std::string("c"), c_schema.format);
+  ASSERT_EQ(std::string("u"), c_schema.dictionary->format);
+  ASSERT_NE(0, c_schema.flags & ARROW_FLAG_DICTIONARY_ORDERED);
+  ASSERT_NE(nullptr, c_array.dictionary);
+  std::shared_ptr<Array> imported;
+  ASSERT_OK(ImportArray(&c_array, &c_schema, &imported));
+  ASSERT_ARRAYS_EQUAL(*array, *imported);
+
+  // The dictionary is only known with the data
+  ASSERT_OK(ExportType(*type, &c_schema));
+  std::shared_ptr<DataType> imported_type;
+  ASSERT_RAISES(NotImplemented, ImportType(&c_schema, &imported_type));
+}
+
+TEST(TestCBridge, RecordBatchRoundtrip) {
+  std::shared_ptr<Array> ints;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true}, {1, 2, 3}, &ints);
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>({"x", "y", "z"}, &strings);
+  auto schema = arrow::schema({field("ints", int64()), field("strings", utf8())});
+  auto batch = RecordBatch::Make(schema, 3, {ints, strings});
+
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+  ASSERT_EQ(std::string("+s"), c_schema.format);
+  std::shared_ptr<RecordBatch> imported;
+  ASSERT_OK(ImportRecordBatch(&c_array, &c_schema, &imported));
+  ASSERT_TRUE(imported->Equals(*batch));
+
+  ASSERT_OK(ExportRecordBatch(*batch->Slice(1), &c_array));
+  ASSERT_OK(ImportRecordBatch(&c_array, schema, &imported));
+  ASSERT_TRUE(imported->Equals(*batch->Slice(1)));
+}
+
+}  // namespace arrow
@@ -19,17 +19,27 @@
 
 #include "arrow/compare.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/hash-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string-view-util.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -39,6 +49,117 @@ namespace arrow {
 
 namespace internal {
 
+// The validity bitmap of an array, or null when all its slots are valid
+static inline const uint8_t* ValidityBitmap(const Array& array) {
+  return array.null_count() > 0 ? array.null_bitmap_data() : nullptr;
+}
+
+// Whether the slots of [left_start, left_start + length) and of the range of
+// the same length at right_start are null at the same positions
+static bool NullsEqual(const Array& left, int64_t left_start, const Array& right,
+                       int64_t right_start, int64_t length) {
+  const uint8_t* left_bitmap = ValidityBitmap(left);
+  const uint8_t* right_bitmap = ValidityBitmap(right);
+  if (left_bitmap == nullptr && right_bitmap == nullptr) {
+    return true;
+  } else if (left_bitmap == nullptr) {
+    return CountSetBits(right_bitmap, right.offset() + right_start, length) == length;
+  } else if (right_bitmap == nullptr) {
+    return CountSetBits(left_bitmap, left.offset() + left_start, length) == length;
+  }
+  return BitmapEquals(left_bitmap, left.offset() + left_start, right_bitmap,
+                      right.offset() + right_start, length);
+}
+
+// Compare the valid slots of [start, start + length) of an array, calling
+// compare_range(position, length) on the stretches without nulls and
+// compare_slot(position) on the valid slots of the 64-bit blocks with some
+// nulls. Returns false as soon as one of them does.
+template <typename CompareRange, typename CompareSlot>
+static bool CompareValidSlots(const Array& array, int64_t start, int64_t length,
+                              CompareRange&& compare_range, CompareSlot&& compare_slot) {
+  const uint8_t* bitmap = ValidityBitmap(array);
+  if (bitmap == nullptr) {
+    return length == 0 || compare_range(start, length);
+  }
+  BitBlockCounter counter(bitmap, array.offset() + start, length);
+  int64_t position = start;
+  int64_t stretch_start = start;
+  for (BitBlockCount block = counter.NextBlock(); block.length > 0;
+       block = counter.NextBlock()) {
+    if (!block.AllSet()) {
+      if (position > stretch_start &&
+          !compare_range(stretch_start, position - stretch_start)) {
+        return false;
+      }
+      if (!block.NoneSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (BitUtil::GetBit(bitmap, array.offset() + i) && !compare_slot(i)) {
+            return false;
+          }
+        }
+      }
+      stretch_start = position + block.length;
+    }
+    position += block.length;
+  }
+  return position == stretch_start ||
+         compare_range(stretch_start, position - stretch_start);
+}
+
+// Whether the offsets of [left_start, left_start + length] and of the range
+// at right_start delimit values of the same lengths
+template <typename offset_type>
+static bool RebasedOffsetsEqual(const offset_type* left_offsets,
+                                const offset_type* right_offsets, int64_t length) {
+  const offset_type left_base = left_offsets[0];
+  const offset_type right_base = right_offsets[0];
+  if (left_base == right_base) {
+    return std::memcmp(left_offsets, right_offsets,
+                       static_cast<size_t>(length + 1) * sizeof(offset_type)) == 0;
+  }
+  // No early exit, so that the compiler can vectorize the loop
+  offset_type differences = 0;
+  for (int64_t i = 1; i <= length; ++i) {
+    differences |= (left_offsets[i] - left_base) ^ (right_offsets[i] - right_base);
+  }
+  return differences == 0;
+}
+
+// Whether fixed-width primitive values are equal in [left_start, left_start +
+// length) and the range at right_start. Integers are compared bytewise,
+// floating point values with operator== as value by value.
+template <typename ArrayType>
+static typename std::enable_if<
+    !std::is_floating_point<typename ArrayType::value_type>::value, bool>::type
+PrimitiveRangeEquals(const ArrayType& left, const ArrayType& right, int64_t left_start,
+                     int64_t right_start, int64_t length) {
+  using T = typename ArrayType::value_type;
+  return std::memcmp(left.raw_values() + left_start, right.raw_values() + right_start,
+                     static_cast<size_t>(length) * sizeof(T)) == 0;
+}
+
+template <typename ArrayType>
+static typename std::enable_if<
+    std::is_floating_point<typename ArrayType::value_type>::value, bool>::type
+PrimitiveRangeEquals(const ArrayType& left, const ArrayType& right, int64_t left_start,
+                     int64_t right_start, int64_t length) {
+  const auto* left_values = left.raw_values() + left_start;
+  const auto* right_values = right.raw_values() + right_start;
+  bool equal = true;
+  for (int64_t i = 0; i < length; ++i) {
+    equal &= left_values[i] == right_values[i];
+  }
+  return equal;
+}
+
+static bool PrimitiveRangeEquals(const BooleanArray& left, const BooleanArray& right,
+                                 int64_t left_start, int64_t right_start,
+                                 int64_t length) {
+  return BitmapEquals(left.values()->data(), left.offset() + left_start,
+                      right.values()->data(), right.offset() + right_start, length);
+}
+
 class RangeEqualsVisitor {
  public:
   RangeEqualsVisitor(const Array& right, int64_t left_start_idx, int64_t left_end_idx,
@@ -52,97 +173,108 @@ class RangeEqualsVisitor {
   template <typename ArrayType>
   inline Status CompareValues(const ArrayType& left) {
     const auto& right = static_cast<const ArrayType&>(right_);
+    const int64_t shift = right_start_idx_ - left_start_idx_;
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i) ||
-          (!is_null && left.Value(i) != right.Value(o_i))) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    result_ =
+        NullsEqual(left, left_start_idx_, right, right_start_idx_, length()) &&
+        CompareValidSlots(
+            left, left_start_idx_, length(),
+            [&](int64_t i, int64_t n) {
+              return PrimitiveRangeEquals(left, right, i, i + shift, n);
+            },
+            [&](int64_t i) { return left.Value(i) == right.Value(i + shift); });
     return Status::OK();
   }
 
-  bool CompareBinaryRange(const BinaryArray& left) const {
-    const auto& right = static_cast<const BinaryArray&>(right_);
-
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
+  template <typename ArrayType>
+  bool CompareBinaryRange(const ArrayType& left) const {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = static_cast<const ArrayType&>(right_);
+    const int64_t shift = right_start_idx_ - left_start_idx_;
+
+    // Compare the stretches of valid values with their offsets rebased, then
+    // their data with a single memcmp
+    auto compare_range = [&](int64_t i, int64_t n) {
+      const offset_type* left_offsets = left.raw_value_offsets() + i;
+      const offset_type* right_offsets = right.raw_value_offsets() + i + shift;
+      if (!RebasedOffsetsEqual(left_offsets, right_offsets, n)) {
         return false;
       }
+      const offset_type num_bytes = left_offsets[n] - left_offsets[0];
+      return num_bytes == 0 ||
+             std::memcmp(left.value_data()->data() + left_offsets[0],
+                         right.value_data()->data() + right_offsets[0],
+                         static_cast<size_t>(num_bytes)) == 0;
+    };
+    return NullsEqual(left, left_start_idx_, right, right_start_idx_, length()) &&
+           CompareValidSlots(left, left_start_idx_, length(), compare_range,
+                             [&](int64_t i) { return compare_range(i, 1); });
+  }
 
-      if (end_offset - begin_offset > 0 &&
-          std::memcmp(left.value_data()->data() + begin_offset,
-                      right.value_data()->data() + right_begin_offset,
-                      static_cast<size_t>(end_offset - begin_offset))) {
-        return false;
-      }
-    }
-    return true;
+  template <typename ArrayType>
+  bool CompareLists(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = static_cast<const ArrayType&>(right_);
+
+    const std::shared_ptr<Array>& left_values = left.values();
+    const std::shared_ptr<Array>& right_values = right.values();
+    const int64_t shift = right_start_idx_ - left_start_idx_;
+
+    // Compare the stretches of valid lists with their offsets rebased, then
+    // their child values as a single range
+    auto compare_range = [&](int64_t i, int64_t n) {
+      const offset_type* left_offsets = left.raw_value_offsets() + i;
+      const offset_type* right_offsets = right.raw_value_offsets() + i + shift;
+      return RebasedOffsetsEqual(left_offsets, right_offsets, n) &&
+             left_values->RangeEquals(left_offsets[0], left_offsets[n], right_offsets[0],
+                                      right_values);
+    };
+    return NullsEqual(left, left_start_idx_, right, right_start_idx_, length()) &&
+           CompareValidSlots(left, left_start_idx_, length(), compare_range,
+                             [&](int64_t i) { return compare_range(i, 1); });
   }
 
-  bool CompareLists(const ListArray& left) {
-    const auto& right = static_cast<const ListArray&>(right_);
+  bool CompareRunLengthEncoded(const RunLengthEncodedArray& left) {
+    const auto& right = static_cast<const RunLengthEncodedArray&>(right_);
 
     const std::shared_ptr<Array>& left_values = left.values();
     const std::shared_ptr<Array>& right_values = right.values();
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
-        return false;
-      }
-      if (!left_values->RangeEquals(begin_offset, end_offset, right_begin_offset,
-                                    right_values)) {
+    // Compare the values of the runs overlapping each other, the runs need not
+    // be split at the same positions
+    int64_t i = left_start_idx_, o_i = right_start_idx_;
+    while (i < left_end_idx_) {
+      const int64_t run = left.FindRun(i);
+      const int64_t right_run = right.FindRun(o_i);
+      if (!left_values->RangeEquals(run, run + 1, right_run, right_values)) {
         return false;
       }
+      const int64_t length =
+          std::min(std::min(left.raw_run_ends()[run] - left.offset() - i,
+                            right.raw_run_ends()[right_run] - right.offset() - o_i),
+                   left_end_idx_ - i);
+      i += length;
+      o_i += length;
     }
     return true;
   }
 
   bool CompareStructs(const StructArray& left) {
     const auto& right = static_cast<const StructArray&>(right_);
-    bool equal_fields = true;
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      if (left.IsNull(i) != right.IsNull(o_i)) {
-        return false;
-      }
-      if (left.IsNull(i)) continue;
+    const int64_t shift = right_start_idx_ - left_start_idx_;
+
+    // Compare the fields over whole stretches of valid structs
+    auto compare_range = [&](int64_t i, int64_t n) {
       for (int j = 0; j < left.num_fields(); ++j) {
-        // TODO: really we should be comparing stretches of non-null data rather
-        // than looking at one value at a time.
-        equal_fields = left.field(j)->RangeEquals(i, i + 1, o_i, right.field(j));
-        if (!equal_fields) {
+        if (!left.field(j)->RangeEquals(i, i + n, i + shift, right.field(j))) {
           return false;
         }
       }
-    }
-    return true;
+      return true;
+    };
+    return NullsEqual(left, left_start_idx_, right, right_start_idx_, length()) &&
+           CompareValidSlots(left, left_start_idx_, length(), compare_range,
+                             [&](int64_t i) { return compare_range(i, 1); });
   }
 
   bool CompareUnions(const UnionArray& left) const {
@@ -217,6 +349,33 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeBinaryArray& left) {
+    result_ = CompareBinaryRange(left);
+    return Status::OK();
+  }
+
+  Status Visit(const StringViewArray& left) {
+    const auto& right = static_cast<const StringViewArray&>(right_);
+    const int64_t shift = right_start_idx_ - left_start_idx_;
+    auto compare_slot = [&](int64_t i) {
+      return internal::StringViewEquals(left.GetView(i), left.raw_data_buffers(),
+                                        right.GetView(i + shift),
+                                        right.raw_data_buffers());
+    };
+    auto compare_range = [&](int64_t i, int64_t n) {
+      for (int64_t k = i; k < i + n; ++k) {
+        if (!compare_slot(k)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    result_ = NullsEqual(left, left_start_idx_, right, right_start_idx_, length()) &&
+              CompareValidSlots(left, left_start_idx_, length(), compare_range,
+                                compare_slot);
+    return Status::OK();
+  }
+
   Status Visit(const FixedSizeBinaryArray& left) {
     const auto& right = static_cast<const FixedSizeBinaryArray&>(right_);
 
@@ -233,21 +392,15 @@ class RangeEqualsVisitor {
       right_data = right.raw_values();
     }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    const int64_t shift = right_start_idx_ - left_start_idx_;
+    auto compare_range = [&](int64_t i, int64_t n) {
+      return std::memcmp(left_data + width * i, right_data + width * (i + shift),
+                         static_cast<size_t>(width * n)) == 0;
+    };
+    result_ =
+        NullsEqual(left, left_start_idx_, right, right_start_idx_, length()) &&
+        CompareValidSlots(left, left_start_idx_, length(), compare_range,
+                          [&](int64_t i) { return compare_range(i, 1); });
     return Status::OK();
   }
 
@@ -272,6 +425,16 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const LargeListArray& left) {
+    result_ = CompareLists(left);
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& left) {
+    result_ = CompareRunLengthEncoded(left);
+    return Status::OK();
+  }
+
   Status Visit(const StructArray& left) {
     result_ = CompareStructs(left);
     return Status::OK();
@@ -296,6 +459,8 @@ class RangeEqualsVisitor {
   bool result() const { return result_; }
 
  protected:
+  int64_t length() const { return left_end_idx_ - left_start_idx_; }
+
   const Array& right_;
   int64_t left_start_idx_;
   int64_t left_end_idx_;
@@ -320,16 +485,13 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
   }
 
   if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (!left_null && (memcmp(left_data, right_data, byte_width) != 0 || right_null)) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
-    }
-    return true;
+    // The validity bitmaps are equal, compare the stretches of valid values
+    auto compare_range = [&](int64_t i, int64_t n) {
+      return memcmp(left_data + byte_width * i, right_data + byte_width * i,
+                    static_cast<size_t>(byte_width * n)) == 0;
+    };
+    return CompareValidSlots(left, 0, left.length(), compare_range,
+                             [&](int64_t i) { return compare_range(i, 1); });
   } else {
     auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
@@ -351,17 +513,11 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     const auto& right = static_cast<const BooleanArray&>(right_);
 
     if (left.null_count() > 0) {
-      const uint8_t* left_data = left.values()->data();
-      const uint8_t* right_data = right.values()->data();
-
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
-                                   BitUtil::GetBit(right_data, i + right.offset())) {
-          result_ = false;
-          return Status::OK();
-        }
-      }
-      result_ = true;
+      auto compare_range = [&](int64_t i, int64_t n) {
+        return PrimitiveRangeEquals(left, right, i, i, n);
+      };
+      auto compare_slot = [&](int64_t i) { return left.Value(i) == right.Value(i); };
+      result_ = CompareValidSlots(left, 0, left.length(), compare_range, compare_slot);
     } else {
       result_ = BitmapEquals(left.values()->data(), left.offset(), right.values()->data(),
                              right.offset(), left.length());
@@ -383,30 +539,23 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     const auto& right = static_cast<const ArrayType&>(right_);
 
     if (left.offset() == 0 && right.offset() == 0) {
+      using offset_type = typename ArrayType::TypeClass::offset_type;
       return left.value_offsets()->Equals(*right.value_offsets(),
-                                          (left.length() + 1) * sizeof(int32_t));
+                                          (left.length() + 1) * sizeof(offset_type));
     } else {
       // One of the arrays is sliced; logic is more complicated because the
       // value offsets are not both 0-based
-      auto left_offsets =
-          reinterpret_cast<const int32_t*>(left.value_offsets()->data()) + left.offset();
-      auto right_offsets =
-          reinterpret_cast<const int32_t*>(right.value_offsets()->data()) +
-          right.offset();
-
-      for (int64_t i = 0; i < left.length() + 1; ++i) {
-        if (left_offsets[i] - left_offsets[0] != right_offsets[i] - right_offsets[0]) {
-          return false;
-        }
-      }
-      return true;
+      return RebasedOffsetsEqual(left.raw_value_offsets(), right.raw_value_offsets(),
+                                 left.length());
     }
   }
 
-  bool CompareBinary(const BinaryArray& left) {
-    const auto& right = static_cast<const BinaryArray&>(right_);
+  template <typename ArrayType>
+  bool CompareBinary(const ArrayType& left) {
+    using offset_type = typename ArrayType::TypeClass::offset_type;
+    const auto& right = static_cast<const ArrayType&>(right_);
 
-    bool equal_offsets = ValueOffsetsEqual<BinaryArray>(left);
+    bool equal_offsets = ValueOffsetsEqual<ArrayType>(left);
     if (!equal_offsets) {
       return false;
     }
@@ -434,19 +583,18 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
                            static_cast<size_t>(total_bytes)) == 0;
       }
     } else {
-      // ARROW-537: Only compare data in non-null slots
-      const int32_t* left_offsets = left.raw_value_offsets();
-      const int32_t* right_offsets = right.raw_value_offsets();
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsNull(i)) {
-          continue;
-        }
-        if (std::memcmp(left_data + left_offsets[i], right_data + right_offsets[i],
-                        left.value_length(i))) {
-          return false;
-        }
-      }
-      return true;
+      // ARROW-537: Only compare data in non-null slots. The offsets are equal
+      // once rebased, so each stretch of valid values is a single memcmp
+      const offset_type* left_offsets = left.raw_value_offsets();
+      const offset_type* right_offsets = right.raw_value_offsets();
+      auto compare_range = [&](int64_t i, int64_t n) {
+        const offset_type num_bytes = left_offsets[i + n] - left_offsets[i];
+        return num_bytes == 0 ||
+               std::memcmp(left_data + left_offsets[i], right_data + right_offsets[i],
+                           static_cast<size_t>(num_bytes)) == 0;
+      };
+      return CompareValidSlots(left, 0, left.length(), compare_range,
+                               [&](int64_t i) { return compare_range(i, 1); });
     }
   }
 
@@ -455,17 +603,29 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     return Status::OK();
   }
 
-  Status Visit(const ListArray& left) {
-    const auto& right = static_cast<const ListArray&>(right_);
-    bool equal_offsets = ValueOffsetsEqual<ListArray>(left);
+  Status Visit(const LargeBinaryArray& left) {
+    result_ = CompareBinary(left);
+    return Status::OK();
+  }
+
+  Status Visit(const StringViewArray& left) { return RangeEqualsVisitor::Visit(left); }
+
+  Status Visit(const ListArray& left) { return CompareListOffsetsAndValues(left); }
+
+  Status Visit(const LargeListArray& left) { return CompareListOffsetsAndValues(left); }
+
+  template <typename ArrayType>
+  Status CompareListOffsetsAndValues(const ArrayType& left) {
+    const auto& right = static_cast<const ArrayType&>(right_);
+    bool equal_offsets = ValueOffsetsEqual<ArrayType>(left);
     if (!equal_offsets) {
       result_ = false;
       return Status::OK();
     }
 
-    result_ = left.values()->RangeEquals(
-        left.value_offset(0), left.value_offset(left.length()) - left.value_offset(0),
-        right.value_offset(0), right.values());
+    result_ = left.values()->RangeEquals(left.value_offset(0),
+                                         left.value_offset(left.length()),
+                                         right.value_offset(0), right.values());
     return Status::OK();
   }
 
@@ -626,8 +786,12 @@ class TypeEqualsVisitor {
 
   Status Visit(const ListType& left) { return VisitChildren(left); }
 
+  Status Visit(const LargeListType& left) { return VisitChildren(left); }
+
   Status Visit(const StructType& left) { return VisitChildren(left); }
 
+  Status Visit(const RunLengthEncodedType& left) { return VisitChildren(left); }
+
   Status Visit(const UnionType& left) {
     const auto& right = static_cast<const UnionType&>(right_);
 
@@ -679,6 +843,23 @@ bool ArrayEquals(const Array& left, const Array& right) {
   return internal::ArrayEqualsImpl<internal::ArrayEqualsVisitor>(left, right);
 }
 
+bool ArrayEquals(const ArrayView& left, const ArrayView& right) {
+  if (left.length() != right.length() || !TypeEquals(left.type(), right.type())) {
+    return false;
+  }
+  if (left.length() == 0 ||
+      (&left.array() == &right.array() && left.offset() == right.offset())) {
+    return true;
+  }
+  internal::RangeEqualsVisitor visitor(right.array(), left.offset(),
+                                       left.offset() + left.length(), right.offset());
+  auto error = VisitArrayInline(left.array(), &visitor);
+  if (!error.ok()) {
+    DCHECK(false) << "Arrays are not comparable: " << error.ToString();
+  }
+  return visitor.result();
+}
+
 bool ArrayApproxEquals(const Array& left, const Array& right) {
   return internal::ArrayEqualsImpl<internal::ApproxEqualsVisitor>(left, right);
 }
@@ -779,4 +960,390 @@ bool TypeEquals(const DataType& left, const DataType& right) {
   return are_equal;
 }
 
+// ----------------------------------------------------------------------
+// Content hashes
+
+namespace internal {
+
+// Each slot is hashed independently of the array, chunk or slice holding it,
+// then mixed with its logical position. The sum of the mixed hashes is
+// independent of how the values are split, so that blocks of values can be
+// hashed in parallel.
+
+static constexpr uint64_t kHashSeed = 0x9e3779b97f4a7c15ULL;
+static constexpr uint64_t kNullHash = 0x5bd1e9955bd1e995ULL;
+static constexpr int64_t kHashBlockSize = 1 << 16;
+
+// The finalizer of MurmurHash3
+static inline uint64_t MixHash(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+static inline uint64_t CombineHashes(uint64_t seed, uint64_t h) {
+  return MixHash(seed ^ (h + kHashSeed + (seed << 6) + (seed >> 2)));
+}
+
+static inline uint64_t BytesHash(const void* data, int64_t length) {
+  return HashUtil::MurmurHash2_64(data, static_cast<int>(length), kHashSeed);
+}
+
+static inline uint64_t StringHash(const std::string& value) {
+  return BytesHash(value.data(), static_cast<int64_t>(value.size()));
+}
+
+static uint64_t FieldHash(const Field& field) {
+  return CombineHashes(StringHash(field.name()), StringHash(field.type()->ToString()));
+}
+
+static Status RowHashes(const Array& array, int64_t start, int64_t length,
+                        uint64_t* out);
+
+// Computes the hashes of the slots [start, start + length) of an array
+class RowHashVisitor {
+ public:
+  RowHashVisitor(int64_t start, int64_t length, uint64_t* out)
+      : start_(start), length_(length), out_(out) {}
+
+  Status Visit(const NullArray&) {
+    std::fill(out_, out_ + length_, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanArray& array) {
+    const uint8_t* values = array.values()->data();
+    for (int64_t i = 0; i < length_; ++i) {
+      out_[i] = MixHash(BitUtil::GetBit(values, array.offset() + start_ + i) ? 2 : 1);
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value &&
+                              !std::is_base_of<BooleanArray, T>::value &&
+                              !std::is_base_of<FixedSizeBinaryArray, T>::value,
+                          Status>::type
+  Visit(const T& array) {
+    using c_type = typename T::value_type;
+    static_assert(sizeof(c_type) <= sizeof(uint64_t), "values wider than 64 bits");
+    const c_type* values = array.raw_values() + start_;
+    for (int64_t i = 0; i < length_; ++i) {
+      uint64_t bits = 0;
+      std::memcpy(&bits, values + i, sizeof(c_type));
+      out_[i] = MixHash(bits);
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryArray& array) {
+    const int32_t width = array.byte_width();
+    const uint8_t* values = array.raw_values() + start_ * width;
+    for (int64_t i = 0; i < length_; ++i) {
+      out_[i] = BytesHash(values + i * width, width);
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Array& array) {
+    return Visit(static_cast<const FixedSizeBinaryArray&>(array));
+  }
+
+  Status Visit(const BinaryArray& array) { return HashBinary(array); }
+
+  Status Visit(const LargeBinaryArray& array) { return HashBinary(array); }
+
+  Status Visit(const StringViewArray& array) {
+    for (int64_t i = 0; i < length_; ++i) {
+      int32_t length;
+      const uint8_t* value = array.GetValue(start_ + i, &length);
+      out_[i] = BytesHash(value, length);
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  template <typename ArrayType>
+  Status HashBinary(const ArrayType& array) {
+    const auto* offsets = array.raw_value_offsets() + start_;
+    const uint8_t* data = array.value_data() ? array.value_data()->data() : nullptr;
+    for (int64_t i = 0; i < length_; ++i) {
+      out_[i] = BytesHash(data + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  Status Visit(const ListArray& array) { return HashList(array); }
+
+  Status Visit(const LargeListArray& array) { return HashList(array); }
+
+  template <typename ArrayType>
+  Status HashList(const ArrayType& array) {
+    // Fold the hashes of the values of each list, in order
+    const auto* offsets = array.raw_value_offsets() + start_;
+    std::vector<uint64_t> value_hashes(offsets[length_] - offsets[0]);
+    RETURN_NOT_OK(RowHashes(*array.values(), offsets[0], offsets[length_] - offsets[0],
+                            value_hashes.data()));
+    const uint64_t* value_hash = value_hashes.data();
+    for (int64_t i = 0; i < length_; ++i) {
+      uint64_t h = MixHash(static_cast<uint64_t>(offsets[i + 1] - offsets[i]));
+      for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+        h = CombineHashes(h, *value_hash++);
+      }
+      out_[i] = h;
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  Status Visit(const StructArray& array) {
+    std::fill(out_, out_ + length_, kHashSeed);
+    std::vector<uint64_t> field_hashes(length_);
+    for (int j = 0; j < array.num_fields(); ++j) {
+      RETURN_NOT_OK(RowHashes(*array.field(j), start_, length_, field_hashes.data()));
+      for (int64_t i = 0; i < length_; ++i) {
+        out_[i] = CombineHashes(out_[i], field_hashes[i]);
+      }
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  Status Visit(const UnionArray& array) {
+    // The value of each slot lies in a different child, hash them one by one
+    const auto& type = static_cast<const UnionType&>(*array.type());
+    const std::vector<uint8_t>& type_codes = type.type_codes();
+    std::vector<int> child_ids(
+        *std::max_element(type_codes.begin(), type_codes.end()) + 1);
+    for (int i = 0; i < static_cast<int>(type_codes.size()); ++i) {
+      child_ids[type_codes[i]] = i;
+    }
+    const uint8_t* type_ids = array.raw_type_ids() + start_;
+    for (int64_t i = 0; i < length_; ++i) {
+      if (array.IsNull(start_ + i)) {
+        continue;
+      }
+      const int64_t position = array.mode() == UnionMode::SPARSE
+                                   ? array.offset() + start_ + i
+                                   : array.raw_value_offsets()[start_ + i];
+      uint64_t value_hash;
+      RETURN_NOT_OK(
+          RowHashes(*array.child(child_ids[type_ids[i]]), position, 1, &value_hash));
+      out_[i] = CombineHashes(MixHash(type_ids[i]), value_hash);
+    }
+    MaskNulls(array);
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryArray& array) {
+    // Hash the dictionary values of the indices
+    const Array& dictionary = *array.dictionary();
+    std::vector<uint64_t> dictionary_hashes(dictionary.length());
+    RETURN_NOT_OK(
+        RowHashes(dictionary, 0, dictionary.length(), dictionary_hashes.data()));
+    const Array& indices = *array.indices();
+    switch (indices.type_id()) {
+      case Type::INT8:
+        GatherHashes<Int8Type>(indices, dictionary_hashes);
+        break;
+      case Type::INT16:
+        GatherHashes<Int16Type>(indices, dictionary_hashes);
+        break;
+      case Type::INT32:
+        GatherHashes<Int32Type>(indices, dictionary_hashes);
+        break;
+      case Type::INT64:
+        GatherHashes<Int64Type>(indices, dictionary_hashes);
+        break;
+      default:
+        return Status::NotImplemented("Dictionary indices of type " +
+                                      indices.type()->ToString());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) {
+    // Hash the value of each run once
+    const int64_t first_run = array.FindRun(start_);
+    const int64_t last_run = array.FindRun(start_ + length_ - 1);
+    std::vector<uint64_t> run_hashes(last_run - first_run + 1);
+    RETURN_NOT_OK(RowHashes(*array.values(), first_run, last_run - first_run + 1,
+                            run_hashes.data()));
+    int64_t i = 0;
+    for (int64_t run = first_run; run <= last_run; ++run) {
+      const int64_t run_end =
+          std::min<int64_t>(array.raw_run_ends()[run] - array.offset() - start_, length_);
+      std::fill(out_ + i, out_ + run_end, run_hashes[run - first_run]);
+      i = run_end;
+    }
+    return Status::OK();
+  }
+
+ private:
+  template <typename IndexType>
+  void GatherHashes(const Array& indices, const std::vector<uint64_t>& hashes) {
+    const auto* values =
+        static_cast<const NumericArray<IndexType>&>(indices).raw_values() + start_;
+    for (int64_t i = 0; i < length_; ++i) {
+      // The index of a null slot need not be valid
+      out_[i] = indices.IsNull(start_ + i) ? kNullHash : hashes[values[i]];
+    }
+  }
+
+  void MaskNulls(const Array& array) {
+    const uint8_t* bitmap = ValidityBitmap(array);
+    if (bitmap == nullptr) {
+      return;
+    }
+    BitBlockCounter counter(bitmap, array.offset() + start_, length_);
+    int64_t position = 0;
+    for (BitBlockCount block = counter.NextBlock(); block.length > 0;
+         block = counter.NextBlock()) {
+      if (!block.AllSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          if (!BitUtil::GetBit(bitmap, array.offset() + start_ + i)) {
+            out_[i] = kNullHash;
+          }
+        }
+      }
+      position += block.length;
+    }
+  }
+
+  int64_t start_;
+  int64_t length_;
+  uint64_t* out_;
+};
+
+static Status RowHashes(const Array& array, int64_t start, int64_t length,
+                        uint64_t* out) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  RowHashVisitor visitor(start, length, out);
+  return VisitArrayInline(array, &visitor);
+}
+
+// A block of a column to hash
+struct HashTask {
+  const Array* array;
+  int64_t start;
+  int64_t length;
+  // The logical position of the block within its column
+  int64_t position;
+  size_t column;
+};
+
+// The sums of the hashes of the values of columns, each given by its chunks,
+// mixed with their positions
+static Status SumColumnHashes(const std::vector<std::vector<const Array*>>& columns,
+                              bool use_threads, std::vector<uint64_t>* out) {
+  std::vector<HashTask> tasks;
+  for (size_t column = 0; column < columns.size(); ++column) {
+    int64_t position = 0;
+    for (const Array* chunk : columns[column]) {
+      for (int64_t start = 0; start < chunk->length(); start += kHashBlockSize) {
+        const int64_t length = std::min(kHashBlockSize, chunk->length() - start);
+        tasks.push_back({chunk, start, length, position + start, column});
+      }
+      position += chunk->length();
+    }
+  }
+
+  std::vector<uint64_t> task_sums(tasks.size());
+  auto hash_block = [&tasks, &task_sums](int i) {
+    const HashTask& task = tasks[i];
+    std::vector<uint64_t> hashes(task.length);
+    RETURN_NOT_OK(RowHashes(*task.array, task.start, task.length, hashes.data()));
+    uint64_t sum = 0;
+    for (int64_t j = 0; j < task.length; ++j) {
+      sum += MixHash(hashes[j] ^ static_cast<uint64_t>(task.position + j) * kHashSeed);
+    }
+    task_sums[i] = sum;
+    return Status::OK();
+  };
+  const int num_tasks = static_cast<int>(tasks.size());
+  if (use_threads && num_tasks > 1) {
+    RETURN_NOT_OK(ParallelFor(GetCpuThreadPoolCapacity(), num_tasks, hash_block));
+  } else {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(hash_block(i));
+    }
+  }
+
+  out->assign(columns.size(), 0);
+  for (size_t i = 0; i < tasks.size(); ++i) {
+    (*out)[tasks[i].column] += task_sums[i];
+  }
+  return Status::OK();
+}
+
+static uint64_t ColumnHash(const DataType& type, int64_t length, uint64_t sum) {
+  return CombineHashes(CombineHashes(StringHash(type.ToString()), length), sum);
+}
+
+template <typename ColumnFunction>
+static Status SchemaHash(const Schema& schema, int64_t num_rows,
+                         ColumnFunction&& column_chunks, bool use_threads,
+                         uint64_t* out) {
+  std::vector<std::vector<const Array*>> columns(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    columns[i] = column_chunks(i);
+  }
+  std::vector<uint64_t> sums;
+  RETURN_NOT_OK(SumColumnHashes(columns, use_threads, &sums));
+  uint64_t h = MixHash(static_cast<uint64_t>(num_rows));
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    h = CombineHashes(h, CombineHashes(FieldHash(*schema.field(i)), sums[i]));
+  }
+  *out = h;
+  return Status::OK();
+}
+
+}  // namespace internal
+
+Status ArrayHash(const Array& array, uint64_t* out, bool use_threads) {
+  std::vector<uint64_t> sums;
+  RETURN_NOT_OK(internal::SumColumnHashes({{&array}}, use_threads, &sums));
+  *out = internal::ColumnHash(*array.type(), array.length(), sums[0]);
+  return Status::OK();
+}
+
+static std::vector<const Array*> ChunkPointers(const ArrayVector& chunks) {
+  std::vector<const Array*> pointers;
+  for (const auto& chunk : chunks) {
+    pointers.push_back(chunk.get());
+  }
+  return pointers;
+}
+
+Status ChunkedArrayHash(const ChunkedArray& array, uint64_t* out, bool use_threads) {
+  std::vector<uint64_t> sums;
+  RETURN_NOT_OK(
+      internal::SumColumnHashes({ChunkPointers(array.chunks())}, use_threads, &sums));
+  *out = internal::ColumnHash(*array.type(), array.length(), sums[0]);
+  return Status::OK();
+}
+
+Status RecordBatchHash(const RecordBatch& batch, uint64_t* out, bool use_threads) {
+  return internal::SchemaHash(
+      *batch.schema(), batch.num_rows(),
+      [&batch](int i) { return std::vector<const Array*>{batch.column(i).get()}; },
+      use_threads, out);
+}
+
+Status TableHash(const Table& table, uint64_t* out, bool use_threads) {
+  return internal::SchemaHash(
+      *table.schema(), table.num_rows(),
+      [&table](int i) { return ChunkPointers(table.column(i)->data()->chunks()); },
+      use_threads, out);
+}
+
 }  // namespace arrow
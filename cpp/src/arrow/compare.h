@@ -27,13 +27,20 @@
 namespace arrow {
 
 class Array;
+class ArrayView;
+class ChunkedArray;
 class DataType;
+class RecordBatch;
 class Status;
+class Table;
 class Tensor;
 
 /// Returns true if the arrays are exactly equal
 bool ARROW_EXPORT ArrayEquals(const Array& left, const Array& right);
 
+/// Returns true if the viewed ranges are exactly equal, without slicing
+bool ARROW_EXPORT ArrayEquals(const ArrayView& left, const ArrayView& right);
+
 bool ARROW_EXPORT TensorEquals(const Tensor& left, const Tensor& right);
 
 /// Returns true if the arrays are approximately equal. For non-floating point
@@ -48,6 +55,46 @@ bool ARROW_EXPORT ArrayRangeEquals(const Array& left, const Array& right,
 /// Returns true if the type metadata are exactly equal
 bool ARROW_EXPORT TypeEquals(const DataType& left, const DataType& right);
 
+/// \brief Compute a hash of the type and the values of an array
+///
+/// The hash only depends on the logical contents: arrays that are equal
+/// according to ArrayEquals hash the same whatever their offsets and the data
+/// under their null slots, and so do chunked arrays of the same values split
+/// in different chunks. It is stable across processes on hosts of the same
+/// endianness, and can serve as a cache key. Different hashes imply different
+/// contents, equal hashes do not imply equal contents.
+///
+/// The values are hashed in blocks, in parallel on the CPU thread pool when
+/// use_threads is true. Union values are hashed slot by slot.
+///
+/// \param[in] array the array to hash
+/// \param[out] out the hash of the array
+/// \param[in] use_threads whether to hash the blocks in parallel
+Status ARROW_EXPORT ArrayHash(const Array& array, uint64_t* out,
+                              bool use_threads = true);
+
+/// \brief Compute a hash of the type and the values of a chunked array,
+/// equal to the hash of an array of the same values
+///
+/// \see ArrayHash
+Status ARROW_EXPORT ChunkedArrayHash(const ChunkedArray& array, uint64_t* out,
+                                     bool use_threads = true);
+
+/// \brief Compute a hash of the schema field names and types and of the
+/// column values of a record batch, equal to the hash of a table of the same
+/// contents
+///
+/// \see ArrayHash
+Status ARROW_EXPORT RecordBatchHash(const RecordBatch& batch, uint64_t* out,
+                                    bool use_threads = true);
+
+/// \brief Compute a hash of the schema field names and types and of the
+/// column values of a table, independent of the chunking of the columns
+///
+/// \see ArrayHash
+Status ARROW_EXPORT TableHash(const Table& table, uint64_t* out,
+                              bool use_threads = true);
+
 }  // namespace arrow
 
 #endif  // ARROW_COMPARE_H
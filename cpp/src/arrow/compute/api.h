@@ -19,9 +19,26 @@
 #define ARROW_COMPUTE_API_H
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/exec-plan.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/profiler.h"
 
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/bloom-filter.h"
 #include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/count-distinct.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/fused.h"
+#include "arrow/compute/kernels/group-by.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/quantile.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/temporal.h"
+#include "arrow/compute/kernels/window.h"
 
 #endif  // ARROW_COMPUTE_API_H
@@ -17,14 +17,25 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
+#include "arrow/table.h"
 #include "arrow/test-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/hash.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/fused.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/sort.h"
 
 namespace arrow {
 namespace compute {
@@ -196,6 +207,549 @@ static void BM_UniqueString100bytes(benchmark::State& state) {
   BenchUnique(state, HashParams<StringType>{0.05, 100}, state.range(0), state.range(1));
 }
 
+static void BM_DictEncodeString10bytes(benchmark::State& state) {
+  BenchDictionaryEncode(state, HashParams<StringType>{0.05, 10}, state.range(0),
+                        state.range(1));
+}
+
+template <typename ParamType>
+void BenchSum(benchmark::State& state, const ParamType& params, int64_t length) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(length, 1 << 10, &arr);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, Datum(arr), &out));
+  }
+  state.SetBytesProcessed(state.iterations() * params.GetBytesProcessed(length));
+}
+
+static void BM_SumInt64NoNulls(benchmark::State& state) {  // NOLINT non-const reference
+  BenchSum(state, HashParams<Int64Type>{0}, state.range(0));
+}
+
+static void BM_SumInt64WithNulls(benchmark::State& state) {  // NOLINT non-const reference
+  BenchSum(state, HashParams<Int64Type>{0.05}, state.range(0));
+}
+
+// Casting int32 to double then comparing to a scalar, step by step or fused
+// over blocks of rows
+
+static void MakeCastCompareKernels(std::vector<std::unique_ptr<UnaryKernel>>* kernels) {
+  kernels->resize(2);
+  ABORT_NOT_OK(GetCastFunction(*int32(), float64(), CastOptions(), &(*kernels)[0]));
+  auto threshold = std::make_shared<PrimitiveScalar<DoubleType>>(1000.0);
+  ABORT_NOT_OK(GetCompareToScalarKernel(
+      threshold, CompareOptions(CompareOperator::GREATER), &(*kernels)[1]));
+}
+
+static void BenchCastCompare(benchmark::State& state, bool fused) {
+  const int64_t length = state.range(0);
+  std::vector<int32_t> values;
+  test::randint<int32_t>(length, 0, 2000, &values);
+  std::shared_ptr<Array> arr;
+  ArrayFromVector<Int32Type, int32_t>(values, &arr);
+
+  std::vector<std::unique_ptr<UnaryKernel>> kernels;
+  MakeCastCompareKernels(&kernels);
+  std::unique_ptr<UnaryKernel> fused_kernel;
+  if (fused) {
+    ABORT_NOT_OK(GetFusedKernel(std::move(kernels), FusionOptions(), &fused_kernel));
+  }
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    if (fused) {
+      ABORT_NOT_OK(fused_kernel->Call(&ctx, Datum(arr), &out));
+    } else {
+      Datum casted;
+      ABORT_NOT_OK(kernels[0]->Call(&ctx, Datum(arr), &casted));
+      ABORT_NOT_OK(kernels[1]->Call(&ctx, casted, &out));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int32_t));
+}
+
+static void BM_CastCompareSteps(benchmark::State& state) {  // NOLINT non-const reference
+  BenchCastCompare(state, false);
+}
+
+static void BM_CastCompareFused(benchmark::State& state) {  // NOLINT non-const reference
+  BenchCastCompare(state, true);
+}
+
+// ----------------------------------------------------------------------
+// Arithmetic
+
+// Arguments: null percent, whether overflow is checked
+static void BenchArithmeticInt64(benchmark::State& state,  // NOLINT non-const reference
+                                 ArithmeticOperator op, bool scalar_right) {
+  const int64_t length = 1 << 20;
+  std::shared_ptr<Array> left, right;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(length, 1 << 16, &left);
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(length, 1 << 16,
+                                                                 &right);
+  const Datum right_datum = scalar_right
+                                ? Datum(std::make_shared<PrimitiveScalar<Int64Type>>(7))
+                                : Datum(right);
+  const ArithmeticOptions options(op, state.range(1) != 0);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Arithmetic(&ctx, Datum(left), right_datum, options, &out));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+  state.SetBytesProcessed(state.iterations() * length * sizeof(int64_t));
+}
+
+static void ArithmeticArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t null_percent : {0, 10}) {
+    for (int64_t checked : {0, 1}) {
+      bench->Args({null_percent, checked});
+    }
+  }
+}
+
+static void BM_AddInt64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchArithmeticInt64(state, ArithmeticOperator::ADD, false);
+}
+
+static void BM_AddInt64Scalar(benchmark::State& state) {  // NOLINT non-const reference
+  BenchArithmeticInt64(state, ArithmeticOperator::ADD, true);
+}
+
+static void BM_MultiplyInt64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchArithmeticInt64(state, ArithmeticOperator::MULTIPLY, false);
+}
+
+static void BM_DivideInt64Scalar(benchmark::State& state) {  // NOLINT non-const reference
+  BenchArithmeticInt64(state, ArithmeticOperator::DIVIDE, true);
+}
+
+// ----------------------------------------------------------------------
+// Sweeps over null density, chunk count, cardinality and string lengths
+//
+// Arguments are passed as integers: null densities in percent, string
+// lengths as a [min, max] range from which each unique string draws its
+// length.
+
+constexpr int64_t kSweepLength = 1 << 22;
+
+// Split an array into chunks of about equal length
+static Datum MakeChunks(const std::shared_ptr<Array>& arr, int64_t num_chunks) {
+  if (num_chunks <= 1) {
+    return Datum(arr);
+  }
+  ArrayVector chunks;
+  const int64_t chunk_length = (arr->length() + num_chunks - 1) / num_chunks;
+  for (int64_t offset = 0; offset < arr->length(); offset += chunk_length) {
+    chunks.push_back(arr->Slice(offset, chunk_length));
+  }
+  return Datum(std::make_shared<ChunkedArray>(chunks));
+}
+
+static void MakeSweepStrings(int64_t length, int64_t num_unique, double null_percent,
+                             int32_t min_length, int32_t max_length,
+                             std::shared_ptr<Array>* arr, int64_t* total_bytes) {
+  std::vector<int32_t> unique_lengths;
+  test::randint<int32_t>(num_unique, min_length, max_length, &unique_lengths);
+  std::vector<int64_t> unique_offsets(num_unique + 1, 0);
+  for (int64_t i = 0; i < num_unique; ++i) {
+    unique_offsets[i + 1] = unique_offsets[i] + unique_lengths[i];
+  }
+  std::vector<uint8_t> unique_bytes(unique_offsets[num_unique]);
+  test::random_ascii(unique_offsets[num_unique], 0, unique_bytes.data());
+
+  std::vector<int64_t> draws;
+  test::randint<int64_t>(length, 0, num_unique - 1, &draws);
+  std::vector<bool> is_valid;
+  test::random_is_valid(length, null_percent, &is_valid);
+
+  *total_bytes = 0;
+  StringBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid[i]) {
+      const int32_t value_length = unique_lengths[draws[i]];
+      ABORT_NOT_OK(builder.Append(unique_bytes.data() + unique_offsets[draws[i]],
+                                  value_length));
+      *total_bytes += value_length;
+    } else {
+      ABORT_NOT_OK(builder.AppendNull());
+    }
+  }
+  ABORT_NOT_OK(builder.Finish(arr));
+}
+
+static void SetThroughput(benchmark::State& state, int64_t length,  // NOLINT
+                          int64_t bytes) {
+  state.SetItemsProcessed(state.iterations() * length);
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// Arguments: null percent, number of chunks
+static void BM_CastInt32ToInt64Sweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int32Type>{state.range(0) / 100.0}.GenerateTestData(kSweepLength, 1 << 20,
+                                                                 &arr);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input, int64(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int32_t));
+}
+
+// Arguments: null percent, number of chunks
+static void BM_CastInt64ToDoubleSweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(kSweepLength, 1 << 20,
+                                                                 &arr);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input, float64(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int64_t));
+}
+
+// Arguments: null percent, number of chunks
+static void BM_CastInt64ToStringSweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(kSweepLength, 1 << 20,
+                                                                 &arr);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input, utf8(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int64_t));
+}
+
+// Arguments: null percent, number of chunks
+static void BM_CastStringToInt64Sweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(kSweepLength, 1 << 20,
+                                                                 &arr);
+  FunctionContext ctx;
+  Datum input;
+  ABORT_NOT_OK(
+      Cast(&ctx, MakeChunks(arr, state.range(1)), utf8(), CastOptions(), &input));
+
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input, int64(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int64_t));
+}
+
+// Arguments: null percent, number of chunks
+static void BM_CastStringToDoubleSweep(benchmark::State& state) {  // NOLINT
+  std::vector<double> values;
+  std::vector<bool> is_valid;
+  test::random_real<double>(kSweepLength, 0, -1e6, 1e6, &values);
+  test::random_is_valid(kSweepLength, state.range(0) / 100.0, &is_valid);
+  std::shared_ptr<Array> arr;
+  ArrayFromVector<DoubleType, double>(is_valid, values, &arr);
+  FunctionContext ctx;
+  Datum input;
+  ABORT_NOT_OK(
+      Cast(&ctx, MakeChunks(arr, state.range(1)), utf8(), CastOptions(), &input));
+
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input, float64(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(double));
+}
+
+// Arguments: null percent, number of chunks, cardinality, min and max length.
+// Decodes dictionary-encoded strings back into dense strings
+static void BM_CastDictionaryToStringSweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  int64_t total_bytes;
+  MakeSweepStrings(kSweepLength, state.range(2), state.range(0) / 100.0,
+                   static_cast<int32_t>(state.range(3)),
+                   static_cast<int32_t>(state.range(4)), &arr, &total_bytes);
+  Datum encoded;
+  FunctionContext ctx;
+  ABORT_NOT_OK(DictionaryEncode(&ctx, MakeChunks(arr, state.range(1)), &encoded));
+
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, encoded, utf8(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, total_bytes);
+}
+
+// Arguments: null percent, number of chunks.
+// Decodes dictionary-encoded integers back into dense integers
+static void BM_CastDictionaryToInt64Sweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(kSweepLength, 1 << 10,
+                                                                 &arr);
+  Datum encoded;
+  FunctionContext ctx;
+  ABORT_NOT_OK(DictionaryEncode(&ctx, MakeChunks(arr, state.range(1)), &encoded));
+
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, encoded, int64(), CastOptions(), &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int64_t));
+}
+
+// Arguments: null percent, number of chunks, cardinality
+static void BM_UniqueInt64Sweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(
+      kSweepLength, state.range(2), &arr);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Unique(&ctx, input, &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int64_t));
+}
+
+// Arguments: null percent, number of chunks, cardinality
+static void BM_DictEncodeInt64Sweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  HashParams<Int64Type>{state.range(0) / 100.0}.GenerateTestData(
+      kSweepLength, state.range(2), &arr);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(DictionaryEncode(&ctx, input, &out));
+  }
+  SetThroughput(state, kSweepLength, kSweepLength * sizeof(int64_t));
+}
+
+// Arguments: null percent, number of chunks, cardinality, min and max length
+static void BM_UniqueStringSweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  int64_t total_bytes;
+  MakeSweepStrings(kSweepLength, state.range(2), state.range(0) / 100.0,
+                   static_cast<int32_t>(state.range(3)),
+                   static_cast<int32_t>(state.range(4)), &arr, &total_bytes);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Unique(&ctx, input, &out));
+  }
+  SetThroughput(state, kSweepLength, total_bytes);
+}
+
+// Arguments: null percent, number of chunks, cardinality, min and max length
+static void BM_DictEncodeStringSweep(benchmark::State& state) {  // NOLINT
+  std::shared_ptr<Array> arr;
+  int64_t total_bytes;
+  MakeSweepStrings(kSweepLength, state.range(2), state.range(0) / 100.0,
+                   static_cast<int32_t>(state.range(3)),
+                   static_cast<int32_t>(state.range(4)), &arr, &total_bytes);
+  const Datum input = MakeChunks(arr, state.range(1));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(DictionaryEncode(&ctx, input, &out));
+  }
+  SetThroughput(state, kSweepLength, total_bytes);
+}
+
+static const std::vector<int64_t> kSweepNullPercents = {0, 1, 50};
+static const std::vector<int64_t> kSweepChunkCounts = {1, 16, 256};
+static const std::vector<int64_t> kSweepCardinalities = {100, 1 << 16, 1 << 20};
+static const std::vector<std::pair<int64_t, int64_t>> kSweepStringLengths = {
+    {8, 8}, {1, 32}, {32, 128}};
+
+static void NullAndChunkArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t null_percent : kSweepNullPercents) {
+    for (int64_t num_chunks : kSweepChunkCounts) {
+      bench->Args({null_percent, num_chunks});
+    }
+  }
+}
+
+// Chunk counts are only swept at the middle cardinality
+static void HashArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t null_percent : kSweepNullPercents) {
+    for (int64_t cardinality : kSweepCardinalities) {
+      bench->Args({null_percent, 1, cardinality});
+    }
+    for (int64_t num_chunks : kSweepChunkCounts) {
+      if (num_chunks != 1) {
+        bench->Args({null_percent, num_chunks, kSweepCardinalities[1]});
+      }
+    }
+  }
+}
+
+// Null densities and chunk counts are only swept at the middle cardinality
+// and string lengths
+static void StringHashArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t cardinality : kSweepCardinalities) {
+    for (const auto& lengths : kSweepStringLengths) {
+      bench->Args({0, 1, cardinality, lengths.first, lengths.second});
+    }
+  }
+  const auto& lengths = kSweepStringLengths[1];
+  for (int64_t null_percent : kSweepNullPercents) {
+    for (int64_t num_chunks : kSweepChunkCounts) {
+      if (null_percent != 0 || num_chunks != 1) {
+        bench->Args({null_percent, num_chunks, kSweepCardinalities[1], lengths.first,
+                     lengths.second});
+      }
+    }
+  }
+}
+
+// Sorting random values to indices
+
+template <typename ArrowType>
+static void BenchSortNumeric(benchmark::State& state) {  // NOLINT non-const reference
+  using T = typename ArrowType::c_type;
+  const int64_t length = state.range(0);
+  std::vector<T> values;
+  test::random_real<double>(length, 0, -1e9, 1e9, &values);
+  std::vector<bool> is_valid;
+  test::random_is_valid(length, 0.01, &is_valid);
+  std::shared_ptr<Array> arr;
+  ArrayFromVector<ArrowType, T>(is_valid, values, &arr);
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(SortToIndices(&ctx, Datum(arr), SortOptions(), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void BM_SortInt64(benchmark::State& state) {  // NOLINT non-const reference
+  BenchSortNumeric<Int64Type>(state);
+}
+
+static void BM_SortDouble(benchmark::State& state) {  // NOLINT non-const reference
+  BenchSortNumeric<DoubleType>(state);
+}
+
+static void BM_SortString(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  // Strings of 4 to 20 random letters
+  std::vector<int32_t> lengths;
+  test::randint<int32_t>(length, 4, 20, &lengths);
+  std::vector<uint8_t> bytes(length * 20);
+  test::random_ascii(static_cast<int64_t>(bytes.size()), 0, bytes.data());
+
+  StringBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    ABORT_NOT_OK(builder.Append(bytes.data() + i * 20, lengths[i]));
+  }
+  std::shared_ptr<Array> arr;
+  ABORT_NOT_OK(builder.Finish(&arr));
+
+  FunctionContext ctx;
+  while (state.KeepRunning()) {
+    Datum out;
+    ABORT_NOT_OK(SortToIndices(&ctx, Datum(arr), SortOptions(), &out));
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+// Hashing alone, comparing the per-value hashing the hash kernels used to do
+// with the block-at-a-time hashing they use now
+
+constexpr int64_t kHashBlockLength = 256;
+
+static void BM_HashInt64Scalar(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<int64_t> values;
+  test::randint<int64_t>(state.range(0), 0, 1 << 30, &values);
+  std::vector<uint32_t> hashes(values.size());
+
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      hashes[i] = HashUtil::Hash(&values[i], sizeof(int64_t), 0);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+}
+
+static void BM_HashInt64Batched(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<int64_t> values;
+  test::randint<int64_t>(state.range(0), 0, 1 << 30, &values);
+  std::vector<uint32_t> hashes(values.size());
+  const int64_t length = static_cast<int64_t>(values.size());
+
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < length; i += kHashBlockLength) {
+      internal::HashFixedWidthValues(reinterpret_cast<const uint8_t*>(values.data() + i),
+                                     sizeof(int64_t),
+                                     std::min(kHashBlockLength, length - i),
+                                     hashes.data() + i);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+}
+
+static void MakeStringsForHashing(int64_t length, int32_t byte_width,
+                                  std::shared_ptr<BinaryArray>* out) {
+  std::shared_ptr<Array> arr;
+  HashParams<StringType>{0, byte_width}.GenerateTestData(length, length, &arr);
+  *out = std::static_pointer_cast<BinaryArray>(arr);
+}
+
+static void BM_HashString10bytesScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::shared_ptr<BinaryArray> arr;
+  MakeStringsForHashing(state.range(0), 10, &arr);
+  std::vector<uint32_t> hashes(arr->length());
+
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < arr->length(); ++i) {
+      int32_t length;
+      const uint8_t* value = arr->GetValue(i, &length);
+      hashes[i] = HashUtil::Hash(value, length, 0);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * arr->length() * 10);
+}
+
+static void BM_HashString10bytesBatched(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::shared_ptr<BinaryArray> arr;
+  MakeStringsForHashing(state.range(0), 10, &arr);
+  std::vector<uint32_t> hashes(arr->length());
+  const int32_t* offsets = arr->raw_value_offsets();
+  const uint8_t* data = arr->value_data()->data();
+
+  while (state.KeepRunning()) {
+    for (int64_t i = 0; i < arr->length(); i += kHashBlockLength) {
+      internal::HashBinaryValues(offsets + i, data,
+                                 std::min(kHashBlockLength, arr->length() - i),
+                                 hashes.data() + i);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * arr->length() * 10);
+}
+
 BENCHMARK(BM_BuildDictionary)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildStringDictionary)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 
@@ -214,6 +768,86 @@ ADD_HASH_ARGS(BENCHMARK(BM_UniqueInt64NoNulls));
 ADD_HASH_ARGS(BENCHMARK(BM_UniqueInt64WithNulls));
 ADD_HASH_ARGS(BENCHMARK(BM_UniqueString10bytes));
 ADD_HASH_ARGS(BENCHMARK(BM_UniqueString100bytes));
+ADD_HASH_ARGS(BENCHMARK(BM_DictEncodeString10bytes));
+
+BENCHMARK(BM_HashInt64Scalar)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+BENCHMARK(BM_HashInt64Batched)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+BENCHMARK(BM_HashString10bytesScalar)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+BENCHMARK(BM_HashString10bytesBatched)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_SumInt64NoNulls)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+BENCHMARK(BM_SumInt64WithNulls)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_CastCompareSteps)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+BENCHMARK(BM_CastCompareFused)->Arg(1 << 20)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_AddInt64)->Apply(ArithmeticArgs)->UseRealTime();
+BENCHMARK(BM_AddInt64Scalar)->Apply(ArithmeticArgs)->UseRealTime();
+BENCHMARK(BM_MultiplyInt64)->Apply(ArithmeticArgs)->UseRealTime();
+BENCHMARK(BM_DivideInt64Scalar)->Apply(ArithmeticArgs)->UseRealTime();
+
+BENCHMARK(BM_CastInt32ToInt64Sweep)
+    ->Apply(NullAndChunkArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_CastInt64ToDoubleSweep)
+    ->Apply(NullAndChunkArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_CastInt64ToStringSweep)
+    ->Apply(NullAndChunkArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_CastStringToInt64Sweep)
+    ->Apply(NullAndChunkArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_CastStringToDoubleSweep)
+    ->Apply(NullAndChunkArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_CastDictionaryToInt64Sweep)
+    ->Apply(NullAndChunkArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_CastDictionaryToStringSweep)
+    ->Apply(StringHashArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_UniqueInt64Sweep)
+    ->Apply(HashArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_DictEncodeInt64Sweep)
+    ->Apply(HashArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_UniqueStringSweep)
+    ->Apply(StringHashArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_DictEncodeStringSweep)
+    ->Apply(StringHashArgs)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_SortInt64)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Arg(100000000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_SortDouble)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Arg(100000000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_SortString)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
 
 BENCHMARK(BM_UniqueUInt8NoNulls)
     ->Args({kHashBenchmarkLength, 200})
@@ -15,11 +15,21 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <fstream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -31,16 +41,36 @@
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/pretty_print.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bloom-filter.h"
+#include "arrow/util/task-scheduler.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/exec-plan.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/kernels/bloom-filter.h"
 #include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/count-distinct.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/fused.h"
+#include "arrow/compute/kernels/group-by.h"
 #include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/quantile.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/temporal.h"
+#include "arrow/compute/kernels/window.h"
+#include "arrow/compute/profiler.h"
 
 using std::shared_ptr;
 using std::vector;
@@ -68,6 +98,36 @@ shared_ptr<Array> _MakeArray(const shared_ptr<DataType>& type, const vector<T>&
   return result;
 }
 
+// A dense union of integers and strings, with type codes 5 and 10. The child
+// index of each slot is given, or -1 for null slots
+template <typename IntType>
+shared_ptr<Array> _MakeDenseUnion(const shared_ptr<DataType>& int_type,
+                                  const vector<int8_t>& children,
+                                  const vector<typename IntType::c_type>& ints,
+                                  const vector<std::string>& strings) {
+  auto type =
+      union_({field("i", int_type), field("s", utf8())}, {5, 10}, UnionMode::DENSE);
+  std::unique_ptr<ArrayBuilder> tmp;
+  ABORT_NOT_OK(MakeBuilder(default_memory_pool(), type, &tmp));
+  auto builder = static_cast<DenseUnionBuilder*>(tmp.get());
+  vector<uint8_t> valid_bytes;
+  for (int8_t child : children) {
+    valid_bytes.push_back(child >= 0);
+  }
+  ABORT_NOT_OK(builder->Append(children.data(), static_cast<int64_t>(children.size()),
+                               valid_bytes.data()));
+  auto int_builder =
+      static_cast<typename TypeTraits<IntType>::BuilderType*>(builder->child_builder(0));
+  ABORT_NOT_OK(int_builder->Append(ints.data(), static_cast<int64_t>(ints.size())));
+  auto string_builder = static_cast<StringBuilder*>(builder->child_builder(1));
+  for (const std::string& value : strings) {
+    ABORT_NOT_OK(string_builder->Append(value));
+  }
+  shared_ptr<Array> result;
+  ABORT_NOT_OK(builder->Finish(&result));
+  return result;
+}
+
 // ----------------------------------------------------------------------
 // Cast
 
@@ -288,6 +348,60 @@ TEST_F(TestCast, ToIntDowncastUnsafe) {
                                                     options);
 }
 
+TEST_F(TestCast, ToIntDowncastSafeUnsignedToSigned) {
+  CastOptions options;
+  options.allow_int_overflow = false;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+
+  vector<uint32_t> v1 = {0, 100, 200, 1, 2};
+  vector<int16_t> e1 = {0, 100, 200, 1, 2};
+  CheckCase<UInt32Type, uint32_t, Int16Type, int16_t>(uint32(), v1, is_valid, int16(),
+                                                      e1, options);
+
+  vector<uint32_t> v2 = {0, 100, 40000, 1, 2};
+  CheckFails<UInt32Type>(uint32(), v2, is_valid, int16(), options);
+}
+
+TEST_F(TestCast, NumericCastsMultipleBlocks) {
+  // The vectorized conversion loops check and convert values by blocks
+  CastOptions options;
+  options.allow_int_overflow = false;
+
+  const int64_t length = 2000;
+  vector<bool> is_valid(length);
+  vector<int64_t> v_i64(length);
+  vector<int32_t> e_i32(length);
+  vector<double> e_f64(length);
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid[i] = (i % 7) != 3;
+    v_i64[i] = (i % 2 == 0 ? 1 : -1) * i * 1000;
+    e_i32[i] = static_cast<int32_t>(v_i64[i]);
+    e_f64[i] = static_cast<double>(v_i64[i]);
+  }
+  vector<int64_t> v_overflow = v_i64;
+  v_overflow[length - 1] = static_cast<int64_t>(1) << 40;
+  vector<int64_t> v_overflow_in_null = v_i64;
+  v_overflow_in_null[1004] = static_cast<int64_t>(1) << 40;
+  ASSERT_FALSE(is_valid[1004]);
+
+  CheckCase<Int64Type, int64_t, Int32Type, int32_t>(int64(), v_i64, is_valid, int32(),
+                                                    e_i32, options);
+  CheckCase<Int64Type, int64_t, DoubleType, double>(int64(), v_i64, is_valid, float64(),
+                                                    e_f64, options);
+  CheckFails<Int64Type>(int64(), v_overflow, is_valid, int32(), options);
+  CheckFails<Int64Type>(int64(), v_overflow, {}, int32(), options);
+
+  shared_ptr<Array> input, result;
+  ArrayFromVector<Int64Type, int64_t>(int64(), is_valid, v_overflow_in_null, &input);
+  ASSERT_OK(Cast(&ctx_, *input, int32(), options, &result));
+  ASSERT_OK(Cast(&ctx_, *input->Slice(1001), int32(), options, &result));
+
+  // Widening
+  CheckCase<Int32Type, int32_t, Int64Type, int64_t>(int32(), e_i32, is_valid, int64(),
+                                                    v_i64, options);
+}
+
 TEST_F(TestCast, TimestampToTimestamp) {
   CastOptions options;
 
@@ -369,6 +483,28 @@ TEST_F(TestCast, TimestampToTimestamp) {
                             timestamp(TimeUnit::MILLI), options);
   CheckFails<TimestampType>(timestamp(TimeUnit::NANO), v10, is_valid,
                             timestamp(TimeUnit::SECOND), options);
+
+  // Longer inputs, with blocks of all valid, all null and mixed values. Values
+  // losing data are only an error where they are valid
+  vector<bool> long_is_valid(200, true);
+  vector<int64_t> v11(200), e11(200);
+  for (int64_t i = 0; i < 200; ++i) {
+    v11[i] = i * 1000;
+    e11[i] = i;
+  }
+  for (int i = 64; i < 128; ++i) {
+    long_is_valid[i] = false;
+    v11[i] = 123;
+    e11[i] = 0;
+  }
+  long_is_valid[150] = false;
+  v11[150] = 456;
+  e11[150] = 0;
+  CheckTimestampCast(options, TimeUnit::MILLI, TimeUnit::SECOND, v11, e11,
+                     long_is_valid);
+  v11[180] = 789;
+  CheckFails<TimestampType>(timestamp(TimeUnit::MILLI), v11, long_is_valid,
+                            timestamp(TimeUnit::SECOND), options);
 }
 
 TEST_F(TestCast, TimestampToDate32_Date64) {
@@ -593,6 +729,218 @@ TEST_F(TestCast, ToDouble) {
                                                    options);
 }
 
+TEST_F(TestCast, StringToNumber) {
+  CastOptions options;
+  vector<bool> is_valid = {true, false, true, true, true};
+
+  vector<std::string> v1 = {"0", "junk", "+7", "2147483647", "-2147483648"};
+  vector<int32_t> e1 = {0, 0, 7, 2147483647, -2147483647 - 1};
+  CheckCase<StringType, std::string, Int32Type, int32_t>(utf8(), v1, is_valid, int32(),
+                                                         e1, options);
+
+  vector<std::string> v2 = {"255", "0", "18446744073709551615"};
+  vector<uint64_t> e2 = {255, 0, std::numeric_limits<uint64_t>::max()};
+  CheckCase<StringType, std::string, UInt64Type, uint64_t>(utf8(), v2, {}, uint64(), e2,
+                                                           options);
+
+  // Exact and rounded values, denormals and more digits than fit a uint64
+  vector<std::string> v3 = {"1.5",
+                            "junk",
+                            "-0.25",
+                            "1E-2",
+                            "0.1",
+                            "1.7976931348623157e308",
+                            "4.9e-324",
+                            "123456789012345678901",
+                            "-Infinity"};
+  vector<double> e3 = {1.5,
+                       0,
+                       -0.25,
+                       0.01,
+                       0.1,
+                       std::numeric_limits<double>::max(),
+                       std::numeric_limits<double>::denorm_min(),
+                       1.2345678901234568e+20,
+                       -std::numeric_limits<double>::infinity()};
+  CheckCase<StringType, std::string, DoubleType, double>(
+      utf8(), v3, {true, false, true, true, true, true, true, true, true}, float64(), e3,
+      options);
+
+  vector<std::string> v4 = {"3.14159", "0.1", "16777217", "inf"};
+  vector<float> e4 = {3.14159f, 0.1f, 16777216.0f,
+                      std::numeric_limits<float>::infinity()};
+  CheckCase<StringType, std::string, FloatType, float>(utf8(), v4, {}, float32(), e4,
+                                                       options);
+
+  for (const char* value : {"256", "-1", "", "12a", "-", " 1"}) {
+    CheckFails<StringType, std::string>(utf8(), {value}, {}, uint8(), options);
+  }
+  CheckFails<StringType, std::string>(utf8(), {"9223372036854775808"}, {}, int64(),
+                                      options);
+  for (const char* value : {"1.5.2", "e5", "1e", "abc", "", "1e+"}) {
+    CheckFails<StringType, std::string>(utf8(), {value}, {}, float64(), options);
+  }
+}
+
+TEST_F(TestCast, StringToTimestamp) {
+  CastOptions options;
+  vector<bool> is_valid = {true, true, false, true, true};
+
+  vector<std::string> v1 = {"1970-01-01", "2018-03-10T12:34:56", "junk",
+                            "2000-02-29 00:00:01Z", "1969-12-31T23:59:59"};
+  vector<int64_t> e1 = {0, 1520685296, 0, 951782401, -1};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), v1, is_valid, timestamp(TimeUnit::SECOND), e1, options);
+
+  vector<std::string> v2 = {"1900-01-01T00:00", "2018-03-10T12:34:56.789",
+                            "2018-03-10T12:34:56.7"};
+  vector<int64_t> e2 = {-2208988800000LL, 1520685296789LL, 1520685296700LL};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(
+      utf8(), v2, {}, timestamp(TimeUnit::MILLI), e2, options);
+
+  for (const char* value :
+       {"2018-02-29", "2018-13-01", "2018-03-10T25:00", "2018-03-10T12:34:56.1234",
+        "2018-03-10T12:34:56.", "18-03-10", "2018-03-10T12"}) {
+    CheckFails<StringType, std::string>(utf8(), {value}, {}, timestamp(TimeUnit::MILLI),
+                                        options);
+  }
+}
+
+TEST_F(TestCast, NumberToString) {
+  CastOptions options;
+  vector<bool> is_valid = {true, false, true, true, true};
+
+  vector<int32_t> v1 = {0, 12, -12, 2147483647, -2147483647 - 1};
+  vector<std::string> e1 = {"0", "", "-12", "2147483647", "-2147483648"};
+  CheckCase<Int32Type, int32_t, StringType, std::string>(int32(), v1, is_valid, utf8(),
+                                                         e1, options);
+
+  vector<int8_t> v2 = {-128, 127};
+  vector<std::string> e2 = {"-128", "127"};
+  CheckCase<Int8Type, int8_t, StringType, std::string>(int8(), v2, {}, utf8(), e2,
+                                                       options);
+
+  vector<uint64_t> v3 = {std::numeric_limits<uint64_t>::max()};
+  vector<std::string> e3 = {"18446744073709551615"};
+  CheckCase<UInt64Type, uint64_t, StringType, std::string>(uint64(), v3, {}, utf8(), e3,
+                                                           options);
+
+  vector<double> v4 = {0.1, 0, -2.5, 1e300, 1.0 / 3};
+  vector<std::string> e4 = {"0.1", "", "-2.5", "1e+300", "0.3333333333333333"};
+  CheckCase<DoubleType, double, StringType, std::string>(float64(), v4, is_valid, utf8(),
+                                                         e4, options);
+
+  vector<float> v5 = {0.1f, -std::numeric_limits<float>::infinity()};
+  vector<std::string> e5 = {"0.1", "-inf"};
+  CheckCase<FloatType, float, StringType, std::string>(float32(), v5, {}, utf8(), e5,
+                                                       options);
+
+  vector<bool> v6 = {true, false, false, true, true};
+  vector<std::string> e6 = {"true", "", "false", "true", "true"};
+  CheckCase<BooleanType, bool, StringType, std::string>(boolean(), v6, is_valid, utf8(),
+                                                        e6, options);
+
+  shared_ptr<Array> strings, nulls;
+  ASSERT_OK(Cast(&this->ctx_, NullArray(3), utf8(), options, &strings));
+  StringBuilder builder;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(builder.AppendNull());
+  }
+  ASSERT_OK(builder.Finish(&nulls));
+  ASSERT_ARRAYS_EQUAL(*nulls, *strings);
+
+  // Doubles survive a round trip through their string representation
+  auto doubles = std::static_pointer_cast<DoubleArray>(
+      TestBase::MakeRandomArray<DoubleArray>(1000, 100));
+  shared_ptr<Array> round_trip;
+  ASSERT_OK(Cast(&this->ctx_, *doubles, utf8(), options, &strings));
+  ASSERT_OK(Cast(&this->ctx_, *strings, float64(), options, &round_trip));
+  ASSERT_ARRAYS_EQUAL(*doubles, *round_trip);
+}
+
+TEST_F(TestCast, Decimals) {
+  CastOptions options;
+  CastOptions truncate;
+  truncate.allow_decimal_truncate = true;
+  vector<bool> is_valid = {true, false, true, true};
+  const Decimal128 large("-123456789012345678901234");
+
+  // Rescaling, in 64 bits and beyond
+  vector<Decimal128> v1 = {12345, 0, -1, 99999999};
+  vector<Decimal128> e1 = {1234500, 0, -100, 9999999900};
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(10, 2), v1, is_valid, decimal(12, 4), e1, options);
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(12, 4), e1, is_valid, decimal(10, 2), v1, options);
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(30, 0), {large}, {}, decimal(38, 10),
+      {large * Decimal128::GetScaleMultiplier(10)}, options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(10, 4), {12345}, {}, decimal(10, 2),
+                                         options);
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(10, 4), {12345, -12345}, {}, decimal(10, 2), {123, -123}, truncate);
+  CheckFails<Decimal128Type, Decimal128>(decimal(10, 2), {99999999}, {}, decimal(5, 2),
+                                         options);
+
+  // Integers
+  vector<int32_t> v2 = {1, 0, -2, 2147483647};
+  vector<Decimal128> e2 = {100, 0, -200, 214748364700};
+  CheckCase<Int32Type, int32_t, Decimal128Type, Decimal128>(int32(), v2, is_valid,
+                                                            decimal(12, 2), e2, options);
+  CheckFails<Int32Type, int32_t>(int32(), v2, {}, decimal(10, 2), options);
+  CheckCase<UInt64Type, uint64_t, Decimal128Type, Decimal128>(
+      uint64(), {std::numeric_limits<uint64_t>::max()}, {}, decimal(20, 0),
+      {Decimal128(0, std::numeric_limits<uint64_t>::max())}, options);
+
+  vector<Decimal128> v3 = {12300, 0, -500, 0};
+  vector<int64_t> e3 = {123, 0, -5, 0};
+  CheckCase<Decimal128Type, Decimal128, Int64Type, int64_t>(decimal(10, 2), v3, is_valid,
+                                                            int64(), e3, options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(10, 2), {12345}, {}, int64(), options);
+  CheckCase<Decimal128Type, Decimal128, Int64Type, int64_t>(
+      decimal(10, 2), {12345, -12399}, {}, int64(), {123, -123}, truncate);
+  CheckFails<Decimal128Type, Decimal128>(decimal(10, 2), {30000}, {}, int8(), options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(10, 0), {-1}, {}, uint32(), options);
+  CheckFails<Decimal128Type, Decimal128>(decimal(38, 0), {large}, {}, int64(), options);
+  CastOptions overflow;
+  overflow.allow_int_overflow = true;
+  CheckCase<Decimal128Type, Decimal128, Int8Type, int8_t>(decimal(10, 2), {30000}, {},
+                                                          int8(), {44}, overflow);
+
+  // Floating point
+  vector<Decimal128> v4 = {12345, 0, -5, 13};
+  vector<double> e4 = {123.45, 0, -0.05, 0.13};
+  CheckCase<Decimal128Type, Decimal128, DoubleType, double>(decimal(10, 2), v4, is_valid,
+                                                            float64(), e4, options);
+  vector<double> v5 = {123.45, 0, -0.05, 0.125};
+  CheckCase<DoubleType, double, Decimal128Type, Decimal128>(float64(), v5, is_valid,
+                                                            decimal(10, 2), v4, options);
+  CheckCase<FloatType, float, Decimal128Type, Decimal128>(float32(), {0.5f, -2.0f}, {},
+                                                          decimal(5, 1), {5, -20},
+                                                          options);
+  CheckFails<DoubleType, double>(float64(), {1e10}, {}, decimal(10, 2), options);
+  CheckFails<DoubleType, double>(float64(), {std::numeric_limits<double>::infinity()},
+                                 {}, decimal(10, 2), options);
+
+  // Strings
+  vector<std::string> v6 = {"123.45", "junk", "-0.5", "1e2"};
+  vector<Decimal128> e6 = {12345, 0, -50, 10000};
+  CheckCase<StringType, std::string, Decimal128Type, Decimal128>(
+      utf8(), v6, is_valid, decimal(10, 2), e6, options);
+  for (const char* value : {"1.234", "abc", "", "123456789.00", "1.5e"}) {
+    CheckFails<StringType, std::string>(utf8(), {value}, {}, decimal(10, 2), options);
+  }
+  CheckCase<StringType, std::string, Decimal128Type, Decimal128>(
+      utf8(), {"1.239"}, {}, decimal(10, 2), {123}, truncate);
+
+  vector<Decimal128> v7 = {12345, 0, -5, 0};
+  vector<std::string> e7 = {"123.45", "", "-0.05", "0.00"};
+  CheckCase<Decimal128Type, Decimal128, StringType, std::string>(
+      decimal(10, 2), v7, is_valid, utf8(), e7, options);
+  CheckCase<Decimal128Type, Decimal128, StringType, std::string>(
+      decimal(38, 4), {large}, {}, utf8(), {"-12345678901234567890.1234"}, options);
+}
+
 TEST_F(TestCast, ChunkedArray) {
   vector<int16_t> values1 = {0, 1, 2};
   vector<int16_t> values2 = {3, 4, 5};
@@ -625,6 +973,111 @@ TEST_F(TestCast, ChunkedArray) {
   ASSERT_TRUE(out.chunked_array()->Equals(*ex_carr));
 }
 
+TEST_F(TestCast, ChunkedArrayParallel) {
+  const int num_chunks = 16;
+  auto out_type = int64();
+
+  ArrayVector chunks, ex_chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    vector<int32_t> values = {i, i + 1, i + 2};
+    vector<int64_t> ex_values = {i, i + 1, i + 2};
+    chunks.push_back(_MakeArray<Int32Type, int32_t>(int32(), values, {}));
+    ex_chunks.push_back(_MakeArray<Int64Type, int64_t>(out_type, ex_values, {}));
+  }
+  auto carr = std::make_shared<ChunkedArray>(chunks);
+  ChunkedArray ex_carr(ex_chunks);
+
+  this->ctx_.set_num_threads(4);
+
+  Datum out;
+  ASSERT_OK(Cast(&this->ctx_, Datum(carr), out_type, {}, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_carr));
+}
+
+TEST_F(TestCast, ChunkedArrayParallelError) {
+  const int num_chunks = 8;
+
+  ArrayVector chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    vector<int32_t> values = {0, (i == 5) ? 1000 : 1, 2};
+    chunks.push_back(_MakeArray<Int32Type, int32_t>(int32(), values, {}));
+  }
+  auto carr = std::make_shared<ChunkedArray>(chunks);
+
+  this->ctx_.set_num_threads(4);
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, Datum(carr), int8(), {}, &out));
+
+  // The parent context is left without a latched error
+  ASSERT_FALSE(this->ctx_.HasError());
+  ASSERT_OK(Cast(&this->ctx_, Datum(carr), int64(), {}, &out));
+}
+
+TEST_F(TestCast, ChunkedArrayTaskScheduler) {
+  std::shared_ptr<TaskScheduler> scheduler;
+  ASSERT_OK(TaskScheduler::Make(3, &scheduler));
+  this->ctx_.set_task_scheduler(scheduler.get());
+
+  ArrayVector chunks, ex_chunks;
+  for (int i = 0; i < 10; ++i) {
+    vector<bool> is_valid = {true, (i % 2) == 0, true};
+    chunks.push_back(_MakeArray<Int32Type, int32_t>(int32(), {i, i, i}, is_valid));
+    double value = static_cast<double>(i);
+    ex_chunks.push_back(
+        _MakeArray<DoubleType, double>(float64(), {value, value, value}, is_valid));
+  }
+  auto carr = std::make_shared<ChunkedArray>(chunks);
+
+  Datum out;
+  ASSERT_OK(Cast(&this->ctx_, Datum(carr), float64(), {}, &out));
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(ex_chunks)));
+
+  this->ctx_.set_task_scheduler(nullptr);
+}
+
+TEST_F(TestCast, Table) {
+  vector<bool> is_valid = {true, false, true};
+
+  auto a1 = _MakeArray<Int16Type, int16_t>(int16(), {0, 1, 2}, is_valid);
+  auto a2 = _MakeArray<Int16Type, int16_t>(int16(), {3, 4, 5}, {});
+  auto b1 = _MakeArray<FloatType, float>(float32(), {0.5, 1.5, 2.5}, {});
+
+  auto ex_a1 = _MakeArray<Int64Type, int64_t>(int64(), {0, 1, 2}, is_valid);
+  auto ex_a2 = _MakeArray<Int64Type, int64_t>(int64(), {3, 4, 5}, {});
+  auto ex_b1 = _MakeArray<DoubleType, double>(float64(), {0.5, 1.5, 2.5}, {});
+
+  auto schema = ::arrow::schema({field("a", int16()), field("b", float32())});
+  auto to_schema = ::arrow::schema({field("a", int64()), field("b", float64())});
+
+  vector<shared_ptr<Column>> columns = {
+      std::make_shared<Column>(schema->field(0), ArrayVector{a1, a2}),
+      std::make_shared<Column>(schema->field(1), ArrayVector{b1})};
+  auto table = Table::Make(schema, columns);
+
+  vector<shared_ptr<Column>> ex_columns = {
+      std::make_shared<Column>(to_schema->field(0), ArrayVector{ex_a1, ex_a2}),
+      std::make_shared<Column>(to_schema->field(1), ArrayVector{ex_b1})};
+  auto expected = Table::Make(to_schema, ex_columns);
+
+  for (int num_threads : {1, 3}) {
+    this->ctx_.set_num_threads(num_threads);
+    shared_ptr<Table> result;
+    ASSERT_OK(Cast(&this->ctx_, *table, to_schema, {}, &result));
+    ASSERT_TRUE(result->Equals(*expected));
+  }
+
+  // Mismatched number of fields
+  shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, *table, ::arrow::schema({field("a", int64())}),
+                              {}, &result));
+
+  // Tables are not accepted by the type-based Datum overload
+  Datum out;
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, Datum(table), int64(), {}, &out));
+}
+
 TEST_F(TestCast, UnsupportedTarget) {
   vector<bool> is_valid = {true, false, true, true, true};
   vector<int32_t> v1 = {0, 1, 2, 3, 4};
@@ -633,7 +1086,7 @@ TEST_F(TestCast, UnsupportedTarget) {
   ArrayFromVector<Int32Type, int32_t>(int32(), is_valid, v1, &arr);
 
   shared_ptr<Array> result;
-  ASSERT_RAISES(NotImplemented, Cast(&this->ctx_, *arr, utf8(), {}, &result));
+  ASSERT_RAISES(NotImplemented, Cast(&this->ctx_, *arr, binary(), {}, &result));
 }
 
 TEST_F(TestCast, DateTimeZeroCopy) {
@@ -769,6 +1222,88 @@ TEST_F(TestCast, OffsetOutputBuffer) {
                                                                 int16(), e3);
 }
 
+// Forwards to the default pool, counting allocations
+class CountingMemoryPool : public MemoryPool {
+ public:
+  CountingMemoryPool() : num_allocations_(0) {}
+
+  Status Allocate(int64_t size, uint8_t** out) override {
+    ++num_allocations_;
+    return default_memory_pool()->Allocate(size, out);
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    ++num_allocations_;
+    return default_memory_pool()->Reallocate(old_size, new_size, ptr);
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    default_memory_pool()->Free(buffer, size);
+  }
+
+  int64_t bytes_allocated() const override {
+    return default_memory_pool()->bytes_allocated();
+  }
+
+  int64_t num_allocations() const { return num_allocations_; }
+
+ private:
+  int64_t num_allocations_;
+};
+
+TEST_F(TestCast, ReusePreallocatedOutput) {
+  CountingMemoryPool pool;
+  FunctionContext ctx(&pool);
+
+  std::unique_ptr<UnaryKernel> kernel;
+  ASSERT_OK(GetCastFunction(*int32(), float64(), CastOptions(), &kernel));
+  ASSERT_TRUE(kernel->out_type()->Equals(*float64()));
+  std::vector<int64_t> sizes;
+  ASSERT_OK(kernel->GetOutputBufferSizes(5, &sizes));
+  ASSERT_EQ(std::vector<int64_t>({1, 5 * sizeof(double)}), sizes);
+
+  Datum out;
+  ASSERT_OK(AllocateOutput(&ctx, *kernel, 5, &out));
+  const std::vector<std::shared_ptr<Buffer>> buffers = out.array()->buffers;
+  ASSERT_EQ(2, buffers.size());
+
+  auto with_nulls = _MakeArray<Int32Type, int32_t>(int32(), {9, 1, 2, 3, 4, 5},
+                                                   {true, true, false, true, true, true});
+  auto no_nulls = _MakeArray<Int32Type, int32_t>(int32(), {6, 7, 8, 9, 10}, {});
+  auto ex_with_nulls = _MakeArray<DoubleType, double>(float64(), {1, 2, 3, 4, 5},
+                                                      {true, false, true, true, true});
+  auto ex_no_nulls = _MakeArray<DoubleType, double>(float64(), {6, 7, 8, 9, 10}, {});
+
+  // Steady state: the same buffers are written by every call, even for a
+  // sliced input whose bitmap would otherwise be copied
+  const int64_t num_allocations = pool.num_allocations();
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(kernel->Call(&ctx, Datum(with_nulls->Slice(1)), &out));
+    ASSERT_EQ(buffers, out.array()->buffers);
+    ASSERT_ARRAYS_EQUAL(*ex_with_nulls, *MakeArray(out.array()));
+
+    ASSERT_OK(kernel->Call(&ctx, Datum(no_nulls), &out));
+    ASSERT_EQ(buffers, out.array()->buffers);
+    ASSERT_EQ(0, out.array()->null_count);
+    ASSERT_ARRAYS_EQUAL(*ex_no_nulls, *MakeArray(out.array()));
+  }
+  ASSERT_EQ(num_allocations, pool.num_allocations());
+
+  // Too large an input
+  auto longer = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4, 5, 6}, {});
+  Datum small_out(ArrayData::Make(float64(), 6, buffers));
+  ASSERT_RAISES(Invalid, kernel->Call(&ctx, Datum(longer), &small_out));
+
+  // Zero-copy casts need no buffers of their own
+  ASSERT_OK(GetCastFunction(*int64(), timestamp(TimeUnit::SECOND), CastOptions(),
+                            &kernel));
+  ASSERT_OK(kernel->GetOutputBufferSizes(5, &sizes));
+  ASSERT_EQ(0, sizes.size());
+
+  ASSERT_OK(GetCastFunction(*list(int32()), list(float64()), CastOptions(), &kernel));
+  ASSERT_RAISES(NotImplemented, AllocateOutput(&ctx, *kernel, 5, &out));
+}
+
 template <typename TestType>
 class TestDictionaryCast : public TestCast {};
 
@@ -790,6 +1325,101 @@ TYPED_TEST(TestDictionaryCast, Basic) {
   this->CheckPass(*MakeArray(out.array()), *plain_array, plain_array->type(), options);
 }
 
+TEST_F(TestCast, DictionaryValues) {
+  auto dict = _MakeArray<Int32Type, int32_t>(int32(), {10, 20, 30}, {});
+  vector<bool> is_valid = {true, true, false, true, true};
+  auto indices = _MakeArray<Int32Type, int32_t>(int32(), {0, 2, 7, 1, 0}, is_valid);
+  auto dict_array = std::make_shared<DictionaryArray>(dictionary(int32(), dict), indices);
+
+  // Only the dictionary is cast, the indices are reused
+  auto double_dict = _MakeArray<DoubleType, double>(float64(), {10, 20, 30}, {});
+  auto to_type = dictionary(int32(), _MakeArray<DoubleType, double>(float64(), {}, {}));
+  shared_ptr<Array> result;
+  ASSERT_OK(Cast(&this->ctx_, *dict_array, to_type, CastOptions(), &result));
+  ASSERT_ARRAYS_EQUAL(DictionaryArray(dictionary(int32(), double_dict), indices),
+                      *result);
+  AssertBufferSame(*dict_array, *result, 1);
+
+  auto int8_indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 2, 0, 1, 0}, is_valid);
+  to_type = dictionary(int8(), _MakeArray<DoubleType, double>(float64(), {}, {}));
+  ASSERT_OK(Cast(&this->ctx_, *dict_array, to_type, CastOptions(), &result));
+  ASSERT_ARRAYS_EQUAL(DictionaryArray(dictionary(int8(), double_dict), int8_indices),
+                      *result);
+
+  // Dense outputs gather the cast dictionary
+  auto dense = _MakeArray<DoubleType, double>(float64(), {10, 30, 0, 20, 10}, is_valid);
+  this->CheckPass(*dict_array, *dense, float64(), CastOptions());
+  this->CheckPass(*dict_array->Slice(2), *dense->Slice(2), float64(), CastOptions());
+
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{dict_array, dict_array->Slice(1)}));
+  Datum out;
+  ASSERT_OK(Cast(&this->ctx_, chunked, float64(), CastOptions(), &out));
+  ASSERT_TRUE(out.chunked_array()->Equals(
+      ChunkedArray(ArrayVector{dense, dense->Slice(1)})));
+
+  // Narrowing the index type checks the indices
+  auto large_indices = _MakeArray<Int32Type, int32_t>(int32(), {1000}, {});
+  DictionaryArray large_array(dictionary(int32(), dict), large_indices);
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, large_array, to_type, CastOptions(), &result));
+
+  ASSERT_RAISES(NotImplemented,
+                Cast(&this->ctx_, *dict_array, binary(), CastOptions(), &result));
+}
+
+TEST_F(TestCast, RunLengthEncoded) {
+  vector<bool> is_valid = {true, true, true, false, false, true, true, true, true, true};
+  auto dense = _MakeArray<Int32Type, int32_t>(
+      int32(), {1, 1, 1, 0, 0, 2, 2, 2, 2, 3}, is_valid);
+
+  // Encoding finds the runs of equal values, nulls included
+  shared_ptr<Array> encoded;
+  ASSERT_OK(Cast(&this->ctx_, *dense, run_length_encoded(int32()), CastOptions(),
+                 &encoded));
+  ASSERT_OK(ValidateArray(*encoded));
+  auto run_ends = _MakeArray<Int32Type, int32_t>(int32(), {3, 5, 9, 10}, {});
+  auto values =
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 2, 3}, {true, false, true, true});
+  shared_ptr<Array> expected;
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values, &expected));
+  ASSERT_ARRAYS_EQUAL(*expected, *encoded);
+  ASSERT_EQ(4, static_cast<const RunLengthEncodedArray&>(*encoded).num_runs());
+
+  // The values are cast once per run, sharing the run ends
+  shared_ptr<Array> double_encoded;
+  ASSERT_OK(Cast(&this->ctx_, *encoded, run_length_encoded(float64()), CastOptions(),
+                 &double_encoded));
+  ASSERT_OK(ValidateArray(*double_encoded));
+  AssertBufferSame(*encoded, *double_encoded, 1);
+  auto double_dense = _MakeArray<DoubleType, double>(
+      float64(), {1, 1, 1, 0, 0, 2, 2, 2, 2, 3}, is_valid);
+  shared_ptr<Array> result;
+  ASSERT_OK(Cast(&this->ctx_, *double_encoded, float64(), CastOptions(), &result));
+  ASSERT_ARRAYS_EQUAL(*double_dense, *result);
+
+  // Decoding, also of slices and to other types
+  this->CheckPass(*encoded, *dense, int32(), CastOptions());
+  this->CheckPass(*encoded->Slice(4, 3), *dense->Slice(4, 3), int32(), CastOptions());
+  this->CheckPass(*encoded->Slice(2), *double_dense->Slice(2), float64(),
+                  CastOptions());
+  ASSERT_OK(Cast(&this->ctx_, *encoded->Slice(4, 3), run_length_encoded(float64()),
+                 CastOptions(), &result));
+  ASSERT_OK(ValidateArray(*result));
+  ASSERT_ARRAYS_EQUAL(*double_encoded->Slice(4, 3), *result);
+
+  // Other value types are encoded through their equality
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "a", "", "b", "b"},
+                                                     {true, true, false, true, true});
+  ASSERT_OK(Cast(&this->ctx_, *strings, run_length_encoded(utf8()), CastOptions(),
+                 &encoded));
+  ASSERT_EQ(3, static_cast<const RunLengthEncodedArray&>(*encoded).num_runs());
+  this->CheckPass(*encoded, *strings, utf8(), CastOptions());
+
+  ASSERT_RAISES(NotImplemented,
+                Cast(&this->ctx_, *encoded, run_length_encoded(boolean()), CastOptions(),
+                     &result));
+}
+
 /*TYPED_TEST(TestDictionaryCast, Reverse) {
   CastOptions options;
   shared_ptr<Array> plain_array =
@@ -842,6 +1472,77 @@ TEST_F(TestCast, ListToList) {
                   options);
 }
 
+TEST_F(TestCast, OffsetWidths) {
+  CastOptions options;
+  vector<bool> is_valid = {true, false, true, true};
+  vector<std::string> strings = {"foo", "", "", "quux"};
+
+  CheckCase<StringType, std::string, LargeStringType, std::string>(
+      utf8(), strings, is_valid, large_utf8(), strings, options);
+  CheckCase<LargeStringType, std::string, StringType, std::string>(
+      large_utf8(), strings, is_valid, utf8(), strings, options);
+  CheckCase<BinaryType, std::string, LargeBinaryType, std::string>(
+      binary(), strings, is_valid, large_binary(), strings, options);
+  CheckCase<LargeBinaryType, std::string, BinaryType, std::string>(
+      large_binary(), strings, is_valid, binary(), strings, options);
+
+  // String views, with strings too long to be inlined
+  strings[3] = "a string of over 12 bytes";
+  CheckCase<StringType, std::string, StringViewType, std::string>(
+      utf8(), strings, is_valid, utf8_view(), strings, options);
+  CheckCase<StringViewType, std::string, StringType, std::string>(
+      utf8_view(), strings, is_valid, utf8(), strings, options);
+
+  // Lists, with their values cast along
+  shared_ptr<Array> offsets, large_offsets, int32_values, int64_values;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true, true}, {0, 2, 2, 5}, &offsets);
+  ArrayFromVector<Int64Type, int64_t>({true, false, true, true}, {0, 2, 2, 5},
+                                     &large_offsets);
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3, 4, 5}, &int32_values);
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3, 4, 5}, &int64_values);
+
+  shared_ptr<Array> list_array, large_list_array;
+  ASSERT_OK(ListArray::FromArrays(*offsets, *int32_values, pool_, &list_array));
+  ASSERT_OK(LargeListArray::FromArrays(*large_offsets, *int64_values, pool_,
+                                       &large_list_array));
+  CheckPass(*list_array, *large_list_array, large_list_array->type(), options);
+  CheckPass(*list_array->Slice(1), *large_list_array->Slice(1), large_list_array->type(),
+            options);
+  CheckPass(*large_list_array, *list_array, list_array->type(), options);
+
+  // Offsets past INT32_MAX
+  const int64_t huge_offsets[] = {0, int64_t(1) << 31};
+  LargeBinaryArray huge(1,
+                        std::make_shared<Buffer>(
+                            reinterpret_cast<const uint8_t*>(huge_offsets),
+                            sizeof(huge_offsets)),
+                        std::make_shared<Buffer>(""));
+  shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, Cast(&ctx_, huge, binary(), options, &result));
+}
+
+TEST_F(TestCast, DenseUnion) {
+  CastOptions options;
+  const vector<int8_t> children = {0, 1, -1, 0, 1, 0};
+  auto input = _MakeDenseUnion<Int32Type>(int32(), children, {1, 2, 3}, {"a", "bc"});
+  auto expected = _MakeDenseUnion<Int64Type>(int64(), children, {1, 2, 3}, {"a", "bc"});
+  CheckPass(*input, *expected, expected->type(), options);
+  CheckPass(*input->Slice(2), *expected->Slice(2), expected->type(), options);
+
+  // The type ids and offsets are shared, and so is the child of the same type
+  shared_ptr<Array> result;
+  ASSERT_OK(Cast(&ctx_, *input, expected->type(), options, &result));
+  AssertBufferSame(*input, *result, 1);
+  AssertBufferSame(*input, *result, 2);
+  ASSERT_EQ(input->data()->child_data[1], result->data()->child_data[1]);
+
+  auto other_codes =
+      union_({field("i", int64()), field("s", utf8())}, {0, 1}, UnionMode::DENSE);
+  ASSERT_RAISES(NotImplemented, Cast(&ctx_, *input, other_codes, options, &result));
+  auto sparse = union_({field("i", int64()), field("s", utf8())}, {5, 10});
+  ASSERT_RAISES(NotImplemented, Cast(&ctx_, *input, sparse, options, &result));
+}
+
 // ----------------------------------------------------------------------
 // Dictionary tests
 
@@ -876,6 +1577,50 @@ void CheckDictEncode(FunctionContext* ctx, const shared_ptr<DataType>& type,
   ASSERT_ARRAYS_EQUAL(expected, *result);
 }
 
+template <typename Type, typename T>
+void CheckMatch(FunctionContext* ctx, const shared_ptr<DataType>& type,
+                const vector<T>& in_values, const vector<bool>& in_is_valid,
+                const vector<T>& member_values, const vector<bool>& member_is_valid,
+                const vector<int32_t>& out_values, const vector<bool>& out_is_valid) {
+  shared_ptr<Array> input = _MakeArray<Type, T>(type, in_values, in_is_valid);
+  shared_ptr<Array> members = _MakeArray<Type, T>(type, member_values, member_is_valid);
+  shared_ptr<Array> expected =
+      _MakeArray<Int32Type, int32_t>(int32(), out_values, out_is_valid);
+
+  Datum datum_out;
+  ASSERT_OK(Match(ctx, Datum(input), Datum(members), &datum_out));
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(datum_out.array()));
+}
+
+template <typename Type, typename T>
+void CheckIsIn(FunctionContext* ctx, const shared_ptr<DataType>& type,
+               const vector<T>& in_values, const vector<bool>& in_is_valid,
+               const vector<T>& member_values, const vector<bool>& member_is_valid,
+               const vector<bool>& out_values, const vector<bool>& out_is_valid) {
+  shared_ptr<Array> input = _MakeArray<Type, T>(type, in_values, in_is_valid);
+  shared_ptr<Array> members = _MakeArray<Type, T>(type, member_values, member_is_valid);
+  shared_ptr<Array> expected =
+      _MakeArray<BooleanType, bool>(boolean(), out_values, out_is_valid);
+
+  Datum datum_out;
+  ASSERT_OK(IsIn(ctx, Datum(input), Datum(members), &datum_out));
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(datum_out.array()));
+}
+
+template <typename Type, typename T>
+void CheckCountValues(FunctionContext* ctx, const shared_ptr<DataType>& type,
+                      const vector<T>& in_values, const vector<bool>& in_is_valid,
+                      const vector<T>& out_values, const vector<int64_t>& out_counts) {
+  shared_ptr<Array> input = _MakeArray<Type, T>(type, in_values, in_is_valid);
+  shared_ptr<Array> ex_uniques = _MakeArray<Type, T>(type, out_values, {});
+  shared_ptr<Array> ex_counts = _MakeArray<Int64Type, int64_t>(int64(), out_counts, {});
+
+  shared_ptr<Array> uniques, counts;
+  ASSERT_OK(CountValues(ctx, Datum(input), &uniques, &counts));
+  ASSERT_ARRAYS_EQUAL(*ex_uniques, *uniques);
+  ASSERT_ARRAYS_EQUAL(*ex_counts, *counts);
+}
+
 class TestHashKernel : public ComputeFixture, public TestBase {};
 
 template <typename Type>
@@ -903,14 +1648,42 @@ TYPED_TEST(TestHashKernelPrimitive, DictEncode) {
                                 {0, 0, 0, 1, 0, 2});
 }
 
+TYPED_TEST(TestHashKernelPrimitive, Match) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  CheckMatch<TypeParam, T>(&this->ctx_, type, {2, 1, 2, 1, 4, 3},
+                           {true, false, true, true, true, true}, {3, 2, 0, 3},
+                           {true, true, false, true}, {1, 0, 1, 0, 0, 0},
+                           {true, false, true, false, false, true});
+}
+
+TYPED_TEST(TestHashKernelPrimitive, IsIn) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  CheckIsIn<TypeParam, T>(&this->ctx_, type, {2, 1, 2, 1, 4, 3},
+                          {true, false, true, true, true, true}, {3, 2, 0},
+                          {true, true, false}, {true, false, true, false, false, true},
+                          {true, false, true, true, true, true});
+}
+
+TYPED_TEST(TestHashKernelPrimitive, CountValues) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  CheckCountValues<TypeParam, T>(&this->ctx_, type, {2, 1, 2, 1, 2, 3},
+                                 {true, false, true, true, true, true}, {2, 1, 3},
+                                 {3, 1, 1});
+}
+
 TYPED_TEST(TestHashKernelPrimitive, PrimitiveResizeTable) {
   using T = typename TypeParam::c_type;
   // Skip this test for (u)int8
-  if (sizeof(Scalar) == 1) {
+  if (sizeof(T) == 1) {
     return;
   }
 
-  const int64_t kTotalValues = 1000000;
+  // Distinct values, within the range of 16-bit types
+  const int64_t kTotalValues =
+      std::min<int64_t>(1000000, static_cast<int64_t>(std::numeric_limits<T>::max()));
   const int64_t kRepeats = 5;
 
   vector<T> values;
@@ -985,6 +1758,12 @@ TEST_F(TestHashKernel, UniqueBinary) {
 
   CheckUnique<StringType, std::string>(&this->ctx_, utf8(), {"test", "", "test2", "test"},
                                        {true, false, true, true}, {"test", "test2"}, {});
+
+  CheckUnique<StringViewType, std::string>(
+      &this->ctx_, utf8_view(),
+      {"a long test string", "", "test", "a long test string", "a long test strinG"},
+      {true, false, true, true, true},
+      {"a long test string", "test", "a long test strinG"}, {});
 }
 
 TEST_F(TestHashKernel, DictEncodeBinary) {
@@ -995,6 +1774,71 @@ TEST_F(TestHashKernel, DictEncodeBinary) {
   CheckDictEncode<StringType, std::string>(
       &this->ctx_, utf8(), {"test", "", "test2", "test", "baz"},
       {true, false, true, true, true}, {"test", "test2", "baz"}, {}, {0, 0, 1, 0, 2});
+
+  CheckDictEncode<StringViewType, std::string>(
+      &this->ctx_, utf8_view(), {"test", "", "a long test string", "test", "baz"},
+      {true, false, true, true, true}, {"test", "a long test string", "baz"}, {},
+      {0, 0, 1, 0, 2});
+}
+
+TEST_F(TestHashKernel, MatchIsInCountValuesBinary) {
+  CheckMatch<StringType, std::string>(&this->ctx_, utf8(), {"b", "", "a", "c", "b"},
+                                      {true, false, true, true, true}, {"a", "b", "a"},
+                                      {}, {1, 0, 0, 0, 1},
+                                      {true, false, true, false, true});
+  CheckIsIn<BinaryType, std::string>(&this->ctx_, binary(), {"b", "", "a", "c", "b"},
+                                     {true, false, true, true, true}, {"a", "b"}, {},
+                                     {true, false, true, false, true},
+                                     {true, false, true, true, true});
+  CheckCountValues<StringType, std::string>(&this->ctx_, utf8(),
+                                            {"b", "", "a", "b", "", "b"},
+                                            {true, false, true, true, true, true},
+                                            {"b", "a", ""}, {3, 1, 1});
+}
+
+TEST_F(TestHashKernel, MatchIsInChunked) {
+  auto type = int32();
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{_MakeArray<Int32Type, int32_t>(type, {1, 5, 2}, {true, true, false}),
+                  _MakeArray<Int32Type, int32_t>(type, {}, {}),
+                  _MakeArray<Int32Type, int32_t>(type, {3, 1}, {})});
+  auto members = std::make_shared<ChunkedArray>(
+      ArrayVector{_MakeArray<Int32Type, int32_t>(type, {3}, {}),
+                  _MakeArray<Int32Type, int32_t>(type, {1, 3}, {})});
+
+  Datum out;
+  ASSERT_OK(Match(&this->ctx_, Datum(values), Datum(members), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ChunkedArray ex_match(ArrayVector{
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 0}, {true, false, false}),
+      _MakeArray<Int32Type, int32_t>(int32(), {}, {}),
+      _MakeArray<Int32Type, int32_t>(int32(), {0, 1}, {})});
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_match));
+
+  ASSERT_OK(IsIn(&this->ctx_, Datum(values), Datum(members), &out));
+  ChunkedArray ex_isin(ArrayVector{
+      _MakeArray<BooleanType, bool>(boolean(), {true, false, false},
+                                    {true, true, false}),
+      _MakeArray<BooleanType, bool>(boolean(), {}, {}),
+      _MakeArray<BooleanType, bool>(boolean(), {true, true}, {})});
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_isin));
+
+  shared_ptr<Array> uniques, counts;
+  ASSERT_OK(CountValues(&this->ctx_, Datum(values), &uniques, &counts));
+  auto ex_uniques = _MakeArray<Int32Type, int32_t>(type, {1, 5, 3}, {});
+  auto ex_counts = _MakeArray<Int64Type, int64_t>(int64(), {2, 1, 1}, {});
+  ASSERT_ARRAYS_EQUAL(*ex_uniques, *uniques);
+  ASSERT_ARRAYS_EQUAL(*ex_counts, *counts);
+
+  // Empty member set
+  auto no_members = _MakeArray<Int32Type, int32_t>(type, {}, {});
+  auto ex_none = _MakeArray<BooleanType, bool>(boolean(), {false, false}, {});
+  ASSERT_OK(IsIn(&this->ctx_, Datum(values->chunk(2)), Datum(no_members), &out));
+  ASSERT_ARRAYS_EQUAL(*ex_none, *MakeArray(out.array()));
+
+  // Mismatched types
+  auto string_members = _MakeArray<StringType, std::string>(utf8(), {"a"}, {});
+  ASSERT_RAISES(Invalid, Match(&this->ctx_, Datum(values), Datum(string_members), &out));
 }
 
 TEST_F(TestHashKernel, BinaryResizeTable) {
@@ -1025,6 +1869,156 @@ TEST_F(TestHashKernel, BinaryResizeTable) {
   CheckUnique<StringType, std::string>(&this->ctx_, utf8(), values, {}, uniques, {});
   CheckDictEncode<StringType, std::string>(&this->ctx_, utf8(), values, {}, uniques, {},
                                            indices);
+
+  CheckDictEncode<StringViewType, std::string>(&this->ctx_, utf8_view(), values, {},
+                                               uniques, {}, indices);
+}
+
+TEST_F(TestHashKernel, DictEncodeBlocksWithNulls) {
+  // Hashes are computed by blocks of values; check nulls and slice offsets
+  // are honoured across block boundaries
+  const int64_t length = 1500;
+  const int64_t kSliceOffset = 3;
+
+  vector<bool> is_valid;
+  vector<int64_t> int_values;
+  vector<std::string> str_values;
+  for (int64_t i = 0; i < length; ++i) {
+    is_valid.push_back(i % 5 != 1);
+    int_values.push_back((i * 7) % 300);
+    str_values.push_back(std::to_string((i * 7) % 300));
+  }
+
+  // Expected dictionary and indices for the sliced input
+  vector<bool> ex_is_valid(is_valid.begin() + kSliceOffset, is_valid.end());
+  vector<int64_t> ex_int_dict;
+  vector<std::string> ex_str_dict;
+  vector<int32_t> ex_indices;
+  std::unordered_map<int64_t, int32_t> memo;
+  for (int64_t i = kSliceOffset; i < length; ++i) {
+    if (!is_valid[i]) {
+      ex_indices.push_back(0);
+      continue;
+    }
+    auto it = memo.find(int_values[i]);
+    if (it == memo.end()) {
+      const auto index = static_cast<int32_t>(ex_int_dict.size());
+      it = memo.emplace(int_values[i], index).first;
+      ex_int_dict.push_back(int_values[i]);
+      ex_str_dict.push_back(str_values[i]);
+    }
+    ex_indices.push_back(it->second);
+  }
+  shared_ptr<Array> ex_indices_array =
+      _MakeArray<Int32Type, int32_t>(int32(), ex_indices, ex_is_valid);
+
+  auto CheckSliced = [&](const shared_ptr<Array>& input,
+                         const shared_ptr<Array>& ex_dict) {
+    DictionaryArray expected(dictionary(int32(), ex_dict), ex_indices_array);
+    Datum datum_out;
+    ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(input->Slice(kSliceOffset)),
+                               &datum_out));
+    ASSERT_ARRAYS_EQUAL(expected, *MakeArray(datum_out.array()));
+  };
+
+  CheckSliced(_MakeArray<Int64Type, int64_t>(int64(), int_values, is_valid),
+              _MakeArray<Int64Type, int64_t>(int64(), ex_int_dict, {}));
+  CheckSliced(_MakeArray<StringType, std::string>(utf8(), str_values, is_valid),
+              _MakeArray<StringType, std::string>(utf8(), ex_str_dict, {}));
+}
+
+TEST_F(TestHashKernel, DictEncodeSlicesWithoutNulls) {
+  // Slices of arrays with nulls have unknown null counts, and are counted to
+  // take the loops without validity checks when they hold no nulls
+  auto values = _MakeArray<Int64Type, int64_t>(int64(), {0, 5, 3, 5, 0, 7},
+                                               {false, true, true, true, false, true});
+  auto strings = _MakeArray<StringType, std::string>(
+      utf8(), {"", "b", "a", "b", "", "c"}, {false, true, true, true, false, true});
+  auto ex_indices = _MakeArray<Int32Type, int32_t>(int32(), {0, 1, 0}, {});
+
+  for (const auto& array : {values, strings}) {
+    auto slice = array->Slice(1, 3);
+    ASSERT_EQ(kUnknownNullCount, slice->data()->null_count);
+
+    Datum out;
+    ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(slice->data()), &out));
+    auto encoded = MakeArray(out.array());
+    const auto& dict_encoded = static_cast<const DictionaryArray&>(*encoded);
+    ASSERT_EQ(0, encoded->null_count());
+    ASSERT_ARRAYS_EQUAL(*ex_indices, *dict_encoded.indices());
+
+    // A slice with nulls still observes them
+    ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(array->Slice(3)->data()), &out));
+    ASSERT_EQ(1, out.array()->null_count);
+  }
+}
+
+TEST_F(TestHashKernel, ParallelDictEncode) {
+  // Large enough to be split into several partitions hashed separately
+  const int64_t length = 300000;
+
+  vector<bool> is_valid;
+  vector<int64_t> int_values;
+  vector<std::string> str_values;
+  for (int64_t i = 0; i < length; ++i) {
+    // A long run of nulls, so that a partition can be all null
+    is_valid.push_back(i % 7 != 3 && (i < 100000 || i >= 175000));
+    int_values.push_back((i * 7919) % 20011 + i / 1000);
+    str_values.push_back(std::to_string(int_values.back()));
+  }
+
+  auto CheckParallel = [&](const shared_ptr<Array>& values) {
+    // Chunks of uneven lengths, among which an empty and an all-null one
+    ArrayVector chunks = {values->Slice(0, 1000),       values->Slice(1000, 99000),
+                          values->Slice(100000, 0),     values->Slice(100000, 75000),
+                          values->Slice(175000, 76000), values->Slice(251000)};
+    Datum chunked(std::make_shared<ChunkedArray>(chunks));
+    Datum sliced(values->Slice(5));
+
+    FunctionContext serial_ctx(this->ctx_.memory_pool());
+    Datum ex_chunked, ex_sliced;
+    shared_ptr<Array> ex_unique, ex_counts, serial_uniques;
+    ASSERT_OK(CountValues(&serial_ctx, chunked, &serial_uniques, &ex_counts));
+    ASSERT_OK(DictionaryEncode(&serial_ctx, chunked, &ex_chunked));
+    ASSERT_OK(DictionaryEncode(&serial_ctx, sliced, &ex_sliced));
+    ASSERT_OK(Unique(&serial_ctx, chunked, &ex_unique));
+    ASSERT_ARRAYS_EQUAL(*ex_unique, *serial_uniques);
+
+    auto CheckContext = [&](FunctionContext* ctx) {
+      Datum out;
+      ASSERT_OK(DictionaryEncode(ctx, chunked, &out));
+      ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+      ASSERT_TRUE(out.chunked_array()->Equals(*ex_chunked.chunked_array()));
+
+      std::unique_ptr<UnaryKernel> kernel;
+      ASSERT_OK(GetParallelDictionaryEncodeKernel(ctx, values->type(), &kernel));
+      ASSERT_OK(kernel->Call(ctx, sliced, &out));
+      ASSERT_EQ(Datum::ARRAY, out.kind());
+      ASSERT_ARRAYS_EQUAL(*MakeArray(ex_sliced.array()), *MakeArray(out.array()));
+
+      shared_ptr<Array> unique;
+      ASSERT_OK(Unique(ctx, chunked, &unique));
+      ASSERT_ARRAYS_EQUAL(*ex_unique, *unique);
+
+      shared_ptr<Array> counts;
+      ASSERT_OK(CountValues(ctx, chunked, &unique, &counts));
+      ASSERT_ARRAYS_EQUAL(*ex_unique, *unique);
+      ASSERT_ARRAYS_EQUAL(*ex_counts, *counts);
+    };
+
+    FunctionContext threaded_ctx(this->ctx_.memory_pool());
+    threaded_ctx.set_num_threads(4);
+    CheckContext(&threaded_ctx);
+
+    std::shared_ptr<TaskScheduler> scheduler;
+    ASSERT_OK(TaskScheduler::Make(3, &scheduler));
+    FunctionContext scheduler_ctx(this->ctx_.memory_pool());
+    scheduler_ctx.set_task_scheduler(scheduler.get());
+    CheckContext(&scheduler_ctx);
+  };
+
+  CheckParallel(_MakeArray<Int64Type, int64_t>(int64(), int_values, is_valid));
+  CheckParallel(_MakeArray<StringType, std::string>(utf8(), str_values, is_valid));
 }
 
 TEST_F(TestHashKernel, UniqueFixedSizeBinary) {
@@ -1120,5 +2114,2855 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   ASSERT_TRUE(encoded_out.chunked_array()->Equals(*dict_carr));
 }
 
+TEST_F(TestHashKernel, DictEncodeTable) {
+  auto type = utf8();
+  auto a1 = _MakeArray<StringType, std::string>(type, {"foo", "bar", "foo"}, {});
+  auto a2 = _MakeArray<StringType, std::string>(type, {"bar", "baz"}, {});
+  auto b1 = _MakeArray<Int32Type, int32_t>(int32(), {7, 7, 8, 7, 9}, {});
+
+  auto schema = ::arrow::schema({field("a", type), field("b", int32(), false)});
+  vector<shared_ptr<Column>> columns = {
+      std::make_shared<Column>(schema->field(0), ArrayVector{a1, a2}),
+      std::make_shared<Column>(schema->field(1), ArrayVector{b1})};
+  auto table = Table::Make(schema, columns);
+
+  auto a_dict = _MakeArray<StringType, std::string>(type, {"foo", "bar", "baz"}, {});
+  auto b_dict = _MakeArray<Int32Type, int32_t>(int32(), {7, 8, 9}, {});
+  auto a_type = dictionary(int32(), a_dict);
+  auto b_type = dictionary(int32(), b_dict);
+
+  ArrayVector ex_a = {
+      std::make_shared<DictionaryArray>(
+          a_type, _MakeArray<Int32Type, int32_t>(int32(), {0, 1, 0}, {})),
+      std::make_shared<DictionaryArray>(
+          a_type, _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {}))};
+  ArrayVector ex_b = {std::make_shared<DictionaryArray>(
+      b_type, _MakeArray<Int32Type, int32_t>(int32(), {0, 0, 1, 0, 2}, {}))};
+
+  for (int num_threads : {1, 2}) {
+    this->ctx_.set_num_threads(num_threads);
+
+    Datum encoded_out;
+    ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(table), &encoded_out));
+    ASSERT_EQ(Datum::TABLE, encoded_out.kind());
+
+    auto result = encoded_out.table();
+    ASSERT_EQ(2, result->num_columns());
+    ASSERT_EQ(table->num_rows(), result->num_rows());
+    ASSERT_TRUE(result->column(0)->data()->Equals(ChunkedArray(ex_a)));
+    ASSERT_TRUE(result->column(1)->data()->Equals(ChunkedArray(ex_b)));
+    ASSERT_TRUE(result->schema()->field(0)->type()->Equals(a_type));
+    ASSERT_FALSE(result->schema()->field(1)->nullable());
+  }
+
+  // Column tasks and the chunk tasks they spawn share the scheduler
+  std::shared_ptr<TaskScheduler> scheduler;
+  ASSERT_OK(TaskScheduler::Make(2, &scheduler));
+  this->ctx_.set_task_scheduler(scheduler.get());
+  Datum encoded_out;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(table), &encoded_out));
+  ASSERT_TRUE(encoded_out.table()->column(0)->data()->Equals(ChunkedArray(ex_a)));
+  ASSERT_TRUE(encoded_out.table()->column(1)->data()->Equals(ChunkedArray(ex_b)));
+  this->ctx_.set_task_scheduler(nullptr);
+}
+
+TEST_F(TestHashKernel, UnifyDictionaries) {
+  auto type = utf8();
+  auto d1 = _MakeArray<StringType, std::string>(type, {"foo", "bar"}, {});
+  auto d2 = _MakeArray<StringType, std::string>(type, {"baz", "", "foo"},
+                                                {true, false, true});
+  auto t1 = dictionary(int8(), d1);
+  auto t2 = dictionary(int32(), d2);
+
+  // The second chunk shares the dictionary of the first
+  ArrayVector chunks = {
+      std::make_shared<DictionaryArray>(
+          t1, _MakeArray<Int8Type, int8_t>(int8(), {1, 0, 1}, {})),
+      std::make_shared<DictionaryArray>(
+          t1, _MakeArray<Int8Type, int8_t>(int8(), {0, 5}, {true, false})),
+      std::make_shared<DictionaryArray>(
+          t2, _MakeArray<Int32Type, int32_t>(int32(), {2, 1, 0, 0}, {}))};
+
+  auto ex_dict = _MakeArray<StringType, std::string>(type, {"foo", "bar", "baz"}, {});
+  auto ex_type = dictionary(int32(), ex_dict);
+  ArrayVector ex_chunks = {
+      std::make_shared<DictionaryArray>(
+          ex_type, _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 1}, {})),
+      std::make_shared<DictionaryArray>(
+          ex_type, _MakeArray<Int32Type, int32_t>(int32(), {0, 0}, {true, false})),
+      std::make_shared<DictionaryArray>(
+          ex_type, _MakeArray<Int32Type, int32_t>(int32(), {0, 0, 2, 2},
+                                                  {true, false, true, true}))};
+
+  for (int num_threads : {1, 2}) {
+    this->ctx_.set_num_threads(num_threads);
+    Datum out;
+    ASSERT_OK(UnifyDictionaries(&this->ctx_,
+                                Datum(std::make_shared<ChunkedArray>(chunks)), &out));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(ex_chunks)));
+  }
+
+  Datum out;
+  ASSERT_OK(UnifyDictionaries(&this->ctx_, Datum(chunks[0]->data()), &out));
+  ASSERT_EQ(Datum::ARRAY, out.kind());
+  auto ex_array = std::make_shared<DictionaryArray>(
+      dictionary(int32(), d1), _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 1}, {}));
+  ASSERT_ARRAYS_EQUAL(*ex_array, *MakeArray(out.array()));
+
+  // Dictionaries of other value types or plain values are rejected
+  auto other = std::make_shared<DictionaryArray>(
+      dictionary(int8(), _MakeArray<Int32Type, int32_t>(int32(), {1}, {})),
+      _MakeArray<Int8Type, int8_t>(int8(), {0}, {}));
+  ASSERT_RAISES(Invalid,
+                UnifyDictionaries(&this->ctx_,
+                                  Datum(std::make_shared<ChunkedArray>(
+                                      ArrayVector{chunks[0], other})),
+                                  &out));
+  ASSERT_RAISES(Invalid, UnifyDictionaries(&this->ctx_, Datum(d1->data()), &out));
+}
+
+// ----------------------------------------------------------------------
+// Group-by tests
+
+class TestGroupBy : public ComputeFixture, public TestBase {
+ public:
+  void SetUp() override {
+    schema_ = ::arrow::schema({field("k", utf8()), field("k2", int32()),
+                               field("v", int32()), field("f", float64())});
+    batch1_ = RecordBatch::Make(
+        schema_, 4,
+        {_MakeArray<StringType, std::string>(utf8(), {"a", "b", "", "a"},
+                                             {true, true, false, true}),
+         _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 1, 2}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 0}, {true, true, true, false}),
+         _MakeArray<DoubleType, double>(float64(), {1.5, -2.0, 0.5, 4.0}, {})});
+    batch2_ = RecordBatch::Make(
+        schema_, 3,
+        {_MakeArray<StringType, std::string>(utf8(), {"b", "c", "a"}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 2}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {5, 0, 7}, {true, false, true}),
+         _MakeArray<DoubleType, double>(float64(), {3.0, 8.0, -1.0}, {})});
+  }
+
+  shared_ptr<Array> KeyColumn(const shared_ptr<Array>& dict,
+                              const vector<int32_t>& indices,
+                              const vector<bool>& is_valid) {
+    auto indices_array = _MakeArray<Int32Type, int32_t>(int32(), indices, is_valid);
+    return std::make_shared<DictionaryArray>(dictionary(int32(), dict), indices_array);
+  }
+
+ protected:
+  shared_ptr<Schema> schema_;
+  shared_ptr<RecordBatch> batch1_;
+  shared_ptr<RecordBatch> batch2_;
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch1_, batch2_}, &table));
+
+  GroupByOptions options;
+  options.keys = {"k"};
+  options.aggregates = {Aggregate(AggregateFunction::SUM, "v"),
+                        Aggregate(AggregateFunction::COUNT, "v"),
+                        Aggregate(AggregateFunction::COUNT, ""),
+                        Aggregate(AggregateFunction::MIN, "f"),
+                        Aggregate(AggregateFunction::MAX, "v")};
+  shared_ptr<Table> result;
+  ASSERT_OK(GroupBy(&this->ctx_, *table, options, &result));
+
+  // Groups: "a", "b", null, "c"
+  ASSERT_EQ(4, result->num_rows());
+  ASSERT_EQ(6, result->num_columns());
+  auto key_dict = _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c"}, {});
+  ArrayVector expected = {
+      KeyColumn(key_dict, {0, 1, 0, 2}, {true, true, false, true}),
+      _MakeArray<Int64Type, int64_t>(int64(), {8, 7, 3, 0}, {true, true, true, false}),
+      _MakeArray<Int64Type, int64_t>(int64(), {2, 2, 1, 0}, {}),
+      _MakeArray<Int64Type, int64_t>(int64(), {3, 2, 1, 1}, {}),
+      _MakeArray<DoubleType, double>(float64(), {-1.0, -2.0, 0.5, 8.0}, {}),
+      _MakeArray<Int32Type, int32_t>(int32(), {7, 5, 3, 0}, {true, true, true, false})};
+  for (int i = 0; i < result->num_columns(); ++i) {
+    ASSERT_EQ(1, result->column(i)->data()->num_chunks());
+    ASSERT_ARRAYS_EQUAL(*expected[i], *result->column(i)->data()->chunk(0));
+  }
+
+  const Schema& out_schema = *result->schema();
+  ASSERT_EQ("k", out_schema.field(0)->name());
+  ASSERT_EQ("sum(v)", out_schema.field(1)->name());
+  ASSERT_EQ("count(*)", out_schema.field(3)->name());
+  ASSERT_FALSE(out_schema.field(3)->nullable());
+  ASSERT_TRUE(out_schema.field(5)->nullable());
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto key_dict = _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c"}, {});
+  auto key2_dict = _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {});
+  auto ex_k = KeyColumn(key_dict, {0, 1, 0, 0, 2}, {true, true, false, true, true});
+  auto ex_k2 = KeyColumn(key2_dict, {0, 0, 0, 1, 0}, {});
+  auto ex_counts = _MakeArray<Int64Type, int64_t>(int64(), {1, 2, 1, 2, 1}, {});
+
+  // Two keys are hashed as int64 tuples, more as fixed size binary ones
+  for (const vector<std::string>& keys :
+       {vector<std::string>{"k", "k2"}, vector<std::string>{"k", "k2", "k2"}}) {
+    GroupByOptions options;
+    options.keys = keys;
+    options.aggregates = {Aggregate(AggregateFunction::COUNT, "")};
+    std::unique_ptr<GroupByKernel> kernel;
+    ASSERT_OK(GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+    ASSERT_OK(kernel->Append(&this->ctx_, *batch1_));
+    ASSERT_OK(kernel->Append(&this->ctx_, *batch2_));
+
+    shared_ptr<RecordBatch> result;
+    ASSERT_OK(kernel->Flush(&result));
+    ASSERT_EQ(static_cast<int>(keys.size()) + 1, result->num_columns());
+    ASSERT_ARRAYS_EQUAL(*ex_k, *result->column(0));
+    ASSERT_ARRAYS_EQUAL(*ex_k2, *result->column(1));
+    ASSERT_ARRAYS_EQUAL(*ex_counts, *result->column(result->num_columns() - 1));
+  }
+}
+
+TEST_F(TestGroupBy, FlushStartsOver) {
+  GroupByOptions options;
+  options.keys = {"k2"};
+  options.aggregates = {Aggregate(AggregateFunction::SUM, "f")};
+  std::unique_ptr<GroupByKernel> kernel;
+  ASSERT_OK(GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+
+  shared_ptr<RecordBatch> result;
+  ASSERT_OK(kernel->Flush(&result));
+  ASSERT_EQ(0, result->num_rows());
+
+  ASSERT_OK(kernel->Append(&this->ctx_, *batch1_));
+  ASSERT_OK(kernel->Flush(&result));
+  auto ex_k2 = KeyColumn(_MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {}), {0, 1}, {});
+  ASSERT_ARRAYS_EQUAL(*ex_k2, *result->column(0));
+  auto ex_sums = _MakeArray<DoubleType, double>(float64(), {0.0, 4.0}, {});
+  ASSERT_ARRAYS_EQUAL(*ex_sums, *result->column(1));
+
+  ASSERT_OK(kernel->Append(&this->ctx_, *batch2_));
+  ASSERT_OK(kernel->Flush(&result));
+  ASSERT_ARRAYS_EQUAL(*ex_k2, *result->column(0));
+  ex_sums = _MakeArray<DoubleType, double>(float64(), {11.0, -1.0}, {});
+  ASSERT_ARRAYS_EQUAL(*ex_sums, *result->column(1));
+}
+
+TEST_F(TestGroupBy, Errors) {
+  std::unique_ptr<GroupByKernel> kernel;
+  GroupByOptions options;
+  options.aggregates = {Aggregate(AggregateFunction::SUM, "v")};
+  ASSERT_RAISES(Invalid, GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+
+  options.keys = {"missing"};
+  ASSERT_RAISES(Invalid, GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+
+  options.keys = {"k2"};
+  options.aggregates = {Aggregate(AggregateFunction::SUM, "k")};
+  ASSERT_RAISES(NotImplemented, GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+
+  options.aggregates = {Aggregate(AggregateFunction::MAX, "")};
+  ASSERT_RAISES(Invalid, GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+
+  options.aggregates = {Aggregate(AggregateFunction::MAX, "v")};
+  ASSERT_OK(GetGroupByKernel(&this->ctx_, schema_, options, &kernel));
+  auto other_batch = RecordBatch::Make(::arrow::schema({field("k2", int32())}), 4,
+                                       {batch1_->column(1)});
+  ASSERT_RAISES(Invalid, kernel->Append(&this->ctx_, *other_batch));
+}
+
+// ----------------------------------------------------------------------
+// Hash join tests
+
+class TestHashJoin : public ComputeFixture, public TestBase {
+ public:
+  void SetUp() override {
+    left_schema_ = ::arrow::schema(
+        {field("k", utf8()), field("k2", int32()), field("v", int32())});
+    left1_ = RecordBatch::Make(
+        left_schema_, 4,
+        {_MakeArray<StringType, std::string>(utf8(), {"a", "b", "", "c"},
+                                             {true, true, false, true}),
+         _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 1, 1}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {0, 1, 2, 3}, {})});
+    left2_ = RecordBatch::Make(
+        left_schema_, 2,
+        {_MakeArray<StringType, std::string>(utf8(), {"a", "d"}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {2, 1}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {4, 5}, {})});
+
+    auto right_schema = ::arrow::schema(
+        {field("rk", utf8()), field("rk2", int32()), field("w", float64())});
+    auto right1 = RecordBatch::Make(
+        right_schema, 3,
+        {_MakeArray<StringType, std::string>(utf8(), {"a", "b", "a"}, {}),
+         _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 1}, {}),
+         _MakeArray<DoubleType, double>(float64(), {10.0, 20.0, 30.0}, {})});
+    auto right2 = RecordBatch::Make(
+        right_schema, 2,
+        {_MakeArray<StringType, std::string>(utf8(), {"", "a"}, {false, true}),
+         _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {}),
+         _MakeArray<DoubleType, double>(float64(), {40.0, 50.0}, {})});
+    ASSERT_OK(Table::FromRecordBatches({right1, right2}, &right_));
+    ASSERT_OK(Table::FromRecordBatches({left1_, left2_}, &left_));
+  }
+
+  void AssertColumn(const Table& table, const std::string& name,
+                    const shared_ptr<Array>& expected) {
+    const int64_t index = table.schema()->GetFieldIndex(name);
+    ASSERT_GE(index, 0);
+    ASSERT_TRUE(table.column(static_cast<int>(index))->data()->Equals(ChunkedArray({expected})));
+  }
+
+ protected:
+  shared_ptr<Schema> left_schema_;
+  shared_ptr<RecordBatch> left1_;
+  shared_ptr<RecordBatch> left2_;
+  shared_ptr<Table> left_;
+  shared_ptr<Table> right_;
+};
+
+TEST_F(TestHashJoin, InnerSingleKey) {
+  JoinOptions options;
+  options.left_keys = {"k"};
+  options.right_keys = {"rk"};
+  std::unique_ptr<HashJoinKernel> kernel;
+  ASSERT_OK(GetHashJoinKernel(&this->ctx_, left_schema_, *right_, options, &kernel));
+
+  // The left columns, then the right columns which are not keys
+  auto ex_schema =
+      ::arrow::schema({field("k", utf8()), field("k2", int32()), field("v", int32()),
+                       field("rk2", int32()), field("w", float64())});
+  ASSERT_TRUE(kernel->out_schema()->Equals(*ex_schema));
+
+  shared_ptr<RecordBatch> result;
+  ASSERT_OK(kernel->Probe(&this->ctx_, *left1_, &result));
+  auto ex_k = _MakeArray<StringType, std::string>(utf8(), {"a", "a", "a", "b"}, {});
+  auto ex_v = _MakeArray<Int32Type, int32_t>(int32(), {0, 0, 0, 1}, {});
+  auto ex_rk2 = _MakeArray<Int32Type, int32_t>(int32(), {1, 1, 2, 1}, {});
+  auto ex_w = _MakeArray<DoubleType, double>(float64(), {10.0, 30.0, 50.0, 20.0}, {});
+  ASSERT_EQ(4, result->num_rows());
+  ASSERT_ARRAYS_EQUAL(*ex_k, *result->column(0));
+  ASSERT_ARRAYS_EQUAL(*ex_v, *result->column(2));
+  ASSERT_ARRAYS_EQUAL(*ex_rk2, *result->column(3));
+  ASSERT_ARRAYS_EQUAL(*ex_w, *result->column(4));
+
+  ASSERT_OK(kernel->Probe(&this->ctx_, *left2_, &result));
+  ex_v = _MakeArray<Int32Type, int32_t>(int32(), {4, 4, 4}, {});
+  ASSERT_EQ(3, result->num_rows());
+  ASSERT_ARRAYS_EQUAL(*ex_v, *result->column(2));
+
+  ASSERT_OK(kernel->Probe(&this->ctx_, *left1_->Slice(0, 0), &result));
+  ASSERT_EQ(0, result->num_rows());
+}
+
+TEST_F(TestHashJoin, LeftMultipleKeys) {
+  auto ex_v = _MakeArray<Int32Type, int32_t>(int32(), {0, 0, 1, 2, 3, 4, 5}, {});
+  auto ex_w = _MakeArray<DoubleType, double>(
+      float64(), {10.0, 30.0, 20.0, 0.0, 0.0, 50.0, 0.0},
+      {true, true, true, false, false, true, false});
+
+  // Two keys are hashed as int64 tuples, more as fixed size binary ones
+  for (const vector<std::string>& keys :
+       {vector<std::string>{"k", "k2"}, vector<std::string>{"k", "k2", "k2"}}) {
+    JoinOptions options;
+    options.type = JoinType::LEFT;
+    options.left_keys = keys;
+    options.right_keys = {"rk", "rk2", "rk2"};
+    options.right_keys.resize(keys.size());
+    shared_ptr<Table> result;
+    ASSERT_OK(HashJoin(&this->ctx_, *left_, *right_, options, &result));
+    ASSERT_EQ(4, result->num_columns());
+    AssertColumn(*result, "v", ex_v);
+    AssertColumn(*result, "w", ex_w);
+  }
+}
+
+TEST_F(TestHashJoin, Semi) {
+  JoinOptions options;
+  options.type = JoinType::SEMI;
+  options.left_keys = {"k"};
+  options.right_keys = {"rk"};
+  shared_ptr<Table> result;
+  ASSERT_OK(HashJoin(&this->ctx_, *left_, *right_, options, &result));
+  ASSERT_TRUE(result->schema()->Equals(*left_schema_));
+  AssertColumn(*result, "v", _MakeArray<Int32Type, int32_t>(int32(), {0, 1, 4}, {}));
+}
+
+TEST_F(TestHashJoin, BuildSmallerInput) {
+  // The right input has more rows, so the hash table is built from the left
+  // one and the output rows follow the right rows
+  JoinOptions options;
+  options.left_keys = {"rk"};
+  options.right_keys = {"k"};
+  for (int num_threads : {1, 4}) {
+    this->ctx_.set_num_threads(num_threads);
+    shared_ptr<Table> result;
+    ASSERT_OK(HashJoin(&this->ctx_, *right_, *left_, options, &result));
+    ASSERT_EQ(5, result->num_columns());
+    ASSERT_EQ("rk", result->schema()->field(0)->name());
+    AssertColumn(*result, "w",
+                 _MakeArray<DoubleType, double>(
+                     float64(), {10.0, 30.0, 50.0, 20.0, 10.0, 30.0, 50.0}, {}));
+    AssertColumn(*result, "v",
+                 _MakeArray<Int32Type, int32_t>(int32(), {0, 0, 0, 1, 4, 4, 4}, {}));
+  }
+  this->ctx_.set_num_threads(1);
+}
+
+TEST_F(TestHashJoin, Errors) {
+  std::unique_ptr<HashJoinKernel> kernel;
+  JoinOptions options;
+  ASSERT_RAISES(Invalid,
+                GetHashJoinKernel(&this->ctx_, left_schema_, *right_, options, &kernel));
+
+  options.left_keys = {"k", "k2"};
+  options.right_keys = {"rk"};
+  ASSERT_RAISES(Invalid,
+                GetHashJoinKernel(&this->ctx_, left_schema_, *right_, options, &kernel));
+
+  options.left_keys = {"missing"};
+  ASSERT_RAISES(Invalid,
+                GetHashJoinKernel(&this->ctx_, left_schema_, *right_, options, &kernel));
+
+  options.left_keys = {"k2"};
+  ASSERT_RAISES(Invalid,
+                GetHashJoinKernel(&this->ctx_, left_schema_, *right_, options, &kernel));
+
+  options.left_keys = {"k"};
+  ASSERT_OK(GetHashJoinKernel(&this->ctx_, left_schema_, *right_, options, &kernel));
+  auto other_batch = RecordBatch::Make(::arrow::schema({field("k", utf8())}), 4,
+                                       {left1_->column(0)});
+  shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, kernel->Probe(&this->ctx_, *other_batch, &result));
+}
+
+// ----------------------------------------------------------------------
+// Exec plan tests
+
+class TestExecPlan : public ComputeFixture, public TestBase {
+ public:
+  void SetUp() override {
+    // Three batches of k = i % 7 and v = i
+    schema_ = ::arrow::schema({field("k", int32()), field("v", int64())});
+    std::vector<shared_ptr<RecordBatch>> batches;
+    const vector<int64_t> bounds = {0, 4000, 7000, kNumRows};
+    for (size_t b = 0; b + 1 < bounds.size(); ++b) {
+      const int64_t begin = bounds[b];
+      const int64_t end = bounds[b + 1];
+      vector<int32_t> k;
+      vector<int64_t> v;
+      for (int64_t i = begin; i < end; ++i) {
+        k.push_back(static_cast<int32_t>(i % 7));
+        v.push_back(i);
+      }
+      batches.push_back(RecordBatch::Make(
+          schema_, end - begin,
+          {_MakeArray<Int32Type, int32_t>(int32(), k, {}),
+           _MakeArray<Int64Type, int64_t>(int64(), v, {})}));
+    }
+    ASSERT_OK(Table::FromRecordBatches(batches, &table_));
+  }
+
+  std::shared_ptr<RecordBatchReader> Source() {
+    return std::make_shared<TableBatchReader>(*table_);
+  }
+
+ protected:
+  static constexpr int64_t kNumRows = 10000;
+
+  shared_ptr<Schema> schema_;
+  shared_ptr<Table> table_;
+};
+
+constexpr int64_t TestExecPlan::kNumRows;
+
+// Counts the batches being processed at the same time
+class ConcurrencyNode : public ExecNode {
+ public:
+  ConcurrencyNode() : running_(0), max_running_(0) {}
+
+  Status InputReceived(FunctionContext* ctx,
+                       const shared_ptr<RecordBatch>& batch) override {
+    int running = ++running_;
+    int max_running = max_running_.load();
+    while (running > max_running &&
+           !max_running_.compare_exchange_weak(max_running, running)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    --running_;
+    return Emit(ctx, batch);
+  }
+
+  Status InputFinished(FunctionContext* ctx) override { return Finish(ctx); }
+
+  int max_running() const { return max_running_.load(); }
+
+ private:
+  std::atomic<int> running_;
+  std::atomic<int> max_running_;
+};
+
+TEST_F(TestExecPlan, ScanFilterAggregate) {
+  // The sums of v >= 100 by k
+  vector<int64_t> ex_sums(7, 0);
+  for (int64_t i = 100; i < kNumRows; ++i) {
+    ex_sums[i % 7] += i;
+  }
+
+  for (int num_threads : {1, 4}) {
+    ExecOptions options;
+    options.morsel_size = 1000;
+    options.num_threads = num_threads;
+    ExecPlan plan(Source(), options);
+    plan.AddNode(MakeFilterNode(CompareToScalar(
+        "v", CompareOperator::GREATER_EQUAL,
+        std::make_shared<PrimitiveScalar<Int64Type>>(100))));
+    GroupByOptions group_by;
+    group_by.keys = {"k"};
+    group_by.aggregates = {Aggregate(AggregateFunction::SUM, "v")};
+    plan.AddNode(MakeGroupByNode(group_by));
+    vector<shared_ptr<RecordBatch>> out;
+    plan.AddNode(MakeSinkNode(&out));
+    ASSERT_OK(plan.Run(&this->ctx_));
+
+    // The groups are in order of first occurrence, which depends on the order
+    // the morsels were processed in
+    ASSERT_EQ(1, out.size());
+    ASSERT_EQ(7, out[0]->num_rows());
+    const auto& keys = static_cast<const DictionaryArray&>(*out[0]->column(0));
+    const auto& key_indices = static_cast<const Int32Array&>(*keys.indices());
+    const auto& key_values = static_cast<const Int32Array&>(*keys.dictionary());
+    const auto& sums = static_cast<const Int64Array&>(*out[0]->column(1));
+    for (int64_t g = 0; g < 7; ++g) {
+      ASSERT_EQ(ex_sums[key_values.Value(key_indices.Value(g))], sums.Value(g));
+    }
+  }
+}
+
+TEST_F(TestExecPlan, ProjectInOrder) {
+  // A single thread pushes the morsels in source order
+  ExecOptions options;
+  options.morsel_size = 3000;
+  options.num_threads = 1;
+  ExecPlan plan(Source(), options);
+  plan.AddNode(MakeProjectNode({"v"}));
+  vector<shared_ptr<RecordBatch>> out;
+  plan.AddNode(MakeSinkNode(&out));
+  ASSERT_OK(plan.Run(&this->ctx_));
+
+  // Batches of 4000, 3000 and 3000 rows
+  ASSERT_EQ(4, out.size());
+  ASSERT_EQ(3000, out[0]->num_rows());
+  ASSERT_EQ(1000, out[1]->num_rows());
+  shared_ptr<Table> result;
+  ASSERT_OK(Table::FromRecordBatches(out, &result));
+  ASSERT_EQ(1, result->num_columns());
+  ASSERT_TRUE(result->column(0)->data()->Equals(*table_->column(1)->data()));
+}
+
+TEST_F(TestExecPlan, Backpressure) {
+  ExecOptions options;
+  options.morsel_size = 100;
+  options.num_threads = 4;
+  options.max_in_flight = 2;
+  ExecPlan plan(Source(), options);
+  auto node = new ConcurrencyNode();
+  plan.AddNode(std::unique_ptr<ExecNode>(node));
+  std::atomic<int64_t> num_rows(0);
+  plan.AddNode(MakeSinkNode([&num_rows](const shared_ptr<RecordBatch>& batch) {
+    num_rows += batch->num_rows();
+    return Status::OK();
+  }));
+  ASSERT_OK(plan.Run(&this->ctx_));
+  ASSERT_EQ(kNumRows, num_rows.load());
+  ASSERT_LE(node->max_running(), 2);
+}
+
+TEST_F(TestExecPlan, Errors) {
+  ExecPlan empty_plan(Source());
+  ASSERT_RAISES(Invalid, empty_plan.Run(&this->ctx_));
+
+  for (int num_threads : {1, 4}) {
+    ExecOptions options;
+    options.morsel_size = 1000;
+    options.num_threads = num_threads;
+    ExecPlan plan(Source(), options);
+    plan.AddNode(MakeProjectNode({"missing"}));
+    vector<shared_ptr<RecordBatch>> out;
+    plan.AddNode(MakeSinkNode(&out));
+    ASSERT_RAISES(Invalid, plan.Run(&this->ctx_));
+    ASSERT_EQ(0, out.size());
+    ASSERT_RAISES(Invalid, plan.Run(&this->ctx_));
+  }
+}
+
+// ----------------------------------------------------------------------
+// Hash partition tests
+
+class TestHashPartition : public ComputeFixture, public TestBase {
+ public:
+  void SetUp() override {
+    const int64_t length = 1000;
+    Int64Builder ints;
+    StringBuilder strings;
+    BooleanBuilder bools;
+    FixedSizeBinaryBuilder narrow(fixed_size_binary(24));
+    FixedSizeBinaryBuilder wide(fixed_size_binary(40));
+    Int8Builder codes;
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_OK(i % 10 == 0 ? ints.AppendNull() : ints.Append(i % 37));
+      ASSERT_OK(strings.Append(i % 7 == 0 ? "" : "s" + std::to_string(i % 5)));
+      ASSERT_OK(i % 11 == 0 ? bools.AppendNull() : bools.Append(i % 3 == 0));
+      ASSERT_OK(narrow.Append(std::string(24, static_cast<char>('a' + i % 26))));
+      ASSERT_OK(wide.Append(std::string(40, static_cast<char>('A' + i % 26))));
+      ASSERT_OK(codes.Append(static_cast<int8_t>(i % 4)));
+    }
+    vector<shared_ptr<Array>> columns(6);
+    ASSERT_OK(ints.Finish(&columns[0]));
+    ASSERT_OK(strings.Finish(&columns[1]));
+    ASSERT_OK(bools.Finish(&columns[2]));
+    ASSERT_OK(narrow.Finish(&columns[3]));
+    ASSERT_OK(wide.Finish(&columns[4]));
+    shared_ptr<Array> dict_indices;
+    ASSERT_OK(codes.Finish(&dict_indices));
+    auto dict_type = dictionary(
+        int8(), _MakeArray<StringType, std::string>(utf8(), {"w", "x", "y", "z"}, {}));
+    columns[5] = std::make_shared<DictionaryArray>(dict_type, dict_indices);
+    auto schema = ::arrow::schema(
+        {field("i", int64()), field("s", utf8()), field("b", boolean()),
+         field("n", fixed_size_binary(24)), field("w", fixed_size_binary(40)),
+         field("d", dict_type)});
+    // Sliced, so that the columns have offsets
+    batch_ = RecordBatch::Make(schema, length, columns)->Slice(3);
+  }
+
+  // Each partition must hold the rows whose hash maps to it, in order
+  void CheckPartition(const vector<std::string>& keys, int num_partitions) {
+    vector<uint32_t> hashes;
+    ASSERT_OK(HashRows(&this->ctx_, *batch_, keys, &hashes));
+    vector<shared_ptr<RecordBatch>> partitions;
+    ASSERT_OK(HashPartition(&this->ctx_, *batch_, keys, num_partitions, &partitions));
+    ASSERT_EQ(num_partitions, static_cast<int>(partitions.size()));
+
+    for (int p = 0; p < num_partitions; ++p) {
+      vector<int32_t> rows;
+      for (int32_t i = 0; i < static_cast<int32_t>(hashes.size()); ++i) {
+        const uint64_t scaled = static_cast<uint64_t>(hashes[i]) * num_partitions;
+        if (static_cast<int>(scaled >> 32) == p) {
+          rows.push_back(i);
+        }
+      }
+      shared_ptr<Array> indices;
+      ArrayFromVector<Int32Type, int32_t>(rows, &indices);
+      Datum expected;
+      ASSERT_OK(Take(&this->ctx_, Datum(batch_), Datum(indices), &expected));
+      ASSERT_TRUE(partitions[p]->Equals(*expected.record_batch()));
+    }
+  }
+
+ protected:
+  shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestHashPartition, HashRows) {
+  vector<uint32_t> hashes;
+  ASSERT_OK(HashRows(&this->ctx_, *batch_, {"i", "s"}, &hashes));
+  ASSERT_EQ(batch_->num_rows(), static_cast<int64_t>(hashes.size()));
+  // Rows 3 and 188 have the same keys, and the nulls of rows 7 and 17 hash alike
+  ASSERT_EQ(hashes[3], hashes[188]);
+  ASSERT_EQ(hashes[7], hashes[17]);
+  ASSERT_NE(hashes[1], hashes[2]);
+
+  vector<uint32_t> swapped;
+  ASSERT_OK(HashRows(&this->ctx_, *batch_, {"s", "i"}, &swapped));
+  ASSERT_NE(hashes, swapped);
+}
+
+TEST_F(TestHashPartition, Partition) {
+  for (int num_threads : {1, 4}) {
+    this->ctx_.set_num_threads(num_threads);
+    CheckPartition({"i"}, 1);
+    CheckPartition({"i"}, 7);
+    CheckPartition({"s", "b"}, 3);
+    CheckPartition({"n", "w", "i"}, 64);
+    CheckPartition({"d"}, 2);
+  }
+}
+
+TEST_F(TestHashPartition, Empty) {
+  vector<shared_ptr<RecordBatch>> partitions;
+  ASSERT_OK(HashPartition(&this->ctx_, *batch_->Slice(0, 0), {"i", "s"}, 4, &partitions));
+  ASSERT_EQ(4, partitions.size());
+  for (const auto& partition : partitions) {
+    ASSERT_EQ(0, partition->num_rows());
+    ASSERT_OK(partition->Validate());
+  }
+}
+
+TEST_F(TestHashPartition, Errors) {
+  vector<shared_ptr<RecordBatch>> partitions;
+  ASSERT_RAISES(Invalid, HashPartition(&this->ctx_, *batch_, {}, 4, &partitions));
+  ASSERT_RAISES(Invalid, HashPartition(&this->ctx_, *batch_, {"i"}, 0, &partitions));
+  ASSERT_RAISES(Invalid,
+                HashPartition(&this->ctx_, *batch_, {"missing"}, 4, &partitions));
+
+  shared_ptr<RecordBatch> lists;
+  ASSERT_OK(ipc::MakeListRecordBatch(&lists));
+  ASSERT_RAISES(NotImplemented,
+                HashPartition(&this->ctx_, *lists, {"f0"}, 4, &partitions));
+  ASSERT_RAISES(NotImplemented,
+                HashPartition(&this->ctx_, *lists, {"f2"}, 4, &partitions));
+}
+
+// ----------------------------------------------------------------------
+// Aggregate tests
+
+class TestAggregate : public ComputeFixture, public TestBase {};
+
+template <typename Type>
+class TestAggregatePrimitive : public ComputeFixture, public TestBase {};
+
+typedef ::testing::Types<Int8Type, UInt8Type, Int16Type, UInt16Type, Int32Type,
+                         UInt32Type, Int64Type, UInt64Type, FloatType, DoubleType>
+    NumericTypes;
+
+TYPED_TEST_CASE(TestAggregatePrimitive, NumericTypes);
+
+// Check the reductions of values against a naive computation
+template <typename Type>
+void CheckReductions(FunctionContext* ctx, const Datum& values,
+                     const vector<shared_ptr<Array>>& arrays) {
+  using T = typename Type::c_type;
+  using SumType = typename std::conditional<
+      std::is_floating_point<T>::value, DoubleType,
+      typename std::conditional<std::is_signed<T>::value, Int64Type,
+                                UInt64Type>::type>::type;
+  using SumCType = typename SumType::c_type;
+
+  SumCType ex_sum = 0;
+  int64_t ex_count = 0;
+  T ex_min = std::numeric_limits<T>::max();
+  T ex_max = std::numeric_limits<T>::lowest();
+  for (const auto& array : arrays) {
+    const auto& typed = static_cast<const NumericArray<Type>&>(*array);
+    for (int64_t i = 0; i < typed.length(); ++i) {
+      if (typed.IsValid(i)) {
+        const T value = typed.Value(i);
+        ex_sum += static_cast<SumCType>(value);
+        ex_min = std::min(ex_min, value);
+        ex_max = std::max(ex_max, value);
+        ++ex_count;
+      }
+    }
+  }
+
+  Datum count_out, sum_out, mean_out, min_out, max_out;
+  ASSERT_OK(Count(ctx, values, &count_out));
+  ASSERT_EQ(Datum::SCALAR, count_out.kind());
+  const auto& count = static_cast<const PrimitiveScalar<Int64Type>&>(*count_out.scalar());
+  ASSERT_EQ(ex_count, count.value);
+
+  ASSERT_OK(Sum(ctx, values, &sum_out));
+  ASSERT_TRUE(sum_out.type()->Equals(*TypeTraits<SumType>::type_singleton()));
+  const auto& sum = static_cast<const PrimitiveScalar<SumType>&>(*sum_out.scalar());
+  ASSERT_EQ(ex_count > 0, sum.is_valid);
+  ASSERT_OK(Mean(ctx, values, &mean_out));
+  const auto& mean = static_cast<const PrimitiveScalar<DoubleType>&>(*mean_out.scalar());
+  ASSERT_EQ(ex_count > 0, mean.is_valid);
+  ASSERT_OK(Min(ctx, values, &min_out));
+  ASSERT_TRUE(min_out.type()->Equals(*TypeTraits<Type>::type_singleton()));
+  const auto& min = static_cast<const PrimitiveScalar<Type>&>(*min_out.scalar());
+  ASSERT_EQ(ex_count > 0, min.is_valid);
+  ASSERT_OK(Max(ctx, values, &max_out));
+  const auto& max = static_cast<const PrimitiveScalar<Type>&>(*max_out.scalar());
+  ASSERT_EQ(ex_count > 0, max.is_valid);
+  if (ex_count == 0) {
+    return;
+  }
+
+  if (std::is_floating_point<T>::value) {
+    ASSERT_DOUBLE_EQ(static_cast<double>(ex_sum), static_cast<double>(sum.value));
+  } else {
+    ASSERT_EQ(ex_sum, sum.value);
+  }
+  ASSERT_DOUBLE_EQ(static_cast<double>(ex_sum) / static_cast<double>(ex_count),
+                   mean.value);
+  ASSERT_EQ(ex_min, min.value);
+  ASSERT_EQ(ex_max, max.value);
+}
+
+TYPED_TEST(TestAggregatePrimitive, Reductions) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+
+  // Runs of valid values and nulls spanning several bitmap words
+  const int64_t length = 1000;
+  vector<T> values;
+  vector<bool> is_valid;
+  for (int64_t i = 0; i < length; ++i) {
+    values.push_back(static_cast<T>((i * 37) % 101));
+    is_valid.push_back((i < 200) || (i >= 300 && i < 301) || (i >= 400 && i % 3 != 0));
+  }
+  auto array = _MakeArray<TypeParam, T>(type, values, is_valid);
+  auto no_nulls = _MakeArray<TypeParam, T>(type, values, {});
+
+  for (int64_t offset : {0, 1, 7, 67, 299}) {
+    auto sliced = array->Slice(offset);
+    CheckReductions<TypeParam>(&this->ctx_, Datum(sliced), {sliced});
+    auto sliced_no_nulls = no_nulls->Slice(offset, 250);
+    CheckReductions<TypeParam>(&this->ctx_, Datum(sliced_no_nulls), {sliced_no_nulls});
+  }
+
+  // Empty and all-null inputs reduce to null, with a zero count
+  auto empty = array->Slice(0, 0);
+  CheckReductions<TypeParam>(&this->ctx_, Datum(empty), {empty});
+  auto all_null = array->Slice(300 + 1, 99);
+  CheckReductions<TypeParam>(&this->ctx_, Datum(all_null), {all_null});
+
+  // Chunked arrays, reduced serially and in parallel
+  ArrayVector chunks = {array->Slice(0, 150), array->Slice(150, 0),
+                        array->Slice(150, 151), array->Slice(301, 99),
+                        array->Slice(400)};
+  Datum chunked(std::make_shared<ChunkedArray>(chunks));
+  CheckReductions<TypeParam>(&this->ctx_, chunked, chunks);
+
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  CheckReductions<TypeParam>(&threaded_ctx, chunked, chunks);
+}
+
+TEST_F(TestAggregate, TemporalMinMax) {
+  auto values = _MakeArray<TimestampType, int64_t>(
+      timestamp(TimeUnit::MILLI), {5, -3, 10, 2}, {true, true, false, true});
+  Datum out;
+  ASSERT_OK(Min(&this->ctx_, Datum(values), &out));
+  ASSERT_TRUE(out.type()->Equals(*values->type()));
+  ASSERT_TRUE(out.scalar()->is_valid);
+  ASSERT_EQ(-3, static_cast<const PrimitiveScalar<TimestampType>&>(*out.scalar()).value);
+  ASSERT_OK(Max(&this->ctx_, Datum(values), &out));
+  ASSERT_EQ(5, static_cast<const PrimitiveScalar<TimestampType>&>(*out.scalar()).value);
+
+  ASSERT_RAISES(NotImplemented, Sum(&this->ctx_, Datum(values), &out));
+}
+
+TEST_F(TestAggregate, CountAnyType) {
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "", "b"},
+                                                     {true, false, true});
+  Datum out;
+  ASSERT_OK(Count(&this->ctx_, Datum(strings), &out));
+  ASSERT_EQ(2, static_cast<const PrimitiveScalar<Int64Type>&>(*out.scalar()).value);
+
+  Datum nulls(std::make_shared<NullArray>(5));
+  ASSERT_OK(Count(&this->ctx_, nulls, &out));
+  ASSERT_TRUE(out.scalar()->is_valid);
+  ASSERT_EQ(0, static_cast<const PrimitiveScalar<Int64Type>&>(*out.scalar()).value);
+}
+
+template <typename Type>
+typename Type::c_type ScalarValue(const Datum& datum) {
+  return static_cast<const PrimitiveScalar<Type>&>(*datum.scalar()).value;
+}
+
+TEST_F(TestAggregate, RunLengthEncoded) {
+  auto run_ends = _MakeArray<Int32Type, int32_t>(int32(), {1000, 1500, 4000, 4002}, {});
+  auto values = _MakeArray<Int32Type, int32_t>(int32(), {3, 0, -2, 7},
+                                               {true, false, true, true});
+  shared_ptr<Array> encoded, dense;
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values, &encoded));
+  ASSERT_OK(Cast(&this->ctx_, *encoded, int32(), CastOptions(), &dense));
+
+  // Reducing the runs gives the results of the decoded values, also for slices
+  for (const auto& range : vector<std::pair<int64_t, int64_t>>{
+           {0, 4002}, {10, 100}, {900, 700}, {1200, 2801}, {1100, 200}}) {
+    auto slice = encoded->Slice(range.first, range.second);
+    auto dense_slice = dense->Slice(range.first, range.second);
+    for (auto func : {Sum, Mean, Min, Max, Count}) {
+      Datum out, expected;
+      ASSERT_OK(func(&this->ctx_, Datum(slice), &out));
+      ASSERT_OK(func(&this->ctx_, Datum(dense_slice), &expected));
+      ASSERT_TRUE(out.type()->Equals(*expected.type()));
+      ASSERT_EQ(expected.scalar()->is_valid, out.scalar()->is_valid);
+      switch (out.type()->id()) {
+        case Type::INT32:
+          ASSERT_EQ(ScalarValue<Int32Type>(expected), ScalarValue<Int32Type>(out));
+          break;
+        case Type::INT64:
+          ASSERT_EQ(ScalarValue<Int64Type>(expected), ScalarValue<Int64Type>(out));
+          break;
+        default:
+          ASSERT_DOUBLE_EQ(ScalarValue<DoubleType>(expected),
+                           ScalarValue<DoubleType>(out));
+      }
+    }
+  }
+
+  Datum out;
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{encoded->Slice(0, 1200), encoded->Slice(1200)}));
+  ASSERT_OK(Sum(&this->ctx_, chunked, &out));
+  ASSERT_EQ(3 * 1000 - 2 * 2500 + 7 * 2, ScalarValue<Int64Type>(out));
+  ASSERT_OK(Min(&this->ctx_, chunked, &out));
+  ASSERT_TRUE(out.type()->Equals(*int32()));
+  ASSERT_EQ(-2, ScalarValue<Int32Type>(out));
+}
+
+TEST_F(TestAggregate, Decimal) {
+  auto type = decimal(10, 2);
+  auto values = _MakeArray<Decimal128Type, Decimal128>(
+      type, {12345, -5, 7, -1, 1, Decimal128("99999999")},
+      {true, true, false, true, true, true});
+
+  Datum out;
+  ASSERT_OK(Sum(&this->ctx_, Datum(values), &out));
+  ASSERT_TRUE(out.type()->Equals(*decimal(38, 2)));
+  ASSERT_EQ(Decimal128(12340 + 99999999),
+            static_cast<const Decimal128Scalar&>(*out.scalar()).value);
+
+  // The sums of chunks and runs carry across the words of the values
+  auto run_ends = _MakeArray<Int32Type, int32_t>(int32(), {3, 5}, {});
+  shared_ptr<Array> encoded;
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values->Slice(3, 2), &encoded));
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 4), encoded, values->Slice(4)}));
+  ASSERT_OK(Sum(&this->ctx_, chunked, &out));
+  ASSERT_EQ(Decimal128(12340 - 1 - 3 + 2 + 1 + 99999999),
+            static_cast<const Decimal128Scalar&>(*out.scalar()).value);
+
+  ASSERT_OK(Sum(&this->ctx_, Datum(values->Slice(2, 1)), &out));
+  ASSERT_FALSE(out.scalar()->is_valid);
+  ASSERT_RAISES(NotImplemented, Mean(&this->ctx_, Datum(values), &out));
+}
+
+TEST_F(TestAggregate, Errors) {
+  Datum out;
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a"}, {});
+  ASSERT_RAISES(NotImplemented, Sum(&this->ctx_, Datum(strings), &out));
+  ASSERT_RAISES(NotImplemented, Min(&this->ctx_, Datum(strings), &out));
+
+  Datum scalar(std::make_shared<PrimitiveScalar<Int32Type>>(1));
+  ASSERT_TRUE(scalar.type()->Equals(*int32()));
+  ASSERT_RAISES(Invalid, Sum(&this->ctx_, scalar, &out));
+  ASSERT_RAISES(Invalid, Count(&this->ctx_, Datum(), &out));
+}
+
+// ----------------------------------------------------------------------
+// Comparison tests
+
+template <typename T>
+bool NaiveCompare(CompareOperator op, const T& left, const T& right) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return left == right;
+    case CompareOperator::NOT_EQUAL:
+      return left != right;
+    case CompareOperator::GREATER:
+      return left > right;
+    case CompareOperator::GREATER_EQUAL:
+      return left >= right;
+    case CompareOperator::LESS:
+      return left < right;
+    case CompareOperator::LESS_EQUAL:
+      return left <= right;
+  }
+  return false;
+}
+
+static const vector<CompareOperator> kCompareOperators = {
+    CompareOperator::EQUAL, CompareOperator::NOT_EQUAL,     CompareOperator::GREATER,
+    CompareOperator::LESS,  CompareOperator::GREATER_EQUAL, CompareOperator::LESS_EQUAL};
+
+class TestCompare : public ComputeFixture, public TestBase {};
+
+template <typename Type>
+class TestComparePrimitive : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestComparePrimitive, NumericTypes);
+
+TYPED_TEST(TestComparePrimitive, ArraysAndScalars) {
+  using T = typename TypeParam::c_type;
+  using ArrayType = NumericArray<TypeParam>;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+
+  // Several comparison blocks, and a length that is no multiple of 8
+  const int64_t length = 2500;
+  vector<T> left_values, right_values;
+  vector<bool> left_valid, right_valid;
+  for (int64_t i = 0; i < length; ++i) {
+    left_values.push_back(static_cast<T>(i % 13));
+    right_values.push_back(static_cast<T>(i % 7 + 3));
+    left_valid.push_back(i % 11 != 0);
+    right_valid.push_back(i % 5 != 2);
+  }
+  auto left_all = _MakeArray<TypeParam, T>(type, left_values, left_valid);
+  auto right_all = _MakeArray<TypeParam, T>(type, right_values, right_valid);
+  auto right_no_nulls = _MakeArray<TypeParam, T>(type, right_values, {});
+
+  for (CompareOperator op : kCompareOperators) {
+    for (int64_t offset : {0, 3, 8}) {
+      auto left = left_all->Slice(offset, 2490);
+      const auto& typed_left = static_cast<const ArrayType&>(*left);
+      for (const auto& right_base : {right_all, right_no_nulls}) {
+        auto right = right_base->Slice(5, 2490);
+        const auto& typed_right = static_cast<const ArrayType&>(*right);
+        Datum out;
+        ASSERT_OK(
+            Compare(&this->ctx_, Datum(left), Datum(right), CompareOptions(op), &out));
+        ASSERT_EQ(Datum::ARRAY, out.kind());
+        const BooleanArray result(out.array());
+        ASSERT_EQ(left->length(), result.length());
+        for (int64_t i = 0; i < result.length(); ++i) {
+          const bool valid = typed_left.IsValid(i) && typed_right.IsValid(i);
+          ASSERT_EQ(valid, result.IsValid(i));
+          if (valid) {
+            ASSERT_EQ(NaiveCompare(op, typed_left.Value(i), typed_right.Value(i)),
+                      result.Value(i));
+          }
+        }
+      }
+
+      // The scalar can be on either side
+      const T scalar_value = static_cast<T>(6);
+      Datum scalar(std::make_shared<PrimitiveScalar<TypeParam>>(scalar_value));
+      Datum out, flipped;
+      ASSERT_OK(Compare(&this->ctx_, Datum(left), scalar, CompareOptions(op), &out));
+      ASSERT_OK(Compare(&this->ctx_, scalar, Datum(left), CompareOptions(op), &flipped));
+      const BooleanArray result(out.array());
+      const BooleanArray flipped_result(flipped.array());
+      for (int64_t i = 0; i < result.length(); ++i) {
+        ASSERT_EQ(typed_left.IsValid(i), result.IsValid(i));
+        if (typed_left.IsValid(i)) {
+          ASSERT_EQ(NaiveCompare(op, typed_left.Value(i), scalar_value),
+                    result.Value(i));
+          ASSERT_EQ(NaiveCompare(op, scalar_value, typed_left.Value(i)),
+                    flipped_result.Value(i));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestCompare, NullScalarAndChunks) {
+  auto left = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4, 5}, {});
+  auto right = _MakeArray<Int32Type, int32_t>(int32(), {5, 2, 1, 4, 0},
+                                              {true, true, true, false, true});
+  const CompareOptions options(CompareOperator::GREATER_EQUAL);
+
+  Datum out;
+  Datum null_scalar(PrimitiveScalar<Int32Type>::MakeNull());
+  ASSERT_OK(Compare(&this->ctx_, Datum(left), null_scalar, options, &out));
+  ASSERT_EQ(5, out.array()->null_count);
+
+  // Chunked arrays need not be chunked alike
+  Datum chunked_left(std::make_shared<ChunkedArray>(
+      ArrayVector{left->Slice(0, 2), left->Slice(2, 0), left->Slice(2)}));
+  Datum chunked_right(
+      std::make_shared<ChunkedArray>(ArrayVector{right->Slice(0, 3), right->Slice(3)}));
+  auto expected = _MakeArray<BooleanType, bool>(
+      boolean(), {false, true, true, false, true}, {true, true, true, false, true});
+  const ChunkedArray ex_chunked({expected});
+  ASSERT_OK(Compare(&this->ctx_, chunked_left, chunked_right, options, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ASSERT_EQ(3, out.chunked_array()->num_chunks());
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_chunked));
+
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  ASSERT_OK(Compare(&threaded_ctx, chunked_left, Datum(right), options, &out));
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_chunked));
+}
+
+TEST_F(TestCompare, Binary) {
+  auto left = _MakeArray<StringType, std::string>(utf8(), {"a", "ab", "b", "", "x"},
+                                                  {true, true, true, true, false});
+  auto right =
+      _MakeArray<StringType, std::string>(utf8(), {"a", "a", "abc", "", "x"}, {});
+  const vector<bool> is_valid = {true, true, true, true, false};
+
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, Datum(left), Datum(right),
+                    CompareOptions(CompareOperator::GREATER), &out));
+  auto expected = _MakeArray<BooleanType, bool>(
+      boolean(), {false, true, true, false, false}, is_valid);
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  ASSERT_OK(Compare(&this->ctx_, Datum(left), Datum(right),
+                    CompareOptions(CompareOperator::EQUAL), &out));
+  expected = _MakeArray<BooleanType, bool>(boolean(), {true, false, false, true, false},
+                                           is_valid);
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+}
+
+TEST_F(TestCompare, StringView) {
+  // Pairs differing in length, in prefix, past the prefix, inline or not
+  const vector<std::string> left_values = {
+      "a", "ab", "abcd", "abcdefghijklm", "abcx", "", "abcdefghijklmnop", "x"};
+  const vector<std::string> right_values = {
+      "a", "abc", "abce", "abcdefghijklm", "abcdefghijklmn", "", "abcdefghijklmnoq", "x"};
+  const vector<bool> is_valid = {true, true, true, true, true, true, true, false};
+  auto left = _MakeArray<StringViewType, std::string>(utf8_view(), left_values, is_valid);
+  auto right = _MakeArray<StringViewType, std::string>(utf8_view(), right_values, {});
+  auto left_strings = _MakeArray<StringType, std::string>(utf8(), left_values, is_valid);
+  auto right_strings = _MakeArray<StringType, std::string>(utf8(), right_values, {});
+
+  for (CompareOperator op : kCompareOperators) {
+    Datum out, expected;
+    ASSERT_OK(Compare(&this->ctx_, Datum(left_strings), Datum(right_strings),
+                      CompareOptions(op), &expected));
+    ASSERT_OK(Compare(&this->ctx_, Datum(left), Datum(right), CompareOptions(op), &out));
+    ASSERT_ARRAYS_EQUAL(*MakeArray(expected.array()), *MakeArray(out.array()));
+  }
+}
+
+TEST_F(TestCompare, Decimal) {
+  auto type = decimal(38, 2);
+  const vector<Decimal128> left_values = {12345, -5, 0, Decimal128("-1e30"), 7, 1};
+  const vector<Decimal128> right_values = {12345, 5, -1, Decimal128("-1e29"), 7, 0};
+  const vector<bool> is_valid = {true, true, true, true, false, true};
+  auto left = _MakeArray<Decimal128Type, Decimal128>(type, left_values, is_valid);
+  auto right = _MakeArray<Decimal128Type, Decimal128>(type, right_values, {});
+  const Decimal128 scalar_value(-5);
+  Datum scalar(std::make_shared<Decimal128Scalar>(scalar_value, type));
+
+  for (CompareOperator op : kCompareOperators) {
+    vector<bool> expected_values, expected_to_scalar;
+    for (size_t i = 0; i < left_values.size(); ++i) {
+      expected_values.push_back(NaiveCompare(op, left_values[i], right_values[i]));
+      expected_to_scalar.push_back(NaiveCompare(op, left_values[i], scalar_value));
+    }
+    Datum out;
+    ASSERT_OK(Compare(&this->ctx_, Datum(left), Datum(right), CompareOptions(op), &out));
+    auto expected = _MakeArray<BooleanType, bool>(boolean(), expected_values, is_valid);
+    ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+    ASSERT_OK(Compare(&this->ctx_, Datum(left->Slice(1)), scalar, CompareOptions(op),
+                      &out));
+    expected = _MakeArray<BooleanType, bool>(boolean(), expected_to_scalar, is_valid);
+    ASSERT_ARRAYS_EQUAL(*expected->Slice(1), *MakeArray(out.array()));
+  }
+
+  Datum out;
+  auto other = _MakeArray<Decimal128Type, Decimal128>(decimal(38, 3), right_values, {});
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, Datum(left), Datum(other),
+                                 CompareOptions(CompareOperator::EQUAL), &out));
+}
+
+TEST_F(TestCompare, RunLengthEncoded) {
+  auto run_ends = _MakeArray<Int32Type, int32_t>(int32(), {3, 5, 9, 10}, {});
+  auto values =
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 2, 3}, {true, false, true, true});
+  shared_ptr<Array> encoded, dense;
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values, &encoded));
+  ASSERT_OK(Cast(&this->ctx_, *encoded, int32(), CastOptions(), &dense));
+  Datum scalar(std::make_shared<PrimitiveScalar<Int32Type>>(2));
+
+  for (CompareOperator op : kCompareOperators) {
+    for (const auto& range : vector<std::pair<int64_t, int64_t>>{{0, 10}, {4, 3}}) {
+      auto slice = encoded->Slice(range.first, range.second);
+      auto dense_slice = dense->Slice(range.first, range.second);
+
+      // Comparing to a scalar keeps the runs
+      Datum out, expected, decoded;
+      ASSERT_OK(Compare(&this->ctx_, Datum(slice), scalar, CompareOptions(op), &out));
+      ASSERT_OK(Compare(&this->ctx_, Datum(dense_slice), scalar, CompareOptions(op),
+                        &expected));
+      ASSERT_TRUE(out.type()->Equals(*run_length_encoded(boolean())));
+      ASSERT_OK(ValidateArray(*MakeArray(out.array())));
+      ASSERT_OK(Cast(&this->ctx_, out, boolean(), CastOptions(), &decoded));
+      ASSERT_ARRAYS_EQUAL(*MakeArray(expected.array()), *MakeArray(decoded.array()));
+
+      // Comparing to an array decodes the runs
+      ASSERT_OK(Compare(&this->ctx_, Datum(slice), Datum(dense_slice),
+                        CompareOptions(op), &out));
+      ASSERT_OK(Compare(&this->ctx_, Datum(dense_slice), Datum(dense_slice),
+                        CompareOptions(op), &expected));
+      ASSERT_ARRAYS_EQUAL(*MakeArray(expected.array()), *MakeArray(out.array()));
+    }
+  }
+
+  Datum out;
+  Datum int64_scalar(std::make_shared<PrimitiveScalar<Int64Type>>(2));
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, Datum(encoded), int64_scalar,
+                                 CompareOptions(CompareOperator::EQUAL), &out));
+}
+
+TEST_F(TestCompare, Errors) {
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {});
+  auto longs = _MakeArray<Int64Type, int64_t>(int64(), {1, 2}, {});
+  Datum scalar(std::make_shared<PrimitiveScalar<Int32Type>>(1));
+  const CompareOptions options(CompareOperator::EQUAL);
+  Datum out;
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, Datum(ints), Datum(longs), options, &out));
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, scalar, scalar, options, &out));
+  ASSERT_RAISES(Invalid,
+                Compare(&this->ctx_, Datum(ints), Datum(ints->Slice(1)), options, &out));
+
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false}, {});
+  ASSERT_RAISES(NotImplemented,
+                Compare(&this->ctx_, Datum(bools), Datum(bools), options, &out));
+}
+
+// ----------------------------------------------------------------------
+// Arithmetic tests
+
+// Small operands, for which the results of integers promoted to int and cast
+// back wrap around like those of the kernels
+template <typename T>
+T NaiveArithmetic(ArithmeticOperator op, T left, T right) {
+  switch (op) {
+    case ArithmeticOperator::ADD:
+      return static_cast<T>(left + right);
+    case ArithmeticOperator::SUBTRACT:
+      return static_cast<T>(left - right);
+    case ArithmeticOperator::MULTIPLY:
+      return static_cast<T>(left * right);
+    case ArithmeticOperator::DIVIDE:
+      return static_cast<T>(left / right);
+  }
+  return T();
+}
+
+static const vector<ArithmeticOperator> kArithmeticOperators = {
+    ArithmeticOperator::ADD, ArithmeticOperator::SUBTRACT, ArithmeticOperator::MULTIPLY,
+    ArithmeticOperator::DIVIDE};
+
+class TestArithmetic : public ComputeFixture, public TestBase {};
+
+template <typename Type>
+class TestArithmeticPrimitive : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestArithmeticPrimitive, NumericTypes);
+
+TYPED_TEST(TestArithmeticPrimitive, ArraysAndScalars) {
+  using T = typename TypeParam::c_type;
+  using ArrayType = NumericArray<TypeParam>;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+
+  // Several blocks, and a length that is no multiple of 8
+  const int64_t length = 2500;
+  vector<T> left_values, right_values;
+  vector<bool> left_valid, right_valid;
+  for (int64_t i = 0; i < length; ++i) {
+    left_values.push_back(static_cast<T>(i % 13));
+    right_values.push_back(static_cast<T>(i % 7 + 3));
+    left_valid.push_back(i % 11 != 0);
+    right_valid.push_back(i % 5 != 2);
+  }
+  auto left_all = _MakeArray<TypeParam, T>(type, left_values, left_valid);
+  auto right_all = _MakeArray<TypeParam, T>(type, right_values, right_valid);
+  auto right_no_nulls = _MakeArray<TypeParam, T>(type, right_values, {});
+
+  for (ArithmeticOperator op : kArithmeticOperators) {
+    for (bool check_overflow : {false, true}) {
+      const ArithmeticOptions options(op, check_overflow);
+      if (check_overflow && op == ArithmeticOperator::SUBTRACT &&
+          std::is_unsigned<T>::value) {
+        // Smaller values are subtracted from larger ones
+        Datum out;
+        ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(left_all),
+                                          Datum(right_no_nulls), options, &out));
+        continue;
+      }
+      for (int64_t offset : {0, 3, 8}) {
+        auto left = left_all->Slice(offset, 2490);
+        const auto& typed_left = static_cast<const ArrayType&>(*left);
+        for (const auto& right_base : {right_all, right_no_nulls}) {
+          auto right = right_base->Slice(5, 2490);
+          const auto& typed_right = static_cast<const ArrayType&>(*right);
+          Datum out;
+          ASSERT_OK(Arithmetic(&this->ctx_, Datum(left), Datum(right), options, &out));
+          ASSERT_EQ(Datum::ARRAY, out.kind());
+          ASSERT_TRUE(out.type()->Equals(*type));
+          const ArrayType result(out.array());
+          ASSERT_EQ(left->length(), result.length());
+          for (int64_t i = 0; i < result.length(); ++i) {
+            const bool valid = typed_left.IsValid(i) && typed_right.IsValid(i);
+            ASSERT_EQ(valid, result.IsValid(i));
+            if (valid) {
+              ASSERT_EQ(NaiveArithmetic(op, typed_left.Value(i), typed_right.Value(i)),
+                        result.Value(i));
+            }
+          }
+        }
+
+        // The scalar can be on either side
+        const T scalar_value = static_cast<T>(6);
+        Datum scalar(std::make_shared<PrimitiveScalar<TypeParam>>(scalar_value));
+        auto divisors = right_all->Slice(offset, 2490);
+        const auto& typed_divisors = static_cast<const ArrayType&>(*divisors);
+        Datum out, flipped;
+        ASSERT_OK(Arithmetic(&this->ctx_, Datum(left), scalar, options, &out));
+        ASSERT_OK(Arithmetic(&this->ctx_, scalar, Datum(divisors), options, &flipped));
+        const ArrayType result(out.array());
+        const ArrayType flipped_result(flipped.array());
+        for (int64_t i = 0; i < result.length(); ++i) {
+          ASSERT_EQ(typed_left.IsValid(i), result.IsValid(i));
+          if (typed_left.IsValid(i)) {
+            ASSERT_EQ(NaiveArithmetic(op, typed_left.Value(i), scalar_value),
+                      result.Value(i));
+          }
+          ASSERT_EQ(typed_divisors.IsValid(i), flipped_result.IsValid(i));
+          if (typed_divisors.IsValid(i)) {
+            ASSERT_EQ(NaiveArithmetic(op, scalar_value, typed_divisors.Value(i)),
+                      flipped_result.Value(i));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestArithmetic, Overflow) {
+  const int32_t max32 = std::numeric_limits<int32_t>::max();
+  const int32_t min32 = std::numeric_limits<int32_t>::min();
+  auto left = _MakeArray<Int32Type, int32_t>(int32(), {1, max32, min32, 5}, {});
+  auto right = _MakeArray<Int32Type, int32_t>(int32(), {2, 1, 1, -3},
+                                              {true, true, false, true});
+  const ArithmeticOperator add = ArithmeticOperator::ADD;
+  const ArithmeticOperator subtract = ArithmeticOperator::SUBTRACT;
+  const ArithmeticOperator multiply = ArithmeticOperator::MULTIPLY;
+
+  // Unchecked results wrap around
+  Datum out;
+  ASSERT_OK(Arithmetic(&this->ctx_, Datum(left), Datum(right), ArithmeticOptions(add),
+                       &out));
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {3, min32, 0, 2},
+                                                 {true, true, false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(left), Datum(right),
+                                    ArithmeticOptions(add, true), &out));
+
+  // Overflows of null slots are ignored
+  ASSERT_OK(Arithmetic(&this->ctx_, Datum(left->Slice(2)), Datum(right->Slice(2)),
+                       ArithmeticOptions(subtract, true), &out));
+  expected = _MakeArray<Int32Type, int32_t>(int32(), {0, 8}, {false, true});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  // Unsigned underflow, and multiplications of the widest integers
+  auto small = _MakeArray<UInt8Type, uint8_t>(uint8(), {1, 200}, {});
+  auto big = _MakeArray<UInt8Type, uint8_t>(uint8(), {2, 100}, {});
+  ASSERT_OK(Arithmetic(&this->ctx_, Datum(small), Datum(big),
+                       ArithmeticOptions(subtract), &out));
+  auto expected_small = _MakeArray<UInt8Type, uint8_t>(uint8(), {255, 100}, {});
+  ASSERT_ARRAYS_EQUAL(*expected_small, *MakeArray(out.array()));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(small), Datum(big),
+                                    ArithmeticOptions(subtract, true), &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(small), Datum(big),
+                                    ArithmeticOptions(multiply, true), &out));
+
+  const int64_t max64 = std::numeric_limits<int64_t>::max();
+  auto longs = _MakeArray<Int64Type, int64_t>(int64(), {-4, max64 / 2, 3}, {});
+  Datum two(std::make_shared<PrimitiveScalar<Int64Type>>(2));
+  ASSERT_OK(Arithmetic(&this->ctx_, Datum(longs), two, ArithmeticOptions(multiply, true),
+                       &out));
+  auto expected_longs =
+      _MakeArray<Int64Type, int64_t>(int64(), {-8, max64 - 1, 6}, {});
+  ASSERT_ARRAYS_EQUAL(*expected_longs, *MakeArray(out.array()));
+  Datum three(std::make_shared<PrimitiveScalar<Int64Type>>(3));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(longs), three,
+                                    ArithmeticOptions(multiply, true), &out));
+}
+
+TEST_F(TestArithmetic, Division) {
+  const int16_t min16 = std::numeric_limits<int16_t>::min();
+  auto left = _MakeArray<Int16Type, int16_t>(int16(), {7, -7, min16, 1}, {});
+  auto right = _MakeArray<Int16Type, int16_t>(int16(), {2, 2, -1, 0},
+                                              {true, true, true, false});
+  const ArithmeticOperator divide = ArithmeticOperator::DIVIDE;
+
+  // Truncated towards zero, and dividing null slots by zero is fine
+  Datum out;
+  ASSERT_OK(Arithmetic(&this->ctx_, Datum(left), Datum(right),
+                       ArithmeticOptions(divide), &out));
+  auto expected = _MakeArray<Int16Type, int16_t>(int16(), {3, -3, min16, 0},
+                                                 {true, true, true, false});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(left), Datum(right),
+                                    ArithmeticOptions(divide, true), &out));
+
+  Datum zero(std::make_shared<PrimitiveScalar<Int16Type>>(0));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(left), zero,
+                                    ArithmeticOptions(divide), &out));
+
+  // Floating point division by zero is infinite
+  auto doubles = _MakeArray<DoubleType, double>(float64(), {1.5, -3}, {});
+  Datum zero_double(std::make_shared<PrimitiveScalar<DoubleType>>(0));
+  ASSERT_OK(Arithmetic(&this->ctx_, Datum(doubles), zero_double,
+                       ArithmeticOptions(divide, true), &out));
+  auto expected_doubles = _MakeArray<DoubleType, double>(
+      float64(), {std::numeric_limits<double>::infinity(),
+                  -std::numeric_limits<double>::infinity()},
+      {});
+  ASSERT_ARRAYS_EQUAL(*expected_doubles, *MakeArray(out.array()));
+}
+
+TEST_F(TestArithmetic, NullScalarAndChunks) {
+  auto left = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4, 5}, {});
+  auto right = _MakeArray<Int32Type, int32_t>(int32(), {5, 2, 1, 4, 0},
+                                              {true, true, true, false, true});
+  const ArithmeticOptions options(ArithmeticOperator::SUBTRACT);
+
+  Datum out;
+  Datum null_scalar(PrimitiveScalar<Int32Type>::MakeNull());
+  ASSERT_OK(Arithmetic(&this->ctx_, null_scalar, Datum(left), options, &out));
+  ASSERT_EQ(5, out.array()->null_count);
+
+  // Chunked arrays need not be chunked alike
+  Datum chunked_left(std::make_shared<ChunkedArray>(
+      ArrayVector{left->Slice(0, 2), left->Slice(2, 0), left->Slice(2)}));
+  Datum chunked_right(
+      std::make_shared<ChunkedArray>(ArrayVector{right->Slice(0, 3), right->Slice(3)}));
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {-4, 0, 2, 0, 5},
+                                                 {true, true, true, false, true});
+  const ChunkedArray ex_chunked({expected});
+  ASSERT_OK(Arithmetic(&this->ctx_, chunked_left, chunked_right, options, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  ASSERT_EQ(3, out.chunked_array()->num_chunks());
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_chunked));
+
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  ASSERT_OK(Arithmetic(&threaded_ctx, chunked_left, Datum(right), options, &out));
+  ASSERT_TRUE(out.chunked_array()->Equals(ex_chunked));
+}
+
+TEST_F(TestArithmetic, Errors) {
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {});
+  auto longs = _MakeArray<Int64Type, int64_t>(int64(), {1, 2}, {});
+  Datum scalar(std::make_shared<PrimitiveScalar<Int32Type>>(1));
+  const ArithmeticOptions options(ArithmeticOperator::ADD);
+  Datum out;
+  ASSERT_RAISES(Invalid,
+                Arithmetic(&this->ctx_, Datum(ints), Datum(longs), options, &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, scalar, scalar, options, &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, Datum(ints), Datum(ints->Slice(1)),
+                                    options, &out));
+
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false}, {});
+  ASSERT_RAISES(NotImplemented,
+                Arithmetic(&this->ctx_, Datum(bools), Datum(bools), options, &out));
+}
+
+// ----------------------------------------------------------------------
+// Temporal tests
+
+class TestTemporal : public ComputeFixture, public TestBase {
+ public:
+  void CheckExtract(const shared_ptr<Array>& values, TemporalComponent component,
+                    const vector<int32_t>& expected, const vector<bool>& is_valid) {
+    Datum out;
+    ASSERT_OK(ExtractTemporal(&this->ctx_, Datum(values), component, &out));
+    auto ex_array = _MakeArray<Int32Type, int32_t>(int32(), expected, is_valid);
+    ASSERT_ARRAYS_EQUAL(*ex_array, *MakeArray(out.array()));
+  }
+
+  void CheckTruncate(const shared_ptr<Array>& values, TemporalUnit unit,
+                     const shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(TruncateTemporal(&this->ctx_, Datum(values), unit, &out));
+    ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+  }
+};
+
+TEST_F(TestTemporal, Extract) {
+  // 1970-01-01T00:00:00, 2000-02-29T01:02:03 and 1969-12-31T23:59:59
+  const vector<int64_t> seconds = {0, 951786123, -1, 0};
+  const vector<bool> is_valid = {true, true, true, false};
+  auto values = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::SECOND), seconds,
+                                                   is_valid);
+  CheckExtract(values, TemporalComponent::YEAR, {1970, 2000, 1969, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::MONTH, {1, 2, 12, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::DAY, {1, 29, 31, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::DAY_OF_WEEK, {3, 1, 2, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::DAY_OF_YEAR, {1, 60, 365, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::HOUR, {0, 1, 23, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::MINUTE, {0, 2, 59, 0}, is_valid);
+  CheckExtract(values, TemporalComponent::SECOND, {0, 3, 59, 0}, is_valid);
+
+  vector<int64_t> nanos;
+  for (int64_t value : seconds) {
+    nanos.push_back(value * 1000000000 + 999);
+  }
+  values = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::NANO), nanos, {});
+  CheckExtract(values, TemporalComponent::DAY, {1, 29, 31, 1}, {});
+  CheckExtract(values, TemporalComponent::SECOND, {0, 3, 59, 0}, {});
+
+  auto dates = _MakeArray<Date32Type, int32_t>(date32(), {0, 11016, -1}, {});
+  CheckExtract(dates, TemporalComponent::YEAR, {1970, 2000, 1969}, {});
+  CheckExtract(dates, TemporalComponent::DAY_OF_YEAR, {1, 60, 365}, {});
+  CheckExtract(dates, TemporalComponent::HOUR, {0, 0, 0}, {});
+  dates = _MakeArray<Date64Type, int64_t>(date64(), {951782400000, -86400000}, {});
+  CheckExtract(dates, TemporalComponent::MONTH, {2, 12}, {});
+
+  // Chunks are processed in parallel
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 1), values->Slice(1, 0), values->Slice(1)}));
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  Datum out;
+  ASSERT_OK(ExtractTemporal(&threaded_ctx, chunked, TemporalComponent::MONTH, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto ex_months = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 12, 1}, {});
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({ex_months})));
+
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1}, {});
+  ASSERT_RAISES(NotImplemented,
+                ExtractTemporal(&this->ctx_, Datum(ints), TemporalComponent::DAY, &out));
+}
+
+TEST_F(TestTemporal, Truncate) {
+  // 2000-02-29T01:02:03 and 1969-12-31T23:59:59
+  auto type = timestamp(TimeUnit::SECOND);
+  auto values = _MakeArray<TimestampType, int64_t>(type, {951786123, -1, 0},
+                                                   {true, true, false});
+  auto expect = [&type](const vector<int64_t>& expected) {
+    return _MakeArray<TimestampType, int64_t>(type, expected, {true, true, false});
+  };
+  CheckTruncate(values, TemporalUnit::YEAR, expect({946684800, -31536000, 0}));
+  CheckTruncate(values, TemporalUnit::MONTH, expect({949363200, -2678400, 0}));
+  CheckTruncate(values, TemporalUnit::WEEK, expect({951696000, -259200, 0}));
+  CheckTruncate(values, TemporalUnit::DAY, expect({951782400, -86400, 0}));
+  CheckTruncate(values, TemporalUnit::HOUR, expect({951786000, -3600, 0}));
+  CheckTruncate(values, TemporalUnit::MINUTE, expect({951786120, -60, 0}));
+  CheckTruncate(values, TemporalUnit::SECOND, values);
+
+  auto dates = _MakeArray<Date32Type, int32_t>(date32(), {11016, -1}, {});
+  CheckTruncate(dates, TemporalUnit::MONTH,
+                _MakeArray<Date32Type, int32_t>(date32(), {10988, -31}, {}));
+  CheckTruncate(dates, TemporalUnit::HOUR, dates);
+}
+
+TEST_F(TestTemporal, ToLocalTime) {
+  auto type = timestamp(TimeUnit::MILLI, "+05:30");
+  auto values = _MakeArray<TimestampType, int64_t>(type, {0, 1000}, {});
+  Datum out;
+  ASSERT_OK(ToLocalTime(&this->ctx_, Datum(values), "", &out));
+  auto expected = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::MILLI),
+                                                     {19800000, 19801000}, {});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+  ASSERT_OK(ToLocalTime(&this->ctx_, Datum(values), "-0100", &out));
+  auto shifted = std::static_pointer_cast<TimestampArray>(MakeArray(out.array()));
+  ASSERT_EQ(-3599000, shifted->Value(1));
+
+  auto naive = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), {0}, {});
+  ASSERT_RAISES(Invalid, ToLocalTime(&this->ctx_, Datum(naive), "", &out));
+  ASSERT_RAISES(Invalid, ToLocalTime(&this->ctx_, Datum(naive), "../UTC", &out));
+  ASSERT_RAISES(KeyError,
+                ToLocalTime(&this->ctx_, Datum(naive), "Nowhere/Atlantis", &out));
+
+  if (std::getenv("TZDIR") != nullptr ||
+      !std::ifstream("/usr/share/zoneinfo/America/New_York")) {
+    // No tz database to test with
+    return;
+  }
+  // January and July 2020, the start of daylight saving time on 2020-03-08,
+  // and July 2050, covered by the recurring rule of the zone
+  const vector<int64_t> seconds = {1577880000, 1593604800, 1583650799, 1583650800,
+                                   2540246400};
+  const vector<int64_t> offsets = {-5, -4, -5, -4, -4};
+  vector<int64_t> utc, local;
+  for (size_t i = 0; i < seconds.size(); ++i) {
+    utc.push_back(seconds[i] * 1000);
+    local.push_back((seconds[i] + offsets[i] * 3600) * 1000);
+  }
+  values = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), utc, {});
+  expected = _MakeArray<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), local, {});
+  // Chunks within a single period of the zone, and spanning several
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 1), values->Slice(1, 1), values->Slice(2)}));
+  ASSERT_OK(ToLocalTime(&this->ctx_, chunked, "America/New_York", &out));
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+}
+
+// ----------------------------------------------------------------------
+// Window tests
+
+class TestWindow : public ComputeFixture, public TestBase {
+ public:
+  void CheckWindow(const WindowOptions& options, const Datum& values,
+                   const shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(Window(&this->ctx_, values, options, &out));
+    if (out.kind() == Datum::ARRAY) {
+      ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+    } else {
+      ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+    }
+  }
+};
+
+TEST_F(TestWindow, Cumulative) {
+  auto values = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 0, 3, -4},
+                                               {true, true, false, true, true});
+  WindowOptions options(WindowFunction::CUMULATIVE_SUM);
+  CheckWindow(options, Datum(values),
+              _MakeArray<Int64Type, int64_t>(int64(), {1, 3, 0, 6, 2},
+                                             {true, true, false, true, true}));
+  options.function = WindowFunction::CUMULATIVE_PRODUCT;
+  CheckWindow(options, Datum(values),
+              _MakeArray<Int64Type, int64_t>(int64(), {1, 2, 0, 6, -24},
+                                             {true, true, false, true, true}));
+
+  // State is carried across chunks
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 2), values->Slice(2, 0), values->Slice(2)}));
+  Datum out;
+  ASSERT_OK(Window(&this->ctx_, chunked, options, &out));
+  ASSERT_EQ(3, out.chunked_array()->num_chunks());
+  ASSERT_TRUE(out.chunked_array()->Equals(
+      ChunkedArray({_MakeArray<Int64Type, int64_t>(int64(), {1, 2, 0, 6, -24},
+                                                   {true, true, false, true, true})})));
+
+  options.function = WindowFunction::CUMULATIVE_SUM;
+  auto doubles = _MakeArray<DoubleType, double>(float64(), {0.5, 1.5}, {});
+  CheckWindow(options, Datum(doubles),
+              _MakeArray<DoubleType, double>(float64(), {0.5, 2}, {}));
+}
+
+TEST_F(TestWindow, Rolling) {
+  auto values = _MakeArray<Int64Type, int64_t>(int64(), {4, 1, 0, 3, 5, 2},
+                                               {true, true, false, true, true, true});
+  WindowOptions options(WindowFunction::ROLLING_SUM);
+  options.window_size = 3;
+  options.min_periods = 2;
+  CheckWindow(options, Datum(values),
+              _MakeArray<Int64Type, int64_t>(int64(), {0, 5, 5, 4, 8, 10},
+                                             {false, true, true, true, true, true}));
+  options.function = WindowFunction::ROLLING_MEAN;
+  CheckWindow(options, Datum(values),
+              _MakeArray<DoubleType, double>(float64(), {0, 2.5, 2.5, 2, 4, 10. / 3},
+                                             {false, true, true, true, true, true}));
+  options.function = WindowFunction::ROLLING_MIN;
+  options.min_periods = 1;
+  CheckWindow(options, Datum(values),
+              _MakeArray<Int64Type, int64_t>(int64(), {4, 1, 1, 1, 3, 2}, {}));
+
+  // Windows span chunks
+  options.function = WindowFunction::ROLLING_MAX;
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 1), values->Slice(1, 3), values->Slice(4)}));
+  CheckWindow(options, chunked,
+              _MakeArray<Int64Type, int64_t>(int64(), {4, 4, 4, 3, 5, 5}, {}));
+
+  // Infinities leave the sums they entered
+  auto doubles = _MakeArray<DoubleType, double>(
+      float64(), {1, std::numeric_limits<double>::infinity(), 2, 3}, {});
+  options.function = WindowFunction::ROLLING_SUM;
+  options.window_size = 2;
+  CheckWindow(options, Datum(doubles),
+              _MakeArray<DoubleType, double>(
+                  float64(),
+                  {1, std::numeric_limits<double>::infinity(),
+                   std::numeric_limits<double>::infinity(), 5},
+                  {}));
+}
+
+TEST_F(TestWindow, TimeWindows) {
+  // Windows of 10 seconds over irregular times
+  auto type = timestamp(TimeUnit::SECOND);
+  auto times = _MakeArray<TimestampType, int64_t>(type, {0, 5, 9, 10, 30, 30}, {});
+  auto values = _MakeArray<DoubleType, double>(float64(), {1, 2, 3, 4, 5, 6}, {});
+  WindowOptions options(WindowFunction::ROLLING_SUM);
+  options.time_window = 10;
+  Datum out;
+  ASSERT_OK(Window(&this->ctx_, Datum(values), Datum(times), options, &out));
+  auto expected = _MakeArray<DoubleType, double>(float64(), {1, 3, 6, 9, 5, 11}, {});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+
+  // Chunks of values and times need not match
+  Datum chunked_values(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 4), values->Slice(4)}));
+  Datum chunked_times(std::make_shared<ChunkedArray>(
+      ArrayVector{times->Slice(0, 1), times->Slice(1, 0), times->Slice(1)}));
+  ASSERT_OK(Window(&this->ctx_, chunked_values, chunked_times, options, &out));
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+
+  // Incrementally, as batches are read
+  options.function = WindowFunction::ROLLING_MAX;
+  std::unique_ptr<WindowKernel> kernel;
+  ASSERT_OK(GetWindowKernel(&this->ctx_, float64(), options, &kernel));
+  shared_ptr<Array> piece;
+  ASSERT_OK(kernel->Append(&this->ctx_, *values->Slice(0, 3), times->Slice(0, 3).get(),
+                           &piece));
+  ASSERT_OK(kernel->Append(&this->ctx_, *values->Slice(3), times->Slice(3).get(),
+                           &piece));
+  auto ex_maxima = _MakeArray<DoubleType, double>(float64(), {4, 5, 6}, {});
+  ASSERT_ARRAYS_EQUAL(*ex_maxima, *piece);
+  ASSERT_RAISES(Invalid, kernel->Append(&this->ctx_, *values->Slice(0, 1),
+                                        times->Slice(0, 1).get(), &piece));
+  ASSERT_RAISES(Invalid, kernel->Append(&this->ctx_, *values, nullptr, &piece));
+  ASSERT_OK(kernel->Finish(&this->ctx_, &piece));
+  ASSERT_EQ(0, piece->length());
+  ASSERT_OK(kernel->Append(&this->ctx_, *values->Slice(0, 1), times->Slice(0, 1).get(),
+                           &piece));
+}
+
+TEST_F(TestWindow, Shift) {
+  auto type = timestamp(TimeUnit::MILLI);
+  auto values = _MakeArray<TimestampType, int64_t>(type, {1, 2, 0, 4},
+                                                   {true, true, false, true});
+  WindowOptions options(WindowFunction::SHIFT);
+  options.periods = 1;
+  CheckWindow(options, Datum(values),
+              _MakeArray<TimestampType, int64_t>(type, {0, 1, 2, 0},
+                                                 {false, true, true, false}));
+  options.periods = -2;
+  CheckWindow(options, Datum(values),
+              _MakeArray<TimestampType, int64_t>(type, {0, 4, 0, 0},
+                                                 {false, true, false, false}));
+
+  // Leads hold rows back until the next chunk or the end
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 1), values->Slice(1)}));
+  Datum out;
+  ASSERT_OK(Window(&this->ctx_, chunked, options, &out));
+  ASSERT_EQ(3, out.chunked_array()->num_chunks());
+  ASSERT_EQ(0, out.chunked_array()->chunk(0)->length());
+  ASSERT_TRUE(out.chunked_array()->Equals(
+      ChunkedArray({_MakeArray<TimestampType, int64_t>(type, {0, 4, 0, 0},
+                                                       {false, true, false, false})})));
+
+  options.periods = 0;
+  CheckWindow(options, Datum(values), values);
+}
+
+TEST_F(TestWindow, Errors) {
+  std::unique_ptr<WindowKernel> kernel;
+  WindowOptions options(WindowFunction::ROLLING_SUM);
+  options.window_size = 0;
+  ASSERT_RAISES(Invalid, GetWindowKernel(&this->ctx_, int32(), options, &kernel));
+  options.window_size = 2;
+  ASSERT_RAISES(NotImplemented, GetWindowKernel(&this->ctx_, date32(), options, &kernel));
+  ASSERT_RAISES(NotImplemented, GetWindowKernel(&this->ctx_, utf8(), options, &kernel));
+
+  ASSERT_OK(GetWindowKernel(&this->ctx_, int32(), options, &kernel));
+  shared_ptr<Array> piece;
+  auto doubles = _MakeArray<DoubleType, double>(float64(), {1}, {});
+  ASSERT_RAISES(Invalid, kernel->Append(&this->ctx_, *doubles, nullptr, &piece));
+}
+
+// ----------------------------------------------------------------------
+// Filter tests
+
+class TestFilter : public ComputeFixture, public TestBase {
+ public:
+  void CheckFilter(const shared_ptr<Array>& values, const shared_ptr<Array>& filter,
+                   const shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(Filter(&this->ctx_, Datum(values), Datum(filter), &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    auto result = MakeArray(out.array());
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+};
+
+TEST_F(TestFilter, Primitive) {
+  // Runs of selected values spanning several bitmap words
+  const int64_t length = 300;
+  vector<int32_t> values, ex_values;
+  vector<bool> is_valid, selected, filter_valid, ex_valid;
+  for (int64_t i = 0; i < length; ++i) {
+    values.push_back(static_cast<int32_t>(i));
+    is_valid.push_back(i % 9 != 4);
+    selected.push_back(i < 70 || (i >= 130 && i % 3 == 0));
+    filter_valid.push_back(i % 17 != 1);
+  }
+  for (int64_t i = 7; i < length; ++i) {
+    if (selected[i - 7] && filter_valid[i - 7]) {
+      ex_values.push_back(values[i]);
+      ex_valid.push_back(is_valid[i]);
+    }
+  }
+  auto array = _MakeArray<Int32Type, int32_t>(int32(), values, is_valid);
+  auto filter = _MakeArray<BooleanType, bool>(boolean(), selected, filter_valid);
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), ex_values, ex_valid);
+  CheckFilter(array->Slice(7), filter->Slice(0, length - 7), expected);
+
+  // Selecting everything is zero-copy
+  auto all = _MakeArray<BooleanType, bool>(boolean(), vector<bool>(length, true), {});
+  Datum out;
+  ASSERT_OK(Filter(&this->ctx_, Datum(array), Datum(all), &out));
+  ASSERT_EQ(array->data()->buffers[1], out.array()->buffers[1]);
+
+  auto none = _MakeArray<BooleanType, bool>(boolean(), vector<bool>(length, false), {});
+  CheckFilter(array, none, array->Slice(0, 0));
+}
+
+TEST_F(TestFilter, OtherTypes) {
+  auto filter = _MakeArray<BooleanType, bool>(boolean(), {true, false, true, true, false},
+                                              {true, true, true, false, true});
+
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, true, false, true, false},
+                                             {true, true, false, true, true});
+  CheckFilter(bools, filter,
+              _MakeArray<BooleanType, bool>(boolean(), {true, false}, {true, false}));
+
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "bc", "", "def", "g"},
+                                                     {true, true, false, true, true});
+  CheckFilter(strings, filter,
+              _MakeArray<StringType, std::string>(utf8(), {"a", ""}, {true, false}));
+  CheckFilter(strings->Slice(1, 2), filter->Slice(1, 2),
+              _MakeArray<StringType, std::string>(utf8(), {""}, {false}));
+
+  auto fixed = _MakeArray<FixedSizeBinaryType, std::string>(
+      fixed_size_binary(2), {"aa", "bb", "cc", "dd", "ee"}, {});
+  CheckFilter(fixed, filter,
+              _MakeArray<FixedSizeBinaryType, std::string>(fixed_size_binary(2),
+                                                           {"aa", "cc"}, {}));
+
+  CheckFilter(std::make_shared<NullArray>(5), filter, std::make_shared<NullArray>(2));
+
+  auto dict_type =
+      dictionary(int8(), _MakeArray<StringType, std::string>(utf8(), {"x", "y"}, {}));
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 1, 1, 0, 0}, {});
+  auto ex_indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 1}, {});
+  CheckFilter(std::make_shared<DictionaryArray>(dict_type, indices), filter,
+              std::make_shared<DictionaryArray>(dict_type, ex_indices));
+
+  auto offsets = _MakeArray<Int32Type, int32_t>(int32(), {0, 1, 2, 3, 4, 5}, {});
+  shared_ptr<Array> lists;
+  ASSERT_OK(ListArray::FromArrays(*offsets, *indices, this->ctx_.memory_pool(), &lists));
+  Datum out;
+  ASSERT_RAISES(NotImplemented, Filter(&this->ctx_, Datum(lists), Datum(filter), &out));
+}
+
+TEST_F(TestFilter, DenseUnion) {
+  auto values = _MakeDenseUnion<Int32Type>(int32(), {0, 1, -1, 0, 1, 0, 0},
+                                           {1, 2, 3, 4}, {"a", "bc"});
+  auto filter = _MakeArray<BooleanType, bool>(
+      boolean(), {true, false, true, false, true, true, false}, {});
+  CheckFilter(values, filter,
+              _MakeDenseUnion<Int32Type>(int32(), {0, -1, 1, 0}, {1, 3}, {"bc"}));
+  CheckFilter(values->Slice(2), filter->Slice(0, 5),
+              _MakeDenseUnion<Int32Type>(int32(), {-1, 1, 0}, {4}, {"bc"}));
+}
+
+TEST_F(TestFilter, ChunkedAndRecordBatch) {
+  auto values = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4, 5, 6}, {});
+  auto filter = _MakeArray<BooleanType, bool>(
+      boolean(), {true, false, true, true, false, true}, {});
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {1, 3, 4, 6}, {});
+
+  Datum chunked_values(
+      std::make_shared<ChunkedArray>(ArrayVector{values->Slice(0, 4), values->Slice(4)}));
+  Datum chunked_filter(
+      std::make_shared<ChunkedArray>(ArrayVector{filter->Slice(0, 1), filter->Slice(1)}));
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  for (FunctionContext* ctx : {&this->ctx_, &threaded_ctx}) {
+    for (const Datum& filter_datum : {Datum(filter), chunked_filter}) {
+      Datum out;
+      ASSERT_OK(Filter(ctx, chunked_values, filter_datum, &out));
+      ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+      ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+    }
+  }
+
+  auto strings =
+      _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c", "d", "e", "f"}, {});
+  auto schema = ::arrow::schema({field("i", int32()), field("s", utf8())});
+  auto batch = RecordBatch::Make(schema, 6, {values, strings});
+  Datum out;
+  ASSERT_OK(Filter(&threaded_ctx, Datum(batch), Datum(filter), &out));
+  ASSERT_EQ(Datum::RECORD_BATCH, out.kind());
+  auto ex_strings = _MakeArray<StringType, std::string>(utf8(), {"a", "c", "d", "f"}, {});
+  ASSERT_TRUE(
+      out.record_batch()->Equals(*RecordBatch::Make(schema, 4, {expected, ex_strings})));
+
+  ASSERT_RAISES(Invalid, Filter(&this->ctx_, Datum(batch), chunked_filter, &out));
+  ASSERT_RAISES(Invalid, Filter(&this->ctx_, Datum(values), Datum(values), &out));
+  ASSERT_RAISES(Invalid,
+                Filter(&this->ctx_, Datum(values->Slice(1)), Datum(filter), &out));
+}
+
+// ----------------------------------------------------------------------
+// Take tests
+
+class TestTake : public ComputeFixture, public TestBase {
+ public:
+  void CheckTake(const shared_ptr<Array>& values, const shared_ptr<Array>& indices,
+                 const shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(Take(&this->ctx_, Datum(values), Datum(indices), &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    auto result = MakeArray(out.array());
+    ASSERT_OK(ValidateArray(*result));
+    ASSERT_ARRAYS_EQUAL(*expected, *result);
+  }
+};
+
+template <typename IndexType>
+class TestTakeIndices : public TestTake {};
+
+typedef ::testing::Types<Int8Type, UInt8Type, Int16Type, UInt16Type, Int32Type,
+                         UInt32Type, Int64Type, UInt64Type>
+    IndexTypes;
+
+TYPED_TEST_CASE(TestTakeIndices, IndexTypes);
+
+TYPED_TEST(TestTakeIndices, Primitive) {
+  using c_type = typename TypeParam::c_type;
+  auto index_type = TypeTraits<TypeParam>::type_singleton();
+
+  auto values = _MakeArray<Int64Type, int64_t>(int64(), {10, 11, 12, 13, 14, 15},
+                                               {true, true, false, true, true, true});
+  auto indices = _MakeArray<TypeParam, c_type>(index_type, {5, 0, 2, 0, 1, 4},
+                                               {true, true, true, false, true, true});
+  auto expected = _MakeArray<Int64Type, int64_t>(int64(), {15, 10, 0, 0, 11, 14},
+                                                 {true, true, false, false, true, true});
+  this->CheckTake(values, indices, expected);
+
+  // Sliced values and indices
+  auto ex_sliced = _MakeArray<Int64Type, int64_t>(int64(), {11, 13, 0},
+                                                  {true, true, false});
+  this->CheckTake(values->Slice(1), indices->Slice(1, 3), ex_sliced);
+
+  // Nulls in the indices only
+  auto no_nulls = _MakeArray<Int64Type, int64_t>(int64(), {10, 11, 12, 13, 14, 15}, {});
+  auto ex_no_nulls = _MakeArray<Int64Type, int64_t>(
+      int64(), {15, 10, 12, 0, 11, 14}, {true, true, true, false, true, true});
+  this->CheckTake(no_nulls, indices, ex_no_nulls);
+
+  auto out_of_bounds = _MakeArray<TypeParam, c_type>(index_type, {0, 6}, {});
+  Datum out;
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, Datum(values), Datum(out_of_bounds), &out));
+  // ... but out of bounds values under nulls are ignored
+  auto null_index = _MakeArray<TypeParam, c_type>(index_type, {0, 6}, {true, false});
+  this->CheckTake(values, null_index,
+                  _MakeArray<Int64Type, int64_t>(int64(), {10, 0}, {true, false}));
+}
+
+TEST_F(TestTake, OtherTypes) {
+  auto indices = _MakeArray<Int32Type, int32_t>(int32(), {3, 0, 0, 2, 1},
+                                                {true, true, false, true, true});
+
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false, true, true},
+                                             {true, true, false, true});
+  CheckTake(bools, indices,
+            _MakeArray<BooleanType, bool>(boolean(), {true, true, false, false, false},
+                                          {true, true, false, false, true}));
+
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"a", "bc", "", "def"},
+                                                     {true, true, false, true});
+  CheckTake(strings, indices,
+            _MakeArray<StringType, std::string>(utf8(), {"def", "a", "", "", "bc"},
+                                                {true, true, false, false, true}));
+  auto ex_sliced =
+      _MakeArray<StringType, std::string>(utf8(), {"def", ""}, {true, false});
+  CheckTake(strings->Slice(1), indices->Slice(3), ex_sliced);
+
+  auto fixed = _MakeArray<FixedSizeBinaryType, std::string>(
+      fixed_size_binary(3), {"aaa", "bbb", "ccc", "ddd"}, {});
+  CheckTake(fixed, indices,
+            _MakeArray<FixedSizeBinaryType, std::string>(
+                fixed_size_binary(3), {"ddd", "aaa", "", "ccc", "bbb"},
+                {true, true, false, true, true}));
+
+  CheckTake(std::make_shared<NullArray>(4), indices, std::make_shared<NullArray>(5));
+
+  auto dict_type =
+      dictionary(int8(), _MakeArray<StringType, std::string>(utf8(), {"x", "y"}, {}));
+  auto dict_indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 1, 1, 0}, {});
+  auto ex_indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 0, 0, 1, 1},
+                                                 {true, true, false, true, true});
+  CheckTake(std::make_shared<DictionaryArray>(dict_type, dict_indices), indices,
+            std::make_shared<DictionaryArray>(dict_type, ex_indices));
+
+  // Taking from empty values
+  auto empty = _MakeArray<Int32Type, int32_t>(int32(), {}, {});
+  auto null_indices = _MakeArray<Int32Type, int32_t>(int32(), {0, 0}, {false, false});
+  CheckTake(empty, null_indices,
+            _MakeArray<Int32Type, int32_t>(int32(), {0, 0}, {false, false}));
+  CheckTake(empty, empty, empty);
+
+  auto offsets = _MakeArray<Int32Type, int32_t>(int32(), {0, 1, 2, 3, 4}, {});
+  shared_ptr<Array> lists;
+  ASSERT_OK(
+      ListArray::FromArrays(*offsets, *dict_indices, this->ctx_.memory_pool(), &lists));
+  Datum out;
+  ASSERT_RAISES(NotImplemented, Take(&this->ctx_, Datum(lists), Datum(indices), &out));
+}
+
+TEST_F(TestTake, DenseUnion) {
+  auto values = _MakeDenseUnion<Int32Type>(int32(), {0, 1, -1, 0, 1, 0},
+                                           {1, 2, 3}, {"a", "bc"});
+  auto indices = _MakeArray<Int32Type, int32_t>(
+      int32(), {5, 4, 2, 0, 1, 0, 4}, {true, true, true, false, true, true, true});
+  // Each child is taken in the order of its slots
+  CheckTake(values, indices,
+            _MakeDenseUnion<Int32Type>(int32(), {0, 1, -1, -1, 1, 0, 1},
+                                       {3, 1}, {"bc", "a", "bc"}));
+  auto sliced_indices =
+      _MakeArray<Int32Type, int32_t>(int32(), {1, 0, 0}, {true, false, true});
+  CheckTake(values->Slice(3), sliced_indices,
+            _MakeDenseUnion<Int32Type>(int32(), {1, -1, 0}, {2}, {"bc"}));
+
+  auto out_of_bounds = _MakeArray<Int32Type, int32_t>(int32(), {6}, {});
+  Datum out;
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, Datum(values), Datum(out_of_bounds), &out));
+}
+
+TEST_F(TestTake, ChunkedAndRecordBatch) {
+  auto values = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3, 4, 5, 6}, {});
+  auto indices = _MakeArray<Int16Type, int16_t>(int16(), {5, 1, 1, 0}, {});
+  auto expected = _MakeArray<Int32Type, int32_t>(int32(), {6, 2, 2, 1}, {});
+
+  Datum chunked_indices(std::make_shared<ChunkedArray>(
+      ArrayVector{indices->Slice(0, 1), indices->Slice(1)}));
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  for (FunctionContext* ctx : {&this->ctx_, &threaded_ctx}) {
+    Datum out;
+    ASSERT_OK(Take(ctx, Datum(values), chunked_indices, &out));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+    ASSERT_EQ(2, out.chunked_array()->num_chunks());
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({expected})));
+  }
+
+  auto strings =
+      _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c", "d", "e", "f"}, {});
+  auto schema = ::arrow::schema({field("i", int32()), field("s", utf8())});
+  auto batch = RecordBatch::Make(schema, 6, {values, strings});
+  Datum out;
+  ASSERT_OK(Take(&threaded_ctx, Datum(batch), Datum(indices), &out));
+  ASSERT_EQ(Datum::RECORD_BATCH, out.kind());
+  auto ex_strings = _MakeArray<StringType, std::string>(utf8(), {"f", "b", "b", "a"}, {});
+  ASSERT_TRUE(
+      out.record_batch()->Equals(*RecordBatch::Make(schema, 4, {expected, ex_strings})));
+
+  auto negative = _MakeArray<Int16Type, int16_t>(int16(), {0, -1}, {});
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, Datum(batch), Datum(negative), &out));
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, Datum(batch), chunked_indices, &out));
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, Datum(values), Datum(strings), &out));
+  Datum chunked_values(std::make_shared<ChunkedArray>(ArrayVector{values}));
+  ASSERT_RAISES(Invalid, Take(&this->ctx_, chunked_values, Datum(indices), &out));
+}
+
+// ----------------------------------------------------------------------
+// Fused kernel tests
+
+class TestFusedKernel : public ComputeFixture, public TestBase {
+ public:
+  void MakeKernels(std::vector<std::unique_ptr<UnaryKernel>>* kernels) {
+    kernels->resize(2);
+    ASSERT_OK(GetCastFunction(*int32(), float64(), CastOptions(), &(*kernels)[0]));
+    ASSERT_OK(GetCompareToScalarKernel(std::make_shared<PrimitiveScalar<DoubleType>>(50),
+                                       CompareOptions(CompareOperator::GREATER),
+                                       &(*kernels)[1]));
+  }
+
+  void CheckFused(FunctionContext* ctx, const Datum& input, int64_t block_size) {
+    // The same kernels run one after the other on whole arrays
+    std::vector<std::unique_ptr<UnaryKernel>> steps;
+    MakeKernels(&steps);
+    std::vector<std::shared_ptr<Array>> in_chunks;
+    if (input.kind() == Datum::ARRAY) {
+      in_chunks.push_back(MakeArray(input.array()));
+    } else {
+      in_chunks = input.chunked_array()->chunks();
+    }
+    std::vector<Datum> expected;
+    for (const auto& chunk : in_chunks) {
+      Datum casted, compared;
+      ASSERT_OK(steps[0]->Call(ctx, Datum(chunk), &casted));
+      ASSERT_OK(steps[1]->Call(ctx, casted, &compared));
+      expected.push_back(compared);
+    }
+
+    std::vector<std::unique_ptr<UnaryKernel>> kernels;
+    MakeKernels(&kernels);
+    FusionOptions options;
+    options.block_size = block_size;
+    std::unique_ptr<UnaryKernel> fused;
+    ASSERT_OK(GetFusedKernel(std::move(kernels), options, &fused));
+    Datum out;
+    ASSERT_OK(fused->Call(ctx, input, &out));
+    ASSERT_EQ(input.kind(), out.kind());
+
+    std::vector<std::shared_ptr<Array>> out_chunks;
+    if (out.kind() == Datum::ARRAY) {
+      out_chunks.push_back(MakeArray(out.array()));
+    } else {
+      out_chunks = out.chunked_array()->chunks();
+    }
+    ASSERT_EQ(expected.size(), out_chunks.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_OK(ValidateArray(*out_chunks[i]));
+      ASSERT_ARRAYS_EQUAL(*MakeArray(expected[i].array()), *out_chunks[i]);
+    }
+  }
+};
+
+TEST_F(TestFusedKernel, CastCompare) {
+  vector<int32_t> values;
+  vector<bool> is_valid;
+  for (int32_t i = 0; i < 1000; ++i) {
+    values.push_back((i * 37) % 101);
+    is_valid.push_back(i % 13 != 5);
+  }
+  auto array = _MakeArray<Int32Type, int32_t>(int32(), values, is_valid);
+  auto no_nulls = _MakeArray<Int32Type, int32_t>(int32(), values, {});
+
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  for (FunctionContext* ctx : {&this->ctx_, &threaded_ctx}) {
+    // Several blocks, the last one partial, and a block size rounded to 104
+    for (int64_t block_size : {64, 100, 4096}) {
+      CheckFused(ctx, Datum(array), block_size);
+      CheckFused(ctx, Datum(array->Slice(3, 990)), block_size);
+      CheckFused(ctx, Datum(no_nulls->Slice(5)), block_size);
+      CheckFused(ctx, Datum(std::make_shared<ChunkedArray>(
+                          ArrayVector{array->Slice(0, 300), array->Slice(300)})),
+                 block_size);
+    }
+    CheckFused(ctx, Datum(array->Slice(0, 0)), 64);
+  }
+}
+
+class DropLastKernel : public UnaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    auto array = MakeArray(input.array());
+    *out = Datum(array->Slice(0, array->length() - 1));
+    return Status::OK();
+  }
+};
+
+TEST_F(TestFusedKernel, Errors) {
+  std::unique_ptr<UnaryKernel> fused;
+  ASSERT_RAISES(Invalid, GetFusedKernel({}, FusionOptions(), &fused));
+
+  std::vector<std::unique_ptr<UnaryKernel>> kernels;
+  MakeKernels(&kernels);
+  FusionOptions options;
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, GetFusedKernel(std::move(kernels), options, &fused));
+
+  kernels.clear();
+  kernels.emplace_back(new DropLastKernel());
+  ASSERT_OK(GetFusedKernel(std::move(kernels), FusionOptions(), &fused));
+  auto array = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3}, {});
+  Datum out;
+  ASSERT_RAISES(Invalid, fused->Call(&this->ctx_, Datum(array), &out));
+}
+
+// ----------------------------------------------------------------------
+// Sort tests
+
+// Stable sort of the value positions, NaNs after other values and nulls
+// placed as the options say
+template <typename T, typename Less>
+vector<uint64_t> NaiveSortToIndices(const vector<T>& values, const vector<bool>& is_valid,
+                                    const SortOptions& options, Less&& less) {
+  vector<uint64_t> valid, nulls;
+  for (size_t i = 0; i < values.size(); ++i) {
+    (is_valid.empty() || is_valid[i] ? valid : nulls).push_back(i);
+  }
+  std::stable_sort(valid.begin(), valid.end(),
+                   [&](uint64_t l, uint64_t r) { return less(values[l], values[r]); });
+  vector<uint64_t> result = options.nulls_first ? nulls : valid;
+  const vector<uint64_t>& second = options.nulls_first ? valid : nulls;
+  result.insert(result.end(), second.begin(), second.end());
+  return result;
+}
+
+template <typename T>
+bool NaNLastLess(T left, T right) {
+  if (left != left) {
+    return false;
+  }
+  return right != right || left < right;
+}
+
+class TestSort : public ComputeFixture, public TestBase {
+ public:
+  void CheckSort(const shared_ptr<Array>& values, const SortOptions& options,
+                 const vector<uint64_t>& expected) {
+    Datum out;
+    ASSERT_OK(SortToIndices(&this->ctx_, Datum(values), options, &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    auto result = MakeArray(out.array());
+    ASSERT_OK(ValidateArray(*result));
+    auto ex_indices = _MakeArray<UInt64Type, uint64_t>(uint64(), expected, {});
+    ASSERT_ARRAYS_EQUAL(*ex_indices, *result);
+  }
+};
+
+template <typename Type>
+class TestSortPrimitive : public TestSort {};
+
+TYPED_TEST_CASE(TestSortPrimitive, NumericTypes);
+
+TYPED_TEST(TestSortPrimitive, RandomValues) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+
+  // Random bit patterns cover negative values, infinities and NaNs
+  const int64_t length = 3000;
+  vector<T> values(length);
+  test::random_bytes(length * sizeof(T), 0, reinterpret_cast<uint8_t*>(values.data()));
+  // Some duplicates, and signed zeros
+  for (int64_t i = 0; i < length; i += 7) {
+    values[i] = values[(i * 31) % length];
+  }
+  values[1] = static_cast<T>(0);
+  values[2] = static_cast<T>(-0.0);
+  values[4] = static_cast<T>(0);
+  vector<bool> is_valid;
+  test::random_is_valid(length, 0.1, &is_valid);
+
+  auto array = _MakeArray<TypeParam, T>(type, values, is_valid);
+  auto no_nulls = _MakeArray<TypeParam, T>(type, values, {});
+  for (bool nulls_first : {false, true}) {
+    SortOptions options;
+    options.nulls_first = nulls_first;
+    this->CheckSort(array, options,
+                    NaiveSortToIndices(values, is_valid, options, NaNLastLess<T>));
+    this->CheckSort(no_nulls, options,
+                    NaiveSortToIndices(values, {}, options, NaNLastLess<T>));
+
+    // Indices are relative to the slice
+    vector<T> sliced_values(values.begin() + 3, values.end());
+    vector<bool> sliced_valid(is_valid.begin() + 3, is_valid.end());
+    this->CheckSort(array->Slice(3), options,
+                    NaiveSortToIndices(sliced_values, sliced_valid, options,
+                                       NaNLastLess<T>));
+  }
+}
+
+TEST_F(TestSort, Strings) {
+  // Short alphabet for shared prefixes of all lengths, with zero bytes
+  // telling strings apart from the padding of prefix keys
+  const int64_t length = 2000;
+  vector<uint8_t> bytes(length * 13);
+  test::random_bytes(static_cast<int64_t>(bytes.size()), 0, bytes.data());
+  const char alphabet[] = {'a', 'b', '\0'};
+  vector<std::string> values;
+  for (int64_t i = 0; i < length; ++i) {
+    std::string value;
+    for (int j = 0; j < bytes[i * 13] % 13; ++j) {
+      value.push_back(alphabet[bytes[i * 13 + j + 1] % 3]);
+    }
+    values.push_back(value);
+  }
+  vector<bool> is_valid;
+  test::random_is_valid(length, 0.1, &is_valid);
+
+  auto array = _MakeArray<StringType, std::string>(utf8(), values, is_valid);
+  auto binary_array = _MakeArray<BinaryType, std::string>(binary(), values, is_valid);
+  // String views with a common prefix are inlined or not depending on length
+  vector<std::string> prefixed_values;
+  for (const auto& value : values) {
+    prefixed_values.push_back("prefix" + value);
+  }
+  auto view_array =
+      _MakeArray<StringViewType, std::string>(utf8_view(), prefixed_values, is_valid);
+  auto less = [](const std::string& l, const std::string& r) { return l < r; };
+  for (bool nulls_first : {false, true}) {
+    SortOptions options;
+    options.nulls_first = nulls_first;
+    auto expected = NaiveSortToIndices(values, is_valid, options, less);
+    CheckSort(array, options, expected);
+    CheckSort(binary_array, options, expected);
+    CheckSort(view_array, options, expected);
+  }
+
+  // The indices feed Take
+  Datum indices, sorted;
+  ASSERT_OK(SortToIndices(&this->ctx_, Datum(array), SortOptions(), &indices));
+  ASSERT_OK(Take(&this->ctx_, Datum(array), indices, &sorted));
+  auto sorted_array = MakeArray(sorted.array());
+  const auto& sorted_strings = static_cast<const StringArray&>(*sorted_array);
+  const int64_t num_valid = length - array->null_count();
+  ASSERT_EQ(array->null_count(), sorted_strings.null_count());
+  ASSERT_EQ(0, sorted_strings.Slice(0, num_valid)->null_count());
+  for (int64_t i = 1; i < num_valid; ++i) {
+    ASSERT_LE(sorted_strings.GetString(i - 1), sorted_strings.GetString(i));
+  }
+}
+
+TEST_F(TestSort, Errors) {
+  auto empty = _MakeArray<Int32Type, int32_t>(int32(), {}, {});
+  CheckSort(empty, SortOptions(), {});
+
+  Datum out;
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false}, {});
+  ASSERT_RAISES(NotImplemented, SortToIndices(&this->ctx_, Datum(bools), SortOptions(),
+                                              &out));
+  Datum chunked(std::make_shared<ChunkedArray>(ArrayVector{empty}));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, chunked, SortOptions(), &out));
+}
+
+// ----------------------------------------------------------------------
+// Top-k tests
+
+template <typename Type>
+class TestTopK : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestTopK, NumericTypes);
+
+TYPED_TEST(TestTopK, RandomValues) {
+  using T = typename TypeParam::c_type;
+  auto type = TypeTraits<TypeParam>::type_singleton();
+
+  // Random bit patterns cover infinities and NaNs, and small types duplicates
+  const int64_t length = 3000;
+  vector<T> values(length);
+  test::random_bytes(length * sizeof(T), 1, reinterpret_cast<uint8_t*>(values.data()));
+  vector<bool> is_valid;
+  test::random_is_valid(length, 0.1, &is_valid);
+  auto array = _MakeArray<TypeParam, T>(type, values, is_valid);
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 1000), array->Slice(1000, 0), array->Slice(1000)}));
+
+  vector<T> valid;
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid[i] && values[i] == values[i]) {
+      valid.push_back(values[i]);
+    }
+  }
+  for (bool largest : {true, false}) {
+    vector<T> sorted = valid;
+    std::sort(sorted.begin(), sorted.end());
+    if (largest) {
+      std::reverse(sorted.begin(), sorted.end());
+    }
+    for (int64_t k : {0, 1, 10, 700, 5000}) {
+      const size_t num_values = std::min(static_cast<size_t>(k), sorted.size());
+      vector<T> expected_values(sorted.begin(), sorted.begin() + num_values);
+      auto expected = _MakeArray<TypeParam, T>(type, expected_values, {});
+      for (int num_threads : {1, 4}) {
+        this->ctx_.set_num_threads(num_threads);
+        for (const Datum& input : {Datum(array), chunked}) {
+          Datum out;
+          ASSERT_OK(TopK(&this->ctx_, input, TopKOptions(k, largest), &out));
+          auto result = MakeArray(out.array());
+          ASSERT_OK(ValidateArray(*result));
+          ASSERT_ARRAYS_EQUAL(*expected, *result);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestTopKErrors, Errors) {
+  FunctionContext ctx;
+  Datum out;
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false}, {});
+  ASSERT_RAISES(NotImplemented, TopK(&ctx, Datum(bools), TopKOptions(1), &out));
+  auto ints = _MakeArray<Int32Type, int32_t>(int32(), {1, 2}, {});
+  ASSERT_RAISES(Invalid, TopK(&ctx, Datum(ints), TopKOptions(-1), &out));
+  ASSERT_RAISES(Invalid, TopK(&ctx, Datum(), TopKOptions(1), &out));
+}
+
+// ----------------------------------------------------------------------
+// Sorted merge tests
+
+class TestMergeSorted : public ComputeFixture, public TestBase {
+ public:
+  // A stream of the keys, cut into batches of the given lengths, whose "row"
+  // column numbers the rows of all the streams
+  std::shared_ptr<RecordBatchReader> MakeStream(const vector<int64_t>& keys,
+                                                const vector<bool>& is_valid,
+                                                const vector<int64_t>& lengths) {
+    auto schema = ::arrow::schema(
+        {field("time", timestamp(TimeUnit::MICRO)), field("row", int64())});
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    int64_t offset = 0;
+    for (int64_t length : lengths) {
+      vector<int64_t> batch_keys(keys.begin() + offset, keys.begin() + offset + length);
+      vector<bool> batch_valid(is_valid.begin() + offset,
+                               is_valid.begin() + offset + length);
+      vector<int64_t> rows;
+      for (int64_t i = 0; i < length; ++i) {
+        rows.push_back(num_rows_++);
+      }
+      batches.push_back(RecordBatch::Make(
+          schema, length,
+          {_MakeArray<TimestampType, int64_t>(schema->field(0)->type(), batch_keys,
+                                              batch_valid),
+           _MakeArray<Int64Type, int64_t>(int64(), rows, {})}));
+      offset += length;
+    }
+    std::shared_ptr<Table> table;
+    EXPECT_OK(Table::FromRecordBatches(schema, batches, &table));
+    tables_.push_back(table);
+    return std::make_shared<TableBatchReader>(*table);
+  }
+
+ protected:
+  int64_t num_rows_ = 0;
+  std::vector<std::shared_ptr<Table>> tables_;
+};
+
+TEST_F(TestMergeSorted, Merge) {
+  // Sorted keys with trailing nulls, interleaved across the streams in runs
+  // and with ties
+  vector<std::shared_ptr<RecordBatchReader>> inputs;
+  vector<std::pair<int64_t, int64_t>> expected;  // (key or max for null, row)
+  for (int s = 0; s < 5; ++s) {
+    vector<int64_t> keys;
+    vector<bool> is_valid;
+    for (int64_t i = 0; i < 300 + 50 * s; ++i) {
+      keys.push_back((i / (s + 1)) * 3 + s % 2);
+      is_valid.push_back(true);
+    }
+    is_valid[is_valid.size() - 1] = is_valid[is_valid.size() - 2] = false;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      expected.emplace_back(is_valid[i] ? keys[i] : std::numeric_limits<int64_t>::max(),
+                            num_rows_ + static_cast<int64_t>(i));
+    }
+    const int64_t n = static_cast<int64_t>(keys.size());
+    inputs.push_back(MakeStream(keys, is_valid, {100, 0, 37, n - 137}));
+  }
+  std::sort(expected.begin(), expected.end());
+
+  MergeOptions options;
+  options.batch_size = 256;
+  std::shared_ptr<RecordBatchReader> merged;
+  ASSERT_OK(MergeSorted(&this->ctx_, inputs, "time", options, &merged));
+  ASSERT_TRUE(merged->schema()->Equals(*inputs[0]->schema()));
+
+  vector<int64_t> rows;
+  int64_t num_nulls = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(merged->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_LE(batch->num_rows(), 256);
+    num_nulls += batch->column(0)->null_count();
+    const auto& row_column = static_cast<const Int64Array&>(*batch->column(1));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      rows.push_back(row_column.Value(i));
+    }
+  }
+  ASSERT_EQ(10, num_nulls);
+  ASSERT_EQ(expected.size(), rows.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    ASSERT_EQ(expected[i].second, rows[i]) << i;
+  }
+}
+
+TEST_F(TestMergeSorted, NullsFirstAndSingleInput) {
+  // A single input is passed on without copying
+  auto input = MakeStream({0, 1, 2, 3}, {false, true, true, true}, {4});
+  MergeOptions options;
+  options.nulls_first = true;
+  std::shared_ptr<RecordBatchReader> merged;
+  ASSERT_OK(MergeSorted(&this->ctx_, {input}, "time", options, &merged));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(merged->ReadNext(&batch));
+  ASSERT_EQ(4, batch->num_rows());
+  ASSERT_EQ(tables_[0]->column(1)->data()->chunk(0)->data()->buffers[1]->data(),
+            batch->column(1)->data()->buffers[1]->data());
+  ASSERT_OK(merged->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // Nulls first in both inputs
+  auto first = MakeStream({0, 5, 9}, {false, true, true}, {3});
+  auto second = MakeStream({0, 0, 7}, {false, false, true}, {1, 2});
+  ASSERT_OK(MergeSorted(&this->ctx_, {first, second}, "time", options, &merged));
+  ASSERT_OK(merged->ReadNext(&batch));
+  auto expected_rows = _MakeArray<Int64Type, int64_t>(int64(), {4, 7, 8, 5, 9, 6}, {});
+  ASSERT_ARRAYS_EQUAL(*expected_rows, *batch->column(1));
+}
+
+TEST_F(TestMergeSorted, Errors) {
+  std::shared_ptr<RecordBatchReader> merged;
+  auto input = MakeStream({0, 1}, {true, true}, {2});
+  ASSERT_RAISES(Invalid, MergeSorted(&this->ctx_, {}, "time", MergeOptions(), &merged));
+  ASSERT_RAISES(Invalid,
+                MergeSorted(&this->ctx_, {input}, "missing", MergeOptions(), &merged));
+  MergeOptions options;
+  options.batch_size = 0;
+  ASSERT_RAISES(Invalid, MergeSorted(&this->ctx_, {input}, "time", options, &merged));
+
+  shared_ptr<RecordBatch> lists;
+  ASSERT_OK(ipc::MakeListRecordBatch(&lists));
+  shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({lists}, &table));
+  auto list_input = std::make_shared<TableBatchReader>(*table);
+  ASSERT_RAISES(Invalid, MergeSorted(&this->ctx_, {input, list_input}, "time",
+                                     MergeOptions(), &merged));
+  ASSERT_RAISES(NotImplemented,
+                MergeSorted(&this->ctx_, {list_input},
+                            lists->schema()->field(0)->name(), MergeOptions(), &merged));
+}
+
+// ----------------------------------------------------------------------
+// Quantile sketch tests
+
+class TestQuantileSketch : public ComputeFixture, public TestBase {
+ public:
+  // The values 0 to length - 1, in a scrambled order
+  static vector<int64_t> Permutation(int64_t length) {
+    vector<int64_t> values;
+    for (int64_t i = 0; i < length; ++i) {
+      values.push_back((i * 7919) % length);
+    }
+    return values;
+  }
+
+  // The rank of a quantile of the values 0 to count - 1 is the quantile
+  // itself, which must be within 2% of q * count
+  static void CheckQuantile(double quantile, double q, int64_t count) {
+    ASSERT_NEAR(q * static_cast<double>(count), quantile, 0.02 * static_cast<double>(count))
+        << "q = " << q;
+  }
+};
+
+TEST_F(TestQuantileSketch, Update) {
+  const int64_t length = 100000;
+  QuantileSketch sketch;
+  ASSERT_TRUE(std::isnan(sketch.Quantile(0.5)));
+  for (int64_t value : Permutation(length)) {
+    sketch.Update(static_cast<double>(value));
+  }
+  sketch.Update(std::numeric_limits<double>::quiet_NaN());
+  ASSERT_EQ(length, sketch.count());
+  ASSERT_LT(sketch.num_retained(), 1000);
+  for (double q : {0.0, 0.01, 0.25, 0.5, 0.99, 1.0}) {
+    CheckQuantile(sketch.Quantile(q), q, length);
+  }
+  ASSERT_EQ(sketch.Quantile(1.0), sketch.Quantile(2.0));
+}
+
+TEST_F(TestQuantileSketch, Merge) {
+  // Sketches of batches, merged as threads would
+  const int64_t length = 100000;
+  const vector<int64_t> values = Permutation(length);
+  QuantileSketch merged;
+  for (int part = 0; part < 4; ++part) {
+    vector<int64_t> part_values(values.begin() + part * length / 4,
+                                values.begin() + (part + 1) * length / 4);
+    auto column = _MakeArray<Int64Type, int64_t>(int64(), part_values, {});
+    auto batch = RecordBatch::Make(::arrow::schema({field("v", int64())}),
+                                   column->length(), {column});
+    QuantileSketch sketch(100);
+    ASSERT_OK(sketch.Update(Datum(batch->column(0))));
+    merged.Merge(sketch);
+  }
+  ASSERT_EQ(length, merged.count());
+  for (double q : {0.01, 0.5, 0.99}) {
+    CheckQuantile(merged.Quantile(q), q, length);
+  }
+}
+
+TEST_F(TestQuantileSketch, ApproximateQuantiles) {
+  const int64_t length = 100000;
+  const vector<int64_t> values = Permutation(length);
+  vector<double> doubles(values.begin(), values.end());
+  vector<bool> is_valid(length, true);
+  // Nulls are skipped, and replaced by values out of range
+  for (int64_t i = 0; i < length; i += 100) {
+    is_valid[i] = false;
+    doubles[i] = 1e9;
+  }
+  auto array = _MakeArray<DoubleType, double>(float64(), doubles, is_valid);
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 30000), array->Slice(30000, 50000),
+                  array->Slice(80000)}));
+
+  const vector<double> quantiles = {0.5, 0.01, 0.99};
+  for (int num_threads : {1, 4}) {
+    this->ctx_.set_num_threads(num_threads);
+    Datum out;
+    ASSERT_OK(ApproximateQuantiles(&this->ctx_, chunked, quantiles, &out));
+    std::shared_ptr<Array> result_array = MakeArray(out.array());
+    const auto& result = static_cast<const DoubleArray&>(*result_array);
+    ASSERT_EQ(3, result.length());
+    ASSERT_EQ(0, result.null_count());
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+      CheckQuantile(result.Value(i), quantiles[i], length);
+    }
+  }
+
+  Datum out;
+  ASSERT_OK(ApproximateQuantiles(&this->ctx_, Datum(array->Slice(0, 0)), {0.5}, &out));
+  ASSERT_EQ(1, out.array()->null_count);
+  ASSERT_RAISES(Invalid,
+                ApproximateQuantiles(&this->ctx_, Datum(array), {1.5}, &out));
+  auto bools = _MakeArray<BooleanType, bool>(boolean(), {true, false}, {});
+  ASSERT_RAISES(NotImplemented,
+                ApproximateQuantiles(&this->ctx_, Datum(bools), {0.5}, &out));
+  // Even without values
+  Datum empty_bools(std::make_shared<ChunkedArray>(ArrayVector{bools->Slice(0, 0)}));
+  ASSERT_RAISES(NotImplemented,
+                ApproximateQuantiles(&this->ctx_, empty_bools, {0.5}, &out));
+}
+
+// ----------------------------------------------------------------------
+// Distinct count tests
+
+class TestCountDistinct : public ComputeFixture, public TestBase {
+ public:
+  void CheckEstimate(int64_t expected, const Datum& values) {
+    Datum out;
+    ASSERT_OK(ApproximateCountDistinct(&this->ctx_, values, &out));
+    const int64_t estimate =
+        static_cast<const PrimitiveScalar<Int64Type>&>(*out.scalar()).value;
+    ASSERT_NEAR(static_cast<double>(expected), static_cast<double>(estimate),
+                0.03 * static_cast<double>(expected) + 1);
+  }
+};
+
+TEST_F(TestCountDistinct, Estimate) {
+  // Each value twice, with nulls
+  const int64_t num_distinct = 200000;
+  vector<int64_t> values;
+  vector<std::string> strings;
+  for (int64_t i = 0; i < 2 * num_distinct; ++i) {
+    values.push_back((i * 7919) % num_distinct);
+    strings.push_back("id" + std::to_string(values.back()));
+  }
+  vector<bool> is_valid(values.size(), true);
+  is_valid[1] = is_valid[5] = false;
+  auto ints = _MakeArray<Int64Type, int64_t>(int64(), values, is_valid);
+  auto string_array = _MakeArray<StringType, std::string>(utf8(), strings, {});
+
+  for (int num_threads : {1, 4}) {
+    this->ctx_.set_num_threads(num_threads);
+    CheckEstimate(num_distinct, Datum(ints));
+    CheckEstimate(num_distinct, Datum(string_array));
+    Datum chunked(std::make_shared<ChunkedArray>(ArrayVector{
+        ints->Slice(0, 100000), ints->Slice(100000, 0), ints->Slice(100000)}));
+    CheckEstimate(num_distinct, chunked);
+  }
+
+  // Small counts are close to exact
+  CheckEstimate(0, Datum(ints->Slice(0, 0)));
+  CheckEstimate(10, Datum(_MakeArray<Int32Type, int32_t>(
+                        int32(), {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 1, 2}, {})));
+  CheckEstimate(2, Datum(_MakeArray<BooleanType, bool>(boolean(), {true, false, true},
+                                                       {true, true, false})));
+}
+
+TEST_F(TestCountDistinct, MergeSerialized) {
+  // Sketches of the halves of the input, combined as another process would
+  const int64_t length = 50000;
+  vector<int64_t> values(length);
+  std::iota(values.begin(), values.end(), 0);
+  auto array = _MakeArray<Int64Type, int64_t>(int64(), values, {});
+
+  std::unique_ptr<DistinctCountSketch> whole, first, second;
+  ASSERT_OK(SketchDistinct(&this->ctx_, Datum(array), 12, &whole));
+  ASSERT_OK(SketchDistinct(&this->ctx_, Datum(array->Slice(0, 30000)), 12, &first));
+  ASSERT_OK(SketchDistinct(&this->ctx_, Datum(array->Slice(20000)), 12, &second));
+  ASSERT_EQ(12, whole->precision());
+
+  std::shared_ptr<Buffer> serialized;
+  ASSERT_OK(second->Serialize(default_memory_pool(), &serialized));
+  ASSERT_EQ(2 + 4096, serialized->size());
+  std::unique_ptr<DistinctCountSketch> received;
+  ASSERT_OK(DistinctCountSketch::Deserialize(*serialized, &received));
+  ASSERT_EQ(second->Estimate(), received->Estimate());
+  ASSERT_OK(first->Merge(*received));
+  ASSERT_EQ(whole->Estimate(), first->Estimate());
+  const double expected = static_cast<double>(length);
+  ASSERT_NEAR(expected, static_cast<double>(whole->Estimate()), 0.05 * expected);
+}
+
+TEST_F(TestCountDistinct, Dictionary) {
+  // Dictionary values are counted, not indices
+  auto dict_type = dictionary(
+      int8(), _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c"}, {}));
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {2, 0, 2, 1}, {true, true, true,
+                                                                   false});
+  auto encoded = std::make_shared<DictionaryArray>(dict_type, indices);
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"c", "a", "d"}, {});
+
+  DistinctCountSketch sketch;
+  ASSERT_OK(sketch.Update(Datum(encoded)));
+  ASSERT_EQ(2, sketch.Estimate());
+  ASSERT_OK(sketch.Update(Datum(strings)));
+  ASSERT_EQ(3, sketch.Estimate());
+}
+
+TEST_F(TestCountDistinct, Errors) {
+  DistinctCountSketch sketch(10);
+  ASSERT_RAISES(Invalid, sketch.Merge(DistinctCountSketch(11)));
+  ASSERT_EQ(DistinctCountSketch::kMaxPrecision, DistinctCountSketch(40).precision());
+
+  std::shared_ptr<Buffer> serialized;
+  ASSERT_OK(sketch.Serialize(default_memory_pool(), &serialized));
+  std::unique_ptr<DistinctCountSketch> out;
+  ASSERT_RAISES(Invalid, DistinctCountSketch::Deserialize(
+                             *SliceBuffer(serialized, 0, serialized->size() - 1), &out));
+  ASSERT_RAISES(Invalid, DistinctCountSketch::Deserialize(
+                             *SliceBuffer(serialized, 1, serialized->size() - 1), &out));
+
+  shared_ptr<RecordBatch> lists;
+  ASSERT_OK(ipc::MakeListRecordBatch(&lists));
+  Datum result;
+  ASSERT_RAISES(NotImplemented,
+                ApproximateCountDistinct(&this->ctx_, Datum(lists->column(0)), &result));
+}
+
+// ----------------------------------------------------------------------
+// Bloom filters
+
+class TestBloomFilter : public ComputeFixture, public TestBase {};
+
+TEST_F(TestBloomFilter, MayContain) {
+  // Even keys inserted, with nulls, then all the keys probed
+  const int64_t length = 20000;
+  vector<int64_t> keys, probes;
+  for (int64_t i = 0; i < length; ++i) {
+    keys.push_back(2 * i);
+  }
+  for (int64_t i = 0; i < 2 * length; ++i) {
+    probes.push_back(i);
+  }
+  vector<bool> is_valid(keys.size(), true);
+  is_valid[3] = false;
+  auto key_array = _MakeArray<Int64Type, int64_t>(int64(), keys, is_valid);
+  auto probe_array = _MakeArray<Int64Type, int64_t>(int64(), probes, {});
+
+  Datum chunked_keys(std::make_shared<ChunkedArray>(
+      ArrayVector{key_array->Slice(0, 5000), key_array->Slice(5000)}));
+  Datum chunked_probes(std::make_shared<ChunkedArray>(ArrayVector{
+      probe_array->Slice(0, 15000), probe_array->Slice(15000, 0),
+      probe_array->Slice(15000)}));
+  std::shared_ptr<BlockedBloomFilter> filter;
+  ASSERT_OK(BuildBloomFilter(&this->ctx_, chunked_keys, &filter));
+  ASSERT_EQ(length * BlockedBloomFilter::kDefaultBitsPerValue / 512,
+            filter->num_blocks());
+
+  for (int num_threads : {1, 4}) {
+    this->ctx_.set_num_threads(num_threads);
+    Datum out;
+    ASSERT_OK(BloomFilterMayContain(&this->ctx_, *filter, chunked_probes, &out));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+    ASSERT_EQ(3, out.chunked_array()->num_chunks());
+    std::shared_ptr<Array> mask;
+    ASSERT_OK(Concatenate(out.chunked_array()->chunks(), default_memory_pool(), &mask));
+    ASSERT_EQ(0, mask->null_count());
+    const auto& bools = static_cast<const BooleanArray&>(*mask);
+    int64_t false_positives = 0;
+    for (int64_t i = 0; i < 2 * length; ++i) {
+      if (i % 2 == 0 && i != 6) {
+        ASSERT_TRUE(bools.Value(i)) << i;
+      } else {
+        false_positives += bools.Value(i);
+      }
+    }
+    ASSERT_LT(false_positives, length / 100);
+  }
+
+  // Nulls are never contained
+  auto nulls = _MakeArray<Int64Type, int64_t>(int64(), {0, 2, 4}, {true, false, true});
+  Datum out;
+  ASSERT_OK(BloomFilterMayContain(&this->ctx_, *filter, Datum(nulls), &out));
+  auto expected = _MakeArray<BooleanType, bool>(boolean(), {true, false, true}, {});
+  ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out.array()));
+}
+
+TEST_F(TestBloomFilter, DictionaryAndSerialized) {
+  // Dictionary-encoded values are hashed as their dictionary values
+  auto dict_type = dictionary(
+      int8(), _MakeArray<StringType, std::string>(utf8(), {"a", "b", "c"}, {}));
+  auto indices = _MakeArray<Int8Type, int8_t>(int8(), {2, 0, 2, 1}, {true, true, true,
+                                                                   false});
+  auto encoded = std::make_shared<DictionaryArray>(dict_type, indices);
+  std::shared_ptr<BlockedBloomFilter> filter;
+  ASSERT_OK(BuildBloomFilter(&this->ctx_, Datum(encoded), &filter));
+  ASSERT_EQ(1, filter->num_blocks());
+
+  // The blocks are opened again without copying
+  auto copy = std::make_shared<Buffer>(filter->data()->data(), filter->data()->size());
+  std::shared_ptr<BlockedBloomFilter> opened;
+  ASSERT_OK(BlockedBloomFilter::Open(copy, &opened));
+  ASSERT_EQ(copy->data(), opened->data()->data());
+  auto strings = _MakeArray<StringType, std::string>(utf8(), {"c", "a", "b"}, {});
+  Datum out;
+  ASSERT_OK(BloomFilterMayContain(&this->ctx_, *opened, Datum(strings), &out));
+  auto mask = MakeArray(out.array());
+  ASSERT_TRUE(static_cast<const BooleanArray&>(*mask).Value(0));
+  ASSERT_TRUE(static_cast<const BooleanArray&>(*mask).Value(1));
+
+  // Immutable filters cannot be inserted into
+  ASSERT_RAISES(Invalid, opened->Insert(*strings->data()));
+  ASSERT_RAISES(Invalid, opened->Merge(*filter));
+  ASSERT_OK(filter->Merge(*opened));
+}
+
+TEST_F(TestBloomFilter, Errors) {
+  std::shared_ptr<BlockedBloomFilter> filter, other;
+  ASSERT_OK(BlockedBloomFilter::Make(100, default_memory_pool(), &filter));
+  ASSERT_OK(BlockedBloomFilter::Make(1000, default_memory_pool(), &other));
+  ASSERT_RAISES(Invalid, filter->Merge(*other));
+  ASSERT_RAISES(Invalid, BlockedBloomFilter::Make(-1, default_memory_pool(), &other));
+  ASSERT_RAISES(Invalid,
+                BlockedBloomFilter::Open(SliceBuffer(filter->data(), 0, 63), &other));
+
+  shared_ptr<RecordBatch> lists;
+  ASSERT_OK(ipc::MakeListRecordBatch(&lists));
+  ASSERT_RAISES(NotImplemented,
+                BuildBloomFilter(&this->ctx_, Datum(lists->column(0)), &other));
+}
+
+// ----------------------------------------------------------------------
+// Profiling
+
+class TestKernelProfiler : public ComputeFixture, public TestBase {};
+
+TEST_F(TestKernelProfiler, TopLevelKernels) {
+  const int64_t length = 1000;
+  vector<int32_t> values, indices;
+  for (int32_t i = 0; i < length; ++i) {
+    values.push_back(i);
+    indices.push_back(length - 1 - i);
+  }
+  auto array = _MakeArray<Int32Type, int32_t>(int32(), values, {});
+  auto index_array = _MakeArray<Int32Type, int32_t>(int32(), indices, {});
+
+  vector<std::string> events;
+  KernelProfiler profiler(
+      [&events](const KernelEvent& event) { events.push_back(event.kernel); });
+  this->ctx_.set_profiler(&profiler);
+
+  Datum casted, taken, compared;
+  ASSERT_OK(Cast(&this->ctx_, Datum(array), int64(), CastOptions(), &casted));
+  ASSERT_OK(Take(&this->ctx_, casted, Datum(index_array), &taken));
+  // Flipping a scalar to the right-hand side calls Compare again
+  ASSERT_OK(Compare(&this->ctx_, Datum(std::make_shared<PrimitiveScalar<Int64Type>>(5)),
+                    taken, CompareOptions(CompareOperator::LESS), &compared));
+
+  // Allocations of parallel tasks are attributed to the calling kernel
+  FunctionContext threaded_ctx(this->ctx_.memory_pool());
+  threaded_ctx.set_num_threads(4);
+  threaded_ctx.set_profiler(&profiler);
+  Datum chunked(std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 500), array->Slice(500)}));
+  ASSERT_OK(Cast(&threaded_ctx, chunked, int64(), CastOptions(), &casted));
+  ASSERT_EQ(length * static_cast<int64_t>(sizeof(int64_t)),
+            threaded_ctx.bytes_allocated());
+
+  ASSERT_EQ(vector<std::string>({"Cast", "Take", "Compare", "Cast"}), events);
+  auto stats = profiler.stats();
+  ASSERT_EQ(3, stats.size());
+  ASSERT_EQ(2, stats["Cast"].num_calls);
+  ASSERT_EQ(2 * length * static_cast<int64_t>(sizeof(int64_t)),
+            stats["Cast"].bytes_allocated);
+  ASSERT_EQ(1, stats["Take"].num_calls);
+  ASSERT_LE(length * static_cast<int64_t>(sizeof(int64_t)),
+            stats["Take"].bytes_allocated);
+  ASSERT_EQ(1, stats["Compare"].num_calls);
+  ASSERT_LE(0, stats["Compare"].wall_time_ns);
+
+  profiler.Reset();
+  ASSERT_EQ(0, profiler.stats().size());
+}
+
+TEST_F(TestKernelProfiler, Disabled) {
+  auto array = _MakeArray<Int32Type, int32_t>(int32(), {1, 2, 3}, {});
+  Datum out;
+  ASSERT_OK(Cast(&this->ctx_, Datum(array), int64(), CastOptions(), &out));
+  ASSERT_EQ(0, this->ctx_.bytes_allocated());
+}
+
 }  // namespace compute
 }  // namespace arrow
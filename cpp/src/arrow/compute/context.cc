@@ -21,11 +21,19 @@
 
 #include "arrow/buffer.h"
 #include "arrow/util/cpu-info.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 namespace compute {
 
-FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool) {
+FunctionContext::FunctionContext(MemoryPool* pool)
+    : pool_(pool),
+      num_threads_(1),
+      scheduler_(nullptr),
+      profiler_(nullptr),
+      parent_(nullptr),
+      bytes_allocated_(0),
+      in_kernel_(false) {
   if (!::arrow::CpuInfo::initialized()) {
     ::arrow::CpuInfo::Init();
   }
@@ -34,7 +42,13 @@ FunctionContext::FunctionContext(MemoryPool* pool) : pool_(pool) {
 MemoryPool* FunctionContext::memory_pool() const { return pool_; }
 
 Status FunctionContext::Allocate(const int64_t nbytes, std::shared_ptr<Buffer>* out) {
-  return AllocateBuffer(pool_, nbytes, out);
+  RETURN_NOT_OK(AllocateBuffer(pool_, nbytes, out));
+  if (ARROW_PREDICT_FALSE(profiler_ != nullptr)) {
+    for (FunctionContext* ctx = this; ctx != nullptr; ctx = ctx->parent_) {
+      ctx->bytes_allocated_ += nbytes;
+    }
+  }
+  return Status::OK();
 }
 
 void FunctionContext::SetStatus(const Status& status) {
@@ -47,5 +61,17 @@ void FunctionContext::SetStatus(const Status& status) {
 /// \brief Clear any error status
 void FunctionContext::ResetStatus() { status_ = Status::OK(); }
 
+void FunctionContext::set_num_threads(int num_threads) {
+  DCHECK_GT(num_threads, 0);
+  num_threads_ = num_threads;
+}
+
+void FunctionContext::PrepareTaskContext(FunctionContext* task_ctx) {
+  task_ctx->scheduler_ = scheduler_;
+  task_ctx->profiler_ = profiler_;
+  task_ctx->parent_ = this;
+  task_ctx->in_kernel_ = in_kernel_;
+}
+
 }  // namespace compute
 }  // namespace arrow
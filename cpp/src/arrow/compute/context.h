@@ -18,16 +18,24 @@
 #ifndef ARROW_COMPUTE_CONTEXT_H
 #define ARROW_COMPUTE_CONTEXT_H
 
+#include <atomic>
 #include <memory>
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class TaskScheduler;
+
 namespace compute {
 
+class KernelProfiler;
+class KernelProfileScope;
+
 #define RETURN_IF_ERROR(ctx)                  \
   if (ARROW_PREDICT_FALSE(ctx->HasError())) { \
     Status s = ctx->status();                 \
@@ -60,9 +68,62 @@ class ARROW_EXPORT FunctionContext {
   /// \brief Return the current status of the context
   const Status& status() const { return status_; }
 
+  /// \brief Set the maximum number of threads that kernels may use to process
+  /// independent pieces (e.g. the chunks of a ChunkedArray) of their input
+  /// \param[in] num_threads a value of 1 (the default) means serial execution
+  void set_num_threads(int num_threads);
+
+  /// \brief Return the maximum number of threads kernels may use
+  int num_threads() const { return num_threads_; }
+
+  /// \brief Execute parallel work on a work-stealing scheduler
+  ///
+  /// When set, it takes precedence over num_threads(). Kernels invoked by
+  /// parallel tasks receive a context carrying the same scheduler, so that
+  /// nested parallelism (e.g. columns, then chunks) shares the scheduler's
+  /// fixed set of threads
+  /// \param[in] scheduler the scheduler, must outlive the context; may be
+  /// nullptr to disable it
+  void set_task_scheduler(TaskScheduler* scheduler) { scheduler_ = scheduler; }
+
+  /// \brief Return the task scheduler, if any
+  TaskScheduler* task_scheduler() const { return scheduler_; }
+
+  /// \brief Record the invocation counts, wall times and allocations of the
+  /// kernels run with this context
+  /// \param[in] profiler the profiler, must outlive the context; nullptr (the
+  /// default) disables profiling, leaving only a pointer check per kernel call
+  void set_profiler(KernelProfiler* profiler) { profiler_ = profiler; }
+
+  /// \brief Return the profiler, if any
+  KernelProfiler* profiler() const { return profiler_; }
+
+  /// \brief Return the number of bytes allocated through Allocate, by this
+  /// context and the contexts of its parallel tasks, while profiling
+  int64_t bytes_allocated() const { return bytes_allocated_; }
+
+  /// \brief Set up the context of a task run in parallel on behalf of this
+  /// context, sharing its task scheduler and profiler
+  void PrepareTaskContext(FunctionContext* task_ctx);
+
  private:
+  friend class KernelProfileScope;
+
   Status status_;
   MemoryPool* pool_;
+  int num_threads_;
+  TaskScheduler* scheduler_;
+
+  KernelProfiler* profiler_;
+  // The context a parallel task was created by, which also counts its
+  // allocations
+  FunctionContext* parent_;
+  std::atomic<int64_t> bytes_allocated_;
+  // Whether a KernelProfileScope is active, so that nested kernels are not
+  // recorded separately
+  bool in_kernel_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(FunctionContext);
 };
 
 }  // namespace compute
@@ -0,0 +1,311 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec-plan.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/thread-pool.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/filter.h"
+
+namespace arrow {
+namespace compute {
+
+Status ExecNode::Emit(FunctionContext* ctx, const std::shared_ptr<RecordBatch>& batch) {
+  return output_ == nullptr ? Status::OK() : output_->InputReceived(ctx, batch);
+}
+
+Status ExecNode::Finish(FunctionContext* ctx) {
+  return output_ == nullptr ? Status::OK() : output_->InputFinished(ctx);
+}
+
+namespace {
+
+Status LookupColumn(const Schema& schema, const std::string& name, int* out) {
+  const int64_t index = schema.GetFieldIndex(name);
+  if (index < 0) {
+    std::stringstream ss;
+    ss << "No column named '" << name << "' in " << schema.ToString();
+    return Status::Invalid(ss.str());
+  }
+  *out = static_cast<int>(index);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Nodes
+
+class FilterNode : public ExecNode {
+ public:
+  explicit FilterNode(BatchPredicate predicate) : predicate_(std::move(predicate)) {}
+
+  Status InputReceived(FunctionContext* ctx,
+                       const std::shared_ptr<RecordBatch>& batch) override {
+    Datum mask;
+    RETURN_NOT_OK(predicate_(ctx, *batch, &mask));
+    Datum filtered;
+    RETURN_NOT_OK(Filter(ctx, Datum(batch), mask, &filtered));
+    if (filtered.record_batch()->num_rows() == 0) {
+      return Status::OK();
+    }
+    return Emit(ctx, filtered.record_batch());
+  }
+
+  Status InputFinished(FunctionContext* ctx) override { return Finish(ctx); }
+
+ private:
+  BatchPredicate predicate_;
+};
+
+class ProjectNode : public ExecNode {
+ public:
+  explicit ProjectNode(std::vector<std::string> columns) : columns_(std::move(columns)) {}
+
+  Status InputReceived(FunctionContext* ctx,
+                       const std::shared_ptr<RecordBatch>& batch) override {
+    std::vector<std::shared_ptr<Field>> fields(columns_.size());
+    std::vector<std::shared_ptr<Array>> arrays(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      int index;
+      RETURN_NOT_OK(LookupColumn(*batch->schema(), columns_[i], &index));
+      fields[i] = batch->schema()->field(index);
+      arrays[i] = batch->column(index);
+    }
+    return Emit(ctx, RecordBatch::Make(::arrow::schema(fields), batch->num_rows(),
+                                       std::move(arrays)));
+  }
+
+  Status InputFinished(FunctionContext* ctx) override { return Finish(ctx); }
+
+ private:
+  std::vector<std::string> columns_;
+};
+
+class GroupByNode : public ExecNode {
+ public:
+  explicit GroupByNode(GroupByOptions options) : options_(std::move(options)) {}
+
+  Status InputReceived(FunctionContext* ctx,
+                       const std::shared_ptr<RecordBatch>& batch) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // The schema is only known with the first batch
+    if (!kernel_) {
+      RETURN_NOT_OK(GetGroupByKernel(ctx, batch->schema(), options_, &kernel_));
+    }
+    return kernel_->Append(ctx, *batch);
+  }
+
+  Status InputFinished(FunctionContext* ctx) override {
+    if (kernel_) {
+      std::shared_ptr<RecordBatch> groups;
+      RETURN_NOT_OK(kernel_->Flush(&groups));
+      RETURN_NOT_OK(Emit(ctx, groups));
+    }
+    return Finish(ctx);
+  }
+
+ private:
+  GroupByOptions options_;
+  std::mutex mutex_;
+  std::unique_ptr<GroupByKernel> kernel_;
+};
+
+class SinkNode : public ExecNode {
+ public:
+  explicit SinkNode(std::function<Status(const std::shared_ptr<RecordBatch>&)> consume)
+      : consume_(std::move(consume)) {}
+
+  Status InputReceived(FunctionContext* ctx,
+                       const std::shared_ptr<RecordBatch>& batch) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return consume_(batch);
+  }
+
+  Status InputFinished(FunctionContext* ctx) override { return Finish(ctx); }
+
+ private:
+  std::function<Status(const std::shared_ptr<RecordBatch>&)> consume_;
+  std::mutex mutex_;
+};
+
+}  // namespace
+
+BatchPredicate CompareToScalar(const std::string& column, CompareOperator op,
+                               const std::shared_ptr<Scalar>& value) {
+  return [column, op, value](FunctionContext* ctx, const RecordBatch& batch,
+                             Datum* mask) {
+    int index;
+    RETURN_NOT_OK(LookupColumn(*batch.schema(), column, &index));
+    return Compare(ctx, Datum(batch.column(index)), Datum(value), CompareOptions(op),
+                   mask);
+  };
+}
+
+std::unique_ptr<ExecNode> MakeFilterNode(BatchPredicate predicate) {
+  return std::unique_ptr<ExecNode>(new FilterNode(std::move(predicate)));
+}
+
+std::unique_ptr<ExecNode> MakeProjectNode(std::vector<std::string> columns) {
+  return std::unique_ptr<ExecNode>(new ProjectNode(std::move(columns)));
+}
+
+std::unique_ptr<ExecNode> MakeGroupByNode(GroupByOptions options) {
+  return std::unique_ptr<ExecNode>(new GroupByNode(std::move(options)));
+}
+
+std::unique_ptr<ExecNode> MakeSinkNode(
+    std::function<Status(const std::shared_ptr<RecordBatch>&)> consume) {
+  return std::unique_ptr<ExecNode>(new SinkNode(std::move(consume)));
+}
+
+std::unique_ptr<ExecNode> MakeSinkNode(std::vector<std::shared_ptr<RecordBatch>>* out) {
+  return MakeSinkNode([out](const std::shared_ptr<RecordBatch>& batch) {
+    out->push_back(batch);
+    return Status::OK();
+  });
+}
+
+// ----------------------------------------------------------------------
+// ExecPlan
+
+namespace {
+
+// Bounds the morsels in flight and collects the first error of their tasks
+class MorselThrottle {
+ public:
+  explicit MorselThrottle(int max_in_flight)
+      : max_in_flight_(max_in_flight), in_flight_(0) {}
+
+  // Wait for a slot, unless a task failed
+  bool Acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return in_flight_ < max_in_flight_ || !error_.ok(); });
+    if (!error_.ok()) {
+      return false;
+    }
+    ++in_flight_;
+    return true;
+  }
+
+  void Release(const Status& status) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!status.ok() && error_.ok()) {
+      error_ = status;
+    }
+    --in_flight_;
+    cv_.notify_all();
+  }
+
+  // Wait for the tasks in flight, returning the first error
+  Status WaitAll() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return in_flight_ == 0; });
+    return error_;
+  }
+
+ private:
+  const int max_in_flight_;
+  int in_flight_;
+  Status error_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+}  // namespace
+
+ExecPlan::ExecPlan(const std::shared_ptr<RecordBatchReader>& source,
+                   const ExecOptions& options)
+    : source_(source), options_(options), ran_(false) {}
+
+ExecPlan::~ExecPlan() {}
+
+void ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
+  if (!nodes_.empty()) {
+    nodes_.back()->set_output(node.get());
+  }
+  nodes_.push_back(std::move(node));
+}
+
+Status ExecPlan::Run(FunctionContext* ctx) {
+  if (nodes_.empty()) {
+    return Status::Invalid("An ExecPlan needs at least one node");
+  }
+  if (ran_) {
+    return Status::Invalid("An ExecPlan can only be run once");
+  }
+  if (options_.morsel_size <= 0) {
+    return Status::Invalid("The morsel size must be positive");
+  }
+  ran_ = true;
+
+  const int num_threads =
+      options_.num_threads > 0 ? options_.num_threads : GetCpuThreadPoolCapacity();
+  const int max_in_flight =
+      options_.max_in_flight > 0 ? options_.max_in_flight : 2 * num_threads;
+  ExecNode* first = nodes_.front().get();
+  internal::ThreadPool* pool = internal::GetCpuThreadPool();
+  MorselThrottle throttle(max_in_flight);
+
+  Status st;
+  std::shared_ptr<RecordBatch> batch;
+  while (st.ok()) {
+    st = source_->ReadNext(&batch);
+    if (!st.ok() || batch == nullptr) {
+      break;
+    }
+    for (int64_t offset = 0; offset < batch->num_rows() && st.ok();
+         offset += options_.morsel_size) {
+      std::shared_ptr<RecordBatch> morsel = batch;
+      if (offset > 0 || batch->num_rows() > options_.morsel_size) {
+        morsel = batch->Slice(offset, options_.morsel_size);
+      }
+      if (num_threads == 1) {
+        st = first->InputReceived(ctx, morsel);
+        continue;
+      }
+      if (!throttle.Acquire()) {
+        break;
+      }
+      st = pool->Spawn([ctx, first, morsel, &throttle]() {
+        FunctionContext task_ctx(ctx->memory_pool());
+        ctx->PrepareTaskContext(&task_ctx);
+        throttle.Release(first->InputReceived(&task_ctx, morsel));
+      });
+      if (!st.ok()) {
+        throttle.Release(Status::OK());
+      }
+    }
+  }
+
+  // The tasks reference the throttle, so they must be waited for even on error
+  Status task_status = throttle.WaitAll();
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(task_status);
+  return first->InputFinished(ctx);
+}
+
+}  // namespace compute
+}  // namespace arrow
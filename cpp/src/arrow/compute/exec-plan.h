@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A push-based engine running pipelines of operators over streams of record
+// batches
+
+#ifndef ARROW_COMPUTE_EXEC_PLAN_H
+#define ARROW_COMPUTE_EXEC_PLAN_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/group-by.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class RecordBatchReader;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+struct Scalar;
+
+/// \class ExecNode
+/// \brief An operator of an ExecPlan, receiving the batches output by the
+/// previous node and pushing its own batches to the next one
+class ARROW_EXPORT ExecNode {
+ public:
+  ExecNode() : output_(NULLPTR) {}
+  virtual ~ExecNode() = default;
+
+  /// \brief Process a batch of the input
+  ///
+  /// Called concurrently for the batches of the input, in no particular
+  /// order, from the threads running the plan
+  virtual Status InputReceived(FunctionContext* ctx,
+                               const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Called once all the batches of the input have been processed,
+  /// before any output of the node is finished
+  virtual Status InputFinished(FunctionContext* ctx) = 0;
+
+  /// \brief The node receiving the output of this one, none for a sink
+  void set_output(ExecNode* output) { output_ = output; }
+
+ protected:
+  /// \brief Push a batch to the next node, if any
+  Status Emit(FunctionContext* ctx, const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Tell the next node, if any, that no batch will follow
+  Status Finish(FunctionContext* ctx);
+
+  ExecNode* output_;
+};
+
+/// \brief Compute a boolean mask selecting rows of a batch
+using BatchPredicate =
+    std::function<Status(FunctionContext*, const RecordBatch&, Datum* mask)>;
+
+/// \brief A predicate comparing a column of the batches to a scalar, see
+/// Compare()
+ARROW_EXPORT
+BatchPredicate CompareToScalar(const std::string& column, CompareOperator op,
+                               const std::shared_ptr<Scalar>& value);
+
+/// \brief Make a node keeping the rows for which a predicate is true, see
+/// Filter(). Batches left empty are dropped
+ARROW_EXPORT
+std::unique_ptr<ExecNode> MakeFilterNode(BatchPredicate predicate);
+
+/// \brief Make a node keeping the named columns of the batches, in the given
+/// order
+ARROW_EXPORT
+std::unique_ptr<ExecNode> MakeProjectNode(std::vector<std::string> columns);
+
+/// \brief Make a node aggregating its input by groups, see GroupByKernel
+///
+/// The groups are output as a single batch once the input is finished, none
+/// if the input was empty. Batches are aggregated one at a time into a
+/// single hash table, so that this node does not scale with the threads of
+/// the plan, unlike the nodes before it.
+ARROW_EXPORT
+std::unique_ptr<ExecNode> MakeGroupByNode(GroupByOptions options);
+
+/// \brief Make a node handing each batch to a function, one at a time
+ARROW_EXPORT
+std::unique_ptr<ExecNode> MakeSinkNode(
+    std::function<Status(const std::shared_ptr<RecordBatch>&)> consume);
+
+/// \brief Make a node collecting the batches into a vector, which must
+/// outlive the plan
+ARROW_EXPORT
+std::unique_ptr<ExecNode> MakeSinkNode(std::vector<std::shared_ptr<RecordBatch>>* out);
+
+struct ARROW_EXPORT ExecOptions {
+  ExecOptions() : morsel_size(1 << 16), num_threads(0), max_in_flight(0) {}
+
+  /// Source batches are sliced into morsels of at most this many rows, each
+  /// pushed through the plan by one task
+  int64_t morsel_size;
+
+  /// Number of threads of the CPU thread pool to run morsels on, or 0 for
+  /// its capacity. With a single thread, the plan runs on the calling
+  /// thread, in order.
+  int num_threads;
+
+  /// Number of morsels processed or waiting for a thread at any time, or 0
+  /// for twice num_threads. Reading the source blocks until a morsel is done,
+  /// which bounds the memory held by the plan.
+  int max_in_flight;
+};
+
+/// \class ExecPlan
+/// \brief A pipeline of nodes over a stream of record batches
+///
+/// The source is read by the thread calling Run(), which slices its batches
+/// into morsels and pushes each through the nodes as a task of the CPU
+/// thread pool. Readers such as RecordBatchStreamReader or TableBatchReader
+/// can thus be processed without being loaded in memory at once.
+///
+/// Run() must not be called from a task of the CPU thread pool, whose
+/// threads would otherwise all be able to block on each other.
+class ARROW_EXPORT ExecPlan {
+ public:
+  explicit ExecPlan(const std::shared_ptr<RecordBatchReader>& source,
+                    const ExecOptions& options = ExecOptions());
+  ~ExecPlan();
+
+  /// \brief Append a node, receiving the output of the previous one (or the
+  /// source for the first node)
+  void AddNode(std::unique_ptr<ExecNode> node);
+
+  /// \brief Push the whole source through the nodes, then finish them
+  ///
+  /// The first error of a node or of the source stops the reading of the
+  /// source and is returned once the morsels in flight are done. The plan
+  /// can only be run once.
+  Status Run(FunctionContext* ctx);
+
+ private:
+  std::shared_ptr<RecordBatchReader> source_;
+  ExecOptions options_;
+  std::vector<std::unique_ptr<ExecNode>> nodes_;
+  bool ran_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExecPlan);
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_EXEC_PLAN_H
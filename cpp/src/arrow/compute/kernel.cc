@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernel.h"
+
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+
+namespace arrow {
+namespace compute {
+
+Status AllocateOutput(FunctionContext* ctx, const UnaryKernel& kernel, int64_t length,
+                      Datum* out) {
+  std::shared_ptr<DataType> type = kernel.out_type();
+  if (type == nullptr) {
+    return Status::NotImplemented("Kernel output type is not known before the call");
+  }
+  std::vector<int64_t> sizes;
+  RETURN_NOT_OK(kernel.GetOutputBufferSizes(length, &sizes));
+
+  std::vector<std::shared_ptr<Buffer>> buffers(sizes.size());
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    RETURN_NOT_OK(ctx->Allocate(sizes[i], &buffers[i]));
+  }
+  *out = Datum(ArrayData::Make(type, length, buffers));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
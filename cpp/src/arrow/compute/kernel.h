@@ -24,6 +24,8 @@
 #include "arrow/array.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/variant.h"
 #include "arrow/util/visibility.h"
@@ -40,13 +42,65 @@ class ARROW_EXPORT OpKernel {
   virtual ~OpKernel() = default;
 };
 
-/// \brief Placeholder for Scalar values until we implement these
+/// \brief Base class for single values, such as the results of reductions
 struct ARROW_EXPORT Scalar {
-  ~Scalar() {}
+  virtual ~Scalar() = default;
+
+  /// The type of the value
+  std::shared_ptr<DataType> type;
+
+  /// Whether the value is valid, i.e. not null
+  bool is_valid;
+
+ protected:
+  Scalar(const std::shared_ptr<DataType>& type, bool is_valid)
+      : type(type), is_valid(is_valid) {}
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(Scalar);
 };
 
+/// \brief A single value of a type with a C representation, such as numbers
+/// or timestamps
+template <typename Type>
+struct PrimitiveScalar : public Scalar {
+  using c_type = typename Type::c_type;
+
+  /// \brief A valid scalar. The type can be omitted for types without
+  /// parameters
+  explicit PrimitiveScalar(c_type value, const std::shared_ptr<DataType>& type =
+                                             TypeTraits<Type>::type_singleton())
+      : Scalar(type, true), value(value) {}
+
+  /// \brief A null scalar
+  static std::shared_ptr<PrimitiveScalar> MakeNull(
+      const std::shared_ptr<DataType>& type = TypeTraits<Type>::type_singleton()) {
+    std::shared_ptr<PrimitiveScalar> scalar = std::make_shared<PrimitiveScalar>(0, type);
+    scalar->is_valid = false;
+    return scalar;
+  }
+
+  /// The value, undefined (zero) if the scalar is null
+  c_type value;
+};
+
+/// \brief A single decimal value
+struct ARROW_EXPORT Decimal128Scalar : public Scalar {
+  /// \brief A valid scalar of the given Decimal128Type
+  Decimal128Scalar(const Decimal128& value, const std::shared_ptr<DataType>& type)
+      : Scalar(type, true), value(value) {}
+
+  /// \brief A null scalar
+  static std::shared_ptr<Decimal128Scalar> MakeNull(
+      const std::shared_ptr<DataType>& type) {
+    auto scalar = std::make_shared<Decimal128Scalar>(Decimal128(), type);
+    scalar->is_valid = false;
+    return scalar;
+  }
+
+  /// The unscaled value, zero if the scalar is null
+  Decimal128 value;
+};
+
 /// \class Datum
 /// \brief Variant type for various Arrow C++ data structures
 struct ARROW_EXPORT Datum {
@@ -99,6 +153,10 @@ struct ARROW_EXPORT Datum {
     }
   }
 
+  std::shared_ptr<Scalar> scalar() const {
+    return util::get<std::shared_ptr<Scalar>>(this->value);
+  }
+
   std::shared_ptr<ArrayData> array() const {
     return util::get<std::shared_ptr<ArrayData>>(this->value);
   }
@@ -107,6 +165,14 @@ struct ARROW_EXPORT Datum {
     return util::get<std::shared_ptr<ChunkedArray>>(this->value);
   }
 
+  std::shared_ptr<RecordBatch> record_batch() const {
+    return util::get<std::shared_ptr<RecordBatch>>(this->value);
+  }
+
+  std::shared_ptr<Table> table() const {
+    return util::get<std::shared_ptr<Table>>(this->value);
+  }
+
   const std::vector<Datum> collection() const {
     return util::get<std::vector<Datum>>(this->value);
   }
@@ -119,7 +185,9 @@ struct ARROW_EXPORT Datum {
   ///
   /// \return nullptr if no type
   std::shared_ptr<DataType> type() const {
-    if (this->kind() == Datum::ARRAY) {
+    if (this->kind() == Datum::SCALAR) {
+      return util::get<std::shared_ptr<Scalar>>(this->value)->type;
+    } else if (this->kind() == Datum::ARRAY) {
       return util::get<std::shared_ptr<ArrayData>>(this->value)->type;
     } else if (this->kind() == Datum::CHUNKED_ARRAY) {
       return util::get<std::shared_ptr<ChunkedArray>>(this->value)->type();
@@ -132,9 +200,41 @@ struct ARROW_EXPORT Datum {
 /// \brief An array-valued function of a single input argument
 class ARROW_EXPORT UnaryKernel : public OpKernel {
  public:
+  /// \brief Run the kernel on an input
+  ///
+  /// If out already holds an ArrayData with allocated buffers, e.g. made by
+  /// AllocateOutput, kernels supporting it write into those buffers instead of
+  /// allocating new ones. The same output can then be reused across calls.
   virtual Status Call(FunctionContext* ctx, const Datum& input, Datum* out) = 0;
+
+  /// \brief The type of the output, or nullptr if only known once called
+  virtual std::shared_ptr<DataType> out_type() const { return NULLPTR; }
+
+  /// \brief The sizes in bytes of the output buffers for an input of the
+  /// given length, in the order of ArrayData::buffers
+  ///
+  /// No sizes means that the output needs no buffers of its own, e.g. when it
+  /// shares the buffers of the input. Kernels unable to write into
+  /// preallocated buffers return NotImplemented.
+  virtual Status GetOutputBufferSizes(int64_t length, std::vector<int64_t>* sizes) const {
+    return Status::NotImplemented("Kernel cannot write into preallocated buffers");
+  }
 };
 
+/// \brief Allocate an output that kernel writes into for inputs of up to
+/// length values, so that steady-state calls do not allocate
+///
+/// \param[in] ctx the FunctionContext, whose memory pool is used
+/// \param[in] kernel a kernel reporting its output type and buffer sizes
+/// \param[in] length the largest input length
+/// \param[out] out an ARRAY Datum of the given length
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AllocateOutput(FunctionContext* ctx, const UnaryKernel& kernel, int64_t length,
+                      Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
 
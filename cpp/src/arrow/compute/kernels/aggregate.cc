@@ -0,0 +1,511 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/aggregate.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Vectorizable reduction loops
+//
+// Like the numeric cast loops, these are compiled for each instruction set
+// supported by DynamicDispatch. Sums use independent accumulators, so that
+// floating point additions, which the compiler may not reorder, still run in
+// parallel.
+
+constexpr int kSumLanes = 8;
+
+// Runs shorter than this are reduced inline rather than through dispatch
+constexpr int64_t kMinDispatchLength = 16;
+
+#define REDUCTION_LOOPS(SUFFIX, TARGET_ATTR)                                     \
+  template <typename T, typename Acc>                                            \
+  TARGET_ATTR Acc SumValues##SUFFIX(const T* values, int64_t length) {           \
+    Acc lanes[kSumLanes] = {};                                                   \
+    int64_t i = 0;                                                               \
+    for (; i + kSumLanes <= length; i += kSumLanes) {                            \
+      for (int j = 0; j < kSumLanes; ++j) {                                      \
+        lanes[j] += static_cast<Acc>(values[i + j]);                             \
+      }                                                                          \
+    }                                                                            \
+    Acc sum = 0;                                                                 \
+    for (; i < length; ++i) {                                                    \
+      sum += static_cast<Acc>(values[i]);                                        \
+    }                                                                            \
+    for (int j = 0; j < kSumLanes; ++j) {                                        \
+      sum += lanes[j];                                                           \
+    }                                                                            \
+    return sum;                                                                  \
+  }                                                                              \
+                                                                                 \
+  /* Selects rather than std::min / std::max, which compile to packed min/max */ \
+  template <typename T, bool kIsMin>                                             \
+  TARGET_ATTR T MinMaxValues##SUFFIX(const T* values, int64_t length, T init) {  \
+    T out = init;                                                                \
+    for (int64_t i = 0; i < length; ++i) {                                       \
+      const T value = values[i];                                                 \
+      out = (kIsMin ? value < out : value > out) ? value : out;                  \
+    }                                                                            \
+    return out;                                                                  \
+  }
+
+REDUCTION_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+REDUCTION_LOOPS(Sse42, ARROW_TARGET_SSE4_2)
+REDUCTION_LOOPS(Avx2, ARROW_TARGET_AVX2)
+REDUCTION_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef REDUCTION_LOOPS
+
+template <typename T, typename Acc>
+struct SumValuesDynamic {
+  using FunctionType = Acc (*)(const T*, int64_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, SumValuesDefault<T, Acc>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, SumValuesSse42<T, Acc>},
+        {DispatchLevel::AVX2, SumValuesAvx2<T, Acc>},
+        {DispatchLevel::AVX512, SumValuesAvx512<T, Acc>},
+#endif
+    };
+  }
+};
+
+template <typename T, bool kIsMin>
+struct MinMaxValuesDynamic {
+  using FunctionType = T (*)(const T*, int64_t, T);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, MinMaxValuesDefault<T, kIsMin>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, MinMaxValuesSse42<T, kIsMin>},
+        {DispatchLevel::AVX2, MinMaxValuesAvx2<T, kIsMin>},
+        {DispatchLevel::AVX512, MinMaxValuesAvx512<T, kIsMin>},
+#endif
+    };
+  }
+};
+
+template <typename T, typename Acc>
+Acc SumValues(const T* values, int64_t length) {
+  if (length < kMinDispatchLength) {
+    Acc sum = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      sum += static_cast<Acc>(values[i]);
+    }
+    return sum;
+  }
+  static DynamicDispatch<SumValuesDynamic<T, Acc>> dispatch;
+  return dispatch.func(values, length);
+}
+
+template <typename T, bool kIsMin>
+T MinMaxValues(const T* values, int64_t length, T init) {
+  if (length < kMinDispatchLength) {
+    return MinMaxValuesDefault<T, kIsMin>(values, length, init);
+  }
+  static DynamicDispatch<MinMaxValuesDynamic<T, kIsMin>> dispatch;
+  return dispatch.func(values, length, init);
+}
+
+// ----------------------------------------------------------------------
+// Reducers
+//
+// A reducer consumes arrays into a State, merges the states of several
+// arrays and finalizes a state into a scalar. Run-length encoded arrays are
+// consumed with ConsumeRuns, once per run rather than per value.
+
+// Visit the index in values() and the length within the array of the non-null
+// runs of a run-length encoded array
+template <typename Visit>
+void VisitValidRunsOf(const RunLengthEncodedArray& array, Visit&& visit) {
+  const Array& values = *array.values();
+  const int64_t end = array.first_run() + array.num_runs();
+  for (int64_t run = array.first_run(); run < end; ++run) {
+    if (values.IsValid(run)) {
+      visit(run, array.run_length(run));
+    }
+  }
+}
+
+template <typename Type>
+struct SumTraits {
+  using c_type = typename Type::c_type;
+  using OutType = typename std::conditional<
+      std::is_floating_point<c_type>::value, DoubleType,
+      typename std::conditional<std::is_signed<c_type>::value, Int64Type,
+                                UInt64Type>::type>::type;
+};
+
+template <typename Type, typename AccType>
+struct SumReducerBase {
+  using T = typename Type::c_type;
+  using Acc = typename AccType::c_type;
+
+  struct State {
+    Acc sum = 0;
+    int64_t count = 0;
+  };
+
+  static void Consume(const ArrayData& data, State* state) {
+    const T* values = GetValues<T>(data, 1);
+    VisitValidRuns(data, [&](int64_t position, int64_t length) {
+      state->sum += SumValues<T, Acc>(values + position, length);
+      state->count += length;
+    });
+  }
+
+  static void ConsumeRuns(const RunLengthEncodedArray& array, State* state) {
+    const T* values = GetValues<T>(*array.values()->data(), 1);
+    VisitValidRunsOf(array, [&](int64_t run, int64_t length) {
+      state->sum += static_cast<Acc>(values[run]) * static_cast<Acc>(length);
+      state->count += length;
+    });
+  }
+
+  static void Merge(const State& other, State* state) {
+    state->sum += other.sum;
+    state->count += other.count;
+  }
+};
+
+template <typename Type>
+struct SumReducer : public SumReducerBase<Type, typename SumTraits<Type>::OutType> {
+  using OutType = typename SumTraits<Type>::OutType;
+  using State = typename SumReducer::State;
+
+  static std::shared_ptr<Scalar> Finalize(const State& state,
+                                          const std::shared_ptr<DataType>&) {
+    if (state.count == 0) {
+      return PrimitiveScalar<OutType>::MakeNull();
+    }
+    return std::make_shared<PrimitiveScalar<OutType>>(state.sum);
+  }
+};
+
+// The sum is accumulated in double precision, so that large integers do not
+// overflow
+template <typename Type>
+struct MeanReducer : public SumReducerBase<Type, DoubleType> {
+  using State = typename MeanReducer::State;
+
+  static std::shared_ptr<Scalar> Finalize(const State& state,
+                                          const std::shared_ptr<DataType>&) {
+    if (state.count == 0) {
+      return PrimitiveScalar<DoubleType>::MakeNull();
+    }
+    return std::make_shared<PrimitiveScalar<DoubleType>>(
+        state.sum / static_cast<double>(state.count));
+  }
+};
+
+// Sum 128-bit values read in place. The carries out of the low words are
+// counted apart, so that the words are summed independently
+Decimal128 SumDecimals(const uint8_t* values, int64_t length) {
+  uint64_t low = 0;
+  uint64_t high = 0;
+  uint64_t carries = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    uint64_t value_low, value_high;
+    std::memcpy(&value_low, values + i * 16, sizeof(value_low));
+    std::memcpy(&value_high, values + i * 16 + 8, sizeof(value_high));
+    value_low = BitUtil::FromLittleEndian(value_low);
+    low += value_low;
+    carries += low < value_low;
+    high += BitUtil::FromLittleEndian(value_high);
+  }
+  return Decimal128(static_cast<int64_t>(high + carries), low);
+}
+
+// Decimals are summed into a decimal of the maximum precision, with the scale
+// of the input. Sums beyond 128 bits wrap around
+struct DecimalSumReducer {
+  struct State {
+    Decimal128 sum;
+    int64_t count = 0;
+  };
+
+  static void Consume(const ArrayData& data, State* state) {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * 16;
+    VisitValidRuns(data, [&](int64_t position, int64_t length) {
+      state->sum += SumDecimals(values + position * 16, length);
+      state->count += length;
+    });
+  }
+
+  static void ConsumeRuns(const RunLengthEncodedArray& array, State* state) {
+    const auto& values = static_cast<const Decimal128Array&>(*array.values());
+    VisitValidRunsOf(array, [&](int64_t run, int64_t length) {
+      state->sum += Decimal128(values.GetValue(run)) * length;
+      state->count += length;
+    });
+  }
+
+  static void Merge(const State& other, State* state) {
+    state->sum += other.sum;
+    state->count += other.count;
+  }
+
+  static std::shared_ptr<Scalar> Finalize(const State& state,
+                                          const std::shared_ptr<DataType>& type) {
+    const auto out_type =
+        decimal(38, static_cast<const Decimal128Type&>(*type).scale());
+    if (state.count == 0) {
+      return Decimal128Scalar::MakeNull(out_type);
+    }
+    return std::make_shared<Decimal128Scalar>(state.sum, out_type);
+  }
+};
+
+template <typename Type, bool kIsMin>
+struct MinMaxReducer {
+  using T = typename Type::c_type;
+
+  struct State {
+    T value = kIsMin ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+    bool has_value = false;
+  };
+
+  static void Consume(const ArrayData& data, State* state) {
+    const T* values = GetValues<T>(data, 1);
+    VisitValidRuns(data, [&](int64_t position, int64_t length) {
+      state->value = MinMaxValues<T, kIsMin>(values + position, length, state->value);
+      state->has_value = true;
+    });
+  }
+
+  // The extremes of the runs don't depend on their lengths
+  static void ConsumeRuns(const RunLengthEncodedArray& array, State* state) {
+    Consume(*array.values()->Slice(array.first_run(), array.num_runs())->data(),
+            state);
+  }
+
+  static void Merge(const State& other, State* state) {
+    if (other.has_value) {
+      const bool better =
+          kIsMin ? other.value < state->value : other.value > state->value;
+      if (!state->has_value || better) {
+        state->value = other.value;
+      }
+      state->has_value = true;
+    }
+  }
+
+  static std::shared_ptr<Scalar> Finalize(const State& state,
+                                          const std::shared_ptr<DataType>& type) {
+    if (!state.has_value) {
+      return PrimitiveScalar<Type>::MakeNull(type);
+    }
+    return std::make_shared<PrimitiveScalar<Type>>(state.value, type);
+  }
+};
+
+template <typename Type>
+using MinReducer = MinMaxReducer<Type, true>;
+
+template <typename Type>
+using MaxReducer = MinMaxReducer<Type, false>;
+
+struct CountReducer {
+  struct State {
+    int64_t count = 0;
+  };
+
+  static void Consume(const ArrayData& data, State* state) {
+    int64_t null_count = data.null_count;
+    if (null_count == kUnknownNullCount) {
+      null_count = MakeArray(std::make_shared<ArrayData>(data))->null_count();
+    }
+    state->count += data.length - null_count;
+  }
+
+  static void ConsumeRuns(const RunLengthEncodedArray& array, State* state) {
+    VisitValidRunsOf(array,
+                     [&](int64_t, int64_t length) { state->count += length; });
+  }
+
+  static void Merge(const State& other, State* state) { state->count += other.count; }
+
+  static std::shared_ptr<Scalar> Finalize(const State& state,
+                                          const std::shared_ptr<DataType>&) {
+    return std::make_shared<PrimitiveScalar<Int64Type>>(state.count);
+  }
+};
+
+// Reduce an array or the chunks of a chunked array, in parallel if there are
+// several chunks
+template <typename Reducer>
+Status Reduce(FunctionContext* ctx, const Datum& value, Datum* out) {
+  using State = typename Reducer::State;
+
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.array());
+  } else {
+    for (const auto& chunk : value.chunked_array()->chunks()) {
+      if (chunk->length() > 0) {
+        chunks.push_back(chunk->data());
+      }
+    }
+  }
+
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<State> states(num_chunks);
+  auto consume = [&](FunctionContext*, int i) {
+    if (chunks[i]->type->id() == Type::RUN_LENGTH_ENCODED) {
+      Reducer::ConsumeRuns(RunLengthEncodedArray(chunks[i]), &states[i]);
+    } else if (chunks[i]->length > 0) {
+      Reducer::Consume(*chunks[i], &states[i]);
+    }
+    return Status::OK();
+  };
+  if (num_chunks > 1) {
+    RETURN_NOT_OK(detail::ParallelInvoke(ctx, num_chunks, consume));
+  } else if (num_chunks == 1) {
+    RETURN_NOT_OK(consume(ctx, 0));
+  }
+
+  State state;
+  for (const State& chunk_state : states) {
+    Reducer::Merge(chunk_state, &state);
+  }
+  // Run-length encoded arrays reduce to scalars of their value type
+  *out = Datum(Reducer::Finalize(state, detail::RunValueType(value.type())));
+  return Status::OK();
+}
+
+Status CheckArrayLike(const Datum& value, const char* funcname) {
+  if (!value.is_arraylike()) {
+    std::stringstream ss;
+    ss << funcname << " expects an array or a chunked array";
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+template <template <typename> class Reducer>
+Status ReduceNumeric(FunctionContext* ctx, const Datum& value, const char* funcname,
+                     bool allow_temporal, Datum* out) {
+  RETURN_NOT_OK(CheckArrayLike(value, funcname));
+
+#define REDUCE_CASE(InType) \
+  case InType::type_id:     \
+    return Reduce<Reducer<InType>>(ctx, value, out)
+
+  const std::shared_ptr<DataType> type = detail::RunValueType(value.type());
+  switch (type->id()) {
+    REDUCE_CASE(UInt8Type);
+    REDUCE_CASE(Int8Type);
+    REDUCE_CASE(UInt16Type);
+    REDUCE_CASE(Int16Type);
+    REDUCE_CASE(UInt32Type);
+    REDUCE_CASE(Int32Type);
+    REDUCE_CASE(UInt64Type);
+    REDUCE_CASE(Int64Type);
+    REDUCE_CASE(FloatType);
+    REDUCE_CASE(DoubleType);
+    default:
+      break;
+  }
+  if (allow_temporal) {
+    switch (type->id()) {
+      REDUCE_CASE(Date32Type);
+      REDUCE_CASE(Date64Type);
+      REDUCE_CASE(Time32Type);
+      REDUCE_CASE(Time64Type);
+      REDUCE_CASE(TimestampType);
+      default:
+        break;
+    }
+  }
+
+#undef REDUCE_CASE
+
+  std::stringstream ss;
+  ss << funcname << " not implemented for " << value.type()->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+}  // namespace
+
+Status Sum(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "Sum");
+  RETURN_NOT_OK(CheckArrayLike(value, "Sum"));
+  if (detail::RunValueType(value.type())->id() == Type::DECIMAL) {
+    return Reduce<DecimalSumReducer>(ctx, value, out);
+  }
+  return ReduceNumeric<SumReducer>(ctx, value, "Sum", false, out);
+}
+
+Status Mean(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "Mean");
+  return ReduceNumeric<MeanReducer>(ctx, value, "Mean", false, out);
+}
+
+Status Min(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "Min");
+  return ReduceNumeric<MinReducer>(ctx, value, "Min", true, out);
+}
+
+Status Max(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "Max");
+  return ReduceNumeric<MaxReducer>(ctx, value, "Max", true, out);
+}
+
+Status Count(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "Count");
+  RETURN_NOT_OK(CheckArrayLike(value, "Count"));
+  return Reduce<CountReducer>(ctx, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
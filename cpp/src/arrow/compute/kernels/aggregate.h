@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_AGGREGATE_H
+#define ARROW_COMPUTE_KERNELS_AGGREGATE_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+// Reductions of numeric array-like inputs into a Scalar Datum. Null values
+// are skipped. The chunks of a ChunkedArray are reduced in parallel, using up
+// to context->num_threads() threads or context->task_scheduler().
+// Run-length encoded inputs are reduced once per run, as their value type.
+
+/// \brief Sum the non-null values
+/// \param[in] context the FunctionContext
+/// \param[in] value numeric array-like input
+/// \param[out] out int64 scalar for signed integers, uint64 for unsigned
+/// integers, double for floating point input and a Decimal128Scalar of
+/// precision 38 and the input scale for decimals, null if there is no
+/// non-null value
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sum(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the mean of the non-null values
+/// \param[in] context the FunctionContext
+/// \param[in] value numeric array-like input
+/// \param[out] out double scalar, null if there is no non-null value
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Mean(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Find the smallest non-null value
+/// \param[in] context the FunctionContext
+/// \param[in] value numeric array-like input
+/// \param[out] out scalar of the input type, null if there is no non-null
+/// value
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Min(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Find the largest non-null value, see Min
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Max(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Count the non-null values
+/// \param[in] context the FunctionContext
+/// \param[in] value array-like input of any type
+/// \param[out] out int64 scalar
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Count(FunctionContext* context, const Datum& value, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_AGGREGATE_H
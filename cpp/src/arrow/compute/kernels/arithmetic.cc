@@ -0,0 +1,530 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Operators
+//
+// Integer results are computed on an unsigned type at least as wide as int,
+// whose overflow wraps around instead of being undefined. Overflows tells
+// whether the wrapped result of an integer operation differs from the exact
+// one, without branching where possible so that checked loops still
+// vectorize.
+
+template <typename T>
+using WrappingType =
+    typename std::common_type<typename std::make_unsigned<T>::type, unsigned int>::type;
+
+template <typename T>
+using enable_if_integral_t = typename std::enable_if<std::is_integral<T>::value, T>::type;
+
+template <typename T>
+using enable_if_floating_t =
+    typename std::enable_if<std::is_floating_point<T>::value, T>::type;
+
+struct Add {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) +
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left + right;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_signed<T>::value, bool>::type Overflows(
+      T left, T right, T result) {
+    // The result has the sign of neither operand
+    return ((left ^ result) & (right ^ result)) < 0;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_unsigned<T>::value, bool>::type Overflows(
+      T left, T right, T result) {
+    return result < left;
+  }
+};
+
+struct Subtract {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) -
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left - right;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_signed<T>::value, bool>::type Overflows(
+      T left, T right, T result) {
+    // The operands have different signs, and the result has the sign of the
+    // right one
+    return ((left ^ right) & (left ^ result)) < 0;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_unsigned<T>::value, bool>::type Overflows(
+      T left, T right, T result) {
+    return left < right;
+  }
+};
+
+struct Multiply {
+  template <typename T>
+  static enable_if_integral_t<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) *
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left * right;
+  }
+
+  // Integers narrower than 64 bits are multiplied exactly in 64 bits
+  template <typename T>
+  static typename std::enable_if<(sizeof(T) < 8), bool>::type Overflows(T left, T right,
+                                                                       T result) {
+    using Wide = typename std::conditional<std::is_signed<T>::value, int64_t,
+                                           uint64_t>::type;
+    return static_cast<Wide>(left) * static_cast<Wide>(right) !=
+           static_cast<Wide>(result);
+  }
+
+  template <typename T>
+  static typename std::enable_if<sizeof(T) == 8, bool>::type Overflows(T left, T right,
+                                                                      T result) {
+#if defined(__GNUC__)
+    T exact;
+    return __builtin_mul_overflow(left, right, &exact);
+#else
+    if (left == 0) {
+      return false;
+    }
+    if (std::is_signed<T>::value && left == static_cast<T>(-1)) {
+      return right == std::numeric_limits<T>::min();
+    }
+    return result / left != right;
+#endif
+  }
+};
+
+// Only floating point division is vectorized, see DivideIntegers
+struct Divide {
+  template <typename T>
+  static enable_if_floating_t<T> Call(T left, T right) {
+    return left / right;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Vectorizable arithmetic loops
+//
+// As for the comparison loops, the operations are compiled for each
+// instruction set supported by DynamicDispatch. The checked loops compute the
+// wrapped results along with whether any of them overflowed.
+
+#define ARITHMETIC_LOOPS(SUFFIX, TARGET_ATTR)                                     \
+  template <typename T, typename Op>                                              \
+  TARGET_ATTR void ArithmeticArrays##SUFFIX(const T* left, const T* right,        \
+                                            int64_t length, T* out) {             \
+    for (int64_t i = 0; i < length; ++i) {                                        \
+      out[i] = Op::Call(left[i], right[i]);                                       \
+    }                                                                             \
+  }                                                                               \
+                                                                                  \
+  template <typename T, typename Op>                                              \
+  TARGET_ATTR bool CheckedArithmeticArrays##SUFFIX(const T* left, const T* right, \
+                                                   int64_t length, T* out) {      \
+    bool overflow = false;                                                        \
+    for (int64_t i = 0; i < length; ++i) {                                        \
+      const T result = Op::Call(left[i], right[i]);                               \
+      overflow |= Op::Overflows(left[i], right[i], result);                       \
+      out[i] = result;                                                            \
+    }                                                                             \
+    return overflow;                                                              \
+  }
+
+ARITHMETIC_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ARITHMETIC_LOOPS(Sse42, ARROW_TARGET_SSE4_2)
+ARITHMETIC_LOOPS(Avx2, ARROW_TARGET_AVX2)
+ARITHMETIC_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef ARITHMETIC_LOOPS
+
+template <typename T, typename Op>
+struct ArithmeticArraysDynamic {
+  using FunctionType = void (*)(const T*, const T*, int64_t, T*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, ArithmeticArraysDefault<T, Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, ArithmeticArraysSse42<T, Op>},
+        {DispatchLevel::AVX2, ArithmeticArraysAvx2<T, Op>},
+        {DispatchLevel::AVX512, ArithmeticArraysAvx512<T, Op>},
+#endif
+    };
+  }
+};
+
+template <typename T, typename Op>
+struct CheckedArithmeticArraysDynamic {
+  using FunctionType = bool (*)(const T*, const T*, int64_t, T*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, CheckedArithmeticArraysDefault<T, Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, CheckedArithmeticArraysSse42<T, Op>},
+        {DispatchLevel::AVX2, CheckedArithmeticArraysAvx2<T, Op>},
+        {DispatchLevel::AVX512, CheckedArithmeticArraysAvx512<T, Op>},
+#endif
+    };
+  }
+};
+
+// ----------------------------------------------------------------------
+// Arithmetic on blocks of values
+//
+// Errors are only raised for valid slots, whose bits are looked up in the
+// output validity bitmap, or nullptr if all slots are valid.
+
+inline bool IsValid(const uint8_t* validity, int64_t i) {
+  return validity == nullptr || BitUtil::GetBit(validity, i);
+}
+
+template <typename T, typename Op, typename Enable = void>
+struct ArithmeticBlock {
+  static Status Call(const T* left, const T* right, int64_t length,
+                     const uint8_t* validity, int64_t offset, bool check_overflow,
+                     T* out) {
+    if (!check_overflow) {
+      static DynamicDispatch<ArithmeticArraysDynamic<T, Op>> dispatch;
+      dispatch.func(left, right, length, out);
+      return Status::OK();
+    }
+    static DynamicDispatch<CheckedArithmeticArraysDynamic<T, Op>> checked_dispatch;
+    if (ARROW_PREDICT_TRUE(!checked_dispatch.func(left, right, length, out))) {
+      return Status::OK();
+    }
+    // Some value overflowed, which only matters if it is valid
+    for (int64_t i = 0; i < length; ++i) {
+      if (IsValid(validity, offset + i) && Op::Overflows(left[i], right[i], out[i])) {
+        return Status::Invalid("Integer overflow");
+      }
+    }
+    return Status::OK();
+  }
+};
+
+template <typename T, typename Op>
+struct ArithmeticBlock<T, Op,
+                       typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static Status Call(const T* left, const T* right, int64_t length,
+                     const uint8_t* validity, int64_t offset, bool check_overflow,
+                     T* out) {
+    static DynamicDispatch<ArithmeticArraysDynamic<T, Op>> dispatch;
+    dispatch.func(left, right, length, out);
+    return Status::OK();
+  }
+};
+
+// Integer division, for which there are no vector instructions. The quotient
+// of the minimum value by -1 overflows and wraps around to the minimum value
+template <typename T>
+struct ArithmeticBlock<T, Divide,
+                       typename std::enable_if<std::is_integral<T>::value>::type> {
+  static Status Call(const T* left, const T* right, int64_t length,
+                     const uint8_t* validity, int64_t offset, bool check_overflow,
+                     T* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      const T divisor = right[i];
+      if (ARROW_PREDICT_FALSE(divisor == 0)) {
+        if (IsValid(validity, offset + i)) {
+          return Status::Invalid("Integer division by zero");
+        }
+        out[i] = 0;
+      } else if (std::is_signed<T>::value && divisor == static_cast<T>(-1)) {
+        if (check_overflow && left[i] == std::numeric_limits<T>::min() &&
+            IsValid(validity, offset + i)) {
+          return Status::Invalid("Integer overflow");
+        }
+        out[i] = Subtract::Call(static_cast<T>(0), left[i]);
+      } else {
+        out[i] = static_cast<T>(left[i] / divisor);
+      }
+    }
+    return Status::OK();
+  }
+};
+
+// ----------------------------------------------------------------------
+// Arithmetic on array pieces
+
+// Number of values computed at a time. Scalars are broadcast into a block of
+// this size, so that the same loops serve array and scalar sides
+constexpr int64_t kArithmeticBlockSize = 1024;
+
+// One side of an operation on a piece: an array, or a scalar
+struct Operand {
+  const ArrayData* array;
+  const Scalar* scalar;
+};
+
+template <typename Type>
+const typename Type::c_type* GetOperandValues(const Operand& operand,
+                                              typename Type::c_type* block) {
+  using T = typename Type::c_type;
+  if (operand.array != nullptr) {
+    return GetValues<T>(*operand.array, 1);
+  }
+  std::fill(block, block + kArithmeticBlockSize,
+            static_cast<const PrimitiveScalar<Type>&>(*operand.scalar).value);
+  return block;
+}
+
+template <typename Type, typename Op>
+Status ArithmeticValues(const Operand& left, const Operand& right, bool check_overflow,
+                        ArrayData* out) {
+  using T = typename Type::c_type;
+  T left_block[kArithmeticBlockSize];
+  T right_block[kArithmeticBlockSize];
+  const T* left_values = GetOperandValues<Type>(left, left_block);
+  const T* right_values = GetOperandValues<Type>(right, right_block);
+  const uint8_t* validity = out->buffers[0] ? out->buffers[0]->data() : nullptr;
+  T* out_values = reinterpret_cast<T*>(out->buffers[1]->mutable_data());
+
+  for (int64_t i = 0; i < out->length; i += kArithmeticBlockSize) {
+    const int64_t block_length = std::min(kArithmeticBlockSize, out->length - i);
+    RETURN_NOT_OK((ArithmeticBlock<T, Op>::Call(
+        left.array != nullptr ? left_values + i : left_values,
+        right.array != nullptr ? right_values + i : right_values, block_length,
+        validity, i, check_overflow, out_values + i)));
+  }
+  return Status::OK();
+}
+
+template <typename Op>
+Status ArithmeticPiece(FunctionContext* ctx, const Operand& left, const Operand& right,
+                       bool check_overflow, std::shared_ptr<Array>* out) {
+  const ArrayData& reference = left.array != nullptr ? *left.array : *right.array;
+  const int64_t length = reference.length;
+  const int64_t value_size =
+      static_cast<const FixedWidthType&>(*reference.type).bit_width() / 8;
+  auto result = std::make_shared<ArrayData>(reference.type, length);
+  result->buffers.resize(2);
+  RETURN_NOT_OK(ctx->Allocate(length * value_size, &result->buffers[1]));
+
+  const Scalar* scalar = left.scalar != nullptr ? left.scalar : right.scalar;
+  if (scalar != nullptr && !scalar->is_valid) {
+    // Arithmetic with null is null
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length, &result->buffers[0]));
+    std::memset(result->buffers[1]->mutable_data(), 0, length * value_size);
+    result->null_count = length;
+    *out = MakeArray(result);
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(detail::ComputeValidity(
+      ctx, reference, scalar != nullptr ? nullptr : right.array, result.get()));
+
+#define NUMERIC_CASE(InType)                                                        \
+  case InType::type_id:                                                             \
+    RETURN_NOT_OK(                                                                  \
+        (ArithmeticValues<InType, Op>(left, right, check_overflow, result.get()))); \
+    break
+
+  switch (reference.type->id()) {
+    NUMERIC_CASE(UInt8Type);
+    NUMERIC_CASE(Int8Type);
+    NUMERIC_CASE(UInt16Type);
+    NUMERIC_CASE(Int16Type);
+    NUMERIC_CASE(UInt32Type);
+    NUMERIC_CASE(Int32Type);
+    NUMERIC_CASE(UInt64Type);
+    NUMERIC_CASE(Int64Type);
+    NUMERIC_CASE(FloatType);
+    NUMERIC_CASE(DoubleType);
+    default:
+      DCHECK(false) << "Arithmetic on unsupported type";
+      break;
+  }
+
+#undef NUMERIC_CASE
+
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+typedef Status (*ArithmeticPieceFunction)(FunctionContext*, const Operand&,
+                                          const Operand&, bool,
+                                          std::shared_ptr<Array>*);
+
+ArithmeticPieceFunction GetArithmeticPieceFunction(ArithmeticOperator op) {
+  switch (op) {
+    case ArithmeticOperator::ADD:
+      return ArithmeticPiece<Add>;
+    case ArithmeticOperator::SUBTRACT:
+      return ArithmeticPiece<Subtract>;
+    case ArithmeticOperator::MULTIPLY:
+      return ArithmeticPiece<Multiply>;
+    case ArithmeticOperator::DIVIDE:
+      return ArithmeticPiece<Divide>;
+  }
+  return nullptr;
+}
+
+bool IsArithmeticType(const DataType& type) {
+  switch (type.id()) {
+    case Type::UINT8:
+    case Type::INT8:
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+int64_t DatumLength(const Datum& value) {
+  return value.kind() == Datum::ARRAY ? value.array()->length
+                                      : value.chunked_array()->length();
+}
+
+}  // namespace
+
+Status Arithmetic(FunctionContext* ctx, const Datum& left, const Datum& right,
+                  const ArithmeticOptions& options, Datum* out) {
+  KernelProfileScope profile(ctx, "Arithmetic");
+  const bool left_scalar = left.kind() == Datum::SCALAR;
+  const bool right_scalar = right.kind() == Datum::SCALAR;
+  if (!(left.is_arraylike() || left_scalar) || !(right.is_arraylike() || right_scalar)) {
+    return Status::Invalid("Arithmetic expects arrays, chunked arrays or scalars");
+  }
+  if (left_scalar && right_scalar) {
+    return Status::Invalid("Arithmetic needs at least one array-like side");
+  }
+  if (!left.type()->Equals(*right.type())) {
+    std::stringstream ss;
+    ss << "Arithmetic needs sides of the same type, got " << left.type()->ToString()
+       << " and " << right.type()->ToString();
+    return Status::Invalid(ss.str());
+  }
+  if (!IsArithmeticType(*left.type())) {
+    return Status::NotImplemented("Arithmetic not implemented for " +
+                                  left.type()->ToString());
+  }
+
+  const Datum& array_side = left_scalar ? right : left;
+  std::vector<std::shared_ptr<Array>> left_pieces, right_pieces;
+  if (left_scalar || right_scalar) {
+    auto* pieces = left_scalar ? &right_pieces : &left_pieces;
+    if (array_side.kind() == Datum::ARRAY) {
+      pieces->push_back(MakeArray(array_side.array()));
+    } else {
+      *pieces = array_side.chunked_array()->chunks();
+    }
+  } else {
+    if (DatumLength(left) != DatumLength(right)) {
+      return Status::Invalid("Arithmetic needs array-like sides of the same length");
+    }
+    detail::AlignChunks(left, right, &left_pieces, &right_pieces);
+  }
+
+  ArithmeticPieceFunction compute = GetArithmeticPieceFunction(options.op);
+  DCHECK_NE(compute, nullptr);
+  const int num_pieces =
+      static_cast<int>(left_scalar ? right_pieces.size() : left_pieces.size());
+  std::vector<std::shared_ptr<Array>> outputs(num_pieces);
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_pieces, [&](FunctionContext* task_ctx, int i) {
+        Operand left_operand = {left_scalar ? nullptr : left_pieces[i]->data().get(),
+                                left_scalar ? left.scalar().get() : nullptr};
+        Operand right_operand = {right_scalar ? nullptr : right_pieces[i]->data().get(),
+                                 right_scalar ? right.scalar().get() : nullptr};
+        return compute(task_ctx, left_operand, right_operand, options.check_overflow,
+                       &outputs[i]);
+      }));
+
+  if (left.kind() != Datum::CHUNKED_ARRAY && right.kind() != Datum::CHUNKED_ARRAY) {
+    *out = Datum(outputs[0]);
+    return Status::OK();
+  }
+  if (outputs.empty()) {
+    // Chunked arrays of length 0
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), left.type(), &builder));
+    outputs.emplace_back();
+    RETURN_NOT_OK(builder->Finish(&outputs.back()));
+  }
+  *out = Datum(std::make_shared<ChunkedArray>(outputs));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+#define ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+enum class ArithmeticOperator { ADD, SUBTRACT, MULTIPLY, DIVIDE };
+
+struct ARROW_EXPORT ArithmeticOptions {
+  explicit ArithmeticOptions(ArithmeticOperator op, bool check_overflow = false)
+      : op(op), check_overflow(check_overflow) {}
+
+  ArithmeticOperator op;
+
+  /// Whether integer overflow is an error. Otherwise integer results wrap
+  /// around, as with two's complement arithmetic
+  bool check_overflow;
+};
+
+/// \brief Add, subtract, multiply or divide values element-wise
+///
+/// Either side can be an array-like Datum or a scalar, but not both scalars.
+/// Array-like sides must have the same length; chunked arrays need not be
+/// chunked alike. Both sides must have the same numeric type, which is the
+/// type of the output. The output is null where either side is null, and is
+/// a chunked array if either side is one.
+///
+/// Integer division truncates towards zero, and dividing a valid value by
+/// zero is an error. Floating point operations follow IEEE 754, and never
+/// fail.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left left-hand side
+/// \param[in] right right-hand side
+/// \param[in] options the operator and overflow checking
+/// \param[out] out array-like output
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Arithmetic(FunctionContext* context, const Datum& left, const Datum& right,
+                  const ArithmeticOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ARITHMETIC_H
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/bloom-filter.h"
+
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/bloom-filter.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+std::vector<std::shared_ptr<ArrayData>> GetChunks(const Datum& values) {
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.array());
+  } else {
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  }
+  return chunks;
+}
+
+}  // namespace
+
+Status BuildBloomFilter(FunctionContext* ctx, const Datum& values,
+                        std::shared_ptr<BlockedBloomFilter>* out) {
+  KernelProfileScope profile(ctx, "BuildBloomFilter");
+  if (!values.is_arraylike()) {
+    return Status::Invalid("BuildBloomFilter expects an array or a chunked array");
+  }
+  const std::vector<std::shared_ptr<ArrayData>> chunks = GetChunks(values);
+  int64_t num_values = 0;
+  for (const auto& chunk : chunks) {
+    num_values += chunk->length;
+  }
+  std::shared_ptr<BlockedBloomFilter> filter;
+  RETURN_NOT_OK(BlockedBloomFilter::Make(num_values, ctx->memory_pool(), &filter));
+  for (const auto& chunk : chunks) {
+    RETURN_NOT_OK(filter->Insert(*chunk));
+  }
+  *out = filter;
+  return Status::OK();
+}
+
+Status BloomFilterMayContain(FunctionContext* ctx, const BlockedBloomFilter& filter,
+                             const Datum& values, Datum* out) {
+  KernelProfileScope profile(ctx, "BloomFilterMayContain");
+  if (!values.is_arraylike()) {
+    return Status::Invalid("BloomFilterMayContain expects an array or a chunked array");
+  }
+  const std::vector<std::shared_ptr<ArrayData>> chunks = GetChunks(values);
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<std::shared_ptr<Array>> outputs(num_chunks);
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_chunks, [&](FunctionContext* task_ctx, int i) {
+        const ArrayData& chunk = *chunks[i];
+        std::shared_ptr<Buffer> bits;
+        RETURN_NOT_OK(task_ctx->Allocate(BitUtil::BytesForBits(chunk.length), &bits));
+        RETURN_NOT_OK(filter.Find(chunk, bits->mutable_data()));
+        outputs[i] =
+            MakeArray(ArrayData::Make(boolean(), chunk.length, {nullptr, bits}, 0));
+        return Status::OK();
+      }));
+
+  if (values.kind() == Datum::ARRAY) {
+    *out = Datum(outputs[0]->data());
+    return Status::OK();
+  }
+  if (outputs.empty()) {
+    // Chunked arrays of length 0
+    std::shared_ptr<Buffer> bits;
+    RETURN_NOT_OK(ctx->Allocate(0, &bits));
+    outputs.push_back(MakeArray(ArrayData::Make(boolean(), 0, {nullptr, bits}, 0)));
+  }
+  *out = Datum(std::make_shared<ChunkedArray>(outputs));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
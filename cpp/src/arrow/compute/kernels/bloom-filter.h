@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_BLOOM_FILTER_H
+#define ARROW_COMPUTE_KERNELS_BLOOM_FILTER_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class BlockedBloomFilter;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \brief Build a Bloom filter of the non-null values of an array-like
+/// input, such as the keys of the build side of a join
+///
+/// The filter is sized for the number of values with
+/// BlockedBloomFilter::kDefaultBitsPerValue bits per value. The chunks of a
+/// ChunkedArray are inserted in order into the same filter.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input, see BlockedBloomFilter::Insert
+/// \param[out] out the filter
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status BuildBloomFilter(FunctionContext* context, const Datum& values,
+                        std::shared_ptr<BlockedBloomFilter>* out);
+
+/// \brief Probe a Bloom filter with the values of an array-like input
+///
+/// The output is true for the values which may have been inserted into the
+/// filter and false for the others and for nulls, so that filtering the
+/// probe side of a semi-join or inner join by it drops most of the rows
+/// without a match before the join. The chunks of a ChunkedArray are probed
+/// in parallel.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] filter the filter
+/// \param[in] values array-like input, hashed as by BlockedBloomFilter::Insert
+/// \param[out] out boolean array-like output without nulls, of the shape of
+/// values
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status BloomFilterMayContain(FunctionContext* context, const BlockedBloomFilter& filter,
+                             const Datum& values, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_BLOOM_FILTER_H
@@ -17,11 +17,18 @@
 
 #include "arrow/compute/kernels/cast.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -32,15 +39,22 @@
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/compare.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
+#include "arrow/util/string-view-util.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
 
 #ifdef ARROW_EXTRA_ERROR_CONTEXT
 
@@ -71,6 +85,9 @@
 namespace arrow {
 namespace compute {
 
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
 constexpr int64_t kMillisecondsInDay = 86400000;
 
 // ----------------------------------------------------------------------
@@ -214,6 +231,89 @@ struct CastFunctor<O, I,
   }
 };
 
+// ----------------------------------------------------------------------
+// Vectorizable numeric conversion loops
+//
+// The loops below are simple enough for the compiler to vectorize. On x86 they
+// are additionally compiled for wider instruction sets, and the best variant
+// supported by the host is selected through DynamicDispatch.
+
+// Number of values validated at once by the safe integer downcasts
+constexpr int64_t kCastCheckBlockSize = 512;
+
+#define NUMERIC_CAST_LOOPS(SUFFIX, TARGET_ATTR)                                 \
+  template <typename I, typename O>                                             \
+  TARGET_ATTR void ConvertValues##SUFFIX(const I* in, int64_t length, O* out) { \
+    for (int64_t i = 0; i < length; ++i) {                                      \
+      out[i] = static_cast<O>(in[i]);                                           \
+    }                                                                           \
+  }                                                                             \
+                                                                                \
+  /* A branch-free reduction, so that a whole block is checked at once */       \
+  template <typename T>                                                         \
+  TARGET_ATTR bool ValuesInRange##SUFFIX(const T* values, int64_t length,       \
+                                         T min, T max) {                        \
+    int out_of_range = 0;                                                       \
+    for (int64_t i = 0; i < length; ++i) {                                      \
+      out_of_range |= (values[i] < min) | (values[i] > max);                    \
+    }                                                                           \
+    return out_of_range == 0;                                                   \
+  }
+
+NUMERIC_CAST_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+NUMERIC_CAST_LOOPS(Sse42, ARROW_TARGET_SSE4_2)
+NUMERIC_CAST_LOOPS(Avx2, ARROW_TARGET_AVX2)
+NUMERIC_CAST_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef NUMERIC_CAST_LOOPS
+
+template <typename I, typename O>
+struct ConvertValuesDynamic {
+  using FunctionType = void (*)(const I*, int64_t, O*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, ConvertValuesDefault<I, O>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, ConvertValuesSse42<I, O>},
+        {DispatchLevel::AVX2, ConvertValuesAvx2<I, O>},
+        {DispatchLevel::AVX512, ConvertValuesAvx512<I, O>},
+#endif
+    };
+  }
+};
+
+template <typename T>
+struct ValuesInRangeDynamic {
+  using FunctionType = bool (*)(const T*, int64_t, T, T);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, ValuesInRangeDefault<T>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, ValuesInRangeSse42<T>},
+        {DispatchLevel::AVX2, ValuesInRangeAvx2<T>},
+        {DispatchLevel::AVX512, ValuesInRangeAvx512<T>},
+#endif
+    };
+  }
+};
+
+template <typename I, typename O>
+void ConvertValues(const I* in, int64_t length, O* out) {
+  static DynamicDispatch<ConvertValuesDynamic<I, O>> dispatch;
+  dispatch.func(in, length, out);
+}
+
+template <typename T>
+bool ValuesInRange(const T* values, int64_t length, T min, T max) {
+  static DynamicDispatch<ValuesInRangeDynamic<T>> dispatch;
+  return dispatch.func(values, length, min, max);
+}
+
 template <typename O, typename I>
 struct CastFunctor<O, I,
                    typename std::enable_if<is_integer_downcast<O, I>::value>::type> {
@@ -222,39 +322,38 @@ struct CastFunctor<O, I,
     using in_type = typename I::c_type;
     using out_type = typename O::c_type;
 
-    auto in_offset = input.offset;
-
     const in_type* in_data = GetValues<in_type>(input, 1);
     auto out_data = GetMutableValues<out_type>(output, 1);
 
-    if (!options.allow_int_overflow) {
-      constexpr in_type kMax = static_cast<in_type>(std::numeric_limits<out_type>::max());
-      constexpr in_type kMin = static_cast<in_type>(std::numeric_limits<out_type>::min());
-
-      // Null count may be -1 if the input array had been sliced
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  (*in_data > kMax || *in_data < kMin))) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-          }
-          *out_data++ = static_cast<out_type>(*in_data++);
-          is_valid_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(*in_data > kMax || *in_data < kMin)) {
+    if (options.allow_int_overflow) {
+      ConvertValues(in_data, input.length, out_data);
+      return;
+    }
+
+    constexpr in_type kMax = static_cast<in_type>(std::numeric_limits<out_type>::max());
+    constexpr in_type kMin =
+        std::is_signed<in_type>::value
+            ? static_cast<in_type>(std::numeric_limits<out_type>::min())
+            : 0;
+
+    const uint8_t* valid_bits =
+        NeedsValidityChecks(input) ? input.buffers[0]->data() : nullptr;
+
+    for (int64_t start = 0; start < input.length; start += kCastCheckBlockSize) {
+      const int64_t block_length = std::min(kCastCheckBlockSize, input.length - start);
+      const in_type* block = in_data + start;
+      if (ARROW_PREDICT_FALSE(!ValuesInRange(block, block_length, kMin, kMax))) {
+        // Slow path: out-of-range values are only an error in non-null slots
+        for (int64_t i = 0; i < block_length; ++i) {
+          if ((block[i] > kMax || block[i] < kMin) &&
+              (valid_bits == nullptr ||
+               BitUtil::GetBit(valid_bits, input.offset + start + i))) {
             ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+            return;
           }
-          *out_data++ = static_cast<out_type>(*in_data++);
         }
       }
-    } else {
-      for (int64_t i = 0; i < input.length; ++i) {
-        *out_data++ = static_cast<out_type>(*in_data++);
-      }
+      ConvertValues(block, block_length, out_data + start);
     }
   }
 };
@@ -270,9 +369,7 @@ struct CastFunctor<O, I,
 
     const in_type* in_data = GetValues<in_type>(input, 1);
     auto out_data = GetMutableValues<out_type>(output, 1);
-    for (int64_t i = 0; i < input.length; ++i) {
-      *out_data++ = static_cast<out_type>(*in_data++);
-    }
+    ConvertValues(in_data, input.length, out_data);
   }
 };
 
@@ -305,25 +402,40 @@ void ShiftTime(FunctionContext* ctx, const CastOptions& options, const bool is_m
      << " would lose data: " << VAL;                                                    \
   ctx->SetStatus(Status::Invalid(ss.str()));
 
-      if (input.null_count != 0) {
-        internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                          input.length);
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (bit_reader.IsSet() && (out_data[i] * factor != in_data[i])) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
+      const uint8_t* valid_bits =
+          NeedsValidityChecks(input) ? input.buffers[0]->data() : nullptr;
+
+      // Blocks without nulls are checked with a loop without branches, and only
+      // the blocks with some nulls test their validity bits one by one
+      internal::BitBlockCounter counter(valid_bits, input.offset, input.length);
+      int64_t position = 0;
+      for (internal::BitBlockCount block = counter.NextBlock(); block.length > 0;
+           block = counter.NextBlock()) {
+        const in_type* block_in = in_data + position;
+        out_type* block_out = out_data + position;
+        for (int64_t i = 0; i < block.length; i++) {
+          block_out[i] = static_cast<out_type>(block_in[i] / factor);
+        }
+        bool check_bits = !block.AllSet() && !block.NoneSet();
+        if (block.AllSet()) {
+          bool lost_data = false;
+          for (int64_t i = 0; i < block.length; i++) {
+            lost_data |= block_out[i] * factor != block_in[i];
           }
-          bit_reader.Next();
+          check_bits = lost_data;
         }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (out_data[i] * factor != in_data[i]) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
+        if (ARROW_PREDICT_FALSE(check_bits)) {
+          // Slow path: find the first valid value losing data
+          for (int64_t i = 0; i < block.length; i++) {
+            if ((valid_bits == nullptr ||
+                 BitUtil::GetBit(valid_bits, input.offset + position + i)) &&
+                block_out[i] * factor != block_in[i]) {
+              RAISE_INVALID_CAST(block_in[i]);
+              return;
+            }
           }
         }
+        position += block.length;
       }
 
 #undef RAISE_INVALID_CAST
@@ -396,21 +508,30 @@ struct CastFunctor<Date64Type, TimestampType> {
     ShiftTime<int64_t, int64_t>(ctx, options, conversion.first, conversion.second, input,
                                 output);
 
-    internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                      input.length);
+    if (NeedsValidityChecks(input)) {
+      TruncateToDays<true>(ctx, options, input, output);
+    } else {
+      TruncateToDays<false>(ctx, options, input, output);
+    }
+  }
 
-    // Ensure that intraday milliseconds have been zeroed out
+ private:
+  // Ensure that intraday milliseconds have been zeroed out
+  template <bool kHasNulls>
+  void TruncateToDays(FunctionContext* ctx, const CastOptions& options,
+                      const ArrayData& input, ArrayData* output) {
+    const uint8_t* valid_bits = kHasNulls ? input.buffers[0]->data() : nullptr;
     auto out_data = GetMutableValues<int64_t>(output, 1);
     for (int64_t i = 0; i < input.length; ++i) {
       const int64_t remainder = out_data[i] % kMillisecondsInDay;
-      if (ARROW_PREDICT_FALSE(!options.allow_time_truncate && bit_reader.IsSet() &&
-                              remainder > 0)) {
+      if (ARROW_PREDICT_FALSE(
+              !options.allow_time_truncate && remainder > 0 &&
+              (!kHasNulls || BitUtil::GetBit(valid_bits, input.offset + i)))) {
         ctx->SetStatus(
             Status::Invalid("Timestamp value had non-zero intraday milliseconds"));
         break;
       }
       out_data[i] -= remainder;
-      bit_reader.Next();
     }
   }
 };
@@ -502,11 +623,185 @@ class ListCastKernel : public UnaryKernel {
     return Status::OK();
   }
 
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
  private:
   std::unique_ptr<UnaryKernel> child_caster_;
   std::shared_ptr<DataType> out_type_;
 };
 
+// ----------------------------------------------------------------------
+// Between 32- and 64-bit offsets
+
+// Cast of binary, string and list arrays to their variant with the other
+// offset width. The offsets are converted, the value data is shared with the
+// input, and list values are cast by child_caster if their type changes too
+template <typename InOffset, typename OutOffset>
+class OffsetWidthCastKernel : public UnaryKernel {
+ public:
+  OffsetWidthCastKernel(std::unique_ptr<UnaryKernel> child_caster,
+                        const std::shared_ptr<DataType>& out_type)
+      : child_caster_(std::move(child_caster)), out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const ArrayData& in_data = *input.array();
+    const int64_t length = in_data.length;
+    const InOffset* in_offsets = GetValues<InOffset>(in_data, 1);
+
+    // Offsets are non-decreasing, so only the last one can overflow
+    if (sizeof(OutOffset) < sizeof(InOffset) && length > 0 &&
+        in_offsets[length] > std::numeric_limits<OutOffset>::max()) {
+      std::stringstream ss;
+      ss << "Offset " << in_offsets[length] << " does not fit in "
+         << out_type_->ToString() << " offsets";
+      return Status::Invalid(ss.str());
+    }
+
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(OutOffset), &offsets));
+    auto out_offsets = reinterpret_cast<OutOffset*>(offsets->mutable_data());
+    if (length > 0) {
+      std::copy(in_offsets, in_offsets + length + 1, out_offsets);
+    } else {
+      out_offsets[0] = 0;
+    }
+
+    std::shared_ptr<Buffer> bitmap = in_data.buffers[0];
+    if (bitmap != nullptr && in_data.offset != 0) {
+      RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), bitmap->data(), in_data.offset,
+                               length, &bitmap));
+    }
+
+    auto result = ArrayData::Make(out_type_, length, {bitmap, offsets},
+                                  in_data.null_count);
+    if (in_data.buffers.size() > 2) {
+      // Binary value data
+      result->buffers.push_back(in_data.buffers[2]);
+    }
+    if (!in_data.child_data.empty()) {
+      std::shared_ptr<ArrayData> values = in_data.child_data[0];
+      if (child_caster_ != nullptr) {
+        Datum casted_child;
+        RETURN_NOT_OK(child_caster_->Call(ctx, Datum(values), &casted_child));
+        values = casted_child.array();
+      }
+      result->child_data.push_back(values);
+    }
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ private:
+  std::unique_ptr<UnaryKernel> child_caster_;
+  std::shared_ptr<DataType> out_type_;
+};
+
+// ----------------------------------------------------------------------
+// Strings to and from string views
+
+// The strings are viewed where they are: the value data of the input is the
+// only data buffer of the output, so that only the entries are allocated
+class StringToViewCastKernel : public UnaryKernel {
+ public:
+  explicit StringToViewCastKernel(const std::shared_ptr<DataType>& out_type)
+      : out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const ArrayData& in_data = *input.array();
+    const int64_t length = in_data.length;
+    const int32_t* offsets = GetValues<int32_t>(in_data, 1);
+    const std::shared_ptr<Buffer>& value_data = in_data.buffers[2];
+    const uint8_t* data = value_data != nullptr ? value_data->data() : nullptr;
+
+    std::shared_ptr<Buffer> views;
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(StringViewEntry), &views));
+    auto out_views = reinterpret_cast<StringViewEntry*>(views->mutable_data());
+    for (int64_t i = 0; i < length; ++i) {
+      out_views[i] = internal::MakeStringView(data + offsets[i],
+                                              offsets[i + 1] - offsets[i], 0, offsets[i]);
+    }
+
+    std::shared_ptr<Buffer> bitmap = in_data.buffers[0];
+    if (bitmap != nullptr && in_data.offset != 0) {
+      RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), bitmap->data(), in_data.offset,
+                               length, &bitmap));
+    }
+    auto result = ArrayData::Make(out_type_, length, {bitmap, views}, in_data.null_count);
+    if (value_data != nullptr) {
+      result->buffers.push_back(value_data);
+    }
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ private:
+  std::shared_ptr<DataType> out_type_;
+};
+
+// The strings are copied contiguously, in the order of the entries
+class ViewToStringCastKernel : public UnaryKernel {
+ public:
+  explicit ViewToStringCastKernel(const std::shared_ptr<DataType>& out_type)
+      : out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const StringViewArray in_array(input.array());
+    const int64_t length = in_array.length();
+    const StringViewEntry* views = in_array.raw_views();
+
+    int64_t data_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      data_length += views[i].size;
+    }
+    if (data_length > std::numeric_limits<int32_t>::max()) {
+      std::stringstream ss;
+      ss << "Strings of " << data_length << " bytes do not fit in "
+         << out_type_->ToString() << " offsets";
+      return Status::Invalid(ss.str());
+    }
+
+    std::shared_ptr<Buffer> offsets, data;
+    RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(int32_t), &offsets));
+    RETURN_NOT_OK(ctx->Allocate(data_length, &data));
+    auto out_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    uint8_t* out_data = data->mutable_data();
+    int32_t position = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      out_offsets[i] = position;
+      std::memcpy(out_data + position,
+                  internal::StringViewData(views[i], in_array.raw_data_buffers()),
+                  views[i].size);
+      position += views[i].size;
+    }
+    out_offsets[length] = position;
+
+    const ArrayData& in_data = *input.array();
+    std::shared_ptr<Buffer> bitmap = in_data.buffers[0];
+    if (bitmap != nullptr && in_data.offset != 0) {
+      RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), bitmap->data(), in_data.offset,
+                               length, &bitmap));
+    }
+    *out = Datum(ArrayData::Make(out_type_, length, {bitmap, offsets, data},
+                                 in_data.null_count));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ private:
+  std::shared_ptr<DataType> out_type_;
+};
+
 // ----------------------------------------------------------------------
 // Dictionary to other things
 
@@ -516,22 +811,17 @@ void UnpackFixedSizeBinaryDictionary(FunctionContext* ctx, const Array& indices,
                                      ArrayData* output) {
   using index_c_type = typename IndexType::c_type;
 
-  internal::BitmapReader valid_bits_reader(indices.null_bitmap_data(), indices.offset(),
-                                           indices.length());
-
   const index_c_type* in = GetValues<index_c_type>(*indices.data(), 1);
 
   int32_t byte_width =
       static_cast<const FixedSizeBinaryType&>(*output->type).byte_width();
 
   uint8_t* out = output->buffers[1]->mutable_data() + byte_width * output->offset;
-  for (int64_t i = 0; i < indices.length(); ++i) {
-    if (valid_bits_reader.IsSet()) {
-      const uint8_t* value = dictionary.Value(in[i]);
-      memcpy(out + i * byte_width, value, byte_width);
+  VisitValidRuns(*indices.data(), [&](int64_t position, int64_t length) {
+    for (int64_t i = position; i < position + length; ++i) {
+      memcpy(out + i * byte_width, dictionary.Value(in[i]), byte_width);
     }
-    valid_bits_reader.Next();
-  }
+  });
 }
 
 template <typename T>
@@ -574,28 +864,41 @@ struct CastFunctor<
   }
 };
 
+template <bool kHasNulls, typename IndexType>
+Status AppendDictionaryValues(const ArrayData& indices, const BinaryArray& dictionary,
+                              BinaryBuilder* builder) {
+  using index_c_type = typename IndexType::c_type;
+  const uint8_t* valid_bits = kHasNulls ? indices.buffers[0]->data() : nullptr;
+  const index_c_type* in = GetValues<index_c_type>(indices, 1);
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (!kHasNulls || BitUtil::GetBit(valid_bits, indices.offset + i)) {
+      int32_t length;
+      const uint8_t* value = dictionary.GetValue(in[i], &length);
+      RETURN_NOT_OK(builder->Append(value, length));
+    } else {
+      RETURN_NOT_OK(builder->AppendNull());
+    }
+  }
+  return Status::OK();
+}
+
 template <typename IndexType>
 Status UnpackBinaryDictionary(FunctionContext* ctx, const Array& indices,
                               const BinaryArray& dictionary, ArrayData* output) {
-  using index_c_type = typename IndexType::c_type;
   std::unique_ptr<ArrayBuilder> builder;
   RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), output->type, &builder));
   BinaryBuilder* binary_builder = static_cast<BinaryBuilder*>(builder.get());
 
-  internal::BitmapReader valid_bits_reader(indices.null_bitmap_data(), indices.offset(),
-                                           indices.length());
-
-  const index_c_type* in = GetValues<index_c_type>(*indices.data(), 1);
-  for (int64_t i = 0; i < indices.length(); ++i) {
-    if (valid_bits_reader.IsSet()) {
-      int32_t length;
-      const uint8_t* value = dictionary.GetValue(in[i], &length);
-      RETURN_NOT_OK(binary_builder->Append(value, length));
-    } else {
-      RETURN_NOT_OK(binary_builder->AppendNull());
-    }
-    valid_bits_reader.Next();
+  const ArrayData& index_data = *indices.data();
+  Status status;
+  if (NeedsValidityChecks(index_data)) {
+    status =
+        AppendDictionaryValues<true, IndexType>(index_data, dictionary, binary_builder);
+  } else {
+    status =
+        AppendDictionaryValues<false, IndexType>(index_data, dictionary, binary_builder);
   }
+  RETURN_NOT_OK(status);
 
   std::shared_ptr<Array> plain_array;
   RETURN_NOT_OK(binary_builder->Finish(&plain_array));
@@ -652,16 +955,13 @@ struct CastFunctor<T, DictionaryType,
 template <typename IndexType, typename c_type>
 void UnpackPrimitiveDictionary(const Array& indices, const c_type* dictionary,
                                c_type* out) {
-  internal::BitmapReader valid_bits_reader(indices.null_bitmap_data(), indices.offset(),
-                                           indices.length());
+  using index_c_type = typename IndexType::c_type;
 
-  auto in = GetValues<typename IndexType::c_type>(*indices.data(), 1);
-  for (int64_t i = 0; i < indices.length(); ++i) {
-    if (valid_bits_reader.IsSet()) {
-      out[i] = dictionary[in[i]];
-    }
-    valid_bits_reader.Next();
-  }
+  // Null slots may hold any index, so only runs of valid slots are gathered
+  const index_c_type* in = GetValues<index_c_type>(*indices.data(), 1);
+  VisitValidRuns(*indices.data(), [&](int64_t position, int64_t length) {
+    detail::GatherValues(in + position, length, dictionary, out + position);
+  });
 }
 
 // Cast from dictionary to plain representation
@@ -707,17 +1007,540 @@ struct CastFunctor<T, DictionaryType,
   }
 };
 
+// ----------------------------------------------------------------------
+// Strings to numbers and timestamps
+//
+// The parsers of util/parsing.h read the bytes of each value in place
+
+using internal::IsDigit;
+using internal::ParseFloat;
+using internal::ParseInteger;
+using internal::ParseTimestamp;
+
+// Call parse(value, length, i) for each valid string of input, i being the
+// output slot, until it fails
+template <typename Parse>
+void ParseStrings(FunctionContext* ctx, const ArrayData& input, const ArrayData& output,
+                  Parse&& parse) {
+  const int32_t* offsets = GetValues<int32_t>(input, 1);
+  const char* data = input.buffers[2] == nullptr
+                         ? ""
+                         : reinterpret_cast<const char*>(input.buffers[2]->data());
+  bool failed = false;
+  VisitValidRuns(input, [&](int64_t position, int64_t run_length) {
+    for (int64_t i = position; i < position + run_length && !failed; ++i) {
+      const char* value = data + offsets[i];
+      const int32_t length = offsets[i + 1] - offsets[i];
+      if (ARROW_PREDICT_FALSE(!parse(value, length, i))) {
+        std::stringstream ss;
+        ss << "Failed to cast String '" << std::string(value, length) << "' to "
+           << output.type->ToString();
+        ctx->SetStatus(Status::Invalid(ss.str()));
+        failed = true;
+      }
+    }
+  });
+}
+
+template <typename O>
+struct CastFunctor<
+    O, StringType,
+    typename std::enable_if<std::is_base_of<Integer, O>::value ||
+                            std::is_base_of<FloatingPoint, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    out_type* out = GetMutableValues<out_type>(output, 1);
+    ParseStrings(ctx, input, *output,
+                 [out](const char* value, int32_t length, int64_t i) {
+                   return ParseNumber(value, length, &out[i]);
+                 });
+  }
+
+ private:
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, bool>::type ParseNumber(
+      const char* s, int32_t length, T* out) {
+    return ParseInteger(s, length, out);
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+  ParseNumber(const char* s, int32_t length, T* out) {
+    return ParseFloat(s, length, out);
+  }
+};
+
+template <>
+struct CastFunctor<TimestampType, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const TimeUnit::type unit = static_cast<const TimestampType&>(*output->type).unit();
+    int64_t* out = GetMutableValues<int64_t>(output, 1);
+    ParseStrings(ctx, input, *output,
+                 [out, unit](const char* value, int32_t length, int64_t i) {
+                   return ParseTimestamp(value, length, unit, &out[i]);
+                 });
+  }
+};
+
+// ----------------------------------------------------------------------
+// Numbers to strings
+//
+// Values are written directly into a data buffer sized for the longest
+// possible representation of each value, then shrunk to fit
+
+// The loop of FormatValues, instantiated with and without validity checks.
+// Returns the length of the data
+template <bool kHasNulls, typename Format>
+int64_t FormatValuesLoop(const ArrayData& input, Format& format, int32_t* offsets,
+                         char* data) {
+  const uint8_t* valid_bits = kHasNulls ? input.buffers[0]->data() : nullptr;
+  int64_t position = 0;
+  for (int64_t i = 0; i < input.length; ++i) {
+    offsets[i] = static_cast<int32_t>(position);
+    if (!kHasNulls || BitUtil::GetBit(valid_bits, input.offset + i)) {
+      position += format(i, data + position);
+    }
+  }
+  return position;
+}
+
+// Write the offsets and data of a string array, format(i, out) writing the
+// representation of valid slot i to out and returning its length
+template <typename Format>
+Status FormatValues(FunctionContext* ctx, const ArrayData& input, int32_t max_length,
+                    Format&& format, ArrayData* output) {
+  const int64_t length = input.length;
+  std::shared_ptr<Buffer> offsets_buffer, data_buffer;
+  RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(int32_t), &offsets_buffer));
+  auto data_buffer_builder = std::make_shared<PoolBuffer>(ctx->memory_pool());
+  RETURN_NOT_OK(data_buffer_builder->Resize(length * max_length));
+
+  int32_t* offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+  char* data = reinterpret_cast<char*>(data_buffer_builder->mutable_data());
+  const int64_t position = NeedsValidityChecks(input)
+                               ? FormatValuesLoop<true>(input, format, offsets, data)
+                               : FormatValuesLoop<false>(input, format, offsets, data);
+  if (position > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Cast output too large for a String array");
+  }
+  offsets[length] = static_cast<int32_t>(position);
+  RETURN_NOT_OK(data_buffer_builder->Resize(position));
+
+  output->buffers.push_back(offsets_buffer);
+  output->buffers.push_back(data_buffer_builder);
+  return Status::OK();
+}
+
+// Write the decimal representation of an integer, at most 20 characters
+template <typename T>
+int32_t FormatInteger(T value, char* out) {
+  using U = typename std::make_unsigned<T>::type;
+  char buffer[20];
+  char* end = buffer + sizeof(buffer);
+  char* p = end;
+  U magnitude = static_cast<U>(value);
+  if (value < 0) {
+    magnitude = static_cast<U>(~magnitude + 1);
+  }
+  do {
+    *--p = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  if (value < 0) {
+    *--p = '-';
+  }
+  const int32_t length = static_cast<int32_t>(end - p);
+  std::memcpy(out, p, length);
+  return length;
+}
+
+constexpr int32_t kMaxFormattedFloatLength = 32;
+
+// Write the shortest representation of a floating point number that parses
+// back to the same value
+template <typename T>
+int32_t FormatFloat(T value, char* out) {
+  if (std::isnan(value)) {
+    std::memcpy(out, "nan", 3);
+    return 3;
+  }
+  if (std::isinf(value)) {
+    std::memcpy(out, value < 0 ? "-inf" : "inf", 4 - (value > 0));
+    return 4 - (value > 0);
+  }
+  char buffer[kMaxFormattedFloatLength + 1];
+  int length = 0;
+  for (int precision = std::numeric_limits<T>::digits10;
+       precision <= std::numeric_limits<T>::max_digits10; ++precision) {
+    length = snprintf(buffer, sizeof(buffer), "%.*g", precision,
+                      static_cast<double>(value));
+    // The decimal point of the C locale may not be a period
+    for (int k = 0; k < length; ++k) {
+      if (!IsDigit(buffer[k]) && buffer[k] != '-' && buffer[k] != '+' &&
+          buffer[k] != 'e') {
+        buffer[k] = '.';
+      }
+    }
+    T parsed;
+    if (ParseFloat(buffer, length, &parsed) && parsed == value) {
+      break;
+    }
+  }
+  std::memcpy(out, buffer, length);
+  return length;
+}
+
+template <typename I>
+struct CastFunctor<
+    StringType, I,
+    typename std::enable_if<std::is_base_of<Integer, I>::value ||
+                            std::is_base_of<FloatingPoint, I>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using in_type = typename I::c_type;
+    const in_type* values = GetValues<in_type>(input, 1);
+    FUNC_RETURN_NOT_OK(FormatValues(
+        ctx, input, MaxLength<in_type>(),
+        [values](int64_t i, char* out) { return Format(values[i], out); }, output));
+  }
+
+ private:
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, int32_t>::type MaxLength() {
+    // Digits plus one for a truncated digit and one for the sign
+    return std::numeric_limits<T>::digits10 + 2;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, int32_t>::type
+  MaxLength() {
+    return kMaxFormattedFloatLength;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, int32_t>::type Format(
+      T value, char* out) {
+    return FormatInteger(value, out);
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, int32_t>::type
+  Format(T value, char* out) {
+    return FormatFloat(value, out);
+  }
+};
+
+template <>
+struct CastFunctor<StringType, BooleanType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const uint8_t* values = input.buffers[1]->data();
+    const int64_t offset = input.offset;
+    FUNC_RETURN_NOT_OK(FormatValues(ctx, input, 5,
+                                    [values, offset](int64_t i, char* out) {
+                                      if (BitUtil::GetBit(values, offset + i)) {
+                                        std::memcpy(out, "true", 4);
+                                        return 4;
+                                      }
+                                      std::memcpy(out, "false", 5);
+                                      return 5;
+                                    },
+                                    output));
+  }
+};
+
+template <>
+struct CastFunctor<StringType, NullType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    FUNC_RETURN_NOT_OK(FormatValues(ctx, input, 0,
+                                    [](int64_t i, char* out) { return 0; }, output));
+  }
+};
+
+// ----------------------------------------------------------------------
+// Decimals to and from other things
+//
+// Decimal values are read and written in place as 16 bytes. Rescaling,
+// division and formatting take 64-bit fast paths in Decimal128 for the
+// values fitting in 64 bits, which are most of them.
+
+constexpr int64_t kDecimalByteWidth = 16;
+
+inline const uint8_t* GetDecimalValues(const ArrayData& data) {
+  return data.buffers[1]->data() + data.offset * kDecimalByteWidth;
+}
+
+inline uint8_t* GetMutableDecimalValues(ArrayData* data) {
+  return data->buffers[1]->mutable_data() + data->offset * kDecimalByteWidth;
+}
+
+// Call convert(i) for each valid slot of input, until it fails
+template <typename Convert>
+void ConvertValidSlots(FunctionContext* ctx, const ArrayData& input, Convert&& convert) {
+  Status status;
+  VisitValidRuns(input, [&](int64_t position, int64_t length) {
+    for (int64_t i = position; i < position + length && status.ok(); ++i) {
+      status = convert(i);
+    }
+  });
+  if (!status.ok()) {
+    ctx->SetStatus(status);
+  }
+}
+
+// Rescale a decimal, dropping the digits below the new scale if allowed, and
+// check that the result has at most precision digits unless precision is 0
+Status RescaleDecimal(const Decimal128& value, int32_t in_scale, int32_t out_scale,
+                      int32_t precision, bool allow_truncate, Decimal128* out) {
+  if (in_scale == out_scale) {
+    *out = value;
+  } else if (allow_truncate && out_scale < in_scale) {
+    *out = value / Decimal128::GetScaleMultiplier(in_scale - out_scale);
+  } else {
+    RETURN_NOT_OK(value.Rescale(in_scale, out_scale, out));
+  }
+  if (precision > 0 && !out->FitsInPrecision(precision)) {
+    std::stringstream ss;
+    ss << "Decimal value " << out->ToString(out_scale)
+       << " does not fit in precision " << precision;
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+template <typename T>
+bool DecimalFitsInInteger(const Decimal128& value) {
+  if (!value.FitsInInt64()) {
+    // Only uint64 has values beyond int64
+    return std::is_unsigned<T>::value && sizeof(T) == 8 && value.high_bits() == 0;
+  }
+  const auto integer = static_cast<int64_t>(value);
+  if (std::is_unsigned<T>::value) {
+    return integer >= 0 &&
+           (sizeof(T) == 8 ||
+            integer <= static_cast<int64_t>(std::numeric_limits<T>::max()));
+  }
+  return integer >= static_cast<int64_t>(std::numeric_limits<T>::min()) &&
+         integer <= static_cast<int64_t>(std::numeric_limits<T>::max());
+}
+
+template <>
+struct CastFunctor<Decimal128Type, Decimal128Type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const auto& in_type = static_cast<const Decimal128Type&>(*input.type);
+    const auto& out_type = static_cast<const Decimal128Type&>(*output->type);
+    const uint8_t* in = GetDecimalValues(input);
+    uint8_t* out = GetMutableDecimalValues(output);
+    ConvertValidSlots(ctx, input, [&](int64_t i) {
+      Decimal128 value;
+      RETURN_NOT_OK(RescaleDecimal(Decimal128(in + i * kDecimalByteWidth),
+                                   in_type.scale(), out_type.scale(),
+                                   out_type.precision(), options.allow_decimal_truncate,
+                                   &value));
+      value.ToBytes(out + i * kDecimalByteWidth);
+      return Status::OK();
+    });
+  }
+};
+
+template <typename I>
+struct CastFunctor<Decimal128Type, I,
+                   typename std::enable_if<std::is_base_of<Integer, I>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using in_type = typename I::c_type;
+    const auto& out_type = static_cast<const Decimal128Type&>(*output->type);
+    const in_type* in = GetValues<in_type>(input, 1);
+    uint8_t* out = GetMutableDecimalValues(output);
+    ConvertValidSlots(ctx, input, [&](int64_t i) {
+      // Unsigned values beyond int64 would be sign extended by the converting
+      // constructor
+      const Decimal128 integer =
+          std::is_unsigned<in_type>::value
+              ? Decimal128(0, static_cast<uint64_t>(in[i]))
+              : Decimal128(static_cast<int64_t>(in[i]));
+      Decimal128 value;
+      RETURN_NOT_OK(RescaleDecimal(integer, 0, out_type.scale(), out_type.precision(),
+                                   false, &value));
+      value.ToBytes(out + i * kDecimalByteWidth);
+      return Status::OK();
+    });
+  }
+};
+
+template <typename I>
+struct CastFunctor<
+    Decimal128Type, I,
+    typename std::enable_if<std::is_base_of<FloatingPoint, I>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using in_type = typename I::c_type;
+    const auto& out_type = static_cast<const Decimal128Type&>(*output->type);
+    const in_type* in = GetValues<in_type>(input, 1);
+    uint8_t* out = GetMutableDecimalValues(output);
+    ConvertValidSlots(ctx, input, [&](int64_t i) {
+      Decimal128 value;
+      RETURN_NOT_OK(Decimal128::FromReal(static_cast<double>(in[i]),
+                                         out_type.precision(), out_type.scale(),
+                                         &value));
+      value.ToBytes(out + i * kDecimalByteWidth);
+      return Status::OK();
+    });
+  }
+};
+
+template <typename O>
+struct CastFunctor<O, Decimal128Type,
+                   typename std::enable_if<std::is_base_of<Integer, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    const int32_t scale = static_cast<const Decimal128Type&>(*input.type).scale();
+    const uint8_t* in = GetDecimalValues(input);
+    out_type* out = GetMutableValues<out_type>(output, 1);
+    ConvertValidSlots(ctx, input, [&](int64_t i) {
+      Decimal128 integer;
+      RETURN_NOT_OK(RescaleDecimal(Decimal128(in + i * kDecimalByteWidth), scale, 0, 0,
+                                   options.allow_decimal_truncate, &integer));
+      if (!options.allow_int_overflow &&
+          ARROW_PREDICT_FALSE(!DecimalFitsInInteger<out_type>(integer))) {
+        return Status::Invalid("Integer value out of bounds");
+      }
+      out[i] = static_cast<out_type>(integer.low_bits());
+      return Status::OK();
+    });
+  }
+};
+
+template <typename O>
+struct CastFunctor<
+    O, Decimal128Type,
+    typename std::enable_if<std::is_base_of<FloatingPoint, O>::value>::type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    using out_type = typename O::c_type;
+    const int32_t scale = static_cast<const Decimal128Type&>(*input.type).scale();
+    const uint8_t* in = GetDecimalValues(input);
+    out_type* out = GetMutableValues<out_type>(output, 1);
+    VisitValidRuns(input, [&](int64_t position, int64_t length) {
+      for (int64_t i = position; i < position + length; ++i) {
+        out[i] = static_cast<out_type>(
+            Decimal128(in + i * kDecimalByteWidth).ToDouble(scale));
+      }
+    });
+  }
+};
+
+template <>
+struct CastFunctor<Decimal128Type, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const auto& out_type = static_cast<const Decimal128Type&>(*output->type);
+    uint8_t* out = GetMutableDecimalValues(output);
+    const int32_t* offsets = GetValues<int32_t>(input, 1);
+    const char* data = input.buffers[2] == nullptr
+                           ? ""
+                           : reinterpret_cast<const char*>(input.buffers[2]->data());
+    ConvertValidSlots(ctx, input, [&](int64_t i) {
+      const char* s = data + offsets[i];
+      const auto length = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+      Decimal128 parsed, value;
+      int32_t scale = 0;
+      RETURN_NOT_OK(Decimal128::FromString(s, length, &parsed, nullptr, &scale));
+      RETURN_NOT_OK(RescaleDecimal(parsed, scale, out_type.scale(),
+                                   out_type.precision(), options.allow_decimal_truncate,
+                                   &value));
+      value.ToBytes(out + i * kDecimalByteWidth);
+      return Status::OK();
+    });
+  }
+};
+
+template <>
+struct CastFunctor<StringType, Decimal128Type> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const int32_t scale = static_cast<const Decimal128Type&>(*input.type).scale();
+    const uint8_t* in = GetDecimalValues(input);
+    FUNC_RETURN_NOT_OK(FormatValues(ctx, input, Decimal128::kMaxStringLength,
+                                    [in, scale](int64_t i, char* out) {
+                                      return Decimal128(in + i * kDecimalByteWidth)
+                                          .ToString(scale, out);
+                                    },
+                                    output));
+  }
+};
+
 // ----------------------------------------------------------------------
 
 typedef std::function<void(FunctionContext*, const CastOptions& options, const ArrayData&,
                            ArrayData*)>
     CastFunction;
 
+// Size in bytes of the values of length elements of a fixed width type
+static Status GetValuesBufferSize(const DataType& type, int64_t length, int64_t* size) {
+  const Type::type type_id = type.id();
+  if (!(is_primitive(type_id) || type_id == Type::FIXED_SIZE_BINARY ||
+        type_id == Type::DECIMAL) ||
+      type_id == Type::NA) {
+    std::stringstream ss;
+    ss << "Cannot pre-allocate memory for type: " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+
+  const int bit_width = static_cast<const FixedWidthType&>(type).bit_width();
+  if (bit_width == 1) {
+    *size = BitUtil::BytesForBits(length);
+  } else {
+    DCHECK_EQ(0, bit_width % 8);
+    *size = length * bit_width / 8;
+  }
+  return Status::OK();
+}
+
+// Check that caller-provided output buffers can hold the cast of length
+// values, at the offset of out
+static Status CheckPreallocated(const ArrayData& out, int64_t length) {
+  const int64_t end = out.offset + length;
+  const std::shared_ptr<Buffer>& bitmap = out.buffers[0];
+  if (bitmap != nullptr &&
+      (!bitmap->is_mutable() || bitmap->size() < BitUtil::BytesForBits(end))) {
+    return Status::Invalid("Preallocated validity bitmap is too small or immutable");
+  }
+  int64_t values_size = 0;
+  RETURN_NOT_OK(GetValuesBufferSize(*out.type, end, &values_size));
+  const std::shared_ptr<Buffer>& values = out.buffers[1];
+  if (values == nullptr || !values->is_mutable() || values->size() < values_size) {
+    return Status::Invalid("Preallocated values buffer is too small or immutable");
+  }
+  return Status::OK();
+}
+
 static Status AllocateIfNotPreallocated(FunctionContext* ctx, const ArrayData& input,
                                         bool can_pre_allocate_values, ArrayData* out) {
   const int64_t length = input.length;
   out->null_count = input.null_count;
 
+  if (out->buffers.size() == 2 && out->buffers[0] != nullptr) {
+    // Fill the preallocated bitmap in place, so that it can be reused by later
+    // calls instead of being replaced
+    uint8_t* bitmap = out->buffers[0]->mutable_data();
+    if (input.type->id() == Type::NA) {
+      FillBitmap(bitmap, out->offset, length, false);
+      out->null_count = length;
+    } else if (input.buffers[0] == nullptr) {
+      FillBitmap(bitmap, out->offset, length, true);
+      out->null_count = 0;
+    } else {
+      CopyBitmap(input.buffers[0]->data(), input.offset, length, bitmap, out->offset);
+    }
+    return Status::OK();
+  }
+
   // Propagate bitmap unless we are null type
   std::shared_ptr<Buffer> validity_bitmap = input.buffers[0];
   if (input.type->id() == Type::NA) {
@@ -739,37 +1562,15 @@ static Status AllocateIfNotPreallocated(FunctionContext* ctx, const ArrayData& i
 
   out->buffers.push_back(validity_bitmap);
 
-  if (can_pre_allocate_values) {
-    std::shared_ptr<Buffer> out_data;
-
-    const Type::type type_id = out->type->id();
-
-    if (!(is_primitive(type_id) || type_id == Type::FIXED_SIZE_BINARY ||
-          type_id == Type::DECIMAL)) {
-      std::stringstream ss;
-      ss << "Cannot pre-allocate memory for type: " << out->type->ToString();
-      return Status::NotImplemented(ss.str());
-    }
-
-    if (type_id != Type::NA) {
-      const auto& fw_type = static_cast<const FixedWidthType&>(*out->type);
-
-      int bit_width = fw_type.bit_width();
-      int64_t buffer_size = 0;
-
-      if (bit_width == 1) {
-        buffer_size = BitUtil::BytesForBits(length);
-      } else if (bit_width % 8 == 0) {
-        buffer_size = length * fw_type.bit_width() / 8;
-      } else {
-        DCHECK(false);
-      }
+  if (can_pre_allocate_values && out->type->id() != Type::NA) {
+    int64_t buffer_size = 0;
+    RETURN_NOT_OK(GetValuesBufferSize(*out->type, length, &buffer_size));
 
-      RETURN_NOT_OK(ctx->Allocate(buffer_size, &out_data));
-      memset(out_data->mutable_data(), 0, buffer_size);
+    std::shared_ptr<Buffer> out_data;
+    RETURN_NOT_OK(ctx->Allocate(buffer_size, &out_data));
+    memset(out_data->mutable_data(), 0, buffer_size);
 
-      out->buffers.push_back(out_data);
-    }
+    out->buffers.push_back(out_data);
   }
 
   return Status::OK();
@@ -797,6 +1598,9 @@ class CastKernel : public UnaryKernel {
 
     result = out->array().get();
 
+    if (!is_zero_copy_ && result->buffers.size() == 2) {
+      RETURN_NOT_OK(CheckPreallocated(*result, in_data.length));
+    }
     if (!is_zero_copy_) {
       RETURN_NOT_OK(
           AllocateIfNotPreallocated(ctx, in_data, can_pre_allocate_values_, result));
@@ -807,6 +1611,27 @@ class CastKernel : public UnaryKernel {
     return Status::OK();
   }
 
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+  Status GetOutputBufferSizes(int64_t length,
+                              std::vector<int64_t>* sizes) const override {
+    sizes->clear();
+    if (is_zero_copy_) {
+      // The output shares the buffers of the input
+      return Status::OK();
+    }
+    if (!can_pre_allocate_values_) {
+      std::stringstream ss;
+      ss << "Cannot pre-allocate memory for type: " << out_type_->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+    int64_t values_size = 0;
+    RETURN_NOT_OK(GetValuesBufferSize(*out_type_, length, &values_size));
+    sizes->push_back(BitUtil::BytesForBits(length));
+    sizes->push_back(values_size);
+    return Status::OK();
+  }
+
  private:
   CastOptions options_;
   CastFunction func_;
@@ -838,7 +1663,12 @@ class CastKernel : public UnaryKernel {
   FN(IN_TYPE, UInt64Type);         \
   FN(IN_TYPE, Int64Type);          \
   FN(IN_TYPE, FloatType);          \
-  FN(IN_TYPE, DoubleType);
+  FN(IN_TYPE, DoubleType);         \
+  FN(IN_TYPE, StringType);
+
+#define NUMBER_CASES(FN, IN_TYPE) \
+  NUMERIC_CASES(FN, IN_TYPE)      \
+  FN(IN_TYPE, Decimal128Type);
 
 #define NULL_CASES(FN, IN_TYPE) \
   NUMERIC_CASES(FN, IN_TYPE)    \
@@ -849,12 +1679,12 @@ class CastKernel : public UnaryKernel {
   FN(NullType, Date64Type);
 
 #define INT32_CASES(FN, IN_TYPE) \
-  NUMERIC_CASES(FN, IN_TYPE)     \
+  NUMBER_CASES(FN, IN_TYPE)      \
   FN(Int32Type, Time32Type);     \
   FN(Int32Type, Date32Type);
 
 #define INT64_CASES(FN, IN_TYPE) \
-  NUMERIC_CASES(FN, IN_TYPE)     \
+  NUMBER_CASES(FN, IN_TYPE)      \
   FN(Int64Type, TimestampType);  \
   FN(Int64Type, Time64Type);     \
   FN(Int64Type, Date64Type);
@@ -885,6 +1715,34 @@ class CastKernel : public UnaryKernel {
   FN(TimestampType, Date64Type);     \
   FN(TimestampType, Int64Type);
 
+#define STRING_CASES(FN, IN_TYPE) \
+  FN(StringType, UInt8Type);      \
+  FN(StringType, Int8Type);       \
+  FN(StringType, UInt16Type);     \
+  FN(StringType, Int16Type);      \
+  FN(StringType, UInt32Type);     \
+  FN(StringType, Int32Type);      \
+  FN(StringType, UInt64Type);     \
+  FN(StringType, Int64Type);      \
+  FN(StringType, FloatType);      \
+  FN(StringType, DoubleType);     \
+  FN(StringType, TimestampType);  \
+  FN(StringType, Decimal128Type);
+
+#define DECIMAL_CASES(FN, IN_TYPE)    \
+  FN(Decimal128Type, UInt8Type);      \
+  FN(Decimal128Type, Int8Type);       \
+  FN(Decimal128Type, UInt16Type);     \
+  FN(Decimal128Type, Int16Type);      \
+  FN(Decimal128Type, UInt32Type);     \
+  FN(Decimal128Type, Int32Type);      \
+  FN(Decimal128Type, UInt64Type);     \
+  FN(Decimal128Type, Int64Type);      \
+  FN(Decimal128Type, FloatType);      \
+  FN(Decimal128Type, DoubleType);     \
+  FN(Decimal128Type, Decimal128Type); \
+  FN(Decimal128Type, StringType);
+
 #define DICTIONARY_CASES(FN, IN_TYPE) \
   FN(IN_TYPE, NullType);              \
   FN(IN_TYPE, Time32Type);            \
@@ -927,21 +1785,23 @@ class CastKernel : public UnaryKernel {
 
 GET_CAST_FUNCTION(NULL_CASES, NullType);
 GET_CAST_FUNCTION(NUMERIC_CASES, BooleanType);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt8Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, Int8Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt16Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, Int16Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt32Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt8Type);
+GET_CAST_FUNCTION(NUMBER_CASES, Int8Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt16Type);
+GET_CAST_FUNCTION(NUMBER_CASES, Int16Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt32Type);
 GET_CAST_FUNCTION(INT32_CASES, Int32Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, UInt64Type);
+GET_CAST_FUNCTION(NUMBER_CASES, UInt64Type);
 GET_CAST_FUNCTION(INT64_CASES, Int64Type);
-GET_CAST_FUNCTION(NUMERIC_CASES, FloatType);
-GET_CAST_FUNCTION(NUMERIC_CASES, DoubleType);
+GET_CAST_FUNCTION(NUMBER_CASES, FloatType);
+GET_CAST_FUNCTION(NUMBER_CASES, DoubleType);
 GET_CAST_FUNCTION(DATE32_CASES, Date32Type);
 GET_CAST_FUNCTION(DATE64_CASES, Date64Type);
 GET_CAST_FUNCTION(TIME32_CASES, Time32Type);
 GET_CAST_FUNCTION(TIME64_CASES, Time64Type);
 GET_CAST_FUNCTION(TIMESTAMP_CASES, TimestampType);
+GET_CAST_FUNCTION(STRING_CASES, StringType);
+GET_CAST_FUNCTION(DECIMAL_CASES, Decimal128Type);
 GET_CAST_FUNCTION(DICTIONARY_CASES, DictionaryType);
 
 #define CAST_FUNCTION_CASE(InType)                      \
@@ -951,6 +1811,356 @@ GET_CAST_FUNCTION(DICTIONARY_CASES, DictionaryType);
 
 namespace {
 
+// Cast of a dictionary array to another value type, which casts the
+// dictionary only, once for all inputs sharing it. A dictionary output reuses
+// the indices, zero-copy unless the index type changes too, and a dense output
+// is unpacked from the cast dictionary.
+//
+// Values of the dictionary are all cast, so that a safe cast may fail on a
+// value that no index refers to
+class DictionaryCastKernel : public UnaryKernel {
+ public:
+  DictionaryCastKernel(std::unique_ptr<UnaryKernel> values_caster,
+                       std::unique_ptr<UnaryKernel> indices_caster,
+                       std::unique_ptr<UnaryKernel> unpacker,
+                       const std::shared_ptr<DataType>& out_type)
+      : values_caster_(std::move(values_caster)),
+        indices_caster_(std::move(indices_caster)),
+        unpacker_(std::move(unpacker)),
+        out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const ArrayData& in_data = *input.array();
+    DCHECK_EQ(Type::DICTIONARY, in_data.type->id());
+    const auto& in_type = static_cast<const DictionaryType&>(*in_data.type);
+
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(CastDictionary(ctx, in_type.dictionary(), &values));
+
+    // Shares the buffers of the input
+    std::shared_ptr<ArrayData> result = in_data.Copy();
+    if (unpacker_ != nullptr) {
+      result->type = dictionary(in_type.index_type(), values, in_type.ordered());
+      return unpacker_->Call(ctx, Datum(result), out);
+    }
+
+    const auto& out_dict_type = static_cast<const DictionaryType&>(*out_type_);
+    if (indices_caster_ != nullptr) {
+      result->type = in_type.index_type();
+      Datum indices;
+      RETURN_NOT_OK(indices_caster_->Call(ctx, Datum(result), &indices));
+      result = indices.array();
+    }
+    result->type =
+        dictionary(out_dict_type.index_type(), values, out_dict_type.ordered());
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    // The type of a dictionary output depends on the input dictionary
+    return unpacker_ != nullptr ? out_type_ : nullptr;
+  }
+
+  Status GetOutputBufferSizes(int64_t length,
+                              std::vector<int64_t>* sizes) const override {
+    if (unpacker_ != nullptr) {
+      return unpacker_->GetOutputBufferSizes(length, sizes);
+    }
+    return UnaryKernel::GetOutputBufferSizes(length, sizes);
+  }
+
+ private:
+  Status CastDictionary(FunctionContext* ctx, const std::shared_ptr<Array>& dictionary,
+                        std::shared_ptr<Array>* out) {
+    // Chunks may be cast concurrently
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (dictionary != cached_dictionary_) {
+      Datum values;
+      RETURN_NOT_OK(values_caster_->Call(ctx, Datum(dictionary->data()), &values));
+      cached_dictionary_ = dictionary;
+      cached_values_ = MakeArray(values.array());
+    }
+    *out = cached_values_;
+    return Status::OK();
+  }
+
+  std::unique_ptr<UnaryKernel> values_caster_;
+  std::unique_ptr<UnaryKernel> indices_caster_;
+  std::unique_ptr<UnaryKernel> unpacker_;
+  std::shared_ptr<DataType> out_type_;
+
+  std::mutex mutex_;
+  std::shared_ptr<Array> cached_dictionary_;
+  std::shared_ptr<Array> cached_values_;
+};
+
+Status GetDictionaryCastFunc(const DataType& in_type,
+                             const std::shared_ptr<DataType>& out_type,
+                             const CastOptions& options,
+                             std::unique_ptr<UnaryKernel>* kernel) {
+  const auto& dict_type = static_cast<const DictionaryType&>(in_type);
+  const std::shared_ptr<DataType>& values_type = dict_type.dictionary()->type();
+  if (out_type->id() != Type::DICTIONARY && values_type->Equals(*out_type)) {
+    *kernel = GetDictionaryTypeCastFunc(out_type, options);
+    return Status::OK();
+  }
+
+  std::unique_ptr<UnaryKernel> values_caster, indices_caster, unpacker;
+  if (out_type->id() == Type::DICTIONARY) {
+    const auto& out_dict_type = static_cast<const DictionaryType&>(*out_type);
+    RETURN_NOT_OK(GetCastFunction(*values_type, out_dict_type.dictionary()->type(),
+                                  options, &values_caster));
+    if (!dict_type.index_type()->Equals(*out_dict_type.index_type())) {
+      RETURN_NOT_OK(GetCastFunction(*dict_type.index_type(), out_dict_type.index_type(),
+                                    options, &indices_caster));
+    }
+  } else {
+    RETURN_NOT_OK(GetCastFunction(*values_type, out_type, options, &values_caster));
+    unpacker = GetDictionaryTypeCastFunc(out_type, options);
+    if (unpacker == nullptr) {
+      // Kernel will be null
+      return Status::OK();
+    }
+  }
+  kernel->reset(new DictionaryCastKernel(std::move(values_caster),
+                                         std::move(indices_caster), std::move(unpacker),
+                                         out_type));
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Run-length encoded to and from other things
+
+// Whether values i and j of a dense array are equal or both null. Fixed width
+// values are compared bitwise
+class ValueEquality {
+ public:
+  explicit ValueEquality(const std::shared_ptr<ArrayData>& data)
+      : array_(MakeArray(data)), other_(MakeArray(data)), bit_width_(0) {
+    const auto fw_type = dynamic_cast<const FixedWidthType*>(data->type.get());
+    if (fw_type != nullptr && data->buffers.size() > 1 &&
+        (fw_type->bit_width() == 1 || fw_type->bit_width() % 8 == 0)) {
+      bit_width_ = fw_type->bit_width();
+      offset_ = data->offset;
+      values_ = data->buffers[1]->data();
+    }
+  }
+
+  bool Equals(int64_t i, int64_t j) const {
+    const bool is_null = array_->IsNull(i);
+    if (is_null != array_->IsNull(j)) {
+      return false;
+    }
+    if (is_null) {
+      return true;
+    }
+    if (bit_width_ == 1) {
+      return BitUtil::GetBit(values_, offset_ + i) ==
+             BitUtil::GetBit(values_, offset_ + j);
+    }
+    if (bit_width_ > 0) {
+      const int64_t byte_width = bit_width_ / 8;
+      return std::memcmp(values_ + (offset_ + i) * byte_width,
+                         values_ + (offset_ + j) * byte_width,
+                         static_cast<size_t>(byte_width)) == 0;
+    }
+    // Distinct arrays, as an array is always equal to itself
+    return array_->RangeEquals(i, i + 1, j, other_);
+  }
+
+ private:
+  std::shared_ptr<Array> array_;
+  std::shared_ptr<Array> other_;
+  int bit_width_;
+  int64_t offset_ = 0;
+  const uint8_t* values_ = nullptr;
+};
+
+// Encode a dense array into runs of equal values
+Status EncodeRuns(FunctionContext* ctx, const std::shared_ptr<ArrayData>& input,
+                  std::shared_ptr<ArrayData>* out) {
+  if (input->length > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Run-length encoded arrays cannot exceed INT32_MAX values");
+  }
+  const int32_t length = static_cast<int32_t>(input->length);
+  TypedBufferBuilder<int32_t> run_ends(ctx->memory_pool());
+  TypedBufferBuilder<int32_t> run_starts(ctx->memory_pool());
+  if (length > 0) {
+    ValueEquality equality(input);
+    RETURN_NOT_OK(run_starts.Append(0));
+    for (int32_t i = 1; i < length; ++i) {
+      if (!equality.Equals(i - 1, i)) {
+        RETURN_NOT_OK(run_ends.Append(i));
+        RETURN_NOT_OK(run_starts.Append(i));
+      }
+    }
+    RETURN_NOT_OK(run_ends.Append(length));
+  }
+
+  const int64_t num_runs = run_starts.length();
+  std::shared_ptr<Buffer> run_ends_buffer, run_starts_buffer;
+  RETURN_NOT_OK(run_ends.Finish(&run_ends_buffer));
+  RETURN_NOT_OK(run_starts.Finish(&run_starts_buffer));
+  Int32Array starts(num_runs, run_starts_buffer);
+  Datum values;
+  RETURN_NOT_OK(Take(ctx, Datum(input), Datum(starts.data()), &values));
+
+  *out = ArrayData::Make(run_length_encoded(input->type), length,
+                         {nullptr, run_ends_buffer}, 0);
+  (*out)->child_data.push_back(values.array());
+  return Status::OK();
+}
+
+// Decode runs into a dense array, given the values of the runs spanned by runs
+Status DecodeRuns(FunctionContext* ctx, const RunLengthEncodedArray& runs,
+                  const std::shared_ptr<ArrayData>& values, Datum* out) {
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), runs.length() * sizeof(int32_t),
+                               &indices));
+  int32_t* dest = reinterpret_cast<int32_t*>(indices->mutable_data());
+  for (int64_t i = 0; i < runs.num_runs(); ++i) {
+    const int64_t run_length = runs.run_length(runs.first_run() + i);
+    std::fill(dest, dest + run_length, static_cast<int32_t>(i));
+    dest += run_length;
+  }
+  Int32Array run_indices(runs.length(), indices);
+  return Take(ctx, Datum(values), Datum(run_indices.data()), out);
+}
+
+// Cast from, to or between run-length encoded arrays. The values are cast
+// once per run, and dense outputs decoded from the cast values
+class RunLengthEncodedCastKernel : public UnaryKernel {
+ public:
+  RunLengthEncodedCastKernel(std::unique_ptr<UnaryKernel> values_caster,
+                             const std::shared_ptr<DataType>& out_type)
+      : values_caster_(std::move(values_caster)), out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    std::shared_ptr<ArrayData> encoded = input.array();
+    if (encoded->type->id() != Type::RUN_LENGTH_ENCODED) {
+      RETURN_NOT_OK(EncodeRuns(ctx, input.array(), &encoded));
+    }
+    RunLengthEncodedArray runs(encoded);
+
+    std::shared_ptr<ArrayData> values =
+        runs.values()->Slice(runs.first_run(), runs.num_runs())->data();
+    if (values_caster_ != nullptr) {
+      Datum casted;
+      RETURN_NOT_OK(values_caster_->Call(ctx, Datum(values), &casted));
+      values = casted.array();
+    }
+
+    if (out_type_->id() == Type::RUN_LENGTH_ENCODED) {
+      *out = Datum(detail::ReplaceRunValues(runs, out_type_, values));
+      return Status::OK();
+    }
+    return DecodeRuns(ctx, runs, values, out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ private:
+  std::unique_ptr<UnaryKernel> values_caster_;
+  std::shared_ptr<DataType> out_type_;
+};
+
+Status GetRunLengthEncodedCastFunc(const DataType& in_type,
+                                   const std::shared_ptr<DataType>& out_type,
+                                   const CastOptions& options,
+                                   std::unique_ptr<UnaryKernel>* kernel) {
+  const DataType& in_value_type =
+      in_type.id() == Type::RUN_LENGTH_ENCODED
+          ? *static_cast<const RunLengthEncodedType&>(in_type).value_type()
+          : in_type;
+  const std::shared_ptr<DataType> out_value_type =
+      out_type->id() == Type::RUN_LENGTH_ENCODED
+          ? static_cast<const RunLengthEncodedType&>(*out_type).value_type()
+          : out_type;
+
+  std::unique_ptr<UnaryKernel> values_caster;
+  if (!in_value_type.Equals(*out_value_type)) {
+    RETURN_NOT_OK(
+        GetCastFunction(in_value_type, out_value_type, options, &values_caster));
+  }
+  kernel->reset(new RunLengthEncodedCastKernel(std::move(values_caster), out_type));
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Union to union
+
+// Cast of a union to a union of the same mode and type codes. The validity,
+// type ids and offsets are shared with the input, and each child is cast at
+// once by its own caster, or shared if its type does not change
+class UnionCastKernel : public UnaryKernel {
+ public:
+  UnionCastKernel(std::vector<std::unique_ptr<UnaryKernel>> child_casters,
+                  const std::shared_ptr<DataType>& out_type)
+      : child_casters_(std::move(child_casters)), out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const ArrayData& in_data = *input.array();
+    auto result = ArrayData::Make(out_type_, in_data.length, in_data.buffers,
+                                  in_data.null_count, in_data.offset);
+    result->child_data.resize(in_data.child_data.size());
+    RETURN_NOT_OK(detail::ParallelInvoke(
+        ctx, static_cast<int>(child_casters_.size()),
+        [&](FunctionContext* task_ctx, int i) {
+          if (child_casters_[i] == nullptr) {
+            result->child_data[i] = in_data.child_data[i];
+            return Status::OK();
+          }
+          Datum casted_child;
+          RETURN_NOT_OK(child_casters_[i]->Call(task_ctx, Datum(in_data.child_data[i]),
+                                                &casted_child));
+          result->child_data[i] = casted_child.array();
+          return Status::OK();
+        }));
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ private:
+  std::vector<std::unique_ptr<UnaryKernel>> child_casters_;
+  std::shared_ptr<DataType> out_type_;
+};
+
+Status GetUnionCastFunc(const DataType& in_type,
+                        const std::shared_ptr<DataType>& out_type,
+                        const CastOptions& options,
+                        std::unique_ptr<UnaryKernel>* kernel) {
+  if (out_type->id() != Type::UNION) {
+    // Kernel will be null
+    return Status::OK();
+  }
+  const auto& in_union = static_cast<const UnionType&>(in_type);
+  const auto& out_union = static_cast<const UnionType&>(*out_type);
+  if (in_union.mode() != out_union.mode() ||
+      in_union.type_codes() != out_union.type_codes()) {
+    return Status::OK();
+  }
+  std::vector<std::unique_ptr<UnaryKernel>> child_casters(in_union.num_children());
+  for (int i = 0; i < in_union.num_children(); ++i) {
+    const DataType& in_child_type = *in_union.child(i)->type();
+    const std::shared_ptr<DataType>& out_child_type = out_union.child(i)->type();
+    if (!in_child_type.Equals(*out_child_type)) {
+      RETURN_NOT_OK(
+          GetCastFunction(in_child_type, out_child_type, options, &child_casters[i]));
+    }
+  }
+  kernel->reset(new UnionCastKernel(std::move(child_casters), out_type));
+  return Status::OK();
+}
+
 Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
   if (out_type->id() != Type::LIST) {
@@ -967,10 +2177,80 @@ Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>&
   return Status::OK();
 }
 
+// The variant of a binary, string or list type with the other offset width
+Type::type OtherOffsetWidth(Type::type type_id) {
+  switch (type_id) {
+    case Type::BINARY:
+      return Type::LARGE_BINARY;
+    case Type::STRING:
+      return Type::LARGE_STRING;
+    case Type::LIST:
+      return Type::LARGE_LIST;
+    case Type::LARGE_BINARY:
+      return Type::BINARY;
+    case Type::LARGE_STRING:
+      return Type::STRING;
+    case Type::LARGE_LIST:
+      return Type::LIST;
+    default:
+      return Type::NA;
+  }
+}
+
+Status GetOffsetWidthCastFunc(const DataType& in_type,
+                              const std::shared_ptr<DataType>& out_type,
+                              const CastOptions& options,
+                              std::unique_ptr<UnaryKernel>* kernel) {
+  std::unique_ptr<UnaryKernel> child_caster;
+  if (in_type.num_children() > 0) {
+    const std::shared_ptr<DataType>& in_value_type = in_type.child(0)->type();
+    const std::shared_ptr<DataType>& out_value_type = out_type->child(0)->type();
+    if (!in_value_type->Equals(*out_value_type)) {
+      RETURN_NOT_OK(
+          GetCastFunction(*in_value_type, out_value_type, options, &child_caster));
+    }
+  }
+  if (in_type.id() == Type::LIST || is_binary_like(in_type.id())) {
+    kernel->reset(
+        new OffsetWidthCastKernel<int32_t, int64_t>(std::move(child_caster), out_type));
+  } else {
+    kernel->reset(
+        new OffsetWidthCastKernel<int64_t, int32_t>(std::move(child_caster), out_type));
+  }
+  return Status::OK();
+}
+
+Status GetStringViewCastFunc(const DataType& in_type,
+                             const std::shared_ptr<DataType>& out_type,
+                             std::unique_ptr<UnaryKernel>* kernel) {
+  if (in_type.id() == Type::STRING && out_type->id() == Type::STRING_VIEW) {
+    kernel->reset(new StringToViewCastKernel(out_type));
+  } else if (in_type.id() == Type::STRING_VIEW && out_type->id() == Type::STRING) {
+    kernel->reset(new ViewToStringCastKernel(out_type));
+  } else {
+    std::stringstream ss;
+    ss << "No cast implemented from " << in_type.ToString() << " to "
+       << out_type->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
+  if (in_type.id() == Type::RUN_LENGTH_ENCODED ||
+      out_type->id() == Type::RUN_LENGTH_ENCODED) {
+    return GetRunLengthEncodedCastFunc(in_type, out_type, options, kernel);
+  }
+  const Type::type other_offset_width = OtherOffsetWidth(in_type.id());
+  if (other_offset_width != Type::NA && out_type->id() == other_offset_width) {
+    return GetOffsetWidthCastFunc(in_type, out_type, options, kernel);
+  }
+  if (in_type.id() == Type::STRING_VIEW || out_type->id() == Type::STRING_VIEW) {
+    return GetStringViewCastFunc(in_type, out_type, kernel);
+  }
   switch (in_type.id()) {
     CAST_FUNCTION_CASE(NullType);
     CAST_FUNCTION_CASE(BooleanType);
@@ -989,10 +2269,17 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
     CAST_FUNCTION_CASE(Time32Type);
     CAST_FUNCTION_CASE(Time64Type);
     CAST_FUNCTION_CASE(TimestampType);
-    CAST_FUNCTION_CASE(DictionaryType);
+    CAST_FUNCTION_CASE(StringType);
+    CAST_FUNCTION_CASE(Decimal128Type);
+    case Type::DICTIONARY:
+      RETURN_NOT_OK(GetDictionaryCastFunc(in_type, out_type, options, kernel));
+      break;
     case Type::LIST:
       RETURN_NOT_OK(GetListCastFunc(in_type, out_type, options, kernel));
       break;
+    case Type::UNION:
+      RETURN_NOT_OK(GetUnionCastFunc(in_type, out_type, options, kernel));
+      break;
     default:
       break;
   }
@@ -1008,12 +2295,20 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
 Status Cast(FunctionContext* ctx, const Datum& value,
             const std::shared_ptr<DataType>& out_type, const CastOptions& options,
             Datum* out) {
+  KernelProfileScope profile(ctx, "Cast");
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Cast input Datum was not array-like");
+  }
+
   // Dynamic dispatch to obtain right cast function
   std::unique_ptr<UnaryKernel> func;
   RETURN_NOT_OK(GetCastFunction(*value.type(), out_type, options, &func));
 
+  // Cast kernels are stateless, so the chunks of a ChunkedArray can be
+  // processed concurrently
   std::vector<Datum> result;
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func.get(), value, &result));
+  RETURN_NOT_OK(
+      detail::InvokeUnaryArrayKernelParallel(ctx, func.get(), value, &result));
 
   *out = detail::WrapDatumsLike(value, result);
   return Status::OK();
@@ -1029,5 +2324,54 @@ Status Cast(FunctionContext* ctx, const Array& array,
   return Status::OK();
 }
 
+Status Cast(FunctionContext* ctx, const Table& table,
+            const std::shared_ptr<Schema>& to_schema, const CastOptions& options,
+            std::shared_ptr<Table>* out) {
+  KernelProfileScope profile(ctx, "Cast");
+  const int num_columns = table.num_columns();
+  if (to_schema->num_fields() != num_columns) {
+    std::stringstream ss;
+    ss << "Target schema has " << to_schema->num_fields() << " fields, table has "
+       << num_columns << " columns";
+    return Status::Invalid(ss.str());
+  }
+
+  std::vector<std::unique_ptr<UnaryKernel>> kernels(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    RETURN_NOT_OK(GetCastFunction(*table.column(i)->type(), to_schema->field(i)->type(),
+                                  options, &kernels[i]));
+  }
+
+  // Flatten all chunks of all columns into a single set of tasks so that
+  // wide tables with few chunks per column still use all threads
+  std::vector<std::pair<int, int>> tasks;
+  std::vector<std::vector<std::shared_ptr<Array>>> out_chunks(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    const int num_chunks = table.column(i)->data()->num_chunks();
+    out_chunks[i].resize(num_chunks);
+    for (int j = 0; j < num_chunks; ++j) {
+      tasks.emplace_back(i, j);
+    }
+  }
+
+  RETURN_NOT_OK(detail::ParallelInvoke(
+      ctx, static_cast<int>(tasks.size()), [&](FunctionContext* task_ctx, int k) {
+        const int i = tasks[k].first;
+        const int j = tasks[k].second;
+        Datum casted;
+        RETURN_NOT_OK(kernels[i]->Call(
+            task_ctx, Datum(table.column(i)->data()->chunk(j)), &casted));
+        out_chunks[i][j] = MakeArray(casted.array());
+        return Status::OK();
+      }));
+
+  std::vector<std::shared_ptr<Column>> columns(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    columns[i] = std::make_shared<Column>(to_schema->field(i), out_chunks[i]);
+  }
+  *out = Table::Make(to_schema, columns, table.num_rows());
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -31,14 +31,23 @@ class Array;
 class ChunkedArray;
 class Column;
 class DataType;
+class Schema;
+class Table;
 
 namespace compute {
 
 struct ARROW_EXPORT CastOptions {
-  CastOptions() : allow_int_overflow(false), allow_time_truncate(false) {}
+  CastOptions()
+      : allow_int_overflow(false),
+        allow_time_truncate(false),
+        allow_decimal_truncate(false) {}
 
   bool allow_int_overflow;
   bool allow_time_truncate;
+
+  /// Whether decimal casts may drop the digits below the output scale
+  /// instead of failing
+  bool allow_decimal_truncate;
 };
 
 /// \since 0.7.0
@@ -62,6 +71,11 @@ Status Cast(FunctionContext* context, const Array& value,
             std::shared_ptr<Array>* out);
 
 /// \brief Cast from one value to another
+///
+/// Run-length encoded values can be cast to run-length encoded values of
+/// another type, casting each run once, or decoded to any type their values
+/// cast to. Any array can be run-length encoded.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value datum to cast
 /// \param[in] to_type type to cast to
@@ -75,6 +89,21 @@ Status Cast(FunctionContext* context, const Datum& value,
             const std::shared_ptr<DataType>& to_type, const CastOptions& options,
             Datum* out);
 
+/// \brief Cast the columns of a table to the types of a target schema
+/// \param[in] context the FunctionContext
+/// \param[in] table table to cast
+/// \param[in] to_schema schema to cast to, must have as many fields as the
+/// table has columns
+/// \param[in] options casting options
+/// \param[out] out resulting table
+///
+/// \note The chunks of all columns are cast as independent tasks using up to
+/// context->num_threads() threads
+ARROW_EXPORT
+Status Cast(FunctionContext* context, const Table& table,
+            const std::shared_ptr<Schema>& to_schema, const CastOptions& options,
+            std::shared_ptr<Table>* out);
+
 }  // namespace compute
 }  // namespace arrow
 
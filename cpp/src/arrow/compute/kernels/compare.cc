@@ -0,0 +1,555 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/compare.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string-view-util.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+namespace {
+
+struct Equal {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left == right;
+  }
+};
+
+struct NotEqual {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left != right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left >= right;
+  }
+};
+
+struct Less {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left < right;
+  }
+};
+
+struct LessEqual {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left <= right;
+  }
+};
+
+// The operator giving the same result with the sides swapped
+CompareOperator FlipOperator(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::GREATER:
+      return CompareOperator::LESS;
+    case CompareOperator::GREATER_EQUAL:
+      return CompareOperator::LESS_EQUAL;
+    case CompareOperator::LESS:
+      return CompareOperator::GREATER;
+    case CompareOperator::LESS_EQUAL:
+      return CompareOperator::GREATER_EQUAL;
+    default:
+      return op;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Vectorizable comparison loops
+//
+// Values are compared a block at a time into bytes of 0 or 1, which the
+// compiler turns into packed compares, then the bytes are packed into the
+// output bitmap. As for the cast loops, the comparisons are compiled for each
+// instruction set supported by DynamicDispatch.
+
+// Number of values compared into bytes before being packed
+constexpr int64_t kCompareBlockSize = 1024;
+
+#define COMPARE_LOOPS(SUFFIX, TARGET_ATTR)                                         \
+  template <typename T, typename Op>                                               \
+  TARGET_ATTR void CompareArrays##SUFFIX(const T* left, const T* right,            \
+                                         int64_t length, uint8_t* out) {           \
+    for (int64_t i = 0; i < length; ++i) {                                         \
+      out[i] = static_cast<uint8_t>(Op::Call(left[i], right[i]));                  \
+    }                                                                              \
+  }                                                                                \
+                                                                                   \
+  template <typename T, typename Op>                                               \
+  TARGET_ATTR void CompareToScalar##SUFFIX(const T* left, T right, int64_t length, \
+                                           uint8_t* out) {                         \
+    for (int64_t i = 0; i < length; ++i) {                                         \
+      out[i] = static_cast<uint8_t>(Op::Call(left[i], right));                     \
+    }                                                                              \
+  }
+
+COMPARE_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+COMPARE_LOOPS(Sse42, ARROW_TARGET_SSE4_2)
+COMPARE_LOOPS(Avx2, ARROW_TARGET_AVX2)
+COMPARE_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef COMPARE_LOOPS
+
+template <typename T, typename Op>
+struct CompareArraysDynamic {
+  using FunctionType = void (*)(const T*, const T*, int64_t, uint8_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, CompareArraysDefault<T, Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, CompareArraysSse42<T, Op>},
+        {DispatchLevel::AVX2, CompareArraysAvx2<T, Op>},
+        {DispatchLevel::AVX512, CompareArraysAvx512<T, Op>},
+#endif
+    };
+  }
+};
+
+template <typename T, typename Op>
+struct CompareToScalarDynamic {
+  using FunctionType = void (*)(const T*, T, int64_t, uint8_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, CompareToScalarDefault<T, Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, CompareToScalarSse42<T, Op>},
+        {DispatchLevel::AVX2, CompareToScalarAvx2<T, Op>},
+        {DispatchLevel::AVX512, CompareToScalarAvx512<T, Op>},
+#endif
+    };
+  }
+};
+
+// Pack bytes of 0 or 1 into a bitmap, from a byte boundary. Eight bytes are
+// gathered into one bitmap byte by a multiplication, like a movemask would
+void PackBytes(const uint8_t* bytes, int64_t length, uint8_t* bitmap) {
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    bitmap[i / 8] = static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+  }
+  if (i < length) {
+    uint8_t last = 0;
+    for (int64_t j = 0; i + j < length; ++j) {
+      last = static_cast<uint8_t>(last | (bytes[i + j] << j));
+    }
+    bitmap[i / 8] = last;
+  }
+}
+
+template <typename T, typename Op>
+void CompareArrays(const T* left, const T* right, int64_t length, uint8_t* bitmap) {
+  static DynamicDispatch<CompareArraysDynamic<T, Op>> dispatch;
+  uint8_t bytes[kCompareBlockSize];
+  for (int64_t i = 0; i < length; i += kCompareBlockSize) {
+    const int64_t block_length = std::min(kCompareBlockSize, length - i);
+    dispatch.func(left + i, right + i, block_length, bytes);
+    PackBytes(bytes, block_length, bitmap + i / 8);
+  }
+}
+
+template <typename T, typename Op>
+void CompareToScalar(const T* left, T right, int64_t length, uint8_t* bitmap) {
+  static DynamicDispatch<CompareToScalarDynamic<T, Op>> dispatch;
+  uint8_t bytes[kCompareBlockSize];
+  for (int64_t i = 0; i < length; i += kCompareBlockSize) {
+    const int64_t block_length = std::min(kCompareBlockSize, length - i);
+    dispatch.func(left + i, right, block_length, bytes);
+    PackBytes(bytes, block_length, bitmap + i / 8);
+  }
+}
+
+template <typename Op>
+void CompareBinaryArrays(const BinaryArray& left, const BinaryArray& right,
+                         uint8_t* bitmap) {
+  internal::BitmapWriter writer(bitmap, 0, left.length());
+  for (int64_t i = 0; i < left.length(); ++i) {
+    int32_t left_length, right_length;
+    const uint8_t* left_value = left.GetValue(i, &left_length);
+    const uint8_t* right_value = right.GetValue(i, &right_length);
+    int cmp = std::memcmp(left_value, right_value,
+                          static_cast<size_t>(std::min(left_length, right_length)));
+    if (cmp == 0) {
+      cmp = (left_length > right_length) - (left_length < right_length);
+    }
+    if (Op::Call(cmp, 0)) {
+      writer.Set();
+    } else {
+      writer.Clear();
+    }
+    writer.Next();
+  }
+  writer.Finish();
+}
+
+// Equality is decided from the length and prefix held by the entries unless
+// both match, ordering from the prefixes unless they are equal
+template <typename Op>
+void CompareStringViewArrays(const StringViewArray& left, const StringViewArray& right,
+                             uint8_t* bitmap) {
+  constexpr bool kEquality =
+      std::is_same<Op, Equal>::value || std::is_same<Op, NotEqual>::value;
+  const StringViewEntry* left_views = left.raw_views();
+  const StringViewEntry* right_views = right.raw_views();
+  const int64_t length = left.length();
+  uint8_t bytes[kCompareBlockSize];
+  for (int64_t i = 0; i < length; i += kCompareBlockSize) {
+    const int64_t block_length = std::min(kCompareBlockSize, length - i);
+    for (int64_t j = 0; j < block_length; ++j) {
+      const StringViewEntry& left_view = left_views[i + j];
+      const StringViewEntry& right_view = right_views[i + j];
+      int cmp;
+      if (kEquality) {
+        cmp = internal::StringViewEquals(left_view, left.raw_data_buffers(), right_view,
+                                         right.raw_data_buffers())
+                  ? 0
+                  : 1;
+      } else {
+        cmp = internal::StringViewCompare(left_view, left.raw_data_buffers(), right_view,
+                                          right.raw_data_buffers());
+      }
+      bytes[j] = static_cast<uint8_t>(Op::Call(cmp, 0));
+    }
+    PackBytes(bytes, block_length, bitmap + i / 8);
+  }
+}
+
+// Three-way comparison of two decimals, read in place as signed 128-bit
+// integers
+inline int CompareDecimals(const uint8_t* left, const uint8_t* right) {
+  int64_t left_high, right_high;
+  uint64_t left_low, right_low;
+  std::memcpy(&left_low, left, sizeof(left_low));
+  std::memcpy(&left_high, left + 8, sizeof(left_high));
+  std::memcpy(&right_low, right, sizeof(right_low));
+  std::memcpy(&right_high, right + 8, sizeof(right_high));
+  left_high = BitUtil::FromLittleEndian(left_high);
+  right_high = BitUtil::FromLittleEndian(right_high);
+  if (left_high != right_high) {
+    return left_high < right_high ? -1 : 1;
+  }
+  left_low = BitUtil::FromLittleEndian(left_low);
+  right_low = BitUtil::FromLittleEndian(right_low);
+  return (left_low > right_low) - (left_low < right_low);
+}
+
+// Compare decimals to others at a stride of right_stride bytes, 0 to compare
+// them all to the same value
+template <typename Op>
+void CompareDecimalArrays(const uint8_t* left, const uint8_t* right,
+                          int64_t right_stride, int64_t length, uint8_t* bitmap) {
+  constexpr int64_t kByteWidth = 16;
+  uint8_t bytes[kCompareBlockSize];
+  for (int64_t i = 0; i < length; i += kCompareBlockSize) {
+    const int64_t block_length = std::min(kCompareBlockSize, length - i);
+    for (int64_t j = 0; j < block_length; ++j) {
+      const int cmp =
+          CompareDecimals(left + (i + j) * kByteWidth, right + (i + j) * right_stride);
+      bytes[j] = static_cast<uint8_t>(Op::Call(cmp, 0));
+    }
+    PackBytes(bytes, block_length, bitmap + i / 8);
+  }
+}
+
+// ----------------------------------------------------------------------
+// Comparison of array pieces
+
+template <typename Op>
+Status ComparePiece(FunctionContext* ctx, const Array& left, const Array* right,
+                    const Scalar* right_scalar, std::shared_ptr<Array>* out) {
+  if (left.type_id() == Type::RUN_LENGTH_ENCODED) {
+    // Each run is compared once, and the output shares the run ends
+    const auto& runs = static_cast<const RunLengthEncodedArray&>(left);
+    std::shared_ptr<Array> values;
+    const auto run_values = runs.values()->Slice(runs.first_run(), runs.num_runs());
+    RETURN_NOT_OK(ComparePiece<Op>(ctx, *run_values, nullptr, right_scalar, &values));
+    *out = MakeArray(
+        detail::ReplaceRunValues(runs, run_length_encoded(boolean()), values->data()));
+    return Status::OK();
+  }
+
+  const int64_t length = left.length();
+  auto result = std::make_shared<ArrayData>(boolean(), length);
+  result->buffers.resize(2);
+
+  if (right_scalar != nullptr && !right_scalar->is_valid) {
+    // Comparing to null is null
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length, &result->buffers[0]));
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length, &result->buffers[1]));
+    result->null_count = length;
+    *out = MakeArray(result);
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(detail::ComputeValidity(ctx, *left.data(),
+                                right == nullptr ? nullptr : right->data().get(),
+                                result.get()));
+  RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length, &result->buffers[1]));
+  uint8_t* bitmap = result->buffers[1]->mutable_data();
+  if (length == 0) {
+    *out = MakeArray(result);
+    return Status::OK();
+  }
+
+#define PRIMITIVE_CASE(InType)                                                         \
+  case InType::type_id: {                                                              \
+    using T = typename InType::c_type;                                                 \
+    const T* left_values = GetValues<T>(*left.data(), 1);                              \
+    if (right_scalar != nullptr) {                                                     \
+      const auto& scalar = static_cast<const PrimitiveScalar<InType>&>(*right_scalar); \
+      CompareToScalar<T, Op>(left_values, scalar.value, length, bitmap);               \
+    } else {                                                                           \
+      CompareArrays<T, Op>(left_values, GetValues<T>(*right->data(), 1), length,       \
+                           bitmap);                                                    \
+    }                                                                                  \
+  } break
+
+  switch (left.type_id()) {
+    PRIMITIVE_CASE(UInt8Type);
+    PRIMITIVE_CASE(Int8Type);
+    PRIMITIVE_CASE(UInt16Type);
+    PRIMITIVE_CASE(Int16Type);
+    PRIMITIVE_CASE(UInt32Type);
+    PRIMITIVE_CASE(Int32Type);
+    PRIMITIVE_CASE(UInt64Type);
+    PRIMITIVE_CASE(Int64Type);
+    PRIMITIVE_CASE(FloatType);
+    PRIMITIVE_CASE(DoubleType);
+    PRIMITIVE_CASE(Date32Type);
+    PRIMITIVE_CASE(Date64Type);
+    PRIMITIVE_CASE(Time32Type);
+    PRIMITIVE_CASE(Time64Type);
+    PRIMITIVE_CASE(TimestampType);
+    case Type::DECIMAL: {
+      const uint8_t* left_values = left.data()->buffers[1]->data() + left.offset() * 16;
+      if (right_scalar != nullptr) {
+        uint8_t right_value[16];
+        static_cast<const Decimal128Scalar&>(*right_scalar).value.ToBytes(right_value);
+        CompareDecimalArrays<Op>(left_values, right_value, 0, length, bitmap);
+      } else {
+        const uint8_t* right_values =
+            right->data()->buffers[1]->data() + right->offset() * 16;
+        CompareDecimalArrays<Op>(left_values, right_values, 16, length, bitmap);
+      }
+    } break;
+    case Type::BINARY:
+    case Type::STRING:
+      if (right_scalar == nullptr) {
+        CompareBinaryArrays<Op>(static_cast<const BinaryArray&>(left),
+                                static_cast<const BinaryArray&>(*right), bitmap);
+        break;
+      }
+    // Fall through
+    case Type::STRING_VIEW:
+      if (right_scalar == nullptr && left.type_id() == Type::STRING_VIEW) {
+        CompareStringViewArrays<Op>(static_cast<const StringViewArray&>(left),
+                                    static_cast<const StringViewArray&>(*right), bitmap);
+        break;
+      }
+    // Fall through
+    default: {
+      std::stringstream ss;
+      ss << "Compare not implemented for " << left.type()->ToString()
+         << (right_scalar != nullptr ? " and a scalar" : "");
+      return Status::NotImplemented(ss.str());
+    }
+  }
+
+#undef PRIMITIVE_CASE
+
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+typedef Status (*ComparePieceFunction)(FunctionContext*, const Array&, const Array*,
+                                       const Scalar*, std::shared_ptr<Array>*);
+
+ComparePieceFunction GetComparePieceFunction(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return ComparePiece<Equal>;
+    case CompareOperator::NOT_EQUAL:
+      return ComparePiece<NotEqual>;
+    case CompareOperator::GREATER:
+      return ComparePiece<Greater>;
+    case CompareOperator::GREATER_EQUAL:
+      return ComparePiece<GreaterEqual>;
+    case CompareOperator::LESS:
+      return ComparePiece<Less>;
+    case CompareOperator::LESS_EQUAL:
+      return ComparePiece<LessEqual>;
+  }
+  return nullptr;
+}
+
+Status DecodeRuns(FunctionContext* ctx, const Datum& value, Datum* out) {
+  if (value.type()->id() != Type::RUN_LENGTH_ENCODED) {
+    *out = value;
+    return Status::OK();
+  }
+  return Cast(ctx, value, detail::RunValueType(value.type()), CastOptions(), out);
+}
+
+int64_t DatumLength(const Datum& value) {
+  return value.kind() == Datum::ARRAY ? value.array()->length
+                                      : value.chunked_array()->length();
+}
+
+class CompareToScalarKernel : public UnaryKernel {
+ public:
+  CompareToScalarKernel(const std::shared_ptr<Scalar>& right,
+                        const CompareOptions& options)
+      : right_(right), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    return Compare(ctx, input, Datum(right_), options_, out);
+  }
+
+ private:
+  std::shared_ptr<Scalar> right_;
+  CompareOptions options_;
+};
+
+}  // namespace
+
+Status Compare(FunctionContext* ctx, const Datum& left, const Datum& right,
+               const CompareOptions& options, Datum* out) {
+  KernelProfileScope profile(ctx, "Compare");
+  const bool left_scalar = left.kind() == Datum::SCALAR;
+  const bool right_scalar = right.kind() == Datum::SCALAR;
+  if (!(left.is_arraylike() || left_scalar) || !(right.is_arraylike() || right_scalar)) {
+    return Status::Invalid("Compare expects arrays, chunked arrays or scalars");
+  }
+  if (left_scalar && right_scalar) {
+    return Status::Invalid("Compare needs at least one array-like side");
+  }
+  if (left_scalar) {
+    return Compare(ctx, right, left, CompareOptions(FlipOperator(options.op)), out);
+  }
+  if (!right_scalar && (left.type()->id() == Type::RUN_LENGTH_ENCODED ||
+                        right.type()->id() == Type::RUN_LENGTH_ENCODED)) {
+    // Runs need not line up between two arrays, those are compared decoded
+    Datum left_values, right_values;
+    RETURN_NOT_OK(DecodeRuns(ctx, left, &left_values));
+    RETURN_NOT_OK(DecodeRuns(ctx, right, &right_values));
+    return Compare(ctx, left_values, right_values, options, out);
+  }
+  // Run-length encoded arrays are compared to scalars of their value type
+  const std::shared_ptr<DataType> left_type =
+      right_scalar ? detail::RunValueType(left.type()) : left.type();
+  if (!left_type->Equals(*right.type())) {
+    std::stringstream ss;
+    ss << "Cannot compare " << left.type()->ToString() << " to "
+       << right.type()->ToString();
+    return Status::Invalid(ss.str());
+  }
+
+  std::vector<std::shared_ptr<Array>> left_pieces, right_pieces;
+  if (right_scalar) {
+    if (left.kind() == Datum::ARRAY) {
+      left_pieces.push_back(MakeArray(left.array()));
+    } else {
+      left_pieces = left.chunked_array()->chunks();
+    }
+  } else {
+    if (DatumLength(left) != DatumLength(right)) {
+      return Status::Invalid("Compare needs array-like sides of the same length");
+    }
+    detail::AlignChunks(left, right, &left_pieces, &right_pieces);
+  }
+
+  ComparePieceFunction compare = GetComparePieceFunction(options.op);
+  DCHECK_NE(compare, nullptr);
+  const int num_pieces = static_cast<int>(left_pieces.size());
+  std::vector<std::shared_ptr<Array>> outputs(num_pieces);
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_pieces, [&](FunctionContext* task_ctx, int i) {
+        return compare(task_ctx, *left_pieces[i],
+                       right_scalar ? nullptr : right_pieces[i].get(),
+                       right_scalar ? right.scalar().get() : nullptr, &outputs[i]);
+      }));
+
+  if (left.kind() == Datum::ARRAY && right.kind() != Datum::CHUNKED_ARRAY) {
+    *out = Datum(outputs[0]);
+    return Status::OK();
+  }
+  if (outputs.empty()) {
+    // Chunked arrays of length 0
+    BooleanBuilder builder(ctx->memory_pool());
+    outputs.emplace_back();
+    RETURN_NOT_OK(builder.Finish(&outputs.back()));
+  }
+  *out = Datum(std::make_shared<ChunkedArray>(outputs));
+  return Status::OK();
+}
+
+Status GetCompareToScalarKernel(const std::shared_ptr<Scalar>& right,
+                                const CompareOptions& options,
+                                std::unique_ptr<UnaryKernel>* kernel) {
+  kernel->reset(new CompareToScalarKernel(right, options));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_COMPARE_H
+#define ARROW_COMPUTE_KERNELS_COMPARE_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+class UnaryKernel;
+struct Datum;
+struct Scalar;
+
+enum class CompareOperator { EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL };
+
+struct ARROW_EXPORT CompareOptions {
+  explicit CompareOptions(CompareOperator op) : op(op) {}
+
+  CompareOperator op;
+};
+
+/// \brief Compare values element-wise into a boolean array
+///
+/// Either side can be an array-like Datum or a scalar, but not both scalars.
+/// Array-like sides must have the same length; chunked arrays need not be
+/// chunked alike. The output is null where either side is null, and is a
+/// chunked array if either side is one.
+///
+/// Numeric, decimal and temporal values are compared, with both sides of the
+/// same type. Binary and string arrays can be compared to each other, but not
+/// to scalars. A run-length encoded array is compared to a scalar of its value
+/// type once per run, into a run-length encoded boolean output sharing its
+/// run ends, and decoded to be compared to another array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left left-hand side
+/// \param[in] right right-hand side
+/// \param[in] options the comparison operator
+/// \param[out] out boolean array-like output
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               const CompareOptions& options, Datum* out);
+
+/// \brief Get a kernel comparing its input to a scalar, so that comparisons
+/// can be chained with other kernels, e.g. by GetFusedKernel
+///
+/// \param[in] right the right-hand side of all comparisons
+/// \param[in] options the comparison operator
+/// \param[out] kernel the kernel, taking the left-hand side as input
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetCompareToScalarKernel(const std::shared_ptr<Scalar>& right,
+                                const CompareOptions& options,
+                                std::unique_ptr<UnaryKernel>* kernel);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_COMPARE_H
@@ -0,0 +1,286 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/count-distinct.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+constexpr uint8_t kSketchFormatVersion = 1;
+constexpr int64_t kSketchHeaderSize = 2;
+
+constexpr uint64_t kHashSeed = 0;
+
+// The width in bytes of the values of a type, or -1 if they are not stored
+// as fixed-width values of whole bytes
+int ByteWidth(const DataType& type) {
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == nullptr || type.id() == Type::BOOL) {
+    return -1;
+  }
+  return fixed_width->bit_width() / 8;
+}
+
+template <typename Visit>
+void VisitValid(const ArrayData& data, Visit&& visit) {
+  VisitValidRuns(data, [&](int64_t position, int64_t length) {
+    for (int64_t i = position; i < position + length; ++i) {
+      visit(i);
+    }
+  });
+}
+
+template <typename IndexType>
+void MarkReferenced(const ArrayData& indices, std::vector<bool>* referenced) {
+  const IndexType* values = GetValues<IndexType>(indices, 1);
+  VisitValid(indices, [&](int64_t i) { (*referenced)[values[i]] = true; });
+}
+
+// Call visit(i, hash) for each valid value i of data, whose values are not
+// dictionary-encoded
+template <typename Visit>
+Status VisitHashes(const ArrayData& data, Visit&& visit) {
+  const DataType& type = *data.type;
+  if (data.length == 0 || type.id() == Type::NA) {
+    return Status::OK();
+  }
+  if (type.id() == Type::BOOL) {
+    const uint8_t* bits = data.buffers[1]->data();
+    VisitValid(data, [&](int64_t i) {
+      const uint8_t value = BitUtil::GetBit(bits, data.offset + i) ? 1 : 0;
+      visit(i, HashUtil::MurmurHash2_64(&value, 1, kHashSeed));
+    });
+  } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    const int32_t* offsets = GetValues<int32_t>(data, 1);
+    const uint8_t* bytes = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+    VisitValid(data, [&](int64_t i) {
+      visit(i, HashUtil::MurmurHash2_64(bytes + offsets[i], offsets[i + 1] - offsets[i],
+                                        kHashSeed));
+    });
+  } else if (type.id() != Type::DICTIONARY && ByteWidth(type) > 0) {
+    const int byte_width = ByteWidth(type);
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+    VisitValid(data, [&](int64_t i) {
+      visit(i, HashUtil::MurmurHash2_64(values + i * byte_width, byte_width, kHashSeed));
+    });
+  } else {
+    std::stringstream ss;
+    ss << "Counting distinct values not implemented for " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+Status UpdateSketch(const ArrayData& data, DistinctCountSketch* sketch) {
+  if (data.type->id() != Type::DICTIONARY) {
+    return VisitHashes(data, [sketch](int64_t, uint64_t hash) { sketch->AddHash(hash); });
+  }
+  if (data.length == 0) {
+    return Status::OK();
+  }
+
+  // The dictionary values referenced are hashed once each
+  const auto& dict_type = static_cast<const DictionaryType&>(*data.type);
+  const std::shared_ptr<Array> dictionary = dict_type.dictionary();
+  std::vector<bool> referenced(static_cast<size_t>(dictionary->length()), false);
+  switch (dict_type.index_type()->id()) {
+    case Type::INT8:
+      MarkReferenced<int8_t>(data, &referenced);
+      break;
+    case Type::INT16:
+      MarkReferenced<int16_t>(data, &referenced);
+      break;
+    case Type::INT32:
+      MarkReferenced<int32_t>(data, &referenced);
+      break;
+    case Type::INT64:
+      MarkReferenced<int64_t>(data, &referenced);
+      break;
+    default:
+      return Status::NotImplemented("Dictionary index type " +
+                                    dict_type.index_type()->ToString());
+  }
+  return VisitHashes(*dictionary->data(), [&](int64_t j, uint64_t hash) {
+    if (referenced[j]) {
+      sketch->AddHash(hash);
+    }
+  });
+}
+
+std::vector<std::shared_ptr<ArrayData>> GetChunks(const Datum& values) {
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.array());
+  } else {
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  }
+  return chunks;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// DistinctCountSketch
+
+constexpr int DistinctCountSketch::kMinPrecision;
+constexpr int DistinctCountSketch::kMaxPrecision;
+constexpr int DistinctCountSketch::kDefaultPrecision;
+
+DistinctCountSketch::DistinctCountSketch(int precision)
+    : precision_(std::min(std::max(precision, kMinPrecision), kMaxPrecision)),
+      registers_(static_cast<size_t>(1) << precision_, 0) {}
+
+void DistinctCountSketch::AddHash(uint64_t hash) {
+  const uint64_t index = hash & ((static_cast<uint64_t>(1) << precision_) - 1);
+  const uint64_t rest = hash >> precision_;
+  const uint8_t rank = static_cast<uint8_t>(
+      rest == 0 ? 64 - precision_ + 1 : BitUtil::CountTrailingZeros(rest) + 1);
+  if (rank > registers_[index]) {
+    registers_[index] = rank;
+  }
+}
+
+Status DistinctCountSketch::Update(const Datum& values) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("DistinctCountSketch expects an array or a chunked array");
+  }
+  for (const auto& chunk : GetChunks(values)) {
+    RETURN_NOT_OK(UpdateSketch(*chunk, this));
+  }
+  return Status::OK();
+}
+
+Status DistinctCountSketch::Merge(const DistinctCountSketch& other) {
+  if (other.precision_ != precision_) {
+    std::stringstream ss;
+    ss << "Cannot merge sketches of precisions " << precision_ << " and "
+       << other.precision_;
+    return Status::Invalid(ss.str());
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+int64_t DistinctCountSketch::Estimate() const {
+  const double m = static_cast<double>(registers_.size());
+  double sum = 0.0;
+  int64_t num_zeros = 0;
+  for (uint8_t rank : registers_) {
+    sum += std::ldexp(1.0, -rank);
+    num_zeros += rank == 0;
+  }
+  const double alpha = 0.7213 / (1.0 + 1.079 / m);
+  double estimate = alpha * m * m / sum;
+  // Small counts leave registers empty, from which linear counting gives a
+  // better estimate. The 64-bit hashes need no correction for large counts
+  if (estimate <= 2.5 * m && num_zeros > 0) {
+    estimate = m * std::log(m / static_cast<double>(num_zeros));
+  }
+  return static_cast<int64_t>(std::llround(estimate));
+}
+
+Status DistinctCountSketch::Serialize(MemoryPool* pool,
+                                      std::shared_ptr<Buffer>* out) const {
+  const int64_t size = kSketchHeaderSize + static_cast<int64_t>(registers_.size());
+  RETURN_NOT_OK(AllocateBuffer(pool, size, out));
+  uint8_t* data = (*out)->mutable_data();
+  data[0] = kSketchFormatVersion;
+  data[1] = static_cast<uint8_t>(precision_);
+  std::memcpy(data + kSketchHeaderSize, registers_.data(), registers_.size());
+  return Status::OK();
+}
+
+Status DistinctCountSketch::Deserialize(const Buffer& buffer,
+                                        std::unique_ptr<DistinctCountSketch>* out) {
+  const uint8_t* data = buffer.data();
+  if (buffer.size() < kSketchHeaderSize || data[0] != kSketchFormatVersion) {
+    return Status::Invalid("Not a serialized DistinctCountSketch");
+  }
+  const int precision = data[1];
+  if (precision < kMinPrecision || precision > kMaxPrecision ||
+      buffer.size() != kSketchHeaderSize + (static_cast<int64_t>(1) << precision)) {
+    return Status::Invalid("Malformed serialized DistinctCountSketch");
+  }
+  std::unique_ptr<DistinctCountSketch> sketch(new DistinctCountSketch(precision));
+  std::memcpy(sketch->registers_.data(), data + kSketchHeaderSize,
+              sketch->registers_.size());
+  *out = std::move(sketch);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Kernels
+
+Status SketchDistinct(FunctionContext* ctx, const Datum& values, int precision,
+                      std::unique_ptr<DistinctCountSketch>* out) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("SketchDistinct expects an array or a chunked array");
+  }
+  const std::vector<std::shared_ptr<ArrayData>> chunks = GetChunks(values);
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<DistinctCountSketch> sketches(num_chunks, DistinctCountSketch(precision));
+  RETURN_NOT_OK(detail::ParallelInvoke(ctx, num_chunks, [&](FunctionContext*, int i) {
+    return sketches[i].Update(Datum(chunks[i]));
+  }));
+
+  std::unique_ptr<DistinctCountSketch> sketch(new DistinctCountSketch(precision));
+  for (const DistinctCountSketch& chunk_sketch : sketches) {
+    RETURN_NOT_OK(sketch->Merge(chunk_sketch));
+  }
+  *out = std::move(sketch);
+  return Status::OK();
+}
+
+Status ApproximateCountDistinct(FunctionContext* ctx, const Datum& values,
+                                Datum* out) {
+  KernelProfileScope profile(ctx, "ApproximateCountDistinct");
+  std::unique_ptr<DistinctCountSketch> sketch;
+  RETURN_NOT_OK(
+      SketchDistinct(ctx, values, DistinctCountSketch::kDefaultPrecision, &sketch));
+  *out = Datum(std::make_shared<PrimitiveScalar<Int64Type>>(sketch->Estimate()));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_COUNT_DISTINCT_H
+#define ARROW_COMPUTE_KERNELS_COUNT_DISTINCT_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \class DistinctCountSketch
+/// \brief Approximate count of distinct values (HyperLogLog)
+///
+/// A value is hashed to 64 bits, whose low precision() bits select one of
+/// 2^precision() registers, which keeps the largest number of trailing zeros
+/// seen in the other bits, plus one. The count is estimated from the harmonic
+/// mean of the registers as in Flajolet et al., "HyperLogLog: the analysis of
+/// a near-optimal cardinality estimation algorithm", switching to linear
+/// counting for small counts. The relative standard error is about
+/// 1.04 / sqrt(2^precision()), 0.8% for the default precision of 14, for 16KB
+/// of registers whatever the number of values.
+///
+/// Sketches of the same precision are merged by taking the maximum of each
+/// register, and serialize to their registers, so that sketches computed by
+/// different threads or processes can be combined.
+class ARROW_EXPORT DistinctCountSketch {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 14;
+
+  /// \param[in] precision the log2 of the number of registers, clamped to
+  /// [kMinPrecision, kMaxPrecision]
+  explicit DistinctCountSketch(int precision = kDefaultPrecision);
+
+  /// \brief Add the 64-bit hash of a value
+  void AddHash(uint64_t hash);
+
+  /// \brief Add the non-null values of an array-like input, such as the
+  /// column of a record batch
+  ///
+  /// Fixed-width values are hashed by their bytes and binary values by their
+  /// data. Dictionary-encoded values are hashed as their dictionary values,
+  /// so that sketches of arrays with different dictionaries can be merged.
+  Status Update(const Datum& values);
+
+  /// \brief Add the values counted by another sketch
+  /// \return Status, Invalid if the precisions differ
+  Status Merge(const DistinctCountSketch& other);
+
+  /// \return the estimated number of distinct values added
+  int64_t Estimate() const;
+
+  /// \brief Serialize the sketch: a format version byte, the precision byte
+  /// and the registers, a byte each
+  Status Serialize(MemoryPool* pool, std::shared_ptr<Buffer>* out) const;
+
+  /// \brief Read a sketch serialized by Serialize
+  static Status Deserialize(const Buffer& buffer,
+                            std::unique_ptr<DistinctCountSketch>* out);
+
+  int precision() const { return precision_; }
+
+ private:
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+/// \brief Sketch the distinct values of an array-like input
+///
+/// The chunks of a ChunkedArray are sketched in parallel, using up to
+/// context->num_threads() threads, and the sketches merged.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input, see DistinctCountSketch::Update
+/// \param[in] precision the precision of the sketch
+/// \param[out] out the sketch
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SketchDistinct(FunctionContext* context, const Datum& values, int precision,
+                      std::unique_ptr<DistinctCountSketch>* out);
+
+/// \brief Approximately count the distinct non-null values, without
+/// materializing them as Unique does
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input, see DistinctCountSketch::Update
+/// \param[out] out int64 scalar, the estimate of a sketch of default precision
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproximateCountDistinct(FunctionContext* context, const Datum& values,
+                                Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_COUNT_DISTINCT_H
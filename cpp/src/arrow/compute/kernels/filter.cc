@@ -0,0 +1,360 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/filter.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// The positions selected by a filter: set and valid bits
+struct Selection {
+  std::shared_ptr<Buffer> bitmap;
+  int64_t offset;
+  int64_t length;
+  int64_t count;
+
+  template <typename Visit>
+  void VisitRuns(Visit&& visit) const {
+    VisitSetBitRuns(bitmap->data(), offset, length, std::forward<Visit>(visit));
+  }
+};
+
+Status MakeSelection(FunctionContext* ctx, const ArrayData& filter, Selection* out) {
+  out->length = filter.length;
+  if (filter.length == 0) {
+    out->offset = 0;
+    out->count = 0;
+    return Status::OK();
+  }
+  if (HasValidityBitmap(filter)) {
+    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), filter.buffers[1]->data(), filter.offset,
+                            filter.buffers[0]->data(), filter.offset, filter.length,
+                            &out->bitmap));
+    out->offset = 0;
+  } else {
+    out->bitmap = filter.buffers[1];
+    out->offset = filter.offset;
+  }
+  out->count = CountSetBits(out->bitmap->data(), out->offset, out->length);
+  return Status::OK();
+}
+
+Status FilterValidity(FunctionContext* ctx, const ArrayData& values,
+                      const Selection& selection, ArrayData* out) {
+  if (!HasValidityBitmap(values)) {
+    out->null_count = 0;
+    return Status::OK();
+  }
+  RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), selection.count, &out->buffers[0]));
+  uint8_t* bitmap = out->buffers[0]->mutable_data();
+  const uint8_t* in_bitmap = values.buffers[0]->data();
+  int64_t position = 0;
+  selection.VisitRuns([&](int64_t start, int64_t length) {
+    CopyBitmap(in_bitmap, values.offset + start, length, bitmap, position);
+    position += length;
+  });
+  out->null_count = selection.count - CountSetBits(bitmap, 0, selection.count);
+  return Status::OK();
+}
+
+Status FilterFixedWidth(FunctionContext* ctx, const ArrayData& values, int byte_width,
+                        const Selection& selection, ArrayData* out) {
+  RETURN_NOT_OK(ctx->Allocate(selection.count * byte_width, &out->buffers[1]));
+  uint8_t* out_values = out->buffers[1]->mutable_data();
+  const uint8_t* in_values = values.buffers[1]->data() + values.offset * byte_width;
+  selection.VisitRuns([&](int64_t start, int64_t length) {
+    std::memcpy(out_values, in_values + start * byte_width,
+                static_cast<size_t>(length * byte_width));
+    out_values += length * byte_width;
+  });
+  return Status::OK();
+}
+
+Status FilterBoolean(FunctionContext* ctx, const ArrayData& values,
+                     const Selection& selection, ArrayData* out) {
+  RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), selection.count, &out->buffers[1]));
+  uint8_t* out_values = out->buffers[1]->mutable_data();
+  int64_t position = 0;
+  selection.VisitRuns([&](int64_t start, int64_t length) {
+    CopyBitmap(values.buffers[1]->data(), values.offset + start, length, out_values,
+               position);
+    position += length;
+  });
+  return Status::OK();
+}
+
+Status FilterBinary(FunctionContext* ctx, const ArrayData& values,
+                    const Selection& selection, ArrayData* out) {
+  const int32_t* offsets = GetValues<int32_t>(values, 1);
+  const uint8_t* data = values.buffers[2] ? values.buffers[2]->data() : nullptr;
+
+  // Size the data buffer before copying
+  int64_t data_length = 0;
+  selection.VisitRuns([&](int64_t start, int64_t length) {
+    data_length += offsets[start + length] - offsets[start];
+  });
+
+  out->buffers.resize(3);
+  const int64_t offsets_size = (selection.count + 1) * sizeof(int32_t);
+  RETURN_NOT_OK(ctx->Allocate(offsets_size, &out->buffers[1]));
+  RETURN_NOT_OK(ctx->Allocate(data_length, &out->buffers[2]));
+  int32_t* out_offsets = reinterpret_cast<int32_t*>(out->buffers[1]->mutable_data());
+  uint8_t* out_data = out->buffers[2]->mutable_data();
+
+  int64_t position = 0;
+  int32_t data_position = 0;
+  selection.VisitRuns([&](int64_t start, int64_t length) {
+    const int32_t base = offsets[start];
+    for (int64_t i = 0; i < length; ++i) {
+      out_offsets[position + i] = data_position + (offsets[start + i] - base);
+    }
+    const int32_t run_bytes = offsets[start + length] - base;
+    if (run_bytes > 0) {
+      std::memcpy(out_data + data_position, data + base, run_bytes);
+    }
+    position += length;
+    data_position += run_bytes;
+  });
+  out_offsets[selection.count] = data_position;
+  return Status::OK();
+}
+
+// Copy the type ids and renumber the offsets of the selected slots in a single
+// pass, collecting the offsets selected from each child. Each child is then
+// taken at once by those offsets
+Status FilterDenseUnion(FunctionContext* ctx, const ArrayData& values,
+                        const Selection& selection, ArrayData* out) {
+  const auto& type = static_cast<const UnionType&>(*values.type);
+  const int num_children = type.num_children();
+  std::vector<int> child_ids(std::numeric_limits<uint8_t>::max() + 1, 0);
+  for (int c = 0; c < num_children; ++c) {
+    child_ids[type.type_codes()[c]] = c;
+  }
+
+  out->buffers.resize(3);
+  RETURN_NOT_OK(ctx->Allocate(selection.count, &out->buffers[1]));
+  RETURN_NOT_OK(ctx->Allocate(selection.count * sizeof(int32_t), &out->buffers[2]));
+  uint8_t* out_type_ids = out->buffers[1]->mutable_data();
+  int32_t* out_offsets = reinterpret_cast<int32_t*>(out->buffers[2]->mutable_data());
+  const uint8_t* type_ids = GetValues<uint8_t>(values, 1);
+  const int32_t* offsets = GetValues<int32_t>(values, 2);
+  const uint8_t* in_bitmap =
+      HasValidityBitmap(values) ? values.buffers[0]->data() : nullptr;
+
+  std::vector<std::vector<int32_t>> child_offsets(num_children);
+  int64_t position = 0;
+  selection.VisitRuns([&](int64_t start, int64_t length) {
+    for (int64_t i = start; i < start + length; ++i, ++position) {
+      if (in_bitmap == nullptr || BitUtil::GetBit(in_bitmap, values.offset + i)) {
+        std::vector<int32_t>& selected = child_offsets[child_ids[type_ids[i]]];
+        out_type_ids[position] = type_ids[i];
+        out_offsets[position] = static_cast<int32_t>(selected.size());
+        selected.push_back(offsets[i]);
+      } else {
+        // Null slots point to the first value of the first child
+        out_type_ids[position] = type.type_codes()[0];
+        out_offsets[position] = 0;
+      }
+    }
+  });
+
+  out->child_data.resize(num_children);
+  return detail::ParallelInvoke(
+      ctx, num_children, [&](FunctionContext* task_ctx, int c) {
+        const std::vector<int32_t>& selected = child_offsets[c];
+        auto child_indices = ArrayData::Make(
+            int32(), static_cast<int64_t>(selected.size()),
+            {nullptr, std::make_shared<Buffer>(
+                          reinterpret_cast<const uint8_t*>(selected.data()),
+                          static_cast<int64_t>(selected.size() * sizeof(int32_t)))},
+            0);
+        Datum taken;
+        RETURN_NOT_OK(Take(task_ctx, Datum(values.child_data[c]), Datum(child_indices),
+                           &taken));
+        out->child_data[c] = taken.array();
+        return Status::OK();
+      });
+}
+
+Status FilterWithSelection(FunctionContext* ctx, const std::shared_ptr<ArrayData>& values,
+                           const Selection& selection, std::shared_ptr<ArrayData>* out) {
+  if (selection.count == values->length) {
+    *out = values;
+    return Status::OK();
+  }
+
+  const DataType& type = *values->type;
+  auto result = std::make_shared<ArrayData>(values->type, selection.count);
+  result->buffers.resize(2);
+
+  if (type.id() == Type::NA) {
+    result->null_count = selection.count;
+    result->buffers.resize(1);
+    *out = result;
+    return Status::OK();
+  }
+  if (type.id() == Type::DICTIONARY) {
+    // Filter the indices, keeping the dictionary
+    std::shared_ptr<Array> indices =
+        static_cast<const DictionaryArray&>(*MakeArray(values)).indices();
+    std::shared_ptr<ArrayData> filtered;
+    RETURN_NOT_OK(FilterWithSelection(ctx, indices->data(), selection, &filtered));
+    *out = filtered->Copy();
+    (*out)->type = values->type;
+    return Status::OK();
+  }
+
+  RETURN_NOT_OK(FilterValidity(ctx, *values, selection, result.get()));
+  if (type.id() == Type::BOOL) {
+    RETURN_NOT_OK(FilterBoolean(ctx, *values, selection, result.get()));
+  } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    RETURN_NOT_OK(FilterBinary(ctx, *values, selection, result.get()));
+  } else if (is_primitive(type.id()) || type.id() == Type::FIXED_SIZE_BINARY ||
+             type.id() == Type::DECIMAL) {
+    const int bit_width = static_cast<const FixedWidthType&>(type).bit_width();
+    RETURN_NOT_OK(FilterFixedWidth(ctx, *values, bit_width / 8, selection, result.get()));
+  } else if (type.id() == Type::UNION &&
+             static_cast<const UnionType&>(type).mode() == UnionMode::DENSE) {
+    RETURN_NOT_OK(FilterDenseUnion(ctx, *values, selection, result.get()));
+  } else {
+    std::stringstream ss;
+    ss << "Filter not implemented for " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  *out = result;
+  return Status::OK();
+}
+
+Status FilterArray(FunctionContext* ctx, const Array& values, const Array& filter,
+                   std::shared_ptr<Array>* out) {
+  Selection selection;
+  RETURN_NOT_OK(MakeSelection(ctx, *filter.data(), &selection));
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(FilterWithSelection(ctx, values.data(), selection, &result));
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+Status FilterRecordBatch(FunctionContext* ctx, const RecordBatch& batch,
+                         const ArrayData& filter, std::shared_ptr<RecordBatch>* out) {
+  Selection selection;
+  RETURN_NOT_OK(MakeSelection(ctx, filter, &selection));
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  RETURN_NOT_OK(detail::ParallelInvoke(
+      ctx, batch.num_columns(), [&](FunctionContext* task_ctx, int i) {
+        std::shared_ptr<ArrayData> column;
+        RETURN_NOT_OK(
+            FilterWithSelection(task_ctx, batch.column(i)->data(), selection, &column));
+        columns[i] = MakeArray(column);
+        return Status::OK();
+      }));
+  *out = RecordBatch::Make(batch.schema(), selection.count, columns);
+  return Status::OK();
+}
+
+int64_t DatumLength(const Datum& value) {
+  switch (value.kind()) {
+    case Datum::ARRAY:
+      return value.array()->length;
+    case Datum::CHUNKED_ARRAY:
+      return value.chunked_array()->length();
+    case Datum::RECORD_BATCH:
+      return value.record_batch()->num_rows();
+    default:
+      return -1;
+  }
+}
+
+}  // namespace
+
+Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
+              Datum* out) {
+  KernelProfileScope profile(ctx, "Filter");
+  if (!filter.is_arraylike() || filter.type()->id() != Type::BOOL) {
+    return Status::Invalid("Filter expects a boolean array or chunked array as filter");
+  }
+  if (!values.is_arraylike() && values.kind() != Datum::RECORD_BATCH) {
+    return Status::Invalid("Filter expects an array, chunked array or record batch");
+  }
+  if (DatumLength(values) != DatumLength(filter)) {
+    return Status::Invalid("Filter needs a filter of the same length as the values");
+  }
+
+  if (values.kind() == Datum::RECORD_BATCH) {
+    if (filter.kind() != Datum::ARRAY) {
+      return Status::Invalid("A record batch must be filtered by an array");
+    }
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(
+        FilterRecordBatch(ctx, *values.record_batch(), *filter.array(), &batch));
+    *out = Datum(batch);
+    return Status::OK();
+  }
+
+  std::vector<std::shared_ptr<Array>> value_pieces, filter_pieces;
+  detail::AlignChunks(values, filter, &value_pieces, &filter_pieces);
+  const int num_pieces = static_cast<int>(value_pieces.size());
+  std::vector<std::shared_ptr<Array>> outputs(num_pieces);
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_pieces, [&](FunctionContext* task_ctx, int i) {
+        return FilterArray(task_ctx, *value_pieces[i], *filter_pieces[i], &outputs[i]);
+      }));
+
+  if (values.kind() == Datum::ARRAY && filter.kind() == Datum::ARRAY) {
+    *out = Datum(outputs[0]);
+    return Status::OK();
+  }
+  if (outputs.empty()) {
+    // Chunked arrays of length 0
+    if (values.kind() == Datum::ARRAY) {
+      *out = Datum(std::make_shared<ChunkedArray>(
+          std::vector<std::shared_ptr<Array>>{MakeArray(values.array())}));
+    } else {
+      *out = Datum(values.chunked_array());
+    }
+    return Status::OK();
+  }
+  *out = Datum(std::make_shared<ChunkedArray>(outputs));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_FILTER_H
+#define ARROW_COMPUTE_KERNELS_FILTER_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \brief Select the values for which a boolean filter is true
+///
+/// Values where the filter is false or null are dropped. The number of
+/// selected values is counted first, so that the output buffers are
+/// allocated once, then the selected runs of values are copied.
+///
+/// Primitive, boolean, binary, string, fixed size binary, decimal, null,
+/// dictionary and dense union values are supported. Each child of a dense
+/// union is taken once, by the offsets of all the slots of that child.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array, chunked array or record batch. The columns of a
+/// record batch are filtered alike
+/// \param[in] filter boolean array or chunked array, of the same length as
+/// values. Chunked arrays need not be chunked alike, but a record batch must
+/// be filtered by an array
+/// \param[out] out the selected values, a chunked array if either values or
+/// filter is one
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Filter(FunctionContext* context, const Datum& values, const Datum& filter,
+              Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_FILTER_H
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/fused.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr int64_t FusionOptions::kDefaultBlockSize;
+
+namespace {
+
+int64_t GetNullCount(const ArrayData& data) {
+  if (data.null_count != kUnknownNullCount) {
+    return data.null_count;
+  }
+  if (data.buffers[0] == nullptr) {
+    return 0;
+  }
+  return data.length - CountSetBits(data.buffers[0]->data(), data.offset, data.length);
+}
+
+class FusedKernel : public UnaryKernel {
+ public:
+  FusedKernel(std::vector<std::unique_ptr<UnaryKernel>> kernels, int64_t block_size)
+      : kernels_(std::move(kernels)), block_size_(block_size) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    KernelProfileScope profile(ctx, "Fused");
+    if (input.kind() == Datum::CHUNKED_ARRAY) {
+      // The blocks of each chunk are processed in parallel instead
+      std::vector<Datum> outputs;
+      RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, this, input, &outputs));
+      *out = detail::WrapDatumsLike(input, outputs);
+      return Status::OK();
+    }
+    if (input.kind() != Datum::ARRAY) {
+      return Status::Invalid("Fused kernel input was not array-like");
+    }
+
+    const auto values = MakeArray(input.array());
+    const int64_t length = values->length();
+    const int64_t num_blocks =
+        std::max<int64_t>(1, (length + block_size_ - 1) / block_size_);
+
+    // The first block gives the output type, so that the output can be
+    // allocated before the other blocks are processed
+    std::shared_ptr<ArrayData> first;
+    RETURN_NOT_OK(CallBlock(ctx, *values, 0, &first));
+    if (num_blocks == 1) {
+      *out = Datum(first);
+      return Status::OK();
+    }
+
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(AllocateOutput(ctx, first->type, length, &result));
+    std::atomic<int64_t> null_count(0);
+    auto copy_block = [&](int64_t block, const ArrayData& piece) {
+      RETURN_NOT_OK(CopyBlock(block, piece, result.get()));
+      null_count += GetNullCount(piece);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(copy_block(0, *first));
+    first.reset();
+
+    RETURN_NOT_OK(detail::ParallelInvoke(
+        ctx, static_cast<int>(num_blocks - 1), [&](FunctionContext* task_ctx, int i) {
+          const int64_t block = i + 1;
+          std::shared_ptr<ArrayData> piece;
+          RETURN_NOT_OK(CallBlock(task_ctx, *values, block, &piece));
+          if (!piece->type->Equals(*result->type)) {
+            return Status::Invalid("Fused kernels gave blocks of different types");
+          }
+          return copy_block(block, *piece);
+        }));
+
+    result->null_count = null_count;
+    if (result->null_count == 0) {
+      result->buffers[0] = nullptr;
+    }
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+ private:
+  // Run the rows of a block through all kernels
+  Status CallBlock(FunctionContext* ctx, const Array& values, int64_t block,
+                   std::shared_ptr<ArrayData>* out) const {
+    const int64_t offset = block * block_size_;
+    const int64_t length = std::min(block_size_, values.length() - offset);
+    Datum current(values.Slice(offset, length));
+    for (const auto& kernel : kernels_) {
+      Datum next;
+      RETURN_NOT_OK(kernel->Call(ctx, current, &next));
+      RETURN_IF_ERROR(ctx);
+      if (next.kind() != Datum::ARRAY || next.array()->length != length) {
+        return Status::Invalid("Fused kernels must be element-wise");
+      }
+      current = next;
+    }
+    *out = current.array();
+    return Status::OK();
+  }
+
+  Status AllocateOutput(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                        int64_t length, std::shared_ptr<ArrayData>* out) const {
+    *out = ArrayData::Make(type, length);
+    if (type->id() == Type::NA) {
+      (*out)->buffers.resize(1);
+      return Status::OK();
+    }
+    const auto fw_type = dynamic_cast<const FixedWidthType*>(type.get());
+    if (fw_type == nullptr || (fw_type->bit_width() != 1 && fw_type->bit_width() % 8)) {
+      std::stringstream ss;
+      ss << "Fused kernels cannot assemble blocks of " << type->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+    (*out)->buffers.resize(2);
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length, &(*out)->buffers[0]));
+    if (fw_type->bit_width() == 1) {
+      return GetEmptyBitmap(ctx->memory_pool(), length, &(*out)->buffers[1]);
+    }
+    return ctx->Allocate(length * (fw_type->bit_width() / 8), &(*out)->buffers[1]);
+  }
+
+  // Copy the output of a block into its rows of out. Blocks are a multiple
+  // of 8 rows, so that blocks copied concurrently never share a byte of the
+  // bitmaps
+  Status CopyBlock(int64_t block, const ArrayData& piece, ArrayData* out) const {
+    const int64_t position = block * block_size_;
+    if (out->type->id() == Type::NA) {
+      return Status::OK();
+    }
+
+    uint8_t* bitmap = out->buffers[0]->mutable_data();
+    if (GetNullCount(piece) == 0) {
+      FillBitmap(bitmap, position, piece.length, true);
+    } else {
+      CopyBitmap(piece.buffers[0]->data(), piece.offset, piece.length, bitmap, position);
+    }
+
+    if (piece.length == 0) {
+      return Status::OK();
+    }
+    const int bit_width = static_cast<const FixedWidthType&>(*out->type).bit_width();
+    uint8_t* data = out->buffers[1]->mutable_data();
+    if (bit_width == 1) {
+      CopyBitmap(piece.buffers[1]->data(), piece.offset, piece.length, data, position);
+    } else {
+      const int64_t byte_width = bit_width / 8;
+      std::memcpy(data + position * byte_width,
+                  piece.buffers[1]->data() + piece.offset * byte_width,
+                  static_cast<size_t>(piece.length * byte_width));
+    }
+    return Status::OK();
+  }
+
+  std::vector<std::unique_ptr<UnaryKernel>> kernels_;
+  int64_t block_size_;
+};
+
+}  // namespace
+
+Status GetFusedKernel(std::vector<std::unique_ptr<UnaryKernel>> kernels,
+                      const FusionOptions& options,
+                      std::unique_ptr<UnaryKernel>* kernel) {
+  if (kernels.empty()) {
+    return Status::Invalid("No kernels to fuse");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("Fused kernels need a positive block size");
+  }
+  const int64_t block_size = BitUtil::RoundUp(options.block_size, 8);
+  kernel->reset(new FusedKernel(std::move(kernels), block_size));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
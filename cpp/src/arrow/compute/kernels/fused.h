@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_FUSED_H
+#define ARROW_COMPUTE_KERNELS_FUSED_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class UnaryKernel;
+
+struct ARROW_EXPORT FusionOptions {
+  FusionOptions() : block_size(kDefaultBlockSize) {}
+
+  static constexpr int64_t kDefaultBlockSize = 4096;
+
+  /// Number of rows run through all kernels at a time, rounded up to a
+  /// multiple of 8. Intermediate results of a block should fit in cache
+  int64_t block_size;
+};
+
+/// \brief Fuse a chain of element-wise kernels into a single kernel
+///
+/// The fused kernel slices its input into blocks of rows and runs each block
+/// through all kernels in turn, so that only the intermediate results of one
+/// block exist at a time instead of whole intermediate arrays. The outputs of
+/// the last kernel are then copied into a single output array. Blocks are
+/// processed in parallel when the FunctionContext has several threads.
+///
+/// Each kernel must be element-wise, i.e. its output slot i depend only on
+/// its input slot i, and safe to call concurrently. The last kernel must
+/// produce fixed-width or boolean values, unless the input fits in a block.
+/// A chunked array input yields a chunked array, chunk by chunk.
+///
+/// \param[in] kernels the kernels to chain, first to last
+/// \param[in] options the block size
+/// \param[out] kernel the fused kernel, taking ownership of kernels
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetFusedKernel(std::vector<std::unique_ptr<UnaryKernel>> kernels,
+                      const FusionOptions& options, std::unique_ptr<UnaryKernel>* kernel);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_FUSED_H
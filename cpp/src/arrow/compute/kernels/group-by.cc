@@ -0,0 +1,520 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/group-by.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Per-group accumulators
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  /// Accumulate values (null for row counts) into the groups given by
+  /// group_ids, which are all less than num_groups
+  virtual void Consume(const ArrayData* values, const int32_t* group_ids,
+                       int64_t num_groups) = 0;
+
+  /// Output the aggregate of each group, then start over
+  virtual Status Finish(MemoryPool* pool, int64_t num_groups,
+                        std::shared_ptr<Array>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call visit(i) for each non-null value i of an array
+template <typename Visit>
+void VisitValid(const ArrayData& values, Visit&& visit) {
+  if (values.null_count == 0 || values.buffers[0] == nullptr) {
+    for (int64_t i = 0; i < values.length; ++i) {
+      visit(i);
+    }
+  } else {
+    internal::BitmapReader valid_reader(values.buffers[0]->data(), values.offset,
+                                        values.length);
+    for (int64_t i = 0; i < values.length; ++i) {
+      if (valid_reader.IsSet()) {
+        visit(i);
+      }
+      valid_reader.Next();
+    }
+  }
+}
+
+class GroupedCount : public GroupedAggregator {
+ public:
+  void Consume(const ArrayData* values, const int32_t* group_ids,
+               int64_t num_groups) override {
+    counts_.resize(num_groups, 0);
+    VisitValid(*values, [&](int64_t i) { ++counts_[group_ids[i]]; });
+  }
+
+  Status Finish(MemoryPool* pool, int64_t num_groups,
+                std::shared_ptr<Array>* out) override {
+    counts_.resize(num_groups, 0);
+    Int64Builder builder(pool);
+    RETURN_NOT_OK(builder.Append(counts_.data(), num_groups));
+    counts_.clear();
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
+// Base for aggregates that are null for groups without any value
+template <typename OutType>
+class GroupedValueAggregator : public GroupedAggregator {
+ public:
+  using T = typename OutType::c_type;
+
+  GroupedValueAggregator(const std::shared_ptr<DataType>& out_type, T initial_value)
+      : out_type_(out_type), initial_value_(initial_value) {}
+
+  Status Finish(MemoryPool* pool, int64_t num_groups,
+                std::shared_ptr<Array>* out) override {
+    Resize(num_groups);
+    NumericBuilder<OutType> builder(out_type_, pool);
+    RETURN_NOT_OK(builder.Append(values_.data(), num_groups, has_value_.data()));
+    values_.clear();
+    has_value_.clear();
+    return builder.Finish(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ protected:
+  void Resize(int64_t num_groups) {
+    values_.resize(num_groups, initial_value_);
+    has_value_.resize(num_groups, 0);
+  }
+
+  std::shared_ptr<DataType> out_type_;
+  T initial_value_;
+  std::vector<T> values_;
+  std::vector<uint8_t> has_value_;
+};
+
+template <typename Type>
+struct SumTraits {
+  using c_type = typename Type::c_type;
+  using OutType = typename std::conditional<
+      std::is_floating_point<c_type>::value, DoubleType,
+      typename std::conditional<std::is_signed<c_type>::value, Int64Type,
+                                UInt64Type>::type>::type;
+};
+
+template <typename Type>
+class GroupedSum : public GroupedValueAggregator<typename SumTraits<Type>::OutType> {
+ public:
+  using OutType = typename SumTraits<Type>::OutType;
+  using Base = GroupedValueAggregator<OutType>;
+
+  GroupedSum() : Base(TypeTraits<OutType>::type_singleton(), 0) {}
+
+  void Consume(const ArrayData* values, const int32_t* group_ids,
+               int64_t num_groups) override {
+    this->Resize(num_groups);
+    const auto* in = GetValues<typename Type::c_type>(*values, 1);
+    VisitValid(*values, [&](int64_t i) {
+      const int32_t group = group_ids[i];
+      this->values_[group] += in[i];
+      this->has_value_[group] = 1;
+    });
+  }
+};
+
+template <typename Type, bool kIsMin>
+class GroupedMinMax : public GroupedValueAggregator<Type> {
+ public:
+  using T = typename Type::c_type;
+  using Base = GroupedValueAggregator<Type>;
+
+  explicit GroupedMinMax(const std::shared_ptr<DataType>& type)
+      : Base(type, kIsMin ? std::numeric_limits<T>::max()
+                          : std::numeric_limits<T>::lowest()) {}
+
+  void Consume(const ArrayData* values, const int32_t* group_ids,
+               int64_t num_groups) override {
+    this->Resize(num_groups);
+    const T* in = GetValues<T>(*values, 1);
+    VisitValid(*values, [&](int64_t i) {
+      const int32_t group = group_ids[i];
+      T& acc = this->values_[group];
+      acc = kIsMin ? std::min(acc, in[i]) : std::max(acc, in[i]);
+      this->has_value_[group] = 1;
+    });
+  }
+};
+
+Status MakeAggregator(AggregateFunction function, const std::shared_ptr<DataType>& type,
+                      std::unique_ptr<GroupedAggregator>* out) {
+  if (function == AggregateFunction::COUNT) {
+    out->reset(new GroupedCount());
+    return Status::OK();
+  }
+
+#define SUM_CASE(InType)                  \
+  case InType::type_id:                   \
+    out->reset(new GroupedSum<InType>()); \
+    break
+
+#define MIN_MAX_CASE(InType)                              \
+  case InType::type_id:                                   \
+    if (function == AggregateFunction::MIN) {             \
+      out->reset(new GroupedMinMax<InType, true>(type));  \
+    } else {                                              \
+      out->reset(new GroupedMinMax<InType, false>(type)); \
+    }                                                     \
+    break
+
+  if (function == AggregateFunction::SUM) {
+    switch (type->id()) {
+      SUM_CASE(UInt8Type);
+      SUM_CASE(Int8Type);
+      SUM_CASE(UInt16Type);
+      SUM_CASE(Int16Type);
+      SUM_CASE(UInt32Type);
+      SUM_CASE(Int32Type);
+      SUM_CASE(UInt64Type);
+      SUM_CASE(Int64Type);
+      SUM_CASE(FloatType);
+      SUM_CASE(DoubleType);
+      default:
+        break;
+    }
+  } else {
+    switch (type->id()) {
+      MIN_MAX_CASE(UInt8Type);
+      MIN_MAX_CASE(Int8Type);
+      MIN_MAX_CASE(UInt16Type);
+      MIN_MAX_CASE(Int16Type);
+      MIN_MAX_CASE(UInt32Type);
+      MIN_MAX_CASE(Int32Type);
+      MIN_MAX_CASE(UInt64Type);
+      MIN_MAX_CASE(Int64Type);
+      MIN_MAX_CASE(FloatType);
+      MIN_MAX_CASE(DoubleType);
+      MIN_MAX_CASE(Date32Type);
+      MIN_MAX_CASE(Date64Type);
+      MIN_MAX_CASE(Time32Type);
+      MIN_MAX_CASE(Time64Type);
+      MIN_MAX_CASE(TimestampType);
+      default:
+        break;
+    }
+  }
+
+#undef SUM_CASE
+#undef MIN_MAX_CASE
+
+  if (!*out) {
+    std::stringstream ss;
+    ss << "Aggregate not implemented for " << type->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+std::string AggregateName(const Aggregate& aggregate) {
+  std::stringstream ss;
+  switch (aggregate.function) {
+    case AggregateFunction::SUM:
+      ss << "sum";
+      break;
+    case AggregateFunction::COUNT:
+      ss << "count";
+      break;
+    case AggregateFunction::MIN:
+      ss << "min";
+      break;
+    case AggregateFunction::MAX:
+      ss << "max";
+      break;
+  }
+  ss << "(" << (aggregate.column.empty() ? "*" : aggregate.column) << ")";
+  return ss.str();
+}
+
+// ----------------------------------------------------------------------
+// Group-by kernel
+
+// Each key column is dictionary-encoded into a hash table of its own. The
+// groups are then the distinct tuples of key indices (offset by one, so
+// that 0 stands for a null key), which are hashed as int32, int64 or
+// fixed-size binary values depending on the number of keys.
+class GroupByKernelImpl : public GroupByKernel {
+ public:
+  GroupByKernelImpl(const std::shared_ptr<Schema>& schema,
+                    const std::vector<int>& key_columns,
+                    const std::vector<int>& value_columns,
+                    const std::vector<Aggregate>& aggregates)
+      : schema_(schema),
+        key_columns_(key_columns),
+        value_columns_(value_columns),
+        aggregates_(aggregates),
+        num_groups_(0) {
+    const int num_keys = static_cast<int>(key_columns_.size());
+    if (num_keys == 1) {
+      tuple_type_ = int32();
+    } else if (num_keys == 2) {
+      tuple_type_ = int64();
+    } else {
+      tuple_type_ = fixed_size_binary(num_keys * static_cast<int>(sizeof(int32_t)));
+    }
+  }
+
+  Status Reset(FunctionContext* ctx) {
+    key_encoders_.resize(key_columns_.size());
+    for (size_t i = 0; i < key_columns_.size(); ++i) {
+      RETURN_NOT_OK(GetDictionaryEncodeKernel(
+          ctx, schema_->field(key_columns_[i])->type(), &key_encoders_[i]));
+    }
+    RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, tuple_type_, &group_encoder_));
+
+    aggregators_.resize(aggregates_.size());
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      const std::shared_ptr<DataType> type =
+          value_columns_[i] < 0 ? null() : schema_->field(value_columns_[i])->type();
+      RETURN_NOT_OK(MakeAggregator(aggregates_[i].function, type, &aggregators_[i]));
+    }
+    num_groups_ = 0;
+    pool_ = ctx->memory_pool();
+    return Status::OK();
+  }
+
+  Status Append(FunctionContext* ctx, const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_)) {
+      return Status::Invalid("Batch schema differs from the group-by schema");
+    }
+    const int64_t length = batch.num_rows();
+    if (length == 0) {
+      return Status::OK();
+    }
+
+    // Encode the key tuple of each row
+    const int64_t num_keys = static_cast<int64_t>(key_columns_.size());
+    std::shared_ptr<Buffer> tuples_buffer;
+    RETURN_NOT_OK(ctx->Allocate(length * num_keys * sizeof(int32_t), &tuples_buffer));
+    auto tuples = reinterpret_cast<int32_t*>(tuples_buffer->mutable_data());
+    for (int64_t k = 0; k < num_keys; ++k) {
+      Datum encoded;
+      RETURN_NOT_OK(key_encoders_[k]->Call(
+          ctx, Datum(batch.column_data(key_columns_[k])), &encoded));
+      const ArrayData& indices = *encoded.array();
+      const int32_t* index_values = GetValues<int32_t>(indices, 1);
+      for (int64_t i = 0; i < length; ++i) {
+        tuples[i * num_keys + k] = index_values[i] + 1;
+      }
+      if (indices.null_count != 0) {
+        VisitNulls(indices, [&](int64_t i) { tuples[i * num_keys + k] = 0; });
+      }
+    }
+
+    Datum encoded_groups;
+    auto tuple_data = ArrayData::Make(tuple_type_, length, {nullptr, tuples_buffer}, 0);
+    RETURN_NOT_OK(group_encoder_->Call(ctx, Datum(tuple_data), &encoded_groups));
+    const int32_t* group_ids = GetValues<int32_t>(*encoded_groups.array(), 1);
+
+    // Group ids are allocated in increasing order
+    num_groups_ = std::max<int64_t>(
+        num_groups_, *std::max_element(group_ids, group_ids + length) + 1);
+
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+      if (value_columns_[i] < 0) {
+        // Count all rows
+        ArrayData rows(null(), length, {nullptr}, 0);
+        aggregators_[i]->Consume(&rows, group_ids, num_groups_);
+      } else {
+        const std::shared_ptr<ArrayData> values = batch.column_data(value_columns_[i]);
+        aggregators_[i]->Consume(values.get(), group_ids, num_groups_);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush(std::shared_ptr<RecordBatch>* out) override {
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+
+    std::shared_ptr<ArrayData> groups;
+    RETURN_NOT_OK(group_encoder_->GetDictionary(&groups));
+    DCHECK_EQ(num_groups_, groups->length);
+    const int64_t num_keys = static_cast<int64_t>(key_columns_.size());
+    for (int64_t k = 0; k < num_keys; ++k) {
+      Int32Builder indices_builder(pool_);
+      RETURN_NOT_OK(indices_builder.Reserve(num_groups_));
+      if (num_groups_ > 0) {
+        const int32_t* tuples = GetValues<int32_t>(*groups, 1);
+        for (int64_t g = 0; g < num_groups_; ++g) {
+          const int32_t index = tuples[g * num_keys + k];
+          if (index == 0) {
+            indices_builder.UnsafeAppendToBitmap(false);
+          } else {
+            indices_builder.UnsafeAppend(index - 1);
+          }
+        }
+      }
+      std::shared_ptr<Array> indices;
+      RETURN_NOT_OK(indices_builder.Finish(&indices));
+
+      std::shared_ptr<ArrayData> dict;
+      RETURN_NOT_OK(key_encoders_[k]->GetDictionary(&dict));
+      auto dict_type = dictionary(int32(), MakeArray(dict));
+      fields.push_back(field(schema_->field(key_columns_[k])->name(), dict_type));
+      columns.push_back(std::make_shared<DictionaryArray>(dict_type, indices));
+    }
+
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+      std::shared_ptr<Array> aggregated;
+      RETURN_NOT_OK(aggregators_[i]->Finish(pool_, num_groups_, &aggregated));
+      const bool nullable = aggregates_[i].function != AggregateFunction::COUNT;
+      fields.push_back(
+          field(AggregateName(aggregates_[i]), aggregators_[i]->out_type(), nullable));
+      columns.push_back(aggregated);
+    }
+
+    *out = RecordBatch::Make(::arrow::schema(fields), num_groups_, columns);
+
+    FunctionContext ctx(pool_);
+    return Reset(&ctx);
+  }
+
+ private:
+  // Call visit(i) for each null value i of an array
+  template <typename Visit>
+  void VisitNulls(const ArrayData& values, Visit&& visit) {
+    internal::BitmapReader valid_reader(values.buffers[0]->data(), values.offset,
+                                        values.length);
+    for (int64_t i = 0; i < values.length; ++i) {
+      if (valid_reader.IsNotSet()) {
+        visit(i);
+      }
+      valid_reader.Next();
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_columns_;
+  // -1 for row counts
+  std::vector<int> value_columns_;
+  std::vector<Aggregate> aggregates_;
+  std::shared_ptr<DataType> tuple_type_;
+
+  MemoryPool* pool_;
+  std::vector<std::unique_ptr<HashKernel>> key_encoders_;
+  std::unique_ptr<HashKernel> group_encoder_;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators_;
+  int64_t num_groups_;
+};
+
+Status LookupColumn(const Schema& schema, const std::string& name, int* out) {
+  const int64_t index = schema.GetFieldIndex(name);
+  if (index < 0) {
+    std::stringstream ss;
+    ss << "No column named '" << name << "' to group by";
+    return Status::Invalid(ss.str());
+  }
+  *out = static_cast<int>(index);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GetGroupByKernel(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                        const GroupByOptions& options,
+                        std::unique_ptr<GroupByKernel>* out) {
+  if (options.keys.empty()) {
+    return Status::Invalid("Group-by needs at least one key column");
+  }
+  std::vector<int> key_columns(options.keys.size());
+  for (size_t i = 0; i < options.keys.size(); ++i) {
+    RETURN_NOT_OK(LookupColumn(*schema, options.keys[i], &key_columns[i]));
+  }
+  std::vector<int> value_columns(options.aggregates.size(), -1);
+  for (size_t i = 0; i < options.aggregates.size(); ++i) {
+    const Aggregate& aggregate = options.aggregates[i];
+    if (!aggregate.column.empty()) {
+      RETURN_NOT_OK(LookupColumn(*schema, aggregate.column, &value_columns[i]));
+    } else if (aggregate.function != AggregateFunction::COUNT) {
+      return Status::Invalid("Only COUNT aggregates can omit the aggregated column");
+    }
+  }
+
+  std::unique_ptr<GroupByKernelImpl> kernel(
+      new GroupByKernelImpl(schema, key_columns, value_columns, options.aggregates));
+  RETURN_NOT_OK(kernel->Reset(ctx));
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const Table& table, const GroupByOptions& options,
+               std::shared_ptr<Table>* out) {
+  KernelProfileScope profile(ctx, "GroupBy");
+  std::unique_ptr<GroupByKernel> kernel;
+  RETURN_NOT_OK(GetGroupByKernel(ctx, table.schema(), options, &kernel));
+
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(kernel->Append(ctx, *batch));
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  RETURN_NOT_OK(kernel->Flush(&result));
+  return Table::FromRecordBatches({result}, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
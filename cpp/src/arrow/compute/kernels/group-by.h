@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_GROUP_BY_H
+#define ARROW_COMPUTE_KERNELS_GROUP_BY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+enum class AggregateFunction { SUM, COUNT, MIN, MAX };
+
+/// \brief An aggregate computed for each group
+struct ARROW_EXPORT Aggregate {
+  Aggregate() : function(AggregateFunction::COUNT) {}
+  Aggregate(AggregateFunction function, const std::string& column)
+      : function(function), column(column) {}
+
+  AggregateFunction function;
+
+  /// Name of the aggregated column. A COUNT without column counts the rows
+  /// of each group, otherwise aggregates ignore nulls
+  std::string column;
+};
+
+struct ARROW_EXPORT GroupByOptions {
+  /// Names of the columns whose distinct value combinations form the groups
+  std::vector<std::string> keys;
+  std::vector<Aggregate> aggregates;
+};
+
+/// \class GroupByKernel
+/// \brief Hash aggregation over a stream of record batches
+///
+/// Groups are identified by dictionary-encoding each key column, then
+/// hashing the combination of the key indices of each row. Only the
+/// dictionaries and one accumulator per group and aggregate are kept, so
+/// that batches can be aggregated as they are read.
+///
+/// The output has one row per group, in order of first occurrence, whose
+/// columns are the keys (dictionary-encoded, with a null key forming its own
+/// group) followed by the aggregates: SUM yields int64 for signed integers,
+/// uint64 for unsigned integers and double for floating point values, COUNT
+/// yields int64, while MIN and MAX keep the value type. SUM, MIN and MAX are
+/// null for groups without any non-null value.
+class ARROW_EXPORT GroupByKernel {
+ public:
+  virtual ~GroupByKernel() = default;
+
+  /// \brief Aggregate a batch, with the schema the kernel was created for
+  virtual Status Append(FunctionContext* ctx, const RecordBatch& batch) = 0;
+
+  /// \brief Output the aggregates of the batches appended since the
+  /// previous Flush(), then start over with no group
+  virtual Status Flush(std::shared_ptr<RecordBatch>* out) = 0;
+};
+
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetGroupByKernel(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                        const GroupByOptions& options,
+                        std::unique_ptr<GroupByKernel>* kernel);
+
+/// \brief Compute aggregates for each group of rows of a table
+/// \param[in] context the FunctionContext
+/// \param[in] table input table, read by batches
+/// \param[in] options key columns and aggregates, see GroupByKernel
+/// \param[out] out table with one row per group
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* context, const Table& table,
+               const GroupByOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_GROUP_BY_H
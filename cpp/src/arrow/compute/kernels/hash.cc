@@ -17,7 +17,8 @@
 
 #include "arrow/compute/kernels/hash.h"
 
-#include <exception>
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -27,19 +28,23 @@
 #include <vector>
 
 #include "arrow/builder.h"
+#include "arrow/table.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util-internal.h"
-#include "arrow/util/hash-util.h"
+#include "arrow/compute/profiler.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/hash.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string-view-util.h"
+#include "arrow/util/task-scheduler.h"
 
 namespace arrow {
 namespace compute {
 
 namespace {
 
-enum class SIMDMode : char { NOSIMD, SSE4, AVX2 };
-
 #define CHECK_IMPLEMENTED(KERNEL, FUNCNAME, TYPE)                  \
   if (!KERNEL) {                                                   \
     std::stringstream ss;                                          \
@@ -47,34 +52,13 @@ enum class SIMDMode : char { NOSIMD, SSE4, AVX2 };
     return Status::NotImplemented(ss.str());                       \
   }
 
-// This is a slight design concession -- some hash actions have the possibility
-// of failure. Rather than introduce extra error checking into all actions, we
-// will raise an internal exception so that only the actions where errors can
-// occur will experience the extra overhead
-class HashException : public std::exception {
- public:
-  explicit HashException(const std::string& msg, StatusCode code = StatusCode::Invalid)
-      : msg_(msg), code_(code) {}
-
-  ~HashException() throw() override {}
-
-  const char* what() const throw() override;
-
-  StatusCode code() const { return code_; }
-
- private:
-  std::string msg_;
-  StatusCode code_;
-};
-
-const char* HashException::what() const throw() { return msg_.c_str(); }
-
 class HashTable {
  public:
   HashTable(const std::shared_ptr<DataType>& type, MemoryPool* pool)
       : type_(type),
         pool_(pool),
         initialized_(false),
+        frozen_(false),
         hash_table_(nullptr),
         hash_slots_(nullptr),
         hash_table_size_(0),
@@ -86,12 +70,17 @@ class HashTable {
   virtual Status Flush(Datum* out) = 0;
   virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) = 0;
 
+  /// Stop inserting new values: values not found in the table are then passed
+  /// to the action's ObserveMissing()
+  void Freeze() { frozen_ = true; }
+
  protected:
   Status Init(int64_t elements);
 
   std::shared_ptr<DataType> type_;
   MemoryPool* pool_;
   bool initialized_;
+  bool frozen_;
 
   // The hash table contains integer indices that reference the set of observed
   // distinct values
@@ -128,8 +117,10 @@ class HashTableKernel : public HashTable {};
 //
 // unique: append to dictionary when not found, no-op with slot
 // dictionary-encode: append to dictionary when not found, append slot #
-// match: raise or set null when not found, otherwise append slot #
-// isin: set false when not found, otherwise true
+// match: dictionary-encode the member set, then freeze the table and set null
+// when not found, otherwise append slot #
+// isin: hash the member set, then freeze the table and set false when not
+// found, otherwise true
 // value counts: append to dictionary when not found, increment count for slot
 
 template <typename Type, typename Enable = void>
@@ -201,7 +192,7 @@ struct HashDictionary<Type, enable_if_has_c_type<Type>> {
 };
 
 #define GENERIC_HASH_PASS(HASH_INNER_LOOP)                                               \
-  if (arr.null_count != 0) {                                                             \
+  if (NeedsValidityChecks(arr)) {                                                        \
     internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length); \
     for (int64_t i = 0; i < arr.length; ++i) {                                           \
       const bool is_null = valid_reader.IsNotSet();                                      \
@@ -220,6 +211,51 @@ struct HashDictionary<Type, enable_if_has_c_type<Type>> {
     }                                                                                    \
   }
 
+// Number of values whose hashes are computed at once, before probing the table
+constexpr int64_t kHashBlockSize = 256;
+
+// How many values ahead the table slot to be probed is prefetched
+constexpr int64_t kHashPrefetchDistance = 16;
+
+// Like GENERIC_HASH_PASS, but the hashes of each block of values are first
+// computed by HASH_BLOCK(start, length, out) in a single vectorizable pass,
+// then the table slots are prefetched ahead of the probing in HASH_INNER_LOOP,
+// which is given the value's hash. The probing loop is expanded once with and
+// once without validity checks, HAS_NULLS being a constant.
+#define BATCHED_HASH_BLOCKS(HAS_NULLS, HASH_BLOCK, HASH_INNER_LOOP)                \
+  for (int64_t start = 0; start < arr.length; start += kHashBlockSize) {           \
+    const int64_t block_length = std::min(kHashBlockSize, arr.length - start);     \
+    HASH_BLOCK(start, block_length, block_hashes);                                 \
+                                                                                   \
+    for (int64_t k = 0; k < std::min(kHashPrefetchDistance, block_length); ++k) {  \
+      ARROW_PREFETCH(hash_slots_ + (block_hashes[k] & mod_bitmask_));              \
+    }                                                                              \
+    for (int64_t k = 0; k < block_length; ++k) {                                   \
+      if (k + kHashPrefetchDistance < block_length) {                              \
+        ARROW_PREFETCH(hash_slots_ +                                               \
+                       (block_hashes[k + kHashPrefetchDistance] & mod_bitmask_));  \
+      }                                                                            \
+      const int64_t i = start + k;                                                 \
+      if (HAS_NULLS && !BitUtil::GetBit(valid_bits, arr.offset + i)) {             \
+        action->ObserveNull();                                                     \
+        continue;                                                                  \
+      }                                                                            \
+      const uint32_t hash = block_hashes[k];                                       \
+                                                                                   \
+      HASH_INNER_LOOP();                                                           \
+    }                                                                              \
+  }
+
+#define BATCHED_HASH_PASS(HASH_BLOCK, HASH_INNER_LOOP)                             \
+  uint32_t block_hashes[kHashBlockSize];                                           \
+  const uint8_t* valid_bits =                                                      \
+      NeedsValidityChecks(arr) ? arr.buffers[0]->data() : nullptr;                 \
+  if (valid_bits != nullptr) {                                                     \
+    BATCHED_HASH_BLOCKS(true, HASH_BLOCK, HASH_INNER_LOOP);                        \
+  } else {                                                                         \
+    BATCHED_HASH_BLOCKS(false, HASH_BLOCK, HASH_INNER_LOOP);                       \
+  }
+
 template <typename Type, typename Action>
 class HashTableKernel<
     Type, Action,
@@ -246,9 +282,13 @@ class HashTableKernel<
 
     RETURN_NOT_OK(action->Reserve(arr.length));
 
+#define HASH_BLOCK(START, LENGTH, OUT)                                             \
+  internal::HashFixedWidthValues(reinterpret_cast<const uint8_t*>(values + START), \
+                                 sizeof(T), LENGTH, OUT)
+
 #define HASH_INNER_LOOP()                                               \
   const T value = values[i];                                            \
-  int64_t j = HashValue(value) & mod_bitmask_;                          \
+  int64_t j = hash & mod_bitmask_;                                      \
   hash_slot_t slot = hash_slots_[j];                                    \
                                                                         \
   while (kHashSlotEmpty != slot && dict_.values[slot] != value) {       \
@@ -259,11 +299,9 @@ class HashTableKernel<
     slot = hash_slots_[j];                                              \
   }                                                                     \
                                                                         \
-  if (slot == kHashSlotEmpty) {                                         \
-    if (!Action::allow_expand) {                                        \
-      throw HashException("Encountered new dictionary value");          \
-    }                                                                   \
-                                                                        \
+  if (slot == kHashSlotEmpty && frozen_) {                              \
+    action->ObserveMissing();                                           \
+  } else if (slot == kHashSlotEmpty) {                                  \
     slot = static_cast<hash_slot_t>(dict_.size);                        \
     hash_slots_[j] = slot;                                              \
     dict_.values[dict_.size++] = value;                                 \
@@ -277,8 +315,9 @@ class HashTableKernel<
     action->ObserveFound(slot);                                         \
   }
 
-    GENERIC_HASH_PASS(HASH_INNER_LOOP);
+    BATCHED_HASH_PASS(HASH_BLOCK, HASH_INNER_LOOP);
 
+#undef HASH_BLOCK
 #undef HASH_INNER_LOOP
 
     return Status::OK();
@@ -295,8 +334,10 @@ class HashTableKernel<
 
  protected:
   int64_t HashValue(const T& value) const {
-    // TODO(wesm): Use faster hash function for C types
-    return HashUtil::Hash(&value, sizeof(T), 0);
+    uint32_t hash;
+    internal::HashFixedWidthValues(reinterpret_cast<const uint8_t*>(&value), sizeof(T),
+                                   1, &hash);
+    return hash;
   }
 
   Status DoubleTableSize() {
@@ -333,10 +374,9 @@ class HashTableKernel<Type, Action, enable_if_boolean<Type>> : public HashTable
     internal::BitmapReader value_reader(arr.buffers[1]->data(), arr.offset, arr.length);
 
 #define HASH_INNER_LOOP()                                      \
-  if (slot == kHashSlotEmpty) {                                \
-    if (!Action::allow_expand) {                               \
-      throw HashException("Encountered new dictionary value"); \
-    }                                                          \
+  if (slot == kHashSlotEmpty && frozen_) {                     \
+    action->ObserveMissing();                                  \
+  } else if (slot == kHashSlotEmpty) {                         \
     table_[j] = slot = static_cast<hash_slot_t>(dict_.size()); \
     dict_.push_back(value);                                    \
     action->ObserveNotFound(slot);                             \
@@ -344,7 +384,7 @@ class HashTableKernel<Type, Action, enable_if_boolean<Type>> : public HashTable
     action->ObserveFound(slot);                                \
   }
 
-    if (arr.null_count != 0) {
+    if (NeedsValidityChecks(arr)) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool is_null = valid_reader.IsNotSet();
@@ -420,18 +460,22 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     if (arr.buffers[2].get() == nullptr) {
       data = &empty_value;
     } else {
-      data = GetValues<uint8_t>(arr, 2);
+      // The offsets are absolute, so the data must not be shifted by arr.offset
+      data = arr.buffers[2]->data();
     }
 
     auto action = static_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
+#define HASH_BLOCK(START, LENGTH, OUT) \
+  internal::HashBinaryValues(offsets + START, data, LENGTH, OUT)
+
 #define HASH_INNER_LOOP()                                                           \
   const int32_t position = offsets[i];                                              \
   const int32_t length = offsets[i + 1] - position;                                 \
   const uint8_t* value = data + position;                                           \
                                                                                     \
-  int64_t j = HashValue(value, length) & mod_bitmask_;                              \
+  int64_t j = hash & mod_bitmask_;                                                  \
   hash_slot_t slot = hash_slots_[j];                                                \
                                                                                     \
   const int32_t* dict_offsets = dict_offsets_.data();                               \
@@ -446,11 +490,9 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     slot = hash_slots_[j];                                                          \
   }                                                                                 \
                                                                                     \
-  if (slot == kHashSlotEmpty) {                                                     \
-    if (!Action::allow_expand) {                                                    \
-      throw HashException("Encountered new dictionary value");                      \
-    }                                                                               \
-                                                                                    \
+  if (slot == kHashSlotEmpty && frozen_) {                                          \
+    action->ObserveMissing();                                                       \
+  } else if (slot == kHashSlotEmpty) {                                              \
     slot = dict_size_++;                                                            \
     hash_slots_[j] = slot;                                                          \
                                                                                     \
@@ -466,8 +508,9 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     action->ObserveFound(slot);                                                     \
   }
 
-    GENERIC_HASH_PASS(HASH_INNER_LOOP);
+    BATCHED_HASH_PASS(HASH_BLOCK, HASH_INNER_LOOP);
 
+#undef HASH_BLOCK
 #undef HASH_INNER_LOOP
 
     return Status::OK();
@@ -485,8 +528,10 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
   }
 
  protected:
-  int64_t HashValue(const uint8_t* data, int32_t length) const {
-    return HashUtil::Hash(data, length, 0);
+  int64_t HashValue(const int32_t* offsets, const uint8_t* data) const {
+    uint32_t hash;
+    internal::HashBinaryValues(offsets, data, 1, &hash);
+    return hash;
   }
 
   Status DoubleTableSize() {
@@ -494,10 +539,8 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
   const int32_t* dict_offsets = dict_offsets_.data(); \
   const uint8_t* dict_data = dict_data_.data()
 
-#define VARBYTES_COMPUTE_HASH                                           \
-  const int32_t length = dict_offsets[index + 1] - dict_offsets[index]; \
-  const uint8_t* value = dict_data + dict_offsets[index];               \
-  int64_t j = HashValue(value, length) & new_mod_bitmask
+#define VARBYTES_COMPUTE_HASH \
+  int64_t j = HashValue(dict_offsets + index, dict_data) & new_mod_bitmask
 
     DOUBLE_TABLE_SIZE(VARBYTES_SETUP, VARBYTES_COMPUTE_HASH);
 
@@ -512,6 +555,140 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
   int32_t dict_size_;
 };
 
+// ----------------------------------------------------------------------
+// Hash table pass for string views
+//
+// The dictionary holds entries too, its long strings in a single data buffer.
+// Probing compares the length and prefix of the entries first, so that the
+// strings themselves are mostly only compared when they are equal
+
+template <typename Type, typename Action>
+class HashTableKernel<Type, Action, enable_if_string_view<Type>> : public HashTable {
+ public:
+  HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : HashTable(type, pool), dict_views_(pool), dict_data_(pool), dict_size_(0) {}
+
+  Status Init() {
+    RETURN_NOT_OK(dict_views_.Resize(kInitialHashTableSize * sizeof(StringViewEntry)));
+    return HashTable::Init(kInitialHashTableSize);
+  }
+
+  Status Append(const ArrayData& arr) override {
+    if (!initialized_) {
+      RETURN_NOT_OK(Init());
+    }
+
+    const StringViewEntry* views = GetValues<StringViewEntry>(arr, 1);
+    std::vector<const uint8_t*> data_buffers;
+    for (size_t i = 2; i < arr.buffers.size(); ++i) {
+      data_buffers.push_back(arr.buffers[i] ? arr.buffers[i]->data() : nullptr);
+    }
+
+    auto action = static_cast<Action*>(this);
+    RETURN_NOT_OK(action->Reserve(arr.length));
+
+#define HASH_BLOCK(START, LENGTH, OUT)                                                 \
+  for (int64_t k = 0; k < LENGTH; ++k) {                                               \
+    OUT[k] = static_cast<uint32_t>(                                                    \
+        HashValue(views[START + k],                                                    \
+                  internal::StringViewData(views[START + k], data_buffers.data())));   \
+  }
+
+#define HASH_INNER_LOOP()                                                              \
+  const StringViewEntry& view = views[i];                                              \
+                                                                                       \
+  int64_t j = hash & mod_bitmask_;                                                     \
+  hash_slot_t slot = hash_slots_[j];                                                   \
+                                                                                       \
+  auto dict_views = reinterpret_cast<const StringViewEntry*>(dict_views_.data());      \
+  const uint8_t* dict_data = dict_data_.data();                                        \
+  while (kHashSlotEmpty != slot &&                                                     \
+         !internal::StringViewEquals(view, data_buffers.data(), dict_views[slot],      \
+                                     &dict_data)) {                                    \
+    ++j;                                                                               \
+    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                                  \
+      j = 0;                                                                           \
+    }                                                                                  \
+    slot = hash_slots_[j];                                                             \
+  }                                                                                    \
+                                                                                       \
+  if (slot == kHashSlotEmpty && frozen_) {                                             \
+    action->ObserveMissing();                                                          \
+  } else if (slot == kHashSlotEmpty) {                                                 \
+    slot = dict_size_++;                                                               \
+    hash_slots_[j] = slot;                                                             \
+                                                                                       \
+    const uint8_t* value = internal::StringViewData(view, data_buffers.data());        \
+    const StringViewEntry dict_view = internal::MakeStringView(                        \
+        value, view.size, 0, static_cast<int32_t>(dict_data_.length()));               \
+    if (!view.is_inline()) {                                                           \
+      RETURN_NOT_OK(dict_data_.Append(value, view.size));                              \
+    }                                                                                  \
+    RETURN_NOT_OK(dict_views_.Append(&dict_view, sizeof(dict_view)));                   \
+                                                                                       \
+    action->ObserveNotFound(slot);                                                     \
+                                                                                       \
+    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {                \
+      RETURN_NOT_OK(action->DoubleSize());                                             \
+    }                                                                                  \
+  } else {                                                                             \
+    action->ObserveFound(slot);                                                        \
+  }
+
+    BATCHED_HASH_PASS(HASH_BLOCK, HASH_INNER_LOOP);
+
+#undef HASH_BLOCK
+#undef HASH_INNER_LOOP
+
+    return Status::OK();
+  }
+
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+    // TODO(wesm): handle null being in the dictionary
+    BufferVector buffers = {nullptr, nullptr};
+    const bool has_data = dict_data_.length() > 0;
+
+    RETURN_NOT_OK(dict_views_.Finish(&buffers[1]));
+    if (has_data) {
+      buffers.emplace_back();
+      RETURN_NOT_OK(dict_data_.Finish(&buffers[2]));
+    }
+
+    *out = ArrayData::Make(type_, dict_size_, std::move(buffers), 0);
+    return Status::OK();
+  }
+
+ protected:
+  int64_t HashValue(const StringViewEntry& view, const uint8_t* value) const {
+    const int32_t offsets[2] = {0, view.size};
+    uint32_t hash;
+    internal::HashBinaryValues(offsets, value, 1, &hash);
+    return hash;
+  }
+
+  Status DoubleTableSize() {
+#define STRING_VIEW_SETUP                                                      \
+  auto dict_views = reinterpret_cast<const StringViewEntry*>(dict_views_.data()); \
+  const uint8_t* dict_data = dict_data_.data()
+
+#define STRING_VIEW_COMPUTE_HASH                                                   \
+  int64_t j = HashValue(dict_views[index],                                         \
+                        internal::StringViewData(dict_views[index], &dict_data)) & \
+              new_mod_bitmask
+
+    DOUBLE_TABLE_SIZE(STRING_VIEW_SETUP, STRING_VIEW_COMPUTE_HASH);
+
+#undef STRING_VIEW_SETUP
+#undef STRING_VIEW_COMPUTE_HASH
+
+    return Status::OK();
+  }
+
+  BufferBuilder dict_views_;
+  TypedBufferBuilder<uint8_t> dict_data_;
+  int32_t dict_size_;
+};
+
 // ----------------------------------------------------------------------
 // Hash table pass for fixed size binary types
 
@@ -540,9 +717,12 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
     auto action = static_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
+#define HASH_BLOCK(START, LENGTH, OUT) \
+  internal::HashFixedWidthValues(data + START * byte_width_, byte_width_, LENGTH, OUT)
+
 #define HASH_INNER_LOOP()                                                      \
   const uint8_t* value = data + i * byte_width_;                               \
-  int64_t j = HashValue(value) & mod_bitmask_;                                 \
+  int64_t j = hash & mod_bitmask_;                                             \
   hash_slot_t slot = hash_slots_[j];                                           \
                                                                                \
   const uint8_t* dict_data = dict_data_.data();                                \
@@ -555,11 +735,9 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
     slot = hash_slots_[j];                                                     \
   }                                                                            \
                                                                                \
-  if (slot == kHashSlotEmpty) {                                                \
-    if (!Action::allow_expand) {                                               \
-      throw HashException("Encountered new dictionary value");                 \
-    }                                                                          \
-                                                                               \
+  if (slot == kHashSlotEmpty && frozen_) {                                     \
+    action->ObserveMissing();                                                  \
+  } else if (slot == kHashSlotEmpty) {                                         \
     slot = dict_size_++;                                                       \
     hash_slots_[j] = slot;                                                     \
                                                                                \
@@ -574,8 +752,9 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
     action->ObserveFound(slot);                                                \
   }
 
-    GENERIC_HASH_PASS(HASH_INNER_LOOP);
+    BATCHED_HASH_PASS(HASH_BLOCK, HASH_INNER_LOOP);
 
+#undef HASH_BLOCK
 #undef HASH_INNER_LOOP
 
     return Status::OK();
@@ -592,7 +771,9 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
 
  protected:
   int64_t HashValue(const uint8_t* data) const {
-    return HashUtil::Hash(data, byte_width_, 0);
+    uint32_t hash;
+    internal::HashFixedWidthValues(data, byte_width_, 1, &hash);
+    return hash;
   }
 
   Status DoubleTableSize() {
@@ -647,22 +828,20 @@ class HashTableKernel<Type, Action, enable_if_8bit_int<Type>> : public HashTable
     auto action = static_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                      \
-  const T value = values[i];                                   \
-  const int hash = Hash8Bit<T>(value);                         \
-  hash_slot_t slot = table_[hash];                             \
-                                                               \
-  if (slot == kHashSlotEmpty) {                                \
-    if (!Action::allow_expand) {                               \
-      throw HashException("Encountered new dictionary value"); \
-    }                                                          \
-                                                               \
-    slot = static_cast<hash_slot_t>(dict_.size());             \
-    table_[hash] = slot;                                       \
-    dict_.push_back(value);                                    \
-    action->ObserveNotFound(slot);                             \
-  } else {                                                     \
-    action->ObserveFound(slot);                                \
+#define HASH_INNER_LOOP()                          \
+  const T value = values[i];                       \
+  const int hash = Hash8Bit<T>(value);             \
+  hash_slot_t slot = table_[hash];                 \
+                                                   \
+  if (slot == kHashSlotEmpty && frozen_) {         \
+    action->ObserveMissing();                      \
+  } else if (slot == kHashSlotEmpty) {             \
+    slot = static_cast<hash_slot_t>(dict_.size()); \
+    table_[hash] = slot;                           \
+    dict_.push_back(value);                        \
+    action->ObserveNotFound(slot);                 \
+  } else {                                         \
+    action->ObserveFound(slot);                    \
   }
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
@@ -694,7 +873,6 @@ class HashTableKernel<Type, Action, enable_if_8bit_int<Type>> : public HashTable
 template <typename Type>
 class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
  public:
-  static constexpr bool allow_expand = true;
   using Base = HashTableKernel<Type, UniqueImpl<Type>>;
   using Base::Base;
 
@@ -703,6 +881,7 @@ class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
   void ObserveFound(const hash_slot_t slot) {}
   void ObserveNull() {}
   void ObserveNotFound(const hash_slot_t slot) {}
+  void ObserveMissing() {}
 
   Status DoubleSize() { return Base::DoubleTableSize(); }
 
@@ -715,12 +894,11 @@ class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
 };
 
 // ----------------------------------------------------------------------
-// Dictionary encode implementation
+// Dictionary encode implementation, also used by match
 
 template <typename Type>
 class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
  public:
-  static constexpr bool allow_expand = true;
   using Base = HashTableKernel<Type, DictEncodeImpl>;
 
   DictEncodeImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
@@ -734,6 +912,8 @@ class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
 
   void ObserveNotFound(const hash_slot_t slot) { return ObserveFound(slot); }
 
+  void ObserveMissing() { return ObserveNull(); }
+
   Status DoubleSize() { return Base::DoubleTableSize(); }
 
   Status Flush(Datum* out) override {
@@ -749,6 +929,79 @@ class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
   Int32Builder indices_builder_;
 };
 
+// ----------------------------------------------------------------------
+// IsIn implementation
+
+template <typename Type>
+class IsInImpl : public HashTableKernel<Type, IsInImpl<Type>> {
+ public:
+  using Base = HashTableKernel<Type, IsInImpl>;
+
+  IsInImpl(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : Base(type, pool), builder_(pool) {}
+
+  Status Reserve(const int64_t length) { return builder_.Reserve(length); }
+
+  void ObserveNull() { builder_.UnsafeAppendToBitmap(false); }
+
+  void ObserveFound(const hash_slot_t slot) { builder_.UnsafeAppend(true); }
+
+  void ObserveNotFound(const hash_slot_t slot) { return ObserveFound(slot); }
+
+  void ObserveMissing() { builder_.UnsafeAppend(false); }
+
+  Status DoubleSize() { return Base::DoubleTableSize(); }
+
+  Status Flush(Datum* out) override {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  using Base::Append;
+
+ private:
+  BooleanBuilder builder_;
+};
+
+// ----------------------------------------------------------------------
+// Value counts implementation
+
+template <typename Type>
+class ValueCountsImpl : public HashTableKernel<Type, ValueCountsImpl<Type>> {
+ public:
+  using Base = HashTableKernel<Type, ValueCountsImpl>;
+  using Base::Base;
+
+  Status Reserve(const int64_t length) { return Status::OK(); }
+
+  void ObserveNull() {}
+
+  void ObserveFound(const hash_slot_t slot) { ++counts_[slot]; }
+
+  void ObserveNotFound(const hash_slot_t slot) { counts_.push_back(1); }
+
+  void ObserveMissing() {}
+
+  Status DoubleSize() { return Base::DoubleTableSize(); }
+
+  // Yield the counts of all the values seen so far, in dictionary order
+  Status Flush(Datum* out) override {
+    Int64Builder builder(this->pool_);
+    RETURN_NOT_OK(builder.Append(counts_.data(), static_cast<int64_t>(counts_.size())));
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  using Base::Append;
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
 // ----------------------------------------------------------------------
 // Kernel wrapper for generic hash table kernels
 
@@ -764,13 +1017,12 @@ class HashKernelImpl : public HashKernel {
   }
 
   Status Append(FunctionContext* ctx, const ArrayData& input) override {
-    std::lock_guard<std::mutex> guard(lock_);
-    try {
-      RETURN_NOT_OK(hasher_->Append(input));
-    } catch (const HashException& e) {
-      return Status(e.code(), e.what());
+    if (input.length == 0) {
+      // Empty arrays may lack data buffers
+      return Status::OK();
     }
-    return Status::OK();
+    std::lock_guard<std::mutex> guard(lock_);
+    return hasher_->Append(input);
   }
 
   Status Flush(Datum* out) override { return hasher_->Flush(out); }
@@ -784,46 +1036,87 @@ class HashKernelImpl : public HashKernel {
   std::unique_ptr<HashTable> hasher_;
 };
 
-}  // namespace
-
-Status GetUniqueKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
-                       std::unique_ptr<HashKernel>* out) {
+template <template <typename> class Impl>
+Status MakeHashTable(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                     const char* funcname, std::unique_ptr<HashTable>* out) {
   std::unique_ptr<HashTable> hasher;
 
-#define UNIQUE_CASE(InType)                                         \
-  case InType::type_id:                                             \
-    hasher.reset(new UniqueImpl<InType>(type, ctx->memory_pool())); \
+#define HASH_TABLE_CASE(InType)                               \
+  case InType::type_id:                                       \
+    hasher.reset(new Impl<InType>(type, ctx->memory_pool())); \
     break
 
   switch (type->id()) {
-    UNIQUE_CASE(NullType);
-    UNIQUE_CASE(BooleanType);
-    UNIQUE_CASE(UInt8Type);
-    UNIQUE_CASE(Int8Type);
-    UNIQUE_CASE(UInt16Type);
-    UNIQUE_CASE(Int16Type);
-    UNIQUE_CASE(UInt32Type);
-    UNIQUE_CASE(Int32Type);
-    UNIQUE_CASE(UInt64Type);
-    UNIQUE_CASE(Int64Type);
-    UNIQUE_CASE(FloatType);
-    UNIQUE_CASE(DoubleType);
-    UNIQUE_CASE(Date32Type);
-    UNIQUE_CASE(Date64Type);
-    UNIQUE_CASE(Time32Type);
-    UNIQUE_CASE(Time64Type);
-    UNIQUE_CASE(TimestampType);
-    UNIQUE_CASE(BinaryType);
-    UNIQUE_CASE(StringType);
-    UNIQUE_CASE(FixedSizeBinaryType);
-    UNIQUE_CASE(Decimal128Type);
+    HASH_TABLE_CASE(NullType);
+    HASH_TABLE_CASE(BooleanType);
+    HASH_TABLE_CASE(UInt8Type);
+    HASH_TABLE_CASE(Int8Type);
+    HASH_TABLE_CASE(UInt16Type);
+    HASH_TABLE_CASE(Int16Type);
+    HASH_TABLE_CASE(UInt32Type);
+    HASH_TABLE_CASE(Int32Type);
+    HASH_TABLE_CASE(UInt64Type);
+    HASH_TABLE_CASE(Int64Type);
+    HASH_TABLE_CASE(FloatType);
+    HASH_TABLE_CASE(DoubleType);
+    HASH_TABLE_CASE(Date32Type);
+    HASH_TABLE_CASE(Date64Type);
+    HASH_TABLE_CASE(Time32Type);
+    HASH_TABLE_CASE(Time64Type);
+    HASH_TABLE_CASE(TimestampType);
+    HASH_TABLE_CASE(BinaryType);
+    HASH_TABLE_CASE(StringType);
+    HASH_TABLE_CASE(StringViewType);
+    HASH_TABLE_CASE(FixedSizeBinaryType);
+    HASH_TABLE_CASE(Decimal128Type);
     default:
       break;
   }
 
-#undef UNIQUE_CASE
+#undef HASH_TABLE_CASE
+
+  CHECK_IMPLEMENTED(hasher, funcname, type);
+  *out = std::move(hasher);
+  return Status::OK();
+}
+
+// Hash all values of the member set, then freeze the table for probing
+template <template <typename> class Impl>
+Status MakeMemberSetKernel(FunctionContext* ctx, const Datum& member_set,
+                           const char* funcname, std::unique_ptr<HashKernel>* out) {
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  if (member_set.kind() == Datum::ARRAY) {
+    arrays.push_back(member_set.array());
+  } else if (member_set.kind() == Datum::CHUNKED_ARRAY) {
+    for (const std::shared_ptr<Array>& chunk : member_set.chunked_array()->chunks()) {
+      arrays.push_back(chunk->data());
+    }
+  } else {
+    return Status::Invalid("Member set must be array-like");
+  }
+
+  std::unique_ptr<HashTable> hasher;
+  RETURN_NOT_OK(MakeHashTable<Impl>(ctx, member_set.type(), funcname, &hasher));
+  for (const std::shared_ptr<ArrayData>& array : arrays) {
+    if (array->length == 0) {
+      continue;
+    }
+    RETURN_NOT_OK(hasher->Append(*array));
+    // Discard the output for the member set itself
+    Datum member_output;
+    RETURN_NOT_OK(hasher->Flush(&member_output));
+  }
+  hasher->Freeze();
+  out->reset(new HashKernelImpl(std::move(hasher)));
+  return Status::OK();
+}
+
+}  // namespace
 
-  CHECK_IMPLEMENTED(hasher, "unique", type);
+Status GetUniqueKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<HashKernel>* out) {
+  std::unique_ptr<HashTable> hasher;
+  RETURN_NOT_OK(MakeHashTable<UniqueImpl>(ctx, type, "unique", &hasher));
   out->reset(new HashKernelImpl(std::move(hasher)));
   return Status::OK();
 }
@@ -832,41 +1125,25 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
                                  const std::shared_ptr<DataType>& type,
                                  std::unique_ptr<HashKernel>* out) {
   std::unique_ptr<HashTable> hasher;
+  RETURN_NOT_OK(MakeHashTable<DictEncodeImpl>(ctx, type, "dictionary-encode", &hasher));
+  out->reset(new HashKernelImpl(std::move(hasher)));
+  return Status::OK();
+}
 
-#define DICTIONARY_ENCODE_CASE(InType)                                  \
-  case InType::type_id:                                                 \
-    hasher.reset(new DictEncodeImpl<InType>(type, ctx->memory_pool())); \
-    break
-
-  switch (type->id()) {
-    DICTIONARY_ENCODE_CASE(NullType);
-    DICTIONARY_ENCODE_CASE(BooleanType);
-    DICTIONARY_ENCODE_CASE(UInt8Type);
-    DICTIONARY_ENCODE_CASE(Int8Type);
-    DICTIONARY_ENCODE_CASE(UInt16Type);
-    DICTIONARY_ENCODE_CASE(Int16Type);
-    DICTIONARY_ENCODE_CASE(UInt32Type);
-    DICTIONARY_ENCODE_CASE(Int32Type);
-    DICTIONARY_ENCODE_CASE(UInt64Type);
-    DICTIONARY_ENCODE_CASE(Int64Type);
-    DICTIONARY_ENCODE_CASE(FloatType);
-    DICTIONARY_ENCODE_CASE(DoubleType);
-    DICTIONARY_ENCODE_CASE(Date32Type);
-    DICTIONARY_ENCODE_CASE(Date64Type);
-    DICTIONARY_ENCODE_CASE(Time32Type);
-    DICTIONARY_ENCODE_CASE(Time64Type);
-    DICTIONARY_ENCODE_CASE(TimestampType);
-    DICTIONARY_ENCODE_CASE(BinaryType);
-    DICTIONARY_ENCODE_CASE(StringType);
-    DICTIONARY_ENCODE_CASE(FixedSizeBinaryType);
-    DICTIONARY_ENCODE_CASE(Decimal128Type);
-    default:
-      break;
-  }
+Status GetMatchKernel(FunctionContext* ctx, const Datum& member_set,
+                      std::unique_ptr<HashKernel>* out) {
+  return MakeMemberSetKernel<DictEncodeImpl>(ctx, member_set, "match", out);
+}
 
-#undef DICTIONARY_ENCODE_CASE
+Status GetIsInKernel(FunctionContext* ctx, const Datum& member_set,
+                     std::unique_ptr<HashKernel>* out) {
+  return MakeMemberSetKernel<IsInImpl>(ctx, member_set, "isin", out);
+}
 
-  CHECK_IMPLEMENTED(hasher, "dictionary-encode", type);
+Status GetValueCountsKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<HashKernel>* out) {
+  std::unique_ptr<HashTable> hasher;
+  RETURN_NOT_OK(MakeHashTable<ValueCountsImpl>(ctx, type, "value counts", &hasher));
   out->reset(new HashKernelImpl(std::move(hasher)));
   return Status::OK();
 }
@@ -884,17 +1161,7 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
-}  // namespace
-
-Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
-
-  std::vector<Datum> dummy_outputs;
-  return InvokeHash(ctx, func.get(), value, &dummy_outputs, out);
-}
-
-Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
+Status DictionaryEncodeSerial(FunctionContext* ctx, const Datum& value, Datum* out) {
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
 
@@ -918,5 +1185,592 @@ Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Parallel hashing with partial hash tables
+//
+// The input is split into contiguous pieces (the chunks of a ChunkedArray,
+// or slices of an Array), and the pieces are divided into contiguous
+// partitions, each hashed by one task into its own hash table. The partial
+// dictionaries are then hashed in partition order into a final hash table,
+// so that values keep the order of their first occurrence in the input and
+// the result is the same as with serial hashing.
+
+// Arrays shorter than this are hashed serially, and longer ones are not cut
+// into slices shorter than this
+constexpr int64_t kMinParallelHashLength = 1 << 16;
+
+typedef Status (*HashKernelFactory)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                    std::unique_ptr<HashKernel>*);
+
+int GetHashParallelism(FunctionContext* ctx) {
+  TaskScheduler* scheduler = ctx->task_scheduler();
+  return scheduler != nullptr ? scheduler->num_workers() : ctx->num_threads();
+}
+
+struct HashPiece {
+  // Index of the output array the piece belongs to, and its offset therein
+  int output;
+  int64_t offset;
+  std::shared_ptr<ArrayData> values;
+};
+
+struct HashPartitions {
+  std::vector<HashPiece> pieces;
+  // Partition i is made of pieces [bounds[i], bounds[i + 1])
+  std::vector<int> bounds;
+
+  int num_partitions() const { return static_cast<int>(bounds.size()) - 1; }
+};
+
+// Return false if the input is not worth hashing in parallel
+bool PartitionForHashing(FunctionContext* ctx, const Datum& value,
+                         HashPartitions* partitions) {
+  const int parallelism = GetHashParallelism(ctx);
+  // Null arrays have no validity bitmap to remap indices with
+  if (parallelism <= 1 || value.type()->id() == Type::NA) {
+    return false;
+  }
+
+  std::vector<HashPiece>& pieces = partitions->pieces;
+  int64_t total_length = 0;
+  if (value.kind() == Datum::ARRAY) {
+    const std::shared_ptr<ArrayData>& array = value.array();
+    total_length = array->length;
+    const int64_t num_slices = std::min<int64_t>(
+        parallelism, std::max<int64_t>(1, total_length / kMinParallelHashLength));
+    for (int64_t i = 0; i < num_slices; ++i) {
+      const int64_t begin = total_length * i / num_slices;
+      const int64_t end = total_length * (i + 1) / num_slices;
+      std::shared_ptr<ArrayData> slice = std::make_shared<ArrayData>(*array);
+      slice->offset = array->offset + begin;
+      slice->length = end - begin;
+      slice->null_count = array->null_count != 0 ? kUnknownNullCount : 0;
+      pieces.push_back(HashPiece{0, begin, slice});
+    }
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    const ChunkedArray& array = *value.chunked_array();
+    total_length = array.length();
+    for (int i = 0; i < array.num_chunks(); ++i) {
+      pieces.push_back(HashPiece{i, 0, array.chunk(i)->data()});
+    }
+  }
+  if (pieces.size() < 2 || total_length < kMinParallelHashLength) {
+    return false;
+  }
+
+  // Cut partitions of roughly equal lengths
+  const int num_partitions = std::min(parallelism, static_cast<int>(pieces.size()));
+  partitions->bounds.push_back(0);
+  int64_t hashed_length = 0;
+  for (int i = 0; i < static_cast<int>(pieces.size()); ++i) {
+    hashed_length += pieces[i].values->length;
+    const int remaining_pieces = static_cast<int>(pieces.size()) - i - 1;
+    const int remaining_partitions =
+        num_partitions - static_cast<int>(partitions->bounds.size());
+    if (remaining_partitions > 0 &&
+        (remaining_pieces <= remaining_partitions ||
+         hashed_length * num_partitions >=
+             total_length * static_cast<int64_t>(partitions->bounds.size()))) {
+      partitions->bounds.push_back(i + 1);
+    }
+  }
+  partitions->bounds.push_back(static_cast<int>(pieces.size()));
+  return true;
+}
+
+// Hash each partition into its own hash table, collecting the kernel output
+// for each piece and the dictionary of each partition
+Status HashPartitionsParallel(FunctionContext* ctx, HashKernelFactory factory,
+                              const std::shared_ptr<DataType>& type,
+                              const HashPartitions& partitions,
+                              std::vector<Datum>* piece_outputs,
+                              std::vector<std::shared_ptr<ArrayData>>* dictionaries) {
+  piece_outputs->resize(partitions.pieces.size());
+  dictionaries->resize(partitions.num_partitions());
+  return detail::ParallelInvoke(
+      ctx, partitions.num_partitions(), [&](FunctionContext* task_ctx, int i) {
+        std::unique_ptr<HashKernel> kernel;
+        RETURN_NOT_OK(factory(task_ctx, type, &kernel));
+        for (int k = partitions.bounds[i]; k < partitions.bounds[i + 1]; ++k) {
+          RETURN_NOT_OK(kernel->Append(task_ctx, *partitions.pieces[k].values));
+          RETURN_NOT_OK(kernel->Flush(&(*piece_outputs)[k]));
+        }
+        return kernel->GetDictionary(&(*dictionaries)[i]);
+      });
+}
+
+// Hash the partial dictionaries into a final hash table. The kernel outputs
+// for each partial dictionary are returned in transpositions
+Status MergeDictionaries(FunctionContext* ctx, HashKernelFactory factory,
+                         const std::shared_ptr<DataType>& type,
+                         const std::vector<std::shared_ptr<ArrayData>>& dictionaries,
+                         std::vector<Datum>* transpositions,
+                         std::shared_ptr<ArrayData>* out) {
+  std::unique_ptr<HashKernel> kernel;
+  RETURN_NOT_OK(factory(ctx, type, &kernel));
+  transpositions->resize(dictionaries.size());
+  for (size_t i = 0; i < dictionaries.size(); ++i) {
+    RETURN_NOT_OK(kernel->Append(ctx, *dictionaries[i]));
+    RETURN_NOT_OK(kernel->Flush(&(*transpositions)[i]));
+  }
+  return kernel->GetDictionary(out);
+}
+
+// Write the indices of a piece into the final dictionary
+void TransposeIndices(const ArrayData& local_indices, const ArrayData& transposition,
+                      int32_t* out) {
+  const int64_t length = local_indices.length;
+  if (length == 0) {
+    return;
+  }
+  if (transposition.length == 0) {
+    // Empty partial dictionary: all values are null
+    std::fill(out, out + length, 0);
+    return;
+  }
+  const int32_t* local = GetValues<int32_t>(local_indices, 1);
+  const int32_t* transpose_map = GetValues<int32_t>(transposition, 1);
+  if (local_indices.null_count == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = transpose_map[local[i]];
+    }
+  } else {
+    // Values at null slots are left uninitialized by the builder
+    const uint8_t* valid_bits = local_indices.buffers[0]->data();
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t position = local_indices.offset + i;
+      out[i] = BitUtil::GetBit(valid_bits, position) ? transpose_map[local[i]] : 0;
+    }
+  }
+}
+
+Status AllocateIndices(FunctionContext* ctx, const ArrayData& values,
+                       std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> null_bitmap;
+  if (values.null_count != 0 && values.buffers[0] != nullptr) {
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), values.buffers[0]->data(),
+                             values.offset, values.length, &null_bitmap));
+  }
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(ctx->Allocate(values.length * sizeof(int32_t), &data));
+  const int64_t null_count = null_bitmap == nullptr ? 0 : values.null_count;
+  *out = ArrayData::Make(int32(), values.length, {null_bitmap, data}, null_count);
+  return Status::OK();
+}
+
+class ParallelDictionaryEncodeKernel : public UnaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    HashPartitions partitions;
+    if (!PartitionForHashing(ctx, input, &partitions)) {
+      return DictionaryEncodeSerial(ctx, input, out);
+    }
+    const std::shared_ptr<DataType> type = input.type();
+
+    std::vector<Datum> local_indices;
+    std::vector<std::shared_ptr<ArrayData>> local_dictionaries;
+    RETURN_NOT_OK(HashPartitionsParallel(ctx, GetDictionaryEncodeKernel, type,
+                                         partitions, &local_indices,
+                                         &local_dictionaries));
+
+    std::vector<Datum> transpositions;
+    std::shared_ptr<ArrayData> dict_data;
+    RETURN_NOT_OK(MergeDictionaries(ctx, GetDictionaryEncodeKernel, type,
+                                    local_dictionaries, &transpositions, &dict_data));
+
+    // One indices array per input chunk, or a single one for an array input
+    std::vector<std::shared_ptr<ArrayData>> indices;
+    if (input.kind() == Datum::ARRAY) {
+      indices.resize(1);
+      RETURN_NOT_OK(AllocateIndices(ctx, *input.array(), &indices[0]));
+    } else {
+      const ChunkedArray& chunked = *input.chunked_array();
+      indices.resize(chunked.num_chunks());
+      for (int i = 0; i < chunked.num_chunks(); ++i) {
+        RETURN_NOT_OK(AllocateIndices(ctx, *chunked.chunk(i)->data(), &indices[i]));
+      }
+    }
+
+    RETURN_NOT_OK(detail::ParallelInvoke(
+        ctx, partitions.num_partitions(), [&](FunctionContext* task_ctx, int i) {
+          const ArrayData& transposition = *transpositions[i].array();
+          for (int k = partitions.bounds[i]; k < partitions.bounds[i + 1]; ++k) {
+            const HashPiece& piece = partitions.pieces[k];
+            int32_t* out_values =
+                GetMutableValues<int32_t>(indices[piece.output].get(), 1) + piece.offset;
+            TransposeIndices(*local_indices[k].array(), transposition, out_values);
+          }
+          return Status::OK();
+        }));
+
+    std::shared_ptr<DataType> dict_type =
+        ::arrow::dictionary(int32(), MakeArray(dict_data));
+    std::vector<std::shared_ptr<Array>> dict_chunks;
+    for (const std::shared_ptr<ArrayData>& data : indices) {
+      dict_chunks.emplace_back(
+          std::make_shared<DictionaryArray>(dict_type, MakeArray(data)));
+    }
+    *out = detail::WrapArraysLike(input, dict_chunks);
+    return Status::OK();
+  }
+};
+
+}  // namespace
+
+Status GetParallelDictionaryEncodeKernel(FunctionContext* ctx,
+                                         const std::shared_ptr<DataType>& type,
+                                         std::unique_ptr<UnaryKernel>* out) {
+  // Check the type is supported
+  std::unique_ptr<HashKernel> serial_kernel;
+  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, type, &serial_kernel));
+  out->reset(new ParallelDictionaryEncodeKernel());
+  return Status::OK();
+}
+
+Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  KernelProfileScope profile(ctx, "Unique");
+  HashPartitions partitions;
+  if (PartitionForHashing(ctx, value, &partitions)) {
+    std::vector<Datum> dummy_outputs;
+    std::vector<std::shared_ptr<ArrayData>> local_uniques;
+    RETURN_NOT_OK(HashPartitionsParallel(ctx, GetUniqueKernel, value.type(), partitions,
+                                         &dummy_outputs, &local_uniques));
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(MergeDictionaries(ctx, GetUniqueKernel, value.type(), local_uniques,
+                                    &dummy_outputs, &uniques));
+    *out = MakeArray(uniques);
+    return Status::OK();
+  }
+
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
+
+  std::vector<Datum> dummy_outputs;
+  return InvokeHash(ctx, func.get(), value, &dummy_outputs, out);
+}
+
+namespace {
+
+// Each column has its own hash table, so columns are encoded independently
+Status DictionaryEncodeTable(FunctionContext* ctx, const Table& table, Datum* out) {
+  const int num_columns = table.num_columns();
+  std::vector<std::shared_ptr<Column>> columns(num_columns);
+  std::vector<std::shared_ptr<Field>> fields(num_columns);
+
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_columns, [&](FunctionContext* task_ctx, int i) {
+        const Column& column = *table.column(i);
+        Datum encoded;
+        RETURN_NOT_OK(DictionaryEncode(task_ctx, Datum(column.data()), &encoded));
+        const std::shared_ptr<Field>& field = column.field();
+        fields[i] = ::arrow::field(field->name(), encoded.type(), field->nullable(),
+                                   field->metadata());
+        columns[i] = std::make_shared<Column>(fields[i], encoded.chunked_array());
+        return Status::OK();
+      }));
+
+  auto schema = ::arrow::schema(fields, table.schema()->metadata());
+  out->value = Table::Make(schema, columns, table.num_rows());
+  return Status::OK();
+}
+
+}  // namespace
+
+Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "DictionaryEncode");
+  if (value.kind() == Datum::TABLE) {
+    return DictionaryEncodeTable(ctx, *value.table(), out);
+  }
+  if (GetHashParallelism(ctx) > 1) {
+    std::unique_ptr<UnaryKernel> func;
+    RETURN_NOT_OK(GetParallelDictionaryEncodeKernel(ctx, value.type(), &func));
+    return func->Call(ctx, value, out);
+  }
+  return DictionaryEncodeSerial(ctx, value, out);
+}
+
+// ----------------------------------------------------------------------
+// Dictionary unification
+
+namespace {
+
+template <typename IndexType>
+void TransposeIndexValues(const ArrayData& indices, const ArrayData& transpose_map,
+                          ArrayData* out) {
+  using index_c_type = typename IndexType::c_type;
+  if (indices.null_count == indices.length) {
+    return;
+  }
+  const index_c_type* in = GetValues<index_c_type>(indices, 1);
+  const int32_t* map = GetValues<int32_t>(transpose_map, 1);
+  int32_t* out_values = GetMutableValues<int32_t>(out, 1);
+
+  // Null slots may hold any index, so only runs of valid slots are gathered
+  VisitValidRuns(indices, [&](int64_t position, int64_t length) {
+    detail::GatherValues(in + position, length, map, out_values + position);
+  });
+  if (!HasValidityBitmap(transpose_map)) {
+    return;
+  }
+
+  // The indices of null dictionary values become null
+  const uint8_t* map_valid = transpose_map.buffers[0]->data();
+  uint8_t* out_valid = out->buffers[0]->mutable_data();
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < out->length; ++i) {
+    if (BitUtil::GetBit(out_valid, i) &&
+        !BitUtil::GetBit(map_valid, transpose_map.offset + in[i])) {
+      BitUtil::ClearBit(out_valid, i);
+      out_values[i] = 0;
+    }
+    null_count += !BitUtil::GetBit(out_valid, i);
+  }
+  out->null_count = null_count;
+}
+
+Status TransposeDictionaryIndexData(FunctionContext* ctx, const ArrayData& indices,
+                                    const ArrayData& transpose_map,
+                                    std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(AllocateIndices(ctx, indices, out));
+  ArrayData* result = out->get();
+  if (result->buffers[0] != nullptr) {
+    std::memset(result->buffers[1]->mutable_data(), 0,
+                static_cast<size_t>(result->length * sizeof(int32_t)));
+  } else if (HasValidityBitmap(transpose_map)) {
+    // Allocate a validity bitmap for the nulls of the dictionary
+    const int64_t num_bytes = BitUtil::BytesForBits(result->length);
+    RETURN_NOT_OK(ctx->Allocate(num_bytes, &result->buffers[0]));
+    std::memset(result->buffers[0]->mutable_data(), 0xFF, static_cast<size_t>(num_bytes));
+  }
+
+  switch (indices.type->id()) {
+    case Type::INT8:
+      TransposeIndexValues<Int8Type>(indices, transpose_map, result);
+      break;
+    case Type::INT16:
+      TransposeIndexValues<Int16Type>(indices, transpose_map, result);
+      break;
+    case Type::INT32:
+      TransposeIndexValues<Int32Type>(indices, transpose_map, result);
+      break;
+    case Type::INT64:
+      TransposeIndexValues<Int64Type>(indices, transpose_map, result);
+      break;
+    default:
+      return Status::Invalid("Invalid index type: " + indices.type->ToString());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status UnifyDictionaries(FunctionContext* ctx,
+                         const std::vector<std::shared_ptr<Array>>& dictionaries,
+                         std::shared_ptr<Array>* out_dictionary,
+                         std::vector<std::shared_ptr<Array>>* out_transpose_maps) {
+  if (dictionaries.empty()) {
+    return Status::Invalid("No dictionaries to unify");
+  }
+  const std::shared_ptr<DataType>& type = dictionaries[0]->type();
+  std::vector<std::shared_ptr<ArrayData>> dictionary_data;
+  for (const auto& dictionary : dictionaries) {
+    if (!dictionary->type()->Equals(*type)) {
+      return Status::Invalid("Cannot unify dictionaries of " + type->ToString() +
+                             " and " + dictionary->type()->ToString());
+    }
+    dictionary_data.push_back(dictionary->data());
+  }
+
+  std::vector<Datum> transpositions;
+  std::shared_ptr<ArrayData> unified;
+  RETURN_NOT_OK(MergeDictionaries(ctx, GetDictionaryEncodeKernel, type, dictionary_data,
+                                  &transpositions, &unified));
+  *out_dictionary = MakeArray(unified);
+  out_transpose_maps->clear();
+  for (const Datum& transposition : transpositions) {
+    out_transpose_maps->push_back(MakeArray(transposition.array()));
+  }
+  return Status::OK();
+}
+
+Status TransposeDictionaryIndices(FunctionContext* ctx, const Array& array,
+                                  const Array& transpose_map,
+                                  const std::shared_ptr<Array>& dictionary,
+                                  std::shared_ptr<Array>* out) {
+  if (array.type_id() != Type::DICTIONARY) {
+    return Status::Invalid("Expected dictionary-encoded values, got " +
+                           array.type()->ToString());
+  }
+  const auto& dict_array = static_cast<const DictionaryArray&>(array);
+  if (transpose_map.type_id() != Type::INT32 ||
+      transpose_map.length() != dict_array.dictionary()->length()) {
+    return Status::Invalid("The transpose map does not match the dictionary");
+  }
+  std::shared_ptr<ArrayData> indices;
+  RETURN_NOT_OK(TransposeDictionaryIndexData(ctx, *dict_array.indices()->data(),
+                                             *transpose_map.data(), &indices));
+  *out = std::make_shared<DictionaryArray>(::arrow::dictionary(int32(), dictionary),
+                                           MakeArray(indices));
+  return Status::OK();
+}
+
+Status UnifyDictionaries(FunctionContext* ctx, const Datum& value, Datum* out) {
+  KernelProfileScope profile(ctx, "UnifyDictionaries");
+  ArrayVector chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(MakeArray(value.array()));
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("UnifyDictionaries expects array-like values");
+  }
+
+  // Chunks commonly share their dictionary, which is then hashed once
+  std::vector<std::shared_ptr<Array>> dictionaries;
+  std::vector<int> chunk_dictionaries;
+  for (const auto& chunk : chunks) {
+    if (chunk->type_id() != Type::DICTIONARY) {
+      return Status::Invalid("Expected dictionary-encoded values, got " +
+                             chunk->type()->ToString());
+    }
+    const auto& dict_type = static_cast<const DictionaryType&>(*chunk->type());
+    int position = 0;
+    while (position < static_cast<int>(dictionaries.size()) &&
+           dictionaries[position] != dict_type.dictionary()) {
+      ++position;
+    }
+    if (position == static_cast<int>(dictionaries.size())) {
+      dictionaries.push_back(dict_type.dictionary());
+    }
+    chunk_dictionaries.push_back(position);
+  }
+  if (chunks.empty()) {
+    *out = value;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Array> dictionary;
+  std::vector<std::shared_ptr<Array>> transpose_maps;
+  RETURN_NOT_OK(UnifyDictionaries(ctx, dictionaries, &dictionary, &transpose_maps));
+
+  ArrayVector out_chunks(chunks.size());
+  RETURN_NOT_OK(detail::ParallelInvoke(
+      ctx, static_cast<int>(chunks.size()), [&](FunctionContext* task_ctx, int i) {
+        return TransposeDictionaryIndices(task_ctx, *chunks[i],
+                                          *transpose_maps[chunk_dictionaries[i]],
+                                          dictionary, &out_chunks[i]);
+      }));
+  *out = detail::WrapArraysLike(value, out_chunks);
+  return Status::OK();
+}
+
+namespace {
+
+Status InvokeMemberSetKernel(FunctionContext* ctx, HashKernel* func, const Datum& values,
+                             const Datum& member_set, Datum* out) {
+  if (!values.type()->Equals(*member_set.type())) {
+    std::stringstream ss;
+    ss << "Values of type " << values.type()->ToString()
+       << " cannot be looked up in a member set of type "
+       << member_set.type()->ToString();
+    return Status::Invalid(ss.str());
+  }
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func, values, &outputs));
+  *out = detail::WrapDatumsLike(values, outputs);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Match(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+             Datum* out) {
+  KernelProfileScope profile(ctx, "Match");
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetMatchKernel(ctx, member_set, &func));
+  return InvokeMemberSetKernel(ctx, func.get(), values, member_set, out);
+}
+
+Status IsIn(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+            Datum* out) {
+  KernelProfileScope profile(ctx, "IsIn");
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetIsInKernel(ctx, member_set, &func));
+  return InvokeMemberSetKernel(ctx, func.get(), values, member_set, out);
+}
+
+namespace {
+
+// Count in parallel partitions, then add up the partial counts of each value
+Status CountValuesParallel(FunctionContext* ctx, const Datum& values,
+                           const HashPartitions& partitions,
+                           std::shared_ptr<Array>* out_uniques,
+                           std::shared_ptr<Array>* out_counts) {
+  const std::shared_ptr<DataType> type = values.type();
+  std::vector<Datum> piece_counts;
+  std::vector<std::shared_ptr<ArrayData>> local_uniques;
+  RETURN_NOT_OK(HashPartitionsParallel(ctx, GetValueCountsKernel, type, partitions,
+                                       &piece_counts, &local_uniques));
+
+  std::vector<Datum> transpositions;
+  std::shared_ptr<ArrayData> uniques;
+  RETURN_NOT_OK(MergeDictionaries(ctx, GetDictionaryEncodeKernel, type, local_uniques,
+                                  &transpositions, &uniques));
+
+  std::vector<int64_t> counts(uniques->length, 0);
+  for (int i = 0; i < partitions.num_partitions(); ++i) {
+    // The counts of a partition are complete after its last piece
+    const ArrayData& local_counts = *piece_counts[partitions.bounds[i + 1] - 1].array();
+    if (local_counts.length == 0) {
+      continue;
+    }
+    const int64_t* local = GetValues<int64_t>(local_counts, 1);
+    const int32_t* transpose_map = GetValues<int32_t>(*transpositions[i].array(), 1);
+    for (int64_t k = 0; k < local_counts.length; ++k) {
+      counts[transpose_map[k]] += local[k];
+    }
+  }
+
+  Int64Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Append(counts.data(), static_cast<int64_t>(counts.size())));
+  RETURN_NOT_OK(builder.Finish(out_counts));
+  *out_uniques = MakeArray(uniques);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status CountValues(FunctionContext* ctx, const Datum& values,
+                   std::shared_ptr<Array>* out_uniques,
+                   std::shared_ptr<Array>* out_counts) {
+  KernelProfileScope profile(ctx, "CountValues");
+  HashPartitions partitions;
+  if (PartitionForHashing(ctx, values, &partitions)) {
+    return CountValuesParallel(ctx, values, partitions, out_uniques, out_counts);
+  }
+
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetValueCountsKernel(ctx, values.type(), &func));
+
+  if (values.kind() == Datum::ARRAY) {
+    RETURN_NOT_OK(func->Append(ctx, *values.array()));
+  } else if (values.kind() == Datum::CHUNKED_ARRAY) {
+    for (const std::shared_ptr<Array>& chunk : values.chunked_array()->chunks()) {
+      RETURN_NOT_OK(func->Append(ctx, *chunk->data()));
+    }
+  } else {
+    return Status::Invalid("Input Datum was not array-like");
+  }
+
+  Datum counts;
+  RETURN_NOT_OK(func->Flush(&counts));
+  *out_counts = MakeArray(counts.array());
+
+  std::shared_ptr<ArrayData> uniques;
+  RETURN_NOT_OK(func->GetDictionary(&uniques));
+  *out_uniques = MakeArray(uniques);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -51,9 +51,58 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
                                  const std::shared_ptr<DataType>& type,
                                  std::unique_ptr<HashKernel>* kernel);
 
+/// \brief Get a kernel yielding, for each input value, its position in the
+/// member set, or null if the value is not a member
+///
+/// The member set (an array-like Datum) is hashed once, when creating the
+/// kernel. Positions refer to the distinct members, in order of first
+/// occurrence, returned by GetDictionary()
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetMatchKernel(FunctionContext* ctx, const Datum& member_set,
+                      std::unique_ptr<HashKernel>* kernel);
+
+/// \brief Get a kernel yielding, for each input value, whether it is in the
+/// member set. The member set is hashed once, when creating the kernel
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetIsInKernel(FunctionContext* ctx, const Datum& member_set,
+                     std::unique_ptr<HashKernel>* kernel);
+
+/// \brief Get a kernel counting the occurrences of each distinct value
+///
+/// Flush() yields the counts of all values appended so far, aligned with the
+/// distinct values returned by GetDictionary()
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetValueCountsKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<HashKernel>* kernel);
+
+/// \brief Get a kernel dictionary-encoding an array-like input in parallel
+///
+/// The input is split into partitions hashed into separate hash tables by up
+/// to ctx->num_threads() threads, or on ctx->task_scheduler() if one is set.
+/// The partial dictionaries are then merged into a single dictionary and the
+/// partial indices remapped into it. Unlike the kernel of
+/// GetDictionaryEncodeKernel, the kernel yields DictionaryArray values: a
+/// single one for an Array input, or one per chunk, all sharing the same
+/// dictionary, for a ChunkedArray input. The result is the same as with
+/// serial encoding. Small inputs are encoded serially
+ARROW_EXPORT
+Status GetParallelDictionaryEncodeKernel(FunctionContext* ctx,
+                                         const std::shared_ptr<DataType>& type,
+                                         std::unique_ptr<UnaryKernel>* kernel);
+
 /// \brief Compute unique elements from an array-like object
 /// \param[in] context the FunctionContext
-/// \param[in] datum array-like input
+/// \param[in] datum array-like input, hashed in parallel partitions when
+/// context allows several threads and the input is large enough
 /// \param[out] out result as Array
 ///
 /// \since 0.8.0
@@ -63,7 +112,9 @@ Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Arra
 
 /// \brief Dictionary-encode values in an array-like object
 /// \param[in] context the FunctionContext
-/// \param[in] data array-like input
+/// \param[in] data array-like input, or a Table in which case each column is
+/// encoded separately. Up to context->num_threads() threads are used, see
+/// GetParallelDictionaryEncodeKernel
 /// \param[out] out result with same shape and type as input
 ///
 /// \since 0.8.0
@@ -71,10 +122,105 @@ Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Arra
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
+/// \brief Look up the position of each value in a member set
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[in] member_set array-like set of values to look up, of the same
+/// type as values
+/// \param[out] out int32 positions in the distinct values of member_set, in
+/// order of first occurrence, with the same shape as values. Positions are
+/// null for null values and values not in member_set
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
+             Datum* out);
+
+/// \brief Test whether each value is in a member set
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[in] member_set array-like set of values to look up, of the same
+/// type as values
+/// \param[out] out boolean result with the same shape as values, null for
+/// null values
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
+            Datum* out);
+
+/// \brief Count the occurrences of each distinct non-null value
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input, hashed in parallel partitions when
+/// context allows several threads and the input is large enough
+/// \param[out] out_uniques distinct values, in order of first occurrence
+/// \param[out] out_counts int64 number of occurrences of each distinct value
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status CountValues(FunctionContext* context, const Datum& values,
+                   std::shared_ptr<Array>* out_uniques,
+                   std::shared_ptr<Array>* out_counts);
+
 // TODO(wesm): Define API for incremental dictionary encoding
 
-// TODO(wesm): Define API for regularizing DictionaryArray objects with
-// different dictionaries
+/// \brief Unify the dictionaries of dictionary-encoded arrays
+///
+/// The dictionaries are hashed in order into the hash table of a dictionary
+/// encoding kernel, so that the unified dictionary holds each distinct
+/// non-null value once, in order of first occurrence.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] dictionaries dictionaries of the same value type
+/// \param[out] out_dictionary the unified dictionary
+/// \param[out] out_transpose_maps for each dictionary, an int32 array of its
+/// length giving the position of each value in the unified dictionary, null
+/// for null values
+/// \return Status, Invalid if the value types differ
+ARROW_EXPORT
+Status UnifyDictionaries(FunctionContext* context,
+                         const std::vector<std::shared_ptr<Array>>& dictionaries,
+                         std::shared_ptr<Array>* out_dictionary,
+                         std::vector<std::shared_ptr<Array>>* out_transpose_maps);
+
+/// \brief Remap the indices of a DictionaryArray onto another dictionary
+///
+/// The indices are gathered from the transpose map, with the gather
+/// instructions of the host if it has any. Indices of null dictionary values
+/// become null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array a DictionaryArray
+/// \param[in] transpose_map int32 positions in dictionary of the values of
+/// the dictionary of array, as returned by UnifyDictionaries
+/// \param[in] dictionary the dictionary of the result
+/// \param[out] out a DictionaryArray with int32 indices into dictionary
+/// \return Status, Invalid if the transpose map does not match the dictionary
+/// of array
+ARROW_EXPORT
+Status TransposeDictionaryIndices(FunctionContext* context, const Array& array,
+                                  const Array& transpose_map,
+                                  const std::shared_ptr<Array>& dictionary,
+                                  std::shared_ptr<Array>* out);
+
+/// \brief Make dictionary-encoded data share a single dictionary
+///
+/// The distinct dictionaries of the chunks are unified with
+/// UnifyDictionaries, then the indices of the chunks are remapped in
+/// parallel, so that the chunks can be concatenated, hashed or written as a
+/// single IPC dictionary without being decoded.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value a DictionaryArray, or a ChunkedArray of DictionaryArrays
+/// whose dictionaries have the same value type
+/// \param[out] out the same shape as value, of DictionaryArrays with int32
+/// indices into the unified dictionary
+/// \return Status, Invalid for values not dictionary-encoded
+ARROW_EXPORT
+Status UnifyDictionaries(FunctionContext* context, const Datum& value, Datum* out);
 
 // class DictionaryEncoder {
 //  public:
@@ -86,20 +232,6 @@ Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out)
 // Status DictionaryEncode(FunctionContext* context, const Datum& data,
 //                         const Array& prior_dictionary, Datum* out);
 
-// TODO(wesm): Implement these next
-// ARROW_EXPORT
-// Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
-//              Datum* out);
-
-// ARROW_EXPORT
-// Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
-//             Datum* out);
-
-// ARROW_EXPORT
-// Status CountValues(FunctionContext* context, const Datum& values,
-//                    std::shared_ptr<Array>* out_uniques,
-//                    std::shared_ptr<Array>* out_counts);
-
 }  // namespace compute
 }  // namespace arrow
 
@@ -0,0 +1,448 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Call visit(i) for each null value i of an array
+template <typename Visit>
+void VisitNulls(const ArrayData& values, Visit&& visit) {
+  if (values.null_count == 0 || values.buffers[0] == nullptr) {
+    return;
+  }
+  internal::BitmapReader valid_reader(values.buffers[0]->data(), values.offset,
+                                      values.length);
+  for (int64_t i = 0; i < values.length; ++i) {
+    if (valid_reader.IsNotSet()) {
+      visit(i);
+    }
+    valid_reader.Next();
+  }
+}
+
+// The chunks of a column as a single array
+Status CombineColumn(MemoryPool* pool, const ChunkedArray& column,
+                     std::shared_ptr<Array>* out) {
+  if (column.num_chunks() == 1) {
+    *out = column.chunk(0);
+    return Status::OK();
+  }
+  if (column.num_chunks() == 0) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(pool, column.type(), &builder));
+    return builder->Finish(out);
+  }
+  return Concatenate(column.chunks(), pool, out);
+}
+
+std::shared_ptr<Schema> SelectFields(const Schema& schema,
+                                     const std::vector<int>& indices) {
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i : indices) {
+    fields.push_back(schema.field(i));
+  }
+  return ::arrow::schema(fields);
+}
+
+std::shared_ptr<RecordBatch> SelectColumns(const RecordBatch& batch,
+                                           const std::vector<int>& indices) {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i : indices) {
+    fields.push_back(batch.schema()->field(i));
+    columns.push_back(batch.column(i));
+  }
+  return RecordBatch::Make(::arrow::schema(fields), batch.num_rows(), columns);
+}
+
+// The columns of a schema, except the keys
+std::vector<int> PayloadColumns(const Schema& schema, const std::vector<int>& keys,
+                                bool keep_keys) {
+  std::vector<int> columns;
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    if (keep_keys || std::find(keys.begin(), keys.end(), i) == keys.end()) {
+      columns.push_back(i);
+    }
+  }
+  return columns;
+}
+
+// ----------------------------------------------------------------------
+// Hash join kernel
+
+// Rows are matched on the positions of their keys in the dictionaries of the
+// build keys. With several keys, these positions are combined into tuples,
+// hashed as int64 or fixed-size binary values as in GroupBy, and matched in
+// the dictionary of the build tuples. Either way, a row ends up with the id
+// of the group of build rows having the same keys, or null if there is none.
+// The build rows are bucketed by group id, in row order.
+class HashJoinKernelImpl : public HashJoinKernel {
+ public:
+  HashJoinKernelImpl(JoinType type, bool probe_is_left,
+                     const std::shared_ptr<Schema>& probe_schema,
+                     const std::vector<int>& probe_keys,
+                     const std::vector<int>& build_keys)
+      : type_(type),
+        probe_is_left_(probe_is_left),
+        probe_schema_(probe_schema),
+        probe_keys_(probe_keys),
+        build_keys_(build_keys) {
+    const int num_keys = static_cast<int>(probe_keys_.size());
+    if (num_keys == 2) {
+      tuple_type_ = int64();
+    } else if (num_keys > 2) {
+      tuple_type_ = fixed_size_binary(num_keys * static_cast<int>(sizeof(int32_t)));
+    }
+    // Only the left input keeps its keys
+    probe_columns_ = PayloadColumns(*probe_schema_, probe_keys_, probe_is_left_);
+  }
+
+  Status Build(FunctionContext* ctx, const Table& build) {
+    if (build.num_rows() > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("The build side of a hash join exceeds 2^31 - 1 rows");
+    }
+    // Combine the chunks of each column, then encode the keys
+    const int num_columns = build.num_columns();
+    std::vector<std::shared_ptr<Array>> build_columns(num_columns);
+    RETURN_NOT_OK(
+        detail::ParallelInvoke(ctx, num_columns, [&](FunctionContext* task_ctx, int i) {
+          return CombineColumn(task_ctx->memory_pool(), *build.column(i)->data(),
+                               &build_columns[i]);
+        }));
+    const int num_keys = static_cast<int>(build_keys_.size());
+    std::vector<std::shared_ptr<ArrayData>> positions(num_keys);
+    key_matchers_.resize(num_keys);
+    RETURN_NOT_OK(
+        detail::ParallelInvoke(ctx, num_keys, [&](FunctionContext* task_ctx, int k) {
+          Datum encoded;
+          RETURN_NOT_OK(
+              DictionaryEncode(task_ctx, Datum(build_columns[build_keys_[k]]), &encoded));
+          const auto& dict_type = static_cast<const DictionaryType&>(*encoded.type());
+          positions[k] = encoded.array();
+          return GetMatchKernel(task_ctx, Datum(dict_type.dictionary()),
+                                &key_matchers_[k]);
+        }));
+
+    std::shared_ptr<ArrayData> tuples;
+    RETURN_NOT_OK(MakeTuples(ctx, build.num_rows(), positions, &tuples));
+    std::shared_ptr<ArrayData> group_ids;
+    int64_t num_groups;
+    if (num_keys == 1) {
+      const auto& dict_type = static_cast<const DictionaryType&>(*tuples->type);
+      group_ids = tuples;
+      num_groups = dict_type.dictionary()->length();
+    } else {
+      Datum encoded;
+      RETURN_NOT_OK(DictionaryEncode(ctx, Datum(tuples), &encoded));
+      const auto& dict_type = static_cast<const DictionaryType&>(*encoded.type());
+      group_ids = encoded.array();
+      num_groups = dict_type.dictionary()->length();
+      RETURN_NOT_OK(GetMatchKernel(ctx, Datum(dict_type.dictionary()), &group_matcher_));
+    }
+    BucketRows(*group_ids, num_groups);
+
+    auto build_batch =
+        RecordBatch::Make(build.schema(), build.num_rows(), std::move(build_columns));
+    build_payload_ = SelectColumns(
+        *build_batch, PayloadColumns(*build.schema(), build_keys_, !probe_is_left_));
+
+    const std::shared_ptr<Schema> probe_payload =
+        SelectFields(*probe_schema_, probe_columns_);
+    const Schema& left = probe_is_left_ ? *probe_payload : *build_payload_->schema();
+    const Schema& right = probe_is_left_ ? *build_payload_->schema() : *probe_payload;
+    std::vector<std::shared_ptr<Field>> fields = left.fields();
+    if (type_ != JoinType::SEMI) {
+      fields.insert(fields.end(), right.fields().begin(), right.fields().end());
+    }
+    out_schema_ = ::arrow::schema(fields);
+    return Status::OK();
+  }
+
+  Status Probe(FunctionContext* ctx, const RecordBatch& batch,
+               std::shared_ptr<RecordBatch>* out) override {
+    if (!batch.schema()->Equals(*probe_schema_)) {
+      return Status::Invalid("Batch schema differs from the probed schema");
+    }
+    const int64_t length = batch.num_rows();
+    const int num_keys = static_cast<int>(probe_keys_.size());
+    std::vector<std::shared_ptr<ArrayData>> positions(num_keys);
+    for (int k = 0; k < num_keys; ++k) {
+      Datum matched;
+      RETURN_NOT_OK(key_matchers_[k]->Call(
+          ctx, Datum(batch.column_data(probe_keys_[k])), &matched));
+      positions[k] = matched.array();
+    }
+    std::shared_ptr<ArrayData> group_ids;
+    RETURN_NOT_OK(MakeTuples(ctx, length, positions, &group_ids));
+    if (num_keys > 1) {
+      Datum matched;
+      RETURN_NOT_OK(group_matcher_->Call(ctx, Datum(group_ids), &matched));
+      group_ids = matched.array();
+    }
+
+    Int32Builder probe_indices(ctx->memory_pool());
+    Int32Builder build_indices(ctx->memory_pool());
+    RETURN_NOT_OK(probe_indices.Reserve(length));
+    RETURN_NOT_OK(build_indices.Reserve(length));
+    const int32_t* groups = length == 0 ? nullptr : GetValues<int32_t>(*group_ids, 1);
+    std::vector<bool> matched(static_cast<size_t>(length), true);
+    VisitNulls(*group_ids, [&](int64_t i) { matched[i] = false; });
+    for (int64_t i = 0; i < length; ++i) {
+      if (!matched[i]) {
+        if (type_ == JoinType::LEFT) {
+          RETURN_NOT_OK(probe_indices.Append(static_cast<int32_t>(i)));
+          RETURN_NOT_OK(build_indices.AppendNull());
+        }
+        continue;
+      }
+      if (type_ == JoinType::SEMI) {
+        RETURN_NOT_OK(probe_indices.Append(static_cast<int32_t>(i)));
+        continue;
+      }
+      const int32_t group = groups[i];
+      for (int32_t j = bucket_offsets_[group]; j < bucket_offsets_[group + 1]; ++j) {
+        RETURN_NOT_OK(probe_indices.Append(static_cast<int32_t>(i)));
+        RETURN_NOT_OK(build_indices.Append(bucket_rows_[j]));
+      }
+    }
+
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(probe_indices.Finish(&indices));
+    Datum probe_rows;
+    RETURN_NOT_OK(Take(ctx, Datum(SelectColumns(batch, probe_columns_)), Datum(indices),
+                       &probe_rows));
+    if (type_ == JoinType::SEMI) {
+      *out = probe_rows.record_batch();
+      return Status::OK();
+    }
+    RETURN_NOT_OK(build_indices.Finish(&indices));
+    Datum build_rows;
+    RETURN_NOT_OK(Take(ctx, Datum(build_payload_), Datum(indices), &build_rows));
+
+    const RecordBatch& left =
+        probe_is_left_ ? *probe_rows.record_batch() : *build_rows.record_batch();
+    const RecordBatch& right =
+        probe_is_left_ ? *build_rows.record_batch() : *probe_rows.record_batch();
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < left.num_columns(); ++i) {
+      columns.push_back(left.column(i));
+    }
+    for (int i = 0; i < right.num_columns(); ++i) {
+      columns.push_back(right.column(i));
+    }
+    *out = RecordBatch::Make(out_schema_, indices->length(), columns);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> out_schema() const override { return out_schema_; }
+
+ private:
+  // Combine the key positions of each row into a tuple_type_ array, null
+  // where any position is null. A single key is its own tuple
+  Status MakeTuples(FunctionContext* ctx, int64_t length,
+                    const std::vector<std::shared_ptr<ArrayData>>& positions,
+                    std::shared_ptr<ArrayData>* out) {
+    const int64_t num_keys = static_cast<int64_t>(positions.size());
+    if (num_keys == 1) {
+      *out = positions[0];
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> tuples_buffer;
+    RETURN_NOT_OK(ctx->Allocate(length * num_keys * sizeof(int32_t), &tuples_buffer));
+    std::shared_ptr<Buffer> valid_buffer;
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &valid_buffer));
+    auto tuples = reinterpret_cast<int32_t*>(tuples_buffer->mutable_data());
+    uint8_t* valid_bits = valid_buffer->mutable_data();
+    std::memset(valid_bits, 0xFF, static_cast<size_t>(valid_buffer->size()));
+    for (int64_t k = 0; k < num_keys && length > 0; ++k) {
+      const ArrayData& key_positions = *positions[k];
+      const int32_t* values = GetValues<int32_t>(key_positions, 1);
+      for (int64_t i = 0; i < length; ++i) {
+        tuples[i * num_keys + k] = values[i];
+      }
+      VisitNulls(key_positions, [&](int64_t i) {
+        tuples[i * num_keys + k] = 0;
+        BitUtil::ClearBit(valid_bits, i);
+      });
+    }
+    const int64_t null_count = length - CountSetBits(valid_bits, 0, length);
+    *out = ArrayData::Make(tuple_type_, length, {valid_buffer, tuples_buffer},
+                           null_count);
+    return Status::OK();
+  }
+
+  // Sort the build rows by group id, dropping those with null keys
+  void BucketRows(const ArrayData& group_ids, int64_t num_groups) {
+    bucket_offsets_.assign(static_cast<size_t>(num_groups + 1), 0);
+    std::vector<bool> valid(static_cast<size_t>(group_ids.length), true);
+    VisitNulls(group_ids, [&](int64_t i) { valid[i] = false; });
+    const int32_t* groups =
+        group_ids.length == 0 ? nullptr : GetValues<int32_t>(group_ids, 1);
+    for (int64_t i = 0; i < group_ids.length; ++i) {
+      if (valid[i]) {
+        ++bucket_offsets_[groups[i] + 1];
+      }
+    }
+    for (int64_t g = 0; g < num_groups; ++g) {
+      bucket_offsets_[g + 1] += bucket_offsets_[g];
+    }
+    bucket_rows_.resize(static_cast<size_t>(bucket_offsets_[num_groups]));
+    std::vector<int32_t> next(bucket_offsets_.begin(), bucket_offsets_.end() - 1);
+    for (int64_t i = 0; i < group_ids.length; ++i) {
+      if (valid[i]) {
+        bucket_rows_[next[groups[i]]++] = static_cast<int32_t>(i);
+      }
+    }
+  }
+
+  JoinType type_;
+  bool probe_is_left_;
+  std::shared_ptr<Schema> probe_schema_;
+  std::vector<int> probe_keys_;
+  std::vector<int> build_keys_;
+  // The columns of the probed batches in the output
+  std::vector<int> probe_columns_;
+  std::shared_ptr<DataType> tuple_type_;
+  std::shared_ptr<Schema> out_schema_;
+
+  std::vector<std::unique_ptr<HashKernel>> key_matchers_;
+  std::unique_ptr<HashKernel> group_matcher_;
+  // The build rows of group g are bucket_rows_[bucket_offsets_[g]] up to
+  // bucket_rows_[bucket_offsets_[g + 1]], excluded
+  std::vector<int32_t> bucket_offsets_;
+  std::vector<int32_t> bucket_rows_;
+  // The columns of the build side in the output
+  std::shared_ptr<RecordBatch> build_payload_;
+};
+
+Status LookupColumn(const Schema& schema, const std::string& name, int* out) {
+  const int64_t index = schema.GetFieldIndex(name);
+  if (index < 0) {
+    std::stringstream ss;
+    ss << "No column named '" << name << "' to join on";
+    return Status::Invalid(ss.str());
+  }
+  *out = static_cast<int>(index);
+  return Status::OK();
+}
+
+Status MakeHashJoinKernel(FunctionContext* ctx, JoinType type, bool probe_is_left,
+                          const std::shared_ptr<Schema>& probe_schema,
+                          const std::vector<std::string>& probe_key_names,
+                          const Table& build,
+                          const std::vector<std::string>& build_key_names,
+                          std::unique_ptr<HashJoinKernel>* out) {
+  if (probe_key_names.empty()) {
+    return Status::Invalid("Join needs at least one key column");
+  }
+  if (probe_key_names.size() != build_key_names.size()) {
+    return Status::Invalid("Join needs as many left keys as right keys");
+  }
+  const size_t num_keys = probe_key_names.size();
+  std::vector<int> probe_keys(num_keys);
+  std::vector<int> build_keys(num_keys);
+  for (size_t i = 0; i < num_keys; ++i) {
+    RETURN_NOT_OK(LookupColumn(*probe_schema, probe_key_names[i], &probe_keys[i]));
+    RETURN_NOT_OK(LookupColumn(*build.schema(), build_key_names[i], &build_keys[i]));
+    const DataType& probe_type = *probe_schema->field(probe_keys[i])->type();
+    const DataType& build_type = *build.schema()->field(build_keys[i])->type();
+    if (!probe_type.Equals(build_type)) {
+      std::stringstream ss;
+      ss << "Join keys '" << probe_key_names[i] << "' and '" << build_key_names[i]
+         << "' have different types: " << probe_type.ToString() << " and "
+         << build_type.ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+
+  std::unique_ptr<HashJoinKernelImpl> kernel(new HashJoinKernelImpl(
+      type, probe_is_left, probe_schema, probe_keys, build_keys));
+  RETURN_NOT_OK(kernel->Build(ctx, build));
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GetHashJoinKernel(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                         const Table& right, const JoinOptions& options,
+                         std::unique_ptr<HashJoinKernel>* out) {
+  return MakeHashJoinKernel(ctx, options.type, true, left_schema, options.left_keys,
+                            right, options.right_keys, out);
+}
+
+Status HashJoin(FunctionContext* ctx, const Table& left, const Table& right,
+                const JoinOptions& options, std::shared_ptr<Table>* out) {
+  KernelProfileScope profile(ctx, "HashJoin");
+  std::unique_ptr<HashJoinKernel> kernel;
+  const bool build_left =
+      options.type == JoinType::INNER && left.num_rows() < right.num_rows();
+  if (build_left) {
+    RETURN_NOT_OK(MakeHashJoinKernel(ctx, options.type, false, right.schema(),
+                                     options.right_keys, left, options.left_keys,
+                                     &kernel));
+  } else {
+    RETURN_NOT_OK(GetHashJoinKernel(ctx, left.schema(), right, options, &kernel));
+  }
+
+  TableBatchReader reader(build_left ? right : left);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    std::shared_ptr<RecordBatch> joined;
+    RETURN_NOT_OK(kernel->Probe(ctx, *batch, &joined));
+    batches.push_back(joined);
+  }
+  return Table::FromRecordBatches(kernel->out_schema(), batches, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_JOIN_H
+#define ARROW_COMPUTE_KERNELS_JOIN_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+enum class JoinType {
+  /// One output row for each pair of matching left and right rows
+  INNER,
+  /// Like INNER, plus one row for each left row without a match, whose right
+  /// columns are null
+  LEFT,
+  /// One output row for each left row having a match, with the left columns
+  /// only
+  SEMI
+};
+
+struct ARROW_EXPORT JoinOptions {
+  JoinOptions() : type(JoinType::INNER) {}
+
+  JoinType type;
+  /// Names of the left columns to match with the right columns of the same
+  /// position in right_keys, which must have the same types
+  std::vector<std::string> left_keys;
+  std::vector<std::string> right_keys;
+};
+
+/// \class HashJoinKernel
+/// \brief Hash join streaming the left input by record batches
+///
+/// The right input (the build side) is hashed up front: each of its key
+/// columns is dictionary-encoded, in parallel partitions if the context allows
+/// several threads, then the rows are bucketed by their combination of key
+/// indices. Each left batch (the probe side) is then looked up in the key
+/// dictionaries, and the output gathered with Take from the indices of the
+/// matching rows.
+///
+/// Null keys never match. The output columns are the left columns followed,
+/// except for SEMI joins, by the right columns that are not keys. The output
+/// rows are in left row order, the matches of a left row in right row order.
+class ARROW_EXPORT HashJoinKernel {
+ public:
+  virtual ~HashJoinKernel() = default;
+
+  /// \brief Join a left batch, with the schema the kernel was created for
+  virtual Status Probe(FunctionContext* ctx, const RecordBatch& batch,
+                       std::shared_ptr<RecordBatch>* out) = 0;
+
+  virtual std::shared_ptr<Schema> out_schema() const = 0;
+};
+
+/// \param[in] ctx the FunctionContext
+/// \param[in] left_schema schema of the batches to probe
+/// \param[in] right input to build the hash table from
+/// \param[in] options join type and keys
+/// \param[out] kernel the kernel, referencing the right input
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetHashJoinKernel(FunctionContext* ctx, const std::shared_ptr<Schema>& left_schema,
+                         const Table& right, const JoinOptions& options,
+                         std::unique_ptr<HashJoinKernel>* kernel);
+
+/// \brief Join two tables on equal keys
+///
+/// The hash table is built from the smaller input for INNER joins, and from
+/// the right input otherwise, see HashJoinKernel. When it is built from the
+/// left input, the output rows are in right row order instead.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left left input
+/// \param[in] right right input
+/// \param[in] options join type and keys
+/// \param[out] out the joined table, with one chunk per probed batch
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* context, const Table& left, const Table& right,
+                const JoinOptions& options, std::shared_ptr<Table>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_JOIN_H
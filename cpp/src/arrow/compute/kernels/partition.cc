@@ -0,0 +1,382 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/partition.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Mixed into the hash of a row for values without bytes to hash
+constexpr uint32_t kNullHash = 0;
+constexpr uint32_t kFalseHash = 1;
+constexpr uint32_t kTrueHash = 2;
+constexpr uint32_t kEmptyHash = 3;
+
+// The size of the staging area of a partition when scattering values
+constexpr int64_t kCacheLineSize = 64;
+
+// The width in bytes of the values of a type, or -1 if they are not stored
+// as fixed-width values of whole bytes
+int ByteWidth(const DataType& type) {
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == nullptr || type.id() == Type::BOOL) {
+    return -1;
+  }
+  return fixed_width->bit_width() / 8;
+}
+
+// ----------------------------------------------------------------------
+// Hashing
+
+// Update the hash of each row with hash_value(i, hash) for the valid values
+// of data, and kNullHash for the nulls
+template <typename HashValue>
+void HashValues(const ArrayData& data, uint32_t* hashes, HashValue&& hash_value) {
+  if (data.length == 0) {
+    return;
+  }
+  if (!HasValidityBitmap(data)) {
+    for (int64_t i = 0; i < data.length; ++i) {
+      hashes[i] = hash_value(i, hashes[i]);
+    }
+    return;
+  }
+  internal::BitmapReader valid_reader(data.buffers[0]->data(), data.offset, data.length);
+  for (int64_t i = 0; i < data.length; ++i) {
+    hashes[i] = valid_reader.IsSet() ? hash_value(i, hashes[i])
+                                     : HashUtil::HashCombine32(kNullHash, hashes[i]);
+    valid_reader.Next();
+  }
+}
+
+Status HashColumn(const ArrayData& data, uint32_t* hashes) {
+  const DataType& type = *data.type;
+  if (type.id() == Type::NA) {
+    for (int64_t i = 0; i < data.length; ++i) {
+      hashes[i] = HashUtil::HashCombine32(kNullHash, hashes[i]);
+    }
+  } else if (type.id() == Type::BOOL) {
+    const uint8_t* bits = data.buffers[1]->data();
+    HashValues(data, hashes, [&](int64_t i, uint32_t hash) {
+      const bool value = BitUtil::GetBit(bits, data.offset + i);
+      return HashUtil::HashCombine32(value ? kTrueHash : kFalseHash, hash);
+    });
+  } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    const int32_t* offsets = GetValues<int32_t>(data, 1);
+    const uint8_t* bytes = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+    HashValues(data, hashes, [&](int64_t i, uint32_t hash) {
+      const int32_t length = offsets[i + 1] - offsets[i];
+      return length == 0 ? HashUtil::HashCombine32(kEmptyHash, hash)
+                         : HashUtil::Hash(bytes + offsets[i], length, hash);
+    });
+  } else if (ByteWidth(type) > 0) {
+    // Dictionary-encoded values are hashed by their indices
+    const int byte_width = ByteWidth(type);
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+    HashValues(data, hashes, [&](int64_t i, uint32_t hash) {
+      return HashUtil::Hash(values + i * byte_width, byte_width, hash);
+    });
+  } else {
+    return Status::NotImplemented("Hashing rows with keys of type " + type.ToString());
+  }
+  return Status::OK();
+}
+
+Status LookupColumn(const Schema& schema, const std::string& name, int* out) {
+  const int64_t index = schema.GetFieldIndex(name);
+  if (index < 0) {
+    std::stringstream ss;
+    ss << "No column named '" << name << "' to hash";
+    return Status::Invalid(ss.str());
+  }
+  *out = static_cast<int>(index);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Scattering
+
+// The rows of each partition are laid out one partition after another, the
+// rows of partition p starting at offsets[p]. Each scatter function walks the
+// rows in order, keeping a cursor per partition on the next output position.
+
+// Scatter values of width bytes through a cache line of staging per
+// partition, flushed to the output when full. width is either an int or an
+// std::integral_constant, so that the common widths get copies of constant
+// size.
+template <typename Width>
+void ScatterFixedWidth(const uint8_t* values, int64_t length, const int32_t* ids,
+                       const std::vector<int64_t>& offsets, Width width, uint8_t* out) {
+  const int64_t byte_width = width;
+  const int num_partitions = static_cast<int>(offsets.size()) - 1;
+  std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+  if (byte_width > kCacheLineSize / 2) {
+    // Staging would not save any write
+    for (int64_t i = 0; i < length; ++i) {
+      std::memcpy(out + cursors[ids[i]]++ * byte_width, values + i * byte_width,
+                  byte_width);
+    }
+    return;
+  }
+
+  const int64_t slots = kCacheLineSize / byte_width;
+  const int64_t line_size = slots * byte_width;
+  std::vector<uint8_t> staging(static_cast<size_t>(num_partitions * line_size));
+  std::vector<int64_t> fill(num_partitions, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    const int32_t p = ids[i];
+    uint8_t* line = staging.data() + p * line_size;
+    std::memcpy(line + fill[p] * byte_width, values + i * byte_width, byte_width);
+    if (++fill[p] == slots) {
+      std::memcpy(out + cursors[p] * byte_width, line, line_size);
+      cursors[p] += slots;
+      fill[p] = 0;
+    }
+  }
+  for (int p = 0; p < num_partitions; ++p) {
+    std::memcpy(out + cursors[p] * byte_width, staging.data() + p * line_size,
+                fill[p] * byte_width);
+  }
+}
+
+// Scatter the bits of a bitmap into a zeroed bitmap
+void ScatterBits(const uint8_t* bits, int64_t offset, int64_t length, const int32_t* ids,
+                 const std::vector<int64_t>& offsets, uint8_t* out) {
+  std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+  internal::BitmapReader reader(bits, offset, length);
+  for (int64_t i = 0; i < length; ++i) {
+    const int64_t position = cursors[ids[i]]++;
+    if (reader.IsSet()) {
+      BitUtil::SetBit(out, position);
+    }
+    reader.Next();
+  }
+}
+
+class Scatter {
+ public:
+  Scatter(FunctionContext* ctx, const std::vector<int32_t>& ids,
+          const std::vector<int64_t>& offsets)
+      : ctx_(ctx), ids_(ids), offsets_(offsets) {}
+
+  Status Column(const Array& column, std::shared_ptr<Array>* out) {
+    const ArrayData& data = *column.data();
+    const int64_t length = data.length;
+    const int64_t null_count = column.null_count();
+    auto result = std::make_shared<ArrayData>(data.type, length, null_count);
+    result->buffers.resize(data.buffers.size());
+
+    const DataType& type = *data.type;
+    if (type.id() == Type::NA) {
+      *out = MakeArray(result);
+      return Status::OK();
+    }
+    const int byte_width = ByteWidth(type);
+    if (type.id() != Type::BOOL && type.id() != Type::BINARY &&
+        type.id() != Type::STRING && byte_width <= 0) {
+      return Status::NotImplemented("Partitioning columns of type " + type.ToString());
+    }
+
+    if (null_count > 0) {
+      RETURN_NOT_OK(ScatterBitmap(data.buffers[0]->data(), data.offset, length,
+                                  &result->buffers[0]));
+    }
+    if (type.id() == Type::BOOL) {
+      RETURN_NOT_OK(ScatterBitmap(data.buffers[1]->data(), data.offset, length,
+                                  &result->buffers[1]));
+    } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+      RETURN_NOT_OK(ScatterBinary(data, result.get()));
+    } else {
+      RETURN_NOT_OK(ctx_->Allocate(length * byte_width, &result->buffers[1]));
+      const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+      uint8_t* out_values = result->buffers[1]->mutable_data();
+      switch (byte_width) {
+        case 1:
+          ScatterFixedWidth(values, length, ids_.data(), offsets_,
+                            std::integral_constant<int, 1>(), out_values);
+          break;
+        case 2:
+          ScatterFixedWidth(values, length, ids_.data(), offsets_,
+                            std::integral_constant<int, 2>(), out_values);
+          break;
+        case 4:
+          ScatterFixedWidth(values, length, ids_.data(), offsets_,
+                            std::integral_constant<int, 4>(), out_values);
+          break;
+        case 8:
+          ScatterFixedWidth(values, length, ids_.data(), offsets_,
+                            std::integral_constant<int, 8>(), out_values);
+          break;
+        case 16:
+          ScatterFixedWidth(values, length, ids_.data(), offsets_,
+                            std::integral_constant<int, 16>(), out_values);
+          break;
+        default:
+          ScatterFixedWidth(values, length, ids_.data(), offsets_, byte_width,
+                            out_values);
+          break;
+      }
+    }
+    *out = MakeArray(result);
+    return Status::OK();
+  }
+
+ private:
+  Status ScatterBitmap(const uint8_t* bits, int64_t offset, int64_t length,
+                       std::shared_ptr<Buffer>* out) {
+    const int64_t nbytes = BitUtil::BytesForBits(length);
+    RETURN_NOT_OK(ctx_->Allocate(nbytes, out));
+    uint8_t* out_bits = (*out)->mutable_data();
+    std::memset(out_bits, 0, static_cast<size_t>(nbytes));
+    if (length > 0) {
+      ScatterBits(bits, offset, length, ids_.data(), offsets_, out_bits);
+    }
+    return Status::OK();
+  }
+
+  // The bytes of a partition start where those of the previous partition end,
+  // so that the output offsets increase across partitions
+  Status ScatterBinary(const ArrayData& data, ArrayData* result) {
+    const int64_t length = data.length;
+    const int num_partitions = static_cast<int>(offsets_.size()) - 1;
+    const int32_t* offsets = GetValues<int32_t>(data, 1);
+    const uint8_t* bytes = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+
+    std::vector<int64_t> byte_cursors(num_partitions + 1, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      byte_cursors[ids_[i] + 1] += offsets[i + 1] - offsets[i];
+    }
+    for (int p = 0; p < num_partitions; ++p) {
+      byte_cursors[p + 1] += byte_cursors[p];
+    }
+    const int64_t total_bytes = byte_cursors[num_partitions];
+
+    RETURN_NOT_OK(ctx_->Allocate((length + 1) * sizeof(int32_t), &result->buffers[1]));
+    RETURN_NOT_OK(ctx_->Allocate(total_bytes, &result->buffers[2]));
+    auto out_offsets = reinterpret_cast<int32_t*>(result->buffers[1]->mutable_data());
+    uint8_t* out_bytes = result->buffers[2]->mutable_data();
+    std::vector<int64_t> cursors(offsets_.begin(), offsets_.end() - 1);
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t p = ids_[i];
+      const int32_t value_length = offsets[i + 1] - offsets[i];
+      out_offsets[cursors[p]++] = static_cast<int32_t>(byte_cursors[p]);
+      if (value_length > 0) {
+        std::memcpy(out_bytes + byte_cursors[p], bytes + offsets[i], value_length);
+        byte_cursors[p] += value_length;
+      }
+    }
+    out_offsets[length] = static_cast<int32_t>(total_bytes);
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  const std::vector<int32_t>& ids_;
+  const std::vector<int64_t>& offsets_;
+};
+
+}  // namespace
+
+Status HashRows(FunctionContext* ctx, const RecordBatch& batch,
+                const std::vector<std::string>& keys, std::vector<uint32_t>* out) {
+  if (keys.empty()) {
+    return Status::Invalid("Hashing rows needs at least one key column");
+  }
+  std::vector<int> key_indices(keys.size());
+  for (size_t k = 0; k < keys.size(); ++k) {
+    RETURN_NOT_OK(LookupColumn(*batch.schema(), keys[k], &key_indices[k]));
+  }
+  out->assign(static_cast<size_t>(batch.num_rows()), 0);
+  for (int index : key_indices) {
+    RETURN_NOT_OK(HashColumn(*batch.column(index)->data(), out->data()));
+  }
+  return Status::OK();
+}
+
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<std::string>& keys, int num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out) {
+  KernelProfileScope profile(ctx, "HashPartition");
+  if (num_partitions < 1) {
+    return Status::Invalid("The number of partitions must be positive");
+  }
+  std::vector<uint32_t> hashes;
+  RETURN_NOT_OK(HashRows(ctx, batch, keys, &hashes));
+  if (num_partitions == 1) {
+    *out = {batch.Slice(0)};
+    return Status::OK();
+  }
+
+  // Partition ids are the high bits of hash * num_partitions, whose histogram
+  // gives the first row of each partition
+  const int64_t num_rows = batch.num_rows();
+  std::vector<int32_t> ids(static_cast<size_t>(num_rows));
+  std::vector<int64_t> offsets(num_partitions + 1, 0);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    ids[i] = static_cast<int32_t>((static_cast<uint64_t>(hashes[i]) * num_partitions) >>
+                                  32);
+    ++offsets[ids[i] + 1];
+  }
+  for (int p = 0; p < num_partitions; ++p) {
+    offsets[p + 1] += offsets[p];
+  }
+
+  const int num_columns = batch.num_columns();
+  std::vector<std::shared_ptr<Array>> columns(num_columns);
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_columns, [&](FunctionContext* task_ctx, int i) {
+        Scatter scatter(task_ctx, ids, offsets);
+        return scatter.Column(*batch.column(i), &columns[i]);
+      }));
+
+  out->clear();
+  for (int p = 0; p < num_partitions; ++p) {
+    const int64_t offset = offsets[p];
+    const int64_t length = offsets[p + 1] - offset;
+    std::vector<std::shared_ptr<Array>> slices;
+    for (const auto& column : columns) {
+      slices.push_back(column->Slice(offset, length));
+    }
+    out->push_back(RecordBatch::Make(batch.schema(), length, slices));
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_PARTITION_H
+#define ARROW_COMPUTE_KERNELS_PARTITION_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Compute a 32-bit hash of the keys of each row of a record batch
+///
+/// The key values are hashed with HashUtil::Hash, a key being seeded with the
+/// hash of the previous keys of the row, so that equal key tuples have equal
+/// hashes. Nulls, booleans and empty strings are mixed in with
+/// HashUtil::HashCombine32. Dictionary-encoded keys are hashed by their
+/// indices, so that their hashes only agree within a dictionary.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the rows to hash
+/// \param[in] keys names of the key columns, which must be of fixed width,
+/// binary or string types
+/// \param[out] out the hashes, one per row
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashRows(FunctionContext* ctx, const RecordBatch& batch,
+                const std::vector<std::string>& keys, std::vector<uint32_t>* out);
+
+/// \brief Split a record batch into partitions by a hash of its keys
+///
+/// The rows are hashed with HashRows, and each hash mapped to a partition by
+/// a multiply-shift, which needs no division. A histogram of the partition
+/// sizes gives the position of each row in the output, then every column is
+/// scattered there in a single pass, rather than filtering it once per
+/// partition. Fixed-width values are staged in a cache line per partition
+/// (software write-combining) so that the output is written a line at a
+/// time. The partitions are slices of a single array per column.
+///
+/// Rows with equal keys always land in the same partition, in input order.
+///
+/// \param[in] ctx the FunctionContext, whose threads scatter the columns
+/// \param[in] batch the rows to partition, whose columns must be of fixed width,
+/// binary or string types
+/// \param[in] keys names of the key columns, as in HashRows
+/// \param[in] num_partitions the number of partitions, at least 1
+/// \param[out] out a record batch per partition, possibly empty
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<std::string>& keys, int num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_PARTITION_H
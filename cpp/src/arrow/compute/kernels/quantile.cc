@@ -0,0 +1,272 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/quantile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+constexpr int kMinSketchK = 8;
+
+// The ratio of the capacities of consecutive levels
+constexpr double kLevelCapacityRatio = 2.0 / 3.0;
+
+template <typename T>
+void UpdateSketch(const ArrayData& data, QuantileSketch* sketch) {
+  if (data.length == 0) {
+    return;
+  }
+  const T* values = GetValues<T>(data, 1);
+  VisitValidRuns(data, [&](int64_t position, int64_t length) {
+    for (int64_t i = position; i < position + length; ++i) {
+      sketch->Update(static_cast<double>(values[i]));
+    }
+  });
+}
+
+Status UpdateSketch(const ArrayData& data, QuantileSketch* sketch) {
+#define UPDATE_SKETCH_CASE(ArrowType)                                \
+  case ArrowType::type_id:                                           \
+    UpdateSketch<typename ArrowType::c_type>(data, sketch);          \
+    return Status::OK();
+
+  switch (data.type->id()) {
+    UPDATE_SKETCH_CASE(UInt8Type);
+    UPDATE_SKETCH_CASE(Int8Type);
+    UPDATE_SKETCH_CASE(UInt16Type);
+    UPDATE_SKETCH_CASE(Int16Type);
+    UPDATE_SKETCH_CASE(UInt32Type);
+    UPDATE_SKETCH_CASE(Int32Type);
+    UPDATE_SKETCH_CASE(UInt64Type);
+    UPDATE_SKETCH_CASE(Int64Type);
+    UPDATE_SKETCH_CASE(FloatType);
+    UPDATE_SKETCH_CASE(DoubleType);
+    default:
+      break;
+  }
+
+#undef UPDATE_SKETCH_CASE
+
+  std::stringstream ss;
+  ss << "Quantiles not implemented for " << data.type->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+std::vector<std::shared_ptr<ArrayData>> GetChunks(const Datum& values) {
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.array());
+  } else {
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  }
+  return chunks;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// QuantileSketch
+
+QuantileSketch::QuantileSketch(int k)
+    : k_(std::max(k, kMinSketchK)),
+      count_(0),
+      num_retained_(0),
+      max_retained_(0),
+      random_state_(0x9e3779b97f4a7c15ULL) {
+  Grow();
+}
+
+int64_t QuantileSketch::LevelCapacity(size_t level) const {
+  const int depth = static_cast<int>(levels_.size() - level) - 1;
+  return static_cast<int64_t>(std::ceil(k_ * std::pow(kLevelCapacityRatio, depth))) + 1;
+}
+
+void QuantileSketch::Grow() {
+  levels_.emplace_back();
+  max_retained_ = 0;
+  for (size_t level = 0; level < levels_.size(); ++level) {
+    max_retained_ += LevelCapacity(level);
+  }
+}
+
+// Promote half the values of a level, the odd one out staying behind
+void QuantileSketch::Compact(size_t level) {
+  random_state_ ^= random_state_ << 13;
+  random_state_ ^= random_state_ >> 7;
+  random_state_ ^= random_state_ << 17;
+  const size_t offset = static_cast<size_t>(random_state_ >> 63);
+
+  std::vector<double>& values = levels_[level];
+  std::sort(values.begin(), values.end());
+  const size_t num_pairs = values.size() / 2;
+  std::vector<double>& next = levels_[level + 1];
+  for (size_t i = 0; i < num_pairs; ++i) {
+    next.push_back(values[2 * i + offset]);
+  }
+  if (values.size() % 2 == 1) {
+    values[0] = values.back();
+    values.resize(1);
+  } else {
+    values.clear();
+  }
+  num_retained_ -= static_cast<int64_t>(num_pairs);
+}
+
+// Compact the lowest levels over capacity until the sketch has room again
+void QuantileSketch::Compress() {
+  for (size_t level = 0; level < levels_.size(); ++level) {
+    if (static_cast<int64_t>(levels_[level].size()) >= LevelCapacity(level)) {
+      if (level + 1 == levels_.size()) {
+        Grow();
+      }
+      Compact(level);
+      if (num_retained_ < max_retained_) {
+        break;
+      }
+    }
+  }
+}
+
+void QuantileSketch::Update(double value) {
+  if (std::isnan(value)) {
+    return;
+  }
+  levels_[0].push_back(value);
+  ++count_;
+  if (++num_retained_ >= max_retained_) {
+    Compress();
+  }
+}
+
+Status QuantileSketch::Update(const Datum& values) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("QuantileSketch expects an array or a chunked array");
+  }
+  for (const auto& chunk : GetChunks(values)) {
+    RETURN_NOT_OK(UpdateSketch(*chunk, this));
+  }
+  return Status::OK();
+}
+
+void QuantileSketch::Merge(const QuantileSketch& other) {
+  while (levels_.size() < other.levels_.size()) {
+    Grow();
+  }
+  for (size_t level = 0; level < other.levels_.size(); ++level) {
+    levels_[level].insert(levels_[level].end(), other.levels_[level].begin(),
+                          other.levels_[level].end());
+  }
+  count_ += other.count_;
+  num_retained_ += other.num_retained_;
+  while (num_retained_ >= max_retained_) {
+    Compress();
+  }
+}
+
+double QuantileSketch::Quantile(double q) const {
+  if (count_ == 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // The retained values in order, with the number of values they stand for
+  std::vector<std::pair<double, int64_t>> weighted;
+  weighted.reserve(static_cast<size_t>(num_retained_));
+  int64_t total_weight = 0;
+  for (size_t level = 0; level < levels_.size(); ++level) {
+    const int64_t weight = static_cast<int64_t>(1) << level;
+    for (double value : levels_[level]) {
+      weighted.emplace_back(value, weight);
+    }
+    total_weight += weight * static_cast<int64_t>(levels_[level].size());
+  }
+  std::sort(weighted.begin(), weighted.end());
+
+  const double rank = std::min(std::max(q, 0.0), 1.0) * static_cast<double>(total_weight);
+  int64_t cumulative = 0;
+  for (const auto& entry : weighted) {
+    cumulative += entry.second;
+    if (static_cast<double>(cumulative) >= rank) {
+      return entry.first;
+    }
+  }
+  return weighted.back().first;
+}
+
+// ----------------------------------------------------------------------
+// Kernel
+
+Status ApproximateQuantiles(FunctionContext* ctx, const Datum& values,
+                            const std::vector<double>& quantiles, Datum* out) {
+  KernelProfileScope profile(ctx, "ApproximateQuantiles");
+  if (!values.is_arraylike()) {
+    return Status::Invalid("ApproximateQuantiles expects an array or a chunked array");
+  }
+  for (double q : quantiles) {
+    if (!(q >= 0.0 && q <= 1.0)) {
+      return Status::Invalid("Quantiles must be between 0 and 1");
+    }
+  }
+
+  const std::vector<std::shared_ptr<ArrayData>> chunks = GetChunks(values);
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<QuantileSketch> sketches(num_chunks);
+  RETURN_NOT_OK(
+      detail::ParallelInvoke(ctx, num_chunks, [&](FunctionContext*, int i) {
+        return UpdateSketch(*chunks[i], &sketches[i]);
+      }));
+  QuantileSketch sketch;
+  for (const QuantileSketch& chunk_sketch : sketches) {
+    sketch.Merge(chunk_sketch);
+  }
+
+  DoubleBuilder builder(ctx->memory_pool());
+  for (double q : quantiles) {
+    RETURN_NOT_OK(sketch.count() == 0 ? builder.AppendNull()
+                                      : builder.Append(sketch.Quantile(q)));
+  }
+  std::shared_ptr<Array> result;
+  RETURN_NOT_OK(builder.Finish(&result));
+  *out = Datum(result->data());
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_QUANTILE_H
+#define ARROW_COMPUTE_KERNELS_QUANTILE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \class QuantileSketch
+/// \brief Streaming approximation of the quantiles of numeric values
+///
+/// A KLL sketch (Karnin, Lang and Liberty, "Optimal Quantile Approximation in
+/// Streams"): values are added to a buffer of level 0, and a level holding
+/// too many values is compacted by sorting it and promoting every other
+/// value, chosen from a random offset, to the next level, where it stands
+/// for twice as many values. The capacities of the levels shrink
+/// geometrically from the top level down, so that about 3k values are
+/// retained whatever the number of values added.
+///
+/// Ranks are approximated within about 1.7% of the number of values for the
+/// default k of 200, with high probability; the error is inversely
+/// proportional to k. Sketches built over separate parts of the input, e.g.
+/// by different threads, are merged with the same guarantee.
+class ARROW_EXPORT QuantileSketch {
+ public:
+  /// \param[in] k the capacity of the top level, raised to 8 if smaller
+  explicit QuantileSketch(int k = 200);
+
+  /// \brief Add a value, unless it is NaN
+  void Update(double value);
+
+  /// \brief Add the non-null values of a numeric array-like input, such as
+  /// the column of a record batch
+  Status Update(const Datum& values);
+
+  /// \brief Add the values summarized by another sketch
+  void Merge(const QuantileSketch& other);
+
+  /// \brief Approximate the q-quantile, the value of rank q * count()
+  ///
+  /// \param[in] q the quantile, clamped to [0, 1]
+  /// \return a value added to the sketch, NaN if there is none
+  double Quantile(double q) const;
+
+  /// \return the number of values added
+  int64_t count() const { return count_; }
+
+  /// \return the number of values retained by the sketch
+  int64_t num_retained() const { return num_retained_; }
+
+ private:
+  int64_t LevelCapacity(size_t level) const;
+  void Grow();
+  void Compact(size_t level);
+  void Compress();
+
+  int k_;
+  int64_t count_;
+  int64_t num_retained_;
+  // The sum of the capacities of the levels, which once reached triggers
+  // a compaction
+  int64_t max_retained_;
+  // The values of level h stand for 2^h values each
+  std::vector<std::vector<double>> levels_;
+  // The state of the xorshift generator choosing the compaction offsets
+  uint64_t random_state_;
+};
+
+/// \brief Approximate quantiles of the non-null values of a numeric input
+///
+/// A QuantileSketch is built over each chunk of a ChunkedArray in parallel,
+/// using up to context->num_threads() threads, then the sketches are merged.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values numeric array-like input
+/// \param[in] quantiles the quantiles to approximate, between 0 and 1
+/// \param[out] out double array of the quantiles, null if there is no value
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproximateQuantiles(FunctionContext* context, const Datum& values,
+                            const std::vector<double>& quantiles, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_QUANTILE_H
@@ -0,0 +1,791 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string-view-util.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Radix sort keys: unsigned integers ordered like the values they map
+
+template <typename T, typename Enable = void>
+struct SortKey {};
+
+template <typename T>
+struct SortKey<T, typename std::enable_if<std::is_integral<T>::value &&
+                                          std::is_unsigned<T>::value>::type> {
+  using type = T;
+
+  static type Make(T value) { return value; }
+};
+
+template <typename T>
+struct SortKey<T, typename std::enable_if<std::is_integral<T>::value &&
+                                          std::is_signed<T>::value>::type> {
+  using type = typename std::make_unsigned<T>::type;
+
+  // Flipping the sign bit orders negative values before positive ones
+  static type Make(T value) {
+    return static_cast<type>(static_cast<type>(value) ^
+                             (type(1) << (sizeof(T) * 8 - 1)));
+  }
+};
+
+template <typename T>
+struct SortKey<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  using type = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+
+  // Negative values have all their bits flipped, so that larger magnitudes
+  // come first, and positive values their sign bit. NaNs come last, and
+  // negative zero is equal to zero
+  static type Make(T value) {
+    if (std::isnan(value)) {
+      return std::numeric_limits<type>::max();
+    }
+    if (value == 0) {
+      value = 0;
+    }
+    type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    const type sign_bit = type(1) << (sizeof(T) * 8 - 1);
+    return (bits & sign_bit) ? static_cast<type>(~bits) : (bits | sign_bit);
+  }
+};
+
+constexpr int kRadixBits = 8;
+constexpr int kRadixSize = 1 << kRadixBits;
+
+// Stable least significant digit radix sort of indices by keys, one byte of
+// the keys at a time. Bytes shared by all keys are skipped
+template <typename Key>
+void RadixSort(std::vector<Key>* keys, std::vector<uint64_t>* indices) {
+  constexpr int kNumDigits = sizeof(Key);
+  const int64_t length = static_cast<int64_t>(keys->size());
+  if (length <= 1) {
+    return;
+  }
+
+  // The histograms of all digits are computed in a single pass
+  std::vector<int64_t> counts(kNumDigits * kRadixSize, 0);
+  for (const Key key : *keys) {
+    for (int digit = 0; digit < kNumDigits; ++digit) {
+      ++counts[digit * kRadixSize + ((key >> (digit * kRadixBits)) & (kRadixSize - 1))];
+    }
+  }
+
+  std::vector<Key> key_scratch(length);
+  std::vector<uint64_t> index_scratch(length);
+  for (int digit = 0; digit < kNumDigits; ++digit) {
+    const int shift = digit * kRadixBits;
+    int64_t* offsets = counts.data() + digit * kRadixSize;
+    if (offsets[((*keys)[0] >> shift) & (kRadixSize - 1)] == length) {
+      continue;
+    }
+    int64_t offset = 0;
+    for (int bucket = 0; bucket < kRadixSize; ++bucket) {
+      const int64_t count = offsets[bucket];
+      offsets[bucket] = offset;
+      offset += count;
+    }
+
+    const Key* in_keys = keys->data();
+    const uint64_t* in_indices = indices->data();
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t position = offsets[(in_keys[i] >> shift) & (kRadixSize - 1)]++;
+      key_scratch[position] = in_keys[i];
+      index_scratch[position] = in_indices[i];
+    }
+    keys->swap(key_scratch);
+    indices->swap(index_scratch);
+  }
+}
+
+// ----------------------------------------------------------------------
+// Sorting of the valid values
+
+// Split the positions of values into those of valid values and those of
+// nulls, each in increasing order
+void PartitionNulls(const ArrayData& values, std::vector<uint64_t>* valid,
+                    std::vector<uint64_t>* nulls) {
+  if (!HasValidityBitmap(values)) {
+    valid->resize(values.length);
+    for (int64_t i = 0; i < values.length; ++i) {
+      (*valid)[i] = static_cast<uint64_t>(i);
+    }
+    return;
+  }
+  internal::BitmapReader reader(values.buffers[0]->data(), values.offset, values.length);
+  for (int64_t i = 0; i < values.length; ++i) {
+    if (reader.IsSet()) {
+      valid->push_back(static_cast<uint64_t>(i));
+    } else {
+      nulls->push_back(static_cast<uint64_t>(i));
+    }
+    reader.Next();
+  }
+}
+
+template <typename CType>
+void SortNumeric(const ArrayData& values, std::vector<uint64_t>* indices) {
+  using Key = typename SortKey<CType>::type;
+  if (indices->empty()) {
+    return;
+  }
+  const CType* data = GetValues<CType>(values, 1);
+  std::vector<Key> keys(indices->size());
+  for (size_t i = 0; i < indices->size(); ++i) {
+    keys[i] = SortKey<CType>::Make(data[(*indices)[i]]);
+  }
+  RadixSort(&keys, indices);
+}
+
+// Big-endian key of the first 8 bytes of a string, zero padded
+uint64_t MakePrefixKey(const uint8_t* data, int32_t length) {
+  uint64_t key = 0;
+  const int32_t prefix_length = std::min<int32_t>(length, 8);
+  for (int32_t i = 0; i < prefix_length; ++i) {
+    key |= static_cast<uint64_t>(data[i]) << (8 * (7 - i));
+  }
+  return key;
+}
+
+void SortBinary(const ArrayData& values, std::vector<uint64_t>* indices) {
+  if (indices->empty()) {
+    return;
+  }
+  const int32_t* offsets = GetValues<int32_t>(values, 1);
+  const uint8_t* data = values.buffers[2] ? values.buffers[2]->data() : nullptr;
+
+  std::vector<uint64_t> keys(indices->size());
+  for (size_t i = 0; i < indices->size(); ++i) {
+    const uint64_t index = (*indices)[i];
+    keys[i] = MakePrefixKey(data + offsets[index], offsets[index + 1] - offsets[index]);
+  }
+  RadixSort(&keys, indices);
+
+  // Strings with equal prefix keys are either both longer than 8 bytes, and
+  // then compared from their 9th byte, or the shorter one is a prefix of the
+  // other, padding bytes of the key matching actual zero bytes
+  auto less = [&](uint64_t left, uint64_t right) {
+    const int32_t left_length = offsets[left + 1] - offsets[left];
+    const int32_t right_length = offsets[right + 1] - offsets[right];
+    if (left_length <= 8 || right_length <= 8) {
+      return left_length < right_length;
+    }
+    const int cmp = std::memcmp(data + offsets[left] + 8, data + offsets[right] + 8,
+                                std::min(left_length, right_length) - 8);
+    return cmp != 0 ? cmp < 0 : left_length < right_length;
+  };
+  const size_t length = keys.size();
+  size_t run_start = 0;
+  for (size_t i = 1; i <= length; ++i) {
+    if (i == length || keys[i] != keys[run_start]) {
+      if (i - run_start > 1) {
+        std::stable_sort(indices->begin() + run_start, indices->begin() + i, less);
+      }
+      run_start = i;
+    }
+  }
+}
+
+// The keys are the prefixes held by the entries, so that only strings with
+// equal prefixes are compared past them
+void SortStringView(const ArrayData& values, std::vector<uint64_t>* indices) {
+  if (indices->empty()) {
+    return;
+  }
+  const StringViewEntry* views = GetValues<StringViewEntry>(values, 1);
+  std::vector<const uint8_t*> data_buffers;
+  for (size_t i = 2; i < values.buffers.size(); ++i) {
+    data_buffers.push_back(values.buffers[i] ? values.buffers[i]->data() : nullptr);
+  }
+
+  std::vector<uint32_t> keys(indices->size());
+  for (size_t i = 0; i < indices->size(); ++i) {
+    const StringViewEntry& view = views[(*indices)[i]];
+    const int32_t prefix_length = std::min(view.size, StringViewEntry::kPrefixSize);
+    keys[i] = static_cast<uint32_t>(MakePrefixKey(view.inlined, prefix_length) >> 32);
+  }
+  RadixSort(&keys, indices);
+
+  auto less = [&](uint64_t left, uint64_t right) {
+    return internal::StringViewCompare(views[left], data_buffers.data(), views[right],
+                                       data_buffers.data()) < 0;
+  };
+  const size_t length = keys.size();
+  size_t run_start = 0;
+  for (size_t i = 1; i <= length; ++i) {
+    if (i == length || keys[i] != keys[run_start]) {
+      if (i - run_start > 1) {
+        std::stable_sort(indices->begin() + run_start, indices->begin() + i, less);
+      }
+      run_start = i;
+    }
+  }
+}
+
+Status SortValid(const ArrayData& values, std::vector<uint64_t>* indices) {
+#define SORT_NUMERIC_CASE(ArrowType)                          \
+  case ArrowType::type_id:                                    \
+    SortNumeric<typename ArrowType::c_type>(values, indices); \
+    return Status::OK();
+
+  switch (values.type->id()) {
+    SORT_NUMERIC_CASE(UInt8Type);
+    SORT_NUMERIC_CASE(Int8Type);
+    SORT_NUMERIC_CASE(UInt16Type);
+    SORT_NUMERIC_CASE(Int16Type);
+    SORT_NUMERIC_CASE(UInt32Type);
+    SORT_NUMERIC_CASE(Int32Type);
+    SORT_NUMERIC_CASE(UInt64Type);
+    SORT_NUMERIC_CASE(Int64Type);
+    SORT_NUMERIC_CASE(FloatType);
+    SORT_NUMERIC_CASE(DoubleType);
+    SORT_NUMERIC_CASE(Date32Type);
+    SORT_NUMERIC_CASE(Date64Type);
+    SORT_NUMERIC_CASE(Time32Type);
+    SORT_NUMERIC_CASE(Time64Type);
+    SORT_NUMERIC_CASE(TimestampType);
+    case Type::BINARY:
+    case Type::STRING:
+      SortBinary(values, indices);
+      return Status::OK();
+    case Type::STRING_VIEW:
+      SortStringView(values, indices);
+      return Status::OK();
+    default:
+      break;
+  }
+
+#undef SORT_NUMERIC_CASE
+
+  std::stringstream ss;
+  ss << "Sorting not implemented for " << values.type->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+// ----------------------------------------------------------------------
+// Top-k selection
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type IsNaN(T value) {
+  return std::isnan(value);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_floating_point<T>::value, bool>::type IsNaN(T) {
+  return false;
+}
+
+// Keeps the k best values added, among up to 2k candidates
+template <typename T, bool kLargest>
+class TopKSelector {
+ public:
+  explicit TopKSelector(int64_t k)
+      : k_(static_cast<size_t>(k)), bar_(), has_bar_(false) {}
+
+  static bool Better(T left, T right) { return kLargest ? left > right : left < right; }
+
+  void Add(T value) {
+    if (k_ == 0 || (has_bar_ && !Better(value, bar_))) {
+      return;
+    }
+    candidates_.push_back(value);
+    if (candidates_.size() >= 2 * k_) {
+      Trim();
+    }
+  }
+
+  void Consume(const ArrayData& data) {
+    const T* values = GetValues<T>(data, 1);
+    VisitValidRuns(data, [&](int64_t position, int64_t length) {
+      for (int64_t i = position; i < position + length; ++i) {
+        if (!IsNaN(values[i])) {
+          Add(values[i]);
+        }
+      }
+    });
+  }
+
+  void Merge(const TopKSelector& other) {
+    for (T value : other.candidates_) {
+      Add(value);
+    }
+  }
+
+  // The k best values, best first
+  const std::vector<T>& Finish() {
+    Trim();
+    std::sort(candidates_.begin(), candidates_.end(), Better);
+    return candidates_;
+  }
+
+ private:
+  void Trim() {
+    if (candidates_.size() <= k_) {
+      return;
+    }
+    std::nth_element(candidates_.begin(), candidates_.begin() + (k_ - 1),
+                     candidates_.end(), Better);
+    candidates_.resize(k_);
+    bar_ = candidates_.back();
+    has_bar_ = true;
+  }
+
+  size_t k_;
+  std::vector<T> candidates_;
+  // Once trimmed, the k-th best value
+  T bar_;
+  bool has_bar_;
+};
+
+template <typename T, bool kLargest>
+Status SelectTopK(FunctionContext* ctx, const Datum& values, int64_t k, Datum* out) {
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.array());
+  } else {
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      if (chunk->length() > 0) {
+        chunks.push_back(chunk->data());
+      }
+    }
+  }
+
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<TopKSelector<T, kLargest>> selectors(num_chunks,
+                                                   TopKSelector<T, kLargest>(k));
+  auto consume = [&](FunctionContext*, int i) {
+    if (chunks[i]->length > 0) {
+      selectors[i].Consume(*chunks[i]);
+    }
+    return Status::OK();
+  };
+  if (num_chunks > 1) {
+    RETURN_NOT_OK(detail::ParallelInvoke(ctx, num_chunks, consume));
+  } else if (num_chunks == 1) {
+    RETURN_NOT_OK(consume(ctx, 0));
+  }
+
+  TopKSelector<T, kLargest> selector(k);
+  for (const auto& chunk_selector : selectors) {
+    selector.Merge(chunk_selector);
+  }
+  const std::vector<T>& best = selector.Finish();
+  const int64_t length = static_cast<int64_t>(best.size());
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(T), &data));
+  if (length > 0) {
+    std::memcpy(data->mutable_data(), best.data(), length * sizeof(T));
+  }
+  *out = Datum(ArrayData::Make(values.type(), length, {nullptr, data}, 0));
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Merging sorted streams
+
+// A sort key of a row: its class, then its value for non-null values.
+// Nulls are class 0 when they come first and 2 when they come last
+template <typename T>
+struct MergeKey {
+  int klass;
+  typename SortKey<T>::type value;
+
+  bool operator<(const MergeKey& other) const {
+    return klass < other.klass || (klass == other.klass && klass == 1 &&
+                                   value < other.value);
+  }
+  bool operator==(const MergeKey& other) const {
+    return klass == other.klass && (klass != 1 || value == other.value);
+  }
+};
+
+// The position of a sorted input in its current record batch
+template <typename T>
+struct MergeCursor {
+  std::shared_ptr<RecordBatch> batch;
+  const T* values = NULLPTR;
+  const uint8_t* validity = NULLPTR;
+  int64_t validity_offset = 0;
+  int64_t position = 0;
+  bool finished = false;
+
+  int64_t length() const { return batch->num_rows(); }
+};
+
+// Merges the inputs with a loser tree over their cursors: internal node n of
+// the tree (1 <= n < k) holds the cursor which lost the match played at n,
+// leaf k + i stands for input i and node 0 holds the overall winner. Moving
+// the winner replays the matches on its path to the root only, and the best
+// of the losers on that path is the runner-up, so that all the rows of the
+// winner sorting before the runner-up are emitted as one range, found by
+// galloping through its batch
+template <typename T>
+class SortedMergeReader : public RecordBatchReader {
+ public:
+  SortedMergeReader(FunctionContext* ctx,
+                    const std::vector<std::shared_ptr<RecordBatchReader>>& inputs,
+                    int key_index, const MergeOptions& options)
+      : ctx_(ctx),
+        inputs_(inputs),
+        schema_(inputs[0]->schema()),
+        key_index_(key_index),
+        options_(options),
+        cursors_(inputs.size()),
+        tree_(inputs.size()),
+        started_(false) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (!started_) {
+      for (size_t i = 0; i < inputs_.size(); ++i) {
+        RETURN_NOT_OK(LoadBatch(static_cast<int>(i)));
+      }
+      tree_[0] = InitTree(1);
+      started_ = true;
+    }
+
+    std::vector<std::shared_ptr<RecordBatch>> pieces;
+    int64_t num_rows = 0;
+    while (num_rows < options_.batch_size) {
+      const int winner = tree_[0];
+      MergeCursor<T>& cursor = cursors_[winner];
+      if (cursor.finished) {
+        break;
+      }
+      const int64_t length = RunLength(winner, options_.batch_size - num_rows);
+      pieces.push_back(cursor.batch->Slice(cursor.position, length));
+      num_rows += length;
+      cursor.position += length;
+      if (cursor.position == cursor.length()) {
+        RETURN_NOT_OK(LoadBatch(winner));
+      }
+      Replay(winner);
+    }
+    return Gather(pieces, num_rows, out);
+  }
+
+ private:
+  // Read the next non-empty batch of input i, if any
+  Status LoadBatch(int i) {
+    MergeCursor<T>& cursor = cursors_[i];
+    while (true) {
+      RETURN_NOT_OK(inputs_[i]->ReadNext(&cursor.batch));
+      if (cursor.batch == nullptr) {
+        cursor.finished = true;
+        return Status::OK();
+      }
+      if (!cursor.batch->schema()->Equals(*schema_)) {
+        return Status::Invalid("Record batch does not match the schema of the merge");
+      }
+      if (cursor.batch->num_rows() > 0) {
+        break;
+      }
+    }
+    const ArrayData& keys = *cursor.batch->column(key_index_)->data();
+    cursor.values = GetValues<T>(keys, 1);
+    cursor.validity = HasValidityBitmap(keys) ? keys.buffers[0]->data() : NULLPTR;
+    cursor.validity_offset = keys.offset;
+    cursor.position = 0;
+    return Status::OK();
+  }
+
+  MergeKey<T> Key(const MergeCursor<T>& cursor, int64_t position) const {
+    MergeKey<T> key;
+    if (cursor.validity != NULLPTR &&
+        !BitUtil::GetBit(cursor.validity, cursor.validity_offset + position)) {
+      key.klass = options_.nulls_first ? 0 : 2;
+      key.value = 0;
+    } else {
+      key.klass = 1;
+      key.value = SortKey<T>::Make(cursor.values[position]);
+    }
+    return key;
+  }
+
+  // Whether the current row of input a is emitted before that of input b.
+  // Ties go to the first input, for a stable merge
+  bool Before(int a, int b) const {
+    const MergeCursor<T>& cursor_a = cursors_[a];
+    const MergeCursor<T>& cursor_b = cursors_[b];
+    if (cursor_a.finished || cursor_b.finished) {
+      return !cursor_a.finished && (cursor_b.finished || a < b);
+    }
+    const MergeKey<T> key_a = Key(cursor_a, cursor_a.position);
+    const MergeKey<T> key_b = Key(cursor_b, cursor_b.position);
+    return key_a < key_b || (key_a == key_b && a < b);
+  }
+
+  int InitTree(int node) {
+    const int k = static_cast<int>(tree_.size());
+    if (node >= k) {
+      return node - k;
+    }
+    const int left = InitTree(2 * node);
+    const int right = InitTree(2 * node + 1);
+    const bool left_wins = Before(left, right);
+    tree_[node] = left_wins ? right : left;
+    return left_wins ? left : right;
+  }
+
+  void Replay(int input) {
+    const int k = static_cast<int>(tree_.size());
+    int winner = input;
+    for (int node = (k + input) / 2; node >= 1; node /= 2) {
+      if (Before(tree_[node], winner)) {
+        std::swap(tree_[node], winner);
+      }
+    }
+    tree_[0] = winner;
+  }
+
+  // The number of rows of the winner, up to max_length, to emit before the
+  // current row of the runner-up
+  int64_t RunLength(int winner, int64_t max_length) const {
+    const int k = static_cast<int>(tree_.size());
+    int runner_up = -1;
+    for (int node = (k + winner) / 2; node >= 1; node /= 2) {
+      if (runner_up == -1 || Before(tree_[node], runner_up)) {
+        runner_up = tree_[node];
+      }
+    }
+
+    const MergeCursor<T>& cursor = cursors_[winner];
+    const int64_t end = std::min(cursor.length(), cursor.position + max_length);
+    if (runner_up == -1 || cursors_[runner_up].finished) {
+      return end - cursor.position;
+    }
+    const MergeCursor<T>& other = cursors_[runner_up];
+    const MergeKey<T> bound = Key(other, other.position);
+    auto before_bound = [&](int64_t position) {
+      const MergeKey<T> key = Key(cursor, position);
+      return key < bound || (key == bound && winner < runner_up);
+    };
+
+    // The current row is before the bound. Gallop to a row which is not, or
+    // to the end, then bisect
+    int64_t low = cursor.position;
+    int64_t step = 1;
+    while (low + step < end && before_bound(low + step)) {
+      low += step;
+      step *= 2;
+    }
+    int64_t high = std::min(low + step, end);
+    while (high - low > 1) {
+      const int64_t middle = low + (high - low) / 2;
+      if (before_bound(middle)) {
+        low = middle;
+      } else {
+        high = middle;
+      }
+    }
+    return high - cursor.position;
+  }
+
+  // Assemble the ranges into a batch, without copying a single range
+  Status Gather(const std::vector<std::shared_ptr<RecordBatch>>& pieces,
+                int64_t num_rows, std::shared_ptr<RecordBatch>* out) {
+    if (pieces.empty()) {
+      out->reset();
+      return Status::OK();
+    }
+    if (pieces.size() == 1) {
+      *out = pieces[0];
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<Array>> columns(schema_->num_fields());
+    for (int j = 0; j < schema_->num_fields(); ++j) {
+      ArrayVector chunks;
+      for (const auto& piece : pieces) {
+        chunks.push_back(piece->column(j));
+      }
+      RETURN_NOT_OK(Concatenate(chunks, ctx_->memory_pool(), &columns[j]));
+    }
+    *out = RecordBatch::Make(schema_, num_rows, columns);
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<RecordBatchReader>> inputs_;
+  std::shared_ptr<Schema> schema_;
+  int key_index_;
+  MergeOptions options_;
+  std::vector<MergeCursor<T>> cursors_;
+  std::vector<int> tree_;
+  bool started_;
+};
+
+}  // namespace
+
+Status TopK(FunctionContext* ctx, const Datum& values, const TopKOptions& options,
+            Datum* out) {
+  KernelProfileScope profile(ctx, "TopK");
+  if (!values.is_arraylike()) {
+    return Status::Invalid("TopK expects an array or a chunked array");
+  }
+  if (options.k < 0) {
+    return Status::Invalid("TopK expects a non-negative number of values");
+  }
+
+#define TOP_K_CASE(ArrowType)                                                   \
+  case ArrowType::type_id:                                                      \
+    return options.largest                                                      \
+               ? SelectTopK<typename ArrowType::c_type, true>(ctx, values,      \
+                                                              options.k, out)   \
+               : SelectTopK<typename ArrowType::c_type, false>(ctx, values,     \
+                                                               options.k, out);
+
+  switch (values.type()->id()) {
+    TOP_K_CASE(UInt8Type);
+    TOP_K_CASE(Int8Type);
+    TOP_K_CASE(UInt16Type);
+    TOP_K_CASE(Int16Type);
+    TOP_K_CASE(UInt32Type);
+    TOP_K_CASE(Int32Type);
+    TOP_K_CASE(UInt64Type);
+    TOP_K_CASE(Int64Type);
+    TOP_K_CASE(FloatType);
+    TOP_K_CASE(DoubleType);
+    TOP_K_CASE(Date32Type);
+    TOP_K_CASE(Date64Type);
+    TOP_K_CASE(Time32Type);
+    TOP_K_CASE(Time64Type);
+    TOP_K_CASE(TimestampType);
+    default:
+      break;
+  }
+
+#undef TOP_K_CASE
+
+  std::stringstream ss;
+  ss << "TopK not implemented for " << values.type()->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+Status SortToIndices(FunctionContext* ctx, const Datum& values,
+                     const SortOptions& options, Datum* out) {
+  KernelProfileScope profile(ctx, "SortToIndices");
+  if (values.kind() != Datum::ARRAY) {
+    return Status::Invalid("SortToIndices expects an array");
+  }
+  const ArrayData& data = *values.array();
+
+  std::vector<uint64_t> valid, nulls;
+  PartitionNulls(data, &valid, &nulls);
+  RETURN_NOT_OK(SortValid(data, &valid));
+
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(ctx->Allocate(data.length * sizeof(uint64_t), &indices));
+  uint64_t* out_indices = reinterpret_cast<uint64_t*>(indices->mutable_data());
+  const std::vector<uint64_t>& first = options.nulls_first ? nulls : valid;
+  const std::vector<uint64_t>& second = options.nulls_first ? valid : nulls;
+  std::copy(first.begin(), first.end(), out_indices);
+  std::copy(second.begin(), second.end(), out_indices + first.size());
+
+  *out = Datum(ArrayData::Make(uint64(), data.length, {nullptr, indices}, 0));
+  return Status::OK();
+}
+
+Status MergeSorted(FunctionContext* ctx,
+                   const std::vector<std::shared_ptr<RecordBatchReader>>& inputs,
+                   const std::string& key, const MergeOptions& options,
+                   std::shared_ptr<RecordBatchReader>* out) {
+  if (inputs.empty()) {
+    return Status::Invalid("MergeSorted expects at least one input");
+  }
+  if (options.batch_size <= 0) {
+    return Status::Invalid("MergeSorted expects a positive batch size");
+  }
+  const std::shared_ptr<Schema>& schema = inputs[0]->schema();
+  for (const auto& input : inputs) {
+    if (!input->schema()->Equals(*schema)) {
+      return Status::Invalid("The inputs of MergeSorted have different schemas");
+    }
+  }
+  const int64_t key_index = schema->GetFieldIndex(key);
+  if (key_index < 0) {
+    return Status::Invalid("No field named " + key);
+  }
+  const DataType& key_type = *schema->field(static_cast<int>(key_index))->type();
+
+#define MERGE_CASE(ArrowType)                                                  \
+  case ArrowType::type_id:                                                     \
+    out->reset(new SortedMergeReader<typename ArrowType::c_type>(              \
+        ctx, inputs, static_cast<int>(key_index), options));                   \
+    return Status::OK();
+
+  switch (key_type.id()) {
+    MERGE_CASE(UInt8Type);
+    MERGE_CASE(Int8Type);
+    MERGE_CASE(UInt16Type);
+    MERGE_CASE(Int16Type);
+    MERGE_CASE(UInt32Type);
+    MERGE_CASE(Int32Type);
+    MERGE_CASE(UInt64Type);
+    MERGE_CASE(Int64Type);
+    MERGE_CASE(FloatType);
+    MERGE_CASE(DoubleType);
+    MERGE_CASE(Date32Type);
+    MERGE_CASE(Date64Type);
+    MERGE_CASE(Time32Type);
+    MERGE_CASE(Time64Type);
+    MERGE_CASE(TimestampType);
+    default:
+      break;
+  }
+
+#undef MERGE_CASE
+
+  std::stringstream ss;
+  ss << "Merging not implemented for keys of type " << key_type.ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+}  // namespace compute
+}  // namespace arrow
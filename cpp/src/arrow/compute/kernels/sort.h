@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_SORT_H
+#define ARROW_COMPUTE_KERNELS_SORT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+struct ARROW_EXPORT SortOptions {
+  SortOptions() : nulls_first(false) {}
+
+  /// Whether nulls are placed before all values rather than after them
+  bool nulls_first;
+};
+
+/// \brief Compute the indices that sort an array in ascending order
+///
+/// The sort is stable: equal values, and nulls, keep their original order.
+/// Taking the values at the output indices, e.g. with Take, yields the sorted
+/// array.
+///
+/// Integer, floating point and temporal values are radix sorted. NaNs are
+/// placed after all other floating point values, but before trailing nulls.
+/// Binary and string values are radix sorted on their first 8 bytes, only
+/// strings sharing those bytes being compared further.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array to sort
+/// \param[in] options where nulls are placed
+/// \param[out] out uint64 array of indices into values
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* context, const Datum& values,
+                     const SortOptions& options, Datum* out);
+
+struct ARROW_EXPORT TopKOptions {
+  explicit TopKOptions(int64_t k = 1, bool largest = true) : k(k), largest(largest) {}
+
+  /// The number of values to select
+  int64_t k;
+  /// Whether the largest values are selected, in descending order, rather
+  /// than the smallest, in ascending order
+  bool largest;
+};
+
+/// \brief Select the k largest or smallest values, without sorting the input
+///
+/// Each chunk keeps its best values in a buffer of up to 2k candidates,
+/// trimmed to the k best with std::nth_element whenever it fills up: the k-th
+/// best value is then the bar further values must pass, so that most values
+/// are compared only once. The chunks of a ChunkedArray are selected from in
+/// parallel, using up to context->num_threads() threads, and their best values
+/// merged. Nulls and NaNs are skipped.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values numeric or temporal array-like input
+/// \param[in] options the number of values and which end to select them from
+/// \param[out] out array of the input type, with min(k, number of values)
+/// values, best first
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopK(FunctionContext* context, const Datum& values, const TopKOptions& options,
+            Datum* out);
+
+struct ARROW_EXPORT MergeOptions {
+  MergeOptions() : nulls_first(false), batch_size(64 * 1024) {}
+
+  /// Whether nulls are placed before all values rather than after them, as
+  /// in the inputs
+  bool nulls_first;
+  /// The maximum number of rows of the output batches
+  int64_t batch_size;
+};
+
+/// \brief Merge streams of record batches sorted on a key into one sorted
+/// stream
+///
+/// The inputs are merged with a loser tree over their current rows. The rows
+/// of the winning input which sort before the current row of the runner-up
+/// are found by galloping through its batch and emitted as one range, so
+/// that the cost of the merge grows with the number of alternations between
+/// the inputs rather than with the number of rows. Output batches are
+/// assembled from the ranges, a single range being passed on without
+/// copying. The merge is stable: rows with equal keys are output in the
+/// order of their inputs. The inputs are read lazily, as the output is read.
+///
+/// \param[in] context the FunctionContext, which must outlive the output
+/// \param[in] inputs streams of the same schema, each sorted in ascending
+/// order of key as by SortToIndices
+/// \param[in] key the name of a numeric or temporal field
+/// \param[in] options where nulls are placed and the size of output batches
+/// \param[out] out the merged stream
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MergeSorted(FunctionContext* context,
+                   const std::vector<std::shared_ptr<RecordBatchReader>>& inputs,
+                   const std::string& key, const MergeOptions& options,
+                   std::shared_ptr<RecordBatchReader>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_SORT_H
@@ -0,0 +1,446 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/take.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// The values of buffer i of data, or nullptr for arrays without that buffer,
+// such as empty ones
+template <typename T>
+const T* GetValuesOrNull(const ArrayData& data, int i) {
+  return data.buffers[i] ? GetValues<T>(data, i) : nullptr;
+}
+
+// Gathers values of any type by indices of a given integer type
+template <typename IndexCType>
+class Taker {
+ public:
+  explicit Taker(const ArrayData& indices)
+      : indices_(indices),
+        index_values_(GetValuesOrNull<IndexCType>(indices, 1)),
+        length_(indices.length),
+        has_nulls_(HasValidityBitmap(indices)) {}
+
+  Status CheckBounds(int64_t num_values) const {
+    // Negative indices wrap around to large unsigned values. The checks are
+    // accumulated without branching, a run of valid indices at a time
+    const auto upper_limit = static_cast<uint64_t>(num_values);
+    bool out_of_bounds = false;
+    auto check_run = [&](int64_t position, int64_t length) {
+      for (int64_t i = position; i < position + length; ++i) {
+        out_of_bounds |= static_cast<uint64_t>(index_values_[i]) >= upper_limit;
+      }
+    };
+    if (length_ == 0) {
+      return Status::OK();
+    }
+    if (has_nulls_) {
+      VisitSetBitRuns(indices_.buffers[0]->data(), indices_.offset, length_, check_run);
+    } else {
+      check_run(0, length_);
+    }
+    if (out_of_bounds) {
+      std::stringstream ss;
+      ss << "Take indices out of bounds for " << num_values << " values";
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
+  Status Take(FunctionContext* ctx, const std::shared_ptr<ArrayData>& values,
+              std::shared_ptr<ArrayData>* out) const {
+    const DataType& type = *values->type;
+    auto result = std::make_shared<ArrayData>(values->type, length_);
+    result->buffers.resize(2);
+
+    if (type.id() == Type::NA) {
+      result->null_count = length_;
+      result->buffers.resize(1);
+      *out = result;
+      return Status::OK();
+    }
+    if (type.id() == Type::DICTIONARY) {
+      // Gather the indices, keeping the dictionary
+      std::shared_ptr<Array> dict_indices =
+          static_cast<const DictionaryArray&>(*MakeArray(values)).indices();
+      std::shared_ptr<ArrayData> taken;
+      RETURN_NOT_OK(Take(ctx, dict_indices->data(), &taken));
+      *out = taken->Copy();
+      (*out)->type = values->type;
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(TakeValidity(ctx, *values, result.get()));
+    if (type.id() == Type::BOOL) {
+      RETURN_NOT_OK(TakeBoolean(ctx, *values, result.get()));
+    } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+      RETURN_NOT_OK(TakeBinary(ctx, *values, result.get()));
+    } else if (is_primitive(type.id()) || type.id() == Type::FIXED_SIZE_BINARY ||
+               type.id() == Type::DECIMAL) {
+      const int byte_width = static_cast<const FixedWidthType&>(type).bit_width() / 8;
+      RETURN_NOT_OK(TakeFixedWidth(ctx, *values, byte_width, result.get()));
+    } else if (type.id() == Type::UNION &&
+               static_cast<const UnionType&>(type).mode() == UnionMode::DENSE) {
+      RETURN_NOT_OK(TakeDenseUnion(ctx, *values, result.get()));
+    } else {
+      std::stringstream ss;
+      ss << "Take not implemented for " << type.ToString();
+      return Status::NotImplemented(ss.str());
+    }
+    *out = result;
+    return Status::OK();
+  }
+
+ private:
+  // Call visit(position, index, is_valid) for each index. Null slots may
+  // hold any value, so that their index is passed as 0
+  template <typename Visit>
+  void VisitIndices(Visit&& visit) const {
+    if (!has_nulls_) {
+      for (int64_t i = 0; i < length_; ++i) {
+        visit(i, static_cast<int64_t>(index_values_[i]), true);
+      }
+      return;
+    }
+    internal::BitmapReader reader(indices_.buffers[0]->data(), indices_.offset, length_);
+    for (int64_t i = 0; i < length_; ++i) {
+      const bool is_valid = reader.IsSet();
+      visit(i, is_valid ? static_cast<int64_t>(index_values_[i]) : 0, is_valid);
+      reader.Next();
+    }
+  }
+
+  Status TakeValidity(FunctionContext* ctx, const ArrayData& values,
+                      ArrayData* out) const {
+    if (!HasValidityBitmap(values)) {
+      if (has_nulls_) {
+        RETURN_NOT_OK(detail::GetValidityAtZero(ctx, indices_, &out->buffers[0]));
+        out->null_count = length_ - CountSetBits(out->buffers[0]->data(), 0, length_);
+      } else {
+        out->null_count = 0;
+      }
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length_, &out->buffers[0]));
+    uint8_t* bitmap = out->buffers[0]->mutable_data();
+    const uint8_t* in_bitmap = values.buffers[0]->data();
+    VisitIndices([&](int64_t i, int64_t index, bool is_valid) {
+      if (is_valid && BitUtil::GetBit(in_bitmap, values.offset + index)) {
+        BitUtil::SetBit(bitmap, i);
+      }
+    });
+    out->null_count = length_ - CountSetBits(bitmap, 0, length_);
+    return Status::OK();
+  }
+
+  // Gather values of a C type of the byte width
+  template <typename T>
+  void GatherValues(const ArrayData& values, uint8_t* out_bytes) const {
+    const T* in = GetValuesOrNull<T>(values, 1);
+    T* out = reinterpret_cast<T*>(out_bytes);
+    if (!has_nulls_) {
+      for (int64_t i = 0; i < length_; ++i) {
+        out[i] = in[index_values_[i]];
+      }
+      return;
+    }
+    VisitIndices([&](int64_t i, int64_t index, bool is_valid) {
+      out[i] = is_valid ? in[index] : T();
+    });
+  }
+
+  Status TakeFixedWidth(FunctionContext* ctx, const ArrayData& values, int byte_width,
+                        ArrayData* out) const {
+    RETURN_NOT_OK(ctx->Allocate(length_ * byte_width, &out->buffers[1]));
+    uint8_t* out_values = out->buffers[1]->mutable_data();
+    switch (byte_width) {
+      case 1:
+        GatherValues<uint8_t>(values, out_values);
+        break;
+      case 2:
+        GatherValues<uint16_t>(values, out_values);
+        break;
+      case 4:
+        GatherValues<uint32_t>(values, out_values);
+        break;
+      case 8:
+        GatherValues<uint64_t>(values, out_values);
+        break;
+      default: {
+        const uint8_t* in = values.buffers[1] ? values.buffers[1]->data() +
+                                                    values.offset * byte_width
+                                              : nullptr;
+        VisitIndices([&](int64_t i, int64_t index, bool is_valid) {
+          uint8_t* dest = out_values + i * byte_width;
+          if (is_valid) {
+            std::memcpy(dest, in + index * byte_width, byte_width);
+          } else {
+            std::memset(dest, 0, byte_width);
+          }
+        });
+      } break;
+    }
+    return Status::OK();
+  }
+
+  Status TakeBoolean(FunctionContext* ctx, const ArrayData& values,
+                     ArrayData* out) const {
+    RETURN_NOT_OK(GetEmptyBitmap(ctx->memory_pool(), length_, &out->buffers[1]));
+    uint8_t* out_values = out->buffers[1]->mutable_data();
+    const uint8_t* in_values = values.buffers[1] ? values.buffers[1]->data() : nullptr;
+    VisitIndices([&](int64_t i, int64_t index, bool is_valid) {
+      if (is_valid && BitUtil::GetBit(in_values, values.offset + index)) {
+        BitUtil::SetBit(out_values, i);
+      }
+    });
+    return Status::OK();
+  }
+
+  Status TakeBinary(FunctionContext* ctx, const ArrayData& values,
+                    ArrayData* out) const {
+    const int32_t* offsets = GetValuesOrNull<int32_t>(values, 1);
+    const uint8_t* data = values.buffers[2] ? values.buffers[2]->data() : nullptr;
+
+    // Compute the output offsets first, so that the data is allocated once
+    out->buffers.resize(3);
+    RETURN_NOT_OK(ctx->Allocate((length_ + 1) * sizeof(int32_t), &out->buffers[1]));
+    int32_t* out_offsets = reinterpret_cast<int32_t*>(out->buffers[1]->mutable_data());
+    int64_t data_length = 0;
+    VisitIndices([&](int64_t i, int64_t index, bool is_valid) {
+      out_offsets[i] = static_cast<int32_t>(data_length);
+      if (is_valid) {
+        data_length += offsets[index + 1] - offsets[index];
+      }
+    });
+    if (data_length > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("Take output too large for a binary array");
+    }
+    out_offsets[length_] = static_cast<int32_t>(data_length);
+
+    RETURN_NOT_OK(ctx->Allocate(data_length, &out->buffers[2]));
+    uint8_t* out_data = out->buffers[2]->mutable_data();
+    VisitIndices([&](int64_t i, int64_t index, bool is_valid) {
+      const int32_t value_length = out_offsets[i + 1] - out_offsets[i];
+      if (is_valid && value_length > 0) {
+        std::memcpy(out_data + out_offsets[i], data + offsets[index], value_length);
+      }
+    });
+    return Status::OK();
+  }
+
+  // Gather the type ids and renumber the offsets in a single pass, collecting
+  // the offsets taken from each child. Each child is then taken at once by
+  // those offsets, rather than value by value
+  Status TakeDenseUnion(FunctionContext* ctx, const ArrayData& values,
+                        ArrayData* out) const {
+    const auto& type = static_cast<const UnionType&>(*values.type);
+    const int num_children = type.num_children();
+    std::vector<int> child_ids(std::numeric_limits<uint8_t>::max() + 1, 0);
+    for (int c = 0; c < num_children; ++c) {
+      child_ids[type.type_codes()[c]] = c;
+    }
+
+    out->buffers.resize(3);
+    RETURN_NOT_OK(ctx->Allocate(length_, &out->buffers[1]));
+    RETURN_NOT_OK(ctx->Allocate(length_ * sizeof(int32_t), &out->buffers[2]));
+    uint8_t* out_type_ids = out->buffers[1]->mutable_data();
+    int32_t* out_offsets = reinterpret_cast<int32_t*>(out->buffers[2]->mutable_data());
+    const uint8_t* type_ids = GetValuesOrNull<uint8_t>(values, 1);
+    const int32_t* offsets = GetValuesOrNull<int32_t>(values, 2);
+    const uint8_t* out_bitmap = out->null_count > 0 ? out->buffers[0]->data() : nullptr;
+
+    std::vector<std::vector<int32_t>> child_offsets(num_children);
+    VisitIndices([&](int64_t i, int64_t index, bool) {
+      if (out_bitmap == nullptr || BitUtil::GetBit(out_bitmap, i)) {
+        std::vector<int32_t>& taken = child_offsets[child_ids[type_ids[index]]];
+        out_type_ids[i] = type_ids[index];
+        out_offsets[i] = static_cast<int32_t>(taken.size());
+        taken.push_back(offsets[index]);
+      } else {
+        // Null slots point to the first value of the first child
+        out_type_ids[i] = type.type_codes()[0];
+        out_offsets[i] = 0;
+      }
+    });
+
+    out->child_data.resize(num_children);
+    return detail::ParallelInvoke(
+        ctx, num_children, [&](FunctionContext* task_ctx, int c) {
+          const std::vector<int32_t>& taken = child_offsets[c];
+          auto child_indices = ArrayData::Make(
+              int32(), static_cast<int64_t>(taken.size()),
+              {nullptr, std::make_shared<Buffer>(
+                            reinterpret_cast<const uint8_t*>(taken.data()),
+                            static_cast<int64_t>(taken.size() * sizeof(int32_t)))},
+              0);
+          Taker<int32_t> child_taker(*child_indices);
+          RETURN_NOT_OK(child_taker.CheckBounds(values.child_data[c]->length));
+          return child_taker.Take(task_ctx, values.child_data[c], &out->child_data[c]);
+        });
+  }
+
+  const ArrayData& indices_;
+  const IndexCType* index_values_;
+  const int64_t length_;
+  const bool has_nulls_;
+};
+
+// Call func(taker) with a Taker for the type of indices. Func has a templated
+// call operator, visiting each index type
+template <typename Func>
+Status WithTaker(const ArrayData& indices, Func&& func) {
+#define TAKER_CASE(IndexType)                         \
+  case IndexType::type_id: {                          \
+    Taker<typename IndexType::c_type> taker(indices); \
+    return func(taker);                               \
+  }
+
+  switch (indices.type->id()) {
+    TAKER_CASE(Int8Type);
+    TAKER_CASE(UInt8Type);
+    TAKER_CASE(Int16Type);
+    TAKER_CASE(UInt16Type);
+    TAKER_CASE(Int32Type);
+    TAKER_CASE(UInt32Type);
+    TAKER_CASE(Int64Type);
+    TAKER_CASE(UInt64Type);
+    default:
+      break;
+  }
+
+#undef TAKER_CASE
+
+  std::stringstream ss;
+  ss << "Take indices must be integers, got " << indices.type->ToString();
+  return Status::Invalid(ss.str());
+}
+
+struct TakeArrayFunctor {
+  FunctionContext* ctx;
+  const std::shared_ptr<ArrayData>& values;
+  std::shared_ptr<ArrayData>* out;
+
+  template <typename IndexCType>
+  Status operator()(const Taker<IndexCType>& taker) const {
+    RETURN_NOT_OK(taker.CheckBounds(values->length));
+    return taker.Take(ctx, values, out);
+  }
+};
+
+struct TakeColumnsFunctor {
+  FunctionContext* ctx;
+  const RecordBatch& batch;
+  std::vector<std::shared_ptr<Array>>* columns;
+
+  template <typename IndexCType>
+  Status operator()(const Taker<IndexCType>& taker) const {
+    // The bounds are checked once for all columns
+    RETURN_NOT_OK(taker.CheckBounds(batch.num_rows()));
+    return detail::ParallelInvoke(
+        ctx, batch.num_columns(), [&](FunctionContext* task_ctx, int i) {
+          std::shared_ptr<ArrayData> column;
+          RETURN_NOT_OK(taker.Take(task_ctx, batch.column(i)->data(), &column));
+          (*columns)[i] = MakeArray(column);
+          return Status::OK();
+        });
+  }
+};
+
+Status TakeArray(FunctionContext* ctx, const std::shared_ptr<ArrayData>& values,
+                 const ArrayData& indices, std::shared_ptr<ArrayData>* out) {
+  return WithTaker(indices, TakeArrayFunctor{ctx, values, out});
+}
+
+Status TakeRecordBatch(FunctionContext* ctx, const RecordBatch& batch,
+                       const ArrayData& indices, std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  RETURN_NOT_OK(WithTaker(indices, TakeColumnsFunctor{ctx, batch, &columns}));
+  *out = RecordBatch::Make(batch.schema(), indices.length, columns);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
+            Datum* out) {
+  KernelProfileScope profile(ctx, "Take");
+  if (!indices.is_arraylike()) {
+    return Status::Invalid("Take expects an array or chunked array of indices");
+  }
+
+  if (values.kind() == Datum::RECORD_BATCH) {
+    if (indices.kind() != Datum::ARRAY) {
+      return Status::Invalid("Rows of a record batch must be taken by an array");
+    }
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(TakeRecordBatch(ctx, *values.record_batch(), *indices.array(), &batch));
+    *out = Datum(batch);
+    return Status::OK();
+  }
+  if (values.kind() != Datum::ARRAY) {
+    return Status::Invalid("Take expects an array or a record batch of values");
+  }
+
+  if (indices.kind() == Datum::ARRAY) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(TakeArray(ctx, values.array(), *indices.array(), &result));
+    *out = Datum(result);
+    return Status::OK();
+  }
+
+  const ChunkedArray& index_chunks = *indices.chunked_array();
+  std::vector<std::shared_ptr<Array>> outputs(index_chunks.num_chunks());
+  RETURN_NOT_OK(detail::ParallelInvoke(
+      ctx, index_chunks.num_chunks(), [&](FunctionContext* task_ctx, int i) {
+        std::shared_ptr<ArrayData> result;
+        RETURN_NOT_OK(TakeArray(task_ctx, values.array(), *index_chunks.chunk(i)->data(),
+                                &result));
+        outputs[i] = MakeArray(result);
+        return Status::OK();
+      }));
+  *out = Datum(std::make_shared<ChunkedArray>(outputs));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
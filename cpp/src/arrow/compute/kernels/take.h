@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_TAKE_H
+#define ARROW_COMPUTE_KERNELS_TAKE_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \brief Gather values at the given positions
+///
+/// The output has the length of indices, with out[i] = values[indices[i]],
+/// or null where indices[i] is null. Indices are checked to be in bounds
+/// before anything is gathered.
+///
+/// Primitive, boolean, binary, string, fixed size binary, decimal, null,
+/// dictionary and dense union values are supported. Each child of a dense
+/// union is gathered once, by the offsets of all the slots of that child.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array or record batch. The columns of a record batch
+/// are gathered alike
+/// \param[in] indices integer array of any width, signed or not. A chunked
+/// array of indices yields one output chunk per chunk of indices, and can
+/// only be used with array values
+/// \param[out] out the gathered values
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Take(FunctionContext* context, const Datum& values, const Datum& indices,
+            Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_TAKE_H
@@ -0,0 +1,937 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/temporal.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Calendar arithmetic
+//
+// Days since the epoch are converted to and from the proleptic Gregorian
+// calendar with the algorithms of Howard Hinnant's "chrono-Compatible
+// Low-Level Date Algorithms", counting years from March so that the leap day
+// comes last. Divisions round down with a correction instead of a branch, and
+// only the 400-year era needs 64 bits, so that the loops below vectorize.
+
+constexpr int64_t kSecondsPerDay = 86400;
+
+inline int64_t FloorDiv(int64_t value, int64_t divisor) {
+  return value / divisor - static_cast<int64_t>(value % divisor < 0);
+}
+
+inline int64_t FloorMod(int64_t value, int64_t divisor) {
+  return value - FloorDiv(value, divisor) * divisor;
+}
+
+// Add without undefined behaviour on overflow, which only null slots with
+// arbitrary values may hit
+inline int64_t WrappingAdd(int64_t left, int64_t right) {
+  return static_cast<int64_t>(static_cast<uint64_t>(left) + static_cast<uint64_t>(right));
+}
+
+struct CivilDate {
+  int64_t year;
+  int32_t month;
+  int32_t day;
+};
+
+inline CivilDate CivilFromDays(int64_t days) {
+  days += 719468;
+  const int64_t era = FloorDiv(days, 146097);
+  const int32_t day_of_era = static_cast<int32_t>(days - era * 146097);
+  const int32_t year_of_era =
+      (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const int32_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const int32_t month_from_march = (5 * day_of_year + 2) / 153;
+  const int32_t month =
+      month_from_march < 10 ? month_from_march + 3 : month_from_march - 9;
+  return {era * 400 + year_of_era + (month <= 2), month,
+          day_of_year - (153 * month_from_march + 2) / 5 + 1};
+}
+
+inline int64_t DaysFromCivil(int64_t year, int32_t month, int32_t day) {
+  year -= month <= 2;
+  const int64_t era = FloorDiv(year, 400);
+  const int32_t year_of_era = static_cast<int32_t>(year - era * 400);
+  const int32_t month_from_march = month > 2 ? month - 3 : month + 9;
+  const int32_t day_of_year = (153 * month_from_march + 2) / 5 + day - 1;
+  const int32_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+// 0 for Monday, the epoch being a Thursday
+inline int64_t DayOfWeek(int64_t days) { return FloorMod(days + 3, 7); }
+
+// ----------------------------------------------------------------------
+// Field extraction and truncation operators
+//
+// Values are counted in ticks: days for date32, milliseconds for date64 and
+// the unit of timestamps.
+
+struct ExtractYear {
+  static int32_t Call(int64_t ticks, int64_t ticks_per_day, int64_t ticks_per_second) {
+    return static_cast<int32_t>(CivilFromDays(FloorDiv(ticks, ticks_per_day)).year);
+  }
+};
+
+struct ExtractMonth {
+  static int32_t Call(int64_t ticks, int64_t ticks_per_day, int64_t ticks_per_second) {
+    return CivilFromDays(FloorDiv(ticks, ticks_per_day)).month;
+  }
+};
+
+struct ExtractDay {
+  static int32_t Call(int64_t ticks, int64_t ticks_per_day, int64_t ticks_per_second) {
+    return CivilFromDays(FloorDiv(ticks, ticks_per_day)).day;
+  }
+};
+
+struct ExtractDayOfWeek {
+  static int32_t Call(int64_t ticks, int64_t ticks_per_day, int64_t ticks_per_second) {
+    return static_cast<int32_t>(DayOfWeek(FloorDiv(ticks, ticks_per_day)));
+  }
+};
+
+struct ExtractDayOfYear {
+  static int32_t Call(int64_t ticks, int64_t ticks_per_day, int64_t ticks_per_second) {
+    const int64_t days = FloorDiv(ticks, ticks_per_day);
+    return static_cast<int32_t>(days - DaysFromCivil(CivilFromDays(days).year, 1, 1) + 1);
+  }
+};
+
+template <int64_t kSecondsPerUnit, int64_t kUnitsPerParent>
+struct ExtractClock {
+  static int32_t Call(int64_t ticks, int64_t ticks_per_day, int64_t ticks_per_second) {
+    const int64_t second_of_day = FloorMod(ticks, ticks_per_day) / ticks_per_second;
+    return static_cast<int32_t>(second_of_day / kSecondsPerUnit % kUnitsPerParent);
+  }
+};
+
+using ExtractHour = ExtractClock<3600, 24>;
+using ExtractMinute = ExtractClock<60, 60>;
+using ExtractSecond = ExtractClock<1, 60>;
+
+struct TruncateToYear {
+  static int64_t Call(int64_t ticks, int64_t ticks_per_day, int64_t multiple) {
+    const CivilDate date = CivilFromDays(FloorDiv(ticks, ticks_per_day));
+    return DaysFromCivil(date.year, 1, 1) * ticks_per_day;
+  }
+};
+
+struct TruncateToMonth {
+  static int64_t Call(int64_t ticks, int64_t ticks_per_day, int64_t multiple) {
+    const CivilDate date = CivilFromDays(FloorDiv(ticks, ticks_per_day));
+    return DaysFromCivil(date.year, date.month, 1) * ticks_per_day;
+  }
+};
+
+struct TruncateToWeek {
+  static int64_t Call(int64_t ticks, int64_t ticks_per_day, int64_t multiple) {
+    const int64_t days = FloorDiv(ticks, ticks_per_day);
+    return (days - DayOfWeek(days)) * ticks_per_day;
+  }
+};
+
+// Days and clock units, a multiple of ticks long
+struct TruncateToMultiple {
+  static int64_t Call(int64_t ticks, int64_t ticks_per_day, int64_t multiple) {
+    return FloorDiv(ticks, multiple) * multiple;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Vectorizable loops, compiled for each instruction set supported by
+// DynamicDispatch as the arithmetic loops are
+
+#define TEMPORAL_LOOPS(SUFFIX, TARGET_ATTR)                                           \
+  template <typename T, typename Op>                                                  \
+  TARGET_ATTR void ExtractTemporalValues##SUFFIX(const T* values, int64_t length,     \
+                                                 int64_t ticks_per_day,               \
+                                                 int64_t ticks_per_second,            \
+                                                 int32_t* out) {                      \
+    for (int64_t i = 0; i < length; ++i) {                                            \
+      out[i] = Op::Call(values[i], ticks_per_day, ticks_per_second);                  \
+    }                                                                                 \
+  }                                                                                   \
+                                                                                      \
+  template <typename T, typename Op>                                                  \
+  TARGET_ATTR void TruncateTemporalValues##SUFFIX(                                    \
+      const T* values, int64_t length, int64_t ticks_per_day, int64_t multiple,       \
+      T* out) {                                                                       \
+    for (int64_t i = 0; i < length; ++i) {                                            \
+      out[i] = static_cast<T>(Op::Call(values[i], ticks_per_day, multiple));          \
+    }                                                                                 \
+  }                                                                                   \
+                                                                                      \
+  TARGET_ATTR void ShiftTimestamps##SUFFIX(const int64_t* values, int64_t length,     \
+                                           int64_t shift, int64_t* out) {             \
+    for (int64_t i = 0; i < length; ++i) {                                            \
+      out[i] = WrappingAdd(values[i], shift);                                         \
+    }                                                                                 \
+  }
+
+TEMPORAL_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+TEMPORAL_LOOPS(Sse42, ARROW_TARGET_SSE4_2)
+TEMPORAL_LOOPS(Avx2, ARROW_TARGET_AVX2)
+TEMPORAL_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef TEMPORAL_LOOPS
+
+template <typename T, typename Op>
+struct ExtractTemporalDynamic {
+  using FunctionType = void (*)(const T*, int64_t, int64_t, int64_t, int32_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, ExtractTemporalValuesDefault<T, Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, ExtractTemporalValuesSse42<T, Op>},
+        {DispatchLevel::AVX2, ExtractTemporalValuesAvx2<T, Op>},
+        {DispatchLevel::AVX512, ExtractTemporalValuesAvx512<T, Op>},
+#endif
+    };
+  }
+};
+
+template <typename T, typename Op>
+struct TruncateTemporalDynamic {
+  using FunctionType = void (*)(const T*, int64_t, int64_t, int64_t, T*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, TruncateTemporalValuesDefault<T, Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, TruncateTemporalValuesSse42<T, Op>},
+        {DispatchLevel::AVX2, TruncateTemporalValuesAvx2<T, Op>},
+        {DispatchLevel::AVX512, TruncateTemporalValuesAvx512<T, Op>},
+#endif
+    };
+  }
+};
+
+struct ShiftTimestampsDynamic {
+  using FunctionType = void (*)(const int64_t*, int64_t, int64_t, int64_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, ShiftTimestampsDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, ShiftTimestampsSse42},
+        {DispatchLevel::AVX2, ShiftTimestampsAvx2},
+        {DispatchLevel::AVX512, ShiftTimestampsAvx512},
+#endif
+    };
+  }
+};
+
+template <typename T, typename Op>
+void ExtractTemporalBlock(const T* values, int64_t length, int64_t ticks_per_day,
+                          int64_t ticks_per_second, int32_t* out) {
+  static DynamicDispatch<ExtractTemporalDynamic<T, Op>> dispatch;
+  dispatch.func(values, length, ticks_per_day, ticks_per_second, out);
+}
+
+template <typename T, typename Op>
+void TruncateTemporalBlock(const T* values, int64_t length, int64_t ticks_per_day,
+                           int64_t multiple, T* out) {
+  static DynamicDispatch<TruncateTemporalDynamic<T, Op>> dispatch;
+  dispatch.func(values, length, ticks_per_day, multiple, out);
+}
+
+template <typename T>
+using ExtractTemporalFunction = void (*)(const T*, int64_t, int64_t, int64_t, int32_t*);
+
+template <typename T>
+ExtractTemporalFunction<T> GetExtractFunction(TemporalComponent component) {
+  switch (component) {
+    case TemporalComponent::YEAR:
+      return ExtractTemporalBlock<T, ExtractYear>;
+    case TemporalComponent::MONTH:
+      return ExtractTemporalBlock<T, ExtractMonth>;
+    case TemporalComponent::DAY:
+      return ExtractTemporalBlock<T, ExtractDay>;
+    case TemporalComponent::DAY_OF_WEEK:
+      return ExtractTemporalBlock<T, ExtractDayOfWeek>;
+    case TemporalComponent::DAY_OF_YEAR:
+      return ExtractTemporalBlock<T, ExtractDayOfYear>;
+    case TemporalComponent::HOUR:
+      return ExtractTemporalBlock<T, ExtractHour>;
+    case TemporalComponent::MINUTE:
+      return ExtractTemporalBlock<T, ExtractMinute>;
+    case TemporalComponent::SECOND:
+      return ExtractTemporalBlock<T, ExtractSecond>;
+  }
+  return nullptr;
+}
+
+template <typename T>
+using TruncateTemporalFunction = void (*)(const T*, int64_t, int64_t, int64_t, T*);
+
+template <typename T>
+TruncateTemporalFunction<T> GetTruncateFunction(TemporalUnit unit) {
+  switch (unit) {
+    case TemporalUnit::YEAR:
+      return TruncateTemporalBlock<T, TruncateToYear>;
+    case TemporalUnit::MONTH:
+      return TruncateTemporalBlock<T, TruncateToMonth>;
+    case TemporalUnit::WEEK:
+      return TruncateTemporalBlock<T, TruncateToWeek>;
+    default:
+      return TruncateTemporalBlock<T, TruncateToMultiple>;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Units of the temporal types
+
+struct TemporalTicks {
+  int64_t per_day;
+  int64_t per_second;
+};
+
+Status GetTemporalTicks(const DataType& type, TemporalTicks* out) {
+  switch (type.id()) {
+    case Type::DATE32:
+      // Clock fields are computed from the remainder of days, always 0
+      *out = {1, 1};
+      return Status::OK();
+    case Type::DATE64:
+      *out = {kSecondsPerDay * 1000, 1000};
+      return Status::OK();
+    case Type::TIMESTAMP: {
+      int64_t per_second = 1;
+      switch (static_cast<const TimestampType&>(type).unit()) {
+        case TimeUnit::SECOND:
+          break;
+        case TimeUnit::MILLI:
+          per_second = 1000;
+          break;
+        case TimeUnit::MICRO:
+          per_second = 1000000;
+          break;
+        case TimeUnit::NANO:
+          per_second = 1000000000;
+          break;
+      }
+      *out = {kSecondsPerDay * per_second, per_second};
+      return Status::OK();
+    }
+    default:
+      return Status::NotImplemented("Temporal kernels not implemented for " +
+                                    type.ToString());
+  }
+}
+
+// ----------------------------------------------------------------------
+// Execution over the pieces of array-like values
+
+using TemporalPieceFunction =
+    std::function<Status(FunctionContext*, const ArrayData&, std::shared_ptr<Array>*)>;
+
+// Make an output piece of the given type with the validity of input, and
+// values to be filled in
+Status MakeTemporalPiece(FunctionContext* ctx, const ArrayData& input,
+                         const std::shared_ptr<DataType>& type,
+                         std::shared_ptr<ArrayData>* out) {
+  const int64_t value_size = static_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  auto result = std::make_shared<ArrayData>(type, input.length);
+  result->buffers.resize(2);
+  RETURN_NOT_OK(ctx->Allocate(input.length * value_size, &result->buffers[1]));
+  RETURN_NOT_OK(detail::ComputeValidity(ctx, input, nullptr, result.get()));
+  *out = result;
+  return Status::OK();
+}
+
+Status ExecuteTemporal(FunctionContext* ctx, const Datum& values,
+                       const std::shared_ptr<DataType>& out_type,
+                       const TemporalPieceFunction& compute, Datum* out) {
+  std::vector<std::shared_ptr<Array>> pieces;
+  if (values.kind() == Datum::ARRAY) {
+    pieces.push_back(MakeArray(values.array()));
+  } else {
+    pieces = values.chunked_array()->chunks();
+  }
+  std::vector<std::shared_ptr<Array>> outputs(pieces.size());
+  RETURN_NOT_OK(detail::ParallelInvoke(
+      ctx, static_cast<int>(pieces.size()), [&](FunctionContext* task_ctx, int i) {
+        return compute(task_ctx, *pieces[i]->data(), &outputs[i]);
+      }));
+  if (outputs.empty()) {
+    // Chunked arrays without chunks
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), out_type, &builder));
+    outputs.emplace_back();
+    RETURN_NOT_OK(builder->Finish(&outputs.back()));
+  }
+  *out = detail::WrapArraysLike(values, outputs);
+  return Status::OK();
+}
+
+Status CheckTemporalValues(const Datum& values, const char* kernel_name) {
+  if (!values.is_arraylike()) {
+    std::stringstream ss;
+    ss << kernel_name << " expects an array or chunked array";
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Timezones
+
+// Offsets from UTC of a timezone, in seconds. offsets[i] applies from
+// transitions[i - 1] included to transitions[i] excluded, so that there is
+// one more offset than transitions
+struct TimezoneTransitions {
+  std::vector<int64_t> transitions;
+  std::vector<int64_t> offsets;
+};
+
+// The year up to which recurring daylight saving time rules are expanded
+constexpr int64_t kLastRuleYear = 2100;
+
+// Parse [+-]hh[:mm[:ss]] or [+-]hh[mm], returning the number of characters
+// read, or 0 if there is no valid time at the start of s
+size_t ParseTimeOfDay(const std::string& s, size_t pos, bool compact_minutes,
+                      int64_t* seconds) {
+  const size_t start = pos;
+  int64_t sign = 1;
+  if (pos < s.size() && (s[pos] == '+' || s[pos] == '-')) {
+    sign = s[pos] == '-' ? -1 : 1;
+    ++pos;
+  }
+  int64_t fields[3] = {0, 0, 0};
+  for (int field = 0; field < 3; ++field) {
+    if (field > 0) {
+      if (pos < s.size() && s[pos] == ':') {
+        ++pos;
+      } else if (!(compact_minutes && field == 1)) {
+        break;
+      }
+    }
+    // POSIX TZ times allow hours up to 167
+    const size_t max_digits = field == 0 && !compact_minutes ? 3 : 2;
+    const size_t digits_start = pos;
+    while (pos < s.size() && pos - digits_start < max_digits && s[pos] >= '0' &&
+           s[pos] <= '9') {
+      fields[field] = fields[field] * 10 + (s[pos] - '0');
+      ++pos;
+    }
+    if (pos == digits_start) {
+      if (field == 0) {
+        return 0;
+      }
+      break;
+    }
+  }
+  *seconds = sign * (fields[0] * 3600 + fields[1] * 60 + fields[2]);
+  return pos - start;
+}
+
+// A fixed offset: "UTC", "Z", or +hh:mm, +hhmm and +hh and their negatives
+bool ParseFixedOffset(const std::string& timezone, int64_t* offset) {
+  if (timezone == "UTC" || timezone == "Z" || timezone == "Etc/UTC") {
+    *offset = 0;
+    return true;
+  }
+  if (timezone.empty() || (timezone[0] != '+' && timezone[0] != '-')) {
+    return false;
+  }
+  return ParseTimeOfDay(timezone, 0, true, offset) == timezone.size();
+}
+
+// Day of the Mm.w.d rule of a POSIX TZ string: day d (0 for Sunday) of week
+// w (5 for the last one) of month m
+struct PosixTzRule {
+  int32_t month;
+  int32_t week;
+  int32_t weekday;
+  int64_t time;
+
+  int64_t DayInYear(int64_t year) const {
+    const int64_t first = DaysFromCivil(year, month, 1);
+    const int64_t next_first = month == 12 ? DaysFromCivil(year + 1, 1, 1)
+                                           : DaysFromCivil(year, month + 1, 1);
+    const int64_t days_in_month = next_first - first;
+    int64_t day = first + FloorMod(weekday - FloorMod(first + 4, 7), 7) + 7 * (week - 1);
+    while (day - first >= days_in_month) {
+      day -= 7;
+    }
+    return day;
+  }
+};
+
+class PosixTzParser {
+ public:
+  explicit PosixTzParser(const std::string& s) : s_(s), pos_(0) {}
+
+  // Parse std offset [dst [offset] ,start[/time],end[/time]], setting has_dst
+  bool Parse(int64_t* std_offset, bool* has_dst, int64_t* dst_offset, PosixTzRule* start,
+             PosixTzRule* end) {
+    if (!SkipName() || !ParseOffset(std_offset)) {
+      return false;
+    }
+    *has_dst = pos_ < s_.size();
+    if (!*has_dst) {
+      return true;
+    }
+    if (!SkipName()) {
+      return false;
+    }
+    *dst_offset = *std_offset + 3600;
+    if (pos_ < s_.size() && s_[pos_] != ',' && !ParseOffset(dst_offset)) {
+      return false;
+    }
+    return Expect(',') && ParseRule(start) && Expect(',') && ParseRule(end) &&
+           pos_ == s_.size();
+  }
+
+ private:
+  bool Expect(char c) {
+    if (pos_ < s_.size() && s_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool SkipName() {
+    if (Expect('<')) {
+      pos_ = s_.find('>', pos_);
+      return pos_ != std::string::npos && Expect('>');
+    }
+    const size_t start = pos_;
+    while (pos_ < s_.size() && std::isalpha(static_cast<unsigned char>(s_[pos_]))) {
+      ++pos_;
+    }
+    return pos_ - start >= 3;
+  }
+
+  // POSIX offsets are positive west of Greenwich
+  bool ParseOffset(int64_t* offset) {
+    int64_t seconds;
+    const size_t length = ParseTimeOfDay(s_, pos_, false, &seconds);
+    pos_ += length;
+    *offset = -seconds;
+    return length > 0;
+  }
+
+  bool ParseNumber(int32_t* out) {
+    const size_t start = pos_;
+    *out = 0;
+    while (pos_ < s_.size() && pos_ - start < 2 && s_[pos_] >= '0' && s_[pos_] <= '9') {
+      *out = *out * 10 + (s_[pos_++] - '0');
+    }
+    return pos_ > start;
+  }
+
+  bool ParseRule(PosixTzRule* rule) {
+    if (!Expect('M') || !ParseNumber(&rule->month) || !Expect('.') ||
+        !ParseNumber(&rule->week) || !Expect('.') || !ParseNumber(&rule->weekday)) {
+      return false;
+    }
+    if (rule->month < 1 || rule->month > 12 || rule->week < 1 || rule->week > 5 ||
+        rule->weekday > 6) {
+      return false;
+    }
+    rule->time = 7200;
+    if (Expect('/')) {
+      const size_t length = ParseTimeOfDay(s_, pos_, false, &rule->time);
+      pos_ += length;
+      return length > 0;
+    }
+    return true;
+  }
+
+  const std::string& s_;
+  size_t pos_;
+};
+
+// Expand the daylight saving time rules of the footer of a TZif file after
+// its last transition. Unsupported rules leave the last offset in force
+void AddPosixTzTransitions(const std::string& tz, TimezoneTransitions* out) {
+  int64_t std_offset, dst_offset = 0;
+  bool has_dst;
+  PosixTzRule start, end;
+  if (!PosixTzParser(tz).Parse(&std_offset, &has_dst, &dst_offset, &start, &end)) {
+    return;
+  }
+  if (!has_dst) {
+    if (out->transitions.empty()) {
+      out->offsets.back() = std_offset;
+    }
+    return;
+  }
+  const int64_t last = out->transitions.empty() ? 0 : out->transitions.back();
+  for (int64_t year = CivilFromDays(FloorDiv(last, kSecondsPerDay)).year;
+       year <= kLastRuleYear; ++year) {
+    // Daylight saving time starts at the given standard time, and ends at
+    // the given daylight saving time
+    std::pair<int64_t, int64_t> changes[2] = {
+        {start.DayInYear(year) * kSecondsPerDay + start.time - std_offset, dst_offset},
+        {end.DayInYear(year) * kSecondsPerDay + end.time - dst_offset, std_offset}};
+    if (changes[1].first < changes[0].first) {
+      std::swap(changes[0], changes[1]);
+    }
+    for (const auto& change : changes) {
+      if (out->transitions.empty() || change.first > out->transitions.back()) {
+        out->transitions.push_back(change.first);
+        out->offsets.push_back(change.second);
+      }
+    }
+  }
+}
+
+// Reader of the big-endian integers of a TZif file, see RFC 8536
+class TzifReader {
+ public:
+  explicit TzifReader(const std::string& data) : data_(data), pos_(0) {}
+
+  bool Skip(int64_t length) {
+    if (length < 0 || length > static_cast<int64_t>(data_.size() - pos_)) {
+      return false;
+    }
+    pos_ += static_cast<size_t>(length);
+    return true;
+  }
+
+  bool ReadInt(int size, int64_t* out) {
+    if (static_cast<size_t>(size) > data_.size() - pos_) {
+      return false;
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < size; ++i) {
+      value = (value << 8) | static_cast<uint8_t>(data_[pos_++]);
+    }
+    // Sign-extend
+    const int shift = 64 - 8 * size;
+    *out = static_cast<int64_t>(value << shift) >> shift;
+    return true;
+  }
+
+  // Read a header, returning its version and counts
+  bool ReadHeader(char* version, int64_t counts[6]) {
+    if (data_.compare(pos_, 4, "TZif") != 0 || !Skip(4) || pos_ >= data_.size()) {
+      return false;
+    }
+    *version = data_[pos_];
+    if (!Skip(16)) {
+      return false;
+    }
+    for (int i = 0; i < 6; ++i) {
+      if (!ReadInt(4, &counts[i]) || counts[i] < 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::string Rest() const { return data_.substr(pos_); }
+
+ private:
+  const std::string& data_;
+  size_t pos_;
+};
+
+bool ParseTzif(const std::string& data, TimezoneTransitions* out) {
+  enum { UTC_COUNT, STD_COUNT, LEAP_COUNT, TIME_COUNT, TYPE_COUNT, CHAR_COUNT };
+  TzifReader reader(data);
+  char version;
+  int64_t counts[6];
+  if (!reader.ReadHeader(&version, counts)) {
+    return false;
+  }
+  int time_size = 4;
+  if (version >= '2') {
+    // Skip the data with 32-bit times for the header and data with 64-bit ones
+    if (!reader.Skip(counts[TIME_COUNT] * 5 + counts[TYPE_COUNT] * 6 +
+                     counts[CHAR_COUNT] + counts[LEAP_COUNT] * 8 + counts[STD_COUNT] +
+                     counts[UTC_COUNT]) ||
+        !reader.ReadHeader(&version, counts)) {
+      return false;
+    }
+    time_size = 8;
+  }
+  if (counts[TYPE_COUNT] == 0) {
+    return false;
+  }
+
+  std::vector<int64_t> times(counts[TIME_COUNT]);
+  std::vector<int64_t> type_indices(counts[TIME_COUNT]);
+  std::vector<int64_t> type_offsets(counts[TYPE_COUNT]);
+  for (auto& time : times) {
+    if (!reader.ReadInt(time_size, &time)) {
+      return false;
+    }
+  }
+  for (auto& index : type_indices) {
+    if (!reader.ReadInt(1, &index) || index < 0 || index >= counts[TYPE_COUNT]) {
+      return false;
+    }
+  }
+  for (auto& offset : type_offsets) {
+    if (!reader.ReadInt(4, &offset) || !reader.Skip(2)) {
+      return false;
+    }
+  }
+  if (!reader.Skip(counts[CHAR_COUNT] + counts[LEAP_COUNT] * (time_size + 4) +
+                   counts[STD_COUNT] + counts[UTC_COUNT])) {
+    return false;
+  }
+
+  // Times before the first transition have the first local time type
+  out->offsets.assign(1, type_offsets[0]);
+  for (size_t i = 0; i < times.size(); ++i) {
+    if (!out->transitions.empty() && times[i] <= out->transitions.back()) {
+      return false;
+    }
+    out->transitions.push_back(times[i]);
+    out->offsets.push_back(type_offsets[type_indices[i]]);
+  }
+
+  const std::string footer = reader.Rest();
+  if (time_size == 8 && footer.size() > 2 && footer.front() == '\n') {
+    AddPosixTzTransitions(footer.substr(1, footer.find('\n', 1) - 1), out);
+  }
+  return true;
+}
+
+Status LoadTimezone(const std::string& timezone, TimezoneTransitions* out) {
+  int64_t offset;
+  if (ParseFixedOffset(timezone, &offset)) {
+    out->offsets.assign(1, offset);
+    return Status::OK();
+  }
+  if (timezone.empty() || timezone[0] == '/' ||
+      timezone.find("..") != std::string::npos) {
+    return Status::Invalid("Invalid timezone: " + timezone);
+  }
+  const char* tz_dir = std::getenv("TZDIR");
+  const std::string path =
+      std::string(tz_dir != nullptr ? tz_dir : "/usr/share/zoneinfo") + "/" + timezone;
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return Status::KeyError("Unknown timezone: " + timezone);
+  }
+  std::stringstream data;
+  data << file.rdbuf();
+  if (!ParseTzif(data.str(), out)) {
+    return Status::IOError("Invalid tz database file " + path);
+  }
+  return Status::OK();
+}
+
+// The transitions of each timezone are loaded once per process
+Status GetTimezoneTransitions(const std::string& timezone,
+                              std::shared_ptr<const TimezoneTransitions>* out) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::shared_ptr<const TimezoneTransitions>>
+      cache;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(timezone);
+  if (it == cache.end()) {
+    auto transitions = std::make_shared<TimezoneTransitions>();
+    RETURN_NOT_OK(LoadTimezone(timezone, transitions.get()));
+    it = cache.emplace(timezone, transitions).first;
+  }
+  *out = it->second;
+  return Status::OK();
+}
+
+Status ToLocalTimePiece(FunctionContext* ctx, const ArrayData& input,
+                        const std::shared_ptr<DataType>& out_type,
+                        const TimezoneTransitions& zone, int64_t ticks_per_second,
+                        std::shared_ptr<Array>* out) {
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(MakeTemporalPiece(ctx, input, out_type, &result));
+  const int64_t* values = GetValues<int64_t>(input, 1);
+  int64_t* out_values = GetMutableValues<int64_t>(result.get(), 1);
+  const int64_t length = input.length;
+  if (length > 0) {
+    // Only the transitions between the earliest and latest values of the
+    // piece are looked up. Most pieces fall between two transitions and are
+    // shifted by a single offset
+    const auto minmax = std::minmax_element(values, values + length);
+    const auto& transitions = zone.transitions;
+    const auto first = std::upper_bound(transitions.begin(), transitions.end(),
+                                        FloorDiv(*minmax.first, ticks_per_second));
+    const auto last = std::upper_bound(first, transitions.end(),
+                                       FloorDiv(*minmax.second, ticks_per_second));
+    if (first == last) {
+      static DynamicDispatch<ShiftTimestampsDynamic> dispatch;
+      const int64_t offset = zone.offsets[first - transitions.begin()];
+      dispatch.func(values, length, offset * ticks_per_second, out_values);
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        const auto next =
+            std::upper_bound(first, last, FloorDiv(values[i], ticks_per_second));
+        const int64_t offset = zone.offsets[next - transitions.begin()];
+        out_values[i] = WrappingAdd(values[i], offset * ticks_per_second);
+      }
+    }
+  }
+  *out = MakeArray(result);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status ExtractTemporal(FunctionContext* ctx, const Datum& values,
+                       TemporalComponent component, Datum* out) {
+  KernelProfileScope profile(ctx, "ExtractTemporal");
+  RETURN_NOT_OK(CheckTemporalValues(values, "ExtractTemporal"));
+  TemporalTicks ticks;
+  RETURN_NOT_OK(GetTemporalTicks(*values.type(), &ticks));
+  const auto out_type = int32();
+  const bool is_date32 = values.type()->id() == Type::DATE32;
+  return ExecuteTemporal(
+      ctx, values, out_type,
+      [&](FunctionContext* task_ctx, const ArrayData& input,
+          std::shared_ptr<Array>* piece) {
+        std::shared_ptr<ArrayData> result;
+        RETURN_NOT_OK(MakeTemporalPiece(task_ctx, input, out_type, &result));
+        int32_t* out_values = GetMutableValues<int32_t>(result.get(), 1);
+        if (is_date32) {
+          GetExtractFunction<int32_t>(component)(GetValues<int32_t>(input, 1),
+                                                 input.length, ticks.per_day,
+                                                 ticks.per_second, out_values);
+        } else {
+          GetExtractFunction<int64_t>(component)(GetValues<int64_t>(input, 1),
+                                                 input.length, ticks.per_day,
+                                                 ticks.per_second, out_values);
+        }
+        *piece = MakeArray(result);
+        return Status::OK();
+      },
+      out);
+}
+
+Status TruncateTemporal(FunctionContext* ctx, const Datum& values, TemporalUnit unit,
+                        Datum* out) {
+  KernelProfileScope profile(ctx, "TruncateTemporal");
+  RETURN_NOT_OK(CheckTemporalValues(values, "TruncateTemporal"));
+  TemporalTicks ticks;
+  RETURN_NOT_OK(GetTemporalTicks(*values.type(), &ticks));
+  int64_t multiple = ticks.per_day;
+  switch (unit) {
+    case TemporalUnit::HOUR:
+      multiple = 3600 * ticks.per_second;
+      break;
+    case TemporalUnit::MINUTE:
+      multiple = 60 * ticks.per_second;
+      break;
+    case TemporalUnit::SECOND:
+      multiple = ticks.per_second;
+      break;
+    default:
+      break;
+  }
+  // Dates are whole days
+  multiple = std::min(multiple, ticks.per_day);
+  const auto out_type = values.type();
+  const bool is_date32 = out_type->id() == Type::DATE32;
+  return ExecuteTemporal(
+      ctx, values, out_type,
+      [&](FunctionContext* task_ctx, const ArrayData& input,
+          std::shared_ptr<Array>* piece) {
+        std::shared_ptr<ArrayData> result;
+        RETURN_NOT_OK(MakeTemporalPiece(task_ctx, input, out_type, &result));
+        if (is_date32) {
+          GetTruncateFunction<int32_t>(unit)(
+              GetValues<int32_t>(input, 1), input.length, ticks.per_day, multiple,
+              GetMutableValues<int32_t>(result.get(), 1));
+        } else {
+          GetTruncateFunction<int64_t>(unit)(
+              GetValues<int64_t>(input, 1), input.length, ticks.per_day, multiple,
+              GetMutableValues<int64_t>(result.get(), 1));
+        }
+        *piece = MakeArray(result);
+        return Status::OK();
+      },
+      out);
+}
+
+Status ToLocalTime(FunctionContext* ctx, const Datum& values,
+                   const std::string& timezone, Datum* out) {
+  KernelProfileScope profile(ctx, "ToLocalTime");
+  RETURN_NOT_OK(CheckTemporalValues(values, "ToLocalTime"));
+  if (values.type()->id() != Type::TIMESTAMP) {
+    return Status::NotImplemented("ToLocalTime not implemented for " +
+                                  values.type()->ToString());
+  }
+  const auto& type = static_cast<const TimestampType&>(*values.type());
+  const std::string& zone_name = timezone.empty() ? type.timezone() : timezone;
+  if (zone_name.empty()) {
+    return Status::Invalid("ToLocalTime needs a timezone");
+  }
+  std::shared_ptr<const TimezoneTransitions> zone;
+  RETURN_NOT_OK(GetTimezoneTransitions(zone_name, &zone));
+  TemporalTicks ticks;
+  RETURN_NOT_OK(GetTemporalTicks(type, &ticks));
+  const auto out_type = ::arrow::timestamp(type.unit());
+  return ExecuteTemporal(
+      ctx, values, out_type,
+      [&](FunctionContext* task_ctx, const ArrayData& input,
+          std::shared_ptr<Array>* piece) {
+        return ToLocalTimePiece(task_ctx, input, out_type, *zone, ticks.per_second,
+                                piece);
+      },
+      out);
+}
+
+}  // namespace compute
+}  // namespace arrow
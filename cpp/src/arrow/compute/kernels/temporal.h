@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_TEMPORAL_H
+#define ARROW_COMPUTE_KERNELS_TEMPORAL_H
+
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+/// \brief A calendar or clock field of a date or timestamp
+enum class TemporalComponent {
+  YEAR,
+  /// 1 to 12
+  MONTH,
+  /// Day of the month, 1 to 31
+  DAY,
+  /// 0 for Monday to 6 for Sunday
+  DAY_OF_WEEK,
+  /// 1 to 366
+  DAY_OF_YEAR,
+  HOUR,
+  MINUTE,
+  SECOND
+};
+
+/// \brief Extract a field of dates or timestamps as int32 values
+///
+/// The values may be date32, date64 or timestamp, of any unit. They are
+/// interpreted in the proleptic Gregorian calendar, timestamps being taken
+/// as they are stored, i.e. in UTC for those with a timezone: convert them
+/// with ToLocalTime first to get the fields of their local time. The clock
+/// fields of dates are 0. Nulls are propagated.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array or chunked array of dates or timestamps
+/// \param[in] component the field to extract
+/// \param[out] out int32 array-like output
+ARROW_EXPORT
+Status ExtractTemporal(FunctionContext* context, const Datum& values,
+                       TemporalComponent component, Datum* out);
+
+/// \brief A unit to which dates and timestamps can be truncated
+enum class TemporalUnit {
+  YEAR,
+  MONTH,
+  /// Weeks starting on Monday
+  WEEK,
+  DAY,
+  HOUR,
+  MINUTE,
+  SECOND
+};
+
+/// \brief Round dates or timestamps down to the start of a calendar or clock
+/// unit
+///
+/// The output has the type of the values, as with ExtractTemporal. Dates are
+/// not changed by truncation to clock units. Nulls are propagated.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array or chunked array of dates or timestamps
+/// \param[in] unit the unit to truncate to
+/// \param[out] out array-like output
+ARROW_EXPORT
+Status TruncateTemporal(FunctionContext* context, const Datum& values, TemporalUnit unit,
+                        Datum* out);
+
+/// \brief Convert timestamps to the wall-clock time of a timezone
+///
+/// The output holds timestamps without a timezone, of the unit of the values,
+/// giving the local time of each instant in the timezone. Timestamps without
+/// a timezone are taken to be in UTC.
+///
+/// The timezone is "UTC", a fixed offset such as "+05:30", or a name of the
+/// tz database such as "Europe/Paris", read from the directory given by the
+/// TZDIR environment variable or /usr/share/zoneinfo. The transitions of a
+/// zone are loaded once per process, up to the year 2100 for zones with
+/// recurring daylight saving time. Chunks whose values all fall between two
+/// transitions are shifted by a single offset; others look up the
+/// transitions spanned by the chunk.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array or chunked array of timestamps
+/// \param[in] timezone the timezone, or empty to use that of the values' type
+/// \param[out] out array-like output
+ARROW_EXPORT
+Status ToLocalTime(FunctionContext* context, const Datum& values,
+                   const std::string& timezone, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_TEMPORAL_H
@@ -17,12 +17,17 @@
 
 #include "arrow/compute/kernels/util-internal.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/task-scheduler.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -50,6 +55,150 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
   return Status::OK();
 }
 
+Status ParallelInvoke(FunctionContext* ctx, int num_tasks,
+                      const std::function<Status(FunctionContext*, int)>& task) {
+  TaskScheduler* scheduler = ctx->task_scheduler();
+  if (scheduler != nullptr && num_tasks > 1) {
+    TaskGroup group(scheduler);
+    for (int i = 0; i < num_tasks; ++i) {
+      group.Append([ctx, &task, i]() {
+        FunctionContext task_ctx(ctx->memory_pool());
+        ctx->PrepareTaskContext(&task_ctx);
+        RETURN_NOT_OK(task(&task_ctx, i));
+        return task_ctx.status();
+      });
+    }
+    return group.Finish();
+  }
+
+  const int num_threads = std::min(ctx->num_threads(), num_tasks);
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(task(ctx, i));
+    }
+    return Status::OK();
+  }
+
+  return ParallelFor(num_threads, num_tasks, [ctx, &task](int i) {
+    FunctionContext task_ctx(ctx->memory_pool());
+    ctx->PrepareTaskContext(&task_ctx);
+    RETURN_NOT_OK(task(&task_ctx, i));
+    return task_ctx.status();
+  });
+}
+
+Status InvokeUnaryArrayKernelParallel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, std::vector<Datum>* outputs) {
+  if (value.kind() != Datum::CHUNKED_ARRAY) {
+    return InvokeUnaryArrayKernel(ctx, kernel, value, outputs);
+  }
+
+  const ChunkedArray& array = *value.chunked_array();
+  std::vector<Datum> chunk_outputs(array.num_chunks());
+  RETURN_NOT_OK(ParallelInvoke(ctx, array.num_chunks(),
+                               [&](FunctionContext* task_ctx, int i) {
+                                 return kernel->Call(task_ctx, Datum(array.chunk(i)),
+                                                     &chunk_outputs[i]);
+                               }));
+  outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
+  return Status::OK();
+}
+
+Status GetValidityAtZero(FunctionContext* ctx, const ArrayData& data,
+                         std::shared_ptr<Buffer>* out) {
+  if (data.offset == 0) {
+    *out = data.buffers[0];
+    return Status::OK();
+  }
+  return CopyBitmap(ctx->memory_pool(), data.buffers[0]->data(), data.offset,
+                    data.length, out);
+}
+
+Status ComputeValidity(FunctionContext* ctx, const ArrayData& left,
+                       const ArrayData* right, ArrayData* out) {
+  const bool left_nulls = HasValidityBitmap(left);
+  const bool right_nulls = right != nullptr && HasValidityBitmap(*right);
+  std::shared_ptr<Buffer> validity;
+  if (left_nulls && right_nulls) {
+    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
+                            right->buffers[0]->data(), right->offset, left.length,
+                            &validity));
+  } else if (left_nulls) {
+    RETURN_NOT_OK(GetValidityAtZero(ctx, left, &validity));
+  } else if (right_nulls) {
+    RETURN_NOT_OK(GetValidityAtZero(ctx, *right, &validity));
+  }
+
+  out->buffers[0] = validity;
+  out->null_count =
+      validity ? out->length - CountSetBits(validity->data(), 0, out->length) : 0;
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> RunValueType(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::RUN_LENGTH_ENCODED) {
+    return static_cast<const RunLengthEncodedType&>(*type).value_type();
+  }
+  return type;
+}
+
+std::shared_ptr<ArrayData> ReplaceRunValues(const RunLengthEncodedArray& runs,
+                                            const std::shared_ptr<DataType>& type,
+                                            const std::shared_ptr<ArrayData>& values) {
+  DCHECK_EQ(runs.num_runs(), values->length);
+  // The run ends stay absolute, so that the offset of runs is kept
+  std::shared_ptr<Buffer> run_ends = runs.run_ends();
+  if (run_ends != nullptr && runs.num_runs() < runs.values()->length()) {
+    run_ends = SliceBuffer(run_ends, runs.first_run() * sizeof(int32_t),
+                           runs.num_runs() * sizeof(int32_t));
+  }
+  auto out = ArrayData::Make(type, runs.length(), {nullptr, run_ends}, 0, runs.offset());
+  out->child_data.push_back(values);
+  return out;
+}
+
+static std::vector<std::shared_ptr<Array>> GetChunks(const Datum& value) {
+  if (value.kind() == Datum::ARRAY) {
+    return {MakeArray(value.array())};
+  }
+  return value.chunked_array()->chunks();
+}
+
+void AlignChunks(const Datum& left, const Datum& right,
+                 std::vector<std::shared_ptr<Array>>* left_pieces,
+                 std::vector<std::shared_ptr<Array>>* right_pieces) {
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+    left_pieces->push_back(MakeArray(left.array()));
+    right_pieces->push_back(MakeArray(right.array()));
+    return;
+  }
+
+  const std::vector<std::shared_ptr<Array>> left_chunks = GetChunks(left);
+  const std::vector<std::shared_ptr<Array>> right_chunks = GetChunks(right);
+  size_t left_index = 0, right_index = 0;
+  int64_t left_offset = 0, right_offset = 0;
+  auto Piece = [](const std::shared_ptr<Array>& chunk, int64_t offset, int64_t length) {
+    return length == chunk->length() ? chunk : chunk->Slice(offset, length);
+  };
+  while (left_index < left_chunks.size() && right_index < right_chunks.size()) {
+    const int64_t left_remaining = left_chunks[left_index]->length() - left_offset;
+    const int64_t right_remaining = right_chunks[right_index]->length() - right_offset;
+    if (left_remaining == 0) {
+      ++left_index;
+      left_offset = 0;
+    } else if (right_remaining == 0) {
+      ++right_index;
+      right_offset = 0;
+    } else {
+      const int64_t length = std::min(left_remaining, right_remaining);
+      left_pieces->push_back(Piece(left_chunks[left_index], left_offset, length));
+      right_pieces->push_back(Piece(right_chunks[right_index], right_offset, length));
+      left_offset += length;
+      right_offset += length;
+    }
+  }
+}
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays) {
   // Create right kind of datum
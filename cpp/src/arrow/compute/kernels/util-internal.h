@@ -18,11 +18,17 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/dispatch.h"
 
 namespace arrow {
 namespace compute {
@@ -72,6 +78,10 @@ template <typename T>
 using enable_if_binary =
     typename std::enable_if<std::is_base_of<BinaryType, T>::value>::type;
 
+template <typename T>
+using enable_if_string_view =
+    typename std::enable_if<std::is_same<StringViewType, T>::value>::type;
+
 template <typename T>
 using enable_if_boolean =
     typename std::enable_if<std::is_same<BooleanType, T>::value>::type;
@@ -96,6 +106,100 @@ inline T* GetMutableValues(const ArrayData* data, int i) {
   return reinterpret_cast<T*>(data->buffers[i]->mutable_data()) + data->offset;
 }
 
+/// \brief Whether data has a validity bitmap with nulls in it
+static inline bool HasValidityBitmap(const ArrayData& data) {
+  return data.null_count != 0 && data.buffers[0] != NULLPTR;
+}
+
+/// \brief Whether the loops over data must test its validity bits
+///
+/// Kernels instantiate their inner loops once without validity checks, taken
+/// when this is false. Unknown null counts, as left by slicing, are counted so
+/// that slices without nulls take those loops too
+static inline bool NeedsValidityChecks(const ArrayData& data) {
+  if (!HasValidityBitmap(data)) {
+    return false;
+  }
+  return data.null_count != kUnknownNullCount ||
+         CountSetBits(data.buffers[0]->data(), data.offset, data.length) != data.length;
+}
+
+/// \brief Call visit(position, length) for each run of consecutive set bits
+/// of a bitmap, positions being relative to offset
+///
+/// The bitmap is read a 64-bit word at a time: full words extend the current
+/// run and empty words are skipped, so that only mixed words are split
+template <typename Visit>
+void VisitSetBitRuns(const uint8_t* bitmap, int64_t offset, int64_t length,
+                     Visit&& visit) {
+  int64_t run_start = 0;
+  int64_t run_length = 0;
+  auto add_run = [&](int64_t start, int64_t count) {
+    if (run_start + run_length == start) {
+      run_length += count;
+    } else {
+      if (run_length > 0) {
+        visit(run_start, run_length);
+      }
+      run_start = start;
+      run_length = count;
+    }
+  };
+
+  // Leading bits, until the bitmap is read at a byte boundary
+  int64_t i = 0;
+  for (; i < length && (offset + i) % 8 != 0; ++i) {
+    if (BitUtil::GetBit(bitmap, offset + i)) {
+      add_run(i, 1);
+    }
+  }
+
+  for (; i + 64 <= length; i += 64) {
+    uint64_t word;
+    std::memcpy(&word, bitmap + (offset + i) / 8, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    if (word == ~static_cast<uint64_t>(0)) {
+      add_run(i, 64);
+      continue;
+    }
+    while (word != 0) {
+      const int start = BitUtil::CountTrailingZeros(word);
+      // The run ends at the first unset bit after start
+      const uint64_t unset = ~(word >> start);
+      const int count = unset == 0 ? 64 - start : BitUtil::CountTrailingZeros(unset);
+      add_run(i + start, count);
+      const int end = start + count;
+      word = end >= 64 ? 0 : word & ~((static_cast<uint64_t>(1) << end) - 1);
+    }
+  }
+
+  for (; i < length; ++i) {
+    if (BitUtil::GetBit(bitmap, offset + i)) {
+      add_run(i, 1);
+    }
+  }
+
+  if (run_length > 0) {
+    visit(run_start, run_length);
+  }
+}
+
+/// \brief Call visit(position, length) for each run of consecutive valid
+/// values of data, positions being relative to data.offset
+template <typename Visit>
+void VisitValidRuns(const ArrayData& data, Visit&& visit) {
+  const int64_t length = data.length;
+  if (length == 0 || data.null_count == length) {
+    return;
+  }
+  if (data.null_count == 0 || data.buffers[0] == NULLPTR) {
+    visit(0, length);
+    return;
+  }
+  VisitSetBitRuns(data.buffers[0]->data(), data.offset, length,
+                  std::forward<Visit>(visit));
+}
+
 static inline void CopyData(const ArrayData& input, ArrayData* output) {
   output->length = input.length;
   output->null_count = input.null_count;
@@ -106,9 +210,98 @@ static inline void CopyData(const ArrayData& input, ArrayData* output) {
 
 namespace detail {
 
+// Gathering fixed-width values by index, a loop which compilers vectorize with
+// gather instructions when targeting AVX2 or later
+
+#define ARROW_GATHER_LOOPS(SUFFIX, TARGET_ATTR)                           \
+  template <typename I, typename T>                                       \
+  TARGET_ATTR void GatherValues##SUFFIX(const I* indices, int64_t length, \
+                                        const T* values, T* out) {        \
+    for (int64_t i = 0; i < length; ++i) {                                \
+      out[i] = values[indices[i]];                                        \
+    }                                                                     \
+  }
+
+ARROW_GATHER_LOOPS(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ARROW_GATHER_LOOPS(Avx2, ARROW_TARGET_AVX2)
+ARROW_GATHER_LOOPS(Avx512, ARROW_TARGET_AVX512)
+#endif
+
+#undef ARROW_GATHER_LOOPS
+
+template <typename I, typename T>
+struct GatherValuesDynamic {
+  using DispatchLevel = internal::DispatchLevel;
+  using FunctionType = void (*)(const I*, int64_t, const T*, T*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, GatherValuesDefault<I, T>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::AVX2, GatherValuesAvx2<I, T>},
+        {DispatchLevel::AVX512, GatherValuesAvx512<I, T>},
+#endif
+    };
+  }
+};
+
+/// \brief Set out[i] = values[indices[i]] for i in [0, length), with the
+/// gather instructions of the host if it has any. The indices must be valid
+template <typename I, typename T>
+void GatherValues(const I* indices, int64_t length, const T* values, T* out) {
+  static internal::DynamicDispatch<GatherValuesDynamic<I, T>> dispatch;
+  dispatch.func(indices, length, values, out);
+}
+
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
+/// \brief Execute independent tasks using up to ctx->num_threads() threads,
+/// or on ctx->task_scheduler() if one is set
+///
+/// Each task is passed its own FunctionContext sharing the memory pool (and
+/// task scheduler) of ctx, so that kernels reporting errors through the
+/// context do not race with each other. The first error encountered is
+/// returned
+Status ParallelInvoke(FunctionContext* ctx, int num_tasks,
+                      const std::function<Status(FunctionContext*, int)>& task);
+
+/// \brief Like InvokeUnaryArrayKernel, but the chunks of a ChunkedArray are
+/// processed in parallel. The kernel must be safe to call concurrently
+Status InvokeUnaryArrayKernelParallel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, std::vector<Datum>* outputs);
+
+/// \brief Get the validity bitmap of data at offset 0, sharing the buffer of
+/// data if already at offset 0 and copying it otherwise. data must have a
+/// validity bitmap
+Status GetValidityAtZero(FunctionContext* ctx, const ArrayData& data,
+                         std::shared_ptr<Buffer>* out);
+
+/// \brief Set the validity bitmap and null count of the output of a binary
+/// operation, null where either side is null. right is null for a valid
+/// scalar side. The bitmap is at offset 0
+Status ComputeValidity(FunctionContext* ctx, const ArrayData& left,
+                       const ArrayData* right, ArrayData* out);
+
+/// \brief The value type of a run-length encoded type, or type itself
+std::shared_ptr<DataType> RunValueType(const std::shared_ptr<DataType>& type);
+
+/// \brief Make a run-length encoded array of the given type with the runs
+/// spanned by runs, whose values are given in order by values. The run ends
+/// of runs are shared
+std::shared_ptr<ArrayData> ReplaceRunValues(const RunLengthEncodedArray& runs,
+                                            const std::shared_ptr<DataType>& type,
+                                            const std::shared_ptr<ArrayData>& values);
+
+/// \brief Slice two array-like values of the same length at the chunk
+/// boundaries of both, so that the resulting pieces can be processed
+/// pairwise. Two arrays are returned as is, even if empty
+void AlignChunks(const Datum& left, const Datum& right,
+                 std::vector<std::shared_ptr<Array>>* left_pieces,
+                 std::vector<std::shared_ptr<Array>>* right_pieces);
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays);
 
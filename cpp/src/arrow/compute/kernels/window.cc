@@ -0,0 +1,702 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/window.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/compute/profiler.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Arithmetic
+
+template <typename Type>
+struct SumTraits {
+  using c_type = typename Type::c_type;
+  using OutType = typename std::conditional<
+      std::is_floating_point<c_type>::value, DoubleType,
+      typename std::conditional<std::is_signed<c_type>::value, Int64Type,
+                                UInt64Type>::type>::type;
+};
+
+// Integers wrap around on overflow, computing in unsigned arithmetic to
+// avoid undefined behaviour
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type WrappingAdd(T left,
+                                                                        T right) {
+  using U = typename std::make_unsigned<T>::type;
+  return static_cast<T>(static_cast<U>(left) + static_cast<U>(right));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type WrappingSubtract(T left,
+                                                                             T right) {
+  using U = typename std::make_unsigned<T>::type;
+  return static_cast<T>(static_cast<U>(left) - static_cast<U>(right));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type WrappingMultiply(T left,
+                                                                             T right) {
+  using U = typename std::make_unsigned<T>::type;
+  return static_cast<T>(static_cast<U>(left) * static_cast<U>(right));
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type WrappingAdd(T left,
+                                                                              T right) {
+  return left + right;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type WrappingSubtract(
+    T left, T right) {
+  return left - right;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type WrappingMultiply(
+    T left, T right) {
+  return left * right;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type IsFinite(T) {
+  return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type IsFinite(T value) {
+  return std::isfinite(value);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type IsNaN(T) {
+  return false;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type IsNaN(T value) {
+  return std::isnan(value);
+}
+
+bool IsRolling(WindowFunction function) {
+  return function == WindowFunction::ROLLING_SUM ||
+         function == WindowFunction::ROLLING_MEAN ||
+         function == WindowFunction::ROLLING_MIN ||
+         function == WindowFunction::ROLLING_MAX;
+}
+
+// Read the times of a chunk as int64
+Status ReadTimes(const Array& times, int64_t length, std::vector<int64_t>* out) {
+  if (times.length() != length) {
+    return Status::Invalid("Times must have the length of the values");
+  }
+  if (times.null_count() != 0) {
+    return Status::Invalid("Times must not be null");
+  }
+  const ArrayData& data = *times.data();
+  out->resize(static_cast<size_t>(length));
+  switch (times.type_id()) {
+    case Type::INT32:
+    case Type::DATE32:
+    case Type::TIME32: {
+      const int32_t* values = GetValues<int32_t>(data, 1);
+      std::copy(values, values + length, out->begin());
+    } break;
+    case Type::INT64:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP: {
+      const int64_t* values = GetValues<int64_t>(data, 1);
+      std::copy(values, values + length, out->begin());
+    } break;
+    default: {
+      std::stringstream ss;
+      ss << "Times must be int32, int64 or temporal values, got "
+         << times.type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Window kernels
+
+// Validates the input of Append, then hands a chunk to the function along
+// with the key of each of its rows that windows span: the row numbers for
+// row windows, or the times for time windows
+class WindowKernelImpl : public WindowKernel {
+ public:
+  WindowKernelImpl(const WindowOptions& options,
+                   const std::shared_ptr<DataType>& in_type,
+                   const std::shared_ptr<DataType>& out_type)
+      : options_(options),
+        in_type_(in_type),
+        out_type_(out_type),
+        has_time_(false),
+        last_time_(0) {}
+
+  Status Append(FunctionContext* ctx, const Array& values, const Array* times,
+                std::shared_ptr<Array>* out) override {
+    if (!values.type()->Equals(*in_type_)) {
+      std::stringstream ss;
+      ss << "Window kernel created for " << in_type_->ToString() << " got "
+         << values.type()->ToString();
+      return Status::Invalid(ss.str());
+    }
+    const int64_t* keys = nullptr;
+    if (IsRolling(options_.function) && options_.time_window > 0) {
+      if (times == nullptr) {
+        return Status::Invalid("Time windows need the times of the values");
+      }
+      RETURN_NOT_OK(ReadTimes(*times, values.length(), &times_));
+      for (int64_t time : times_) {
+        if (has_time_ && time < last_time_) {
+          return Status::Invalid("Times must be non-decreasing");
+        }
+        has_time_ = true;
+        last_time_ = time;
+      }
+      keys = times_.data();
+    }
+    return Consume(ctx->memory_pool(), *values.data(), keys, out);
+  }
+
+  Status Finish(FunctionContext* ctx, std::shared_ptr<Array>* out) override {
+    has_time_ = false;
+    return Flush(ctx->memory_pool(), out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ protected:
+  // Output the rows of a chunk. keys is null for row windows
+  virtual Status Consume(MemoryPool* pool, const ArrayData& values,
+                         const int64_t* keys, std::shared_ptr<Array>* out) = 0;
+
+  // Output the rows held back, then reset the state
+  virtual Status Flush(MemoryPool* pool, std::shared_ptr<Array>* out) = 0;
+
+  WindowOptions options_;
+  std::shared_ptr<DataType> in_type_;
+  std::shared_ptr<DataType> out_type_;
+
+ private:
+  std::vector<int64_t> times_;
+  bool has_time_;
+  int64_t last_time_;
+};
+
+// Call visit(i, is_valid) for each row of values
+template <typename Visit>
+void VisitRows(const ArrayData& values, Visit&& visit) {
+  const uint8_t* valid_bits =
+      values.null_count == 0 || values.buffers[0] == nullptr ? nullptr
+                                                             : values.buffers[0]->data();
+  for (int64_t i = 0; i < values.length; ++i) {
+    visit(i, valid_bits == nullptr || BitUtil::GetBit(valid_bits, values.offset + i));
+  }
+}
+
+template <typename OutType>
+Status FinishEmpty(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                   std::shared_ptr<Array>* out) {
+  NumericBuilder<OutType> builder(type, pool);
+  return builder.Finish(out);
+}
+
+template <typename InType, bool kIsProduct>
+class CumulativeKernel : public WindowKernelImpl {
+ public:
+  using OutType = typename SumTraits<InType>::OutType;
+  using T = typename OutType::c_type;
+
+  CumulativeKernel(const WindowOptions& options, const std::shared_ptr<DataType>& type)
+      : WindowKernelImpl(options, type, TypeTraits<OutType>::type_singleton()),
+        value_(kIsProduct ? 1 : 0) {}
+
+ protected:
+  Status Consume(MemoryPool* pool, const ArrayData& values, const int64_t* keys,
+                 std::shared_ptr<Array>* out) override {
+    NumericBuilder<OutType> builder(out_type_, pool);
+    RETURN_NOT_OK(builder.Reserve(values.length));
+    const auto* in = GetValues<typename InType::c_type>(values, 1);
+    VisitRows(values, [&](int64_t i, bool is_valid) {
+      if (is_valid) {
+        const T value = static_cast<T>(in[i]);
+        value_ =
+            kIsProduct ? WrappingMultiply(value_, value) : WrappingAdd(value_, value);
+        builder.UnsafeAppend(value_);
+      } else {
+        builder.UnsafeAppendToBitmap(false);
+      }
+    });
+    return builder.Finish(out);
+  }
+
+  Status Flush(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    value_ = kIsProduct ? 1 : 0;
+    return FinishEmpty<OutType>(out_type_, pool, out);
+  }
+
+ private:
+  T value_;
+};
+
+template <typename InType, WindowFunction kFunction>
+struct RollingTraits {
+  // Sums of ROLLING_MEAN are kept in double
+  using OutType = typename std::conditional<
+      kFunction == WindowFunction::ROLLING_SUM, typename SumTraits<InType>::OutType,
+      typename std::conditional<kFunction == WindowFunction::ROLLING_MEAN, DoubleType,
+                                InType>::type>::type;
+};
+
+// The window ending at a row holds the non-null values whose keys k' are in
+// (k - width, k], k being the key of the row. Sums are updated as values enter
+// and leave the window, except for floating point values that are not
+// finite, which are counted instead so that a sum that saw an infinity or a
+// NaN does not stay so: windows holding some are summed in full.
+template <typename InType, WindowFunction kFunction>
+class RollingKernel : public WindowKernelImpl {
+ public:
+  using InT = typename InType::c_type;
+  using OutType = typename RollingTraits<InType, kFunction>::OutType;
+  using OutT = typename OutType::c_type;
+  using SumT = typename std::conditional<kFunction == WindowFunction::ROLLING_MIN ||
+                                             kFunction == WindowFunction::ROLLING_MAX,
+                                         InT, OutT>::type;
+
+  static constexpr bool kIsExtreme = kFunction == WindowFunction::ROLLING_MIN ||
+                                     kFunction == WindowFunction::ROLLING_MAX;
+
+  RollingKernel(const WindowOptions& options, const std::shared_ptr<DataType>& type)
+      : WindowKernelImpl(options, type,
+                         MakeOutType(type, std::integral_constant<bool, kIsExtreme>())),
+        width_(options.time_window > 0 ? options.time_window : options.window_size) {
+    Reset();
+  }
+
+ protected:
+  Status Consume(MemoryPool* pool, const ArrayData& values, const int64_t* keys,
+                 std::shared_ptr<Array>* out) override {
+    NumericBuilder<OutType> builder(out_type_, pool);
+    RETURN_NOT_OK(builder.Reserve(values.length));
+    const InT* in = GetValues<InT>(values, 1);
+    VisitRows(values, [&](int64_t i, bool is_valid) {
+      const int64_t key = keys == nullptr ? row_++ : keys[i];
+      Expire(key);
+      if (is_valid) {
+        Push(key, in[i]);
+      }
+      if (static_cast<int64_t>(window_.size()) >= options_.min_periods) {
+        builder.UnsafeAppend(Value());
+      } else {
+        builder.UnsafeAppendToBitmap(false);
+      }
+    });
+    return builder.Finish(out);
+  }
+
+  Status Flush(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    Reset();
+    return FinishEmpty<OutType>(out_type_, pool, out);
+  }
+
+ private:
+  static std::shared_ptr<DataType> MakeOutType(const std::shared_ptr<DataType>& type,
+                                               std::true_type) {
+    return type;
+  }
+
+  static std::shared_ptr<DataType> MakeOutType(const std::shared_ptr<DataType>&,
+                                               std::false_type) {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+  void Reset() {
+    window_.clear();
+    extremes_.clear();
+    sum_ = 0;
+    num_non_finite_ = 0;
+    row_ = 0;
+  }
+
+  void Expire(int64_t key) {
+    while (!window_.empty() && window_.front().first <= key - width_) {
+      const InT value = window_.front().second;
+      if (!kIsExtreme) {
+        if (IsFinite(value)) {
+          sum_ = WrappingSubtract(sum_, static_cast<SumT>(value));
+        } else {
+          --num_non_finite_;
+        }
+      }
+      window_.pop_front();
+    }
+    while (!extremes_.empty() && extremes_.front().first <= key - width_) {
+      extremes_.pop_front();
+    }
+  }
+
+  void Push(int64_t key, InT value) {
+    window_.emplace_back(key, value);
+    if (kIsExtreme) {
+      // NaN values are not ordered, hence ignored
+      if (IsNaN(value)) {
+        return;
+      }
+      // Keep the extremes strictly increasing for MIN, decreasing for MAX
+      while (!extremes_.empty() && !Precedes(extremes_.back().second, value)) {
+        extremes_.pop_back();
+      }
+      extremes_.emplace_back(key, value);
+    } else if (IsFinite(value)) {
+      sum_ = WrappingAdd(sum_, static_cast<SumT>(value));
+    } else {
+      ++num_non_finite_;
+    }
+  }
+
+  static bool Precedes(InT extreme, InT value) {
+    return kFunction == WindowFunction::ROLLING_MIN ? extreme < value : extreme > value;
+  }
+
+  OutT Value() const {
+    if (kIsExtreme) {
+      // A window of NaN values only
+      return extremes_.empty() ? static_cast<OutT>(window_.front().second)
+                               : static_cast<OutT>(extremes_.front().second);
+    }
+    SumT sum = sum_;
+    if (num_non_finite_ > 0) {
+      sum = 0;
+      for (const auto& entry : window_) {
+        sum = WrappingAdd(sum, static_cast<SumT>(entry.second));
+      }
+    }
+    if (kFunction == WindowFunction::ROLLING_MEAN) {
+      return static_cast<OutT>(static_cast<double>(sum) /
+                               static_cast<double>(window_.size()));
+    }
+    return static_cast<OutT>(sum);
+  }
+
+  const int64_t width_;
+  // The non-null values of the window, with their keys
+  std::deque<std::pair<int64_t, InT>> window_;
+  // For MIN and MAX, the values of the window that may become its extreme
+  std::deque<std::pair<int64_t, InT>> extremes_;
+  SumT sum_;
+  int64_t num_non_finite_;
+  int64_t row_;
+};
+
+// Lags keep the last `periods` rows, starting with nulls. Leads skip the
+// first -periods rows, then output each row as the value of the row -periods
+// rows before it, the rows held back being null on Finish.
+template <typename InType>
+class ShiftKernel : public WindowKernelImpl {
+ public:
+  using T = typename InType::c_type;
+
+  ShiftKernel(const WindowOptions& options, const std::shared_ptr<DataType>& type)
+      : WindowKernelImpl(options, type, type) {
+    Reset();
+  }
+
+ protected:
+  Status Consume(MemoryPool* pool, const ArrayData& values, const int64_t* keys,
+                 std::shared_ptr<Array>* out) override {
+    NumericBuilder<InType> builder(out_type_, pool);
+    RETURN_NOT_OK(builder.Reserve(values.length));
+    const T* in = GetValues<T>(values, 1);
+    VisitRows(values, [&](int64_t i, bool is_valid) {
+      std::pair<T, bool> row(is_valid ? in[i] : T(), is_valid);
+      if (options_.periods > 0) {
+        history_.push_back(row);
+        row = history_.front();
+        history_.pop_front();
+      } else if (num_held_ < -options_.periods) {
+        ++num_held_;
+        return;
+      }
+      if (row.second) {
+        builder.UnsafeAppend(row.first);
+      } else {
+        builder.UnsafeAppendToBitmap(false);
+      }
+    });
+    return builder.Finish(out);
+  }
+
+  Status Flush(MemoryPool* pool, std::shared_ptr<Array>* out) override {
+    NumericBuilder<InType> builder(out_type_, pool);
+    RETURN_NOT_OK(builder.Reserve(num_held_));
+    for (int64_t i = 0; i < num_held_; ++i) {
+      builder.UnsafeAppendToBitmap(false);
+    }
+    Reset();
+    return builder.Finish(out);
+  }
+
+ private:
+  void Reset() {
+    history_.assign(static_cast<size_t>(std::max<int64_t>(options_.periods, 0)),
+                    std::make_pair(T(), false));
+    num_held_ = 0;
+  }
+
+  std::deque<std::pair<T, bool>> history_;
+  int64_t num_held_;
+};
+
+Status CheckWindowOptions(const WindowOptions& options) {
+  if (IsRolling(options.function)) {
+    if (options.time_window < 0) {
+      return Status::Invalid("Time windows must be positive");
+    }
+    if (options.time_window == 0 && options.window_size < 1) {
+      return Status::Invalid("Windows must span at least one row");
+    }
+    if (options.min_periods < 1) {
+      return Status::Invalid("Windows need at least one value");
+    }
+  }
+  return Status::OK();
+}
+
+template <typename InType>
+void MakeRollingKernel(const WindowOptions& options,
+                       const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<WindowKernel>* out) {
+  switch (options.function) {
+    case WindowFunction::ROLLING_SUM:
+      out->reset(new RollingKernel<InType, WindowFunction::ROLLING_SUM>(options, type));
+      break;
+    case WindowFunction::ROLLING_MEAN:
+      out->reset(new RollingKernel<InType, WindowFunction::ROLLING_MEAN>(options, type));
+      break;
+    case WindowFunction::ROLLING_MIN:
+      out->reset(new RollingKernel<InType, WindowFunction::ROLLING_MIN>(options, type));
+      break;
+    case WindowFunction::ROLLING_MAX:
+      out->reset(new RollingKernel<InType, WindowFunction::ROLLING_MAX>(options, type));
+      break;
+    default:
+      break;
+  }
+}
+
+template <typename InType>
+void MakeNumericKernel(const WindowOptions& options,
+                       const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<WindowKernel>* out) {
+  switch (options.function) {
+    case WindowFunction::CUMULATIVE_SUM:
+      out->reset(new CumulativeKernel<InType, false>(options, type));
+      break;
+    case WindowFunction::CUMULATIVE_PRODUCT:
+      out->reset(new CumulativeKernel<InType, true>(options, type));
+      break;
+    case WindowFunction::SHIFT:
+      out->reset(new ShiftKernel<InType>(options, type));
+      break;
+    default:
+      MakeRollingKernel<InType>(options, type, out);
+      break;
+  }
+}
+
+// Temporal values have no sums
+template <typename InType>
+void MakeTemporalKernel(const WindowOptions& options,
+                        const std::shared_ptr<DataType>& type,
+                        std::unique_ptr<WindowKernel>* out) {
+  switch (options.function) {
+    case WindowFunction::ROLLING_MIN:
+      out->reset(new RollingKernel<InType, WindowFunction::ROLLING_MIN>(options, type));
+      break;
+    case WindowFunction::ROLLING_MAX:
+      out->reset(new RollingKernel<InType, WindowFunction::ROLLING_MAX>(options, type));
+      break;
+    case WindowFunction::SHIFT:
+      out->reset(new ShiftKernel<InType>(options, type));
+      break;
+    default:
+      break;
+  }
+}
+
+// Compute the function over pieces of values, and of times if not null,
+// splitting the chunks of both at the boundaries of either
+Status ExecuteWindow(FunctionContext* ctx, const Datum& values, const Datum* times,
+                     const WindowOptions& options, Datum* out) {
+  if (!values.is_arraylike() || (times != nullptr && !times->is_arraylike())) {
+    return Status::Invalid("Window expects arrays or chunked arrays");
+  }
+  std::unique_ptr<WindowKernel> kernel;
+  RETURN_NOT_OK(GetWindowKernel(ctx, values.type(), options, &kernel));
+
+  auto get_chunks = [](const Datum& datum) {
+    return datum.kind() == Datum::ARRAY ? ArrayVector{MakeArray(datum.array())}
+                                        : datum.chunked_array()->chunks();
+  };
+  const ArrayVector value_chunks = get_chunks(values);
+  ArrayVector outputs;
+  std::shared_ptr<Array> piece;
+  if (times == nullptr) {
+    for (const auto& chunk : value_chunks) {
+      RETURN_NOT_OK(kernel->Append(ctx, *chunk, nullptr, &piece));
+      outputs.push_back(piece);
+    }
+  } else {
+    auto get_length = [](const Datum& datum) {
+      return datum.kind() == Datum::ARRAY ? datum.array()->length
+                                          : datum.chunked_array()->length();
+    };
+    if (get_length(*times) != get_length(values)) {
+      return Status::Invalid("Times must have the length of the values");
+    }
+    const ArrayVector time_chunks = get_chunks(*times);
+    size_t time_chunk = 0;
+    int64_t time_offset = 0;
+    for (const auto& chunk : value_chunks) {
+      int64_t offset = 0;
+      while (offset < chunk->length()) {
+        while (time_offset == time_chunks[time_chunk]->length()) {
+          ++time_chunk;
+          time_offset = 0;
+        }
+        const int64_t length = std::min(chunk->length() - offset,
+                                        time_chunks[time_chunk]->length() - time_offset);
+        const auto time_piece = time_chunks[time_chunk]->Slice(time_offset, length);
+        RETURN_NOT_OK(
+            kernel->Append(ctx, *chunk->Slice(offset, length), time_piece.get(), &piece));
+        outputs.push_back(piece);
+        offset += length;
+        time_offset += length;
+      }
+    }
+  }
+  RETURN_NOT_OK(kernel->Finish(ctx, &piece));
+  if (piece->length() > 0 || outputs.empty()) {
+    outputs.push_back(piece);
+  }
+
+  if (values.kind() == Datum::CHUNKED_ARRAY) {
+    *out = Datum(std::make_shared<ChunkedArray>(outputs));
+  } else if (outputs.size() == 1) {
+    *out = Datum(outputs[0]->data());
+  } else {
+    std::shared_ptr<Array> result;
+    RETURN_NOT_OK(Concatenate(outputs, ctx->memory_pool(), &result));
+    *out = Datum(result->data());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status GetWindowKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                       const WindowOptions& options,
+                       std::unique_ptr<WindowKernel>* kernel) {
+  RETURN_NOT_OK(CheckWindowOptions(options));
+  kernel->reset();
+
+#define NUMERIC_CASE(InType)                          \
+  case InType::type_id:                               \
+    MakeNumericKernel<InType>(options, type, kernel); \
+    break
+
+#define TEMPORAL_CASE(InType)                          \
+  case InType::type_id:                                \
+    MakeTemporalKernel<InType>(options, type, kernel); \
+    break
+
+  switch (type->id()) {
+    NUMERIC_CASE(UInt8Type);
+    NUMERIC_CASE(Int8Type);
+    NUMERIC_CASE(UInt16Type);
+    NUMERIC_CASE(Int16Type);
+    NUMERIC_CASE(UInt32Type);
+    NUMERIC_CASE(Int32Type);
+    NUMERIC_CASE(UInt64Type);
+    NUMERIC_CASE(Int64Type);
+    NUMERIC_CASE(FloatType);
+    NUMERIC_CASE(DoubleType);
+    TEMPORAL_CASE(Date32Type);
+    TEMPORAL_CASE(Date64Type);
+    TEMPORAL_CASE(Time32Type);
+    TEMPORAL_CASE(Time64Type);
+    TEMPORAL_CASE(TimestampType);
+    default:
+      break;
+  }
+
+#undef NUMERIC_CASE
+#undef TEMPORAL_CASE
+
+  if (!*kernel) {
+    std::stringstream ss;
+    ss << "Window function not implemented for " << type->ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+Status Window(FunctionContext* ctx, const Datum& values, const WindowOptions& options,
+              Datum* out) {
+  KernelProfileScope profile(ctx, "Window");
+  return ExecuteWindow(ctx, values, nullptr, options, out);
+}
+
+Status Window(FunctionContext* ctx, const Datum& values, const Datum& times,
+              const WindowOptions& options, Datum* out) {
+  KernelProfileScope profile(ctx, "Window");
+  return ExecuteWindow(ctx, values, &times, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_WINDOW_H
+#define ARROW_COMPUTE_KERNELS_WINDOW_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+class FunctionContext;
+struct Datum;
+
+enum class WindowFunction {
+  /// Sum of the values up to each row
+  CUMULATIVE_SUM,
+  /// Product of the values up to each row
+  CUMULATIVE_PRODUCT,
+  /// Sum of the values in the window ending at each row
+  ROLLING_SUM,
+  ROLLING_MEAN,
+  ROLLING_MIN,
+  ROLLING_MAX,
+  /// Value of the row `periods` rows before each row
+  SHIFT
+};
+
+struct ARROW_EXPORT WindowOptions {
+  explicit WindowOptions(WindowFunction function = WindowFunction::CUMULATIVE_SUM)
+      : function(function), window_size(1), time_window(0), min_periods(1), periods(1) {}
+
+  WindowFunction function;
+
+  /// For rolling functions, the number of rows of the window, the current row
+  /// included. Ignored if time_window is set
+  int64_t window_size;
+
+  /// For rolling functions, if positive, the window ending at a row spans the
+  /// rows whose times t' are in (t - time_window, t], t being the time of the
+  /// row, in the unit of the times
+  int64_t time_window;
+
+  /// For rolling functions, the number of non-null values a window needs for
+  /// its output not to be null
+  int64_t min_periods;
+
+  /// For SHIFT, the number of rows to shift by: positive values lag, negative
+  /// values lead
+  int64_t periods;
+};
+
+/// \class WindowKernel
+/// \brief Cumulative, rolling and shift functions over a stream of chunks
+///
+/// The state of the function is carried from a chunk to the next, so that a
+/// column can be processed a batch at a time as it is read. Rolling windows
+/// keep the non-null values they span in a deque, and ROLLING_MIN and
+/// ROLLING_MAX a monotonic deque of the candidate extremes, so that each
+/// value is pushed and popped once whatever the size of the window.
+///
+/// Null values are skipped: the output of a null row is null for cumulative
+/// functions, which go on with the next row, and rolling windows count the
+/// non-null values they span against min_periods.
+///
+/// CUMULATIVE_SUM, CUMULATIVE_PRODUCT and ROLLING_SUM yield int64 for signed
+/// integers, wrapping around on overflow, uint64 for unsigned integers and
+/// double for floating point values. ROLLING_MEAN yields double, while
+/// ROLLING_MIN, ROLLING_MAX and SHIFT keep the value type, which may also be
+/// a date, time or timestamp for them.
+class ARROW_EXPORT WindowKernel {
+ public:
+  virtual ~WindowKernel() = default;
+
+  /// \brief Process a chunk of values
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] values the chunk, of the type the kernel was created for
+  /// \param[in] times the non-null, non-decreasing times of the rows when
+  /// time_window is set, otherwise null. Integer, date, time or timestamp
+  /// values of the length of values
+  /// \param[out] out the output of the rows appended so far that is known,
+  /// that is all of them except for the last -periods rows when SHIFT leads
+  virtual Status Append(FunctionContext* ctx, const Array& values, const Array* times,
+                        std::shared_ptr<Array>* out) = 0;
+
+  /// \brief Output the rows held back, then start over
+  virtual Status Finish(FunctionContext* ctx, std::shared_ptr<Array>* out) = 0;
+
+  /// \brief The type of the output
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetWindowKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                       const WindowOptions& options,
+                       std::unique_ptr<WindowKernel>* kernel);
+
+/// \brief Compute a window function over an array or chunked array
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[in] options the function, see WindowKernel
+/// \param[out] out array-like output, of the length of values
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Window(FunctionContext* context, const Datum& values,
+              const WindowOptions& options, Datum* out);
+
+/// \brief Compute a window function with time-based windows
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[in] times array-like times of the values, see WindowKernel::Append,
+/// whose chunks may differ from those of values
+/// \param[in] options the function, see WindowKernel
+/// \param[out] out array-like output, of the length of values
+///
+/// \since 0.10.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Window(FunctionContext* context, const Datum& values, const Datum& times,
+              const WindowOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_WINDOW_H
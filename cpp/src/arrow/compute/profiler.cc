@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/profiler.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace arrow {
+namespace compute {
+
+KernelProfiler::KernelProfiler() {}
+
+KernelProfiler::KernelProfiler(Sink sink) : sink_(std::move(sink)) {}
+
+void KernelProfiler::Record(const KernelEvent& event) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    KernelStats& stats = stats_[event.kernel];
+    ++stats.num_calls;
+    stats.wall_time_ns += event.wall_time_ns;
+    stats.bytes_allocated += event.bytes_allocated;
+  }
+  if (sink_) {
+    sink_(event);
+  }
+}
+
+std::map<std::string, KernelStats> KernelProfiler::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void KernelProfiler::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.clear();
+}
+
+void KernelProfileScope::Start() {
+  ctx_->in_kernel_ = true;
+  start_bytes_ = ctx_->bytes_allocated();
+  start_time_ = std::chrono::steady_clock::now();
+}
+
+void KernelProfileScope::Finish() {
+  const auto elapsed = std::chrono::steady_clock::now() - start_time_;
+  ctx_->in_kernel_ = false;
+
+  KernelEvent event;
+  event.kernel = kernel_;
+  event.wall_time_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  event.bytes_allocated = ctx_->bytes_allocated() - start_bytes_;
+  ctx_->profiler()->Record(event);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_PROFILER_H
+#define ARROW_COMPUTE_PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "arrow/compute/context.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/tracing.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+/// \brief A single kernel invocation, as reported to a KernelProfiler
+struct ARROW_EXPORT KernelEvent {
+  /// Name of the kernel, e.g. "Cast"
+  const char* kernel;
+  /// Wall time of the invocation in nanoseconds
+  int64_t wall_time_ns;
+  /// Bytes allocated through FunctionContext::Allocate during the invocation
+  int64_t bytes_allocated;
+};
+
+/// \brief Totals of the invocations of one kernel
+struct ARROW_EXPORT KernelStats {
+  KernelStats() : num_calls(0), wall_time_ns(0), bytes_allocated(0) {}
+
+  int64_t num_calls;
+  int64_t wall_time_ns;
+  int64_t bytes_allocated;
+};
+
+/// \brief Collects the invocations of the kernels run with a FunctionContext
+///
+/// Only calls to the top-level kernel functions (e.g. Cast or Take) are
+/// recorded: the time and allocations of kernels they invoke internally,
+/// including on other threads, are attributed to them.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT KernelProfiler {
+ public:
+  using Sink = std::function<void(const KernelEvent&)>;
+
+  KernelProfiler();
+
+  /// \param[in] sink called with each event, e.g. to export it to a metrics
+  /// system. It may be called concurrently from several threads
+  explicit KernelProfiler(Sink sink);
+
+  /// \brief Add an event to the totals and pass it to the sink. Thread-safe
+  void Record(const KernelEvent& event);
+
+  /// \brief Return the totals of each kernel invoked so far, by name
+  std::map<std::string, KernelStats> stats() const;
+
+  /// \brief Clear the totals
+  void Reset();
+
+ private:
+  Sink sink_;
+  mutable std::mutex mutex_;
+  std::map<std::string, KernelStats> stats_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(KernelProfiler);
+};
+
+/// \brief Record the invocation of a kernel during the lifetime of the scope
+///
+/// Does nothing unless the context has a profiler, or when nested in another
+/// scope of the context or of the context a parallel task was created by.
+/// When built with ARROW_TRACING, the invocation, nested or not, is also
+/// traced as a span of the "compute" category.
+class ARROW_EXPORT KernelProfileScope {
+ public:
+  KernelProfileScope(FunctionContext* ctx, const char* kernel)
+      : ctx_(NULLPTR), kernel_(kernel), start_bytes_(0), trace_start_ns_(-1) {
+#ifdef ARROW_WITH_TRACING
+    if (ARROW_PREDICT_FALSE(IsTracing())) {
+      trace_start_ns_ = ::arrow::internal::TraceClockNanos();
+    }
+#endif
+    if (ARROW_PREDICT_FALSE(ctx->profiler() != NULLPTR) && !ctx->in_kernel_) {
+      ctx_ = ctx;
+      Start();
+    }
+  }
+  ~KernelProfileScope() {
+    if (ARROW_PREDICT_FALSE(ctx_ != NULLPTR)) {
+      Finish();
+    }
+    if (ARROW_PREDICT_FALSE(trace_start_ns_ >= 0)) {
+      ::arrow::internal::RecordTraceSpan("compute", kernel_, trace_start_ns_,
+                                         ::arrow::internal::TraceClockNanos());
+    }
+  }
+
+ private:
+  void Start();
+  void Finish();
+
+  FunctionContext* ctx_;
+  const char* kernel_;
+  std::chrono::steady_clock::time_point start_time_;
+  int64_t start_bytes_;
+  int64_t trace_start_ns_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(KernelProfileScope);
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_PROFILER_H
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/converter.h"
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+namespace csv {
+namespace internal {
+
+static Status ConversionError(const DataType& type, const char* data, int32_t length) {
+  std::stringstream ss;
+  ss << "CSV conversion error to " << type.ToString() << ": invalid value '"
+     << std::string(data, length) << "'";
+  return Status::Invalid(ss.str());
+}
+
+template <typename T>
+static typename std::enable_if<std::is_integral<T>::value, bool>::type ParseNumber(
+    const char* s, int32_t length, T* out) {
+  return ::arrow::internal::ParseInteger(s, length, out);
+}
+
+template <typename T>
+static typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+ParseNumber(const char* s, int32_t length, T* out) {
+  return ::arrow::internal::ParseFloat(s, length, out);
+}
+
+template <typename ArrowType>
+class NumberConverter : public Converter {
+ public:
+  NumberConverter(MemoryPool* pool, const std::shared_ptr<DataType>& type)
+      : builder_(type, pool) {}
+
+  Status Append(const char* data, int32_t length) override {
+    if (length == 0) {
+      return builder_.AppendNull();
+    }
+    typename ArrowType::c_type value;
+    if (ARROW_PREDICT_FALSE(!ParseNumber(data, length, &value))) {
+      return ConversionError(*builder_.type(), data, length);
+    }
+    return builder_.Append(value);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override { return builder_.Finish(out); }
+
+ private:
+  NumericBuilder<ArrowType> builder_;
+};
+
+class TimestampConverter : public Converter {
+ public:
+  TimestampConverter(MemoryPool* pool, const std::shared_ptr<DataType>& type)
+      : unit_(static_cast<const TimestampType&>(*type).unit()), builder_(type, pool) {}
+
+  Status Append(const char* data, int32_t length) override {
+    if (length == 0) {
+      return builder_.AppendNull();
+    }
+    int64_t value;
+    if (ARROW_PREDICT_FALSE(
+            !::arrow::internal::ParseTimestamp(data, length, unit_, &value))) {
+      return ConversionError(*builder_.type(), data, length);
+    }
+    return builder_.Append(value);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override { return builder_.Finish(out); }
+
+ private:
+  TimeUnit::type unit_;
+  TimestampBuilder builder_;
+};
+
+// Strings and binary values are kept as they are, empty ones included
+class StringConverter : public Converter {
+ public:
+  StringConverter(MemoryPool* pool, const std::shared_ptr<DataType>& type)
+      : builder_(type, pool) {}
+
+  Status Append(const char* data, int32_t length) override {
+    return builder_.Append(data, length);
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override { return builder_.Finish(out); }
+
+ private:
+  BinaryBuilder builder_;
+};
+
+class NullConverter : public Converter {
+ public:
+  explicit NullConverter(MemoryPool* pool) : builder_(pool) {}
+
+  Status Append(const char* data, int32_t length) override {
+    if (length != 0) {
+      return ConversionError(*null(), data, length);
+    }
+    return builder_.AppendNull();
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override { return builder_.Finish(out); }
+
+ private:
+  NullBuilder builder_;
+};
+
+Status Converter::Make(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                       std::unique_ptr<Converter>* out) {
+#define NUMBER_CASE(ENUM, ArrowType)                        \
+  case Type::ENUM:                                          \
+    out->reset(new NumberConverter<ArrowType>(pool, type)); \
+    break;
+
+  switch (type->id()) {
+    NUMBER_CASE(INT8, Int8Type);
+    NUMBER_CASE(INT16, Int16Type);
+    NUMBER_CASE(INT32, Int32Type);
+    NUMBER_CASE(INT64, Int64Type);
+    NUMBER_CASE(UINT8, UInt8Type);
+    NUMBER_CASE(UINT16, UInt16Type);
+    NUMBER_CASE(UINT32, UInt32Type);
+    NUMBER_CASE(UINT64, UInt64Type);
+    NUMBER_CASE(FLOAT, FloatType);
+    NUMBER_CASE(DOUBLE, DoubleType);
+    case Type::TIMESTAMP:
+      out->reset(new TimestampConverter(pool, type));
+      break;
+    case Type::STRING:
+    case Type::BINARY:
+      out->reset(new StringConverter(pool, type));
+      break;
+    case Type::NA:
+      out->reset(new NullConverter(pool));
+      break;
+    default:
+      return Status::NotImplemented("CSV conversion to " + type->ToString());
+  }
+
+#undef NUMBER_CASE
+
+  return Status::OK();
+}
+
+// Append all the values, stopping at the first invalid one
+static Status ConvertAll(const StringArray& values, Converter* converter) {
+  for (int64_t i = 0; i < values.length(); ++i) {
+    int32_t length;
+    const uint8_t* value = values.GetValue(i, &length);
+    RETURN_NOT_OK(converter->Append(reinterpret_cast<const char*>(value), length));
+  }
+  return Status::OK();
+}
+
+Status InferAndConvert(MemoryPool* pool, const StringArray& values,
+                       std::shared_ptr<Array>* out) {
+  bool all_empty = true;
+  for (int64_t i = 0; i < values.length() && all_empty; ++i) {
+    all_empty = values.value_length(i) == 0;
+  }
+
+  std::vector<std::shared_ptr<DataType>> candidates;
+  if (!all_empty) {
+    candidates = {int64(), float64(), timestamp(TimeUnit::SECOND),
+                  timestamp(TimeUnit::NANO)};
+  }
+
+  std::unique_ptr<Converter> converter;
+  for (const auto& type : candidates) {
+    RETURN_NOT_OK(Converter::Make(pool, type, &converter));
+    if (ConvertAll(values, converter.get()).ok()) {
+      return converter->Finish(out);
+    }
+  }
+  // Any value is a string
+  RETURN_NOT_OK(Converter::Make(pool, utf8(), &converter));
+  RETURN_NOT_OK(ConvertAll(values, converter.get()));
+  return converter->Finish(out);
+}
+
+}  // namespace internal
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Conversion of CSV fields to typed arrays
+
+#ifndef ARROW_CSV_CONVERTER_H
+#define ARROW_CSV_CONVERTER_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class MemoryPool;
+class StringArray;
+
+namespace csv {
+namespace internal {
+
+/// \brief Builder of an array from the text of its values
+class ARROW_EXPORT Converter {
+ public:
+  virtual ~Converter() = default;
+
+  /// \brief Append a value, an empty one being null except for string and
+  /// binary types
+  ///
+  /// \return Status, Invalid if the value is not a valid one of the type
+  virtual Status Append(const char* data, int32_t length) = 0;
+
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+
+  /// \brief Create a converter to a type
+  ///
+  /// \return Status, NotImplemented for unsupported types
+  static Status Make(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                     std::unique_ptr<Converter>* out);
+};
+
+/// \brief Convert text values to the first type that holds all of them
+///
+/// The types tried are int64, double, timestamp[s], timestamp[ns] and,
+/// eventually, utf8. Columns of empty values stay utf8
+///
+/// \param[in] pool the pool of the converted array
+/// \param[in] values the text values
+/// \param[out] out the converted array
+/// \return Status
+ARROW_EXPORT
+Status InferAndConvert(MemoryPool* pool, const StringArray& values,
+                       std::shared_ptr<Array>* out);
+
+}  // namespace internal
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_CONVERTER_H
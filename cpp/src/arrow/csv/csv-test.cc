@@ -0,0 +1,265 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::BlockParser;
+using internal::FieldView;
+
+// ----------------------------------------------------------------------
+// Parsing
+
+static std::vector<std::vector<std::string>> ParseAll(const ReadOptions& options,
+                                                      const std::string& csv) {
+  BlockParser parser(options);
+  std::vector<std::vector<std::string>> rows;
+  std::vector<FieldView> fields;
+  int64_t position = 0;
+  bool has_row = true;
+  while (true) {
+    EXPECT_OK(parser.ParseRow(csv.data(), static_cast<int64_t>(csv.size()), &position,
+                              &fields, &has_row));
+    if (!has_row) {
+      break;
+    }
+    std::vector<std::string> row;
+    for (const auto& field : fields) {
+      row.emplace_back(field.data, field.length);
+    }
+    rows.push_back(row);
+  }
+  return rows;
+}
+
+TEST(TestBlockParser, Basics) {
+  ReadOptions options;
+  auto rows = ParseAll(options, "a,b,c\n1,,3\r\n\n4,5,\n6,7,8");
+  std::vector<std::vector<std::string>> expected = {
+      {"a", "b", "c"}, {"1", "", "3"}, {"4", "5", ""}, {"6", "7", "8"}};
+  ASSERT_EQ(expected, rows);
+
+  options.delimiter = '\t';
+  rows = ParseAll(options, "a,b\tc\n");
+  expected = {{"a,b", "c"}};
+  ASSERT_EQ(expected, rows);
+}
+
+TEST(TestBlockParser, Quoting) {
+  ReadOptions options;
+  auto rows = ParseAll(options, "\"a,b\",\"c\nd\",\"say \"\"hi\"\"\"\r\n\"\",x\n");
+  std::vector<std::vector<std::string>> expected = {{"a,b", "c\nd", "say \"hi\""},
+                                                    {"", "x"}};
+  ASSERT_EQ(expected, rows);
+
+  options.quoting = false;
+  rows = ParseAll(options, "\"a,b\"\n");
+  expected = {{"\"a", "b\""}};
+  ASSERT_EQ(expected, rows);
+
+  BlockParser parser(ReadOptions{});
+  std::vector<FieldView> fields;
+  bool has_row;
+  for (std::string csv : {"\"abc", "\"ab\"c,d"}) {
+    int64_t position = 0;
+    ASSERT_RAISES(Invalid,
+                  parser.ParseRow(csv.data(), static_cast<int64_t>(csv.size()),
+                                  &position, &fields, &has_row));
+  }
+}
+
+TEST(TestBlockParser, WholeRowsLength) {
+  ReadOptions options;
+  std::string csv = "a,b\n\"c\nd\",e\n\"f\n";
+  ASSERT_EQ(12, internal::WholeRowsLength(options, csv.data(), csv.size()));
+  ASSERT_EQ(4, internal::WholeRowsLength(options, csv.data(), 6));
+
+  options.quoting = false;
+  ASSERT_EQ(static_cast<int64_t>(csv.size()),
+            internal::WholeRowsLength(options, csv.data(), csv.size()));
+}
+
+// ----------------------------------------------------------------------
+// Conversion
+
+static std::shared_ptr<Array> MakeStrings(const std::vector<std::string>& values) {
+  std::shared_ptr<Array> out;
+  ArrayFromVector<StringType, std::string>(values, &out);
+  return out;
+}
+
+static void AssertInferred(const std::vector<std::string>& values,
+                           const std::shared_ptr<DataType>& expected_type) {
+  std::shared_ptr<Array> out;
+  auto strings = MakeStrings(values);
+  ASSERT_OK(internal::InferAndConvert(default_memory_pool(),
+                                      static_cast<const StringArray&>(*strings), &out));
+  ASSERT_TRUE(out->type()->Equals(expected_type)) << out->type()->ToString();
+  ASSERT_EQ(static_cast<int64_t>(values.size()), out->length());
+}
+
+TEST(TestConverter, Infer) {
+  AssertInferred({"1", "", "-3"}, int64());
+  AssertInferred({"1", "2.5", "nan"}, float64());
+  AssertInferred({"2018-01-01", "", "2018-01-01 10:00:00"}, timestamp(TimeUnit::SECOND));
+  AssertInferred({"2018-01-01 10:00:00.123"}, timestamp(TimeUnit::NANO));
+  AssertInferred({"1", "a"}, utf8());
+  AssertInferred({"", ""}, utf8());
+  AssertInferred({}, utf8());
+}
+
+TEST(TestConverter, Values) {
+  std::unique_ptr<internal::Converter> converter;
+  ASSERT_OK(internal::Converter::Make(default_memory_pool(), int16(), &converter));
+  ASSERT_OK(converter->Append("12", 2));
+  ASSERT_OK(converter->Append("", 0));
+  ASSERT_RAISES(Invalid, converter->Append("70000", 5));
+  ASSERT_RAISES(Invalid, converter->Append("x", 1));
+
+  std::shared_ptr<Array> out, expected;
+  ASSERT_OK(converter->Finish(&out));
+  ArrayFromVector<Int16Type, int16_t>({true, false}, {12, 0}, &expected);
+  ASSERT_TRUE(out->Equals(expected));
+
+  ASSERT_OK(internal::Converter::Make(default_memory_pool(), utf8(), &converter));
+  ASSERT_OK(converter->Append("", 0));
+  ASSERT_OK(converter->Finish(&out));
+  ASSERT_TRUE(out->Equals(MakeStrings({""})));
+
+  ASSERT_RAISES(NotImplemented, internal::Converter::Make(default_memory_pool(),
+                                                         list(int32()), &converter));
+}
+
+// ----------------------------------------------------------------------
+// Reading
+
+static Status ReadCsv(const std::string& csv, const ReadOptions& options,
+                      std::shared_ptr<Table>* out) {
+  auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(csv));
+  std::shared_ptr<Reader> reader;
+  RETURN_NOT_OK(Reader::Open(default_memory_pool(), input, options, &reader));
+  return reader->ReadAll(out);
+}
+
+static std::shared_ptr<Array> ColumnValues(const Table& table, int i) {
+  std::shared_ptr<Array> out;
+  EXPECT_OK(Concatenate(table.column(i)->data()->chunks(), default_memory_pool(), &out));
+  return out;
+}
+
+static const char* kCsv =
+    "int,float,time,str\n"
+    "1,1.5,2018-01-01,a\n"
+    "2,,2018-01-02 03:04:05,\"b,c\"\n"
+    ",-3,,\n";
+
+TEST(TestReader, InferTypes) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(ReadCsv(kCsv, ReadOptions(), &table));
+
+  auto expected_schema =
+      schema({field("int", int64()), field("float", float64()),
+              field("time", timestamp(TimeUnit::SECOND)), field("str", utf8())});
+  ASSERT_TRUE(table->schema()->Equals(*expected_schema));
+  ASSERT_EQ(3, table->num_rows());
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int64Type, int64_t>({true, true, false}, {1, 2, 0}, &expected);
+  ASSERT_TRUE(ColumnValues(*table, 0)->Equals(expected));
+  ArrayFromVector<DoubleType, double>({true, false, true}, {1.5, 0, -3}, &expected);
+  ASSERT_TRUE(ColumnValues(*table, 1)->Equals(expected));
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND),
+                                          {true, true, false},
+                                          {1514764800, 1514862245, 0}, &expected);
+  ASSERT_TRUE(ColumnValues(*table, 2)->Equals(expected));
+  ASSERT_TRUE(ColumnValues(*table, 3)->Equals(MakeStrings({"a", "b,c", ""})));
+}
+
+TEST(TestReader, ColumnTypesAndBlocks) {
+  ReadOptions options;
+  options.column_types["int"] = int32();
+  options.column_types["str"] = binary();
+  // Blocks smaller than a row hold a row each
+  options.block_size = 4;
+
+  for (bool use_threads : {false, true}) {
+    options.use_threads = use_threads;
+    std::shared_ptr<Table> table;
+    ASSERT_OK(ReadCsv(kCsv, options, &table));
+    ASSERT_EQ(3, table->num_rows());
+    ASSERT_EQ(3, table->column(0)->data()->num_chunks());
+    ASSERT_TRUE(table->schema()->field(0)->type()->Equals(int32()));
+    ASSERT_TRUE(table->schema()->field(3)->type()->Equals(binary()));
+
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<Int32Type, int32_t>({true, true, false}, {1, 2, 0}, &expected);
+    ASSERT_TRUE(ColumnValues(*table, 0)->Equals(expected));
+  }
+}
+
+TEST(TestReader, NoHeader) {
+  ReadOptions options;
+  options.header = false;
+  std::shared_ptr<Table> table;
+  ASSERT_OK(ReadCsv("1,x\n2,y", options, &table));
+  auto expected_schema = schema({field("f0", int64()), field("f1", utf8())});
+  ASSERT_TRUE(table->schema()->Equals(*expected_schema));
+  ASSERT_EQ(2, table->num_rows());
+}
+
+TEST(TestReader, Empty) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(ReadCsv("", ReadOptions(), &table));
+  ASSERT_EQ(0, table->num_columns());
+
+  ASSERT_OK(ReadCsv("a,b\n", ReadOptions(), &table));
+  ASSERT_EQ(2, table->num_columns());
+  ASSERT_EQ(0, table->num_rows());
+}
+
+TEST(TestReader, Errors) {
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, ReadCsv("a,b\n1,2\n3\n", ReadOptions(), &table));
+
+  // Types are inferred from the first block only
+  ReadOptions options;
+  options.block_size = 4;
+  ASSERT_RAISES(Invalid, ReadCsv("a\n1\nx\n", options, &table));
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_OPTIONS_H
+#define ARROW_CSV_OPTIONS_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace csv {
+
+struct ARROW_EXPORT ReadOptions {
+  ReadOptions()
+      : delimiter(','),
+        quoting(true),
+        quote_char('"'),
+        header(true),
+        block_size(1 << 20),
+        use_threads(true) {}
+
+  /// Separator of the fields of a row
+  char delimiter;
+
+  /// Whether fields may be quoted, in which case they can hold delimiters
+  /// and ends of line, a quote being written as two quotes
+  bool quoting;
+  char quote_char;
+
+  /// Whether the first row holds the column names. Otherwise the columns are
+  /// named "f0", "f1", ...
+  bool header;
+
+  /// Approximate number of bytes parsed into each record batch. Blocks are
+  /// extended to the end of their last row
+  int64_t block_size;
+
+  /// Parse several blocks at once on the CPU thread pool
+  bool use_threads;
+
+  /// The types of some of the columns, by name. The types of the other
+  /// columns are inferred from the first block
+  std::unordered_map<std::string, std::shared_ptr<DataType>> column_types;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_OPTIONS_H
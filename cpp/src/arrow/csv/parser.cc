@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/parser.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+
+namespace arrow {
+namespace csv {
+namespace internal {
+
+BlockParser::BlockParser(const ReadOptions& options)
+    : delimiter_(options.delimiter),
+      quoting_(options.quoting),
+      quote_char_(options.quote_char) {}
+
+Status BlockParser::ParseRow(const char* data, int64_t size, int64_t* position,
+                             std::vector<FieldView>* fields, bool* has_row) {
+  int64_t pos = *position;
+  while (pos < size && (data[pos] == '\n' || data[pos] == '\r')) {
+    ++pos;
+  }
+  fields->clear();
+  if (pos == size) {
+    *position = pos;
+    *has_row = false;
+    return Status::OK();
+  }
+
+  // Unquoted values are never longer than their quoted field, so that the
+  // rest of the data always fits and the views are not invalidated
+  if (static_cast<int64_t>(unquoted_.size()) < size - pos) {
+    unquoted_.resize(static_cast<size_t>(size - pos));
+  }
+  char* out = &unquoted_[0];
+
+  while (true) {
+    if (quoting_ && pos < size && data[pos] == quote_char_) {
+      char* begin = out;
+      ++pos;
+      while (true) {
+        if (pos == size) {
+          return Status::Invalid("Unterminated quoted field in CSV data");
+        }
+        const char c = data[pos++];
+        if (c == quote_char_) {
+          if (pos < size && data[pos] == quote_char_) {
+            // Two quotes stand for one
+            ++pos;
+          } else {
+            break;
+          }
+        }
+        *out++ = c;
+      }
+      fields->push_back({begin, static_cast<int32_t>(out - begin)});
+      if (pos < size && data[pos] == '\r') {
+        ++pos;
+      }
+      if (pos < size && data[pos] != delimiter_ && data[pos] != '\n') {
+        return Status::Invalid("Unexpected character after a quoted field in CSV data");
+      }
+    } else {
+      const int64_t begin = pos;
+      while (pos < size && data[pos] != delimiter_ && data[pos] != '\n') {
+        ++pos;
+      }
+      int64_t end = pos;
+      if ((pos == size || data[pos] == '\n') && end > begin && data[end - 1] == '\r') {
+        --end;
+      }
+      fields->push_back({data + begin, static_cast<int32_t>(end - begin)});
+    }
+
+    if (pos == size) {
+      break;
+    }
+    if (data[pos++] == '\n') {
+      break;
+    }
+  }
+  *position = pos;
+  *has_row = true;
+  return Status::OK();
+}
+
+int64_t WholeRowsLength(const ReadOptions& options, const char* data, int64_t size) {
+  if (!options.quoting) {
+    for (int64_t i = size; i > 0; --i) {
+      if (data[i - 1] == '\n') {
+        return i;
+      }
+    }
+    return 0;
+  }
+  // Ends of line in quoted fields do not end rows, so the quotes are
+  // followed from the start
+  int64_t length = 0;
+  bool in_quotes = false;
+  for (int64_t i = 0; i < size; ++i) {
+    if (data[i] == options.quote_char) {
+      in_quotes = !in_quotes;
+    } else if (data[i] == '\n' && !in_quotes) {
+      length = i + 1;
+    }
+  }
+  return length;
+}
+
+}  // namespace internal
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Splitting CSV data into rows and fields
+
+#ifndef ARROW_CSV_PARSER_H
+#define ARROW_CSV_PARSER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+namespace internal {
+
+/// A field of a parsed row, pointing into the parsed data, or into the
+/// parser itself for quoted fields
+struct FieldView {
+  const char* data;
+  int32_t length;
+};
+
+/// \brief Parser of the rows of a block of CSV data
+///
+/// The fields of a row stay valid until the next row is parsed
+class ARROW_EXPORT BlockParser {
+ public:
+  explicit BlockParser(const ReadOptions& options);
+
+  /// \brief Parse the row at a position of data, skipping blank lines
+  ///
+  /// \param[in] data the data to parse
+  /// \param[in] size the size of the data
+  /// \param[in,out] position the position of the row, moved past its end of
+  /// line
+  /// \param[out] fields the fields of the row
+  /// \param[out] has_row false at the end of the data
+  /// \return Status, Invalid on malformed quoted fields
+  Status ParseRow(const char* data, int64_t size, int64_t* position,
+                  std::vector<FieldView>* fields, bool* has_row);
+
+ private:
+  const char delimiter_;
+  const bool quoting_;
+  const char quote_char_;
+
+  // The unquoted values of the quoted fields of the current row
+  std::string unquoted_;
+};
+
+/// \brief Return the length of the leading whole rows of data
+///
+/// That is the position after the last end of line that is not in a quoted
+/// field, or 0 if there is none
+ARROW_EXPORT
+int64_t WholeRowsLength(const ReadOptions& options, const char* data, int64_t size);
+
+}  // namespace internal
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_PARSER_H
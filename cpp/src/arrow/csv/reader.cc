@@ -0,0 +1,281 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/reader.h"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/parser.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace csv {
+
+class Reader::ReaderImpl {
+ public:
+  ReaderImpl(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+             const ReadOptions& options)
+      : pool_(pool), input_(input), options_(options), num_columns_(0), eof_(false) {}
+
+  Status Open() {
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Block size must be positive");
+    }
+    if (options_.delimiter == '\n' ||
+        (options_.quoting && options_.quote_char == options_.delimiter)) {
+      return Status::Invalid("Invalid CSV delimiter");
+    }
+
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(ReadBlock(&block));
+
+    // The first row gives the number of columns, and their names
+    std::vector<std::string> names;
+    if (block) {
+      internal::BlockParser parser(options_);
+      int64_t position = 0;
+      std::vector<internal::FieldView> fields;
+      bool has_row;
+      RETURN_NOT_OK(parser.ParseRow(reinterpret_cast<const char*>(block->data()),
+                                    block->size(), &position, &fields, &has_row));
+      for (size_t i = 0; i < fields.size(); ++i) {
+        names.push_back(options_.header ? std::string(fields[i].data, fields[i].length)
+                                        : "f" + std::to_string(i));
+      }
+      if (options_.header) {
+        block = SliceBuffer(block, position, block->size() - position);
+      }
+    }
+    num_columns_ = static_cast<int>(names.size());
+
+    // The columns without a given type are read as strings, then converted
+    // to the type inferred from them
+    std::vector<bool> inferred(num_columns_);
+    types_.resize(num_columns_);
+    for (int i = 0; i < num_columns_; ++i) {
+      auto it = options_.column_types.find(names[i]);
+      inferred[i] = it == options_.column_types.end();
+      types_[i] = inferred[i] ? utf8() : it->second;
+    }
+    std::vector<std::shared_ptr<Array>> columns;
+    int64_t num_rows = 0;
+    if (block) {
+      RETURN_NOT_OK(ParseBlock(*block, &columns, &num_rows));
+    }
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i = 0; i < num_columns_; ++i) {
+      if (inferred[i]) {
+        RETURN_NOT_OK(internal::InferAndConvert(
+            pool_, static_cast<const StringArray&>(*columns[i]), &columns[i]));
+        types_[i] = columns[i]->type();
+      }
+      fields.push_back(field(names[i], types_[i]));
+    }
+    schema_ = ::arrow::schema(fields);
+    if (num_rows > 0) {
+      batches_.push_back(RecordBatch::Make(schema_, num_rows, std::move(columns)));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    while (batches_.empty()) {
+      if (eof_ && !partial_) {
+        out->reset();
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ParseNextBlocks());
+    }
+    *out = batches_.front();
+    batches_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  // Read the next block of whole rows, or null at the end of the input
+  Status ReadBlock(std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<Buffer> block = partial_;
+    partial_.reset();
+    while (!eof_) {
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(input_->Read(options_.block_size, &data));
+      if (data->size() == 0) {
+        eof_ = true;
+        break;
+      }
+      if (block && block->size() > 0) {
+        std::shared_ptr<Buffer> joined;
+        RETURN_NOT_OK(AllocateBuffer(pool_, block->size() + data->size(), &joined));
+        std::memcpy(joined->mutable_data(), block->data(),
+                    static_cast<size_t>(block->size()));
+        std::memcpy(joined->mutable_data() + block->size(), data->data(),
+                    static_cast<size_t>(data->size()));
+        block = joined;
+      } else {
+        block = data;
+      }
+
+      const int64_t length = internal::WholeRowsLength(
+          options_, reinterpret_cast<const char*>(block->data()), block->size());
+      if (length > 0) {
+        partial_ = SliceBuffer(block, length, block->size() - length);
+        *out = SliceBuffer(block, 0, length);
+        return Status::OK();
+      }
+    }
+    // The last row may not end with an end of line
+    *out = block && block->size() > 0 ? block : nullptr;
+    return Status::OK();
+  }
+
+  Status ParseBlock(const Buffer& block, std::vector<std::shared_ptr<Array>>* columns,
+                    int64_t* num_rows) {
+    std::vector<std::unique_ptr<internal::Converter>> converters(num_columns_);
+    for (int i = 0; i < num_columns_; ++i) {
+      RETURN_NOT_OK(internal::Converter::Make(pool_, types_[i], &converters[i]));
+    }
+
+    internal::BlockParser parser(options_);
+    const char* data = reinterpret_cast<const char*>(block.data());
+    int64_t position = 0;
+    std::vector<internal::FieldView> fields;
+    *num_rows = 0;
+    while (true) {
+      bool has_row;
+      RETURN_NOT_OK(parser.ParseRow(data, block.size(), &position, &fields, &has_row));
+      if (!has_row) {
+        break;
+      }
+      if (static_cast<int>(fields.size()) != num_columns_) {
+        std::stringstream ss;
+        ss << "Expected " << num_columns_ << " fields in a CSV row, got "
+           << fields.size();
+        return Status::Invalid(ss.str());
+      }
+      for (int i = 0; i < num_columns_; ++i) {
+        RETURN_NOT_OK(converters[i]->Append(fields[i].data, fields[i].length));
+      }
+      ++*num_rows;
+    }
+
+    columns->resize(num_columns_);
+    for (int i = 0; i < num_columns_; ++i) {
+      RETURN_NOT_OK(converters[i]->Finish(&(*columns)[i]));
+    }
+    return Status::OK();
+  }
+
+  // Read a block per thread and parse them concurrently, into one batch each
+  Status ParseNextBlocks() {
+    const int num_threads = options_.use_threads ? GetCpuThreadPoolCapacity() : 1;
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    while (static_cast<int>(blocks.size()) < num_threads) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(ReadBlock(&block));
+      if (!block) {
+        break;
+      }
+      blocks.push_back(block);
+    }
+
+    const int num_blocks = static_cast<int>(blocks.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_blocks);
+    RETURN_NOT_OK(ParallelFor(num_threads, num_blocks, [&](int i) {
+      std::vector<std::shared_ptr<Array>> columns;
+      int64_t num_rows = 0;
+      RETURN_NOT_OK(ParseBlock(*blocks[i], &columns, &num_rows));
+      batches[i] = RecordBatch::Make(schema_, num_rows, std::move(columns));
+      return Status::OK();
+    }));
+
+    for (const auto& batch : batches) {
+      if (batch->num_rows() > 0) {
+        batches_.push_back(batch);
+      }
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
+  ReadOptions options_;
+
+  int num_columns_;
+  std::vector<std::shared_ptr<DataType>> types_;
+  std::shared_ptr<Schema> schema_;
+
+  // The start of a row whose end has not been read yet
+  std::shared_ptr<Buffer> partial_;
+  bool eof_;
+
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
+Reader::Reader() {}
+
+Reader::~Reader() {}
+
+Status Reader::Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                    const ReadOptions& options, std::shared_ptr<Reader>* out) {
+  std::shared_ptr<Reader> result(new Reader());
+  result->impl_.reset(new ReaderImpl(pool, input, options));
+  RETURN_NOT_OK(result->impl_->Open());
+  *out = result;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> Reader::schema() const { return impl_->schema(); }
+
+Status Reader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+Status Reader::ReadAll(std::shared_ptr<Table>* out) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  return Table::FromRecordBatches(schema(), batches, out);
+}
+
+}  // namespace csv
+}  // namespace arrow
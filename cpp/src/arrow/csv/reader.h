@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_READER_H
+#define ARROW_CSV_READER_H
+
+#include <memory>
+
+#include "arrow/csv/options.h"  // IWYU pragma: export
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Schema;
+class Table;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace csv {
+
+/// \class Reader
+/// \brief Read CSV data as record batches
+///
+/// The input is read in blocks of whole rows, which are parsed concurrently
+/// on the CPU thread pool into one record batch each, so that memory use is
+/// bounded by the block size and the number of threads. Empty fields are
+/// nulls, except in string columns
+class ARROW_EXPORT Reader : public RecordBatchReader {
+ public:
+  ~Reader() override;
+
+  /// \brief Open a reader, reading the column names and inferring the
+  /// column types from the first block
+  ///
+  /// \param[in] pool a MemoryPool to use for buffer allocations
+  /// \param[in] input the CSV data
+  /// \param[in] options the reading options
+  /// \param[out] out the created reader
+  /// \return Status
+  static Status Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                     const ReadOptions& options, std::shared_ptr<Reader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+  /// \brief Read the remaining record batches as a table, whose columns have
+  /// one chunk per block
+  ///
+  /// \param[out] out the read table
+  /// \return Status
+  Status ReadAll(std::shared_ptr<Table>* out);
+
+ private:
+  Reader();
+
+  class ARROW_NO_EXPORT ReaderImpl;
+  std::unique_ptr<ReaderImpl> impl_;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_READER_H
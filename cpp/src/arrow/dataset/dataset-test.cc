@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/io/file.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestDataset : public ::testing::Test {
+ public:
+  void SetUp() {
+    root_ = "arrow-test-dataset";
+    fs_ = std::make_shared<io::LocalFileSystem>();
+    io::FileStatistics stat;
+    if (fs_->Stat(root_, &stat).ok()) {
+      ASSERT_OK(fs_->DeleteDirectory(root_));
+    }
+
+    schema_ = ::arrow::schema(
+        {field("day", int32()), field("name", utf8()), field("v", int64())});
+    std::shared_ptr<Array> day, name, v;
+    ArrayFromVector<Int32Type, int32_t>({true, true, true, false}, {1, 2, 1, 0}, &day);
+    ArrayFromVector<StringType, std::string>({"a", "a", "b", "a"}, &name);
+    ArrayFromVector<Int64Type, int64_t>({0, 1, 2, 3}, &v);
+    auto batch1 = RecordBatch::Make(schema_, 4, {day, name, v});
+    ArrayFromVector<Int32Type, int32_t>({2, 1}, &day);
+    ArrayFromVector<StringType, std::string>({"a", "a"}, &name);
+    ArrayFromVector<Int64Type, int64_t>({4, 5}, &v);
+    auto batch2 = RecordBatch::Make(schema_, 2, {day, name, v});
+    ASSERT_OK(Table::FromRecordBatches({batch1, batch2}, &table_));
+  }
+
+  void TearDown() {
+    io::FileStatistics stat;
+    if (fs_->Stat(root_, &stat).ok()) {
+      ASSERT_OK(fs_->DeleteDirectory(root_));
+    }
+  }
+
+  Status Write(const std::vector<std::string>& partition_columns) {
+    TableBatchReader reader(*table_);
+    DatasetWriteOptions options;
+    options.partition_columns = partition_columns;
+    options.num_threads = 4;
+    return WriteDataset(fs_, root_, &reader, options);
+  }
+
+  template <typename ArrowType, typename CType>
+  void AssertColumn(const Table& table, int i, const std::vector<bool>& is_valid,
+                    const std::vector<CType>& values) {
+    std::shared_ptr<Array> expected;
+    if (is_valid.empty()) {
+      ArrayFromVector<ArrowType, CType>(values, &expected);
+    } else {
+      ArrayFromVector<ArrowType, CType>(is_valid, values, &expected);
+    }
+    ASSERT_TRUE(table.column(i)->data()->Equals(ChunkedArray({expected})));
+  }
+
+ protected:
+  std::string root_;
+  std::shared_ptr<io::LocalFileSystem> fs_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(TestDataset, WriteAndDiscover) {
+  ASSERT_OK(Write({"day", "name"}));
+  // Marker files are ignored
+  std::shared_ptr<io::OutputStream> marker;
+  ASSERT_OK(fs_->OpenOutputStream(root_ + "/_SUCCESS", &marker));
+  ASSERT_OK(marker->Close());
+
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_OK(Dataset::Discover(fs_, root_ + "/", &dataset));
+  ASSERT_EQ(std::vector<std::string>({"day", "name"}), dataset->partition_names());
+  const auto& fragments = dataset->fragments();
+  ASSERT_EQ(4, fragments.size());
+  ASSERT_EQ(root_ + "/day=1/name=a/part-0.arrow", fragments[0].path);
+  ASSERT_EQ(root_ + "/day=1/name=b/part-0.arrow", fragments[1].path);
+  ASSERT_EQ("2", fragments[2].keys[0].value);
+  ASSERT_FALSE(fragments[2].keys[0].is_null);
+  ASSERT_TRUE(fragments[3].keys[0].is_null);
+  ASSERT_EQ("a", fragments[3].keys[1].value);
+}
+
+TEST_F(TestDataset, ReadAll) {
+  ASSERT_OK(Write({"day", "name"}));
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_OK(Dataset::Discover(fs_, root_, &dataset));
+
+  // The rows of each partition are in write order
+  DatasetReadOptions options;
+  options.num_threads = 4;
+  std::shared_ptr<Table> result;
+  ASSERT_OK(dataset->Read(options, &result));
+  ASSERT_EQ(3, result->num_columns());
+  ASSERT_EQ("v", result->schema()->field(0)->name());
+  AssertColumn<Int64Type, int64_t>(*result, 0, {}, {0, 5, 2, 1, 4, 3});
+  AssertColumn<StringType, std::string>(*result, 1,
+                                        {true, true, true, true, true, false},
+                                        {"1", "1", "1", "2", "2", ""});
+  AssertColumn<StringType, std::string>(*result, 2, {},
+                                        {"a", "a", "b", "a", "a", "a"});
+}
+
+TEST_F(TestDataset, PruneAndProject) {
+  ASSERT_OK(Write({"day"}));
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_OK(Dataset::Discover(fs_, root_, &dataset));
+  ASSERT_EQ(3, dataset->fragments().size());
+
+  DatasetReadOptions options;
+  options.columns = {"v", "day", "name"};
+  options.filter = PartitionKeyEquals("day", "2");
+  std::shared_ptr<Table> result;
+  ASSERT_OK(dataset->Read(options, &result));
+  ASSERT_EQ(3, result->num_columns());
+  AssertColumn<Int64Type, int64_t>(*result, 0, {}, {1, 4});
+  AssertColumn<StringType, std::string>(*result, 1, {}, {"2", "2"});
+  AssertColumn<StringType, std::string>(*result, 2, {}, {"a", "a"});
+
+  // Without any partition left, the table is empty
+  options.filter = PartitionKeyEquals("day", "9");
+  ASSERT_OK(dataset->Read(options, &result));
+  ASSERT_EQ(0, result->num_rows());
+  ASSERT_EQ(3, result->num_columns());
+}
+
+TEST_F(TestDataset, Errors) {
+  DatasetWriteOptions options;
+  TableBatchReader reader(*table_);
+  options.partition_columns = {"missing"};
+  ASSERT_RAISES(Invalid, WriteDataset(fs_, root_, &reader, options));
+
+  auto float_schema = ::arrow::schema({field("f", float64())});
+  std::shared_ptr<Array> f;
+  ArrayFromVector<DoubleType, double>({1.5}, &f);
+  std::shared_ptr<Table> float_table;
+  ASSERT_OK(Table::FromRecordBatches({RecordBatch::Make(float_schema, 1, {f})},
+                                     &float_table));
+  TableBatchReader float_reader(*float_table);
+  options.partition_columns = {"f"};
+  ASSERT_RAISES(NotImplemented, WriteDataset(fs_, root_, &float_reader, options));
+
+  std::shared_ptr<Dataset> dataset;
+  ASSERT_OK(fs_->MakeDirectory(root_ + "/not-a-partition"));
+  ASSERT_OK(Dataset::Discover(fs_, root_, &dataset));
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, dataset->Read(DatasetReadOptions(), &result));
+
+  ASSERT_OK(Write({"day"}));
+  ASSERT_OK(Dataset::Discover(fs_, root_, &dataset));
+  DatasetReadOptions read_options;
+  read_options.columns = {"missing"};
+  ASSERT_RAISES(Invalid, dataset->Read(read_options, &result));
+
+  std::shared_ptr<io::OutputStream> stray;
+  ASSERT_OK(fs_->OpenOutputStream(root_ + "/not-a-partition/stray.arrow", &stray));
+  ASSERT_OK(stray->Close());
+  ASSERT_RAISES(Invalid, Dataset::Discover(fs_, root_, &dataset));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,469 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/dataset.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+namespace dataset {
+
+const char kNullPartitionValue[] = "__HIVE_DEFAULT_PARTITION__";
+
+namespace {
+
+std::string StripTrailingSlashes(const std::string& path) {
+  size_t end = path.size();
+  while (end > 1 && path[end - 1] == '/') {
+    --end;
+  }
+  return path.substr(0, end);
+}
+
+bool IsHidden(const std::string& name) {
+  return name.empty() || name[0] == '.' || name[0] == '_';
+}
+
+// Parse the path of a file relative to the base directory. Hidden files are
+// skipped, leaving *keep false
+Status ParseFragment(const std::string& path, const std::string& relative_path,
+                     DataFragment* out, bool* keep) {
+  std::vector<std::string> segments;
+  size_t begin = 0;
+  while (true) {
+    const size_t end = relative_path.find('/', begin);
+    segments.push_back(relative_path.substr(begin, end - begin));
+    if (end == std::string::npos) {
+      break;
+    }
+    begin = end + 1;
+  }
+  *keep = false;
+  for (const std::string& segment : segments) {
+    if (IsHidden(segment)) {
+      return Status::OK();
+    }
+  }
+
+  out->path = path;
+  out->keys.clear();
+  for (size_t i = 0; i + 1 < segments.size(); ++i) {
+    const std::string& segment = segments[i];
+    const size_t equals = segment.find('=');
+    if (equals == std::string::npos || equals == 0) {
+      std::stringstream ss;
+      ss << "Directory '" << segment << "' of " << path
+         << " is not a partition of the form name=value";
+      return Status::Invalid(ss.str());
+    }
+    PartitionKey key;
+    key.name = segment.substr(0, equals);
+    key.value = segment.substr(equals + 1);
+    key.is_null = key.value == kNullPartitionValue;
+    if (key.is_null) {
+      key.value.clear();
+    }
+    out->keys.push_back(std::move(key));
+  }
+  *keep = true;
+  return Status::OK();
+}
+
+Status OpenFile(io::FileSystem* fs, const std::string& path,
+                std::shared_ptr<ipc::RecordBatchFileReader>* out) {
+  std::shared_ptr<io::RandomAccessFile> file;
+  RETURN_NOT_OK(fs->OpenInputFile(path, &file));
+  return ipc::RecordBatchFileReader::Open(file, out);
+}
+
+// A utf8 column repeating the value of a partition key
+Status MakeKeyColumn(const PartitionKey& key, int64_t length,
+                     std::shared_ptr<Array>* out) {
+  StringBuilder builder;
+  RETURN_NOT_OK(builder.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    RETURN_NOT_OK(key.is_null ? builder.AppendNull() : builder.Append(key.value));
+  }
+  return builder.Finish(out);
+}
+
+}  // namespace
+
+PartitionFilter PartitionKeyEquals(const std::string& name, const std::string& value) {
+  return [name, value](const std::vector<PartitionKey>& keys) {
+    for (const PartitionKey& key : keys) {
+      if (key.name == name) {
+        return !key.is_null && key.value == value;
+      }
+    }
+    return false;
+  };
+}
+
+// ----------------------------------------------------------------------
+// Reading
+
+Dataset::Dataset(const std::shared_ptr<io::FileSystem>& fs,
+                 std::vector<DataFragment> fragments,
+                 std::vector<std::string> partition_names)
+    : fs_(fs),
+      fragments_(std::move(fragments)),
+      partition_names_(std::move(partition_names)) {}
+
+Status Dataset::Discover(const std::shared_ptr<io::FileSystem>& fs,
+                         const std::string& base_dir, std::shared_ptr<Dataset>* out) {
+  const std::string base = StripTrailingSlashes(base_dir);
+  std::vector<io::FileEntry> entries;
+  RETURN_NOT_OK(fs->GetChildrenRecursive(base, &entries));
+
+  std::vector<DataFragment> fragments;
+  std::vector<std::string> partition_names;
+  for (const io::FileEntry& entry : entries) {
+    if (entry.stat.kind != io::ObjectType::FILE) {
+      continue;
+    }
+    DataFragment fragment;
+    bool keep;
+    const std::string relative_path = entry.path.substr(base.size() + 1);
+    RETURN_NOT_OK(ParseFragment(entry.path, relative_path, &fragment, &keep));
+    if (!keep) {
+      continue;
+    }
+    std::vector<std::string> names;
+    for (const PartitionKey& key : fragment.keys) {
+      names.push_back(key.name);
+    }
+    if (fragments.empty()) {
+      partition_names = names;
+    } else if (names != partition_names) {
+      std::stringstream ss;
+      ss << "The partition keys of " << entry.path << " differ from those of "
+         << fragments[0].path;
+      return Status::Invalid(ss.str());
+    }
+    fragments.push_back(std::move(fragment));
+  }
+
+  out->reset(new Dataset(fs, std::move(fragments), std::move(partition_names)));
+  return Status::OK();
+}
+
+Status Dataset::Read(const DatasetReadOptions& options,
+                     std::shared_ptr<Table>* out) const {
+  if (fragments_.empty()) {
+    return Status::Invalid("The dataset has no file");
+  }
+  std::vector<const DataFragment*> selected;
+  for (const DataFragment& fragment : fragments_) {
+    if (!options.filter || options.filter(fragment.keys)) {
+      selected.push_back(&fragment);
+    }
+  }
+
+  // The schema of the files, taken from the first one read
+  std::shared_ptr<Schema> file_schema;
+  {
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    const DataFragment& first = selected.empty() ? fragments_[0] : *selected[0];
+    RETURN_NOT_OK(OpenFile(fs_.get(), first.path, &reader));
+    file_schema = reader->schema();
+  }
+
+  // Each output column is either a file column (>= 0) or a key (-1 - index)
+  std::vector<std::string> columns = options.columns;
+  if (columns.empty()) {
+    for (const auto& field : file_schema->fields()) {
+      columns.push_back(field->name());
+    }
+    columns.insert(columns.end(), partition_names_.begin(), partition_names_.end());
+  }
+  std::vector<int> sources;
+  std::vector<int> included_fields;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (const std::string& name : columns) {
+    const auto key = std::find(partition_names_.begin(), partition_names_.end(), name);
+    if (key != partition_names_.end()) {
+      sources.push_back(-1 - static_cast<int>(key - partition_names_.begin()));
+      fields.push_back(field(name, utf8()));
+      continue;
+    }
+    const int64_t field_index = file_schema->GetFieldIndex(name);
+    if (field_index < 0) {
+      return Status::Invalid("No column named '" + name + "' in the dataset");
+    }
+    const int index = static_cast<int>(field_index);
+    sources.push_back(index);
+    included_fields.push_back(index);
+    fields.push_back(file_schema->field(index));
+  }
+  std::sort(included_fields.begin(), included_fields.end());
+  included_fields.erase(std::unique(included_fields.begin(), included_fields.end()),
+                        included_fields.end());
+  auto out_schema = schema(fields);
+
+  std::vector<std::vector<std::shared_ptr<RecordBatch>>> batches(selected.size());
+  auto read_fragment = [&](int i) -> Status {
+    const DataFragment& fragment = *selected[i];
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    RETURN_NOT_OK(OpenFile(fs_.get(), fragment.path, &reader));
+    if (!reader->schema()->Equals(*file_schema)) {
+      std::stringstream ss;
+      ss << "The schema of " << fragment.path << " differs from that of "
+         << selected[0]->path;
+      return Status::Invalid(ss.str());
+    }
+    for (int b = 0; b < reader->num_record_batches(); ++b) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader->ReadRecordBatch(b, included_fields, &batch));
+      std::vector<std::shared_ptr<Array>> arrays;
+      for (int source : sources) {
+        if (source < 0) {
+          std::shared_ptr<Array> keys;
+          RETURN_NOT_OK(MakeKeyColumn(fragment.keys[-1 - source], batch->num_rows(),
+                                      &keys));
+          arrays.push_back(keys);
+        } else {
+          const auto position =
+              std::lower_bound(included_fields.begin(), included_fields.end(), source) -
+              included_fields.begin();
+          arrays.push_back(batch->column(static_cast<int>(position)));
+        }
+      }
+      batches[i].push_back(
+          RecordBatch::Make(out_schema, batch->num_rows(), std::move(arrays)));
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(ParallelFor(std::max(options.num_threads, 1),
+                            static_cast<int>(selected.size()), read_fragment));
+
+  std::vector<std::shared_ptr<RecordBatch>> all_batches;
+  for (const auto& fragment_batches : batches) {
+    all_batches.insert(all_batches.end(), fragment_batches.begin(),
+                       fragment_batches.end());
+  }
+  return Table::FromRecordBatches(out_schema, all_batches, out);
+}
+
+// ----------------------------------------------------------------------
+// Writing
+
+namespace {
+
+bool IsPartitionType(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+    case Type::UINT8:
+    case Type::INT8:
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::STRING:
+    case Type::BINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename ArrayType>
+std::string FormatInteger(const Array& array, int64_t i) {
+  return std::to_string(static_cast<const ArrayType&>(array).Value(i));
+}
+
+// The directory name of a partition value
+Status FormatValue(const Array& array, int64_t i, std::string* out) {
+  if (array.IsNull(i)) {
+    *out = kNullPartitionValue;
+    return Status::OK();
+  }
+  switch (array.type_id()) {
+    case Type::BOOL:
+      *out = static_cast<const BooleanArray&>(array).Value(i) ? "true" : "false";
+      break;
+    case Type::UINT8:
+      *out = FormatInteger<UInt8Array>(array, i);
+      break;
+    case Type::INT8:
+      *out = FormatInteger<Int8Array>(array, i);
+      break;
+    case Type::UINT16:
+      *out = FormatInteger<UInt16Array>(array, i);
+      break;
+    case Type::INT16:
+      *out = FormatInteger<Int16Array>(array, i);
+      break;
+    case Type::UINT32:
+      *out = FormatInteger<UInt32Array>(array, i);
+      break;
+    case Type::INT32:
+      *out = FormatInteger<Int32Array>(array, i);
+      break;
+    case Type::UINT64:
+      *out = FormatInteger<UInt64Array>(array, i);
+      break;
+    case Type::INT64:
+      *out = FormatInteger<Int64Array>(array, i);
+      break;
+    default:
+      *out = static_cast<const BinaryArray&>(array).GetString(i);
+      if (out->find('/') != std::string::npos || IsHidden(*out)) {
+        std::stringstream ss;
+        ss << "Partition value '" << *out
+           << "' contains '/' or starts with '.' or '_'";
+        return Status::Invalid(ss.str());
+      }
+      break;
+  }
+  return Status::OK();
+}
+
+// The file of a partition, kept open while the batches are written
+struct PartitionFile {
+  std::shared_ptr<io::OutputStream> stream;
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+};
+
+}  // namespace
+
+Status WriteDataset(const std::shared_ptr<io::FileSystem>& fs,
+                    const std::string& base_dir, RecordBatchReader* reader,
+                    const DatasetWriteOptions& options) {
+  const std::string base = StripTrailingSlashes(base_dir);
+  const std::shared_ptr<Schema> schema = reader->schema();
+  std::vector<int> partition_columns;
+  for (const std::string& name : options.partition_columns) {
+    const int64_t field_index = schema->GetFieldIndex(name);
+    if (field_index < 0) {
+      return Status::Invalid("No column named '" + name + "' to partition by");
+    }
+    const int index = static_cast<int>(field_index);
+    if (!IsPartitionType(*schema->field(index)->type())) {
+      return Status::NotImplemented("Cannot partition by values of type " +
+                                    schema->field(index)->type()->ToString());
+    }
+    partition_columns.push_back(index);
+  }
+  std::vector<int> payload_columns;
+  std::vector<std::shared_ptr<Field>> payload_fields;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (std::find(partition_columns.begin(), partition_columns.end(), i) ==
+        partition_columns.end()) {
+      payload_columns.push_back(i);
+      payload_fields.push_back(schema->field(i));
+    }
+  }
+  auto payload_schema = ::arrow::schema(payload_fields, schema->metadata());
+
+  RETURN_NOT_OK(fs->MakeDirectory(base));
+  const int num_threads = std::max(options.num_threads, 1);
+  std::map<std::string, PartitionFile> files;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+
+    // Split the rows by partition directory
+    std::map<std::string, std::vector<int32_t>> partitions;
+    std::string directory;
+    std::string value;
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      directory.clear();
+      for (size_t k = 0; k < partition_columns.size(); ++k) {
+        RETURN_NOT_OK(FormatValue(*batch->column(partition_columns[k]), row, &value));
+        directory += options.partition_columns[k] + "=" + value + "/";
+      }
+      partitions[directory].push_back(static_cast<int32_t>(row));
+    }
+
+    std::vector<std::shared_ptr<Array>> payload_arrays;
+    for (int i : payload_columns) {
+      payload_arrays.push_back(batch->column(i));
+    }
+    auto payload =
+        RecordBatch::Make(payload_schema, batch->num_rows(), std::move(payload_arrays));
+
+    // Open the files of new partitions, then write the partitions in parallel
+    std::vector<std::pair<PartitionFile*, const std::vector<int32_t>*>> tasks;
+    for (const auto& partition : partitions) {
+      PartitionFile& file = files[partition.first];
+      if (!file.writer) {
+        const std::string dir = base + "/" + partition.first;
+        RETURN_NOT_OK(fs->MakeDirectory(StripTrailingSlashes(dir)));
+        RETURN_NOT_OK(fs->OpenOutputStream(dir + options.basename + "-0.arrow",
+                                           &file.stream));
+        RETURN_NOT_OK(ipc::RecordBatchFileWriter::Open(file.stream.get(),
+                                                       payload_schema, &file.writer));
+      }
+      tasks.emplace_back(&file, &partition.second);
+    }
+    RETURN_NOT_OK(ParallelFor(
+        num_threads, static_cast<int>(tasks.size()), [&](int i) -> Status {
+          const std::vector<int32_t>& rows = *tasks[i].second;
+          std::shared_ptr<RecordBatch> rows_batch = payload;
+          if (static_cast<int64_t>(rows.size()) != payload->num_rows()) {
+            Int32Builder indices_builder;
+            RETURN_NOT_OK(
+                indices_builder.Append(rows.data(), static_cast<int64_t>(rows.size())));
+            std::shared_ptr<Array> indices;
+            RETURN_NOT_OK(indices_builder.Finish(&indices));
+            compute::FunctionContext ctx(default_memory_pool());
+            compute::Datum taken;
+            RETURN_NOT_OK(compute::Take(&ctx, compute::Datum(payload),
+                                        compute::Datum(indices), &taken));
+            rows_batch = taken.record_batch();
+          }
+          return tasks[i].first->writer->WriteRecordBatch(*rows_batch);
+        }));
+  }
+
+  std::vector<PartitionFile*> open_files;
+  for (auto& file : files) {
+    open_files.push_back(&file.second);
+  }
+  return ParallelFor(num_threads, static_cast<int>(open_files.size()),
+                     [&](int i) -> Status {
+                       RETURN_NOT_OK(open_files[i]->writer->Close());
+                       return open_files[i]->stream->Close();
+                     });
+}
+
+}  // namespace dataset
+}  // namespace arrow
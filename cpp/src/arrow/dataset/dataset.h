@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Datasets stored as directory trees of Arrow files, partitioned by the
+// values of some columns
+
+#ifndef ARROW_DATASET_DATASET_H
+#define ARROW_DATASET_DATASET_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+class Schema;
+class Table;
+
+namespace io {
+
+class FileSystem;
+
+}  // namespace io
+
+namespace dataset {
+
+/// \brief The value of a partition key, parsed from a "name=value" segment
+/// of the path of a file
+struct ARROW_EXPORT PartitionKey {
+  std::string name;
+  std::string value;
+  /// Whether the value is null, written as kNullPartitionValue
+  bool is_null;
+};
+
+/// \brief The directory name of null partition values, as in Hive
+ARROW_EXPORT extern const char kNullPartitionValue[];
+
+/// \brief A file of a dataset
+struct ARROW_EXPORT DataFragment {
+  std::string path;
+  /// The keys of the directories of the file, from the outermost one
+  std::vector<PartitionKey> keys;
+};
+
+/// \brief Decides whether the files of a partition are read, from its keys
+using PartitionFilter = std::function<bool(const std::vector<PartitionKey>& keys)>;
+
+/// \brief A filter keeping the partitions where a key has the given value
+ARROW_EXPORT
+PartitionFilter PartitionKeyEquals(const std::string& name, const std::string& value);
+
+struct ARROW_EXPORT DatasetReadOptions {
+  DatasetReadOptions() : num_threads(1) {}
+
+  /// Names of the columns to read, including partition keys, in output order.
+  /// All the columns of the files followed by the partition keys if empty
+  std::vector<std::string> columns;
+  /// Partitions to read, all if unset
+  PartitionFilter filter;
+  /// Number of files read at the same time
+  int num_threads;
+};
+
+/// \class Dataset
+/// \brief A directory tree of Arrow files partitioned Hive-style
+///
+/// Files are stored in directories named "key=value", one level per key, for
+/// example "year=2018/month=3/part-0.arrow". The files have the columns which
+/// are not keys; the keys are added to the record batches read as utf8
+/// columns, after the columns of the files. Files and directories whose name
+/// starts with '.' or '_' are ignored.
+class ARROW_EXPORT Dataset {
+ public:
+  /// \brief Find the files of a dataset
+  ///
+  /// The directories are listed in parallel, see
+  /// FileSystem::GetChildrenRecursive. All the files must be at the same
+  /// depth, under directories with the same keys
+  ///
+  /// \param[in] fs the file system holding the dataset
+  /// \param[in] base_dir the root directory of the dataset
+  /// \param[out] out the dataset
+  /// \return Status
+  static Status Discover(const std::shared_ptr<io::FileSystem>& fs,
+                         const std::string& base_dir, std::shared_ptr<Dataset>* out);
+
+  /// \brief The files of the dataset, sorted by path
+  const std::vector<DataFragment>& fragments() const { return fragments_; }
+
+  /// \brief The names of the partition keys, from the outermost directory
+  const std::vector<std::string>& partition_names() const { return partition_names_; }
+
+  /// \brief Read the files of the selected partitions into a table
+  ///
+  /// The files are read in parallel with RecordBatchFileReader, fetching
+  /// only the selected columns. They must have the same schema. The record
+  /// batches of the table are in fragment order
+  ///
+  /// \param[in] options the columns and partitions to read
+  /// \param[out] out the table
+  /// \return Status, Invalid if the dataset has no file
+  Status Read(const DatasetReadOptions& options, std::shared_ptr<Table>* out) const;
+
+ private:
+  Dataset(const std::shared_ptr<io::FileSystem>& fs, std::vector<DataFragment> fragments,
+          std::vector<std::string> partition_names);
+
+  std::shared_ptr<io::FileSystem> fs_;
+  std::vector<DataFragment> fragments_;
+  std::vector<std::string> partition_names_;
+};
+
+struct ARROW_EXPORT DatasetWriteOptions {
+  DatasetWriteOptions() : basename("part"), num_threads(1) {}
+
+  /// Names of the columns to partition by, from the outermost directory.
+  /// Their values must be integers, booleans, strings or binary strings
+  /// without '/'
+  std::vector<std::string> partition_columns;
+  /// Each partition is written to a file named <basename>-0.arrow
+  std::string basename;
+  /// Number of files written at the same time
+  int num_threads;
+};
+
+/// \brief Write record batches as a partitioned dataset
+///
+/// Each batch is split by the values of the partition columns. The rows of
+/// each partition, without the partition columns, are appended to the file
+/// of the partition, the files of the partitions of a batch being written in
+/// parallel. Only one batch is held in memory at a time, apart from the
+/// buffering of the files
+///
+/// \param[in] fs the file system to write to
+/// \param[in] base_dir the root directory of the dataset, created if needed
+/// \param[in] reader the record batches to write
+/// \param[in] options the partition columns
+/// \return Status
+ARROW_EXPORT
+Status WriteDataset(const std::shared_ptr<io::FileSystem>& fs,
+                    const std::string& base_dir, RecordBatchReader* reader,
+                    const DatasetWriteOptions& options);
+
+}  // namespace dataset
+}  // namespace arrow
+
+#endif  // ARROW_DATASET_DATASET_H
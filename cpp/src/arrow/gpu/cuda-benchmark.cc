@@ -19,11 +19,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/test-util.h"
+#include "arrow/type.h"
 
 #include "arrow/gpu/cuda_api.h"
 
@@ -32,9 +35,18 @@ namespace gpu {
 
 constexpr int64_t kGpuNumber = 0;
 
+static std::shared_ptr<CudaContext> GetContext() {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+  return context;
+}
+
 static void CudaBufferWriterBenchmark(benchmark::State& state, const int64_t total_bytes,
                                       const int64_t chunksize,
-                                      const int64_t buffer_size) {
+                                      const int64_t buffer_size,
+                                      const bool streamed = false) {
   CudaDeviceManager* manager;
   ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
   std::shared_ptr<CudaContext> context;
@@ -47,6 +59,11 @@ static void CudaBufferWriterBenchmark(benchmark::State& state, const int64_t tot
   if (buffer_size > 0) {
     ABORT_NOT_OK(writer.SetBufferSize(buffer_size));
   }
+  if (streamed) {
+    std::shared_ptr<CudaStream> stream;
+    ABORT_NOT_OK(context->NewStream(&stream));
+    ABORT_NOT_OK(writer.SetStream(stream));
+  }
 
   std::shared_ptr<PoolBuffer> buffer;
   ASSERT_OK(test::MakeRandomBytePoolBuffer(total_bytes, default_memory_pool(), &buffer));
@@ -60,6 +77,8 @@ static void CudaBufferWriterBenchmark(benchmark::State& state, const int64_t tot
       ABORT_NOT_OK(writer.Write(host_data + bytes_written, bytes_to_write));
       bytes_written += bytes_to_write;
     }
+    // Include the copies still in flight
+    ABORT_NOT_OK(writer.Flush());
   }
   state.SetBytesProcessed(int64_t(state.iterations()) * total_bytes);
 }
@@ -74,6 +93,16 @@ static void BM_Writer_Buffered(benchmark::State& state) {
   CudaBufferWriterBenchmark(state, kTotalBytes, state.range(0), kBufferSize);
 }
 
+static void BM_Writer_Streamed(benchmark::State& state) {
+  // 128MB
+  const int64_t kTotalBytes = 1 << 27;
+
+  // 8MB
+  const int64_t kBufferSize = 1 << 23;
+
+  CudaBufferWriterBenchmark(state, kTotalBytes, state.range(0), kBufferSize, true);
+}
+
 static void BM_Writer_Unbuffered(benchmark::State& state) {
   // 128MB
   const int64_t kTotalBytes = 1 << 27;
@@ -87,6 +116,12 @@ BENCHMARK(BM_Writer_Buffered)
     ->MinTime(1.0)
     ->UseRealTime();
 
+BENCHMARK(BM_Writer_Streamed)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 16)
+    ->MinTime(1.0)
+    ->UseRealTime();
+
 BENCHMARK(BM_Writer_Unbuffered)
     ->RangeMultiplier(4)
     ->RangeMultiplier(16)
@@ -94,5 +129,174 @@ BENCHMARK(BM_Writer_Unbuffered)
     ->MinTime(1.0)
     ->UseRealTime();
 
+static void BM_AllocateFree(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaBuffer> buffer;
+    ABORT_NOT_OK(context->Allocate(size, &buffer));
+  }
+}
+
+// The same without the cached device memory, as cuMemAlloc and cuMemFree
+static void BM_AllocateFree_Uncached(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaBuffer> buffer;
+    ABORT_NOT_OK(context->Allocate(size, &buffer));
+    buffer.reset();
+    ABORT_NOT_OK(context->ReleaseCachedMemory());
+  }
+}
+
+static void CopyBenchmark(benchmark::State& state, bool pinned, bool to_device) {
+  const int64_t size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(context->Allocate(size, &device_buffer));
+
+  std::shared_ptr<MutableBuffer> host_buffer;
+  if (pinned) {
+    std::shared_ptr<CudaHostBuffer> pinned_buffer;
+    ABORT_NOT_OK(AllocateCudaHostBuffer(size, &pinned_buffer));
+    host_buffer = pinned_buffer;
+  } else {
+    std::shared_ptr<PoolBuffer> pool_buffer;
+    ABORT_NOT_OK(
+        test::MakeRandomBytePoolBuffer(size, default_memory_pool(), &pool_buffer));
+    host_buffer = pool_buffer;
+  }
+
+  while (state.KeepRunning()) {
+    if (to_device) {
+      ABORT_NOT_OK(device_buffer->CopyFromHost(0, host_buffer->data(), size));
+    } else {
+      ABORT_NOT_OK(device_buffer->CopyToHost(0, size, host_buffer->mutable_data()));
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * size);
+}
+
+static void BM_CopyToDevice_Pageable(benchmark::State& state) {
+  CopyBenchmark(state, false, true);
+}
+
+static void BM_CopyToDevice_Pinned(benchmark::State& state) {
+  CopyBenchmark(state, true, true);
+}
+
+static void BM_CopyToHost_Pageable(benchmark::State& state) {
+  CopyBenchmark(state, false, false);
+}
+
+static void BM_CopyToHost_Pinned(benchmark::State& state) {
+  CopyBenchmark(state, true, false);
+}
+
+// Exporting a buffer and serializing its handle, then reading the handle as
+// the other process would. Opening it needs another process, so it is not
+// measured.
+static void BM_ExportForIpc(benchmark::State& state) {
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(context->Allocate(1 << 20, &device_buffer));
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaIpcMemHandle> handle;
+    ABORT_NOT_OK(device_buffer->ExportForIpc(&handle));
+    std::shared_ptr<Buffer> serialized;
+    ABORT_NOT_OK(handle->Serialize(default_memory_pool(), &serialized));
+    std::shared_ptr<CudaIpcMemHandle> read_handle;
+    ABORT_NOT_OK(CudaIpcMemHandle::FromBuffer(serialized->data(), &read_handle));
+  }
+}
+
+// A batch of double columns with 1M values in all
+static std::shared_ptr<RecordBatch> MakeBatch(int num_columns) {
+  const int64_t length = (1 << 20) / num_columns;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < num_columns; ++i) {
+    std::shared_ptr<PoolBuffer> data;
+    ABORT_NOT_OK(test::MakeRandomBytePoolBuffer(length * sizeof(double),
+                                                default_memory_pool(), &data, i));
+    fields.push_back(field("f" + std::to_string(i), float64()));
+    columns.push_back(std::make_shared<DoubleArray>(length, data));
+  }
+  return RecordBatch::Make(schema(fields), length, columns);
+}
+
+static void BM_RecordBatchToDevice(benchmark::State& state) {
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<RecordBatch> batch = MakeBatch(static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> device_batch;
+    ABORT_NOT_OK(CopyRecordBatchToDevice(*batch, context.get(), &device_batch));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * (1 << 20) * sizeof(double));
+}
+
+// The same through an IPC message written with a CudaBufferWriter
+static void BM_RecordBatchToDevice_Serialized(benchmark::State& state) {
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<RecordBatch> batch = MakeBatch(static_cast<int>(state.range(0)));
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaBuffer> serialized;
+    ABORT_NOT_OK(SerializeRecordBatch(*batch, context.get(), &serialized));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * (1 << 20) * sizeof(double));
+}
+
+static void BM_RecordBatchToHost(benchmark::State& state) {
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<RecordBatch> batch = MakeBatch(static_cast<int>(state.range(0)));
+  std::shared_ptr<RecordBatch> device_batch;
+  ABORT_NOT_OK(CopyRecordBatchToDevice(*batch, context.get(), &device_batch));
+  CudaHostMemoryPool pool;
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> host_batch;
+    ABORT_NOT_OK(CopyRecordBatchToHost(*device_batch, &pool, &host_batch));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * (1 << 20) * sizeof(double));
+}
+
+// From 256 bytes to 64MB
+BENCHMARK(BM_AllocateFree)->RangeMultiplier(16)->Range(1 << 8, 1 << 26);
+
+BENCHMARK(BM_AllocateFree_Uncached)->RangeMultiplier(16)->Range(1 << 8, 1 << 26);
+
+// From 1KB to 256MB
+BENCHMARK(BM_CopyToDevice_Pageable)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 28)
+    ->UseRealTime();
+
+BENCHMARK(BM_CopyToDevice_Pinned)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 28)
+    ->UseRealTime();
+
+BENCHMARK(BM_CopyToHost_Pageable)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 28)
+    ->UseRealTime();
+
+BENCHMARK(BM_CopyToHost_Pinned)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 28)
+    ->UseRealTime();
+
+BENCHMARK(BM_ExportForIpc)->UseRealTime();
+
+// From 1 to 256 columns
+BENCHMARK(BM_RecordBatchToDevice)->RangeMultiplier(16)->Range(1, 256)->UseRealTime();
+
+BENCHMARK(BM_RecordBatchToDevice_Serialized)
+    ->RangeMultiplier(16)
+    ->Range(1, 256)
+    ->UseRealTime();
+
+BENCHMARK(BM_RecordBatchToHost)->RangeMultiplier(16)->Range(1, 256)->UseRealTime();
+
 }  // namespace gpu
 }  // namespace arrow
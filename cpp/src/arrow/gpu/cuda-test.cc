@@ -16,13 +16,16 @@
 // under the License.
 
 #include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/test-common.h"
+#include "arrow/memory_pool-test.h"
 #include "arrow/status.h"
 #include "arrow/test-util.h"
 
@@ -58,6 +61,42 @@ TEST_F(TestCudaBuffer, Allocate) {
   ASSERT_EQ(kSize, context_->bytes_allocated());
 }
 
+TEST_F(TestCudaBuffer, CachedAllocations) {
+  ASSERT_OK(context_->ReleaseCachedMemory());
+  ASSERT_EQ(0, context_->bytes_cached());
+
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(context_->Allocate(1000, &buffer));
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+  ASSERT_EQ(0, context_->bytes_allocated());
+  ASSERT_GE(context_->bytes_cached(), 1000);
+
+  // An allocation of the same size class reuses the freed memory
+  ASSERT_OK(context_->Allocate(990, &buffer));
+  ASSERT_EQ(data, buffer->data());
+  ASSERT_EQ(990, buffer->size());
+  ASSERT_EQ(990, context_->bytes_allocated());
+  ASSERT_EQ(0, context_->bytes_cached());
+
+  // Closing the buffer twice frees it once
+  ASSERT_OK(buffer->Close());
+  ASSERT_OK(buffer->Close());
+  buffer.reset();
+  const int64_t bytes_cached = context_->bytes_cached();
+  ASSERT_OK(context_->Allocate(1000, &buffer));
+  std::shared_ptr<CudaBuffer> other;
+  ASSERT_OK(context_->Allocate(1000, &other));
+  ASSERT_NE(buffer->data(), other->data());
+  ASSERT_EQ(0, context_->bytes_cached());
+  buffer.reset();
+  other.reset();
+  ASSERT_EQ(2 * bytes_cached, context_->bytes_cached());
+
+  ASSERT_OK(context_->ReleaseCachedMemory());
+  ASSERT_EQ(0, context_->bytes_cached());
+}
+
 void AssertCudaBufferEquals(const CudaBuffer& buffer, const uint8_t* host_data,
                             const int64_t nbytes) {
   std::shared_ptr<Buffer> result;
@@ -80,6 +119,66 @@ TEST_F(TestCudaBuffer, CopyFromHost) {
   AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<PoolBuffer> random_data;
+  ASSERT_OK(test::MakeRandomBytePoolBuffer(kSize, default_memory_pool(), &random_data));
+  std::shared_ptr<CudaHostBuffer> host_buffer;
+  ASSERT_OK(AllocateCudaHostBuffer(kSize, &host_buffer));
+  std::memcpy(host_buffer->mutable_data(), random_data->data(), kSize);
+
+  std::shared_ptr<CudaStream> stream;
+  ASSERT_OK(context_->NewStream(&stream));
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, host_buffer->data(), 500, *stream));
+  ASSERT_OK(device_buffer->CopyFromHostAsync(500, host_buffer->data() + 500,
+                                             kSize - 500, *stream));
+
+  // Copying back on the same stream is ordered after the copies to the device
+  std::shared_ptr<CudaHostBuffer> result;
+  ASSERT_OK(AllocateCudaHostBuffer(kSize, &result));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, result->mutable_data(), *stream));
+
+  std::shared_ptr<CudaEvent> event;
+  ASSERT_OK(stream->RecordEvent(&event));
+  ASSERT_OK(event->Synchronize());
+  bool done = false;
+  ASSERT_OK(event->IsDone(&done));
+  ASSERT_TRUE(done);
+  ASSERT_OK(stream->IsDone(&done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(0, std::memcmp(result->data(), random_data->data(), kSize));
+}
+
+TEST_F(TestCudaBuffer, StreamWaitEvent) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<CudaHostBuffer> host_buffer;
+  ASSERT_OK(AllocateCudaHostBuffer(kSize, &host_buffer));
+  std::memset(host_buffer->mutable_data(), 7, kSize);
+
+  std::shared_ptr<CudaStream> upload;
+  std::shared_ptr<CudaStream> download;
+  ASSERT_OK(context_->NewStream(&upload));
+  ASSERT_OK(context_->NewStream(&download));
+
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, host_buffer->data(), kSize, *upload));
+  std::shared_ptr<CudaEvent> uploaded;
+  ASSERT_OK(upload->RecordEvent(&uploaded));
+
+  // The copy back waits for the upload although it is on another stream
+  std::shared_ptr<CudaHostBuffer> result;
+  ASSERT_OK(AllocateCudaHostBuffer(kSize, &result));
+  ASSERT_OK(download->WaitEvent(*uploaded));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, result->mutable_data(), *download));
+  ASSERT_OK(download->Synchronize());
+  ASSERT_EQ(0, std::memcmp(result->data(), host_buffer->data(), kSize));
+}
+
 // IPC only supported on Linux
 #if defined(__linux)
 
@@ -177,6 +276,41 @@ TEST_F(TestCudaBufferWriter, BufferedWrites) {
   TestWrites(kTotalSize, 1000, 1 << 12);
 }
 
+TEST_F(TestCudaBufferWriter, StreamedWrites) {
+  const int64_t kTotalSize = 1 << 16;
+  Allocate(kTotalSize);
+  std::shared_ptr<CudaStream> stream;
+  ASSERT_OK(context_->NewStream(&stream));
+  ASSERT_OK(writer_->SetStream(stream));
+  TestWrites(kTotalSize, 1000, 1 << 12);
+}
+
+TEST_F(TestCudaBufferWriter, FlushAsync) {
+  const int64_t kTotalSize = 1 << 12;
+  Allocate(kTotalSize);
+
+  std::shared_ptr<PoolBuffer> buffer;
+  ASSERT_OK(test::MakeRandomBytePoolBuffer(kTotalSize, default_memory_pool(), &buffer));
+  const uint8_t* host_data = buffer->data();
+
+  ASSERT_OK(writer_->SetBufferSize(1000));
+  // Asynchronous flushes need a stream
+  ASSERT_RAISES(Invalid, writer_->FlushAsync());
+
+  std::shared_ptr<CudaStream> stream;
+  ASSERT_OK(context_->NewStream(&stream));
+  ASSERT_OK(writer_->SetStream(stream));
+  for (int64_t position = 0; position < kTotalSize; position += 512) {
+    ASSERT_OK(writer_->Write(host_data + position, 512));
+    ASSERT_OK(writer_->FlushAsync());
+    ASSERT_EQ(0, writer_->num_bytes_buffered());
+  }
+
+  // Flush waits for the copies in flight
+  ASSERT_OK(writer_->Flush());
+  AssertCudaBufferEquals(*device_buffer_, host_data, kTotalSize);
+}
+
 TEST_F(TestCudaBufferWriter, EdgeCases) {
   Allocate(1000);
 
@@ -220,6 +354,66 @@ TEST_F(TestCudaBufferWriter, EdgeCases) {
   AssertCudaBufferEquals(*device_buffer_, host_data, 1000);
 }
 
+class TestCudaHostMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  CudaHostMemoryPool pool_;
+};
+
+TEST_F(TestCudaHostMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestCudaHostMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestCudaHostMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestCudaHostMemoryPool, SubAllocation) {
+  CudaHostMemoryPool pool(1 << 12);
+  ASSERT_EQ(0, pool.bytes_pinned());
+
+  // Small blocks share a chunk, and are reused once freed
+  uint8_t* first = nullptr;
+  uint8_t* second = nullptr;
+  ASSERT_OK(pool.Allocate(100, &first));
+  ASSERT_OK(pool.Allocate(100, &second));
+  ASSERT_EQ(1 << 12, pool.bytes_pinned());
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(first) % 64);
+  ASSERT_EQ(128, std::abs(second - first));
+  pool.Free(first, 100);
+  uint8_t* third = nullptr;
+  ASSERT_OK(pool.Allocate(120, &third));
+  ASSERT_EQ(first, third);
+  ASSERT_EQ(220, pool.bytes_allocated());
+
+  // Large blocks are pinned on their own
+  uint8_t* large = nullptr;
+  ASSERT_OK(pool.Allocate(5000, &large));
+  ASSERT_EQ((1 << 12) + 5000, pool.bytes_pinned());
+  pool.Free(large, 5000);
+  ASSERT_EQ(1 << 12, pool.bytes_pinned());
+
+  pool.Free(second, 100);
+  pool.Free(third, 120);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(5220, pool.max_memory());
+}
+
+TEST_F(TestCudaHostMemoryPool, CopyToDevice) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<PoolBuffer> host_buffer;
+  ASSERT_OK(test::MakeRandomBytePoolBuffer(kSize, &pool_, &host_buffer));
+
+  CudaDeviceManager* manager;
+  std::shared_ptr<CudaContext> context;
+  ASSERT_OK(CudaDeviceManager::GetInstance(&manager));
+  ASSERT_OK(manager->GetContext(kGpuNumber, &context));
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context->Allocate(kSize, &device_buffer));
+  ASSERT_OK(device_buffer->CopyFromHost(0, host_buffer->data(), kSize));
+  AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
+}
+
 class TestCudaBufferReader : public TestCudaBufferBase {
  public:
   void SetUp() { TestCudaBufferBase::SetUp(); }
@@ -301,5 +495,58 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   ipc::CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, CopyRecordBatch) {
+  std::vector<ipc::MakeRecordBatch*> makers = {
+      &ipc::MakeIntRecordBatch, &ipc::MakeStringTypesRecordBatch,
+      &ipc::MakeListRecordBatch, &ipc::MakeZeroLengthRecordBatch};
+  for (auto maker : makers) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(maker(&batch));
+
+    std::shared_ptr<RecordBatch> device_batch;
+    ASSERT_OK(CopyRecordBatchToDevice(*batch, context_.get(), &device_batch));
+    ASSERT_EQ(batch->num_rows(), device_batch->num_rows());
+
+    // Copied back in one transfer
+    std::shared_ptr<RecordBatch> cpu_batch;
+    ASSERT_OK(CopyRecordBatchToHost(*device_batch, pool_, &cpu_batch));
+    ipc::CompareBatch(*batch, *cpu_batch);
+  }
+}
+
+TEST_F(TestCudaArrowIpc, CopyRecordBatchOfSeveralAllocations) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+  ASSERT_GE(batch->num_columns(), 2);
+
+  // The columns come from different device allocations, so that the buffers
+  // are copied one by one
+  std::shared_ptr<RecordBatch> first;
+  std::shared_ptr<RecordBatch> second;
+  ASSERT_OK(CopyRecordBatchToDevice(*batch, context_.get(), &first));
+  ASSERT_OK(CopyRecordBatchToDevice(*batch, context_.get(), &second));
+  std::vector<std::shared_ptr<Array>> columns = {first->column(0)};
+  for (int i = 1; i < batch->num_columns(); ++i) {
+    columns.push_back(second->column(i));
+  }
+  auto device_batch = RecordBatch::Make(batch->schema(), batch->num_rows(), columns);
+
+  std::shared_ptr<RecordBatch> cpu_batch;
+  ASSERT_OK(CopyRecordBatchToHost(*device_batch, pool_, &cpu_batch));
+  ipc::CompareBatch(*batch, *cpu_batch);
+}
+
+TEST_F(TestCudaArrowIpc, CopyRecordBatchErrors) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeDictionary(&batch));
+  std::shared_ptr<RecordBatch> device_batch;
+  ASSERT_RAISES(NotImplemented,
+                CopyRecordBatchToDevice(*batch, context_.get(), &device_batch));
+
+  // Host buffers cannot be copied from the device
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+  ASSERT_RAISES(Invalid, CopyRecordBatchToHost(*batch, pool_, &device_batch));
+}
+
 }  // namespace gpu
 }  // namespace arrow
@@ -18,10 +18,12 @@
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/message.h"
@@ -29,6 +31,8 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/visibility.h"
 
 #include "arrow/gpu/cuda_context.h"
@@ -106,5 +110,169 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ipc::ReadRecordBatch(*message, schema, out);
 }
 
+namespace {
+
+// The buffers of an array and of its children, depth first
+Status CollectBuffers(const ArrayData& data, std::vector<std::shared_ptr<Buffer>>* out) {
+  if (data.type->id() == Type::DICTIONARY) {
+    // The dictionary is part of the type, so it would stay on the host
+    return Status::NotImplemented("Copying dictionary arrays to or from the device");
+  }
+  for (const auto& buffer : data.buffers) {
+    out->push_back(buffer);
+  }
+  for (const auto& child : data.child_data) {
+    RETURN_NOT_OK(CollectBuffers(*child, out));
+  }
+  return Status::OK();
+}
+
+Status CollectBuffers(const RecordBatch& batch,
+                      std::vector<std::shared_ptr<Buffer>>* out) {
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(CollectBuffers(*batch.column_data(i), out));
+  }
+  return Status::OK();
+}
+
+// Offsets of the buffers when laid out one after the other, 64-byte aligned
+int64_t LayOutBuffers(const std::vector<std::shared_ptr<Buffer>>& buffers,
+                      std::vector<int64_t>* offsets) {
+  int64_t total_size = 0;
+  for (const auto& buffer : buffers) {
+    offsets->push_back(total_size);
+    if (buffer) {
+      total_size += BitUtil::RoundUpToMultipleOf64(buffer->size());
+    }
+  }
+  return total_size;
+}
+
+// A copy of an array with the buffers replaced, in the order of CollectBuffers
+std::shared_ptr<ArrayData> ReplaceBuffers(
+    const ArrayData& data, const std::vector<std::shared_ptr<Buffer>>& buffers,
+    size_t* index) {
+  std::shared_ptr<ArrayData> out = data.Copy();
+  for (auto& buffer : out->buffers) {
+    buffer = buffers[(*index)++];
+  }
+  for (auto& child : out->child_data) {
+    child = ReplaceBuffers(*child, buffers, index);
+  }
+  return out;
+}
+
+std::shared_ptr<RecordBatch> ReplaceBuffers(
+    const RecordBatch& batch, const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  size_t index = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back(ReplaceBuffers(*batch.column_data(i), buffers, &index));
+  }
+  return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+}
+
+// Pinned memory for gathering the buffers of uploaded batches
+CudaHostMemoryPool* staging_memory_pool() {
+  static CudaHostMemoryPool pool;
+  return &pool;
+}
+
+}  // namespace
+
+Status CopyRecordBatchToDevice(const RecordBatch& batch, CudaContext* ctx,
+                               std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  RETURN_NOT_OK(CollectBuffers(batch, &buffers));
+  std::vector<int64_t> offsets;
+  const int64_t total_size = LayOutBuffers(buffers, &offsets);
+
+  std::shared_ptr<Buffer> staging;
+  RETURN_NOT_OK(AllocateBuffer(staging_memory_pool(), total_size, &staging));
+  uint8_t* staging_data = staging->mutable_data();
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (buffers[i]) {
+      std::memcpy(staging_data + offsets[i], buffers[i]->data(),
+                  static_cast<size_t>(buffers[i]->size()));
+    }
+  }
+
+  std::shared_ptr<CudaBuffer> device_buffer;
+  RETURN_NOT_OK(ctx->Allocate(total_size, &device_buffer));
+  std::shared_ptr<CudaStream> stream;
+  RETURN_NOT_OK(ctx->NewStream(&stream));
+  RETURN_NOT_OK(device_buffer->CopyFromHostAsync(0, staging_data, total_size, *stream));
+  // The staging memory is reused once freed
+  RETURN_NOT_OK(stream->Synchronize());
+
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (buffers[i]) {
+      buffers[i] =
+          std::make_shared<CudaBuffer>(device_buffer, offsets[i], buffers[i]->size());
+    }
+  }
+  *out = ReplaceBuffers(batch, buffers);
+  return Status::OK();
+}
+
+Status CopyRecordBatchToHost(const RecordBatch& batch, MemoryPool* pool,
+                             std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  RETURN_NOT_OK(CollectBuffers(batch, &buffers));
+
+  std::vector<std::shared_ptr<CudaBuffer>> device_buffers;
+  std::shared_ptr<Buffer> parent;
+  bool same_parent = true;
+  for (const auto& buffer : buffers) {
+    auto device_buffer = std::dynamic_pointer_cast<CudaBuffer>(buffer);
+    if (buffer && !device_buffer) {
+      return Status::Invalid("Record batch has buffers which are not on the device");
+    }
+    device_buffers.push_back(device_buffer);
+    if (buffer) {
+      if (!buffer->parent() || (parent && buffer->parent() != parent)) {
+        same_parent = false;
+      }
+      parent = buffer->parent();
+    }
+  }
+
+  std::vector<int64_t> offsets;
+  const int64_t total_size = LayOutBuffers(buffers, &offsets);
+
+  if (parent && same_parent) {
+    // Copy the parent at once and slice the host buffers from it, unless it is
+    // much larger than the batch
+    auto device_parent = std::dynamic_pointer_cast<CudaBuffer>(parent);
+    if (device_parent && device_parent->size() <= 2 * total_size) {
+      std::shared_ptr<Buffer> host_buffer;
+      RETURN_NOT_OK(AllocateBuffer(pool, device_parent->size(), &host_buffer));
+      RETURN_NOT_OK(device_parent->CopyToHost(0, device_parent->size(),
+                                              host_buffer->mutable_data()));
+      for (auto& buffer : buffers) {
+        if (buffer) {
+          buffer = SliceBuffer(host_buffer, buffer->data() - device_parent->data(),
+                               buffer->size());
+        }
+      }
+      *out = ReplaceBuffers(batch, buffers);
+      return Status::OK();
+    }
+  }
+
+  // Copy the buffers one by one into a single host buffer
+  std::shared_ptr<Buffer> host_buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool, total_size, &host_buffer));
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (buffers[i]) {
+      RETURN_NOT_OK(device_buffers[i]->CopyToHost(
+          0, buffers[i]->size(), host_buffer->mutable_data() + offsets[i]));
+      buffers[i] = SliceBuffer(host_buffer, offsets[i], buffers[i]->size());
+    }
+  }
+  *out = ReplaceBuffers(batch, buffers);
+  return Status::OK();
+}
+
 }  // namespace gpu
 }  // namespace arrow
@@ -71,6 +71,32 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
                        const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \brief Copy a record batch to GPU device memory in a single transfer
+/// \param[in] batch record batch in host memory
+/// \param[in] ctx CudaContext to allocate device memory from
+/// \param[out] out a record batch whose buffers are slices of one CudaBuffer
+/// \return Status
+///
+/// Unlike SerializeRecordBatch, no IPC message is written: the buffers are
+/// gathered into pinned host memory, at 64-byte aligned offsets, and copied to
+/// the device at once. Dictionary-encoded columns are not supported.
+ARROW_EXPORT
+Status CopyRecordBatchToDevice(const RecordBatch& batch, CudaContext* ctx,
+                               std::shared_ptr<RecordBatch>* out);
+
+/// \brief Copy a record batch located on GPU device to host memory
+/// \param[in] batch record batch whose buffers are CudaBuffer instances
+/// \param[in] pool a MemoryPool to allocate the host memory from, a
+/// CudaHostMemoryPool giving the fastest copies
+/// \param[out] out a record batch whose buffers are slices of one host buffer
+/// \return Status
+///
+/// If the buffers are all slices of the same CudaBuffer, as when produced by
+/// CopyRecordBatchToDevice, it is copied in a single transfer.
+ARROW_EXPORT
+Status CopyRecordBatchToHost(const RecordBatch& batch, MemoryPool* pool,
+                             std::shared_ptr<RecordBatch>* out);
+
 }  // namespace gpu
 }  // namespace arrow
 
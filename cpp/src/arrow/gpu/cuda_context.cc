@@ -20,18 +20,42 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <cuda.h>
 
+#include "arrow/util/logging.h"
+
 #include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_memory.h"
 
 namespace arrow {
 namespace gpu {
 
+namespace {
+
+// The smallest device allocation, which is also the alignment of cuMemAlloc
+constexpr int64_t kMinAllocationSize = 256;
+
+// Round an allocation up to its size class. There are four size classes between
+// consecutive powers of two, so that at most a fifth of a block is wasted.
+int64_t AllocationSize(int64_t nbytes) {
+  if (nbytes <= kMinAllocationSize) {
+    return kMinAllocationSize;
+  }
+  int64_t power = kMinAllocationSize;
+  while (power * 2 < nbytes) {
+    power *= 2;
+  }
+  const int64_t step = power / 4;
+  return (nbytes + step - 1) / step * step;
+}
+
+}  // namespace
+
 struct CudaDevice {
   int device_num;
   CUdevice handle;
@@ -40,7 +64,7 @@ struct CudaDevice {
 
 class CudaContext::CudaContextImpl {
  public:
-  CudaContextImpl() {}
+  CudaContextImpl() : bytes_allocated_(0), bytes_cached_(0) {}
 
   Status Init(const CudaDevice& device) {
     device_ = device;
@@ -50,6 +74,9 @@ class CudaContext::CudaContextImpl {
   }
 
   Status Close() {
+    if (is_open_) {
+      RETURN_NOT_OK(ReleaseCachedMemory());
+    }
     if (is_open_ && own_context_) {
       CU_RETURN_NOT_OK(cuCtxDestroy(context_));
     }
@@ -59,16 +86,58 @@ class CudaContext::CudaContextImpl {
 
   int64_t bytes_allocated() const { return bytes_allocated_.load(); }
 
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return bytes_cached_;
+  }
+
   Status Allocate(int64_t nbytes, uint8_t** out) {
-    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    const int64_t size = AllocationSize(nbytes);
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      auto it = free_blocks_.find(size);
+      if (it != free_blocks_.end() && !it->second.empty()) {
+        *out = reinterpret_cast<uint8_t*>(it->second.back());
+        it->second.pop_back();
+        bytes_cached_ -= size;
+        bytes_allocated_ += nbytes;
+        return Status::OK();
+      }
+    }
 
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
     CUdeviceptr data;
-    CU_RETURN_NOT_OK(cuMemAlloc(&data, static_cast<size_t>(nbytes)));
+    CUresult ret = cuMemAlloc(&data, static_cast<size_t>(size));
+    if (ret == CUDA_ERROR_OUT_OF_MEMORY) {
+      // The cached blocks may be of other sizes, give them back and retry
+      RETURN_NOT_OK(ReleaseCachedMemory());
+      ret = cuMemAlloc(&data, static_cast<size_t>(size));
+    }
+    CU_RETURN_NOT_OK(ret);
     bytes_allocated_ += nbytes;
     *out = reinterpret_cast<uint8_t*>(data);
     return Status::OK();
   }
 
+  Status ReleaseCachedMemory() {
+    std::unordered_map<int64_t, std::vector<CUdeviceptr>> free_blocks;
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      free_blocks.swap(free_blocks_);
+      bytes_cached_ = 0;
+    }
+    if (free_blocks.empty()) {
+      return Status::OK();
+    }
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    for (const auto& size_class : free_blocks) {
+      for (CUdeviceptr block : size_class.second) {
+        CU_RETURN_NOT_OK(cuMemFree(block));
+      }
+    }
+    return Status::OK();
+  }
+
   Status CopyHostToDevice(void* dst, const void* src, int64_t nbytes) {
     CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
     CU_RETURN_NOT_OK(cuMemcpyHtoD(reinterpret_cast<CUdeviceptr>(dst), src,
@@ -83,8 +152,42 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    CU_RETURN_NOT_OK(cuMemcpyHtoDAsync(reinterpret_cast<CUdeviceptr>(dst), src,
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    CU_RETURN_NOT_OK(cuMemcpyDtoHAsync(dst, reinterpret_cast<const CUdeviceptr>(src),
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status NewStream(CUstream* out) {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    // Not ordered with the default stream, so that the work of other streams
+    // does not wait for it
+    CU_RETURN_NOT_OK(cuStreamCreate(out, CU_STREAM_NON_BLOCKING));
+    return Status::OK();
+  }
+
+  Status SetCurrent() {
+    CU_RETURN_NOT_OK(cuCtxSetCurrent(context_));
+    return Status::OK();
+  }
+
   Status Free(void* device_ptr, int64_t nbytes) {
-    CU_RETURN_NOT_OK(cuMemFree(reinterpret_cast<CUdeviceptr>(device_ptr)));
+    // Keep the block for a later allocation of the same size class, since
+    // cuMemFree synchronizes the device
+    const int64_t size = AllocationSize(nbytes);
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    free_blocks_[size].push_back(reinterpret_cast<CUdeviceptr>(device_ptr));
+    bytes_cached_ += size;
     bytes_allocated_ -= nbytes;
     return Status::OK();
   }
@@ -119,6 +222,11 @@ class CudaContext::CudaContextImpl {
   bool own_context_;
 
   std::atomic<int64_t> bytes_allocated_;
+
+  // Freed device blocks by size class, and their total size
+  mutable std::mutex cache_mutex_;
+  std::unordered_map<int64_t, std::vector<CUdeviceptr>> free_blocks_;
+  int64_t bytes_cached_;
 };
 
 class CudaDeviceManager::CudaDeviceManagerImpl {
@@ -253,6 +361,29 @@ Status CudaContext::CopyDeviceToHost(void* dst, const void* src, int64_t nbytes)
   return impl_->CopyDeviceToHost(dst, src, nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                                          const CudaStream& stream) {
+  DCHECK_EQ(this, stream.context().get()) << "Stream of another context";
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes,
+                                      static_cast<CUstream>(stream.handle()));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                                          const CudaStream& stream) {
+  DCHECK_EQ(this, stream.context().get()) << "Stream of another context";
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes,
+                                      static_cast<CUstream>(stream.handle()));
+}
+
+Status CudaContext::NewStream(std::shared_ptr<CudaStream>* out) {
+  CUstream stream;
+  RETURN_NOT_OK(impl_->NewStream(&stream));
+  *out = std::shared_ptr<CudaStream>(new CudaStream(this->shared_from_this(), stream));
+  return Status::OK();
+}
+
+Status CudaContext::SetCurrent() { return impl_->SetCurrent(); }
+
 Status CudaContext::Close() { return impl_->Close(); }
 
 Status CudaContext::Free(void* device_ptr, int64_t nbytes) {
@@ -274,7 +405,72 @@ Status CudaContext::OpenIpcBuffer(const CudaIpcMemHandle& ipc_handle,
   return Status::OK();
 }
 
+Status CudaContext::ReleaseCachedMemory() { return impl_->ReleaseCachedMemory(); }
+
 int64_t CudaContext::bytes_allocated() const { return impl_->bytes_allocated(); }
 
+int64_t CudaContext::bytes_cached() const { return impl_->bytes_cached(); }
+
+// ----------------------------------------------------------------------
+// CudaEvent and CudaStream
+
+CudaEvent::CudaEvent(const std::shared_ptr<CudaContext>& context, void* handle)
+    : context_(context), handle_(handle) {}
+
+CudaEvent::~CudaEvent() { CUDA_DCHECK(cuEventDestroy(static_cast<CUevent>(handle_))); }
+
+Status CudaEvent::Synchronize() {
+  CU_RETURN_NOT_OK(cuEventSynchronize(static_cast<CUevent>(handle_)));
+  return Status::OK();
+}
+
+Status CudaEvent::IsDone(bool* done) {
+  const CUresult result = cuEventQuery(static_cast<CUevent>(handle_));
+  *done = result != CUDA_ERROR_NOT_READY;
+  if (*done) {
+    CU_RETURN_NOT_OK(result);
+  }
+  return Status::OK();
+}
+
+CudaStream::CudaStream(const std::shared_ptr<CudaContext>& context, void* handle)
+    : context_(context), handle_(handle) {}
+
+CudaStream::~CudaStream() {
+  // Work still enqueued completes before the stream is released
+  CUDA_DCHECK(cuStreamDestroy(static_cast<CUstream>(handle_)));
+}
+
+Status CudaStream::Synchronize() {
+  CU_RETURN_NOT_OK(cuStreamSynchronize(static_cast<CUstream>(handle_)));
+  return Status::OK();
+}
+
+Status CudaStream::IsDone(bool* done) {
+  const CUresult result = cuStreamQuery(static_cast<CUstream>(handle_));
+  *done = result != CUDA_ERROR_NOT_READY;
+  if (*done) {
+    CU_RETURN_NOT_OK(result);
+  }
+  return Status::OK();
+}
+
+Status CudaStream::RecordEvent(std::shared_ptr<CudaEvent>* out) {
+  RETURN_NOT_OK(context_->SetCurrent());
+  CUevent event;
+  CU_RETURN_NOT_OK(cuEventCreate(&event, CU_EVENT_DISABLE_TIMING));
+  // Owned before recording, so that it is destroyed if recording fails
+  std::shared_ptr<CudaEvent> recorded(new CudaEvent(context_, event));
+  CU_RETURN_NOT_OK(cuEventRecord(event, static_cast<CUstream>(handle_)));
+  *out = recorded;
+  return Status::OK();
+}
+
+Status CudaStream::WaitEvent(const CudaEvent& event) {
+  CU_RETURN_NOT_OK(cuStreamWaitEvent(static_cast<CUstream>(handle_),
+                                     static_cast<CUevent>(event.handle_), 0));
+  return Status::OK();
+}
+
 }  // namespace gpu
 }  // namespace arrow
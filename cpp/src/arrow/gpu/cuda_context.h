@@ -62,6 +62,73 @@ class ARROW_EXPORT CudaDeviceManager {
 
 struct ARROW_EXPORT CudaDeviceInfo {};
 
+/// \class CudaEvent
+/// \brief A marker in a CudaStream, which completes once the work enqueued on
+/// the stream before it has completed
+class ARROW_EXPORT CudaEvent {
+ public:
+  ~CudaEvent();
+
+  /// \brief Block until the event has completed
+  Status Synchronize();
+
+  /// \brief Check whether the event has completed, without blocking
+  /// \param[out] done true if the event has completed
+  /// \return Status
+  Status IsDone(bool* done);
+
+ private:
+  CudaEvent(const std::shared_ptr<CudaContext>& context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  // A CUevent
+  void* handle_;
+
+  friend CudaStream;
+};
+
+/// \class CudaStream
+/// \brief A queue of asynchronous operations on a device, executed in order.
+///
+/// Operations on different streams may run concurrently, e.g. a copy to the
+/// device on one stream with a kernel on another.
+class ARROW_EXPORT CudaStream {
+ public:
+  ~CudaStream();
+
+  /// \brief Block until all the work enqueued on the stream has completed
+  Status Synchronize();
+
+  /// \brief Check whether all the work enqueued on the stream has completed,
+  /// without blocking
+  /// \param[out] done true if the work has completed
+  /// \return Status
+  Status IsDone(bool* done);
+
+  /// \brief Record an event completing with the work enqueued so far
+  /// \param[out] out the event
+  /// \return Status
+  Status RecordEvent(std::shared_ptr<CudaEvent>* out);
+
+  /// \brief Make the work enqueued from now on wait for an event, which may
+  /// have been recorded on another stream. This does not block the host.
+  Status WaitEvent(const CudaEvent& event);
+
+  /// \brief The CUstream of the driver API, e.g. to launch kernels on
+  void* handle() const { return handle_; }
+
+  std::shared_ptr<CudaContext> context() const { return context_; }
+
+ private:
+  CudaStream(const std::shared_ptr<CudaContext>& context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  // A CUstream
+  void* handle_;
+
+  friend CudaContext;
+};
+
 /// \class CudaContext
 /// \brief Friendlier interface to the CUDA driver API
 class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext> {
@@ -71,11 +138,25 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status Close();
 
   /// \brief Allocate CUDA memory on GPU device for this context
+  ///
+  /// Allocations are rounded up to size classes, and the memory of destroyed
+  /// buffers is kept for later allocations of the same class instead of being
+  /// returned to the device, like a host MemoryPool. Memory may therefore be
+  /// reused as soon as its buffer is destroyed: streams using a buffer must be
+  /// synchronized before destroying it.
+  ///
   /// \param[in] nbytes number of bytes
   /// \param[out] out the allocated buffer
   /// \return Status
   Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
 
+  /// \brief Return the memory kept for later allocations to the device
+  ///
+  /// This is also done when an allocation runs out of device memory, and when
+  /// the context is closed.
+  /// \return Status
+  Status ReleaseCachedMemory();
+
   /// \brief Open existing CUDA IPC memory handle
   /// \param[in] ipc_handle opaque pointer to CUipcMemHandle (driver API)
   /// \param[out] buffer a CudaBuffer referencing
@@ -83,16 +164,32 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status OpenIpcBuffer(const CudaIpcMemHandle& ipc_handle,
                        std::shared_ptr<CudaBuffer>* buffer);
 
+  /// \brief Create a stream for asynchronous operations on this context
+  /// \param[out] out the stream
+  /// \return Status
+  Status NewStream(std::shared_ptr<CudaStream>* out);
+
+  /// \brief The number of bytes of the buffers allocated by this context
   int64_t bytes_allocated() const;
 
+  /// \brief The number of device bytes kept for later allocations
+  int64_t bytes_cached() const;
+
  private:
   CudaContext();
 
   Status ExportIpcBuffer(void* data, std::shared_ptr<CudaIpcMemHandle>* handle);
   Status CopyHostToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               const CudaStream& stream);
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               const CudaStream& stream);
   Status Free(void* device_ptr, int64_t nbytes);
 
+  // Make this context current on the calling thread
+  Status SetCurrent();
+
   class CudaContextImpl;
   std::unique_ptr<CudaContextImpl> impl_;
 
@@ -100,6 +197,8 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   friend CudaBufferReader;
   friend CudaBufferWriter;
   friend CudaDeviceManager::CudaDeviceManagerImpl;
+  friend CudaEvent;
+  friend CudaStream;
 };
 
 }  // namespace gpu
@@ -20,8 +20,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <cuda.h>
 
@@ -87,8 +91,10 @@ Status CudaBuffer::Close() {
     if (is_ipc_) {
       CU_RETURN_NOT_OK(cuIpcCloseMemHandle(reinterpret_cast<CUdeviceptr>(mutable_data_)));
     } else {
-      return context_->Free(mutable_data_, size_);
+      RETURN_NOT_OK(context_->Free(mutable_data_, size_));
     }
+    // Closing twice must not free the memory twice
+    own_data_ = false;
   }
   return Status::OK();
 }
@@ -111,6 +117,17 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, const CudaStream& stream) const {
+  return context_->CopyDeviceToHostAsync(out, data_ + position, nbytes, stream);
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, const CudaStream& stream) {
+  DCHECK_LE(nbytes, size_ - position) << "Copy would overflow buffer";
+  return context_->CopyHostToDeviceAsync(mutable_data_ + position, data, nbytes, stream);
+}
+
 Status CudaBuffer::ExportForIpc(std::shared_ptr<CudaIpcMemHandle>* handle) {
   if (is_ipc_) {
     return Status::Invalid("Buffer has already been exported for IPC");
@@ -166,22 +183,39 @@ class CudaBufferWriter::CudaBufferWriterImpl {
     position_ = 0;
   }
 
+  ~CudaBufferWriterImpl() {
+    // The host buffer being copied asynchronously must outlive the copy
+    Status status = WaitForCopy();
+    DCHECK(status.ok()) << status.message();
+  }
+
   Status Seek(int64_t position) {
     if (position < 0 || position >= size_) {
       return Status::IOError("position out of bounds");
     }
+    // Later writes may overlap the bytes still being copied
+    RETURN_NOT_OK(WaitForCopy());
     position_ = position;
     return Status::OK();
   }
 
   Status Flush() {
-    if (buffer_size_ > 0 && buffer_position_ > 0) {
-      // Only need to flush when the write has been buffered
-      RETURN_NOT_OK(
-          context_->CopyHostToDevice(mutable_data_ + position_ - buffer_position_,
-                                     host_buffer_data_, buffer_position_));
-      buffer_position_ = 0;
+    RETURN_NOT_OK(FlushBuffer());
+    return WaitForCopy();
+  }
+
+  Status FlushAsync() {
+    if (stream_ == nullptr) {
+      return Status::Invalid("No stream was set to flush asynchronously on");
     }
+    return FlushBuffer();
+  }
+
+  Status SetStream(const std::shared_ptr<CudaStream>& stream) {
+    DCHECK(stream == nullptr || stream->context() == context_)
+        << "Stream of another context";
+    RETURN_NOT_OK(Flush());
+    stream_ = stream;
     return Status::OK();
   }
 
@@ -196,15 +230,20 @@ class CudaBufferWriter::CudaBufferWriterImpl {
     }
 
     if (buffer_size_ > 0) {
-      if (nbytes + buffer_position_ >= buffer_size_) {
-        // Reach end of buffer, write everything
-        RETURN_NOT_OK(Flush());
-        RETURN_NOT_OK(
-            context_->CopyHostToDevice(mutable_data_ + position_, data, nbytes));
-      } else {
+      bool fits = nbytes + buffer_position_ < buffer_size_;
+      if (!fits) {
+        RETURN_NOT_OK(FlushBuffer());
+        // With a stream, the bytes are buffered while the flushed ones are copied
+        fits = stream_ != nullptr && nbytes < buffer_size_;
+      }
+      if (fits) {
         // Write bytes to buffer
         std::memcpy(host_buffer_data_ + buffer_position_, data, nbytes);
         buffer_position_ += nbytes;
+      } else {
+        // Reach end of buffer, write everything
+        RETURN_NOT_OK(
+            context_->CopyHostToDevice(mutable_data_ + position_, data, nbytes));
       }
     } else {
       // Unbuffered write
@@ -221,12 +260,11 @@ class CudaBufferWriter::CudaBufferWriterImpl {
   }
 
   Status SetBufferSize(const int64_t buffer_size) {
-    if (buffer_position_ > 0) {
-      // Flush any buffered data
-      RETURN_NOT_OK(Flush());
-    }
+    // Flush any buffered data, and wait for the copies of the host buffers
+    RETURN_NOT_OK(Flush());
     RETURN_NOT_OK(AllocateCudaHostBuffer(buffer_size, &host_buffer_));
     host_buffer_data_ = host_buffer_->mutable_data();
+    spare_host_buffer_.reset();
     buffer_size_ = buffer_size;
     return Status::OK();
   }
@@ -236,6 +274,41 @@ class CudaBufferWriter::CudaBufferWriterImpl {
   int64_t buffer_position() const { return buffer_position_; }
 
  private:
+  // Copy the buffered bytes to the device, asynchronously if there is a stream
+  Status FlushBuffer() {
+    if (buffer_size_ == 0 || buffer_position_ == 0) {
+      // Only need to flush when the write has been buffered
+      return Status::OK();
+    }
+    uint8_t* dst = mutable_data_ + position_ - buffer_position_;
+    if (stream_ == nullptr) {
+      RETURN_NOT_OK(context_->CopyHostToDevice(dst, host_buffer_data_, buffer_position_));
+    } else {
+      // Go on buffering in the spare host buffer while this one is copied, once
+      // the previous copy from the spare one has completed
+      if (spare_host_buffer_ == nullptr) {
+        RETURN_NOT_OK(AllocateCudaHostBuffer(buffer_size_, &spare_host_buffer_));
+      }
+      RETURN_NOT_OK(WaitForCopy());
+      RETURN_NOT_OK(context_->CopyHostToDeviceAsync(dst, host_buffer_data_,
+                                                    buffer_position_, *stream_));
+      RETURN_NOT_OK(stream_->RecordEvent(&copy_done_));
+      std::swap(host_buffer_, spare_host_buffer_);
+      host_buffer_data_ = host_buffer_->mutable_data();
+    }
+    buffer_position_ = 0;
+    return Status::OK();
+  }
+
+  // Wait for the asynchronous copy from the spare host buffer, if any
+  Status WaitForCopy() {
+    if (copy_done_ != nullptr) {
+      RETURN_NOT_OK(copy_done_->Synchronize());
+      copy_done_.reset();
+    }
+    return Status::OK();
+  }
+
   std::shared_ptr<CudaContext> context_;
   std::shared_ptr<CudaBuffer> buffer_;
   std::mutex lock_;
@@ -248,6 +321,12 @@ class CudaBufferWriter::CudaBufferWriterImpl {
   int64_t buffer_position_;
   std::shared_ptr<CudaHostBuffer> host_buffer_;
   uint8_t* host_buffer_data_;
+
+  // With a stream, the buffered bytes are copied asynchronously from the host
+  // buffer, which is then swapped with the spare one
+  std::shared_ptr<CudaStream> stream_;
+  std::shared_ptr<CudaHostBuffer> spare_host_buffer_;
+  std::shared_ptr<CudaEvent> copy_done_;
 };
 
 CudaBufferWriter::CudaBufferWriter(const std::shared_ptr<CudaBuffer>& buffer) {
@@ -260,6 +339,12 @@ Status CudaBufferWriter::Close() { return Flush(); }
 
 Status CudaBufferWriter::Flush() { return impl_->Flush(); }
 
+Status CudaBufferWriter::FlushAsync() { return impl_->FlushAsync(); }
+
+Status CudaBufferWriter::SetStream(const std::shared_ptr<CudaStream>& stream) {
+  return impl_->SetStream(stream);
+}
+
 Status CudaBufferWriter::Seek(int64_t position) {
   if (impl_->buffer_position() > 0) {
     RETURN_NOT_OK(Flush());
@@ -293,5 +378,152 @@ Status AllocateCudaHostBuffer(const int64_t size, std::shared_ptr<CudaHostBuffer
   return manager->AllocateHost(size, out);
 }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+namespace {
+
+// The smallest block, which keeps the blocks 64-byte aligned in the chunks
+constexpr int64_t kMinHostBlockSize = 64;
+
+int64_t HostBlockSize(int64_t size) {
+  int64_t block_size = kMinHostBlockSize;
+  while (block_size < size) {
+    block_size *= 2;
+  }
+  return block_size;
+}
+
+}  // namespace
+
+class CudaHostMemoryPool::CudaHostMemoryPoolImpl {
+ public:
+  explicit CudaHostMemoryPoolImpl(int64_t chunk_size)
+      : chunk_size_(HostBlockSize(chunk_size)),
+        chunk_position_(0),
+        bytes_allocated_(0),
+        max_memory_(0),
+        bytes_pinned_(0) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t block_size = HostBlockSize(size);
+    if (block_size > chunk_size_ / 4) {
+      std::shared_ptr<CudaHostBuffer> buffer;
+      RETURN_NOT_OK(AllocateCudaHostBuffer(size, &buffer));
+      *out = buffer->mutable_data();
+      large_blocks_[*out] = buffer;
+      bytes_pinned_ += size;
+    } else {
+      std::vector<uint8_t*>& free_blocks = free_blocks_[block_size];
+      if (!free_blocks.empty()) {
+        *out = free_blocks.back();
+        free_blocks.pop_back();
+      } else {
+        if (chunks_.empty() || chunk_position_ + block_size > chunk_size_) {
+          // The rest of the current chunk is left unused
+          std::shared_ptr<CudaHostBuffer> chunk;
+          RETURN_NOT_OK(AllocateCudaHostBuffer(chunk_size_, &chunk));
+          chunks_.push_back(chunk);
+          chunk_position_ = 0;
+          bytes_pinned_ += chunk_size_;
+        }
+        *out = chunks_.back()->mutable_data() + chunk_position_;
+        chunk_position_ += block_size;
+      }
+    }
+    bytes_allocated_ += size;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t old_block_size = HostBlockSize(old_size);
+    if (old_block_size <= chunk_size_ / 4 && old_block_size == HostBlockSize(new_size)) {
+      // The block is large enough already
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_allocated_ += new_size - old_size;
+      max_memory_ = std::max(max_memory_, bytes_allocated_);
+      return Status::OK();
+    }
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DCHECK_GE(bytes_allocated_, size);
+    bytes_allocated_ -= size;
+    const int64_t block_size = HostBlockSize(size);
+    if (block_size > chunk_size_ / 4) {
+      // Unpinned by the destructor of the CudaHostBuffer
+      DCHECK_EQ(1, large_blocks_.count(buffer));
+      large_blocks_.erase(buffer);
+      bytes_pinned_ -= size;
+    } else {
+      free_blocks_[block_size].push_back(buffer);
+    }
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_pinned() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_pinned_;
+  }
+
+ private:
+  const int64_t chunk_size_;
+
+  mutable std::mutex mutex_;
+  // The pinned chunks, blocks being taken from the end of the last one
+  std::vector<std::shared_ptr<CudaHostBuffer>> chunks_;
+  int64_t chunk_position_;
+  // Freed blocks of the chunks by size
+  std::unordered_map<int64_t, std::vector<uint8_t*>> free_blocks_;
+  // Allocations pinned on their own
+  std::unordered_map<uint8_t*, std::shared_ptr<CudaHostBuffer>> large_blocks_;
+
+  int64_t bytes_allocated_;
+  int64_t max_memory_;
+  int64_t bytes_pinned_;
+};
+
+CudaHostMemoryPool::CudaHostMemoryPool(int64_t chunk_size)
+    : impl_(new CudaHostMemoryPoolImpl(chunk_size)) {}
+
+CudaHostMemoryPool::~CudaHostMemoryPool() {}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaHostMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t CudaHostMemoryPool::bytes_pinned() const { return impl_->bytes_pinned(); }
+
 }  // namespace gpu
 }  // namespace arrow
@@ -31,6 +31,7 @@ namespace gpu {
 
 class CudaContext;
 class CudaIpcMemHandle;
+class CudaStream;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -58,6 +59,32 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy from GPU device to CPU host on a stream
+  /// \param[in] position start position to copy bytes
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out a pre-allocated output buffer, which must stay valid until
+  /// the copy has completed
+  /// \param[in] stream a stream of the context of this buffer
+  /// \return Status
+  ///
+  /// \note The copy only runs concurrently with the host and with other
+  /// streams if out is pinned memory, e.g. of a CudaHostBuffer
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         const CudaStream& stream) const;
+
+  /// \brief Enqueue a copy from CPU host to device at position on a stream
+  /// \param[in] position start position to copy bytes
+  /// \param[in] data the host data to copy, which must stay valid and unchanged
+  /// until the copy has completed
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream a stream of the context of this buffer
+  /// \return Status
+  ///
+  /// \note The copy only runs concurrently with the host and with other
+  /// streams if data is pinned memory, e.g. of a CudaHostBuffer
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           const CudaStream& stream);
+
   /// \brief Expose this device buffer as IPC memory which can be used in other processes
   /// \param[out] handle the exported IPC handle
   /// \return Status
@@ -153,9 +180,27 @@ class ARROW_EXPORT CudaBufferWriter : public io::WriteableFile {
   /// \brief Close writer and flush buffered bytes to GPU
   Status Close() override;
 
-  /// \brief Flush buffered bytes to GPU
+  /// \brief Flush buffered bytes to GPU, and wait for the asynchronous copies
+  /// of previous flushes to complete
   Status Flush() override;
 
+  /// \brief Start copying the buffered bytes to the GPU on the stream set
+  /// with SetStream(), without waiting for the copy to complete
+  Status FlushAsync();
+
+  /// \brief Copy buffered bytes to the GPU asynchronously on a stream
+  /// \param[in] stream a stream of the context of the buffer written, or null
+  /// to copy them synchronously again
+  /// \return Status
+  ///
+  /// When the host buffer is full, or on FlushAsync(), its bytes are copied
+  /// on the stream while the next writes fill a second host buffer, so that
+  /// the copies overlap with writing. Flush() and Close() wait for the
+  /// copies to complete; the stream can also be synchronized, or made to
+  /// wait for an event recorded on it. Writes larger than the host buffer
+  /// are still copied synchronously.
+  Status SetStream(const std::shared_ptr<CudaStream>& stream);
+
   Status Seek(int64_t position) override;
 
   Status Write(const void* data, int64_t nbytes) override;
@@ -189,6 +234,39 @@ class ARROW_EXPORT CudaBufferWriter : public io::WriteableFile {
 ARROW_EXPORT
 Status AllocateCudaHostBuffer(const int64_t size, std::shared_ptr<CudaHostBuffer>* out);
 
+/// \class CudaHostMemoryPool
+/// \brief A MemoryPool of pinned host memory, from which copies to and from
+/// the device run at full bandwidth
+///
+/// Pinning memory is slow, so the pool pins it in chunks with
+/// CudaDeviceManager::AllocateHost and hands out blocks of them in power-of-two
+/// size classes. Freed blocks are kept for later allocations of their size
+/// class, and the chunks are only unpinned when the pool is destroyed.
+/// Allocations larger than a quarter of a chunk are pinned on their own and
+/// unpinned when freed.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] chunk_size number of bytes pinned at once
+  explicit CudaHostMemoryPool(int64_t chunk_size = 1 << 24);
+  ~CudaHostMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of bytes of pinned memory held by the pool
+  int64_t bytes_pinned() const;
+
+ private:
+  class CudaHostMemoryPoolImpl;
+  std::unique_ptr<CudaHostMemoryPoolImpl> impl_;
+};
+
 }  // namespace gpu
 }  // namespace arrow
 
@@ -18,9 +18,14 @@
 #ifndef ARROW_IO_API_H
 #define ARROW_IO_API_H
 
+#include "arrow/io/buffered.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/compressed.h"
 #include "arrow/io/file.h"
 #include "arrow/io/hdfs.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/readahead.h"
 
 #endif  // ARROW_IO_API_H
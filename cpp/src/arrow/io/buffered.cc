@@ -0,0 +1,445 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/buffered.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace io {
+
+static Status CheckBufferSize(int64_t buffer_size) {
+  if (buffer_size <= 0) {
+    std::stringstream ss;
+    ss << "Buffer size must be positive, got " << buffer_size;
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// BufferedOutputStream implementation
+
+class BufferedOutputStream::Impl {
+ public:
+  Impl(const std::shared_ptr<OutputStream>& raw, MemoryPool* pool)
+      : raw_(raw), pool_(pool), is_open_(true), buffer_pos_(0), raw_pos_(-1) {}
+
+  Status Init(int64_t buffer_size) {
+    RETURN_NOT_OK(CheckBufferSize(buffer_size));
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, buffer_size, &buffer_));
+    return raw_->Tell(&raw_pos_);
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      Status st = FlushUnlocked();
+      is_open_ = false;
+      RETURN_NOT_OK(raw_->Close());
+      return st;
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = raw_pos_ + buffer_pos_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    return WriteUnlocked(data, nbytes);
+  }
+
+  Status Writev(const std::vector<WriteSlice>& slices) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    int64_t total = 0;
+    for (const auto& slice : slices) {
+      total += slice.nbytes;
+    }
+    if (buffer_pos_ + total <= buffer_->size()) {
+      for (const auto& slice : slices) {
+        RETURN_NOT_OK(WriteUnlocked(slice.data, slice.nbytes));
+      }
+      return Status::OK();
+    }
+    // Large slices are written out with the buffered bytes in a single call
+    std::vector<WriteSlice> all_slices;
+    all_slices.reserve(slices.size() + 1);
+    if (buffer_pos_ > 0) {
+      all_slices.push_back({buffer_->data(), buffer_pos_});
+    }
+    all_slices.insert(all_slices.end(), slices.begin(), slices.end());
+    RETURN_NOT_OK(raw_->Writev(all_slices));
+    raw_pos_ += buffer_pos_ + total;
+    buffer_pos_ = 0;
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    RETURN_NOT_OK(FlushUnlocked());
+    return raw_->Flush();
+  }
+
+  Status Detach(std::shared_ptr<OutputStream>* raw) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    RETURN_NOT_OK(FlushUnlocked());
+    is_open_ = false;
+    *raw = raw_;
+    return Status::OK();
+  }
+
+  Status SetBufferSize(int64_t new_buffer_size) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckBufferSize(new_buffer_size));
+    if (buffer_pos_ > new_buffer_size) {
+      RETURN_NOT_OK(FlushUnlocked());
+    }
+    return buffer_->Resize(new_buffer_size);
+  }
+
+  int64_t buffer_size() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return buffer_->size();
+  }
+
+  int64_t bytes_buffered() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return buffer_pos_;
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+ private:
+  Status CheckOpen() const {
+    if (ARROW_PREDICT_FALSE(!is_open_)) {
+      return Status::IOError("OutputStream is closed");
+    }
+    return Status::OK();
+  }
+
+  Status WriteUnlocked(const void* data, int64_t nbytes) {
+    if (nbytes < 0) {
+      return Status::Invalid("Write length must be non-negative");
+    }
+    if (buffer_pos_ + nbytes > buffer_->size()) {
+      RETURN_NOT_OK(FlushUnlocked());
+    }
+    if (nbytes >= buffer_->size()) {
+      // Pass large writes through rather than copying them
+      RETURN_NOT_OK(raw_->Write(data, nbytes));
+      raw_pos_ += nbytes;
+      return Status::OK();
+    }
+    if (nbytes > 0) {
+      memcpy(buffer_->mutable_data() + buffer_pos_, data, static_cast<size_t>(nbytes));
+      buffer_pos_ += nbytes;
+    }
+    return Status::OK();
+  }
+
+  Status FlushUnlocked() {
+    if (buffer_pos_ > 0) {
+      // Keep the buffered bytes if the write fails
+      RETURN_NOT_OK(raw_->Write(buffer_->data(), buffer_pos_));
+      raw_pos_ += buffer_pos_;
+      buffer_pos_ = 0;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<OutputStream> raw_;
+  MemoryPool* pool_;
+  mutable std::mutex lock_;
+  bool is_open_;
+
+  std::shared_ptr<ResizableBuffer> buffer_;
+  int64_t buffer_pos_;
+
+  // The position of the wrapped stream, so that Tell needs no call to it
+  int64_t raw_pos_;
+};
+
+BufferedOutputStream::BufferedOutputStream() {}
+
+BufferedOutputStream::~BufferedOutputStream() { DCHECK(impl_->Close().ok()); }
+
+Status BufferedOutputStream::Create(const std::shared_ptr<OutputStream>& raw,
+                                    int64_t buffer_size, MemoryPool* pool,
+                                    std::shared_ptr<BufferedOutputStream>* out) {
+  std::shared_ptr<BufferedOutputStream> result(new BufferedOutputStream());
+  result->impl_.reset(new Impl(raw, pool));
+  RETURN_NOT_OK(result->impl_->Init(buffer_size));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status BufferedOutputStream::SetBufferSize(int64_t new_buffer_size) {
+  return impl_->SetBufferSize(new_buffer_size);
+}
+
+int64_t BufferedOutputStream::buffer_size() const { return impl_->buffer_size(); }
+
+int64_t BufferedOutputStream::bytes_buffered() const { return impl_->bytes_buffered(); }
+
+Status BufferedOutputStream::Detach(std::shared_ptr<OutputStream>* raw) {
+  return impl_->Detach(raw);
+}
+
+std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
+
+Status BufferedOutputStream::Close() { return impl_->Close(); }
+
+Status BufferedOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status BufferedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status BufferedOutputStream::Writev(const std::vector<WriteSlice>& slices) {
+  return impl_->Writev(slices);
+}
+
+Status BufferedOutputStream::Flush() { return impl_->Flush(); }
+
+// ----------------------------------------------------------------------
+// BufferedInputStream implementation
+
+class BufferedInputStream::Impl {
+ public:
+  Impl(const std::shared_ptr<InputStream>& raw, MemoryPool* pool)
+      : raw_(raw),
+        pool_(pool),
+        is_open_(true),
+        buffer_size_(0),
+        buffer_pos_(0),
+        bytes_buffered_(0),
+        raw_pos_(-1) {}
+
+  Status Init(int64_t buffer_size) {
+    RETURN_NOT_OK(CheckBufferSize(buffer_size));
+    buffer_size_ = buffer_size;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, buffer_size, &buffer_));
+    return raw_->Tell(&raw_pos_);
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      is_open_ = false;
+      return raw_->Close();
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = raw_pos_ - bytes_buffered_;
+    return Status::OK();
+  }
+
+  Status Peek(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (nbytes < 0) {
+      return Status::Invalid("Peek length must be non-negative");
+    }
+    if (nbytes > bytes_buffered_) {
+      // Move the buffered bytes to the front and read more behind them
+      if (nbytes > buffer_->size()) {
+        RETURN_NOT_OK(buffer_->Resize(nbytes));
+      }
+      if (buffer_pos_ > 0 && bytes_buffered_ > 0) {
+        memmove(buffer_->mutable_data(), buffer_->data() + buffer_pos_,
+                static_cast<size_t>(bytes_buffered_));
+      }
+      buffer_pos_ = 0;
+      RETURN_NOT_OK(FillBuffer(nbytes));
+    }
+    *out = SliceBuffer(buffer_, buffer_pos_, std::min(nbytes, bytes_buffered_));
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (nbytes < 0) {
+      return Status::Invalid("Read length must be non-negative");
+    }
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+
+    // The buffered bytes first
+    int64_t copied = std::min(nbytes, bytes_buffered_);
+    if (copied > 0) {
+      memcpy(out_data, buffer_->data() + buffer_pos_, static_cast<size_t>(copied));
+      Consume(copied);
+    }
+
+    const int64_t remaining = nbytes - copied;
+    if (remaining >= buffer_size_) {
+      // Pass large reads through rather than copying them
+      int64_t raw_read = 0;
+      RETURN_NOT_OK(raw_->Read(remaining, &raw_read, out_data + copied));
+      raw_pos_ += raw_read;
+      copied += raw_read;
+    } else if (remaining > 0) {
+      buffer_pos_ = 0;
+      RETURN_NOT_OK(FillBuffer(remaining));
+      const int64_t ncopy = std::min(remaining, bytes_buffered_);
+      memcpy(out_data + copied, buffer_->data(), static_cast<size_t>(ncopy));
+      Consume(ncopy);
+      copied += ncopy;
+    }
+    *bytes_read = copied;
+    return Status::OK();
+  }
+
+  int64_t buffer_size() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return buffer_size_;
+  }
+
+  int64_t bytes_buffered() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return bytes_buffered_;
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+  MemoryPool* pool() const { return pool_; }
+
+ private:
+  Status CheckOpen() const {
+    if (ARROW_PREDICT_FALSE(!is_open_)) {
+      return Status::IOError("InputStream is closed");
+    }
+    return Status::OK();
+  }
+
+  void Consume(int64_t nbytes) {
+    buffer_pos_ += nbytes;
+    bytes_buffered_ -= nbytes;
+  }
+
+  // Read from the wrapped stream, as much as fits in the buffer, until at
+  // least min_bytes are buffered or the stream ends. The buffered bytes must
+  // start at the front of the buffer
+  Status FillBuffer(int64_t min_bytes) {
+    DCHECK_EQ(0, buffer_pos_);
+    // Peek may have grown the buffer; shrink it back once it is drained
+    if (bytes_buffered_ == 0 && buffer_->size() > buffer_size_) {
+      RETURN_NOT_OK(buffer_->Resize(buffer_size_));
+    }
+    while (bytes_buffered_ < min_bytes) {
+      int64_t raw_read = 0;
+      RETURN_NOT_OK(raw_->Read(buffer_->size() - bytes_buffered_, &raw_read,
+                               buffer_->mutable_data() + bytes_buffered_));
+      if (raw_read == 0) {
+        break;
+      }
+      raw_pos_ += raw_read;
+      bytes_buffered_ += raw_read;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  MemoryPool* pool_;
+  mutable std::mutex lock_;
+  bool is_open_;
+
+  // The requested size of the buffer, which Peek can grow past
+  int64_t buffer_size_;
+  std::shared_ptr<ResizableBuffer> buffer_;
+  int64_t buffer_pos_;
+  int64_t bytes_buffered_;
+
+  // The position of the wrapped stream, so that Tell needs no call to it
+  int64_t raw_pos_;
+};
+
+BufferedInputStream::BufferedInputStream() {}
+
+BufferedInputStream::~BufferedInputStream() { DCHECK(impl_->Close().ok()); }
+
+Status BufferedInputStream::Create(const std::shared_ptr<InputStream>& raw,
+                                   int64_t buffer_size, MemoryPool* pool,
+                                   std::shared_ptr<BufferedInputStream>* out) {
+  std::shared_ptr<BufferedInputStream> result(new BufferedInputStream());
+  result->impl_.reset(new Impl(raw, pool));
+  RETURN_NOT_OK(result->impl_->Init(buffer_size));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status BufferedInputStream::Peek(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Peek(nbytes, out);
+}
+
+int64_t BufferedInputStream::buffer_size() const { return impl_->buffer_size(); }
+
+int64_t BufferedInputStream::bytes_buffered() const { return impl_->bytes_buffered(); }
+
+std::shared_ptr<InputStream> BufferedInputStream::raw() const { return impl_->raw(); }
+
+Status BufferedInputStream::Close() { return impl_->Close(); }
+
+Status BufferedInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status BufferedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status BufferedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(impl_->pool(), nbytes, &buffer));
+
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+  if (bytes_read < nbytes) {
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+  }
+  *out = buffer;
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Buffered input and output streams over any stream
+
+#ifndef ARROW_IO_BUFFERED_H
+#define ARROW_IO_BUFFERED_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+static constexpr int64_t kDefaultBufferSize = 1 << 16;
+
+/// \class BufferedOutputStream
+/// \brief Gather small writes into fewer, larger writes to a stream
+///
+/// Writes are copied into a buffer which is written to the wrapped stream
+/// when full, on Flush and on Close. Writes at least as large as the buffer
+/// go straight to the wrapped stream
+class ARROW_EXPORT BufferedOutputStream : public OutputStream {
+ public:
+  ~BufferedOutputStream() override;
+
+  /// \brief Create a buffered output stream wrapping the given stream
+  ///
+  /// \param[in] raw the stream to write to
+  /// \param[in] buffer_size the size of the buffer, in bytes
+  /// \param[in] pool MemoryPool to allocate the buffer from
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(const std::shared_ptr<OutputStream>& raw, int64_t buffer_size,
+                       MemoryPool* pool, std::shared_ptr<BufferedOutputStream>* out);
+
+  /// \brief Resize the buffer, writing out the buffered bytes first if they
+  /// do not fit
+  Status SetBufferSize(int64_t new_buffer_size);
+
+  int64_t buffer_size() const;
+
+  /// Number of bytes written but not yet passed to the wrapped stream
+  int64_t bytes_buffered() const;
+
+  /// \brief Write out the buffered bytes and return the wrapped stream,
+  /// leaving this stream closed but the wrapped one open
+  Status Detach(std::shared_ptr<OutputStream>* raw);
+
+  /// The wrapped stream
+  std::shared_ptr<OutputStream> raw() const;
+
+  // Implement the OutputStream interface
+
+  /// Write out the buffered bytes and close the wrapped stream
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Write(const void* data, int64_t nbytes) override;
+  Status Writev(const std::vector<WriteSlice>& slices) override;
+
+  /// Write out the buffered bytes and flush the wrapped stream
+  Status Flush() override;
+
+ private:
+  BufferedOutputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class BufferedInputStream
+/// \brief Read a stream in fewer, larger reads
+///
+/// Reads are served from a buffer which is refilled from the wrapped stream
+/// as needed. Reads at least as large as the buffer go straight to the
+/// wrapped stream once the buffered bytes are used up
+class ARROW_EXPORT BufferedInputStream : public InputStream {
+ public:
+  ~BufferedInputStream() override;
+
+  /// \brief Create a buffered input stream wrapping the given stream
+  ///
+  /// \param[in] raw the stream to read from
+  /// \param[in] buffer_size the size of the buffer, in bytes
+  /// \param[in] pool MemoryPool to allocate the buffer from
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(const std::shared_ptr<InputStream>& raw, int64_t buffer_size,
+                       MemoryPool* pool, std::shared_ptr<BufferedInputStream>* out);
+
+  /// \brief Return the next bytes of the stream without consuming them
+  ///
+  /// The buffer is extended to hold nbytes if needed. Fewer bytes are
+  /// returned at the end of the stream. The returned buffer is a view of the
+  /// internal buffer, only valid until the next read from this stream
+  ///
+  /// \param[in] nbytes the number of bytes to look at
+  /// \param[out] out the next bytes of the stream
+  /// \return Status
+  Status Peek(int64_t nbytes, std::shared_ptr<Buffer>* out);
+
+  int64_t buffer_size() const;
+
+  /// Number of bytes read from the wrapped stream but not yet consumed
+  int64_t bytes_buffered() const;
+
+  /// The wrapped stream
+  std::shared_ptr<InputStream> raw() const;
+
+  // Implement the InputStream interface
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+ private:
+  BufferedInputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_BUFFERED_H
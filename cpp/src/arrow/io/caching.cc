@@ -0,0 +1,582 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace io {
+
+namespace {
+
+struct BlockKey {
+  std::string path;
+  int64_t file_size;
+  int64_t offset;
+
+  bool operator==(const BlockKey& other) const {
+    return offset == other.offset && file_size == other.file_size && path == other.path;
+  }
+};
+
+struct BlockKeyHash {
+  size_t operator()(const BlockKey& key) const {
+    size_t h = std::hash<std::string>()(key.path);
+    h = h * 31 + std::hash<int64_t>()(key.file_size);
+    return h * 31 + std::hash<int64_t>()(key.offset);
+  }
+};
+
+// Least recently used first out, most recently used at the front
+template <typename Value>
+class LruMap {
+ public:
+  using Entry = std::pair<BlockKey, Value>;
+
+  Value* Find(const BlockKey& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &it->second->second;
+  }
+
+  // Insert or replace, returning the replaced value if any
+  bool Put(const BlockKey& key, Value value, Value* replaced) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      *replaced = std::move(it->second->second);
+      it->second->second = std::move(value);
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return true;
+    }
+    entries_.emplace_front(key, std::move(value));
+    index_[key] = entries_.begin();
+    return false;
+  }
+
+  bool Remove(const BlockKey& key, Value* removed) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return false;
+    }
+    *removed = std::move(it->second->second);
+    entries_.erase(it->second);
+    index_.erase(it);
+    return true;
+  }
+
+  Entry PopOldest() {
+    Entry entry = std::move(entries_.back());
+    index_.erase(entry.first);
+    entries_.pop_back();
+    return entry;
+  }
+
+  std::vector<Value> Clear() {
+    std::vector<Value> values;
+    for (auto& entry : entries_) {
+      values.push_back(std::move(entry.second));
+    }
+    entries_.clear();
+    index_.clear();
+    return values;
+  }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  std::list<Entry> entries_;
+  std::unordered_map<BlockKey, typename std::list<Entry>::iterator, BlockKeyHash> index_;
+};
+
+struct SpilledBlock {
+  std::string file_name;
+  int64_t size;
+};
+
+void DeleteSpillFiles(const std::vector<SpilledBlock>& blocks) {
+  for (const SpilledBlock& block : blocks) {
+    std::remove(block.file_name.c_str());
+  }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// BlockCache implementation
+
+class BlockCache::Impl {
+ public:
+  explicit Impl(const BlockCacheOptions& options)
+      : options_(options), next_file_id_(0), statistics_() {}
+
+  ~Impl() { ARROW_UNUSED(Clear()); }
+
+  Status Init() {
+    if (options_.block_size <= 0 || options_.capacity < 0 ||
+        options_.disk_capacity < 0) {
+      return Status::Invalid("Invalid block cache options");
+    }
+    if (!options_.disk_directory.empty()) {
+      RETURN_NOT_OK(LocalFileSystem().MakeDirectory(options_.disk_directory));
+    }
+    return Status::OK();
+  }
+
+  int64_t block_size() const { return options_.block_size; }
+
+  BlockCacheStatistics statistics() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return statistics_;
+  }
+
+  Status Clear() {
+    std::vector<SpilledBlock> spilled;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      memory_.Clear();
+      spilled = disk_.Clear();
+      statistics_.memory_bytes = 0;
+      statistics_.disk_bytes = 0;
+    }
+    DeleteSpillFiles(spilled);
+    return Status::OK();
+  }
+
+  // Return a cached block, or null if not cached
+  Status Get(const BlockKey& key, std::shared_ptr<Buffer>* out) {
+    SpilledBlock spilled;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      std::shared_ptr<Buffer>* block = memory_.Find(key);
+      if (block != nullptr) {
+        ++statistics_.hits;
+        *out = *block;
+        return Status::OK();
+      }
+      if (!disk_.Remove(key, &spilled)) {
+        ++statistics_.misses;
+        out->reset();
+        return Status::OK();
+      }
+      statistics_.disk_bytes -= spilled.size;
+    }
+
+    // Move the block back into memory. A spill file that cannot be read is
+    // a miss, the block is read again from the cached file
+    std::shared_ptr<ReadableFile> file;
+    std::shared_ptr<Buffer> block;
+    Status st = ReadableFile::Open(spilled.file_name, &file);
+    if (st.ok()) {
+      st = file->Read(spilled.size, &block);
+      ARROW_UNUSED(file->Close());
+    }
+    DeleteSpillFiles({spilled});
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      if (st.ok() && block->size() == spilled.size) {
+        ++statistics_.disk_hits;
+      } else {
+        ++statistics_.misses;
+        block.reset();
+      }
+    }
+    if (block) {
+      Put(key, block);
+    }
+    *out = block;
+    return Status::OK();
+  }
+
+  void Put(const BlockKey& key, const std::shared_ptr<Buffer>& block) {
+    std::vector<std::pair<BlockKey, std::shared_ptr<Buffer>>> evicted;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      std::shared_ptr<Buffer> replaced;
+      if (memory_.Put(key, block, &replaced)) {
+        statistics_.memory_bytes -= replaced->size();
+      }
+      statistics_.memory_bytes += block->size();
+      while (statistics_.memory_bytes > options_.capacity && memory_.size() > 0) {
+        evicted.push_back(memory_.PopOldest());
+        statistics_.memory_bytes -= evicted.back().second->size();
+      }
+    }
+    for (const auto& entry : evicted) {
+      Spill(entry.first, entry.second);
+    }
+  }
+
+ private:
+  // Write a block evicted from memory to disk, evicting older spilled blocks
+  // if needed. Blocks that fail to be written are dropped
+  void Spill(const BlockKey& key, const std::shared_ptr<Buffer>& block) {
+    if (options_.disk_directory.empty() || block->size() > options_.disk_capacity) {
+      return;
+    }
+    SpilledBlock spilled;
+    spilled.size = block->size();
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      spilled.file_name =
+          options_.disk_directory + "/block-" + std::to_string(next_file_id_++);
+    }
+
+    std::shared_ptr<FileOutputStream> file;
+    Status st = FileOutputStream::Open(spilled.file_name, &file);
+    if (st.ok()) {
+      st = file->Write(block->data(), block->size());
+      Status close_status = file->Close();
+      if (st.ok()) {
+        st = close_status;
+      }
+    }
+    if (!st.ok()) {
+      DeleteSpillFiles({spilled});
+      return;
+    }
+
+    std::vector<SpilledBlock> dropped;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      SpilledBlock replaced;
+      if (disk_.Put(key, spilled, &replaced)) {
+        statistics_.disk_bytes -= replaced.size;
+        dropped.push_back(replaced);
+      }
+      statistics_.disk_bytes += spilled.size;
+      while (statistics_.disk_bytes > options_.disk_capacity) {
+        dropped.push_back(disk_.PopOldest().second);
+        statistics_.disk_bytes -= dropped.back().size;
+      }
+    }
+    DeleteSpillFiles(dropped);
+  }
+
+  const BlockCacheOptions options_;
+
+  mutable std::mutex lock_;
+  LruMap<std::shared_ptr<Buffer>> memory_;
+  LruMap<SpilledBlock> disk_;
+  int64_t next_file_id_;
+  BlockCacheStatistics statistics_;
+};
+
+BlockCache::BlockCache() {}
+
+BlockCache::~BlockCache() {}
+
+Status BlockCache::Create(const BlockCacheOptions& options,
+                          std::shared_ptr<BlockCache>* out) {
+  std::shared_ptr<BlockCache> result(new BlockCache());
+  result->impl_.reset(new Impl(options));
+  RETURN_NOT_OK(result->impl_->Init());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+int64_t BlockCache::block_size() const { return impl_->block_size(); }
+
+BlockCacheStatistics BlockCache::statistics() const { return impl_->statistics(); }
+
+Status BlockCache::Clear() { return impl_->Clear(); }
+
+// ----------------------------------------------------------------------
+// CachedRandomAccessFile implementation
+
+class CachedRandomAccessFile::Impl {
+ public:
+  Impl(const std::shared_ptr<RandomAccessFile>& raw, const std::string& path,
+       const std::shared_ptr<BlockCache>& cache)
+      : raw_(raw),
+        path_(path),
+        cache_(cache),
+        block_size_(cache->block_size()),
+        size_(0),
+        position_(0),
+        is_open_(true) {}
+
+  Status Init() { return raw_->GetSize(&size_); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      is_open_ = false;
+      return raw_->Close();
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (position < 0) {
+      return Status::Invalid("Cannot seek to negative position");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    *size = size_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(ReadAtUnlocked(position_, nbytes, bytes_read, out));
+    position_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(ReadAtUnlocked(position_, nbytes, out));
+    position_ += (*out)->size();
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      RETURN_NOT_OK(CheckOpen());
+    }
+    return ReadAtUnlocked(position, nbytes, bytes_read, out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      RETURN_NOT_OK(CheckOpen());
+    }
+    return ReadAtUnlocked(position, nbytes, out);
+  }
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) { return raw_->WillNeed(ranges); }
+
+  std::shared_ptr<RandomAccessFile> raw() const { return raw_; }
+
+ private:
+  Status CheckOpen() const {
+    if (!is_open_) {
+      return Status::IOError("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status ClampRange(int64_t position, int64_t* nbytes) const {
+    if (position < 0 || *nbytes < 0) {
+      return Status::Invalid("Invalid read range");
+    }
+    *nbytes = std::min(*nbytes, size_ - std::min(position, size_));
+    return Status::OK();
+  }
+
+  // Fetch the blocks covering [position, position + nbytes), nbytes > 0
+  Status GetBlocks(int64_t position, int64_t nbytes,
+                   std::vector<std::shared_ptr<Buffer>>* blocks) {
+    const int64_t first = position / block_size_;
+    const int64_t last = (position + nbytes - 1) / block_size_;
+    blocks->resize(last - first + 1);
+
+    BlockKey key = {path_, size_, 0};
+    for (int64_t i = first; i <= last; ++i) {
+      key.offset = i * block_size_;
+      RETURN_NOT_OK(cache_->impl_->Get(key, &(*blocks)[i - first]));
+    }
+
+    // Read each run of missing blocks at once
+    int64_t i = first;
+    while (i <= last) {
+      if ((*blocks)[i - first]) {
+        ++i;
+        continue;
+      }
+      int64_t run_end = i;
+      while (run_end + 1 <= last && !(*blocks)[run_end + 1 - first]) {
+        ++run_end;
+      }
+      const int64_t offset = i * block_size_;
+      const int64_t length = std::min((run_end + 1) * block_size_, size_) - offset;
+      std::shared_ptr<Buffer> run;
+      RETURN_NOT_OK(raw_->ReadAt(offset, length, &run));
+      if (run->size() < length) {
+        return Status::IOError("Unexpected end of file " + path_);
+      }
+      for (int64_t j = i; j <= run_end; ++j) {
+        key.offset = j * block_size_;
+        const int64_t block_length = std::min(block_size_, size_ - key.offset);
+        std::shared_ptr<Buffer> block;
+        if (run_end == i) {
+          block = SliceBuffer(run, 0, block_length);
+        } else {
+          // Copy, so that each block is released once evicted
+          RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), block_length, &block));
+          memcpy(block->mutable_data(), run->data() + (key.offset - offset),
+                 static_cast<size_t>(block_length));
+        }
+        cache_->impl_->Put(key, block);
+        (*blocks)[j - first] = block;
+      }
+      i = run_end + 1;
+    }
+    return Status::OK();
+  }
+
+  // Copy [position, position + nbytes) out of the blocks starting at the
+  // block containing position
+  void CopyFromBlocks(int64_t position, int64_t nbytes,
+                      const std::vector<std::shared_ptr<Buffer>>& blocks, uint8_t* out) {
+    int64_t offset_in_block = position % block_size_;
+    for (const auto& block : blocks) {
+      const int64_t chunk = std::min(nbytes, block->size() - offset_in_block);
+      memcpy(out, block->data() + offset_in_block, static_cast<size_t>(chunk));
+      out += chunk;
+      nbytes -= chunk;
+      offset_in_block = 0;
+    }
+  }
+
+  Status ReadAtUnlocked(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                        void* out) {
+    RETURN_NOT_OK(ClampRange(position, &nbytes));
+    if (nbytes > 0) {
+      std::vector<std::shared_ptr<Buffer>> blocks;
+      RETURN_NOT_OK(GetBlocks(position, nbytes, &blocks));
+      CopyFromBlocks(position, nbytes, blocks, reinterpret_cast<uint8_t*>(out));
+    }
+    *bytes_read = nbytes;
+    return Status::OK();
+  }
+
+  Status ReadAtUnlocked(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(ClampRange(position, &nbytes));
+    if (nbytes == 0) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    RETURN_NOT_OK(GetBlocks(position, nbytes, &blocks));
+    if (blocks.size() == 1) {
+      *out = SliceBuffer(blocks[0], position % block_size_, nbytes);
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), nbytes, &buffer));
+    CopyFromBlocks(position, nbytes, blocks, buffer->mutable_data());
+    *out = buffer;
+    return Status::OK();
+  }
+
+  std::shared_ptr<RandomAccessFile> raw_;
+  const std::string path_;
+  std::shared_ptr<BlockCache> cache_;
+  const int64_t block_size_;
+  int64_t size_;
+
+  mutable std::mutex lock_;
+  int64_t position_;
+  bool is_open_;
+};
+
+CachedRandomAccessFile::CachedRandomAccessFile() {}
+
+CachedRandomAccessFile::~CachedRandomAccessFile() { DCHECK(impl_->Close().ok()); }
+
+Status CachedRandomAccessFile::Create(const std::shared_ptr<RandomAccessFile>& raw,
+                                      const std::string& path,
+                                      const std::shared_ptr<BlockCache>& cache,
+                                      std::shared_ptr<CachedRandomAccessFile>* out) {
+  std::shared_ptr<CachedRandomAccessFile> result(new CachedRandomAccessFile());
+  result->impl_.reset(new Impl(raw, path, cache));
+  RETURN_NOT_OK(result->impl_->Init());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+std::shared_ptr<RandomAccessFile> CachedRandomAccessFile::raw() const {
+  return impl_->raw();
+}
+
+Status CachedRandomAccessFile::Close() { return impl_->Close(); }
+
+Status CachedRandomAccessFile::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status CachedRandomAccessFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status CachedRandomAccessFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+bool CachedRandomAccessFile::supports_zero_copy() const { return false; }
+
+Status CachedRandomAccessFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status CachedRandomAccessFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status CachedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                      int64_t* bytes_read, void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status CachedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                      std::shared_ptr<Buffer>* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Status CachedRandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return impl_->WillNeed(ranges);
+}
+
+}  // namespace io
+}  // namespace arrow
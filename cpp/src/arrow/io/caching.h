@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Caching of the blocks of remote files
+
+#ifndef ARROW_IO_CACHING_H
+#define ARROW_IO_CACHING_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+struct ARROW_EXPORT BlockCacheOptions {
+  BlockCacheOptions() : block_size(1 << 20), capacity(1 << 28), disk_capacity(0) {}
+
+  /// Files are cached in aligned blocks of this size
+  int64_t block_size;
+
+  /// Maximum number of bytes of blocks kept in memory
+  int64_t capacity;
+
+  /// Directory, dedicated to the cache, where blocks evicted from memory
+  /// are spilled, such as one on a local SSD. No spilling if empty
+  std::string disk_directory;
+
+  /// Maximum number of bytes of blocks spilled to disk
+  int64_t disk_capacity;
+};
+
+/// \brief Counters of a BlockCache
+struct BlockCacheStatistics {
+  /// Blocks served from memory
+  int64_t hits;
+  /// Blocks served from disk, then moved back into memory
+  int64_t disk_hits;
+  /// Blocks read from the cached files
+  int64_t misses;
+  int64_t memory_bytes;
+  int64_t disk_bytes;
+};
+
+/// \class BlockCache
+/// \brief A size-bounded LRU cache of file blocks, shared by the files read
+/// through it with CachedRandomAccessFile
+///
+/// Blocks are keyed by file path, size and offset, so files must not change
+/// while cached, except by being replaced with a file of another size.
+/// Thread-safe
+class ARROW_EXPORT BlockCache {
+ public:
+  ~BlockCache();
+
+  /// \brief Create a cache, and its spill directory if missing
+  static Status Create(const BlockCacheOptions& options,
+                       std::shared_ptr<BlockCache>* out);
+
+  int64_t block_size() const;
+
+  BlockCacheStatistics statistics() const;
+
+  /// \brief Drop every block
+  Status Clear();
+
+ private:
+  BlockCache();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+
+  friend class CachedRandomAccessFile;
+};
+
+/// \class CachedRandomAccessFile
+/// \brief Read a file through a BlockCache
+///
+/// Reads are served from cached blocks, reading missing blocks from the
+/// wrapped file, consecutive ones with a single read. Reads within a block
+/// return a slice of it without copying. Tell, Seek and GetSize are served
+/// locally, the size being read once on creation
+class ARROW_EXPORT CachedRandomAccessFile : public RandomAccessFile {
+ public:
+  ~CachedRandomAccessFile() override;
+
+  /// \brief Create a file reading the given one through a cache
+  ///
+  /// \param[in] raw the file to read from
+  /// \param[in] path the path identifying the file in the cache
+  /// \param[in] cache the cache to use
+  /// \param[out] out the created file
+  /// \return Status
+  static Status Create(const std::shared_ptr<RandomAccessFile>& raw,
+                       const std::string& path, const std::shared_ptr<BlockCache>& cache,
+                       std::shared_ptr<CachedRandomAccessFile>* out);
+
+  /// The wrapped file
+  std::shared_ptr<RandomAccessFile> raw() const;
+
+  // Implement the RandomAccessFile interface
+
+  /// Close the wrapped file. Its blocks stay cached
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+  bool supports_zero_copy() const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// Passed on to the wrapped file
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+ private:
+  CachedRandomAccessFile();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_CACHING_H
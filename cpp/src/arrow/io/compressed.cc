@@ -0,0 +1,379 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/compressed.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace io {
+
+// The size of the compressed chunks written to or read from the wrapped stream
+static constexpr int64_t kChunkSize = 64 * 1024;
+
+// ----------------------------------------------------------------------
+// CompressedOutputStream implementation
+
+class CompressedOutputStream::Impl {
+ public:
+  Impl(const std::shared_ptr<OutputStream>& raw, MemoryPool* pool)
+      : raw_(raw), pool_(pool), is_open_(false), compressed_pos_(0), total_pos_(0) {}
+
+  Status Init(Codec* codec) {
+    RETURN_NOT_OK(codec->MakeCompressor(&compressor_));
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, kChunkSize, &compressed_));
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      is_open_ = false;
+      Status st = FinishUnlocked();
+      RETURN_NOT_OK(raw_->Close());
+      return st;
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = total_pos_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (nbytes < 0) {
+      return Status::Invalid("Write length must be non-negative");
+    }
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      int64_t bytes_read = 0, bytes_written = 0;
+      RETURN_NOT_OK(compressor_->Compress(
+          nbytes, input, compressed_->size() - compressed_pos_,
+          compressed_->mutable_data() + compressed_pos_, &bytes_read, &bytes_written));
+      input += bytes_read;
+      nbytes -= bytes_read;
+      total_pos_ += bytes_read;
+      compressed_pos_ += bytes_written;
+      if (bytes_read == 0) {
+        // The compressor needs more output space
+        RETURN_NOT_OK(MakeRoomUnlocked());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    bool should_retry = true;
+    while (should_retry) {
+      int64_t bytes_written = 0;
+      RETURN_NOT_OK(compressor_->Flush(compressed_->size() - compressed_pos_,
+                                       compressed_->mutable_data() + compressed_pos_,
+                                       &bytes_written, &should_retry));
+      compressed_pos_ += bytes_written;
+      if (should_retry) {
+        RETURN_NOT_OK(MakeRoomUnlocked());
+      }
+    }
+    RETURN_NOT_OK(FlushCompressedUnlocked());
+    return raw_->Flush();
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+ private:
+  Status CheckOpen() const {
+    if (ARROW_PREDICT_FALSE(!is_open_)) {
+      return Status::IOError("OutputStream is closed");
+    }
+    return Status::OK();
+  }
+
+  // Write out the compressed bytes, or grow the buffer if it is empty and
+  // still too small for the compressor to make progress
+  Status MakeRoomUnlocked() {
+    if (compressed_pos_ > 0) {
+      return FlushCompressedUnlocked();
+    }
+    return compressed_->Resize(compressed_->size() * 2);
+  }
+
+  Status FlushCompressedUnlocked() {
+    if (compressed_pos_ > 0) {
+      RETURN_NOT_OK(raw_->Write(compressed_->data(), compressed_pos_));
+      compressed_pos_ = 0;
+    }
+    return Status::OK();
+  }
+
+  // Write out the end of the compressed stream
+  Status FinishUnlocked() {
+    bool should_retry = true;
+    while (should_retry) {
+      int64_t bytes_written = 0;
+      RETURN_NOT_OK(compressor_->End(compressed_->size() - compressed_pos_,
+                                     compressed_->mutable_data() + compressed_pos_,
+                                     &bytes_written, &should_retry));
+      compressed_pos_ += bytes_written;
+      if (should_retry) {
+        RETURN_NOT_OK(MakeRoomUnlocked());
+      }
+    }
+    return FlushCompressedUnlocked();
+  }
+
+  std::shared_ptr<OutputStream> raw_;
+  MemoryPool* pool_;
+  mutable std::mutex lock_;
+  bool is_open_;
+
+  std::shared_ptr<Compressor> compressor_;
+  std::shared_ptr<ResizableBuffer> compressed_;
+  int64_t compressed_pos_;
+
+  // The number of uncompressed bytes written
+  int64_t total_pos_;
+};
+
+CompressedOutputStream::CompressedOutputStream() {}
+
+CompressedOutputStream::~CompressedOutputStream() { DCHECK(impl_->Close().ok()); }
+
+Status CompressedOutputStream::Create(Codec* codec,
+                                      const std::shared_ptr<OutputStream>& raw,
+                                      MemoryPool* pool,
+                                      std::shared_ptr<CompressedOutputStream>* out) {
+  std::shared_ptr<CompressedOutputStream> result(new CompressedOutputStream());
+  result->impl_.reset(new Impl(raw, pool));
+  RETURN_NOT_OK(result->impl_->Init(codec));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+std::shared_ptr<OutputStream> CompressedOutputStream::raw() const {
+  return impl_->raw();
+}
+
+Status CompressedOutputStream::Close() { return impl_->Close(); }
+
+Status CompressedOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status CompressedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status CompressedOutputStream::Flush() { return impl_->Flush(); }
+
+// ----------------------------------------------------------------------
+// CompressedInputStream implementation
+
+class CompressedInputStream::Impl {
+ public:
+  Impl(Codec* codec, const std::shared_ptr<InputStream>& raw, MemoryPool* pool)
+      : codec_(codec),
+        raw_(raw),
+        pool_(pool),
+        is_open_(false),
+        compressed_pos_(0),
+        compressed_len_(0),
+        raw_eof_(false),
+        stream_started_(false),
+        total_pos_(0) {}
+
+  Status Init() {
+    RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor_));
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, kChunkSize, &compressed_));
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (is_open_) {
+      is_open_ = false;
+      return raw_->Close();
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = total_pos_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (nbytes < 0) {
+      return Status::Invalid("Read length must be non-negative");
+    }
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t total_written = 0;
+    while (total_written < nbytes) {
+      if (decompressor_->IsFinished()) {
+        if (compressed_pos_ == compressed_len_) {
+          RETURN_NOT_OK(ReadCompressedUnlocked());
+        }
+        if (compressed_pos_ == compressed_len_) {
+          // End of the wrapped stream
+          break;
+        }
+        // More data follows the end of a compressed stream: start another
+        RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor_));
+        stream_started_ = false;
+      }
+      if (compressed_pos_ == compressed_len_) {
+        RETURN_NOT_OK(ReadCompressedUnlocked());
+      }
+
+      // Even without input, the decompressor may hold back some output
+      int64_t decompressed_read = 0, decompressed_written = 0;
+      bool need_more_output = false;
+      RETURN_NOT_OK(decompressor_->Decompress(
+          compressed_len_ - compressed_pos_, compressed_->data() + compressed_pos_,
+          nbytes - total_written, out_data + total_written, &decompressed_read,
+          &decompressed_written, &need_more_output));
+      stream_started_ = stream_started_ || decompressed_read > 0;
+      compressed_pos_ += decompressed_read;
+      total_written += decompressed_written;
+
+      if (decompressed_read == 0 && decompressed_written == 0 &&
+          !decompressor_->IsFinished()) {
+        if (compressed_pos_ < compressed_len_ || need_more_output) {
+          return Status::IOError("Decompressor made no progress");
+        }
+        if (raw_eof_) {
+          if (stream_started_) {
+            return Status::IOError("Truncated compressed stream");
+          }
+          // The wrapped stream was empty
+          break;
+        }
+      }
+    }
+    total_pos_ += total_written;
+    *bytes_read = total_written;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+  MemoryPool* pool() const { return pool_; }
+
+ private:
+  Status CheckOpen() const {
+    if (ARROW_PREDICT_FALSE(!is_open_)) {
+      return Status::IOError("InputStream is closed");
+    }
+    return Status::OK();
+  }
+
+  // Read the next chunk of compressed data, if the wrapped stream has not
+  // ended yet
+  Status ReadCompressedUnlocked() {
+    compressed_pos_ = 0;
+    compressed_len_ = 0;
+    if (!raw_eof_) {
+      RETURN_NOT_OK(
+          raw_->Read(compressed_->size(), &compressed_len_, compressed_->mutable_data()));
+      raw_eof_ = compressed_len_ == 0;
+    }
+    return Status::OK();
+  }
+
+  Codec* codec_;
+  std::shared_ptr<InputStream> raw_;
+  MemoryPool* pool_;
+  mutable std::mutex lock_;
+  bool is_open_;
+
+  std::shared_ptr<Decompressor> decompressor_;
+  std::shared_ptr<ResizableBuffer> compressed_;
+  int64_t compressed_pos_;
+  int64_t compressed_len_;
+  bool raw_eof_;
+
+  // Whether the current decompressor was given any input
+  bool stream_started_;
+
+  // The number of uncompressed bytes read
+  int64_t total_pos_;
+};
+
+CompressedInputStream::CompressedInputStream() {}
+
+CompressedInputStream::~CompressedInputStream() { DCHECK(impl_->Close().ok()); }
+
+Status CompressedInputStream::Create(Codec* codec,
+                                     const std::shared_ptr<InputStream>& raw,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<CompressedInputStream>* out) {
+  std::shared_ptr<CompressedInputStream> result(new CompressedInputStream());
+  result->impl_.reset(new Impl(codec, raw, pool));
+  RETURN_NOT_OK(result->impl_->Init());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+std::shared_ptr<InputStream> CompressedInputStream::raw() const { return impl_->raw(); }
+
+Status CompressedInputStream::Close() { return impl_->Close(); }
+
+Status CompressedInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status CompressedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status CompressedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(impl_->pool(), nbytes, &buffer));
+
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+  if (bytes_read < nbytes) {
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+  }
+  *out = buffer;
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compressed input and output streams over any stream
+
+#ifndef ARROW_IO_COMPRESSED_H
+#define ARROW_IO_COMPRESSED_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Codec;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \class CompressedOutputStream
+/// \brief Compress the data written to a stream
+///
+/// Writes are compressed in pieces into a fixed-size buffer, which is written
+/// to the wrapped stream when full, so memory use does not grow with the
+/// length of the stream. Tell returns the number of uncompressed bytes written
+class ARROW_EXPORT CompressedOutputStream : public OutputStream {
+ public:
+  ~CompressedOutputStream() override;
+
+  /// \brief Create a compressed output stream wrapping the given stream
+  ///
+  /// \param[in] codec the codec to compress with, which must support streaming
+  /// compression
+  /// \param[in] raw the stream to write the compressed data to
+  /// \param[in] pool MemoryPool to allocate the buffer from
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(Codec* codec, const std::shared_ptr<OutputStream>& raw,
+                       MemoryPool* pool, std::shared_ptr<CompressedOutputStream>* out);
+
+  /// The wrapped stream
+  std::shared_ptr<OutputStream> raw() const;
+
+  // Implement the OutputStream interface
+
+  /// Finish the compressed stream and close the wrapped stream
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Write(const void* data, int64_t nbytes) override;
+
+  /// Write out the compressed data for all the bytes written so far and
+  /// flush the wrapped stream
+  Status Flush() override;
+
+ private:
+  CompressedOutputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class CompressedInputStream
+/// \brief Decompress the data read from a stream
+///
+/// The wrapped stream is read in pieces of fixed size, which are decompressed
+/// straight into the caller's memory. Concatenated compressed streams are
+/// read as one stream. Tell returns the number of uncompressed bytes read
+class ARROW_EXPORT CompressedInputStream : public InputStream {
+ public:
+  ~CompressedInputStream() override;
+
+  /// \brief Create a compressed input stream wrapping the given stream
+  ///
+  /// \param[in] codec the codec to decompress with, which must support
+  /// streaming decompression and outlive the stream
+  /// \param[in] raw the stream to read the compressed data from
+  /// \param[in] pool MemoryPool to allocate buffers from
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(Codec* codec, const std::shared_ptr<InputStream>& raw,
+                       MemoryPool* pool, std::shared_ptr<CompressedInputStream>* out);
+
+  /// The wrapped stream
+  std::shared_ptr<InputStream> raw() const;
+
+  // Implement the InputStream interface
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+ private:
+  CompressedInputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_COMPRESSED_H
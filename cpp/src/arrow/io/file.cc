@@ -61,11 +61,17 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <mutex>
 #include <sstream>  // IWYU pragma: keep
+#include <string>
+#include <utility>
+#include <vector>
 
 #if defined(_MSC_VER)
 #include <codecvt>
@@ -87,6 +93,17 @@
 
 #endif  // _MSC_VER
 
+#ifndef _WIN32
+#include <dirent.h>
+#include <limits.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef ARROW_WITH_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
 // defines that don't exist in MinGW
 #if defined(__MINGW32__)
 #define ARROW_WRITE_SHMODE S_IRUSR | S_IWUSR
@@ -120,7 +137,9 @@
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 #if defined(_MSC_VER)
 #include <boost/filesystem.hpp>           // NOLINT
@@ -172,15 +191,28 @@ static inline int64_t lseek64_compat(int fd, int64_t pos, int whence) {
 #endif
 }
 
-static inline Status FileOpenReadable(const PlatformFilename& file_name, int* fd) {
+// direct_io opens the file with O_DIRECT, where the platform has it
+static inline Status FileOpenReadable(const PlatformFilename& file_name, bool direct_io,
+                                      int* fd) {
   int ret;
   errno_t errno_actual = 0;
 #if defined(_MSC_VER)
+  if (direct_io) {
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+  }
   errno_actual = _wsopen_s(fd, file_name.wstring().c_str(), _O_RDONLY | _O_BINARY,
                            _SH_DENYNO, _S_IREAD);
   ret = *fd;
 #else
-  ret = *fd = open(file_name.c_str(), O_RDONLY | O_BINARY);
+  int oflag = O_RDONLY | O_BINARY;
+  if (direct_io) {
+#ifdef O_DIRECT
+    oflag |= O_DIRECT;
+#else
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+  }
+  ret = *fd = open(file_name.c_str(), oflag);
   errno_actual = errno;
 #endif
 
@@ -287,6 +319,57 @@ static inline Status FileRead(const int fd, uint8_t* buffer, const int64_t nbyte
   return Status::OK();
 }
 
+// Read at an absolute position without using the file offset, so that
+// several threads can read the file at once
+static inline Status FilePread(const int fd, uint8_t* buffer, const int64_t position,
+                               const int64_t nbytes, int64_t* bytes_read) {
+#ifdef _WIN32
+  HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+  if (handle == INVALID_HANDLE_VALUE) {
+    return Status::IOError("Invalid file handle");
+  }
+#endif
+  *bytes_read = 0;
+  while (*bytes_read < nbytes) {
+    int64_t chunksize =
+        std::min(static_cast<int64_t>(ARROW_MAX_IO_CHUNKSIZE), nbytes - *bytes_read);
+#ifdef _WIN32
+    // The offset of an OVERLAPPED read on a synchronous handle is where it
+    // starts; the call still blocks until the bytes are read
+    const int64_t offset = position + *bytes_read;
+    OVERLAPPED overlapped = {0};
+    overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD nread = 0;
+    if (!ReadFile(handle, buffer + *bytes_read, static_cast<DWORD>(chunksize), &nread,
+                  &overlapped)) {
+      const DWORD error = GetLastError();
+      if (error == ERROR_HANDLE_EOF) {
+        break;
+      }
+      std::stringstream ss;
+      ss << "Error reading bytes from file: Windows error " << error;
+      return Status::IOError(ss.str());
+    }
+    const int64_t ret = static_cast<int64_t>(nread);
+#else
+    int64_t ret = static_cast<int64_t>(pread(fd, buffer + *bytes_read,
+                                             static_cast<size_t>(chunksize),
+                                             static_cast<off_t>(position + *bytes_read)));
+    if (ret == -1) {
+      return Status::IOError(std::string("Error reading bytes from file: ") +
+                             std::string(strerror(errno)));
+    }
+#endif
+    *bytes_read += ret;
+    if (ret < chunksize) {
+      // EOF
+      break;
+    }
+  }
+  return Status::OK();
+}
+
 static inline Status FileWrite(const int fd, const uint8_t* buffer,
                                const int64_t nbytes) {
   int ret = 0;
@@ -315,6 +398,79 @@ static inline Status FileWrite(const int fd, const uint8_t* buffer,
   return Status::OK();
 }
 
+#ifndef _WIN32
+
+#ifdef IOV_MAX
+static constexpr int kMaxWritevSlices = IOV_MAX;
+#else
+static constexpr int kMaxWritevSlices = 1024;
+#endif
+
+// Write all of the iovecs, retrying partial writes
+static inline Status FileWriteIovecs(const int fd, std::vector<struct iovec>* iov) {
+  size_t next = 0;
+  while (next < iov->size()) {
+    const int count = static_cast<int>(
+        std::min(iov->size() - next, static_cast<size_t>(kMaxWritevSlices)));
+    ssize_t ret = writev(fd, iov->data() + next, count);
+    if (ret == -1) {
+      return Status::IOError(std::string("Error writing bytes from file: ") +
+                             std::string(strerror(errno)));
+    }
+    // Skip the slices written in full and trim a partially written one
+    size_t written = static_cast<size_t>(ret);
+    while (next < iov->size() && written >= (*iov)[next].iov_len) {
+      written -= (*iov)[next].iov_len;
+      ++next;
+    }
+    if (written > 0) {
+      struct iovec& partial = (*iov)[next];
+      partial.iov_base = static_cast<uint8_t*>(partial.iov_base) + written;
+      partial.iov_len -= written;
+    }
+  }
+  iov->clear();
+  return Status::OK();
+}
+
+#endif
+
+// Write the slices with as few calls as possible. Each call stays within
+// ARROW_MAX_IO_CHUNKSIZE bytes, as FileWrite does
+static inline Status FileWritev(const int fd, const std::vector<WriteSlice>& slices) {
+#ifdef _WIN32
+  for (const auto& slice : slices) {
+    RETURN_NOT_OK(
+        FileWrite(fd, reinterpret_cast<const uint8_t*>(slice.data), slice.nbytes));
+  }
+  return Status::OK();
+#else
+  std::vector<struct iovec> iov;
+  int64_t pending_bytes = 0;
+  for (const auto& slice : slices) {
+    if (slice.nbytes < 0) {
+      return Status::IOError("Length must be non-negative");
+    }
+    if (slice.nbytes == 0) {
+      continue;
+    }
+    if (pending_bytes + slice.nbytes > ARROW_MAX_IO_CHUNKSIZE ||
+        static_cast<int>(iov.size()) == kMaxWritevSlices) {
+      RETURN_NOT_OK(FileWriteIovecs(fd, &iov));
+      pending_bytes = 0;
+    }
+    if (slice.nbytes > ARROW_MAX_IO_CHUNKSIZE) {
+      RETURN_NOT_OK(
+          FileWrite(fd, reinterpret_cast<const uint8_t*>(slice.data), slice.nbytes));
+      continue;
+    }
+    iov.push_back({const_cast<void*>(slice.data), static_cast<size_t>(slice.nbytes)});
+    pending_bytes += slice.nbytes;
+  }
+  return FileWriteIovecs(fd, &iov);
+#endif
+}
+
 static inline Status FileGetSize(int fd, int64_t* size) {
   int64_t ret;
 
@@ -354,6 +510,55 @@ static inline Status FileClose(int fd) {
   return Status::OK();
 }
 
+// The page cache hints are ignored where the platform has no posix_fadvise
+static inline Status CheckReadRanges(const std::vector<ReadRange>& ranges) {
+  for (const ReadRange& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read range");
+    }
+  }
+  return Status::OK();
+}
+
+#ifdef POSIX_FADV_WILLNEED
+static inline Status FileAdvise(int fd, int64_t offset, int64_t length, int advice) {
+  const int ret = posix_fadvise(fd, offset, length, advice);
+  if (ret != 0) {
+    std::stringstream ss;
+    ss << "posix_fadvise failed: " << std::strerror(ret);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+}
+#endif
+
+static inline Status FileWillNeed(int fd, const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(CheckReadRanges(ranges));
+#ifdef POSIX_FADV_WILLNEED
+  for (const ReadRange& range : ranges) {
+    if (range.length > 0) {
+      RETURN_NOT_OK(FileAdvise(fd, range.offset, range.length, POSIX_FADV_WILLNEED));
+    }
+  }
+#endif
+  return Status::OK();
+}
+
+static inline Status FileAdviseAccessPattern(int fd, AccessPattern::type pattern) {
+#ifdef POSIX_FADV_WILLNEED
+  int advice = POSIX_FADV_NORMAL;
+  if (pattern == AccessPattern::SEQUENTIAL) {
+    advice = POSIX_FADV_SEQUENTIAL;
+  } else if (pattern == AccessPattern::RANDOM) {
+    advice = POSIX_FADV_RANDOM;
+  }
+  // A length of 0 covers the whole file
+  return FileAdvise(fd, 0, 0, advice);
+#else
+  return Status::OK();
+#endif
+}
+
 class OSFile {
  public:
   OSFile() : fd_(-1), is_open_(false), size_(-1) {}
@@ -375,10 +580,10 @@ class OSFile {
     return Status::OK();
   }
 
-  Status OpenReadable(const std::string& path) {
+  Status OpenReadable(const std::string& path, bool direct_io = false) {
     RETURN_NOT_OK(SetFileName(path));
 
-    RETURN_NOT_OK(FileOpenReadable(file_name_, &fd_));
+    RETURN_NOT_OK(FileOpenReadable(file_name_, direct_io, &fd_));
     RETURN_NOT_OK(FileGetSize(fd_, &size_));
 
     is_open_ = true;
@@ -399,9 +604,15 @@ class OSFile {
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
-    std::lock_guard<std::mutex> guard(lock_);
-    RETURN_NOT_OK(Seek(position));
-    return Read(nbytes, bytes_read, out);
+    // No lock is taken, so that concurrent ReadAt calls overlap. The file
+    // position is then left after the bytes read, as Read would leave it; the
+    // seek is a single system call, so racing calls leave it after one of them
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    RETURN_NOT_OK(
+        FilePread(fd_, reinterpret_cast<uint8_t*>(out), position, nbytes, bytes_read));
+    return FileSeek(fd_, position + *bytes_read);
   }
 
   Status Seek(int64_t pos) {
@@ -421,6 +632,11 @@ class OSFile {
     return FileWrite(fd_, reinterpret_cast<const uint8_t*>(data), length);
   }
 
+  Status Writev(const std::vector<WriteSlice>& slices) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return FileWritev(fd_, slices);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -468,6 +684,19 @@ class ReadableFile::ReadableFileImpl : public OSFile {
 
   Status Open(const std::string& path) { return OpenReadable(path); }
 
+  Status ReadBufferAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(ReadAt(position, nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
   Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
@@ -505,23 +734,25 @@ Status ReadableFile::Close() { return impl_->Close(); }
 Status ReadableFile::Tell(int64_t* pos) const { return impl_->Tell(pos); }
 
 Status ReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  ARROW_TRACE_SPAN("io", "ReadableFile::Read");
   std::lock_guard<std::mutex> guard(impl_->lock());
   return impl_->Read(nbytes, bytes_read, out);
 }
 
 Status ReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                             void* out) {
+  ARROW_TRACE_SPAN("io", "ReadableFile::ReadAt");
   return impl_->ReadAt(position, nbytes, bytes_read, out);
 }
 
 Status ReadableFile::ReadAt(int64_t position, int64_t nbytes,
                             std::shared_ptr<Buffer>* out) {
-  std::lock_guard<std::mutex> guard(impl_->lock());
-  RETURN_NOT_OK(Seek(position));
-  return impl_->ReadBuffer(nbytes, out);
+  ARROW_TRACE_SPAN("io", "ReadableFile::ReadAt");
+  return impl_->ReadBufferAt(position, nbytes, out);
 }
 
 Status ReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  ARROW_TRACE_SPAN("io", "ReadableFile::Read");
   std::lock_guard<std::mutex> guard(impl_->lock());
   return impl_->ReadBuffer(nbytes, out);
 }
@@ -535,6 +766,14 @@ Status ReadableFile::Seek(int64_t pos) { return impl_->Seek(pos); }
 
 bool ReadableFile::supports_zero_copy() const { return false; }
 
+Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return FileWillNeed(impl_->fd(), ranges);
+}
+
+Status ReadableFile::AdviseAccessPattern(AccessPattern::type pattern) {
+  return FileAdviseAccessPattern(impl_->fd(), pattern);
+}
+
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -582,21 +821,670 @@ Status FileOutputStream::Close() { return impl_->Close(); }
 Status FileOutputStream::Tell(int64_t* pos) const { return impl_->Tell(pos); }
 
 Status FileOutputStream::Write(const void* data, int64_t length) {
+  ARROW_TRACE_SPAN("io", "FileOutputStream::Write");
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::Writev(const std::vector<WriteSlice>& slices) {
+  ARROW_TRACE_SPAN("io", "FileOutputStream::Writev");
+  return impl_->Writev(slices);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
+// ----------------------------------------------------------------------
+// io_uring file backend
+
+// A read or write of a contiguous range of the file, advanced as it
+// completes
+struct UringRequest {
+  int64_t offset;
+  uint8_t* data;
+  // The bytes left to transfer
+  int64_t length;
+  // The bytes transferred
+  int64_t done;
+  // Whether data is in the registered buffer
+  bool fixed;
+};
+
+// The alignment of MemoryPool allocations
+static constexpr int64_t kPoolAlignment = 64;
+
+#ifdef ARROW_WITH_IO_URING
+
+// The length of a single operation is 32-bit, longer requests are resubmitted
+// for their remainder
+static constexpr int64_t kMaxUringIOSize = 1 << 30;
+
+static inline Status UringError(const char* opname, int errno_actual) {
+  std::stringstream ss;
+  ss << opname << " failed: " << std::strerror(errno_actual);
+  return Status::IOError(ss.str());
+}
+
+// The submission and completion rings shared with the kernel, through the raw
+// system calls so as not to depend on liburing. A ring has a single
+// submitter, the callers serialize Run
+class Uring {
+ public:
+  Uring()
+      : ring_fd_(-1),
+        sq_ring_(nullptr),
+        cq_ring_(nullptr),
+        sqes_(nullptr),
+        has_registered_buffer_(false) {}
+
+  ~Uring() { DCHECK_OK(Close()); }
+
+  Status Init(int32_t entries) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ring_fd_ < 0) {
+      if (errno == ENOSYS || errno == EPERM) {
+        // The kernel is too old, or a sandbox forbids the ring
+        return Status::NotImplemented(std::string("io_uring is not available: ") +
+                                      std::strerror(errno));
+      }
+      return UringError("io_uring_setup", errno);
+    }
+    sq_entries_ = params.sq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    RETURN_NOT_OK(Map(sq_ring_size_, IORING_OFF_SQ_RING, &sq_ring_));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      RETURN_NOT_OK(Map(cq_ring_size_, IORING_OFF_CQ_RING, &cq_ring_));
+    }
+    void* sqes;
+    RETURN_NOT_OK(Map(params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES, &sqes));
+    sqes_ = reinterpret_cast<io_uring_sqe*>(sqes);
+
+    uint8_t* sq = reinterpret_cast<uint8_t*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    uint8_t* cq = reinterpret_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sq_entries_ * sizeof(io_uring_sqe));
+      sqes_ = nullptr;
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    cq_ring_ = nullptr;
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+      sq_ring_ = nullptr;
+    }
+    if (ring_fd_ >= 0) {
+      RETURN_NOT_OK(FileClose(ring_fd_));
+      ring_fd_ = -1;
+    }
+    return Status::OK();
+  }
+
+  // Register the memory of the fixed requests, replacing the previous one.
+  // No request may be in flight
+  Status RegisterBuffer(uint8_t* data, int64_t size) {
+    if (has_registered_buffer_) {
+      if (syscall(__NR_io_uring_register, ring_fd_, IORING_UNREGISTER_BUFFERS, nullptr,
+                  0) < 0) {
+        return UringError("io_uring_register", errno);
+      }
+      has_registered_buffer_ = false;
+    }
+    struct iovec iov;
+    iov.iov_base = data;
+    iov.iov_len = static_cast<size_t>(size);
+    if (syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_BUFFERS, &iov, 1) < 0) {
+      return UringError("io_uring_register", errno);
+    }
+    has_registered_buffer_ = true;
+    return Status::OK();
+  }
+
+  // Run the requests to completion, keeping as many in flight as the ring
+  // holds. A short transfer is resubmitted for its remainder unless
+  // stop_on_short, a read of 0 bytes being the end of the file. All the
+  // requests have completed when this returns, even on error
+  Status Run(int fd, bool write, bool stop_on_short,
+             std::vector<UringRequest>* requests) {
+    std::deque<size_t> ready;
+    for (size_t i = 0; i < requests->size(); ++i) {
+      if ((*requests)[i].length > 0) {
+        ready.push_back(i);
+      }
+    }
+
+    Status st;
+    unsigned in_flight = 0;
+    while (in_flight > 0 || (st.ok() && !ready.empty())) {
+      unsigned to_submit = 0;
+      while (st.ok() && !ready.empty() && in_flight < sq_entries_) {
+        const size_t i = ready.front();
+        ready.pop_front();
+        Prepare(fd, write, i, (*requests)[i]);
+        ++to_submit;
+        ++in_flight;
+      }
+      Status enter_st = Enter(to_submit);
+      if (!enter_st.ok()) {
+        // The ring is unusable; what was submitted may still complete into
+        // the request memory, which the caller may not release
+        DCHECK_OK(enter_st);
+        return enter_st;
+      }
+
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      unsigned head = *cq_head_;
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        const size_t i = static_cast<size_t>(cqe.user_data);
+        UringRequest& request = (*requests)[i];
+        --in_flight;
+        if (cqe.res == -EINTR || cqe.res == -EAGAIN) {
+          ready.push_back(i);
+        } else if (cqe.res < 0) {
+          if (st.ok()) {
+            st = UringError(write ? "io_uring write" : "io_uring read", -cqe.res);
+          }
+        } else if (cqe.res == 0) {
+          if (write && st.ok()) {
+            st = Status::IOError("io_uring write made no progress");
+          }
+        } else {
+          request.offset += cqe.res;
+          request.data += cqe.res;
+          request.length -= cqe.res;
+          request.done += cqe.res;
+          if (request.length > 0 && !stop_on_short) {
+            ready.push_back(i);
+          }
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+    }
+    return st;
+  }
+
+ private:
+  Status Map(size_t size, off_t offset, void** out) {
+    void* result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring_fd_, offset);
+    if (result == MAP_FAILED) {
+      return UringError("io_uring mmap", errno);
+    }
+    *out = result;
+    return Status::OK();
+  }
+
+  void Prepare(int fd, bool write, size_t index, const UringRequest& request) {
+    const unsigned tail = *sq_tail_;
+    const unsigned slot = tail & sq_mask_;
+    io_uring_sqe* sqe = &sqes_[slot];
+    std::memset(sqe, 0, sizeof(*sqe));
+    if (request.fixed) {
+      sqe->opcode = write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+      sqe->buf_index = 0;
+    } else {
+      sqe->opcode = write ? IORING_OP_WRITE : IORING_OP_READ;
+    }
+    sqe->fd = fd;
+    sqe->off = static_cast<uint64_t>(request.offset);
+    sqe->addr = reinterpret_cast<uint64_t>(request.data);
+    sqe->len = static_cast<uint32_t>(std::min(request.length, kMaxUringIOSize));
+    sqe->user_data = static_cast<uint64_t>(index);
+    sq_array_[slot] = slot;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+  }
+
+  // Submit the prepared entries and wait for at least one completion
+  Status Enter(unsigned to_submit) {
+    while (true) {
+      const int ret = static_cast<int>(syscall(__NR_io_uring_enter, ring_fd_, to_submit,
+                                               1, IORING_ENTER_GETEVENTS, nullptr, 0));
+      if (ret >= 0) {
+        to_submit -= std::min(to_submit, static_cast<unsigned>(ret));
+        if (to_submit == 0) {
+          return Status::OK();
+        }
+      } else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        return UringError("io_uring_enter", errno);
+      }
+    }
+  }
+
+  int ring_fd_;
+  unsigned sq_entries_;
+  size_t sq_ring_size_;
+  size_t cq_ring_size_;
+  void* sq_ring_;
+  void* cq_ring_;
+  io_uring_sqe* sqes_;
+  unsigned* sq_tail_;
+  unsigned sq_mask_;
+  unsigned* sq_array_;
+  unsigned* cq_head_;
+  unsigned* cq_tail_;
+  unsigned cq_mask_;
+  io_uring_cqe* cqes_;
+  bool has_registered_buffer_;
+};
+
+#else
+
+class Uring {
+ public:
+  Status Init(int32_t entries) {
+    return Status::NotImplemented("Arrow was not built with io_uring (ARROW_IO_URING)");
+  }
+  Status Close() { return Status::OK(); }
+  Status RegisterBuffer(uint8_t* data, int64_t size) {
+    return Status::NotImplemented("io_uring");
+  }
+  Status Run(int fd, bool write, bool stop_on_short,
+             std::vector<UringRequest>* requests) {
+    return Status::NotImplemented("io_uring");
+  }
+};
+
+#endif  // ARROW_WITH_IO_URING
+
+static inline Status ValidateUringOptions(const UringOptions& options) {
+  if (options.queue_depth <= 0) {
+    return Status::Invalid("io_uring queue depth must be positive");
+  }
+  if (options.registered_buffer_size < 0) {
+    return Status::Invalid("Registered buffer size must be non-negative");
+  }
+  return Status::OK();
+}
+
+class UringReadableFile::UringReadableFileImpl : public OSFile {
+ public:
+  UringReadableFileImpl(const UringOptions& options, MemoryPool* pool)
+      : OSFile(),
+        options_(options),
+        pool_(pool),
+        alignment_(options.direct_io ? kDirectIOAlignment : kPoolAlignment),
+        position_(0),
+        arena_offset_(0),
+        arena_used_(0) {}
+
+  Status Open(const std::string& path) {
+    RETURN_NOT_OK(ValidateUringOptions(options_));
+    RETURN_NOT_OK(ring_.Init(options_.queue_depth));
+    return OpenReadable(path, options_.direct_io);
+  }
+
+  Status Close() {
+    RETURN_NOT_OK(OSFile::Close());
+    return ring_.Close();
+  }
+
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    std::vector<std::shared_ptr<Buffer>>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return ReadRangesUnlocked(ranges, out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return ReadAtUnlocked(position, nbytes, bytes_read, out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return ReadAtUnlocked(position, nbytes, out);
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(ReadAtUnlocked(position_, nbytes, bytes_read, out));
+    position_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(ReadAtUnlocked(position_, nbytes, out));
+    position_ += (*out)->size();
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
+ private:
+  Status ReadAtUnlocked(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                        void* out) {
+    if (options_.direct_io) {
+      // The caller's memory is not aligned
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(ReadAtUnlocked(position, nbytes, &buffer));
+      *bytes_read = buffer->size();
+      std::memcpy(out, buffer->data(), static_cast<size_t>(*bytes_read));
+      return Status::OK();
+    }
+    RETURN_NOT_OK(CheckRange(position, nbytes));
+    std::vector<UringRequest> requests(1);
+    requests[0] = {position, reinterpret_cast<uint8_t*>(out), nbytes, 0, false};
+    RETURN_NOT_OK(ring_.Run(fd_, false, false, &requests));
+    *bytes_read = requests[0].done;
+    return Status::OK();
+  }
+
+  Status ReadAtUnlocked(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    RETURN_NOT_OK(ReadRangesUnlocked({{position, nbytes}}, &buffers));
+    *out = std::move(buffers[0]);
+    return Status::OK();
+  }
+
+  Status ReadRangesUnlocked(const std::vector<ReadRange>& ranges,
+                            std::vector<std::shared_ptr<Buffer>>* out) {
+    const size_t num_ranges = ranges.size();
+    for (const ReadRange& range : ranges) {
+      RETURN_NOT_OK(CheckRange(range.offset, range.length));
+    }
+
+    // Direct reads cover whole blocks, the range starting skip bytes in
+    std::vector<UringRequest> requests(num_ranges);
+    std::vector<int64_t> skips(num_ranges);
+    int64_t arena_bytes = 0;
+    for (size_t i = 0; i < num_ranges; ++i) {
+      int64_t start = ranges[i].offset;
+      int64_t end = ranges[i].offset + ranges[i].length;
+      if (options_.direct_io) {
+        start -= start % kDirectIOAlignment;
+        end = BitUtil::RoundUp(end, kDirectIOAlignment);
+      }
+      requests[i] = {start, nullptr, end - start, 0, false};
+      skips[i] = ranges[i].offset - start;
+      if (FitsArena(requests[i].length)) {
+        arena_bytes += BitUtil::RoundUp(requests[i].length, alignment_);
+      }
+    }
+    // Registering a new region once the batch is in flight is not allowed
+    if (arena_bytes > 0 && (arena_ == nullptr || arena_used_ + arena_bytes >
+                                                     options_.registered_buffer_size)) {
+      RETURN_NOT_OK(NewArena());
+    }
+
+    std::vector<std::shared_ptr<Buffer>> buffers(num_ranges);
+    std::vector<int64_t> buffer_offsets(num_ranges);
+    for (size_t i = 0; i < num_ranges; ++i) {
+      RETURN_NOT_OK(Allocate(&requests[i], &buffers[i], &buffer_offsets[i]));
+    }
+    RETURN_NOT_OK(ring_.Run(fd_, false, options_.direct_io, &requests));
+
+    out->resize(num_ranges);
+    for (size_t i = 0; i < num_ranges; ++i) {
+      const int64_t size =
+          std::max<int64_t>(0, std::min(ranges[i].length, requests[i].done - skips[i]));
+      (*out)[i] = SliceBuffer(buffers[i], buffer_offsets[i] + skips[i], size);
+    }
+    return Status::OK();
+  }
+
+  Status CheckRange(int64_t position, int64_t nbytes) {
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    if (nbytes < 0) {
+      return Status::Invalid("Invalid read length");
+    }
+    return Status::OK();
+  }
+
+  bool FitsArena(int64_t length) const {
+    return length > 0 && length <= options_.registered_buffer_size;
+  }
+
+  Status NewArena() {
+    const int64_t size = options_.registered_buffer_size;
+    std::shared_ptr<Buffer> arena;
+    RETURN_NOT_OK(AllocateBuffer(pool_, size + alignment_, &arena));
+    const int64_t offset =
+        BitUtil::RoundUp(reinterpret_cast<int64_t>(arena->data()), alignment_) -
+        reinterpret_cast<int64_t>(arena->data());
+    RETURN_NOT_OK(ring_.RegisterBuffer(arena->mutable_data() + offset, size));
+    // The buffers carved from the previous region keep it alive
+    arena_ = std::move(arena);
+    arena_offset_ = offset;
+    arena_used_ = 0;
+    return Status::OK();
+  }
+
+  // Find the memory of a request, in the registered region if it fits
+  Status Allocate(UringRequest* request, std::shared_ptr<Buffer>* buffer,
+                  int64_t* buffer_offset) {
+    const int64_t length = BitUtil::RoundUp(request->length, alignment_);
+    if (FitsArena(request->length) &&
+        arena_used_ + length <= options_.registered_buffer_size) {
+      *buffer = arena_;
+      *buffer_offset = arena_offset_ + arena_used_;
+      request->fixed = true;
+      arena_used_ += length;
+    } else {
+      // Pool allocations are already aligned enough for buffered reads
+      const int64_t padding = options_.direct_io ? alignment_ : 0;
+      RETURN_NOT_OK(AllocateBuffer(pool_, length + padding, buffer));
+      const int64_t address = reinterpret_cast<int64_t>((*buffer)->data());
+      *buffer_offset = BitUtil::RoundUp(address, alignment_) - address;
+    }
+    request->data = (*buffer)->mutable_data() + *buffer_offset;
+    return Status::OK();
+  }
+
+  UringOptions options_;
+  MemoryPool* pool_;
+  Uring ring_;
+  const int64_t alignment_;
+  int64_t position_;
+
+  // The registered region and how much of it is handed out
+  std::shared_ptr<Buffer> arena_;
+  int64_t arena_offset_;
+  int64_t arena_used_;
+};
+
+UringReadableFile::UringReadableFile(const UringOptions& options, MemoryPool* pool) {
+  impl_.reset(new UringReadableFileImpl(options, pool));
+}
+
+UringReadableFile::~UringReadableFile() { DCHECK(impl_->Close().ok()); }
+
+Status UringReadableFile::Open(const std::string& path, const UringOptions& options,
+                               MemoryPool* pool,
+                               std::shared_ptr<UringReadableFile>* file) {
+  *file = std::shared_ptr<UringReadableFile>(new UringReadableFile(options, pool));
+  return (*file)->impl_->Open(path);
+}
+
+Status UringReadableFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                     std::vector<std::shared_ptr<Buffer>>* out) {
+  ARROW_TRACE_SPAN("io", "UringReadableFile::ReadRanges");
+  return impl_->ReadRanges(ranges, out);
+}
+
+Status UringReadableFile::Close() { return impl_->Close(); }
+
+Status UringReadableFile::Tell(int64_t* position) const { return impl_->Tell(position); }
+
+Status UringReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status UringReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status UringReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                 void* out) {
+  ARROW_TRACE_SPAN("io", "UringReadableFile::ReadAt");
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status UringReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                 std::shared_ptr<Buffer>* out) {
+  ARROW_TRACE_SPAN("io", "UringReadableFile::ReadAt");
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Status UringReadableFile::GetSize(int64_t* size) {
+  *size = impl_->size();
+  return Status::OK();
+}
+
+Status UringReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+bool UringReadableFile::supports_zero_copy() const { return false; }
+
+Status UringReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return FileWillNeed(impl_->fd(), ranges);
+}
+
+Status UringReadableFile::AdviseAccessPattern(AccessPattern::type pattern) {
+  return FileAdviseAccessPattern(impl_->fd(), pattern);
+}
+
+int UringReadableFile::file_descriptor() const { return impl_->fd(); }
+
+class UringFileOutputStream::UringFileOutputStreamImpl : public OSFile {
+ public:
+  explicit UringFileOutputStreamImpl(const UringOptions& options)
+      : OSFile(), options_(options), position_(0) {}
+
+  Status Open(const std::string& path, bool append) {
+    RETURN_NOT_OK(ValidateUringOptions(options_));
+    RETURN_NOT_OK(ring_.Init(options_.queue_depth));
+    RETURN_NOT_OK(OpenWriteable(path, append, true));
+    position_ = size_;
+    return Status::OK();
+  }
+
+  Status Close() {
+    RETURN_NOT_OK(OSFile::Close());
+    return ring_.Close();
+  }
+
+  // The slices are written at consecutive offsets, in whatever order they
+  // complete
+  Status Writev(const std::vector<WriteSlice>& slices) {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::vector<UringRequest> requests;
+    requests.reserve(slices.size());
+    int64_t offset = position_;
+    for (const WriteSlice& slice : slices) {
+      if (slice.nbytes < 0) {
+        return Status::IOError("Length must be non-negative");
+      }
+      uint8_t* data = reinterpret_cast<uint8_t*>(const_cast<void*>(slice.data));
+      requests.push_back({offset, data, slice.nbytes, 0, false});
+      offset += slice.nbytes;
+    }
+    RETURN_NOT_OK(ring_.Run(fd_, true, false, &requests));
+    position_ = offset;
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
+ private:
+  UringOptions options_;
+  Uring ring_;
+  int64_t position_;
+};
+
+UringFileOutputStream::UringFileOutputStream(const UringOptions& options) {
+  impl_.reset(new UringFileOutputStreamImpl(options));
+}
+
+UringFileOutputStream::~UringFileOutputStream() {
+  // This can fail; better to explicitly call close
+  DCHECK(impl_->Close().ok());
+}
+
+Status UringFileOutputStream::Open(const std::string& path, bool append,
+                                   const UringOptions& options,
+                                   std::shared_ptr<UringFileOutputStream>* file) {
+  *file = std::shared_ptr<UringFileOutputStream>(new UringFileOutputStream(options));
+  return (*file)->impl_->Open(path, append);
+}
+
+Status UringFileOutputStream::Close() { return impl_->Close(); }
+
+Status UringFileOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status UringFileOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Writev({{data, nbytes}});
+}
+
+Status UringFileOutputStream::Writev(const std::vector<WriteSlice>& slices) {
+  return impl_->Writev(slices);
+}
+
+int UringFileOutputStream::file_descriptor() const { return impl_->fd(); }
+
 // ----------------------------------------------------------------------
 // Implement MemoryMappedFile
 
+// The smallest mapping of a growable file
+static constexpr int64_t kMinGrowableMapSize = 1 << 20;
+
 class MemoryMappedFile::MemoryMap : public MutableBuffer {
  public:
-  MemoryMap() : MutableBuffer(nullptr, 0) {}
+  MemoryMap()
+      : MutableBuffer(nullptr, 0),
+        readable_size_(0),
+        growable_(false),
+        sealed_(false),
+        mapped_size_(0),
+        reserved_size_(0) {}
 
   ~MemoryMap() {
     if (file_->is_open()) {
-      munmap(mutable_data_, static_cast<size_t>(size_));
+      if (growable_) {
+        DCHECK_OK(Seal());
+        munmap(mutable_data_, static_cast<size_t>(reserved_size_));
+      } else {
+        munmap(mutable_data_, static_cast<size_t>(size_));
+      }
       DCHECK(file_->Close().ok());
     }
   }
@@ -625,6 +1513,7 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
     }
 
     size_ = file_->size();
+    readable_size_.store(size_);
 
     void* result = nullptr;
 
@@ -646,8 +1535,99 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
     return Status::OK();
   }
 
+#ifndef _WIN32
+  // The file starts empty, with only address space behind the mapping
+  Status OpenGrowable(const std::string& path, int64_t max_size) {
+    file_.reset(new OSFile());
+    constexpr bool append = false;
+    constexpr bool write_only = false;
+    RETURN_NOT_OK(file_->OpenWriteable(path, append, write_only));
+
+    page_size_ = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    reserved_size_ = BitUtil::RoundUp(std::max<int64_t>(max_size, 1), page_size_);
+    void* result = mmap(nullptr, static_cast<size_t>(reserved_size_), PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (result == MAP_FAILED) {
+      std::stringstream ss;
+      ss << "Reserving " << reserved_size_ << " bytes of address space failed: "
+         << std::strerror(errno);
+      return Status::IOError(ss.str());
+    }
+    data_ = mutable_data_ = reinterpret_cast<uint8_t*>(result);
+    size_ = 0;
+    max_size_ = max_size;
+    position_ = 0;
+    growable_ = true;
+    is_mutable_ = true;
+    return Status::OK();
+  }
+
+  // Make room for size bytes, extending the file and mapping the new part
+  // over the reserved address space
+  Status Grow(int64_t size) {
+    if (size <= mapped_size_) {
+      return Status::OK();
+    }
+    if (size > max_size_) {
+      std::stringstream ss;
+      ss << "Cannot grow memory map past its maximum size of " << max_size_ << " bytes";
+      return Status::Invalid(ss.str());
+    }
+    int64_t new_size = std::max(mapped_size_ * 2, kMinGrowableMapSize);
+    new_size = std::min(std::max(BitUtil::RoundUp(size, page_size_), new_size),
+                        reserved_size_);
+
+    if (ftruncate(file_->fd(), static_cast<off_t>(new_size)) == -1) {
+      std::stringstream ss;
+      ss << "Extending memory mapped file failed: " << std::strerror(errno);
+      return Status::IOError(ss.str());
+    }
+    uint8_t* tail = mutable_data_ + mapped_size_;
+    void* result = mmap(tail, static_cast<size_t>(new_size - mapped_size_),
+                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file_->fd(),
+                        static_cast<off_t>(mapped_size_));
+    if (result != tail) {
+      std::stringstream ss;
+      ss << "Memory mapping file failed: " << std::strerror(errno);
+      return Status::IOError(ss.str());
+    }
+    mapped_size_ = new_size;
+    return Status::OK();
+  }
+
+#endif
+
+  // Cut a growable file down to the bytes written, ending the writes
+  Status Seal() {
+    if (!growable_ || sealed_) {
+      return Status::OK();
+    }
+    sealed_ = true;
+#ifndef _WIN32
+    if (ftruncate(file_->fd(), static_cast<off_t>(size_)) == -1) {
+      std::stringstream ss;
+      ss << "Truncating memory mapped file failed: " << std::strerror(errno);
+      return Status::IOError(ss.str());
+    }
+#endif
+    return Status::OK();
+  }
+
+  // The bytes written to a growable file are readable, once they are copied
+  void Extend(int64_t end) {
+    size_ = std::max(size_, end);
+    readable_size_.store(size_, std::memory_order_release);
+  }
+
   int64_t size() const { return size_; }
 
+  // The size for readers that do not take the lock
+  int64_t readable_size() const {
+    return readable_size_.load(std::memory_order_acquire);
+  }
+
+  bool growable() const { return growable_; }
+
   Status Seek(int64_t position) {
     if (position < 0) {
       return Status::Invalid("position is out of bounds");
@@ -662,7 +1642,7 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
 
   uint8_t* head() { return mutable_data_ + position_; }
 
-  bool writable() { return file_->mode() != FileMode::READ; }
+  bool writable() { return file_->mode() != FileMode::READ && !sealed_; }
 
   bool opened() { return file_->is_open(); }
 
@@ -673,6 +1653,15 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
  private:
   std::unique_ptr<OSFile> file_;
   int64_t position_;
+  std::atomic<int64_t> readable_size_;
+
+  bool growable_;
+  bool sealed_;
+  int64_t page_size_;
+  int64_t max_size_;
+  // The bytes of the file mapped, a prefix of the reserved address space
+  int64_t mapped_size_;
+  int64_t reserved_size_;
 };
 
 MemoryMappedFile::MemoryMappedFile() {}
@@ -710,8 +1699,26 @@ Status MemoryMappedFile::Open(const std::string& path, FileMode::type mode,
   return Status::OK();
 }
 
+Status MemoryMappedFile::CreateGrowable(const std::string& path, int64_t max_size,
+                                        std::shared_ptr<MemoryMappedFile>* out) {
+#ifdef _WIN32
+  return Status::NotImplemented("Growable memory maps are not supported on Windows");
+#else
+  if (max_size <= 0) {
+    return Status::Invalid("Maximum size of a growable memory map must be positive");
+  }
+  std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
+
+  result->memory_map_.reset(new MemoryMap());
+  RETURN_NOT_OK(result->memory_map_->OpenGrowable(path, max_size));
+
+  *out = result;
+  return Status::OK();
+#endif
+}
+
 Status MemoryMappedFile::GetSize(int64_t* size) {
-  *size = memory_map_->size();
+  *size = memory_map_->readable_size();
   return Status::OK();
 }
 
@@ -724,7 +1731,8 @@ Status MemoryMappedFile::Seek(int64_t position) { return memory_map_->Seek(posit
 
 Status MemoryMappedFile::Close() {
   // munmap handled in pimpl dtor
-  return Status::OK();
+  std::lock_guard<std::mutex> guard(memory_map_->lock());
+  return memory_map_->Seal();
 }
 
 Status MemoryMappedFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
@@ -751,22 +1759,98 @@ Status MemoryMappedFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return Status::OK();
 }
 
+// ReadAt addresses the map directly rather than seeking, so that it leaves the
+// read position alone. The mapping never moves, so no lock is needed either
 Status MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
-  std::lock_guard<std::mutex> guard(memory_map_->lock());
-  RETURN_NOT_OK(Seek(position));
-  return Read(nbytes, bytes_read, out);
+  ARROW_TRACE_SPAN("io", "MemoryMappedFile::ReadAt");
+  if (position < 0) {
+    return Status::Invalid("position is out of bounds");
+  }
+  const int64_t size = memory_map_->readable_size();
+  nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+  if (nbytes > 0) {
+    std::memcpy(out, memory_map_->data() + position, static_cast<size_t>(nbytes));
+  }
+  *bytes_read = nbytes;
+  return Status::OK();
 }
 
 Status MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes,
                                 std::shared_ptr<Buffer>* out) {
-  std::lock_guard<std::mutex> guard(memory_map_->lock());
-  RETURN_NOT_OK(Seek(position));
-  return Read(nbytes, out);
+  if (position < 0) {
+    return Status::Invalid("position is out of bounds");
+  }
+  const int64_t size = memory_map_->readable_size();
+  nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+  if (nbytes > 0) {
+    *out = SliceBuffer(memory_map_, position, nbytes);
+  } else {
+    *out = std::make_shared<Buffer>(nullptr, 0);
+  }
+  return Status::OK();
+}
+
+Status MemoryMappedFile::ReadAsync(int64_t position, int64_t nbytes,
+                                   std::shared_ptr<Buffer>* out,
+                                   std::future<Status>* done) {
+  std::promise<Status> promise;
+  promise.set_value(ReadAt(position, nbytes, out));
+  *done = promise.get_future();
+  return Status::OK();
 }
 
 bool MemoryMappedFile::supports_zero_copy() const { return true; }
 
+#ifndef _WIN32
+static inline Status MemoryAdvise(const uint8_t* data, int64_t length, int advice) {
+  if (madvise(const_cast<uint8_t*>(data), static_cast<size_t>(length), advice) == -1) {
+    std::stringstream ss;
+    ss << "madvise failed: " << std::strerror(errno);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+}
+#endif
+
+Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(CheckReadRanges(ranges));
+#ifndef _WIN32
+  static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  std::lock_guard<std::mutex> guard(memory_map_->lock());
+  const int64_t size = memory_map_->size();
+  for (const ReadRange& range : ranges) {
+    const int64_t end = std::min(size, range.offset + range.length);
+    if (range.offset >= end) {
+      continue;
+    }
+    // madvise takes page-aligned addresses, and the mapping starts on a page
+    const int64_t start = range.offset - range.offset % page_size;
+    RETURN_NOT_OK(
+        MemoryAdvise(memory_map_->data() + start, end - start, MADV_WILLNEED));
+  }
+#endif
+  return Status::OK();
+}
+
+Status MemoryMappedFile::AdviseAccessPattern(AccessPattern::type pattern) {
+#ifndef _WIN32
+  std::lock_guard<std::mutex> guard(memory_map_->lock());
+  if (memory_map_->size() == 0) {
+    return Status::OK();
+  }
+  int advice = MADV_NORMAL;
+  if (pattern == AccessPattern::SEQUENTIAL) {
+    advice = MADV_SEQUENTIAL;
+  } else if (pattern == AccessPattern::RANDOM) {
+    advice = MADV_RANDOM;
+  }
+  return MemoryAdvise(memory_map_->data(), memory_map_->size(), advice);
+#else
+  return Status::OK();
+#endif
+}
+
 Status MemoryMappedFile::WriteAt(int64_t position, const void* data, int64_t nbytes) {
   std::lock_guard<std::mutex> guard(memory_map_->lock());
 
@@ -779,24 +1863,241 @@ Status MemoryMappedFile::WriteAt(int64_t position, const void* data, int64_t nby
 }
 
 Status MemoryMappedFile::Write(const void* data, int64_t nbytes) {
+  ARROW_TRACE_SPAN("io", "MemoryMappedFile::Write");
   std::lock_guard<std::mutex> guard(memory_map_->lock());
 
   if (!memory_map_->opened() || !memory_map_->writable()) {
     return Status::IOError("Unable to write");
   }
-  if (nbytes + memory_map_->position() > memory_map_->size()) {
+  if (!memory_map_->growable() &&
+      nbytes + memory_map_->position() > memory_map_->size()) {
     return Status::Invalid("Cannot write past end of memory map");
   }
   return WriteInternal(data, nbytes);
 }
 
 Status MemoryMappedFile::WriteInternal(const void* data, int64_t nbytes) {
+  const int64_t end = memory_map_->position() + nbytes;
+#ifndef _WIN32
+  if (memory_map_->growable()) {
+    RETURN_NOT_OK(memory_map_->Grow(end));
+  }
+#endif
   memcpy(memory_map_->head(), data, static_cast<size_t>(nbytes));
   memory_map_->advance(nbytes);
+  if (memory_map_->growable()) {
+    memory_map_->Extend(end);
+  }
   return Status::OK();
 }
 
 int MemoryMappedFile::file_descriptor() const { return memory_map_->fd(); }
 
+// ----------------------------------------------------------------------
+// LocalFileSystem implementation
+
+#if defined(_MSC_VER)
+
+static Status ToPlatformFilename(const std::string& path, PlatformFilename* out) {
+  try {
+    std::codecvt_utf8_utf16<wchar_t> utf16_converter;
+    out->assign(path, utf16_converter);
+  } catch (boost::system::system_error& e) {
+    return Status::Invalid(e.what());
+  }
+  return Status::OK();
+}
+
+// Run a boost::filesystem operation, turning its exceptions into errors
+template <typename Function>
+static Status FileSystemCall(Function&& func) {
+  try {
+    func();
+  } catch (boost::system::system_error& e) {
+    return Status::IOError(e.what());
+  }
+  return Status::OK();
+}
+
+#else
+
+static std::string JoinPath(const std::string& dir, const std::string& name) {
+  if (!dir.empty() && dir.back() == '/') {
+    return dir + name;
+  }
+  return dir + "/" + name;
+}
+
+static Status ListDirectory(const std::string& path, std::vector<std::string>* names) {
+  DIR* dir = opendir(path.c_str());
+  if (dir == nullptr) {
+    return CheckFileOpResult(-1, errno, PlatformFilename(path), "open directory");
+  }
+  struct dirent* entry;
+  errno = 0;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      names->push_back(entry->d_name);
+    }
+  }
+  int errno_actual = errno;
+  closedir(dir);
+  return CheckFileOpResult(errno_actual == 0 ? 0 : -1, errno_actual,
+                           PlatformFilename(path), "list directory");
+}
+
+// Delete a file, or a directory and its contents. Symbolic links are
+// deleted, not followed
+static Status DeleteTree(const std::string& path) {
+  struct stat st;
+  int ret = lstat(path.c_str(), &st);
+  RETURN_NOT_OK(CheckFileOpResult(ret, errno, PlatformFilename(path), "stat"));
+  if (S_ISDIR(st.st_mode)) {
+    std::vector<std::string> names;
+    RETURN_NOT_OK(ListDirectory(path, &names));
+    for (const auto& name : names) {
+      RETURN_NOT_OK(DeleteTree(JoinPath(path, name)));
+    }
+    ret = rmdir(path.c_str());
+    return CheckFileOpResult(ret, errno, PlatformFilename(path), "delete directory");
+  }
+  ret = unlink(path.c_str());
+  return CheckFileOpResult(ret, errno, PlatformFilename(path), "delete");
+}
+
+#endif
+
+LocalFileSystem::LocalFileSystem() {}
+
+LocalFileSystem::~LocalFileSystem() {}
+
+Status LocalFileSystem::MakeDirectory(const std::string& path) {
+#if defined(_MSC_VER)
+  PlatformFilename file_name;
+  RETURN_NOT_OK(ToPlatformFilename(path, &file_name));
+  return FileSystemCall([&file_name]() { fs::create_directories(file_name); });
+#else
+  // Create the missing directories from the root down
+  size_t pos = 0;
+  while (pos != std::string::npos) {
+    pos = path.find('/', pos + 1);
+    const std::string prefix = path.substr(0, pos);
+    if (prefix.empty() || prefix.back() == '/') {
+      continue;
+    }
+    if (mkdir(prefix.c_str(), 0777) == -1) {
+      int errno_actual = errno;
+      struct stat st;
+      if (errno_actual != EEXIST || stat(prefix.c_str(), &st) == -1 ||
+          !S_ISDIR(st.st_mode)) {
+        return CheckFileOpResult(-1, errno_actual, PlatformFilename(prefix),
+                                 "create directory");
+      }
+    }
+  }
+  return Status::OK();
+#endif
+}
+
+Status LocalFileSystem::DeleteDirectory(const std::string& path) {
+#if defined(_MSC_VER)
+  PlatformFilename file_name;
+  RETURN_NOT_OK(ToPlatformFilename(path, &file_name));
+  return FileSystemCall([&file_name]() {
+    if (!fs::is_directory(file_name)) {
+      throw fs::filesystem_error("Not a directory", file_name,
+                                 boost::system::errc::make_error_code(
+                                     boost::system::errc::not_a_directory));
+    }
+    fs::remove_all(file_name);
+  });
+#else
+  struct stat st;
+  int ret = stat(path.c_str(), &st);
+  RETURN_NOT_OK(CheckFileOpResult(ret, errno, PlatformFilename(path), "stat"));
+  if (!S_ISDIR(st.st_mode)) {
+    std::stringstream ss;
+    ss << "Not a directory: " << path;
+    return Status::IOError(ss.str());
+  }
+  return DeleteTree(path);
+#endif
+}
+
+Status LocalFileSystem::GetChildren(const std::string& path,
+                                    std::vector<std::string>* listing) {
+#if defined(_MSC_VER)
+  PlatformFilename file_name;
+  RETURN_NOT_OK(ToPlatformFilename(path, &file_name));
+  return FileSystemCall([&file_name, listing]() {
+    std::codecvt_utf8_utf16<wchar_t> utf16_converter;
+    for (fs::directory_iterator it(file_name), end; it != end; ++it) {
+      listing->push_back(it->path().string(utf16_converter));
+    }
+  });
+#else
+  std::vector<std::string> names;
+  RETURN_NOT_OK(ListDirectory(path, &names));
+  listing->reserve(listing->size() + names.size());
+  for (const auto& name : names) {
+    listing->push_back(JoinPath(path, name));
+  }
+  return Status::OK();
+#endif
+}
+
+Status LocalFileSystem::Rename(const std::string& src, const std::string& dst) {
+#if defined(_MSC_VER)
+  PlatformFilename src_name, dst_name;
+  RETURN_NOT_OK(ToPlatformFilename(src, &src_name));
+  RETURN_NOT_OK(ToPlatformFilename(dst, &dst_name));
+  return FileSystemCall([&src_name, &dst_name]() { fs::rename(src_name, dst_name); });
+#else
+  int ret = rename(src.c_str(), dst.c_str());
+  return CheckFileOpResult(ret, errno, PlatformFilename(src), "rename");
+#endif
+}
+
+Status LocalFileSystem::Stat(const std::string& path, FileStatistics* stat) {
+#if defined(_MSC_VER)
+  PlatformFilename file_name;
+  RETURN_NOT_OK(ToPlatformFilename(path, &file_name));
+  return FileSystemCall([&file_name, stat]() {
+    if (fs::is_directory(file_name)) {
+      stat->kind = ObjectType::DIRECTORY;
+      stat->size = 0;
+    } else {
+      stat->kind = ObjectType::FILE;
+      stat->size = static_cast<int64_t>(fs::file_size(file_name));
+    }
+  });
+#else
+  struct stat st;
+  int ret = ::stat(path.c_str(), &st);
+  RETURN_NOT_OK(CheckFileOpResult(ret, errno, PlatformFilename(path), "stat"));
+  if (S_ISDIR(st.st_mode)) {
+    stat->kind = ObjectType::DIRECTORY;
+    stat->size = 0;
+  } else {
+    stat->kind = ObjectType::FILE;
+    stat->size = static_cast<int64_t>(st.st_size);
+  }
+  return Status::OK();
+#endif
+}
+
+Status LocalFileSystem::OpenInputFile(const std::string& path,
+                                      std::shared_ptr<RandomAccessFile>* file) {
+  std::shared_ptr<ReadableFile> readable;
+  RETURN_NOT_OK(ReadableFile::Open(path, &readable));
+  *file = readable;
+  return Status::OK();
+}
+
+Status LocalFileSystem::OpenOutputStream(const std::string& path,
+                                         std::shared_ptr<OutputStream>* stream) {
+  return FileOutputStream::Open(path, stream);
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -76,6 +77,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write the slices with vectored writes where available. Thread-safe
+  Status Writev(const std::vector<WriteSlice>& slices) override;
+
   int file_descriptor() const;
 
  private:
@@ -123,6 +127,11 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
 
   bool supports_zero_copy() const override;
 
+  /// \brief Start reading the ranges into the page cache
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  Status AdviseAccessPattern(AccessPattern::type pattern) override;
+
   int file_descriptor() const;
 
  private:
@@ -132,6 +141,126 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief Options of the io_uring file backend
+struct ARROW_EXPORT UringOptions {
+  UringOptions() : queue_depth(64), registered_buffer_size(0), direct_io(false) {}
+
+  /// Number of submission queue entries, the most reads or writes in flight
+  /// at once
+  int32_t queue_depth;
+
+  /// Size of the region allocated from the memory pool and registered with
+  /// the ring, from which the buffers of ReadRanges and zero-copy ReadAt are
+  /// carved. The kernel then maps it once instead of at every read. Once
+  /// used up, another region is registered; the buffers keep theirs alive.
+  /// 0 to read into unregistered buffers
+  int64_t registered_buffer_size;
+
+  /// Open the file with O_DIRECT, bypassing the page cache. Reads are
+  /// widened to whole kDirectIOAlignment blocks and the buffers returned
+  /// are slices of them. Only used for reading
+  bool direct_io;
+};
+
+/// The alignment of the offsets, lengths and memory of direct reads
+static constexpr int64_t kDirectIOAlignment = 4096;
+
+/// \class UringReadableFile
+/// \brief A local file read through a Linux io_uring
+///
+/// Reads are queued to the kernel, up to queue_depth of them with one system
+/// call, instead of one pread each. Requires Linux 5.6 and building with
+/// ARROW_IO_URING, otherwise Open returns NotImplemented. The calls are
+/// thread-safe but share the ring, so issue concurrent reads with ReadRanges
+class ARROW_EXPORT UringReadableFile : public RandomAccessFile {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options the ring and buffer options
+  /// \param[in] pool a MemoryPool for the buffers read
+  /// \param[out] file UringReadableFile instance
+  static Status Open(const std::string& path, const UringOptions& options,
+                     MemoryPool* pool, std::shared_ptr<UringReadableFile>* file);
+
+  /// \brief Read several ranges of the file at once
+  ///
+  /// The ranges are submitted together and read in whatever order the
+  /// device completes them. A buffer is shorter than its range past the end
+  /// of the file
+  ///
+  /// \param[in] ranges the ranges to read
+  /// \param[out] out a buffer for each range
+  /// \return Status
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    std::vector<std::shared_ptr<Buffer>>* out);
+
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status GetSize(int64_t* size) override;
+  Status Seek(int64_t position) override;
+
+  bool supports_zero_copy() const override;
+
+  /// \brief Start reading the ranges into the page cache
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  Status AdviseAccessPattern(AccessPattern::type pattern) override;
+
+  int file_descriptor() const;
+
+ private:
+  UringReadableFile(const UringOptions& options, MemoryPool* pool);
+
+  class ARROW_NO_EXPORT UringReadableFileImpl;
+  std::unique_ptr<UringReadableFileImpl> impl_;
+};
+
+/// \class UringFileOutputStream
+/// \brief A local file written through a Linux io_uring
+///
+/// The slices of Writev are submitted together, at their offsets in the
+/// file, instead of through one writev call which the kernel serves a slice
+/// at a time. The same build requirements as UringReadableFile apply
+class ARROW_EXPORT UringFileOutputStream : public OutputStream {
+ public:
+  ~UringFileOutputStream() override;
+
+  /// \brief Open a local file for writing
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] append append to existing file, otherwise truncate to 0 bytes
+  /// \param[in] options the ring options
+  /// \param[out] file UringFileOutputStream instance
+  static Status Open(const std::string& path, bool append, const UringOptions& options,
+                     std::shared_ptr<UringFileOutputStream>* file);
+
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+
+  // Write bytes to the stream. Thread-safe
+  Status Write(const void* data, int64_t nbytes) override;
+
+  // Write the slices with a single submission. Thread-safe
+  Status Writev(const std::vector<WriteSlice>& slices) override;
+
+  int file_descriptor() const;
+
+ private:
+  explicit UringFileOutputStream(const UringOptions& options);
+
+  class ARROW_NO_EXPORT UringFileOutputStreamImpl;
+  std::unique_ptr<UringFileOutputStreamImpl> impl_;
+};
+
 // A file interface that uses memory-mapped files for memory interactions,
 // supporting zero copy reads. The same class is used for both reading and
 // writing.
@@ -149,6 +278,21 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   static Status Open(const std::string& path, FileMode::type mode,
                      std::shared_ptr<MemoryMappedFile>* out);
 
+  /// \brief Create a new file, mapped as it grows with the data written
+  ///
+  /// Writes past the end extend the file, doubling the mapped size. The
+  /// address space for max_size bytes is reserved up front, so that the
+  /// mapping never moves and the zero-copy buffers read from it stay valid
+  /// while it grows. Close truncates the file to the bytes written, after
+  /// which it is read-only. Not supported on Windows
+  ///
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] max_size the largest size the file can grow to
+  /// \param[out] out the created file, in read/write mode
+  static Status CreateGrowable(const std::string& path, int64_t max_size,
+                               std::shared_ptr<MemoryMappedFile>* out);
+
+  /// Truncate a growable file to the bytes written
   Status Close() override;
 
   Status Tell(int64_t* position) const override;
@@ -161,14 +305,25 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   // Zero copy read. Not thread-safe
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
+  /// Thread-safe without locking, and does not change the read position
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                 void* out) override;
 
-  /// Default implementation is thread-safe
+  /// Zero copy read, thread-safe without locking, and does not change the
+  /// read position. Concurrent writes to a growable file do not block it
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
+  /// Zero copy read, done right away
+  Status ReadAsync(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out,
+                   std::future<Status>* done) override;
+
   bool supports_zero_copy() const override;
 
+  /// \brief Fault in the pages of the ranges ahead of the reads
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  Status AdviseAccessPattern(AccessPattern::type pattern) override;
+
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
@@ -189,6 +344,35 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   std::shared_ptr<MemoryMap> memory_map_;
 };
 
+/// \class LocalFileSystem
+/// \brief The file system of the local machine
+///
+/// Paths are UTF8 encoded. Listed paths are the directory path joined with
+/// the child name. Symbolic links are followed
+class ARROW_EXPORT LocalFileSystem : public FileSystem {
+ public:
+  LocalFileSystem();
+  ~LocalFileSystem() override;
+
+  Status MakeDirectory(const std::string& path) override;
+
+  Status DeleteDirectory(const std::string& path) override;
+
+  Status GetChildren(const std::string& path, std::vector<std::string>* listing) override;
+
+  Status Rename(const std::string& src, const std::string& dst) override;
+
+  Status Stat(const std::string& path, FileStatistics* stat) override;
+
+  /// Open a ReadableFile
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<RandomAccessFile>* file) override;
+
+  /// Open a FileOutputStream
+  Status OpenOutputStream(const std::string& path,
+                          std::shared_ptr<OutputStream>* stream) override;
+};
+
 }  // namespace io
 }  // namespace arrow
 
@@ -314,6 +314,17 @@ void LibHdfsShim::BuilderSetForceNewInstance(hdfsBuilder* bld) {
   this->hdfsBuilderSetForceNewInstance(bld);
 }
 
+bool LibHdfsShim::HasBuilderConfSetStr() {
+  GET_SYMBOL(this, hdfsBuilderConfSetStr);
+  return this->hdfsBuilderConfSetStr != nullptr;
+}
+
+int LibHdfsShim::BuilderConfSetStr(hdfsBuilder* bld, const char* key, const char* val) {
+  GET_SYMBOL(this, hdfsBuilderConfSetStr);
+  DCHECK(this->hdfsBuilderConfSetStr);
+  return this->hdfsBuilderConfSetStr(bld, key, val);
+}
+
 hdfsFS LibHdfsShim::BuilderConnect(hdfsBuilder* bld) {
   return this->hdfsBuilderConnect(bld);
 }
@@ -488,6 +499,26 @@ int LibHdfsShim::Utime(hdfsFS fs, const char* path, tTime mtime, tTime atime) {
   }
 }
 
+bool LibHdfsShim::HasReadStatistics() {
+  GET_SYMBOL(this, hdfsFileGetReadStatistics);
+  GET_SYMBOL(this, hdfsFileFreeReadStatistics);
+  return this->hdfsFileGetReadStatistics != nullptr &&
+         this->hdfsFileFreeReadStatistics != nullptr;
+}
+
+int LibHdfsShim::FileGetReadStatistics(hdfsFile file,
+                                       struct hdfsReadStatistics** stats) {
+  GET_SYMBOL(this, hdfsFileGetReadStatistics);
+  DCHECK(this->hdfsFileGetReadStatistics);
+  return this->hdfsFileGetReadStatistics(file, stats);
+}
+
+void LibHdfsShim::FileFreeReadStatistics(struct hdfsReadStatistics* stats) {
+  GET_SYMBOL(this, hdfsFileFreeReadStatistics);
+  DCHECK(this->hdfsFileFreeReadStatistics);
+  this->hdfsFileFreeReadStatistics(stats);
+}
+
 Status LibHdfsShim::GetRequiredSymbols() {
   GET_SYMBOL_REQUIRED(this, hdfsNewBuilder);
   GET_SYMBOL_REQUIRED(this, hdfsBuilderSetNameNode);
@@ -52,6 +52,7 @@ struct LibHdfsShim {
   void (*hdfsBuilderSetKerbTicketCachePath)(hdfsBuilder* bld,
                                             const char* kerbTicketCachePath);
   void (*hdfsBuilderSetForceNewInstance)(hdfsBuilder* bld);
+  int (*hdfsBuilderConfSetStr)(hdfsBuilder* bld, const char* key, const char* val);
   hdfsFS (*hdfsBuilderConnect)(hdfsBuilder* bld);
 
   int (*hdfsDisconnect)(hdfsFS fs);
@@ -88,6 +89,8 @@ struct LibHdfsShim {
   int (*hdfsChown)(hdfsFS fs, const char* path, const char* owner, const char* group);
   int (*hdfsChmod)(hdfsFS fs, const char* path, short mode);  // NOLINT
   int (*hdfsUtime)(hdfsFS fs, const char* path, tTime mtime, tTime atime);
+  int (*hdfsFileGetReadStatistics)(hdfsFile file, struct hdfsReadStatistics** stats);
+  void (*hdfsFileFreeReadStatistics)(struct hdfsReadStatistics* stats);
 
   void Initialize() {
     this->handle = nullptr;
@@ -97,6 +100,7 @@ struct LibHdfsShim {
     this->hdfsBuilderSetUserName = nullptr;
     this->hdfsBuilderSetKerbTicketCachePath = nullptr;
     this->hdfsBuilderSetForceNewInstance = nullptr;
+    this->hdfsBuilderConfSetStr = nullptr;
     this->hdfsBuilderConnect = nullptr;
     this->hdfsDisconnect = nullptr;
     this->hdfsOpenFile = nullptr;
@@ -128,6 +132,8 @@ struct LibHdfsShim {
     this->hdfsChown = nullptr;
     this->hdfsChmod = nullptr;
     this->hdfsUtime = nullptr;
+    this->hdfsFileGetReadStatistics = nullptr;
+    this->hdfsFileFreeReadStatistics = nullptr;
   }
 
   hdfsBuilder* NewBuilder(void);
@@ -142,6 +148,10 @@ struct LibHdfsShim {
 
   void BuilderSetForceNewInstance(hdfsBuilder* bld);
 
+  bool HasBuilderConfSetStr();
+
+  int BuilderConfSetStr(hdfsBuilder* bld, const char* key, const char* val);
+
   hdfsFS BuilderConnect(hdfsBuilder* bld);
 
   int Disconnect(hdfsFS fs);
@@ -206,6 +216,12 @@ struct LibHdfsShim {
 
   int Utime(hdfsFS fs, const char* path, tTime mtime, tTime atime);
 
+  bool HasReadStatistics();
+
+  int FileGetReadStatistics(hdfsFile file, struct hdfsReadStatistics** stats);
+
+  void FileFreeReadStatistics(struct hdfsReadStatistics* stats);
+
   Status GetRequiredSymbols();
 };
 
@@ -20,10 +20,15 @@
 #include <algorithm>
 #include <cerrno>
 #include <cstddef>
+#include <condition_variable>
 #include <cstdint>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/hdfs-internal.h"
@@ -31,6 +36,8 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
 using std::size_t;
 
@@ -59,8 +66,6 @@ static Status CheckReadResult(int ret) {
   return Status::OK();
 }
 
-static constexpr int kDefaultHdfsBufferSize = 1 << 16;
-
 // ----------------------------------------------------------------------
 // File reading
 
@@ -108,10 +113,22 @@ class HdfsAnyFileImpl {
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
-  explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
+  explicit HdfsReadableFileImpl(MemoryPool* pool)
+      : pool_(pool), num_pooled_handles_(0) {}
 
   Status Close() {
     if (is_open_) {
+      // The pooled handles are all free, as no ReadAt may be running
+      std::lock_guard<std::mutex> guard(handles_lock_);
+      DCHECK_EQ(free_handles_.size(), static_cast<size_t>(num_pooled_handles_));
+      for (hdfsFile handle : free_handles_) {
+        int ret = driver_->CloseFile(fs_, handle);
+        CHECK_FAILURE(ret, "CloseFile");
+      }
+      free_handles_.clear();
+      all_pooled_handles_.clear();
+      num_pooled_handles_ = 0;
+
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
       is_open_ = false;
@@ -120,6 +137,15 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* buffer) {
+    if (options_.max_handles > 1) {
+      if (nbytes >= 2 * options_.parallel_read_size) {
+        return ParallelReadAt(position, nbytes, bytes_read,
+                              reinterpret_cast<uint8_t*>(buffer));
+      }
+      return PooledReadAt(position, nbytes, bytes_read,
+                          reinterpret_cast<uint8_t*>(buffer));
+    }
+
     tSize ret;
     if (driver_->HasPread()) {
       ret = driver_->Pread(fs_, file_, static_cast<tOffset>(position),
@@ -154,7 +180,8 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     while (total_bytes < nbytes) {
       tSize ret = driver_->Read(
           fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
-          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
+          static_cast<tSize>(
+              std::min<int64_t>(options_.buffer_size, nbytes - total_bytes)));
       RETURN_NOT_OK(CheckReadResult(ret));
       total_bytes += ret;
       if (ret == 0) {
@@ -191,13 +218,196 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
     return Status::OK();
   }
 
+  Status GetReadStatistics(HdfsReadStatistics* out) {
+    if (!driver_->HasReadStatistics()) {
+      return Status::NotImplemented("HDFS driver does not support read statistics");
+    }
+    *out = HdfsReadStatistics{0, 0, 0, 0};
+    RETURN_NOT_OK(AddReadStatistics(file_, out));
+    std::lock_guard<std::mutex> guard(handles_lock_);
+    for (hdfsFile handle : all_pooled_handles_) {
+      RETURN_NOT_OK(AddReadStatistics(handle, out));
+    }
+    return Status::OK();
+  }
+
   void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
 
-  void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
+  void set_options(const HdfsReadOptions& options) { options_ = options; }
 
  private:
+  // Read a range with a handle of the pool
+  Status PooledReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                      uint8_t* buffer) {
+    ARROW_TRACE_SPAN("io", "HdfsReadableFile::PooledReadAt");
+    hdfsFile handle;
+    RETURN_NOT_OK(AcquireHandle(&handle));
+    Status st = ReadAtHandle(handle, position, nbytes, bytes_read, buffer);
+    ReleaseHandle(handle);
+    return st;
+  }
+
+  // Read a range with a handle no other thread uses, until it is complete or
+  // the file ends
+  Status ReadAtHandle(hdfsFile handle, int64_t position, int64_t nbytes,
+                      int64_t* bytes_read, uint8_t* buffer) {
+    const bool has_pread = driver_->HasPread();
+    if (!has_pread) {
+      int ret = driver_->Seek(fs_, handle, static_cast<tOffset>(position));
+      CHECK_FAILURE(ret, "seek");
+    }
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      // tSize is 32-bit
+      const tSize length = static_cast<tSize>(std::min<int64_t>(
+          nbytes - total_bytes, std::numeric_limits<tSize>::max()));
+      tSize ret;
+      if (has_pread) {
+        ret = driver_->Pread(fs_, handle, static_cast<tOffset>(position + total_bytes),
+                             buffer + total_bytes, length);
+      } else {
+        ret = driver_->Read(fs_, handle, buffer + total_bytes, length);
+      }
+      RETURN_NOT_OK(CheckReadResult(ret));
+      if (ret == 0) {
+        break;
+      }
+      total_bytes += ret;
+    }
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  // State of a ReadAt split into pieces read on several handles
+  struct ParallelRead {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t next_piece;
+    int64_t pieces_done;
+    Status status;
+    std::vector<int64_t> piece_bytes_read;
+  };
+
+  // Read a large range in pieces on several handles at once. The calling
+  // thread reads pieces too and only waits for pieces other threads started,
+  // so it cannot deadlock when called from the I/O thread pool
+  Status ParallelReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                        uint8_t* buffer) {
+    const int64_t piece_size =
+        std::max(options_.parallel_read_size,
+                 (nbytes + options_.max_handles - 1) / options_.max_handles);
+    const int64_t num_pieces = (nbytes + piece_size - 1) / piece_size;
+
+    auto state = std::make_shared<ParallelRead>();
+    state->next_piece = 0;
+    state->pieces_done = 0;
+    state->piece_bytes_read.resize(num_pieces, 0);
+
+    auto read_pieces = [this, state, position, nbytes, buffer, piece_size,
+                        num_pieces]() {
+      while (true) {
+        int64_t piece;
+        {
+          std::lock_guard<std::mutex> guard(state->mutex);
+          if (state->next_piece == num_pieces || !state->status.ok()) {
+            return;
+          }
+          piece = state->next_piece++;
+        }
+        const int64_t offset = piece * piece_size;
+        int64_t piece_read = 0;
+        Status st = PooledReadAt(position + offset,
+                                 std::min(piece_size, nbytes - offset), &piece_read,
+                                 buffer + offset);
+        std::lock_guard<std::mutex> guard(state->mutex);
+        state->piece_bytes_read[piece] = piece_read;
+        if (!st.ok() && state->status.ok()) {
+          state->status = st;
+        }
+        ++state->pieces_done;
+        state->cv.notify_all();
+      }
+    };
+
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    for (int64_t i = 1; i < num_pieces; ++i) {
+      RETURN_NOT_OK(pool->Spawn(read_pieces));
+    }
+    read_pieces();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&state]() { return state->pieces_done == state->next_piece; });
+    RETURN_NOT_OK(state->status);
+
+    // The pieces are contiguous up to the first short one, at the end of file
+    int64_t total_bytes = 0;
+    for (int64_t i = 0; i < num_pieces; ++i) {
+      total_bytes += state->piece_bytes_read[i];
+      if (state->piece_bytes_read[i] < std::min(piece_size, nbytes - i * piece_size)) {
+        break;
+      }
+    }
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  // Take a free handle from the pool, opening a new one if the pool is not
+  // full, otherwise waiting for one to be released
+  Status AcquireHandle(hdfsFile* out) {
+    std::unique_lock<std::mutex> lock(handles_lock_);
+    while (free_handles_.empty()) {
+      if (num_pooled_handles_ < options_.max_handles) {
+        ++num_pooled_handles_;
+        lock.unlock();
+        hdfsFile handle = driver_->OpenFile(fs_, path_.c_str(), O_RDONLY,
+                                            options_.buffer_size, 0, 0);
+        lock.lock();
+        if (handle == nullptr) {
+          --num_pooled_handles_;
+          handle_released_.notify_one();
+          std::stringstream ss;
+          ss << "HDFS: opening another handle to " << path_ << " failed";
+          return Status::IOError(ss.str());
+        }
+        all_pooled_handles_.push_back(handle);
+        *out = handle;
+        return Status::OK();
+      }
+      handle_released_.wait(lock);
+    }
+    *out = free_handles_.back();
+    free_handles_.pop_back();
+    return Status::OK();
+  }
+
+  void ReleaseHandle(hdfsFile handle) {
+    std::lock_guard<std::mutex> guard(handles_lock_);
+    free_handles_.push_back(handle);
+    handle_released_.notify_one();
+  }
+
+  Status AddReadStatistics(hdfsFile handle, HdfsReadStatistics* out) {
+    struct hdfsReadStatistics* stats = nullptr;
+    int ret = driver_->FileGetReadStatistics(handle, &stats);
+    CHECK_FAILURE(ret, "GetReadStatistics");
+    out->total_bytes_read += static_cast<int64_t>(stats->totalBytesRead);
+    out->local_bytes_read += static_cast<int64_t>(stats->totalLocalBytesRead);
+    out->short_circuit_bytes_read +=
+        static_cast<int64_t>(stats->totalShortCircuitBytesRead);
+    out->zero_copy_bytes_read += static_cast<int64_t>(stats->totalZeroCopyBytesRead);
+    driver_->FileFreeReadStatistics(stats);
+    return Status::OK();
+  }
+
   MemoryPool* pool_;
-  int32_t buffer_size_;
+  HdfsReadOptions options_;
+
+  // Handles for ReadAt, when options_.max_handles > 1
+  std::mutex handles_lock_;
+  std::condition_variable handle_released_;
+  std::vector<hdfsFile> free_handles_;
+  std::vector<hdfsFile> all_pooled_handles_;
+  int32_t num_pooled_handles_;
 };
 
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
@@ -213,26 +423,34 @@ Status HdfsReadableFile::Close() { return impl_->Close(); }
 
 Status HdfsReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* buffer) {
+  ARROW_TRACE_SPAN("io", "HdfsReadableFile::ReadAt");
   return impl_->ReadAt(position, nbytes, bytes_read, buffer);
 }
 
 Status HdfsReadableFile::ReadAt(int64_t position, int64_t nbytes,
                                 std::shared_ptr<Buffer>* out) {
+  ARROW_TRACE_SPAN("io", "HdfsReadableFile::ReadAt");
   return impl_->ReadAt(position, nbytes, out);
 }
 
 bool HdfsReadableFile::supports_zero_copy() const { return false; }
 
 Status HdfsReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* buffer) {
+  ARROW_TRACE_SPAN("io", "HdfsReadableFile::Read");
   return impl_->Read(nbytes, bytes_read, buffer);
 }
 
 Status HdfsReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* buffer) {
+  ARROW_TRACE_SPAN("io", "HdfsReadableFile::Read");
   return impl_->Read(nbytes, buffer);
 }
 
 Status HdfsReadableFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
 
+Status HdfsReadableFile::GetReadStatistics(HdfsReadStatistics* out) {
+  return impl_->GetReadStatistics(out);
+}
+
 Status HdfsReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
 
 Status HdfsReadableFile::Tell(int64_t* position) const { return impl_->Tell(position); }
@@ -278,6 +496,7 @@ HdfsOutputStream::~HdfsOutputStream() { DCHECK(impl_->Close().ok()); }
 Status HdfsOutputStream::Close() { return impl_->Close(); }
 
 Status HdfsOutputStream::Write(const void* buffer, int64_t nbytes, int64_t* bytes_read) {
+  ARROW_TRACE_SPAN("io", "HdfsOutputStream::Write");
   return impl_->Write(buffer, nbytes, bytes_read);
 }
 
@@ -323,6 +542,10 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       RETURN_NOT_OK(ConnectLibHdfs(&driver_));
     }
 
+    if (!config->extra_conf.empty() && !driver_->HasBuilderConfSetStr()) {
+      return Status::NotImplemented("HDFS driver does not support extra_conf");
+    }
+
     // connect to HDFS with the builder object
     hdfsBuilder* builder = driver_->NewBuilder();
     if (!config->host.empty()) {
@@ -335,6 +558,13 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     if (!config->kerb_ticket.empty()) {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
+    if (!config->extra_conf.empty()) {
+      for (const auto& kv : config->extra_conf) {
+        int ret =
+            driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
+        CHECK_FAILURE(ret, "confsetstr");
+      }
+    }
     driver_->BuilderSetForceNewInstance(builder);
     fs_ = driver_->BuilderConnect(builder);
 
@@ -450,9 +680,14 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     return Status::OK();
   }
 
-  Status OpenReadable(const std::string& path, int32_t buffer_size,
+  Status OpenReadable(const std::string& path, const HdfsReadOptions& options,
                       std::shared_ptr<HdfsReadableFile>* file) {
-    hdfsFile handle = driver_->OpenFile(fs_, path.c_str(), O_RDONLY, buffer_size, 0, 0);
+    if (options.buffer_size <= 0 || options.max_handles <= 0 ||
+        options.parallel_read_size <= 0) {
+      return Status::Invalid("HDFS read options must be positive");
+    }
+    hdfsFile handle =
+        driver_->OpenFile(fs_, path.c_str(), O_RDONLY, options.buffer_size, 0, 0);
 
     if (handle == nullptr) {
       std::stringstream ss;
@@ -468,7 +703,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     // std::make_shared does not work with private ctors
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
-    (*file)->impl_->set_buffer_size(buffer_size);
+    (*file)->impl_->set_options(options);
 
     return Status::OK();
   }
@@ -582,14 +817,37 @@ Status HadoopFileSystem::ListDirectory(const std::string& path,
   return impl_->ListDirectory(path, listing);
 }
 
+Status HadoopFileSystem::GetChildrenStats(const std::string& path,
+                                          std::vector<FileEntry>* listing) {
+  std::vector<HdfsPathInfo> detailed_listing;
+  RETURN_NOT_OK(impl_->ListDirectory(path, &detailed_listing));
+  listing->reserve(listing->size() + detailed_listing.size());
+  for (const auto& info : detailed_listing) {
+    FileEntry entry;
+    entry.path = info.name;
+    entry.stat.size = info.size;
+    entry.stat.kind = info.kind;
+    listing->push_back(std::move(entry));
+  }
+  return Status::OK();
+}
+
 Status HadoopFileSystem::OpenReadable(const std::string& path, int32_t buffer_size,
                                       std::shared_ptr<HdfsReadableFile>* file) {
-  return impl_->OpenReadable(path, buffer_size, file);
+  HdfsReadOptions options;
+  options.buffer_size = buffer_size;
+  return impl_->OpenReadable(path, options, file);
+}
+
+Status HadoopFileSystem::OpenReadable(const std::string& path,
+                                      std::shared_ptr<HdfsReadableFile>* file) {
+  return impl_->OpenReadable(path, HdfsReadOptions(), file);
 }
 
 Status HadoopFileSystem::OpenReadable(const std::string& path,
+                                      const HdfsReadOptions& options,
                                       std::shared_ptr<HdfsReadableFile>* file) {
-  return OpenReadable(path, kDefaultHdfsBufferSize, file);
+  return impl_->OpenReadable(path, options, file);
 }
 
 Status HadoopFileSystem::OpenWriteable(const std::string& path, bool append,
@@ -605,6 +863,22 @@ Status HadoopFileSystem::OpenWriteable(const std::string& path, bool append,
   return OpenWriteable(path, append, 0, 0, 0, file);
 }
 
+Status HadoopFileSystem::OpenInputFile(const std::string& path,
+                                       std::shared_ptr<RandomAccessFile>* file) {
+  std::shared_ptr<HdfsReadableFile> readable;
+  RETURN_NOT_OK(OpenReadable(path, &readable));
+  *file = readable;
+  return Status::OK();
+}
+
+Status HadoopFileSystem::OpenOutputStream(const std::string& path,
+                                          std::shared_ptr<OutputStream>* stream) {
+  std::shared_ptr<HdfsOutputStream> writeable;
+  RETURN_NOT_OK(OpenWriteable(path, false, &writeable));
+  *stream = writeable;
+  return Status::OK();
+}
+
 Status HadoopFileSystem::Chmod(const std::string& path, int mode) {
   return impl_->Chmod(path, mode);
 }
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
@@ -64,6 +65,37 @@ struct HdfsConnectionConfig {
   std::string user;
   std::string kerb_ticket;
   HdfsDriver driver;
+
+  /// Extra Hadoop client configuration. For example, short-circuit local
+  /// reads are enabled with "dfs.client.read.shortcircuit" set to "true" and
+  /// "dfs.domain.socket.path" set to the datanode socket
+  std::unordered_map<std::string, std::string> extra_conf;
+};
+
+struct ARROW_EXPORT HdfsReadOptions {
+  HdfsReadOptions() : buffer_size(1 << 16), max_handles(1), parallel_read_size(1 << 22) {}
+
+  /// Size of the read buffer of each handle, and of the reads made by Read
+  int32_t buffer_size;
+
+  /// Maximum number of handles opened for ReadAt, besides the one used by
+  /// Read, Seek and Tell. With more than one, concurrent ReadAt calls use
+  /// separate handles, each streaming from its own datanode, and large ReadAt
+  /// calls are split across handles. With one, ReadAt uses the Read handle
+  int32_t max_handles;
+
+  /// Minimum number of bytes read by each handle when a ReadAt call is split
+  int64_t parallel_read_size;
+};
+
+/// Bytes read from a file, by where they were read from
+struct HdfsReadStatistics {
+  int64_t total_bytes_read;
+  /// Bytes read from a datanode on the same host
+  int64_t local_bytes_read;
+  /// Local bytes read straight from the block files, bypassing the datanode
+  int64_t short_circuit_bytes_read;
+  int64_t zero_copy_bytes_read;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -118,6 +150,9 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
 
   Status ListDirectory(const std::string& path, std::vector<HdfsPathInfo>* listing);
 
+  Status GetChildrenStats(const std::string& path,
+                          std::vector<FileEntry>* listing) override;
+
   /// Change
   ///
   /// @param path file path to change
@@ -149,6 +184,9 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
 
   Status OpenReadable(const std::string& path, std::shared_ptr<HdfsReadableFile>* file);
 
+  Status OpenReadable(const std::string& path, const HdfsReadOptions& options,
+                      std::shared_ptr<HdfsReadableFile>* file);
+
   // FileMode::WRITE options
   // @param path complete file path
   // @param buffer_size, 0 for default
@@ -161,6 +199,12 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
   Status OpenWriteable(const std::string& path, bool append,
                        std::shared_ptr<HdfsOutputStream>* file);
 
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<RandomAccessFile>* file) override;
+
+  Status OpenOutputStream(const std::string& path,
+                          std::shared_ptr<OutputStream>* stream) override;
+
  private:
   friend class HdfsReadableFile;
   friend class HdfsOutputStream;
@@ -198,6 +242,11 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
 
   void set_memory_pool(MemoryPool* pool);
 
+  /// \brief Return the bytes read so far through all the handles of the file
+  ///
+  /// Returns NotImplemented if the driver does not keep read statistics
+  Status GetReadStatistics(HdfsReadStatistics* out);
+
  private:
   explicit HdfsReadableFile(MemoryPool* pool = NULLPTR);
 
@@ -0,0 +1,407 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/instrumented.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace io {
+
+// ----------------------------------------------------------------------
+// IoStatistics
+
+constexpr int IoCallStatistics::kNumLatencyBuckets;
+
+IoCallStatistics::IoCallStatistics()
+    : num_calls(0), bytes_requested(0), bytes_transferred(0), total_time_ns(0) {
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    latency_buckets[i] = 0;
+  }
+}
+
+int64_t IoCallStatistics::LatencyQuantile(double q) const {
+  int64_t total = 0;
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    total += latency_buckets[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  const int64_t target = std::max<int64_t>(
+      static_cast<int64_t>(std::ceil(q * static_cast<double>(total))), 1);
+  int64_t seen = 0;
+  int i = 0;
+  for (; i < kNumLatencyBuckets - 1; ++i) {
+    seen += latency_buckets[i];
+    if (seen >= target) {
+      break;
+    }
+  }
+  return (INT64_C(2) << i) * 1000;
+}
+
+static void PrintCallStatistics(const char* name, const IoCallStatistics& stats,
+                                std::ostream* out) {
+  *out << name << ": " << stats.num_calls << " calls, " << stats.bytes_transferred
+       << " of " << stats.bytes_requested << " bytes";
+  if (stats.num_calls > 0) {
+    *out << ", mean " << stats.total_time_ns / stats.num_calls / 1000 << " us"
+         << ", p50 <= " << stats.LatencyQuantile(0.5) / 1000 << " us"
+         << ", p99 <= " << stats.LatencyQuantile(0.99) / 1000 << " us";
+  }
+  *out << "\n";
+}
+
+std::string IoStatistics::ToString() const {
+  std::stringstream ss;
+  PrintCallStatistics("Read", reads, &ss);
+  PrintCallStatistics("ReadAt", read_ats, &ss);
+  PrintCallStatistics("Write", writes, &ss);
+  return ss.str();
+}
+
+// ----------------------------------------------------------------------
+// IoStatisticsCollector
+
+namespace {
+
+struct AtomicCallStatistics {
+  AtomicCallStatistics() { Reset(); }
+
+  void Reset() {
+    num_calls = 0;
+    bytes_requested = 0;
+    bytes_transferred = 0;
+    total_time_ns = 0;
+    for (auto& bucket : latency_buckets) {
+      bucket = 0;
+    }
+  }
+
+  void Record(int64_t requested, int64_t transferred, int64_t time_ns) {
+    num_calls.fetch_add(1, std::memory_order_relaxed);
+    bytes_requested.fetch_add(requested, std::memory_order_relaxed);
+    bytes_transferred.fetch_add(transferred, std::memory_order_relaxed);
+    total_time_ns.fetch_add(time_ns, std::memory_order_relaxed);
+    int bucket = 0;
+    for (int64_t us = time_ns / 1000;
+         us > 1 && bucket < IoCallStatistics::kNumLatencyBuckets - 1; us >>= 1) {
+      ++bucket;
+    }
+    latency_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  IoCallStatistics Load() const {
+    IoCallStatistics out;
+    out.num_calls = num_calls.load();
+    out.bytes_requested = bytes_requested.load();
+    out.bytes_transferred = bytes_transferred.load();
+    out.total_time_ns = total_time_ns.load();
+    for (int i = 0; i < IoCallStatistics::kNumLatencyBuckets; ++i) {
+      out.latency_buckets[i] = latency_buckets[i].load();
+    }
+    return out;
+  }
+
+  std::atomic<int64_t> num_calls;
+  std::atomic<int64_t> bytes_requested;
+  std::atomic<int64_t> bytes_transferred;
+  std::atomic<int64_t> total_time_ns;
+  std::atomic<int64_t> latency_buckets[IoCallStatistics::kNumLatencyBuckets];
+};
+
+// Time a call, recording it once the call has set the bytes transferred
+class CallTimer {
+ public:
+  CallTimer(IoStatisticsCollector* collector, IoStatisticsCollector::Call::type call,
+            int64_t bytes_requested)
+      : collector_(collector),
+        call_(call),
+        bytes_requested_(bytes_requested),
+        start_(std::chrono::steady_clock::now()) {}
+
+  void Finish(int64_t bytes_transferred) {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    collector_->Record(
+        call_, bytes_requested_, bytes_transferred,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+ private:
+  IoStatisticsCollector* collector_;
+  IoStatisticsCollector::Call::type call_;
+  int64_t bytes_requested_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+int64_t BufferSize(const Status& st, const std::shared_ptr<Buffer>& buffer) {
+  return st.ok() && buffer ? buffer->size() : 0;
+}
+
+std::shared_ptr<IoStatisticsCollector> GetCollector(
+    const std::shared_ptr<IoStatisticsCollector>& collector) {
+  return collector ? collector : std::make_shared<IoStatisticsCollector>();
+}
+
+}  // namespace
+
+class IoStatisticsCollector::Impl {
+ public:
+  AtomicCallStatistics calls[3];
+};
+
+IoStatisticsCollector::IoStatisticsCollector() : impl_(new Impl()) {}
+
+IoStatisticsCollector::~IoStatisticsCollector() {}
+
+void IoStatisticsCollector::Record(Call::type call, int64_t bytes_requested,
+                                   int64_t bytes_transferred, int64_t time_ns) {
+  impl_->calls[call].Record(bytes_requested, bytes_transferred, time_ns);
+}
+
+IoStatistics IoStatisticsCollector::statistics() const {
+  IoStatistics out;
+  out.reads = impl_->calls[Call::READ].Load();
+  out.read_ats = impl_->calls[Call::READ_AT].Load();
+  out.writes = impl_->calls[Call::WRITE].Load();
+  return out;
+}
+
+void IoStatisticsCollector::Reset() {
+  for (auto& call : impl_->calls) {
+    call.Reset();
+  }
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedRandomAccessFile
+
+using Call = IoStatisticsCollector::Call;
+
+InstrumentedRandomAccessFile::InstrumentedRandomAccessFile() {}
+
+InstrumentedRandomAccessFile::~InstrumentedRandomAccessFile() {}
+
+Status InstrumentedRandomAccessFile::Create(
+    const std::shared_ptr<RandomAccessFile>& raw,
+    const std::shared_ptr<IoStatisticsCollector>& collector,
+    std::shared_ptr<InstrumentedRandomAccessFile>* out) {
+  std::shared_ptr<InstrumentedRandomAccessFile> file(new InstrumentedRandomAccessFile());
+  file->raw_ = raw;
+  file->collector_ = GetCollector(collector);
+  *out = std::move(file);
+  return Status::OK();
+}
+
+std::shared_ptr<RandomAccessFile> InstrumentedRandomAccessFile::raw() const {
+  return raw_;
+}
+
+std::shared_ptr<IoStatisticsCollector> InstrumentedRandomAccessFile::collector() const {
+  return collector_;
+}
+
+IoStatistics InstrumentedRandomAccessFile::statistics() const {
+  return collector_->statistics();
+}
+
+Status InstrumentedRandomAccessFile::Close() { return raw_->Close(); }
+
+Status InstrumentedRandomAccessFile::Tell(int64_t* position) const {
+  return raw_->Tell(position);
+}
+
+Status InstrumentedRandomAccessFile::Seek(int64_t position) {
+  return raw_->Seek(position);
+}
+
+Status InstrumentedRandomAccessFile::GetSize(int64_t* size) {
+  return raw_->GetSize(size);
+}
+
+bool InstrumentedRandomAccessFile::supports_zero_copy() const {
+  return raw_->supports_zero_copy();
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, int64_t* bytes_read,
+                                          void* out) {
+  CallTimer timer(collector_.get(), Call::READ, nbytes);
+  Status st = raw_->Read(nbytes, bytes_read, out);
+  timer.Finish(st.ok() ? *bytes_read : 0);
+  return st;
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  CallTimer timer(collector_.get(), Call::READ, nbytes);
+  Status st = raw_->Read(nbytes, out);
+  timer.Finish(BufferSize(st, *out));
+  return st;
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            int64_t* bytes_read, void* out) {
+  CallTimer timer(collector_.get(), Call::READ_AT, nbytes);
+  Status st = raw_->ReadAt(position, nbytes, bytes_read, out);
+  timer.Finish(st.ok() ? *bytes_read : 0);
+  return st;
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            std::shared_ptr<Buffer>* out) {
+  CallTimer timer(collector_.get(), Call::READ_AT, nbytes);
+  Status st = raw_->ReadAt(position, nbytes, out);
+  timer.Finish(BufferSize(st, *out));
+  return st;
+}
+
+Status InstrumentedRandomAccessFile::ReadAsync(int64_t position, int64_t nbytes,
+                                               std::shared_ptr<Buffer>* out,
+                                               std::future<Status>* done) {
+  if (raw_->supports_zero_copy()) {
+    // Zero-copy reads complete right away, as in BufferReader
+    std::promise<Status> promise;
+    promise.set_value(ReadAt(position, nbytes, out));
+    *done = promise.get_future();
+    return Status::OK();
+  }
+  return RandomAccessFile::ReadAsync(position, nbytes, out, done);
+}
+
+Status InstrumentedRandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return raw_->WillNeed(ranges);
+}
+
+Status InstrumentedRandomAccessFile::AdviseAccessPattern(AccessPattern::type pattern) {
+  return raw_->AdviseAccessPattern(pattern);
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedInputStream
+
+InstrumentedInputStream::InstrumentedInputStream() {}
+
+InstrumentedInputStream::~InstrumentedInputStream() {}
+
+Status InstrumentedInputStream::Create(
+    const std::shared_ptr<InputStream>& raw,
+    const std::shared_ptr<IoStatisticsCollector>& collector,
+    std::shared_ptr<InstrumentedInputStream>* out) {
+  std::shared_ptr<InstrumentedInputStream> stream(new InstrumentedInputStream());
+  stream->raw_ = raw;
+  stream->collector_ = GetCollector(collector);
+  *out = std::move(stream);
+  return Status::OK();
+}
+
+std::shared_ptr<InputStream> InstrumentedInputStream::raw() const { return raw_; }
+
+std::shared_ptr<IoStatisticsCollector> InstrumentedInputStream::collector() const {
+  return collector_;
+}
+
+IoStatistics InstrumentedInputStream::statistics() const {
+  return collector_->statistics();
+}
+
+Status InstrumentedInputStream::Close() { return raw_->Close(); }
+
+Status InstrumentedInputStream::Tell(int64_t* position) const {
+  return raw_->Tell(position);
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  CallTimer timer(collector_.get(), Call::READ, nbytes);
+  Status st = raw_->Read(nbytes, bytes_read, out);
+  timer.Finish(st.ok() ? *bytes_read : 0);
+  return st;
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  CallTimer timer(collector_.get(), Call::READ, nbytes);
+  Status st = raw_->Read(nbytes, out);
+  timer.Finish(BufferSize(st, *out));
+  return st;
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedOutputStream
+
+InstrumentedOutputStream::InstrumentedOutputStream() {}
+
+InstrumentedOutputStream::~InstrumentedOutputStream() {}
+
+Status InstrumentedOutputStream::Create(
+    const std::shared_ptr<OutputStream>& raw,
+    const std::shared_ptr<IoStatisticsCollector>& collector,
+    std::shared_ptr<InstrumentedOutputStream>* out) {
+  std::shared_ptr<InstrumentedOutputStream> stream(new InstrumentedOutputStream());
+  stream->raw_ = raw;
+  stream->collector_ = GetCollector(collector);
+  *out = std::move(stream);
+  return Status::OK();
+}
+
+std::shared_ptr<OutputStream> InstrumentedOutputStream::raw() const { return raw_; }
+
+std::shared_ptr<IoStatisticsCollector> InstrumentedOutputStream::collector() const {
+  return collector_;
+}
+
+IoStatistics InstrumentedOutputStream::statistics() const {
+  return collector_->statistics();
+}
+
+Status InstrumentedOutputStream::Close() { return raw_->Close(); }
+
+Status InstrumentedOutputStream::Tell(int64_t* position) const {
+  return raw_->Tell(position);
+}
+
+Status InstrumentedOutputStream::Write(const void* data, int64_t nbytes) {
+  CallTimer timer(collector_.get(), Call::WRITE, nbytes);
+  Status st = raw_->Write(data, nbytes);
+  timer.Finish(st.ok() ? nbytes : 0);
+  return st;
+}
+
+Status InstrumentedOutputStream::Writev(const std::vector<WriteSlice>& slices) {
+  int64_t nbytes = 0;
+  for (const auto& slice : slices) {
+    nbytes += slice.nbytes;
+  }
+  CallTimer timer(collector_.get(), Call::WRITE, nbytes);
+  Status st = raw_->Writev(slices);
+  timer.Finish(st.ok() ? nbytes : 0);
+  return st;
+}
+
+Status InstrumentedOutputStream::Flush() { return raw_->Flush(); }
+
+}  // namespace io
+}  // namespace arrow
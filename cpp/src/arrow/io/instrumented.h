@@ -0,0 +1,235 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Statistics of the calls made to files and streams
+
+#ifndef ARROW_IO_INSTRUMENTED_H
+#define ARROW_IO_INSTRUMENTED_H
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief Totals of one kind of call to a file
+struct ARROW_EXPORT IoCallStatistics {
+  static constexpr int kNumLatencyBuckets = 32;
+
+  IoCallStatistics();
+
+  int64_t num_calls;
+  /// Bytes asked for by reads, or given to writes
+  int64_t bytes_requested;
+  /// Bytes actually read or written
+  int64_t bytes_transferred;
+  int64_t total_time_ns;
+  /// latency_buckets[i] counts the calls which took from 2^i to 2^(i+1)
+  /// microseconds, the first bucket also counting those under a microsecond
+  /// and the last one those of more than 2^31 microseconds
+  int64_t latency_buckets[kNumLatencyBuckets];
+
+  /// \brief Return an upper bound of the latency under which a fraction q of
+  /// the calls completed, in nanoseconds, or 0 if there were no calls
+  int64_t LatencyQuantile(double q) const;
+};
+
+/// \brief Statistics of the calls made to an instrumented file
+struct ARROW_EXPORT IoStatistics {
+  /// Sequential reads, i.e. Read
+  IoCallStatistics reads;
+  /// Positional reads, i.e. ReadAt and ReadAsync
+  IoCallStatistics read_ats;
+  IoCallStatistics writes;
+
+  std::string ToString() const;
+};
+
+/// \class IoStatisticsCollector
+/// \brief Thread-safe accumulator of IoStatistics, which may be shared by
+/// several instrumented files to add up their calls
+class ARROW_EXPORT IoStatisticsCollector {
+ public:
+  struct Call {
+    enum type { READ, READ_AT, WRITE };
+  };
+
+  IoStatisticsCollector();
+  ~IoStatisticsCollector();
+
+  /// \brief Add a call, without locking
+  void Record(Call::type call, int64_t bytes_requested, int64_t bytes_transferred,
+              int64_t time_ns);
+
+  /// \brief Return the totals so far. Calls recorded concurrently may be
+  /// partially counted
+  IoStatistics statistics() const;
+
+  void Reset();
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(IoStatisticsCollector);
+};
+
+/// \class InstrumentedRandomAccessFile
+/// \brief Count the reads of a file, their bytes and latencies
+///
+/// Only two clock reads and a few relaxed atomic additions are added to each
+/// call. ReadAsync is counted as a ReadAt once complete, which runs on the
+/// I/O thread pool unless the wrapped file supports zero-copy reads
+class ARROW_EXPORT InstrumentedRandomAccessFile : public RandomAccessFile {
+ public:
+  ~InstrumentedRandomAccessFile() override;
+
+  /// \brief Create a file counting the reads of the given one
+  ///
+  /// \param[in] raw the file to read from
+  /// \param[in] collector where to record the calls, a new collector if null
+  /// \param[out] out the created file
+  /// \return Status
+  static Status Create(const std::shared_ptr<RandomAccessFile>& raw,
+                       const std::shared_ptr<IoStatisticsCollector>& collector,
+                       std::shared_ptr<InstrumentedRandomAccessFile>* out);
+
+  /// The wrapped file
+  std::shared_ptr<RandomAccessFile> raw() const;
+
+  std::shared_ptr<IoStatisticsCollector> collector() const;
+
+  /// \brief Shorthand for collector()->statistics()
+  IoStatistics statistics() const;
+
+  // Implement the RandomAccessFile interface
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+  bool supports_zero_copy() const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  Status ReadAsync(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out,
+                   std::future<Status>* done) override;
+
+  /// Passed on to the wrapped file
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+  Status AdviseAccessPattern(AccessPattern::type pattern) override;
+
+ private:
+  InstrumentedRandomAccessFile();
+
+  std::shared_ptr<RandomAccessFile> raw_;
+  std::shared_ptr<IoStatisticsCollector> collector_;
+};
+
+/// \class InstrumentedInputStream
+/// \brief Count the reads of a stream, their bytes and latencies
+class ARROW_EXPORT InstrumentedInputStream : public InputStream {
+ public:
+  ~InstrumentedInputStream() override;
+
+  /// \brief Create a stream counting the reads of the given one
+  ///
+  /// \param[in] raw the stream to read from
+  /// \param[in] collector where to record the calls, a new collector if null
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(const std::shared_ptr<InputStream>& raw,
+                       const std::shared_ptr<IoStatisticsCollector>& collector,
+                       std::shared_ptr<InstrumentedInputStream>* out);
+
+  /// The wrapped stream
+  std::shared_ptr<InputStream> raw() const;
+
+  std::shared_ptr<IoStatisticsCollector> collector() const;
+
+  /// \brief Shorthand for collector()->statistics()
+  IoStatistics statistics() const;
+
+  // Implement the InputStream interface
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+ private:
+  InstrumentedInputStream();
+
+  std::shared_ptr<InputStream> raw_;
+  std::shared_ptr<IoStatisticsCollector> collector_;
+};
+
+/// \class InstrumentedOutputStream
+/// \brief Count the writes to a stream, their bytes and latencies
+class ARROW_EXPORT InstrumentedOutputStream : public OutputStream {
+ public:
+  ~InstrumentedOutputStream() override;
+
+  /// \brief Create a stream counting the writes to the given one
+  ///
+  /// \param[in] raw the stream to write to
+  /// \param[in] collector where to record the calls, a new collector if null
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(const std::shared_ptr<OutputStream>& raw,
+                       const std::shared_ptr<IoStatisticsCollector>& collector,
+                       std::shared_ptr<InstrumentedOutputStream>* out);
+
+  /// The wrapped stream
+  std::shared_ptr<OutputStream> raw() const;
+
+  std::shared_ptr<IoStatisticsCollector> collector() const;
+
+  /// \brief Shorthand for collector()->statistics()
+  IoStatistics statistics() const;
+
+  // Implement the OutputStream interface
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Write(const void* data, int64_t nbytes) override;
+  /// Counted as a single write of all the slices
+  Status Writev(const std::vector<WriteSlice>& slices) override;
+  Status Flush() override;
+
+ private:
+  InstrumentedOutputStream();
+
+  std::shared_ptr<OutputStream> raw_;
+  std::shared_ptr<IoStatisticsCollector> collector_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_INSTRUMENTED_H
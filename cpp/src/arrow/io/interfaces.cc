@@ -17,15 +17,134 @@
 
 #include "arrow/io/interfaces.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
 
+Status FileSystem::GetChildrenStats(const std::string& path,
+                                    std::vector<FileEntry>* listing) {
+  std::vector<std::string> children;
+  RETURN_NOT_OK(GetChildren(path, &children));
+  listing->reserve(listing->size() + children.size());
+  for (auto& child : children) {
+    FileEntry entry;
+    RETURN_NOT_OK(Stat(child, &entry.stat));
+    entry.path = std::move(child);
+    listing->push_back(std::move(entry));
+  }
+  return Status::OK();
+}
+
+namespace {
+
+// State shared by the threads listing a directory tree
+struct DirectoryWalk {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::string> pending;
+  std::vector<FileEntry> entries;
+  // Number of threads listing a directory, which may find more
+  int num_listing;
+  // Number of spawned workers that have not exited
+  int num_workers;
+  int max_workers;
+  Status status;
+};
+
+// List pending directories until there are none left. Returns without
+// waiting when the queue is empty, so that workers never block the I/O
+// thread pool
+void WalkDirectories(FileSystem* fs, const std::shared_ptr<DirectoryWalk>& walk) {
+  std::unique_lock<std::mutex> lock(walk->mutex);
+  while (!walk->pending.empty() && walk->status.ok()) {
+    std::string dir = std::move(walk->pending.front());
+    walk->pending.pop_front();
+    ++walk->num_listing;
+    lock.unlock();
+
+    std::vector<FileEntry> children;
+    Status st = fs->GetChildrenStats(dir, &children);
+
+    lock.lock();
+    --walk->num_listing;
+    walk->cv.notify_all();
+    if (!st.ok()) {
+      walk->status = st;
+      break;
+    }
+    for (auto& child : children) {
+      if (child.stat.kind == ObjectType::DIRECTORY) {
+        walk->pending.push_back(child.path);
+      }
+      walk->entries.push_back(std::move(child));
+    }
+    // Hand the new directories to more workers
+    while (walk->num_workers < walk->max_workers &&
+           walk->num_workers < static_cast<int>(walk->pending.size())) {
+      ++walk->num_workers;
+      Status spawn_st = ::arrow::internal::GetIOThreadPool()->Spawn([fs, walk]() {
+        WalkDirectories(fs, walk);
+        std::lock_guard<std::mutex> guard(walk->mutex);
+        --walk->num_workers;
+        walk->cv.notify_all();
+      });
+      if (!spawn_st.ok()) {
+        --walk->num_workers;
+        break;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+Status FileSystem::GetChildrenRecursive(const std::string& path,
+                                        std::vector<FileEntry>* listing) {
+  auto walk = std::make_shared<DirectoryWalk>();
+  walk->pending.push_back(path);
+  walk->num_listing = 0;
+  walk->num_workers = 0;
+  walk->max_workers = GetIOThreadPoolCapacity();
+
+  // The calling thread lists directories too, and only waits while others
+  // are listing, so that it never waits for a task that has not started
+  std::unique_lock<std::mutex> lock(walk->mutex);
+  while (true) {
+    if (!walk->pending.empty() && walk->status.ok()) {
+      lock.unlock();
+      WalkDirectories(this, walk);
+      lock.lock();
+    } else if (walk->num_listing == 0) {
+      break;
+    } else {
+      walk->cv.wait(lock);
+    }
+  }
+  RETURN_NOT_OK(walk->status);
+
+  std::sort(walk->entries.begin(), walk->entries.end(),
+            [](const FileEntry& left, const FileEntry& right) {
+              return left.path < right.path;
+            });
+  listing->reserve(listing->size() + walk->entries.size());
+  std::move(walk->entries.begin(), walk->entries.end(), std::back_inserter(*listing));
+  walk->entries.clear();
+  return Status::OK();
+}
+
 FileInterface::~FileInterface() = default;
 
 struct RandomAccessFile::RandomAccessFileImpl {
@@ -51,10 +170,34 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+Status RandomAccessFile::ReadAsync(int64_t position, int64_t nbytes,
+                                   std::shared_ptr<Buffer>* out,
+                                   std::future<Status>* done) {
+  return ::arrow::internal::GetIOThreadPool()->Submit(
+      done, [this, position, nbytes, out]() { return ReadAt(position, nbytes, out); });
+}
+
+Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return Status::OK();
+}
+
+Status RandomAccessFile::AdviseAccessPattern(AccessPattern::type pattern) {
+  return Status::OK();
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+Status Writable::Writev(const std::vector<WriteSlice>& slices) {
+  for (const auto& slice : slices) {
+    if (slice.nbytes != 0) {
+      RETURN_NOT_OK(Write(slice.data, slice.nbytes));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 }  // namespace io
@@ -19,6 +19,7 @@
 #define ARROW_IO_INTERFACES_H
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -47,20 +48,54 @@ struct ARROW_EXPORT FileStatistics {
   ObjectType::type kind;
 };
 
+/// A path with its statistics, as found in a directory
+struct ARROW_EXPORT FileEntry {
+  std::string path;
+  FileStatistics stat;
+};
+
+class OutputStream;
+class RandomAccessFile;
+
 class ARROW_EXPORT FileSystem {
  public:
   virtual ~FileSystem() = default;
 
+  /// Create a directory and its missing parents
   virtual Status MakeDirectory(const std::string& path) = 0;
 
+  /// Delete a directory and its contents
   virtual Status DeleteDirectory(const std::string& path) = 0;
 
+  /// List the paths of the children of a directory
   virtual Status GetChildren(const std::string& path,
                              std::vector<std::string>* listing) = 0;
 
   virtual Status Rename(const std::string& src, const std::string& dst) = 0;
 
   virtual Status Stat(const std::string& path, FileStatistics* stat) = 0;
+
+  /// Open a file for reading
+  virtual Status OpenInputFile(const std::string& path,
+                               std::shared_ptr<RandomAccessFile>* file) = 0;
+
+  /// Create a file, or truncate an existing one, and open it for writing
+  virtual Status OpenOutputStream(const std::string& path,
+                                  std::shared_ptr<OutputStream>* stream) = 0;
+
+  /// \brief List the children of a directory with their statistics
+  ///
+  /// The default implementation calls Stat for each child. File systems
+  /// which get the statistics with the listing should override it
+  virtual Status GetChildrenStats(const std::string& path,
+                                  std::vector<FileEntry>* listing);
+
+  /// \brief List all the files and directories under a directory
+  ///
+  /// The directories are listed in parallel on the I/O thread pool, so that
+  /// the latency of remote file systems is paid once per level of the tree
+  /// rather than once per directory. The entries are appended sorted by path
+  Status GetChildrenRecursive(const std::string& path, std::vector<FileEntry>* listing);
 };
 
 class ARROW_EXPORT FileInterface {
@@ -86,12 +121,35 @@ class ARROW_EXPORT Seekable {
   virtual Status Seek(int64_t position) = 0;
 };
 
+/// \brief How a file will be read, see RandomAccessFile::AdviseAccessPattern
+struct AccessPattern {
+  enum type { NORMAL, SEQUENTIAL, RANDOM };
+};
+
+/// \brief A range of bytes of a file to read
+struct ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief A region of memory to write, see Writable::Writev
+struct WriteSlice {
+  const void* data;
+  int64_t nbytes;
+};
+
 class ARROW_EXPORT Writable {
  public:
   virtual ~Writable() = default;
 
   virtual Status Write(const void* data, int64_t nbytes) = 0;
 
+  /// \brief Write the slices one after the other
+  ///
+  /// The default implementation writes them in turn. Outputs for which each
+  /// write is costly, such as files, gather them into fewer writes
+  virtual Status Writev(const std::vector<WriteSlice>& slices);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -152,6 +210,32 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   virtual Status ReadAt(int64_t position, int64_t nbytes,
                         std::shared_ptr<Buffer>* out) = 0;
 
+  /// \brief Start reading nbytes at position, without waiting for the read
+  ///
+  /// Many reads can be in flight at the same time, which hides the latency
+  /// of remote storage. The default implementation runs ReadAt on the I/O
+  /// thread pool; files that make no blocking calls complete it right away.
+  /// The file and out must outlive the returned future
+  ///
+  /// \param[in] position Where to read bytes from
+  /// \param[in] nbytes The number of bytes to read
+  /// \param[out] out The buffer read, set once done is ready
+  /// \param[out] done The status of the read
+  /// \return Status of issuing the read
+  virtual Status ReadAsync(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out,
+                           std::future<Status>* done);
+
+  /// \brief Hint that the ranges will be read soon
+  ///
+  /// Files backed by the OS page cache start bringing them in, so that the
+  /// first reads do not stall on page faults or disk reads. The default
+  /// implementation does nothing
+  virtual Status WillNeed(const std::vector<ReadRange>& ranges);
+
+  /// \brief Hint how the file will be read, tuning the OS read-ahead. The
+  /// default implementation does nothing
+  virtual Status AdviseAccessPattern(AccessPattern::type pattern);
+
  protected:
   RandomAccessFile();
 
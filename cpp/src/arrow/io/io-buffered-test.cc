@@ -0,0 +1,273 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/buffered.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<size_t>(buffer.size()));
+}
+
+// Counts the writes reaching a buffer
+class CountingOutputStream : public OutputStream {
+ public:
+  CountingOutputStream() : num_writes_(0) {
+    EXPECT_OK(BufferOutputStream::Create(0, default_memory_pool(), &sink_));
+  }
+
+  Status Close() override { return sink_->Close(); }
+  Status Tell(int64_t* position) const override { return sink_->Tell(position); }
+  Status Write(const void* data, int64_t nbytes) override {
+    ++num_writes_;
+    return sink_->Write(data, nbytes);
+  }
+
+  std::string contents() {
+    std::shared_ptr<Buffer> buffer;
+    EXPECT_OK(sink_->Finish(&buffer));
+    return AsString(*buffer);
+  }
+
+  int num_writes() const { return num_writes_; }
+
+ private:
+  std::shared_ptr<BufferOutputStream> sink_;
+  int num_writes_;
+};
+
+class TestBufferedOutputStream : public ::testing::Test {
+ public:
+  void SetUp() {
+    raw_ = std::make_shared<CountingOutputStream>();
+    ASSERT_OK(BufferedOutputStream::Create(raw_, 10, default_memory_pool(), &stream_));
+  }
+
+  Status WriteString(const std::string& data) {
+    return stream_->Write(data.data(), static_cast<int64_t>(data.size()));
+  }
+
+ protected:
+  std::shared_ptr<CountingOutputStream> raw_;
+  std::shared_ptr<BufferedOutputStream> stream_;
+};
+
+TEST_F(TestBufferedOutputStream, SmallWrites) {
+  int64_t position;
+  ASSERT_OK(WriteString("abc"));
+  ASSERT_OK(WriteString("defg"));
+  ASSERT_EQ(0, raw_->num_writes());
+  ASSERT_EQ(7, stream_->bytes_buffered());
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(7, position);
+
+  // Does not fit, the buffered bytes are written out first
+  ASSERT_OK(WriteString("hijk"));
+  ASSERT_EQ(1, raw_->num_writes());
+  ASSERT_EQ(4, stream_->bytes_buffered());
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(11, position);
+
+  ASSERT_OK(stream_->Flush());
+  ASSERT_EQ(2, raw_->num_writes());
+  ASSERT_EQ(0, stream_->bytes_buffered());
+
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ("abcdefghijk", raw_->contents());
+}
+
+TEST_F(TestBufferedOutputStream, LargeWritesPassThrough) {
+  ASSERT_OK(WriteString("ab"));
+  ASSERT_OK(WriteString("0123456789abcdef"));
+  ASSERT_EQ(2, raw_->num_writes());
+  ASSERT_EQ(0, stream_->bytes_buffered());
+
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ("ab0123456789abcdef", raw_->contents());
+}
+
+TEST_F(TestBufferedOutputStream, Writev) {
+  std::string data = "0123456789abcdef";
+  ASSERT_OK(stream_->Writev({{data.data(), 2}, {data.data() + 2, 3}}));
+  ASSERT_EQ(0, raw_->num_writes());
+
+  // Written out together with the buffered bytes
+  ASSERT_OK(stream_->Writev({{data.data() + 5, 6}, {data.data() + 11, 5}}));
+  ASSERT_EQ(0, stream_->bytes_buffered());
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(16, position);
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ(data, raw_->contents());
+}
+
+TEST_F(TestBufferedOutputStream, SetBufferSize) {
+  ASSERT_OK(WriteString("abcdef"));
+  ASSERT_OK(stream_->SetBufferSize(20));
+  ASSERT_EQ(20, stream_->buffer_size());
+  ASSERT_EQ(6, stream_->bytes_buffered());
+  ASSERT_OK(WriteString("0123456789"));
+  ASSERT_EQ(0, raw_->num_writes());
+
+  ASSERT_OK(stream_->SetBufferSize(4));
+  ASSERT_EQ(1, raw_->num_writes());
+  ASSERT_EQ(0, stream_->bytes_buffered());
+
+  ASSERT_RAISES(Invalid, stream_->SetBufferSize(0));
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ("abcdef0123456789", raw_->contents());
+}
+
+TEST_F(TestBufferedOutputStream, DetachAndClose) {
+  ASSERT_OK(WriteString("abc"));
+
+  std::shared_ptr<OutputStream> detached;
+  ASSERT_OK(stream_->Detach(&detached));
+  ASSERT_EQ(raw_.get(), detached.get());
+  ASSERT_EQ(1, raw_->num_writes());
+  ASSERT_RAISES(IOError, WriteString("def"));
+
+  // The wrapped stream is left open
+  ASSERT_OK(detached->Write(std::string("def")));
+  ASSERT_EQ("abcdef", raw_->contents());
+}
+
+TEST_F(TestBufferedOutputStream, DtorFlushes) {
+  ASSERT_OK(WriteString("abc"));
+  stream_.reset();
+  ASSERT_EQ("abc", raw_->contents());
+}
+
+class TestBufferedInputStream : public ::testing::Test {
+ public:
+  void MakeStream(int64_t buffer_size) {
+    data_ = "0123456789abcdefghijklmnopqrstuvwxyz";
+    raw_ = std::make_shared<BufferReader>(std::make_shared<Buffer>(data_));
+    ASSERT_OK(BufferedInputStream::Create(raw_, buffer_size, default_memory_pool(),
+                                          &stream_));
+  }
+
+  void AssertRead(int64_t nbytes, const std::string& expected) {
+    std::vector<char> out(nbytes);
+    int64_t bytes_read;
+    ASSERT_OK(stream_->Read(nbytes, &bytes_read, out.data()));
+    ASSERT_EQ(expected, std::string(out.data(), static_cast<size_t>(bytes_read)));
+  }
+
+  void AssertTell(int64_t expected) {
+    int64_t position;
+    ASSERT_OK(stream_->Tell(&position));
+    ASSERT_EQ(expected, position);
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<BufferReader> raw_;
+  std::shared_ptr<BufferedInputStream> stream_;
+};
+
+TEST_F(TestBufferedInputStream, SmallReads) {
+  MakeStream(10);
+
+  AssertRead(3, "012");
+  ASSERT_EQ(7, stream_->bytes_buffered());
+  AssertTell(3);
+
+  // Uses up the buffer, then refills it
+  AssertRead(9, "3456789ab");
+  ASSERT_EQ(8, stream_->bytes_buffered());
+  AssertTell(12);
+
+  int64_t raw_position;
+  ASSERT_OK(raw_->Tell(&raw_position));
+  ASSERT_EQ(20, raw_position);
+}
+
+TEST_F(TestBufferedInputStream, LargeReadsPassThrough) {
+  MakeStream(4);
+
+  AssertRead(1, "0");
+  AssertRead(20, "123456789abcdefghijk");
+  ASSERT_EQ(0, stream_->bytes_buffered());
+  AssertTell(21);
+
+  // Past the end of the stream
+  AssertRead(30, "lmnopqrstuvwxyz");
+  AssertRead(3, "");
+  AssertTell(36);
+}
+
+TEST_F(TestBufferedInputStream, Peek) {
+  MakeStream(8);
+
+  std::shared_ptr<Buffer> peeked;
+  ASSERT_OK(stream_->Peek(4, &peeked));
+  ASSERT_EQ("0123", AsString(*peeked));
+  AssertTell(0);
+
+  AssertRead(6, "012345");
+
+  // Larger than the buffer, which grows to hold it
+  ASSERT_OK(stream_->Peek(12, &peeked));
+  ASSERT_EQ("6789abcdefgh", AsString(*peeked));
+  ASSERT_EQ(12, stream_->bytes_buffered());
+  AssertTell(6);
+  AssertRead(14, "6789abcdefghij");
+
+  ASSERT_OK(stream_->Peek(100, &peeked));
+  ASSERT_EQ("klmnopqrstuvwxyz", AsString(*peeked));
+  ASSERT_EQ(8, stream_->buffer_size());
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(100, &buffer));
+  ASSERT_EQ("klmnopqrstuvwxyz", AsString(*buffer));
+  ASSERT_OK(stream_->Peek(1, &peeked));
+  ASSERT_EQ(0, peeked->size());
+}
+
+TEST_F(TestBufferedInputStream, Close) {
+  MakeStream(8);
+  ASSERT_OK(stream_->Close());
+  int64_t bytes_read;
+  char out;
+  ASSERT_RAISES(IOError, stream_->Read(1, &bytes_read, &out));
+
+  std::shared_ptr<Buffer> peeked;
+  ASSERT_RAISES(IOError, stream_->Peek(1, &peeked));
+  ASSERT_RAISES(Invalid, BufferedInputStream::Create(raw_, -1, default_memory_pool(),
+                                                    &stream_));
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/file.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+// Counts the reads of a buffer made through ReadAt
+class CountingFile : public RandomAccessFile {
+ public:
+  explicit CountingFile(const std::shared_ptr<Buffer>& buffer)
+      : reader_(buffer), num_reads_(0) {}
+
+  Status Close() override { return reader_.Close(); }
+  Status Tell(int64_t* position) const override { return reader_.Tell(position); }
+  Status Seek(int64_t position) override { return reader_.Seek(position); }
+  Status GetSize(int64_t* size) override { return reader_.GetSize(size); }
+  bool supports_zero_copy() const override { return true; }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    return Status::NotImplemented("Read");
+  }
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    return Status::NotImplemented("Read");
+  }
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override {
+    return Status::NotImplemented("copying ReadAt");
+  }
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads_;
+    return reader_.ReadAt(position, nbytes, out);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  BufferReader reader_;
+  std::atomic<int> num_reads_;
+};
+
+class TestCachedRandomAccessFile : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK(AllocateBuffer(default_memory_pool(), 10000, &data_));
+    test::random_bytes(data_->size(), 0, data_->mutable_data());
+    options_.block_size = 1000;
+  }
+
+  void MakeCache() { ASSERT_OK(BlockCache::Create(options_, &cache_)); }
+
+  void OpenFile(const std::string& path, std::shared_ptr<CachedRandomAccessFile>* out,
+                std::shared_ptr<Buffer> data = nullptr) {
+    raw_ = std::make_shared<CountingFile>(data ? data : data_);
+    ASSERT_OK(CachedRandomAccessFile::Create(raw_, path, cache_, out));
+  }
+
+  void AssertReadAt(const std::shared_ptr<RandomAccessFile>& file, int64_t position,
+                    int64_t nbytes) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(file->ReadAt(position, nbytes, &buffer));
+    const int64_t expected = std::min(nbytes, data_->size() - position);
+    ASSERT_EQ(expected, buffer->size());
+    ASSERT_EQ(0, memcmp(buffer->data(), data_->data() + position, expected));
+
+    std::vector<uint8_t> out(nbytes);
+    int64_t bytes_read;
+    ASSERT_OK(file->ReadAt(position, nbytes, &bytes_read, out.data()));
+    ASSERT_EQ(expected, bytes_read);
+    ASSERT_EQ(0, memcmp(out.data(), data_->data() + position, expected));
+  }
+
+ protected:
+  std::shared_ptr<Buffer> data_;
+  BlockCacheOptions options_;
+  std::shared_ptr<BlockCache> cache_;
+  std::shared_ptr<CountingFile> raw_;
+};
+
+TEST_F(TestCachedRandomAccessFile, ReadsAreCached) {
+  MakeCache();
+  std::shared_ptr<CachedRandomAccessFile> file;
+  OpenFile("data", &file);
+
+  AssertReadAt(file, 100, 50);
+  ASSERT_EQ(1, raw_->num_reads());
+  AssertReadAt(file, 900, 100);
+  ASSERT_EQ(1, raw_->num_reads());
+
+  // Consecutive missing blocks are read at once, around cached ones
+  AssertReadAt(file, 500, 3000);
+  ASSERT_EQ(2, raw_->num_reads());
+  AssertReadAt(file, 0, 20000);
+  ASSERT_EQ(3, raw_->num_reads());
+  AssertReadAt(file, 9999, 100);
+  AssertReadAt(file, 10000, 100);
+  ASSERT_EQ(3, raw_->num_reads());
+
+  BlockCacheStatistics stats = cache_->statistics();
+  ASSERT_EQ(10, stats.misses);
+  ASSERT_EQ(10000, stats.memory_bytes);
+  ASSERT_EQ(0, stats.disk_bytes);
+}
+
+TEST_F(TestCachedRandomAccessFile, ReadSeekTell) {
+  MakeCache();
+  std::shared_ptr<CachedRandomAccessFile> file;
+  OpenFile("data", &file);
+
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(10000, size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->Seek(1500));
+  ASSERT_OK(file->Read(1000, &buffer));
+  ASSERT_EQ(0, memcmp(buffer->data(), data_->data() + 1500, 1000));
+  int64_t position;
+  ASSERT_OK(file->Tell(&position));
+  ASSERT_EQ(2500, position);
+
+  std::vector<uint8_t> out(1000);
+  int64_t bytes_read;
+  ASSERT_OK(file->Seek(9500));
+  ASSERT_OK(file->Read(1000, &bytes_read, out.data()));
+  ASSERT_EQ(500, bytes_read);
+  ASSERT_EQ(0, memcmp(out.data(), data_->data() + 9500, 500));
+  ASSERT_OK(file->Read(1000, &bytes_read, out.data()));
+  ASSERT_EQ(0, bytes_read);
+
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 10, &buffer));
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(IOError, file->ReadAt(0, 10, &buffer));
+}
+
+TEST_F(TestCachedRandomAccessFile, SharedBetweenFiles) {
+  MakeCache();
+  std::shared_ptr<CachedRandomAccessFile> file1, file2;
+  OpenFile("data", &file1);
+  AssertReadAt(file1, 8000, 2000);
+
+  // The footer of the same file is cached for another reader
+  OpenFile("data", &file2);
+  AssertReadAt(file2, 9000, 1000);
+  ASSERT_EQ(0, raw_->num_reads());
+
+  // Another path, or the same one with another size, is another file
+  OpenFile("other", &file2);
+  AssertReadAt(file2, 9000, 1000);
+  ASSERT_EQ(1, raw_->num_reads());
+
+  std::shared_ptr<Buffer> shorter = SliceBuffer(data_, 0, 9500);
+  OpenFile("data", &file2, shorter);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file2->ReadAt(9000, 1000, &buffer));
+  ASSERT_EQ(500, buffer->size());
+  ASSERT_EQ(1, raw_->num_reads());
+}
+
+TEST_F(TestCachedRandomAccessFile, Eviction) {
+  options_.capacity = 2000;
+  MakeCache();
+  std::shared_ptr<CachedRandomAccessFile> file;
+  OpenFile("data", &file);
+
+  AssertReadAt(file, 0, 10);
+  AssertReadAt(file, 1000, 10);
+  AssertReadAt(file, 0, 10);
+  // Evicts the least recently used block, 1000-2000
+  AssertReadAt(file, 2000, 10);
+  ASSERT_EQ(3, raw_->num_reads());
+  AssertReadAt(file, 0, 10);
+  ASSERT_EQ(3, raw_->num_reads());
+  AssertReadAt(file, 1000, 10);
+  ASSERT_EQ(4, raw_->num_reads());
+  ASSERT_EQ(2000, cache_->statistics().memory_bytes);
+
+  ASSERT_OK(cache_->Clear());
+  ASSERT_EQ(0, cache_->statistics().memory_bytes);
+  AssertReadAt(file, 1000, 10);
+  ASSERT_EQ(5, raw_->num_reads());
+}
+
+TEST_F(TestCachedRandomAccessFile, SpillToDisk) {
+  const std::string directory = "arrow-test-io-caching-spill";
+  LocalFileSystem fs;
+  options_.capacity = 1000;
+  options_.disk_directory = directory;
+  options_.disk_capacity = 2000;
+  MakeCache();
+  std::shared_ptr<CachedRandomAccessFile> file;
+  OpenFile("data", &file);
+
+  AssertReadAt(file, 0, 10);
+  AssertReadAt(file, 1000, 10);
+  AssertReadAt(file, 2000, 10);
+  BlockCacheStatistics stats = cache_->statistics();
+  ASSERT_EQ(1000, stats.memory_bytes);
+  ASSERT_EQ(2000, stats.disk_bytes);
+  std::vector<std::string> listing;
+  ASSERT_OK(fs.GetChildren(directory, &listing));
+  ASSERT_EQ(2, listing.size());
+
+  // Served from disk, moving 2000-3000 out of memory
+  AssertReadAt(file, 0, 10);
+  ASSERT_EQ(3, raw_->num_reads());
+  ASSERT_EQ(1, cache_->statistics().disk_hits);
+
+  // Evicts 1000-2000, the oldest on disk
+  AssertReadAt(file, 3000, 10);
+  AssertReadAt(file, 1000, 10);
+  ASSERT_EQ(5, raw_->num_reads());
+
+  ASSERT_OK(cache_->Clear());
+  listing.clear();
+  ASSERT_OK(fs.GetChildren(directory, &listing));
+  ASSERT_EQ(0, listing.size());
+  ASSERT_OK(fs.DeleteDirectory(directory));
+}
+
+}  // namespace io
+}  // namespace arrow
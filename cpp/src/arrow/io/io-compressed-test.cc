@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace io {
+
+// Compressible data: random bytes from a small alphabet
+static std::vector<uint8_t> MakeData(int64_t size) {
+  std::vector<uint8_t> data(static_cast<size_t>(size));
+  test::random_bytes(size, 42, data.data());
+  for (auto& byte : data) {
+    byte = static_cast<uint8_t>('a' + byte % 16);
+  }
+  return data;
+}
+
+static Status Compress(Codec* codec, const std::vector<uint8_t>& data,
+                       int64_t write_size, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<BufferOutputStream> sink;
+  RETURN_NOT_OK(BufferOutputStream::Create(0, default_memory_pool(), &sink));
+  std::shared_ptr<CompressedOutputStream> stream;
+  RETURN_NOT_OK(
+      CompressedOutputStream::Create(codec, sink, default_memory_pool(), &stream));
+  const int64_t size = static_cast<int64_t>(data.size());
+  for (int64_t pos = 0; pos < size; pos += write_size) {
+    RETURN_NOT_OK(stream->Write(data.data() + pos, std::min(write_size, size - pos)));
+  }
+  int64_t position = -1;
+  RETURN_NOT_OK(stream->Tell(&position));
+  EXPECT_EQ(size, position);
+  RETURN_NOT_OK(stream->Close());
+  return sink->Finish(out);
+}
+
+static void CheckDecompress(Codec* codec, const std::shared_ptr<Buffer>& compressed,
+                            const std::vector<uint8_t>& data, int64_t read_size) {
+  std::shared_ptr<CompressedInputStream> stream;
+  ASSERT_OK(CompressedInputStream::Create(
+      codec, std::make_shared<BufferReader>(compressed), default_memory_pool(), &stream));
+  std::vector<uint8_t> decompressed;
+  std::shared_ptr<Buffer> chunk;
+  do {
+    ASSERT_OK(stream->Read(read_size, &chunk));
+    decompressed.insert(decompressed.end(), chunk->data(),
+                        chunk->data() + chunk->size());
+  } while (chunk->size() > 0);
+  ASSERT_EQ(data, decompressed);
+
+  int64_t position = -1;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), position);
+  ASSERT_OK(stream->Close());
+}
+
+class TestCompressedStreams : public ::testing::TestWithParam<Compression::type> {
+ public:
+  void SetUp() { ASSERT_OK(Codec::Create(GetParam(), &codec_)); }
+
+ protected:
+  std::unique_ptr<Codec> codec_;
+};
+
+TEST_P(TestCompressedStreams, Roundtrip) {
+  for (int64_t size : {0, 1, 1000, 1 << 20}) {
+    auto data = MakeData(size);
+    std::shared_ptr<Buffer> compressed;
+    ASSERT_OK(Compress(codec_.get(), data, 1 << 20, &compressed));
+    if (size == 1 << 20) {
+      ASSERT_LT(compressed->size(), size);
+    }
+    CheckDecompress(codec_.get(), compressed, data, 1 << 20);
+  }
+}
+
+TEST_P(TestCompressedStreams, SmallWritesAndReads) {
+  auto data = MakeData(200000);
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(Compress(codec_.get(), data, 7, &compressed));
+  CheckDecompress(codec_.get(), compressed, data, 13);
+  CheckDecompress(codec_.get(), compressed, data, 100000);
+}
+
+TEST_P(TestCompressedStreams, Flush) {
+  auto data = MakeData(1000);
+  std::shared_ptr<ResizableBuffer> sink_buffer;
+  ASSERT_OK(AllocateResizableBuffer(default_memory_pool(), 0, &sink_buffer));
+  auto sink = std::make_shared<BufferOutputStream>(sink_buffer);
+  std::shared_ptr<CompressedOutputStream> stream;
+  ASSERT_OK(
+      CompressedOutputStream::Create(codec_.get(), sink, default_memory_pool(), &stream));
+  ASSERT_OK(stream->Write(data.data(), 500));
+
+  // After a flush, the bytes written so far can be decompressed
+  ASSERT_OK(stream->Flush());
+  int64_t flushed_size = -1;
+  ASSERT_OK(sink->Tell(&flushed_size));
+  ASSERT_GT(flushed_size, 0);
+  std::shared_ptr<CompressedInputStream> reader;
+  ASSERT_OK(CompressedInputStream::Create(
+      codec_.get(),
+      std::make_shared<BufferReader>(sink_buffer->data(), flushed_size),
+      default_memory_pool(), &reader));
+  std::vector<uint8_t> decompressed(500);
+  int64_t bytes_read = 0;
+  ASSERT_OK(reader->Read(500, &bytes_read, decompressed.data()));
+  ASSERT_EQ(500, bytes_read);
+  ASSERT_EQ(std::vector<uint8_t>(data.begin(), data.begin() + 500), decompressed);
+
+  ASSERT_OK(stream->Write(data.data() + 500, 500));
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(IOError, stream->Write(data.data(), 1));
+
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(sink->Finish(&compressed));
+  CheckDecompress(codec_.get(), compressed, data, 1000);
+}
+
+TEST_P(TestCompressedStreams, ConcatenatedStreams) {
+  auto data = MakeData(100000);
+  std::shared_ptr<Buffer> first, second;
+  ASSERT_OK(Compress(codec_.get(), data, 30000, &first));
+  ASSERT_OK(Compress(codec_.get(), data, 30000, &second));
+
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), first->size() + second->size(),
+                           &concatenated));
+  memcpy(concatenated->mutable_data(), first->data(), first->size());
+  memcpy(concatenated->mutable_data() + first->size(), second->data(), second->size());
+
+  std::vector<uint8_t> expected(data);
+  expected.insert(expected.end(), data.begin(), data.end());
+  CheckDecompress(codec_.get(), concatenated, expected, 4096);
+}
+
+TEST_P(TestCompressedStreams, TruncatedStream) {
+  auto data = MakeData(100000);
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(Compress(codec_.get(), data, 100000, &compressed));
+
+  std::shared_ptr<CompressedInputStream> stream;
+  ASSERT_OK(CompressedInputStream::Create(
+      codec_.get(),
+      std::make_shared<BufferReader>(SliceBuffer(compressed, 0, compressed->size() - 4)),
+      default_memory_pool(), &stream));
+  std::shared_ptr<Buffer> out;
+  ASSERT_RAISES(IOError, stream->Read(200000, &out));
+}
+
+INSTANTIATE_TEST_CASE_P(Codecs, TestCompressedStreams,
+                        ::testing::Values(Compression::GZIP, Compression::BROTLI,
+                                          Compression::ZSTD));
+
+TEST(TestCompressedStreamCodecs, BlockCodecs) {
+  std::unique_ptr<Codec> codec;
+  ASSERT_OK(Codec::Create(Compression::LZ4, &codec));
+  std::shared_ptr<BufferOutputStream> sink;
+  ASSERT_OK(BufferOutputStream::Create(0, default_memory_pool(), &sink));
+  std::shared_ptr<CompressedOutputStream> stream;
+  ASSERT_RAISES(NotImplemented, CompressedOutputStream::Create(
+                                    codec.get(), sink, default_memory_pool(), &stream));
+}
+
+}  // namespace io
+}  // namespace arrow
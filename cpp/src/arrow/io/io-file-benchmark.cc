@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/api.h"
+#include "arrow/io/file.h"
+#include "arrow/test-util.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arrow {
+namespace io {
+
+static constexpr int64_t kFileSize = 64 * 1024 * 1024;  // 64MB
+static constexpr int64_t kRangeSize = 64 * 1024;        // 64KB
+static constexpr int kNumRanges = 256;
+
+static const char* kBenchmarkPath = "arrow-io-file-benchmark.bin";
+
+// A file of random bytes, and random ranges of it aligned for direct reads
+static std::vector<ReadRange> MakeBenchmarkFile() {
+  std::vector<uint8_t> data(kFileSize);
+  test::random_bytes(kFileSize, 0, data.data());
+  std::ofstream stream(kBenchmarkPath, std::ios::binary);
+  stream.write(reinterpret_cast<const char*>(data.data()), kFileSize);
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int64_t> dist(0, (kFileSize - kRangeSize) / 4096);
+  std::vector<ReadRange> ranges;
+  for (int i = 0; i < kNumRanges; ++i) {
+    ranges.push_back({dist(gen) * 4096, kRangeSize});
+  }
+  return ranges;
+}
+
+static void BM_ReadableFileReadAt(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<ReadRange> ranges = MakeBenchmarkFile();
+  std::shared_ptr<ReadableFile> file;
+  ABORT_NOT_OK(ReadableFile::Open(kBenchmarkPath, &file));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<Buffer> buffer;
+    for (const ReadRange& range : ranges) {
+      ABORT_NOT_OK(file->ReadAt(range.offset, range.length, &buffer));
+    }
+  }
+  ABORT_NOT_OK(file->Close());
+  std::remove(kBenchmarkPath);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kNumRanges * kRangeSize);
+}
+
+// The reads are spread over the I/O thread pool
+static void BM_ReadableFileReadAsync(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<ReadRange> ranges = MakeBenchmarkFile();
+  std::shared_ptr<ReadableFile> file;
+  ABORT_NOT_OK(ReadableFile::Open(kBenchmarkPath, &file));
+
+  while (state.KeepRunning()) {
+    std::vector<std::shared_ptr<Buffer>> buffers(kNumRanges);
+    std::vector<std::future<Status>> reads(kNumRanges);
+    for (int i = 0; i < kNumRanges; ++i) {
+      ABORT_NOT_OK(
+          file->ReadAsync(ranges[i].offset, ranges[i].length, &buffers[i], &reads[i]));
+    }
+    for (auto& read : reads) {
+      ABORT_NOT_OK(read.get());
+    }
+  }
+  ABORT_NOT_OK(file->Close());
+  std::remove(kBenchmarkPath);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kNumRanges * kRangeSize);
+}
+
+// state.range(0) is the queue depth and state.range(1) whether the reads
+// bypass the page cache
+static void BM_UringReadRanges(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<ReadRange> ranges = MakeBenchmarkFile();
+  UringOptions options;
+  options.queue_depth = static_cast<int32_t>(state.range(0));
+  options.direct_io = state.range(1) != 0;
+  options.registered_buffer_size = kNumRanges * kRangeSize;
+  std::shared_ptr<UringReadableFile> file;
+  Status st = UringReadableFile::Open(kBenchmarkPath, options, default_memory_pool(),
+                                      &file);
+  if (st.IsNotImplemented()) {
+    std::remove(kBenchmarkPath);
+    state.SkipWithError(st.message().c_str());
+    return;
+  }
+  ABORT_NOT_OK(st);
+
+  while (state.KeepRunning()) {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    ABORT_NOT_OK(file->ReadRanges(ranges, &buffers));
+  }
+  ABORT_NOT_OK(file->Close());
+  std::remove(kBenchmarkPath);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kNumRanges * kRangeSize);
+}
+
+BENCHMARK(BM_ReadableFileReadAt)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_ReadableFileReadAsync)->MinTime(1.0)->UseRealTime();
+
+BENCHMARK(BM_UringReadRanges)
+    ->Args({8, 0})
+    ->Args({64, 0})
+    ->Args({64, 1})
+    ->MinTime(1.0)
+    ->UseRealTime();
+
+}  // namespace io
+}  // namespace arrow
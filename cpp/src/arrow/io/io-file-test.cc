@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <cstdint>
@@ -22,6 +23,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>  // IWYU pragma: keep
+#include <future>
 #include <memory>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
@@ -205,6 +207,40 @@ TEST_F(TestFileOutputStream, Tell) {
   ASSERT_EQ(8, position);
 }
 
+TEST_F(TestFileOutputStream, Writev) {
+  OpenFile();
+
+  const std::string data = "testdata";
+  std::vector<WriteSlice> slices;
+  for (size_t i = 0; i < data.size(); ++i) {
+    slices.push_back({data.data() + i, 1});
+    // Empty slices are skipped
+    slices.push_back({data.data(), 0});
+  }
+  // More slices than a single writev call accepts
+  const std::string long_data(5000, 'x');
+  for (size_t i = 0; i < long_data.size(); ++i) {
+    slices.push_back({long_data.data() + i, 1});
+  }
+  ASSERT_OK(file_->Writev(slices));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size() + long_data.size()), position);
+  ASSERT_OK(file_->Close());
+
+  std::shared_ptr<ReadableFile> rd_file;
+  ASSERT_OK(ReadableFile::Open(path_, &rd_file));
+  std::shared_ptr<Buffer> contents;
+  ASSERT_OK(rd_file->Read(position, &contents));
+  ASSERT_EQ(data + long_data,
+            std::string(reinterpret_cast<const char*>(contents->data()),
+                        static_cast<size_t>(contents->size())));
+
+  OpenFile();
+  ASSERT_RAISES(IOError, file_->Writev({{data.data(), -1}}));
+}
+
 TEST_F(TestFileOutputStream, TruncatesNewFile) {
   ASSERT_OK(FileOutputStream::Open(path_, &file_));
 
@@ -457,6 +493,253 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+TEST_F(TestReadableFile, ConcurrentReadAt) {
+  // Every thread reads its own ranges of the file, so that the reads only
+  // come out right if they do not share the file position
+  const int kNumThreads = 4;
+  const int64_t kChunkSize = 1000;
+  std::string data;
+  for (int64_t i = 0; i < kNumThreads * kChunkSize; ++i) {
+    data.push_back(static_cast<char>('a' + i % 23));
+  }
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+  }
+  OpenFile();
+
+  std::atomic<int> correct_count(0);
+  const int niter = 1000;
+
+  auto ReadChunk = [&](int chunk) {
+    uint8_t buffer[kChunkSize];
+    for (int i = 0; i < niter; ++i) {
+      // Vary the offset into the chunk to interleave the threads more
+      const int64_t offset = i % 100;
+      int64_t bytes_read;
+      ASSERT_OK(file_->ReadAt(chunk * kChunkSize + offset, kChunkSize - offset,
+                              &bytes_read, buffer));
+      if (bytes_read == kChunkSize - offset &&
+          0 == memcmp(data.c_str() + chunk * kChunkSize + offset, buffer, bytes_read)) {
+        correct_count += 1;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back(ReadChunk, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(niter * kNumThreads, correct_count);
+}
+
+TEST_F(TestReadableFile, AccessHints) {
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK(file_->WillNeed({{0, 4}, {2, 100}, {0, 0}}));
+  ASSERT_RAISES(Invalid, file_->WillNeed({{0, -1}}));
+  ASSERT_OK(file_->AdviseAccessPattern(AccessPattern::SEQUENTIAL));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(0, 8, &buffer));
+  ASSERT_EQ(0, memcmp(buffer->data(), "testdata", 8));
+}
+
+TEST_F(TestReadableFile, ReadAsync) {
+  const int kNumReads = 50;
+  const int64_t kChunkSize = 100;
+  std::string data;
+  for (int64_t i = 0; i < kNumReads * kChunkSize; ++i) {
+    data.push_back(static_cast<char>('a' + i % 23));
+  }
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str());
+    stream << data;
+  }
+  OpenFile();
+
+  // All the reads are issued before waiting for any of them
+  std::vector<std::shared_ptr<Buffer>> buffers(kNumReads);
+  std::vector<std::future<Status>> reads(kNumReads);
+  for (int i = 0; i < kNumReads; ++i) {
+    ASSERT_OK(file_->ReadAsync(i * kChunkSize, kChunkSize, &buffers[i], &reads[i]));
+  }
+  for (int i = 0; i < kNumReads; ++i) {
+    ASSERT_OK(reads[i].get());
+    ASSERT_EQ(kChunkSize, buffers[i]->size());
+    ASSERT_EQ(0, memcmp(data.c_str() + i * kChunkSize, buffers[i]->data(), kChunkSize));
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  std::future<Status> read;
+  ASSERT_OK(file_->ReadAsync(data.size() - 10, 100, &buffer, &read));
+  ASSERT_OK(read.get());
+  ASSERT_EQ(10, buffer->size());
+}
+
+// ----------------------------------------------------------------------
+// io_uring tests
+
+class TestUringFile : public FileTestFixture {
+ public:
+  void SetUp() {
+    FileTestFixture::SetUp();
+    const int64_t kSize = 30000;
+    data_.resize(kSize);
+    test::random_bytes(kSize, 0, reinterpret_cast<uint8_t*>(&data_[0]));
+  }
+
+  void MakeTestFile() {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data_;
+  }
+
+  // Whether io_uring is built and allowed by the kernel
+  bool OpenFile(const UringOptions& options) {
+    Status st = UringReadableFile::Open(path_, options, default_memory_pool(), &file_);
+    if (st.IsNotImplemented()) {
+      return false;
+    }
+    EXPECT_OK(st);
+    return st.ok();
+  }
+
+  void AssertRange(const ReadRange& range, const Buffer& buffer) {
+    const int64_t offset = std::min<int64_t>(range.offset, data_.size());
+    const int64_t length = std::min<int64_t>(range.length, data_.size() - offset);
+    ASSERT_EQ(length, buffer.size());
+    ASSERT_EQ(0, memcmp(data_.data() + offset, buffer.data(), length));
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<UringReadableFile> file_;
+};
+
+TEST_F(TestUringFile, ReadRanges) {
+  MakeTestFile();
+
+  std::vector<ReadRange> ranges = {{0, 100},     {5000, 12000}, {17, 0},
+                                   {4096, 4096}, {29990, 100},  {40000, 10},
+                                   {123, 4567},  {9999, 1}};
+  for (bool direct_io : {false, true}) {
+    for (int64_t registered_buffer_size : {0, 16384}) {
+      UringOptions options;
+      options.queue_depth = 4;
+      options.direct_io = direct_io;
+      options.registered_buffer_size = registered_buffer_size;
+      if (!OpenFile(options)) {
+        return;
+      }
+
+      // Twice, so that the registered region is used up and replaced
+      for (int i = 0; i < 2; ++i) {
+        std::vector<std::shared_ptr<Buffer>> buffers;
+        ASSERT_OK(file_->ReadRanges(ranges, &buffers));
+        ASSERT_EQ(ranges.size(), buffers.size());
+        for (size_t j = 0; j < ranges.size(); ++j) {
+          AssertRange(ranges[j], *buffers[j]);
+        }
+      }
+      ASSERT_OK(file_->Close());
+    }
+  }
+}
+
+TEST_F(TestUringFile, Reads) {
+  MakeTestFile();
+  if (!OpenFile(UringOptions())) {
+    return;
+  }
+
+  int64_t size;
+  ASSERT_OK(file_->GetSize(&size));
+  ASSERT_EQ(static_cast<int64_t>(data_.size()), size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Read(1000, &buffer));
+  AssertRange({0, 1000}, *buffer);
+
+  std::vector<uint8_t> out(2000);
+  int64_t bytes_read;
+  ASSERT_OK(file_->Read(2000, &bytes_read, out.data()));
+  ASSERT_EQ(2000, bytes_read);
+  ASSERT_EQ(0, memcmp(data_.data() + 1000, out.data(), 2000));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(3000, position);
+
+  ASSERT_OK(file_->Seek(29000));
+  ASSERT_OK(file_->Read(2000, &buffer));
+  AssertRange({29000, 2000}, *buffer);
+  ASSERT_OK(file_->Read(2000, &buffer));
+  ASSERT_EQ(0, buffer->size());
+
+  // ReadAt leaves the position unchanged
+  ASSERT_OK(file_->ReadAt(10, 20, &bytes_read, out.data()));
+  ASSERT_EQ(20, bytes_read);
+  ASSERT_EQ(0, memcmp(data_.data() + 10, out.data(), 20));
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(30000, position);
+
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 20, &buffer));
+  ASSERT_RAISES(Invalid, file_->Seek(-1));
+  ASSERT_OK(file_->Close());
+}
+
+TEST_F(TestUringFile, InvalidOptions) {
+  MakeTestFile();
+  UringOptions options;
+  options.queue_depth = 0;
+  ASSERT_RAISES(Invalid,
+                UringReadableFile::Open(path_, options, default_memory_pool(), &file_));
+}
+
+TEST_F(TestUringFile, OutputStream) {
+  UringOptions options;
+  options.queue_depth = 2;
+  std::shared_ptr<UringFileOutputStream> stream;
+  Status st = UringFileOutputStream::Open(path_, false, options, &stream);
+  if (st.IsNotImplemented()) {
+    return;
+  }
+  ASSERT_OK(st);
+
+  // More slices than the ring holds
+  std::vector<WriteSlice> slices;
+  for (int64_t offset = 0; offset < 20000; offset += 2500) {
+    slices.push_back({data_.data() + offset, 2500});
+  }
+  slices.push_back({data_.data(), 0});
+  ASSERT_OK(stream->Writev(slices));
+  ASSERT_OK(stream->Write(data_.data() + 20000, 5000));
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(25000, position);
+  ASSERT_OK(stream->Close());
+
+  ASSERT_OK(UringFileOutputStream::Open(path_, true, options, &stream));
+  ASSERT_OK(stream->Write(data_.data() + 25000, 5000));
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(30000, position);
+  ASSERT_OK(stream->Close());
+
+  std::shared_ptr<ReadableFile> file;
+  ASSERT_OK(ReadableFile::Open(path_, &file));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->Read(40000, &buffer));
+  ASSERT_EQ(data_, std::string(reinterpret_cast<const char*>(buffer->data()),
+                               static_cast<size_t>(buffer->size())));
+}
+
 // ----------------------------------------------------------------------
 // Memory map tests
 
@@ -477,6 +760,130 @@ TEST_F(TestMemoryMappedFile, ZeroSizeFlie) {
   ASSERT_EQ(0, size);
 }
 
+TEST_F(TestMemoryMappedFile, Growable) {
+  const int64_t chunk_size = 300000;
+  std::vector<uint8_t> buffer(chunk_size);
+  test::random_bytes(chunk_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-growable";
+  AppendFile(path);
+  std::shared_ptr<MemoryMappedFile> file;
+  ASSERT_RAISES(Invalid, MemoryMappedFile::CreateGrowable(path, 0, &file));
+  ASSERT_OK(MemoryMappedFile::CreateGrowable(path, 20 * chunk_size, &file));
+
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(0, size);
+
+  // The buffers read stay valid as the mapping grows past them
+  std::vector<std::shared_ptr<Buffer>> chunks;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(file->Write(buffer.data(), chunk_size));
+    std::shared_ptr<Buffer> chunk;
+    ASSERT_OK(file->ReadAt(i * chunk_size, chunk_size, &chunk));
+    chunks.push_back(chunk);
+  }
+  for (const auto& chunk : chunks) {
+    ASSERT_EQ(chunk_size, chunk->size());
+    ASSERT_EQ(0, memcmp(chunk->data(), buffer.data(), chunk_size));
+  }
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(10 * chunk_size, size);
+
+  ASSERT_OK(file->WriteAt(1, buffer.data(), 10));
+  ASSERT_EQ(0, memcmp(chunks[0]->data() + 1, buffer.data(), 10));
+  ASSERT_RAISES(Invalid, file->WriteAt(19 * chunk_size, buffer.data(), chunk_size + 1));
+
+  // Closing cuts the file down to the bytes written
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(IOError, file->Write(buffer.data(), 10));
+  ASSERT_EQ(0, memcmp(chunks[9]->data(), buffer.data(), chunk_size));
+
+  std::shared_ptr<ReadableFile> reader;
+  ASSERT_OK(ReadableFile::Open(path, &reader));
+  ASSERT_OK(reader->GetSize(&size));
+  ASSERT_EQ(10 * chunk_size, size);
+}
+
+TEST_F(TestMemoryMappedFile, ConcurrentReadAt) {
+  const int64_t chunk_size = 100000;
+  const int num_chunks = 40;
+  std::vector<uint8_t> buffer(chunk_size);
+  for (int64_t i = 0; i < chunk_size; ++i) {
+    buffer[i] = static_cast<uint8_t>(i % 251);
+  }
+
+  std::string path = "io-memory-map-concurrent-read-at";
+  AppendFile(path);
+  std::shared_ptr<MemoryMappedFile> file;
+  ASSERT_OK(MemoryMappedFile::CreateGrowable(path, num_chunks * chunk_size, &file));
+
+  // The readers slice what is written so far while the mapping grows
+  std::atomic<bool> done(false);
+  std::atomic<int> num_errors(0);
+  auto ReadChunks = [&](int seed) {
+    int64_t offset = seed;
+    while (!done) {
+      int64_t size;
+      ASSERT_OK(file->GetSize(&size));
+      if (size < chunk_size) {
+        continue;
+      }
+      offset = (offset * 7919 + 17) % (size - 1000);
+      std::shared_ptr<Buffer> slice;
+      ASSERT_OK(file->ReadAt(offset, 1000, &slice));
+      for (int64_t i = 0; i < slice->size(); ++i) {
+        if (slice->data()[i] != static_cast<uint8_t>((offset + i) % chunk_size % 251)) {
+          ++num_errors;
+          break;
+        }
+      }
+    }
+  };
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back(ReadChunks, i);
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    ASSERT_OK(file->Write(buffer.data(), chunk_size));
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  ASSERT_EQ(0, num_errors);
+  ASSERT_OK(file->Close());
+}
+
+TEST_F(TestMemoryMappedFile, AccessHints) {
+  const int64_t buffer_size = 100000;
+  std::vector<uint8_t> buffer(buffer_size);
+  test::random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-access-hints";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+
+  // Ranges past the end of the mapping are cut short or skipped
+  ASSERT_OK(result->WillNeed({{0, 10}, {5000, 20000}, {99990, 1000}, {200000, 10}}));
+  ASSERT_OK(result->WillNeed({}));
+  ASSERT_RAISES(Invalid, result->WillNeed({{-1, 10}}));
+  for (auto pattern : {AccessPattern::SEQUENTIAL, AccessPattern::RANDOM,
+                       AccessPattern::NORMAL}) {
+    ASSERT_OK(result->AdviseAccessPattern(pattern));
+  }
+
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(result->ReadAt(5000, 20000, &out));
+  ASSERT_EQ(0, memcmp(out->data(), buffer.data() + 5000, 20000));
+
+  std::shared_ptr<MemoryMappedFile> empty;
+  ASSERT_OK(InitMemoryMap(0, "io-memory-map-access-hints-empty", &empty));
+  ASSERT_OK(empty->WillNeed({{0, 10}}));
+  ASSERT_OK(empty->AdviseAccessPattern(AccessPattern::SEQUENTIAL));
+}
+
 TEST_F(TestMemoryMappedFile, WriteRead) {
   const int64_t buffer_size = 1024;
   std::vector<uint8_t> buffer(buffer_size);
@@ -534,6 +941,41 @@ TEST_F(TestMemoryMappedFile, ReadOnly) {
   ASSERT_OK(rommap->Close());
 }
 
+TEST_F(TestMemoryMappedFile, ReadAtKeepsPosition) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  test::random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-read-at-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+  ASSERT_OK(result->Seek(10));
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(result->ReadAt(100, 200, &out_buffer));
+  ASSERT_EQ(200, out_buffer->size());
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data() + 100, 200));
+
+  // Zero-copy, and past the end only the remaining bytes are read
+  ASSERT_TRUE(out_buffer->parent() != nullptr);
+  ASSERT_OK(result->ReadAt(buffer_size - 24, 100, &out_buffer));
+  ASSERT_EQ(24, out_buffer->size());
+
+  uint8_t out[8];
+  int64_t bytes_read;
+  ASSERT_OK(result->ReadAt(8, 8, &bytes_read, out));
+  ASSERT_EQ(8, bytes_read);
+  ASSERT_EQ(0, memcmp(out, buffer.data() + 8, 8));
+
+  int64_t position;
+  ASSERT_OK(result->Tell(&position));
+  ASSERT_EQ(10, position);
+
+  ASSERT_RAISES(Invalid, result->ReadAt(-1, 8, &out_buffer));
+  ASSERT_OK(result->Close());
+}
+
 TEST_F(TestMemoryMappedFile, DISABLED_ReadWriteOver4GbFile) {
   // ARROW-1096
   const int64_t buffer_size = 1000 * 1000;
@@ -660,5 +1102,145 @@ TEST_F(TestMemoryMappedFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+// ----------------------------------------------------------------------
+// LocalFileSystem tests
+
+class TestLocalFileSystem : public ::testing::Test {
+ public:
+  void SetUp() {
+    root_ = "arrow-test-io-local-fs";
+    fs_.reset(new LocalFileSystem());
+    FileStatistics stat;
+    if (fs_->Stat(root_, &stat).ok()) {
+      ASSERT_OK(fs_->DeleteDirectory(root_));
+    }
+  }
+
+  void TearDown() {
+    FileStatistics stat;
+    if (fs_->Stat(root_, &stat).ok()) {
+      ASSERT_OK(fs_->DeleteDirectory(root_));
+    }
+  }
+
+  void WriteFile(const std::string& path, const std::string& data) {
+    std::shared_ptr<OutputStream> stream;
+    ASSERT_OK(fs_->OpenOutputStream(path, &stream));
+    ASSERT_OK(stream->Write(data.c_str(), static_cast<int64_t>(data.size())));
+    ASSERT_OK(stream->Close());
+  }
+
+ protected:
+  std::string root_;
+  std::unique_ptr<LocalFileSystem> fs_;
+};
+
+TEST_F(TestLocalFileSystem, MakeDirectoryAndStat) {
+  const std::string nested = root_ + "/a/b/c";
+  ASSERT_OK(fs_->MakeDirectory(nested));
+  // Already existing directories are not an error
+  ASSERT_OK(fs_->MakeDirectory(nested));
+
+  FileStatistics stat;
+  ASSERT_OK(fs_->Stat(nested, &stat));
+  ASSERT_EQ(ObjectType::DIRECTORY, stat.kind);
+
+  WriteFile(nested + "/data", "0123456789");
+  ASSERT_OK(fs_->Stat(nested + "/data", &stat));
+  ASSERT_EQ(ObjectType::FILE, stat.kind);
+  ASSERT_EQ(10, stat.size);
+
+  // A file in the way of a directory
+  ASSERT_RAISES(IOError, fs_->MakeDirectory(nested + "/data/d"));
+  ASSERT_RAISES(IOError, fs_->Stat(root_ + "/does-not-exist", &stat));
+}
+
+TEST_F(TestLocalFileSystem, ReadWriteFiles) {
+  ASSERT_OK(fs_->MakeDirectory(root_));
+  const std::string path = root_ + "/data";
+  WriteFile(path, "testdata");
+
+  std::shared_ptr<RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile(path, &file));
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(8, size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(4, 4, &buffer));
+  ASSERT_EQ(0, std::memcmp(buffer->data(), "data", 4));
+  ASSERT_OK(file->Close());
+
+  ASSERT_RAISES(IOError, fs_->OpenInputFile(root_ + "/does-not-exist", &file));
+}
+
+TEST_F(TestLocalFileSystem, GetChildren) {
+  ASSERT_OK(fs_->MakeDirectory(root_ + "/dir"));
+  WriteFile(root_ + "/file1", "a");
+  WriteFile(root_ + "/file2", "bc");
+
+  std::vector<std::string> listing;
+  ASSERT_OK(fs_->GetChildren(root_, &listing));
+  std::sort(listing.begin(), listing.end());
+  std::vector<std::string> expected = {root_ + "/dir", root_ + "/file1",
+                                       root_ + "/file2"};
+  ASSERT_EQ(expected, listing);
+
+  std::vector<FileEntry> entries;
+  ASSERT_OK(fs_->GetChildrenStats(root_, &entries));
+  ASSERT_EQ(3, entries.size());
+  for (const auto& entry : entries) {
+    if (entry.path == root_ + "/dir") {
+      ASSERT_EQ(ObjectType::DIRECTORY, entry.stat.kind);
+    } else {
+      ASSERT_EQ(ObjectType::FILE, entry.stat.kind);
+      ASSERT_EQ(entry.path == root_ + "/file1" ? 1 : 2, entry.stat.size);
+    }
+  }
+
+  ASSERT_RAISES(IOError, fs_->GetChildren(root_ + "/does-not-exist", &listing));
+}
+
+TEST_F(TestLocalFileSystem, GetChildrenRecursive) {
+  std::vector<std::string> expected;
+  for (int i = 0; i < 4; ++i) {
+    const std::string dir = root_ + "/dir" + std::to_string(i);
+    ASSERT_OK(fs_->MakeDirectory(dir + "/sub"));
+    expected.push_back(dir);
+    expected.push_back(dir + "/file");
+    expected.push_back(dir + "/sub");
+    expected.push_back(dir + "/sub/file");
+    WriteFile(dir + "/file", "x");
+    WriteFile(dir + "/sub/file", "yy");
+  }
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<FileEntry> entries;
+  ASSERT_OK(fs_->GetChildrenRecursive(root_, &entries));
+  ASSERT_EQ(expected.size(), entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    ASSERT_EQ(expected[i], entries[i].path);
+  }
+
+  ASSERT_RAISES(IOError,
+                fs_->GetChildrenRecursive(root_ + "/does-not-exist", &entries));
+}
+
+TEST_F(TestLocalFileSystem, RenameAndDelete) {
+  ASSERT_OK(fs_->MakeDirectory(root_ + "/src/sub"));
+  WriteFile(root_ + "/src/sub/file", "abc");
+
+  ASSERT_OK(fs_->Rename(root_ + "/src", root_ + "/dst"));
+  FileStatistics stat;
+  ASSERT_RAISES(IOError, fs_->Stat(root_ + "/src", &stat));
+  ASSERT_OK(fs_->Stat(root_ + "/dst/sub/file", &stat));
+  ASSERT_EQ(3, stat.size);
+
+  // Only directories can be deleted
+  ASSERT_RAISES(IOError, fs_->DeleteDirectory(root_ + "/dst/sub/file"));
+  ASSERT_OK(fs_->DeleteDirectory(root_ + "/dst"));
+  ASSERT_RAISES(IOError, fs_->Stat(root_ + "/dst", &stat));
+}
+
 }  // namespace io
 }  // namespace arrow
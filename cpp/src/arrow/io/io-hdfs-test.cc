@@ -398,6 +398,87 @@ TYPED_TEST(TestHadoopFileSystem, LargeFile) {
   ASSERT_EQ(size, bytes_read);
 }
 
+TYPED_TEST(TestHadoopFileSystem, PooledReadAt) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-pooled-read");
+  const int size = 1000000;
+
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  HdfsReadOptions options;
+  options.buffer_size = 1 << 12;
+  options.max_handles = 4;
+  options.parallel_read_size = 1 << 16;
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(this->client_->OpenReadable(path, options, &file));
+
+  // Split across the handles, up to the end of file
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(1000, size, &buffer));
+  ASSERT_EQ(size - 1000, buffer->size());
+  ASSERT_EQ(0, std::memcmp(buffer->data(), data.data() + 1000, size - 1000));
+
+  std::atomic<int> correct_count(0);
+  const int niter = 100;
+  auto ReadData = [&file, &correct_count, &data](int64_t offset) {
+    for (int i = 0; i < niter; ++i) {
+      std::shared_ptr<Buffer> chunk;
+      const int64_t position = (offset + i * 9973) % (size - 5000);
+      ASSERT_OK(file->ReadAt(position, 5000, &chunk));
+      if (chunk->size() == 5000 &&
+          0 == memcmp(data.data() + position, chunk->data(), 5000)) {
+        correct_count += 1;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back(ReadData, i * 100000);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(niter * 8, correct_count);
+
+  // Sequential reads use their own handle
+  int64_t bytes_read = 0;
+  std::vector<uint8_t> head(100);
+  ASSERT_OK(file->Read(100, &bytes_read, head.data()));
+  ASSERT_EQ(100, bytes_read);
+  ASSERT_EQ(0, std::memcmp(head.data(), data.data(), 100));
+
+  HdfsReadStatistics stats;
+  Status st = file->GetReadStatistics(&stats);
+  if (st.ok()) {
+    ASSERT_GE(stats.total_bytes_read, niter * 8 * 5000);
+    ASSERT_GE(stats.total_bytes_read, stats.local_bytes_read);
+    ASSERT_GE(stats.local_bytes_read, stats.short_circuit_bytes_read);
+  } else {
+    ASSERT_TRUE(st.IsNotImplemented());
+  }
+  ASSERT_OK(file->Close());
+}
+
+TYPED_TEST(TestHadoopFileSystem, ExtraConf) {
+  SKIP_IF_NO_DRIVER();
+
+  HdfsConnectionConfig conf = this->conf_;
+  conf.extra_conf["dfs.client.read.shortcircuit"] = "false";
+
+  std::shared_ptr<HadoopFileSystem> client;
+  Status st = HadoopFileSystem::Connect(&conf, &client);
+  if (st.IsNotImplemented()) {
+    return;
+  }
+  ASSERT_OK(st);
+  ASSERT_OK(client->Disconnect());
+}
+
 TYPED_TEST(TestHadoopFileSystem, RenameFile) {
   SKIP_IF_NO_DRIVER();
   ASSERT_OK(this->MakeScratchDir());
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<size_t>(buffer.size()));
+}
+
+TEST(TestIoCallStatistics, LatencyQuantile) {
+  IoCallStatistics stats;
+  ASSERT_EQ(0, stats.LatencyQuantile(0.5));
+
+  stats.latency_buckets[0] = 90;  // Under 2 us
+  stats.latency_buckets[10] = 10;  // 1 to 2 ms
+  ASSERT_EQ(2000, stats.LatencyQuantile(0.5));
+  ASSERT_EQ(2000, stats.LatencyQuantile(0.9));
+  ASSERT_EQ(2048000, stats.LatencyQuantile(0.95));
+  ASSERT_EQ(2048000, stats.LatencyQuantile(1));
+}
+
+TEST(TestIoStatisticsCollector, Record) {
+  IoStatisticsCollector collector;
+  using Call = IoStatisticsCollector::Call;
+  collector.Record(Call::READ_AT, 100, 100, 500);
+  collector.Record(Call::READ_AT, 100, 40, 5000);
+  collector.Record(Call::WRITE, 10, 10, 3000000);
+
+  IoStatistics stats = collector.statistics();
+  ASSERT_EQ(0, stats.reads.num_calls);
+  ASSERT_EQ(2, stats.read_ats.num_calls);
+  ASSERT_EQ(200, stats.read_ats.bytes_requested);
+  ASSERT_EQ(140, stats.read_ats.bytes_transferred);
+  ASSERT_EQ(5500, stats.read_ats.total_time_ns);
+  ASSERT_EQ(1, stats.read_ats.latency_buckets[0]);
+  ASSERT_EQ(1, stats.read_ats.latency_buckets[2]);  // 4 to 8 us
+  ASSERT_EQ(1, stats.writes.latency_buckets[11]);   // 2 to 4 ms
+  ASSERT_NE(std::string::npos, stats.ToString().find("ReadAt: 2 calls, 140 of 200"));
+
+  collector.Reset();
+  ASSERT_EQ(0, collector.statistics().read_ats.num_calls);
+}
+
+TEST(TestInstrumentedRandomAccessFile, Reads) {
+  const std::string data = "0123456789";
+  auto buffer = std::make_shared<Buffer>(data);
+  std::shared_ptr<InstrumentedRandomAccessFile> file;
+  ASSERT_OK(InstrumentedRandomAccessFile::Create(std::make_shared<BufferReader>(buffer),
+                                                 nullptr, &file));
+  ASSERT_TRUE(file->supports_zero_copy());
+
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(file->Read(4, &out));
+  ASSERT_EQ("0123", AsString(*out));
+  char chars[4];
+  int64_t bytes_read;
+  ASSERT_OK(file->ReadAt(8, 4, &bytes_read, chars));
+  ASSERT_EQ(2, bytes_read);
+  std::future<Status> done;
+  ASSERT_OK(file->ReadAsync(2, 3, &out, &done));
+  ASSERT_OK(done.get());
+  ASSERT_EQ("234", AsString(*out));
+
+  IoStatistics stats = file->statistics();
+  ASSERT_EQ(1, stats.reads.num_calls);
+  ASSERT_EQ(4, stats.reads.bytes_transferred);
+  ASSERT_EQ(2, stats.read_ats.num_calls);
+  ASSERT_EQ(7, stats.read_ats.bytes_requested);
+  ASSERT_EQ(5, stats.read_ats.bytes_transferred);
+  ASSERT_EQ(0, stats.writes.num_calls);
+
+  // Files may share a collector
+  std::shared_ptr<InstrumentedRandomAccessFile> other;
+  ASSERT_OK(InstrumentedRandomAccessFile::Create(std::make_shared<BufferReader>(buffer),
+                                                 file->collector(), &other));
+  ASSERT_OK(other->ReadAt(0, 10, &out));
+  ASSERT_EQ(3, file->statistics().read_ats.num_calls);
+}
+
+TEST(TestInstrumentedStreams, ReadsAndWrites) {
+  std::shared_ptr<BufferOutputStream> sink;
+  ASSERT_OK(BufferOutputStream::Create(64, default_memory_pool(), &sink));
+  std::shared_ptr<InstrumentedOutputStream> output;
+  ASSERT_OK(InstrumentedOutputStream::Create(sink, nullptr, &output));
+  ASSERT_OK(output->Write("abc", 3));
+  ASSERT_OK(output->Writev({{"de", 2}, {"fgh", 3}}));
+  ASSERT_EQ(2, output->statistics().writes.num_calls);
+  ASSERT_EQ(8, output->statistics().writes.bytes_transferred);
+
+  std::shared_ptr<Buffer> written;
+  ASSERT_OK(sink->Finish(&written));
+  std::shared_ptr<InstrumentedInputStream> input;
+  ASSERT_OK(InstrumentedInputStream::Create(std::make_shared<BufferReader>(written),
+                                            nullptr, &input));
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(input->Read(5, &out));
+  ASSERT_OK(input->Read(5, &out));
+  ASSERT_EQ("fgh", AsString(*out));
+  IoStatistics stats = input->statistics();
+  ASSERT_EQ(2, stats.reads.num_calls);
+  ASSERT_EQ(10, stats.reads.bytes_requested);
+  ASSERT_EQ(8, stats.reads.bytes_transferred);
+}
+
+}  // namespace io
+}  // namespace arrow
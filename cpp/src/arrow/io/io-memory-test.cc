@@ -15,9 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -69,6 +71,14 @@ TEST_F(TestBufferOutputStream, CloseResizes) {
   ASSERT_EQ(static_cast<int64_t>(K * data.size()), buffer_->size());
 }
 
+TEST_F(TestBufferOutputStream, Writev) {
+  std::string data = "data123456";
+  ASSERT_OK(stream_->Writev({{data.data(), 4}, {data.data(), 0}, {data.data() + 4, 6}}));
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ(data, std::string(reinterpret_cast<const char*>(buffer_->data()),
+                              static_cast<size_t>(buffer_->size())));
+}
+
 TEST_F(TestBufferOutputStream, WriteAfterFinish) {
   std::string data = "data123456";
   ASSERT_OK(stream_->Write(data));
@@ -129,6 +139,52 @@ TEST(TestBufferReader, RetainParentReference) {
   ASSERT_EQ(0, std::memcmp(slice2->data(), data.c_str() + 4, 6));
 }
 
+TEST(TestBufferReader, ReadAtKeepsPosition) {
+  std::string data = "data123456";
+  auto buffer = std::make_shared<Buffer>(data);
+  BufferReader reader(buffer);
+  ASSERT_OK(reader.Seek(2));
+
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(reader.ReadAt(4, 4, &out));
+  ASSERT_EQ(out->parent(), buffer);
+  ASSERT_EQ(0, std::memcmp(out->data(), data.c_str() + 4, 4));
+
+  ASSERT_OK(reader.ReadAt(8, 10, &out));
+  ASSERT_EQ(2, out->size());
+
+  uint8_t bytes[4];
+  int64_t bytes_read;
+  ASSERT_OK(reader.ReadAt(0, 4, &bytes_read, bytes));
+  ASSERT_EQ(4, bytes_read);
+  ASSERT_EQ(0, std::memcmp(bytes, data.c_str(), 4));
+
+  int64_t position;
+  ASSERT_OK(reader.Tell(&position));
+  ASSERT_EQ(2, position);
+
+  ASSERT_RAISES(IOError, reader.ReadAt(-1, 4, &out));
+  ASSERT_RAISES(IOError, reader.ReadAt(11, 4, &out));
+}
+
+TEST(TestBufferReader, ReadAsync) {
+  std::string data = "data123456";
+  auto buffer = std::make_shared<Buffer>(data);
+  BufferReader reader(buffer);
+
+  // The read is done before ReadAsync returns
+  std::shared_ptr<Buffer> out;
+  std::future<Status> done;
+  ASSERT_OK(reader.ReadAsync(4, 4, &out, &done));
+  ASSERT_EQ(std::future_status::ready, done.wait_for(std::chrono::seconds(0)));
+  ASSERT_OK(done.get());
+  ASSERT_EQ(out->parent(), buffer);
+  ASSERT_EQ(0, std::memcmp(out->data(), data.c_str() + 4, 4));
+
+  ASSERT_OK(reader.ReadAsync(11, 4, &out, &done));
+  ASSERT_RAISES(IOError, done.get());
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
   for (int i = 0; i < 5; ++i) {
     // randomize size so the memcopy alignment is tested
@@ -0,0 +1,176 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/readahead.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace io {
+
+static std::string AsString(const Buffer& buffer) {
+  return std::string(reinterpret_cast<const char*>(buffer.data()),
+                     static_cast<size_t>(buffer.size()));
+}
+
+// Counts the reads of a buffer, and fails them from a given one on
+class CountingInputStream : public InputStream {
+ public:
+  explicit CountingInputStream(const std::shared_ptr<Buffer>& buffer, int fail_at = -1)
+      : reader_(buffer), num_reads_(0), fail_at_(fail_at), closed_(false) {}
+
+  Status Close() override {
+    closed_ = true;
+    return reader_.Close();
+  }
+  Status Tell(int64_t* position) const override { return reader_.Tell(position); }
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    return Status::NotImplemented("copying read");
+  }
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    if (num_reads_++ == fail_at_) {
+      return Status::IOError("read failed");
+    }
+    return reader_.Read(nbytes, out);
+  }
+
+  int num_reads() const { return num_reads_; }
+  bool closed() const { return closed_; }
+
+ private:
+  BufferReader reader_;
+  std::atomic<int> num_reads_;
+  int fail_at_;
+  bool closed_;
+};
+
+class TestReadaheadInputStream : public ::testing::Test {
+ public:
+  void SetUp() {
+    data_ = "0123456789abcdefghijklmnopqrstuvwxyz";
+    buffer_ = std::make_shared<Buffer>(data_);
+  }
+
+  void MakeStream(int64_t block_size, int32_t depth, int fail_at = -1) {
+    raw_ = std::make_shared<CountingInputStream>(buffer_, fail_at);
+    ASSERT_OK(ReadaheadInputStream::Create(raw_, block_size, depth,
+                                           default_memory_pool(), &stream_));
+  }
+
+  void AssertTell(int64_t expected) {
+    int64_t position;
+    ASSERT_OK(stream_->Tell(&position));
+    ASSERT_EQ(expected, position);
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<Buffer> buffer_;
+  std::shared_ptr<CountingInputStream> raw_;
+  std::shared_ptr<ReadaheadInputStream> stream_;
+};
+
+TEST_F(TestReadaheadInputStream, ReadBlocks) {
+  MakeStream(10, 2);
+
+  std::shared_ptr<Buffer> block;
+  std::string result;
+  do {
+    ASSERT_OK(stream_->ReadBlock(&block));
+    ASSERT_LE(block->size(), 10);
+    // The blocks are those of the wrapped stream
+    if (block->size() > 0) {
+      ASSERT_EQ(buffer_->data() + result.size(), block->data());
+    }
+    result += AsString(*block);
+  } while (block->size() > 0);
+
+  ASSERT_EQ(data_, result);
+  AssertTell(36);
+  ASSERT_OK(stream_->Close());
+  ASSERT_TRUE(raw_->closed());
+}
+
+TEST_F(TestReadaheadInputStream, Reads) {
+  MakeStream(8, 3);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(5, &buffer));
+  ASSERT_EQ("01234", AsString(*buffer));
+  ASSERT_EQ(buffer_->data(), buffer->data());
+
+  // Spans blocks
+  ASSERT_OK(stream_->Read(10, &buffer));
+  ASSERT_EQ("56789abcde", AsString(*buffer));
+  AssertTell(15);
+
+  std::vector<char> out(30);
+  int64_t bytes_read;
+  ASSERT_OK(stream_->Read(30, &bytes_read, out.data()));
+  ASSERT_EQ("fghijklmnopqrstuvwxyz", std::string(out.data(), bytes_read));
+
+  ASSERT_OK(stream_->Read(4, &bytes_read, out.data()));
+  ASSERT_EQ(0, bytes_read);
+  ASSERT_OK(stream_->Read(4, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  AssertTell(36);
+}
+
+TEST_F(TestReadaheadInputStream, ReadsAhead) {
+  MakeStream(4, 3);
+
+  std::shared_ptr<Buffer> block;
+  ASSERT_OK(stream_->ReadBlock(&block));
+  ASSERT_EQ("0123", AsString(*block));
+
+  // The consumed block is replaced in the queue
+  ASSERT_OK(stream_->Close());
+  ASSERT_LE(raw_->num_reads(), 4);
+  ASSERT_RAISES(IOError, stream_->ReadBlock(&block));
+}
+
+TEST_F(TestReadaheadInputStream, Errors) {
+  MakeStream(4, 2, 1);
+
+  std::shared_ptr<Buffer> block;
+  ASSERT_OK(stream_->ReadBlock(&block));
+  ASSERT_EQ("0123", AsString(*block));
+  ASSERT_RAISES(IOError, stream_->ReadBlock(&block));
+  ASSERT_OK(stream_->Close());
+
+  std::shared_ptr<ReadaheadInputStream> stream;
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(raw_, 0, 2, default_memory_pool(),
+                                                      &stream));
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(raw_, 4, 0, default_memory_pool(),
+                                                      &stream));
+}
+
+}  // namespace io
+}  // namespace arrow
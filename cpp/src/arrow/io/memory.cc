@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <future>
 #include <mutex>
 
 #include "arrow/buffer.h"
@@ -36,12 +37,17 @@ namespace io {
 
 static constexpr int64_t kBufferMinimumSize = 256;
 
+static constexpr int kMemcopyDefaultNumThreads = 1;
+static constexpr int64_t kMemcopyDefaultBlocksize = 64;
+static constexpr int64_t kMemcopyDefaultThreshold = 1024 * 1024;
+
 BufferOutputStream::BufferOutputStream(const std::shared_ptr<ResizableBuffer>& buffer)
     : buffer_(buffer),
       is_open_(true),
       capacity_(buffer->size()),
       position_(0),
-      mutable_data_(buffer->mutable_data()) {}
+      mutable_data_(buffer->mutable_data()),
+      memcopy_num_threads_(kMemcopyDefaultNumThreads) {}
 
 Status BufferOutputStream::Create(int64_t initial_capacity, MemoryPool* pool,
                                   std::shared_ptr<BufferOutputStream>* out) {
@@ -85,7 +91,13 @@ Status BufferOutputStream::Write(const void* data, int64_t nbytes) {
   }
   DCHECK(buffer_);
   RETURN_NOT_OK(Reserve(nbytes));
-  memcpy(mutable_data_ + position_, data, nbytes);
+  if (nbytes >= kMemcopyDefaultThreshold) {
+    internal::ParallelMemcopy(mutable_data_ + position_,
+                              reinterpret_cast<const uint8_t*>(data), nbytes,
+                              memcopy_num_threads_, kMemcopyDefaultBlocksize);
+  } else {
+    memcpy(mutable_data_ + position_, data, nbytes);
+  }
   position_ += nbytes;
   return Status::OK();
 }
@@ -124,10 +136,6 @@ Status MockOutputStream::Write(const void* data, int64_t nbytes) {
 // ----------------------------------------------------------------------
 // In-memory buffer writer
 
-static constexpr int kMemcopyDefaultNumThreads = 1;
-static constexpr int64_t kMemcopyDefaultBlocksize = 64;
-static constexpr int64_t kMemcopyDefaultThreshold = 1024 * 1024;
-
 class FixedSizeBufferWriter::FixedSizeBufferWriterImpl {
  public:
   /// Input buffer must be mutable, will abort if not
@@ -163,10 +171,10 @@ class FixedSizeBufferWriter::FixedSizeBufferWriterImpl {
   }
 
   Status Write(const void* data, int64_t nbytes) {
-    if (nbytes > memcopy_threshold_ && memcopy_num_threads_ > 1) {
-      internal::parallel_memcopy(mutable_data_ + position_,
-                                 reinterpret_cast<const uint8_t*>(data), nbytes,
-                                 memcopy_blocksize_, memcopy_num_threads_);
+    if (nbytes > memcopy_threshold_) {
+      internal::ParallelMemcopy(mutable_data_ + position_,
+                                reinterpret_cast<const uint8_t*>(data), nbytes,
+                                memcopy_num_threads_, memcopy_blocksize_);
     } else {
       memcpy(mutable_data_ + position_, data, nbytes);
     }
@@ -278,14 +286,41 @@ Status BufferReader::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return Status::OK();
 }
 
+// The data is immutable, so ReadAt needs neither the lock nor the read
+// position, which it leaves unchanged
 Status BufferReader::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                             void* out) {
-  return RandomAccessFile::ReadAt(position, nbytes, bytes_read, out);
+  if (position < 0 || position > size_) {
+    return Status::IOError("position out of bounds");
+  }
+  *bytes_read = std::min(nbytes, size_ - position);
+  if (*bytes_read) {
+    memcpy(out, data_ + position, *bytes_read);
+  }
+  return Status::OK();
 }
 
 Status BufferReader::ReadAt(int64_t position, int64_t nbytes,
                             std::shared_ptr<Buffer>* out) {
-  return RandomAccessFile::ReadAt(position, nbytes, out);
+  if (position < 0 || position > size_) {
+    return Status::IOError("position out of bounds");
+  }
+  int64_t size = std::min(nbytes, size_ - position);
+
+  if (size > 0 && buffer_ != nullptr) {
+    *out = SliceBuffer(buffer_, position, size);
+  } else {
+    *out = std::make_shared<Buffer>(data_ + position, size);
+  }
+  return Status::OK();
+}
+
+Status BufferReader::ReadAsync(int64_t position, int64_t nbytes,
+                               std::shared_ptr<Buffer>* out, std::future<Status>* done) {
+  std::promise<Status> promise;
+  promise.set_value(ReadAt(position, nbytes, out));
+  *done = promise.get_future();
+  return Status::OK();
 }
 
 Status BufferReader::GetSize(int64_t* size) {
@@ -53,6 +53,9 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   /// Close the stream and return the buffer
   Status Finish(std::shared_ptr<Buffer>* result);
 
+  /// Copy large writes with this many threads, 1 by default
+  void set_memcopy_threads(int num_threads) { memcopy_num_threads_ = num_threads; }
+
  private:
   // Ensures there is sufficient space available to write nbytes
   Status Reserve(int64_t nbytes);
@@ -62,6 +65,7 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   int64_t capacity_;
   int64_t position_;
   uint8_t* mutable_data_;
+  int memcopy_num_threads_;
 };
 
 // \brief A helper class to tracks the size of allocations
@@ -116,12 +120,17 @@ class ARROW_EXPORT BufferReader : public RandomAccessFile {
 
   // Zero copy read
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  /// Thread-safe and does not change the read position
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                 void* out) override;
 
-  /// Default implementation is thread-safe
+  /// Zero copy read, thread-safe and does not change the read position
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
+  /// Zero copy read, done right away
+  Status ReadAsync(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out,
+                   std::future<Status>* done) override;
+
   Status GetSize(int64_t* size) override;
   Status Seek(int64_t position) override;
 
@@ -0,0 +1,272 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/readahead.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace io {
+
+class ReadaheadInputStream::Impl {
+ public:
+  Impl(const std::shared_ptr<InputStream>& raw, int64_t block_size,
+       int32_t readahead_depth, MemoryPool* pool)
+      : raw_(raw),
+        block_size_(block_size),
+        readahead_depth_(readahead_depth),
+        pool_(pool),
+        is_open_(false),
+        cancelled_(false),
+        eof_(false),
+        current_pos_(0),
+        position_(0) {}
+
+  Status Init() {
+    if (block_size_ <= 0 || readahead_depth_ <= 0) {
+      return Status::Invalid("Read-ahead block size and depth must be positive");
+    }
+    RETURN_NOT_OK(raw_->Tell(&position_));
+    RETURN_NOT_OK(::arrow::internal::ThreadPool::Make(1, &io_pool_));
+    std::lock_guard<std::mutex> guard(lock_);
+    is_open_ = true;
+    for (int32_t i = 0; i < readahead_depth_; ++i) {
+      RETURN_NOT_OK(SubmitBlock());
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!is_open_) {
+      return Status::OK();
+    }
+    is_open_ = false;
+
+    // The blocks not yet read are skipped, the one being read is waited for
+    cancelled_ = true;
+    while (!pending_.empty()) {
+      pending_.front().wait();
+      pending_.pop_front();
+    }
+    RETURN_NOT_OK(io_pool_->Shutdown());
+    current_.reset();
+    return raw_->Close();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status ReadBlock(std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    int64_t available;
+    RETURN_NOT_OK(EnsureCurrent(&available));
+    if (available == 0) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    *out = SliceBuffer(current_, current_pos_, available);
+    Consume(available);
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    return ReadUnlocked(nbytes, bytes_read, reinterpret_cast<uint8_t*>(out));
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckOpen());
+    if (nbytes < 0) {
+      return Status::Invalid("Read length must be non-negative");
+    }
+    int64_t available;
+    RETURN_NOT_OK(EnsureCurrent(&available));
+    if (available >= nbytes) {
+      *out = SliceBuffer(current_, current_pos_, nbytes);
+      Consume(nbytes);
+      return Status::OK();
+    }
+
+    // The bytes span several blocks
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(ReadUnlocked(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
+ private:
+  struct Block {
+    Status status;
+    std::shared_ptr<Buffer> buffer;
+  };
+
+  Status CheckOpen() const {
+    if (ARROW_PREDICT_FALSE(!is_open_)) {
+      return Status::IOError("InputStream is closed");
+    }
+    return Status::OK();
+  }
+
+  // Queue the read of the next block on the I/O thread. The blocks are read
+  // in the order they are queued, since the thread runs its tasks in turn
+  Status SubmitBlock() {
+    std::future<Block> block;
+    RETURN_NOT_OK(io_pool_->Submit(&block, [this]() {
+      Block result;
+      if (!cancelled_) {
+        result.status = raw_->Read(block_size_, &result.buffer);
+      }
+      return result;
+    }));
+    pending_.push_back(std::move(block));
+    return Status::OK();
+  }
+
+  // Make sure the current block has bytes left to read, unless the stream
+  // is exhausted, and return how many
+  Status EnsureCurrent(int64_t* available) {
+    while ((current_ == nullptr || current_pos_ == current_->size()) &&
+           !pending_.empty()) {
+      Block block = pending_.front().get();
+      pending_.pop_front();
+      current_.reset();
+      current_pos_ = 0;
+      if (!block.status.ok()) {
+        // Skip the blocks queued after the failed one
+        eof_ = true;
+        return block.status;
+      }
+      if (block.buffer == nullptr || block.buffer->size() < block_size_) {
+        eof_ = true;
+      }
+      if (!eof_) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      current_ = block.buffer;
+    }
+    *available = current_ == nullptr ? 0 : current_->size() - current_pos_;
+    return Status::OK();
+  }
+
+  void Consume(int64_t nbytes) {
+    current_pos_ += nbytes;
+    position_ += nbytes;
+  }
+
+  Status ReadUnlocked(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    if (nbytes < 0) {
+      return Status::Invalid("Read length must be non-negative");
+    }
+    *bytes_read = 0;
+    while (*bytes_read < nbytes) {
+      int64_t available;
+      RETURN_NOT_OK(EnsureCurrent(&available));
+      if (available == 0) {
+        break;
+      }
+      const int64_t ncopy = std::min(available, nbytes - *bytes_read);
+      memcpy(out + *bytes_read, current_->data() + current_pos_,
+             static_cast<size_t>(ncopy));
+      Consume(ncopy);
+      *bytes_read += ncopy;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw_;
+  const int64_t block_size_;
+  const int32_t readahead_depth_;
+  MemoryPool* pool_;
+
+  mutable std::mutex lock_;
+  bool is_open_;
+  std::atomic<bool> cancelled_;
+  bool eof_;
+
+  std::shared_ptr<::arrow::internal::ThreadPool> io_pool_;
+  std::deque<std::future<Block>> pending_;
+
+  // The block being consumed and the position in it
+  std::shared_ptr<Buffer> current_;
+  int64_t current_pos_;
+
+  // The position of the reader in the stream
+  int64_t position_;
+};
+
+ReadaheadInputStream::ReadaheadInputStream() {}
+
+ReadaheadInputStream::~ReadaheadInputStream() { DCHECK(impl_->Close().ok()); }
+
+Status ReadaheadInputStream::Create(const std::shared_ptr<InputStream>& raw,
+                                    int64_t block_size, int32_t readahead_depth,
+                                    MemoryPool* pool,
+                                    std::shared_ptr<ReadaheadInputStream>* out) {
+  std::shared_ptr<ReadaheadInputStream> result(new ReadaheadInputStream());
+  result->impl_.reset(new Impl(raw, block_size, readahead_depth, pool));
+  RETURN_NOT_OK(result->impl_->Init());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status ReadaheadInputStream::ReadBlock(std::shared_ptr<Buffer>* out) {
+  return impl_->ReadBlock(out);
+}
+
+Status ReadaheadInputStream::Close() { return impl_->Close(); }
+
+Status ReadaheadInputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ReadaheadInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+}  // namespace io
+}  // namespace arrow
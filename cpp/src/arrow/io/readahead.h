@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Read-ahead of an input stream on a background thread
+
+#ifndef ARROW_IO_READAHEAD_H
+#define ARROW_IO_READAHEAD_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \class ReadaheadInputStream
+/// \brief Read a stream sequentially in blocks, ahead of the reader
+///
+/// Up to readahead_depth blocks are read on a background I/O thread while
+/// the caller consumes the previous ones, so that reading overlaps with
+/// decoding. The blocks are buffers as returned by the zero-copy Read of the
+/// wrapped stream, which is not to be used directly until this stream is
+/// closed
+class ARROW_EXPORT ReadaheadInputStream : public InputStream {
+ public:
+  ~ReadaheadInputStream() override;
+
+  /// \brief Create a read-ahead stream and start reading the wrapped stream
+  ///
+  /// \param[in] raw the stream to read from
+  /// \param[in] block_size the number of bytes read at once
+  /// \param[in] readahead_depth the maximum number of blocks read ahead
+  /// \param[in] pool MemoryPool for reads spanning several blocks
+  /// \param[out] out the created stream
+  /// \return Status
+  static Status Create(const std::shared_ptr<InputStream>& raw, int64_t block_size,
+                       int32_t readahead_depth, MemoryPool* pool,
+                       std::shared_ptr<ReadaheadInputStream>* out);
+
+  /// \brief Return the rest of the current block, or the next block, without
+  /// copying
+  ///
+  /// \param[out] out the block, empty at the end of the stream
+  /// \return Status
+  Status ReadBlock(std::shared_ptr<Buffer>* out);
+
+  // Implement the InputStream interface
+
+  /// Stop reading ahead, waiting for the block being read, and close the
+  /// wrapped stream
+  Status Close() override;
+  Status Tell(int64_t* position) const override;
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+
+  /// Does not copy if the bytes are within one block
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+ private:
+  ReadaheadInputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_READAHEAD_H
@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/s3-internal.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+namespace {
+
+const char kHexDigits[] = "0123456789abcdef";
+
+std::string ToHex(const uint8_t* data, size_t length) {
+  std::string out(length * 2, '\0');
+  for (size_t i = 0; i < length; ++i) {
+    out[2 * i] = kHexDigits[data[i] >> 4];
+    out[2 * i + 1] = kHexDigits[data[i] & 0xf];
+  }
+  return out;
+}
+
+std::string HmacSha256(const std::string& key, const std::string& data) {
+  uint8_t digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_length = 0;
+  HMAC(EVP_sha256(), key.data(), static_cast<int>(key.size()),
+       reinterpret_cast<const uint8_t*>(data.data()), data.size(), digest,
+       &digest_length);
+  return std::string(reinterpret_cast<const char*>(digest), digest_length);
+}
+
+std::string Trim(const std::string& value) {
+  size_t begin = 0;
+  size_t end = value.size();
+  while (begin < end && std::isspace(static_cast<unsigned char>(value[begin]))) {
+    ++begin;
+  }
+  while (end > begin && std::isspace(static_cast<unsigned char>(value[end - 1]))) {
+    --end;
+  }
+  return value.substr(begin, end - begin);
+}
+
+std::string ToLower(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return value;
+}
+
+std::string XmlUnescape(const std::string& value) {
+  static const std::pair<const char*, char> kEntities[] = {
+      {"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&apos;", '\''}};
+
+  std::string out;
+  out.reserve(value.size());
+  size_t pos = 0;
+  while (pos < value.size()) {
+    if (value[pos] == '&') {
+      bool replaced = false;
+      for (const auto& entity : kEntities) {
+        const size_t length = strlen(entity.first);
+        if (value.compare(pos, length, entity.first) == 0) {
+          out += entity.second;
+          pos += length;
+          replaced = true;
+          break;
+        }
+      }
+      if (replaced) {
+        continue;
+      }
+    }
+    out += value[pos++];
+  }
+  return out;
+}
+
+}  // namespace
+
+std::string S3UriEncode(const std::string& value, bool encode_slash) {
+  std::string out;
+  out.reserve(value.size());
+  for (const char c : value) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.' ||
+        c == '~' || (c == '/' && !encode_slash)) {
+      out += c;
+    } else {
+      const uint8_t byte = static_cast<uint8_t>(c);
+      out += '%';
+      out += static_cast<char>(std::toupper(kHexDigits[byte >> 4]));
+      out += static_cast<char>(std::toupper(kHexDigits[byte & 0xf]));
+    }
+  }
+  return out;
+}
+
+std::string Sha256Hex(const void* data, size_t length) {
+  uint8_t digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_length = 0;
+  EVP_Digest(data, length, digest, &digest_length, EVP_sha256(), nullptr);
+  return ToHex(digest, digest_length);
+}
+
+std::string S3Authorization(const S3SigningRequest& request,
+                            const std::string& access_key, const std::string& secret_key,
+                            const std::string& region, const std::string& amz_date) {
+  std::vector<std::pair<std::string, std::string>> query;
+  for (const auto& param : request.query) {
+    query.emplace_back(S3UriEncode(param.first, true), S3UriEncode(param.second, true));
+  }
+  std::sort(query.begin(), query.end());
+
+  std::vector<std::pair<std::string, std::string>> headers;
+  for (const auto& header : request.headers) {
+    headers.emplace_back(ToLower(header.first), Trim(header.second));
+  }
+  std::sort(headers.begin(), headers.end());
+
+  std::stringstream canonical;
+  canonical << request.method << "\n" << request.canonical_uri << "\n";
+  for (size_t i = 0; i < query.size(); ++i) {
+    canonical << (i == 0 ? "" : "&") << query[i].first << "=" << query[i].second;
+  }
+  canonical << "\n";
+  std::string signed_headers;
+  for (const auto& header : headers) {
+    canonical << header.first << ":" << header.second << "\n";
+    signed_headers += (signed_headers.empty() ? "" : ";") + header.first;
+  }
+  canonical << "\n" << signed_headers << "\n" << request.payload_hash;
+  const std::string canonical_request = canonical.str();
+
+  const std::string date = amz_date.substr(0, 8);
+  const std::string scope = date + "/" + region + "/s3/aws4_request";
+  const std::string string_to_sign =
+      "AWS4-HMAC-SHA256\n" + amz_date + "\n" + scope + "\n" +
+      Sha256Hex(canonical_request.data(), canonical_request.size());
+
+  std::string key = HmacSha256("AWS4" + secret_key, date);
+  key = HmacSha256(key, region);
+  key = HmacSha256(key, "s3");
+  key = HmacSha256(key, "aws4_request");
+  const std::string signature = HmacSha256(key, string_to_sign);
+
+  return "AWS4-HMAC-SHA256 Credential=" + access_key + "/" + scope +
+         ",SignedHeaders=" + signed_headers + ",Signature=" +
+         ToHex(reinterpret_cast<const uint8_t*>(signature.data()), signature.size());
+}
+
+std::vector<std::string> XmlElements(const std::string& xml, const std::string& tag) {
+  const std::string open = "<" + tag;
+  const std::string close = "</" + tag + ">";
+
+  std::vector<std::string> elements;
+  size_t pos = 0;
+  while ((pos = xml.find(open, pos)) != std::string::npos) {
+    const size_t name_end = pos + open.size();
+    // Skip longer tags sharing the prefix, such as <KeyCount> for <Key>
+    if (name_end >= xml.size() ||
+        (xml[name_end] != '>' && xml[name_end] != '/' &&
+         !std::isspace(static_cast<unsigned char>(xml[name_end])))) {
+      pos = name_end;
+      continue;
+    }
+    const size_t start_end = xml.find('>', name_end);
+    if (start_end == std::string::npos) {
+      break;
+    }
+    if (xml[start_end - 1] == '/') {
+      // Empty element
+      elements.emplace_back();
+      pos = start_end + 1;
+      continue;
+    }
+    const size_t end = xml.find(close, start_end + 1);
+    if (end == std::string::npos) {
+      break;
+    }
+    elements.push_back(xml.substr(start_end + 1, end - start_end - 1));
+    pos = end + close.size();
+  }
+  return elements;
+}
+
+std::string XmlText(const std::string& xml, const std::string& tag) {
+  const std::vector<std::string> elements = XmlElements(xml, tag);
+  return elements.empty() ? "" : XmlUnescape(elements[0]);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
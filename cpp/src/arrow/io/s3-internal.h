@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Request signing and response parsing for the S3 REST API, exposed for
+// testing
+
+#ifndef ARROW_IO_S3_INTERNAL
+#define ARROW_IO_S3_INTERNAL
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief Percent-encode all but the unreserved characters, as S3 expects
+/// in URIs and canonical requests. '/' is kept unless encode_slash
+ARROW_EXPORT
+std::string S3UriEncode(const std::string& value, bool encode_slash);
+
+/// \brief Lowercase hex SHA-256 digest of data
+ARROW_EXPORT
+std::string Sha256Hex(const void* data, size_t length);
+
+/// \brief A request to sign with AWS Signature Version 4
+struct S3SigningRequest {
+  std::string method;
+  /// Encoded path, starting with '/'
+  std::string canonical_uri;
+  /// Decoded query parameters
+  std::vector<std::pair<std::string, std::string>> query;
+  /// Headers to sign, including host and x-amz-date
+  std::vector<std::pair<std::string, std::string>> headers;
+  /// Hex SHA-256 digest of the body
+  std::string payload_hash;
+};
+
+/// \brief Return the Authorization header of a request
+///
+/// \param[in] request the request to sign
+/// \param[in] access_key the access key id
+/// \param[in] secret_key the secret access key
+/// \param[in] region the region of the endpoint, such as "us-east-1"
+/// \param[in] amz_date the x-amz-date header, as YYYYMMDD'T'HHMMSS'Z'
+ARROW_EXPORT
+std::string S3Authorization(const S3SigningRequest& request,
+                            const std::string& access_key, const std::string& secret_key,
+                            const std::string& region, const std::string& amz_date);
+
+/// \brief Return the contents of each <tag> element of an XML document, as
+/// raw XML. Elements of the same tag must not nest
+ARROW_EXPORT
+std::vector<std::string> XmlElements(const std::string& xml, const std::string& tag);
+
+/// \brief Return the unescaped text of the first <tag> element of an XML
+/// document, or an empty string
+ARROW_EXPORT
+std::string XmlText(const std::string& xml, const std::string& tag);
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_S3_INTERNAL
@@ -0,0 +1,1407 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/s3-internal.h"
+#include "arrow/io/s3.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace io {
+
+using internal::S3UriEncode;
+using internal::XmlElements;
+using internal::XmlText;
+
+namespace {
+
+// S3 rejects smaller parts, except for the last one
+constexpr int64_t kMinPartSize = 5 << 20;
+constexpr int64_t kMaxParts = 10000;
+
+using KeyValues = std::vector<std::pair<std::string, std::string>>;
+
+// A request to the object store
+struct S3Call {
+  S3Call(const std::string& method, const std::string& bucket, const std::string& key)
+      : method(method), bucket(bucket), key(key) {}
+
+  std::string method;
+  std::string bucket;
+  std::string key;
+  KeyValues query;
+  KeyValues headers;
+  const uint8_t* body = nullptr;
+  int64_t body_size = 0;
+  // If set, a successful response body is written here, up to out_capacity
+  uint8_t* out = nullptr;
+  int64_t out_capacity = 0;
+};
+
+struct S3Response {
+  int64_t status_code = 0;
+  // Header names are lowercase
+  std::unordered_map<std::string, std::string> headers;
+  std::string body;
+  int64_t out_size = 0;
+
+  bool ok() const { return status_code >= 200 && status_code < 300; }
+};
+
+struct ResponseWriter {
+  CURL* curl;
+  S3Response* response;
+  uint8_t* out;
+  int64_t out_capacity;
+};
+
+size_t WriteCallback(char* data, size_t size, size_t nmemb, void* userdata) {
+  auto writer = reinterpret_cast<ResponseWriter*>(userdata);
+  const int64_t nbytes = static_cast<int64_t>(size * nmemb);
+  long status_code = 0;  // NOLINT
+  curl_easy_getinfo(writer->curl, CURLINFO_RESPONSE_CODE, &status_code);
+  if (writer->out != nullptr && status_code >= 200 && status_code < 300) {
+    S3Response* response = writer->response;
+    if (response->out_size + nbytes > writer->out_capacity) {
+      // More than requested, abort the transfer
+      return 0;
+    }
+    memcpy(writer->out + response->out_size, data, static_cast<size_t>(nbytes));
+    response->out_size += nbytes;
+  } else {
+    writer->response->body.append(data, static_cast<size_t>(nbytes));
+  }
+  return static_cast<size_t>(nbytes);
+}
+
+size_t HeaderCallback(char* data, size_t size, size_t nitems, void* userdata) {
+  auto response = reinterpret_cast<S3Response*>(userdata);
+  const size_t nbytes = size * nitems;
+  const std::string line(data, nbytes);
+  const size_t colon = line.find(':');
+  if (colon != std::string::npos) {
+    std::string name = line.substr(0, colon);
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    const size_t begin = line.find_first_not_of(" \t", colon + 1);
+    const size_t end = line.find_last_not_of(" \t\r\n");
+    response->headers[name] =
+        (begin == std::string::npos || end < begin) ? ""
+                                                    : line.substr(begin, end - begin + 1);
+  }
+  return nbytes;
+}
+
+std::string AmzDate() {
+  const std::time_t now = std::time(nullptr);
+  std::tm tm;
+#if defined(_MSC_VER)
+  gmtime_s(&tm, &now);
+#else
+  gmtime_r(&now, &tm);
+#endif
+  char buffer[32];
+  std::strftime(buffer, sizeof(buffer), "%Y%m%dT%H%M%SZ", &tm);
+  return buffer;
+}
+
+// Split "bucket/key" into its parts, ignoring leading and trailing slashes
+void SplitPath(const std::string& path, std::string* bucket, std::string* key) {
+  const size_t begin = path.find_first_not_of('/');
+  if (begin == std::string::npos) {
+    bucket->clear();
+    key->clear();
+    return;
+  }
+  const size_t end = path.find_last_not_of('/') + 1;
+  const size_t slash = path.find('/', begin);
+  if (slash == std::string::npos || slash >= end) {
+    *bucket = path.substr(begin, end - begin);
+    key->clear();
+  } else {
+    *bucket = path.substr(begin, slash - begin);
+    *key = path.substr(slash + 1, end - slash - 1);
+  }
+}
+
+Status ParseInt(const std::string& value, int64_t* out) {
+  char* end = nullptr;
+  errno = 0;
+  *out = static_cast<int64_t>(std::strtoll(value.c_str(), &end, 10));
+  if (value.empty() || *end != '\0' || errno != 0) {
+    return Status::IOError("Invalid integer in S3 response: '" + value + "'");
+  }
+  return Status::OK();
+}
+
+std::once_flag curl_init_flag;
+CURLcode curl_init_result = CURLE_OK;
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// HTTP client of the object store
+
+class S3Client {
+ public:
+  explicit S3Client(const S3Options& options) : options_(options) {
+    endpoint_ = options_.endpoint;
+    if (endpoint_.empty()) {
+      endpoint_ = "https://s3." + options_.region + ".amazonaws.com";
+    } else if (endpoint_.find("://") == std::string::npos) {
+      endpoint_ = "https://" + endpoint_;
+    }
+    while (endpoint_.back() == '/') {
+      endpoint_.pop_back();
+    }
+    host_ = endpoint_.substr(endpoint_.find("://") + 3);
+    host_ = host_.substr(0, host_.find('/'));
+  }
+
+  ~S3Client() {
+    for (CURL* handle : idle_handles_) {
+      curl_easy_cleanup(handle);
+    }
+  }
+
+  const S3Options& options() const { return options_; }
+
+  // Make the request, retrying server and network errors. HTTP errors are
+  // left to the caller in the response
+  Status Perform(const S3Call& call, S3Response* response) {
+    Status st;
+    for (int32_t attempt = 0;; ++attempt) {
+      if (attempt > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100 << (attempt - 1)));
+      }
+      *response = S3Response();
+      st = PerformOnce(call, response);
+      const bool retriable = !st.ok() || response->status_code >= 500;
+      if (!retriable || attempt == options_.max_retries) {
+        return st;
+      }
+    }
+  }
+
+  // Make the request, failing on HTTP errors
+  Status Call(const S3Call& call, S3Response* response) {
+    RETURN_NOT_OK(Perform(call, response));
+    if (!response->ok()) {
+      return ErrorStatus(call, *response);
+    }
+    return Status::OK();
+  }
+
+  Status Call(const S3Call& call) {
+    S3Response response;
+    return Call(call, &response);
+  }
+
+  static Status ErrorStatus(const S3Call& call, const S3Response& response) {
+    std::stringstream ss;
+    ss << "S3 " << call.method << " " << call.bucket;
+    if (!call.key.empty()) {
+      ss << "/" << call.key;
+    }
+    ss << " failed with HTTP status " << response.status_code;
+    const std::string code = XmlText(response.body, "Code");
+    if (!code.empty()) {
+      ss << ": " << code << ": " << XmlText(response.body, "Message");
+    }
+    return Status::IOError(ss.str());
+  }
+
+ private:
+  Status PerformOnce(const S3Call& call, S3Response* response) {
+    std::string canonical_uri = "/";
+    if (!call.bucket.empty()) {
+      canonical_uri += S3UriEncode(call.bucket, false);
+      if (!call.key.empty()) {
+        canonical_uri += "/" + S3UriEncode(call.key, false);
+      }
+    }
+    std::string url = endpoint_ + canonical_uri;
+    for (size_t i = 0; i < call.query.size(); ++i) {
+      url += (i == 0 ? "?" : "&") + S3UriEncode(call.query[i].first, true) + "=" +
+             S3UriEncode(call.query[i].second, true);
+    }
+
+    internal::S3SigningRequest signing;
+    signing.method = call.method;
+    signing.canonical_uri = canonical_uri;
+    signing.query = call.query;
+    signing.payload_hash =
+        internal::Sha256Hex(call.body, static_cast<size_t>(call.body_size));
+    const std::string amz_date = AmzDate();
+    signing.headers = call.headers;
+    signing.headers.emplace_back("host", host_);
+    signing.headers.emplace_back("x-amz-date", amz_date);
+    signing.headers.emplace_back("x-amz-content-sha256", signing.payload_hash);
+    if (!options_.session_token.empty()) {
+      signing.headers.emplace_back("x-amz-security-token", options_.session_token);
+    }
+
+    struct curl_slist* headers = nullptr;
+    bool has_content_type = false;
+    for (const auto& header : signing.headers) {
+      headers = curl_slist_append(headers, (header.first + ": " + header.second).c_str());
+      has_content_type = has_content_type || header.first == "content-type";
+    }
+    if (!options_.access_key.empty()) {
+      const std::string authorization =
+          internal::S3Authorization(signing, options_.access_key, options_.secret_key,
+                                    options_.region, amz_date);
+      headers = curl_slist_append(headers, ("Authorization: " + authorization).c_str());
+    }
+    // Disable the headers curl adds by default
+    headers = curl_slist_append(headers, "Expect:");
+    if (!has_content_type) {
+      headers = curl_slist_append(headers, "Content-Type:");
+    }
+
+    CURL* curl = AcquireHandle();
+    if (curl == nullptr) {
+      curl_slist_free_all(headers);
+      return Status::IOError("Failed to create a curl handle");
+    }
+    ResponseWriter writer = {curl, response, call.out, call.out_capacity};
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &writer);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, response);
+    if (call.method == "HEAD") {
+      curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+    } else if (call.method != "GET") {
+      curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, call.method.c_str());
+    }
+    if (call.method == "PUT" || call.method == "POST") {
+      const char* body =
+          call.body == nullptr ? "" : reinterpret_cast<const char*>(call.body);
+      curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body);
+      curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE,
+                       static_cast<curl_off_t>(call.body_size));
+    }
+
+    char error[CURL_ERROR_SIZE] = "";
+    curl_easy_setopt(curl, CURLOPT_ERRORBUFFER, error);
+    const CURLcode code = curl_easy_perform(curl);
+    long status_code = 0;  // NOLINT
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status_code);
+    response->status_code = status_code;
+
+    curl_slist_free_all(headers);
+    ReleaseHandle(curl);
+
+    if (code != CURLE_OK) {
+      std::stringstream ss;
+      ss << "S3 request " << call.method << " " << url << " failed: "
+         << (error[0] != '\0' ? error : curl_easy_strerror(code));
+      return Status::IOError(ss.str());
+    }
+    return Status::OK();
+  }
+
+  // Handles are reused so that their connections are kept alive
+  CURL* AcquireHandle() {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      if (!idle_handles_.empty()) {
+        CURL* handle = idle_handles_.back();
+        idle_handles_.pop_back();
+        curl_easy_reset(handle);
+        return handle;
+      }
+    }
+    return curl_easy_init();
+  }
+
+  void ReleaseHandle(CURL* handle) {
+    std::lock_guard<std::mutex> guard(lock_);
+    idle_handles_.push_back(handle);
+  }
+
+  S3Options options_;
+  std::string endpoint_;
+  std::string host_;
+
+  std::mutex lock_;
+  std::vector<CURL*> idle_handles_;
+};
+
+namespace {
+
+// Read a range of an object into out, returning the number of bytes read
+Status GetObjectRange(S3Client* client, const std::string& bucket,
+                      const std::string& key, int64_t position, int64_t nbytes,
+                      int64_t* bytes_read, uint8_t* out) {
+  if (nbytes == 0) {
+    *bytes_read = 0;
+    return Status::OK();
+  }
+  S3Call call("GET", bucket, key);
+  std::stringstream range;
+  range << "bytes=" << position << "-" << (position + nbytes - 1);
+  call.headers.emplace_back("range", range.str());
+  call.out = out;
+  call.out_capacity = nbytes;
+
+  S3Response response;
+  RETURN_NOT_OK(client->Call(call, &response));
+  *bytes_read = response.out_size;
+  return Status::OK();
+}
+
+// A range fetched in the background. Whichever thread gets to it first,
+// the I/O thread pool or a reader, fetches it
+struct PrefetchedRange {
+  ReadRange range;
+  std::shared_ptr<ResizableBuffer> buffer;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool started = false;
+  bool done = false;
+  Status status;
+};
+
+void FetchRange(S3Client* client, const std::string& bucket, const std::string& key,
+                PrefetchedRange* prefetch) {
+  {
+    std::lock_guard<std::mutex> guard(prefetch->mutex);
+    if (prefetch->started) {
+      return;
+    }
+    prefetch->started = true;
+  }
+  int64_t bytes_read = 0;
+  Status st = GetObjectRange(client, bucket, key, prefetch->range.offset,
+                             prefetch->range.length, &bytes_read,
+                             prefetch->buffer->mutable_data());
+  if (st.ok() && bytes_read < prefetch->range.length) {
+    st = prefetch->buffer->Resize(bytes_read);
+  }
+
+  std::lock_guard<std::mutex> guard(prefetch->mutex);
+  prefetch->status = st;
+  prefetch->done = true;
+  prefetch->cv.notify_all();
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// S3ReadableFile implementation
+
+class S3ReadableFile::S3ReadableFileImpl {
+ public:
+  S3ReadableFileImpl(const std::shared_ptr<S3Client>& client, const std::string& bucket,
+                     const std::string& key, MemoryPool* pool)
+      : client_(client),
+        bucket_(bucket),
+        key_(key),
+        pool_(pool),
+        size_(0),
+        position_(0),
+        is_open_(false) {}
+
+  Status Open() {
+    S3Call call("HEAD", bucket_, key_);
+    S3Response response;
+    RETURN_NOT_OK(client_->Perform(call, &response));
+    if (response.status_code == 404) {
+      return Status::IOError("Path does not exist: " + bucket_ + "/" + key_);
+    }
+    if (!response.ok()) {
+      return S3Client::ErrorStatus(call, response);
+    }
+    RETURN_NOT_OK(ParseInt(response.headers["content-length"], &size_));
+    is_open_ = true;
+    return Status::OK();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(prefetch_lock_);
+    prefetched_.clear();
+    is_open_ = false;
+    return Status::OK();
+  }
+
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::IOError("Operation on closed S3 file");
+    }
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(ClampRange(position, &nbytes));
+
+    std::shared_ptr<Buffer> prefetched;
+    RETURN_NOT_OK(ReadPrefetched(position, nbytes, &prefetched));
+    if (prefetched) {
+      memcpy(out, prefetched->data(), static_cast<size_t>(nbytes));
+      *bytes_read = nbytes;
+      return Status::OK();
+    }
+
+    if (nbytes >= 2 * client_->options().range_request_size) {
+      return ParallelReadAt(position, nbytes, bytes_read, out);
+    }
+    return GetObjectRange(client_.get(), bucket_, key_, position, nbytes, bytes_read,
+                          out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(ClampRange(position, &nbytes));
+
+    std::shared_ptr<Buffer> prefetched;
+    RETURN_NOT_OK(ReadPrefetched(position, nbytes, &prefetched));
+    if (prefetched) {
+      *out = prefetched;
+      return Status::OK();
+    }
+
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(ReadAt(position, nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    std::lock_guard<std::mutex> guard(position_lock_);
+    RETURN_NOT_OK(ReadAt(position_, nbytes, bytes_read, out));
+    position_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(position_lock_);
+    RETURN_NOT_OK(ReadAt(position_, nbytes, out));
+    position_ += (*out)->size();
+    return Status::OK();
+  }
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::vector<ReadRange> sorted;
+    for (ReadRange range : ranges) {
+      if (range.offset < 0 || range.length < 0) {
+        return Status::Invalid("Invalid read range");
+      }
+      range.length = std::min(range.length, size_ - std::min(range.offset, size_));
+      if (range.length > 0) {
+        sorted.push_back(range);
+      }
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const ReadRange& a, const ReadRange& b) {
+      return a.offset < b.offset;
+    });
+
+    // Coalesce ranges separated by small holes, since the latency of a GET
+    // outweighs transferring a few unneeded bytes, up to the range request size
+    const S3Options& options = client_->options();
+    std::vector<ReadRange> coalesced;
+    for (const ReadRange& range : sorted) {
+      if (!coalesced.empty()) {
+        ReadRange& last = coalesced.back();
+        const int64_t last_end = last.offset + last.length;
+        const int64_t end = std::max(last_end, range.offset + range.length);
+        if (range.offset - last_end <= options.coalesce_hole_size &&
+            (end - last.offset <= options.range_request_size || end == last_end)) {
+          last.length = end - last.offset;
+          continue;
+        }
+      }
+      coalesced.push_back(range);
+    }
+
+    std::vector<std::shared_ptr<PrefetchedRange>> prefetched;
+    for (const ReadRange& range : coalesced) {
+      auto prefetch = std::make_shared<PrefetchedRange>();
+      prefetch->range = range;
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, range.length, &prefetch->buffer));
+      prefetched.push_back(prefetch);
+    }
+
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    for (const auto& prefetch : prefetched) {
+      std::shared_ptr<S3Client> client = client_;
+      const std::string bucket = bucket_;
+      const std::string key = key_;
+      RETURN_NOT_OK(pool->Spawn([client, bucket, key, prefetch]() {
+        FetchRange(client.get(), bucket, key, prefetch.get());
+      }));
+    }
+
+    std::lock_guard<std::mutex> guard(prefetch_lock_);
+    prefetched_ = std::move(prefetched);
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot seek to negative position");
+    }
+    std::lock_guard<std::mutex> guard(position_lock_);
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    RETURN_NOT_OK(CheckClosed());
+    std::lock_guard<std::mutex> guard(position_lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) {
+    RETURN_NOT_OK(CheckClosed());
+    *size = size_;
+    return Status::OK();
+  }
+
+ private:
+  struct ParallelRead {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t next_piece;
+    int64_t pieces_done;
+    std::vector<int64_t> piece_bytes_read;
+    Status status;
+  };
+
+  Status ClampRange(int64_t position, int64_t* nbytes) const {
+    if (position < 0 || *nbytes < 0) {
+      return Status::Invalid("Invalid read range");
+    }
+    *nbytes = std::min(*nbytes, size_ - std::min(position, size_));
+    return Status::OK();
+  }
+
+  // Return a slice of a fetched range containing the read, waiting for it
+  // or fetching it if needed. Returns null if no range contains the read
+  Status ReadPrefetched(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<PrefetchedRange> prefetch;
+    {
+      std::lock_guard<std::mutex> guard(prefetch_lock_);
+      for (const auto& candidate : prefetched_) {
+        if (candidate->range.offset <= position &&
+            position + nbytes <= candidate->range.offset + candidate->range.length) {
+          prefetch = candidate;
+          break;
+        }
+      }
+    }
+    if (!prefetch || nbytes == 0) {
+      return Status::OK();
+    }
+
+    // Fetch it ourselves if the I/O thread pool has not started it, instead
+    // of waiting on a queued task
+    FetchRange(client_.get(), bucket_, key_, prefetch.get());
+    std::unique_lock<std::mutex> lock(prefetch->mutex);
+    prefetch->cv.wait(lock, [&prefetch]() { return prefetch->done; });
+    RETURN_NOT_OK(prefetch->status);
+
+    const int64_t offset = position - prefetch->range.offset;
+    if (offset + nbytes > prefetch->buffer->size()) {
+      // The object shrank since it was opened
+      return Status::IOError("Unexpected end of S3 object " + bucket_ + "/" + key_);
+    }
+    *out = SliceBuffer(prefetch->buffer, offset, nbytes);
+    return Status::OK();
+  }
+
+  // Read a large range with several GETs at once. The calling thread makes
+  // GETs too and only waits for those other threads started, so it cannot
+  // deadlock when called from the I/O thread pool
+  Status ParallelReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                        uint8_t* out) {
+    const int64_t piece_size = client_->options().range_request_size;
+    const int64_t num_pieces = (nbytes + piece_size - 1) / piece_size;
+
+    auto state = std::make_shared<ParallelRead>();
+    state->next_piece = 0;
+    state->pieces_done = 0;
+    state->piece_bytes_read.resize(num_pieces, 0);
+
+    std::shared_ptr<S3Client> client = client_;
+    const std::string bucket = bucket_;
+    const std::string key = key_;
+    auto read_pieces = [client, bucket, key, state, position, nbytes, out, piece_size,
+                        num_pieces]() {
+      while (true) {
+        int64_t piece;
+        {
+          std::lock_guard<std::mutex> guard(state->mutex);
+          if (state->next_piece == num_pieces || !state->status.ok()) {
+            return;
+          }
+          piece = state->next_piece++;
+        }
+        const int64_t offset = piece * piece_size;
+        int64_t piece_read = 0;
+        Status st = GetObjectRange(client.get(), bucket, key, position + offset,
+                                   std::min(piece_size, nbytes - offset), &piece_read,
+                                   out + offset);
+        std::lock_guard<std::mutex> guard(state->mutex);
+        state->piece_bytes_read[piece] = piece_read;
+        if (!st.ok() && state->status.ok()) {
+          state->status = st;
+        }
+        ++state->pieces_done;
+        state->cv.notify_all();
+      }
+    };
+
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    for (int64_t i = 1; i < num_pieces; ++i) {
+      RETURN_NOT_OK(pool->Spawn(read_pieces));
+    }
+    read_pieces();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&state]() { return state->pieces_done == state->next_piece; });
+    RETURN_NOT_OK(state->status);
+
+    // The pieces are contiguous up to the first short one
+    int64_t total_bytes = 0;
+    for (int64_t i = 0; i < num_pieces; ++i) {
+      total_bytes += state->piece_bytes_read[i];
+      if (state->piece_bytes_read[i] < std::min(piece_size, nbytes - i * piece_size)) {
+        break;
+      }
+    }
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  std::shared_ptr<S3Client> client_;
+  std::string bucket_;
+  std::string key_;
+  MemoryPool* pool_;
+  int64_t size_;
+
+  mutable std::mutex position_lock_;
+  int64_t position_;
+  bool is_open_;
+
+  std::mutex prefetch_lock_;
+  std::vector<std::shared_ptr<PrefetchedRange>> prefetched_;
+};
+
+S3ReadableFile::S3ReadableFile() {}
+
+S3ReadableFile::~S3ReadableFile() { DCHECK(impl_->Close().ok()); }
+
+Status S3ReadableFile::Close() { return impl_->Close(); }
+
+Status S3ReadableFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+Status S3ReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* buffer) {
+  return impl_->Read(nbytes, bytes_read, reinterpret_cast<uint8_t*>(buffer));
+}
+
+Status S3ReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status S3ReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                              void* buffer) {
+  return impl_->ReadAt(position, nbytes, bytes_read, reinterpret_cast<uint8_t*>(buffer));
+}
+
+Status S3ReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                              std::shared_ptr<Buffer>* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Status S3ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return impl_->WillNeed(ranges);
+}
+
+bool S3ReadableFile::supports_zero_copy() const { return false; }
+
+Status S3ReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status S3ReadableFile::Tell(int64_t* position) const { return impl_->Tell(position); }
+
+// ----------------------------------------------------------------------
+// S3OutputStream implementation
+
+class S3OutputStream::S3OutputStreamImpl {
+ public:
+  S3OutputStreamImpl(const std::shared_ptr<S3Client>& client, const std::string& bucket,
+                     const std::string& key, MemoryPool* pool)
+      : client_(client),
+        bucket_(bucket),
+        key_(key),
+        pool_(pool),
+        part_size_(client->options().part_size),
+        buffered_(0),
+        position_(0),
+        next_part_number_(1),
+        is_open_(true),
+        uploads_(std::make_shared<Uploads>()) {}
+
+  Status Open() { return AllocateResizableBuffer(pool_, part_size_, &part_); }
+
+  Status Write(const void* data, int64_t nbytes) {
+    if (!is_open_) {
+      return Status::IOError("Operation on closed S3 stream");
+    }
+    auto bytes = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      const int64_t chunk = std::min(nbytes, part_size_ - buffered_);
+      memcpy(part_->mutable_data() + buffered_, bytes, static_cast<size_t>(chunk));
+      buffered_ += chunk;
+      position_ += chunk;
+      bytes += chunk;
+      nbytes -= chunk;
+      if (buffered_ == part_size_) {
+        RETURN_NOT_OK(UploadPart());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (!is_open_) {
+      return Status::OK();
+    }
+    is_open_ = false;
+
+    if (upload_id_.empty()) {
+      // Small enough for a single request
+      S3Call call("PUT", bucket_, key_);
+      call.body = part_->data();
+      call.body_size = buffered_;
+      Status st = client_->Call(call);
+      part_.reset();
+      return st;
+    }
+
+    Status st;
+    if (buffered_ > 0) {
+      st = UploadPart();
+    }
+    part_.reset();
+    Status upload_status = WaitForUploads();
+    if (st.ok()) {
+      st = upload_status;
+    }
+    if (st.ok()) {
+      st = CompleteUpload();
+    }
+    if (!st.ok()) {
+      S3Call call("DELETE", bucket_, key_);
+      call.query.emplace_back("uploadId", upload_id_);
+      client_->Call(call);
+    }
+    return st;
+  }
+
+  Status Tell(int64_t* position) const {
+    if (!is_open_) {
+      return Status::IOError("Operation on closed S3 stream");
+    }
+    *position = position_;
+    return Status::OK();
+  }
+
+ private:
+  struct Part {
+    int64_t number;
+    std::shared_ptr<Buffer> data;
+  };
+
+  // Parts queued or being uploaded, shared with the I/O thread pool
+  struct Uploads {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Part> pending;
+    int64_t in_progress = 0;
+    // ETags by part number
+    std::vector<std::string> etags;
+    Status status;
+  };
+
+  Status UploadPart() {
+    if (upload_id_.empty()) {
+      S3Call call("POST", bucket_, key_);
+      call.query.emplace_back("uploads", "");
+      S3Response response;
+      RETURN_NOT_OK(client_->Call(call, &response));
+      upload_id_ = XmlText(response.body, "UploadId");
+      if (upload_id_.empty()) {
+        return Status::IOError("S3 did not return an upload id for " + bucket_ + "/" +
+                               key_);
+      }
+    }
+    if (next_part_number_ > kMaxParts) {
+      return Status::IOError("S3 object too large for its part size: " + bucket_ + "/" +
+                             key_);
+    }
+
+    Part part = {next_part_number_++, SliceBuffer(part_, 0, buffered_)};
+    {
+      std::lock_guard<std::mutex> guard(uploads_->mutex);
+      RETURN_NOT_OK(uploads_->status);
+      uploads_->pending.push_back(part);
+      uploads_->etags.resize(part.number);
+    }
+    buffered_ = 0;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, part_size_, &part_));
+
+    std::shared_ptr<S3Client> client = client_;
+    std::shared_ptr<Uploads> uploads = uploads_;
+    const std::string bucket = bucket_;
+    const std::string key = key_;
+    const std::string upload_id = upload_id_;
+    RETURN_NOT_OK(::arrow::internal::GetIOThreadPool()->Spawn(
+        [client, uploads, bucket, key, upload_id]() {
+          while (UploadNextPart(client.get(), uploads.get(), bucket, key, upload_id)) {
+          }
+        }));
+
+    // Bound the parts in memory. Upload queued parts ourselves rather than
+    // wait for the I/O thread pool to start them
+    std::unique_lock<std::mutex> lock(uploads_->mutex);
+    while (static_cast<int64_t>(uploads_->pending.size()) + uploads_->in_progress >
+           client_->options().max_concurrent_uploads) {
+      if (!uploads_->pending.empty()) {
+        lock.unlock();
+        UploadNextPart(client_.get(), uploads_.get(), bucket_, key_, upload_id_);
+        lock.lock();
+      } else {
+        uploads_->cv.wait(lock);
+      }
+    }
+    return uploads_->status;
+  }
+
+  // Upload a queued part, returning false if there was none
+  static bool UploadNextPart(S3Client* client, Uploads* uploads,
+                             const std::string& bucket, const std::string& key,
+                             const std::string& upload_id) {
+    Part part;
+    {
+      std::lock_guard<std::mutex> guard(uploads->mutex);
+      if (uploads->pending.empty()) {
+        return false;
+      }
+      part = uploads->pending.front();
+      uploads->pending.pop_front();
+      ++uploads->in_progress;
+    }
+
+
+    Status st;
+    S3Response response;
+    bool failed;
+    {
+      std::lock_guard<std::mutex> guard(uploads->mutex);
+      failed = !uploads->status.ok();
+    }
+    // Once a part failed, the upload is aborted anyway
+    if (!failed) {
+      S3Call call("PUT", bucket, key);
+      call.query.emplace_back("partNumber", std::to_string(part.number));
+      call.query.emplace_back("uploadId", upload_id);
+      call.body = part.data->data();
+      call.body_size = part.data->size();
+      st = client->Call(call, &response);
+    }
+
+    std::lock_guard<std::mutex> guard(uploads->mutex);
+    if (st.ok()) {
+      uploads->etags[part.number - 1] = response.headers["etag"];
+    } else if (uploads->status.ok()) {
+      uploads->status = st;
+    }
+    --uploads->in_progress;
+    uploads->cv.notify_all();
+    return true;
+  }
+
+  Status WaitForUploads() {
+    while (UploadNextPart(client_.get(), uploads_.get(), bucket_, key_, upload_id_)) {
+    }
+    std::unique_lock<std::mutex> lock(uploads_->mutex);
+    uploads_->cv.wait(lock, [this]() { return uploads_->in_progress == 0; });
+    return uploads_->status;
+  }
+
+  Status CompleteUpload() {
+    std::stringstream body;
+    body << "<CompleteMultipartUpload>";
+    for (size_t i = 0; i < uploads_->etags.size(); ++i) {
+      body << "<Part><PartNumber>" << (i + 1) << "</PartNumber><ETag>"
+           << uploads_->etags[i] << "</ETag></Part>";
+    }
+    body << "</CompleteMultipartUpload>";
+    const std::string xml = body.str();
+
+    S3Call call("POST", bucket_, key_);
+    call.query.emplace_back("uploadId", upload_id_);
+    call.headers.emplace_back("content-type", "application/xml");
+    call.body = reinterpret_cast<const uint8_t*>(xml.data());
+    call.body_size = static_cast<int64_t>(xml.size());
+    S3Response response;
+    RETURN_NOT_OK(client_->Call(call, &response));
+    // Errors after the response started are reported in a successful one
+    if (!XmlElements(response.body, "Error").empty()) {
+      response.status_code = 500;
+      return S3Client::ErrorStatus(call, response);
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<S3Client> client_;
+  std::string bucket_;
+  std::string key_;
+  MemoryPool* pool_;
+  const int64_t part_size_;
+
+  std::shared_ptr<ResizableBuffer> part_;
+  int64_t buffered_;
+  int64_t position_;
+
+  std::string upload_id_;
+  int64_t next_part_number_;
+  bool is_open_;
+  std::shared_ptr<Uploads> uploads_;
+};
+
+S3OutputStream::S3OutputStream() {}
+
+S3OutputStream::~S3OutputStream() { DCHECK(impl_->Close().ok()); }
+
+Status S3OutputStream::Close() { return impl_->Close(); }
+
+Status S3OutputStream::Write(const void* buffer, int64_t nbytes) {
+  return impl_->Write(buffer, nbytes);
+}
+
+Status S3OutputStream::Tell(int64_t* position) const { return impl_->Tell(position); }
+
+// ----------------------------------------------------------------------
+// S3FileSystem implementation
+
+class S3FileSystem::S3FileSystemImpl {
+ public:
+  explicit S3FileSystemImpl(const S3Options& options)
+      : client_(std::make_shared<S3Client>(options)) {}
+
+  Status MakeDirectory(const std::string& path) {
+    std::string bucket, key;
+    RETURN_NOT_OK(SplitBucketPath(path, &bucket, &key));
+    if (key.empty()) {
+      return CreateBucket(bucket);
+    }
+    return client_->Call(S3Call("PUT", bucket, key + "/"));
+  }
+
+  Status DeleteDirectory(const std::string& path) {
+    std::string bucket, key;
+    RETURN_NOT_OK(SplitBucketPath(path, &bucket, &key));
+
+    FileStatistics stat;
+    RETURN_NOT_OK(Stat(path, &stat));
+    if (stat.kind != ObjectType::DIRECTORY) {
+      return Status::IOError("Not a directory: " + path);
+    }
+
+    std::vector<FileEntry> objects;
+    RETURN_NOT_OK(ListObjects(bucket, key, true, &objects));
+    for (const FileEntry& object : objects) {
+      RETURN_NOT_OK(client_->Call(S3Call("DELETE", bucket, object.path)));
+    }
+    if (key.empty()) {
+      return client_->Call(S3Call("DELETE", bucket, ""));
+    }
+    // The marker, if any. Deleting a missing object succeeds
+    return client_->Call(S3Call("DELETE", bucket, key + "/"));
+  }
+
+  Status DeleteFile(const std::string& path) {
+    std::string bucket, key;
+    RETURN_NOT_OK(SplitObjectPath(path, &bucket, &key));
+    return DeleteObject(bucket, key, path);
+  }
+
+  Status GetChildrenStats(const std::string& path, std::vector<FileEntry>* listing) {
+    std::string bucket, key;
+    SplitPath(path, &bucket, &key);
+    if (bucket.empty()) {
+      return ListBuckets(listing);
+    }
+
+    std::vector<FileEntry> children;
+    RETURN_NOT_OK(ListObjects(bucket, key, false, &children));
+    if (children.empty()) {
+      // An empty listing of a missing path is an error, as on other file systems
+      FileStatistics stat;
+      RETURN_NOT_OK(Stat(path, &stat));
+    }
+    for (FileEntry& child : children) {
+      child.path = bucket + "/" + child.path;
+      listing->push_back(std::move(child));
+    }
+    return Status::OK();
+  }
+
+  Status Rename(const std::string& src, const std::string& dst) {
+    std::string src_bucket, src_key, dst_bucket, dst_key;
+    RETURN_NOT_OK(SplitObjectPath(src, &src_bucket, &src_key));
+    RETURN_NOT_OK(SplitObjectPath(dst, &dst_bucket, &dst_key));
+
+    FileStatistics stat;
+    RETURN_NOT_OK(Stat(src, &stat));
+    if (stat.kind == ObjectType::DIRECTORY) {
+      return Status::NotImplemented("Cannot rename S3 directories");
+    }
+
+    S3Call call("PUT", dst_bucket, dst_key);
+    call.headers.emplace_back("x-amz-copy-source",
+                              "/" + S3UriEncode(src_bucket + "/" + src_key, false));
+    S3Response response;
+    RETURN_NOT_OK(client_->Call(call, &response));
+    if (!XmlElements(response.body, "Error").empty()) {
+      response.status_code = 500;
+      return S3Client::ErrorStatus(call, response);
+    }
+    return client_->Call(S3Call("DELETE", src_bucket, src_key));
+  }
+
+  Status Stat(const std::string& path, FileStatistics* stat) {
+    std::string bucket, key;
+    SplitPath(path, &bucket, &key);
+    if (bucket.empty()) {
+      stat->kind = ObjectType::DIRECTORY;
+      stat->size = 0;
+      return Status::OK();
+    }
+
+    S3Call call("HEAD", bucket, key);
+    S3Response response;
+    RETURN_NOT_OK(client_->Perform(call, &response));
+    if (response.ok()) {
+      stat->kind = key.empty() ? ObjectType::DIRECTORY : ObjectType::FILE;
+      stat->size = 0;
+      if (!key.empty()) {
+        RETURN_NOT_OK(ParseInt(response.headers["content-length"], &stat->size));
+      }
+      return Status::OK();
+    }
+    if (response.status_code != 404) {
+      return S3Client::ErrorStatus(call, response);
+    }
+
+    if (!key.empty()) {
+      // Not an object, but maybe a prefix of some
+      std::vector<FileEntry> children;
+      RETURN_NOT_OK(ListObjects(bucket, key, false, &children, 1));
+      if (!children.empty() || ObjectExists(bucket, key + "/")) {
+        stat->kind = ObjectType::DIRECTORY;
+        stat->size = 0;
+        return Status::OK();
+      }
+    }
+    return Status::IOError("Path does not exist: " + path);
+  }
+
+  Status OpenReadable(const std::string& path, MemoryPool* pool,
+                      std::shared_ptr<S3ReadableFile>* file) {
+    std::string bucket, key;
+    RETURN_NOT_OK(SplitObjectPath(path, &bucket, &key));
+
+    std::shared_ptr<S3ReadableFile> result(new S3ReadableFile());
+    result->impl_.reset(
+        new S3ReadableFile::S3ReadableFileImpl(client_, bucket, key, pool));
+    RETURN_NOT_OK(result->impl_->Open());
+    *file = result;
+    return Status::OK();
+  }
+
+  Status OpenWriteable(const std::string& path, std::shared_ptr<S3OutputStream>* file) {
+    std::string bucket, key;
+    RETURN_NOT_OK(SplitObjectPath(path, &bucket, &key));
+
+    std::shared_ptr<S3OutputStream> result(new S3OutputStream());
+    result->impl_.reset(new S3OutputStream::S3OutputStreamImpl(client_, bucket, key,
+                                                               default_memory_pool()));
+    RETURN_NOT_OK(result->impl_->Open());
+    *file = result;
+    return Status::OK();
+  }
+
+ private:
+  Status SplitBucketPath(const std::string& path, std::string* bucket, std::string* key) {
+    SplitPath(path, bucket, key);
+    if (bucket->empty()) {
+      return Status::Invalid("Expected an S3 path of the form bucket[/key], got '" +
+                             path + "'");
+    }
+    return Status::OK();
+  }
+
+  Status SplitObjectPath(const std::string& path, std::string* bucket, std::string* key) {
+    SplitPath(path, bucket, key);
+    if (bucket->empty() || key->empty()) {
+      return Status::Invalid("Expected an S3 path of the form bucket/key, got '" + path +
+                             "'");
+    }
+    return Status::OK();
+  }
+
+  bool ObjectExists(const std::string& bucket, const std::string& key) {
+    S3Response response;
+    return client_->Perform(S3Call("HEAD", bucket, key), &response).ok() &&
+           response.ok();
+  }
+
+  Status CreateBucket(const std::string& bucket) {
+    S3Call call("PUT", bucket, "");
+    std::string xml;
+    if (client_->options().region != "us-east-1") {
+      xml = "<CreateBucketConfiguration><LocationConstraint>" +
+            client_->options().region +
+            "</LocationConstraint></CreateBucketConfiguration>";
+      call.body = reinterpret_cast<const uint8_t*>(xml.data());
+      call.body_size = static_cast<int64_t>(xml.size());
+    }
+    S3Response response;
+    RETURN_NOT_OK(client_->Perform(call, &response));
+    if (!response.ok() && XmlText(response.body, "Code") != "BucketAlreadyOwnedByYou") {
+      return S3Client::ErrorStatus(call, response);
+    }
+    return Status::OK();
+  }
+
+  Status DeleteObject(const std::string& bucket, const std::string& key,
+                      const std::string& path) {
+    // Deleting a missing object succeeds, so check first
+    S3Call call("HEAD", bucket, key);
+    S3Response response;
+    RETURN_NOT_OK(client_->Perform(call, &response));
+    if (response.status_code == 404) {
+      return Status::IOError("Path does not exist: " + path);
+    }
+    return client_->Call(S3Call("DELETE", bucket, key));
+  }
+
+  Status ListBuckets(std::vector<FileEntry>* listing) {
+    S3Response response;
+    RETURN_NOT_OK(client_->Call(S3Call("GET", "", ""), &response));
+    for (const std::string& bucket : XmlElements(response.body, "Bucket")) {
+      FileEntry entry;
+      entry.path = XmlText(bucket, "Name");
+      entry.stat.kind = ObjectType::DIRECTORY;
+      entry.stat.size = 0;
+      listing->push_back(entry);
+    }
+    return Status::OK();
+  }
+
+  // List the keys under a directory, with the paths of the entries being
+  // keys. Without recursive, keys further down are grouped into directories.
+  // A positive limit stops the listing once it has that many entries
+  Status ListObjects(const std::string& bucket, const std::string& key, bool recursive,
+                     std::vector<FileEntry>* entries, int64_t limit = 0) {
+    const std::string prefix = key.empty() ? "" : key + "/";
+    std::string continuation_token;
+    do {
+      S3Call call("GET", bucket, "");
+      call.query.emplace_back("list-type", "2");
+      call.query.emplace_back("prefix", prefix);
+      if (limit > 0) {
+        call.query.emplace_back("max-keys", std::to_string(limit));
+      }
+      if (!recursive) {
+        call.query.emplace_back("delimiter", "/");
+      }
+      if (!continuation_token.empty()) {
+        call.query.emplace_back("continuation-token", continuation_token);
+      }
+      S3Response response;
+      RETURN_NOT_OK(client_->Call(call, &response));
+
+      for (const std::string& contents : XmlElements(response.body, "Contents")) {
+        FileEntry entry;
+        entry.path = XmlText(contents, "Key");
+        if (entry.path == prefix) {
+          // The marker of the directory itself
+          continue;
+        }
+        entry.stat.kind =
+            entry.path.back() == '/' ? ObjectType::DIRECTORY : ObjectType::FILE;
+        RETURN_NOT_OK(ParseInt(XmlText(contents, "Size"), &entry.stat.size));
+        entries->push_back(entry);
+      }
+      for (const std::string& common : XmlElements(response.body, "CommonPrefixes")) {
+        FileEntry entry;
+        entry.path = XmlText(common, "Prefix");
+        entry.path.pop_back();
+        entry.stat.kind = ObjectType::DIRECTORY;
+        entry.stat.size = 0;
+        entries->push_back(entry);
+      }
+
+      if (XmlText(response.body, "IsTruncated") != "true" ||
+          (limit > 0 && static_cast<int64_t>(entries->size()) >= limit)) {
+        break;
+      }
+      continuation_token = XmlText(response.body, "NextContinuationToken");
+    } while (!continuation_token.empty());
+    return Status::OK();
+  }
+
+  std::shared_ptr<S3Client> client_;
+};
+
+S3FileSystem::S3FileSystem() {}
+
+S3FileSystem::~S3FileSystem() {}
+
+Status S3FileSystem::Connect(const S3Options& options,
+                             std::shared_ptr<S3FileSystem>* fs) {
+  if (options.part_size < kMinPartSize) {
+    return Status::Invalid("S3 part size must be at least 5MB");
+  }
+  if (options.range_request_size <= 0 || options.max_concurrent_uploads <= 0 ||
+      options.max_retries < 0) {
+    return Status::Invalid("Invalid S3 options");
+  }
+  std::call_once(curl_init_flag,
+                 []() { curl_init_result = curl_global_init(CURL_GLOBAL_DEFAULT); });
+  if (curl_init_result != CURLE_OK) {
+    return Status::IOError(std::string("Failed to initialize curl: ") +
+                           curl_easy_strerror(curl_init_result));
+  }
+
+  std::shared_ptr<S3FileSystem> result(new S3FileSystem());
+  result->impl_.reset(new S3FileSystemImpl(options));
+  *fs = result;
+  return Status::OK();
+}
+
+Status S3FileSystem::MakeDirectory(const std::string& path) {
+  return impl_->MakeDirectory(path);
+}
+
+Status S3FileSystem::DeleteDirectory(const std::string& path) {
+  return impl_->DeleteDirectory(path);
+}
+
+Status S3FileSystem::DeleteFile(const std::string& path) {
+  return impl_->DeleteFile(path);
+}
+
+Status S3FileSystem::GetChildren(const std::string& path,
+                                 std::vector<std::string>* listing) {
+  std::vector<FileEntry> entries;
+  RETURN_NOT_OK(impl_->GetChildrenStats(path, &entries));
+  for (const FileEntry& entry : entries) {
+    listing->push_back(entry.path);
+  }
+  return Status::OK();
+}
+
+Status S3FileSystem::GetChildrenStats(const std::string& path,
+                                      std::vector<FileEntry>* listing) {
+  return impl_->GetChildrenStats(path, listing);
+}
+
+Status S3FileSystem::Rename(const std::string& src, const std::string& dst) {
+  return impl_->Rename(src, dst);
+}
+
+Status S3FileSystem::Stat(const std::string& path, FileStatistics* stat) {
+  return impl_->Stat(path, stat);
+}
+
+Status S3FileSystem::OpenReadable(const std::string& path,
+                                  std::shared_ptr<S3ReadableFile>* file) {
+  return impl_->OpenReadable(path, default_memory_pool(), file);
+}
+
+Status S3FileSystem::OpenReadable(const std::string& path, MemoryPool* pool,
+                                  std::shared_ptr<S3ReadableFile>* file) {
+  return impl_->OpenReadable(path, pool, file);
+}
+
+Status S3FileSystem::OpenWriteable(const std::string& path,
+                                   std::shared_ptr<S3OutputStream>* file) {
+  return impl_->OpenWriteable(path, file);
+}
+
+Status S3FileSystem::OpenInputFile(const std::string& path,
+                                   std::shared_ptr<RandomAccessFile>* file) {
+  std::shared_ptr<S3ReadableFile> readable;
+  RETURN_NOT_OK(OpenReadable(path, &readable));
+  *file = readable;
+  return Status::OK();
+}
+
+Status S3FileSystem::OpenOutputStream(const std::string& path,
+                                      std::shared_ptr<OutputStream>* stream) {
+  std::shared_ptr<S3OutputStream> writeable;
+  RETURN_NOT_OK(OpenWriteable(path, &writeable));
+  *stream = writeable;
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
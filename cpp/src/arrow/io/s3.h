@@ -0,0 +1,221 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_IO_S3
+#define ARROW_IO_S3
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+class S3ReadableFile;
+class S3OutputStream;
+
+struct ARROW_EXPORT S3Options {
+  S3Options()
+      : region("us-east-1"),
+        range_request_size(1 << 23),
+        coalesce_hole_size(1 << 20),
+        part_size(1 << 23),
+        max_concurrent_uploads(4),
+        max_retries(3) {}
+
+  /// URL of the service, such as "http://localhost:9000" for an
+  /// S3-compatible store. Buckets are addressed in the path. By default, the
+  /// AWS endpoint of the region
+  std::string endpoint;
+  std::string region;
+
+  /// Credentials to sign requests with. Requests are anonymous without an
+  /// access key
+  std::string access_key;
+  std::string secret_key;
+  /// Token of temporary credentials, if any
+  std::string session_token;
+
+  /// Size of the ranged GETs a large ReadAt is split into, made concurrently
+  int64_t range_request_size;
+
+  /// Ranges passed to WillNeed are fetched together when fewer bytes than
+  /// this separate them
+  int64_t coalesce_hole_size;
+
+  /// Size of the parts of multipart uploads, at least 5MB. Smaller objects
+  /// are uploaded with a single request on Close
+  int64_t part_size;
+
+  /// Maximum number of parts an output stream uploads at once, bounding
+  /// its memory use to about (max_concurrent_uploads + 1) * part_size
+  int32_t max_concurrent_uploads;
+
+  /// Number of times a request failing with a server or network error is
+  /// retried
+  int32_t max_retries;
+};
+
+/// \class S3FileSystem
+/// \brief Objects in an S3-compatible object store
+///
+/// Paths are of the form "bucket/key". Directories are key prefixes ending
+/// in '/': they exist while they contain objects, or when created by
+/// MakeDirectory, which uploads an empty "key/" marker object. The empty
+/// path lists the buckets
+class ARROW_EXPORT S3FileSystem : public FileSystem {
+ public:
+  ~S3FileSystem() override;
+
+  /// \brief Create a client of the object store. No request is made
+  static Status Connect(const S3Options& options, std::shared_ptr<S3FileSystem>* fs);
+
+  /// Create a bucket, or a directory marker in a bucket
+  Status MakeDirectory(const std::string& path) override;
+
+  /// Delete every object under the path, and the bucket if the path is one
+  Status DeleteDirectory(const std::string& path) override;
+
+  /// Delete an object
+  Status DeleteFile(const std::string& path);
+
+  Status GetChildren(const std::string& path, std::vector<std::string>* listing) override;
+
+  /// Listing the objects returns their sizes, so this makes no per-child
+  /// requests
+  Status GetChildrenStats(const std::string& path,
+                          std::vector<FileEntry>* listing) override;
+
+  /// Copy an object server-side, then delete the source. Objects of over 5GB
+  /// and directories cannot be renamed
+  Status Rename(const std::string& src, const std::string& dst) override;
+
+  Status Stat(const std::string& path, FileStatistics* stat) override;
+
+  Status OpenReadable(const std::string& path, std::shared_ptr<S3ReadableFile>* file);
+
+  Status OpenReadable(const std::string& path, MemoryPool* pool,
+                      std::shared_ptr<S3ReadableFile>* file);
+
+  /// Start writing an object, replacing any existing one once closed
+  Status OpenWriteable(const std::string& path, std::shared_ptr<S3OutputStream>* file);
+
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<RandomAccessFile>* file) override;
+
+  Status OpenOutputStream(const std::string& path,
+                          std::shared_ptr<OutputStream>* stream) override;
+
+ private:
+  friend class S3ReadableFile;
+  friend class S3OutputStream;
+
+  class ARROW_NO_EXPORT S3FileSystemImpl;
+  std::unique_ptr<S3FileSystemImpl> impl_;
+
+  S3FileSystem();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(S3FileSystem);
+};
+
+/// \class S3ReadableFile
+/// \brief An object read with ranged GETs
+///
+/// Reads make no request past the end of the object, whose size is fetched
+/// on open. ReadAt is thread-safe
+class ARROW_EXPORT S3ReadableFile : public RandomAccessFile {
+ public:
+  ~S3ReadableFile() override;
+
+  Status Close() override;
+
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// Reads of at least twice the range request size are split into ranged
+  /// GETs made concurrently on the I/O thread pool
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* buffer) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Start fetching the ranges in the background
+  ///
+  /// Nearby ranges are coalesced into fewer GETs. Reads within a fetched
+  /// range are served from memory, zero-copy for ReadAt returning a Buffer.
+  /// Ranges fetched for an earlier call are released
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  bool supports_zero_copy() const override;
+
+  Status Seek(int64_t position) override;
+  Status Tell(int64_t* position) const override;
+
+ private:
+  S3ReadableFile();
+
+  class ARROW_NO_EXPORT S3ReadableFileImpl;
+  std::unique_ptr<S3ReadableFileImpl> impl_;
+
+  friend class S3FileSystem::S3FileSystemImpl;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(S3ReadableFile);
+};
+
+/// \class S3OutputStream
+/// \brief An object written with a multipart upload
+///
+/// Full parts are uploaded on the I/O thread pool while writing continues.
+/// The object appears only once Close succeeds; on failure the upload is
+/// aborted
+class ARROW_EXPORT S3OutputStream : public OutputStream {
+ public:
+  ~S3OutputStream() override;
+
+  Status Close() override;
+
+  Status Write(const void* buffer, int64_t nbytes) override;
+
+  Status Tell(int64_t* position) const override;
+
+ private:
+  S3OutputStream();
+
+  class ARROW_NO_EXPORT S3OutputStreamImpl;
+  std::unique_ptr<S3OutputStreamImpl> impl_;
+
+  friend class S3FileSystem::S3FileSystemImpl;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(S3OutputStream);
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_S3
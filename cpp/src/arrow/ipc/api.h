@@ -23,6 +23,7 @@
 #include "arrow/ipc/json.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/reader.h"
+#include "arrow/ipc/table-cache.h"
 #include "arrow/ipc/writer.h"
 
 #endif  // ARROW_IPC_API_H
@@ -59,6 +59,10 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Replace the dictionary with a particular id. Returns KeyError if
+  /// there is no dictionary with that id
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of dictionaries stored in the memo
@@ -24,6 +24,7 @@
 
 #include "gtest/gtest.h"
 
+#include "arrow/io/instrumented.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather.h"
@@ -31,6 +32,7 @@
 #include "arrow/pretty_print.h"
 #include "arrow/table.h"
 #include "arrow/test-util.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 namespace ipc {
@@ -305,6 +307,11 @@ TEST_F(TestTableWriter, EmptyTable) {
 
   ASSERT_EQ(0, reader_->num_rows());
   ASSERT_EQ(0, reader_->num_columns());
+
+  // The magic bytes, then the footer and the metadata
+  const io::IoStatistics stats = reader_->io_statistics();
+  ASSERT_EQ(1, stats.reads.num_calls);
+  ASSERT_EQ(2, stats.read_ats.num_calls);
 }
 
 TEST_F(TestTableWriter, SetNumRows) {
@@ -343,6 +350,120 @@ TEST_F(TestTableWriter, PrimitiveRoundTrip) {
   ASSERT_EQ("f1", col->name());
 }
 
+TEST_F(TestTableWriter, ReadTable) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  ASSERT_OK(writer_->Append("f0", *batch->column(0)));
+  ASSERT_OK(writer_->Append("f1", *batch->column(1)));
+  Finish();
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader_->Read({1, 0}, &table));
+  ASSERT_EQ(2, table->num_columns());
+  ASSERT_EQ(batch->num_rows(), table->num_rows());
+  ASSERT_EQ("f1", table->column(0)->name());
+  ASSERT_TRUE(table->column(0)->data()->chunk(0)->Equals(batch->column(1)));
+  ASSERT_EQ("f0", table->column(1)->name());
+  ASSERT_TRUE(table->column(1)->data()->chunk(0)->Equals(batch->column(0)));
+
+  ASSERT_OK(reader_->Read(&table));
+  ASSERT_EQ(2, table->num_columns());
+  ASSERT_EQ("f0", table->column(0)->name());
+  ASSERT_EQ("f1", table->column(1)->name());
+
+  ASSERT_RAISES(Invalid, reader_->Read({2}, &table));
+}
+
+TEST_F(TestTableWriter, AppendRecordBatches) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionaryFlat(&batch));
+
+  ASSERT_OK(writer_->Append(*batch));
+  ASSERT_OK(writer_->Append(*batch));
+  ASSERT_RAISES(Invalid, writer_->Append("f0", *batch->column(0)));
+  Finish();
+
+  ASSERT_EQ(2 * batch->num_rows(), reader_->num_rows());
+  ASSERT_EQ(batch->num_columns(), reader_->num_columns());
+
+  std::shared_ptr<Column> col;
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    ASSERT_OK(reader_->GetColumn(i, &col));
+    ASSERT_EQ(batch->column_name(i), col->name());
+    ASSERT_EQ(2, col->data()->num_chunks());
+    ASSERT_TRUE(col->data()->chunk(0)->Equals(batch->column(i)));
+    ASSERT_TRUE(col->data()->chunk(1)->Equals(batch->column(i)));
+  }
+}
+
+TEST_F(TestTableWriter, AppendSingleRecordBatch) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  ASSERT_OK(writer_->Append(*batch));
+  Finish();
+
+  ASSERT_EQ(batch->num_rows(), reader_->num_rows());
+  std::shared_ptr<Column> col;
+  ASSERT_OK(reader_->GetColumn(0, &col));
+  ASSERT_EQ(1, col->data()->num_chunks());
+  ASSERT_TRUE(col->data()->chunk(0)->Equals(batch->column(0)));
+}
+
+TEST_F(TestTableWriter, AppendRecordBatchAfterColumn) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  ASSERT_OK(writer_->Append("f0", *batch->column(0)));
+  ASSERT_RAISES(Invalid, writer_->Append(*batch));
+}
+
+// The codecs built in this configuration
+std::vector<Compression::type> AvailableCodecs() {
+  std::vector<Compression::type> codecs;
+  for (auto compression : {Compression::LZ4, Compression::ZSTD, Compression::SNAPPY,
+                           Compression::GZIP, Compression::BROTLI}) {
+    std::unique_ptr<Codec> codec;
+    if (Codec::Create(compression, &codec).ok()) {
+      codecs.push_back(compression);
+    }
+  }
+  return codecs;
+}
+
+TEST_F(TestTableWriter, CompressedRoundTrip) {
+  const int64_t length = 1000;
+  std::vector<bool> is_valid(length, true);
+  is_valid[10] = false;
+  std::shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int64Type, int64_t>(is_valid, std::vector<int64_t>(length, 42), &ints);
+  ArrayFromVector<StringType, std::string>(
+      is_valid, std::vector<std::string>(length, "foo"), &strings);
+
+  std::shared_ptr<RecordBatch> dict_batch;
+  ASSERT_OK(MakeDictionaryFlat(&dict_batch));
+
+  for (auto compression : AvailableCodecs()) {
+    SetUp();
+    ASSERT_OK(writer_->SetCompression(compression));
+    ASSERT_OK(writer_->Append("ints", *ints));
+    ASSERT_OK(writer_->Append("strings", *strings));
+    ASSERT_OK(writer_->Append("dict", *dict_batch->column(0)));
+    Finish();
+
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader_->Read(&table));
+    ASSERT_EQ(3, table->num_columns());
+    ASSERT_TRUE(table->column(0)->data()->chunk(0)->Equals(ints));
+    ASSERT_TRUE(table->column(1)->data()->chunk(0)->Equals(strings));
+    ASSERT_TRUE(table->column(2)->data()->chunk(0)->Equals(dict_batch->column(0)));
+  }
+
+  // Not supported by Feather
+  ASSERT_RAISES(NotImplemented, writer_->SetCompression(Compression::LZO));
+}
+
 TEST_F(TestTableWriter, CategoryRoundtrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeDictionaryFlat(&batch));
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
 #include <utility>
@@ -29,16 +30,22 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather_generated.h"
 #include "arrow/ipc/util.h"  // IWYU pragma: keep
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -92,6 +99,60 @@ static Status WritePaddedBlank(io::OutputStream* stream, int64_t length,
   return Status::OK();
 }
 
+static Status ToFlatbufferCompression(Compression::type compression,
+                                      fbs::CompressionType* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = fbs::CompressionType_UNCOMPRESSED;
+      break;
+    case Compression::LZ4:
+      *out = fbs::CompressionType_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = fbs::CompressionType_ZSTD;
+      break;
+    case Compression::SNAPPY:
+      *out = fbs::CompressionType_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = fbs::CompressionType_GZIP;
+      break;
+    case Compression::BROTLI:
+      *out = fbs::CompressionType_BROTLI;
+      break;
+    default:
+      return Status::NotImplemented("Unsupported codec for Feather compression");
+  }
+  return Status::OK();
+}
+
+static Status FromFlatbufferCompression(fbs::CompressionType compression,
+                                        Compression::type* out) {
+  switch (compression) {
+    case fbs::CompressionType_UNCOMPRESSED:
+      *out = Compression::UNCOMPRESSED;
+      break;
+    case fbs::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    case fbs::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    case fbs::CompressionType_SNAPPY:
+      *out = Compression::SNAPPY;
+      break;
+    case fbs::CompressionType_GZIP:
+      *out = Compression::GZIP;
+      break;
+    case fbs::CompressionType_BROTLI:
+      *out = Compression::BROTLI;
+      break;
+    default:
+      return Status::Invalid("Unknown Feather compression codec");
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // TableBuilder
 
@@ -183,9 +244,21 @@ Status ColumnBuilder::Finish() {
   auto values = GetPrimitiveArray(buf, values_);
   flatbuffers::Offset<void> metadata = CreateColumnMetadata();
 
+  // A column written in a single piece has no chunks, so that it reads the
+  // same as one written whole
+  flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<fbs::PrimitiveArray>>>
+      chunks = 0;
+  if (chunks_.size() > 1) {
+    std::vector<flatbuffers::Offset<fbs::PrimitiveArray>> chunk_offsets;
+    for (const ArrayMetadata& chunk : chunks_) {
+      chunk_offsets.push_back(GetPrimitiveArray(buf, chunk));
+    }
+    chunks = buf.CreateVector(chunk_offsets);
+  }
+
   auto column = fbs::CreateColumn(buf, buf.CreateString(name_), values,
                                   ToFlatbufferEnum(type_),  // metadata_type
-                                  metadata, buf.CreateString(user_metadata_));
+                                  metadata, buf.CreateString(user_metadata_), chunks);
 
   // bad coupling, but OK for now
   parent_->add_column(column);
@@ -194,6 +267,13 @@ Status ColumnBuilder::Finish() {
 
 void ColumnBuilder::SetValues(const ArrayMetadata& values) { values_ = values; }
 
+void ColumnBuilder::AddChunk(const ArrayMetadata& values) {
+  if (chunks_.empty()) {
+    values_ = values;
+  }
+  chunks_.push_back(values);
+}
+
 void ColumnBuilder::SetUserMetadata(const std::string& data) { user_metadata_ = data; }
 
 void ColumnBuilder::SetCategory(const ArrayMetadata& levels, bool ordered) {
@@ -232,8 +312,10 @@ class TableReader::TableReaderImpl {
  public:
   TableReaderImpl() {}
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& source) {
-    source_ = source;
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& raw) {
+    // Reads go through a wrapper counting them
+    RETURN_NOT_OK(io::InstrumentedRandomAccessFile::Create(raw, nullptr, &source_));
+    io::RandomAccessFile* source = source_.get();
 
     int magic_size = static_cast<int>(strlen(kFeatherMagicBytes));
     int footer_size = magic_size + static_cast<int>(sizeof(uint32_t));
@@ -344,13 +426,20 @@ class TableReader::TableReaderImpl {
                     const void* metadata, std::shared_ptr<Array>* out) {
     std::shared_ptr<DataType> type;
     RETURN_NOT_OK(GetDataType(meta, metadata_type, metadata, &type));
+    return LoadValues(meta, type, out);
+  }
 
+  Status LoadValues(const fbs::PrimitiveArray* meta,
+                    const std::shared_ptr<DataType>& type, std::shared_ptr<Array>* out) {
     std::vector<std::shared_ptr<Buffer>> buffers;
 
     // Buffer data from the source (may or may not perform a copy depending on
     // input source)
     std::shared_ptr<Buffer> buffer;
     RETURN_NOT_OK(source_->ReadAt(meta->offset(), meta->total_bytes(), &buffer));
+    if (meta->compression() != fbs::CompressionType_UNCOMPRESSED) {
+      RETURN_NOT_OK(DecompressValues(meta, &buffer));
+    }
 
     int64_t offset = 0;
 
@@ -377,6 +466,40 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
+  // Replace the data of a compressed array by its decompressed data
+  static Status DecompressValues(const fbs::PrimitiveArray* meta,
+                                 std::shared_ptr<Buffer>* buffer) {
+    Compression::type compression;
+    RETURN_NOT_OK(FromFlatbufferCompression(meta->compression(), &compression));
+    // Codecs are not thread-safe, and columns are decompressed concurrently
+    std::unique_ptr<Codec> codec;
+    RETURN_NOT_OK(Codec::Create(compression, &codec));
+
+    std::shared_ptr<Buffer> decompressed;
+    RETURN_NOT_OK(
+        AllocateBuffer(default_memory_pool(), meta->uncompressed_bytes(), &decompressed));
+    RETURN_NOT_OK(codec->Decompress((*buffer)->size(), (*buffer)->data(),
+                                    meta->uncompressed_bytes(),
+                                    decompressed->mutable_data()));
+    *buffer = decompressed;
+    return Status::OK();
+  }
+
+  static bool IsCompressed(const fbs::Column* col_meta) {
+    if (col_meta->values()->compression() != fbs::CompressionType_UNCOMPRESSED) {
+      return true;
+    }
+    auto chunks_meta = col_meta->chunks();
+    if (chunks_meta != nullptr) {
+      for (flatbuffers::uoffset_t j = 0; j < chunks_meta->size(); ++j) {
+        if (chunks_meta->Get(j)->compression() != fbs::CompressionType_UNCOMPRESSED) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
   bool HasDescription() const { return metadata_->HasDescription(); }
 
   std::string GetDescription() const { return metadata_->GetDescription(); }
@@ -399,12 +522,55 @@ class TableReader::TableReaderImpl {
     std::shared_ptr<Array> values;
     RETURN_NOT_OK(LoadValues(col_meta->values(), col_meta->metadata_type(),
                              col_meta->metadata(), &values));
-    out->reset(new Column(col_meta->name()->str(), values));
+
+    auto chunks_meta = col_meta->chunks();
+    if (chunks_meta == nullptr || chunks_meta->size() < 2) {
+      out->reset(new Column(col_meta->name()->str(), values));
+      return Status::OK();
+    }
+
+    // The chunks share the type, and category levels, of the first one
+    ArrayVector chunks = {values};
+    for (flatbuffers::uoffset_t j = 1; j < chunks_meta->size(); ++j) {
+      std::shared_ptr<Array> chunk;
+      RETURN_NOT_OK(LoadValues(chunks_meta->Get(j), values->type(), &chunk));
+      chunks.push_back(chunk);
+    }
+    out->reset(new Column(field(col_meta->name()->str(), values->type()), chunks));
+    return Status::OK();
+  }
+
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    for (int i : indices) {
+      if (i < 0 || i >= num_columns()) {
+        return Status::Invalid("Column index out of range");
+      }
+    }
+    // Zero-copy reads only slice the source, which is not worth the threads
+    // unless some columns have to be decompressed
+    bool parallel = !source_->supports_zero_copy();
+    for (int i : indices) {
+      parallel = parallel || IsCompressed(metadata_->column(i));
+    }
+    const int num_threads = parallel ? GetCpuThreadPoolCapacity() : 1;
+    const int num_indices = static_cast<int>(indices.size());
+    std::vector<std::shared_ptr<Column>> columns(num_indices);
+    RETURN_NOT_OK(ParallelFor(num_threads, num_indices, [&](int i) {
+      return GetColumn(indices[i], &columns[i]);
+    }));
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (const auto& column : columns) {
+      fields.push_back(column->field());
+    }
+    *out = Table::Make(::arrow::schema(fields), columns, num_rows());
     return Status::OK();
   }
 
+  io::IoStatistics io_statistics() const { return source_->statistics(); }
+
  private:
-  std::shared_ptr<io::RandomAccessFile> source_;
+  std::shared_ptr<io::InstrumentedRandomAccessFile> source_;
   std::unique_ptr<TableMetadata> metadata_;
 
   std::shared_ptr<Schema> schema_;
@@ -439,6 +605,18 @@ Status TableReader::GetColumn(int i, std::shared_ptr<Column>* out) {
   return impl_->GetColumn(i, out);
 }
 
+Status TableReader::Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+  return impl_->Read(indices, out);
+}
+
+Status TableReader::Read(std::shared_ptr<Table>* out) {
+  std::vector<int> indices(static_cast<size_t>(num_columns()));
+  std::iota(indices.begin(), indices.end(), 0);
+  return impl_->Read(indices, out);
+}
+
+io::IoStatistics TableReader::io_statistics() const { return impl_->io_statistics(); }
+
 // ----------------------------------------------------------------------
 // writer.cc
 
@@ -500,7 +678,12 @@ static Status SanitizeUnsupportedTypes(const Array& values, std::shared_ptr<Arra
 
 class TableWriter::TableWriterImpl : public ArrayVisitor {
  public:
-  TableWriterImpl() : initialized_stream_(false), metadata_(0) {}
+  TableWriterImpl()
+      : initialized_stream_(false),
+        metadata_(0),
+        compression_(fbs::CompressionType_UNCOMPRESSED),
+        current_column_(nullptr),
+        num_rows_(0) {}
 
   Status Open(const std::shared_ptr<io::OutputStream>& stream) {
     stream_ = stream;
@@ -511,8 +694,26 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
 
   void SetNumRows(int64_t num_rows) { metadata_.SetNumRows(num_rows); }
 
+  Status SetCompression(Compression::type compression) {
+    fbs::CompressionType fb_compression;
+    RETURN_NOT_OK(ToFlatbufferCompression(compression, &fb_compression));
+    std::unique_ptr<Codec> codec;
+    if (compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(Codec::Create(compression, &codec));
+    }
+    compression_ = fb_compression;
+    codec_ = std::move(codec);
+    return Status::OK();
+  }
+
   Status Finalize() {
     RETURN_NOT_OK(CheckStarted());
+    if (schema_) {
+      for (const auto& column : batch_columns_) {
+        RETURN_NOT_OK(column->Finish());
+      }
+      metadata_.SetNumRows(num_rows_);
+    }
     RETURN_NOT_OK(metadata_.Finish());
 
     auto buffer = metadata_.GetBuffer();
@@ -549,8 +750,45 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
   Status WriteArray(const Array& values, ArrayMetadata* meta) {
     RETURN_NOT_OK(CheckStarted());
     RETURN_NOT_OK(LoadArrayMetadata(values, meta));
+    if (!codec_) {
+      return WriteArrayData(values, stream_.get(), &meta->total_bytes);
+    }
+
+    // The data of the array is compressed as a whole, so it is first laid out
+    // in memory as it would be written uncompressed
+    std::shared_ptr<io::BufferOutputStream> scratch;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &scratch));
+    int64_t uncompressed_bytes = 0;
+    RETURN_NOT_OK(WriteArrayData(values, scratch.get(), &uncompressed_bytes));
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(scratch->Finish(&data));
+
+    const int64_t max_length = codec_->MaxCompressedLen(data->size(), data->data());
+    std::shared_ptr<Buffer> compressed;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), max_length, &compressed));
+    int64_t compressed_length = 0;
+    RETURN_NOT_OK(codec_->Compress(data->size(), data->data(), max_length,
+                                   compressed->mutable_data(), &compressed_length));
+    if (compressed_length >= data->size()) {
+      // Incompressible data is written as is
+      meta->total_bytes = data->size();
+      return stream_->Write(data->data(), data->size());
+    }
 
     int64_t bytes_written;
+    RETURN_NOT_OK(WritePadded(stream_.get(), compressed->data(), compressed_length,
+                              &bytes_written));
+    meta->total_bytes = compressed_length;
+    meta->compression = compression_;
+    meta->uncompressed_bytes = uncompressed_bytes;
+    return Status::OK();
+  }
+
+  // Write the null bitmap, offsets and values of an array to dst, adding the
+  // number of bytes written to total_bytes
+  Status WriteArrayData(const Array& values, io::OutputStream* dst,
+                        int64_t* total_bytes) {
+    int64_t bytes_written;
 
     // Write the null bitmask
     if (values.null_count() > 0) {
@@ -558,12 +796,12 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
       // byte boundary, and we write this much data into the stream
       int64_t null_bitmap_size = GetOutputLength(BitUtil::BytesForBits(values.length()));
       if (values.null_bitmap()) {
-        RETURN_NOT_OK(WritePadded(stream_.get(), values.null_bitmap()->data(),
+        RETURN_NOT_OK(WritePadded(dst, values.null_bitmap()->data(),
                                   null_bitmap_size, &bytes_written));
       } else {
-        RETURN_NOT_OK(WritePaddedBlank(stream_.get(), null_bitmap_size, &bytes_written));
+        RETURN_NOT_OK(WritePaddedBlank(dst, null_bitmap_size, &bytes_written));
       }
-      meta->total_bytes += bytes_written;
+      *total_bytes += bytes_written;
     }
 
     int64_t values_bytes = 0;
@@ -580,13 +818,13 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
 
         // Write the variable-length offsets
         RETURN_NOT_OK(
-            WritePadded(stream_.get(),
+            WritePadded(dst,
                         reinterpret_cast<const uint8_t*>(bin_values.raw_value_offsets()),
                         offset_bytes, &bytes_written));
       } else {
-        RETURN_NOT_OK(WritePaddedBlank(stream_.get(), offset_bytes, &bytes_written));
+        RETURN_NOT_OK(WritePaddedBlank(dst, offset_bytes, &bytes_written));
       }
-      meta->total_bytes += bytes_written;
+      *total_bytes += bytes_written;
 
       if (bin_values.value_data()) {
         values_buffer = bin_values.value_data()->data();
@@ -608,11 +846,11 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     }
     if (values_buffer) {
       RETURN_NOT_OK(
-          WritePadded(stream_.get(), values_buffer, values_bytes, &bytes_written));
+          WritePadded(dst, values_buffer, values_bytes, &bytes_written));
     } else {
-      RETURN_NOT_OK(WritePaddedBlank(stream_.get(), values_bytes, &bytes_written));
+      RETURN_NOT_OK(WritePaddedBlank(dst, values_bytes, &bytes_written));
     }
-    meta->total_bytes += bytes_written;
+    *total_bytes += bytes_written;
 
     return Status::OK();
   }
@@ -621,7 +859,7 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     // Prepare metadata payload
     ArrayMetadata meta;
     RETURN_NOT_OK(WriteArray(values, &meta));
-    current_column_->SetValues(meta);
+    current_column_->AddChunk(meta);
     return Status::OK();
   }
 
@@ -658,6 +896,10 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
     }
 
     RETURN_NOT_OK(WritePrimitiveValues(*values.indices()));
+    if (current_column_->num_chunks() > 1) {
+      // The levels were written with the first chunk
+      return Status::OK();
+    }
 
     ArrayMetadata levels_meta;
     std::shared_ptr<Array> sanitized_dictionary;
@@ -693,9 +935,35 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
   }
 
   Status Append(const std::string& name, const Array& values) {
-    current_column_ = metadata_.AddColumn(name);
+    if (schema_) {
+      return Status::Invalid(
+          "Cannot append a column to a file written in record batches");
+    }
+    std::unique_ptr<ColumnBuilder> column = metadata_.AddColumn(name);
+    current_column_ = column.get();
     RETURN_NOT_OK(values.Accept(this));
-    return current_column_->Finish();
+    return column->Finish();
+  }
+
+  Status Append(const RecordBatch& batch) {
+    if (!schema_) {
+      if (metadata_.num_columns() > 0) {
+        return Status::Invalid(
+            "Cannot append a record batch to a file written in columns");
+      }
+      schema_ = batch.schema();
+      for (int i = 0; i < schema_->num_fields(); ++i) {
+        batch_columns_.push_back(metadata_.AddColumn(schema_->field(i)->name()));
+      }
+    } else if (!batch.schema()->Equals(*schema_)) {
+      return Status::Invalid("Record batch schema differs from the first record batch");
+    }
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      current_column_ = batch_columns_[i].get();
+      RETURN_NOT_OK(batch.column(i)->Accept(this));
+    }
+    num_rows_ += batch.num_rows();
+    return Status::OK();
   }
 
  private:
@@ -715,7 +983,17 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
   bool initialized_stream_;
   TableBuilder metadata_;
 
-  std::unique_ptr<ColumnBuilder> current_column_;
+  // The codec of the arrays written from now on, or null
+  fbs::CompressionType compression_;
+  std::unique_ptr<Codec> codec_;
+
+  ColumnBuilder* current_column_;
+
+  // The schema and the columns of a file written in record batches, whose
+  // metadata is only written by Finalize
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::unique_ptr<ColumnBuilder>> batch_columns_;
+  int64_t num_rows_;
 
   Status AppendPrimitive(const PrimitiveArray& values, ArrayMetadata* out);
 };
@@ -734,10 +1012,16 @@ void TableWriter::SetDescription(const std::string& desc) { impl_->SetDescriptio
 
 void TableWriter::SetNumRows(int64_t num_rows) { impl_->SetNumRows(num_rows); }
 
+Status TableWriter::SetCompression(Compression::type compression) {
+  return impl_->SetCompression(compression);
+}
+
 Status TableWriter::Append(const std::string& name, const Array& values) {
   return impl_->Append(name, values);
 }
 
+Status TableWriter::Append(const RecordBatch& batch) { return impl_->Append(batch); }
+
 Status TableWriter::Finalize() { return impl_->Finalize(); }
 
 }  // namespace feather
@@ -24,19 +24,24 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
 class Array;
 class Column;
+class RecordBatch;
 class Status;
+class Table;
 
 namespace io {
 
 class OutputStream;
 class RandomAccessFile;
+struct IoStatistics;
 
 }  // namespace io
 
@@ -88,9 +93,32 @@ class ARROW_EXPORT TableReader {
   /// \param[out] out the returned column
   /// \return Status
   ///
-  /// This function is zero-copy if the file source supports zero-copy reads
+  /// This function is zero-copy if the file source supports zero-copy reads.
+  /// A column written one record batch at a time has one chunk per batch
   Status GetColumn(int i, std::shared_ptr<Column>* out);
 
+  /// \brief Read some of the columns of the file as an arrow::Table
+  ///
+  /// Unless the source supports zero-copy reads, in which case the columns
+  /// are slices of it, the columns are read concurrently on the CPU thread
+  /// pool, as reading many columns one after the other is latency-bound
+  ///
+  /// \param[in] indices the indices of the columns to read, in the order
+  /// they appear in the table
+  /// \param[out] out the read table
+  /// \return Status
+  Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out);
+
+  /// \brief Read all the columns of the file as an arrow::Table
+  ///
+  /// \param[out] out the read table
+  /// \return Status
+  Status Read(std::shared_ptr<Table>* out);
+
+  /// \brief The statistics of the reads made from the source since it was
+  /// opened
+  io::IoStatistics io_statistics() const;
+
  private:
   class ARROW_NO_EXPORT TableReaderImpl;
   std::unique_ptr<TableReaderImpl> impl_;
@@ -113,8 +141,22 @@ class ARROW_EXPORT TableWriter {
   void SetDescription(const std::string& desc);
 
   /// \brief Set the number of rows in the file
+  ///
+  /// Files written with Append(const RecordBatch&) count their rows instead
   void SetNumRows(int64_t num_rows);
 
+  /// \brief Compress the columns appended from now on
+  ///
+  /// The data of each column, or of each chunk of a column, is compressed as
+  /// a whole and the codec is recorded in the file metadata, so that
+  /// TableReader decompresses the columns transparently, and concurrently
+  /// when reading a table. Data the codec does not shrink is written
+  /// uncompressed
+  ///
+  /// \param[in] compression the codec, UNCOMPRESSED to stop compressing
+  /// \return Status, NotImplemented if the codec was not built
+  Status SetCompression(Compression::type compression);
+
   /// \brief Append a column to the file
   ///
   /// \param[in] name the column name
@@ -122,6 +164,16 @@ class ARROW_EXPORT TableWriter {
   /// \return Status
   Status Append(const std::string& name, const Array& values);
 
+  /// \brief Append the next rows of the file, one chunk per column
+  ///
+  /// The batches are written as they come, so that a large table can be
+  /// written a piece at a time without materializing it. All the batches
+  /// must have the same schema, and cannot be mixed with whole columns
+  ///
+  /// \param[in] batch the record batch to write
+  /// \return Status
+  Status Append(const RecordBatch& batch);
+
   /// \brief Finalize the file by writing the file metadata and footer
   /// \return Status
   Status Finalize();
@@ -27,7 +27,9 @@
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/json-internal.h"
+#include "arrow/ipc/json-lines.h"
 #include "arrow/ipc/json.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
@@ -415,6 +417,118 @@ TEST_P(TestJsonRoundTrip, RoundTrip) {
 
 INSTANTIATE_TEST_CASE_P(TestJsonRoundTrip, TestJsonRoundTrip, BATCH_CASES());
 
+// ----------------------------------------------------------------------
+// Line-delimited JSON
+
+using ::arrow::ipc::json::LineReader;
+using ::arrow::ipc::json::LineReadOptions;
+
+static const char* kJsonLines =
+    "{\"a\": 1, \"b\": \"x\", \"c\": true}\n"
+    "{\"a\": 2.5, \"c\": false, \"d\": 7}\n"
+    "\n"
+    "{\"b\": null, \"a\": -3}";
+
+Status ReadJsonLines(const std::string& json, const std::shared_ptr<Schema>& schema,
+                     const LineReadOptions& options, std::shared_ptr<Schema>* out_schema,
+                     std::vector<std::shared_ptr<Array>>* out_columns,
+                     int* num_batches) {
+  auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(json));
+  std::shared_ptr<LineReader> reader;
+  RETURN_NOT_OK(LineReader::Open(default_memory_pool(), input, schema, options, &reader));
+  *out_schema = reader->schema();
+
+  std::vector<ArrayVector> chunks((*out_schema)->num_fields());
+  *num_batches = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    ++*num_batches;
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      chunks[i].push_back(batch->column(i));
+    }
+  }
+  out_columns->resize(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    RETURN_NOT_OK(Concatenate(chunks[i], default_memory_pool(), &(*out_columns)[i]));
+  }
+  return Status::OK();
+}
+
+TEST(TestJsonLines, InferSchema) {
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<Array>> columns;
+  int num_batches = 0;
+  ASSERT_OK(ReadJsonLines(kJsonLines, nullptr, LineReadOptions(), &schema, &columns,
+                          &num_batches));
+
+  auto expected_schema = ::arrow::schema({field("a", float64()), field("b", utf8()),
+                                          field("c", boolean()), field("d", int64())});
+  ASSERT_TRUE(schema->Equals(*expected_schema));
+  ASSERT_EQ(1, num_batches);
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<DoubleType, double>({1, 2.5, -3}, &expected);
+  ASSERT_TRUE(columns[0]->Equals(expected));
+  ArrayFromVector<StringType, std::string>({true, false, false}, {"x", "", ""},
+                                           &expected);
+  ASSERT_TRUE(columns[1]->Equals(expected));
+  ArrayFromVector<BooleanType, bool>({true, true, false}, {true, false, false},
+                                     &expected);
+  ASSERT_TRUE(columns[2]->Equals(expected));
+  ArrayFromVector<Int64Type, int64_t>({false, true, false}, {0, 7, 0}, &expected);
+  ASSERT_TRUE(columns[3]->Equals(expected));
+}
+
+TEST(TestJsonLines, SchemaAndBlocks) {
+  // Blocks smaller than a line hold a line each
+  LineReadOptions options;
+  options.block_size = 16;
+  auto given_schema = ::arrow::schema({field("c", boolean()), field("a", float32())});
+
+  for (bool use_threads : {false, true}) {
+    options.use_threads = use_threads;
+    std::shared_ptr<Schema> schema;
+    std::vector<std::shared_ptr<Array>> columns;
+    int num_batches = 0;
+    ASSERT_OK(ReadJsonLines(kJsonLines, given_schema, options, &schema, &columns,
+                            &num_batches));
+    ASSERT_TRUE(schema->Equals(*given_schema));
+    ASSERT_EQ(3, num_batches);
+
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<BooleanType, bool>({true, true, false}, {true, false, false},
+                                       &expected);
+    ASSERT_TRUE(columns[0]->Equals(expected));
+    ArrayFromVector<FloatType, float>({1, 2.5, -3}, &expected);
+    ASSERT_TRUE(columns[1]->Equals(expected));
+  }
+}
+
+TEST(TestJsonLines, Errors) {
+  std::shared_ptr<Schema> schema;
+  std::vector<std::shared_ptr<Array>> columns;
+  int num_batches = 0;
+  LineReadOptions options;
+
+  ASSERT_RAISES(Invalid, ReadJsonLines("{\"a\": 1}\n{\"a\": \"x\"}", nullptr, options,
+                                       &schema, &columns, &num_batches));
+  auto int8_schema = ::arrow::schema({field("a", int8())});
+  ASSERT_RAISES(Invalid, ReadJsonLines("{\"a\": 300}", int8_schema, options, &schema,
+                                       &columns, &num_batches));
+  ASSERT_RAISES(NotImplemented, ReadJsonLines("{\"a\": {\"b\": 1}}", nullptr, options,
+                                              &schema, &columns, &num_batches));
+  ASSERT_RAISES(Invalid, ReadJsonLines("{\"a\": 1", nullptr, options, &schema,
+                                       &columns, &num_batches));
+  ASSERT_RAISES(Invalid, ReadJsonLines("1\n2", nullptr, options, &schema, &columns,
+                                       &num_batches));
+  ASSERT_RAISES(NotImplemented, ReadJsonLines("{\"a\": [1]}", nullptr, options, &schema,
+                                              &columns, &num_batches));
+}
+
 }  // namespace json
 }  // namespace internal
 }  // namespace ipc
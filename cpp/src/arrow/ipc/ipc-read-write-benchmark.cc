@@ -17,14 +17,36 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "arrow/api.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/test-util.h"
+#include "arrow/util/compression.h"
+
+// Count the heap allocations, to report them per batch read
+static std::atomic<int64_t> num_heap_allocations(0);
+
+void* operator new(size_t size) {
+  ++num_heap_allocations;
+  void* ptr = std::malloc(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
 
 namespace arrow {
 
@@ -116,6 +138,332 @@ static void BM_ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const r
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Read a stream of small batches from a memory map, reporting the heap
+// allocations and the bytes allocated from the memory pool per batch. As the
+// read is zero-copy, no bytes should come from the pool
+static void BM_ReadStreamFromMemoryMap(
+    benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int64_t kBatchSize = 1 << 12;
+  constexpr int kNumBatches = 64;
+  auto record_batch = MakeRecordBatch<Int64Type>(kBatchSize, state.range(0));
+
+  io::MockOutputStream mock;
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(
+      ipc::RecordBatchStreamWriter::Open(&mock, record_batch->schema(), &writer));
+  for (int i = 0; i < kNumBatches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+
+  const std::string path = "ipc-read-write-benchmark-mmap";
+  std::shared_ptr<io::MemoryMappedFile> file;
+  ABORT_NOT_OK(io::MemoryMappedFile::Create(path, mock.GetExtentBytesWritten(), &file));
+  ABORT_NOT_OK(
+      ipc::RecordBatchStreamWriter::Open(file.get(), record_batch->schema(), &writer));
+  for (int i = 0; i < kNumBatches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  ABORT_NOT_OK(file->Close());
+  ABORT_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &file));
+
+  int64_t num_allocations = 0;
+  int64_t pool_bytes = 0;
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(file->Seek(0));
+    const int64_t start_allocations = num_heap_allocations.load();
+    const int64_t start_bytes = default_memory_pool()->bytes_allocated();
+
+    std::shared_ptr<RecordBatchReader> reader;
+    ABORT_NOT_OK(ipc::RecordBatchStreamReader::Open(file.get(), &reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(batch);
+    }
+
+    pool_bytes += default_memory_pool()->bytes_allocated() - start_bytes;
+    num_allocations += num_heap_allocations.load() - start_allocations;
+  }
+  ABORT_NOT_OK(file->Close());
+  std::remove(path.c_str());
+
+  state.SetBytesProcessed(state.iterations() * kNumBatches * kBatchSize);
+  const double num_batches = static_cast<double>(state.iterations() * kNumBatches);
+  state.counters["allocations_per_batch"] =
+      static_cast<double>(num_allocations) / num_batches;
+  state.counters["pool_bytes_per_batch"] = static_cast<double>(pool_bytes) / num_batches;
+}
+
+// ----------------------------------------------------------------------
+// Stream and file format benchmarks over several kinds of columns
+
+// The kinds of columns of the benchmarked record batches
+enum ColumnKind { INT64_COLUMNS, STRING_COLUMNS, LIST_COLUMNS, STRUCT_COLUMNS };
+
+// Each record batch holds about this many values, spread over its fields, so
+// that the batches of wide schemas are short and their metadata matters
+constexpr int64_t kValuesPerBatch = 1 << 16;
+constexpr int kNumFormatBatches = 16;
+
+static std::shared_ptr<Array> MakeInt64Column(int64_t length) {
+  std::vector<bool> is_valid;
+  test::random_is_valid(length, 0.1, &is_valid);
+  std::vector<int64_t> values;
+  test::randint<int64_t>(length, 0, 100, &values);
+
+  Int64Builder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    if (is_valid[i]) {
+      ABORT_NOT_OK(builder.Append(values[i]));
+    } else {
+      ABORT_NOT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+  return array;
+}
+
+// Strings of 0 to 16 ASCII characters
+static std::shared_ptr<Array> MakeStringColumn(int64_t length) {
+  constexpr int32_t kMaxLength = 16;
+  std::vector<int32_t> lengths;
+  test::randint<int32_t>(length, 0, kMaxLength, &lengths);
+  std::vector<uint8_t> chars(length * kMaxLength);
+  test::random_ascii(length * kMaxLength, 0, chars.data());
+
+  StringBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    ABORT_NOT_OK(builder.Append(chars.data() + i * kMaxLength, lengths[i]));
+  }
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+  return array;
+}
+
+// Lists of 0 to 8 int64 values
+static std::shared_ptr<Array> MakeListColumn(int64_t length) {
+  std::vector<int32_t> lengths;
+  test::randint<int32_t>(length, 0, 8, &lengths);
+
+  Int32Builder offsets_builder;
+  int32_t offset = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    ABORT_NOT_OK(offsets_builder.Append(offset));
+    offset += lengths[i];
+  }
+  ABORT_NOT_OK(offsets_builder.Append(offset));
+  std::shared_ptr<Array> offsets;
+  ABORT_NOT_OK(offsets_builder.Finish(&offsets));
+
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(ListArray::FromArrays(*offsets, *MakeInt64Column(offset),
+                                     default_memory_pool(), &array));
+  return array;
+}
+
+static std::shared_ptr<Array> MakeStructColumn(int64_t length) {
+  auto type = struct_({field("a", int64()), field("b", utf8())});
+  return std::make_shared<StructArray>(
+      type, length,
+      std::vector<std::shared_ptr<Array>>{MakeInt64Column(length),
+                                          MakeStringColumn(length)});
+}
+
+// A record batch of num_fields columns of the given kind
+static std::shared_ptr<RecordBatch> MakeFormatRecordBatch(ColumnKind kind,
+                                                          int64_t num_fields) {
+  const int64_t length = std::max<int64_t>(1, kValuesPerBatch / num_fields);
+  std::shared_ptr<Array> array;
+  switch (kind) {
+    case INT64_COLUMNS:
+      array = MakeInt64Column(length);
+      break;
+    case STRING_COLUMNS:
+      array = MakeStringColumn(length);
+      break;
+    case LIST_COLUMNS:
+      array = MakeListColumn(length);
+      break;
+    case STRUCT_COLUMNS:
+      array = MakeStructColumn(length);
+      break;
+  }
+
+  ArrayVector arrays;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int64_t i = 0; i < num_fields; ++i) {
+    std::stringstream ss;
+    ss << "f" << i;
+    fields.push_back(field(ss.str(), array->type()));
+    arrays.push_back(array);
+  }
+  return RecordBatch::Make(schema(fields), length, arrays);
+}
+
+// Write the batch kNumFormatBatches times in the stream or the file format,
+// and optionally get the index giving the size of each message
+static Status WriteFormatBatches(const RecordBatch& batch, bool file_format,
+                                 Compression::type compression, io::OutputStream* sink,
+                                 std::shared_ptr<RecordBatch>* index = nullptr) {
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  if (file_format) {
+    RETURN_NOT_OK(ipc::RecordBatchFileWriter::Open(sink, batch.schema(), &writer));
+  } else {
+    RETURN_NOT_OK(ipc::RecordBatchStreamWriter::Open(sink, batch.schema(), &writer));
+  }
+  auto stream_writer = static_cast<ipc::RecordBatchStreamWriter*>(writer.get());
+  RETURN_NOT_OK(stream_writer->SetCompression(compression));
+  if (index != nullptr) {
+    RETURN_NOT_OK(stream_writer->SetIndexing(true));
+  }
+  for (int i = 0; i < kNumFormatBatches; ++i) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+  }
+  if (index != nullptr) {
+    RETURN_NOT_OK(stream_writer->GetIndex(index));
+  }
+  return writer->Close();
+}
+
+// The arguments of the format benchmarks: the number of fields, the
+// ColumnKind, 1 for the file format and 1 for LZ4 compression
+static void FormatArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t num_fields : {1, 1000}) {
+    for (int64_t kind = INT64_COLUMNS; kind <= STRUCT_COLUMNS; ++kind) {
+      for (int64_t file_format : {0, 1}) {
+        for (int64_t compressed : {0, 1}) {
+          bench->Args({num_fields, kind, file_format, compressed});
+        }
+      }
+    }
+  }
+}
+
+struct FormatCase {
+  std::shared_ptr<RecordBatch> batch;
+  bool file_format;
+  Compression::type compression;
+  int64_t uncompressed_body_bytes;
+};
+
+// Set up the benchmark case and report the metadata and body bytes of each
+// message as counters. The throughput is that of the uncompressed bodies, so
+// that it is comparable between codecs
+static bool SetupFormatCase(benchmark::State& state,  // NOLINT non-const reference
+                            FormatCase* out) {
+  out->batch = MakeFormatRecordBatch(static_cast<ColumnKind>(state.range(1)),
+                                     state.range(0));
+  out->file_format = state.range(2) != 0;
+  out->compression = state.range(3) != 0 ? Compression::LZ4 : Compression::UNCOMPRESSED;
+  if (out->compression != Compression::UNCOMPRESSED) {
+    std::unique_ptr<Codec> codec;
+    if (!Codec::Create(out->compression, &codec).ok()) {
+      state.SkipWithError("LZ4 support not built");
+      return false;
+    }
+  }
+
+  io::MockOutputStream mock;
+  std::shared_ptr<RecordBatch> index;
+  ABORT_NOT_OK(
+      WriteFormatBatches(*out->batch, out->file_format, out->compression, &mock, &index));
+  const auto& metadata_lengths = static_cast<const Int32Array&>(*index->column(1));
+  const auto& body_lengths = static_cast<const Int64Array&>(*index->column(2));
+  int64_t metadata_bytes = 0;
+  int64_t body_bytes = 0;
+  for (int64_t i = 0; i < index->num_rows(); ++i) {
+    metadata_bytes += metadata_lengths.Value(i);
+    body_bytes += body_lengths.Value(i);
+  }
+  state.counters["metadata_bytes_per_batch"] =
+      static_cast<double>(metadata_bytes) / kNumFormatBatches;
+  state.counters["body_bytes_per_batch"] =
+      static_cast<double>(body_bytes) / kNumFormatBatches;
+
+  out->uncompressed_body_bytes = body_bytes;
+  if (out->compression != Compression::UNCOMPRESSED) {
+    io::MockOutputStream uncompressed_mock;
+    ABORT_NOT_OK(WriteFormatBatches(*out->batch, out->file_format,
+                                    Compression::UNCOMPRESSED, &uncompressed_mock,
+                                    &index));
+    out->uncompressed_body_bytes = 0;
+    const auto& lengths = static_cast<const Int64Array&>(*index->column(2));
+    for (int64_t i = 0; i < index->num_rows(); ++i) {
+      out->uncompressed_body_bytes += lengths.Value(i);
+    }
+  }
+  return true;
+}
+
+static void SetFormatThroughput(benchmark::State& state,  // NOLINT non-const reference
+                                const FormatCase& format_case) {
+  state.SetItemsProcessed(state.iterations() * kNumFormatBatches);
+  state.SetBytesProcessed(state.iterations() * format_case.uncompressed_body_bytes);
+}
+
+static void BM_WriteFormat(benchmark::State& state) {  // NOLINT non-const reference
+  FormatCase format_case;
+  if (!SetupFormatCase(state, &format_case)) {
+    return;
+  }
+
+  auto buffer = std::make_shared<PoolBuffer>(default_memory_pool());
+  while (state.KeepRunning()) {
+    io::BufferOutputStream stream(buffer);
+    ABORT_NOT_OK(WriteFormatBatches(*format_case.batch, format_case.file_format,
+                                    format_case.compression, &stream));
+  }
+  SetFormatThroughput(state, format_case);
+}
+
+// Read the batches back from a memory map, which is zero-copy unless the
+// buffers are compressed
+static void BM_ReadFormat(benchmark::State& state) {  // NOLINT non-const reference
+  FormatCase format_case;
+  if (!SetupFormatCase(state, &format_case)) {
+    return;
+  }
+
+  io::MockOutputStream mock;
+  ABORT_NOT_OK(WriteFormatBatches(*format_case.batch, format_case.file_format,
+                                  format_case.compression, &mock));
+  const std::string path = "ipc-read-write-benchmark-format";
+  std::shared_ptr<io::MemoryMappedFile> file;
+  ABORT_NOT_OK(io::MemoryMappedFile::Create(path, mock.GetExtentBytesWritten(), &file));
+  ABORT_NOT_OK(WriteFormatBatches(*format_case.batch, format_case.file_format,
+                                  format_case.compression, file.get()));
+  ABORT_NOT_OK(file->Close());
+  ABORT_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &file));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> batch;
+    if (format_case.file_format) {
+      std::shared_ptr<ipc::RecordBatchFileReader> reader;
+      ABORT_NOT_OK(ipc::RecordBatchFileReader::Open(file.get(), &reader));
+      for (int i = 0; i < reader->num_record_batches(); ++i) {
+        ABORT_NOT_OK(reader->ReadRecordBatch(i, &batch));
+      }
+    } else {
+      ABORT_NOT_OK(file->Seek(0));
+      std::shared_ptr<RecordBatchReader> reader;
+      ABORT_NOT_OK(ipc::RecordBatchStreamReader::Open(file.get(), &reader));
+      do {
+        ABORT_NOT_OK(reader->ReadNext(&batch));
+      } while (batch != nullptr);
+    }
+  }
+  ABORT_NOT_OK(file->Close());
+  std::remove(path.c_str());
+  SetFormatThroughput(state, format_case);
+}
+
 BENCHMARK(BM_WriteRecordBatch)
     ->RangeMultiplier(4)
     ->Range(1, 1 << 13)
@@ -128,4 +476,13 @@ BENCHMARK(BM_ReadRecordBatch)
     ->MinTime(1.0)
     ->UseRealTime();
 
+BENCHMARK(BM_ReadStreamFromMemoryMap)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 6)
+    ->UseRealTime();
+
+BENCHMARK(BM_WriteFormat)->Apply(FormatArgs)->UseRealTime();
+
+BENCHMARK(BM_ReadFormat)->Apply(FormatArgs)->UseRealTime();
+
 }  // namespace arrow
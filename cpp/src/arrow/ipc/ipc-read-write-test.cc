@@ -26,20 +26,28 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test-common.h"
+#include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/ipc/util.h"
 #include "arrow/memory_pool.h"
 #include "arrow/pretty_print.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/test-util.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bloom-filter.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
+
+namespace flatbuf = org::apache::arrow::flatbuf;
+
 namespace ipc {
 
 using BatchVector = std::vector<std::shared_ptr<RecordBatch>>;
@@ -85,6 +93,39 @@ TEST(TestMessage, Equals) {
   ASSERT_FALSE(msg5.Equals(msg1));
 }
 
+// Messages written with a reused metadata writer are the same as messages
+// written on their own, whatever was written before
+TEST(TestMessage, ReusedMetadataWriter) {
+  const std::vector<internal::FieldMetadata> wide_nodes(100, {5, 1, 0});
+  const std::vector<internal::BufferMetadata> wide_buffers(200, {8, 64});
+  const std::vector<internal::FieldMetadata> narrow_nodes = {{3, 0, 0}};
+  const std::vector<internal::BufferMetadata> narrow_buffers = {{0, 0}, {0, 24}};
+
+  internal::RecordBatchMetadataWriter writer;
+  std::shared_ptr<Buffer> reused, expected;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(writer.WriteRecordBatch(5, 12800, wide_nodes, wide_buffers,
+                                      Compression::UNCOMPRESSED, {}, &reused));
+    ASSERT_OK(internal::WriteRecordBatchMessage(5, 12800, wide_nodes, wide_buffers,
+                                                Compression::UNCOMPRESSED, {},
+                                                &expected));
+    ASSERT_TRUE(reused->Equals(*expected));
+
+    ASSERT_OK(writer.WriteDictionary(0, 3, 24, narrow_nodes, narrow_buffers, true,
+                                     &reused));
+    ASSERT_OK(internal::WriteDictionaryMessage(0, 3, 24, narrow_nodes, narrow_buffers,
+                                               true, &expected));
+    ASSERT_TRUE(reused->Equals(*expected));
+
+    ASSERT_OK(writer.WriteRecordBatch(3, 24, narrow_nodes, narrow_buffers,
+                                      Compression::UNCOMPRESSED, {1, 2}, &reused));
+    ASSERT_OK(internal::WriteRecordBatchMessage(3, 24, narrow_nodes, narrow_buffers,
+                                                Compression::UNCOMPRESSED, {1, 2},
+                                                &expected));
+    ASSERT_TRUE(reused->Equals(*expected));
+  }
+}
+
 const std::shared_ptr<DataType> INT32 = std::make_shared<Int32Type>();
 
 TEST_F(TestSchemaMetadata, PrimitiveFields) {
@@ -500,11 +541,18 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
+  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches,
+                         Compression::type compression = Compression::UNCOMPRESSED,
+                         int64_t min_compressed_size = kDefaultMinCompressedSize,
+                         int max_pending_batches = 0) {
     // Write the file
     std::shared_ptr<RecordBatchWriter> writer;
     RETURN_NOT_OK(
         RecordBatchFileWriter::Open(sink_.get(), in_batches[0]->schema(), &writer));
+    RETURN_NOT_OK(static_cast<RecordBatchFileWriter*>(writer.get())
+                      ->SetCompression(compression, min_compressed_size));
+    RETURN_NOT_OK(static_cast<RecordBatchFileWriter*>(writer.get())
+                      ->SetPipelining(max_pending_batches));
 
     const int num_batches = static_cast<int>(in_batches.size());
 
@@ -566,11 +614,18 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& batches, BatchVector* out_batches) {
+  Status RoundTripHelper(const BatchVector& batches, BatchVector* out_batches,
+                         Compression::type compression = Compression::UNCOMPRESSED,
+                         int64_t min_compressed_size = kDefaultMinCompressedSize,
+                         int max_pending_batches = 0) {
     // Write the file
     std::shared_ptr<RecordBatchWriter> writer;
     RETURN_NOT_OK(
         RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+    RETURN_NOT_OK(static_cast<RecordBatchStreamWriter*>(writer.get())
+                      ->SetCompression(compression, min_compressed_size));
+    RETURN_NOT_OK(static_cast<RecordBatchStreamWriter*>(writer.get())
+                      ->SetPipelining(max_pending_batches));
 
     for (const auto& batch : batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -616,6 +671,85 @@ TEST_P(TestStreamFormat, RoundTrip) {
   }
 }
 
+// The codecs built in this configuration
+std::vector<Compression::type> AvailableCodecs() {
+  std::vector<Compression::type> codecs;
+  for (auto compression : {Compression::LZ4, Compression::ZSTD, Compression::SNAPPY,
+                           Compression::GZIP, Compression::BROTLI}) {
+    std::unique_ptr<Codec> codec;
+    if (Codec::Create(compression, &codec).ok()) {
+      codecs.push_back(compression);
+    }
+  }
+  return codecs;
+}
+
+TEST_P(TestFileFormat, CompressedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  for (auto compression : AvailableCodecs()) {
+    // Compress every buffer, then only the large ones
+    for (int64_t min_compressed_size : {int64_t(0), kDefaultMinCompressedSize}) {
+      SetUp();
+      BatchVector out_batches;
+      ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches, compression,
+                                min_compressed_size));
+      for (const auto& out_batch : out_batches) {
+        CompareBatch(*batch, *out_batch);
+      }
+    }
+  }
+}
+
+TEST_P(TestStreamFormat, CompressedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  for (auto compression : AvailableCodecs()) {
+    for (int64_t min_compressed_size : {int64_t(0), kDefaultMinCompressedSize}) {
+      SetUp();
+      BatchVector out_batches;
+      ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches, compression,
+                                min_compressed_size));
+      for (const auto& out_batch : out_batches) {
+        CompareBatch(*batch, *out_batch);
+      }
+    }
+  }
+}
+
+TEST_P(TestFileFormat, PipelinedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  BatchVector in_batches(5, batch);
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper(in_batches, &out_batches, Compression::UNCOMPRESSED,
+                            kDefaultMinCompressedSize, 2));
+  ASSERT_EQ(in_batches.size(), out_batches.size());
+  for (const auto& out_batch : out_batches) {
+    CompareBatch(*batch, *out_batch);
+  }
+}
+
+TEST_P(TestStreamFormat, PipelinedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  for (auto compression : AvailableCodecs()) {
+    SetUp();
+    BatchVector in_batches(5, batch);
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper(in_batches, &out_batches, compression,
+                              kDefaultMinCompressedSize, 2));
+    ASSERT_EQ(in_batches.size(), out_batches.size());
+    for (const auto& out_batch : out_batches) {
+      CompareBatch(*batch, *out_batch);
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -674,6 +808,68 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) {
   CheckBatchDictionaries(*out_batches[0]);
 }
 
+// Frame a payload as the stream format does
+static Status WriteFramedPayload(const IpcPayload& payload, io::OutputStream* dst) {
+  const int64_t size = payload.metadata->size();
+  const int32_t padded_size =
+      static_cast<int32_t>(BitUtil::RoundUpToMultipleOf8(size + 4) - 4);
+  RETURN_NOT_OK(dst->Write(&padded_size, sizeof(int32_t)));
+  RETURN_NOT_OK(dst->Write(payload.metadata->data(), size));
+  RETURN_NOT_OK(dst->Write(kPaddingBytes, padded_size - size));
+  int64_t body_length = 0;
+  for (const auto& buffer : payload.body_buffers) {
+    if (buffer) {
+      const int64_t padded = BitUtil::RoundUpToMultipleOf8(buffer->size());
+      RETURN_NOT_OK(dst->Write(buffer->data(), buffer->size()));
+      RETURN_NOT_OK(dst->Write(kPaddingBytes, padded - buffer->size()));
+      body_length += padded;
+    }
+  }
+  if (body_length != payload.body_length) {
+    return Status::Invalid("Unexpected body length");
+  }
+  return Status::OK();
+}
+
+TEST_F(TestStreamFormat, PayloadsRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+
+  std::vector<IpcPayload> payloads;
+  ASSERT_OK(GetSchemaPayloads(*batch->schema(), pool_, &payloads));
+  ASSERT_EQ(Message::SCHEMA, payloads[0].type);
+  ASSERT_GT(payloads.size(), 1U);
+  for (size_t i = 1; i < payloads.size(); ++i) {
+    ASSERT_EQ(Message::DICTIONARY_BATCH, payloads[i].type);
+  }
+
+  IpcPayload batch_payload;
+  ASSERT_OK(GetRecordBatchPayload(*batch, pool_, &batch_payload));
+  ASSERT_EQ(Message::RECORD_BATCH, batch_payload.type);
+  // The values of the first column are not copied
+  ASSERT_EQ(batch->column(0)->data()->buffers[1]->data(),
+            batch_payload.body_buffers[1]->data());
+  payloads.push_back(batch_payload);
+
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, pool_, &sink));
+  for (const auto& payload : payloads) {
+    ASSERT_OK(WriteFramedPayload(payload, sink.get()));
+  }
+  std::shared_ptr<Buffer> stream;
+  ASSERT_OK(sink->Finish(&stream));
+
+  io::BufferReader source(stream);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&source, &reader));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_TRUE(batch->Equals(*result));
+  CheckBatchDictionaries(*result);
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_EQ(nullptr, result);
+}
+
 TEST_F(TestStreamFormat, WriteTable) {
   std::shared_ptr<RecordBatch> b1, b2, b3;
   ASSERT_OK(MakeIntRecordBatch(&b1));
@@ -688,6 +884,598 @@ TEST_F(TestStreamFormat, WriteTable) {
   ASSERT_TRUE(b3->Equals(*out_batches[2]));
 }
 
+TEST_F(TestStreamFormat, PipelinedWriteMatchesSynchronous) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+
+  std::vector<std::shared_ptr<Buffer>> streams;
+  for (int max_pending_batches : {0, 1, 3}) {
+    std::shared_ptr<io::BufferOutputStream> sink;
+    ASSERT_OK(io::BufferOutputStream::Create(1024, pool_, &sink));
+    std::shared_ptr<RecordBatchWriter> writer;
+    ASSERT_OK(RecordBatchStreamWriter::Open(sink.get(), batch->schema(), &writer));
+    auto stream_writer = static_cast<RecordBatchStreamWriter*>(writer.get());
+    ASSERT_RAISES(Invalid, stream_writer->SetPipelining(-1));
+    ASSERT_OK(stream_writer->SetPipelining(max_pending_batches));
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch->Slice(i * 20, 20)));
+    }
+    ASSERT_OK(writer->Close());
+    std::shared_ptr<Buffer> stream;
+    ASSERT_OK(sink->Finish(&stream));
+    streams.push_back(stream);
+  }
+  ASSERT_TRUE(streams[0]->Equals(*streams[1]));
+  ASSERT_TRUE(streams[0]->Equals(*streams[2]));
+}
+
+static std::shared_ptr<RecordBatch> MakeDictionaryBatch(
+    const std::vector<std::string>& dictionary_values,
+    const std::vector<int8_t>& index_values) {
+  std::shared_ptr<Array> dictionary, indices;
+  ArrayFromVector<StringType, std::string>(dictionary_values, &dictionary);
+  ArrayFromVector<Int8Type, int8_t>(index_values, &indices);
+  auto type = std::make_shared<DictionaryType>(int8(), dictionary);
+  auto array = std::make_shared<DictionaryArray>(type, indices);
+  return RecordBatch::Make(::arrow::schema({field("f0", type)}), array->length(),
+                           {array});
+}
+
+TEST_F(TestStreamFormat, DictionaryDeltasAndReplacements) {
+  BatchVector in_batches = {
+      MakeDictionaryBatch({"a", "b"}, {0, 1, 0}),
+      // Extends the dictionary, sent as a delta
+      MakeDictionaryBatch({"a", "b", "c"}, {2, 1}),
+      // Sent as a replacement
+      MakeDictionaryBatch({"x", "y"}, {1, 1, 0}),
+      // Unchanged
+      MakeDictionaryBatch({"x", "y"}, {0})};
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper(in_batches, &out_batches));
+  ASSERT_EQ(in_batches.size(), out_batches.size());
+  for (size_t i = 0; i < in_batches.size(); ++i) {
+    CompareBatch(*in_batches[i], *out_batches[i]);
+  }
+
+  // The initial dictionary, then one batch for the delta (negative length)
+  // and one for the replacement
+  io::BufferReader buf_reader(buffer_);
+  auto message_reader = MessageReader::Open(&buf_reader);
+  std::vector<int64_t> dictionary_lengths;
+  std::unique_ptr<Message> message;
+  ASSERT_OK(message_reader->ReadNextMessage(&message));
+  while (message != nullptr) {
+    if (message->type() == Message::DICTIONARY_BATCH) {
+      auto dictionary_batch =
+          static_cast<const flatbuf::DictionaryBatch*>(message->header());
+      const int64_t length = dictionary_batch->data()->length();
+      dictionary_lengths.push_back(dictionary_batch->isDelta() ? -length : length);
+    }
+    ASSERT_OK(message_reader->ReadNextMessage(&message));
+  }
+  ASSERT_EQ(std::vector<int64_t>({2, -1, 2}), dictionary_lengths);
+}
+
+static Status WriteCoalesced(const BatchVector& batches, int64_t max_rows,
+                             std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<io::BufferOutputStream> sink;
+  RETURN_NOT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  std::shared_ptr<RecordBatchWriter> writer;
+  RETURN_NOT_OK(RecordBatchStreamWriter::Open(sink.get(), batches[0]->schema(), &writer));
+  RETURN_NOT_OK(
+      static_cast<RecordBatchStreamWriter*>(writer.get())->SetCoalescing(max_rows));
+  for (const auto& batch : batches) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  RETURN_NOT_OK(writer->Close());
+  return sink->Finish(out);
+}
+
+static Status ReadCoalesced(const std::shared_ptr<Buffer>& stream, bool split,
+                            BatchVector* out) {
+  auto buf_reader = std::make_shared<io::BufferReader>(stream);
+  std::shared_ptr<RecordBatchReader> reader;
+  RETURN_NOT_OK(RecordBatchStreamReader::Open(buf_reader, &reader));
+  static_cast<RecordBatchStreamReader*>(reader.get())->set_split_coalesced(split);
+  out->clear();
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      return Status::OK();
+    }
+    out->push_back(batch);
+  }
+}
+
+TEST_F(TestStreamFormat, CoalescedBatches) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+  BatchVector in_batches;
+  for (int i = 0; i < 10; ++i) {
+    in_batches.push_back(batch->Slice(i * 20, 20));
+  }
+
+  std::shared_ptr<Buffer> stream;
+  ASSERT_OK(WriteCoalesced(in_batches, 50, &stream));
+
+  // Three batches per message, the last one flushed by Close
+  BatchVector out_batches;
+  ASSERT_OK(ReadCoalesced(stream, false, &out_batches));
+  ASSERT_EQ(4U, out_batches.size());
+  CompareBatch(*batch->Slice(0, 60), *out_batches[0]);
+  CompareBatch(*batch->Slice(180, 20), *out_batches[3]);
+
+  ASSERT_OK(ReadCoalesced(stream, true, &out_batches));
+  ASSERT_EQ(in_batches.size(), out_batches.size());
+  for (size_t i = 0; i < in_batches.size(); ++i) {
+    CompareBatch(*in_batches[i], *out_batches[i]);
+  }
+
+  // Batches with different dictionaries are not coalesced
+  in_batches = {MakeDictionaryBatch({"a", "b"}, {0, 1, 0}),
+                MakeDictionaryBatch({"a", "b", "c"}, {2, 1}),
+                MakeDictionaryBatch({"x", "y"}, {1, 1, 0}),
+                MakeDictionaryBatch({"x", "y"}, {0})};
+  ASSERT_OK(WriteCoalesced(in_batches, 100, &stream));
+  ASSERT_OK(ReadCoalesced(stream, false, &out_batches));
+  ASSERT_EQ(3U, out_batches.size());
+  ASSERT_EQ(4, out_batches[2]->num_rows());
+
+  ASSERT_OK(ReadCoalesced(stream, true, &out_batches));
+  ASSERT_EQ(in_batches.size(), out_batches.size());
+  for (size_t i = 0; i < in_batches.size(); ++i) {
+    CompareBatch(*in_batches[i], *out_batches[i]);
+  }
+}
+
+TEST_F(TestFileFormat, DictionaryChangesUnsupported) {
+  std::shared_ptr<RecordBatchWriter> writer;
+  auto batch = MakeDictionaryBatch({"a", "b"}, {0, 1});
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*MakeDictionaryBatch({"a", "b"}, {1})));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*MakeDictionaryBatch({"a"}, {0})));
+}
+
+TEST_F(TestFileFormat, BatchStatistics) {
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", utf8())});
+  std::vector<std::vector<bool>> is_valid = {{true, true, false}, {true, true}, {false}};
+  std::vector<std::vector<int32_t>> values = {{1, 2, 0}, {9, 5}, {0}};
+  BatchVector batches;
+  for (size_t i = 0; i < values.size(); ++i) {
+    std::shared_ptr<Array> f0, f1;
+    ArrayFromVector<Int32Type, int32_t>(is_valid[i], values[i], &f0);
+    ArrayFromVector<StringType, std::string>(
+        is_valid[i], std::vector<std::string>(values[i].size(), "x"), &f1);
+    batches.push_back(RecordBatch::Make(schema, f0->length(), {f0, f1}));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), schema, &writer));
+  ASSERT_OK(static_cast<RecordBatchFileWriter*>(writer.get())->SetIndexing(true));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, &reader));
+  std::shared_ptr<RecordBatch> statistics = reader->statistics();
+  ASSERT_NE(nullptr, statistics);
+  ASSERT_EQ(3, statistics->num_rows());
+  ASSERT_EQ(-1, statistics->schema()->GetFieldIndex("f1_min"));
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<Int64Type, int64_t>({1, 0, 1}, &expected);
+  ASSERT_TRUE(expected->Equals(
+      *statistics->column(statistics->schema()->GetFieldIndex("f1_null_count"))));
+  ArrayFromVector<Int32Type, int32_t>({true, true, false}, {1, 5, 0}, &expected);
+  ASSERT_TRUE(expected->Equals(
+      *statistics->column(statistics->schema()->GetFieldIndex("f0_min"))));
+
+  // Skip the batches that cannot hold f0 >= 4
+  auto maxima = std::static_pointer_cast<Int32Array>(
+      statistics->column(statistics->schema()->GetFieldIndex("f0_max")));
+  std::vector<int> matching;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    if (maxima->IsValid(i) && maxima->Value(i) >= 4) {
+      matching.push_back(i);
+    }
+  }
+  ASSERT_EQ(std::vector<int>({1}), matching);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadRecordBatch(matching[0], &batch));
+  CompareBatch(*batches[1], *batch);
+
+  // Files written without indexing have no statistics
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  ASSERT_OK(RecordBatchFileWriter::Open(sink.get(), schema, &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_OK(writer->Close());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(sink->Finish(&buffer));
+  io::BufferReader plain_reader(buffer);
+  ASSERT_OK(RecordBatchFileReader::Open(&plain_reader, &reader));
+  ASSERT_EQ(nullptr, reader->statistics());
+}
+
+TEST_F(TestFileFormat, IoStatistics) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, &reader));
+  // The footer and its length
+  const io::IoStatistics opened = reader->io_statistics();
+  ASSERT_EQ(2, opened.read_ats.num_calls);
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadRecordBatch(0, &result));
+  const io::IoStatistics read = reader->io_statistics();
+  ASSERT_GT(read.read_ats.num_calls, opened.read_ats.num_calls);
+  ASSERT_EQ(read.read_ats.bytes_requested, read.read_ats.bytes_transferred);
+  ASSERT_LE(read.read_ats.bytes_transferred, buffer_->size());
+  ASSERT_EQ(0, read.reads.num_calls);
+}
+
+TEST_F(TestFileFormat, BloomFilters) {
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", utf8())});
+  BatchVector batches;
+  for (int32_t i = 0; i < 3; ++i) {
+    std::vector<int32_t> ints;
+    std::vector<std::string> strings;
+    for (int32_t j = 0; j < 100; ++j) {
+      ints.push_back(i * 100 + j);
+      strings.push_back("key" + std::to_string(i * 100 + j));
+    }
+    std::shared_ptr<Array> f0, f1;
+    ArrayFromVector<Int32Type, int32_t>(ints, &f0);
+    ArrayFromVector<StringType, std::string>(strings, &f1);
+    batches.push_back(RecordBatch::Make(schema, f0->length(), {f0, f1}));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), schema, &writer));
+  auto file_writer = static_cast<RecordBatchFileWriter*>(writer.get());
+  ASSERT_RAISES(Invalid, file_writer->SetBloomFilters({"f2"}));
+  ASSERT_OK(file_writer->SetBloomFilters({"f1"}));
+  ASSERT_OK(file_writer->SetIndexing(true));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_RAISES(Invalid, file_writer->SetBloomFilters({}));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, &reader));
+  ASSERT_NE(nullptr, reader->statistics());
+  std::shared_ptr<BlockedBloomFilter> filter;
+  ASSERT_OK(reader->ReadBloomFilter(0, 0, &filter));
+  ASSERT_EQ(nullptr, filter);
+  ASSERT_OK(reader->ReadBloomFilter(2, 1, &filter));
+  ASSERT_NE(nullptr, filter);
+  ASSERT_RAISES(Invalid, reader->ReadBloomFilter(3, 1, &filter));
+
+  // Only the batch holding the key is read, unfiltered fields match any batch
+  std::shared_ptr<Array> probe;
+  ArrayFromVector<StringType, std::string>({"key142"}, &probe);
+  std::vector<int> matching;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    bool may_contain;
+    ASSERT_OK(reader->MayContain(i, 1, *probe, &may_contain));
+    if (may_contain) {
+      matching.push_back(i);
+    }
+    ASSERT_OK(reader->MayContain(i, 0, *batches[0]->column(0), &may_contain));
+    ASSERT_TRUE(may_contain);
+  }
+  ASSERT_EQ(std::vector<int>({1}), matching);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadRecordBatch(matching[0], &batch));
+  CompareBatch(*batches[1], *batch);
+}
+
+TEST_F(TestStreamFormat, ReadIncludedFields) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+  auto expected = RecordBatch::Make(::arrow::schema({batch->schema()->field(1)}),
+                                    batch->num_rows(), {batch->column(1)});
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(&buf_reader, &reader));
+  auto stream_reader = static_cast<RecordBatchStreamReader*>(reader.get());
+
+  std::shared_ptr<RecordBatch> out_batch;
+  ASSERT_OK(stream_reader->ReadNext({1}, &out_batch));
+  CompareBatch(*expected, *out_batch);
+  ASSERT_OK(stream_reader->ReadNext({1}, &out_batch));
+  ASSERT_EQ(nullptr, out_batch);
+}
+
+TEST_F(TestStreamFormat, IndexedReads) {
+  auto schema = ::arrow::schema({field("ts", int64()), field("name", utf8())});
+  BatchVector batches;
+  for (int64_t i = 0; i < 4; ++i) {
+    std::shared_ptr<Array> ts, names;
+    // The third batch has no timestamps
+    ArrayFromVector<Int64Type, int64_t>({i != 2, false, i != 2},
+                                        {i * 10, 0, i * 10 + 9}, &ts);
+    ArrayFromVector<StringType, std::string>({"a", "b", "c"}, &names);
+    batches.push_back(RecordBatch::Make(schema, 3, {ts, names}));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), schema, &writer));
+  auto stream_writer = static_cast<RecordBatchStreamWriter*>(writer.get());
+  std::shared_ptr<RecordBatch> index;
+  ASSERT_RAISES(Invalid, stream_writer->GetIndex(&index));
+  ASSERT_OK(stream_writer->SetIndexing(true));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_OK(stream_writer->GetIndex(&index));
+  ASSERT_EQ(1, index->num_rows());
+  ASSERT_RAISES(Invalid, stream_writer->SetIndexing(false));
+  for (size_t i = 1; i < batches.size(); ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batches[i]));
+  }
+  ASSERT_OK(stream_writer->GetIndex(&index));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  ASSERT_EQ(4, index->num_rows());
+  ASSERT_EQ(-1, index->schema()->GetFieldIndex("name_min"));
+  std::shared_ptr<Array> expected_min, expected_max;
+  ArrayFromVector<Int64Type, int64_t>({true, true, false, true}, {0, 10, 0, 30},
+                                      &expected_min);
+  ArrayFromVector<Int64Type, int64_t>({true, true, false, true}, {9, 19, 0, 39},
+                                      &expected_max);
+  ASSERT_TRUE(
+      expected_min->Equals(*index->column(index->schema()->GetFieldIndex("ts_min"))));
+  ASSERT_TRUE(
+      expected_max->Equals(*index->column(index->schema()->GetFieldIndex("ts_max"))));
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchIndexedStreamReader> reader;
+  ASSERT_OK(RecordBatchIndexedStreamReader::Open(&buf_reader, index, &reader));
+  ASSERT_EQ(4, reader->num_record_batches());
+  ASSERT_EQ(3, reader->num_rows(1));
+
+  std::shared_ptr<RecordBatch> batch;
+  for (int i : {3, 0, 2}) {
+    ASSERT_OK(reader->ReadRecordBatch(i, &batch));
+    CompareBatch(*batches[i], *batch);
+  }
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(4, &batch));
+
+  int found;
+  ASSERT_OK(reader->FindRecordBatch("ts", -5, &found));
+  ASSERT_EQ(0, found);
+  ASSERT_OK(reader->FindRecordBatch("ts", 15, &found));
+  ASSERT_EQ(1, found);
+  // The batch without timestamps is skipped
+  ASSERT_OK(reader->FindRecordBatch("ts", 25, &found));
+  ASSERT_EQ(3, found);
+  ASSERT_OK(reader->FindRecordBatch("ts", 40, &found));
+  ASSERT_EQ(4, found);
+  ASSERT_RAISES(KeyError, reader->FindRecordBatch("name", 0, &found));
+}
+
+TEST_F(TestStreamFormat, CompressionShrinksStream) {
+  // Compressible values, and a small buffer left as is
+  std::vector<int64_t> values(1 << 16, 42);
+  std::shared_ptr<Array> large, small;
+  ArrayFromVector<Int64Type, int64_t>(values, &large);
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3}, &small);
+  auto schema = ::arrow::schema({field("f0", int64())});
+  auto large_batch = RecordBatch::Make(schema, large->length(), {large});
+  auto small_batch = RecordBatch::Make(schema, small->length(), {small});
+
+  BatchVector out_batches;
+  ASSERT_OK(RoundTripHelper({large_batch, small_batch}, &out_batches));
+  const int64_t uncompressed_size = buffer_->size();
+
+  for (auto compression : AvailableCodecs()) {
+    SetUp();
+    out_batches.clear();
+    ASSERT_OK(RoundTripHelper({large_batch, small_batch}, &out_batches, compression));
+    ASSERT_LT(buffer_->size() * 4, uncompressed_size);
+    ASSERT_TRUE(large_batch->Equals(*out_batches[0]));
+    ASSERT_TRUE(small_batch->Equals(*out_batches[1]));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), schema, &writer));
+  ASSERT_RAISES(NotImplemented, static_cast<RecordBatchStreamWriter*>(writer.get())
+                                    ->SetCompression(Compression::LZO));
+}
+
+TEST_F(TestFileFormat, CompressedManyColumns) {
+  // More compressed buffers than threads, decompressed in parallel
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < 32; ++i) {
+    std::vector<int32_t> values(4096, i);
+    std::shared_ptr<Array> column;
+    ArrayFromVector<Int32Type, int32_t>(values, &column);
+    fields.push_back(field("f" + std::to_string(i), int32()));
+    columns.push_back(column);
+  }
+  auto batch = RecordBatch::Make(::arrow::schema(fields), 4096, columns);
+
+  for (auto compression : AvailableCodecs()) {
+    SetUp();
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches, compression));
+    for (const auto& out_batch : out_batches) {
+      CompareBatch(*batch, *out_batch);
+    }
+  }
+}
+
+TEST_F(TestFileFormat, PrefetchedReads) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(40, &batch));
+  BatchVector in_batches;
+  for (int i = 0; i < 4; ++i) {
+    in_batches.push_back(batch->Slice(i * 10, 10));
+  }
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  for (const auto& in_batch : in_batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*in_batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, footer_offset, &reader));
+  reader->SetPrefetch(true);
+
+  // In order, then out of order, discarding the batch read ahead
+  for (int i : {0, 1, 2, 3, 1, 0, 3, 2}) {
+    std::shared_ptr<RecordBatch> out_batch;
+    ASSERT_OK(reader->ReadRecordBatch(i, &out_batch));
+    CompareBatch(*in_batches[i], *out_batch);
+  }
+}
+
+TEST_F(TestFileFormat, GrowableMemoryMap) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(1000, &batch));
+
+  // Written straight into the mapping, and read back from it zero-copy
+  const std::string path = "test-growable-memory-map";
+  std::shared_ptr<io::MemoryMappedFile> file;
+  ASSERT_OK(io::MemoryMappedFile::CreateGrowable(path, 1 << 30, &file));
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(file.get(), batch->schema(), &writer));
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  int64_t footer_offset;
+  ASSERT_OK(file->Tell(&footer_offset));
+  ASSERT_OK(file->Close());
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(file.get(), footer_offset, &reader));
+  ASSERT_EQ(100, reader->num_record_batches());
+  for (int i : {0, 99}) {
+    std::shared_ptr<RecordBatch> out_batch;
+    ASSERT_OK(reader->ReadRecordBatch(i, &out_batch));
+    CompareBatch(*batch, *out_batch);
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(TestFileFormat, TableCache) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(100, &batch));
+  const std::vector<std::string> paths = {"test-table-cache-0", "test-table-cache-1"};
+  for (const auto& path : paths) {
+    std::shared_ptr<io::FileOutputStream> sink;
+    ASSERT_OK(io::FileOutputStream::Open(path, &sink));
+    std::shared_ptr<RecordBatchWriter> writer;
+    ASSERT_OK(RecordBatchFileWriter::Open(sink.get(), batch->schema(), &writer));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  }
+
+  TableCache cache;
+  ASSERT_OK(cache.Load(paths, 2));
+  ASSERT_EQ(2, cache.num_tables());
+  const int64_t mapped_bytes = cache.mapped_bytes();
+  ASSERT_GT(mapped_bytes, 0);
+
+  // Every request returns the cached table
+  std::shared_ptr<Table> table, cached_table;
+  ASSERT_OK(cache.GetTable(paths[0], &table));
+  ASSERT_OK(cache.GetTable(paths[0], &cached_table));
+  ASSERT_EQ(table, cached_table);
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch}, &expected));
+  ASSERT_TRUE(table->Equals(*expected));
+
+  std::shared_ptr<Table> concatenated;
+  ASSERT_OK(cache.GetTable(paths, 2, &concatenated));
+  ASSERT_OK(Table::FromRecordBatches({batch, batch, batch, batch}, &expected));
+  ASSERT_TRUE(concatenated->Equals(*expected));
+
+  // An evicted table stays valid, and the file is read again when requested
+  cache.Evict(paths[0]);
+  ASSERT_EQ(1, cache.num_tables());
+  ASSERT_LT(cache.mapped_bytes(), mapped_bytes);
+  ASSERT_EQ(200, table->num_rows());
+  ASSERT_OK(cache.GetTable(paths[0], &cached_table));
+  ASSERT_NE(table, cached_table);
+  ASSERT_TRUE(cached_table->Equals(*table));
+  ASSERT_EQ(mapped_bytes, cache.mapped_bytes());
+
+  ASSERT_RAISES(IOError, cache.GetTable("test-table-cache-missing", &table));
+  ASSERT_EQ(2, cache.num_tables());
+
+  for (const auto& path : paths) {
+    std::remove(path.c_str());
+  }
+}
+
+TEST_F(TestFileFormat, ReadIncludedFields) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+  // The skipped nested field must not throw off the following ones
+  auto expected = RecordBatch::Make(
+      ::arrow::schema({batch->schema()->field(0), batch->schema()->field(2)}),
+      batch->num_rows(), {batch->column(0), batch->column(2)});
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchFileWriter::Open(sink_.get(), batch->schema(), &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+  int64_t footer_offset;
+  ASSERT_OK(sink_->Tell(&footer_offset));
+
+  io::BufferReader buf_reader(buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(&buf_reader, footer_offset, &reader));
+
+  std::shared_ptr<RecordBatch> out_batch;
+  ASSERT_OK(reader->ReadRecordBatch(0, {2, 0}, &out_batch));
+  CompareBatch(*expected, *out_batch);
+
+  ASSERT_OK(reader->ReadRecordBatch(0, {}, &out_batch));
+  ASSERT_EQ(0, out_batch->num_columns());
+  ASSERT_EQ(batch->num_rows(), out_batch->num_rows());
+
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {3}, &out_batch));
+}
+
 TEST_F(TestFileFormat, DictionaryRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeDictionary(&batch));
@@ -758,6 +1546,74 @@ TEST_F(TestTensorRoundTrip, NonContiguous) {
   CheckTensorRoundTrip(tensor);
 }
 
+TEST_F(TestTensorRoundTrip, StridedZeroCopy) {
+  std::string path = "test-write-tensor-strided-zero-copy";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> values;
+  test::randint(24, 0, 100, &values);
+  auto data = test::GetBufferFromVector(values);
+
+  // Column-major 4x6 and every other column of a 4x6 row-major tensor
+  Tensor transposed(int64(), data, {4, 6}, {8, 32});
+  Tensor skipping(int64(), data, {4, 3}, {48, 16});
+
+  std::vector<Compression::type> codecs = AvailableCodecs();
+  codecs.push_back(Compression::UNCOMPRESSED);
+  for (const Tensor* tensor : {&transposed, &skipping}) {
+    for (auto compression : codecs) {
+      int32_t metadata_length;
+      int64_t body_length;
+      ASSERT_OK(mmap_->Seek(0));
+      ASSERT_OK(WriteStridedTensor(*tensor, mmap_.get(), compression, pool_,
+                                   &metadata_length, &body_length));
+      if (compression == Compression::UNCOMPRESSED) {
+        // The spanned memory is written as is
+        ASSERT_EQ(tensor->strides()[0] == 8 ? 192 : 184, body_length);
+      }
+
+      std::shared_ptr<Tensor> result;
+      ASSERT_OK(ReadTensor(0, mmap_.get(), &result));
+      ASSERT_EQ(tensor->strides(), result->strides());
+      ASSERT_TRUE(tensor->Equals(*result));
+    }
+  }
+}
+
+TEST_F(TestTensorRoundTrip, SparseTensor) {
+  std::string path = "test-write-sparse-tensor";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<double> values = {1, 0, 0, 2, 0, 0, 0, 0, 0, 3, 4, 0};
+  Tensor dense(float64(), test::GetBufferFromVector(values), {3, 4}, {},
+               {"foo", "bar"});
+
+  std::shared_ptr<SparseTensorCOO> coo;
+  std::shared_ptr<SparseTensorCSR> csr;
+  ASSERT_OK(SparseTensorCOO::Make(dense, pool_, &coo));
+  ASSERT_OK(SparseTensorCSR::Make(dense, pool_, &csr));
+
+  for (const SparseTensor* sparse : {static_cast<const SparseTensor*>(coo.get()),
+                                     static_cast<const SparseTensor*>(csr.get())}) {
+    int32_t metadata_length;
+    int64_t body_length;
+    ASSERT_OK(mmap_->Seek(0));
+    ASSERT_OK(WriteSparseTensor(*sparse, mmap_.get(), &metadata_length, &body_length,
+                                pool_));
+
+    std::shared_ptr<SparseTensor> result;
+    ASSERT_OK(ReadSparseTensor(0, mmap_.get(), &result));
+    ASSERT_TRUE(sparse->Equals(*result));
+    ASSERT_EQ("bar", result->dim_name(1));
+
+    std::shared_ptr<Tensor> result_dense;
+    ASSERT_OK(result->ToTensor(pool_, &result_dense));
+    ASSERT_TRUE(dense.Equals(*result_dense));
+  }
+}
+
 TEST(TestRecordBatchStreamReader, MalformedInput) {
   const std::string empty_str = "";
   const std::string garbage_str = "12345678";
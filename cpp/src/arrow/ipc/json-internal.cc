@@ -334,6 +334,22 @@ class SchemaWriter {
     return VisitType(*type.dictionary()->type());
   }
 
+  Status Visit(const RunLengthEncodedType& type) {
+    return Status::NotImplemented("run_length_encoded");
+  }
+
+  Status Visit(const LargeBinaryType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
+  Status Visit(const LargeListType& type) {
+    return Status::NotImplemented("large_list");
+  }
+
+  Status Visit(const StringViewType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
  private:
   DictionaryMemo dictionary_memo_;
 
@@ -513,6 +529,22 @@ class ArrayWriter {
     return VisitArrayValues(*array.indices());
   }
 
+  Status Visit(const RunLengthEncodedArray& array) {
+    return Status::NotImplemented("run_length_encoded");
+  }
+
+  Status Visit(const LargeBinaryArray& array) {
+    return Status::NotImplemented(array.type()->ToString());
+  }
+
+  Status Visit(const LargeListArray& array) {
+    return Status::NotImplemented("large_list");
+  }
+
+  Status Visit(const StringViewArray& array) {
+    return Status::NotImplemented(array.type()->ToString());
+  }
+
   Status Visit(const ListArray& array) {
     WriteValidityField(array);
     WriteIntegerField("OFFSET", array.raw_value_offsets(), array.length() + 1);
@@ -1185,6 +1217,22 @@ class ArrayReader {
     return Status::OK();
   }
 
+  Status Visit(const RunLengthEncodedType& type) {
+    return Status::NotImplemented("run_length_encoded");
+  }
+
+  Status Visit(const LargeBinaryType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
+  Status Visit(const LargeListType& type) {
+    return Status::NotImplemented("large_list");
+  }
+
+  Status Visit(const StringViewType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
   Status Visit(const DictionaryType& type) {
     // This stores the indices in result_
     //
@@ -0,0 +1,639 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/json-lines.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rapidjson/error/en.h"
+#include "rapidjson/memorystream.h"
+#include "rapidjson/reader.h"
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace ipc {
+namespace json {
+
+using FieldIndex = std::unordered_map<std::string, int>;
+
+static bool IsSupportedType(Type::type id) {
+  switch (id) {
+    case Type::NA:
+    case Type::BOOL:
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::STRING:
+    case Type::BINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// ----------------------------------------------------------------------
+// SAX handlers
+
+// Handle the structure of the lines, each being a flat JSON object
+class LineHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, LineHandler> {
+ public:
+  LineHandler() : in_object_(false) {}
+
+  const Status& status() const { return status_; }
+
+  bool StartArray() {
+    return Fail(Status::NotImplemented("JSON arrays are not supported"));
+  }
+
+  bool EndArray(rapidjson::SizeType) { return false; }
+
+ protected:
+  bool Fail(const Status& status) {
+    status_ = status;
+    return false;
+  }
+
+  bool Check(const Status& status) {
+    if (!status.ok()) {
+      return Fail(status);
+    }
+    return true;
+  }
+
+  bool BeginObject() {
+    if (in_object_) {
+      return Fail(Status::NotImplemented("Nested JSON objects are not supported"));
+    }
+    in_object_ = true;
+    return true;
+  }
+
+  bool FinishObject() {
+    in_object_ = false;
+    return true;
+  }
+
+  // Values are only expected as members of the object of a line
+  bool CheckValue() {
+    if (!in_object_) {
+      return Fail(Status::Invalid("Each line must hold a JSON object"));
+    }
+    return true;
+  }
+
+  bool in_object_;
+  Status status_;
+};
+
+// Collect the fields of the objects and the kinds of their values
+class InferHandler : public LineHandler {
+ public:
+  struct Kind {
+    // A field holding integers and doubles is a double field
+    enum type { NONE, BOOLEAN, INTEGER, DOUBLE, STRING };
+  };
+
+  InferHandler() : current_(-1) {}
+
+  bool StartObject() { return BeginObject(); }
+
+  bool EndObject(rapidjson::SizeType) { return FinishObject(); }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool) {
+    std::string name(str, length);
+    auto it = index_.find(name);
+    if (it == index_.end()) {
+      current_ = static_cast<int>(names_.size());
+      index_[name] = current_;
+      names_.push_back(name);
+      kinds_.push_back(Kind::NONE);
+    } else {
+      current_ = it->second;
+    }
+    return true;
+  }
+
+  bool Null() { return Observe(Kind::NONE); }
+  bool Bool(bool) { return Observe(Kind::BOOLEAN); }
+  bool Int(int) { return Observe(Kind::INTEGER); }
+  bool Uint(unsigned) { return Observe(Kind::INTEGER); }
+  bool Int64(int64_t) { return Observe(Kind::INTEGER); }
+  bool Uint64(uint64_t value) {
+    return Observe(value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())
+                       ? Kind::DOUBLE
+                       : Kind::INTEGER);
+  }
+  bool Double(double) { return Observe(Kind::DOUBLE); }
+  bool String(const char*, rapidjson::SizeType, bool) { return Observe(Kind::STRING); }
+
+  std::shared_ptr<Schema> GetSchema() const {
+    std::vector<std::shared_ptr<Field>> fields;
+    for (size_t i = 0; i < names_.size(); ++i) {
+      std::shared_ptr<DataType> type;
+      switch (kinds_[i]) {
+        case Kind::BOOLEAN:
+          type = boolean();
+          break;
+        case Kind::INTEGER:
+          type = int64();
+          break;
+        case Kind::DOUBLE:
+          type = float64();
+          break;
+        case Kind::STRING:
+          type = utf8();
+          break;
+        default:
+          type = null();
+          break;
+      }
+      fields.push_back(field(names_[i], type));
+    }
+    return ::arrow::schema(fields);
+  }
+
+ private:
+  bool Observe(Kind::type kind) {
+    if (!CheckValue()) {
+      return false;
+    }
+    Kind::type& current = kinds_[current_];
+    if (kind == Kind::NONE || kind == current) {
+      return true;
+    }
+    if (current == Kind::NONE) {
+      current = kind;
+    } else if ((current == Kind::INTEGER && kind == Kind::DOUBLE) ||
+               (current == Kind::DOUBLE && kind == Kind::INTEGER)) {
+      current = Kind::DOUBLE;
+    } else {
+      return Fail(Status::Invalid("Field '" + names_[current_] +
+                                  "' holds JSON values of different types"));
+    }
+    return true;
+  }
+
+  int current_;
+  std::vector<std::string> names_;
+  std::vector<Kind::type> kinds_;
+  FieldIndex index_;
+};
+
+template <typename c_type>
+static bool IntegerInRange(int64_t value) {
+  if (value < 0) {
+    return value >= static_cast<int64_t>(std::numeric_limits<c_type>::min());
+  }
+  return static_cast<uint64_t>(value) <=
+         static_cast<uint64_t>(std::numeric_limits<c_type>::max());
+}
+
+// Append the values of the objects to the builders of the schema fields
+class BuildHandler : public LineHandler {
+ public:
+  BuildHandler(const Schema& schema, const FieldIndex& index,
+               std::vector<std::unique_ptr<ArrayBuilder>>* builders)
+      : schema_(schema),
+        index_(index),
+        builders_(*builders),
+        seen_(builders->size(), false),
+        current_(-1),
+        next_(0),
+        num_rows_(0) {}
+
+  int64_t num_rows() const { return num_rows_; }
+
+  bool StartObject() {
+    std::fill(seen_.begin(), seen_.end(), false);
+    next_ = 0;
+    return BeginObject();
+  }
+
+  bool EndObject(rapidjson::SizeType) {
+    for (size_t i = 0; i < seen_.size(); ++i) {
+      if (!seen_[i] && !Check(AppendNull(static_cast<int>(i)))) {
+        return false;
+      }
+    }
+    ++num_rows_;
+    return FinishObject();
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool) {
+    // The keys of the lines usually come in the same order as the fields,
+    // which spares the lookup
+    if (next_ < schema_.num_fields() && MatchesField(next_, str, length)) {
+      current_ = next_;
+    } else {
+      auto it = index_.find(std::string(str, length));
+      current_ = it == index_.end() ? -1 : it->second;
+    }
+    if (current_ < 0) {
+      // Not in the schema
+      return true;
+    }
+    if (seen_[current_]) {
+      return Fail(Status::Invalid("Duplicate key '" + schema_.field(current_)->name() +
+                                  "' in a JSON object"));
+    }
+    seen_[current_] = true;
+    next_ = current_ + 1;
+    return true;
+  }
+
+  bool Null() { return CheckValue() && (current_ < 0 || Check(AppendNull(current_))); }
+
+  bool Bool(bool value) {
+    if (!CheckValue() || current_ < 0) {
+      return status_.ok();
+    }
+    if (type_id(current_) != Type::BOOL) {
+      return TypeError("a boolean");
+    }
+    return Check(static_cast<BooleanBuilder*>(builders_[current_].get())->Append(value));
+  }
+
+  bool Int(int value) { return Integer(value); }
+  bool Uint(unsigned value) { return Integer(value); }
+  bool Int64(int64_t value) { return Integer(value); }
+
+  bool Uint64(uint64_t value) {
+    if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+      return Integer(static_cast<int64_t>(value));
+    }
+    if (!CheckValue() || current_ < 0) {
+      return status_.ok();
+    }
+    if (type_id(current_) == Type::UINT64) {
+      return Check(static_cast<UInt64Builder*>(builders_[current_].get())->Append(value));
+    }
+    return Double(static_cast<double>(value));
+  }
+
+  bool Double(double value) {
+    if (!CheckValue() || current_ < 0) {
+      return status_.ok();
+    }
+    ArrayBuilder* builder = builders_[current_].get();
+    switch (type_id(current_)) {
+      case Type::FLOAT:
+        return Check(
+            static_cast<FloatBuilder*>(builder)->Append(static_cast<float>(value)));
+      case Type::DOUBLE:
+        return Check(static_cast<DoubleBuilder*>(builder)->Append(value));
+      default:
+        return TypeError("a non-integer number");
+    }
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool) {
+    if (!CheckValue() || current_ < 0) {
+      return status_.ok();
+    }
+    const Type::type id = type_id(current_);
+    if (id != Type::STRING && id != Type::BINARY) {
+      return TypeError("a string");
+    }
+    return Check(static_cast<BinaryBuilder*>(builders_[current_].get())
+                     ->Append(str, static_cast<int32_t>(length)));
+  }
+
+ private:
+  Type::type type_id(int i) const { return schema_.field(i)->type()->id(); }
+
+  bool MatchesField(int i, const char* str, rapidjson::SizeType length) const {
+    const std::string& name = schema_.field(i)->name();
+    return name.size() == length && std::memcmp(name.data(), str, length) == 0;
+  }
+
+  bool TypeError(const char* kind) {
+    std::stringstream ss;
+    ss << "Found " << kind << " for field '" << schema_.field(current_)->name()
+       << "' of type " << schema_.field(current_)->type()->ToString();
+    return Fail(Status::Invalid(ss.str()));
+  }
+
+  bool Integer(int64_t value) {
+    if (!CheckValue() || current_ < 0) {
+      return status_.ok();
+    }
+    ArrayBuilder* builder = builders_[current_].get();
+
+#define INTEGER_CASE(ENUM, ArrowType)                                                 \
+  case Type::ENUM: {                                                                \
+    using c_type = ArrowType::c_type;                                                \
+    if (!IntegerInRange<c_type>(value)) {                                           \
+      return TypeError("an out of range integer");                                  \
+    }                                                                               \
+    return Check(static_cast<NumericBuilder<ArrowType>*>(builder)->Append(        \
+        static_cast<c_type>(value)));                                               \
+  }
+
+    switch (type_id(current_)) {
+      INTEGER_CASE(INT8, Int8Type);
+      INTEGER_CASE(INT16, Int16Type);
+      INTEGER_CASE(INT32, Int32Type);
+      INTEGER_CASE(INT64, Int64Type);
+      INTEGER_CASE(UINT8, UInt8Type);
+      INTEGER_CASE(UINT16, UInt16Type);
+      INTEGER_CASE(UINT32, UInt32Type);
+      INTEGER_CASE(UINT64, UInt64Type);
+      case Type::FLOAT:
+        return Check(
+            static_cast<FloatBuilder*>(builder)->Append(static_cast<float>(value)));
+      case Type::DOUBLE:
+        return Check(
+            static_cast<DoubleBuilder*>(builder)->Append(static_cast<double>(value)));
+      default:
+        return TypeError("an integer");
+    }
+
+#undef INTEGER_CASE
+  }
+
+  Status AppendNull(int i) {
+    ArrayBuilder* builder = builders_[i].get();
+
+#define NULL_CASE(ENUM, BuilderType) \
+  case Type::ENUM:                   \
+    return static_cast<BuilderType*>(builder)->AppendNull();
+
+    switch (type_id(i)) {
+      NULL_CASE(NA, NullBuilder);
+      NULL_CASE(BOOL, BooleanBuilder);
+      NULL_CASE(INT8, Int8Builder);
+      NULL_CASE(INT16, Int16Builder);
+      NULL_CASE(INT32, Int32Builder);
+      NULL_CASE(INT64, Int64Builder);
+      NULL_CASE(UINT8, UInt8Builder);
+      NULL_CASE(UINT16, UInt16Builder);
+      NULL_CASE(UINT32, UInt32Builder);
+      NULL_CASE(UINT64, UInt64Builder);
+      NULL_CASE(FLOAT, FloatBuilder);
+      NULL_CASE(DOUBLE, DoubleBuilder);
+      NULL_CASE(STRING, StringBuilder);
+      NULL_CASE(BINARY, BinaryBuilder);
+      default:
+        break;
+    }
+
+#undef NULL_CASE
+
+    return Status::NotImplemented(schema_.field(i)->type()->ToString());
+  }
+
+  const Schema& schema_;
+  const FieldIndex& index_;
+  std::vector<std::unique_ptr<ArrayBuilder>>& builders_;
+
+  // The fields found in the object being parsed
+  std::vector<bool> seen_;
+  int current_;
+  int next_;
+  int64_t num_rows_;
+};
+
+// Parse all the JSON objects of a block of whole lines
+template <class Handler>
+static Status ParseLines(const Buffer& block, Handler* handler) {
+  const size_t size = static_cast<size_t>(block.size());
+  rapidjson::MemoryStream stream(reinterpret_cast<const char*>(block.data()), size);
+  rapidjson::Reader reader;
+  while (true) {
+    rapidjson::SkipWhitespace(stream);
+    if (stream.Tell() == size) {
+      break;
+    }
+    reader.Parse<rapidjson::kParseStopWhenDoneFlag>(stream, *handler);
+    if (reader.HasParseError()) {
+      RETURN_NOT_OK(handler->status());
+      std::stringstream ss;
+      ss << "JSON parse error at byte " << reader.GetErrorOffset()
+         << " of a block: " << rapidjson::GetParseError_En(reader.GetParseErrorCode());
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// LineReader implementation
+
+class LineReader::LineReaderImpl {
+ public:
+  LineReaderImpl(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                 const LineReadOptions& options)
+      : pool_(pool), input_(input), options_(options), eof_(false) {}
+
+  Status Open(const std::shared_ptr<Schema>& schema) {
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Block size must be positive");
+    }
+    if (schema) {
+      schema_ = schema;
+    } else {
+      // The first block is kept to be parsed again into the first batch
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(ReadBlock(&block));
+      InferHandler handler;
+      if (block) {
+        RETURN_NOT_OK(ParseLines(*block, &handler));
+        blocks_.push_back(block);
+      }
+      schema_ = handler.GetSchema();
+    }
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const auto& field = schema_->field(i);
+      if (!IsSupportedType(field->type()->id())) {
+        return Status::NotImplemented("Reading JSON into field of type " +
+                                      field->type()->ToString());
+      }
+      index_[field->name()] = i;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) {
+    while (batches_.empty()) {
+      if (eof_ && blocks_.empty()) {
+        out->reset();
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ParseNextBlocks());
+    }
+    *out = batches_.front();
+    batches_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  // Read the next block of whole lines, or null at the end of the input
+  Status ReadBlock(std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<Buffer> block = partial_;
+    partial_.reset();
+    while (!eof_) {
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(input_->Read(options_.block_size, &data));
+      if (data->size() == 0) {
+        eof_ = true;
+        break;
+      }
+      if (block && block->size() > 0) {
+        std::shared_ptr<Buffer> joined;
+        RETURN_NOT_OK(AllocateBuffer(pool_, block->size() + data->size(), &joined));
+        std::memcpy(joined->mutable_data(), block->data(),
+                    static_cast<size_t>(block->size()));
+        std::memcpy(joined->mutable_data() + block->size(), data->data(),
+                    static_cast<size_t>(data->size()));
+        block = joined;
+      } else {
+        block = data;
+      }
+
+      // Only the data just read can hold the last end of line
+      const uint8_t* begin = block->data() + block->size() - data->size();
+      const uint8_t* end = block->data() + block->size();
+      const uint8_t* last_eol = end;
+      for (const uint8_t* p = end; p != begin; --p) {
+        if (*(p - 1) == '\n') {
+          last_eol = p - 1;
+          break;
+        }
+      }
+      if (last_eol != end) {
+        const int64_t length = last_eol - block->data() + 1;
+        partial_ = SliceBuffer(block, length, block->size() - length);
+        *out = SliceBuffer(block, 0, length);
+        return Status::OK();
+      }
+    }
+    // The last line may not end with an end of line
+    *out = block && block->size() > 0 ? block : nullptr;
+    return Status::OK();
+  }
+
+  Status ParseBlock(const Buffer& block, std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::unique_ptr<ArrayBuilder>> builders(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      RETURN_NOT_OK(MakeBuilder(pool_, schema_->field(i)->type(), &builders[i]));
+    }
+    BuildHandler handler(*schema_, index_, &builders);
+    RETURN_NOT_OK(ParseLines(block, &handler));
+
+    std::vector<std::shared_ptr<Array>> columns(builders.size());
+    for (size_t i = 0; i < builders.size(); ++i) {
+      RETURN_NOT_OK(builders[i]->Finish(&columns[i]));
+    }
+    *out = RecordBatch::Make(schema_, handler.num_rows(), std::move(columns));
+    return Status::OK();
+  }
+
+  // Read a block per thread and parse them concurrently, into one batch each
+  Status ParseNextBlocks() {
+    const int num_threads = options_.use_threads ? GetCpuThreadPoolCapacity() : 1;
+    while (static_cast<int>(blocks_.size()) < num_threads && !eof_) {
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(ReadBlock(&block));
+      if (block) {
+        blocks_.push_back(block);
+      }
+    }
+
+    const int num_blocks = static_cast<int>(blocks_.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_blocks);
+    RETURN_NOT_OK(ParallelFor(num_threads, num_blocks, [this, &batches](int i) {
+      return ParseBlock(*blocks_[i], &batches[i]);
+    }));
+    blocks_.clear();
+
+    for (const auto& batch : batches) {
+      if (batch->num_rows() > 0) {
+        batches_.push_back(batch);
+      }
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<io::InputStream> input_;
+  LineReadOptions options_;
+
+  std::shared_ptr<Schema> schema_;
+  FieldIndex index_;
+
+  // The start of a line whose end has not been read yet
+  std::shared_ptr<Buffer> partial_;
+  bool eof_;
+
+  std::vector<std::shared_ptr<Buffer>> blocks_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
+LineReader::LineReader() {}
+
+LineReader::~LineReader() {}
+
+Status LineReader::Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                        const std::shared_ptr<Schema>& schema,
+                        const LineReadOptions& options,
+                        std::shared_ptr<LineReader>* out) {
+  std::shared_ptr<LineReader> result(new LineReader());
+  result->impl_.reset(new LineReaderImpl(pool, input, options));
+  RETURN_NOT_OK(result->impl_->Open(schema));
+  *out = result;
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> LineReader::schema() const { return impl_->schema(); }
+
+Status LineReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(batch);
+}
+
+}  // namespace json
+}  // namespace ipc
+}  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Read line-delimited JSON, one object per line, as record batches
+
+#ifndef ARROW_IPC_JSON_LINES_H
+#define ARROW_IPC_JSON_LINES_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Schema;
+
+namespace io {
+
+class InputStream;
+
+}  // namespace io
+
+namespace ipc {
+namespace json {
+
+struct ARROW_EXPORT LineReadOptions {
+  LineReadOptions() : block_size(1 << 20), use_threads(true) {}
+
+  /// Approximate number of bytes parsed into each record batch. Blocks are
+  /// extended to the end of their last line
+  int64_t block_size;
+
+  /// Parse several blocks at once on the CPU thread pool
+  bool use_threads;
+};
+
+/// \class LineReader
+/// \brief Read a stream of JSON objects, one per line, as record batches
+///
+/// The objects are parsed with a SAX parser straight into array builders,
+/// a block of lines at a time, so memory use is bounded by the block size
+/// and the number of threads. Keys missing from an object are read as nulls
+/// and keys that are not in the schema are ignored. Only flat objects, whose
+/// values are null, booleans, numbers or strings, are supported
+class ARROW_EXPORT LineReader : public RecordBatchReader {
+ public:
+  ~LineReader() override;
+
+  /// \brief Open a reader of record batches of the given schema
+  ///
+  /// \param[in] pool a MemoryPool to use for buffer allocations
+  /// \param[in] input the line-delimited JSON
+  /// \param[in] schema the schema of the record batches, or null to infer it
+  /// from the first block. Numbers are then read as int64, or double if any
+  /// of them is not an integer, and all-null fields as the null type
+  /// \param[in] options the reading options
+  /// \param[out] out the created reader
+  /// \return Status
+  static Status Open(MemoryPool* pool, const std::shared_ptr<io::InputStream>& input,
+                     const std::shared_ptr<Schema>& schema,
+                     const LineReadOptions& options, std::shared_ptr<LineReader>* out);
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
+
+ private:
+  LineReader();
+
+  class ARROW_NO_EXPORT LineReaderImpl;
+  std::unique_ptr<LineReaderImpl> impl_;
+};
+
+}  // namespace json
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_JSON_LINES_H
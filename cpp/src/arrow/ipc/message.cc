@@ -61,6 +61,8 @@ class Message::MessageImpl {
         return Message::RECORD_BATCH;
       case flatbuf::MessageHeader_Tensor:
         return Message::TENSOR;
+      case flatbuf::MessageHeader_SparseTensor:
+        return Message::SPARSE_TENSOR;
       default:
         return Message::NONE;
     }
@@ -133,6 +135,16 @@ bool Message::Equals(const Message& other) const {
   }
 }
 
+static Status CheckBodyLength(const Buffer& body, int64_t body_length) {
+  if (body.size() < body_length) {
+    std::stringstream ss;
+    ss << "Expected to be able to read " << body_length << " bytes for message body, got "
+       << body.size();
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+}
+
 Status Message::ReadFrom(const std::shared_ptr<Buffer>& metadata, io::InputStream* stream,
                          std::unique_ptr<Message>* out) {
   auto fb_message = flatbuf::GetMessage(metadata->data());
@@ -141,12 +153,20 @@ Status Message::ReadFrom(const std::shared_ptr<Buffer>& metadata, io::InputStrea
 
   std::shared_ptr<Buffer> body;
   RETURN_NOT_OK(stream->Read(body_length, &body));
-  if (body->size() < body_length) {
-    std::stringstream ss;
-    ss << "Expected to be able to read " << body_length << " bytes for message body, got "
-       << body->size();
-    return Status::IOError(ss.str());
-  }
+  RETURN_NOT_OK(CheckBodyLength(*body, body_length));
+
+  return Message::Open(metadata, body, out);
+}
+
+Status Message::ReadFrom(const int64_t offset, const std::shared_ptr<Buffer>& metadata,
+                         io::RandomAccessFile* file, std::unique_ptr<Message>* out) {
+  auto fb_message = flatbuf::GetMessage(metadata->data());
+
+  int64_t body_length = fb_message->bodyLength();
+
+  std::shared_ptr<Buffer> body;
+  RETURN_NOT_OK(file->ReadAt(offset, body_length, &body));
+  RETURN_NOT_OK(CheckBodyLength(*body, body_length));
 
   return Message::Open(metadata, body, out);
 }
@@ -174,6 +194,10 @@ std::string FormatMessageType(Message::Type type) {
       return "record batch";
     case Message::DICTIONARY_BATCH:
       return "dictionary";
+    case Message::TENSOR:
+      return "tensor";
+    case Message::SPARSE_TENSOR:
+      return "sparse tensor";
     default:
       break;
   }
@@ -204,7 +228,7 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
   }
 
   auto metadata = SliceBuffer(buffer, 4, buffer->size() - 4);
-  return Message::ReadFrom(metadata, file, message);
+  return Message::ReadFrom(offset + metadata_length, metadata, file, message);
 }
 
 Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
@@ -31,10 +31,12 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/File_generated.h"
 #include "arrow/ipc/Message_generated.h"
+#include "arrow/ipc/SparseTensor_generated.h"
 #include "arrow/ipc/Tensor_generated.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/util.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
@@ -148,6 +150,23 @@ static Status ListToFlatbuffer(FBB& fbb, const DataType& type,
   return Status::OK();
 }
 
+static Status LargeListToFlatbuffer(FBB& fbb, const DataType& type,
+                                    std::vector<FieldOffset>* out_children,
+                                    DictionaryMemo* dictionary_memo, Offset* offset) {
+  RETURN_NOT_OK(AppendChildFields(fbb, type, out_children, dictionary_memo));
+  *offset = flatbuf::CreateLargeList(fbb).Union();
+  return Status::OK();
+}
+
+static Status RunLengthEncodedToFlatbuffer(FBB& fbb, const DataType& type,
+                                           std::vector<FieldOffset>* out_children,
+                                           DictionaryMemo* dictionary_memo,
+                                           Offset* offset) {
+  RETURN_NOT_OK(AppendChildFields(fbb, type, out_children, dictionary_memo));
+  *offset = flatbuf::CreateRunLengthEncoded(fbb).Union();
+  return Status::OK();
+}
+
 static Status StructToFlatbuffer(FBB& fbb, const DataType& type,
                                  std::vector<FieldOffset>* out_children,
                                  DictionaryMemo* dictionary_memo, Offset* offset) {
@@ -270,6 +289,12 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
     case flatbuf::Type_Utf8:
       *out = utf8();
       return Status::OK();
+    case flatbuf::Type_LargeBinary:
+      *out = large_binary();
+      return Status::OK();
+    case flatbuf::Type_LargeUtf8:
+      *out = large_utf8();
+      return Status::OK();
     case flatbuf::Type_Bool:
       *out = boolean();
       return Status::OK();
@@ -326,6 +351,18 @@ static Status TypeFromFlatbuffer(flatbuf::Type type, const void* type_data,
       }
       *out = std::make_shared<ListType>(children[0]);
       return Status::OK();
+    case flatbuf::Type_LargeList:
+      if (children.size() != 1) {
+        return Status::Invalid("LargeList must have exactly 1 child field");
+      }
+      *out = std::make_shared<LargeListType>(children[0]);
+      return Status::OK();
+    case flatbuf::Type_RunLengthEncoded:
+      if (children.size() != 1) {
+        return Status::Invalid("RunLengthEncoded must have exactly 1 child field");
+      }
+      *out = run_length_encoded(children[0]->type());
+      return Status::OK();
     case flatbuf::Type_Struct_:
       *out = std::make_shared<StructType>(children);
       return Status::OK();
@@ -401,6 +438,14 @@ static Status TypeToFlatbuffer(FBB& fbb, const DataType& type,
       *out_type = flatbuf::Type_Utf8;
       *offset = flatbuf::CreateUtf8(fbb).Union();
       break;
+    case Type::LARGE_BINARY:
+      *out_type = flatbuf::Type_LargeBinary;
+      *offset = flatbuf::CreateLargeBinary(fbb).Union();
+      break;
+    case Type::LARGE_STRING:
+      *out_type = flatbuf::Type_LargeUtf8;
+      *offset = flatbuf::CreateLargeUtf8(fbb).Union();
+      break;
     case Type::DATE32:
       *out_type = flatbuf::Type_Date;
       *offset = flatbuf::CreateDate(fbb, flatbuf::DateUnit_DAY).Union();
@@ -439,6 +484,13 @@ static Status TypeToFlatbuffer(FBB& fbb, const DataType& type,
     case Type::LIST:
       *out_type = flatbuf::Type_List;
       return ListToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
+    case Type::LARGE_LIST:
+      *out_type = flatbuf::Type_LargeList;
+      return LargeListToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
+    case Type::RUN_LENGTH_ENCODED:
+      *out_type = flatbuf::Type_RunLengthEncoded;
+      return RunLengthEncodedToFlatbuffer(fbb, *value_type, children, dictionary_memo,
+                                          offset);
     case Type::STRUCT:
       *out_type = flatbuf::Type_Struct_;
       return StructToFlatbuffer(fbb, *value_type, children, dictionary_memo, offset);
@@ -601,6 +653,20 @@ flatbuf::Endianness endianness() {
   return bint.c[0] == 1 ? flatbuf::Endianness_Big : flatbuf::Endianness_Little;
 }
 
+static flatbuffers::Offset<flatbuffers::Vector<KeyValueOffset>>
+KeyValueMetadataToFlatbuffer(FBB& fbb, const KeyValueMetadata& metadata) {
+  std::vector<KeyValueOffset> key_value_offsets;
+  size_t metadata_size = metadata.size();
+  key_value_offsets.reserve(metadata_size);
+  for (size_t i = 0; i < metadata_size; ++i) {
+    const auto& key = metadata.key(i);
+    const auto& value = metadata.value(i);
+    key_value_offsets.push_back(
+        flatbuf::CreateKeyValue(fbb, fbb.CreateString(key), fbb.CreateString(value)));
+  }
+  return fbb.CreateVector(key_value_offsets);
+}
+
 static Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema,
                                  DictionaryMemo* dictionary_memo,
                                  flatbuffers::Offset<flatbuf::Schema>* out) {
@@ -618,17 +684,8 @@ static Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema,
   const KeyValueMetadata* metadata = schema.metadata().get();
 
   if (metadata != nullptr) {
-    std::vector<KeyValueOffset> key_value_offsets;
-    size_t metadata_size = metadata->size();
-    key_value_offsets.reserve(metadata_size);
-    for (size_t i = 0; i < metadata_size; ++i) {
-      const auto& key = metadata->key(i);
-      const auto& value = metadata->value(i);
-      key_value_offsets.push_back(
-          flatbuf::CreateKeyValue(fbb, fbb.CreateString(key), fbb.CreateString(value)));
-    }
     *out = flatbuf::CreateSchema(fbb, endianness(), fb_offsets,
-                                 fbb.CreateVector(key_value_offsets));
+                                 KeyValueMetadataToFlatbuffer(fbb, *metadata));
   } else {
     *out = flatbuf::CreateSchema(fbb, endianness(), fb_offsets);
   }
@@ -669,61 +726,196 @@ using FieldNodeVector =
     flatbuffers::Offset<flatbuffers::Vector<const flatbuf::FieldNode*>>;
 using BufferVector = flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Buffer*>>;
 
+// fb_nodes is scratch space, kept by the caller between messages
 static Status WriteFieldNodes(FBB& fbb, const std::vector<FieldMetadata>& nodes,
+                              std::vector<flatbuf::FieldNode>* fb_nodes,
                               FieldNodeVector* out) {
-  std::vector<flatbuf::FieldNode> fb_nodes;
-  fb_nodes.reserve(nodes.size());
+  fb_nodes->clear();
+  fb_nodes->reserve(nodes.size());
 
   for (size_t i = 0; i < nodes.size(); ++i) {
     const FieldMetadata& node = nodes[i];
     if (node.offset != 0) {
       return Status::Invalid("Field metadata for IPC must have offset 0");
     }
-    fb_nodes.emplace_back(node.length, node.null_count);
+    fb_nodes->emplace_back(node.length, node.null_count);
   }
-  *out = fbb.CreateVectorOfStructs(fb_nodes);
+  *out = fbb.CreateVectorOfStructs(*fb_nodes);
   return Status::OK();
 }
 
+// fb_buffers is scratch space, kept by the caller between messages
 static Status WriteBuffers(FBB& fbb, const std::vector<BufferMetadata>& buffers,
-                           BufferVector* out) {
-  std::vector<flatbuf::Buffer> fb_buffers;
-  fb_buffers.reserve(buffers.size());
+                           std::vector<flatbuf::Buffer>* fb_buffers, BufferVector* out) {
+  fb_buffers->clear();
+  fb_buffers->reserve(buffers.size());
 
   for (size_t i = 0; i < buffers.size(); ++i) {
     const BufferMetadata& buffer = buffers[i];
-    fb_buffers.emplace_back(buffer.offset, buffer.length);
+    fb_buffers->emplace_back(buffer.offset, buffer.length);
   }
-  *out = fbb.CreateVectorOfStructs(fb_buffers);
+  *out = fbb.CreateVectorOfStructs(*fb_buffers);
   return Status::OK();
 }
 
-static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
-                              const std::vector<FieldMetadata>& nodes,
-                              const std::vector<BufferMetadata>& buffers,
-                              RecordBatchOffset* offset) {
+static Status CompressionToFlatbuffer(Compression::type compression,
+                                      flatbuf::CompressionType* out) {
+  switch (compression) {
+    case Compression::LZ4:
+      *out = flatbuf::CompressionType_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = flatbuf::CompressionType_ZSTD;
+      break;
+    case Compression::SNAPPY:
+      *out = flatbuf::CompressionType_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = flatbuf::CompressionType_GZIP;
+      break;
+    case Compression::BROTLI:
+      *out = flatbuf::CompressionType_BROTLI;
+      break;
+    default:
+      return Status::NotImplemented("Unsupported codec for IPC buffer compression");
+  }
+  return Status::OK();
+}
+
+static Status CompressionFromFlatbuffer(const flatbuf::BodyCompression* compression,
+                                        Compression::type* out) {
+  if (compression == nullptr) {
+    *out = Compression::UNCOMPRESSED;
+    return Status::OK();
+  }
+  if (compression->method() != flatbuf::BodyCompressionMethod_BUFFER) {
+    return Status::Invalid("Unknown body compression method");
+  }
+  switch (compression->codec()) {
+    case flatbuf::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    case flatbuf::CompressionType_SNAPPY:
+      *out = Compression::SNAPPY;
+      break;
+    case flatbuf::CompressionType_GZIP:
+      *out = Compression::GZIP;
+      break;
+    case flatbuf::CompressionType_BROTLI:
+      *out = Compression::BROTLI;
+      break;
+    default:
+      return Status::Invalid("Unknown body compression codec");
+  }
+  return Status::OK();
+}
+
+Status GetCompression(const void* opaque_batch, Compression::type* out) {
+  auto batch = static_cast<const flatbuf::RecordBatch*>(opaque_batch);
+  return CompressionFromFlatbuffer(batch->compression(), out);
+}
+
+Status GetBatchLengths(const void* opaque_batch, std::vector<int64_t>* out) {
+  auto batch = static_cast<const flatbuf::RecordBatch*>(opaque_batch);
+  out->clear();
+  const flatbuffers::Vector<int64_t>* lengths = batch->batchLengths();
+  if (lengths == nullptr) {
+    return Status::OK();
+  }
+  int64_t total_length = 0;
+  for (int64_t length : *lengths) {
+    if (length < 0) {
+      return Status::Invalid("Negative coalesced record batch length");
+    }
+    total_length += length;
+    out->push_back(length);
+  }
+  if (total_length != batch->length()) {
+    return Status::Invalid("Coalesced record batch lengths do not add up to its length");
+  }
+  return Status::OK();
+}
+
+RecordBatchMetadataWriter::RecordBatchMetadataWriter() {}
+
+RecordBatchMetadataWriter::~RecordBatchMetadataWriter() {}
+
+Status RecordBatchMetadataWriter::MakeRecordBatch(
+    int64_t length, const std::vector<FieldMetadata>& nodes,
+    const std::vector<BufferMetadata>& buffers, Compression::type compression,
+    const std::vector<int64_t>& batch_lengths, RecordBatchOffset* offset) {
+  FBB& fbb = fbb_;
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression;
+  flatbuffers::Offset<flatbuffers::Vector<int64_t>> fb_batch_lengths;
+
+  // Keeps the memory of the previous message
+  fbb.Clear();
+  RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &nodes_, &fb_nodes));
+  RETURN_NOT_OK(WriteBuffers(fbb, buffers, &buffers_, &fb_buffers));
+  if (compression != Compression::UNCOMPRESSED) {
+    flatbuf::CompressionType codec;
+    RETURN_NOT_OK(CompressionToFlatbuffer(compression, &codec));
+    fb_compression =
+        flatbuf::CreateBodyCompression(fbb, codec, flatbuf::BodyCompressionMethod_BUFFER);
+  }
 
-  RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
-  RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
+  if (!batch_lengths.empty()) {
+    fb_batch_lengths = fbb.CreateVector(batch_lengths);
+  }
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression,
+                                       fb_batch_lengths);
   return Status::OK();
 }
 
+Status RecordBatchMetadataWriter::WriteRecordBatch(
+    int64_t length, int64_t body_length, const std::vector<FieldMetadata>& nodes,
+    const std::vector<BufferMetadata>& buffers, Compression::type compression,
+    const std::vector<int64_t>& batch_lengths, std::shared_ptr<Buffer>* out) {
+  RecordBatchOffset record_batch;
+  RETURN_NOT_OK(
+      MakeRecordBatch(length, nodes, buffers, compression, batch_lengths, &record_batch));
+  return WriteFBMessage(fbb_, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
+                        body_length, out);
+}
+
+Status RecordBatchMetadataWriter::WriteDictionary(
+    int64_t id, int64_t length, int64_t body_length,
+    const std::vector<FieldMetadata>& nodes, const std::vector<BufferMetadata>& buffers,
+    bool is_delta, std::shared_ptr<Buffer>* out) {
+  RecordBatchOffset record_batch;
+  RETURN_NOT_OK(MakeRecordBatch(length, nodes, buffers, Compression::UNCOMPRESSED, {},
+                                &record_batch));
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb_, id, record_batch, is_delta).Union();
+  return WriteFBMessage(fbb_, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
+                        body_length, out);
+}
+
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
+                               const std::vector<int64_t>& batch_lengths,
                                std::shared_ptr<Buffer>* out) {
-  FBB fbb;
-  RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
-                        body_length, out);
+  RecordBatchMetadataWriter writer;
+  return writer.WriteRecordBatch(length, body_length, nodes, buffers, compression,
+                                 batch_lengths, out);
+}
+
+Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
+                          std::shared_ptr<Buffer>* out) {
+  return WriteTensorMessage(tensor, buffer_start_offset, tensor.data()->size(),
+                            Compression::UNCOMPRESSED, out);
 }
 
 Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
+                          int64_t body_length, Compression::type compression,
                           std::shared_ptr<Buffer>* out) {
   using TensorDimOffset = flatbuffers::Offset<flatbuf::TensorDim>;
   using TensorOffset = flatbuffers::Offset<flatbuf::Tensor>;
@@ -742,26 +934,81 @@ Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
 
   auto fb_shape = fbb.CreateVector(dims);
   auto fb_strides = fbb.CreateVector(tensor.strides());
-  int64_t body_length = tensor.data()->size();
   flatbuf::Buffer buffer(buffer_start_offset, body_length);
 
-  TensorOffset fb_tensor =
-      flatbuf::CreateTensor(fbb, fb_type_type, fb_type, fb_shape, fb_strides, &buffer);
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression;
+  if (compression != Compression::UNCOMPRESSED) {
+    flatbuf::CompressionType codec;
+    RETURN_NOT_OK(CompressionToFlatbuffer(compression, &codec));
+    fb_compression =
+        flatbuf::CreateBodyCompression(fbb, codec, flatbuf::BodyCompressionMethod_BUFFER);
+  }
+
+  TensorOffset fb_tensor = flatbuf::CreateTensor(fbb, fb_type_type, fb_type, fb_shape,
+                                                 fb_strides, &buffer, fb_compression);
 
   return WriteFBMessage(fbb, flatbuf::MessageHeader_Tensor, fb_tensor.Union(),
                         body_length, out);
 }
 
+Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_length,
+                                const std::vector<BufferMetadata>& buffers,
+                                std::shared_ptr<Buffer>* out) {
+  using TensorDimOffset = flatbuffers::Offset<flatbuf::TensorDim>;
+  using SparseTensorOffset = flatbuffers::Offset<flatbuf::SparseTensor>;
+
+  FBB fbb;
+
+  flatbuf::Type fb_type_type;
+  Offset fb_type;
+  RETURN_NOT_OK(
+      TensorTypeToFlatbuffer(fbb, *sparse_tensor.type(), &fb_type_type, &fb_type));
+
+  std::vector<TensorDimOffset> dims;
+  for (int i = 0; i < sparse_tensor.ndim(); ++i) {
+    FBString name = fbb.CreateString(sparse_tensor.dim_name(i));
+    dims.push_back(flatbuf::CreateTensorDim(fbb, sparse_tensor.shape()[i], name));
+  }
+  auto fb_shape = fbb.CreateVector(dims);
+
+  // The buffers of the sparse index come first, then the data
+  flatbuf::SparseTensorIndex fb_index_type;
+  Offset fb_index;
+  switch (sparse_tensor.format_id()) {
+    case SparseTensorFormat::COO: {
+      DCHECK_EQ(2, buffers.size());
+      flatbuf::Buffer indices(buffers[0].offset, buffers[0].length);
+      fb_index_type = flatbuf::SparseTensorIndex_SparseTensorIndexCOO;
+      fb_index = flatbuf::CreateSparseTensorIndexCOO(fbb, &indices).Union();
+      break;
+    }
+    case SparseTensorFormat::CSR: {
+      DCHECK_EQ(3, buffers.size());
+      flatbuf::Buffer indptr(buffers[0].offset, buffers[0].length);
+      flatbuf::Buffer indices(buffers[1].offset, buffers[1].length);
+      fb_index_type = flatbuf::SparseTensorIndex_SparseMatrixIndexCSR;
+      fb_index = flatbuf::CreateSparseMatrixIndexCSR(fbb, &indptr, &indices).Union();
+      break;
+    }
+    default:
+      return Status::NotImplemented("Unsupported sparse tensor format");
+  }
+  flatbuf::Buffer data(buffers.back().offset, buffers.back().length);
+
+  SparseTensorOffset fb_sparse_tensor = flatbuf::CreateSparseTensor(
+      fbb, fb_type_type, fb_type, fb_shape, sparse_tensor.non_zero_length(),
+      fb_index_type, fb_index, &data);
+
+  return WriteFBMessage(fbb, flatbuf::MessageHeader_SparseTensor,
+                        fb_sparse_tensor.Union(), body_length, out);
+}
+
 Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
-                              const std::vector<BufferMetadata>& buffers,
+                              const std::vector<BufferMetadata>& buffers, bool is_delta,
                               std::shared_ptr<Buffer>* out) {
-  FBB fbb;
-  RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
-  return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
-                        body_length, out);
+  RecordBatchMetadataWriter writer;
+  return writer.WriteDictionary(id, length, body_length, nodes, buffers, is_delta, out);
 }
 
 static flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Block*>>
@@ -777,7 +1024,8 @@ FileBlocksToFlatbuffer(FBB& fbb, const std::vector<FileBlock>& blocks) {
 
 Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dictionaries,
                        const std::vector<FileBlock>& record_batches,
-                       DictionaryMemo* dictionary_memo, io::OutputStream* out) {
+                       DictionaryMemo* dictionary_memo, io::OutputStream* out,
+                       const KeyValueMetadata* custom_metadata) {
   FBB fbb;
 
   flatbuffers::Offset<flatbuf::Schema> fb_schema;
@@ -800,8 +1048,14 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
   auto fb_dictionaries = FileBlocksToFlatbuffer(fbb, dictionaries);
   auto fb_record_batches = FileBlocksToFlatbuffer(fbb, record_batches);
 
-  auto footer = flatbuf::CreateFooter(fbb, kCurrentMetadataVersion, fb_schema,
-                                      fb_dictionaries, fb_record_batches);
+  flatbuffers::Offset<flatbuffers::Vector<KeyValueOffset>> fb_custom_metadata = 0;
+  if (custom_metadata != nullptr) {
+    fb_custom_metadata = KeyValueMetadataToFlatbuffer(fbb, *custom_metadata);
+  }
+
+  auto footer =
+      flatbuf::CreateFooter(fbb, kCurrentMetadataVersion, fb_schema, fb_dictionaries,
+                            fb_record_batches, fb_custom_metadata);
 
   fbb.Finish(footer);
 
@@ -865,7 +1119,8 @@ Status GetSchema(const void* opaque_schema, const DictionaryMemo& dictionary_mem
 
 Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
                          std::vector<int64_t>* shape, std::vector<int64_t>* strides,
-                         std::vector<std::string>* dim_names) {
+                         std::vector<std::string>* dim_names,
+                         Compression::type* compression) {
   auto message = flatbuf::GetMessage(metadata.data());
   auto tensor = reinterpret_cast<const flatbuf::Tensor*>(message->header());
 
@@ -889,9 +1144,72 @@ Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type
     }
   }
 
+  RETURN_NOT_OK(CompressionFromFlatbuffer(tensor->compression(), compression));
   return TypeFromFlatbuffer(tensor->type_type(), tensor->type(), {}, type);
 }
 
+static Status AppendBufferMetadata(const flatbuf::Buffer* buffer,
+                                   std::vector<BufferMetadata>* out) {
+  if (buffer == nullptr) {
+    return Status::Invalid("Sparse tensor buffer was null");
+  }
+  out->push_back({buffer->offset(), buffer->length()});
+  return Status::OK();
+}
+
+Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
+                               std::vector<int64_t>* shape,
+                               std::vector<std::string>* dim_names,
+                               int64_t* non_zero_length,
+                               SparseTensorFormat::type* format_id,
+                               std::vector<BufferMetadata>* buffers) {
+  auto message = flatbuf::GetMessage(metadata.data());
+  if (message->header_type() != flatbuf::MessageHeader_SparseTensor) {
+    return Status::Invalid("Message is not a sparse tensor");
+  }
+  auto sparse_tensor = reinterpret_cast<const flatbuf::SparseTensor*>(message->header());
+  if (sparse_tensor->shape() == nullptr) {
+    return Status::Invalid("Sparse tensor shape was null");
+  }
+
+  const int ndim = static_cast<int>(sparse_tensor->shape()->size());
+  for (int i = 0; i < ndim; ++i) {
+    auto dim = sparse_tensor->shape()->Get(i);
+
+    shape->push_back(dim->size());
+    auto fb_name = dim->name();
+    if (fb_name == 0) {
+      dim_names->push_back("");
+    } else {
+      dim_names->push_back(fb_name->str());
+    }
+  }
+  *non_zero_length = sparse_tensor->nonZeroLength();
+
+  switch (sparse_tensor->sparseIndex_type()) {
+    case flatbuf::SparseTensorIndex_SparseTensorIndexCOO: {
+      auto index = reinterpret_cast<const flatbuf::SparseTensorIndexCOO*>(
+          sparse_tensor->sparseIndex());
+      *format_id = SparseTensorFormat::COO;
+      RETURN_NOT_OK(AppendBufferMetadata(index->indicesBuffer(), buffers));
+      break;
+    }
+    case flatbuf::SparseTensorIndex_SparseMatrixIndexCSR: {
+      auto index = reinterpret_cast<const flatbuf::SparseMatrixIndexCSR*>(
+          sparse_tensor->sparseIndex());
+      *format_id = SparseTensorFormat::CSR;
+      RETURN_NOT_OK(AppendBufferMetadata(index->indptrBuffer(), buffers));
+      RETURN_NOT_OK(AppendBufferMetadata(index->indicesBuffer(), buffers));
+      break;
+    }
+    default:
+      return Status::Invalid("Unrecognized sparse tensor index type");
+  }
+  RETURN_NOT_OK(AppendBufferMetadata(sparse_tensor->data(), buffers));
+
+  return TypeFromFlatbuffer(sparse_tensor->type_type(), sparse_tensor->type(), {}, type);
+}
+
 // ----------------------------------------------------------------------
 // Implement message writing
 
@@ -25,14 +25,20 @@
 #include <string>
 #include <vector>
 
+#include <flatbuffers/flatbuffers.h>
+
+#include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
 class Buffer;
 class DataType;
+class KeyValueMetadata;
 class Schema;
 class Status;
 class Tensor;
@@ -58,6 +64,14 @@ MetadataVersion GetMetadataVersion(flatbuf::MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// Footer metadata key of the per record batch statistics, an IPC stream of
+// the index taken with RecordBatchStreamWriter::GetIndex
+static constexpr const char* kBatchStatisticsKey = "ARROW:batch_statistics";
+
+// Footer metadata key of the locations of the Bloom filters of the record
+// batches, an IPC stream of their "batch", "field", "offset" and "length"
+static constexpr const char* kBloomFiltersKey = "ARROW:bloom_filters";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
@@ -92,9 +106,26 @@ Status GetDictionaryTypes(const void* opaque_schema, DictionaryTypeMap* id_to_fi
 Status GetSchema(const void* opaque_schema, const DictionaryMemo& dictionary_memo,
                  std::shared_ptr<Schema>* out);
 
+// Get the codec the buffers of a record batch message are compressed with, or
+// UNCOMPRESSED
+Status GetCompression(const void* opaque_batch, Compression::type* out);
+
+// Get the lengths of the record batches coalesced into a record batch message,
+// empty if it was written as is
+Status GetBatchLengths(const void* opaque_batch, std::vector<int64_t>* out);
+
 Status GetTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
                          std::vector<int64_t>* shape, std::vector<int64_t>* strides,
-                         std::vector<std::string>* dim_names);
+                         std::vector<std::string>* dim_names,
+                         Compression::type* compression);
+
+// The buffers are those of the sparse index, then the data
+Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>* type,
+                               std::vector<int64_t>* shape,
+                               std::vector<std::string>* dim_names,
+                               int64_t* non_zero_length,
+                               SparseTensorFormat::type* format_id,
+                               std::vector<BufferMetadata>* buffers);
 
 /// Write a serialized message metadata with a length-prefix and padding to an
 /// 8-byte offset
@@ -116,19 +147,68 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
+                               const std::vector<int64_t>& batch_lengths,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
                           std::shared_ptr<Buffer>* out);
 
+// Write the metadata of a tensor whose body, possibly compressed, is
+// body_length bytes long
+Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
+                          const int64_t body_length, Compression::type compression,
+                          std::shared_ptr<Buffer>* out);
+
+// The buffers are those of the sparse index, then the data
+Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_length,
+                                const std::vector<BufferMetadata>& buffers,
+                                std::shared_ptr<Buffer>* out);
+
 Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dictionaries,
                        const std::vector<FileBlock>& record_batches,
-                       DictionaryMemo* dictionary_memo, io::OutputStream* out);
+                       DictionaryMemo* dictionary_memo, io::OutputStream* out,
+                       const KeyValueMetadata* custom_metadata = NULLPTR);
+
+// Writes the metadata of successive record batch or dictionary messages. The
+// flatbuffer builder and the scratch space keep their memory between
+// messages, which for the record batches of a stream all have the same
+// number of field nodes and buffers
+class RecordBatchMetadataWriter {
+ public:
+  RecordBatchMetadataWriter();
+  ~RecordBatchMetadataWriter();
+
+  Status WriteRecordBatch(int64_t length, int64_t body_length,
+                          const std::vector<FieldMetadata>& nodes,
+                          const std::vector<BufferMetadata>& buffers,
+                          Compression::type compression,
+                          const std::vector<int64_t>& batch_lengths,
+                          std::shared_ptr<Buffer>* out);
+
+  Status WriteDictionary(int64_t id, int64_t length, int64_t body_length,
+                         const std::vector<FieldMetadata>& nodes,
+                         const std::vector<BufferMetadata>& buffers, bool is_delta,
+                         std::shared_ptr<Buffer>* out);
+
+ private:
+  Status MakeRecordBatch(int64_t length, const std::vector<FieldMetadata>& nodes,
+                         const std::vector<BufferMetadata>& buffers,
+                         Compression::type compression,
+                         const std::vector<int64_t>& batch_lengths,
+                         flatbuffers::Offset<flatbuf::RecordBatch>* offset);
+
+  flatbuffers::FlatBufferBuilder fbb_;
+  std::vector<flatbuf::FieldNode> nodes_;
+  std::vector<flatbuf::Buffer> buffers_;
+};
 
+// is_delta marks the dictionary as values to append to the dictionary with
+// the same id
 Status WriteDictionaryMessage(const int64_t id, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
-                              const std::vector<BufferMetadata>& buffers,
+                              const std::vector<BufferMetadata>& buffers, bool is_delta,
                               std::shared_ptr<Buffer>* out);
 
 }  // namespace internal
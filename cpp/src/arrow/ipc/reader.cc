@@ -17,8 +17,14 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -29,6 +35,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/File_generated.h"
@@ -38,12 +45,20 @@
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bloom-filter.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -58,24 +73,116 @@ using internal::kArrowMagicBytes;
 // ----------------------------------------------------------------------
 // Record batch read path
 
+// Strip the uncompressed length prefix of a buffer, decompressing it unless
+// the length is -1
+static Status DecompressBuffer(Codec* codec, std::shared_ptr<Buffer>* buffer) {
+  ARROW_TRACE_SPAN("ipc", "DecompressBuffer");
+  const int64_t prefix_size = static_cast<int64_t>(sizeof(int64_t));
+  if ((*buffer)->size() < prefix_size) {
+    return Status::Invalid("Compressed buffer too short for its length prefix");
+  }
+  int64_t uncompressed_length;
+  std::memcpy(&uncompressed_length, (*buffer)->data(), sizeof(int64_t));
+  uncompressed_length = BitUtil::FromLittleEndian(uncompressed_length);
+  if (uncompressed_length == -1) {
+    *buffer = SliceBuffer(*buffer, prefix_size, (*buffer)->size() - prefix_size);
+    return Status::OK();
+  }
+  if (uncompressed_length < 0) {
+    return Status::Invalid("Invalid uncompressed length of compressed buffer");
+  }
+
+  std::shared_ptr<Buffer> uncompressed;
+  RETURN_NOT_OK(
+      AllocateBuffer(default_memory_pool(), uncompressed_length, &uncompressed));
+  RETURN_NOT_OK(codec->Decompress((*buffer)->size() - prefix_size,
+                                  (*buffer)->data() + prefix_size, uncompressed_length,
+                                  uncompressed->mutable_data()));
+  *buffer = uncompressed;
+  return Status::OK();
+}
+
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  // The buffer offsets in the metadata are relative to body_offset in file
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata),
+        file_(file),
+        body_offset_(body_offset),
+        compression_(Compression::UNCOMPRESSED) {}
+
+  // Reads still in flight, if loading failed, write into the arrays being
+  // loaded
+  ~IpcComponentSource() {
+    for (auto& done : pending_reads_) {
+      done.wait();
+    }
+  }
 
+  // Get the codec the buffers are compressed with, if any. Whether it is
+  // built is only checked by DecompressBuffers, rather than by creating a
+  // codec for every record batch read
+  Status Init() { return internal::GetCompression(metadata_, &compression_); }
+
+  // Compressed buffers are only decompressed by DecompressBuffers, once all
+  // the arrays of the batch have been laid out. Unless the file is in memory,
+  // the buffers are read concurrently and only set once WaitForBuffers returns
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
 
     if (buffer->length() == 0) {
       *out = nullptr;
       return Status::OK();
+    }
+    DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
+        << "Buffer " << buffer_index
+        << " did not start on 8-byte aligned offset: " << buffer->offset();
+    const int64_t position = body_offset_ + buffer->offset();
+    if (file_->supports_zero_copy()) {
+      RETURN_NOT_OK(file_->ReadAt(position, buffer->length(), out));
     } else {
-      DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
-          << "Buffer " << buffer_index
-          << " did not start on 8-byte aligned offset: " << buffer->offset();
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      std::future<Status> done;
+      RETURN_NOT_OK(file_->ReadAsync(position, buffer->length(), out, &done));
+      pending_reads_.push_back(std::move(done));
+    }
+    if (compression_ != Compression::UNCOMPRESSED) {
+      compressed_buffers_.push_back(out);
+    }
+    return Status::OK();
+  }
+
+  // Wait for the reads issued by GetBuffer, returning the first error
+  Status WaitForBuffers() {
+    Status st;
+    for (auto& done : pending_reads_) {
+      Status read_status = done.get();
+      if (st.ok()) {
+        st = read_status;
+      }
     }
+    pending_reads_.clear();
+    return st;
+  }
+
+  // Decompress the buffers read by GetBuffer, the buffers being independent
+  // of each other. Each task has its own codec, as codecs keep state
+  Status DecompressBuffers(int num_threads) {
+    const int num_buffers = static_cast<int>(compressed_buffers_.size());
+    std::atomic<int> next_buffer(0);
+    auto decompress = [&](int) -> Status {
+      std::unique_ptr<Codec> codec;
+      RETURN_NOT_OK(Codec::Create(compression_, &codec));
+      for (int i = next_buffer++; i < num_buffers; i = next_buffer++) {
+        RETURN_NOT_OK(DecompressBuffer(codec.get(), compressed_buffers_[i]));
+      }
+      return Status::OK();
+    };
+    RETURN_NOT_OK(ParallelFor(num_threads, std::min(num_threads, num_buffers),
+                              decompress));
+    compressed_buffers_.clear();
+    return Status::OK();
   }
 
   Status GetFieldMetadata(int field_index, ArrayData* out) {
@@ -95,6 +202,11 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  int64_t body_offset_;
+  Compression::type compression_;
+  // The slots of the arrays being loaded that hold compressed buffers
+  std::vector<std::shared_ptr<Buffer>*> compressed_buffers_;
+  std::vector<std::future<Status>> pending_reads_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -107,6 +219,8 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // If false, the loaded fields only advance the field and buffer indices
+  bool read_buffers;
 };
 
 static Status LoadArray(const std::shared_ptr<DataType>& type,
@@ -130,6 +244,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (!context_->read_buffers) {
+      *out = nullptr;
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -208,8 +326,10 @@ class ArrayLoader {
   }
 
   template <typename T>
-  typename std::enable_if<std::is_base_of<BinaryType, T>::value, Status>::type Visit(
-      const T& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, T>::value ||
+                              std::is_base_of<LargeBinaryType, T>::value,
+                          Status>::type
+  Visit(const T& type) {
     return LoadBinary<T>();
   }
 
@@ -219,7 +339,16 @@ class ArrayLoader {
     return GetBuffer(context_->buffer_index++, &out_->buffers[1]);
   }
 
-  Status Visit(const ListType& type) {
+  Status Visit(const ListType& type) { return LoadList(type); }
+
+  Status Visit(const LargeListType& type) { return LoadList(type); }
+
+  // The number of data buffers of string views is not part of the metadata
+  Status Visit(const StringViewType& type) {
+    return Status::NotImplemented(type.ToString());
+  }
+
+  Status LoadList(const NestedType& type) {
     out_->buffers.resize(2);
 
     RETURN_NOT_OK(LoadCommon());
@@ -235,6 +364,14 @@ class ArrayLoader {
     return LoadChildren(type.children());
   }
 
+  Status Visit(const RunLengthEncodedType& type) {
+    out_->buffers.resize(2);
+
+    RETURN_NOT_OK(LoadCommon());
+    RETURN_NOT_OK(GetBuffer(context_->buffer_index++, &out_->buffers[1]));
+    return LoadChildren(type.children());
+  }
+
   Status Visit(const StructType& type) {
     out_->buffers.resize(1);
     RETURN_NOT_OK(LoadCommon());
@@ -290,56 +427,117 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // ----------------------------------------------------------------------
 // Array loading
 
+// Load the fields of schema listed in included_fields, or all of them if it is
+// null. The other fields are walked without reading their buffers
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
+                                        const std::vector<int>* included_fields,
                                         int64_t num_rows, int max_recursion_depth,
                                         IpcComponentSource* source,
                                         std::shared_ptr<RecordBatch>* out) {
+  const int num_fields = schema->num_fields();
+  std::vector<bool> included(num_fields, included_fields == nullptr);
+  int num_loaded_fields = num_fields;
+  if (included_fields != nullptr) {
+    num_loaded_fields = 0;
+    for (int i : *included_fields) {
+      if (i < 0 || i >= num_fields) {
+        std::stringstream ss;
+        ss << "Field index " << i << " out of range for schema with " << num_fields
+           << " fields";
+        return Status::Invalid(ss.str());
+      }
+      included[i] = true;
+      num_loaded_fields = std::max(num_loaded_fields, i + 1);
+    }
+  }
+
   ArrayLoaderContext context;
   context.source = source;
   context.field_index = 0;
   context.buffer_index = 0;
   context.max_recursion_depth = max_recursion_depth;
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
-  for (int i = 0; i < schema->num_fields(); ++i) {
-    auto arr = std::make_shared<ArrayData>();
-    RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
-    DCHECK_EQ(num_rows, arr->length) << "Array length did not match record batch length";
-    arrays[i] = std::move(arr);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  {
+    ARROW_TRACE_SPAN("ipc", "ArrayLoader");
+    // Nothing is left to read past the last included field
+    for (int i = 0; i < num_loaded_fields; ++i) {
+      auto arr = std::make_shared<ArrayData>();
+      context.read_buffers = included[i];
+      RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
+      DCHECK_EQ(num_rows, arr->length)
+          << "Array length did not match record batch length";
+      if (included[i]) {
+        fields.push_back(schema->field(i));
+        arrays.push_back(std::move(arr));
+      }
+    }
+  }
+  {
+    ARROW_TRACE_SPAN("ipc", "WaitForBuffers");
+    RETURN_NOT_OK(source->WaitForBuffers());
   }
+  RETURN_NOT_OK(source->DecompressBuffers(GetCpuThreadPoolCapacity()));
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  *out = RecordBatch::Make(included_fields == nullptr
+                               ? schema
+                               : std::make_shared<Schema>(fields, schema->metadata()),
+                           num_rows, std::move(arrays));
   return Status::OK();
 }
 
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
+                                     const std::vector<int>* included_fields,
                                      int max_recursion_depth, io::RandomAccessFile* file,
+                                     int64_t body_offset,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(), max_recursion_depth,
-                                   &source, out);
+  ARROW_TRACE_SPAN("ipc", "ReadRecordBatch");
+  IpcComponentSource source(metadata, file, body_offset);
+  RETURN_NOT_OK(source.Init());
+  return LoadRecordBatchFromSource(schema, included_fields, metadata->length(),
+                                   max_recursion_depth, &source, out);
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       int max_recursion_depth, io::RandomAccessFile* file,
-                       std::shared_ptr<RecordBatch>* out) {
+static Status ReadRecordBatch(const Buffer& metadata,
+                              const std::shared_ptr<Schema>& schema,
+                              const std::vector<int>* included_fields,
+                              int max_recursion_depth, io::RandomAccessFile* file,
+                              int64_t body_offset, std::shared_ptr<RecordBatch>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   if (message->header_type() != flatbuf::MessageHeader_RecordBatch) {
     DCHECK_EQ(message->header_type(), flatbuf::MessageHeader_RecordBatch);
   }
   auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
-  return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
+  return ReadRecordBatch(batch, schema, included_fields, max_recursion_depth, file,
+                         body_offset, out);
 }
 
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, nullptr, max_recursion_depth, file, 0, out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const std::vector<int>& included_fields,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, &included_fields, kMaxNestingDepth, file, 0,
+                         out);
+}
+
+// is_delta tells whether the dictionary holds values to append to the
+// dictionary with the same id rather than a whole dictionary
 Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionary_types,
                       io::RandomAccessFile* file, int64_t* dictionary_id,
-                      std::shared_ptr<Array>* out) {
+                      std::shared_ptr<Array>* out, bool* is_delta) {
   auto message = flatbuf::GetMessage(metadata.data());
   auto dictionary_batch =
       reinterpret_cast<const flatbuf::DictionaryBatch*>(message->header());
 
   int64_t id = *dictionary_id = dictionary_batch->id();
+  *is_delta = dictionary_batch->isDelta();
   auto it = dictionary_types.find(id);
   if (it == dictionary_types.end()) {
     std::stringstream ss;
@@ -356,8 +554,8 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta =
       reinterpret_cast<const flatbuf::RecordBatch*>(dictionary_batch->data());
-  RETURN_NOT_OK(
-      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, &batch));
+  RETURN_NOT_OK(ReadRecordBatch(batch_meta, dummy_schema, nullptr, kMaxNestingDepth, file,
+                                0, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -368,6 +566,7 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
 
 static Status ReadMessageAndValidate(MessageReader* reader, Message::Type expected_type,
                                      bool allow_null, std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN("ipc", "ReadMessage");
   RETURN_NOT_OK(reader->ReadNextMessage(message));
 
   if (!(*message) && !allow_null) {
@@ -399,7 +598,8 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
 
 class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  public:
-  RecordBatchStreamReaderImpl() {}
+  RecordBatchStreamReaderImpl()
+      : split_coalesced_(false), next_slice_(0), slice_offset_(0) {}
   ~RecordBatchStreamReaderImpl() {}
 
   Status Open(std::unique_ptr<MessageReader> message_reader) {
@@ -416,13 +616,38 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     std::shared_ptr<Array> dictionary;
     int64_t id;
+    bool is_delta;
     RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, &reader, &id,
-                                 &dictionary));
+                                 &dictionary, &is_delta));
+    if (is_delta) {
+      return Status::Invalid("Delta dictionary batch before the initial dictionaries");
+    }
     return dictionary_memo_.AddDictionary(id, dictionary);
   }
 
+  // Apply a dictionary batch found between record batches, which extends or
+  // replaces a dictionary. The schema is rebuilt with the new dictionary
+  Status UpdateDictionary(const Message& message) {
+    io::BufferReader reader(message.body());
+
+    std::shared_ptr<Array> dictionary;
+    int64_t id;
+    bool is_delta;
+    RETURN_NOT_OK(ReadDictionary(*message.metadata(), dictionary_types_, &reader, &id,
+                                 &dictionary, &is_delta));
+    if (is_delta) {
+      std::shared_ptr<Array> previous;
+      RETURN_NOT_OK(dictionary_memo_.GetDictionary(id, &previous));
+      RETURN_NOT_OK(
+          Concatenate({previous, dictionary}, default_memory_pool(), &dictionary));
+    }
+    RETURN_NOT_OK(dictionary_memo_.UpdateDictionary(id, dictionary));
+    return internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_);
+  }
+
   Status ReadSchema() {
-    std::unique_ptr<Message> message;
+    ARROW_TRACE_SPAN("ipc", "ReadSchema");
+    std::unique_ptr<Message>& message = schema_message_;
     RETURN_NOT_OK(
         ReadMessageAndValidate(message_reader_.get(), Message::SCHEMA, false, &message));
 
@@ -438,30 +663,76 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     return internal::GetSchema(message->header(), dictionary_memo_, &schema_);
   }
 
-  Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+  Status ReadNext(const std::vector<int>* included_fields,
+                  std::shared_ptr<RecordBatch>* batch) {
+    if (next_slice_ < slice_lengths_.size()) {
+      return NextSlice(batch);
+    }
+    coalesced_.reset();
+
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::RECORD_BATCH,
-                                         true, &message));
+    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    while (message != nullptr && message->type() == Message::DICTIONARY_BATCH) {
+      RETURN_NOT_OK(UpdateDictionary(*message));
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    }
 
     if (message == nullptr) {
       // End of stream
       *batch = nullptr;
       return Status::OK();
     }
+    if (message->type() != Message::RECORD_BATCH) {
+      std::stringstream ss;
+      ss << "Message not expected type: " << FormatMessageType(Message::RECORD_BATCH)
+         << ", was: " << message->type();
+      return Status::IOError(ss.str());
+    }
 
     io::BufferReader reader(message->body());
-    return ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    RETURN_NOT_OK(ReadRecordBatch(*message->metadata(), schema_, included_fields,
+                                  kMaxNestingDepth, &reader, 0, batch));
+    if (!split_coalesced_) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(internal::GetBatchLengths(message->header(), &slice_lengths_));
+    if (slice_lengths_.empty()) {
+      return Status::OK();
+    }
+    coalesced_ = *batch;
+    next_slice_ = 0;
+    slice_offset_ = 0;
+    return NextSlice(batch);
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
 
+  void set_split_coalesced(bool split) { split_coalesced_ = split; }
+
  private:
+  Status NextSlice(std::shared_ptr<RecordBatch>* batch) {
+    const int64_t length = slice_lengths_[next_slice_++];
+    *batch = coalesced_->Slice(slice_offset_, length);
+    slice_offset_ += length;
+    return Status::OK();
+  }
+
   std::unique_ptr<MessageReader> message_reader_;
 
+  // Kept to rebuild the schema when dictionaries change
+  std::unique_ptr<Message> schema_message_;
+
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
   DictionaryMemo dictionary_memo_;
   std::shared_ptr<Schema> schema_;
+
+  // The record batch being split into the ones coalesced by the writer
+  bool split_coalesced_;
+  std::shared_ptr<RecordBatch> coalesced_;
+  std::vector<int64_t> slice_lengths_;
+  size_t next_slice_;
+  int64_t slice_offset_;
 };
 
 RecordBatchStreamReader::RecordBatchStreamReader() {
@@ -494,17 +765,87 @@ std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
 }
 
 Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
-  return impl_->ReadNext(batch);
+  return impl_->ReadNext(nullptr, batch);
+}
+
+Status RecordBatchStreamReader::ReadNext(const std::vector<int>& included_fields,
+                                         std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadNext(&included_fields, batch);
+}
+
+void RecordBatchStreamReader::set_split_coalesced(bool split) {
+  impl_->set_split_coalesced(split);
 }
 
 // ----------------------------------------------------------------------
 // Reader implementation
 
+// Hint that the message in block is read next
+static Status WillNeed(const FileBlock& block, io::RandomAccessFile* file) {
+  if (block.offset < 0 || block.metadata_length < 0 || block.body_length < 0) {
+    // Reported if the message is read
+    return Status::OK();
+  }
+  return file->WillNeed({{block.offset, block.metadata_length + block.body_length}});
+}
+
+// Read the metadata and the body of a file block with a single read, rather
+// than reading the body after the metadata. Without read_body, the message
+// has no body
+static Status ReadMessageBlock(const FileBlock& block, bool read_body,
+                               io::RandomAccessFile* file,
+                               std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN("ipc", "ReadMessage");
+  DCHECK(BitUtil::IsMultipleOf8(block.offset));
+  DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
+  DCHECK(BitUtil::IsMultipleOf8(block.body_length));
+  DCHECK_GT(static_cast<size_t>(block.metadata_length), sizeof(int32_t));
+
+  const int64_t block_length =
+      block.metadata_length + (read_body ? block.body_length : 0);
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(file->ReadAt(block.offset, block_length, &buffer));
+  if (buffer->size() < block_length) {
+    std::stringstream ss;
+    ss << "Expected to read " << block_length << " bytes for message at offset "
+       << block.offset << " but got " << buffer->size();
+    return Status::Invalid(ss.str());
+  }
+
+  int32_t flatbuffer_size = *reinterpret_cast<const int32_t*>(buffer->data());
+  if (flatbuffer_size + static_cast<int>(sizeof(int32_t)) > block.metadata_length) {
+    std::stringstream ss;
+    ss << "flatbuffer size " << flatbuffer_size << " invalid. File offset: "
+       << block.offset << ", metadata length: " << block.metadata_length;
+    return Status::Invalid(ss.str());
+  }
+
+  auto metadata = SliceBuffer(buffer, 4, block.metadata_length - 4);
+  std::shared_ptr<Buffer> body;
+  if (read_body) {
+    body = SliceBuffer(buffer, block.metadata_length, block.body_length);
+  }
+  RETURN_NOT_OK(Message::Open(metadata, body, message));
+  if (flatbuf::GetMessage(metadata->data())->bodyLength() != block.body_length) {
+    return Status::Invalid("Message body length does not match its file block");
+  }
+  return Status::OK();
+}
+
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() { dictionary_memo_ = std::make_shared<DictionaryMemo>(); }
+  RecordBatchFileReaderImpl() : prefetch_(false), prefetched_index_(-1) {
+    dictionary_memo_ = std::make_shared<DictionaryMemo>();
+  }
+
+  ~RecordBatchFileReaderImpl() {
+    if (prefetched_.valid()) {
+      prefetched_.wait();
+    }
+  }
 
   Status ReadFooter() {
+    ARROW_TRACE_SPAN("ipc", "ReadFooter");
     int magic_size = static_cast<int>(strlen(kArrowMagicBytes));
 
     if (footer_offset_ <= magic_size * 2 + 4) {
@@ -560,42 +901,69 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+  // Read the fields of record batch i listed in included_fields, or all of
+  // them if it is null
+  Status ReadRecordBatch(int i, const std::vector<int>* included_fields,
+                         std::shared_ptr<RecordBatch>* batch) {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
-    FileBlock block = record_batch(i);
-
-    DCHECK(BitUtil::IsMultipleOf8(block.offset));
-    DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
-    DCHECK(BitUtil::IsMultipleOf8(block.body_length));
+    // A projected read only fetches the buffers of the included fields from
+    // the file, unless the whole block was prefetched
+    const bool read_body = included_fields == nullptr;
 
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, &message));
+    if (prefetched_.valid()) {
+      // A failed prefetch is retried below, so that its error is reported
+      // only if the batch is actually read
+      Status prefetch_status = prefetched_.get();
+      if (prefetched_index_ == i && prefetch_status.ok()) {
+        message = std::move(prefetched_message_);
+      }
+      prefetched_message_.reset();
+    }
+    const FileBlock block = record_batch(i);
+    if (message == nullptr) {
+      RETURN_NOT_OK(ReadMessageBlock(block, read_body, file_, &message));
+    }
+    if (read_body && i + 1 < num_record_batches()) {
+      if (prefetch_) {
+        RETURN_NOT_OK(Prefetch(i + 1));
+      } else {
+        // Zero-copy files are not read ahead, but the OS can bring the next
+        // block into memory while this one is used
+        RETURN_NOT_OK(WillNeed(record_batch(i + 1), file_));
+      }
+    }
 
+    if (message->body() == nullptr) {
+      return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, included_fields,
+                                           kMaxNestingDepth, file_,
+                                           block.offset + block.metadata_length, batch);
+    }
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, included_fields,
+                                         kMaxNestingDepth, &reader, 0, batch);
   }
 
   Status ReadSchema() {
+    ARROW_TRACE_SPAN("ipc", "ReadSchema");
     RETURN_NOT_OK(internal::GetDictionaryTypes(footer_->schema(), &dictionary_fields_));
 
     // Read all the dictionaries
     for (int i = 0; i < num_dictionaries(); ++i) {
-      FileBlock block = dictionary(i);
-
-      DCHECK(BitUtil::IsMultipleOf8(block.offset));
-      DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
-      DCHECK(BitUtil::IsMultipleOf8(block.body_length));
-
       std::unique_ptr<Message> message;
-      RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, &message));
+      RETURN_NOT_OK(ReadMessageBlock(dictionary(i), true, file_, &message));
 
       io::BufferReader reader(message->body());
 
       std::shared_ptr<Array> dictionary;
       int64_t dictionary_id;
+      bool is_delta;
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_fields_, &reader,
-                                   &dictionary_id, &dictionary));
+                                   &dictionary_id, &dictionary, &is_delta));
+      if (is_delta) {
+        return Status::Invalid("Delta dictionary batches are not supported in files");
+      }
       RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
     }
 
@@ -603,24 +971,150 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return internal::GetSchema(footer_->schema(), *dictionary_memo_, &schema_);
   }
 
+  // Read the statistics of the record batches, if the writer recorded them
+  // in the footer
+  Status ReadStatistics() {
+    auto custom_metadata = footer_->custom_metadata();
+    if (custom_metadata == nullptr) {
+      return Status::OK();
+    }
+    for (const auto& pair : *custom_metadata) {
+      const std::string key = pair->key()->str();
+      if (key == internal::kBatchStatisticsKey) {
+        RETURN_NOT_OK(ReadFooterBatch(pair->value(), &statistics_));
+        if (statistics_ == nullptr || statistics_->num_rows() != num_record_batches()) {
+          return Status::Invalid("The file statistics do not match its record batches");
+        }
+      } else if (key == internal::kBloomFiltersKey) {
+        RETURN_NOT_OK(ReadBloomFilterLocations(pair->value()));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Read a record batch serialized as a stream in the footer
+  Status ReadFooterBatch(const flatbuffers::String* value,
+                         std::shared_ptr<RecordBatch>* out) {
+    // Copied out of the footer, where the stream is not aligned
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), value->size(), &buffer));
+    std::memcpy(buffer->mutable_data(), value->data(), value->size());
+
+    io::BufferReader buffer_reader(buffer);
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(&buffer_reader, &reader));
+    return reader->ReadNext(out);
+  }
+
+  Status ReadBloomFilterLocations(const flatbuffers::String* value) {
+    std::shared_ptr<RecordBatch> locations;
+    RETURN_NOT_OK(ReadFooterBatch(value, &locations));
+    auto schema = ::arrow::schema({field("batch", int32()), field("field", int32()),
+                                   field("offset", int64()), field("length", int64())});
+    if (locations == nullptr || !locations->schema()->Equals(*schema) ||
+        locations->column(0)->null_count() != 0 ||
+        locations->column(1)->null_count() != 0 ||
+        locations->column(2)->null_count() != 0 ||
+        locations->column(3)->null_count() != 0) {
+      return Status::Invalid("Malformed Bloom filter locations in the file footer");
+    }
+    const auto& batches = static_cast<const Int32Array&>(*locations->column(0));
+    const auto& fields = static_cast<const Int32Array&>(*locations->column(1));
+    const auto& offsets = static_cast<const Int64Array&>(*locations->column(2));
+    const auto& lengths = static_cast<const Int64Array&>(*locations->column(3));
+    for (int64_t k = 0; k < locations->num_rows(); ++k) {
+      if (batches.Value(k) < 0 || batches.Value(k) >= num_record_batches() ||
+          fields.Value(k) < 0 || fields.Value(k) >= schema_->num_fields() ||
+          offsets.Value(k) < 0 || lengths.Value(k) <= 0 ||
+          offsets.Value(k) + lengths.Value(k) > footer_offset_) {
+        return Status::Invalid("Malformed Bloom filter locations in the file footer");
+      }
+      bloom_filters_[std::make_pair(batches.Value(k), fields.Value(k))] =
+          std::make_pair(offsets.Value(k), lengths.Value(k));
+    }
+    return Status::OK();
+  }
+
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
     owned_file_ = file;
     return Open(file.get(), footer_offset);
   }
 
   Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
-    file_ = file;
+    // The reads are counted through a wrapper, which does not own the file
+    std::shared_ptr<io::RandomAccessFile> unowned(file, [](io::RandomAccessFile*) {});
+    RETURN_NOT_OK(
+        io::InstrumentedRandomAccessFile::Create(unowned, nullptr, &instrumented_file_));
+    file_ = instrumented_file_.get();
     footer_offset_ = footer_offset;
+    // Reads from zero-copy sources are free, others may be remote round trips
+    prefetch_ = !file->supports_zero_copy();
     RETURN_NOT_OK(ReadFooter());
-    return ReadSchema();
+    RETURN_NOT_OK(ReadSchema());
+    return ReadStatistics();
   }
 
+  void SetPrefetch(bool prefetch) { prefetch_ = prefetch; }
+
+  io::IoStatistics io_statistics() const { return instrumented_file_->statistics(); }
+
   std::shared_ptr<Schema> schema() const { return schema_; }
 
+  std::shared_ptr<RecordBatch> statistics() const { return statistics_; }
+
+  Status ReadBloomFilter(int i, int field_index,
+                         std::shared_ptr<BlockedBloomFilter>* out) {
+    if (i < 0 || i >= num_record_batches() || field_index < 0 ||
+        field_index >= schema_->num_fields()) {
+      return Status::Invalid("Bloom filter index out of range");
+    }
+    out->reset();
+    auto it = bloom_filters_.find(std::make_pair(i, field_index));
+    if (it == bloom_filters_.end()) {
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(file_->ReadAt(it->second.first, it->second.second, &data));
+    if (data->size() != it->second.second) {
+      return Status::IOError("Unexpected end of file reading a Bloom filter");
+    }
+    return BlockedBloomFilter::Open(data, out);
+  }
+
+  Status MayContain(int i, int field_index, const Array& values, bool* out) {
+    std::shared_ptr<BlockedBloomFilter> filter;
+    RETURN_NOT_OK(ReadBloomFilter(i, field_index, &filter));
+    if (filter == nullptr) {
+      *out = true;
+      return Status::OK();
+    }
+    const int64_t num_bytes = BitUtil::BytesForBits(values.length());
+    std::vector<uint8_t> found(static_cast<size_t>(num_bytes));
+    RETURN_NOT_OK(filter->Find(*values.data(), found.data()));
+    *out = std::any_of(found.begin(), found.end(),
+                       [](uint8_t bits) { return bits != 0; });
+    return Status::OK();
+  }
+
  private:
+  // Start reading the block of record batch i in the background. The reads
+  // are I/O-bound, so they go to a thread of their own rather than to the
+  // CPU thread pool
+  Status Prefetch(int i) {
+    if (io_pool_ == nullptr) {
+      RETURN_NOT_OK(::arrow::internal::ThreadPool::Make(1, &io_pool_));
+    }
+    const FileBlock block = record_batch(i);
+    prefetched_index_ = i;
+    return io_pool_->Submit(&prefetched_, [this, block]() {
+      return ReadMessageBlock(block, true, file_, &prefetched_message_);
+    });
+  }
+
   io::RandomAccessFile* file_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
+  std::shared_ptr<io::InstrumentedRandomAccessFile> instrumented_file_;
 
   // The location where the Arrow file layout ends. May be the end of the file
   // or some other location if embedded in a larger file.
@@ -635,6 +1129,19 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+
+  // Per record batch statistics from the footer, or null
+  std::shared_ptr<RecordBatch> statistics_;
+
+  // The offsets and lengths of the Bloom filters by record batch and field
+  std::map<std::pair<int, int>, std::pair<int64_t, int64_t>> bloom_filters_;
+
+  // Whether to read the next record batch ahead of ReadRecordBatch
+  bool prefetch_;
+  std::shared_ptr<::arrow::internal::ThreadPool> io_pool_;
+  int prefetched_index_;
+  std::future<Status> prefetched_;
+  std::unique_ptr<Message> prefetched_message_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -672,17 +1179,219 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
 
+std::shared_ptr<RecordBatch> RecordBatchFileReader::statistics() const {
+  return impl_->statistics();
+}
+
+Status RecordBatchFileReader::ReadBloomFilter(int i, int field_index,
+                                              std::shared_ptr<BlockedBloomFilter>* out) {
+  return impl_->ReadBloomFilter(i, field_index, out);
+}
+
+Status RecordBatchFileReader::MayContain(int i, int field_index, const Array& values,
+                                         bool* out) {
+  return impl_->MayContain(i, field_index, values, out);
+}
+
 int RecordBatchFileReader::num_record_batches() const {
   return impl_->num_record_batches();
 }
 
 MetadataVersion RecordBatchFileReader::version() const { return impl_->version(); }
 
+void RecordBatchFileReader::SetPrefetch(bool prefetch) { impl_->SetPrefetch(prefetch); }
+
+io::IoStatistics RecordBatchFileReader::io_statistics() const {
+  return impl_->io_statistics();
+}
+
 Status RecordBatchFileReader::ReadRecordBatch(int i,
                                               std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, nullptr, batch);
+}
+
+Status RecordBatchFileReader::ReadRecordBatch(int i,
+                                              const std::vector<int>& included_fields,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, &included_fields, batch);
+}
+
+// ----------------------------------------------------------------------
+// Indexed stream reader implementation
+
+template <typename ArrowType>
+static void AppendSearchKeys(const Array& array, std::vector<int64_t>* out) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  const auto& values = static_cast<const ArrayType&>(array);
+  // A running maximum, which null values leave unchanged
+  int64_t key = std::numeric_limits<int64_t>::min();
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i)) {
+      key = std::max(key, static_cast<int64_t>(values.Value(i)));
+    }
+    out->push_back(key);
+  }
+}
+
+#define SEARCH_KEYS_CASE(TYPE_ID, ArrowType) \
+  case Type::TYPE_ID:                        \
+    AppendSearchKeys<ArrowType>(array, out); \
+    return Status::OK();
+
+static Status GetSearchKeys(const Array& array, std::vector<int64_t>* out) {
+  switch (array.type_id()) {
+    SEARCH_KEYS_CASE(UINT8, UInt8Type);
+    SEARCH_KEYS_CASE(INT8, Int8Type);
+    SEARCH_KEYS_CASE(UINT16, UInt16Type);
+    SEARCH_KEYS_CASE(INT16, Int16Type);
+    SEARCH_KEYS_CASE(UINT32, UInt32Type);
+    SEARCH_KEYS_CASE(INT32, Int32Type);
+    SEARCH_KEYS_CASE(INT64, Int64Type);
+    SEARCH_KEYS_CASE(DATE32, Date32Type);
+    SEARCH_KEYS_CASE(DATE64, Date64Type);
+    SEARCH_KEYS_CASE(TIME32, Time32Type);
+    SEARCH_KEYS_CASE(TIME64, Time64Type);
+    SEARCH_KEYS_CASE(TIMESTAMP, TimestampType);
+    default:
+      break;
+  }
+  return Status::NotImplemented("Cannot search the record batches by type " +
+                                array.type()->ToString());
+}
+
+#undef SEARCH_KEYS_CASE
+
+class RecordBatchIndexedStreamReader::RecordBatchIndexedStreamReaderImpl {
+ public:
+  Status Open(io::RandomAccessFile* stream, const std::shared_ptr<RecordBatch>& index) {
+    stream_ = stream;
+    index_ = index;
+    RETURN_NOT_OK(GetLocationColumn("offset", Type::INT64, &offsets_));
+    RETURN_NOT_OK(GetLocationColumn("metadata_length", Type::INT32, &metadata_lengths_));
+    RETURN_NOT_OK(GetLocationColumn("body_length", Type::INT64, &body_lengths_));
+    RETURN_NOT_OK(GetLocationColumn("num_rows", Type::INT64, &num_rows_));
+
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(stream, &reader));
+    schema_ = reader->schema();
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  int num_record_batches() const { return static_cast<int>(index_->num_rows()); }
+
+  int64_t num_rows(int i) const { return num_rows_->Value(i); }
+
+  Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+    if (i < 0 || i >= num_record_batches()) {
+      return Status::Invalid("Record batch index out of range");
+    }
+    const FileBlock block = {offsets_->Value(i), metadata_lengths_->Value(i),
+                             body_lengths_->Value(i)};
+    // The index comes from outside the stream, unlike file footers
+    if (!BitUtil::IsMultipleOf8(block.offset) ||
+        !BitUtil::IsMultipleOf8(block.metadata_length) ||
+        !BitUtil::IsMultipleOf8(block.body_length) ||
+        block.metadata_length <= static_cast<int32_t>(sizeof(int32_t))) {
+      return Status::Invalid("Invalid record batch location in stream index");
+    }
+
+    std::unique_ptr<Message> message;
+    RETURN_NOT_OK(ReadMessageBlock(block, true, stream_, &message));
+    if (i + 1 < num_record_batches()) {
+      const FileBlock next = {offsets_->Value(i + 1), metadata_lengths_->Value(i + 1),
+                              body_lengths_->Value(i + 1)};
+      RETURN_NOT_OK(WillNeed(next, stream_));
+    }
+    if (message->type() != Message::RECORD_BATCH) {
+      return Status::Invalid("Stream index does not point to a record batch");
+    }
+    io::BufferReader reader(message->body());
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, nullptr,
+                                         kMaxNestingDepth, &reader, 0, batch);
+  }
+
+  Status FindRecordBatch(const std::string& field_name, int64_t value, int* out) {
+    auto it = search_keys_.find(field_name);
+    if (it == search_keys_.end()) {
+      const int64_t i = index_->schema()->GetFieldIndex(field_name + "_max");
+      if (i == -1) {
+        return Status::KeyError("Stream index has no statistics for field " +
+                                field_name);
+      }
+      std::vector<int64_t> keys;
+      RETURN_NOT_OK(GetSearchKeys(*index_->column(static_cast<int>(i)), &keys));
+      it = search_keys_.emplace(field_name, std::move(keys)).first;
+    }
+    const std::vector<int64_t>& keys = it->second;
+    *out = static_cast<int>(std::lower_bound(keys.begin(), keys.end(), value) -
+                            keys.begin());
+    return Status::OK();
+  }
+
+ private:
+  template <typename ArrayType>
+  Status GetLocationColumn(const std::string& name, Type::type type_id,
+                           std::shared_ptr<ArrayType>* out) {
+    const int64_t i = index_->schema()->GetFieldIndex(name);
+    if (i == -1 || index_->column(static_cast<int>(i))->type_id() != type_id ||
+        index_->column(static_cast<int>(i))->null_count() != 0) {
+      return Status::Invalid("Stream index has no valid " + name + " column");
+    }
+    *out = std::static_pointer_cast<ArrayType>(index_->column(static_cast<int>(i)));
+    return Status::OK();
+  }
+
+  io::RandomAccessFile* stream_;
+  std::shared_ptr<RecordBatch> index_;
+  std::shared_ptr<Schema> schema_;
+
+  std::shared_ptr<Int64Array> offsets_;
+  std::shared_ptr<Int32Array> metadata_lengths_;
+  std::shared_ptr<Int64Array> body_lengths_;
+  std::shared_ptr<Int64Array> num_rows_;
+
+  // The running maxima of the fields searched, by field name
+  std::map<std::string, std::vector<int64_t>> search_keys_;
+};
+
+RecordBatchIndexedStreamReader::RecordBatchIndexedStreamReader() {
+  impl_.reset(new RecordBatchIndexedStreamReaderImpl());
+}
+
+RecordBatchIndexedStreamReader::~RecordBatchIndexedStreamReader() {}
+
+Status RecordBatchIndexedStreamReader::Open(
+    io::RandomAccessFile* stream, const std::shared_ptr<RecordBatch>& index,
+    std::shared_ptr<RecordBatchIndexedStreamReader>* reader) {
+  *reader = std::shared_ptr<RecordBatchIndexedStreamReader>(
+      new RecordBatchIndexedStreamReader());
+  return (*reader)->impl_->Open(stream, index);
+}
+
+std::shared_ptr<Schema> RecordBatchIndexedStreamReader::schema() const {
+  return impl_->schema();
+}
+
+int RecordBatchIndexedStreamReader::num_record_batches() const {
+  return impl_->num_record_batches();
+}
+
+int64_t RecordBatchIndexedStreamReader::num_rows(int i) const {
+  return impl_->num_rows(i);
+}
+
+Status RecordBatchIndexedStreamReader::ReadRecordBatch(
+    int i, std::shared_ptr<RecordBatch>* batch) {
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchIndexedStreamReader::FindRecordBatch(const std::string& field_name,
+                                                       int64_t value, int* out) {
+  return impl_->FindRecordBatch(field_name, value, out);
+}
+
 static Status ReadContiguousPayload(io::InputStream* file,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, message));
@@ -724,9 +1433,111 @@ Status ReadTensor(const Message& message, std::shared_ptr<Tensor>* out) {
   std::vector<int64_t> shape;
   std::vector<int64_t> strides;
   std::vector<std::string> dim_names;
+  Compression::type compression;
   RETURN_NOT_OK(internal::GetTensorMetadata(*message.metadata(), &type, &shape, &strides,
-                                            &dim_names));
-  *out = std::make_shared<Tensor>(type, message.body(), shape, strides, dim_names);
+                                            &dim_names, &compression));
+  std::shared_ptr<Buffer> body = message.body();
+  if (compression != Compression::UNCOMPRESSED && body && body->size() > 0) {
+    std::unique_ptr<Codec> codec;
+    RETURN_NOT_OK(Codec::Create(compression, &codec));
+    RETURN_NOT_OK(DecompressBuffer(codec.get(), &body));
+  }
+  *out = std::make_shared<Tensor>(type, body, shape, strides, dim_names);
+  return Status::OK();
+}
+
+namespace {
+
+Status GetSparseTensorBuffer(const Message& message,
+                             const internal::BufferMetadata& meta, int64_t expected,
+                             std::shared_ptr<Buffer>* out) {
+  const std::shared_ptr<Buffer>& body = message.body();
+  const int64_t body_size = body ? body->size() : 0;
+  if (meta.offset < 0 || meta.length < expected || meta.offset > body_size ||
+      meta.length > body_size - meta.offset) {
+    return Status::Invalid("Sparse tensor buffer is out of the message body");
+  }
+  *out = expected > 0 ? SliceBuffer(body, meta.offset, expected)
+                      : std::make_shared<Buffer>(nullptr, 0);
+  return Status::OK();
+}
+
+Status GetSparseIndexTensor(const Message& message, const internal::BufferMetadata& meta,
+                            const std::vector<int64_t>& shape,
+                            std::shared_ptr<Tensor>* out) {
+  int64_t size = 1;
+  for (int64_t dim : shape) {
+    size *= dim;
+  }
+  std::shared_ptr<Buffer> data;
+  const int64_t nbytes = size * static_cast<int64_t>(sizeof(int64_t));
+  RETURN_NOT_OK(GetSparseTensorBuffer(message, meta, nbytes, &data));
+  *out = std::make_shared<Tensor>(int64(), data, shape);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status ReadSparseTensor(int64_t offset, io::RandomAccessFile* file,
+                        std::shared_ptr<SparseTensor>* out) {
+  // Respect alignment of SparseTensor messages (see WriteSparseTensor)
+  offset = PaddedLength(offset);
+  RETURN_NOT_OK(file->Seek(offset));
+
+  std::unique_ptr<Message> message;
+  RETURN_NOT_OK(ReadContiguousPayload(file, &message));
+  return ReadSparseTensor(*message, out);
+}
+
+Status ReadSparseTensor(const Message& message, std::shared_ptr<SparseTensor>* out) {
+  std::shared_ptr<DataType> type;
+  std::vector<int64_t> shape;
+  std::vector<std::string> dim_names;
+  int64_t non_zero_length;
+  SparseTensorFormat::type format_id;
+  std::vector<internal::BufferMetadata> buffers;
+  RETURN_NOT_OK(internal::GetSparseTensorMetadata(*message.metadata(), &type, &shape,
+                                                  &dim_names, &non_zero_length,
+                                                  &format_id, &buffers));
+  if (!is_tensor_supported(type->id())) {
+    return Status::Invalid("Sparse tensor values must be of a fixed-width number type");
+  }
+  if (non_zero_length < 0 ||
+      std::any_of(shape.begin(), shape.end(), [](int64_t dim) { return dim < 0; })) {
+    return Status::Invalid("Negative sparse tensor length");
+  }
+
+  // The indices and values are slices of the body
+  const auto& fw_type = static_cast<const FixedWidthType&>(*type);
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(GetSparseTensorBuffer(message, buffers.back(),
+                                      non_zero_length * fw_type.bit_width() / 8, &data));
+
+  const int64_t ndim = static_cast<int64_t>(shape.size());
+  switch (format_id) {
+    case SparseTensorFormat::COO: {
+      std::shared_ptr<Tensor> coords;
+      RETURN_NOT_OK(
+          GetSparseIndexTensor(message, buffers[0], {non_zero_length, ndim}, &coords));
+      *out = std::make_shared<SparseTensorCOO>(std::make_shared<SparseCOOIndex>(coords),
+                                               type, data, shape, dim_names);
+      break;
+    }
+    case SparseTensorFormat::CSR: {
+      if (ndim != 2) {
+        return Status::Invalid("A CSR sparse tensor must be a matrix");
+      }
+      std::shared_ptr<Tensor> indptr;
+      std::shared_ptr<Tensor> indices;
+      RETURN_NOT_OK(GetSparseIndexTensor(message, buffers[0], {shape[0] + 1}, &indptr));
+      RETURN_NOT_OK(
+          GetSparseIndexTensor(message, buffers[1], {non_zero_length}, &indices));
+      *out = std::make_shared<SparseTensorCSR>(
+          std::make_shared<SparseCSRIndex>(indptr, indices), type, data, shape,
+          dim_names);
+      break;
+    }
+  }
   return Status::OK();
 }
 
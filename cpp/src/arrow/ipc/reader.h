@@ -22,6 +22,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/ipc/message.h"
 #include "arrow/record_batch.h"
@@ -29,8 +31,11 @@
 
 namespace arrow {
 
+class Array;
+class BlockedBloomFilter;
 class Buffer;
 class Schema;
+class SparseTensor;
 class Status;
 class Tensor;
 
@@ -38,6 +43,7 @@ namespace io {
 
 class InputStream;
 class RandomAccessFile;
+struct IoStatistics;
 
 }  // namespace io
 
@@ -83,6 +89,26 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
 
+  /// \brief Read the next record batch, keeping only some of its fields
+  ///
+  /// The buffers of the other fields are neither decompressed nor exposed
+  ///
+  /// \param[in] included_fields the indices of the fields to keep in the
+  /// schema; they appear in the batch in schema order
+  /// \param[out] batch the read batch, null at the end of the stream
+  /// \return Status
+  Status ReadNext(const std::vector<int>& included_fields,
+                  std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Return record batches coalesced by the writer as the original
+  /// record batches, see RecordBatchStreamWriter::SetCoalescing
+  ///
+  /// The batches are zero-copy slices of the coalesced one, and keep the
+  /// fields it was read with. By default coalesced batches are returned whole
+  ///
+  /// \param[in] split whether to split coalesced record batches
+  void set_split_coalesced(bool split);
+
  private:
   RecordBatchStreamReader();
 
@@ -142,17 +168,85 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \brief Returns the number of record batches in the file
   int num_record_batches() const;
 
+  /// \brief The statistics of the record batches, if the file has them
+  ///
+  /// A RecordBatchFileWriter with indexing enabled stores its index in the
+  /// footer: one row per record batch with its "num_rows", the
+  /// "<name>_null_count" of each field and the "<name>_min" and "<name>_max"
+  /// of the numeric and temporal fields (see
+  /// RecordBatchStreamWriter::SetIndexing). Predicates can be checked against
+  /// them to skip record batches without reading them
+  ///
+  /// \return the statistics, null if the writer did not record them
+  std::shared_ptr<RecordBatch> statistics() const;
+
+  /// \brief Read the Bloom filter of a field of a record batch, if the file
+  /// has one
+  ///
+  /// See RecordBatchFileWriter::SetBloomFilters. The filter is read from the
+  /// file on each call, without copying for zero-copy sources
+  ///
+  /// \param[in] i the index of the record batch
+  /// \param[in] field_index the index of the field in the schema
+  /// \param[out] out the filter, null if the field of the batch has none
+  /// \return Status, Invalid if the indices are out of range
+  Status ReadBloomFilter(int i, int field_index,
+                         std::shared_ptr<BlockedBloomFilter>* out);
+
+  /// \brief Test whether a record batch may hold any of some values of a
+  /// field, from its Bloom filter
+  ///
+  /// \param[in] i the index of the record batch
+  /// \param[in] field_index the index of the field in the schema
+  /// \param[in] values the values to look for, of the type of the field or
+  /// hashed alike, see BlockedBloomFilter::Insert
+  /// \param[out] out false if the batch holds none of the non-null values,
+  /// true if it may hold one or if the field of the batch has no filter
+  /// \return Status
+  Status MayContain(int i, int field_index, const Array& values, bool* out);
+
   /// \brief Return the metadata version from the file metadata
   MetadataVersion version() const;
 
+  /// \brief Read the next record batch in the background after each call to
+  /// ReadRecordBatch
+  ///
+  /// Enabled by default for sources that do not support zero-copy, where
+  /// each read may be a remote round trip
+  ///
+  /// \param[in] prefetch whether to read ahead
+  void SetPrefetch(bool prefetch);
+
+  /// \brief The statistics of the reads made from the file since it was
+  /// opened, including those of the footer and of prefetched batches
+  ///
+  /// Comparing them with the sizes of the batches read shows how much of the
+  /// file was read, and the latency histograms how long the reads took
+  io::IoStatistics io_statistics() const;
+
   /// \brief Read a particular record batch from the file. Does not copy memory
   /// if the input source supports zero-copy.
   ///
+  /// The metadata and the body of the record batch are fetched with a
+  /// single read
+  ///
   /// \param[in] i the index of the record batch to return
   /// \param[out] batch the read batch
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read some of the fields of a particular record batch
+  ///
+  /// Only the buffers of the included fields are read from the file
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] included_fields the indices of the fields to keep in the
+  /// schema; they appear in the batch in schema order
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, const std::vector<int>& included_fields,
+                         std::shared_ptr<RecordBatch>* batch);
+
  private:
   RecordBatchFileReader();
 
@@ -160,6 +254,67 @@ class ARROW_EXPORT RecordBatchFileReader {
   std::unique_ptr<RecordBatchFileReaderImpl> impl_;
 };
 
+/// \brief Random access to the record batches of a stream through its index
+///
+/// The index is taken from the writer with RecordBatchStreamWriter::GetIndex
+/// and kept next to the stream, for example as a record batch file. The
+/// record batches are then read without scanning the stream up to them
+class ARROW_EXPORT RecordBatchIndexedStreamReader {
+ public:
+  ~RecordBatchIndexedStreamReader();
+
+  /// \brief Open a stream with its index
+  ///
+  /// \param[in] stream the stream, positioned at its start as the schema and
+  /// the dictionaries are read from there. The offsets of the index are
+  /// positions in stream
+  /// \param[in] index the index of the record batches of the stream
+  /// \param[out] reader the returned reader
+  /// \return Status, Invalid if index does not have the layout described
+  /// for RecordBatchStreamWriter::SetIndexing
+  static Status Open(io::RandomAccessFile* stream,
+                     const std::shared_ptr<RecordBatch>& index,
+                     std::shared_ptr<RecordBatchIndexedStreamReader>* reader);
+
+  /// \brief The schema read from the stream
+  std::shared_ptr<Schema> schema() const;
+
+  /// \brief Returns the number of record batches in the index
+  int num_record_batches() const;
+
+  /// \brief Returns the number of rows of a record batch, from the index
+  int64_t num_rows(int i) const;
+
+  /// \brief Read a particular record batch from the stream. Does not copy
+  /// memory if the stream supports zero-copy.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Binary search for a value in a stream ordered by a field
+  ///
+  /// Finds the first record batch whose maximum of the field is at least
+  /// value, that is the first one which can hold value or greater values if
+  /// the stream is ordered by the field. Record batches without non-null
+  /// values of the field are never found
+  ///
+  /// \param[in] field_name the name of an integer (except uint64), date,
+  /// time or timestamp field, compared as its integer representation
+  /// \param[in] value the value to search for
+  /// \param[out] out the index of the record batch, num_record_batches() if
+  /// no record batch has a maximum of at least value
+  /// \return Status, KeyError if the index has no statistics for the field
+  Status FindRecordBatch(const std::string& field_name, int64_t value, int* out);
+
+ private:
+  RecordBatchIndexedStreamReader();
+
+  class ARROW_NO_EXPORT RecordBatchIndexedStreamReaderImpl;
+  std::unique_ptr<RecordBatchIndexedStreamReaderImpl> impl_;
+};
+
 // Generic read functions; does not copy data if the input supports zero copy reads
 
 /// \brief Read Schema from stream serialized as a sequence of one or more IPC
@@ -196,6 +351,21 @@ ARROW_EXPORT
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
                        io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out);
 
+/// \brief Read some of the fields of a record batch from file given metadata
+/// and schema
+///
+/// \param[in] metadata a Message containing the record batch metadata
+/// \param[in] schema the record batch schema
+/// \param[in] included_fields the indices of the fields of schema to read;
+/// they appear in the batch in schema order
+/// \param[in] file a random access file
+/// \param[out] out the read record batch
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const std::vector<int>& included_fields,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out);
+
 /// \brief Read record batch from encapulated Message
 ///
 /// \param[in] message a message instance containing metadata and body
@@ -237,6 +407,26 @@ Status ReadTensor(int64_t offset, io::RandomAccessFile* file,
 ARROW_EXPORT
 Status ReadTensor(const Message& message, std::shared_ptr<Tensor>* out);
 
+/// \brief EXPERIMENTAL: Read arrow::SparseTensor as encapsulated IPC message in file
+///
+/// \param[in] offset the file location of the start of the message
+/// \param[in] file the file where the sparse tensor is located
+/// \param[out] out the read sparse tensor
+/// \return Status
+ARROW_EXPORT
+Status ReadSparseTensor(int64_t offset, io::RandomAccessFile* file,
+                        std::shared_ptr<SparseTensor>* out);
+
+/// \brief EXPERIMENTAL: Read arrow::SparseTensor from IPC message
+///
+/// The sparse index and the values are slices of the message body
+///
+/// \param[in] message a Message containing the sparse tensor metadata and body
+/// \param[out] out the read sparse tensor
+/// \return Status
+ARROW_EXPORT
+Status ReadSparseTensor(const Message& message, std::shared_ptr<SparseTensor>* out);
+
 }  // namespace ipc
 }  // namespace arrow
 
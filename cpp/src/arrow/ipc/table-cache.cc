@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/table-cache.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+namespace ipc {
+
+namespace {
+
+// A file of the cache. Its mutex is held while the file is read, so that
+// concurrent requests for the same file read it once
+struct CachedFile {
+  std::mutex mutex;
+  std::shared_ptr<Table> table;
+  int64_t size = 0;
+};
+
+Status ReadTable(const std::string& path, std::shared_ptr<Table>* out,
+                 int64_t* size) {
+  std::shared_ptr<io::MemoryMappedFile> file;
+  RETURN_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &file));
+  RETURN_NOT_OK(file->GetSize(size));
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  RETURN_NOT_OK(RecordBatchFileReader::Open(file, &reader));
+  std::vector<std::shared_ptr<RecordBatch>> batches(reader->num_record_batches());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    RETURN_NOT_OK(reader->ReadRecordBatch(i, &batches[i]));
+  }
+  return Table::FromRecordBatches(reader->schema(), batches, out);
+}
+
+}  // namespace
+
+class TableCache::Impl {
+ public:
+  Impl() : num_tables_(0), mapped_bytes_(0) {}
+
+  Status GetTable(const std::string& path, std::shared_ptr<Table>* out) {
+    std::shared_ptr<CachedFile> cached;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& slot = files_[path];
+      if (slot == nullptr) {
+        slot = std::make_shared<CachedFile>();
+      }
+      cached = slot;
+    }
+
+    std::lock_guard<std::mutex> lock(cached->mutex);
+    if (cached->table == nullptr) {
+      Status s = ReadTable(path, &cached->table, &cached->size);
+      if (!s.ok()) {
+        // Not cached, so that the file is read again on the next request
+        std::lock_guard<std::mutex> files_lock(mutex_);
+        auto it = files_.find(path);
+        if (it != files_.end() && it->second == cached) {
+          files_.erase(it);
+        }
+        return s;
+      }
+      num_tables_ += 1;
+      mapped_bytes_ += cached->size;
+    }
+    *out = cached->table;
+    return Status::OK();
+  }
+
+  void Evict(const std::string& path) {
+    std::shared_ptr<CachedFile> cached;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = files_.find(path);
+      if (it == files_.end()) {
+        return;
+      }
+      cached = std::move(it->second);
+      files_.erase(it);
+    }
+
+    // Wait for a read of the file in progress, which counts the file
+    std::lock_guard<std::mutex> lock(cached->mutex);
+    if (cached->table != nullptr) {
+      num_tables_ -= 1;
+      mapped_bytes_ -= cached->size;
+    }
+  }
+
+  int64_t num_tables() const { return num_tables_.load(); }
+
+  int64_t mapped_bytes() const { return mapped_bytes_.load(); }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<CachedFile>> files_;
+  std::atomic<int64_t> num_tables_;
+  std::atomic<int64_t> mapped_bytes_;
+};
+
+TableCache::TableCache() : impl_(new Impl()) {}
+
+TableCache::~TableCache() {}
+
+TableCache* TableCache::Default() {
+  // Never destroyed, so that tables can be requested from static destructors
+  static TableCache* cache = new TableCache();
+  return cache;
+}
+
+Status TableCache::Load(const std::vector<std::string>& paths, int nthreads) {
+  return ParallelFor(nthreads, static_cast<int>(paths.size()), [&](int i) {
+    std::shared_ptr<Table> table;
+    return impl_->GetTable(paths[i], &table);
+  });
+}
+
+Status TableCache::GetTable(const std::string& path, std::shared_ptr<Table>* out) {
+  return impl_->GetTable(path, out);
+}
+
+Status TableCache::GetTable(const std::vector<std::string>& paths, int nthreads,
+                            std::shared_ptr<Table>* out) {
+  std::vector<std::shared_ptr<Table>> tables(paths.size());
+  RETURN_NOT_OK(ParallelFor(nthreads, static_cast<int>(paths.size()), [&](int i) {
+    return impl_->GetTable(paths[i], &tables[i]);
+  }));
+  if (tables.size() == 1) {
+    *out = tables[0];
+    return Status::OK();
+  }
+  return ConcatenateTables(tables, out);
+}
+
+void TableCache::Evict(const std::string& path) { impl_->Evict(path); }
+
+int64_t TableCache::num_tables() const { return impl_->num_tables(); }
+
+int64_t TableCache::mapped_bytes() const { return impl_->mapped_bytes(); }
+
+}  // namespace ipc
+}  // namespace arrow
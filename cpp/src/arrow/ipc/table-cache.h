@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Cache of the tables of memory-mapped Arrow files
+
+#ifndef ARROW_IPC_TABLE_CACHE_H
+#define ARROW_IPC_TABLE_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Table;
+
+namespace ipc {
+
+/// \class TableCache
+/// \brief The tables of Arrow files, memory-mapped and read once per process
+///
+/// The first request for the table of a file memory-maps the file and reads
+/// its footer, its schema and the metadata of its record batches. The table
+/// is then cached, and every later request returns it without touching the
+/// file. Its buffers point into the mapping, which stays alive as long as any
+/// of them does.
+///
+/// The files are mapped read-only, so the operating system keeps their pages
+/// in memory once, however many processes map them. Loading the files before
+/// forking worker processes also spares the workers reading the metadata:
+/// they inherit the cached tables.
+///
+/// Arrow files are written once, so a cached table is not checked against
+/// its file again; Evict drops it, e.g. after the file was replaced. All
+/// methods are thread-safe.
+class ARROW_EXPORT TableCache {
+ public:
+  TableCache();
+  ~TableCache();
+
+  /// \brief The cache shared by the whole process
+  static TableCache* Default();
+
+  /// \brief Load files into the cache, several at once
+  ///
+  /// \param[in] paths the paths of the files
+  /// \param[in] nthreads the number of files read at once
+  /// \return Status, the first error of a file that could not be read
+  Status Load(const std::vector<std::string>& paths, int nthreads);
+
+  /// \brief Return the table of a file, loading the file if it is not cached
+  ///
+  /// \param[in] path the path of the file
+  /// \param[out] out the table of all the record batches of the file
+  /// \return Status
+  Status GetTable(const std::string& path, std::shared_ptr<Table>* out);
+
+  /// \brief Return the concatenated tables of several files, loading the
+  /// files that are not cached several at once
+  ///
+  /// \param[in] paths the paths of the files, which must have the same schema
+  /// \param[in] nthreads the number of files read at once
+  /// \param[out] out a table with the record batches of all the files, in order
+  /// \return Status, Invalid if the schemas differ
+  Status GetTable(const std::vector<std::string>& paths, int nthreads,
+                  std::shared_ptr<Table>* out);
+
+  /// \brief Drop the table of a file from the cache
+  ///
+  /// Tables already returned are left valid.
+  void Evict(const std::string& path);
+
+  /// \brief The number of files cached
+  int64_t num_tables() const;
+
+  /// \brief The total size of the files cached
+  int64_t mapped_bytes() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_TABLE_CACHE_H
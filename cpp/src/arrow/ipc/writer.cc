@@ -18,14 +18,22 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/message.h"
@@ -33,12 +41,19 @@
 #include "arrow/ipc/util.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bloom-filter.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace ipc {
@@ -95,6 +110,95 @@ static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
   return offset != 0 || min_length < buffer->size();
 }
 
+// A record batch or dictionary serialized in memory, ready to be written out
+struct RecordBatchPayload {
+  std::shared_ptr<Buffer> metadata;
+  std::vector<std::shared_ptr<Buffer>> body_buffers;
+  int64_t body_length;
+};
+
+// Write the length-prefixed metadata and then the padded body buffers, as a
+// single gather write. This frames the metadata as internal::WriteMessage does
+static Status WritePayload(const RecordBatchPayload& payload, io::OutputStream* dst,
+                           int32_t* metadata_length) {
+  ARROW_TRACE_SPAN("ipc", "WritePayload");
+  int64_t start_offset;
+  RETURN_NOT_OK(dst->Tell(&start_offset));
+
+  const int64_t message_size = payload.metadata->size();
+  int32_t padded_message_length = static_cast<int32_t>(message_size) + 4;
+  const int32_t remainder =
+      (padded_message_length + static_cast<int32_t>(start_offset)) % 8;
+  if (remainder != 0) {
+    padded_message_length += 8 - remainder;
+  }
+
+  // The returned message size includes the length prefix, the flatbuffer,
+  // plus padding
+  *metadata_length = padded_message_length;
+  const int32_t flatbuffer_size = padded_message_length - 4;
+
+  std::vector<io::WriteSlice> slices;
+  slices.reserve(3 + 2 * payload.body_buffers.size());
+  slices.push_back({&flatbuffer_size, sizeof(int32_t)});
+  slices.push_back({payload.metadata->data(), message_size});
+  slices.push_back({kPaddingBytes, flatbuffer_size - message_size});
+
+  for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
+    const Buffer* buffer = payload.body_buffers[i].get();
+
+    // The buffer might be null if we are handling zero row lengths.
+    if (buffer) {
+      const int64_t size = buffer->size();
+      slices.push_back({buffer->data(), size});
+      slices.push_back({kPaddingBytes, BitUtil::RoundUpToMultipleOf8(size) - size});
+    }
+  }
+  RETURN_NOT_OK(dst->Writev(slices));
+
+#ifndef NDEBUG
+  int64_t current_position;
+  RETURN_NOT_OK(dst->Tell(&current_position));
+  DCHECK(BitUtil::IsMultipleOf8(current_position));
+#endif
+
+  return Status::OK();
+}
+
+// Prefix a buffer with its uncompressed length and compress it, or prefix it
+// with -1 when it is too small or the codec does not shrink it
+static Status CompressBuffer(Codec* codec, int64_t min_compressed_size,
+                             MemoryPool* pool, const Buffer& buffer,
+                             std::shared_ptr<Buffer>* out) {
+  ARROW_TRACE_SPAN("ipc", "CompressBuffer");
+  const int64_t size = buffer.size();
+  const int64_t prefix_size = static_cast<int64_t>(sizeof(int64_t));
+  std::shared_ptr<ResizableBuffer> result;
+  if (size >= min_compressed_size) {
+    const int64_t max_length = codec->MaxCompressedLen(size, buffer.data());
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, prefix_size + max_length, &result));
+    int64_t compressed_length = 0;
+    RETURN_NOT_OK(codec->Compress(size, buffer.data(), max_length,
+                                  result->mutable_data() + prefix_size,
+                                  &compressed_length));
+    if (compressed_length < size) {
+      const int64_t prefix = BitUtil::ToLittleEndian(size);
+      std::memcpy(result->mutable_data(), &prefix, sizeof(int64_t));
+      RETURN_NOT_OK(result->Resize(prefix_size + compressed_length, false));
+      *out = result;
+      return Status::OK();
+    }
+  }
+
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, prefix_size + size, &result));
+  const int64_t prefix = BitUtil::ToLittleEndian(static_cast<int64_t>(-1));
+  std::memcpy(result->mutable_data(), &prefix, sizeof(int64_t));
+  std::memcpy(result->mutable_data() + prefix_size, buffer.data(),
+              static_cast<size_t>(size));
+  *out = result;
+  return Status::OK();
+}
+
 class RecordBatchSerializer : public ArrayVisitor {
  public:
   RecordBatchSerializer(MemoryPool* pool, int64_t buffer_start_offset,
@@ -102,12 +206,32 @@ class RecordBatchSerializer : public ArrayVisitor {
       : pool_(pool),
         max_recursion_depth_(max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
-        allow_64bit_(allow_64bit) {
+        allow_64bit_(allow_64bit),
+        compression_(Compression::UNCOMPRESSED),
+        min_compressed_size_(0) {
     DCHECK_GT(max_recursion_depth, 0);
   }
 
   ~RecordBatchSerializer() override = default;
 
+  // Compress the buffers of at least min_buffer_size bytes with the codec
+  Status SetCompression(Compression::type compression, int64_t min_buffer_size) {
+    compression_ = compression;
+    min_compressed_size_ = min_buffer_size;
+    if (compression == Compression::UNCOMPRESSED) {
+      codec_.reset();
+      return Status::OK();
+    }
+    return Codec::Create(compression, &codec_);
+  }
+
+  // Record the lengths of the record batches coalesced into the serialized one
+  void SetBatchLengths(const std::vector<int64_t>& batch_lengths) {
+    batch_lengths_ = batch_lengths;
+  }
+
+  void set_allow_64bit(bool allow_64bit) { allow_64bit_ = allow_64bit; }
+
   Status VisitArray(const Array& arr) {
     if (max_recursion_depth_ <= 0) {
       return Status::Invalid("Max recursion depth reached");
@@ -144,6 +268,14 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    if (codec_) {
+      for (auto& buffer : buffers_) {
+        if (buffer && buffer->size() > 0) {
+          RETURN_NOT_OK(CompressBuffer(buffer, &buffer));
+        }
+      }
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -162,7 +294,8 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
-      buffer_meta_.push_back({offset, size + padding});
+      // The codecs need the exact length of compressed buffers
+      buffer_meta_.push_back({offset, codec_ ? size : size + padding});
       offset += size + padding;
     }
 
@@ -175,62 +308,35 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status WriteMetadataMessage(int64_t num_rows, int64_t body_length,
                                       std::shared_ptr<Buffer>* out) {
-    return WriteRecordBatchMessage(num_rows, body_length, field_nodes_, buffer_meta_,
-                                   out);
+    return metadata_writer_.WriteRecordBatch(
+        num_rows, body_length, field_nodes_, buffer_meta_,
+        codec_ ? compression_ : Compression::UNCOMPRESSED, batch_lengths_, out);
   }
 
-  Status Write(const RecordBatch& batch, io::OutputStream* dst, int32_t* metadata_length,
-               int64_t* body_length) {
-    RETURN_NOT_OK(Assemble(batch, body_length));
-
-#ifndef NDEBUG
-    int64_t start_position, current_position;
-    RETURN_NOT_OK(dst->Tell(&start_position));
-#endif
+  // Serialize the batch in memory, without writing it out
+  Status GetPayload(const RecordBatch& batch, RecordBatchPayload* out) {
+    ARROW_TRACE_SPAN("ipc", "GetRecordBatchPayload");
+    RETURN_NOT_OK(Assemble(batch, &out->body_length));
 
     // Now that we have computed the locations of all of the buffers in shared
-    // memory, the data header can be converted to a flatbuffer and written out
-    //
-    // Note: The memory written here is prefixed by the size of the flatbuffer
-    // itself as an int32_t.
-    std::shared_ptr<Buffer> metadata_fb;
-    RETURN_NOT_OK(WriteMetadataMessage(batch.num_rows(), *body_length, &metadata_fb));
-    RETURN_NOT_OK(internal::WriteMessage(*metadata_fb, dst, metadata_length));
-
-#ifndef NDEBUG
-    RETURN_NOT_OK(dst->Tell(&current_position));
-    DCHECK(BitUtil::IsMultipleOf8(current_position));
-#endif
-
-    // Now write the buffers
-    for (size_t i = 0; i < buffers_.size(); ++i) {
-      const Buffer* buffer = buffers_[i].get();
-      int64_t size = 0;
-      int64_t padding = 0;
-
-      // The buffer might be null if we are handling zero row lengths.
-      if (buffer) {
-        size = buffer->size();
-        padding = BitUtil::RoundUpToMultipleOf8(size) - size;
-      }
-
-      if (size > 0) {
-        RETURN_NOT_OK(dst->Write(buffer->data(), size));
-      }
-
-      if (padding > 0) {
-        RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
-      }
-    }
-
-#ifndef NDEBUG
-    RETURN_NOT_OK(dst->Tell(&current_position));
-    DCHECK(BitUtil::IsMultipleOf8(current_position));
-#endif
-
+    // memory, the data header can be converted to a flatbuffer
+    RETURN_NOT_OK(
+        WriteMetadataMessage(batch.num_rows(), out->body_length, &out->metadata));
+    out->body_buffers = std::move(buffers_);
+    buffers_.clear();
+    // The next batch of the stream likely has as many buffers
+    buffers_.reserve(out->body_buffers.size());
     return Status::OK();
   }
 
+  Status Write(const RecordBatch& batch, io::OutputStream* dst, int32_t* metadata_length,
+               int64_t* body_length) {
+    RecordBatchPayload payload;
+    RETURN_NOT_OK(GetPayload(batch, &payload));
+    *body_length = payload.body_length;
+    return WritePayload(payload, dst, metadata_length);
+  }
+
  protected:
   template <typename ArrayType>
   Status VisitFixedWidth(const ArrayType& array) {
@@ -257,7 +363,9 @@ class RecordBatchSerializer : public ArrayVisitor {
   template <typename ArrayType>
   Status GetZeroBasedValueOffsets(const ArrayType& array,
                                   std::shared_ptr<Buffer>* value_offsets) {
-    // Share slicing logic between ListArray and BinaryArray
+    // Share slicing logic between ListArray and BinaryArray, and their
+    // variants with 64-bit offsets
+    using offset_type = typename ArrayType::TypeClass::offset_type;
 
     auto offsets = array.value_offsets();
 
@@ -267,11 +375,11 @@ class RecordBatchSerializer : public ArrayVisitor {
       // b) slice the values array accordingly
 
       std::shared_ptr<Buffer> shifted_offsets;
-      RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(int32_t) * (array.length() + 1),
+      RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(offset_type) * (array.length() + 1),
                                    &shifted_offsets));
 
-      int32_t* dest_offsets = reinterpret_cast<int32_t*>(shifted_offsets->mutable_data());
-      const int32_t start_offset = array.value_offset(0);
+      auto dest_offsets = reinterpret_cast<offset_type*>(shifted_offsets->mutable_data());
+      const offset_type start_offset = array.value_offset(0);
 
       for (int i = 0; i < array.length(); ++i) {
         dest_offsets[i] = array.value_offset(i) - start_offset;
@@ -285,9 +393,10 @@ class RecordBatchSerializer : public ArrayVisitor {
     return Status::OK();
   }
 
-  Status VisitBinary(const BinaryArray& array) {
+  template <typename ArrayType>
+  Status VisitBinary(const ArrayType& array) {
     std::shared_ptr<Buffer> value_offsets;
-    RETURN_NOT_OK(GetZeroBasedValueOffsets<BinaryArray>(array, &value_offsets));
+    RETURN_NOT_OK(GetZeroBasedValueOffsets<ArrayType>(array, &value_offsets));
     auto data = array.value_data();
 
     int64_t total_data_bytes = 0;
@@ -348,25 +457,47 @@ class RecordBatchSerializer : public ArrayVisitor {
 
   Status Visit(const BinaryArray& array) override { return VisitBinary(array); }
 
-  Status Visit(const ListArray& array) override {
+  Status Visit(const LargeStringArray& array) override { return VisitBinary(array); }
+
+  Status Visit(const LargeBinaryArray& array) override { return VisitBinary(array); }
+
+  Status Visit(const ListArray& array) override { return VisitList(array); }
+
+  Status Visit(const LargeListArray& array) override { return VisitList(array); }
+
+  template <typename ArrayType>
+  Status VisitList(const ArrayType& array) {
     std::shared_ptr<Buffer> value_offsets;
-    RETURN_NOT_OK(GetZeroBasedValueOffsets<ListArray>(array, &value_offsets));
+    RETURN_NOT_OK(GetZeroBasedValueOffsets<ArrayType>(array, &value_offsets));
     buffers_.push_back(value_offsets);
 
     --max_recursion_depth_;
+    // The values spanned by the slice, which the offsets were rebased to
+    RETURN_NOT_OK(VisitArray(*array.Flatten()));
+    ++max_recursion_depth_;
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) override {
+    const int64_t first_run = array.first_run();
+    const int64_t num_runs = array.num_runs();
+    std::shared_ptr<Buffer> run_ends = array.run_ends();
     std::shared_ptr<Array> values = array.values();
 
-    int32_t values_offset = 0;
-    int32_t values_length = 0;
-    if (value_offsets) {
-      values_offset = array.value_offset(0);
-      values_length = array.value_offset(array.length()) - values_offset;
+    if (array.offset() != 0 || num_runs < values->length()) {
+      // Write the runs spanned by the slice, clipped to it
+      RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(int32_t) * num_runs, &run_ends));
+      int32_t* dest_run_ends = reinterpret_cast<int32_t*>(run_ends->mutable_data());
+      int32_t position = 0;
+      for (int64_t i = 0; i < num_runs; ++i) {
+        position += static_cast<int32_t>(array.run_length(first_run + i));
+        dest_run_ends[i] = position;
+      }
+      values = values->Slice(first_run, num_runs);
     }
+    buffers_.push_back(run_ends);
 
-    if (array.offset() != 0 || values_length < values->length()) {
-      // Must also slice the values
-      values = values->Slice(values_offset, values_length);
-    }
+    --max_recursion_depth_;
     RETURN_NOT_OK(VisitArray(*values));
     ++max_recursion_depth_;
     return Status::OK();
@@ -478,6 +609,12 @@ class RecordBatchSerializer : public ArrayVisitor {
     return array.indices()->Accept(this);
   }
 
+  Status CompressBuffer(const std::shared_ptr<Buffer>& buffer,
+                        std::shared_ptr<Buffer>* out) {
+    return ::arrow::ipc::CompressBuffer(codec_.get(), min_compressed_size_, pool_,
+                                        *buffer, out);
+  }
+
   // In some cases, intermediate buffers may need to be allocated (with sliced arrays)
   MemoryPool* pool_;
 
@@ -488,6 +625,15 @@ class RecordBatchSerializer : public ArrayVisitor {
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
   bool allow_64bit_;
+
+  Compression::type compression_;
+  int64_t min_compressed_size_;
+  std::unique_ptr<Codec> codec_;
+
+  std::vector<int64_t> batch_lengths_;
+
+  // Reused when the serializer writes several record batches
+  internal::RecordBatchMetadataWriter metadata_writer_;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
@@ -496,13 +642,15 @@ class DictionaryWriter : public RecordBatchSerializer {
 
   Status WriteMetadataMessage(int64_t num_rows, int64_t body_length,
                               std::shared_ptr<Buffer>* out) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, body_length, field_nodes_,
-                                  buffer_meta_, out);
+    return metadata_writer_.WriteDictionary(dictionary_id_, num_rows, body_length,
+                                            field_nodes_, buffer_meta_, is_delta_, out);
   }
 
   Status Write(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
-               io::OutputStream* dst, int32_t* metadata_length, int64_t* body_length) {
+               bool is_delta, io::OutputStream* dst, int32_t* metadata_length,
+               int64_t* body_length) {
     dictionary_id_ = dictionary_id;
+    is_delta_ = is_delta;
 
     // Make a dummy record batch. A bit tedious as we have to make a schema
     auto schema = arrow::schema({arrow::field("dictionary", dictionary->type())});
@@ -510,9 +658,20 @@ class DictionaryWriter : public RecordBatchSerializer {
     return RecordBatchSerializer::Write(*batch, dst, metadata_length, body_length);
   }
 
+  Status GetPayload(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
+                    RecordBatchPayload* out) {
+    dictionary_id_ = dictionary_id;
+    is_delta_ = false;
+
+    auto schema = arrow::schema({arrow::field("dictionary", dictionary->type())});
+    auto batch = RecordBatch::Make(schema, dictionary->length(), {dictionary});
+    return RecordBatchSerializer::GetPayload(*batch, out);
+  }
+
  private:
   // TODO(wesm): Setting this in Write is a bit unclean, but it works
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 // Adds padding bytes if necessary to ensure all memory blocks are written on
@@ -536,6 +695,17 @@ Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
   return writer.Write(batch, dst, metadata_length, body_length);
 }
 
+Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, MemoryPool* pool, int max_recursion_depth,
+                        bool allow_64bit, Compression::type compression,
+                        int64_t min_compressed_size) {
+  RecordBatchSerializer writer(pool, buffer_start_offset, max_recursion_depth,
+                               allow_64bit);
+  RETURN_NOT_OK(writer.SetCompression(compression, min_compressed_size));
+  return writer.Write(batch, dst, metadata_length, body_length);
+}
+
 Status WriteRecordBatchStream(const std::vector<std::shared_ptr<RecordBatch>>& batches,
                               io::OutputStream* dst) {
   std::shared_ptr<RecordBatchWriter> writer;
@@ -645,6 +815,125 @@ Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadat
   }
 }
 
+Status WriteStridedTensor(const Tensor& tensor, io::OutputStream* dst,
+                          Compression::type compression, MemoryPool* pool,
+                          int32_t* metadata_length, int64_t* body_length) {
+  const auto& type = static_cast<const FixedWidthType&>(*tensor.type());
+  const int64_t elem_size = type.bit_width() / 8;
+
+  // The bytes from the first value to the end of the last one
+  int64_t span = tensor.size() > 0 ? elem_size : 0;
+  for (int i = 0; i < tensor.ndim() && span > 0; ++i) {
+    const int64_t stride = tensor.strides()[i];
+    if (stride < 0) {
+      // The metadata only has non-negative strides
+      std::unique_ptr<Tensor> contiguous;
+      RETURN_NOT_OK(GetContiguousTensor(tensor, pool, &contiguous));
+      return WriteStridedTensor(*contiguous, dst, compression, pool, metadata_length,
+                                body_length);
+    }
+    span += (tensor.shape()[i] - 1) * stride;
+  }
+  if (span > 0 && (tensor.data() == nullptr || span > tensor.data()->size())) {
+    return Status::Invalid("Tensor strides reach past the end of its data");
+  }
+
+  std::shared_ptr<Buffer> body = span > 0 ? SliceBuffer(tensor.data(), 0, span)
+                                          : std::make_shared<Buffer>(nullptr, 0);
+  if (compression != Compression::UNCOMPRESSED) {
+    std::unique_ptr<Codec> codec;
+    RETURN_NOT_OK(Codec::Create(compression, &codec));
+    RETURN_NOT_OK(CompressBuffer(codec.get(), 0, pool, *body, &body));
+  }
+
+  RETURN_NOT_OK(AlignStreamPosition(dst));
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(
+      internal::WriteTensorMessage(tensor, 0, body->size(), compression, &metadata));
+  RETURN_NOT_OK(internal::WriteMessage(*metadata, dst, metadata_length));
+  *body_length = body->size();
+  return dst->Write(body->data(), body->size());
+}
+
+namespace {
+
+// A row-major copy of a sparse index tensor, which may have been wrapped from
+// memory of another layout
+Status GetRowMajorIndex(const std::shared_ptr<Tensor>& index, MemoryPool* pool,
+                        std::shared_ptr<Tensor>* out) {
+  if (index->is_row_major()) {
+    *out = index;
+    return Status::OK();
+  }
+  std::unique_ptr<Tensor> contiguous;
+  RETURN_NOT_OK(GetContiguousTensor(*index, pool, &contiguous));
+  out->reset(contiguous.release());
+  return Status::OK();
+}
+
+}  // namespace
+
+Status WriteSparseTensor(const SparseTensor& sparse_tensor, io::OutputStream* dst,
+                         int32_t* metadata_length, int64_t* body_length,
+                         MemoryPool* pool) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::shared_ptr<Tensor> index;
+  switch (sparse_tensor.format_id()) {
+    case SparseTensorFormat::COO: {
+      const auto& sparse_index =
+          static_cast<const SparseCOOIndex&>(*sparse_tensor.sparse_index());
+      RETURN_NOT_OK(GetRowMajorIndex(sparse_index.indices(), pool, &index));
+      buffers.push_back(index->data());
+      break;
+    }
+    case SparseTensorFormat::CSR: {
+      const auto& sparse_index =
+          static_cast<const SparseCSRIndex&>(*sparse_tensor.sparse_index());
+      RETURN_NOT_OK(GetRowMajorIndex(sparse_index.indptr(), pool, &index));
+      buffers.push_back(index->data());
+      RETURN_NOT_OK(GetRowMajorIndex(sparse_index.indices(), pool, &index));
+      buffers.push_back(index->data());
+      break;
+    }
+    default:
+      return Status::NotImplemented("Unsupported sparse tensor format");
+  }
+
+  // Only the non-zero values are written, the data may be a larger buffer
+  const auto& type = static_cast<const FixedWidthType&>(*sparse_tensor.type());
+  const int64_t data_size = sparse_tensor.non_zero_length() * type.bit_width() / 8;
+  buffers.push_back(data_size > 0 ? SliceBuffer(sparse_tensor.data(), 0, data_size)
+                                  : std::make_shared<Buffer>(nullptr, 0));
+
+  // Every buffer starts at an 8-byte offset into the body
+  std::vector<internal::BufferMetadata> buffer_meta;
+  int64_t offset = 0;
+  for (const auto& buffer : buffers) {
+    const int64_t size = buffer ? buffer->size() : 0;
+    buffer_meta.push_back({offset, size});
+    offset += PaddedLength(size);
+  }
+
+  RETURN_NOT_OK(AlignStreamPosition(dst));
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(
+      internal::WriteSparseTensorMessage(sparse_tensor, offset, buffer_meta, &metadata));
+  RETURN_NOT_OK(internal::WriteMessage(*metadata, dst, metadata_length));
+
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const int64_t size = buffer_meta[i].length;
+    if (size > 0) {
+      RETURN_NOT_OK(dst->Write(buffers[i]->data(), size));
+    }
+    const int64_t padding = PaddedLength(size) - size;
+    if (padding > 0) {
+      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+    }
+  }
+  *body_length = offset;
+  return Status::OK();
+}
+
 Status GetTensorMessage(const Tensor& tensor, MemoryPool* pool,
                         std::unique_ptr<Message>* out) {
   const Tensor* tensor_to_write = &tensor;
@@ -663,9 +952,11 @@ Status GetTensorMessage(const Tensor& tensor, MemoryPool* pool,
 
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
                        int64_t buffer_start_offset, io::OutputStream* dst,
-                       int32_t* metadata_length, int64_t* body_length, MemoryPool* pool) {
+                       int32_t* metadata_length, int64_t* body_length, MemoryPool* pool,
+                       bool is_delta = false) {
   DictionaryWriter writer(pool, buffer_start_offset, kMaxNestingDepth, false);
-  return writer.Write(dictionary_id, dictionary, dst, metadata_length, body_length);
+  return writer.Write(dictionary_id, dictionary, is_delta, dst, metadata_length,
+                      body_length);
 }
 
 Status GetRecordBatchSize(const RecordBatch& batch, int64_t* size) {
@@ -750,7 +1041,10 @@ class SchemaWriter : public StreamBookKeeper {
  public:
   SchemaWriter(const Schema& schema, DictionaryMemo* dictionary_memo, MemoryPool* pool,
                io::OutputStream* sink)
-      : StreamBookKeeper(sink), schema_(schema), dictionary_memo_(dictionary_memo) {}
+      : StreamBookKeeper(sink),
+        pool_(pool),
+        schema_(schema),
+        dictionary_memo_(dictionary_memo) {}
 
   Status WriteSchema() {
     std::shared_ptr<Buffer> schema_fb;
@@ -799,6 +1093,99 @@ class SchemaWriter : public StreamBookKeeper {
   DictionaryMemo* dictionary_memo_;
 };
 
+// ----------------------------------------------------------------------
+// Record batch index statistics, see RecordBatchStreamWriter::SetIndexing
+
+static bool HasIndexStatistics(const DataType& type) {
+  switch (type.id()) {
+    case Type::UINT8:
+    case Type::INT8:
+    case Type::UINT16:
+    case Type::INT16:
+    case Type::UINT32:
+    case Type::INT32:
+    case Type::UINT64:
+    case Type::INT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename ArrowType>
+static Status AppendMinMax(const Array& array, ArrayBuilder* min_builder,
+                           ArrayBuilder* max_builder) {
+  using c_type = typename ArrowType::c_type;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using BuilderType = typename TypeTraits<ArrowType>::BuilderType;
+
+  const auto& values = static_cast<const ArrayType&>(array);
+  bool found = false;
+  c_type min_value = c_type();
+  c_type max_value = c_type();
+  for (int64_t i = 0; i < values.length(); ++i) {
+    const c_type value = values.Value(i);
+    // NaN compares unequal to itself and is left out as nulls are
+    if (values.IsNull(i) || value != value) {
+      continue;
+    }
+    if (!found) {
+      min_value = max_value = value;
+      found = true;
+    } else {
+      min_value = std::min(min_value, value);
+      max_value = std::max(max_value, value);
+    }
+  }
+
+  auto min_values = static_cast<BuilderType*>(min_builder);
+  auto max_values = static_cast<BuilderType*>(max_builder);
+  if (!found) {
+    RETURN_NOT_OK(min_values->AppendNull());
+    return max_values->AppendNull();
+  }
+  RETURN_NOT_OK(min_values->Append(min_value));
+  return max_values->Append(max_value);
+}
+
+#define INDEX_STATISTICS_CASE(TYPE_ID, ArrowType) \
+  case Type::TYPE_ID:                              \
+    return AppendMinMax<ArrowType>(array, min_builder, max_builder);
+
+static Status AppendIndexStatistics(const Array& array, ArrayBuilder* min_builder,
+                                    ArrayBuilder* max_builder) {
+  switch (array.type_id()) {
+    INDEX_STATISTICS_CASE(UINT8, UInt8Type);
+    INDEX_STATISTICS_CASE(INT8, Int8Type);
+    INDEX_STATISTICS_CASE(UINT16, UInt16Type);
+    INDEX_STATISTICS_CASE(INT16, Int16Type);
+    INDEX_STATISTICS_CASE(UINT32, UInt32Type);
+    INDEX_STATISTICS_CASE(INT32, Int32Type);
+    INDEX_STATISTICS_CASE(UINT64, UInt64Type);
+    INDEX_STATISTICS_CASE(INT64, Int64Type);
+    INDEX_STATISTICS_CASE(FLOAT, FloatType);
+    INDEX_STATISTICS_CASE(DOUBLE, DoubleType);
+    INDEX_STATISTICS_CASE(DATE32, Date32Type);
+    INDEX_STATISTICS_CASE(DATE64, Date64Type);
+    INDEX_STATISTICS_CASE(TIME32, Time32Type);
+    INDEX_STATISTICS_CASE(TIME64, Time64Type);
+    INDEX_STATISTICS_CASE(TIMESTAMP, TimestampType);
+    default:
+      break;
+  }
+  return Status::NotImplemented("No index statistics for type " +
+                                array.type()->ToString());
+}
+
+#undef INDEX_STATISTICS_CASE
+
 class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKeeper {
  public:
   RecordBatchStreamWriterImpl(io::OutputStream* sink,
@@ -806,13 +1193,31 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
       : StreamBookKeeper(sink),
         schema_(schema),
         pool_(default_memory_pool()),
-        started_(false) {}
-
-  virtual ~RecordBatchStreamWriterImpl() = default;
+        started_(false),
+        compression_(Compression::UNCOMPRESSED),
+        min_compressed_size_(kDefaultMinCompressedSize),
+        allow_dictionary_updates_(true),
+        dictionaries_updated_(false),
+        max_pending_batches_(0),
+        num_pending_batches_(0),
+        coalesce_max_rows_(0),
+        coalesce_max_bytes_(0),
+        coalesce_max_delay_(-1),
+        coalesced_rows_(0),
+        coalesced_bytes_(0),
+        coalesced_allow_64bit_(true),
+        indexing_(false) {}
+
+  virtual ~RecordBatchStreamWriterImpl() {
+    // The pipeline tasks refer to this object, even if Close was not called
+    Status st = WaitForPending(0);
+    ARROW_UNUSED(st);
+  }
 
   virtual Status Start() {
     SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_);
     RETURN_NOT_OK(schema_writer.Write(&dictionaries_));
+    written_dictionaries_ = dictionary_memo_.id_to_dictionary();
     started_ = true;
     return Status::OK();
   }
@@ -821,6 +1226,8 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     // Write the schema if not already written
     // User is responsible for closing the OutputStream
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(FlushCoalesced());
+    RETURN_NOT_OK(WaitForPending(0));
 
     // Write 0 EOS message
     const int32_t kEos = 0;
@@ -834,17 +1241,23 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     return Status::OK();
   }
 
-  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit, FileBlock* block) {
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit,
+                          const std::vector<int64_t>& batch_lengths, FileBlock* block) {
     RETURN_NOT_OK(CheckStarted());
+    std::vector<DictionaryUpdate> updates;
+    RETURN_NOT_OK(GetDictionaryUpdates(batch, &updates));
+    RETURN_NOT_OK(WriteDictionaryUpdates(updates));
     RETURN_NOT_OK(UpdatePosition());
 
     block->offset = position_;
 
     // Frame of reference in file format is 0, see ARROW-384
-    const int64_t buffer_start_offset = 0;
-    RETURN_NOT_OK(arrow::ipc::WriteRecordBatch(
-        batch, buffer_start_offset, sink_, &block->metadata_length, &block->body_length,
-        pool_, kMaxNestingDepth, allow_64bit));
+    RecordBatchSerializer* serializer;
+    RETURN_NOT_OK(GetSerializer(&serializer));
+    serializer->set_allow_64bit(allow_64bit);
+    serializer->SetBatchLengths(batch_lengths);
+    RETURN_NOT_OK(
+        serializer->Write(batch, sink_, &block->metadata_length, &block->body_length));
     RETURN_NOT_OK(UpdatePosition());
 
     DCHECK(position_ % 8 == 0) << "WriteRecordBatch did not perform aligned writes";
@@ -853,25 +1266,565 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
   }
 
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit) {
+    if (coalesce_max_rows_ > 0) {
+      return CoalesceRecordBatch(batch, allow_64bit);
+    }
+    return WriteMessage(batch, allow_64bit, {});
+  }
+
+  // Write the buffered record batches as one, see SetCoalescing
+  Status FlushCoalesced() {
+    if (coalesced_.empty()) {
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    batches.swap(coalesced_);
+    const bool allow_64bit = coalesced_allow_64bit_;
+    coalesced_rows_ = 0;
+    coalesced_bytes_ = 0;
+    coalesced_allow_64bit_ = true;
+    if (batches.size() == 1) {
+      return WriteMessage(*batches[0], allow_64bit, {});
+    }
+
+    std::vector<int64_t> batch_lengths(batches.size());
+    int64_t num_rows = 0;
+    for (size_t i = 0; i < batches.size(); ++i) {
+      batch_lengths[i] = batches[i]->num_rows();
+      num_rows += batch_lengths[i];
+    }
+    const std::shared_ptr<Schema>& schema = batches[0]->schema();
+    std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      ArrayVector chunks(batches.size());
+      for (size_t j = 0; j < batches.size(); ++j) {
+        chunks[j] = batches[j]->column(i);
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool_, &columns[i]));
+    }
+    return WriteMessage(*RecordBatch::Make(schema, num_rows, columns), allow_64bit,
+                        batch_lengths);
+  }
+
+  Status Flush() {
+    RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(FlushCoalesced());
+    RETURN_NOT_OK(WaitForPending(0));
+    return sink_->Flush();
+  }
+
+  Status SetCoalescing(int64_t max_rows, int64_t max_bytes, double max_delay) {
+    // Batches already buffered are written with the previous settings
+    RETURN_NOT_OK(FlushCoalesced());
+    coalesce_max_rows_ = std::max<int64_t>(max_rows, 0);
+    coalesce_max_bytes_ = max_bytes;
+    coalesce_max_delay_ = max_delay;
+    return Status::OK();
+  }
+
+  void set_memory_pool(MemoryPool* pool) {
+    // A pipelined error is returned by the next write
+    Status st = WaitForPending(0);
+    ARROW_UNUSED(st);
+    pool_ = pool;
+    serializer_.reset();
+  }
+
+  Status SetPipelining(int max_pending_batches) {
+    if (max_pending_batches < 0) {
+      return Status::Invalid("The number of pending batches must be non-negative");
+    }
+    // Batches already queued are written with the previous settings
+    RETURN_NOT_OK(WaitForPending(0));
+    if (max_pending_batches > 0 && serialize_pool_ == nullptr) {
+      RETURN_NOT_OK(::arrow::internal::ThreadPool::Make(1, &serialize_pool_));
+      RETURN_NOT_OK(::arrow::internal::ThreadPool::Make(1, &write_pool_));
+    }
+    max_pending_batches_ = max_pending_batches;
+    return Status::OK();
+  }
+
+  Status SetIndexing(bool indexing) {
+    RETURN_NOT_OK(WaitForPending(0));
+    if (!record_batches_.empty() || !coalesced_.empty()) {
+      return Status::Invalid("Indexing must be set before writing record batches");
+    }
+    indexing_ = indexing;
+    null_counts_.assign(indexing ? schema_->num_fields() : 0, {});
+    indexed_fields_.clear();
+    min_builders_.clear();
+    max_builders_.clear();
+    minima_.clear();
+    maxima_.clear();
+    if (!indexing) {
+      return Status::OK();
+    }
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const std::shared_ptr<DataType>& type = schema_->field(i)->type();
+      if (!HasIndexStatistics(*type)) {
+        continue;
+      }
+      std::unique_ptr<ArrayBuilder> min_builder;
+      std::unique_ptr<ArrayBuilder> max_builder;
+      RETURN_NOT_OK(MakeBuilder(pool_, type, &min_builder));
+      RETURN_NOT_OK(MakeBuilder(pool_, type, &max_builder));
+      indexed_fields_.push_back(i);
+      min_builders_.push_back(std::move(min_builder));
+      max_builders_.push_back(std::move(max_builder));
+      minima_.push_back(nullptr);
+      maxima_.push_back(nullptr);
+    }
+    return Status::OK();
+  }
+
+  Status SetBloomFilters(const std::vector<std::string>& field_names) {
+    RETURN_NOT_OK(WaitForPending(0));
+    if (!record_batches_.empty() || !coalesced_.empty()) {
+      return Status::Invalid("Bloom filters must be set before writing record batches");
+    }
+    std::vector<int> fields;
+    for (const std::string& name : field_names) {
+      const int64_t index = schema_->GetFieldIndex(name);
+      if (index < 0) {
+        return Status::Invalid("No field named " + name);
+      }
+      fields.push_back(static_cast<int>(index));
+    }
+    bloom_fields_ = fields;
+    bloom_filters_.clear();
+    return Status::OK();
+  }
+
+  Status GetIndex(std::shared_ptr<RecordBatch>* out) {
+    RETURN_NOT_OK(WaitForPending(0));
+    if (!indexing_) {
+      return Status::Invalid("Indexing was not enabled on the writer");
+    }
+    if (dictionaries_updated_) {
+      return Status::Invalid(
+          "Streams whose dictionaries change between batches cannot be indexed");
+    }
+    DCHECK_EQ(num_rows_.size(), record_batches_.size());
+
+    Int64Builder offsets(pool_);
+    Int32Builder metadata_lengths(pool_);
+    Int64Builder body_lengths(pool_);
+    Int64Builder num_rows(pool_);
+    for (const FileBlock& block : record_batches_) {
+      RETURN_NOT_OK(offsets.Append(block.offset));
+      RETURN_NOT_OK(metadata_lengths.Append(block.metadata_length));
+      RETURN_NOT_OK(body_lengths.Append(block.body_length));
+    }
+    RETURN_NOT_OK(
+        num_rows.Append(num_rows_.data(), static_cast<int64_t>(num_rows_.size())));
+
+    std::vector<std::shared_ptr<Field>> fields = {
+        field("offset", int64(), false), field("metadata_length", int32(), false),
+        field("body_length", int64(), false), field("num_rows", int64(), false)};
+    std::vector<std::shared_ptr<Array>> columns(fields.size());
+    RETURN_NOT_OK(offsets.Finish(&columns[0]));
+    RETURN_NOT_OK(metadata_lengths.Finish(&columns[1]));
+    RETURN_NOT_OK(body_lengths.Finish(&columns[2]));
+    RETURN_NOT_OK(num_rows.Finish(&columns[3]));
+
+    size_t j = 0;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const Field& indexed = *schema_->field(i);
+      Int64Builder null_counts(pool_);
+      RETURN_NOT_OK(null_counts.Append(null_counts_[i].data(),
+                                       static_cast<int64_t>(null_counts_[i].size())));
+      std::shared_ptr<Array> column;
+      RETURN_NOT_OK(null_counts.Finish(&column));
+      fields.push_back(field(indexed.name() + "_null_count", int64(), false));
+      columns.push_back(column);
+
+      if (j < indexed_fields_.size() && indexed_fields_[j] == i) {
+        RETURN_NOT_OK(FinishIndexColumn(min_builders_[j].get(), &minima_[j]));
+        RETURN_NOT_OK(FinishIndexColumn(max_builders_[j].get(), &maxima_[j]));
+        fields.push_back(field(indexed.name() + "_min", indexed.type()));
+        fields.push_back(field(indexed.name() + "_max", indexed.type()));
+        columns.push_back(minima_[j]);
+        columns.push_back(maxima_[j]);
+        ++j;
+      }
+    }
+    *out = RecordBatch::Make(::arrow::schema(fields),
+                             static_cast<int64_t>(num_rows_.size()), columns);
+    return Status::OK();
+  }
+
+  Status SetCompression(Compression::type compression, int64_t min_buffer_size) {
+    if (compression != Compression::UNCOMPRESSED) {
+      // Fail early if the codec is not built
+      std::unique_ptr<Codec> codec;
+      RETURN_NOT_OK(Codec::Create(compression, &codec));
+    }
+    // Batches already queued are serialized with the previous settings
+    RETURN_NOT_OK(WaitForPending(0));
+    compression_ = compression;
+    min_compressed_size_ = min_buffer_size;
+    if (serializer_) {
+      RETURN_NOT_OK(serializer_->SetCompression(compression, min_buffer_size));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  // The serializer is kept between record batches, so that its scratch space
+  // and metadata builder are allocated once per stream. It is only used from
+  // the serialize thread while batches are queued
+  Status GetSerializer(RecordBatchSerializer** out) {
+    if (serializer_ == nullptr) {
+      // Frame of reference in file format is 0, see ARROW-384
+      serializer_.reset(new RecordBatchSerializer(pool_, 0, kMaxNestingDepth, false));
+      RETURN_NOT_OK(serializer_->SetCompression(compression_, min_compressed_size_));
+    }
+    *out = serializer_.get();
+    return Status::OK();
+  }
+
+  // Write a record batch as its own message, or the record batches of the
+  // given lengths coalesced into it
+  Status WriteMessage(const RecordBatch& batch, bool allow_64bit,
+                      const std::vector<int64_t>& batch_lengths) {
+    if (indexing_) {
+      RETURN_NOT_OK(AppendIndexEntry(batch));
+    }
+    if (!bloom_fields_.empty()) {
+      RETURN_NOT_OK(AppendBloomFilters(batch));
+    }
+    if (max_pending_batches_ > 0) {
+      return EnqueueRecordBatch(batch, allow_64bit, batch_lengths);
+    }
     // Push an empty FileBlock. Can be written in the footer later
     record_batches_.push_back({0, 0, 0});
-    return WriteRecordBatch(batch, allow_64bit,
+    return WriteRecordBatch(batch, allow_64bit, batch_lengths,
                             &record_batches_[record_batches_.size() - 1]);
   }
 
-  void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
+  // Buffer the batch until enough rows or bytes are buffered, or the oldest
+  // buffered batch is too old. Only batches of the same schema, hence with
+  // the same dictionaries, can be concatenated
+  Status CoalesceRecordBatch(const RecordBatch& batch, bool allow_64bit) {
+    if (batch.num_columns() != schema_->num_fields()) {
+      return Status::Invalid("Record batch does not match the stream schema");
+    }
+    if (!coalesced_.empty()) {
+      const std::shared_ptr<Schema>& schema = coalesced_[0]->schema();
+      if (schema != batch.schema() && !schema->Equals(*batch.schema())) {
+        RETURN_NOT_OK(FlushCoalesced());
+      }
+    }
+    if (coalesced_.empty()) {
+      coalesce_start_ = std::chrono::steady_clock::now();
+    }
+
+    // The caller only lends us the batch, so its columns are retained
+    std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns[i] = batch.column(i);
+      coalesced_bytes_ += BufferedSize(*columns[i]->data());
+    }
+    coalesced_.push_back(RecordBatch::Make(batch.schema(), batch.num_rows(), columns));
+    coalesced_rows_ += batch.num_rows();
+    coalesced_allow_64bit_ = coalesced_allow_64bit_ && allow_64bit;
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - coalesce_start_;
+    if (coalesced_rows_ >= coalesce_max_rows_ ||
+        (coalesce_max_bytes_ > 0 && coalesced_bytes_ >= coalesce_max_bytes_) ||
+        (coalesce_max_delay_ >= 0 && elapsed.count() >= coalesce_max_delay_)) {
+      return FlushCoalesced();
+    }
+    return Status::OK();
+  }
+
+  // The size of the buffers the array refers to, which is more than the
+  // serialized size of a slice
+  static int64_t BufferedSize(const ArrayData& data) {
+    int64_t size = 0;
+    for (const auto& buffer : data.buffers) {
+      if (buffer) {
+        size += buffer->size();
+      }
+    }
+    for (const auto& child : data.child_data) {
+      size += BufferedSize(*child);
+    }
+    return size;
+  }
+
+  // Block until at most max_pending batches are queued, returning the first
+  // error of the pipeline
+  Status WaitForPending(int max_pending) {
+    std::unique_lock<std::mutex> lock(pending_mutex_);
+    pending_cv_.wait(lock, [&]() { return num_pending_batches_ <= max_pending; });
+    return pipeline_status_;
+  }
+
+  void FinishPending(const Status& st) {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (!st.ok() && pipeline_status_.ok()) {
+      pipeline_status_ = st;
+    }
+    --num_pending_batches_;
+    pending_cv_.notify_all();
+  }
+
+  // Serialize the batch on one thread and write it out on another, so that
+  // a batch is serialized while the previous one is written. The sink is
+  // only used from the write thread until the queue is drained
+  Status EnqueueRecordBatch(const RecordBatch& batch, bool allow_64bit,
+                            const std::vector<int64_t>& batch_lengths) {
+    RETURN_NOT_OK(CheckStarted());
+    std::vector<DictionaryUpdate> updates;
+    RETURN_NOT_OK(GetDictionaryUpdates(batch, &updates));
+    if (!updates.empty()) {
+      // The dictionary batches must precede the record batch in the sink
+      RETURN_NOT_OK(WaitForPending(0));
+      RETURN_NOT_OK(WriteDictionaryUpdates(updates));
+    }
+    RETURN_NOT_OK(WaitForPending(max_pending_batches_ - 1));
+
+    // The caller only lends us the batch, so its columns are retained
+    std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns[i] = batch.column(i);
+    }
+    auto retained = RecordBatch::Make(batch.schema(), batch.num_rows(), columns);
+    RecordBatchSerializer* serializer;
+    RETURN_NOT_OK(GetSerializer(&serializer));
+
+    {
+      std::lock_guard<std::mutex> lock(pending_mutex_);
+      ++num_pending_batches_;
+    }
+    Status spawn_status = serialize_pool_->Spawn([=]() {
+      auto payload = std::make_shared<RecordBatchPayload>();
+      serializer->set_allow_64bit(allow_64bit);
+      serializer->SetBatchLengths(batch_lengths);
+      Status st = serializer->GetPayload(*retained, payload.get());
+      if (st.ok()) {
+        st = write_pool_->Spawn(
+            [this, payload]() { FinishPending(WritePayloadBlock(*payload)); });
+      }
+      if (!st.ok()) {
+        FinishPending(st);
+      }
+    });
+    if (!spawn_status.ok()) {
+      FinishPending(spawn_status);
+    }
+    return spawn_status;
+  }
+
+  // Record the row count and the statistics of the indexed fields of the
+  // batch. The location of the batch is known once it is written
+  Status AppendIndexEntry(const RecordBatch& batch) {
+    if (batch.num_columns() != schema_->num_fields()) {
+      return Status::Invalid("Record batch does not match the stream schema");
+    }
+    for (size_t j = 0; j < indexed_fields_.size(); ++j) {
+      const Array& column = *batch.column(indexed_fields_[j]);
+      if (!column.type()->Equals(*schema_->field(indexed_fields_[j])->type())) {
+        return Status::Invalid("Record batch type does not match the stream schema");
+      }
+      RETURN_NOT_OK(AppendIndexStatistics(column, min_builders_[j].get(),
+                                          max_builders_[j].get()));
+    }
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      null_counts_[i].push_back(batch.column(i)->null_count());
+    }
+    num_rows_.push_back(batch.num_rows());
+    return Status::OK();
+  }
+
+  // Build the Bloom filters of the filtered fields of the batch
+  Status AppendBloomFilters(const RecordBatch& batch) {
+    if (batch.num_columns() != schema_->num_fields()) {
+      return Status::Invalid("Record batch does not match the stream schema");
+    }
+    for (int i : bloom_fields_) {
+      std::shared_ptr<BlockedBloomFilter> filter;
+      RETURN_NOT_OK(BlockedBloomFilter::Make(batch.num_rows(), pool_, &filter));
+      RETURN_NOT_OK(filter->Insert(*batch.column(i)->data()));
+      bloom_filters_.push_back(filter->data());
+    }
+    return Status::OK();
+  }
+
+  // Append the values accumulated in builder since the last call to column,
+  // so that the index can be taken repeatedly while writing
+  Status FinishIndexColumn(ArrayBuilder* builder, std::shared_ptr<Array>* column) {
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(builder->Finish(&values));
+    if (*column == nullptr) {
+      *column = values;
+      return Status::OK();
+    }
+    return Concatenate({*column, values}, pool_, column);
+  }
+
+  // A dictionary batch to write before a record batch, either values to
+  // append to the dictionary with that id or a replacement for it
+  struct DictionaryUpdate {
+    int64_t id;
+    // The dictionary after the update, and the values sent for it
+    std::shared_ptr<Array> dictionary;
+    std::shared_ptr<Array> values;
+    bool is_delta;
+  };
+
+  // Find the dictionaries of the batch, keyed by the ids of the dictionary
+  // types of the stream schema they correspond to
+  Status CollectDictionaries(const DataType& stream_type, const DataType& batch_type,
+                             std::map<int64_t, std::shared_ptr<Array>>* out) {
+    if (stream_type.id() == Type::DICTIONARY) {
+      if (batch_type.id() != Type::DICTIONARY) {
+        return Status::Invalid("Record batch type does not match the stream schema");
+      }
+      const int64_t id = dictionary_memo_.GetId(
+          static_cast<const DictionaryType&>(stream_type).dictionary());
+      const std::shared_ptr<Array>& dictionary =
+          static_cast<const DictionaryType&>(batch_type).dictionary();
+      auto it = out->find(id);
+      if (it == out->end()) {
+        (*out)[id] = dictionary;
+      } else if (it->second != dictionary && !it->second->Equals(*dictionary)) {
+        std::stringstream ss;
+        ss << "Fields sharing dictionary " << id
+           << " have different dictionaries in the record batch";
+        return Status::Invalid(ss.str());
+      }
+      return Status::OK();
+    }
+    if (stream_type.num_children() != batch_type.num_children()) {
+      return Status::Invalid("Record batch type does not match the stream schema");
+    }
+    for (int i = 0; i < stream_type.num_children(); ++i) {
+      RETURN_NOT_OK(CollectDictionaries(*stream_type.child(i)->type(),
+                                        *batch_type.child(i)->type(), out));
+    }
+    return Status::OK();
+  }
+
+  // Compare the dictionaries of the batch with the ones last written. A
+  // dictionary that extends the previous one is sent as a delta of the new
+  // values, any other change as a replacement
+  Status GetDictionaryUpdates(const RecordBatch& batch,
+                              std::vector<DictionaryUpdate>* updates) {
+    if (written_dictionaries_.empty()) {
+      return Status::OK();
+    }
+    if (batch.num_columns() != schema_->num_fields()) {
+      return Status::Invalid("Record batch does not match the stream schema");
+    }
+    std::map<int64_t, std::shared_ptr<Array>> dictionaries;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      RETURN_NOT_OK(CollectDictionaries(*schema_->field(i)->type(),
+                                        *batch.schema()->field(i)->type(),
+                                        &dictionaries));
+    }
+    for (const auto& entry : dictionaries) {
+      const std::shared_ptr<Array>& written = written_dictionaries_[entry.first];
+      const std::shared_ptr<Array>& dictionary = entry.second;
+      if (written == dictionary || written->Equals(*dictionary)) {
+        continue;
+      }
+      if (!allow_dictionary_updates_) {
+        return Status::Invalid(
+            "The file format does not support dictionaries changing between batches");
+      }
+      const int64_t written_length = written->length();
+      if (dictionary->length() > written_length &&
+          dictionary->Slice(0, written_length)->Equals(*written)) {
+        updates->push_back(
+            {entry.first, dictionary, dictionary->Slice(written_length), true});
+      } else {
+        updates->push_back({entry.first, dictionary, dictionary, false});
+      }
+    }
+    return Status::OK();
+  }
+
+  Status WriteDictionaryUpdates(const std::vector<DictionaryUpdate>& updates) {
+    for (const DictionaryUpdate& update : updates) {
+      int32_t metadata_length = 0;
+      int64_t body_length = 0;
+      RETURN_NOT_OK(WriteDictionary(update.id, update.values, 0, sink_,
+                                    &metadata_length, &body_length, pool_,
+                                    update.is_delta));
+      written_dictionaries_[update.id] = update.dictionary;
+      dictionaries_updated_ = true;
+    }
+    return Status::OK();
+  }
+
+  Status WritePayloadBlock(const RecordBatchPayload& payload) {
+    RETURN_NOT_OK(UpdatePosition());
+    FileBlock block = {position_, 0, payload.body_length};
+    RETURN_NOT_OK(WritePayload(payload, sink_, &block.metadata_length));
+    RETURN_NOT_OK(UpdatePosition());
+    DCHECK(position_ % 8 == 0) << "WriteRecordBatch did not perform aligned writes";
+    record_batches_.push_back(block);
+    return Status::OK();
+  }
 
- protected:
   std::shared_ptr<Schema> schema_;
   MemoryPool* pool_;
   bool started_;
 
+  Compression::type compression_;
+  int64_t min_compressed_size_;
+  std::unique_ptr<RecordBatchSerializer> serializer_;
+
+  // Pipelined mode, see SetPipelining
+  int max_pending_batches_;
+  std::shared_ptr<::arrow::internal::ThreadPool> serialize_pool_;
+  std::shared_ptr<::arrow::internal::ThreadPool> write_pool_;
+  std::mutex pending_mutex_;
+  std::condition_variable pending_cv_;
+  int num_pending_batches_;
+  Status pipeline_status_;
+
+  // Coalescing of small record batches, see SetCoalescing
+  int64_t coalesce_max_rows_;
+  int64_t coalesce_max_bytes_;
+  double coalesce_max_delay_;
+  std::vector<std::shared_ptr<RecordBatch>> coalesced_;
+  int64_t coalesced_rows_;
+  int64_t coalesced_bytes_;
+  bool coalesced_allow_64bit_;
+  std::chrono::steady_clock::time_point coalesce_start_;
+
   // When writing out the schema, we keep track of all the dictionaries we
   // encounter, as they must be written out first in the stream
   DictionaryMemo dictionary_memo_;
 
+  // The dictionaries as the readers know them, updated by dictionary batches
+  // written between record batches
+  DictionaryMap written_dictionaries_;
+  bool allow_dictionary_updates_;
+  bool dictionaries_updated_;
+
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
+
+  // Index of the record batches, see SetIndexing. The minima and maxima of
+  // the indexed fields are accumulated in the builders until GetIndex
+  bool indexing_;
+  std::vector<int64_t> num_rows_;
+  std::vector<std::vector<int64_t>> null_counts_;
+  std::vector<int> indexed_fields_;
+  std::vector<std::unique_ptr<ArrayBuilder>> min_builders_;
+  std::vector<std::unique_ptr<ArrayBuilder>> max_builders_;
+  std::vector<std::shared_ptr<Array>> minima_;
+  std::vector<std::shared_ptr<Array>> maxima_;
+
+  // The Bloom filters of the filtered fields of each record batch, in record
+  // batch then field order, see RecordBatchFileWriter::SetBloomFilters
+  std::vector<int> bloom_fields_;
+  std::vector<std::shared_ptr<Buffer>> bloom_filters_;
 };
 
 RecordBatchStreamWriter::RecordBatchStreamWriter() {}
@@ -887,6 +1840,30 @@ void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
   impl_->set_memory_pool(pool);
 }
 
+Status RecordBatchStreamWriter::SetCompression(Compression::type compression,
+                                               int64_t min_buffer_size) {
+  return impl_->SetCompression(compression, min_buffer_size);
+}
+
+Status RecordBatchStreamWriter::SetPipelining(int max_pending_batches) {
+  return impl_->SetPipelining(max_pending_batches);
+}
+
+Status RecordBatchStreamWriter::SetIndexing(bool indexing) {
+  return impl_->SetIndexing(indexing);
+}
+
+Status RecordBatchStreamWriter::SetCoalescing(int64_t max_rows, int64_t max_bytes,
+                                              double max_delay) {
+  return impl_->SetCoalescing(max_rows, max_bytes, max_delay);
+}
+
+Status RecordBatchStreamWriter::Flush() { return impl_->Flush(); }
+
+Status RecordBatchStreamWriter::GetIndex(std::shared_ptr<RecordBatch>* out) {
+  return impl_->GetIndex(out);
+}
+
 Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
                                      const std::shared_ptr<Schema>& schema,
                                      std::shared_ptr<RecordBatchWriter>* out) {
@@ -908,7 +1885,10 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
   using BASE = RecordBatchStreamWriter::RecordBatchStreamWriterImpl;
 
   RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema)
-      : BASE(sink, schema) {}
+      : BASE(sink, schema) {
+    // Readers load the dictionaries of a file once, from its footer
+    allow_dictionary_updates_ = false;
+  }
 
   Status Start() override {
     // It is only necessary to align to 8-byte boundary at the start of the file
@@ -921,12 +1901,24 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
   }
 
   Status Close() override {
+    RETURN_NOT_OK(FlushCoalesced());
+    RETURN_NOT_OK(WaitForPending(0));
+
     // Write metadata
     RETURN_NOT_OK(UpdatePosition());
 
+    auto custom_metadata = std::make_shared<KeyValueMetadata>();
+    if (indexing_) {
+      RETURN_NOT_OK(AppendStatisticsMetadata(custom_metadata.get()));
+    }
+    if (!bloom_fields_.empty()) {
+      RETURN_NOT_OK(WriteBloomFilters(custom_metadata.get()));
+    }
+
     int64_t initial_position = position_;
-    RETURN_NOT_OK(WriteFileFooter(*schema_, dictionaries_, record_batches_,
-                                  &dictionary_memo_, sink_));
+    RETURN_NOT_OK(WriteFileFooter(
+        *schema_, dictionaries_, record_batches_, &dictionary_memo_, sink_,
+        custom_metadata->size() > 0 ? custom_metadata.get() : nullptr));
     RETURN_NOT_OK(UpdatePosition());
 
     // Write footer length
@@ -941,6 +1933,65 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
     // Write magic bytes to end file
     return Write(kArrowMagicBytes, strlen(kArrowMagicBytes));
   }
+
+ private:
+  // The index of the record batches, serialized as a stream for the footer
+  Status AppendStatisticsMetadata(KeyValueMetadata* metadata) {
+    std::shared_ptr<RecordBatch> index;
+    RETURN_NOT_OK(GetIndex(&index));
+    std::string value;
+    RETURN_NOT_OK(SerializeFooterBatch(*index, &value));
+    metadata->Append(internal::kBatchStatisticsKey, value);
+    return Status::OK();
+  }
+
+  // Write the Bloom filters after the last record batch, where readers of the
+  // footer do not look, and their locations to the footer
+  Status WriteBloomFilters(KeyValueMetadata* metadata) {
+    DCHECK_EQ(bloom_filters_.size(), record_batches_.size() * bloom_fields_.size());
+    Int32Builder batches(pool_);
+    Int32Builder fields(pool_);
+    Int64Builder offsets(pool_);
+    Int64Builder lengths(pool_);
+    const size_t num_fields = bloom_fields_.size();
+    for (size_t k = 0; k < bloom_filters_.size(); ++k) {
+      const Buffer& filter = *bloom_filters_[k];
+      RETURN_NOT_OK(batches.Append(static_cast<int32_t>(k / num_fields)));
+      RETURN_NOT_OK(fields.Append(bloom_fields_[k % num_fields]));
+      RETURN_NOT_OK(offsets.Append(position_));
+      RETURN_NOT_OK(lengths.Append(filter.size()));
+      // The filters are made of 64-byte blocks, so the footer stays aligned
+      RETURN_NOT_OK(Write(filter.data(), filter.size()));
+    }
+    bloom_filters_.clear();
+
+    std::vector<std::shared_ptr<Array>> columns(4);
+    RETURN_NOT_OK(batches.Finish(&columns[0]));
+    RETURN_NOT_OK(fields.Finish(&columns[1]));
+    RETURN_NOT_OK(offsets.Finish(&columns[2]));
+    RETURN_NOT_OK(lengths.Finish(&columns[3]));
+    auto schema = ::arrow::schema({field("batch", int32()), field("field", int32()),
+                                   field("offset", int64()), field("length", int64())});
+    auto locations = RecordBatch::Make(schema, columns[0]->length(), columns);
+    std::string value;
+    RETURN_NOT_OK(SerializeFooterBatch(*locations, &value));
+    metadata->Append(internal::kBloomFiltersKey, value);
+    return Status::OK();
+  }
+
+  Status SerializeFooterBatch(const RecordBatch& batch, std::string* out) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(1024, pool_, &stream));
+    std::shared_ptr<RecordBatchWriter> writer;
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(stream.get(), batch.schema(), &writer));
+    RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+    RETURN_NOT_OK(writer->Close());
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(stream->Finish(&buffer));
+    out->assign(reinterpret_cast<const char*>(buffer->data()),
+                static_cast<size_t>(buffer->size()));
+    return Status::OK();
+  }
 };
 
 RecordBatchFileWriter::RecordBatchFileWriter() {}
@@ -962,6 +2013,35 @@ Status RecordBatchFileWriter::WriteRecordBatch(const RecordBatch& batch,
   return file_impl_->WriteRecordBatch(batch, allow_64bit);
 }
 
+Status RecordBatchFileWriter::SetCompression(Compression::type compression,
+                                             int64_t min_buffer_size) {
+  return file_impl_->SetCompression(compression, min_buffer_size);
+}
+
+Status RecordBatchFileWriter::SetPipelining(int max_pending_batches) {
+  return file_impl_->SetPipelining(max_pending_batches);
+}
+
+Status RecordBatchFileWriter::SetIndexing(bool indexing) {
+  return file_impl_->SetIndexing(indexing);
+}
+
+Status RecordBatchFileWriter::SetBloomFilters(
+    const std::vector<std::string>& field_names) {
+  return file_impl_->SetBloomFilters(field_names);
+}
+
+Status RecordBatchFileWriter::SetCoalescing(int64_t max_rows, int64_t max_bytes,
+                                            double max_delay) {
+  return file_impl_->SetCoalescing(max_rows, max_bytes, max_delay);
+}
+
+Status RecordBatchFileWriter::Flush() { return file_impl_->Flush(); }
+
+Status RecordBatchFileWriter::GetIndex(std::shared_ptr<RecordBatch>* out) {
+  return file_impl_->GetIndex(out);
+}
+
 Status RecordBatchFileWriter::Close() { return file_impl_->Close(); }
 
 // ----------------------------------------------------------------------
@@ -1003,5 +2083,42 @@ Status SerializeSchema(const Schema& schema, MemoryPool* pool,
   return stream->Finish(out);
 }
 
+static void MoveToIpcPayload(Message::Type type, RecordBatchPayload* payload,
+                             IpcPayload* out) {
+  out->type = type;
+  out->metadata = std::move(payload->metadata);
+  out->body_buffers = std::move(payload->body_buffers);
+  out->body_length = payload->body_length;
+}
+
+Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool,
+                         std::vector<IpcPayload>* out) {
+  DictionaryMemo memo;
+  IpcPayload schema_payload;
+  schema_payload.type = Message::SCHEMA;
+  schema_payload.body_length = 0;
+  RETURN_NOT_OK(internal::WriteSchemaMessage(schema, &memo, &schema_payload.metadata));
+
+  out->clear();
+  out->push_back(std::move(schema_payload));
+  for (const auto& entry : memo.id_to_dictionary()) {
+    DictionaryWriter writer(pool, 0, kMaxNestingDepth, false);
+    RecordBatchPayload payload;
+    RETURN_NOT_OK(writer.GetPayload(entry.first, entry.second, &payload));
+    out->emplace_back();
+    MoveToIpcPayload(Message::DICTIONARY_BATCH, &payload, &out->back());
+  }
+  return Status::OK();
+}
+
+Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
+                             IpcPayload* out) {
+  RecordBatchSerializer serializer(pool, 0, kMaxNestingDepth, true);
+  RecordBatchPayload payload;
+  RETURN_NOT_OK(serializer.GetPayload(batch, &payload));
+  MoveToIpcPayload(Message::RECORD_BATCH, &payload, out);
+  return Status::OK();
+}
+
 }  // namespace ipc
 }  // namespace arrow
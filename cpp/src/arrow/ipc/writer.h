@@ -23,9 +23,11 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/ipc/message.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -36,6 +38,7 @@ class Field;
 class MemoryPool;
 class RecordBatch;
 class Schema;
+class SparseTensor;
 class Status;
 class Table;
 class Tensor;
@@ -48,6 +51,10 @@ class OutputStream;
 
 namespace ipc {
 
+/// Buffers smaller than this are not compressed by default, the codecs
+/// gaining little on them for the cost of a call
+constexpr int64_t kDefaultMinCompressedSize = 1024;
+
 /// \class RecordBatchWriter
 /// \brief Abstract interface for writing a stream of record batches
 class ARROW_EXPORT RecordBatchWriter {
@@ -113,6 +120,83 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
 
   void set_memory_pool(MemoryPool* pool) override;
 
+  /// \brief Compress the buffers of the record batches written from now on
+  ///
+  /// Each buffer of at least min_buffer_size bytes is compressed on its own
+  /// and the codec is recorded in the record batch metadata, so that readers
+  /// decompress the buffers transparently. Dictionaries are not compressed.
+  ///
+  /// \param[in] compression the codec, UNCOMPRESSED to stop compressing
+  /// \param[in] min_buffer_size buffers smaller than this are not compressed
+  /// \return Status, NotImplemented if the codec was not built
+  virtual Status SetCompression(Compression::type compression,
+                                int64_t min_buffer_size = kDefaultMinCompressedSize);
+
+  /// \brief Serialize and write record batches on background threads
+  ///
+  /// WriteRecordBatch then only queues the batch, which is serialized (and
+  /// compressed) on one thread while the previous batch is written to the
+  /// sink on another. WriteRecordBatch blocks while max_pending_batches are
+  /// queued, and errors are returned by the next call to WriteRecordBatch or
+  /// Close. The sink must not be used by the caller until Close returns.
+  ///
+  /// \param[in] max_pending_batches the queue depth, 0 to write synchronously
+  /// \return Status
+  virtual Status SetPipelining(int max_pending_batches);
+
+  /// \brief Index the record batches written, for random access to them
+  ///
+  /// The index returned by GetIndex has one row per record batch: its
+  /// location in the sink ("offset" as int64, "metadata_length" as int32 and
+  /// "body_length" as int64), its "num_rows" as int64 and then, for each
+  /// field, its "<name>_null_count" as int64 followed, for integer, floating
+  /// point, date, time and timestamp fields, by the "<name>_min" and
+  /// "<name>_max" of its non-null values, null if it has none. The index can
+  /// be kept next to the stream and passed to a
+  /// RecordBatchIndexedStreamReader. The file writer stores it in the footer
+  /// too, see RecordBatchFileReader::statistics. Must be called before the
+  /// first record batch is written
+  ///
+  /// \param[in] indexing whether to index the record batches
+  /// \return Status, Invalid if record batches were already written
+  virtual Status SetIndexing(bool indexing);
+
+  /// \brief Get the index of the record batches written so far
+  ///
+  /// As other stream readers, the indexed reader only knows the dictionaries
+  /// sent with the schema, so streams whose dictionaries changed cannot be
+  /// indexed
+  ///
+  /// \param[out] out the index, see SetIndexing
+  /// \return Status, Invalid if indexing is disabled or the dictionaries
+  /// changed between record batches
+  virtual Status GetIndex(std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Coalesce small record batches into larger messages
+  ///
+  /// WriteRecordBatch then buffers the batches, which are concatenated and
+  /// written as a single record batch message once max_rows rows or
+  /// max_bytes bytes are buffered, or when the oldest buffered batch is
+  /// max_delay seconds old. There is no timer: the delay is checked when a
+  /// batch is written, so use Flush to bound the latency of idle streams.
+  /// The message records the lengths of the original batches, see
+  /// RecordBatchStreamReader::set_split_coalesced. Batches are only
+  /// coalesced while their schema, including dictionaries, is the same. The
+  /// index has one entry per message
+  ///
+  /// \param[in] max_rows the number of rows to buffer, 0 to stop coalescing
+  /// \param[in] max_bytes the approximate size of the buffers of the
+  /// batches to buffer, 0 for no limit
+  /// \param[in] max_delay how long to buffer batches, negative for no limit
+  /// \return Status
+  virtual Status SetCoalescing(int64_t max_rows, int64_t max_bytes = 0,
+                               double max_delay = -1);
+
+  /// \brief Write out the coalesced and pipelined record batches now and
+  /// flush the sink
+  /// \return Status
+  virtual Status Flush();
+
  protected:
   RecordBatchStreamWriter();
   class ARROW_NO_EXPORT RecordBatchStreamWriterImpl;
@@ -144,6 +228,37 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   /// \return Status
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
 
+  Status SetCompression(Compression::type compression,
+                        int64_t min_buffer_size = kDefaultMinCompressedSize) override;
+
+  Status SetPipelining(int max_pending_batches) override;
+
+  Status SetIndexing(bool indexing) override;
+
+  Status GetIndex(std::shared_ptr<RecordBatch>* out) override;
+
+  /// \brief Store a Bloom filter of the values of some fields of each record
+  /// batch in the file
+  ///
+  /// A BlockedBloomFilter of the non-null values of each field is built for
+  /// every record batch written and kept in memory, about 2 bytes per value,
+  /// until Close writes the filters after the last record batch and their
+  /// locations in the footer. RecordBatchFileReader::MayContain tests them to
+  /// skip the record batches which cannot hold a value without reading them.
+  /// Readers ignore the filters otherwise. Nested fields cannot be filtered,
+  /// WriteRecordBatch then returning NotImplemented. Must be called before
+  /// the first record batch is written
+  ///
+  /// \param[in] field_names the fields to filter, none to disable filtering
+  /// \return Status, Invalid if record batches were already written or a
+  /// field does not exist
+  Status SetBloomFilters(const std::vector<std::string>& field_names);
+
+  Status SetCoalescing(int64_t max_rows, int64_t max_bytes = 0,
+                       double max_delay = -1) override;
+
+  Status Flush() override;
+
   /// \brief Close the file stream by writing the file footer and magic number
   /// \return Status
   Status Close() override;
@@ -187,6 +302,21 @@ Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         int max_recursion_depth = kMaxNestingDepth,
                         bool allow_64bit = false);
 
+/// \brief Low-level API for writing a record batch with compressed buffers
+///
+/// As the other overload, except that the buffers of at least
+/// min_compressed_size bytes are compressed, as described in
+/// format/Message.fbs
+///
+/// \param[in] compression the codec, UNCOMPRESSED not to compress
+/// \param[in] min_compressed_size buffers smaller than this are not compressed
+ARROW_EXPORT
+Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, MemoryPool* pool, int max_recursion_depth,
+                        bool allow_64bit, Compression::type compression,
+                        int64_t min_compressed_size);
+
 /// \brief Serialize record batch as encapsulated IPC message in a new buffer
 ///
 /// \param[in] batch the record batch
@@ -229,6 +359,43 @@ ARROW_EXPORT
 Status WriteRecordBatchStream(const std::vector<std::shared_ptr<RecordBatch>>& batches,
                               io::OutputStream* dst);
 
+/// \brief A message serialized in memory, for transports framing messages
+/// themselves rather than writing the stream format
+struct ARROW_EXPORT IpcPayload {
+  Message::Type type;
+  /// The message flatbuffer, without length prefix or padding
+  std::shared_ptr<Buffer> metadata;
+  /// The buffers of the body, each to be followed by padding to a multiple of
+  /// 8 bytes. May contain null buffers, which take no space
+  std::vector<std::shared_ptr<Buffer>> body_buffers;
+  /// The length of the body, padding included
+  int64_t body_length;
+};
+
+/// \brief Serialize a schema as the messages starting a stream: the schema
+/// and then a dictionary batch per dictionary
+///
+/// \param[in] schema the schema
+/// \param[in] pool a MemoryPool to allocate memory from
+/// \param[out] out the messages
+/// \return Status
+ARROW_EXPORT
+Status GetSchemaPayloads(const Schema& schema, MemoryPool* pool,
+                         std::vector<IpcPayload>* out);
+
+/// \brief Serialize a record batch as a message without copying its buffers
+///
+/// The body buffers are those of the arrays, sliced where needed, except for
+/// validity bitmaps at a non-zero bit offset which are copied
+///
+/// \param[in] batch the record batch
+/// \param[in] pool a MemoryPool to allocate memory from
+/// \param[out] out the message
+/// \return Status
+ARROW_EXPORT
+Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
+                             IpcPayload* out);
+
 /// \brief Compute the number of bytes needed to write a record batch including metadata
 ///
 /// \param[in] batch the record batch to write
@@ -269,6 +436,44 @@ ARROW_EXPORT
 Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadata_length,
                    int64_t* body_length);
 
+/// \brief EXPERIMENTAL: Write arrow::Tensor as a message keeping its strides
+///
+/// Rather than copying a non-contiguous tensor, such as a transposed one, in
+/// row-major order, the memory spanned by its strides is written as is and
+/// the strides are kept in the metadata. The body then includes the values
+/// skipped by the strides, if any. Tensors with negative strides are made
+/// contiguous first. The body can be compressed as a single buffer, which
+/// ReadTensor decompresses
+///
+/// \param[in] tensor the Tensor to write
+/// \param[in] dst the OutputStream to write to
+/// \param[in] compression the codec of the body, or UNCOMPRESSED
+/// \param[in] pool MemoryPool to allocate the compressed body from
+/// \param[out] metadata_length the actual metadata length
+/// \param[out] body_length the actual message body length
+/// \return Status
+ARROW_EXPORT
+Status WriteStridedTensor(const Tensor& tensor, io::OutputStream* dst,
+                          Compression::type compression, MemoryPool* pool,
+                          int32_t* metadata_length, int64_t* body_length);
+
+/// \brief EXPERIMENTAL: Write arrow::SparseTensor as a contiguous message
+///
+/// The body holds the buffers of the sparse index, made row-major if needed,
+/// then the non-zero values, each padded to an 8-byte boundary, so that
+/// ReadSparseTensor slices them without copying
+///
+/// \param[in] sparse_tensor the SparseTensor to write
+/// \param[in] dst the OutputStream to write to
+/// \param[out] metadata_length the actual metadata length
+/// \param[out] body_length the actual message body length
+/// \param[in] pool MemoryPool to allocate row-major copies of the indices
+/// \return Status
+ARROW_EXPORT
+Status WriteSparseTensor(const SparseTensor& sparse_tensor, io::OutputStream* dst,
+                         int32_t* metadata_length, int64_t* body_length,
+                         MemoryPool* pool);
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -0,0 +1,267 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+
+// The default pool is backed by jemalloc when built with ARROW_JEMALLOC, and
+// by posix_memalign otherwise. The other pools are shared by all the threads
+// of a benchmark and never destroyed, like the default one
+
+static MemoryPool* numa_pool() {
+  static NumaMemoryPool* pool = new NumaMemoryPool();
+  return pool;
+}
+
+static MemoryPool* recycling_pool() {
+  static RecyclingMemoryPool* pool = new RecyclingMemoryPool(default_memory_pool());
+  return pool;
+}
+
+static MemoryPool* child_pool() {
+  static ChildMemoryPool* pool = new ChildMemoryPool(default_memory_pool());
+  return pool;
+}
+
+// Allocate, touch and free buffers of a single size
+static void BenchAllocateSize(benchmark::State& state,  // NOLINT non-const reference
+                              MemoryPool* pool) {
+  const int64_t size = state.range(0);
+  while (state.KeepRunning()) {
+    uint8_t* buffer;
+    ABORT_NOT_OK(pool->Allocate(size, &buffer));
+    buffer[0] = 1;
+    benchmark::DoNotOptimize(buffer);
+    pool->Free(buffer, size);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_AllocateSizeDefault(benchmark::State& state) {  // NOLINT
+  BenchAllocateSize(state, default_memory_pool());
+}
+
+static void BM_AllocateSizeThreadCaching(benchmark::State& state) {  // NOLINT
+  BenchAllocateSize(state, thread_caching_memory_pool());
+}
+
+static void BM_AllocateSizeNuma(benchmark::State& state) {  // NOLINT
+  BenchAllocateSize(state, numa_pool());
+}
+
+static void BM_AllocateSizeRecycling(benchmark::State& state) {  // NOLINT
+  BenchAllocateSize(state, recycling_pool());
+}
+
+// Grow a buffer from 64 bytes by doubling its capacity, as BufferBuilder does,
+// writing the new half each time
+static void BenchReallocateGrowth(benchmark::State& state,  // NOLINT non-const reference
+                                  MemoryPool* pool) {
+  const int64_t final_size = state.range(0);
+  while (state.KeepRunning()) {
+    int64_t capacity = 64;
+    uint8_t* buffer;
+    ABORT_NOT_OK(pool->Allocate(capacity, &buffer));
+    std::memset(buffer, 1, capacity);
+    while (capacity < final_size) {
+      ABORT_NOT_OK(pool->Reallocate(capacity, 2 * capacity, &buffer));
+      std::memset(buffer + capacity, 1, capacity);
+      capacity *= 2;
+    }
+    pool->Free(buffer, capacity);
+  }
+  state.SetBytesProcessed(state.iterations() * final_size);
+}
+
+static void BM_ReallocateGrowthDefault(benchmark::State& state) {  // NOLINT
+  BenchReallocateGrowth(state, default_memory_pool());
+}
+
+static void BM_ReallocateGrowthThreadCaching(benchmark::State& state) {  // NOLINT
+  BenchReallocateGrowth(state, thread_caching_memory_pool());
+}
+
+static void BM_ReallocateGrowthNuma(benchmark::State& state) {  // NOLINT
+  BenchReallocateGrowth(state, numa_pool());
+}
+
+static void BM_ReallocateGrowthRecycling(benchmark::State& state) {  // NOLINT
+  BenchReallocateGrowth(state, recycling_pool());
+}
+
+// Allocate and free buffers of the sizes small builders go through, the way
+// concurrent builder threads do
+static void BenchAllocateFree(benchmark::State& state,  // NOLINT non-const reference
+                              MemoryPool* pool) {
+  const std::vector<int64_t> sizes = {64, 128, 256, 512, 1024, 4096, 16384};
+  std::vector<uint8_t*> buffers(sizes.size());
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      ABORT_NOT_OK(pool->Allocate(sizes[i], &buffers[i]));
+    }
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      pool->Free(buffers[i], sizes[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * sizes.size());
+}
+
+static void BM_AllocateFreeDefault(benchmark::State& state) {  // NOLINT
+  BenchAllocateFree(state, default_memory_pool());
+}
+
+static void BM_AllocateFreeThreadCaching(benchmark::State& state) {  // NOLINT
+  BenchAllocateFree(state, thread_caching_memory_pool());
+}
+
+static void BM_AllocateFreeNuma(benchmark::State& state) {  // NOLINT
+  BenchAllocateFree(state, numa_pool());
+}
+
+static void BM_AllocateFreeRecycling(benchmark::State& state) {  // NOLINT
+  BenchAllocateFree(state, recycling_pool());
+}
+
+static void BM_AllocateFreeChild(benchmark::State& state) {  // NOLINT
+  BenchAllocateFree(state, child_pool());
+}
+
+// Build dozens of short-lived arrays, as when decoding a request
+static void BenchBuildBatch(benchmark::State& state,  // NOLINT non-const reference
+                            MemoryPool* pool, ArenaMemoryPool* arena) {
+  const int kNumArrays = 50;
+  const int kArrayLength = 1000;
+  while (state.KeepRunning()) {
+    std::vector<std::shared_ptr<Array>> arrays(kNumArrays);
+    for (auto& array : arrays) {
+      Int64Builder builder(pool);
+      for (int64_t i = 0; i < kArrayLength; ++i) {
+        ABORT_NOT_OK(builder.Append(i));
+      }
+      ABORT_NOT_OK(builder.Finish(&array));
+    }
+    arrays.clear();
+    if (arena != nullptr) {
+      arena->Reset();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumArrays * kArrayLength);
+}
+
+static void BM_BuildBatchDefault(benchmark::State& state) {  // NOLINT
+  BenchBuildBatch(state, default_memory_pool(), nullptr);
+}
+
+static void BM_BuildBatchArena(benchmark::State& state) {  // NOLINT
+  ArenaMemoryPool arena;
+  BenchBuildBatch(state, &arena, &arena);
+}
+
+// Allocate, fill and free the buffers of a record batch of 1M rows and eight
+// int64 columns, as when reading the same schema batch after batch
+static void BenchBatchBuffers(benchmark::State& state,  // NOLINT non-const reference
+                              MemoryPool* pool) {
+  const int kNumBuffers = 8;
+  const int64_t kBufferSize = 8 << 20;
+  std::vector<uint8_t*> buffers(kNumBuffers);
+  while (state.KeepRunning()) {
+    for (auto& buffer : buffers) {
+      ABORT_NOT_OK(pool->Allocate(kBufferSize, &buffer));
+      std::memset(buffer, 1, kBufferSize);
+    }
+    for (auto& buffer : buffers) {
+      pool->Free(buffer, kBufferSize);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kNumBuffers * kBufferSize);
+}
+
+static void BM_BatchBuffersDefault(benchmark::State& state) {  // NOLINT
+  BenchBatchBuffers(state, default_memory_pool());
+}
+
+static void BM_BatchBuffersRecycling(benchmark::State& state) {  // NOLINT
+  RecyclingMemoryPool pool(default_memory_pool(), 128 << 20);
+  BenchBatchBuffers(state, &pool);
+}
+
+// Allocate a 64 MB zeroed bitmap, of which only the first bytes get written,
+// as when few rows of a large batch are null
+static void BM_ZeroedBitmapMemset(benchmark::State& state) {  // NOLINT
+  const int64_t kBitmapSize = 64 << 20;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Buffer> bitmap;
+    ABORT_NOT_OK(AllocateBuffer(default_memory_pool(), kBitmapSize, &bitmap));
+    std::memset(bitmap->mutable_data(), 0, kBitmapSize);
+    bitmap->mutable_data()[0] = 1;
+    benchmark::DoNotOptimize(bitmap->data());
+  }
+  state.SetBytesProcessed(state.iterations() * kBitmapSize);
+}
+
+static void BM_ZeroedBitmapAllocateZeroed(benchmark::State& state) {  // NOLINT
+  const int64_t kBitmapSize = 64 << 20;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Buffer> bitmap;
+    ABORT_NOT_OK(AllocateZeroedBuffer(default_memory_pool(), kBitmapSize, &bitmap));
+    bitmap->mutable_data()[0] = 1;
+    benchmark::DoNotOptimize(bitmap->data());
+  }
+  state.SetBytesProcessed(state.iterations() * kBitmapSize);
+}
+
+// From 64 bytes to 64 MB
+BENCHMARK(BM_AllocateSizeDefault)->RangeMultiplier(8)->Range(64, 64 << 20);
+BENCHMARK(BM_AllocateSizeThreadCaching)->RangeMultiplier(8)->Range(64, 64 << 20);
+BENCHMARK(BM_AllocateSizeNuma)->RangeMultiplier(8)->Range(64, 64 << 20);
+BENCHMARK(BM_AllocateSizeRecycling)->RangeMultiplier(8)->Range(64, 64 << 20);
+
+BENCHMARK(BM_ReallocateGrowthDefault)->RangeMultiplier(16)->Range(64 << 10, 16 << 20);
+BENCHMARK(BM_ReallocateGrowthThreadCaching)
+    ->RangeMultiplier(16)
+    ->Range(64 << 10, 16 << 20);
+BENCHMARK(BM_ReallocateGrowthNuma)->RangeMultiplier(16)->Range(64 << 10, 16 << 20);
+BENCHMARK(BM_ReallocateGrowthRecycling)->RangeMultiplier(16)->Range(64 << 10, 16 << 20);
+
+BENCHMARK(BM_AllocateFreeDefault)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_AllocateFreeThreadCaching)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_AllocateFreeNuma)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_AllocateFreeRecycling)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_AllocateFreeChild)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK(BM_BatchBuffersDefault)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BatchBuffersRecycling)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BuildBatchDefault)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBatchArena)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_ZeroedBitmapMemset)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ZeroedBitmapAllocateZeroed)->Unit(benchmark::kMicrosecond);
+
+}  // namespace arrow
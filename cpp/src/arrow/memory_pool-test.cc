@@ -16,6 +16,11 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -32,6 +37,8 @@ class TestDefaultMemoryPool : public ::arrow::test::TestMemoryPoolBase {
 
 TEST_F(TestDefaultMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
 
+TEST_F(TestDefaultMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
 TEST_F(TestDefaultMemoryPool, OOM) {
 #ifndef ADDRESS_SANITIZER
   this->TestOOM();
@@ -75,6 +82,456 @@ TEST(DefaultMemoryPoolDeathTest, MaxMemory) {
 
 #endif  // ARROW_VALGRIND
 
+class TestThreadCachingMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool pool_;
+};
+
+TEST_F(TestThreadCachingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestThreadCachingMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestThreadCachingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestThreadCachingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestThreadCachingMemoryPool, ReuseBlocks) {
+  uint8_t* data;
+  ASSERT_OK(pool_.Allocate(100, &data));
+  uint8_t* const first = data;
+  EXPECT_EQ(0, reinterpret_cast<uint64_t>(data) % 64);
+
+  // Growing within the size class keeps the block
+  data[99] = 42;
+  ASSERT_OK(pool_.Reallocate(100, 128, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_EQ(42, data[99]);
+  ASSERT_EQ(128, pool_.bytes_allocated());
+
+  // Freed blocks are reused by allocations of the same size class
+  pool_.Free(data, 128);
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(128, pool_.bytes_cached());
+  ASSERT_OK(pool_.Allocate(65, &data));
+  ASSERT_EQ(first, data);
+  ASSERT_EQ(0, pool_.bytes_cached());
+
+  // Growing past the size class moves the contents to a larger block
+  data[64] = 7;
+  ASSERT_OK(pool_.Reallocate(65, 1000, &data));
+  ASSERT_EQ(7, data[64]);
+  ASSERT_EQ(128, pool_.bytes_cached());
+
+  // Large blocks are not cached
+  uint8_t* large;
+  ASSERT_OK(pool_.Allocate(1 << 20, &large));
+  pool_.Free(large, 1 << 20);
+  pool_.Free(data, 1000);
+  ASSERT_EQ(128 + 1024, pool_.bytes_cached());
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ((1 << 20) + 1000, pool_.max_memory());
+
+  pool_.ReleaseUnused();
+  ASSERT_EQ(0, pool_.bytes_cached());
+}
+
+TEST_F(TestThreadCachingMemoryPool, ConcurrentThreads) {
+  const int kNumThreads = 8;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([this, t]() {
+      std::vector<std::pair<uint8_t*, int64_t>> blocks;
+      for (int i = 0; i < 2000; ++i) {
+        const int64_t size = 1 + (i * 7919 + t * 104729) % 50000;
+        uint8_t* data;
+        ASSERT_OK(pool_.Allocate(size, &data));
+        data[0] = static_cast<uint8_t>(t);
+        data[size - 1] = static_cast<uint8_t>(t);
+        blocks.emplace_back(data, size);
+        if (i % 3 == 2) {
+          // Free some blocks before allocating more
+          for (int j = 0; j < 2; ++j) {
+            ASSERT_EQ(t, blocks.back().first[0]);
+            ASSERT_EQ(t, blocks.back().first[blocks.back().second - 1]);
+            pool_.Free(blocks.back().first, blocks.back().second);
+            blocks.pop_back();
+          }
+        }
+      }
+      for (const auto& block : blocks) {
+        pool_.Free(block.first, block.second);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_GT(pool_.max_memory(), 0);
+}
+
+class TestChildMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestChildMemoryPool() : pool_(&parent_) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool parent_;
+  ChildMemoryPool pool_;
+};
+
+TEST_F(TestChildMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestChildMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestChildMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+  ASSERT_EQ(0, pool_.bytes_allocated());
+}
+
+TEST_F(TestChildMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestChildMemoryPool, NestedLimits) {
+  ChildMemoryPool query(&pool_, 1000);
+  ChildMemoryPool first(&query);
+  ChildMemoryPool second(&query, 300);
+
+  uint8_t* a;
+  uint8_t* b;
+  uint8_t* c;
+  ASSERT_OK(first.Allocate(600, &a));
+  ASSERT_OK(second.Allocate(200, &b));
+
+  // Over the limit of the child, then over the one of the parent
+  ASSERT_RAISES(OutOfMemory, second.Reallocate(200, 400, &b));
+  ASSERT_RAISES(OutOfMemory, first.Allocate(250, &c));
+  ASSERT_EQ(600, first.bytes_allocated());
+  ASSERT_EQ(200, second.bytes_allocated());
+  ASSERT_EQ(800, query.bytes_allocated());
+  ASSERT_EQ(800, pool_.bytes_allocated());
+
+  // Freed memory can be allocated again
+  ASSERT_OK(second.Reallocate(200, 100, &b));
+  ASSERT_OK(first.Allocate(250, &c));
+  ASSERT_EQ(950, query.bytes_allocated());
+
+  first.Free(a, 600);
+  first.Free(c, 250);
+  second.Free(b, 100);
+  ASSERT_EQ(0, query.bytes_allocated());
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(850, first.max_memory());
+  ASSERT_EQ(200, second.max_memory());
+  ASSERT_EQ(950, query.max_memory());
+  ASSERT_EQ(1000, query.limit());
+  ASSERT_EQ(-1, first.limit());
+
+  // Failed allocations are not counted
+  ASSERT_EQ(2, first.num_allocations());
+  ASSERT_EQ(1, second.num_allocations());
+  ASSERT_EQ(3, query.num_allocations());
+}
+
+class TestNumaMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  // A threshold small enough for the base tests to cover mapped allocations
+  TestNumaMemoryPool() : pool_(-1, 16) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  NumaMemoryPool pool_;
+};
+
+TEST_F(TestNumaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestNumaMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestNumaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestNumaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestNumaMemoryPool, LargeAllocations) {
+  const int64_t size = 3 << 20;
+  uint8_t* data;
+  ASSERT_OK(pool_.Allocate(size, &data));
+#ifdef __linux__
+  ASSERT_EQ(0, reinterpret_cast<uint64_t>(data) % (1 << 21));
+#endif
+  data[0] = 1;
+  data[size - 1] = 2;
+  ASSERT_GE(GetNumaNode(data), -1);
+
+  // Growing within the mapping, then past it
+  ASSERT_OK(pool_.Reallocate(size, 4 << 20, &data));
+  ASSERT_OK(pool_.Reallocate(4 << 20, 5 << 20, &data));
+  ASSERT_EQ(1, data[0]);
+  ASSERT_EQ(2, data[size - 1]);
+  ASSERT_EQ(5 << 20, pool_.bytes_allocated());
+  pool_.Free(data, 5 << 20);
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  // The contents are copied to a new mapping
+  ASSERT_EQ((4 << 20) + (5 << 20), pool_.max_memory());
+}
+
+TEST(NumaMemoryPool, BindToNode) {
+  NumaMemoryPool pool(0);
+  ASSERT_EQ(0, pool.numa_node());
+  const int64_t size = 4 << 20;
+  uint8_t* data;
+  Status status = pool.Allocate(size, &data);
+  if (!status.ok()) {
+    // No NUMA support, e.g. in a container
+    ASSERT_TRUE(status.IsIOError());
+    return;
+  }
+  std::memset(data, 1, size);
+#ifdef __linux__
+  ASSERT_EQ(0, GetNumaNode(data));
+  ASSERT_EQ(0, GetNumaNode(data + size - 1));
+#endif
+  pool.Free(data, size);
+}
+
+class TestRecyclingMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestRecyclingMemoryPool() : pool_(&parent_, 1000) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool parent_;
+  RecyclingMemoryPool pool_;
+};
+
+TEST_F(TestRecyclingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestRecyclingMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestRecyclingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestRecyclingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestRecyclingMemoryPool, ReuseSameSizes) {
+  uint8_t* a;
+  uint8_t* b;
+  uint8_t* c;
+  ASSERT_OK(pool_.Allocate(400, &a));
+  ASSERT_OK(pool_.Allocate(400, &b));
+  ASSERT_OK(pool_.Allocate(300, &c));
+  pool_.Free(a, 400);
+  pool_.Free(b, 400);
+  pool_.Free(c, 300);
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(1100 - 400, pool_.bytes_retained());
+  // The least recently freed buffer went back to the parent
+  ASSERT_EQ(700, parent_.bytes_allocated());
+
+  // Only buffers of the exact size are reused, the most recently freed first
+  uint8_t* reused;
+  ASSERT_OK(pool_.Allocate(400, &reused));
+  ASSERT_EQ(b, reused);
+  uint8_t* fresh;
+  ASSERT_OK(pool_.Allocate(400, &fresh));
+  ASSERT_EQ(300, pool_.bytes_retained());
+
+  // Reallocating to a retained size moves to the retained buffer
+  reused[0] = 9;
+  ASSERT_OK(pool_.Reallocate(400, 300, &reused));
+  ASSERT_EQ(c, reused);
+  ASSERT_EQ(9, reused[0]);
+  ASSERT_EQ(400, pool_.bytes_retained());
+  ASSERT_EQ(700, pool_.bytes_allocated());
+  ASSERT_EQ(1100, pool_.max_memory());
+
+  pool_.Free(reused, 300);
+  pool_.Free(fresh, 400);
+  pool_.ReleaseUnused();
+  ASSERT_EQ(0, pool_.bytes_retained());
+  ASSERT_EQ(0, parent_.bytes_allocated());
+}
+
+class TestArenaMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestArenaMemoryPool() : pool_(&parent_, 4096) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool parent_;
+  ArenaMemoryPool pool_;
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestArenaMemoryPool, BumpAllocation) {
+  uint8_t* first;
+  uint8_t* second;
+  ASSERT_OK(pool_.Allocate(10, &first));
+  ASSERT_OK(pool_.Allocate(100, &second));
+  ASSERT_EQ(first + 64, second);
+  ASSERT_EQ(4096, pool_.bytes_reserved());
+  ASSERT_EQ(4096, parent_.bytes_allocated());
+
+  // The most recent allocation grows in place while the chunk has room
+  second[99] = 5;
+  ASSERT_OK(pool_.Reallocate(100, 1000, &second));
+  ASSERT_EQ(first + 64, second);
+  ASSERT_OK(pool_.Reallocate(1000, 4050, &second));
+  ASSERT_NE(first + 64, second);
+  ASSERT_EQ(5, second[99]);
+  ASSERT_EQ(8192, pool_.bytes_reserved());
+
+  // Other allocations are copied when they outgrow their slot
+  first[9] = 3;
+  ASSERT_OK(pool_.Reallocate(10, 64, &first));
+  ASSERT_OK(pool_.Reallocate(64, 65, &first));
+  ASSERT_EQ(3, first[9]);
+  ASSERT_EQ(0, reinterpret_cast<uint64_t>(first) % 64);
+  ASSERT_EQ(12288, pool_.bytes_reserved());
+
+  // Freeing the most recent allocation gives its space back
+  uint8_t* third;
+  ASSERT_OK(pool_.Allocate(64, &third));
+  pool_.Free(third, 64);
+  uint8_t* fourth;
+  ASSERT_OK(pool_.Allocate(64, &fourth));
+  ASSERT_EQ(third, fourth);
+
+  // Oversized allocations get their own chunk
+  uint8_t* large;
+  ASSERT_OK(pool_.Allocate(10000, &large));
+  ASSERT_EQ(12288 + 10048, pool_.bytes_reserved());
+  uint8_t* fifth;
+  ASSERT_OK(pool_.Allocate(64, &fifth));
+  ASSERT_EQ(fourth + 64, fifth);
+
+  pool_.Free(first, 65);
+  pool_.Free(second, 4050);
+  pool_.Free(fourth, 64);
+  pool_.Free(large, 10000);
+  pool_.Free(fifth, 64);
+  ASSERT_EQ(0, pool_.bytes_allocated());
+  ASSERT_EQ(65 + 4050 + 64 + 10000 + 64, pool_.max_memory());
+
+  // Reset keeps one chunk for the next allocations
+  pool_.Reset();
+  ASSERT_EQ(4096, pool_.bytes_reserved());
+  ASSERT_EQ(4096, parent_.bytes_allocated());
+  uint8_t* after_reset;
+  ASSERT_OK(pool_.Allocate(64, &after_reset));
+  pool_.Free(after_reset, 64);
+}
+
+ProfilingMemoryPoolOptions ProfileEverything() {
+  ProfilingMemoryPoolOptions options;
+  options.stack_sample_interval = 1;
+  options.timeline_interval_ns = 0;
+  options.max_timeline_samples = 3;
+  return options;
+}
+
+class TestProfilingMemoryPool : public ::arrow::test::TestMemoryPoolBase {
+ public:
+  TestProfilingMemoryPool() : pool_(&parent_, ProfileEverything()) {}
+
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ThreadCachingMemoryPool parent_;
+  ProfilingMemoryPool pool_;
+};
+
+TEST_F(TestProfilingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestProfilingMemoryPool, AllocateZeroed) { this->TestAllocateZeroed(); }
+
+TEST_F(TestProfilingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestProfilingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestProfilingMemoryPool, Profile) {
+  uint8_t* a;
+  uint8_t* b;
+  uint8_t* c;
+  ASSERT_OK(pool_.Allocate(0, &a));
+  ASSERT_OK(pool_.Allocate(100, &b));
+  ASSERT_OK(pool_.Allocate(128, &c));
+  ASSERT_OK(pool_.Reallocate(128, 1000, &c));
+  pool_.Free(a, 0);
+  pool_.Free(b, 100);
+  pool_.Free(c, 1000);
+
+  MemoryPoolProfile profile = pool_.GetProfile();
+  ASSERT_EQ(3, profile.num_allocations);
+  ASSERT_EQ(1, profile.num_reallocations);
+  ASSERT_EQ(3, profile.num_frees);
+  ASSERT_EQ(0, profile.bytes_allocated);
+  ASSERT_EQ(1100, profile.max_memory);
+  ASSERT_EQ(1100, pool_.max_memory());
+
+  // 0 in bucket 0, 100 in [64, 128) and 128 in [128, 256)
+  ASSERT_EQ(1, profile.allocation_sizes[0]);
+  ASSERT_EQ(1, profile.allocation_sizes[7]);
+  ASSERT_EQ(1, profile.allocation_sizes[8]);
+  ASSERT_EQ(3, std::accumulate(profile.allocation_sizes.begin(),
+                               profile.allocation_sizes.end(), int64_t(0)));
+  // 1000 in [512, 1024)
+  ASSERT_EQ(1, profile.reallocation_sizes[10]);
+
+  // Only the three latest of the seven samples are kept
+  ASSERT_EQ(3, profile.live_bytes.size());
+  ASSERT_EQ(1100, profile.live_bytes[0].second);
+  ASSERT_EQ(1000, profile.live_bytes[1].second);
+  ASSERT_EQ(0, profile.live_bytes[2].second);
+  ASSERT_LE(profile.live_bytes[0].first, profile.live_bytes[2].first);
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+  ASSERT_FALSE(profile.stacks.empty());
+  int64_t num_sampled = 0;
+  for (size_t i = 0; i < profile.stacks.size(); ++i) {
+    ASSERT_FALSE(profile.stacks[i].frames.empty());
+    if (i > 0) {
+      ASSERT_GE(profile.stacks[i - 1].bytes, profile.stacks[i].bytes);
+    }
+    num_sampled += profile.stacks[i].num_allocations;
+  }
+  ASSERT_EQ(3, num_sampled);
+#endif
+}
+
 TEST(LoggingMemoryPool, Logging) {
   MemoryPool* pool = default_memory_pool();
 
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #include <gtest/gtest.h>
@@ -44,6 +45,25 @@ class TestMemoryPoolBase : public ::testing::Test {
     ASSERT_EQ(0, pool->bytes_allocated());
   }
 
+  void TestAllocateZeroed() {
+    auto pool = memory_pool();
+
+    // Likely to reuse the dirtied memory
+    uint8_t* data;
+    ASSERT_OK(pool->Allocate(100, &data));
+    std::memset(data, 0xFF, 100);
+    pool->Free(data, 100);
+
+    ASSERT_OK(pool->AllocateZeroed(100, &data));
+    EXPECT_EQ(static_cast<uint64_t>(0), reinterpret_cast<uint64_t>(data) % 64);
+    ASSERT_EQ(100, pool->bytes_allocated());
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_EQ(0, data[i]);
+    }
+    pool->Free(data, 100);
+    ASSERT_EQ(0, pool->bytes_allocated());
+  }
+
   void TestOOM() {
     auto pool = memory_pool();
 
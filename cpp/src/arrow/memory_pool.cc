@@ -18,14 +18,37 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>
+#include <array>
 #include <cerrno>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <limits>
+#include <list>
+#include <map>
 #include <mutex>
 #include <sstream>  // IWYU pragma: keep
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define ARROW_HAVE_BACKTRACE
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 
 #ifdef ARROW_JEMALLOC
@@ -78,6 +101,24 @@ Status AllocateAligned(int64_t size, uint8_t** out) {
 #endif
   return Status::OK();
 }
+
+void FreeAligned(uint8_t* buffer) {
+#ifdef _MSC_VER
+  _aligned_free(buffer);
+#elif defined(ARROW_JEMALLOC)
+  dallocx(buffer, MALLOCX_ALIGN(kAlignment));
+#else
+  std::free(buffer);
+#endif
+}
+
+// Raise the peak memory to allocated if lower, without locking
+void UpdateMaxMemory(std::atomic<int64_t>* max_memory, int64_t allocated) {
+  int64_t max = max_memory->load();
+  while (allocated > max && !max_memory->compare_exchange_weak(max, allocated)) {
+  }
+}
+
 }  // namespace
 
 MemoryPool::MemoryPool() {}
@@ -86,6 +127,37 @@ MemoryPool::~MemoryPool() {}
 
 int64_t MemoryPool::max_memory() const { return -1; }
 
+Status MemoryPool::AllocateZeroed(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Allocate(size, out));
+  std::memset(*out, 0, static_cast<size_t>(size));
+  return Status::OK();
+}
+
+namespace {
+
+#if defined(__linux__) && !defined(ARROW_JEMALLOC)
+#define ARROW_MAP_LARGE_ALLOCATIONS
+
+// Allocations from this size are mapped from the system directly, as glibc
+// does anyway above its largest dynamic threshold, so that zeroed ones need
+// no clearing
+constexpr int64_t kMinMappedSize = 32 << 20;
+
+Status MapPages(int64_t size, uint8_t** out) {
+  void* mapped = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED) {
+    std::stringstream ss;
+    ss << "mmap of size " << size << " failed: " << std::strerror(errno);
+    return Status::OutOfMemory(ss.str());
+  }
+  *out = reinterpret_cast<uint8_t*>(mapped);
+  return Status::OK();
+}
+#endif
+
+}  // namespace
+
 class DefaultMemoryPool : public MemoryPool {
  public:
   DefaultMemoryPool() : bytes_allocated_(0) { max_memory_ = 0; }
@@ -93,15 +165,33 @@ class DefaultMemoryPool : public MemoryPool {
   ~DefaultMemoryPool() override {}
 
   Status Allocate(int64_t size, uint8_t** out) override {
-    RETURN_NOT_OK(AllocateAligned(size, out));
-    bytes_allocated_ += size;
+    RETURN_NOT_OK(AllocateChunk(size, out));
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
+    return Status::OK();
+  }
 
-    {
-      std::lock_guard<std::mutex> guard(lock_);
-      if (bytes_allocated_ > max_memory_) {
-        max_memory_ = bytes_allocated_.load();
-      }
+  Status AllocateZeroed(int64_t size, uint8_t** out) override {
+#if defined(ARROW_JEMALLOC)
+    // jemalloc skips clearing the pages it has not handed out yet
+    *out = reinterpret_cast<uint8_t*>(
+        mallocx(std::max(static_cast<size_t>(size), kAlignment),
+                MALLOCX_ALIGN(kAlignment) | MALLOCX_ZERO));
+    if (*out == NULL) {
+      std::stringstream ss;
+      ss << "malloc of size " << size << " failed";
+      return Status::OutOfMemory(ss.str());
     }
+#else
+    RETURN_NOT_OK(AllocateChunk(size, out));
+#ifdef ARROW_MAP_LARGE_ALLOCATIONS
+    if (size < kMinMappedSize) {
+      std::memset(*out, 0, static_cast<size_t>(size));
+    }
+#else
+    std::memset(*out, 0, static_cast<size_t>(size));
+#endif
+#endif  // defined(ARROW_JEMALLOC)
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
     return Status::OK();
   }
 
@@ -116,58 +206,1084 @@ class DefaultMemoryPool : public MemoryPool {
       return Status::OutOfMemory(ss.str());
     }
 #else
+#ifdef ARROW_MAP_LARGE_ALLOCATIONS
+    if (old_size >= kMinMappedSize && new_size >= kMinMappedSize) {
+      // Moves the pages rather than copying them
+      void* remapped = mremap(*ptr, static_cast<size_t>(old_size),
+                              static_cast<size_t>(new_size), MREMAP_MAYMOVE);
+      if (remapped == MAP_FAILED) {
+        std::stringstream ss;
+        ss << "mremap of size " << new_size << " failed: " << std::strerror(errno);
+        return Status::OutOfMemory(ss.str());
+      }
+      *ptr = reinterpret_cast<uint8_t*>(remapped);
+      UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+      return Status::OK();
+    }
+#endif
     // Note: We cannot use realloc() here as it doesn't guarantee alignment.
 
     // Allocate new chunk
     uint8_t* out = nullptr;
-    RETURN_NOT_OK(AllocateAligned(new_size, &out));
+    RETURN_NOT_OK(AllocateChunk(new_size, &out));
     DCHECK(out);
     // Copy contents and release old memory chunk
     memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
-#ifdef _MSC_VER
-    _aligned_free(*ptr);
-#else
-    std::free(*ptr);
-#endif  // defined(_MSC_VER)
+    FreeChunk(*ptr, old_size);
     *ptr = out;
 #endif  // defined(ARROW_JEMALLOC)
 
-    bytes_allocated_ += new_size - old_size;
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+    return Status::OK();
+  }
+
+  int64_t bytes_allocated() const override { return bytes_allocated_.load(); }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    DCHECK_GE(bytes_allocated_, size);
+    FreeChunk(buffer, size);
+    bytes_allocated_ -= size;
+  }
+
+  int64_t max_memory() const override { return max_memory_.load(); }
+
+ private:
+  static Status AllocateChunk(int64_t size, uint8_t** out) {
+#ifdef ARROW_MAP_LARGE_ALLOCATIONS
+    if (size >= kMinMappedSize) {
+      return MapPages(size, out);
+    }
+#endif
+    return AllocateAligned(size, out);
+  }
+
+  static void FreeChunk(uint8_t* buffer, int64_t size) {
+#ifdef ARROW_MAP_LARGE_ALLOCATIONS
+    if (size >= kMinMappedSize) {
+      munmap(buffer, static_cast<size_t>(size));
+      return;
+    }
+#endif
+    FreeAligned(buffer);
+  }
+
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+};
+
+// ----------------------------------------------------------------------
+// ThreadCachingMemoryPool
+
+namespace {
+
+// Blocks are cached in power-of-two size classes from kMinBlockSize to
+// kMaxCachedBlockSize bytes. Larger allocations bypass the caches
+constexpr int64_t kMinBlockSize = 64;
+constexpr int64_t kMaxCachedBlockSize = 32 * 1024;
+constexpr int kNumSizeClasses = 10;
+
+// Bytes of free blocks an arena keeps before returning them to the system
+constexpr int64_t kMaxCachedBytesPerArena = 1 << 20;
+
+int SizeClass(int64_t size) {
+  if (size <= kMinBlockSize) {
+    return 0;
+  }
+  // ceil(log2(size)) - log2(kMinBlockSize)
+  const int64_t bits = 32 - BitUtil::CountLeadingZeros(static_cast<uint32_t>(size - 1));
+  return static_cast<int>(bits - 6);
+}
+
+int64_t SizeClassBytes(int size_class) { return kMinBlockSize << size_class; }
+
+// Free blocks are linked through their first bytes
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+}  // namespace
+
+class ThreadCachingMemoryPool::Impl {
+ public:
+  explicit Impl(int num_arenas)
+      : arenas_(num_arenas > 0 ? num_arenas : DefaultNumArenas()),
+        bytes_allocated_(0),
+        max_memory_(0) {}
+
+  ~Impl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size > kMaxCachedBlockSize) {
+      RETURN_NOT_OK(AllocateAligned(size, out));
+    } else {
+      const int size_class = SizeClass(size);
+      Arena& arena = GetArena();
+      {
+        std::lock_guard<std::mutex> guard(arena.mutex);
+        FreeBlock* block = arena.free_blocks[size_class];
+        if (block != nullptr) {
+          arena.free_blocks[size_class] = block->next;
+          arena.cached_bytes -= SizeClassBytes(size_class);
+        }
+        *out = reinterpret_cast<uint8_t*>(block);
+      }
+      if (*out == nullptr) {
+        RETURN_NOT_OK(AllocateAligned(SizeClassBytes(size_class), out));
+      }
+    }
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (old_size <= kMaxCachedBlockSize && new_size <= kMaxCachedBlockSize &&
+        SizeClass(old_size) == SizeClass(new_size)) {
+      // The block is large enough already
+      UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* out = nullptr;
+    RETURN_NOT_OK(Allocate(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+    Free(*ptr, old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    DCHECK_GE(bytes_allocated_, size);
+    bytes_allocated_ -= size;
+    if (buffer == nullptr) {
+      return;
+    }
+    if (size > kMaxCachedBlockSize) {
+      FreeAligned(buffer);
+      return;
+    }
+    const int size_class = SizeClass(size);
+    Arena& arena = GetArena();
     {
-      std::lock_guard<std::mutex> guard(lock_);
-      if (bytes_allocated_ > max_memory_) {
-        max_memory_ = bytes_allocated_.load();
+      std::lock_guard<std::mutex> guard(arena.mutex);
+      if (arena.cached_bytes + SizeClassBytes(size_class) <= kMaxCachedBytesPerArena) {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(buffer);
+        block->next = arena.free_blocks[size_class];
+        arena.free_blocks[size_class] = block;
+        arena.cached_bytes += SizeClassBytes(size_class);
+        return;
+      }
+    }
+    FreeAligned(buffer);
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  int64_t bytes_cached() const {
+    int64_t total = 0;
+    for (const Arena& arena : arenas_) {
+      std::lock_guard<std::mutex> guard(arena.mutex);
+      total += arena.cached_bytes;
+    }
+    return total;
+  }
+
+  void ReleaseUnused() {
+    for (Arena& arena : arenas_) {
+      FreeBlock* lists[kNumSizeClasses];
+      {
+        std::lock_guard<std::mutex> guard(arena.mutex);
+        std::copy(arena.free_blocks, arena.free_blocks + kNumSizeClasses, lists);
+        std::fill(arena.free_blocks, arena.free_blocks + kNumSizeClasses, nullptr);
+        arena.cached_bytes = 0;
+      }
+      for (FreeBlock* block : lists) {
+        while (block != nullptr) {
+          FreeBlock* next = block->next;
+          FreeAligned(reinterpret_cast<uint8_t*>(block));
+          block = next;
+        }
       }
     }
+  }
+
+ private:
+  struct Arena {
+    Arena() : cached_bytes(0) {
+      std::fill(free_blocks, free_blocks + kNumSizeClasses, nullptr);
+    }
+
+    mutable std::mutex mutex;
+    FreeBlock* free_blocks[kNumSizeClasses];
+    int64_t cached_bytes;
+  };
+
+  static int DefaultNumArenas() {
+    return 2 * std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+
+  // Threads are assigned arenas round-robin the first time they use a pool
+  Arena& GetArena() {
+    static std::atomic<int> next_thread_index(0);
+    static thread_local int thread_index = next_thread_index++;
+    return arenas_[thread_index % arenas_.size()];
+  }
+
+  std::vector<Arena> arenas_;
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+};
+
+ThreadCachingMemoryPool::ThreadCachingMemoryPool(int num_arenas)
+    : impl_(new Impl(num_arenas)) {}
+
+ThreadCachingMemoryPool::~ThreadCachingMemoryPool() {}
+
+Status ThreadCachingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ThreadCachingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                           uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ThreadCachingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t ThreadCachingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t ThreadCachingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ThreadCachingMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+void ThreadCachingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+// ----------------------------------------------------------------------
+// ProfilingMemoryPool
+
+namespace {
+
+constexpr int kNumSizeBuckets = 64;
+
+int SizeBucket(int64_t size) {
+  int bucket = 0;
+  while (size > 0 && bucket < kNumSizeBuckets - 1) {
+    size >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+typedef std::array<std::atomic<int64_t>, kNumSizeBuckets> SizeHistogram;
+
+std::vector<int64_t> LoadHistogram(const SizeHistogram& histogram) {
+  std::vector<int64_t> counts;
+  for (const auto& count : histogram) {
+    counts.push_back(count.load());
+  }
+  return counts;
+}
+
+}  // namespace
+
+class ProfilingMemoryPool::Impl {
+ public:
+  Impl(MemoryPool* pool, const ProfilingMemoryPoolOptions& options)
+      : pool_(pool),
+        options_(options),
+        start_time_(std::chrono::steady_clock::now()),
+        num_allocations_(0),
+        num_reallocations_(0),
+        num_frees_(0),
+        bytes_allocated_(0),
+        max_memory_(0),
+        last_sample_ns_(-options.timeline_interval_ns) {
+    for (auto& count : allocation_sizes_) {
+      count = 0;
+    }
+    for (auto& count : reallocation_sizes_) {
+      count = 0;
+    }
+  }
 
+  Status Allocate(int64_t size, bool zeroed, uint8_t** out) {
+    RETURN_NOT_OK(zeroed ? pool_->AllocateZeroed(size, out) : pool_->Allocate(size, out));
+    const int64_t allocation = num_allocations_++;
+    ++allocation_sizes_[SizeBucket(size)];
+    if (options_.stack_sample_interval > 0 &&
+        allocation % options_.stack_sample_interval == 0) {
+      SampleStack(size);
+    }
+    DidChange(size);
     return Status::OK();
   }
 
-  int64_t bytes_allocated() const override { return bytes_allocated_.load(); }
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    ++num_reallocations_;
+    ++reallocation_sizes_[SizeBucket(new_size)];
+    DidChange(new_size - old_size);
+    return Status::OK();
+  }
 
-  void Free(uint8_t* buffer, int64_t size) override {
-    DCHECK_GE(bytes_allocated_, size);
-#ifdef _MSC_VER
-    _aligned_free(buffer);
-#elif defined(ARROW_JEMALLOC)
-    dallocx(buffer, MALLOCX_ALIGN(kAlignment));
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    ++num_frees_;
+    DidChange(-size);
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  MemoryPoolProfile GetProfile() const {
+    MemoryPoolProfile profile;
+    profile.num_allocations = num_allocations_.load();
+    profile.num_reallocations = num_reallocations_.load();
+    profile.num_frees = num_frees_.load();
+    profile.bytes_allocated = bytes_allocated_.load();
+    profile.max_memory = max_memory_.load();
+    profile.allocation_sizes = LoadHistogram(allocation_sizes_);
+    profile.reallocation_sizes = LoadHistogram(reallocation_sizes_);
+
+    std::map<std::vector<void*>, StackStats> stacks;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      profile.live_bytes.assign(live_bytes_.begin(), live_bytes_.end());
+      stacks = stacks_;
+    }
+    for (const auto& stack : stacks) {
+      AllocationStackSample sample;
+      sample.frames = Symbolize(stack.first);
+      sample.num_allocations = stack.second.num_allocations;
+      sample.bytes = stack.second.bytes;
+      profile.stacks.push_back(std::move(sample));
+    }
+    std::sort(profile.stacks.begin(), profile.stacks.end(),
+              [](const AllocationStackSample& left, const AllocationStackSample& right) {
+                return left.bytes > right.bytes;
+              });
+    return profile;
+  }
+
+ private:
+  struct StackStats {
+    int64_t num_allocations;
+    int64_t bytes;
+  };
+
+  // Update the live bytes, and sample them if the last sample is old enough
+  void DidChange(int64_t delta) {
+    const int64_t allocated = bytes_allocated_ += delta;
+    UpdateMaxMemory(&max_memory_, allocated);
+    const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - start_time_)
+                               .count();
+    int64_t last_ns = last_sample_ns_.load();
+    if (now_ns - last_ns < options_.timeline_interval_ns ||
+        !last_sample_ns_.compare_exchange_strong(last_ns, now_ns)) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    live_bytes_.emplace_back(now_ns, allocated);
+    if (static_cast<int64_t>(live_bytes_.size()) > options_.max_timeline_samples) {
+      live_bytes_.pop_front();
+    }
+  }
+
+  void SampleStack(int64_t size) {
+#ifdef ARROW_HAVE_BACKTRACE
+    // One more frame for this function, which is left out
+    std::vector<void*> frames(options_.max_stack_depth + 1);
+    const int depth = backtrace(frames.data(), static_cast<int>(frames.size()));
+    if (depth <= 1) {
+      return;
+    }
+    std::vector<void*> stack(frames.begin() + 1, frames.begin() + depth);
+    std::lock_guard<std::mutex> guard(mutex_);
+    StackStats& stats = stacks_[stack];
+    ++stats.num_allocations;
+    stats.bytes += size;
+#endif
+  }
+
+  static std::vector<std::string> Symbolize(const std::vector<void*>& stack) {
+    std::vector<std::string> frames;
+#ifdef ARROW_HAVE_BACKTRACE
+    char** symbols = backtrace_symbols(const_cast<void* const*>(stack.data()),
+                                       static_cast<int>(stack.size()));
+    if (symbols == nullptr) {
+      return frames;
+    }
+    frames.assign(symbols, symbols + stack.size());
+    std::free(symbols);
+#endif
+    return frames;
+  }
+
+  MemoryPool* pool_;
+  const ProfilingMemoryPoolOptions options_;
+  const std::chrono::steady_clock::time_point start_time_;
+
+  std::atomic<int64_t> num_allocations_;
+  std::atomic<int64_t> num_reallocations_;
+  std::atomic<int64_t> num_frees_;
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+  SizeHistogram allocation_sizes_;
+  SizeHistogram reallocation_sizes_;
+  std::atomic<int64_t> last_sample_ns_;
+
+  mutable std::mutex mutex_;
+  std::deque<std::pair<int64_t, int64_t>> live_bytes_;
+  std::map<std::vector<void*>, StackStats> stacks_;
+};
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool,
+                                         const ProfilingMemoryPoolOptions& options)
+    : impl_(new Impl(pool, options)) {}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, false, out);
+}
+
+Status ProfilingMemoryPool::AllocateZeroed(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, true, out);
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t ProfilingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ProfilingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+MemoryPoolProfile ProfilingMemoryPool::GetProfile() const { return impl_->GetProfile(); }
+
+// ----------------------------------------------------------------------
+// ChildMemoryPool
+
+ChildMemoryPool::ChildMemoryPool(MemoryPool* parent, int64_t limit)
+    : parent_(parent),
+      limit_(limit),
+      bytes_allocated_(0),
+      max_memory_(0),
+      num_allocations_(0) {}
+
+ChildMemoryPool::~ChildMemoryPool() {}
+
+Status ChildMemoryPool::Reserve(int64_t size) {
+  const int64_t allocated = bytes_allocated_ += size;
+  if (limit_ >= 0 && size > 0 && allocated > limit_) {
+    bytes_allocated_ -= size;
+    std::stringstream ss;
+    ss << "Allocation of " << size << " bytes exceeds the memory limit of " << limit_
+       << " bytes (" << allocated - size << " bytes already allocated)";
+    return Status::OutOfMemory(ss.str());
+  }
+  UpdateMaxMemory(&max_memory_, allocated);
+  return Status::OK();
+}
+
+Status ChildMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status status = parent_->Allocate(size, out);
+  if (status.ok()) {
+    ++num_allocations_;
+  } else {
+    bytes_allocated_ -= size;
+  }
+  return status;
+}
+
+Status ChildMemoryPool::AllocateZeroed(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status status = parent_->AllocateZeroed(size, out);
+  if (status.ok()) {
+    ++num_allocations_;
+  } else {
+    bytes_allocated_ -= size;
+  }
+  return status;
+}
+
+Status ChildMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  RETURN_NOT_OK(Reserve(new_size - old_size));
+  Status status = parent_->Reallocate(old_size, new_size, ptr);
+  if (!status.ok()) {
+    bytes_allocated_ -= new_size - old_size;
+  }
+  return status;
+}
+
+void ChildMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  DCHECK_GE(bytes_allocated_, size);
+  parent_->Free(buffer, size);
+  bytes_allocated_ -= size;
+}
+
+int64_t ChildMemoryPool::bytes_allocated() const { return bytes_allocated_.load(); }
+
+int64_t ChildMemoryPool::max_memory() const { return max_memory_.load(); }
+
+// ----------------------------------------------------------------------
+// NumaMemoryPool
+
+namespace {
+
+#ifdef __linux__
+
+constexpr int64_t kHugePageSize = 1 << 21;
+
+// From linux/mempolicy.h, called through syscall() so that libnuma is not
+// needed
+constexpr int kMemPolicyBind = 2;
+constexpr int kMemPolicyFlagNode = 1;
+constexpr int kMemPolicyFlagAddress = 2;
+
+int64_t HugePageLength(int64_t size) {
+  return (size + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+}
+
+Status BindToNumaNode(void* address, int64_t length, int numa_node) {
+  constexpr int kBitsPerWord = static_cast<int>(sizeof(unsigned long) * 8);  // NOLINT
+  std::vector<unsigned long> node_mask(numa_node / kBitsPerWord + 1, 0);     // NOLINT
+  node_mask[numa_node / kBitsPerWord] = 1UL << (numa_node % kBitsPerWord);
+  // The kernel reads one bit less than the maximum node passed
+  const unsigned long max_node = node_mask.size() * kBitsPerWord + 1;  // NOLINT
+  if (syscall(SYS_mbind, address, static_cast<unsigned long>(length),  // NOLINT
+              kMemPolicyBind, node_mask.data(), max_node, 0) != 0) {
+    std::stringstream ss;
+    ss << "Cannot bind memory to NUMA node " << numa_node << ": " << std::strerror(errno);
+    return Status::IOError(ss.str());
+  }
+  return Status::OK();
+}
+
+// Map whole huge pages aligned to their size, by over-mapping one page and
+// trimming the excess at both ends
+Status MapHugePages(int64_t size, int numa_node, uint8_t** out) {
+  if (size > std::numeric_limits<int64_t>::max() - 2 * kHugePageSize) {
+    std::stringstream ss;
+    ss << "malloc of size " << size << " failed";
+    return Status::OutOfMemory(ss.str());
+  }
+  const int64_t length = HugePageLength(size);
+  void* mapped = mmap(nullptr, static_cast<size_t>(length + kHugePageSize),
+                      PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED) {
+    std::stringstream ss;
+    ss << "mmap of size " << size << " failed: " << std::strerror(errno);
+    return Status::OutOfMemory(ss.str());
+  }
+  uint8_t* start = reinterpret_cast<uint8_t*>(mapped);
+  uint8_t* aligned = reinterpret_cast<uint8_t*>(
+      (reinterpret_cast<uintptr_t>(start) + kHugePageSize - 1) &
+      ~static_cast<uintptr_t>(kHugePageSize - 1));
+  if (aligned != start) {
+    munmap(start, static_cast<size_t>(aligned - start));
+  }
+  const int64_t tail = (start + length + kHugePageSize) - (aligned + length);
+  if (tail > 0) {
+    munmap(aligned + length, static_cast<size_t>(tail));
+  }
+
+#ifdef MADV_HUGEPAGE
+  // Only advice: transparent huge pages may be disabled
+  madvise(aligned, static_cast<size_t>(length), MADV_HUGEPAGE);
+#endif
+  if (numa_node >= 0) {
+    Status status = BindToNumaNode(aligned, length, numa_node);
+    if (!status.ok()) {
+      munmap(aligned, static_cast<size_t>(length));
+      return status;
+    }
+  }
+  *out = aligned;
+  return Status::OK();
+}
+
+void UnmapHugePages(uint8_t* buffer, int64_t size) {
+  munmap(buffer, static_cast<size_t>(HugePageLength(size)));
+}
+
+#endif  // defined(__linux__)
+
+}  // namespace
+
+NumaMemoryPool::NumaMemoryPool(int numa_node, int64_t huge_page_threshold)
+    : numa_node_(numa_node),
+      huge_page_threshold_(huge_page_threshold),
+      bytes_allocated_(0),
+      max_memory_(0) {}
+
+NumaMemoryPool::~NumaMemoryPool() {}
+
+bool NumaMemoryPool::IsMapped(int64_t size) const {
+#ifdef __linux__
+  return size >= huge_page_threshold_;
+#else
+  return false;
+#endif
+}
+
+Status NumaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+#ifdef __linux__
+  if (IsMapped(size)) {
+    RETURN_NOT_OK(MapHugePages(size, numa_node_, out));
+  } else {
+    RETURN_NOT_OK(AllocateAligned(size, out));
+  }
+#else
+  RETURN_NOT_OK(AllocateAligned(size, out));
+#endif
+  UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
+  return Status::OK();
+}
+
+Status NumaMemoryPool::AllocateZeroed(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Allocate(size, out));
+  // Fresh mappings are zero already
+  if (!IsMapped(size)) {
+    std::memset(*out, 0, static_cast<size_t>(size));
+  }
+  return Status::OK();
+}
+
+Status NumaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+#ifdef __linux__
+  if (IsMapped(old_size) && IsMapped(new_size) &&
+      HugePageLength(old_size) == HugePageLength(new_size)) {
+    // The mapping is large enough already
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+    return Status::OK();
+  }
+#endif
+  uint8_t* out = nullptr;
+  RETURN_NOT_OK(Allocate(new_size, &out));
+  std::memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+  Free(*ptr, old_size);
+  *ptr = out;
+  return Status::OK();
+}
+
+void NumaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  DCHECK_GE(bytes_allocated_, size);
+#ifdef __linux__
+  if (IsMapped(size)) {
+    UnmapHugePages(buffer, size);
+  } else {
+    FreeAligned(buffer);
+  }
+#else
+  FreeAligned(buffer);
+#endif
+  bytes_allocated_ -= size;
+}
+
+int64_t NumaMemoryPool::bytes_allocated() const { return bytes_allocated_.load(); }
+
+int64_t NumaMemoryPool::max_memory() const { return max_memory_.load(); }
+
+int GetNumaNode(const uint8_t* address) {
+#ifdef __linux__
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0UL, address,
+              kMemPolicyFlagNode | kMemPolicyFlagAddress) != 0) {
+    return -1;
+  }
+  return node;
 #else
-    std::free(buffer);
+  return -1;
 #endif
+}
+
+// ----------------------------------------------------------------------
+// ArenaMemoryPool
+
+namespace {
+
+// Allocations are rounded up so that all of them stay aligned. Sizes too
+// large to round are left for the parent pool to reject
+int64_t ArenaSlotSize(int64_t size) {
+  if (size > std::numeric_limits<int64_t>::max() - static_cast<int64_t>(kAlignment)) {
+    return size;
+  }
+  return std::max(static_cast<int64_t>(kAlignment), BitUtil::RoundUpToMultipleOf64(size));
+}
+
+}  // namespace
+
+class ArenaMemoryPool::Impl {
+ public:
+  Impl(MemoryPool* parent, int64_t chunk_size)
+      : parent_(parent),
+        chunk_size_(ArenaSlotSize(chunk_size)),
+        current_(nullptr),
+        end_(nullptr),
+        last_(nullptr),
+        bytes_allocated_(0),
+        max_memory_(0),
+        bytes_reserved_(0) {}
+
+  ~Impl() {
+    for (const Chunk& chunk : chunks_) {
+      parent_->Free(chunk.data, chunk.size);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    RETURN_NOT_OK(AllocateSlot(ArenaSlotSize(size), out));
+    DidAllocate(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    const int64_t new_slot = ArenaSlotSize(new_size);
+    if (*ptr == last_ && new_slot <= end_ - last_) {
+      // The most recent allocation grows or shrinks in place
+      current_ = last_ + new_slot;
+    } else if (new_slot > ArenaSlotSize(old_size)) {
+      // The space of the old allocation is only reclaimed by Reset()
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateSlot(new_slot, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      *ptr = out;
+    }
+    DidAllocate(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    DCHECK_GE(bytes_allocated_, size);
     bytes_allocated_ -= size;
+    if (buffer != nullptr && buffer == last_) {
+      current_ = last_;
+      last_ = nullptr;
+    }
   }
 
-  int64_t max_memory() const override { return max_memory_.load(); }
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return bytes_reserved_;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Keep a chunk of the regular size, if any
+    std::vector<Chunk> kept;
+    for (const Chunk& chunk : chunks_) {
+      if (kept.empty() && chunk.size == chunk_size_) {
+        kept.push_back(chunk);
+      } else {
+        parent_->Free(chunk.data, chunk.size);
+      }
+    }
+    chunks_.swap(kept);
+    current_ = chunks_.empty() ? nullptr : chunks_[0].data;
+    end_ = chunks_.empty() ? nullptr : chunks_[0].data + chunks_[0].size;
+    last_ = nullptr;
+    bytes_reserved_ = chunks_.empty() ? 0 : chunks_[0].size;
+  }
 
  private:
-  mutable std::mutex lock_;
+  struct Chunk {
+    uint8_t* data;
+    int64_t size;
+  };
+
+  Status AllocateSlot(int64_t slot_size, uint8_t** out) {
+    if (slot_size <= end_ - current_) {
+      *out = last_ = current_;
+      current_ += slot_size;
+      return Status::OK();
+    }
+    const int64_t chunk_size = std::max(chunk_size_, slot_size);
+    uint8_t* data;
+    RETURN_NOT_OK(parent_->Allocate(chunk_size, &data));
+    chunks_.push_back({data, chunk_size});
+    bytes_reserved_ += chunk_size;
+    if (slot_size > chunk_size_) {
+      // Oversized allocations leave the current chunk in use
+      *out = data;
+      return Status::OK();
+    }
+    current_ = data;
+    end_ = data + chunk_size;
+    *out = last_ = current_;
+    current_ += slot_size;
+    return Status::OK();
+  }
+
+  void DidAllocate(int64_t size) {
+    bytes_allocated_ += size;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+  }
+
+  MemoryPool* parent_;
+  const int64_t chunk_size_;
+  mutable std::mutex mutex_;
+  std::vector<Chunk> chunks_;
+
+  // Free space of the current chunk, and the most recent allocation in it
+  uint8_t* current_;
+  uint8_t* end_;
+  uint8_t* last_;
+
+  int64_t bytes_allocated_;
+  int64_t max_memory_;
+  int64_t bytes_reserved_;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t chunk_size)
+    : impl_(new Impl(parent, chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) { impl_->Free(buffer, size); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+// ----------------------------------------------------------------------
+// RecyclingMemoryPool
+
+class RecyclingMemoryPool::Impl {
+ public:
+  Impl(MemoryPool* parent, int64_t max_retained_bytes)
+      : parent_(parent),
+        max_retained_bytes_(max_retained_bytes),
+        bytes_retained_(0),
+        bytes_allocated_(0),
+        max_memory_(0) {}
+
+  ~Impl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (!TakeRetained(size, out)) {
+      RETURN_NOT_OK(parent_->Allocate(size, out));
+    }
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    uint8_t* out;
+    if (TakeRetained(new_size, &out)) {
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Retain(*ptr, old_size);
+      *ptr = out;
+    } else {
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+    }
+    UpdateMaxMemory(&max_memory_, bytes_allocated_ += new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    DCHECK_GE(bytes_allocated_, size);
+    bytes_allocated_ -= size;
+    if (buffer != nullptr) {
+      Retain(buffer, size);
+    }
+  }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+  int64_t max_memory() const { return max_memory_.load(); }
+
+  int64_t bytes_retained() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return bytes_retained_;
+  }
+
+  void ReleaseUnused() {
+    std::list<Retained> released;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      released.swap(by_age_);
+      by_size_.clear();
+      bytes_retained_ = 0;
+    }
+    for (const Retained& buffer : released) {
+      parent_->Free(buffer.data, buffer.size);
+    }
+  }
+
+ private:
+  struct Retained {
+    uint8_t* data;
+    int64_t size;
+  };
+  using RetainedList = std::list<Retained>;
+
+  // Take the most recently freed buffer of that size, if any
+  bool TakeRetained(int64_t size, uint8_t** out) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = by_size_.find(size);
+    if (it == by_size_.end()) {
+      return false;
+    }
+    std::deque<RetainedList::iterator>& buffers = it->second;
+    *out = buffers.back()->data;
+    by_age_.erase(buffers.back());
+    buffers.pop_back();
+    if (buffers.empty()) {
+      by_size_.erase(it);
+    }
+    bytes_retained_ -= size;
+    return true;
+  }
+
+  // Keep a freed buffer, then return the least recently freed ones to the
+  // parent while over the limit
+  void Retain(uint8_t* data, int64_t size) {
+    std::vector<Retained> evicted;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      by_age_.push_front({data, size});
+      by_size_[size].push_back(by_age_.begin());
+      bytes_retained_ += size;
+      while (bytes_retained_ > max_retained_bytes_) {
+        const Retained oldest = by_age_.back();
+        // The oldest buffer of a size is the first one in its queue
+        auto it = by_size_.find(oldest.size);
+        it->second.pop_front();
+        if (it->second.empty()) {
+          by_size_.erase(it);
+        }
+        by_age_.pop_back();
+        bytes_retained_ -= oldest.size;
+        evicted.push_back(oldest);
+      }
+    }
+    for (const Retained& buffer : evicted) {
+      parent_->Free(buffer.data, buffer.size);
+    }
+  }
+
+  MemoryPool* parent_;
+  const int64_t max_retained_bytes_;
+
+  mutable std::mutex mutex_;
+  // Retained buffers from the most to the least recently freed, and indexed
+  // by size from the least to the most recently freed
+  RetainedList by_age_;
+  std::unordered_map<int64_t, std::deque<RetainedList::iterator>> by_size_;
+  int64_t bytes_retained_;
+
   std::atomic<int64_t> bytes_allocated_;
   std::atomic<int64_t> max_memory_;
 };
 
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* parent, int64_t max_retained_bytes)
+    : impl_(new Impl(parent, max_retained_bytes)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t RecyclingMemoryPool::bytes_retained() const { return impl_->bytes_retained(); }
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+// ----------------------------------------------------------------------
+// Process-wide pools
+
+namespace {
+
+MemoryPool* GetDefaultMemoryPool() {
+  const char* value = std::getenv("ARROW_DEFAULT_MEMORY_POOL");
+  if (value == nullptr) {
+    return system_memory_pool();
+  }
+  const std::string name(value);
+  if (name == "thread_caching") {
+    return thread_caching_memory_pool();
+  } else if (name != "system") {
+    ARROW_LOG(WARNING) << "Invalid value for ARROW_DEFAULT_MEMORY_POOL: " << value;
+  }
+  return system_memory_pool();
+}
+
+}  // namespace
+
 MemoryPool* default_memory_pool() {
-  static DefaultMemoryPool default_memory_pool_;
-  return &default_memory_pool_;
+  static MemoryPool* default_memory_pool_ = GetDefaultMemoryPool();
+  return default_memory_pool_;
+}
+
+MemoryPool* system_memory_pool() {
+  static DefaultMemoryPool pool;
+  return &pool;
+}
+
+bool jemalloc_enabled() {
+#ifdef ARROW_JEMALLOC
+  return true;
+#else
+  return false;
+#endif
+}
+
+MemoryPool* thread_caching_memory_pool() {
+  // Never destroyed, so that buffers freed by the destructors of other static
+  // objects can still be returned to it
+  static ThreadCachingMemoryPool* pool = new ThreadCachingMemoryPool();
+  return pool;
 }
 
 LoggingMemoryPool::LoggingMemoryPool(MemoryPool* pool) : pool_(pool) {}
@@ -178,6 +1294,12 @@ Status LoggingMemoryPool::Allocate(int64_t size, uint8_t** out) {
   return s;
 }
 
+Status LoggingMemoryPool::AllocateZeroed(int64_t size, uint8_t** out) {
+  Status s = pool_->AllocateZeroed(size, out);
+  std::cout << "AllocateZeroed: size = " << size << std::endl;
+  return s;
+}
+
 Status LoggingMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
   Status s = pool_->Reallocate(old_size, new_size, ptr);
   std::cout << "Reallocate: old_size = " << old_size << " - new_size = " << new_size
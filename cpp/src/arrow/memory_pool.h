@@ -20,6 +20,10 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/util/visibility.h"
 
@@ -40,6 +44,13 @@ class ARROW_EXPORT MemoryPool {
   /// The allocated region shall be 64-byte aligned.
   virtual Status Allocate(int64_t size, uint8_t** out) = 0;
 
+  /// Allocate a new memory region of at least size bytes, all zero.
+  ///
+  /// By default the region is allocated then cleared. Pools mapping fresh
+  /// pages from the operating system return them as they are, so that large
+  /// zeroed regions cost nothing until written.
+  virtual Status AllocateZeroed(int64_t size, uint8_t** out);
+
   /// Resize an already allocated memory section.
   ///
   /// As by default most default allocators on a platform don't support aligned
@@ -74,6 +85,7 @@ class ARROW_EXPORT LoggingMemoryPool : public MemoryPool {
   ~LoggingMemoryPool() override = default;
 
   Status Allocate(int64_t size, uint8_t** out) override;
+  Status AllocateZeroed(int64_t size, uint8_t** out) override;
   Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
 
   void Free(uint8_t* buffer, int64_t size) override;
@@ -86,14 +98,314 @@ class ARROW_EXPORT LoggingMemoryPool : public MemoryPool {
   MemoryPool* pool_;
 };
 
+/// A pool that keeps freed blocks of up to 32 KB for reuse, in power-of-two
+/// size classes.
+///
+/// The blocks are cached in arenas, each with its own lock, and each thread
+/// allocates from and frees into the same arena, so that threads seldom
+/// contend. Reallocations within a size class return the same block.
+/// bytes_allocated() and max_memory() count the requested sizes, not the
+/// cached blocks, and are updated without locking.
+class ARROW_EXPORT ThreadCachingMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] num_arenas number of arenas, by default twice the number of
+  /// hardware threads
+  explicit ThreadCachingMemoryPool(int num_arenas = 0);
+  ~ThreadCachingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of bytes of free blocks kept for reuse
+  int64_t bytes_cached() const;
+
+  /// \brief Return the cached blocks to the system allocator
+  void ReleaseUnused();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// Return the process-wide pool used by default.
+///
+/// This is system_memory_pool() unless the ARROW_DEFAULT_MEMORY_POOL
+/// environment variable is set to "thread_caching", in which case it is
+/// thread_caching_memory_pool().
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
+/// Return the process-wide pool allocating from the system allocator, or from
+/// jemalloc if Arrow was built with it
+ARROW_EXPORT MemoryPool* system_memory_pool();
+
+/// Whether Arrow was built with jemalloc, which system_memory_pool() then uses
+ARROW_EXPORT bool jemalloc_enabled();
+
+/// Return the process-wide ThreadCachingMemoryPool
+ARROW_EXPORT MemoryPool* thread_caching_memory_pool();
+
 #ifdef ARROW_NO_DEFAULT_MEMORY_POOL
 #define ARROW_MEMORY_POOL_DEFAULT
 #else
 #define ARROW_MEMORY_POOL_DEFAULT = default_memory_pool()
 #endif
 
+struct ARROW_EXPORT ProfilingMemoryPoolOptions {
+  ProfilingMemoryPoolOptions()
+      : stack_sample_interval(0),
+        max_stack_depth(32),
+        timeline_interval_ns(10000000),
+        max_timeline_samples(1024) {}
+
+  /// Record the call stack of one allocation in every stack_sample_interval,
+  /// or none if 0. Only supported with glibc and on macOS
+  int64_t stack_sample_interval;
+
+  /// Maximum number of frames recorded per call stack
+  int max_stack_depth;
+
+  /// Minimum time between two samples of the live bytes
+  int64_t timeline_interval_ns;
+
+  /// Number of samples of the live bytes kept, the oldest being dropped first
+  int64_t max_timeline_samples;
+};
+
+/// A call stack recorded by a ProfilingMemoryPool
+struct ARROW_EXPORT AllocationStackSample {
+  /// The symbolized frames, innermost first
+  std::vector<std::string> frames;
+  /// Number of sampled allocations made from this stack
+  int64_t num_allocations;
+  /// Total bytes of the sampled allocations
+  int64_t bytes;
+};
+
+/// A snapshot of the statistics of a ProfilingMemoryPool
+///
+/// Histograms count sizes by power of two: bucket 0 counts sizes of 0 and
+/// bucket i > 0 sizes in [2^(i-1), 2^i).
+struct ARROW_EXPORT MemoryPoolProfile {
+  int64_t num_allocations;
+  int64_t num_reallocations;
+  int64_t num_frees;
+  int64_t bytes_allocated;
+  int64_t max_memory;
+
+  /// Sizes of the allocations
+  std::vector<int64_t> allocation_sizes;
+  /// New sizes of the reallocations. Many reallocations to small sizes point
+  /// to buffers grown in too small steps
+  std::vector<int64_t> reallocation_sizes;
+
+  /// Live bytes over time, as pairs of nanoseconds since the creation of the
+  /// pool and bytes allocated
+  std::vector<std::pair<int64_t, int64_t>> live_bytes;
+
+  /// Sampled call stacks, by decreasing number of bytes
+  std::vector<AllocationStackSample> stacks;
+};
+
+/// A pool forwarding to another pool while profiling its allocations, e.g.
+/// to scrape allocation statistics from a long-running service. Thread-safe.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  explicit ProfilingMemoryPool(
+      MemoryPool* pool,
+      const ProfilingMemoryPoolOptions& options = ProfilingMemoryPoolOptions());
+  ~ProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status AllocateZeroed(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief Return the statistics gathered so far
+  MemoryPoolProfile GetProfile() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// A pool forwarding to a parent pool while tracking its own allocations,
+/// e.g. those of one query.
+///
+/// Children can be nested, every level enforcing its own limit. Allocations
+/// that would take the pool over its limit fail with Status::OutOfMemory
+/// before reaching the parent.
+class ARROW_EXPORT ChildMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] parent the pool the memory is allocated from
+  /// \param[in] limit maximum number of bytes allocated through this pool at
+  /// any time, or -1 for no limit
+  explicit ChildMemoryPool(MemoryPool* parent, int64_t limit = -1);
+  ~ChildMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status AllocateZeroed(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The byte limit, or -1 if unlimited
+  int64_t limit() const { return limit_; }
+
+  /// \brief The number of allocations made through this pool, not counting
+  /// reallocations
+  int64_t num_allocations() const { return num_allocations_.load(); }
+
+ private:
+  // Account for size more bytes, failing if over the limit
+  Status Reserve(int64_t size);
+
+  MemoryPool* parent_;
+  const int64_t limit_;
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+  std::atomic<int64_t> num_allocations_;
+};
+
+/// A pool for large buffers that can back them with huge pages and bind them
+/// to a NUMA node, e.g. the columns of big tables scanned by many threads.
+///
+/// Allocations of at least huge_page_threshold bytes are mapped from the
+/// operating system in multiples of 2 MB, aligned to 2 MB and advised to use
+/// transparent huge pages. If numa_node is not -1, these mappings are bound
+/// to that node, and failing to bind them is an error. Smaller allocations
+/// come from the system allocator, and are placed wherever it puts them.
+///
+/// Huge pages and binding are only supported on Linux; elsewhere all
+/// allocations come from the system allocator.
+class ARROW_EXPORT NumaMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] numa_node the node to bind large allocations to, or -1 to
+  /// leave them to the default policy of the operating system
+  /// \param[in] huge_page_threshold minimum size of the allocations mapped
+  /// with huge pages
+  explicit NumaMemoryPool(int numa_node = -1,
+                          int64_t huge_page_threshold = 2 * 1024 * 1024);
+  ~NumaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status AllocateZeroed(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int numa_node() const { return numa_node_; }
+
+ private:
+  bool IsMapped(int64_t size) const;
+
+  const int numa_node_;
+  const int64_t huge_page_threshold_;
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+};
+
+/// Return the NUMA node holding the memory at address, e.g. the data() of a
+/// Buffer, so that work on it can be scheduled nearby.
+///
+/// \return the node, or -1 if unknown, e.g. on platforms other than Linux
+ARROW_EXPORT
+int GetNumaNode(const uint8_t* address);
+
+/// A pool keeping recently freed buffers for reuse by allocations of the
+/// exact same size, e.g. the buffers of consecutive record batches of one
+/// schema and length.
+///
+/// Recycled buffers are already mapped and warm in cache, unlike fresh ones
+/// from the parent pool. The least recently freed buffers are returned to
+/// the parent once more than max_retained_bytes are kept.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] parent the pool the buffers are allocated from
+  /// \param[in] max_retained_bytes maximum number of bytes of freed buffers
+  /// kept for reuse
+  explicit RecyclingMemoryPool(MemoryPool* parent ARROW_MEMORY_POOL_DEFAULT,
+                               int64_t max_retained_bytes = 64 << 20);
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of bytes of freed buffers kept for reuse
+  int64_t bytes_retained() const;
+
+  /// \brief Return the retained buffers to the parent pool
+  void ReleaseUnused();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// A pool carving allocations out of large chunks from a parent pool, for
+/// short-lived buffers that are released together.
+///
+/// Allocations bump a pointer in the current chunk, freeing only gives back
+/// the space of the most recent allocation, and reallocating the most recent
+/// allocation grows or shrinks it in place, as builders do repeatedly. The
+/// chunks are returned to the parent pool by Reset() or on destruction.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  /// \param[in] parent the pool the chunks are allocated from
+  /// \param[in] chunk_size size of the chunks. Larger allocations get a
+  /// chunk of their own
+  explicit ArenaMemoryPool(MemoryPool* parent ARROW_MEMORY_POOL_DEFAULT,
+                           int64_t chunk_size = 1 << 20);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of bytes of the chunks held from the parent pool
+  int64_t bytes_reserved() const;
+
+  /// \brief Make the space of all allocations available again
+  ///
+  /// One chunk is kept for the next allocations and the others are returned
+  /// to the parent pool. No buffer allocated from this pool may be used
+  /// afterwards.
+  void Reset();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace arrow
 
 #endif  // ARROW_MEMORY_POOL_H
@@ -90,6 +90,38 @@ TEST_F(TestPrettyPrint, BinaryType) {
   CheckPrimitive<BinaryType, std::string>(0, is_valid, values, ex);
 }
 
+TEST_F(TestPrettyPrint, LargeBinaryTypes) {
+  std::vector<bool> is_valid = {true, true, false, true, false};
+  std::vector<std::string> values = {"foo", "bar", "", "baz", ""};
+  static const char* ex = R"expected(["foo", "bar", null, "baz", null])expected";
+  CheckPrimitive<LargeStringType, std::string>(0, is_valid, values, ex);
+  static const char* ex2 = R"expected([666F6F, 626172, null, 62617A, null])expected";
+  CheckPrimitive<LargeBinaryType, std::string>(0, is_valid, values, ex2);
+
+  LargeListBuilder list_builder(default_memory_pool(),
+                                std::unique_ptr<ArrayBuilder>(new Int8Builder()));
+  auto list_values = static_cast<Int8Builder*>(list_builder.value_builder());
+  ASSERT_OK(list_builder.Append());
+  ASSERT_OK(list_values->Append(1));
+  ASSERT_OK(list_builder.AppendNull());
+  ASSERT_OK(list_builder.Append());
+  ASSERT_OK(list_values->Append(2));
+  ASSERT_OK(list_values->Append(3));
+  std::shared_ptr<Array> list;
+  ASSERT_OK(list_builder.Finish(&list));
+  CheckArray(*list->Slice(1), 0, R"expected(
+-- is_valid: [false, true]
+-- value_offsets: [1, 1, 3]
+-- values: [2, 3])expected");
+}
+
+TEST_F(TestPrettyPrint, StringViewType) {
+  std::vector<bool> is_valid = {true, false, true};
+  std::vector<std::string> values = {"foo", "", "a string of over 12 bytes"};
+  static const char* ex = R"expected(["foo", null, "a string of over 12 bytes"])expected";
+  CheckPrimitive<StringViewType, std::string>(0, is_valid, values, ex);
+}
+
 TEST_F(TestPrettyPrint, FixedSizeBinaryType) {
   std::vector<bool> is_valid = {true, true, false, true, false};
   std::vector<std::string> values = {"foo", "bar", "baz"};
@@ -151,6 +183,77 @@ TEST_F(TestPrettyPrint, DictionaryType) {
   CheckArray(*arr, 0, expected);
 }
 
+TEST_F(TestPrettyPrint, RunLengthEncodedType) {
+  std::shared_ptr<Array> run_ends, values, arr;
+  ArrayFromVector<Int32Type, int32_t>({2, 5, 6}, &run_ends);
+  ArrayFromVector<StringType, std::string>({true, false, true}, {"foo", "", "bar"},
+                                           &values);
+  ASSERT_OK(RunLengthEncodedArray::FromArrays(*run_ends, *values, &arr));
+
+  static const char* expected = R"expected(
+-- run_ends: [2, 5, 6]
+-- values: ["foo", null, "bar"])expected";
+  CheckArray(*arr, 0, expected);
+
+  // The run ends of slices are those of the parent
+  static const char* expected_slice = R"expected(
+-- run_ends: [5]
+-- values: [null])expected";
+  CheckArray(*arr->Slice(3, 2), 0, expected_slice);
+}
+
+void CheckView(const ArrayView& view, int indent, const char* expected) {
+  std::ostringstream sink;
+  ASSERT_OK(PrettyPrint(view, indent, &sink));
+  ASSERT_EQ(std::string(expected), sink.str());
+
+  // Same as printing a slice
+  std::ostringstream slice_sink;
+  ASSERT_OK(PrettyPrint(*view.ToArray(), indent, &slice_sink));
+  ASSERT_EQ(slice_sink.str(), sink.str());
+}
+
+TEST_F(TestPrettyPrint, ArrayView) {
+  std::vector<bool> is_valid = {true, true, false, true, false};
+  std::shared_ptr<Array> array;
+  ArrayFromVector<StringType, std::string>(is_valid, {"foo", "bar", "", "baz", ""},
+                                           &array);
+  CheckView(ArrayView(*array, 1, 3), 0, R"expected(["bar", null, "baz"])expected");
+  CheckView(ArrayView(*array, 5, 1), 0, "[]");
+
+  ListBuilder list_builder(default_memory_pool(),
+                           std::unique_ptr<ArrayBuilder>(new Int8Builder()));
+  auto values = static_cast<Int8Builder*>(list_builder.value_builder());
+  ASSERT_OK(list_builder.Append());
+  ASSERT_OK(values->Append(1));
+  ASSERT_OK(list_builder.AppendNull());
+  ASSERT_OK(list_builder.Append());
+  ASSERT_OK(values->Append(2));
+  ASSERT_OK(values->Append(3));
+  ASSERT_OK(list_builder.Append());
+  ASSERT_OK(values->Append(4));
+  std::shared_ptr<Array> list;
+  ASSERT_OK(list_builder.Finish(&list));
+  CheckView(ArrayView(*list->Slice(1), 1, 2), 0, R"expected(
+-- is_valid: all not null
+-- value_offsets: [1, 3, 4]
+-- values: [2, 3, 4])expected");
+  CheckView(ArrayView(*list, 1, 2), 0, R"expected(
+-- is_valid: [false, true]
+-- value_offsets: [1, 1, 3]
+-- values: [2, 3])expected");
+
+  std::shared_ptr<Array> dict;
+  ArrayFromVector<StringType, std::string>({"foo", "bar"}, &dict);
+  std::shared_ptr<Array> indices;
+  ArrayFromVector<Int8Type, int8_t>({1, 0, 1, 1}, &indices);
+  DictionaryArray dict_array(dictionary(int8(), dict), indices);
+  CheckView(ArrayView(dict_array, 1, 2), 0, R"expected(
+-- is_valid: all not null
+-- dictionary: ["foo", "bar"]
+-- indices: [0, 1])expected");
+}
+
 TEST_F(TestPrettyPrint, SchemaWithDictionary) {
   std::vector<bool> is_valid = {true, true, false, true, true, true};
 
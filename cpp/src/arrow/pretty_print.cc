@@ -83,15 +83,18 @@ void PrettyPrinter::Indent() {
 
 class ArrayPrinter : public PrettyPrinter {
  public:
-  ArrayPrinter(const Array& array, int indent, std::ostream* sink)
-      : PrettyPrinter(indent, sink), array_(array) {}
+  ArrayPrinter(const ArrayView& view, int indent, std::ostream* sink)
+      : PrettyPrinter(indent, sink),
+        array_(view.array()),
+        offset_(view.offset()),
+        length_(view.length()) {}
 
   template <typename T>
   inline typename std::enable_if<IsInteger<T>::value, void>::type WriteDataValues(
       const T& array) {
     const auto data = array.raw_values();
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
@@ -106,8 +109,8 @@ class ArrayPrinter : public PrettyPrinter {
   inline typename std::enable_if<IsFloatingPoint<T>::value, void>::type WriteDataValues(
       const T& array) {
     const auto data = array.raw_values();
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
@@ -120,29 +123,32 @@ class ArrayPrinter : public PrettyPrinter {
 
   // String (Utf8)
   template <typename T>
-  inline typename std::enable_if<std::is_same<StringArray, T>::value, void>::type
+  inline typename std::enable_if<std::is_same<StringArray, T>::value ||
+                                     std::is_same<LargeStringArray, T>::value ||
+                                     std::is_same<StringViewArray, T>::value,
+                                 void>::type
   WriteDataValues(const T& array) {
-    int32_t length;
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
         Write("null");
       } else {
-        const char* buf = reinterpret_cast<const char*>(array.GetValue(i, &length));
-        (*sink_) << "\"" << std::string(buf, length) << "\"";
+        (*sink_) << "\"" << array.GetString(i) << "\"";
       }
     }
   }
 
   // Binary
   template <typename T>
-  inline typename std::enable_if<std::is_same<BinaryArray, T>::value, void>::type
+  inline typename std::enable_if<std::is_same<BinaryArray, T>::value ||
+                                     std::is_same<LargeBinaryArray, T>::value,
+                                 void>::type
   WriteDataValues(const T& array) {
-    int32_t length;
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    typename T::TypeClass::offset_type length;
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
@@ -158,8 +164,8 @@ class ArrayPrinter : public PrettyPrinter {
   inline typename std::enable_if<std::is_same<FixedSizeBinaryArray, T>::value, void>::type
   WriteDataValues(const T& array) {
     int32_t width = array.byte_width();
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
@@ -173,8 +179,8 @@ class ArrayPrinter : public PrettyPrinter {
   template <typename T>
   inline typename std::enable_if<std::is_same<Decimal128Array, T>::value, void>::type
   WriteDataValues(const T& array) {
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
@@ -188,8 +194,8 @@ class ArrayPrinter : public PrettyPrinter {
   template <typename T>
   inline typename std::enable_if<std::is_base_of<BooleanArray, T>::value, void>::type
   WriteDataValues(const T& array) {
-    for (int i = 0; i < array.length(); ++i) {
-      if (i > 0) {
+    for (int64_t i = offset_; i < offset_ + length_; ++i) {
+      if (i > offset_) {
         (*sink_) << ", ";
       }
       if (array.IsNull(i)) {
@@ -201,14 +207,16 @@ class ArrayPrinter : public PrettyPrinter {
   }
 
   Status Visit(const NullArray& array) {
-    (*sink_) << array.length() << " nulls";
+    (*sink_) << length_ << " nulls";
     return Status::OK();
   }
 
   template <typename T>
   typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value ||
                               std::is_base_of<FixedSizeBinaryArray, T>::value ||
-                              std::is_base_of<BinaryArray, T>::value,
+                              std::is_base_of<BinaryArray, T>::value ||
+                              std::is_base_of<LargeBinaryArray, T>::value ||
+                              std::is_same<StringViewArray, T>::value,
                           Status>::type
   Visit(const T& array) {
     OpenArray();
@@ -221,51 +229,76 @@ class ArrayPrinter : public PrettyPrinter {
 
   Status WriteValidityBitmap(const Array& array);
 
-  Status Visit(const ListArray& array) {
+  Status Visit(const ListArray& array) { return WriteList<Int32Array>(array); }
+
+  Status Visit(const LargeListArray& array) { return WriteList<Int64Array>(array); }
+
+  template <typename OffsetsArrayType, typename ListArrayType>
+  Status WriteList(const ListArrayType& array) {
     RETURN_NOT_OK(WriteValidityBitmap(array));
 
     Newline();
     Write("-- value_offsets: ");
-    Int32Array value_offsets(array.length() + 1, array.value_offsets(), nullptr, 0,
-                             array.offset());
-    RETURN_NOT_OK(PrettyPrint(value_offsets, indent_ + 2, sink_));
+    OffsetsArrayType value_offsets(array.length() + 1, array.value_offsets(), nullptr, 0,
+                                   array.offset());
+    RETURN_NOT_OK(
+        PrettyPrint(ArrayView(value_offsets, offset_, length_ + 1), indent_ + 2, sink_));
+
+    Newline();
+    Write("-- values: ");
+    const int64_t values_offset = array.value_offset(offset_);
+    ArrayView values(*array.values(), values_offset,
+                     array.value_offset(offset_ + length_) - values_offset);
+    RETURN_NOT_OK(PrettyPrint(values, indent_ + 2, sink_));
+
+    return Status::OK();
+  }
+
+  Status Visit(const RunLengthEncodedArray& array) {
+    // Print the runs spanned by the printed values, with their absolute ends
+    int64_t first_run = 0, num_runs = 0;
+    if (length_ > 0) {
+      first_run = array.FindRun(offset_);
+      num_runs = array.FindRun(offset_ + length_ - 1) - first_run + 1;
+    }
+
+    Newline();
+    Write("-- run_ends: ");
+    Int32Array run_ends(array.values()->length(), array.run_ends());
+    RETURN_NOT_OK(
+        PrettyPrint(ArrayView(run_ends, first_run, num_runs), indent_ + 2, sink_));
 
     Newline();
     Write("-- values: ");
-    auto values =
-        array.values()->Slice(array.value_offset(0),
-                              array.value_offset(array.length()) - array.value_offset(0));
-    RETURN_NOT_OK(PrettyPrint(*values, indent_ + 2, sink_));
+    RETURN_NOT_OK(PrettyPrint(ArrayView(*array.values(), first_run, num_runs),
+                              indent_ + 2, sink_));
 
     return Status::OK();
   }
 
-  Status PrintChildren(const std::vector<std::shared_ptr<Array>>& fields, int64_t offset,
-                       int64_t length) {
+  Status PrintChildren(const std::vector<ArrayView>& fields) {
     for (size_t i = 0; i < fields.size(); ++i) {
       Newline();
       std::stringstream ss;
-      ss << "-- child " << i << " type: " << fields[i]->type()->ToString() << " values: ";
+      ss << "-- child " << i << " type: " << fields[i].type().ToString() << " values: ";
       Write(ss.str());
 
-      std::shared_ptr<Array> field = fields[i];
-      if (offset != 0) {
-        field = field->Slice(offset, length);
-      }
-
-      RETURN_NOT_OK(PrettyPrint(*field, indent_ + 2, sink_));
+      RETURN_NOT_OK(PrettyPrint(fields[i], indent_ + 2, sink_));
     }
     return Status::OK();
   }
 
   Status Visit(const StructArray& array) {
     RETURN_NOT_OK(WriteValidityBitmap(array));
-    std::vector<std::shared_ptr<Array>> children;
+    std::vector<std::shared_ptr<Array>> fields;
+    std::vector<ArrayView> children;
+    fields.reserve(array.num_fields());
     children.reserve(array.num_fields());
     for (int i = 0; i < array.num_fields(); ++i) {
-      children.emplace_back(array.field(i));
+      fields.emplace_back(array.field(i));
+      children.emplace_back(*fields.back(), offset_, length_);
     }
-    return PrintChildren(children, 0, array.length());
+    return PrintChildren(children);
   }
 
   Status Visit(const UnionArray& array) {
@@ -274,23 +307,27 @@ class ArrayPrinter : public PrettyPrinter {
     Newline();
     Write("-- type_ids: ");
     UInt8Array type_ids(array.length(), array.type_ids(), nullptr, 0, array.offset());
-    RETURN_NOT_OK(PrettyPrint(type_ids, indent_ + 2, sink_));
+    RETURN_NOT_OK(PrettyPrint(ArrayView(type_ids, offset_, length_), indent_ + 2, sink_));
 
     if (array.mode() == UnionMode::DENSE) {
       Newline();
       Write("-- value_offsets: ");
       Int32Array value_offsets(array.length(), array.value_offsets(), nullptr, 0,
                                array.offset());
-      RETURN_NOT_OK(PrettyPrint(value_offsets, indent_ + 2, sink_));
+      RETURN_NOT_OK(
+          PrettyPrint(ArrayView(value_offsets, offset_, length_), indent_ + 2, sink_));
     }
 
     // Print the children without any offset, because the type ids are absolute
-    std::vector<std::shared_ptr<Array>> children;
+    std::vector<std::shared_ptr<Array>> fields;
+    std::vector<ArrayView> children;
+    fields.reserve(array.num_fields());
     children.reserve(array.num_fields());
     for (int i = 0; i < array.num_fields(); ++i) {
-      children.emplace_back(array.child(i));
+      fields.emplace_back(array.child(i));
+      children.emplace_back(*fields.back());
     }
-    return PrintChildren(children, 0, array.length() + array.offset());
+    return PrintChildren(children);
   }
 
   Status Visit(const DictionaryArray& array) {
@@ -302,7 +339,7 @@ class ArrayPrinter : public PrettyPrinter {
 
     Newline();
     Write("-- indices: ");
-    return PrettyPrint(*array.indices(), indent_ + 2, sink_);
+    return PrettyPrint(ArrayView(*array.indices(), offset_, length_), indent_ + 2, sink_);
   }
 
   Status Print() {
@@ -313,16 +350,25 @@ class ArrayPrinter : public PrettyPrinter {
 
  private:
   const Array& array_;
+  // The printed range of array_
+  int64_t offset_;
+  int64_t length_;
 };
 
 Status ArrayPrinter::WriteValidityBitmap(const Array& array) {
   Newline();
   Write("-- is_valid: ");
 
-  if (array.null_count() > 0) {
+  // Only the nulls of the printed range count, as for a slice
+  bool has_nulls = array.null_count() > 0;
+  if (has_nulls && length_ < array.length()) {
+    has_nulls = CountSetBits(array.null_bitmap_data(), array.offset() + offset_,
+                             length_) < length_;
+  }
+  if (has_nulls) {
     BooleanArray is_valid(array.length(), array.null_bitmap(), nullptr, 0,
                           array.offset());
-    return PrettyPrint(is_valid, indent_ + 2, sink_);
+    return PrettyPrint(ArrayView(is_valid, offset_, length_), indent_ + 2, sink_);
   } else {
     Write("all not null");
     return Status::OK();
@@ -330,7 +376,11 @@ Status ArrayPrinter::WriteValidityBitmap(const Array& array) {
 }
 
 Status PrettyPrint(const Array& arr, int indent, std::ostream* sink) {
-  ArrayPrinter printer(arr, indent, sink);
+  return PrettyPrint(ArrayView(arr), indent, sink);
+}
+
+Status PrettyPrint(const ArrayView& view, int indent, std::ostream* sink) {
+  ArrayPrinter printer(view, indent, sink);
   return printer.Print();
 }
 
@@ -27,6 +27,7 @@
 namespace arrow {
 
 class Array;
+class ArrayView;
 class Status;
 
 struct PrettyPrintOptions {
@@ -41,6 +42,11 @@ Status PrettyPrint(const RecordBatch& batch, int indent, std::ostream* sink);
 ARROW_EXPORT
 Status PrettyPrint(const Array& arr, int indent, std::ostream* sink);
 
+/// \brief Print human-readable representation of the viewed range of an
+/// Array, without slicing it
+ARROW_EXPORT
+Status PrettyPrint(const ArrayView& view, int indent, std::ostream* sink);
+
 ARROW_EXPORT
 Status PrettyPrint(const Schema& schema, const PrettyPrintOptions& options,
                    std::ostream* sink);
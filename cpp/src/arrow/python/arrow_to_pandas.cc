@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -37,9 +38,11 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/hash.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/api.h"
@@ -82,6 +85,12 @@ struct WrapBytes<BinaryArray> {
   }
 };
 
+template <>
+struct WrapBytes<LargeStringArray> : public WrapBytes<StringArray> {};
+
+template <>
+struct WrapBytes<LargeBinaryArray> : public WrapBytes<BinaryArray> {};
+
 template <>
 struct WrapBytes<FixedSizeBinaryArray> {
   static inline PyObject* Wrap(const uint8_t* data, int64_t length) {
@@ -89,6 +98,77 @@ struct WrapBytes<FixedSizeBinaryArray> {
   }
 };
 
+// The distinct values of binary-like arrays, each with the index of its
+// first occurrence, found without the GIL so that only the Python objects of
+// the distinct values have to be created under it. The table points into the
+// arrays, which must outlive it.
+class BinaryMemoTable {
+ public:
+  BinaryMemoTable() : size_(0) {}
+
+  /// Return the index of a value among the distinct values, inserting it if
+  /// it was not seen yet.
+  int32_t GetOrInsert(const uint8_t* data, int32_t length, uint32_t hash) {
+    // Keep the load factor below 1/2, as for the hash tables of the kernels.
+    if (2 * (size_ + 1) > entries_.size()) {
+      Grow();
+    }
+    const size_t mask = entries_.size() - 1;
+    size_t index = hash & mask;
+    while (entries_[index].index != kHashSlotEmpty) {
+      const Entry& entry = entries_[index];
+      if (entry.hash == hash && entry.length == length &&
+          (length == 0 || std::memcmp(entry.data, data, length) == 0)) {
+        return entry.index;
+      }
+      index = (index + 1) & mask;
+    }
+    entries_[index] = {hash, length, data, static_cast<int32_t>(size_)};
+    values_.push_back(index);
+    return static_cast<int32_t>(size_++);
+  }
+
+  /// The number of distinct values.
+  int32_t size() const { return static_cast<int32_t>(size_); }
+
+  /// The distinct value of an index.
+  const uint8_t* GetValue(int32_t index, int32_t* length) const {
+    const Entry& entry = entries_[values_[index]];
+    *length = entry.length;
+    return entry.data;
+  }
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    int32_t length;
+    const uint8_t* data;
+    int32_t index;
+  };
+
+  void Grow() {
+    std::vector<Entry> old_entries(std::max<size_t>(entries_.size() * 2, 1024),
+                                   Entry{0, 0, nullptr, kHashSlotEmpty});
+    old_entries.swap(entries_);
+    const size_t mask = entries_.size() - 1;
+    for (const auto& entry : old_entries) {
+      if (entry.index != kHashSlotEmpty) {
+        size_t index = entry.hash & mask;
+        while (entries_[index].index != kHashSlotEmpty) {
+          index = (index + 1) & mask;
+        }
+        entries_[index] = entry;
+        values_[entry.index] = index;
+      }
+    }
+  }
+
+  std::vector<Entry> entries_;
+  // distinct value index -> position in entries_
+  std::vector<size_t> values_;
+  size_t size_;
+};
+
 static inline bool ListTypeSupported(const DataType& type) {
   switch (type.id()) {
     case Type::UINT8:
@@ -103,14 +183,15 @@ static inline bool ListTypeSupported(const DataType& type) {
     case Type::DOUBLE:
     case Type::BINARY:
     case Type::STRING:
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
     case Type::TIMESTAMP:
     case Type::NA:  // empty list
       // The above types are all supported.
       return true;
-    case Type::LIST: {
-      const ListType& list_type = static_cast<const ListType&>(type);
-      return ListTypeSupported(*list_type.value_type());
-    }
+    case Type::LIST:
+    case Type::LARGE_LIST:
+      return ListTypeSupported(*type.child(0)->type());
     default:
       break;
   }
@@ -264,6 +345,58 @@ class PandasBlock {
     return Status::OK();
   }
 
+  // Make the block a 1-dimensional NumPy view of the values of an Arrow array,
+  // without copying them. The view holds a reference to the array.
+  Status AllocateNDArrayView(int npy_type, const std::shared_ptr<Array>& arr,
+                             const void* values) {
+    npy_intp block_dims[1] = {num_rows_};
+
+    PyAcquireGIL lock;
+
+    PyArray_Descr* descr = GetSafeNumPyDtype(npy_type);
+    if (descr == nullptr) {
+      // Error occurred, trust error state is set
+      return Status::OK();
+    }
+    set_numpy_metadata(npy_type, arr->type().get(), descr);
+
+    PyObject* block_arr =
+        PyArray_NewFromDescr(&PyArray_Type, descr, 1, block_dims, nullptr,
+                             const_cast<void*>(values), NPY_ARRAY_CARRAY, nullptr);
+    RETURN_IF_PYERROR();
+
+    // Add a reference to the underlying Array. Otherwise the array may be
+    // deleted once we leave the block conversion.
+    auto capsule = new ArrowCapsule{{arr}};
+    PyObject* base = PyCapsule_New(reinterpret_cast<void*>(capsule), "arrow",
+                                   &ArrowCapsule_Destructor);
+    if (base == nullptr) {
+      delete capsule;
+      RETURN_IF_PYERROR();
+    }
+
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(block_arr), base) == -1) {
+      // Error occurred, trust that SetBaseObject set the error state
+      Py_XDECREF(base);
+      return Status::OK();
+    }
+
+    npy_intp placement_dims[1] = {num_columns_};
+    PyObject* placement_arr = PyArray_SimpleNew(1, placement_dims, NPY_INT64);
+    RETURN_IF_PYERROR();
+
+    block_arr_.reset(block_arr);
+    placement_arr_.reset(placement_arr);
+
+    block_data_ = reinterpret_cast<uint8_t*>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(block_arr)));
+
+    placement_data_ = reinterpret_cast<int64_t*>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(placement_arr)));
+
+    return Status::OK();
+  }
+
   int64_t num_rows_;
   int num_columns_;
 
@@ -290,6 +423,35 @@ inline const T* GetPrimitiveValues(const Array& arr) {
   return raw_values + arr.offset();
 }
 
+// Write convert(i) for the valid slots i of an array, and na_value for its null
+// slots. The validity bitmap is scanned in blocks so that the runs of valid
+// values are converted in a loop without branches, which the compiler can
+// vectorize, and only the blocks mixing valid and null values test each bit.
+template <typename OutType, typename Convert>
+inline void ConvertWithNulls(const Array& arr, OutType na_value, Convert&& convert,
+                             OutType* out_values) {
+  const uint8_t* valid_bits = arr.null_count() > 0 ? arr.null_bitmap_data() : nullptr;
+  ::arrow::internal::BitBlockCounter counter(valid_bits, arr.offset(), arr.length());
+  int64_t position = 0;
+  for (::arrow::internal::BitBlockCount block = counter.NextBlock(); block.length > 0;
+       block = counter.NextBlock()) {
+    const int64_t end = position + block.length;
+    if (block.AllSet()) {
+      for (int64_t i = position; i < end; ++i) {
+        out_values[i] = convert(i);
+      }
+    } else if (block.NoneSet()) {
+      std::fill(out_values + position, out_values + end, na_value);
+    } else {
+      for (int64_t i = position; i < end; ++i) {
+        out_values[i] =
+            BitUtil::GetBit(valid_bits, arr.offset() + i) ? convert(i) : na_value;
+      }
+    }
+    position = end;
+  }
+}
+
 template <typename T>
 inline void ConvertIntegerWithNulls(PandasOptions options, const ChunkedArray& data,
                                     double* out_values) {
@@ -297,10 +459,10 @@ inline void ConvertIntegerWithNulls(PandasOptions options, const ChunkedArray& d
     const auto& arr = *data.chunk(c);
     const T* in_values = GetPrimitiveValues<T>(arr);
     // Upcast to double, set NaN as appropriate
-
-    for (int i = 0; i < arr.length(); ++i) {
-      *out_values++ = arr.IsNull(i) ? NAN : static_cast<double>(in_values[i]);
-    }
+    ConvertWithNulls<double>(
+        arr, NAN, [in_values](int64_t i) { return static_cast<double>(in_values[i]); },
+        out_values);
+    out_values += arr.length();
   }
 }
 
@@ -386,16 +548,90 @@ static Status ConvertIntegerObjects(PandasOptions options, const ChunkedArray& d
   return Status::OK();
 }
 
+static Status WrapBytesFailed(const uint8_t* data, int32_t length) {
+  PyErr_Clear();
+  std::stringstream ss;
+  ss << "Wrapping " << std::string(reinterpret_cast<const char*>(data), length)
+     << " failed";
+  return Status::UnknownError(ss.str());
+}
+
+// Convert the values of a binary-like column to deduplicated Python objects.
+// The values are hashed and deduplicated without the GIL, so that columns
+// converted on different threads only contend for it to create the objects
+// of their distinct values.
+template <typename Type>
+inline typename std::enable_if<std::is_base_of<BinaryType, Type>::value, Status>::type
+ConvertBinaryLikeDeduplicated(const ChunkedArray& data, PyObject** out_values) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  BinaryMemoTable memo;
+  // row -> index of its distinct value, or -1 for nulls
+  std::vector<int32_t> indices(data.length());
+  std::vector<uint32_t> hashes;
+  int64_t row = 0;
+  for (int c = 0; c < data.num_chunks(); c++) {
+    const auto& arr = static_cast<const ArrayType&>(*data.chunk(c));
+    if (arr.length() == 0) {
+      continue;
+    }
+    hashes.resize(arr.length());
+    const auto& value_data = arr.value_data();
+    internal::HashBinaryValues(arr.raw_value_offsets(),
+                               value_data ? value_data->data() : nullptr, arr.length(),
+                               hashes.data());
+    const uint8_t* data_ptr;
+    int32_t length;
+    const bool has_nulls = arr.null_count() > 0;
+    for (int64_t i = 0; i < arr.length(); ++i, ++row) {
+      if (has_nulls && arr.IsNull(i)) {
+        indices[row] = -1;
+      } else {
+        data_ptr = arr.GetValue(i, &length);
+        indices[row] = memo.GetOrInsert(data_ptr, length, hashes[i]);
+      }
+    }
+  }
+
+  PyAcquireGIL lock;
+  std::vector<OwnedRef> objects(memo.size());
+  for (int32_t i = 0; i < memo.size(); ++i) {
+    int32_t length;
+    const uint8_t* data_ptr = memo.GetValue(i, &length);
+    objects[i].reset(WrapBytes<ArrayType>::Wrap(data_ptr, length));
+    if (objects[i].obj() == nullptr) {
+      return WrapBytesFailed(data_ptr, length);
+    }
+  }
+  for (const int32_t index : indices) {
+    PyObject* object = index == -1 ? Py_None : objects[index].obj();
+    Py_INCREF(object);
+    *out_values++ = object;
+  }
+  return Status::OK();
+}
+
+// The memo table holds 32-bit lengths, so that the values of large binary-like
+// arrays are not deduplicated
+template <typename Type>
+inline typename std::enable_if<std::is_base_of<LargeBinaryType, Type>::value,
+                               Status>::type
+ConvertBinaryLikeDeduplicated(const ChunkedArray& data, PyObject** out_values) {
+  return Status::NotImplemented("Deduplicating large binary values");
+}
+
 template <typename Type>
 inline Status ConvertBinaryLike(PandasOptions options, const ChunkedArray& data,
                                 PyObject** out_values) {
   using ArrayType = typename TypeTraits<Type>::ArrayType;
+  if (options.deduplicate_objects && std::is_base_of<BinaryType, Type>::value) {
+    return ConvertBinaryLikeDeduplicated<Type>(data, out_values);
+  }
   PyAcquireGIL lock;
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = static_cast<const ArrayType&>(*data.chunk(c));
 
     const uint8_t* data_ptr;
-    int32_t length;
+    typename Type::offset_type length;
     const bool has_nulls = data.null_count() > 0;
     for (int64_t i = 0; i < arr.length(); ++i) {
       if (has_nulls && arr.IsNull(i)) {
@@ -405,11 +641,7 @@ inline Status ConvertBinaryLike(PandasOptions options, const ChunkedArray& data,
         data_ptr = arr.GetValue(i, &length);
         *out_values = WrapBytes<ArrayType>::Wrap(data_ptr, length);
         if (*out_values == nullptr) {
-          PyErr_Clear();
-          std::stringstream ss;
-          ss << "Wrapping "
-             << std::string(reinterpret_cast<const char*>(data_ptr), length) << " failed";
-          return Status::UnknownError(ss.str());
+          return WrapBytesFailed(data_ptr, length);
         }
       }
       ++out_values;
@@ -477,14 +709,15 @@ inline Status ConvertStruct(PandasOptions options, const ChunkedArray& data,
   int32_t num_fields = arr->num_fields();
   auto array_type = arr->type();
   std::vector<OwnedRef> fields_data(num_fields);
+  std::vector<std::shared_ptr<Array>> fields;
   OwnedRef dict_item;
   for (int c = 0; c < data.num_chunks(); c++) {
     auto arr = static_cast<const StructArray*>(data.chunk(c).get());
-    // Convert the struct arrays first
+    // Convert the struct arrays first, null where the struct is
+    RETURN_NOT_OK(arr->Flatten(default_memory_pool(), &fields));
     for (int32_t i = 0; i < num_fields; i++) {
       PyObject* numpy_array;
-      RETURN_NOT_OK(ConvertArrayToPandas(options, arr->field(static_cast<int>(i)),
-                                         nullptr, &numpy_array));
+      RETURN_NOT_OK(ConvertArrayToPandas(options, fields[i], nullptr, &numpy_array));
       fields_data[i].reset(numpy_array);
     }
 
@@ -501,7 +734,7 @@ inline Status ConvertStruct(PandasOptions options, const ChunkedArray& data,
         for (int32_t field_idx = 0; field_idx < num_fields; ++field_idx) {
           OwnedRef field_value;
           auto name = array_type->child(static_cast<int>(field_idx))->name();
-          if (!arr->field(static_cast<int>(field_idx))->IsNull(i)) {
+          if (!fields[field_idx]->IsNull(i)) {
             // Value exists in child array, obtain it
             auto array = reinterpret_cast<PyArrayObject*>(fields_data[field_idx].obj());
             auto ptr = reinterpret_cast<const char*>(PyArray_GETPTR1(array, i));
@@ -528,17 +761,19 @@ inline Status ConvertStruct(PandasOptions options, const ChunkedArray& data,
   return Status::OK();
 }
 
-template <typename ArrowType>
+template <typename ArrowType, typename ListArrayType = ListArray>
 inline Status ConvertListsLike(PandasOptions options, const std::shared_ptr<Column>& col,
                                PyObject** out_values) {
   const ChunkedArray& data = *col->data().get();
-  const auto& list_type = static_cast<const ListType&>(*col->type());
+  const auto& list_type =
+      static_cast<const typename ListArrayType::TypeClass&>(*col->type());
 
-  // Get column of underlying value arrays
+  // Get column of the values spanned by each chunk, without the values of
+  // the lists sliced off
   std::vector<std::shared_ptr<Array>> value_arrays;
   for (int c = 0; c < data.num_chunks(); c++) {
-    const auto& arr = static_cast<const ListArray&>(*data.chunk(c));
-    value_arrays.emplace_back(arr.values());
+    const auto& arr = static_cast<const ListArrayType&>(*data.chunk(c));
+    value_arrays.emplace_back(arr.Flatten());
   }
   auto flat_column = std::make_shared<Column>(list_type.value_field(), value_arrays);
   // TODO(ARROW-489): Currently we don't have a Python reference for single columns.
@@ -554,7 +789,9 @@ inline Status ConvertListsLike(PandasOptions options, const std::shared_ptr<Colu
 
   int64_t chunk_offset = 0;
   for (int c = 0; c < data.num_chunks(); c++) {
-    auto arr = std::static_pointer_cast<ListArray>(data.chunk(c));
+    auto arr = std::static_pointer_cast<ListArrayType>(data.chunk(c));
+    // Rebase the offsets of sliced lists on their flattened values
+    const int64_t values_offset = arr->length() > 0 ? arr->value_offset(0) : 0;
 
     const bool has_nulls = data.null_count() > 0;
     for (int64_t i = 0; i < arr->length(); ++i) {
@@ -562,8 +799,10 @@ inline Status ConvertListsLike(PandasOptions options, const std::shared_ptr<Colu
         Py_INCREF(Py_None);
         *out_values = Py_None;
       } else {
-        OwnedRef start(PyLong_FromLongLong(arr->value_offset(i) + chunk_offset));
-        OwnedRef end(PyLong_FromLongLong(arr->value_offset(i + 1) + chunk_offset));
+        OwnedRef start(
+            PyLong_FromLongLong(arr->value_offset(i) - values_offset + chunk_offset));
+        OwnedRef end(
+            PyLong_FromLongLong(arr->value_offset(i + 1) - values_offset + chunk_offset));
         OwnedRef slice(PySlice_New(start.obj(), end.obj(), nullptr));
 
         if (ARROW_PREDICT_FALSE(slice.obj() == nullptr)) {
@@ -581,7 +820,7 @@ inline Status ConvertListsLike(PandasOptions options, const std::shared_ptr<Colu
     }
     RETURN_IF_PYERROR();
 
-    chunk_offset += arr->values()->length();
+    chunk_offset += value_arrays[c]->length();
   }
 
   return Status::OK();
@@ -594,9 +833,9 @@ inline void ConvertNumericNullable(const ChunkedArray& data, T na_value, T* out_
     const T* in_values = GetPrimitiveValues<T>(arr);
 
     if (arr.null_count() > 0) {
-      for (int64_t i = 0; i < arr.length(); ++i) {
-        *out_values++ = arr.IsNull(i) ? na_value : in_values[i];
-      }
+      ConvertWithNulls<T>(arr, na_value, [in_values](int64_t i) { return in_values[i]; },
+                          out_values);
+      out_values += arr.length();
     } else {
       memcpy(out_values, in_values, sizeof(T) * arr.length());
       out_values += arr.length();
@@ -611,9 +850,11 @@ inline void ConvertNumericNullableCast(const ChunkedArray& data, OutType na_valu
     const auto& arr = *data.chunk(c);
     const InType* in_values = GetPrimitiveValues<InType>(arr);
 
-    for (int64_t i = 0; i < arr.length(); ++i) {
-      *out_values++ = arr.IsNull(i) ? na_value : static_cast<OutType>(in_values[i]);
-    }
+    ConvertWithNulls<OutType>(
+        arr, na_value,
+        [in_values](int64_t i) { return static_cast<OutType>(in_values[i]); },
+        out_values);
+    out_values += arr.length();
   }
 }
 
@@ -623,10 +864,22 @@ inline void ConvertDatetimeNanos(const ChunkedArray& data, int64_t* out_values)
     const auto& arr = *data.chunk(c);
     const T* in_values = GetPrimitiveValues<T>(arr);
 
+    // Scale all the values first, in a loop without branches that the compiler
+    // can vectorize, and then overwrite the nulls
     for (int64_t i = 0; i < arr.length(); ++i) {
-      *out_values++ = arr.IsNull(i) ? kPandasTimestampNull
-                                    : (static_cast<int64_t>(in_values[i]) * SHIFT);
+      out_values[i] = static_cast<int64_t>(in_values[i]) * SHIFT;
+    }
+    if (arr.null_count() > 0) {
+      ::arrow::internal::BitmapReader valid_reader(arr.null_bitmap_data(), arr.offset(),
+                                                   arr.length());
+      for (int64_t i = 0; i < arr.length(); ++i) {
+        if (valid_reader.IsNotSet()) {
+          out_values[i] = kPandasTimestampNull;
+        }
+        valid_reader.Next();
+      }
     }
+    out_values += arr.length();
   }
 }
 
@@ -729,6 +982,10 @@ class ObjectBlock : public PandasBlock {
       RETURN_NOT_OK(ConvertBinaryLike<BinaryType>(options_, data, out_buffer));
     } else if (type == Type::STRING) {
       RETURN_NOT_OK(ConvertBinaryLike<StringType>(options_, data, out_buffer));
+    } else if (type == Type::LARGE_BINARY) {
+      RETURN_NOT_OK(ConvertBinaryLike<LargeBinaryType>(options_, data, out_buffer));
+    } else if (type == Type::LARGE_STRING) {
+      RETURN_NOT_OK(ConvertBinaryLike<LargeStringType>(options_, data, out_buffer));
     } else if (type == Type::FIXED_SIZE_BINARY) {
       RETURN_NOT_OK(ConvertFixedSizeBinary(options_, data, out_buffer));
     } else if (type == Type::TIME32) {
@@ -755,7 +1012,10 @@ class ObjectBlock : public PandasBlock {
         CONVERTLISTSLIKE_CASE(DoubleType, DOUBLE)
         CONVERTLISTSLIKE_CASE(BinaryType, BINARY)
         CONVERTLISTSLIKE_CASE(StringType, STRING)
+        CONVERTLISTSLIKE_CASE(LargeBinaryType, LARGE_BINARY)
+        CONVERTLISTSLIKE_CASE(LargeStringType, LARGE_STRING)
         CONVERTLISTSLIKE_CASE(ListType, LIST)
+        CONVERTLISTSLIKE_CASE(LargeListType, LARGE_LIST)
         CONVERTLISTSLIKE_CASE(NullType, NA)
         default: {
           std::stringstream ss;
@@ -764,6 +1024,10 @@ class ObjectBlock : public PandasBlock {
           return Status::NotImplemented(ss.str());
         }
       }
+    } else if (type == Type::LARGE_LIST) {
+      // The value type was checked by ListTypeSupported
+      RETURN_NOT_OK((ConvertListsLike<LargeListType, LargeListArray>(options_, col,
+                                                                     out_buffer)));
     } else if (type == Type::STRUCT) {
       RETURN_NOT_OK(ConvertStruct(options_, data, out_buffer));
     } else {
@@ -1010,6 +1274,24 @@ class DatetimeTZBlock : public DatetimeBlock {
   // Like Categorical, the internal ndarray is 1-dimensional
   Status Allocate() override { return AllocateDatetime(1); }
 
+  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
+               int64_t rel_placement) override {
+    const auto& ts_type = static_cast<const TimestampType&>(*col->type());
+    const ChunkedArray& data = *col->data();
+    if (ts_type.unit() == TimeUnit::NANO && data.num_chunks() == 1 &&
+        data.null_count() == 0) {
+      // The values already are what pandas expects, so the block can be a view
+      const std::shared_ptr<Array>& arr = data.chunk(0);
+      RETURN_NOT_OK(AllocateNDArrayView(NPY_DATETIME, arr,
+                                        GetPrimitiveValues<int64_t>(*arr)));
+    } else {
+      RETURN_NOT_OK(Allocate());
+      RETURN_NOT_OK(DatetimeBlock::Write(col, abs_placement, rel_placement));
+    }
+    placement_data_[rel_placement] = abs_placement;
+    return Status::OK();
+  }
+
   Status GetPyResult(PyObject** output) override {
     PyObject* result = PyDict_New();
     RETURN_IF_PYERROR();
@@ -1070,7 +1352,8 @@ class CategoricalBlock : public PandasBlock {
 
     if (!needs_copy_ && data.num_chunks() == 1 && indices_first->null_count() == 0) {
       RETURN_NOT_OK(CheckIndices(*indices_first, dict_arr_first.dictionary()->length()));
-      RETURN_NOT_OK(AllocateNDArrayFromIndices<T>(npy_type, indices_first));
+      RETURN_NOT_OK(AllocateNDArrayView(npy_type, indices_first,
+                                        GetPrimitiveValues<T>(*indices_first)));
     } else {
       if (options_.zero_copy_only) {
         std::stringstream ss;
@@ -1176,58 +1459,6 @@ class CategoricalBlock : public PandasBlock {
   PyObject* dictionary() const { return dictionary_.obj(); }
 
  protected:
-  template <typename T>
-  Status AllocateNDArrayFromIndices(int npy_type,
-                                    const std::shared_ptr<PrimitiveArray>& indices) {
-    npy_intp block_dims[1] = {num_rows_};
-
-    const T* in_values = GetPrimitiveValues<T>(*indices);
-    void* data = const_cast<T*>(in_values);
-
-    PyAcquireGIL lock;
-
-    PyArray_Descr* descr = GetSafeNumPyDtype(npy_type);
-    if (descr == nullptr) {
-      // Error occurred, trust error state is set
-      return Status::OK();
-    }
-
-    PyObject* block_arr = PyArray_NewFromDescr(&PyArray_Type, descr, 1, block_dims,
-                                               nullptr, data, NPY_ARRAY_CARRAY, nullptr);
-    RETURN_IF_PYERROR();
-
-    // Add a reference to the underlying Array. Otherwise the array may be
-    // deleted once we leave the block conversion.
-    auto capsule = new ArrowCapsule{{indices}};
-    PyObject* base = PyCapsule_New(reinterpret_cast<void*>(capsule), "arrow",
-                                   &ArrowCapsule_Destructor);
-    if (base == nullptr) {
-      delete capsule;
-      RETURN_IF_PYERROR();
-    }
-
-    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(block_arr), base) == -1) {
-      // Error occurred, trust that SetBaseObject set the error state
-      Py_XDECREF(base);
-      return Status::OK();
-    }
-
-    npy_intp placement_dims[1] = {num_columns_};
-    PyObject* placement_arr = PyArray_SimpleNew(1, placement_dims, NPY_INT64);
-    RETURN_IF_PYERROR();
-
-    block_arr_.reset(block_arr);
-    placement_arr_.reset(placement_arr);
-
-    block_data_ = reinterpret_cast<uint8_t*>(
-        PyArray_DATA(reinterpret_cast<PyArrayObject*>(block_arr)));
-
-    placement_data_ = reinterpret_cast<int64_t*>(
-        PyArray_DATA(reinterpret_cast<PyArrayObject*>(placement_arr)));
-
-    return Status::OK();
-  }
-
   MemoryPool* pool_;
   OwnedRefNoGIL dictionary_;
   bool ordered_;
@@ -1333,12 +1564,17 @@ static Status GetPandasBlockType(const Column& col, const PandasOptions& options
         *output_type = PandasBlock::DATETIME;
       }
     } break;
-    case Type::LIST: {
-      auto list_type = std::static_pointer_cast<ListType>(col.type());
-      if (!ListTypeSupported(*list_type->value_type())) {
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      *output_type = PandasBlock::OBJECT;
+      break;
+    case Type::LIST:
+    case Type::LARGE_LIST: {
+      const auto& value_type = col.type()->child(0)->type();
+      if (!ListTypeSupported(*value_type)) {
         std::stringstream ss;
         ss << "Not implemented type for list in DataFrameBlock: "
-           << list_type->value_type()->ToString();
+           << value_type->ToString();
         return Status::NotImplemented(ss.str());
       }
       *output_type = PandasBlock::OBJECT;
@@ -1366,11 +1602,15 @@ class DataFrameBlockCreator {
  public:
   explicit DataFrameBlockCreator(const PandasOptions& options,
                                  const std::shared_ptr<Table>& table, MemoryPool* pool)
-      : table_(table), options_(options), pool_(pool) {}
+      : num_rows_(table->num_rows()), options_(options), pool_(pool) {
+    for (int i = 0; i < table->num_columns(); ++i) {
+      columns_.push_back(table->column(i));
+    }
+  }
 
   Status Convert(int nthreads, PyObject** output) {
-    column_types_.resize(table_->num_columns());
-    column_block_placement_.resize(table_->num_columns());
+    column_types_.resize(columns_.size());
+    column_block_placement_.resize(columns_.size());
     type_counts_.clear();
     blocks_.clear();
 
@@ -1381,21 +1621,21 @@ class DataFrameBlockCreator {
   }
 
   Status CreateBlocks() {
-    for (int i = 0; i < table_->num_columns(); ++i) {
-      std::shared_ptr<Column> col = table_->column(i);
+    for (int i = 0; i < static_cast<int>(columns_.size()); ++i) {
+      const std::shared_ptr<Column>& col = columns_[i];
       PandasBlock::type output_type = PandasBlock::OBJECT;
       RETURN_NOT_OK(GetPandasBlockType(*col, options_, &output_type));
 
       int block_placement = 0;
       std::shared_ptr<PandasBlock> block;
       if (output_type == PandasBlock::CATEGORICAL) {
-        block = std::make_shared<CategoricalBlock>(options_, pool_, table_->num_rows());
+        block = std::make_shared<CategoricalBlock>(options_, pool_, num_rows_);
         categorical_blocks_[i] = block;
       } else if (output_type == PandasBlock::DATETIME_WITH_TZ) {
         const auto& ts_type = static_cast<const TimestampType&>(*col->type());
-        block = std::make_shared<DatetimeTZBlock>(options_, ts_type.timezone(),
-                                                  table_->num_rows());
-        RETURN_NOT_OK(block->Allocate());
+        // Allocated when writing, as it may be a view of the column
+        block =
+            std::make_shared<DatetimeTZBlock>(options_, ts_type.timezone(), num_rows_);
         datetimetz_blocks_[i] = block;
       } else {
         auto it = type_counts_.find(output_type);
@@ -1417,7 +1657,7 @@ class DataFrameBlockCreator {
       PandasBlock::type type = static_cast<PandasBlock::type>(it.first);
       std::shared_ptr<PandasBlock> block;
       RETURN_NOT_OK(
-          MakeBlock(this->options_, type, this->table_->num_rows(), it.second, &block));
+          MakeBlock(this->options_, type, this->num_rows_, it.second, &block));
       this->blocks_[type] = block;
     }
     return Status::OK();
@@ -1450,12 +1690,19 @@ class DataFrameBlockCreator {
 
   Status WriteTableToBlocks(int nthreads) {
     auto WriteColumn = [this](int i) {
+      ARROW_TRACE_SPAN("pandas", "WriteColumn");
       std::shared_ptr<PandasBlock> block;
       RETURN_NOT_OK(this->GetBlock(i, &block));
-      return block->Write(this->table_->column(i), i, this->column_block_placement_[i]);
+      RETURN_NOT_OK(
+          block->Write(this->columns_[i], i, this->column_block_placement_[i]));
+      if (this->options_.self_destruct) {
+        // Free the memory of the column if nothing else references it
+        this->columns_[i].reset();
+      }
+      return Status::OK();
     };
 
-    int num_tasks = table_->num_columns();
+    int num_tasks = static_cast<int>(columns_.size());
     nthreads = std::min<int>(nthreads, num_tasks);
     if (nthreads == 1) {
       for (int i = 0; i < num_tasks; ++i) {
@@ -1496,7 +1743,8 @@ class DataFrameBlockCreator {
   }
 
  private:
-  std::shared_ptr<Table> table_;
+  std::vector<std::shared_ptr<Column>> columns_;
+  int64_t num_rows_;
 
   // column num -> block type id
   std::vector<PandasBlock::type> column_types_;
@@ -1659,15 +1907,31 @@ class ArrowDeserializer {
     return Status::OK();
   }
 
+  Status Visit(const TimestampType& type) {
+    // NumPy has the units of Arrow timestamps, so the values can be used as is
+    if (data_.num_chunks() == 1 && data_.null_count() == 0) {
+      return ConvertValuesZeroCopy<Type::TIMESTAMP>(options_, NPY_DATETIME,
+                                                    data_.chunk(0));
+    } else if (options_.zero_copy_only) {
+      std::stringstream ss;
+      ss << "Needed to copy " << data_.num_chunks() << " chunks with "
+         << data_.null_count() << " nulls, but zero_copy_only was True";
+      return Status::Invalid(ss.str());
+    }
+    return ConvertDatetimeLike<TimestampType>();
+  }
+
   template <typename Type>
-  typename std::enable_if<std::is_base_of<DateType, Type>::value ||
-                              std::is_base_of<TimestampType, Type>::value,
-                          Status>::type
-  Visit(const Type& type) {
+  typename std::enable_if<std::is_base_of<DateType, Type>::value, Status>::type Visit(
+      const Type& type) {
     if (options_.zero_copy_only) {
       return Status::Invalid("Copy Needed, but zero_copy_only was True");
     }
+    return ConvertDatetimeLike<Type>();
+  }
 
+  template <typename Type>
+  Status ConvertDatetimeLike() {
     constexpr int TYPE = Type::type_id;
     using traits = internal::arrow_traits<TYPE>;
     using c_type = typename Type::c_type;
@@ -1684,9 +1948,11 @@ class ArrowDeserializer {
       const auto& arr = *data_.chunk(c);
       const c_type* in_values = GetPrimitiveValues<c_type>(arr);
 
-      for (int64_t i = 0; i < arr.length(); ++i) {
-        *out_values++ = arr.IsNull(i) ? na_value : static_cast<T>(in_values[i]) / kShift;
-      }
+      ConvertWithNulls<T>(
+          arr, na_value,
+          [in_values](int64_t i) { return static_cast<T>(in_values[i]) / kShift; },
+          out_values);
+      out_values += arr.length();
     }
     return Status::OK();
   }
@@ -1746,8 +2012,10 @@ class ArrowDeserializer {
 
   // UTF8 strings
   template <typename Type>
-  typename std::enable_if<std::is_base_of<BinaryType, Type>::value, Status>::type Visit(
-      const Type& type) {
+  typename std::enable_if<std::is_base_of<BinaryType, Type>::value ||
+                              std::is_base_of<LargeBinaryType, Type>::value,
+                          Status>::type
+  Visit(const Type& type) {
     return VisitObjects(ConvertBinaryLike<Type>);
   }
 
@@ -1805,8 +2073,11 @@ class ArrowDeserializer {
       CONVERTVALUES_LISTSLIKE_CASE(DoubleType, DOUBLE)
       CONVERTVALUES_LISTSLIKE_CASE(BinaryType, BINARY)
       CONVERTVALUES_LISTSLIKE_CASE(StringType, STRING)
+      CONVERTVALUES_LISTSLIKE_CASE(LargeBinaryType, LARGE_BINARY)
+      CONVERTVALUES_LISTSLIKE_CASE(LargeStringType, LARGE_STRING)
       CONVERTVALUES_LISTSLIKE_CASE(Decimal128Type, DECIMAL)
       CONVERTVALUES_LISTSLIKE_CASE(ListType, LIST)
+      CONVERTVALUES_LISTSLIKE_CASE(LargeListType, LARGE_LIST)
       default: {
         std::stringstream ss;
         ss << "Not implemented type for lists: " << list_type->value_type()->ToString();
@@ -1832,8 +2103,30 @@ class ArrowDeserializer {
     return Status::OK();
   }
 
+  Status Visit(const LargeListType& type) {
+    if (options_.zero_copy_only) {
+      return Status::Invalid("LargeListType needs copies, but zero_copy_only was True");
+    }
+    if (!ListTypeSupported(*type.value_type())) {
+      std::stringstream ss;
+      ss << "Not implemented type for lists: " << type.value_type()->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+    RETURN_NOT_OK(AllocateOutput(NPY_OBJECT));
+    auto out_values = reinterpret_cast<PyObject**>(PyArray_DATA(arr_));
+    return ConvertListsLike<LargeListType, LargeListArray>(options_, col_, out_values);
+  }
+
   Status Visit(const UnionType& type) { return Status::NotImplemented("union type"); }
 
+  Status Visit(const RunLengthEncodedType& type) {
+    return Status::NotImplemented("run_length_encoded type");
+  }
+
+  Status Visit(const StringViewType& type) {
+    return Status::NotImplemented("string_view type");
+  }
+
   Status Convert(PyObject** out) {
     RETURN_NOT_OK(VisitTypeInline(*col_->type(), this));
     *out = result_;
@@ -1874,10 +2167,20 @@ Status ConvertTableToPandas(PandasOptions options,
                             const std::shared_ptr<Table>& table, int nthreads,
                             MemoryPool* pool, PyObject** out) {
   std::shared_ptr<Table> current_table = table;
+  return ConvertTableToPandas(options, categorical_columns, &current_table, nthreads,
+                              pool, out);
+}
+
+Status ConvertTableToPandas(PandasOptions options,
+                            const std::unordered_set<std::string>& categorical_columns,
+                            std::shared_ptr<Table>* table, int nthreads,
+                            MemoryPool* pool, PyObject** out) {
+  std::shared_ptr<Table> current_table;
+  current_table.swap(*table);
   if (!categorical_columns.empty()) {
     FunctionContext ctx;
-    for (int i = 0; i < table->num_columns(); i++) {
-      const Column& col = *table->column(i);
+    for (int i = 0; i < current_table->num_columns(); i++) {
+      const Column& col = *current_table->column(i);
       if (categorical_columns.count(col.name())) {
         Datum out;
         RETURN_NOT_OK(DictionaryEncode(&ctx, Datum(col.data()), &out));
@@ -1892,6 +2195,8 @@ Status ConvertTableToPandas(PandasOptions options,
   }
 
   DataFrameBlockCreator helper(options, current_table, pool);
+  // The helper holds the only references to the columns that the table held
+  current_table.reset();
   return helper.Convert(nthreads, out);
 }
 
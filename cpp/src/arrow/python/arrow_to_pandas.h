@@ -45,11 +45,19 @@ struct PandasOptions {
   bool strings_to_categorical;
   bool zero_copy_only;
   bool integer_object_nulls;
+  /// If true, equal values of string and binary columns that are converted
+  /// to Python objects share one object
+  bool deduplicate_objects;
+  /// If true, a table releases its columns as they are converted, see
+  /// ConvertTableToPandas
+  bool self_destruct;
 
   PandasOptions()
       : strings_to_categorical(false),
         zero_copy_only(false),
-        integer_object_nulls(false) {}
+        integer_object_nulls(false),
+        deduplicate_objects(false),
+        self_destruct(false) {}
 };
 
 ARROW_EXPORT
@@ -80,6 +88,18 @@ Status ConvertTableToPandas(PandasOptions options,
                             const std::shared_ptr<Table>& table, int nthreads,
                             MemoryPool* pool, PyObject** out);
 
+/// Convert a whole table as efficiently as possible to a pandas.DataFrame,
+/// taking over the reference to the table, which is reset.
+///
+/// With options.self_destruct, each column is released once it is converted,
+/// so that its memory is freed during the conversion if the caller holds no
+/// other reference to it.
+ARROW_EXPORT
+Status ConvertTableToPandas(PandasOptions options,
+                            const std::unordered_set<std::string>& categorical_columns,
+                            std::shared_ptr<Table>* table, int nthreads,
+                            MemoryPool* pool, PyObject** out);
+
 }  // namespace py
 }  // namespace arrow
 
@@ -104,7 +104,7 @@ Status DeserializeArray(const Array& array, int64_t offset, PyObject* base,
   return Status::OK();
 }
 
-Status GetValue(PyObject* context, const UnionArray& parent, const Array& arr,
+Status GetValue(PyObject* context, const UnionArray* parent, const Array& arr,
                 int64_t index, int32_t type, PyObject* base,
                 const SerializedPyObject& blobs, PyObject** result) {
   switch (arr.type()->id()) {
@@ -163,7 +163,9 @@ Status GetValue(PyObject* context, const UnionArray& parent, const Array& arr,
       }
     }
     default: {
-      const std::string& child_name = parent.type()->child(type)->name();
+      DCHECK(parent != nullptr) << "array of type " << arr.type()->ToString()
+                                << " outside of a union";
+      const std::string& child_name = parent->type()->child(type)->name();
       if (child_name == "tensor") {
         return DeserializeArray(arr, index, base, blobs, result);
       } else if (child_name == "buffer") {
@@ -180,8 +182,18 @@ Status GetValue(PyObject* context, const UnionArray& parent, const Array& arr,
 }
 
 #define DESERIALIZE_SEQUENCE(CREATE_FN, SET_ITEM_FN)                                     \
-  const auto& data = static_cast<const UnionArray&>(array);                              \
   OwnedRef result(CREATE_FN(stop_idx - start_idx));                                      \
+  if (array.type_id() != Type::UNION) {                                                  \
+    /* All of the elements have the type of the array, see SequenceBuilder */            \
+    for (int64_t i = start_idx; i < stop_idx; ++i) {                                     \
+      PyObject* value;                                                                   \
+      RETURN_NOT_OK(GetValue(context, nullptr, array, i, 0, base, blobs, &value));       \
+      SET_ITEM_FN(result.obj(), i - start_idx, value);                                   \
+    }                                                                                    \
+    *out = result.detach();                                                              \
+    return Status::OK();                                                                 \
+  }                                                                                      \
+  const auto& data = static_cast<const UnionArray&>(array);                              \
   const uint8_t* type_ids = data.raw_type_ids();                                         \
   const int32_t* value_offsets = data.raw_value_offsets();                               \
   for (int64_t i = start_idx; i < stop_idx; ++i) {                                       \
@@ -192,8 +204,8 @@ Status GetValue(PyObject* context, const UnionArray& parent, const Array& arr,
       int64_t offset = value_offsets[i];                                                 \
       uint8_t type = type_ids[i];                                                        \
       PyObject* value;                                                                   \
-      RETURN_NOT_OK(GetValue(context, data, *data.UnsafeChild(type), offset, type, base, \
-                             blobs, &value));                                            \
+      RETURN_NOT_OK(GetValue(context, &data, *data.UnsafeChild(type), offset, type,      \
+                             base, blobs, &value));                                      \
       SET_ITEM_FN(result.obj(), i - start_idx, value);                                   \
     }                                                                                    \
   }                                                                                      \
@@ -215,8 +227,20 @@ Status DeserializeTuple(PyObject* context, const Array& array, int64_t start_idx
 Status DeserializeSet(PyObject* context, const Array& array, int64_t start_idx,
                       int64_t stop_idx, PyObject* base, const SerializedPyObject& blobs,
                       PyObject** out) {
-  const auto& data = static_cast<const UnionArray&>(array);
   OwnedRef result(PySet_New(nullptr));
+  if (array.type_id() != Type::UNION) {
+    // All of the elements have the type of the array, see SequenceBuilder
+    for (int64_t i = start_idx; i < stop_idx; ++i) {
+      PyObject* value;
+      RETURN_NOT_OK(GetValue(context, nullptr, array, i, 0, base, blobs, &value));
+      if (PySet_Add(result.obj(), value) < 0) {
+        RETURN_IF_PYERROR();
+      }
+    }
+    *out = result.detach();
+    return Status::OK();
+  }
+  const auto& data = static_cast<const UnionArray&>(array);
   const uint8_t* type_ids = data.raw_type_ids();
   const int32_t* value_offsets = data.raw_value_offsets();
   for (int64_t i = start_idx; i < stop_idx; ++i) {
@@ -229,7 +253,7 @@ Status DeserializeSet(PyObject* context, const Array& array, int64_t start_idx,
       int32_t offset = value_offsets[i];
       int8_t type = type_ids[i];
       PyObject* value;
-      RETURN_NOT_OK(GetValue(context, data, *data.UnsafeChild(type), offset, type, base,
+      RETURN_NOT_OK(GetValue(context, &data, *data.UnsafeChild(type), offset, type, base,
                              blobs, &value));
       if (PySet_Add(result.obj(), value) < 0) {
         RETURN_IF_PYERROR();
@@ -268,11 +292,11 @@ Status ReadSerializedObject(io::RandomAccessFile* src, SerializedPyObject* out)
     int64_t size;
     RETURN_NOT_OK(src->ReadAt(offset, sizeof(int64_t), &bytes_read,
                               reinterpret_cast<uint8_t*>(&size)));
-    RETURN_NOT_OK(src->Tell(&offset));
+    offset += bytes_read;
     std::shared_ptr<Buffer> buffer;
     RETURN_NOT_OK(src->ReadAt(offset, size, &buffer));
     out->buffers.push_back(buffer);
-    RETURN_NOT_OK(src->Tell(&offset));
+    offset += buffer->size();
   }
 
   return Status::OK();
@@ -289,41 +313,44 @@ Status DeserializeObject(PyObject* context, const SerializedPyObject& obj, PyObj
 
 Status GetSerializedFromComponents(int num_tensors, int num_buffers, PyObject* data,
                                    SerializedPyObject* out) {
-  PyAcquireGIL gil;
-  const Py_ssize_t data_length = PyList_Size(data);
-  RETURN_IF_PYERROR();
+  std::vector<std::shared_ptr<Buffer>> components;
+  {
+    PyAcquireGIL gil;
+    const Py_ssize_t data_length = PyList_Size(data);
+    RETURN_IF_PYERROR();
+
+    for (Py_ssize_t i = 0; i < data_length; ++i) {
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(unwrap_buffer(PyList_GET_ITEM(data, i), &buffer));
+      components.push_back(std::move(buffer));
+    }
+  }
+  return GetSerializedFromComponents(num_tensors, num_buffers, components, out);
+}
 
-  const Py_ssize_t expected_data_length = 1 + num_tensors * 2 + num_buffers;
-  if (data_length != expected_data_length) {
+Status GetSerializedFromComponents(int num_tensors, int num_buffers,
+                                   const std::vector<std::shared_ptr<Buffer>>& data,
+                                   SerializedPyObject* out) {
+  const size_t expected_data_length = 1 + num_tensors * 2 + num_buffers;
+  if (data.size() != expected_data_length) {
     return Status::Invalid("Invalid number of buffers in data");
   }
 
-  auto GetBuffer = [&data](Py_ssize_t index, std::shared_ptr<Buffer>* out) {
-    PyObject* py_buf = PyList_GET_ITEM(data, index);
-    return unwrap_buffer(py_buf, out);
-  };
-
-  Py_ssize_t buffer_index = 0;
+  size_t buffer_index = 0;
 
   // Read the union batch describing object structure
   {
-    std::shared_ptr<Buffer> data_buffer;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &data_buffer));
-    gil.release();
-    io::BufferReader buf_reader(data_buffer);
+    io::BufferReader buf_reader(data[buffer_index++]);
     std::shared_ptr<RecordBatchReader> reader;
     RETURN_NOT_OK(ipc::RecordBatchStreamReader::Open(&buf_reader, &reader));
     RETURN_NOT_OK(reader->ReadNext(&out->batch));
-    gil.acquire();
   }
 
   // Zero-copy reconstruct tensors
   for (int i = 0; i < num_tensors; ++i) {
-    std::shared_ptr<Buffer> metadata;
-    std::shared_ptr<Buffer> body;
+    const std::shared_ptr<Buffer>& metadata = data[buffer_index++];
+    const std::shared_ptr<Buffer>& body = data[buffer_index++];
     std::shared_ptr<Tensor> tensor;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &metadata));
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &body));
 
     ipc::Message message(metadata, body);
 
@@ -331,11 +358,9 @@ Status GetSerializedFromComponents(int num_tensors, int num_buffers, PyObject* d
     out->tensors.emplace_back(std::move(tensor));
   }
 
-  // Unwrap and append buffers
+  // Append buffers
   for (int i = 0; i < num_buffers; ++i) {
-    std::shared_ptr<Buffer> buffer;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &buffer));
-    out->buffers.emplace_back(std::move(buffer));
+    out->buffers.push_back(data[buffer_index++]);
   }
 
   return Status::OK();
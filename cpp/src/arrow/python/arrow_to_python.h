@@ -61,6 +61,20 @@ ARROW_EXPORT
 Status GetSerializedFromComponents(int num_tensors, int num_buffers, PyObject* data,
                                    SerializedPyObject* out);
 
+/// \brief Reconstruct SerializedPyObject from the buffers produced by
+/// SerializedPyObject::GetComponents, without copying them or needing the GIL
+///
+/// \param[in] num_tensors number of tensors in the object
+/// \param[in] num_buffers number of buffers in the object
+/// \param[in] data the buffers. Must be 1 + num_tensors * 2 + num_buffers in
+/// length
+/// \param[out] out the reconstructed object
+/// \return Status
+ARROW_EXPORT
+Status GetSerializedFromComponents(int num_tensors, int num_buffers,
+                                   const std::vector<std::shared_ptr<Buffer>>& data,
+                                   SerializedPyObject* out);
+
 /// \brief Reconstruct Python object from Arrow-serialized representation
 /// \param[in] context Serialization context which contains custom serialization
 /// and deserialization callbacks. Can be any Python object with a
@@ -980,6 +980,123 @@ Status AppendPySequence(PyObject* obj, int64_t size,
   return converter->AppendMultiple(obj, size);
 }
 
+// The kinds of Python scalars that the single-pass conversion handles, in the
+// order from the least to the most preferred by ScalarVisitor::GetType()
+enum class ScalarKind { NONE, UNICODE, BINARY, BOOL, INT, FLOAT, OTHER };
+
+static ScalarKind GetScalarKind(PyObject* obj) {
+  if (obj == Py_None || internal::PyFloat_IsNaN(obj)) {
+    return ScalarKind::NONE;
+  } else if (PyBool_Check(obj)) {
+    return ScalarKind::BOOL;
+  } else if (PyFloat_Check(obj)) {
+    return ScalarKind::FLOAT;
+  } else if (internal::IsPyInteger(obj)) {
+    return ScalarKind::INT;
+  } else if (PyBytes_Check(obj)) {
+    return ScalarKind::BINARY;
+  } else if (PyUnicode_Check(obj)) {
+    return ScalarKind::UNICODE;
+  }
+  return ScalarKind::OTHER;
+}
+
+// Whether a sequence whose values are of the kind *kind* and *item_kind* would
+// be inferred to have the type of *kind*
+static bool KindAccepts(ScalarKind kind, ScalarKind item_kind) {
+  switch (kind) {
+    case ScalarKind::FLOAT:
+    case ScalarKind::INT:
+      return item_kind <= kind && item_kind >= ScalarKind::BOOL;
+    case ScalarKind::BINARY:
+      return item_kind == ScalarKind::BINARY || item_kind == ScalarKind::UNICODE;
+    default:
+      return item_kind == kind;
+  }
+}
+
+static std::shared_ptr<DataType> GetKindType(ScalarKind kind) {
+  switch (kind) {
+    case ScalarKind::UNICODE:
+      return utf8();
+    case ScalarKind::BINARY:
+      return binary();
+    case ScalarKind::BOOL:
+      return boolean();
+    case ScalarKind::INT:
+      return int64();
+    case ScalarKind::FLOAT:
+      return float64();
+    default:
+      return null();
+  }
+}
+
+// Convert a flat sequence of scalars in a single pass, without inferring its
+// type first: the type is guessed from the first non-null value, and when a
+// later value needs a wider type (an int after bools, a float after ints,
+// bytes after unicode) the conversion starts over with that type. The result
+// is the same as that of the inferring conversion. If the sequence has values
+// that are not handled here, or a value cannot be appended, *converted* is set
+// to false, and the caller is left to infer the type as usual.
+static Status ConvertFlatPySequence(PyObject* seq, int64_t size, MemoryPool* pool,
+                                    std::shared_ptr<Array>* out, bool* converted) {
+  *converted = false;
+  if (PyArray_Check(seq)) {
+    return Status::OK();
+  }
+  ScalarKind kind = ScalarKind::NONE;
+  std::unique_ptr<ArrayBuilder> builder;
+  std::unique_ptr<SeqConverter> converter;
+  int64_t num_leading_nulls = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    OwnedRef ref(PySequence_GetItem(seq, i));
+    RETURN_IF_PYERROR();
+    const ScalarKind item_kind = GetScalarKind(ref.obj());
+    if (item_kind == ScalarKind::NONE) {
+      if (converter == nullptr) {
+        ++num_leading_nulls;
+        continue;
+      }
+    } else if (item_kind == ScalarKind::OTHER) {
+      return Status::OK();
+    } else if (converter == nullptr || !KindAccepts(kind, item_kind)) {
+      if (converter != nullptr) {
+        if (!KindAccepts(item_kind, kind)) {
+          // Values of these kinds cannot be converted to one type
+          return Status::OK();
+        }
+        // Start over with the wider type
+        i = 0;
+        num_leading_nulls = 0;
+        ref.reset(PySequence_GetItem(seq, i));
+        RETURN_IF_PYERROR();
+      }
+      kind = item_kind;
+      const auto type = GetKindType(kind);
+      RETURN_NOT_OK(MakeBuilder(pool, type, &builder));
+      RETURN_NOT_OK(builder->Reserve(size));
+      converter = GetConverter(type);
+      RETURN_NOT_OK(converter->Init(builder.get()));
+      for (int64_t j = 0; j < num_leading_nulls; ++j) {
+        RETURN_NOT_OK(converter->AppendSingle(Py_None));
+      }
+    }
+    if (!converter->AppendSingle(ref.obj()).ok()) {
+      // Let the inferring conversion report the error, if it has one
+      PyErr_Clear();
+      return Status::OK();
+    }
+  }
+  if (converter == nullptr) {
+    out->reset(new NullArray(size));
+  } else {
+    RETURN_NOT_OK(builder->Finish(out));
+  }
+  *converted = true;
+  return Status::OK();
+}
+
 static Status ConvertPySequenceReal(PyObject* obj, int64_t size,
                                     const std::shared_ptr<DataType>* type,
                                     MemoryPool* pool, std::shared_ptr<Array>* out) {
@@ -993,6 +1110,11 @@ static Status ConvertPySequenceReal(PyObject* obj, int64_t size,
   RETURN_NOT_OK(ConvertToSequenceAndInferSize(obj, &seq, &size));
   tmp_seq_nanny.reset(seq);
   if (type == nullptr) {
+    bool converted;
+    RETURN_NOT_OK(ConvertFlatPySequence(seq, size, pool, out, &converted));
+    if (converted) {
+      return Status::OK();
+    }
     RETURN_NOT_OK(InferArrowType(seq, &real_type));
   } else {
     real_type = *type;
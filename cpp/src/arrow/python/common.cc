@@ -45,6 +45,26 @@ MemoryPool* get_memory_pool() {
   }
 }
 
+Status GetMemoryPoolByName(const std::string& name, MemoryPool** out) {
+  if (name == "default") {
+    *out = default_memory_pool();
+  } else if (name == "system") {
+    *out = system_memory_pool();
+  } else if (name == "jemalloc") {
+    if (!jemalloc_enabled()) {
+      return Status::NotImplemented("Arrow was built without jemalloc");
+    }
+    *out = system_memory_pool();
+  } else if (name == "thread_caching") {
+    *out = thread_caching_memory_pool();
+  } else {
+    std::stringstream ss;
+    ss << "Unknown memory pool: " << name;
+    return Status::Invalid(ss.str());
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // PyBuffer
 
@@ -145,6 +145,14 @@ Status PassPyError();
 ARROW_EXPORT void set_default_memory_pool(MemoryPool* pool);
 ARROW_EXPORT MemoryPool* get_memory_pool();
 
+// \brief Get one of the process-wide memory pools by name
+// \param[in] name "default" for arrow::default_memory_pool(), "system" for
+// arrow::system_memory_pool(), "jemalloc" for the same if Arrow was built with
+// jemalloc, or "thread_caching" for arrow::thread_caching_memory_pool()
+// \param[out] out The memory pool, which is never destroyed
+// \return The status of the operation
+ARROW_EXPORT Status GetMemoryPoolByName(const std::string& name, MemoryPool** out);
+
 class ARROW_EXPORT PyBuffer : public Buffer {
  public:
   /// While memoryview objects support multi-dimensional buffers, PyBuffer only supports
@@ -122,54 +122,131 @@ Status PythonDecimalToString(PyObject* python_decimal, std::string* out) {
   return Status::OK();
 }
 
-// \brief Infer the precision and scale of a Python decimal.Decimal instance
-// \param python_decimal[in] An instance of decimal.Decimal
-// \param precision[out] The value of the inferred precision
-// \param scale[out] The value of the inferred scale
-// \return The status of the operation
-static Status InferDecimalPrecisionAndScale(PyObject* python_decimal, int32_t* precision,
-                                            int32_t* scale) {
+namespace {
+
+// The number of decimal digits that always fit in an int64_t
+constexpr int32_t kInt64DecimalDigits = 18;
+
+// The number of decimal digits that always fit in a Decimal128
+constexpr int32_t kMaxDecimalDigits = 38;
+
+int64_t PowerOfTen(int32_t exponent) {
+  int64_t result = 1;
+  for (int32_t i = 0; i < exponent; ++i) {
+    result *= 10;
+  }
+  return result;
+}
+
+}  // namespace
+
+Status ReadPythonDecimal(PyObject* python_decimal, bool* is_nan, PythonDecimal* out) {
   DCHECK_NE(python_decimal, NULLPTR);
-  DCHECK_NE(precision, NULLPTR);
-  DCHECK_NE(scale, NULLPTR);
+  DCHECK_NE(is_nan, NULLPTR);
+  DCHECK_NE(out, NULLPTR);
 
-  // TODO(phillipc): Make sure we perform PyDecimal_Check(python_decimal) as a DCHECK
+  // as_tuple() returns a DecimalTuple(sign, digits, exponent) named tuple, whose items
+  // are read directly rather than through attribute lookups
   OwnedRef as_tuple(PyObject_CallMethod(python_decimal, const_cast<char*>("as_tuple"),
                                         const_cast<char*>("")));
   RETURN_IF_PYERROR();
   DCHECK(PyTuple_Check(as_tuple.obj()));
+  DCHECK_EQ(PyTuple_GET_SIZE(as_tuple.obj()), 3);
 
-  OwnedRef digits(PyObject_GetAttrString(as_tuple.obj(), "digits"));
-  RETURN_IF_PYERROR();
-  DCHECK(PyTuple_Check(digits.obj()));
+  PyObject* py_sign = PyTuple_GET_ITEM(as_tuple.obj(), 0);
+  PyObject* digits = PyTuple_GET_ITEM(as_tuple.obj(), 1);
+  PyObject* py_exponent = PyTuple_GET_ITEM(as_tuple.obj(), 2);
+  DCHECK(PyTuple_Check(digits));
 
-  const auto num_digits = static_cast<int32_t>(PyTuple_Size(digits.obj()));
-  RETURN_IF_PYERROR();
+  // The exponent of a NaN is 'n' or 'N' (signaling), and that of an infinity is 'F'
+  if (!IsPyInteger(py_exponent)) {
+    PyObjectStringify str(py_exponent);
+    RETURN_IF_PYERROR();
+    DCHECK_EQ(str.size, 1);
+    if (str.bytes[0] != 'n' && str.bytes[0] != 'N') {
+      return Status::Invalid("Cannot convert an infinite decimal to an Arrow decimal");
+    }
+    *is_nan = true;
+    return Status::OK();
+  }
+  *is_nan = false;
 
-  OwnedRef py_exponent(PyObject_GetAttrString(as_tuple.obj(), "exponent"));
+  const auto exponent = static_cast<int32_t>(PyLong_AsLong(py_exponent));
   RETURN_IF_PYERROR();
-  DCHECK(IsPyInteger(py_exponent.obj()));
+  const auto num_digits = static_cast<int32_t>(PyTuple_GET_SIZE(digits));
 
-  const auto exponent = static_cast<int32_t>(PyLong_AsLong(py_exponent.obj()));
+  if (ARROW_PREDICT_FALSE(num_digits > kMaxDecimalDigits)) {
+    std::stringstream buf;
+    buf << "Decimal with " << num_digits << " digits does not fit into "
+        << kMaxDecimalDigits << " digits";
+    return Status::Invalid(buf.str());
+  }
+
+  // Accumulate the digits in chunks that fit in an int64_t, as Decimal128::FromString
+  // does with those of the string
+  Decimal128 value;
+  for (int32_t posn = 0; posn < num_digits;) {
+    const int32_t group = std::min(kInt64DecimalDigits, num_digits - posn);
+    int64_t chunk = 0;
+    for (const int32_t group_end = posn + group; posn < group_end; ++posn) {
+      chunk = chunk * 10 + PyLong_AsLong(PyTuple_GET_ITEM(digits, posn));
+    }
+    value *= PowerOfTen(group);
+    value += chunk;
+  }
   RETURN_IF_PYERROR();
 
-  const int32_t abs_exponent = std::abs(exponent);
+  const bool is_zero = value == 0;
+  if (PyLong_AsLong(py_sign) == 1) {
+    value.Negate();
+  }
 
-  int32_t num_additional_zeros;
+  // The precision and scale that Decimal128::FromString parses from str(), which has
+  // no exponent if the exponent is not positive and the value is not too small, and
+  // otherwise has one digit before the decimal point. Zeros before the decimal point
+  // are not counted, and zero itself has no precision.
+  const int32_t adjusted_exponent = num_digits - 1 + exponent;
+  if (is_zero) {
+    out->precision = 0;
+    out->scale = 0;
+  } else if (exponent <= 0 && adjusted_exponent >= -6) {
+    out->precision = std::max(num_digits + exponent, 0) - exponent;
+    out->scale = -exponent;
+  } else {
+    out->precision = num_digits;
+    out->scale = -exponent;
+  }
+  if (out->scale < 0) {
+    out->precision -= out->scale;
+    if (ARROW_PREDICT_FALSE(out->precision > kMaxDecimalDigits)) {
+      std::stringstream buf;
+      buf << "Decimal with precision " << out->precision << " does not fit into "
+          << kMaxDecimalDigits << " digits";
+      return Status::Invalid(buf.str());
+    }
+    for (int32_t remaining = -out->scale; remaining > 0;
+         remaining -= kInt64DecimalDigits) {
+      value *= PowerOfTen(std::min(kInt64DecimalDigits, remaining));
+    }
+    out->scale = 0;
+  }
+  out->value = value;
 
+  // The precision and scale that a decimal type is inferred from
+  const int32_t abs_exponent = std::abs(exponent);
+  int32_t num_additional_zeros;
   if (num_digits <= abs_exponent) {
     DCHECK_NE(exponent, 0) << "exponent should never be zero here";
 
     // we have leading/trailing zeros, leading if exponent is negative
     num_additional_zeros = exponent < 0 ? abs_exponent - num_digits : exponent;
-    *scale = static_cast<int32_t>(exponent < 0) * -exponent;
+    out->inferred_scale = static_cast<int32_t>(exponent < 0) * -exponent;
   } else {
     // we can use the number of digits as the precision
     num_additional_zeros = 0;
-    *scale = -exponent;
+    out->inferred_scale = -exponent;
   }
-
-  *precision = num_digits + num_additional_zeros;
+  out->inferred_precision = num_digits + num_additional_zeros;
   return Status::OK();
 }
 
@@ -192,30 +269,34 @@ Status DecimalFromPythonDecimal(PyObject* python_decimal, const DecimalType& arr
   DCHECK_NE(python_decimal, NULLPTR);
   DCHECK_NE(out, NULLPTR);
 
-  std::string string;
-  RETURN_NOT_OK(PythonDecimalToString(python_decimal, &string));
-
-  int32_t inferred_precision;
-  int32_t inferred_scale;
+  bool is_nan;
+  PythonDecimal decimal;
+  RETURN_NOT_OK(ReadPythonDecimal(python_decimal, &is_nan, &decimal));
+  if (ARROW_PREDICT_FALSE(is_nan)) {
+    return Status::Invalid("Cannot convert a NaN decimal to an Arrow decimal");
+  }
+  return PythonDecimalToType(decimal, arrow_type, out);
+}
 
-  RETURN_NOT_OK(
-      Decimal128::FromString(string, out, &inferred_precision, &inferred_scale));
+Status PythonDecimalToType(const PythonDecimal& decimal, const DecimalType& arrow_type,
+                           Decimal128* out) {
+  DCHECK_NE(out, NULLPTR);
 
   const int32_t precision = arrow_type.precision();
   const int32_t scale = arrow_type.scale();
 
-  if (ARROW_PREDICT_FALSE(inferred_precision > precision)) {
+  if (ARROW_PREDICT_FALSE(decimal.precision > precision)) {
     std::stringstream buf;
-    buf << "Decimal type with precision " << inferred_precision
+    buf << "Decimal type with precision " << decimal.precision
         << " does not fit into precision inferred from first array element: "
         << precision;
     return Status::Invalid(buf.str());
   }
 
-  if (scale != inferred_scale) {
-    DCHECK_NE(out, NULLPTR);
-    RETURN_NOT_OK(out->Rescale(inferred_scale, scale, out));
+  if (scale != decimal.scale) {
+    return decimal.value.Rescale(decimal.scale, scale, out);
   }
+  *out = decimal.value;
   return Status::OK();
 }
 
@@ -291,14 +372,13 @@ Status DecimalMetadata::Update(int32_t suggested_precision, int32_t suggested_sc
 Status DecimalMetadata::Update(PyObject* object) {
   DCHECK(PyDecimal_Check(object)) << "Object is not a Python Decimal";
 
-  if (ARROW_PREDICT_FALSE(PyDecimal_ISNAN(object))) {
+  bool is_nan;
+  PythonDecimal decimal;
+  RETURN_NOT_OK(ReadPythonDecimal(object, &is_nan, &decimal));
+  if (ARROW_PREDICT_FALSE(is_nan)) {
     return Status::OK();
   }
-
-  int32_t precision;
-  int32_t scale;
-  RETURN_NOT_OK(InferDecimalPrecisionAndScale(object, &precision, &scale));
-  return Update(precision, scale);
+  return Update(decimal.inferred_precision, decimal.inferred_scale);
 }
 
 bool PyFloat_IsNaN(PyObject* obj) {
@@ -27,13 +27,11 @@
 #include <numpy/halffloat.h>
 
 #include "arrow/type.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
-
-class Decimal128;
-
 namespace py {
 
 class OwnedRef;
@@ -87,6 +85,35 @@ PyObject* DecimalFromString(PyObject* decimal_constructor,
 Status DecimalFromPythonDecimal(PyObject* python_decimal, const DecimalType& arrow_type,
                                 Decimal128* out);
 
+// \brief A finite Python decimal, read from its as_tuple() representation
+struct PythonDecimal {
+  // The unscaled value
+  Decimal128 value;
+  // The precision and scale of the value, as Decimal128::FromString parses them from
+  // the string representation of the decimal
+  int32_t precision;
+  int32_t scale;
+  // The precision and scale that DecimalMetadata infers from the decimal
+  int32_t inferred_precision;
+  int32_t inferred_scale;
+};
+
+// \brief Read a Python decimal without formatting and parsing it as a string
+// \param[in] python_decimal A Python decimal.Decimal instance
+// \param[out] is_nan Whether the decimal is NaN, in which case out is not set
+// \param[out] out The value of the decimal
+// \return The status of the operation
+Status ReadPythonDecimal(PyObject* python_decimal, bool* is_nan, PythonDecimal* out);
+
+// \brief Convert a decimal read by ReadPythonDecimal to an Arrow decimal type. This
+// does not call into Python, so it can run without the GIL.
+// \param[in] decimal A decimal read by ReadPythonDecimal
+// \param[in] arrow_type An instance of arrow::DecimalType
+// \param[out] out A pointer to a Decimal128
+// \return The status of the operation
+Status PythonDecimalToType(const PythonDecimal& decimal, const DecimalType& arrow_type,
+                           Decimal128* out);
+
 // \brief Check whether obj is an integer, independent of Python versions.
 bool IsPyInteger(PyObject* obj);
 
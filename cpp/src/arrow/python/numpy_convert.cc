@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 
@@ -304,5 +305,142 @@ Status TensorToNdarray(const std::shared_ptr<Tensor>& tensor, PyObject* base,
   return Status::OK();
 }
 
+Status BufferToNdarray(const std::shared_ptr<Buffer>& buffer, const DataType& type,
+                       int64_t offset, int64_t length, PyObject** out) {
+  PyAcquireGIL lock;
+
+  int type_num;
+  RETURN_NOT_OK(GetNumPyType(type, &type_num));
+  const int64_t byte_width = static_cast<const FixedWidthType&>(type).bit_width() / 8;
+  const int64_t buffer_size = buffer ? buffer->size() : 0;
+  if (offset < 0 || length < 0 || (offset + length) * byte_width > buffer_size) {
+    std::stringstream ss;
+    ss << "Buffer of " << buffer_size << " bytes is too small for " << length
+       << " values of type " << type.ToString() << " at offset " << offset;
+    return Status::Invalid(ss.str());
+  }
+
+  PyArray_Descr* dtype = PyArray_DescrNewFromType(type_num);
+  RETURN_IF_PYERROR();
+
+  npy_intp npy_shape[1] = {static_cast<npy_intp>(length)};
+  void* data = nullptr;
+  if (buffer) {
+    data = const_cast<uint8_t*>(buffer->data()) + offset * byte_width;
+  }
+  int array_flags = NPY_ARRAY_CARRAY_RO;
+  if (buffer && buffer->is_mutable()) {
+    array_flags |= NPY_ARRAY_WRITEABLE;
+  }
+
+  OwnedRef result(PyArray_NewFromDescr(&PyArray_Type, dtype, 1, npy_shape, nullptr,
+                                       data, array_flags, nullptr));
+  RETURN_IF_PYERROR();
+
+  if (buffer) {
+    PyObject* base = py::wrap_buffer(buffer);
+    RETURN_IF_PYERROR();
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(result.obj()), base) ==
+        -1) {
+      // The base reference is stolen even on failure
+      RETURN_IF_PYERROR();
+    }
+  }
+  *out = result.detach();
+  return Status::OK();
+}
+
+// Wrap an array-like as a tensor of the given NumPy type and number of
+// dimensions, copying it only if it is not already a C-contiguous ndarray of
+// that type, as the index arrays of SciPy, which are most often int32
+static Status NdarrayToCTensor(MemoryPool* pool, PyObject* ao, int type_num, int ndim,
+                               std::shared_ptr<Tensor>* out) {
+  PyArray_Descr* dtype =
+      type_num == NPY_NOTYPE ? nullptr : PyArray_DescrFromType(type_num);
+  OwnedRef ndarray(PyArray_FromAny(ao, dtype, ndim, ndim,
+                                   NPY_ARRAY_C_CONTIGUOUS | NPY_ARRAY_ALIGNED, nullptr));
+  RETURN_IF_PYERROR();
+  return NdarrayToTensor(pool, ndarray.obj(), out);
+}
+
+Status NdarraysToSparseTensorCOO(MemoryPool* pool, PyObject* data_ao, PyObject* coords_ao,
+                                 const std::vector<int64_t>& shape,
+                                 const std::vector<std::string>& dim_names,
+                                 std::shared_ptr<SparseTensorCOO>* out) {
+  PyAcquireGIL lock;
+
+  std::shared_ptr<Tensor> data;
+  std::shared_ptr<Tensor> coords;
+  RETURN_NOT_OK(NdarrayToCTensor(pool, data_ao, NPY_NOTYPE, 1, &data));
+  RETURN_NOT_OK(NdarrayToCTensor(pool, coords_ao, NPY_INT64, 2, &coords));
+
+  const int64_t ndim = static_cast<int64_t>(shape.size());
+  if (coords->shape()[0] != data->shape()[0] || coords->shape()[1] != ndim) {
+    return Status::Invalid("Coordinates must be of shape (len(data), len(shape))");
+  }
+  *out = std::make_shared<SparseTensorCOO>(std::make_shared<SparseCOOIndex>(coords),
+                                           data->type(), data->data(), shape, dim_names);
+  return Status::OK();
+}
+
+Status NdarraysToSparseTensorCSR(MemoryPool* pool, PyObject* data_ao, PyObject* indptr_ao,
+                                 PyObject* indices_ao, const std::vector<int64_t>& shape,
+                                 const std::vector<std::string>& dim_names,
+                                 std::shared_ptr<SparseTensorCSR>* out) {
+  PyAcquireGIL lock;
+
+  if (shape.size() != 2) {
+    return Status::Invalid("A CSR sparse tensor must be a matrix");
+  }
+  std::shared_ptr<Tensor> data;
+  std::shared_ptr<Tensor> indptr;
+  std::shared_ptr<Tensor> indices;
+  RETURN_NOT_OK(NdarrayToCTensor(pool, data_ao, NPY_NOTYPE, 1, &data));
+  RETURN_NOT_OK(NdarrayToCTensor(pool, indptr_ao, NPY_INT64, 1, &indptr));
+  RETURN_NOT_OK(NdarrayToCTensor(pool, indices_ao, NPY_INT64, 1, &indices));
+
+  if (indptr->shape()[0] != shape[0] + 1 || indices->shape()[0] != data->shape()[0]) {
+    return Status::Invalid(
+        "Row pointers must be of length nrows + 1 and indices of length len(data)");
+  }
+  *out = std::make_shared<SparseTensorCSR>(
+      std::make_shared<SparseCSRIndex>(indptr, indices), data->type(), data->data(),
+      shape, dim_names);
+  return Status::OK();
+}
+
+// The non-zero values of a sparse tensor as a vector
+static std::shared_ptr<Tensor> SparseTensorData(const SparseTensor& sparse_tensor) {
+  return std::make_shared<Tensor>(sparse_tensor.type(), sparse_tensor.data(),
+                                  std::vector<int64_t>{sparse_tensor.non_zero_length()});
+}
+
+Status SparseTensorCOOToNdarray(const std::shared_ptr<SparseTensorCOO>& sparse_tensor,
+                                PyObject* base, PyObject** out_data,
+                                PyObject** out_coords) {
+  PyAcquireGIL lock;
+
+  OwnedRef data;
+  RETURN_NOT_OK(TensorToNdarray(SparseTensorData(*sparse_tensor), base, data.ref()));
+  RETURN_NOT_OK(TensorToNdarray(sparse_tensor->index().indices(), base, out_coords));
+  *out_data = data.detach();
+  return Status::OK();
+}
+
+Status SparseTensorCSRToNdarray(const std::shared_ptr<SparseTensorCSR>& sparse_tensor,
+                                PyObject* base, PyObject** out_data,
+                                PyObject** out_indptr, PyObject** out_indices) {
+  PyAcquireGIL lock;
+
+  OwnedRef data;
+  OwnedRef indptr;
+  RETURN_NOT_OK(TensorToNdarray(SparseTensorData(*sparse_tensor), base, data.ref()));
+  RETURN_NOT_OK(TensorToNdarray(sparse_tensor->index().indptr(), base, indptr.ref()));
+  RETURN_NOT_OK(TensorToNdarray(sparse_tensor->index().indices(), base, out_indices));
+  *out_data = data.detach();
+  *out_indptr = indptr.detach();
+  return Status::OK();
+}
+
 }  // namespace py
 }  // namespace arrow
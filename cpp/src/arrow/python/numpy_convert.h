@@ -23,10 +23,13 @@
 
 #include "arrow/python/platform.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/sparse_tensor.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -68,6 +71,56 @@ ARROW_EXPORT Status NdarrayToTensor(MemoryPool* pool, PyObject* ao,
 ARROW_EXPORT Status TensorToNdarray(const std::shared_ptr<Tensor>& tensor, PyObject* base,
                                     PyObject** out);
 
+/// \brief Wrap fixed-width values in a buffer as a 1-dimensional ndarray,
+/// without copying them
+///
+/// The base object of the ndarray is a pyarrow.Buffer, which keeps the buffer
+/// alive. The ndarray is writeable if the buffer is mutable.
+///
+/// \param[in] buffer the buffer of the values
+/// \param[in] type the type of the values, which must have a NumPy equivalent
+/// \param[in] offset the index in the buffer of the first value
+/// \param[in] length the number of values
+/// \param[out] out the ndarray
+ARROW_EXPORT Status BufferToNdarray(const std::shared_ptr<Buffer>& buffer,
+                                    const DataType& type, int64_t offset,
+                                    int64_t length, PyObject** out);
+
+/// \brief EXPERIMENTAL: Wrap the non-zero values and the coordinates of a sparse
+/// tensor, such as those of a scipy.sparse.coo_matrix
+///
+/// The values are wrapped without copying. The coordinates, an array of shape
+/// (len(data), len(shape)), are only copied if they are not a C-contiguous
+/// int64 ndarray
+ARROW_EXPORT Status NdarraysToSparseTensorCOO(MemoryPool* pool, PyObject* data_ao,
+                                              PyObject* coords_ao,
+                                              const std::vector<int64_t>& shape,
+                                              const std::vector<std::string>& dim_names,
+                                              std::shared_ptr<SparseTensorCOO>* out);
+
+/// \brief EXPERIMENTAL: Wrap the data, indptr and indices of a
+/// scipy.sparse.csr_matrix as a sparse tensor
+///
+/// The values are wrapped without copying, the indices are only copied if they
+/// are not C-contiguous int64 ndarrays
+ARROW_EXPORT Status NdarraysToSparseTensorCSR(MemoryPool* pool, PyObject* data_ao,
+                                              PyObject* indptr_ao, PyObject* indices_ao,
+                                              const std::vector<int64_t>& shape,
+                                              const std::vector<std::string>& dim_names,
+                                              std::shared_ptr<SparseTensorCSR>* out);
+
+/// \brief EXPERIMENTAL: The non-zero values and the coordinates of a sparse
+/// tensor as ndarrays viewing its memory
+ARROW_EXPORT Status SparseTensorCOOToNdarray(
+    const std::shared_ptr<SparseTensorCOO>& sparse_tensor, PyObject* base,
+    PyObject** out_data, PyObject** out_coords);
+
+/// \brief EXPERIMENTAL: The data, indptr and indices of a sparse matrix as
+/// ndarrays viewing its memory
+ARROW_EXPORT Status SparseTensorCSRToNdarray(
+    const std::shared_ptr<SparseTensorCSR>& sparse_tensor, PyObject* base,
+    PyObject** out_data, PyObject** out_indptr, PyObject** out_indices);
+
 }  // namespace py
 }  // namespace arrow
 
@@ -25,6 +25,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -41,6 +43,8 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/context.h"
@@ -404,12 +408,19 @@ class NumPyConverter {
   // NumPy unicode arrays
   Status Visit(const StringType& type);
 
+  // Large binary and large string arrays (64-bit offsets)
+  Status Visit(const LargeBinaryType& type) {
+    return TypeNotImplemented(type.ToString());
+  }
+
   Status Visit(const StructType& type);
 
   Status Visit(const FixedSizeBinaryType& type) {
     return TypeNotImplemented(type.ToString());
   }
 
+  Status Visit(const StringViewType& type) { return TypeNotImplemented(type.ToString()); }
+
   Status Visit(const Decimal128Type& type) { return TypeNotImplemented(type.ToString()); }
 
   Status Visit(const DictionaryType& type) { return TypeNotImplemented(type.ToString()); }
@@ -784,21 +795,13 @@ Status NumPyConverter::ConvertDecimals() {
   internal::DecimalMetadata max_decimal_metadata;
   Ndarray1DIndexer<PyObject*> objects(arr_);
 
-  if (type_ == NULLPTR) {
-    for (PyObject* object : objects) {
-      RETURN_NOT_OK(max_decimal_metadata.Update(object));
-    }
-
-    type_ =
-        ::arrow::decimal(max_decimal_metadata.precision(), max_decimal_metadata.scale());
-  }
-
-  Decimal128Builder builder(type_, pool_);
-  RETURN_NOT_OK(builder.Resize(length_));
-
-  const auto& decimal_type = static_cast<const DecimalType&>(*type_);
+  // Read the decimals with the GIL held, in the same pass as the type is inferred,
+  // and convert them to the type once it is released
+  std::vector<internal::PythonDecimal> decimals(length_);
+  std::vector<bool> is_nan(length_);
 
-  for (PyObject* object : objects) {
+  for (int64_t i = 0; i < length_; ++i) {
+    PyObject* object = objects[i];
     const int is_decimal = PyObject_IsInstance(object, decimal_type_.obj());
 
     if (ARROW_PREDICT_FALSE(is_decimal == 0)) {
@@ -811,11 +814,33 @@ Status NumPyConverter::ConvertDecimals() {
       RETURN_IF_PYERROR();
     }
 
-    if (internal::PandasObjectIsNull(object)) {
+    bool value_is_nan;
+    RETURN_NOT_OK(internal::ReadPythonDecimal(object, &value_is_nan, &decimals[i]));
+    is_nan[i] = value_is_nan;
+    if (type_ == NULLPTR && !value_is_nan) {
+      RETURN_NOT_OK(max_decimal_metadata.Update(decimals[i].inferred_precision,
+                                                decimals[i].inferred_scale));
+    }
+  }
+
+  lock.release();
+
+  if (type_ == NULLPTR) {
+    type_ =
+        ::arrow::decimal(max_decimal_metadata.precision(), max_decimal_metadata.scale());
+  }
+
+  Decimal128Builder builder(type_, pool_);
+  RETURN_NOT_OK(builder.Resize(length_));
+
+  const auto& decimal_type = static_cast<const DecimalType&>(*type_);
+
+  for (int64_t i = 0; i < length_; ++i) {
+    if (is_nan[i]) {
       RETURN_NOT_OK(builder.AppendNull());
     } else {
       Decimal128 value;
-      RETURN_NOT_OK(internal::DecimalFromPythonDecimal(object, decimal_type, &value));
+      RETURN_NOT_OK(internal::PythonDecimalToType(decimals[i], decimal_type, &value));
       RETURN_NOT_OK(builder.Append(value));
     }
   }
@@ -1542,69 +1567,166 @@ namespace {
 // NumPy unicode is UCS4/UTF32 always
 constexpr int kNumPyUnicodeSize = 4;
 
-Status AppendUTF32(const char* data, int itemsize, int byteorder,
-                   StringBuilder* builder) {
-  // The binary \x00\x00\x00\x00 indicates a nul terminator in NumPy unicode,
-  // so we need to detect that here to truncate if necessary. Yep.
-  int actual_length = 0;
-  for (; actual_length < itemsize / kNumPyUnicodeSize; ++actual_length) {
-    const char* code_point = data + actual_length * kNumPyUnicodeSize;
-    if ((*code_point == '\0') && (*(code_point + 1) == '\0') &&
-        (*(code_point + 2) == '\0') && (*(code_point + 3) == '\0')) {
-      break;
-    }
+// The number of values of a unicode array transcoded by a task
+constexpr int64_t kUnicodeTaskSize = 1 << 16;
+
+inline uint32_t ReadCodePoint(const char* data, bool byteswapped) {
+  uint32_t code_point;
+  std::memcpy(&code_point, data, sizeof(code_point));
+  return byteswapped ? BitUtil::ByteSwap(code_point) : code_point;
+}
+
+// The number of bytes of the UTF-8 encoding of a code point, or 0 if it is not
+// a valid Unicode scalar value
+inline int UTF8Length(uint32_t code_point) {
+  if (code_point < 0x80) {
+    return 1;
+  } else if (code_point < 0x800) {
+    return 2;
+  } else if (code_point < 0x10000) {
+    // Surrogates are not valid on their own
+    return (code_point >= 0xD800 && code_point < 0xE000) ? 0 : 3;
+  } else if (code_point < 0x110000) {
+    return 4;
+  }
+  return 0;
+}
+
+inline uint8_t* EncodeUTF8(uint32_t code_point, uint8_t* out) {
+  if (code_point < 0x80) {
+    *out++ = static_cast<uint8_t>(code_point);
+  } else if (code_point < 0x800) {
+    *out++ = static_cast<uint8_t>(0xC0 | (code_point >> 6));
+    *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x10000) {
+    *out++ = static_cast<uint8_t>(0xE0 | (code_point >> 12));
+    *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+    *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
+  } else {
+    *out++ = static_cast<uint8_t>(0xF0 | (code_point >> 18));
+    *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+    *out++ = static_cast<uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+    *out++ = static_cast<uint8_t>(0x80 | (code_point & 0x3F));
   }
+  return out;
+}
 
-  OwnedRef unicode_obj(PyUnicode_DecodeUTF32(data, actual_length * kNumPyUnicodeSize,
-                                             nullptr, &byteorder));
-  RETURN_IF_PYERROR();
-  OwnedRef utf8_obj(PyUnicode_AsUTF8String(unicode_obj.obj()));
-  if (utf8_obj.obj() == NULL) {
-    PyErr_Clear();
-    return Status::Invalid("failed converting UTF32 to UTF8");
+// The length of the UTF-8 encoding of a NumPy unicode value. The values are
+// nul-terminated unless they fill their whole item.
+Status UTF32ToUTF8Length(const char* data, int itemsize, bool byteswapped,
+                         int32_t* out) {
+  int32_t length = 0;
+  for (int i = 0; i < itemsize / kNumPyUnicodeSize; ++i) {
+    const uint32_t code_point = ReadCodePoint(data + i * kNumPyUnicodeSize, byteswapped);
+    if (code_point == 0) {
+      break;
+    }
+    const int code_point_length = UTF8Length(code_point);
+    if (code_point_length == 0) {
+      return Status::Invalid("failed converting UTF32 to UTF8");
+    }
+    length += code_point_length;
   }
+  *out = length;
+  return Status::OK();
+}
 
-  const int32_t length = static_cast<int32_t>(PyBytes_GET_SIZE(utf8_obj.obj()));
-  if (builder->value_data_length() + length > kBinaryMemoryLimit) {
-    return Status::Invalid("Encoded string length exceeds maximum size (2GB)");
+// Encode a NumPy unicode value validated by UTF32ToUTF8Length
+void UTF32ToUTF8(const char* data, int itemsize, bool byteswapped, uint8_t* out) {
+  for (int i = 0; i < itemsize / kNumPyUnicodeSize; ++i) {
+    const uint32_t code_point = ReadCodePoint(data + i * kNumPyUnicodeSize, byteswapped);
+    if (code_point == 0) {
+      break;
+    }
+    out = EncodeUTF8(code_point, out);
   }
-  return builder->Append(PyBytes_AS_STRING(utf8_obj.obj()), length);
 }
 
 }  // namespace
 
+// The values are transcoded in C++ without the GIL, in two passes over tasks
+// of kUnicodeTaskSize values: the first computes the length of every value,
+// which sizes the data buffer, and the second encodes them in place.
 Status NumPyConverter::Visit(const StringType& type) {
-  StringBuilder builder(pool_);
-
-  auto data = reinterpret_cast<const char*>(PyArray_DATA(arr_));
-
-  char numpy_byteorder = PyArray_DESCR(arr_)->byteorder;
-
-  // For Python C API, -1 is little-endian, 1 is big-endian
-  int byteorder = numpy_byteorder == '>' ? 1 : -1;
-
-  PyAcquireGIL gil_lock;
-
+  const auto data = reinterpret_cast<const char*>(PyArray_DATA(arr_));
+  const bool byteswapped = PyArray_ISBYTESWAPPED(arr_);
+  const uint8_t* mask_data = nullptr;
+  int64_t mask_stride = 0;
   if (mask_ != nullptr) {
-    Ndarray1DIndexer<uint8_t> mask_values(mask_);
-    for (int64_t i = 0; i < length_; ++i) {
-      if (mask_values[i]) {
-        RETURN_NOT_OK(builder.AppendNull());
-      } else {
-        RETURN_NOT_OK(AppendUTF32(data, itemsize_, byteorder, &builder));
+    mask_data = reinterpret_cast<const uint8_t*>(PyArray_DATA(mask_));
+    mask_stride = static_cast<int64_t>(PyArray_STRIDES(mask_)[0]);
+    RETURN_NOT_OK(InitNullBitmap());
+    null_count_ = MaskToBitmap(mask_, length_, null_bitmap_data_);
+  }
+
+  std::shared_ptr<Buffer> offsets_buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool_, (length_ + 1) * sizeof(int32_t), &offsets_buffer));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+
+  const int num_tasks =
+      static_cast<int>((length_ + kUnicodeTaskSize - 1) / kUnicodeTaskSize);
+  const int num_threads = std::min(GetCpuThreadPoolCapacity(), num_tasks);
+  auto RunTasks = [num_tasks, num_threads](const std::function<Status(int)>& task) {
+    if (num_threads <= 1) {
+      for (int i = 0; i < num_tasks; ++i) {
+        RETURN_NOT_OK(task(i));
       }
-      data += stride_;
+      return Status::OK();
     }
-  } else {
-    for (int64_t i = 0; i < length_; ++i) {
-      RETURN_NOT_OK(AppendUTF32(data, itemsize_, byteorder, &builder));
-      data += stride_;
+    return ParallelFor(num_threads, num_tasks, task);
+  };
+  const int itemsize = itemsize_;
+  const int64_t stride = stride_;
+  const int64_t length = length_;
+  auto IsMasked = [mask_data, mask_stride](int64_t i) {
+    return mask_data != nullptr && mask_data[i * mask_stride] != 0;
+  };
+
+  // Store the length of each value in its offset, and sum them per task
+  std::vector<int64_t> task_offsets(num_tasks + 1, 0);
+  RETURN_NOT_OK(RunTasks([&](int task) {
+    const int64_t end = std::min(length, (task + 1) * kUnicodeTaskSize);
+    int64_t task_length = 0;
+    for (int64_t i = task * kUnicodeTaskSize; i < end; ++i) {
+      offsets[i] = 0;
+      if (!IsMasked(i)) {
+        RETURN_NOT_OK(UTF32ToUTF8Length(data + i * stride, itemsize, byteswapped,
+                                        &offsets[i]));
+      }
+      task_length += offsets[i];
     }
+    task_offsets[task + 1] = task_length;
+    return Status::OK();
+  }));
+  for (int task = 0; task < num_tasks; ++task) {
+    task_offsets[task + 1] += task_offsets[task];
+  }
+  const int64_t data_length = task_offsets[num_tasks];
+  if (data_length > kBinaryMemoryLimit) {
+    return Status::Invalid("Encoded string length exceeds maximum size (2GB)");
   }
 
-  std::shared_ptr<Array> result;
-  RETURN_NOT_OK(builder.Finish(&result));
-  return PushArray(result->data());
+  std::shared_ptr<Buffer> data_buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool_, data_length, &data_buffer));
+  uint8_t* out = data_buffer->mutable_data();
+  RETURN_NOT_OK(RunTasks([&](int task) {
+    const int64_t end = std::min(length, (task + 1) * kUnicodeTaskSize);
+    int32_t position = static_cast<int32_t>(task_offsets[task]);
+    for (int64_t i = task * kUnicodeTaskSize; i < end; ++i) {
+      const int32_t value_length = offsets[i];
+      offsets[i] = position;
+      if (value_length > 0) {
+        UTF32ToUTF8(data + i * stride, itemsize, byteswapped, out + position);
+      }
+      position += value_length;
+    }
+    return Status::OK();
+  }));
+  offsets[length_] = static_cast<int32_t>(data_length);
+
+  auto arr_data = ArrayData::Make(
+      type_, length_, {null_bitmap_, offsets_buffer, data_buffer}, null_count_, 0);
+  return PushArray(arr_data);
 }
 
 Status NumPyConverter::Visit(const StructType& type) {
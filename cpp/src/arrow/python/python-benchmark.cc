@@ -0,0 +1,417 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Round trips between Arrow and Python: tables to pandas, NumPy arrays and
+// Python sequences to Arrow, and the serialization of Python objects, over
+// numeric, string, categorical, timestamp and nested data.
+//
+// The throughput is reported in bytes of Arrow data per second. After the
+// timed runs, each benchmark runs once more to report its peak memory: the
+// peak_python_bytes counter is the peak of the memory traced by tracemalloc,
+// which includes the NumPy arrays, and is left out on Pythons without
+// tracemalloc. The conversions taking a memory pool also report the peak of
+// that pool as the peak_pool_bytes counter.
+
+#include "arrow/python/platform.h"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+
+#include "arrow/python/arrow_to_pandas.h"
+#include "arrow/python/arrow_to_python.h"
+#include "arrow/python/builtin_convert.h"
+#include "arrow/python/common.h"
+#include "arrow/python/init.h"
+#include "arrow/python/numpy_to_arrow.h"
+#include "arrow/python/python_to_arrow.h"
+#include "arrow/python/util/datetime.h"
+
+#include "benchmark/benchmark.h"
+
+namespace arrow {
+namespace py {
+
+enum DataKind { kNumeric, kString, kCategorical, kTimestamp, kNested };
+
+const char* kDataKindNames[] = {"numeric", "string", "categorical", "timestamp",
+                                "nested"};
+
+// The number of distinct values of categorical data
+constexpr int kNumCategories = 64;
+
+// The number of columns of the tables converted to pandas
+constexpr int kNumColumns = 4;
+
+constexpr double kNullProbability = 0.1;
+
+// Generate a column of the given kind, with 10% nulls. Categorical data is
+// strings of low cardinality, which become categoricals in pandas.
+std::shared_ptr<Array> MakeColumn(DataKind kind, int64_t length, uint32_t seed) {
+  std::mt19937 engine(seed);
+  std::bernoulli_distribution is_null(kNullProbability);
+  std::unique_ptr<ArrayBuilder> builder;
+  switch (kind) {
+    case kNumeric: {
+      std::normal_distribution<double> values;
+      auto doubles = new DoubleBuilder();
+      builder.reset(doubles);
+      for (int64_t i = 0; i < length; ++i) {
+        ABORT_NOT_OK(is_null(engine) ? doubles->AppendNull()
+                                     : doubles->Append(values(engine)));
+      }
+      break;
+    }
+    case kString:
+    case kCategorical: {
+      std::uniform_int_distribution<int> string_length(4, 32);
+      std::uniform_int_distribution<int> letters('a', 'z');
+      std::uniform_int_distribution<int> categories(0, kNumCategories - 1);
+      auto strings = new StringBuilder();
+      builder.reset(strings);
+      for (int64_t i = 0; i < length; ++i) {
+        if (is_null(engine)) {
+          ABORT_NOT_OK(strings->AppendNull());
+        } else if (kind == kCategorical) {
+          ABORT_NOT_OK(strings->Append("category_" + std::to_string(categories(engine))));
+        } else {
+          std::string value(string_length(engine), ' ');
+          for (char& c : value) {
+            c = static_cast<char>(letters(engine));
+          }
+          ABORT_NOT_OK(strings->Append(value));
+        }
+      }
+      break;
+    }
+    case kTimestamp: {
+      // Timestamps over ten years from 2010, in nanoseconds
+      const int64_t start = INT64_C(1262304000000000000);
+      std::uniform_int_distribution<int64_t> offsets(0, INT64_C(315360000000000000));
+      auto timestamps = new TimestampBuilder(timestamp(TimeUnit::NANO),
+                                             default_memory_pool());
+      builder.reset(timestamps);
+      for (int64_t i = 0; i < length; ++i) {
+        // Whole microseconds, so that the Python datetimes are exact
+        const int64_t value = (start + offsets(engine)) / 1000 * 1000;
+        ABORT_NOT_OK(is_null(engine) ? timestamps->AppendNull()
+                                     : timestamps->Append(value));
+      }
+      break;
+    }
+    case kNested: {
+      std::uniform_int_distribution<int> list_length(0, 8);
+      std::uniform_int_distribution<int64_t> values(0, 1 << 20);
+      auto lists = new ListBuilder(default_memory_pool(),
+                                   std::unique_ptr<ArrayBuilder>(new Int64Builder()));
+      builder.reset(lists);
+      auto ints = static_cast<Int64Builder*>(lists->value_builder());
+      for (int64_t i = 0; i < length; ++i) {
+        if (is_null(engine)) {
+          ABORT_NOT_OK(lists->AppendNull());
+          continue;
+        }
+        ABORT_NOT_OK(lists->Append());
+        for (int j = list_length(engine); j > 0; --j) {
+          ABORT_NOT_OK(ints->Append(values(engine)));
+        }
+      }
+      break;
+    }
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder->Finish(&out));
+  return out;
+}
+
+// The size of the buffers of an array, the data a conversion goes through
+int64_t DataSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += DataSize(*child);
+  }
+  return size;
+}
+
+// Convert an array to a Python list, with None for the nulls. The GIL must be
+// held.
+PyObject* MakePyList(DataKind kind, const Array& array) {
+  PyDateTime_IMPORT;
+  PyObject* list = PyList_New(array.length());
+  for (int64_t i = 0; i < array.length(); ++i) {
+    PyObject* item = nullptr;
+    if (array.IsNull(i)) {
+      Py_INCREF(Py_None);
+      item = Py_None;
+    } else if (kind == kNumeric) {
+      item = PyFloat_FromDouble(static_cast<const DoubleArray&>(array).Value(i));
+    } else if (kind == kString || kind == kCategorical) {
+      const auto value = static_cast<const StringArray&>(array).GetString(i);
+      item = PyUnicode_FromStringAndSize(value.data(), value.size());
+    } else if (kind == kTimestamp) {
+      const int64_t value = static_cast<const TimestampArray&>(array).Value(i);
+      ABORT_NOT_OK(PyDateTime_from_int(value / 1000, TimeUnit::MICRO, &item));
+    } else {
+      const auto& lists = static_cast<const ListArray&>(array);
+      const auto& values = static_cast<const Int64Array&>(*lists.values());
+      const int32_t offset = lists.value_offset(i);
+      item = PyList_New(lists.value_length(i));
+      for (int32_t j = 0; j < lists.value_length(i); ++j) {
+        PyList_SET_ITEM(item, j, PyLong_FromLongLong(values.Value(offset + j)));
+      }
+    }
+    PyList_SET_ITEM(list, i, item);
+  }
+  return list;
+}
+
+// Run a benchmark once more while tracing the Python allocations, and report
+// their peak
+template <typename RunOnce>
+void ReportPeakMemory(benchmark::State& state,  // NOLINT non-const reference
+                      RunOnce&& run_once) {
+  OwnedRef tracemalloc;
+  {
+    PyAcquireGIL lock;
+    tracemalloc.reset(PyImport_ImportModule("tracemalloc"));
+    if (tracemalloc.obj() == nullptr) {
+      PyErr_Clear();
+    } else {
+      OwnedRef result(PyObject_CallMethod(tracemalloc.obj(), "start", nullptr));
+    }
+  }
+
+  run_once();
+
+  if (tracemalloc.obj() != nullptr) {
+    PyAcquireGIL lock;
+    OwnedRef traced(PyObject_CallMethod(tracemalloc.obj(), "get_traced_memory", nullptr));
+    OwnedRef result(PyObject_CallMethod(tracemalloc.obj(), "stop", nullptr));
+    state.counters["peak_python_bytes"] =
+        PyLong_AsDouble(PyTuple_GET_ITEM(traced.obj(), 1));
+    tracemalloc.reset();
+  }
+}
+
+// Release the GIL taken by the main thread, for the conversions that take it
+// themselves from several threads
+class ReleaseGIL {
+ public:
+  ReleaseGIL() : state_(PyEval_SaveThread()) {}
+  ~ReleaseGIL() { PyEval_RestoreThread(state_); }
+
+ private:
+  PyThreadState* state_;
+};
+
+static void BM_TableToPandas(benchmark::State& state) {  // NOLINT non-const reference
+  const auto kind = static_cast<DataKind>(state.range(0));
+  const int64_t length = state.range(1);
+  const int nthreads = static_cast<int>(state.range(2));
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  std::unordered_set<std::string> categorical_columns;
+  int64_t data_size = 0;
+  for (int i = 0; i < kNumColumns; ++i) {
+    columns.push_back(MakeColumn(kind, length, i));
+    fields.push_back(field("f" + std::to_string(i), columns.back()->type()));
+    data_size += DataSize(*columns.back()->data());
+    if (kind == kCategorical) {
+      categorical_columns.insert(fields.back()->name());
+    }
+  }
+  auto table = Table::Make(schema(fields), columns);
+
+  auto convert = [&](MemoryPool* pool) {
+    PyObject* out;
+    {
+      ReleaseGIL release;
+      ABORT_NOT_OK(ConvertTableToPandas(PandasOptions(), categorical_columns, table,
+                                        nthreads, pool, &out));
+    }
+    return out;
+  };
+  while (state.KeepRunning()) {
+    PyObject* out = convert(default_memory_pool());
+    state.PauseTiming();
+    Py_DECREF(out);
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * data_size);
+  state.SetLabel(kDataKindNames[kind]);
+  ChildMemoryPool pool(default_memory_pool());
+  ReportPeakMemory(state, [&]() { Py_DECREF(convert(&pool)); });
+  state.counters["peak_pool_bytes"] = static_cast<double>(pool.max_memory());
+}
+
+static void BM_NdarrayToArrow(benchmark::State& state) {  // NOLINT non-const reference
+  const auto kind = static_cast<DataKind>(state.range(0));
+  const int64_t length = state.range(1);
+
+  auto array = MakeColumn(kind, length, 0);
+  // Categorical data comes from NumPy as strings
+  OwnedRef ndarray;
+  ABORT_NOT_OK(ConvertArrayToPandas(PandasOptions(), array, nullptr, ndarray.ref()));
+
+  auto convert = [&](MemoryPool* pool) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(NdarrayToArrow(pool, ndarray.obj(), Py_None, true, array->type(), &out));
+  };
+  while (state.KeepRunning()) {
+    convert(default_memory_pool());
+  }
+  state.SetBytesProcessed(state.iterations() * DataSize(*array->data()));
+  state.SetLabel(kDataKindNames[kind]);
+  ChildMemoryPool pool(default_memory_pool());
+  ReportPeakMemory(state, [&]() { convert(&pool); });
+  state.counters["peak_pool_bytes"] = static_cast<double>(pool.max_memory());
+}
+
+static void BM_ConvertPySequence(benchmark::State& state) {  // NOLINT non-const reference
+  const auto kind = static_cast<DataKind>(state.range(0));
+  const int64_t length = state.range(1);
+
+  auto array = MakeColumn(kind, length, 0);
+  OwnedRef list(MakePyList(kind, *array));
+
+  // The type of the values is inferred, as it is in pyarrow.array
+  auto convert = [&](MemoryPool* pool) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(ConvertPySequence(list.obj(), pool, &out));
+  };
+  while (state.KeepRunning()) {
+    convert(default_memory_pool());
+  }
+  state.SetBytesProcessed(state.iterations() * DataSize(*array->data()));
+  state.SetLabel(kDataKindNames[kind]);
+  ChildMemoryPool pool(default_memory_pool());
+  ReportPeakMemory(state, [&]() { convert(&pool); });
+  state.counters["peak_pool_bytes"] = static_cast<double>(pool.max_memory());
+}
+
+// Serialization allocates from the default pool, so only the Python peak is
+// reported, along with the size of the serialized data as the
+// serialized_bytes counter.
+static void BM_SerializeObject(benchmark::State& state) {  // NOLINT non-const reference
+  const auto kind = static_cast<DataKind>(state.range(0));
+  const int64_t length = state.range(1);
+
+  auto array = MakeColumn(kind, length, 0);
+  OwnedRef list(MakePyList(kind, *array));
+
+  int64_t serialized_size = 0;
+  auto serialize = [&]() {
+    SerializedPyObject serialized;
+    ABORT_NOT_OK(SerializeObject(Py_None, list.obj(), &serialized));
+    serialized_size = DataSize(*serialized.batch->column(0)->data());
+  };
+  while (state.KeepRunning()) {
+    serialize();
+  }
+  state.SetBytesProcessed(state.iterations() * DataSize(*array->data()));
+  state.SetLabel(kDataKindNames[kind]);
+  ReportPeakMemory(state, serialize);
+  state.counters["serialized_bytes"] = static_cast<double>(serialized_size);
+}
+
+static void BM_DeserializeObject(benchmark::State& state) {  // NOLINT non-const reference
+  const auto kind = static_cast<DataKind>(state.range(0));
+  const int64_t length = state.range(1);
+
+  auto array = MakeColumn(kind, length, 0);
+  SerializedPyObject serialized;
+  {
+    OwnedRef list(MakePyList(kind, *array));
+    ABORT_NOT_OK(SerializeObject(Py_None, list.obj(), &serialized));
+  }
+
+  auto deserialize = [&]() {
+    PyObject* out;
+    ABORT_NOT_OK(DeserializeObject(Py_None, serialized, Py_None, &out));
+    return out;
+  };
+  while (state.KeepRunning()) {
+    PyObject* out = deserialize();
+    state.PauseTiming();
+    Py_DECREF(out);
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * DataSize(*array->data()));
+  state.SetLabel(kDataKindNames[kind]);
+  ReportPeakMemory(state, [&]() { Py_DECREF(deserialize()); });
+}
+
+static void DataArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t kind = kNumeric; kind <= kNested; ++kind) {
+    for (int64_t length : {1 << 10, 1 << 16, 1 << 20}) {
+      bench->Args({kind, length});
+    }
+  }
+}
+
+static void TableArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t kind = kNumeric; kind <= kNested; ++kind) {
+    for (int64_t length : {1 << 10, 1 << 16, 1 << 20}) {
+      for (int64_t nthreads : {1, 4, 8}) {
+        bench->Args({kind, length, nthreads});
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_TableToPandas)
+    ->Apply(TableArgs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_NdarrayToArrow)->Apply(DataArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConvertPySequence)->Apply(DataArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SerializeObject)->Apply(DataArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeserializeObject)->Apply(DataArgs)->Unit(benchmark::kMillisecond);
+
+}  // namespace py
+}  // namespace arrow
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+
+  // The main thread holds the GIL, except while converting tables to pandas
+  Py_Initialize();
+#if PY_VERSION_HEX < 0x03070000
+  PyEval_InitThreads();
+#endif
+  arrow_init_numpy();
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  Py_Finalize();
+  return 0;
+}
@@ -23,12 +23,16 @@
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/memory_pool.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/test-util.h"
 
 #include "arrow/python/arrow_to_pandas.h"
+#include "arrow/python/arrow_to_python.h"
 #include "arrow/python/builtin_convert.h"
 #include "arrow/python/helpers.h"
+#include "arrow/python/python_to_arrow.h"
 
 namespace arrow {
 namespace py {
@@ -261,6 +265,35 @@ TEST_F(DecimalTest, TestOverflowFails) {
                                                             decimal_type, &value));
 }
 
+TEST_F(DecimalTest, ReadPythonDecimal) {
+  bool is_nan;
+  internal::PythonDecimal decimal;
+
+  OwnedRef negative_exponent(this->CreatePythonDecimal("-1.23E-8"));
+  ASSERT_OK(internal::ReadPythonDecimal(negative_exponent.obj(), &is_nan, &decimal));
+  ASSERT_FALSE(is_nan);
+  ASSERT_EQ(Decimal128(-123), decimal.value);
+  ASSERT_EQ(10, decimal.scale);
+  ASSERT_EQ(10, decimal.inferred_precision);
+  ASSERT_EQ(10, decimal.inferred_scale);
+
+  // A positive exponent is multiplied into the value
+  OwnedRef positive_exponent(this->CreatePythonDecimal("4.5E+20"));
+  ASSERT_OK(internal::ReadPythonDecimal(positive_exponent.obj(), &is_nan, &decimal));
+  Decimal128 expected;
+  ASSERT_OK(Decimal128::FromString("450000000000000000000", &expected));
+  ASSERT_EQ(expected, decimal.value);
+  ASSERT_EQ(21, decimal.precision);
+  ASSERT_EQ(0, decimal.scale);
+
+  OwnedRef nan(this->CreatePythonDecimal("nan"));
+  ASSERT_OK(internal::ReadPythonDecimal(nan.obj(), &is_nan, &decimal));
+  ASSERT_TRUE(is_nan);
+
+  OwnedRef infinity(this->CreatePythonDecimal("-Infinity"));
+  ASSERT_RAISES(Invalid, internal::ReadPythonDecimal(infinity.obj(), &is_nan, &decimal));
+}
+
 TEST_F(DecimalTest, TestNoneAndNaN) {
   OwnedRef list_ref(PyList_New(4));
   PyObject* list = list_ref.obj();
@@ -367,6 +400,23 @@ TEST_F(DecimalTest, UpdateWithNaN) {
   ASSERT_EQ(std::numeric_limits<int32_t>::min(), metadata.scale());
 }
 
+TEST(PythonTest, GetMemoryPoolByName) {
+  MemoryPool* pool;
+  ASSERT_OK(GetMemoryPoolByName("default", &pool));
+  ASSERT_EQ(default_memory_pool(), pool);
+  ASSERT_OK(GetMemoryPoolByName("system", &pool));
+  ASSERT_EQ(system_memory_pool(), pool);
+  ASSERT_OK(GetMemoryPoolByName("thread_caching", &pool));
+  ASSERT_EQ(thread_caching_memory_pool(), pool);
+  if (jemalloc_enabled()) {
+    ASSERT_OK(GetMemoryPoolByName("jemalloc", &pool));
+    ASSERT_EQ(system_memory_pool(), pool);
+  } else {
+    ASSERT_RAISES(NotImplemented, GetMemoryPoolByName("jemalloc", &pool));
+  }
+  ASSERT_RAISES(Invalid, GetMemoryPoolByName("unknown", &pool));
+}
+
 TEST(PythonTest, ConstructStringArrayWithLeadingZeros) {
   PyAcquireGIL lock;
 
@@ -382,5 +432,38 @@ TEST(PythonTest, ConstructStringArrayWithLeadingZeros) {
   ASSERT_OK(ConvertPySequence(list, pool, &out));
 }
 
+TEST(SerializedPyObject, ComponentsAreNotCopied) {
+  SerializedPyObject object;
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3}, &array);
+  object.batch = RecordBatch::Make(schema({field("f0", int64())}), 3, {array});
+
+  std::vector<double> values = {1, 2, 3, 4, 5, 6};
+  auto tensor_data = std::make_shared<Buffer>(
+      reinterpret_cast<const uint8_t*>(values.data()), values.size() * sizeof(double));
+  object.tensors.push_back(
+      std::make_shared<Tensor>(float64(), tensor_data, std::vector<int64_t>{2, 3}));
+  const std::string payload = "payload";
+  object.buffers.push_back(std::make_shared<Buffer>(payload));
+
+  std::vector<std::shared_ptr<Buffer>> components;
+  ASSERT_OK(object.GetComponents(default_memory_pool(), &components));
+  ASSERT_EQ(4, static_cast<int>(components.size()));
+  ASSERT_EQ(components[2]->data(), tensor_data->data());
+  ASSERT_EQ(components[3], object.buffers[0]);
+
+  SerializedPyObject result;
+  ASSERT_OK(GetSerializedFromComponents(1, 1, components, &result));
+  ASSERT_TRUE(result.batch->Equals(*object.batch));
+  ASSERT_EQ(1, static_cast<int>(result.tensors.size()));
+  ASSERT_TRUE(result.tensors[0]->Equals(*object.tensors[0]));
+  ASSERT_EQ(result.tensors[0]->data()->data(), tensor_data->data());
+  ASSERT_EQ(1, static_cast<int>(result.buffers.size()));
+  ASSERT_EQ(result.buffers[0], object.buffers[0]);
+
+  SerializedPyObject invalid;
+  ASSERT_RAISES(Invalid, GetSerializedFromComponents(1, 2, components, &invalid));
+}
+
 }  // namespace py
 }  // namespace arrow
@@ -75,6 +75,7 @@ class SequenceBuilder {
 
   /// Appending a none to the sequence
   Status AppendNone() {
+    RETURN_NOT_OK(EndUniform());
     RETURN_NOT_OK(offsets_.Append(0));
     RETURN_NOT_OK(types_.Append(0));
     return nones_.AppendToBitmap(false);
@@ -84,11 +85,33 @@ class SequenceBuilder {
     if (*tag == -1) {
       *tag = num_tags_++;
     }
+    if (uniform_ && *tag == 0) {
+      // The offsets of the elements of the first type are consecutive.
+      DCHECK_EQ(offset, num_uniform_);
+      ++num_uniform_;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(EndUniform());
     RETURN_NOT_OK(offsets_.Append(static_cast<int32_t>(offset)));
     RETURN_NOT_OK(types_.Append(*tag));
     return nones_.AppendToBitmap(true);
   }
 
+  /// Write the type ids and offsets of the elements appended so far, once the
+  /// sequence turns out not to be uniform.
+  Status EndUniform() {
+    if (!uniform_) {
+      return Status::OK();
+    }
+    uniform_ = false;
+    for (int64_t i = 0; i < num_uniform_; ++i) {
+      RETURN_NOT_OK(offsets_.Append(static_cast<int32_t>(i)));
+      RETURN_NOT_OK(types_.Append(0));
+      RETURN_NOT_OK(nones_.AppendToBitmap(true));
+    }
+    return Status::OK();
+  }
+
   template <typename BuilderType, typename T>
   Status AppendPrimitive(const T val, int8_t* tag, BuilderType* out) {
     RETURN_NOT_OK(Update(out->length(), tag));
@@ -230,7 +253,10 @@ class SequenceBuilder {
     return Status::OK();
   }
 
-  /// Finish building the sequence and return the result.
+  /// Finish building the sequence and return the result. If all of its elements
+  /// have the same type, and are not None, tensors or buffers, the result is the
+  /// array of the elements rather than a union, which needs no type ids and
+  /// offsets. The elements of such arrays are identified by their type.
   /// Input arrays may be nullptr
   Status Finish(const Array* list_data, const Array* tuple_data, const Array* dict_data,
                 const Array* set_data, std::shared_ptr<Array>* out) {
@@ -253,6 +279,11 @@ class SequenceBuilder {
     RETURN_NOT_OK(AddSubsequence(dict_tag_, dict_data, dict_offsets_, "dict"));
     RETURN_NOT_OK(AddSubsequence(set_tag_, set_data, set_offsets_, "set"));
 
+    if (uniform_ && num_tags_ == 1 && tensor_tag_ != 0 && buffer_tag_ != 0) {
+      *out = children_[0];
+      return Status::OK();
+    }
+
     auto type = ::arrow::union_(fields_, type_ids_, UnionMode::DENSE);
     out->reset(new UnionArray(type, types_.length(), children_, types_.data(),
                               offsets_.data(), nones_.null_bitmap(),
@@ -307,6 +338,11 @@ class SequenceBuilder {
 
   int8_t num_tags_ = 0;
 
+  // Whether all of the elements so far have tag 0 and are not None, in which
+  // case their type ids and offsets are not written to types_ and offsets_.
+  bool uniform_ = true;
+  int64_t num_uniform_ = 0;
+
   // Members for the output union constructed in Finish
   std::vector<std::shared_ptr<Field>> fields_;
   std::vector<std::shared_ptr<Array>> children_;
@@ -736,7 +772,39 @@ Status SerializedPyObject::WriteTo(io::OutputStream* dst) {
   return Status::OK();
 }
 
+Status SerializedPyObject::GetComponents(
+    MemoryPool* memory_pool, std::vector<std::shared_ptr<Buffer>>* out) const {
+  constexpr int64_t kInitialCapacity = 1024;
+
+  out->clear();
+  out->reserve(1 + 2 * this->tensors.size() + this->buffers.size());
+
+  // Write the record batch describing the object structure
+  std::shared_ptr<io::BufferOutputStream> stream;
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(io::BufferOutputStream::Create(kInitialCapacity, memory_pool, &stream));
+  RETURN_NOT_OK(ipc::WriteRecordBatchStream({this->batch}, stream.get()));
+  RETURN_NOT_OK(stream->Finish(&buffer));
+  out->push_back(buffer);
+
+  // For each tensor, get a metadata buffer and a buffer for the body
+  for (const auto& tensor : this->tensors) {
+    std::unique_ptr<ipc::Message> message;
+    RETURN_NOT_OK(ipc::GetTensorMessage(*tensor, memory_pool, &message));
+    out->push_back(message->metadata());
+    out->push_back(message->body());
+  }
+
+  for (const auto& buf : this->buffers) {
+    out->push_back(buf);
+  }
+  return Status::OK();
+}
+
 Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out) {
+  std::vector<std::shared_ptr<Buffer>> components;
+  RETURN_NOT_OK(GetComponents(memory_pool, &components));
+
   PyAcquireGIL py_gil;
 
   OwnedRef result(PyDict_New());
@@ -755,7 +823,7 @@ Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out
 
   Py_DECREF(buffers);
 
-  auto PushBuffer = [&buffers](const std::shared_ptr<Buffer>& buffer) {
+  for (const auto& buffer : components) {
     PyObject* wrapped_buffer = wrap_buffer(buffer);
     RETURN_IF_PYERROR();
     if (PyList_Append(buffers, wrapped_buffer) < 0) {
@@ -763,33 +831,6 @@ Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out
       RETURN_IF_PYERROR();
     }
     Py_DECREF(wrapped_buffer);
-    return Status::OK();
-  };
-
-  constexpr int64_t kInitialCapacity = 1024;
-
-  // Write the record batch describing the object structure
-  std::shared_ptr<io::BufferOutputStream> stream;
-  std::shared_ptr<Buffer> buffer;
-
-  py_gil.release();
-  RETURN_NOT_OK(io::BufferOutputStream::Create(kInitialCapacity, memory_pool, &stream));
-  RETURN_NOT_OK(ipc::WriteRecordBatchStream({this->batch}, stream.get()));
-  RETURN_NOT_OK(stream->Finish(&buffer));
-  py_gil.acquire();
-
-  RETURN_NOT_OK(PushBuffer(buffer));
-
-  // For each tensor, get a metadata buffer and a buffer for the body
-  for (const auto& tensor : this->tensors) {
-    std::unique_ptr<ipc::Message> message;
-    RETURN_NOT_OK(ipc::GetTensorMessage(*tensor, memory_pool, &message));
-    RETURN_NOT_OK(PushBuffer(message->metadata()));
-    RETURN_NOT_OK(PushBuffer(message->body()));
-  }
-
-  for (const auto& buf : this->buffers) {
-    RETURN_NOT_OK(PushBuffer(buf));
   }
 
   *out = result.detach();
@@ -66,6 +66,21 @@ struct ARROW_EXPORT SerializedPyObject {
   /// with the first buffer containing the serialized record batch containing
   /// the UnionArray that describes the whole object
   Status GetComponents(MemoryPool* pool, PyObject** out);
+
+  /// \brief Get the message components of the serialized object as buffers,
+  /// in the order of the 'data' list of the dict version
+  ///
+  /// Only the record batch and the tensor metadata are written to new memory.
+  /// The tensor bodies are the memory of the tensors, unless they are not
+  /// contiguous, and the buffers are those of this object, so the components
+  /// can be sent with scatter/gather I/O without copying the payload. This
+  /// does not need the GIL.
+  ///
+  /// \param[in] pool the memory pool for the record batch and tensor metadata
+  /// \param[out] out the buffers, 1 + 2 * tensors.size() + buffers.size() of
+  /// them
+  /// \return Status
+  Status GetComponents(MemoryPool* pool, std::vector<std::shared_ptr<Buffer>>* out) const;
 };
 
 /// \brief Serialize Python sequence as a RecordBatch plus
@@ -19,16 +19,23 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -45,7 +52,7 @@ class SimpleRecordBatch : public RecordBatch {
  public:
   SimpleRecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows,
                     const std::vector<std::shared_ptr<Array>>& columns)
-      : RecordBatch(schema, num_rows) {
+      : RecordBatch(schema, num_rows), boxed_columns_(columns) {
     columns_.resize(columns.size());
     boxed_columns_.resize(schema->num_fields());
     for (size_t i = 0; i < columns.size(); ++i) {
@@ -53,14 +60,16 @@ class SimpleRecordBatch : public RecordBatch {
     }
   }
 
+  // The arrays are kept as the boxed columns, so that column() need not make
+  // them again
   SimpleRecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows,
                     std::vector<std::shared_ptr<Array>>&& columns)
-      : RecordBatch(schema, num_rows) {
-    columns_.resize(columns.size());
-    boxed_columns_.resize(schema->num_fields());
-    for (size_t i = 0; i < columns.size(); ++i) {
-      columns_[i] = columns[i]->data();
+      : RecordBatch(schema, num_rows), boxed_columns_(std::move(columns)) {
+    columns_.resize(boxed_columns_.size());
+    for (size_t i = 0; i < boxed_columns_.size(); ++i) {
+      columns_[i] = boxed_columns_[i]->data();
     }
+    boxed_columns_.resize(schema->num_fields());
   }
 
   SimpleRecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows,
@@ -244,6 +253,323 @@ Status RecordBatch::Validate() const {
   return Status::OK();
 }
 
+Status RecordBatch::ValidateFull() const {
+  RETURN_NOT_OK(Validate());
+  for (int i = 0; i < num_columns(); ++i) {
+    const Status column_valid = ValidateArrayFull(*column(i));
+    if (!column_valid.ok()) {
+      std::stringstream ss;
+      ss << "Column " << i << " invalid: " << column_valid.message();
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Conversion to and from tensors
+
+namespace {
+
+// Bytes of the tile of a row-major tensor converted at once, which should
+// fit in the L2 cache as its rows are written to column by column
+constexpr int64_t kTensorTileBytes = 1 << 16;
+
+int BitWidth(const DataType& type) {
+  return static_cast<const FixedWidthType&>(type).bit_width();
+}
+
+std::shared_ptr<DataType> MakeIntegerType(int bits, bool is_signed) {
+  switch (bits) {
+    case 8:
+      return is_signed ? int8() : uint8();
+    case 16:
+      return is_signed ? int16() : uint16();
+    case 32:
+      return is_signed ? int32() : uint32();
+    default:
+      return is_signed ? int64() : uint64();
+  }
+}
+
+// The type holding the values of all the columns, following the NumPy
+// promotion rules
+Status TensorValueType(const RecordBatch& batch, std::shared_ptr<DataType>* out) {
+  int signed_bits = 0;
+  int unsigned_bits = 0;
+  int float_bits = 0;
+  bool has_nulls = false;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const Array& column = *batch.column(i);
+    const DataType& type = *column.type();
+    switch (type.id()) {
+      case Type::INT8:
+      case Type::INT16:
+      case Type::INT32:
+      case Type::INT64:
+        signed_bits = std::max(signed_bits, BitWidth(type));
+        break;
+      case Type::UINT8:
+      case Type::UINT16:
+      case Type::UINT32:
+      case Type::UINT64:
+        unsigned_bits = std::max(unsigned_bits, BitWidth(type));
+        break;
+      case Type::FLOAT:
+      case Type::DOUBLE:
+        float_bits = std::max(float_bits, BitWidth(type));
+        break;
+      default: {
+        std::stringstream ss;
+        ss << "Cannot convert column '" << batch.column_name(i) << "' of type "
+           << type.ToString() << " to a tensor";
+        return Status::TypeError(ss.str());
+      }
+    }
+    has_nulls = has_nulls || column.null_count() > 0;
+  }
+
+  // Width of the integer type holding all the integer columns, more than 64
+  // bits if there is none
+  int int_bits = std::max(signed_bits, unsigned_bits);
+  if (signed_bits > 0 && unsigned_bits >= signed_bits) {
+    int_bits = 2 * unsigned_bits;
+  }
+  if (float_bits == 0 && !has_nulls && int_bits > 0 && int_bits <= 64) {
+    *out = MakeIntegerType(int_bits, signed_bits > 0);
+  } else if (float_bits == 32 && int_bits <= 16) {
+    // Single precision holds integers of up to 16 bits exactly
+    *out = float32();
+  } else {
+    *out = float64();
+  }
+  return Status::OK();
+}
+
+// Write values [begin, end) of a column to out, stride values apart
+template <typename OutType, typename InType>
+void CopyTensorColumn(const Array& column, int64_t begin, int64_t end, OutType* out,
+                      int64_t stride) {
+  const InType* values =
+      reinterpret_cast<const InType*>(column.data()->buffers[1]->data()) +
+      column.offset();
+  if (column.null_count() == 0) {
+    for (int64_t i = begin; i < end; ++i, out += stride) {
+      *out = static_cast<OutType>(values[i]);
+    }
+  } else {
+    const uint8_t* bitmap = column.null_bitmap_data();
+    const int64_t offset = column.offset();
+    for (int64_t i = begin; i < end; ++i, out += stride) {
+      *out = BitUtil::GetBit(bitmap, offset + i)
+                 ? static_cast<OutType>(values[i])
+                 : std::numeric_limits<OutType>::quiet_NaN();
+    }
+  }
+}
+
+template <typename OutType>
+using CopyTensorColumnFunction = void (*)(const Array&, int64_t, int64_t, OutType*,
+                                          int64_t);
+
+template <typename OutType>
+CopyTensorColumnFunction<OutType> GetCopyTensorColumn(Type::type id) {
+  switch (id) {
+    case Type::INT8:
+      return CopyTensorColumn<OutType, int8_t>;
+    case Type::INT16:
+      return CopyTensorColumn<OutType, int16_t>;
+    case Type::INT32:
+      return CopyTensorColumn<OutType, int32_t>;
+    case Type::INT64:
+      return CopyTensorColumn<OutType, int64_t>;
+    case Type::UINT8:
+      return CopyTensorColumn<OutType, uint8_t>;
+    case Type::UINT16:
+      return CopyTensorColumn<OutType, uint16_t>;
+    case Type::UINT32:
+      return CopyTensorColumn<OutType, uint32_t>;
+    case Type::UINT64:
+      return CopyTensorColumn<OutType, uint64_t>;
+    case Type::FLOAT:
+      return CopyTensorColumn<OutType, float>;
+    default:
+      return CopyTensorColumn<OutType, double>;
+  }
+}
+
+template <typename OutType>
+Status FillTensor(const RecordBatch& batch, bool row_major, int num_threads,
+                  uint8_t* data) {
+  const int64_t num_rows = batch.num_rows();
+  const int num_columns = batch.num_columns();
+  OutType* out = reinterpret_cast<OutType*>(data);
+  std::vector<std::shared_ptr<Array>> columns(num_columns);
+  std::vector<CopyTensorColumnFunction<OutType>> copy(num_columns);
+  for (int j = 0; j < num_columns; ++j) {
+    columns[j] = batch.column(j);
+    copy[j] = GetCopyTensorColumn<OutType>(columns[j]->type_id());
+  }
+
+  if (!row_major) {
+    return ParallelFor(num_threads, num_columns, [&](int j) {
+      copy[j](*columns[j], 0, num_rows, out + j * num_rows, 1);
+      return Status::OK();
+    });
+  }
+
+  // Each tile reads a run of values of every column and writes them to its
+  // rows, which stay in the cache in between
+  const int64_t row_bytes = std::max<int64_t>(num_columns, 1) * sizeof(OutType);
+  const int64_t tile_rows = std::max<int64_t>(kTensorTileBytes / row_bytes, 1);
+  const int64_t num_tiles = (num_rows + tile_rows - 1) / tile_rows;
+  if (num_tiles > std::numeric_limits<int>::max()) {
+    return Status::Invalid("Too many rows to convert to a tensor");
+  }
+  return ParallelFor(num_threads, static_cast<int>(num_tiles), [&](int tile) {
+    const int64_t begin = tile * tile_rows;
+    const int64_t end = std::min(begin + tile_rows, num_rows);
+    for (int j = 0; j < num_columns; ++j) {
+      copy[j](*columns[j], begin, end, out + begin * num_columns + j, num_columns);
+    }
+    return Status::OK();
+  });
+}
+
+// Gather a column of a tensor whose values are stride bytes apart
+template <typename T>
+void GatherTensorColumn(const uint8_t* data, int64_t length, int64_t stride, T* out) {
+  for (int64_t i = 0; i < length; ++i, data += stride) {
+    std::memcpy(out + i, data, sizeof(T));
+  }
+}
+
+}  // namespace
+
+Status RecordBatch::ToTensor(bool row_major, MemoryPool* pool,
+                             std::shared_ptr<Tensor>* out) const {
+  return ToTensor(row_major, pool, GetCpuThreadPoolCapacity(), out);
+}
+
+Status RecordBatch::ToTensor(bool row_major, MemoryPool* pool, int num_threads,
+                             std::shared_ptr<Tensor>* out) const {
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(TensorValueType(*this, &type));
+  const int64_t value_size = BitWidth(*type) / 8;
+  const int64_t ncolumns = num_columns();
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, num_rows_ * ncolumns * value_size, &data));
+  uint8_t* raw_data = data->mutable_data();
+  Status st;
+  switch (type->id()) {
+    case Type::INT8:
+      st = FillTensor<int8_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::INT16:
+      st = FillTensor<int16_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::INT32:
+      st = FillTensor<int32_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::INT64:
+      st = FillTensor<int64_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::UINT8:
+      st = FillTensor<uint8_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::UINT16:
+      st = FillTensor<uint16_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::UINT32:
+      st = FillTensor<uint32_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::UINT64:
+      st = FillTensor<uint64_t>(*this, row_major, num_threads, raw_data);
+      break;
+    case Type::FLOAT:
+      st = FillTensor<float>(*this, row_major, num_threads, raw_data);
+      break;
+    default:
+      st = FillTensor<double>(*this, row_major, num_threads, raw_data);
+      break;
+  }
+  RETURN_NOT_OK(st);
+
+  std::vector<int64_t> shape = {num_rows_, ncolumns};
+  std::vector<int64_t> strides;
+  if (num_rows_ == 0 || ncolumns == 0) {
+    strides = {value_size, value_size};
+  } else if (row_major) {
+    strides = {ncolumns * value_size, value_size};
+  } else {
+    strides = {value_size, num_rows_ * value_size};
+  }
+  *out = std::make_shared<Tensor>(type, data, shape, strides);
+  return Status::OK();
+}
+
+Status RecordBatch::FromTensor(const Tensor& tensor,
+                               const std::vector<std::string>& column_names,
+                               MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
+  if (tensor.ndim() != 2) {
+    std::stringstream ss;
+    ss << "Expected a two-dimensional tensor, got " << tensor.ndim() << " dimensions";
+    return Status::Invalid(ss.str());
+  }
+  const int64_t num_rows = tensor.shape()[0];
+  const int64_t ncolumns = tensor.shape()[1];
+  if (static_cast<int64_t>(column_names.size()) != ncolumns) {
+    std::stringstream ss;
+    ss << "Expected " << ncolumns << " column names, got " << column_names.size();
+    return Status::Invalid(ss.str());
+  }
+  const auto type = tensor.type();
+  const int64_t value_size = BitWidth(*type) / 8;
+  const int64_t row_stride = tensor.strides()[0];
+  const int64_t column_stride = tensor.strides()[1];
+
+  std::vector<std::shared_ptr<Field>> fields(ncolumns);
+  std::vector<std::shared_ptr<Array>> columns(ncolumns);
+  for (int64_t j = 0; j < ncolumns; ++j) {
+    fields[j] = field(column_names[j], type);
+  }
+  RETURN_NOT_OK(
+      ParallelFor(GetCpuThreadPoolCapacity(), static_cast<int>(ncolumns), [&](int j) {
+        std::shared_ptr<Buffer> values;
+        if (num_rows == 0) {
+          values = SliceBuffer(tensor.data(), 0, 0);
+        } else if (row_stride == value_size || num_rows == 1) {
+          values = SliceBuffer(tensor.data(), j * column_stride, num_rows * value_size);
+        } else {
+          RETURN_NOT_OK(AllocateBuffer(pool, num_rows * value_size, &values));
+          const uint8_t* data = tensor.raw_data() + j * column_stride;
+          uint8_t* out_data = values->mutable_data();
+          switch (value_size) {
+            case 1:
+              GatherTensorColumn(data, num_rows, row_stride, out_data);
+              break;
+            case 2:
+              GatherTensorColumn(data, num_rows, row_stride,
+                                 reinterpret_cast<uint16_t*>(out_data));
+              break;
+            case 4:
+              GatherTensorColumn(data, num_rows, row_stride,
+                                 reinterpret_cast<uint32_t*>(out_data));
+              break;
+            default:
+              GatherTensorColumn(data, num_rows, row_stride,
+                                 reinterpret_cast<uint64_t*>(out_data));
+              break;
+          }
+        }
+        columns[j] = MakeArray(ArrayData::Make(type, num_rows, {nullptr, values}, 0));
+        return Status::OK();
+      }));
+  *out = RecordBatch::Make(::arrow::schema(fields), num_rows, std::move(columns));
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Base record batch reader
 
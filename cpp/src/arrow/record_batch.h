@@ -31,7 +31,9 @@
 namespace arrow {
 
 class KeyValueMetadata;
+class MemoryPool;
 class Status;
+class Tensor;
 
 /// \class RecordBatch
 /// \brief Collection of equal-length arrays matching a particular Schema
@@ -149,9 +151,58 @@ class ARROW_EXPORT RecordBatch {
   virtual std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const = 0;
 
   /// \brief Check for schema or length inconsistencies
+  ///
+  /// This takes time proportional to the number of columns, and does not
+  /// look at their data.
+  ///
   /// \return Status
   virtual Status Validate() const;
 
+  /// \brief Perform the checks of Validate, then check the data of each
+  /// column with ValidateArrayFull
+  ///
+  /// Batches read from untrusted sources, such as IPC streams from peers,
+  /// must pass this check before their values are accessed.
+  ///
+  /// \return Status
+  Status ValidateFull() const;
+
+  /// \brief Convert the columns to a two-dimensional tensor of shape
+  /// (num_rows, num_columns), using all the CPU threads
+  Status ToTensor(bool row_major, MemoryPool* pool, std::shared_ptr<Tensor>* out) const;
+
+  /// \brief Convert the columns to a two-dimensional tensor of shape
+  /// (num_rows, num_columns)
+  ///
+  /// The columns must have integer or floating point types, which are
+  /// promoted to a common type as in NumPy: int8 and uint8 to int16, or int32
+  /// and float to double. Null values become NaN, so that columns with nulls
+  /// make the tensor floating point. Row-major tensors are written in tiles
+  /// of rows small enough to stay in the CPU cache, spread over the threads.
+  ///
+  /// \param[in] row_major whether to lay out the rows (C order) or the
+  /// columns (Fortran order) contiguously
+  /// \param[in] pool memory pool to allocate the tensor data from
+  /// \param[in] num_threads number of threads to convert with
+  /// \param[out] out the tensor
+  /// \return Status
+  Status ToTensor(bool row_major, MemoryPool* pool, int num_threads,
+                  std::shared_ptr<Tensor>* out) const;
+
+  /// \brief Make a record batch of the columns of a two-dimensional tensor
+  ///
+  /// The columns of a column-major tensor, or any tensor whose columns are
+  /// contiguous, are slices of its data. Otherwise they are copied.
+  ///
+  /// \param[in] tensor the tensor of shape (num_rows, num_columns)
+  /// \param[in] column_names the names of the num_columns fields
+  /// \param[in] pool memory pool to allocate copied columns from
+  /// \param[out] out the record batch
+  /// \return Status
+  static Status FromTensor(const Tensor& tensor,
+                           const std::vector<std::string>& column_names,
+                           MemoryPool* pool, std::shared_ptr<RecordBatch>* out);
+
  protected:
   RecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows);
 
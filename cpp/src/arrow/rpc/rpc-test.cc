@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/test-common.h"
+#include "arrow/record_batch.h"
+#include "arrow/rpc/rpc.h"
+#include "arrow/rpc/serialization-internal.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+
+namespace arrow {
+namespace rpc {
+
+// Serves tables by name, each stream reading a contiguous range of rows
+class TableService : public RecordBatchService {
+ public:
+  void AddTable(const std::string& name, const std::shared_ptr<Table>& table) {
+    tables_.emplace_back(name, table);
+  }
+
+  Status OpenStream(const StreamRequest& request,
+                    std::shared_ptr<RecordBatchReader>* out) override {
+    for (const auto& entry : tables_) {
+      if (entry.first != request.ticket) {
+        continue;
+      }
+      const int64_t num_rows = entry.second->num_rows();
+      const int64_t begin = num_rows * request.stream_index / request.num_streams;
+      const int64_t end = num_rows * (request.stream_index + 1) / request.num_streams;
+      auto lazy = std::make_shared<LazyTable>(
+          std::make_shared<TableBatchReader>(*entry.second));
+      return lazy->Slice(begin, end - begin)->Scan(out);
+    }
+    return Status::KeyError("No table " + request.ticket);
+  }
+
+ private:
+  std::vector<std::pair<std::string, std::shared_ptr<Table>>> tables_;
+};
+
+class TestRpc : public ::testing::Test {
+ public:
+  void SetUp() {
+    service_ = std::make_shared<TableService>();
+    ASSERT_OK(RpcServer::Start("localhost:0", service_, &server_));
+    ASSERT_OK(RpcClient::Connect("localhost:" + std::to_string(server_->port()),
+                                 &client_));
+  }
+
+  void TearDown() {
+    if (server_) {
+      server_->Shutdown();
+    }
+  }
+
+ protected:
+  std::shared_ptr<TableService> service_;
+  std::unique_ptr<RpcServer> server_;
+  std::unique_ptr<RpcClient> client_;
+};
+
+TEST(TestRpcSerialization, StreamRequest) {
+  StreamRequest request{std::string("ticket\0with nul", 15), 3, 7};
+  grpc::ByteBuffer buffer;
+  ASSERT_TRUE(internal::SerializeRequest(request, &buffer).ok());
+
+  StreamRequest result;
+  ASSERT_TRUE(internal::DeserializeRequest(&buffer, &result).ok());
+  ASSERT_EQ(request.ticket, result.ticket);
+  ASSERT_EQ(3, result.stream_index);
+  ASSERT_EQ(7, result.num_streams);
+}
+
+TEST(TestRpcSerialization, MessageZeroCopy) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+  ipc::IpcPayload payload;
+  ASSERT_OK(ipc::GetRecordBatchPayload(*batch, default_memory_pool(), &payload));
+
+  grpc::ByteBuffer buffer;
+  ASSERT_TRUE(internal::SerializeMessage(payload, &buffer).ok());
+  // The header, then the body buffers and their padding
+  std::vector<grpc::Slice> slices;
+  ASSERT_TRUE(buffer.Dump(&slices).ok());
+  for (const auto& body_buffer : payload.body_buffers) {
+    if (body_buffer && body_buffer->size() > 0) {
+      ASSERT_EQ(body_buffer->data(), slices[1].begin());
+      break;
+    }
+  }
+
+  std::unique_ptr<ipc::Message> message;
+  ASSERT_TRUE(internal::DeserializeMessage(&buffer, &message).ok());
+  ASSERT_EQ(ipc::Message::RECORD_BATCH, message->type());
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(ipc::ReadRecordBatch(*message, batch->schema(), &result));
+  ASSERT_TRUE(batch->Equals(*result));
+}
+
+TEST_F(TestRpc, ReadTable) {
+  std::shared_ptr<RecordBatch> b1, b2;
+  ASSERT_OK(ipc::MakeListRecordBatch(&b1));
+  ASSERT_OK(ipc::MakeListRecordBatch(&b2));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({b1, b2}, &table));
+  service_->AddTable("lists", table);
+
+  for (int num_streams : {1, 3}) {
+    std::shared_ptr<Table> result;
+    ASSERT_OK(client_->ReadTable("lists", num_streams, &result));
+    ASSERT_TRUE(table->Equals(*result));
+  }
+}
+
+TEST_F(TestRpc, Dictionaries) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeDictionary(&batch));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+  service_->AddTable("dictionaries", table);
+
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->OpenStream({"dictionaries", 0, 1}, &reader));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_TRUE(batch->Equals(*result));
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_EQ(nullptr, result);
+}
+
+TEST_F(TestRpc, Errors) {
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(KeyError, client_->OpenStream({"missing", 0, 1}, &reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(KeyError, client_->ReadTable("missing", 2, &result));
+  ASSERT_RAISES(Invalid, client_->ReadTable("missing", 0, &result));
+}
+
+}  // namespace rpc
+}  // namespace arrow
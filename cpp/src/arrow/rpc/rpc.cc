@@ -0,0 +1,303 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/rpc/rpc.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/impl/codegen/client_context.h>
+#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/impl/codegen/rpc_method.h>
+#include <grpcpp/impl/codegen/rpc_service_method.h>
+#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/impl/codegen/sync_stream.h>
+
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/rpc/serialization-internal.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace rpc {
+
+using internal::FromGrpcStatus;
+using internal::IncomingMessage;
+using internal::OutgoingMessage;
+using internal::ToGrpcStatus;
+
+// The only method of the service: read one stream of a dataset
+static const char kDoGetMethod[] = "/arrow.rpc.RecordBatchService/DoGet";
+
+#define RETURN_GRPC_NOT_OK(s)            \
+  do {                                   \
+    ::arrow::Status _s = (s);            \
+    if (ARROW_PREDICT_FALSE(!_s.ok())) { \
+      return ToGrpcStatus(_s);           \
+    }                                    \
+  } while (false)
+
+// ----------------------------------------------------------------------
+// Server
+
+namespace {
+
+// Registers DoGet as protoc would, with the request and messages serialized
+// by the traits of serialization-internal.h
+class GrpcService : public grpc::Service {
+ public:
+  explicit GrpcService(const std::shared_ptr<RecordBatchService>& service)
+      : service_(service) {
+    AddMethod(new grpc::internal::RpcServiceMethod(
+        kDoGetMethod, grpc::internal::RpcMethod::SERVER_STREAMING,
+        new grpc::internal::ServerStreamingHandler<GrpcService, StreamRequest,
+                                                   OutgoingMessage>(
+            [](GrpcService* service, grpc::ServerContext*, const StreamRequest* request,
+               grpc::ServerWriter<OutgoingMessage>* writer) {
+              return service->DoGet(*request, writer);
+            },
+            this)));
+  }
+
+  grpc::Status DoGet(const StreamRequest& request,
+                     grpc::ServerWriter<OutgoingMessage>* writer) {
+    std::shared_ptr<RecordBatchReader> reader;
+    RETURN_GRPC_NOT_OK(service_->OpenStream(request, &reader));
+    MemoryPool* pool = default_memory_pool();
+
+    std::vector<ipc::IpcPayload> schema_payloads;
+    RETURN_GRPC_NOT_OK(ipc::GetSchemaPayloads(*reader->schema(), pool, &schema_payloads));
+    for (const ipc::IpcPayload& payload : schema_payloads) {
+      if (!writer->Write(OutgoingMessage{&payload})) {
+        // The client went away
+        return grpc::Status::CANCELLED;
+      }
+    }
+
+    std::shared_ptr<RecordBatch> batch;
+    ipc::IpcPayload payload;
+    while (true) {
+      RETURN_GRPC_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      RETURN_GRPC_NOT_OK(ipc::GetRecordBatchPayload(*batch, pool, &payload));
+      if (!writer->Write(OutgoingMessage{&payload})) {
+        return grpc::Status::CANCELLED;
+      }
+    }
+    return grpc::Status::OK;
+  }
+
+ private:
+  std::shared_ptr<RecordBatchService> service_;
+};
+
+}  // namespace
+
+class RpcServer::RpcServerImpl {
+ public:
+  Status Start(const std::string& address,
+               const std::shared_ptr<RecordBatchService>& service) {
+    service_.reset(new GrpcService(service));
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(address, grpc::InsecureServerCredentials(), &port_);
+    builder.RegisterService(service_.get());
+    // Record batches routinely exceed the default limit of 4MB
+    builder.SetMaxSendMessageSize(-1);
+    builder.SetMaxReceiveMessageSize(-1);
+    server_ = builder.BuildAndStart();
+    if (!server_) {
+      return Status::IOError("Could not start RPC server on " + address);
+    }
+    return Status::OK();
+  }
+
+  int port() const { return port_; }
+
+  void Shutdown() {
+    if (server_) {
+      server_->Shutdown();
+      server_->Wait();
+      server_.reset();
+    }
+  }
+
+ private:
+  std::unique_ptr<GrpcService> service_;
+  std::unique_ptr<grpc::Server> server_;
+  int port_ = 0;
+};
+
+RpcServer::RpcServer() : impl_(new RpcServerImpl()) {}
+
+RpcServer::~RpcServer() { impl_->Shutdown(); }
+
+Status RpcServer::Start(const std::string& address,
+                        const std::shared_ptr<RecordBatchService>& service,
+                        std::unique_ptr<RpcServer>* out) {
+  std::unique_ptr<RpcServer> server(new RpcServer());
+  RETURN_NOT_OK(server->impl_->Start(address, service));
+  *out = std::move(server);
+  return Status::OK();
+}
+
+int RpcServer::port() const { return impl_->port(); }
+
+void RpcServer::Shutdown() { impl_->Shutdown(); }
+
+// ----------------------------------------------------------------------
+// Client
+
+namespace {
+
+// The messages of a DoGet call, for the IPC stream reader
+class GrpcMessageReader : public ipc::MessageReader {
+ public:
+  GrpcMessageReader(const std::shared_ptr<grpc::Channel>& channel,
+                    const StreamRequest& request)
+      : channel_(channel), finished_(false) {
+    grpc::internal::RpcMethod method(kDoGetMethod,
+                                     grpc::internal::RpcMethod::SERVER_STREAMING);
+    reader_.reset(grpc::internal::ClientReaderFactory<IncomingMessage>::Create(
+        channel_.get(), method, &context_, request));
+  }
+
+  ~GrpcMessageReader() override {
+    if (!finished_) {
+      // Stop the server sending the rest of the stream
+      context_.TryCancel();
+      reader_->Finish();
+    }
+  }
+
+  Status ReadNextMessage(std::unique_ptr<ipc::Message>* message) override {
+    IncomingMessage incoming;
+    if (!finished_ && reader_->Read(&incoming)) {
+      *message = std::move(incoming.message);
+      return Status::OK();
+    }
+    message->reset();
+    if (finished_) {
+      return Status::OK();
+    }
+    finished_ = true;
+    return FromGrpcStatus(reader_->Finish());
+  }
+
+ private:
+  std::shared_ptr<grpc::Channel> channel_;
+  grpc::ClientContext context_;
+  std::unique_ptr<grpc::ClientReader<IncomingMessage>> reader_;
+  bool finished_;
+};
+
+}  // namespace
+
+class RpcClient::RpcClientImpl {
+ public:
+  void Connect(const std::string& address) {
+    grpc::ChannelArguments args;
+    args.SetMaxReceiveMessageSize(-1);
+    channel_ =
+        grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
+  }
+
+  Status OpenStream(const StreamRequest& request,
+                    std::shared_ptr<RecordBatchReader>* out) {
+    std::unique_ptr<ipc::MessageReader> messages(
+        new GrpcMessageReader(channel_, request));
+    return ipc::RecordBatchStreamReader::Open(std::move(messages), out);
+  }
+
+ private:
+  std::shared_ptr<grpc::Channel> channel_;
+};
+
+RpcClient::RpcClient() : impl_(new RpcClientImpl()) {}
+
+RpcClient::~RpcClient() {}
+
+Status RpcClient::Connect(const std::string& address, std::unique_ptr<RpcClient>* out) {
+  std::unique_ptr<RpcClient> client(new RpcClient());
+  client->impl_->Connect(address);
+  *out = std::move(client);
+  return Status::OK();
+}
+
+Status RpcClient::OpenStream(const StreamRequest& request,
+                             std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->OpenStream(request, out);
+}
+
+Status RpcClient::ReadTable(const std::string& ticket, int num_streams,
+                            std::shared_ptr<Table>* out) {
+  if (num_streams <= 0) {
+    return Status::Invalid("The number of streams must be positive");
+  }
+
+  // The streams are network-bound, so each gets its own thread rather than
+  // a task on the CPU thread pool
+  std::vector<std::shared_ptr<Schema>> schemas(num_streams);
+  std::vector<std::vector<std::shared_ptr<RecordBatch>>> batches(num_streams);
+  std::vector<Status> statuses(num_streams);
+  std::vector<std::thread> threads;
+  threads.reserve(num_streams);
+  for (int i = 0; i < num_streams; ++i) {
+    threads.emplace_back([&, i]() {
+      StreamRequest request{ticket, i, num_streams};
+      std::shared_ptr<RecordBatchReader> reader;
+      Status st = OpenStream(request, &reader);
+      if (st.ok()) {
+        schemas[i] = reader->schema();
+      }
+      std::shared_ptr<RecordBatch> batch;
+      while (st.ok()) {
+        st = reader->ReadNext(&batch);
+        if (!st.ok() || batch == nullptr) {
+          break;
+        }
+        batches[i].push_back(batch);
+      }
+      statuses[i] = st;
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> all_batches;
+  for (int i = 0; i < num_streams; ++i) {
+    RETURN_NOT_OK(statuses[i]);
+    if (!schemas[i]->Equals(*schemas[0])) {
+      return Status::Invalid("The streams of " + ticket + " have different schemas");
+    }
+    all_batches.insert(all_batches.end(), batches[i].begin(), batches[i].end());
+  }
+  return Table::FromRecordBatches(schemas[0], all_batches, out);
+}
+
+}  // namespace rpc
+}  // namespace arrow
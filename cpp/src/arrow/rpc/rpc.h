@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Streaming record batches between processes over gRPC
+
+#ifndef ARROW_RPC_RPC_H
+#define ARROW_RPC_RPC_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+class Table;
+
+namespace rpc {
+
+/// \brief A request for one of the streams of record batches of a dataset
+struct ARROW_EXPORT StreamRequest {
+  /// Identifies the dataset, interpreted by the service
+  std::string ticket;
+  /// The stream to read, from 0 to num_streams - 1
+  int32_t stream_index;
+  /// The number of streams the dataset is split into
+  int32_t num_streams;
+};
+
+/// \class RecordBatchService
+/// \brief The datasets served by an RpcServer, implemented by applications
+///
+/// A dataset is split into as many streams as the client requests, which are
+/// read concurrently, each on its own RPC.
+class ARROW_EXPORT RecordBatchService {
+ public:
+  virtual ~RecordBatchService() = default;
+
+  /// \brief Open one of the streams of a dataset
+  ///
+  /// Called concurrently for the streams of a request. The streams of a
+  /// dataset must have the same schema, and hold the record batches of the
+  /// dataset in stream order. The record batches must have the dictionaries
+  /// of the schema, if any.
+  ///
+  /// \param[in] request the dataset and stream to open
+  /// \param[out] out the record batches of the stream
+  /// \return Status, returned to the client if not OK
+  virtual Status OpenStream(const StreamRequest& request,
+                            std::shared_ptr<RecordBatchReader>* out) = 0;
+};
+
+/// \class RpcServer
+/// \brief Serves the record batches of a RecordBatchService over gRPC
+///
+/// Each record batch is sent as an IPC message whose body is handed to gRPC
+/// without copying the Arrow buffers.
+class ARROW_EXPORT RpcServer {
+ public:
+  ~RpcServer();
+
+  /// \brief Start serving on a background thread pool
+  ///
+  /// \param[in] address the address to listen on, such as "0.0.0.0:0" for any
+  /// free port
+  /// \param[in] service the datasets to serve
+  /// \param[out] out the running server
+  /// \return Status, IOError if the server could not start
+  static Status Start(const std::string& address,
+                      const std::shared_ptr<RecordBatchService>& service,
+                      std::unique_ptr<RpcServer>* out);
+
+  /// \return the port listened on
+  int port() const;
+
+  /// \brief Stop serving, cancelling the streams in flight
+  void Shutdown();
+
+ private:
+  RpcServer();
+
+  class RpcServerImpl;
+  std::unique_ptr<RpcServerImpl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(RpcServer);
+};
+
+/// \class RpcClient
+/// \brief Reads record batches from an RpcServer
+class ARROW_EXPORT RpcClient {
+ public:
+  ~RpcClient();
+
+  /// \brief Connect to a server
+  ///
+  /// \param[in] address the address of the server, such as "localhost:1234"
+  /// \param[out] out the client
+  /// \return Status
+  static Status Connect(const std::string& address, std::unique_ptr<RpcClient>* out);
+
+  /// \brief Open one stream of a dataset
+  ///
+  /// The record batches are received as they are read from the reader. Their
+  /// buffers point into the messages received, which are not copied unless
+  /// gRPC delivered them in several pieces. The reader may outlive the client
+  ///
+  /// \param[in] request the dataset and stream to open
+  /// \param[out] out the record batches of the stream
+  /// \return Status, including the errors of the service
+  Status OpenStream(const StreamRequest& request,
+                    std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Read all the streams of a dataset in parallel into a table
+  ///
+  /// Each stream is read by its own thread and RPC.
+  ///
+  /// \param[in] ticket the dataset
+  /// \param[in] num_streams the number of streams to split the dataset into
+  /// \param[out] out the record batches of the streams, in stream order
+  /// \return Status
+  Status ReadTable(const std::string& ticket, int num_streams,
+                   std::shared_ptr<Table>* out);
+
+ private:
+  RpcClient();
+
+  class RpcClientImpl;
+  std::unique_ptr<RpcClientImpl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(RpcClient);
+};
+
+}  // namespace rpc
+}  // namespace arrow
+
+#endif  // ARROW_RPC_RPC_H
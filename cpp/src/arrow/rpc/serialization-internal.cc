@@ -0,0 +1,206 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/rpc/serialization-internal.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <grpcpp/support/slice.h>
+
+#include "arrow/buffer.h"
+#include "arrow/ipc/util.h"
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+namespace rpc {
+namespace internal {
+
+grpc::Status ToGrpcStatus(const Status& status) {
+  if (status.ok()) {
+    return grpc::Status::OK;
+  }
+  grpc::StatusCode code = grpc::StatusCode::UNKNOWN;
+  if (status.IsInvalid()) {
+    code = grpc::StatusCode::INVALID_ARGUMENT;
+  } else if (status.IsKeyError()) {
+    code = grpc::StatusCode::NOT_FOUND;
+  } else if (status.IsNotImplemented()) {
+    code = grpc::StatusCode::UNIMPLEMENTED;
+  } else if (status.IsOutOfMemory()) {
+    code = grpc::StatusCode::RESOURCE_EXHAUSTED;
+  }
+  return grpc::Status(code, status.message());
+}
+
+Status FromGrpcStatus(const grpc::Status& status) {
+  switch (status.error_code()) {
+    case grpc::StatusCode::OK:
+      return Status::OK();
+    case grpc::StatusCode::INVALID_ARGUMENT:
+      return Status::Invalid(status.error_message());
+    case grpc::StatusCode::NOT_FOUND:
+      return Status::KeyError(status.error_message());
+    case grpc::StatusCode::UNIMPLEMENTED:
+      return Status::NotImplemented(status.error_message());
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+      return Status::OutOfMemory(status.error_message());
+    default:
+      return Status::IOError("gRPC error " + std::to_string(status.error_code()) +
+                             ": " + status.error_message());
+  }
+}
+
+// ----------------------------------------------------------------------
+// Messages
+
+// Releases the reference to an Arrow buffer held by a gRPC slice
+static void ReleaseBuffer(void* buffer) {
+  delete reinterpret_cast<std::shared_ptr<Buffer>*>(buffer);
+}
+
+static grpc::Slice PaddingSlice(int64_t size) {
+  return grpc::Slice(ipc::kPaddingBytes, static_cast<size_t>(size),
+                     grpc::Slice::STATIC_SLICE);
+}
+
+grpc::Status SerializeMessage(const ipc::IpcPayload& payload, grpc::ByteBuffer* out) {
+  std::vector<grpc::Slice> slices;
+  slices.reserve(2 + 2 * payload.body_buffers.size());
+
+  // The metadata is small, so it is copied along with its length prefix. The
+  // prefix counts the padding which aligns the body on 8 bytes
+  const int64_t metadata_size = payload.metadata->size();
+  const int32_t prefix_size = static_cast<int32_t>(sizeof(int32_t));
+  const int64_t padded_size =
+      BitUtil::RoundUpToMultipleOf8(prefix_size + metadata_size) - prefix_size;
+  const int32_t prefix = BitUtil::ToLittleEndian(static_cast<int32_t>(padded_size));
+  std::string header(static_cast<size_t>(prefix_size + padded_size), '\0');
+  std::memcpy(&header[0], &prefix, sizeof(int32_t));
+  std::memcpy(&header[prefix_size], payload.metadata->data(),
+              static_cast<size_t>(metadata_size));
+  slices.emplace_back(header);
+
+  for (const std::shared_ptr<Buffer>& buffer : payload.body_buffers) {
+    if (!buffer || buffer->size() == 0) {
+      continue;
+    }
+    const int64_t size = buffer->size();
+    // The slice keeps the buffer alive until gRPC has sent it
+    auto reference = new std::shared_ptr<Buffer>(buffer);
+    slices.emplace_back(const_cast<uint8_t*>(buffer->data()), static_cast<size_t>(size),
+                        ReleaseBuffer, reference);
+    const int64_t padding = BitUtil::RoundUpToMultipleOf8(size) - size;
+    if (padding > 0) {
+      slices.push_back(PaddingSlice(padding));
+    }
+  }
+
+  grpc::ByteBuffer result(slices.data(), slices.size());
+  out->Swap(&result);
+  return grpc::Status::OK;
+}
+
+// A buffer over the bytes of a gRPC slice, holding a reference to it
+class GrpcSliceBuffer : public Buffer {
+ public:
+  explicit GrpcSliceBuffer(const grpc::Slice& slice) : Buffer(nullptr, 0), slice_(slice) {
+    // Small slices are stored inline, so the bytes are those of the copy
+    data_ = slice_.begin();
+    size_ = capacity_ = static_cast<int64_t>(slice_.size());
+  }
+
+ private:
+  grpc::Slice slice_;
+};
+
+grpc::Status DeserializeMessage(grpc::ByteBuffer* buffer,
+                                std::unique_ptr<ipc::Message>* out) {
+  // The messages are usually received as a single slice. Otherwise, its
+  // pieces are concatenated, the IPC reader needing a contiguous body
+  grpc::Slice slice;
+  if (!buffer->TrySingleSlice(&slice).ok()) {
+    grpc::Status status = buffer->DumpToSingleSlice(&slice);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  buffer->Clear();
+
+  auto data = std::make_shared<GrpcSliceBuffer>(slice);
+  const int64_t prefix_size = static_cast<int64_t>(sizeof(int32_t));
+  int32_t metadata_size = 0;
+  if (data->size() >= prefix_size) {
+    std::memcpy(&metadata_size, data->data(), sizeof(int32_t));
+    metadata_size = BitUtil::FromLittleEndian(metadata_size);
+  }
+  if (data->size() < prefix_size || metadata_size <= 0 ||
+      metadata_size > data->size() - prefix_size) {
+    return grpc::Status(grpc::StatusCode::INTERNAL, "Malformed IPC message received");
+  }
+
+  const int64_t body_offset = prefix_size + metadata_size;
+  auto metadata = SliceBuffer(data, prefix_size, metadata_size);
+  auto body = SliceBuffer(data, body_offset, data->size() - body_offset);
+  return ToGrpcStatus(ipc::Message::Open(metadata, body, out));
+}
+
+// ----------------------------------------------------------------------
+// Requests
+
+grpc::Status SerializeRequest(const StreamRequest& request, grpc::ByteBuffer* out) {
+  std::string bytes(2 * sizeof(int32_t) + request.ticket.size(), '\0');
+  const int32_t stream_index = BitUtil::ToLittleEndian(request.stream_index);
+  const int32_t num_streams = BitUtil::ToLittleEndian(request.num_streams);
+  std::memcpy(&bytes[0], &stream_index, sizeof(int32_t));
+  std::memcpy(&bytes[sizeof(int32_t)], &num_streams, sizeof(int32_t));
+  std::memcpy(&bytes[2 * sizeof(int32_t)], request.ticket.data(), request.ticket.size());
+
+  grpc::Slice slice(bytes);
+  grpc::ByteBuffer result(&slice, 1);
+  out->Swap(&result);
+  return grpc::Status::OK;
+}
+
+grpc::Status DeserializeRequest(grpc::ByteBuffer* buffer, StreamRequest* out) {
+  std::vector<grpc::Slice> slices;
+  grpc::Status status = buffer->Dump(&slices);
+  buffer->Clear();
+  if (!status.ok()) {
+    return status;
+  }
+  std::string bytes;
+  for (const grpc::Slice& slice : slices) {
+    bytes.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+  }
+  if (bytes.size() < 2 * sizeof(int32_t)) {
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Malformed stream request");
+  }
+
+  std::memcpy(&out->stream_index, &bytes[0], sizeof(int32_t));
+  std::memcpy(&out->num_streams, &bytes[sizeof(int32_t)], sizeof(int32_t));
+  out->stream_index = BitUtil::FromLittleEndian(out->stream_index);
+  out->num_streams = BitUtil::FromLittleEndian(out->num_streams);
+  out->ticket = bytes.substr(2 * sizeof(int32_t));
+  return grpc::Status::OK;
+}
+
+}  // namespace internal
+}  // namespace rpc
+}  // namespace arrow
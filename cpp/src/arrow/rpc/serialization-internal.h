@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The wire format of the RPC messages, plugged into gRPC in place of
+// protobuf. A stream request is its stream index and number of streams as
+// little-endian int32, followed by the ticket. A response is an IPC message
+// in the encapsulated format of the stream format, without end-of-stream
+// marker: the end of the RPC ends the stream.
+
+#ifndef ARROW_RPC_SERIALIZATION_INTERNAL_H
+#define ARROW_RPC_SERIALIZATION_INTERNAL_H
+
+#include <memory>
+
+#include <grpcpp/impl/codegen/serialization_traits.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/status.h>
+
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/rpc/rpc.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace rpc {
+namespace internal {
+
+/// \brief A message to send, referencing the payload without owning it
+struct OutgoingMessage {
+  const ipc::IpcPayload* payload;
+};
+
+/// \brief A message received
+struct IncomingMessage {
+  std::unique_ptr<ipc::Message> message;
+};
+
+grpc::Status ToGrpcStatus(const Status& status);
+
+Status FromGrpcStatus(const grpc::Status& status);
+
+/// \brief Frame a message as gRPC slices, the body buffers being referenced
+/// rather than copied
+grpc::Status SerializeMessage(const ipc::IpcPayload& payload, grpc::ByteBuffer* out);
+
+/// \brief Parse a message, wrapping the bytes received without copying them
+/// if they came as a single slice
+grpc::Status DeserializeMessage(grpc::ByteBuffer* buffer,
+                                std::unique_ptr<ipc::Message>* out);
+
+grpc::Status SerializeRequest(const StreamRequest& request, grpc::ByteBuffer* out);
+
+grpc::Status DeserializeRequest(grpc::ByteBuffer* buffer, StreamRequest* out);
+
+}  // namespace internal
+}  // namespace rpc
+}  // namespace arrow
+
+namespace grpc {
+
+template <>
+class SerializationTraits<arrow::rpc::internal::OutgoingMessage> {
+ public:
+  static Status Serialize(const arrow::rpc::internal::OutgoingMessage& message,
+                          ByteBuffer* buffer, bool* own_buffer) {
+    *own_buffer = true;
+    return arrow::rpc::internal::SerializeMessage(*message.payload, buffer);
+  }
+};
+
+template <>
+class SerializationTraits<arrow::rpc::internal::IncomingMessage> {
+ public:
+  static Status Deserialize(ByteBuffer* buffer,
+                            arrow::rpc::internal::IncomingMessage* message) {
+    return arrow::rpc::internal::DeserializeMessage(buffer, &message->message);
+  }
+};
+
+template <>
+class SerializationTraits<arrow::rpc::StreamRequest> {
+ public:
+  static Status Serialize(const arrow::rpc::StreamRequest& request, ByteBuffer* buffer,
+                          bool* own_buffer) {
+    *own_buffer = true;
+    return arrow::rpc::internal::SerializeRequest(request, buffer);
+  }
+
+  static Status Deserialize(ByteBuffer* buffer, arrow::rpc::StreamRequest* request) {
+    return arrow::rpc::internal::DeserializeRequest(buffer, request);
+  }
+};
+
+}  // namespace grpc
+
+#endif  // ARROW_RPC_SERIALIZATION_INTERNAL_H
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Unit tests for SparseTensor
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/tensor.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+static void AssertIndexValues(const std::vector<int64_t>& expected,
+                              const Tensor& index) {
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), index.size());
+  ASSERT_TRUE(index.is_row_major());
+  const auto values = reinterpret_cast<const int64_t*>(index.raw_data());
+  ASSERT_EQ(expected, std::vector<int64_t>(values, values + index.size()));
+}
+
+class TestSparseTensor : public ::testing::Test {
+ public:
+  void SetUp() {
+    // 3x4 matrix
+    //   1 0 0 2
+    //   0 0 0 0
+    //   0 3 4 0
+    values_ = {1, 0, 0, 2, 0, 0, 0, 0, 0, 3, 4, 0};
+    dense_ = std::make_shared<Tensor>(int64(), test::GetBufferFromVector(values_),
+                                      std::vector<int64_t>{3, 4},
+                                      std::vector<int64_t>{32, 8},
+                                      std::vector<std::string>{"foo", "bar"});
+  }
+
+  void AssertNonZeroValues(const SparseTensor& sparse) {
+    ASSERT_EQ(4, sparse.non_zero_length());
+    const auto values = reinterpret_cast<const int64_t*>(sparse.raw_data());
+    ASSERT_EQ(std::vector<int64_t>({1, 2, 3, 4}),
+              std::vector<int64_t>(values, values + 4));
+  }
+
+ protected:
+  std::vector<int64_t> values_;
+  std::shared_ptr<Tensor> dense_;
+};
+
+TEST_F(TestSparseTensor, COOFromDense) {
+  std::shared_ptr<SparseTensorCOO> sparse;
+  ASSERT_OK(SparseTensorCOO::Make(*dense_, default_memory_pool(), &sparse));
+
+  ASSERT_EQ(SparseTensorFormat::COO, sparse->format_id());
+  ASSERT_EQ(dense_->shape(), sparse->shape());
+  ASSERT_EQ(12, sparse->size());
+  ASSERT_EQ("bar", sparse->dim_name(1));
+  AssertNonZeroValues(*sparse);
+  AssertIndexValues({0, 0, 0, 3, 2, 1, 2, 2}, *sparse->index().indices());
+
+  std::shared_ptr<Tensor> result;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &result));
+  ASSERT_TRUE(dense_->Equals(*result));
+  ASSERT_EQ("foo", result->dim_name(0));
+}
+
+TEST_F(TestSparseTensor, CSRFromDense) {
+  std::shared_ptr<SparseTensorCSR> sparse;
+  ASSERT_OK(SparseTensorCSR::Make(*dense_, default_memory_pool(), &sparse));
+
+  ASSERT_EQ(SparseTensorFormat::CSR, sparse->format_id());
+  AssertNonZeroValues(*sparse);
+  AssertIndexValues({0, 2, 2, 4}, *sparse->index().indptr());
+  AssertIndexValues({0, 3, 1, 2}, *sparse->index().indices());
+
+  std::shared_ptr<Tensor> result;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &result));
+  ASSERT_TRUE(dense_->Equals(*result));
+
+  Tensor cube(int64(), dense_->data(), {3, 2, 2});
+  ASSERT_RAISES(Invalid, SparseTensorCSR::Make(cube, default_memory_pool(), &sparse));
+}
+
+TEST_F(TestSparseTensor, FromStridedDense) {
+  // Every other column of the matrix
+  Tensor strided(int64(), dense_->data(), {3, 2}, {32, 16});
+
+  std::shared_ptr<SparseTensorCOO> sparse;
+  ASSERT_OK(SparseTensorCOO::Make(strided, default_memory_pool(), &sparse));
+  AssertIndexValues({0, 0, 2, 1}, *sparse->index().indices());
+
+  std::shared_ptr<Tensor> result;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &result));
+  ASSERT_TRUE(result->is_row_major());
+  ASSERT_TRUE(strided.Equals(*result));
+}
+
+TEST_F(TestSparseTensor, EmptyAndAllZero) {
+  std::vector<double> zeros(6, 0);
+  Tensor dense(float64(), test::GetBufferFromVector(zeros), {2, 3});
+
+  std::shared_ptr<SparseTensorCSR> sparse;
+  ASSERT_OK(SparseTensorCSR::Make(dense, default_memory_pool(), &sparse));
+  ASSERT_EQ(0, sparse->non_zero_length());
+  AssertIndexValues({0, 0, 0}, *sparse->index().indptr());
+
+  std::shared_ptr<Tensor> result;
+  ASSERT_OK(sparse->ToTensor(default_memory_pool(), &result));
+  ASSERT_TRUE(dense.Equals(*result));
+
+  Tensor empty(float64(), test::GetBufferFromVector(zeros), {0, 3});
+  std::shared_ptr<SparseTensorCOO> coo;
+  ASSERT_OK(SparseTensorCOO::Make(empty, default_memory_pool(), &coo));
+  ASSERT_EQ(0, coo->non_zero_length());
+  ASSERT_EQ(std::vector<int64_t>({0, 2}), coo->index().indices()->shape());
+}
+
+TEST_F(TestSparseTensor, Equals) {
+  std::shared_ptr<SparseTensorCOO> coo1, coo2;
+  std::shared_ptr<SparseTensorCSR> csr;
+  ASSERT_OK(SparseTensorCOO::Make(*dense_, default_memory_pool(), &coo1));
+  ASSERT_OK(SparseTensorCOO::Make(*dense_, default_memory_pool(), &coo2));
+  ASSERT_OK(SparseTensorCSR::Make(*dense_, default_memory_pool(), &csr));
+
+  ASSERT_TRUE(coo1->Equals(*coo2));
+  ASSERT_FALSE(coo1->Equals(*csr));
+
+  std::vector<int64_t> other_values = values_;
+  other_values[3] = 5;
+  Tensor other(int64(), test::GetBufferFromVector(other_values), {3, 4});
+  ASSERT_OK(SparseTensorCOO::Make(other, default_memory_pool(), &coo2));
+  ASSERT_FALSE(coo1->Equals(*coo2));
+}
+
+TEST_F(TestSparseTensor, OutOfBoundsIndex) {
+  std::vector<int64_t> coords_values = {0, 0, 3, 0};
+  auto coords = std::make_shared<Tensor>(
+      int64(), test::GetBufferFromVector(coords_values), std::vector<int64_t>{2, 2});
+  std::vector<int64_t> values = {1, 2};
+  SparseTensorCOO sparse(std::make_shared<SparseCOOIndex>(coords), int64(),
+                         test::GetBufferFromVector(values), {3, 4});
+
+  std::shared_ptr<Tensor> result;
+  ASSERT_RAISES(Invalid, sparse.ToTensor(default_memory_pool(), &result));
+}
+
+}  // namespace arrow
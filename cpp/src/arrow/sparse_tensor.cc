@@ -0,0 +1,348 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/sparse_tensor.h"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/compare.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+namespace {
+
+// The i-th value of an int64 vector, or the (i, j)-th of an int64 matrix,
+// whatever their strides
+inline int64_t IndexValue(const Tensor& index, int64_t i) {
+  return *reinterpret_cast<const int64_t*>(index.raw_data() + i * index.strides()[0]);
+}
+
+inline int64_t IndexValue(const Tensor& index, int64_t i, int64_t j) {
+  return *reinterpret_cast<const int64_t*>(index.raw_data() + i * index.strides()[0] +
+                                           j * index.strides()[1]);
+}
+
+Status MakeIndexTensor(MemoryPool* pool, const std::vector<int64_t>& values,
+                       const std::vector<int64_t>& shape, std::shared_ptr<Tensor>* out) {
+  const int64_t nbytes = static_cast<int64_t>(values.size() * sizeof(int64_t));
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, nbytes, &data));
+  if (nbytes > 0) {
+    memcpy(data->mutable_data(), values.data(), static_cast<size_t>(nbytes));
+  }
+  *out = std::make_shared<Tensor>(int64(), data, shape);
+  return Status::OK();
+}
+
+// Append the coordinates and values of the non-zero cells of a tensor, in
+// row-major order
+template <typename c_type>
+void GatherNonZero(const Tensor& tensor, int dim_index, int64_t offset,
+                   std::vector<int64_t>* coord, std::vector<int64_t>* coords,
+                   std::vector<c_type>* values) {
+  if (dim_index == tensor.ndim()) {
+    const c_type value = *reinterpret_cast<const c_type*>(tensor.raw_data() + offset);
+    if (value != 0) {
+      coords->insert(coords->end(), coord->begin(), coord->end());
+      values->push_back(value);
+    }
+    return;
+  }
+  for (int64_t i = 0; i < tensor.shape()[dim_index]; ++i) {
+    (*coord)[dim_index] = i;
+    GatherNonZero(tensor, dim_index + 1, offset, coord, coords, values);
+    offset += tensor.strides()[dim_index];
+  }
+}
+
+template <typename c_type>
+Status GatherNonZero(const Tensor& tensor, MemoryPool* pool, std::vector<int64_t>* coords,
+                     std::shared_ptr<Buffer>* data) {
+  std::vector<c_type> values;
+  if (tensor.size() > 0) {
+    std::vector<int64_t> coord(tensor.ndim());
+    GatherNonZero(tensor, 0, 0, &coord, coords, &values);
+  }
+  const int64_t nbytes = static_cast<int64_t>(values.size() * sizeof(c_type));
+  RETURN_NOT_OK(AllocateBuffer(pool, nbytes, data));
+  if (nbytes > 0) {
+    memcpy((*data)->mutable_data(), values.data(), static_cast<size_t>(nbytes));
+  }
+  return Status::OK();
+}
+
+#define GATHER_NON_ZERO_CASE(TYPE_CLASS)                              \
+  case TYPE_CLASS::type_id:                                           \
+    return GatherNonZero<TYPE_CLASS::c_type>(tensor, pool, coords, data);
+
+// The row-major coordinates of the non-zero values of a tensor, and the values
+Status GatherNonZero(const Tensor& tensor, MemoryPool* pool, std::vector<int64_t>* coords,
+                     std::shared_ptr<Buffer>* data) {
+  switch (tensor.type_id()) {
+    GATHER_NON_ZERO_CASE(UInt8Type);
+    GATHER_NON_ZERO_CASE(Int8Type);
+    GATHER_NON_ZERO_CASE(UInt16Type);
+    GATHER_NON_ZERO_CASE(Int16Type);
+    GATHER_NON_ZERO_CASE(UInt32Type);
+    GATHER_NON_ZERO_CASE(Int32Type);
+    GATHER_NON_ZERO_CASE(UInt64Type);
+    GATHER_NON_ZERO_CASE(Int64Type);
+    GATHER_NON_ZERO_CASE(HalfFloatType);
+    GATHER_NON_ZERO_CASE(FloatType);
+    GATHER_NON_ZERO_CASE(DoubleType);
+    default:
+      break;
+  }
+  std::stringstream ss;
+  ss << "Cannot make a sparse tensor of type " << tensor.type()->ToString();
+  return Status::NotImplemented(ss.str());
+}
+
+#undef GATHER_NON_ZERO_CASE
+
+Status MakeSparseIndex(const Tensor& tensor, MemoryPool* pool,
+                       std::shared_ptr<SparseCOOIndex>* out,
+                       std::shared_ptr<Buffer>* data) {
+  std::vector<int64_t> coords;
+  RETURN_NOT_OK(GatherNonZero(tensor, pool, &coords, data));
+
+  const auto& type = static_cast<const FixedWidthType&>(*tensor.type());
+  const int64_t non_zero_length = (*data)->size() / (type.bit_width() / 8);
+  const int64_t ndim = tensor.ndim();
+  std::shared_ptr<Tensor> coords_tensor;
+  RETURN_NOT_OK(MakeIndexTensor(pool, coords, {non_zero_length, ndim}, &coords_tensor));
+  *out = std::make_shared<SparseCOOIndex>(coords_tensor);
+  return Status::OK();
+}
+
+Status MakeSparseIndex(const Tensor& tensor, MemoryPool* pool,
+                       std::shared_ptr<SparseCSRIndex>* out,
+                       std::shared_ptr<Buffer>* data) {
+  if (tensor.ndim() != 2) {
+    return Status::Invalid("A CSR sparse index can only be made for a matrix");
+  }
+  std::vector<int64_t> coords;
+  RETURN_NOT_OK(GatherNonZero(tensor, pool, &coords, data));
+
+  // The coordinates are sorted by row
+  const int64_t nrows = tensor.shape()[0];
+  const int64_t non_zero_length = static_cast<int64_t>(coords.size()) / 2;
+  std::vector<int64_t> indptr(nrows + 1, 0);
+  std::vector<int64_t> indices(non_zero_length);
+  for (int64_t i = 0; i < non_zero_length; ++i) {
+    ++indptr[coords[2 * i] + 1];
+    indices[i] = coords[2 * i + 1];
+  }
+  std::partial_sum(indptr.begin(), indptr.end(), indptr.begin());
+
+  std::shared_ptr<Tensor> indptr_tensor;
+  std::shared_ptr<Tensor> indices_tensor;
+  RETURN_NOT_OK(MakeIndexTensor(pool, indptr, {nrows + 1}, &indptr_tensor));
+  RETURN_NOT_OK(MakeIndexTensor(pool, indices, {non_zero_length}, &indices_tensor));
+  *out = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
+  return Status::OK();
+}
+
+Status OutOfBoundsError(int64_t i) {
+  std::stringstream ss;
+  ss << "Sparse index of non-zero value " << i << " is out of bounds";
+  return Status::Invalid(ss.str());
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// SparseCOOIndex
+
+SparseCOOIndex::SparseCOOIndex(const std::shared_ptr<Tensor>& coords)
+    : SparseIndex(SparseTensorFormat::COO, coords->shape()[0]), coords_(coords) {
+  DCHECK_EQ(Type::INT64, coords->type_id());
+  DCHECK_EQ(2, coords->ndim());
+}
+
+std::string SparseCOOIndex::ToString() const { return std::string("SparseCOOIndex"); }
+
+bool SparseCOOIndex::Equals(const SparseCOOIndex& other) const {
+  return coords_->shape() == other.coords_->shape() && coords_->Equals(*other.coords_);
+}
+
+// ----------------------------------------------------------------------
+// SparseCSRIndex
+
+SparseCSRIndex::SparseCSRIndex(const std::shared_ptr<Tensor>& indptr,
+                               const std::shared_ptr<Tensor>& indices)
+    : SparseIndex(SparseTensorFormat::CSR, indices->shape()[0]),
+      indptr_(indptr),
+      indices_(indices) {
+  DCHECK_EQ(Type::INT64, indptr->type_id());
+  DCHECK_EQ(1, indptr->ndim());
+  DCHECK_EQ(Type::INT64, indices->type_id());
+  DCHECK_EQ(1, indices->ndim());
+}
+
+std::string SparseCSRIndex::ToString() const { return std::string("SparseCSRIndex"); }
+
+bool SparseCSRIndex::Equals(const SparseCSRIndex& other) const {
+  return indptr_->shape() == other.indptr_->shape() &&
+         indices_->shape() == other.indices_->shape() &&
+         indptr_->Equals(*other.indptr_) && indices_->Equals(*other.indices_);
+}
+
+// ----------------------------------------------------------------------
+// SparseTensor
+
+SparseTensor::SparseTensor(const std::shared_ptr<DataType>& type,
+                           const std::shared_ptr<Buffer>& data,
+                           const std::vector<int64_t>& shape,
+                           const std::shared_ptr<SparseIndex>& sparse_index,
+                           const std::vector<std::string>& dim_names)
+    : type_(type),
+      data_(data),
+      shape_(shape),
+      sparse_index_(sparse_index),
+      dim_names_(dim_names) {
+  DCHECK(is_tensor_supported(type->id()));
+}
+
+const std::string& SparseTensor::dim_name(int i) const {
+  static const std::string kEmpty = "";
+  if (dim_names_.size() == 0) {
+    return kEmpty;
+  } else {
+    DCHECK_LT(i, static_cast<int>(dim_names_.size()));
+    return dim_names_[i];
+  }
+}
+
+int64_t SparseTensor::size() const {
+  return std::accumulate(shape_.begin(), shape_.end(), 1LL, std::multiplies<int64_t>());
+}
+
+bool SparseTensor::Equals(const SparseTensor& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (format_id() != other.format_id() || !type_->Equals(*other.type_) ||
+      shape_ != other.shape_ || non_zero_length() != other.non_zero_length()) {
+    return false;
+  }
+  switch (format_id()) {
+    case SparseTensorFormat::COO:
+      if (!static_cast<const SparseCOOIndex&>(*sparse_index_)
+               .Equals(static_cast<const SparseCOOIndex&>(*other.sparse_index_))) {
+        return false;
+      }
+      break;
+    case SparseTensorFormat::CSR:
+      if (!static_cast<const SparseCSRIndex&>(*sparse_index_)
+               .Equals(static_cast<const SparseCSRIndex&>(*other.sparse_index_))) {
+        return false;
+      }
+      break;
+  }
+  const auto& fw_type = static_cast<const FixedWidthType&>(*type_);
+  const int64_t nbytes = non_zero_length() * fw_type.bit_width() / 8;
+  return nbytes == 0 ||
+         memcmp(raw_data(), other.raw_data(), static_cast<size_t>(nbytes)) == 0;
+}
+
+Status SparseTensor::ToTensor(MemoryPool* pool, std::shared_ptr<Tensor>* out) const {
+  const auto& fw_type = static_cast<const FixedWidthType&>(*type_);
+  const int64_t elem_size = fw_type.bit_width() / 8;
+
+  std::shared_ptr<Buffer> dense;
+  RETURN_NOT_OK(AllocateZeroedBuffer(pool, size() * elem_size, &dense));
+  uint8_t* dense_data = dense->mutable_data();
+  const uint8_t* values = non_zero_length() > 0 ? raw_data() : nullptr;
+
+  switch (format_id()) {
+    case SparseTensorFormat::COO: {
+      const auto& index = static_cast<const SparseCOOIndex&>(*sparse_index_);
+      const Tensor& coords = *index.indices();
+      for (int64_t i = 0; i < non_zero_length(); ++i) {
+        int64_t position = 0;
+        for (int j = 0; j < ndim(); ++j) {
+          const int64_t coord = IndexValue(coords, i, j);
+          if (coord < 0 || coord >= shape_[j]) {
+            return OutOfBoundsError(i);
+          }
+          position = position * shape_[j] + coord;
+        }
+        memcpy(dense_data + position * elem_size, values + i * elem_size, elem_size);
+      }
+      break;
+    }
+    case SparseTensorFormat::CSR: {
+      const auto& index = static_cast<const SparseCSRIndex&>(*sparse_index_);
+      const Tensor& indptr = *index.indptr();
+      const Tensor& indices = *index.indices();
+      if (ndim() != 2 || indptr.shape()[0] != shape_[0] + 1) {
+        return Status::Invalid("CSR sparse index does not match the tensor shape");
+      }
+      const int64_t ncols = shape_[1];
+      for (int64_t row = 0; row < shape_[0]; ++row) {
+        const int64_t start = IndexValue(indptr, row);
+        const int64_t end = IndexValue(indptr, row + 1);
+        if (start < 0 || end < start || end > non_zero_length()) {
+          return OutOfBoundsError(start);
+        }
+        for (int64_t i = start; i < end; ++i) {
+          const int64_t col = IndexValue(indices, i);
+          if (col < 0 || col >= ncols) {
+            return OutOfBoundsError(i);
+          }
+          memcpy(dense_data + (row * ncols + col) * elem_size, values + i * elem_size,
+                 elem_size);
+        }
+      }
+      break;
+    }
+  }
+
+  *out = std::make_shared<Tensor>(type_, dense, shape_, std::vector<int64_t>{},
+                                  dim_names_);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// SparseTensorImpl
+
+template <typename SparseIndexType>
+Status SparseTensorImpl<SparseIndexType>::Make(const Tensor& tensor, MemoryPool* pool,
+                                               std::shared_ptr<SparseTensorImpl>* out) {
+  std::shared_ptr<SparseIndexType> sparse_index;
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(MakeSparseIndex(tensor, pool, &sparse_index, &data));
+  *out = std::make_shared<SparseTensorImpl>(sparse_index, tensor.type(), data,
+                                            tensor.shape(), tensor.dim_names());
+  return Status::OK();
+}
+
+template class ARROW_TEMPLATE_EXPORT SparseTensorImpl<SparseCOOIndex>;
+template class ARROW_TEMPLATE_EXPORT SparseTensorImpl<SparseCSRIndex>;
+
+}  // namespace arrow
@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_SPARSE_TENSOR_H
+#define ARROW_SPARSE_TENSOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/tensor.h"
+#include "arrow/type.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Status;
+
+struct SparseTensorFormat {
+  /// EXPERIMENTAL: The index format of a sparse tensor
+  enum type {
+    /// Coordinate list: the coordinates of every non-zero value
+    COO,
+    /// Compressed sparse row, for matrices only
+    CSR
+  };
+};
+
+/// \brief EXPERIMENTAL: The locations of the non-zero values of a sparse tensor
+class ARROW_EXPORT SparseIndex {
+ public:
+  SparseIndex(SparseTensorFormat::type format_id, int64_t non_zero_length)
+      : format_id_(format_id), non_zero_length_(non_zero_length) {}
+
+  virtual ~SparseIndex() = default;
+
+  SparseTensorFormat::type format_id() const { return format_id_; }
+
+  /// Number of non-zero values
+  int64_t non_zero_length() const { return non_zero_length_; }
+
+  virtual std::string ToString() const = 0;
+
+ protected:
+  SparseTensorFormat::type format_id_;
+  int64_t non_zero_length_;
+};
+
+/// \brief EXPERIMENTAL: Coordinate list index
+///
+/// The coordinates are a row-major int64 tensor of shape (non-zero length,
+/// ndim), whose i-th row locates the i-th non-zero value
+class ARROW_EXPORT SparseCOOIndex : public SparseIndex {
+ public:
+  explicit SparseCOOIndex(const std::shared_ptr<Tensor>& coords);
+
+  const std::shared_ptr<Tensor>& indices() const { return coords_; }
+
+  std::string ToString() const override;
+
+  bool Equals(const SparseCOOIndex& other) const;
+
+ protected:
+  std::shared_ptr<Tensor> coords_;
+};
+
+/// \brief EXPERIMENTAL: Compressed sparse row index of a matrix
+///
+/// indptr is an int64 vector of length nrows + 1; the columns of the non-zero
+/// values of row i are indices[indptr[i]:indptr[i + 1]]
+class ARROW_EXPORT SparseCSRIndex : public SparseIndex {
+ public:
+  SparseCSRIndex(const std::shared_ptr<Tensor>& indptr,
+                 const std::shared_ptr<Tensor>& indices);
+
+  const std::shared_ptr<Tensor>& indptr() const { return indptr_; }
+  const std::shared_ptr<Tensor>& indices() const { return indices_; }
+
+  std::string ToString() const override;
+
+  bool Equals(const SparseCSRIndex& other) const;
+
+ protected:
+  std::shared_ptr<Tensor> indptr_;
+  std::shared_ptr<Tensor> indices_;
+};
+
+/// \brief EXPERIMENTAL: A tensor storing only its non-zero values
+///
+/// The values are a contiguous buffer of non_zero_length() cells, located by
+/// the sparse index
+class ARROW_EXPORT SparseTensor {
+ public:
+  virtual ~SparseTensor() = default;
+
+  SparseTensorFormat::type format_id() const { return sparse_index_->format_id(); }
+
+  std::shared_ptr<DataType> type() const { return type_; }
+  std::shared_ptr<Buffer> data() const { return data_; }
+
+  const uint8_t* raw_data() const { return data_->data(); }
+
+  const std::vector<int64_t>& shape() const { return shape_; }
+
+  const std::shared_ptr<SparseIndex>& sparse_index() const { return sparse_index_; }
+
+  int ndim() const { return static_cast<int>(shape_.size()); }
+
+  const std::vector<std::string>& dim_names() const { return dim_names_; }
+  const std::string& dim_name(int i) const;
+
+  /// Total number of value cells, zero or not, in the sparse tensor
+  int64_t size() const;
+
+  /// Number of non-zero values
+  int64_t non_zero_length() const { return sparse_index_->non_zero_length(); }
+
+  /// Return true if the underlying data buffer is mutable
+  bool is_mutable() const { return data_->is_mutable(); }
+
+  bool Equals(const SparseTensor& other) const;
+
+  /// \brief Convert to a row-major dense tensor
+  Status ToTensor(MemoryPool* pool, std::shared_ptr<Tensor>* out) const;
+
+ protected:
+  SparseTensor(const std::shared_ptr<DataType>& type, const std::shared_ptr<Buffer>& data,
+               const std::vector<int64_t>& shape,
+               const std::shared_ptr<SparseIndex>& sparse_index,
+               const std::vector<std::string>& dim_names);
+
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Buffer> data_;
+  std::vector<int64_t> shape_;
+  std::shared_ptr<SparseIndex> sparse_index_;
+
+  /// These names are optional
+  std::vector<std::string> dim_names_;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SparseTensor);
+};
+
+/// \brief EXPERIMENTAL: A sparse tensor with a given index format
+template <typename SparseIndexType>
+class ARROW_EXPORT SparseTensorImpl : public SparseTensor {
+ public:
+  SparseTensorImpl(const std::shared_ptr<SparseIndexType>& sparse_index,
+                   const std::shared_ptr<DataType>& type,
+                   const std::shared_ptr<Buffer>& data, const std::vector<int64_t>& shape,
+                   const std::vector<std::string>& dim_names = {})
+      : SparseTensor(type, data, shape, sparse_index, dim_names) {}
+
+  const SparseIndexType& index() const {
+    return static_cast<const SparseIndexType&>(*sparse_index_);
+  }
+
+  /// \brief Gather the non-zero values of a dense tensor
+  ///
+  /// The values are ordered as in a row-major traversal of the tensor,
+  /// whatever its strides
+  static Status Make(const Tensor& tensor, MemoryPool* pool,
+                     std::shared_ptr<SparseTensorImpl>* out);
+};
+
+using SparseTensorCOO = SparseTensorImpl<SparseCOOIndex>;
+using SparseTensorCSR = SparseTensorImpl<SparseCSRIndex>;
+
+}  // namespace arrow
+
+#endif  // ARROW_SPARSE_TENSOR_H
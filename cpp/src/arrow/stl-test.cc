@@ -15,9 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "arrow/stl.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
 
 namespace arrow {
 namespace stl {
@@ -74,5 +82,70 @@ TEST(TestSchemaFromTuple, NestedList) {
   ASSERT_TRUE(expected_schema.Equals(*schema));
 }
 
+TEST(TestTableFromTupleRange, RoundTrip) {
+  using row_type = std::tuple<int64_t, double, std::string, std::vector<int32_t>>;
+  std::vector<row_type> rows;
+  // Span several blocks
+  const int64_t num_rows = 2 * kTupleBlockSize + 3;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    rows.emplace_back(i, 0.5 * static_cast<double>(i), std::to_string(i),
+                      std::vector<int32_t>(i % 4, static_cast<int32_t>(i)));
+  }
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), rows,
+                                {"int", "double", "string", "list"}, &table));
+  ASSERT_EQ(num_rows, table->num_rows());
+  ASSERT_EQ(4, table->num_columns());
+  ASSERT_TRUE(table->schema()->Equals(
+      *SchemaFromTuple<row_type>::MakeSchema({"int", "double", "string", "list"})));
+
+  const auto& strings =
+      static_cast<const StringArray&>(*table->column(2)->data()->chunk(0));
+  ASSERT_EQ("1027", strings.GetString(1027));
+
+  std::vector<row_type> result;
+  ASSERT_OK(TupleRangeFromTable(*table, &result));
+  ASSERT_EQ(rows, result);
+}
+
+TEST(TestTableFromTupleRange, Chunked) {
+  using row_type = std::tuple<int32_t, std::string>;
+  std::vector<row_type> first = {row_type(1, "a"), row_type(2, "b")};
+  std::vector<row_type> second = {row_type(3, "c")};
+
+  std::shared_ptr<Table> table1, table2, table;
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), first, {"i", "s"}, &table1));
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), second, {"i", "s"}, &table2));
+  ASSERT_OK(ConcatenateTables({table1, table2}, &table));
+
+  std::vector<row_type> result;
+  ASSERT_OK(TupleRangeFromTable(*table, &result));
+  ASSERT_EQ(std::vector<row_type>({row_type(1, "a"), row_type(2, "b"), row_type(3, "c")}),
+            result);
+}
+
+TEST(TestTableFromTupleRange, Errors) {
+  using row_type = std::tuple<int32_t, std::string>;
+  std::vector<row_type> rows = {row_type(1, "a")};
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, TableFromTupleRange(default_memory_pool(), rows, {"i"}, &table));
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), rows, {"i", "s"}, &table));
+
+  std::vector<std::tuple<int64_t, std::string>> wrong_type;
+  ASSERT_RAISES(Invalid, TupleRangeFromTable(*table, &wrong_type));
+  std::vector<std::tuple<int32_t>> wrong_width;
+  ASSERT_RAISES(Invalid, TupleRangeFromTable(*table, &wrong_width));
+
+  // Nulls have no tuple representation
+  Int32Builder builder;
+  ASSERT_OK(builder.AppendNull());
+  std::shared_ptr<Array> nulls;
+  ASSERT_OK(builder.Finish(&nulls));
+  auto null_table = Table::Make(::arrow::schema({field("i", int32())}), {nulls});
+  std::vector<std::tuple<int32_t>> null_rows;
+  ASSERT_RAISES(Invalid, TupleRangeFromTable(*null_table, &null_rows));
+}
+
 }  // namespace stl
 }  // namespace arrow
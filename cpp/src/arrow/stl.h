@@ -18,28 +18,49 @@
 #ifndef ARROW_STL_H
 #define ARROW_STL_H
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 
 namespace arrow {
 
+class MemoryPool;
 class Schema;
 
 namespace stl {
 
 /// Traits meta class to map standard C/C++ types to equivalent Arrow types.
+///
+/// Besides the Arrow type, each specialization defines the builder and array
+/// classes of the type, how to append a value to the builder (AppendRow) and
+/// how to read it back from the array (GetEntry).
 template <typename T>
 struct ConversionTraits {};
 
-#define ARROW_STL_CONVERSION(c_type, ArrowType_) \
-  template <>                                    \
-  struct ConversionTraits<c_type> {              \
-    using ArrowType = ArrowType_;                \
-    constexpr static bool nullable = false;      \
+#define ARROW_STL_CONVERSION(c_type, ArrowType_)                                      \
+  template <>                                                                         \
+  struct ConversionTraits<c_type> {                                                   \
+    using ArrowType = ArrowType_;                                                     \
+    using BuilderType = typename TypeTraits<ArrowType>::BuilderType;                  \
+    using ArrayType = typename TypeTraits<ArrowType>::ArrayType;                      \
+    constexpr static bool nullable = false;                                           \
+    static Status AppendRow(BuilderType& builder, c_type cell) { /* NOLINT */         \
+      return builder.Append(cell);                                                    \
+    }                                                                                 \
+    static c_type GetEntry(const ArrayType& array, int64_t j) { return array.Value(j); } \
   };
 
 ARROW_STL_CONVERSION(bool, BooleanType)
@@ -53,12 +74,50 @@ ARROW_STL_CONVERSION(uint32_t, UInt32Type)
 ARROW_STL_CONVERSION(uint64_t, UInt64Type)
 ARROW_STL_CONVERSION(float, FloatType)
 ARROW_STL_CONVERSION(double, DoubleType)
-ARROW_STL_CONVERSION(std::string, StringType)
+
+#undef ARROW_STL_CONVERSION
+
+template <>
+struct ConversionTraits<std::string> {
+  using ArrowType = StringType;
+  using BuilderType = StringBuilder;
+  using ArrayType = StringArray;
+  constexpr static bool nullable = false;
+  static Status AppendRow(BuilderType& builder, const std::string& cell) {  // NOLINT
+    return builder.Append(cell);
+  }
+  static std::string GetEntry(const ArrayType& array, int64_t j) {
+    return array.GetString(j);
+  }
+};
 
 template <typename value_c_type>
 struct ConversionTraits<std::vector<value_c_type>> {
-  using ArrowType = meta::ListType<typename ConversionTraits<value_c_type>::ArrowType>;
+  using ValueTraits = ConversionTraits<value_c_type>;
+  using ArrowType = meta::ListType<typename ValueTraits::ArrowType>;
+  using BuilderType = ListBuilder;
+  using ArrayType = ListArray;
   constexpr static bool nullable = false;
+  static Status AppendRow(BuilderType& builder,  // NOLINT
+                          const std::vector<value_c_type>& cell) {
+    auto value_builder =
+        static_cast<typename ValueTraits::BuilderType*>(builder.value_builder());
+    RETURN_NOT_OK(builder.Append());
+    for (const value_c_type& value : cell) {
+      RETURN_NOT_OK(ValueTraits::AppendRow(*value_builder, value));
+    }
+    return Status::OK();
+  }
+  static std::vector<value_c_type> GetEntry(const ArrayType& array, int64_t j) {
+    const auto& values =
+        static_cast<const typename ValueTraits::ArrayType&>(*array.values());
+    std::vector<value_c_type> cell;
+    cell.reserve(array.value_length(j));
+    for (int32_t k = array.value_offset(j); k < array.value_offset(j + 1); ++k) {
+      cell.push_back(ValueTraits::GetEntry(values, k));
+    }
+    return cell;
+  }
 };
 
 /// Build an arrow::Schema based upon the types defined in a std::tuple-like structure.
@@ -148,6 +207,142 @@ struct SchemaFromTuple<Tuple, 0> {
 };
 /// @endcond
 
+/// @cond FALSE
+namespace detail {
+
+// Column-wise conversions between the first N columns of tuples and arrays
+template <typename Tuple, std::size_t N = std::tuple_size<Tuple>::value>
+struct TupleColumns {
+  using Element = typename std::tuple_element<N - 1, Tuple>::type;
+  using Traits = ConversionTraits<Element>;
+
+  // Append the columns of the rows [begin, end)
+  template <typename Iterator>
+  static Status Append(Iterator begin, Iterator end,
+                       const std::vector<ArrayBuilder*>& builders) {
+    RETURN_NOT_OK((TupleColumns<Tuple, N - 1>::Append(begin, end, builders)));
+    auto builder = static_cast<typename Traits::BuilderType*>(builders[N - 1]);
+    for (Iterator it = begin; it != end; ++it) {
+      RETURN_NOT_OK(Traits::AppendRow(*builder, std::get<N - 1>(*it)));
+    }
+    return Status::OK();
+  }
+
+  // Set the elements of table.num_rows() rows from the columns of table
+  static Status Get(const Table& table, Tuple* rows) {
+    RETURN_NOT_OK((TupleColumns<Tuple, N - 1>::Get(table, rows)));
+    const Column& column = *table.column(static_cast<int>(N - 1));
+    const typename Traits::ArrowType expected_type;
+    if (!column.type()->Equals(expected_type)) {
+      std::stringstream ss;
+      ss << "Cannot convert column " << column.name() << " of type "
+         << column.type()->ToString() << " to " << expected_type.ToString();
+      return Status::Invalid(ss.str());
+    }
+    if (column.null_count() > 0) {
+      return Status::Invalid("Cannot convert column " + column.name() +
+                             " holding nulls to non-nullable values");
+    }
+    int64_t row = 0;
+    for (const auto& chunk : column.data()->chunks()) {
+      const auto& array = static_cast<const typename Traits::ArrayType&>(*chunk);
+      for (int64_t j = 0; j < array.length(); ++j) {
+        std::get<N - 1>(rows[row++]) = Traits::GetEntry(array, j);
+      }
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Tuple>
+struct TupleColumns<Tuple, 0> {
+  template <typename Iterator>
+  static Status Append(Iterator, Iterator, const std::vector<ArrayBuilder*>&) {
+    return Status::OK();
+  }
+
+  static Status Get(const Table&, Tuple*) { return Status::OK(); }
+};
+
+}  // namespace detail
+/// @endcond
+
+/// Number of rows TableFromTupleRange appends a column at a time
+constexpr int64_t kTupleBlockSize = 1024;
+
+/// \brief Build a Table from a range of tuple-like rows
+///
+/// The schema is the one of SchemaFromTuple. The builders are reserved once
+/// for all the rows, which are appended by blocks of kTupleBlockSize, one
+/// column at a time, so that each block stays in cache for all its columns.
+///
+/// \code{.cpp}
+/// std::vector<std::tuple<int64_t, std::string>> rows = {{1, "a"}, {2, "b"}};
+/// std::shared_ptr<Table> table;
+/// RETURN_NOT_OK(TableFromTupleRange(pool, rows, {"id", "name"}, &table));
+/// \endcode
+///
+/// \param[in] pool the pool the arrays are allocated from
+/// \param[in] rows a range of tuple-like values, such as a std::vector
+/// \param[in] names the column names
+/// \param[out] table the resulting Table
+/// \return Status
+template <typename Range>
+Status TableFromTupleRange(MemoryPool* pool, const Range& rows,
+                           const std::vector<std::string>& names,
+                           std::shared_ptr<Table>* table) {
+  using row_type = typename std::decay<decltype(*std::begin(rows))>::type;
+  constexpr std::size_t num_columns = std::tuple_size<row_type>::value;
+  if (names.size() != num_columns) {
+    return Status::Invalid("Expected one name per tuple element");
+  }
+  std::shared_ptr<Schema> schema = SchemaFromTuple<row_type>::MakeSchema(names);
+
+  const int64_t num_rows = std::distance(std::begin(rows), std::end(rows));
+  std::vector<std::unique_ptr<ArrayBuilder>> builders(num_columns);
+  std::vector<ArrayBuilder*> raw_builders(num_columns);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    RETURN_NOT_OK(MakeBuilder(pool, schema->field(static_cast<int>(i))->type(),
+                              &builders[i]));
+    RETURN_NOT_OK(builders[i]->Reserve(num_rows));
+    raw_builders[i] = builders[i].get();
+  }
+
+  auto block_begin = std::begin(rows);
+  for (int64_t row = 0; row < num_rows; row += kTupleBlockSize) {
+    auto block_end = block_begin;
+    std::advance(block_end, std::min(kTupleBlockSize, num_rows - row));
+    RETURN_NOT_OK(
+        detail::TupleColumns<row_type>::Append(block_begin, block_end, raw_builders));
+    block_begin = block_end;
+  }
+
+  std::vector<std::shared_ptr<Array>> arrays(num_columns);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    RETURN_NOT_OK(builders[i]->Finish(&arrays[i]));
+  }
+  *table = Table::Make(schema, arrays, num_rows);
+  return Status::OK();
+}
+
+/// \brief Convert a Table into a vector of tuples, one per row
+///
+/// The column types must be the ones SchemaFromTuple gives for the tuple
+/// elements, and the columns may not hold nulls.
+///
+/// \param[in] table the table to convert
+/// \param[out] rows the vector the rows are written to, resized to the number
+/// of rows of the table
+/// \return Status
+template <typename Tuple>
+Status TupleRangeFromTable(const Table& table, std::vector<Tuple>* rows) {
+  if (table.num_columns() != static_cast<int>(std::tuple_size<Tuple>::value)) {
+    return Status::Invalid("Expected as many columns as tuple elements");
+  }
+  rows->resize(static_cast<std::size_t>(table.num_rows()));
+  return detail::TupleColumns<Tuple>::Get(table, rows->data());
+}
+
 }  // namespace stl
 }  // namespace arrow
 
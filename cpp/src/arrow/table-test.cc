@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,9 +23,11 @@
 #include "gtest/gtest.h"
 
 #include "arrow/array.h"
+#include "arrow/compare.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/test-common.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
@@ -123,6 +126,42 @@ TEST_F(TestChunkedArray, SliceEquals) {
   test::AssertChunkedEqual(*slice, *slice2);
 }
 
+TEST_F(TestChunkedArray, Locate) {
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(10));
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(0));
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(5));
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(0));
+  Construct();
+
+  ASSERT_EQ(std::vector<int64_t>({0, 10, 10, 15, 15}), one_->chunk_offsets());
+
+  auto AssertLocation = [](ChunkLocation location, int chunk_index,
+                           int64_t index_in_chunk) {
+    ASSERT_EQ(chunk_index, location.chunk_index);
+    ASSERT_EQ(index_in_chunk, location.index_in_chunk);
+  };
+  AssertLocation(one_->Locate(0), 0, 0);
+  AssertLocation(one_->Locate(9), 0, 9);
+  AssertLocation(one_->Locate(10), 2, 0);
+  AssertLocation(one_->Locate(14), 2, 4);
+  AssertLocation(one_->Locate(15), 4, 0);
+
+  // Sequential, backward and random lookups agree with the binary search
+  ChunkResolver resolver(*one_);
+  for (int64_t i = 0; i < one_->length(); ++i) {
+    ChunkLocation expected = one_->Locate(i);
+    AssertLocation(resolver.Resolve(i), expected.chunk_index, expected.index_in_chunk);
+  }
+  for (int64_t i : {14, 3, 15, 12, 0, 9, 10}) {
+    ChunkLocation expected = one_->Locate(i);
+    AssertLocation(resolver.Resolve(i), expected.chunk_index, expected.index_in_chunk);
+  }
+
+  ChunkedArray empty(ArrayVector{});
+  AssertLocation(empty.Locate(0), 0, 0);
+  AssertLocation(ChunkResolver(empty).Resolve(0), 0, 0);
+}
+
 class TestColumn : public TestChunkedArray {
  protected:
   void Construct() override {
@@ -416,6 +455,85 @@ TEST_F(TestTable, ConcatenateTables) {
   ASSERT_RAISES(Invalid, ConcatenateTables({t1, t3}, &result));
 }
 
+TEST_F(TestTable, CombineChunks) {
+  const int64_t length = 10;
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < 8; ++i) {
+    MakeExample1(length);
+    batches.push_back(RecordBatch::Make(schema_, length, arrays_));
+  }
+  std::shared_ptr<Table> table, combined;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), &combined));
+  ASSERT_OK(combined->Validate());
+  for (int i = 0; i < combined->num_columns(); ++i) {
+    ASSERT_EQ(1, combined->column(i)->data()->num_chunks());
+  }
+  test::AssertTablesEqual(*table, *combined, false);
+
+  // Runs of chunks of at least 100 bytes, the chunks being of 42, 12 and 22
+  // bytes with their validity bitmaps
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), 100, 4, &combined));
+  ASSERT_OK(combined->Validate());
+  ASSERT_EQ(3, combined->column(0)->data()->num_chunks());
+  ASSERT_EQ(1, combined->column(1)->data()->num_chunks());
+  ASSERT_EQ(2, combined->column(2)->data()->num_chunks());
+  test::AssertTablesEqual(*table, *combined, false);
+
+  // A single chunk is kept as is
+  ASSERT_OK(combined->CombineChunks(default_memory_pool(), &combined));
+  std::shared_ptr<Table> recombined;
+  ASSERT_OK(combined->CombineChunks(default_memory_pool(), &recombined));
+  ASSERT_EQ(combined->column(0)->data()->chunk(0).get(),
+            recombined->column(0)->data()->chunk(0).get());
+}
+
+TEST_F(TestTable, Hash) {
+  const int64_t length = 30000;
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", float64())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < 8; ++i) {
+    batches.push_back(RecordBatch::Make(schema, length,
+                                        {MakeRandomArray<Int32Array>(length, 100),
+                                         MakeRandomArray<DoubleArray>(length)}));
+  }
+  std::shared_ptr<Table> table, combined, fewer_rows;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), &combined));
+  batches.pop_back();
+  ASSERT_OK(Table::FromRecordBatches(batches, &fewer_rows));
+
+  // The hashes do not depend on the chunking, nor on threading
+  uint64_t hash, other_hash;
+  ASSERT_OK(TableHash(*table, &hash));
+  ASSERT_OK(TableHash(*table, &other_hash, false));
+  ASSERT_EQ(hash, other_hash);
+  ASSERT_OK(TableHash(*combined, &other_hash));
+  ASSERT_EQ(hash, other_hash);
+  auto batch = RecordBatch::Make(schema, table->num_rows(),
+                                 {combined->column(0)->data()->chunk(0),
+                                  combined->column(1)->data()->chunk(0)});
+  ASSERT_OK(RecordBatchHash(*batch, &other_hash));
+  ASSERT_EQ(hash, other_hash);
+
+  ASSERT_OK(ChunkedArrayHash(*table->column(0)->data(), &hash));
+  ASSERT_OK(ArrayHash(*batch->column(0), &other_hash, false));
+  ASSERT_EQ(hash, other_hash);
+  ASSERT_OK(ArrayHash(*batch->column(1), &other_hash));
+  ASSERT_NE(hash, other_hash);
+
+  // Different contents or schemas hash differently
+  ASSERT_OK(TableHash(*table, &hash));
+  ASSERT_OK(TableHash(*fewer_rows, &other_hash));
+  ASSERT_NE(hash, other_hash);
+  auto renamed = RecordBatch::Make(
+      ::arrow::schema({field("f0", int32()), field("f2", float64())}), batch->num_rows(),
+      {batch->column(0), batch->column(1)});
+  ASSERT_OK(RecordBatchHash(*renamed, &other_hash));
+  ASSERT_NE(hash, other_hash);
+}
+
 TEST_F(TestTable, RemoveColumn) {
   const int64_t length = 10;
   MakeExample1(length);
@@ -546,6 +664,23 @@ TEST_F(TestRecordBatch, Equals) {
   ASSERT_FALSE(b1->Equals(*b4));
 }
 
+TEST_F(TestRecordBatch, KeepsColumnArrays) {
+  const int length = 10;
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", uint8())});
+  auto a0 = MakeRandomArray<Int32Array>(length);
+  auto a1 = MakeRandomArray<UInt8Array>(length);
+
+  // The arrays are returned as they were given, not made again from their data
+  auto batch = RecordBatch::Make(schema, length, {a0, a1});
+  ASSERT_EQ(a0.get(), batch->column(0).get());
+  ASSERT_EQ(a1.get(), batch->column(1).get());
+
+  vector<shared_ptr<Array>> columns = {a0, a1};
+  batch = RecordBatch::Make(schema, length, columns);
+  ASSERT_EQ(a1.get(), batch->column(1).get());
+  ASSERT_EQ(a0->data(), batch->column_data(0));
+}
+
 TEST_F(TestRecordBatch, Validate) {
   const int length = 10;
 
@@ -573,6 +708,26 @@ TEST_F(TestRecordBatch, Validate) {
   ASSERT_RAISES(Invalid, b3->Validate());
 }
 
+TEST_F(TestRecordBatch, ValidateFull) {
+  auto schema = ::arrow::schema({field("f0", int32()), field("f1", utf8())});
+  auto a0 = MakeRandomArray<Int32Array>(2);
+
+  const std::string data = "ab\xc3";
+  const vector<int32_t> offsets = {0, 1, 3};
+  auto offsets_buffer = std::make_shared<Buffer>(
+      reinterpret_cast<const uint8_t*>(offsets.data()), 3 * sizeof(int32_t));
+  auto a1 =
+      std::make_shared<StringArray>(2, offsets_buffer, std::make_shared<Buffer>(data));
+
+  // The batch is consistent with its schema, but a string is not UTF-8
+  auto batch = RecordBatch::Make(schema, 2, {a0, a1});
+  ASSERT_OK(batch->Validate());
+  ASSERT_RAISES(Invalid, batch->ValidateFull());
+  ASSERT_OK(batch->Slice(0, 1)->ValidateFull());
+
+  ASSERT_RAISES(Invalid, RecordBatch::Make(schema, 2, {a0, a0})->ValidateFull());
+}
+
 TEST_F(TestRecordBatch, Slice) {
   const int length = 10;
 
@@ -710,6 +865,86 @@ TEST_F(TestRecordBatch, RemoveColumnEmpty) {
   ASSERT_TRUE(added->Equals(*batch1));
 }
 
+TEST_F(TestRecordBatch, ToTensor) {
+  std::shared_ptr<Array> a1, a2;
+  ArrayFromVector<Int8Type, int8_t>({-1, 2, 3}, &a1);
+  ArrayFromVector<UInt8Type, uint8_t>({200, 5, 6}, &a2);
+  auto schema = ::arrow::schema({field("a", int8()), field("b", uint8())});
+  auto batch = RecordBatch::Make(schema, 3, {a1, a2});
+
+  // int8 and uint8 are promoted to int16
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(batch->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_TRUE(tensor->type()->Equals(int16()));
+  ASSERT_EQ(std::vector<int64_t>({3, 2}), tensor->shape());
+  ASSERT_TRUE(tensor->is_row_major());
+  const auto row_major = reinterpret_cast<const int16_t*>(tensor->raw_data());
+  ASSERT_EQ(std::vector<int16_t>({-1, 200, 2, 5, 3, 6}),
+            std::vector<int16_t>(row_major, row_major + 6));
+
+  ASSERT_OK(batch->ToTensor(false, default_memory_pool(), &tensor));
+  ASSERT_TRUE(tensor->is_column_major());
+  const auto column_major = reinterpret_cast<const int16_t*>(tensor->raw_data());
+  ASSERT_EQ(std::vector<int16_t>({-1, 2, 3, 200, 5, 6}),
+            std::vector<int16_t>(column_major, column_major + 6));
+
+  // Nulls become NaN
+  std::shared_ptr<Array> a3, a4;
+  ArrayFromVector<Int16Type, int16_t>({true, false, true}, {1, 0, 3}, &a3);
+  ArrayFromVector<FloatType, float>({0.5f, 1.5f, 2.5f}, &a4);
+  batch = RecordBatch::Make(
+      ::arrow::schema({field("c", int16()), field("d", float32())}), 3, {a3, a4});
+  ASSERT_OK(batch->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_TRUE(tensor->type()->Equals(float32()));
+  const auto values = reinterpret_cast<const float*>(tensor->raw_data());
+  ASSERT_EQ(1.0f, values[0]);
+  ASSERT_TRUE(std::isnan(values[2]));
+  ASSERT_EQ(2.5f, values[5]);
+
+  batch = RecordBatch::Make(::arrow::schema({field("a", int8()), field("c", int16())}),
+                            3, {a1, a3});
+  ASSERT_OK(batch->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_TRUE(tensor->type()->Equals(float64()));
+
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>({"x", "y", "z"}, &strings);
+  batch = RecordBatch::Make(::arrow::schema({field("s", utf8())}), 3, {strings});
+  ASSERT_RAISES(TypeError, batch->ToTensor(true, default_memory_pool(), &tensor));
+}
+
+TEST_F(TestRecordBatch, TensorRoundtrip) {
+  // Enough rows for several tiles, and columns with offsets
+  const int64_t length = 10000;
+  auto schema = ::arrow::schema(
+      {field("f0", int64()), field("f1", int64()), field("f2", int64())});
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < 3; ++i) {
+    columns.push_back(MakeRandomArray<Int64Array>(length + i)->Slice(i));
+  }
+  auto batch = RecordBatch::Make(schema, length, columns);
+
+  for (bool row_major : {true, false}) {
+    std::shared_ptr<Tensor> tensor;
+    ASSERT_OK(batch->ToTensor(row_major, default_memory_pool(), 4, &tensor));
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(
+        RecordBatch::FromTensor(*tensor, {"f0", "f1", "f2"}, default_memory_pool(),
+                                &result));
+    ASSERT_OK(result->ValidateFull());
+    ASSERT_TRUE(result->Equals(*batch));
+
+    // The columns of column-major tensors are not copied
+    const uint8_t* column_data = result->column_data(2)->buffers[1]->data();
+    ASSERT_EQ(!row_major, column_data == tensor->raw_data() + 2 * length * 8);
+  }
+
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(batch->ToTensor(true, default_memory_pool(), &tensor));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid,
+                RecordBatch::FromTensor(*tensor, {"f0"}, default_memory_pool(), &result));
+}
+
 class TestTableBatchReader : public TestBase {};
 
 TEST_F(TestTableBatchReader, ReadNext) {
@@ -792,4 +1027,196 @@ TEST_F(TestTableBatchReader, Chunksize) {
   ASSERT_EQ(nullptr, batch);
 }
 
+// Reads batches from a table, counting them
+class CountingBatchReader : public RecordBatchReader {
+ public:
+  explicit CountingBatchReader(const std::shared_ptr<Table>& table)
+      : table_(table), reader_(*table), batches_read_(0) {}
+
+  std::shared_ptr<Schema> schema() const override { return reader_.schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    RETURN_NOT_OK(reader_.ReadNext(out));
+    batches_read_ += *out != nullptr;
+    return Status::OK();
+  }
+
+  int batches_read() const { return batches_read_; }
+
+ private:
+  std::shared_ptr<Table> table_;
+  TableBatchReader reader_;
+  int batches_read_;
+};
+
+class TestLazyTable : public TestBase {
+ protected:
+  void SetUp() override {
+    TestBase::SetUp();
+    auto sch = arrow::schema(
+        {field("f0", int32()), field("f1", int32()), field("f2", int32())});
+    std::vector<std::shared_ptr<Column>> columns;
+    for (int i = 0; i < 3; ++i) {
+      ArrayVector chunks;
+      for (int64_t length : {10, 20, 30, 40}) {
+        chunks.push_back(MakeRandomArray<Int32Array>(length));
+      }
+      columns.push_back(column(sch->field(i), chunks));
+    }
+    table_ = Table::Make(sch, columns);
+    reader_ = std::make_shared<CountingBatchReader>(table_);
+  }
+
+  std::shared_ptr<Table> table_;
+  std::shared_ptr<CountingBatchReader> reader_;
+};
+
+TEST_F(TestLazyTable, Materialize) {
+  LazyTable lazy(reader_);
+  ASSERT_TRUE(lazy.schema()->Equals(*table_->schema()));
+  ASSERT_EQ(0, reader_->batches_read());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(lazy.Materialize(&result));
+  ASSERT_TRUE(result->Equals(*table_));
+  ASSERT_EQ(4, reader_->batches_read());
+
+  // The source is single-pass
+  ASSERT_RAISES(Invalid, lazy.Materialize(&result));
+}
+
+TEST_F(TestLazyTable, SelectColumnsAndRows) {
+  LazyTable lazy(reader_);
+  std::shared_ptr<LazyTable> projected, selected;
+  ASSERT_OK(lazy.SelectColumns(std::vector<std::string>{"f2", "f0"}, &projected));
+  ASSERT_OK(projected->SelectColumns(std::vector<int>{1}, &selected));
+  ASSERT_EQ(1, selected->schema()->num_fields());
+  ASSERT_EQ("f0", selected->schema()->field(0)->name());
+  ASSERT_RAISES(Invalid, projected->SelectColumns(std::vector<int>{2}, &selected));
+  ASSERT_RAISES(Invalid,
+                projected->SelectColumns(std::vector<std::string>{"f1"}, &selected));
+
+  // Rows 25 to 45, within the second and third batches
+  auto sliced = projected->Slice(5)->Slice(20, 20);
+  ASSERT_EQ(0, reader_->batches_read());
+
+  std::shared_ptr<RecordBatchReader> scan;
+  ASSERT_OK(sliced->Scan(&scan));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(scan->ReadNext(&batch));
+  ASSERT_OK(batch->Validate());
+  ASSERT_EQ(5, batch->num_rows());
+  ASSERT_TRUE(batch->column(0)->Equals(table_->column(2)->data()->chunk(1)->Slice(15)));
+  ASSERT_TRUE(batch->column(1)->Equals(table_->column(0)->data()->chunk(1)->Slice(15)));
+  ASSERT_OK(scan->ReadNext(&batch));
+  ASSERT_EQ(15, batch->num_rows());
+  ASSERT_TRUE(
+      batch->column(0)->Equals(table_->column(2)->data()->chunk(2)->Slice(0, 15)));
+
+  // The last batch is never read
+  ASSERT_OK(scan->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+  ASSERT_EQ(3, reader_->batches_read());
+
+  ASSERT_RAISES(Invalid, lazy.Scan(&scan));
+}
+
+TEST_F(TestLazyTable, SlicePastEnd) {
+  LazyTable lazy(reader_);
+  std::shared_ptr<Table> result;
+  ASSERT_OK(lazy.Slice(90)->Slice(5, 100)->Materialize(&result));
+  ASSERT_EQ(5, result->num_rows());
+  ASSERT_TRUE(result->column(1)->data()->Equals(table_->column(1)->data()->Slice(95)));
+}
+
+class TestRebatching : public TestBase {
+ protected:
+  // A table of batches of the given lengths, of an int32 and a string column
+  void MakeSource(const std::vector<int64_t>& lengths) {
+    auto sch = arrow::schema({field("f0", int32()), field("f1", utf8())});
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int64_t length : lengths) {
+      StringBuilder builder;
+      for (int64_t i = 0; i < length; ++i) {
+        ASSERT_OK(builder.Append(std::string(i % 3 == 0 ? 12 : 4, 'x')));
+      }
+      std::shared_ptr<Array> strings;
+      ASSERT_OK(builder.Finish(&strings));
+      batches.push_back(RecordBatch::Make(
+          sch, length, {MakeRandomArray<Int32Array>(length), strings}));
+    }
+    ASSERT_OK(Table::FromRecordBatches(sch, batches, &table_));
+  }
+
+  void Rebatch(int64_t max_rows, int64_t max_bytes,
+               std::vector<std::shared_ptr<RecordBatch>>* out) {
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(RebatchRecordBatches(std::make_shared<TableBatchReader>(*table_),
+                                   max_rows, max_bytes, pool_, &reader));
+    ASSERT_TRUE(reader->schema()->Equals(*table_->schema()));
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_OK(batch->Validate());
+      out->push_back(batch);
+    }
+    std::shared_ptr<Table> result;
+    ASSERT_OK(Table::FromRecordBatches(table_->schema(), *out, &result));
+    ASSERT_TRUE(result->Equals(*table_));
+  }
+
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(TestRebatching, Rows) {
+  MakeSource({5, 5, 30, 5, 0, 3});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Rebatch(12, 0, &batches);
+
+  std::vector<int64_t> lengths;
+  for (const auto& batch : batches) {
+    lengths.push_back(batch->num_rows());
+  }
+  ASSERT_EQ(std::vector<int64_t>({12, 12, 12, 12}), lengths);
+
+  // The batch within a single source batch is a zero-copy slice of it
+  ASSERT_EQ(table_->column(0)->data()->chunk(2)->data()->buffers[1],
+            batches[1]->column_data(0)->buffers[1]);
+  ASSERT_NE(table_->column(0)->data()->chunk(0)->data()->buffers[1],
+            batches[0]->column_data(0)->buffers[1]);
+}
+
+TEST_F(TestRebatching, Bytes) {
+  MakeSource({100, 100});
+  // Rows of 4 bytes of int32, 4 of offset and 4 or 12 of string data
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Rebatch(0, 800, &batches);
+  for (const auto& batch : batches) {
+    ASSERT_GE(batch->num_rows(), 40);
+    ASSERT_LE(batch->num_rows(), 60);
+  }
+
+  // Wider rows than the target are emitted one by one
+  batches.clear();
+  Rebatch(0, 8, &batches);
+  ASSERT_EQ(200, static_cast<int>(batches.size()));
+
+  // The tighter of both limits applies
+  batches.clear();
+  Rebatch(30, 800, &batches);
+  ASSERT_EQ(30, batches[0]->num_rows());
+}
+
+TEST_F(TestRebatching, Errors) {
+  MakeSource({10});
+  auto source = std::make_shared<TableBatchReader>(*table_);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(Invalid, RebatchRecordBatches(source, 0, 0, pool_, &reader));
+  ASSERT_RAISES(Invalid, RebatchRecordBatches(source, -1, 100, pool_, &reader));
+  ASSERT_RAISES(Invalid, RebatchRecordBatches(source, 100, -1, pool_, &reader));
+}
+
 }  // namespace arrow
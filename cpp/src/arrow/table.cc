@@ -29,7 +29,9 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -39,10 +41,27 @@ namespace arrow {
 ChunkedArray::ChunkedArray(const ArrayVector& chunks) : chunks_(chunks) {
   length_ = 0;
   null_count_ = 0;
+  chunk_offsets_.reserve(chunks.size() + 1);
   for (const std::shared_ptr<Array>& chunk : chunks) {
+    chunk_offsets_.push_back(length_);
     length_ += chunk->length();
     null_count_ += chunk->null_count();
   }
+  chunk_offsets_.push_back(length_);
+}
+
+ChunkLocation ChunkedArray::Locate(int64_t index) const {
+  const int chunk_index = ChunkResolver::Bisect(chunk_offsets_, index);
+  return {chunk_index, index - chunk_offsets_[chunk_index]};
+}
+
+int ChunkResolver::Bisect(const std::vector<int64_t>& offsets, int64_t index) {
+  DCHECK_GE(index, 0);
+  // The first offset past index ends the chunk holding it. Empty chunks share
+  // their offset with the next chunk, so they are never returned for an index
+  // in bounds, and positions past the end map to the number of chunks
+  auto it = std::upper_bound(offsets.begin(), offsets.end(), index);
+  return static_cast<int>(it - offsets.begin()) - 1;
 }
 
 std::shared_ptr<DataType> ChunkedArray::type() const { return chunks_[0]->type(); }
@@ -106,11 +125,9 @@ bool ChunkedArray::Equals(const std::shared_ptr<ChunkedArray>& other) const {
 std::shared_ptr<ChunkedArray> ChunkedArray::Slice(int64_t offset, int64_t length) const {
   DCHECK_LE(offset, length_);
 
-  int curr_chunk = 0;
-  while (offset >= chunk(curr_chunk)->length()) {
-    offset -= chunk(curr_chunk)->length();
-    curr_chunk++;
-  }
+  const ChunkLocation location = Locate(offset);
+  int curr_chunk = location.chunk_index;
+  offset = location.index_in_chunk;
 
   ArrayVector new_chunks;
   while (length > 0 && curr_chunk < num_chunks()) {
@@ -392,6 +409,72 @@ bool Table::Equals(const Table& other) const {
   return true;
 }
 
+namespace {
+
+int64_t BufferBytes(const ArrayData& data) {
+  int64_t nbytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      nbytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    nbytes += BufferBytes(*child);
+  }
+  return nbytes;
+}
+
+Status CombineColumnChunks(const Column& column, MemoryPool* pool, int64_t chunk_bytes,
+                           std::shared_ptr<Column>* out) {
+  const ArrayVector& chunks = column.data()->chunks();
+  if (chunks.size() <= 1) {
+    *out = std::make_shared<Column>(column.field(), column.data());
+    return Status::OK();
+  }
+
+  ArrayVector combined, run;
+  int64_t run_bytes = 0;
+  auto flush_run = [&]() -> Status {
+    if (run.size() == 1) {
+      combined.push_back(run[0]);
+    } else if (run.size() > 1) {
+      std::shared_ptr<Array> array;
+      RETURN_NOT_OK(Concatenate(run, pool, &array));
+      combined.push_back(array);
+    }
+    run.clear();
+    run_bytes = 0;
+    return Status::OK();
+  };
+  for (const auto& chunk : chunks) {
+    run.push_back(chunk);
+    run_bytes += BufferBytes(*chunk->data());
+    if (chunk_bytes > 0 && run_bytes >= chunk_bytes) {
+      RETURN_NOT_OK(flush_run());
+    }
+  }
+  RETURN_NOT_OK(flush_run());
+  *out = std::make_shared<Column>(column.field(), combined);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Table::CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const {
+  return CombineChunks(pool, 0, GetCpuThreadPoolCapacity(), out);
+}
+
+Status Table::CombineChunks(MemoryPool* pool, int64_t chunk_bytes, int num_threads,
+                            std::shared_ptr<Table>* out) const {
+  const int ncolumns = num_columns();
+  std::vector<std::shared_ptr<Column>> columns(ncolumns);
+  RETURN_NOT_OK(ParallelFor(num_threads, ncolumns, [&](int i) {
+    return CombineColumnChunks(*column(i), pool, chunk_bytes, &columns[i]);
+  }));
+  *out = Table::Make(schema_, columns, num_rows_);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -489,4 +572,320 @@ Status TableBatchReader::ReadNext(std::shared_ptr<RecordBatch>* out) {
   return impl_->ReadNext(out);
 }
 
+// ----------------------------------------------------------------------
+// Re-batching record batch streams
+
+namespace {
+
+// The bytes of a column per row: exact for fixed-width and binary values,
+// averaged over the buffers for the other types
+double ColumnRowBytes(const ArrayData& data) {
+  if (data.length == 0) {
+    return 0;
+  }
+  const double validity_bytes = data.buffers.size() > 0 && data.buffers[0] ? 0.125 : 0;
+  const DataType& type = *data.type;
+  if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    const int32_t* offsets =
+        reinterpret_cast<const int32_t*>(data.buffers[1]->data()) + data.offset;
+    const double value_bytes = static_cast<double>(offsets[data.length] - offsets[0]);
+    return validity_bytes + sizeof(int32_t) +
+           value_bytes / static_cast<double>(data.length);
+  }
+  const DataType* value_type = &type;
+  if (type.id() == Type::DICTIONARY) {
+    value_type = static_cast<const DictionaryType&>(type).index_type().get();
+  }
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(value_type);
+  if (fixed_width != nullptr) {
+    return validity_bytes + fixed_width->bit_width() / 8.0;
+  }
+  return static_cast<double>(BufferBytes(data)) / static_cast<double>(data.length);
+}
+
+class RebatchingReader : public RecordBatchReader {
+ public:
+  RebatchingReader(const std::shared_ptr<RecordBatchReader>& source, int64_t max_rows,
+                   int64_t max_bytes, MemoryPool* pool)
+      : source_(source),
+        max_rows_(max_rows),
+        max_bytes_(max_bytes),
+        pool_(pool),
+        position_(0),
+        row_bytes_(0),
+        pending_rows_(0),
+        pending_bytes_(0) {}
+
+  std::shared_ptr<Schema> schema() const override { return source_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (true) {
+      if (current_ == nullptr) {
+        RETURN_NOT_OK(source_->ReadNext(&current_));
+        if (current_ == nullptr) {
+          break;
+        }
+        position_ = 0;
+        row_bytes_ = 0;
+        for (int i = 0; i < current_->num_columns(); ++i) {
+          row_bytes_ += ColumnRowBytes(*current_->column_data(i));
+        }
+        if (current_->num_rows() == 0) {
+          current_.reset();
+        }
+        continue;
+      }
+
+      const int64_t available = current_->num_rows() - position_;
+      int64_t capacity = available;
+      if (max_rows_ > 0) {
+        capacity = std::min(capacity, max_rows_ - pending_rows_);
+      }
+      if (max_bytes_ > 0 && row_bytes_ > 0) {
+        const double rows = (static_cast<double>(max_bytes_) - pending_bytes_) / row_bytes_;
+        capacity = std::min(capacity, static_cast<int64_t>(std::max(rows, 0.0)));
+      }
+      if (capacity <= 0) {
+        if (pending_.empty()) {
+          // A row wider than the target is a batch of its own
+          capacity = 1;
+        } else {
+          return Flush(out);
+        }
+      }
+
+      if (capacity == current_->num_rows()) {
+        pending_.push_back(current_);
+      } else {
+        pending_.push_back(current_->Slice(position_, capacity));
+      }
+      pending_rows_ += capacity;
+      pending_bytes_ += static_cast<double>(capacity) * row_bytes_;
+      position_ += capacity;
+      if (capacity < available) {
+        // The batch was cut at a limit
+        return Flush(out);
+      }
+      current_.reset();
+    }
+
+    if (pending_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    return Flush(out);
+  }
+
+ private:
+  // Emit the pending slices, concatenated only if there are several
+  Status Flush(std::shared_ptr<RecordBatch>* out) {
+    if (pending_.size() == 1) {
+      *out = pending_[0];
+    } else {
+      const int num_columns = source_->schema()->num_fields();
+      std::vector<std::shared_ptr<Array>> columns(num_columns);
+      ArrayVector pieces(pending_.size());
+      for (int i = 0; i < num_columns; ++i) {
+        for (size_t j = 0; j < pending_.size(); ++j) {
+          pieces[j] = pending_[j]->column(i);
+        }
+        RETURN_NOT_OK(Concatenate(pieces, pool_, &columns[i]));
+      }
+      *out = RecordBatch::Make(source_->schema(), pending_rows_, std::move(columns));
+    }
+    pending_.clear();
+    pending_rows_ = 0;
+    pending_bytes_ = 0;
+    return Status::OK();
+  }
+
+  std::shared_ptr<RecordBatchReader> source_;
+  int64_t max_rows_;
+  int64_t max_bytes_;
+  MemoryPool* pool_;
+
+  // The batch being cut and the position of its first row not yet pending
+  std::shared_ptr<RecordBatch> current_;
+  int64_t position_;
+  double row_bytes_;
+
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_rows_;
+  double pending_bytes_;
+};
+
+}  // namespace
+
+Status RebatchRecordBatches(const std::shared_ptr<RecordBatchReader>& source,
+                            int64_t max_rows, int64_t max_bytes, MemoryPool* pool,
+                            std::shared_ptr<RecordBatchReader>* out) {
+  if (max_rows < 0 || max_bytes < 0 || (max_rows == 0 && max_bytes == 0)) {
+    return Status::Invalid("Re-batching needs a positive number of rows or bytes");
+  }
+  out->reset(new RebatchingReader(source, max_rows, max_bytes, pool));
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Lazy tables over record batch readers
+
+struct LazyTable::Source {
+  std::shared_ptr<RecordBatchReader> reader;
+  bool scanned;
+};
+
+namespace {
+
+class SelectingBatchReader : public RecordBatchReader {
+ public:
+  SelectingBatchReader(const std::shared_ptr<RecordBatchReader>& source,
+                       const std::shared_ptr<Schema>& schema,
+                       const std::vector<int>& columns, int64_t offset, int64_t length)
+      : source_(source),
+        schema_(schema),
+        columns_(columns),
+        to_skip_(offset),
+        remaining_(length) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::shared_ptr<RecordBatch> batch;
+    while (remaining_ > 0) {
+      RETURN_NOT_OK(source_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      const int64_t num_rows = batch->num_rows();
+      if (to_skip_ >= num_rows) {
+        to_skip_ -= num_rows;
+        continue;
+      }
+      const int64_t length = std::min(num_rows - to_skip_, remaining_);
+      std::vector<std::shared_ptr<ArrayData>> columns;
+      columns.reserve(columns_.size());
+      for (int i : columns_) {
+        std::shared_ptr<Array> column = batch->column(i);
+        if (to_skip_ > 0 || length < num_rows) {
+          column = column->Slice(to_skip_, length);
+        }
+        columns.push_back(column->data());
+      }
+      to_skip_ = 0;
+      remaining_ -= length;
+      *out = RecordBatch::Make(schema_, length, std::move(columns));
+      return Status::OK();
+    }
+    // Release the source as soon as the selected rows are read
+    source_.reset();
+    *out = nullptr;
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<RecordBatchReader> source_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> columns_;
+  int64_t to_skip_;
+  int64_t remaining_;
+};
+
+}  // namespace
+
+LazyTable::LazyTable(const std::shared_ptr<RecordBatchReader>& source)
+    : source_(std::make_shared<Source>()),
+      schema_(source->schema()),
+      columns_(source->schema()->num_fields()),
+      offset_(0),
+      length_(std::numeric_limits<int64_t>::max()) {
+  source_->reader = source;
+  source_->scanned = false;
+  for (int i = 0; i < schema_->num_fields(); ++i) {
+    columns_[i] = i;
+  }
+}
+
+LazyTable::LazyTable(const std::shared_ptr<Source>& source,
+                     const std::shared_ptr<Schema>& schema,
+                     const std::vector<int>& columns, int64_t offset, int64_t length)
+    : source_(source),
+      schema_(schema),
+      columns_(columns),
+      offset_(offset),
+      length_(length) {}
+
+Status LazyTable::SelectColumns(const std::vector<int>& indices,
+                                std::shared_ptr<LazyTable>* out) const {
+  std::vector<std::shared_ptr<Field>> fields(indices.size());
+  std::vector<int> columns(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    if (indices[i] < 0 || indices[i] >= schema_->num_fields()) {
+      std::stringstream ss;
+      ss << "Column index " << indices[i] << " out of bounds for a table of "
+         << schema_->num_fields() << " columns";
+      return Status::Invalid(ss.str());
+    }
+    fields[i] = schema_->field(indices[i]);
+    columns[i] = columns_[indices[i]];
+  }
+  auto schema = std::make_shared<Schema>(fields, schema_->metadata());
+  out->reset(new LazyTable(source_, schema, columns, offset_, length_));
+  return Status::OK();
+}
+
+Status LazyTable::SelectColumns(const std::vector<std::string>& names,
+                                std::shared_ptr<LazyTable>* out) const {
+  std::vector<int> indices(names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    const int64_t index = schema_->GetFieldIndex(names[i]);
+    if (index < 0) {
+      return Status::Invalid("No column named " + names[i]);
+    }
+    indices[i] = static_cast<int>(index);
+  }
+  return SelectColumns(indices, out);
+}
+
+std::shared_ptr<LazyTable> LazyTable::Slice(int64_t offset, int64_t length) const {
+  DCHECK_GE(offset, 0);
+  DCHECK_GE(length, 0);
+  offset = std::min(offset, length_);
+  length = std::min(length, length_ - offset);
+  // Keep the sum of offset and length from overflowing for unbounded ranges
+  const int64_t new_offset = offset_ + offset;
+  length = std::min(length, std::numeric_limits<int64_t>::max() - new_offset);
+  return std::shared_ptr<LazyTable>(
+      new LazyTable(source_, schema_, columns_, new_offset, length));
+}
+
+std::shared_ptr<LazyTable> LazyTable::Slice(int64_t offset) const {
+  return Slice(offset, length_);
+}
+
+Status LazyTable::Scan(std::shared_ptr<RecordBatchReader>* out) const {
+  if (source_->scanned) {
+    return Status::Invalid("The source of the lazy table was already scanned");
+  }
+  source_->scanned = true;
+  out->reset(
+      new SelectingBatchReader(source_->reader, schema_, columns_, offset_, length_));
+  source_->reader.reset();
+  return Status::OK();
+}
+
+Status LazyTable::Materialize(std::shared_ptr<Table>* out) const {
+  std::shared_ptr<RecordBatchReader> reader;
+  RETURN_NOT_OK(Scan(&reader));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  return Table::FromRecordBatches(schema_, batches, out);
+}
+
 }  // namespace arrow
@@ -32,8 +32,18 @@
 namespace arrow {
 
 class KeyValueMetadata;
+class MemoryPool;
 class Status;
 
+/// \brief The position of a value in a chunked array
+struct ChunkLocation {
+  /// The index of the chunk holding the value, or the number of chunks if
+  /// the value is out of bounds
+  int chunk_index;
+  /// The index of the value within its chunk
+  int64_t index_in_chunk;
+};
+
 /// \class ChunkedArray
 /// \brief A data structure managing a list of primitive Arrow arrays logically
 /// as one large array
@@ -54,6 +64,20 @@ class ARROW_EXPORT ChunkedArray {
 
   const ArrayVector& chunks() const { return chunks_; }
 
+  /// \return the logical position of the first value of each chunk, followed
+  /// by the length of the chunked array; computed on construction
+  const std::vector<int64_t>& chunk_offsets() const { return chunk_offsets_; }
+
+  /// \brief Find the chunk holding a logical position, by binary search
+  /// over the chunk offsets
+  ///
+  /// Empty chunks are skipped. For repeated lookups with locality, prefer a
+  /// ChunkResolver.
+  ///
+  /// \param[in] index the logical position of the value
+  /// \return the location of the value
+  ChunkLocation Locate(int64_t index) const;
+
   /// \brief Construct a zero-copy slice of the chunked array with the
   /// indicated offset and length
   ///
@@ -77,11 +101,48 @@ class ARROW_EXPORT ChunkedArray {
   ArrayVector chunks_;
   int64_t length_;
   int64_t null_count_;
+  std::vector<int64_t> chunk_offsets_;
 
  private:
   ARROW_DISALLOW_COPY_AND_ASSIGN(ChunkedArray);
 };
 
+/// \class ChunkResolver
+/// \brief Maps logical positions of a chunked array to chunk locations,
+/// remembering the last chunk found
+///
+/// Positions falling in the same chunk as the previous lookup are resolved
+/// without searching, which makes sequential and clustered access patterns
+/// O(1) per lookup. A resolver is cheap to construct and is not thread-safe;
+/// each thread should use its own. The chunked array must outlive it.
+class ARROW_EXPORT ChunkResolver {
+ public:
+  explicit ChunkResolver(const ChunkedArray& chunked_array)
+      : offsets_(chunked_array.chunk_offsets()), cached_chunk_(0) {}
+
+  /// \brief Find the chunk holding a logical position
+  ChunkLocation Resolve(int64_t index) {
+    const int num_chunks = static_cast<int>(offsets_.size()) - 1;
+    if (cached_chunk_ < num_chunks && index >= offsets_[cached_chunk_] &&
+        index < offsets_[cached_chunk_ + 1]) {
+      return {cached_chunk_, index - offsets_[cached_chunk_]};
+    }
+    const int chunk_index = Bisect(offsets_, index);
+    if (chunk_index < num_chunks) {
+      cached_chunk_ = chunk_index;
+    }
+    return {chunk_index, index - offsets_[chunk_index]};
+  }
+
+  /// \brief Return the index of the last chunk starting at or before index,
+  /// or the number of chunks if index is past the end
+  static int Bisect(const std::vector<int64_t>& offsets, int64_t index);
+
+ private:
+  const std::vector<int64_t>& offsets_;
+  int cached_chunk_;
+};
+
 /// \class Column
 /// \brief An immutable column data structure consisting of a field (type
 /// metadata) and a chunked data array
@@ -113,6 +174,10 @@ class ARROW_EXPORT Column {
   /// \return the column's data as a chunked logical array
   std::shared_ptr<ChunkedArray> data() const { return data_; }
 
+  /// \brief Find the chunk holding a logical position of the column
+  /// \see ChunkedArray::Locate
+  ChunkLocation Locate(int64_t index) const { return data_->Locate(index); }
+
   /// \brief Construct a zero-copy slice of the column with the indicated
   /// offset and length
   ///
@@ -225,6 +290,32 @@ class ARROW_EXPORT Table {
   /// \brief Determine if semantic contents of tables are exactly equal
   bool Equals(const Table& other) const;
 
+  /// \brief Make a table whose columns are each a single contiguous chunk
+  ///
+  /// The columns are combined in parallel on the CPU thread pool, see the
+  /// other overload.
+  ///
+  /// \param[in] pool memory pool to allocate the combined chunks from
+  /// \param[out] out the new table
+  /// \return Status
+  Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const;
+
+  /// \brief Make a table whose columns are combined into fewer, larger chunks
+  ///
+  /// A table concatenated from many small batches holds as many small chunks,
+  /// which slows down every later scan. Here runs of consecutive chunks are
+  /// copied into contiguous arrays with Concatenate, one column per task.
+  /// Columns of a single chunk are not copied.
+  ///
+  /// \param[in] pool memory pool to allocate the combined chunks from
+  /// \param[in] chunk_bytes combine consecutive chunks until their buffers
+  /// reach this many bytes; 0 to combine each column into a single chunk
+  /// \param[in] num_threads number of threads to combine the columns with
+  /// \param[out] out the new table
+  /// \return Status
+  Status CombineChunks(MemoryPool* pool, int64_t chunk_bytes, int num_threads,
+                       std::shared_ptr<Table>* out) const;
+
  protected:
   Table();
 
@@ -254,6 +345,93 @@ class ARROW_EXPORT TableBatchReader : public RecordBatchReader {
   std::unique_ptr<TableBatchReaderImpl> impl_;
 };
 
+/// \brief Re-batch a stream of record batches to a target number of rows or
+/// bytes
+///
+/// Batches larger than the target are cut into zero-copy slices. Consecutive
+/// batches smaller than the target are coalesced, their columns being
+/// concatenated into newly allocated arrays only when a result spans several
+/// input batches. The bytes of a row are estimated from the buffers of each
+/// input batch, so that byte targets hold whatever the width of the rows.
+///
+/// \param[in] source the batches to re-batch, read as the result is read
+/// \param[in] max_rows the maximum number of rows of a batch, 0 for no limit
+/// \param[in] max_bytes the approximate maximum number of bytes of a batch, 0
+/// for no limit. A batch has at least one row, even if wider
+/// \param[in] pool the memory pool to allocate the coalesced batches from
+/// \param[out] out the reader of the re-batched stream
+/// \return Status, Invalid unless one limit is positive and none is negative
+ARROW_EXPORT
+Status RebatchRecordBatches(const std::shared_ptr<RecordBatchReader>& source,
+                            int64_t max_rows, int64_t max_bytes, MemoryPool* pool,
+                            std::shared_ptr<RecordBatchReader>* out);
+
+/// \class LazyTable
+/// \brief A table whose record batches are read from a RecordBatchReader only
+/// when iterated
+///
+/// Selecting columns or a range of rows derives a new LazyTable without
+/// reading anything. Scanning then drops the unselected columns of each batch
+/// as it is read, discards the batches before the range and stops reading the
+/// source once the range is exhausted, so that only the batches being
+/// consumed are held in memory.
+///
+/// Record batch readers are single-pass: the tables derived from a LazyTable
+/// share its source, and only one of them may be scanned.
+class ARROW_EXPORT LazyTable {
+ public:
+  explicit LazyTable(const std::shared_ptr<RecordBatchReader>& source);
+
+  /// \return the schema of the selected columns
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+  /// \brief Select columns by their indices in this table's schema
+  ///
+  /// \param[in] indices the columns to keep, in the order of the result
+  /// \param[out] out the lazy table of the selected columns
+  /// \return Status, Invalid if an index is out of bounds
+  Status SelectColumns(const std::vector<int>& indices,
+                       std::shared_ptr<LazyTable>* out) const;
+
+  /// \brief Select columns by their names in this table's schema
+  /// \return Status, Invalid if a name is absent
+  Status SelectColumns(const std::vector<std::string>& names,
+                       std::shared_ptr<LazyTable>* out) const;
+
+  /// \brief Select a range of rows
+  ///
+  /// \param[in] offset the position of the first selected row
+  /// \param[in] length the number of rows, fewer if the table ends first
+  /// \return the lazy table of the selected rows
+  std::shared_ptr<LazyTable> Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Select the rows from offset until the end of the table
+  std::shared_ptr<LazyTable> Slice(int64_t offset) const;
+
+  /// \brief Start reading the selected rows and columns, as a stream of
+  /// record batches following the batches of the source
+  ///
+  /// \return Status, Invalid if the source was already scanned
+  Status Scan(std::shared_ptr<RecordBatchReader>* out) const;
+
+  /// \brief Read the selected rows and columns into a table
+  /// \return Status, Invalid if the source was already scanned
+  Status Materialize(std::shared_ptr<Table>* out) const;
+
+ private:
+  struct Source;
+
+  LazyTable(const std::shared_ptr<Source>& source, const std::shared_ptr<Schema>& schema,
+            const std::vector<int>& columns, int64_t offset, int64_t length);
+
+  std::shared_ptr<Source> source_;
+  std::shared_ptr<Schema> schema_;
+  // Indices of the selected columns in the schema of the source
+  std::vector<int> columns_;
+  int64_t offset_;
+  int64_t length_;
+};
+
 /// \brief Construct table from multiple input tables.
 /// \return Status, fails if any schemas are different
 ARROW_EXPORT
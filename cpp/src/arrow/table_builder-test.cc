@@ -22,6 +22,7 @@
 #include "gtest/gtest.h"
 
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
@@ -144,4 +145,145 @@ TEST_F(TestRecordBatchBuilder, InvalidFieldLength) {
   ASSERT_RAISES(Invalid, builder->Flush(&dummy));
 }
 
+TEST_F(TestRecordBatchBuilder, AppendColumnsInParallel) {
+  // A block of rows, converted one column at a time
+  const int kNumFields = 16;
+  const int kNumRows = 1000;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < kNumFields; ++i) {
+    fields.push_back(field("f" + std::to_string(i), i % 2 == 0 ? int32() : utf8()));
+  }
+  auto schema = ::arrow::schema(fields);
+
+  auto append = [](int i, ArrayBuilder* builder) -> Status {
+    for (int row = 0; row < kNumRows; ++row) {
+      const bool is_null = row % 7 == i % 7;
+      if (i % 2 == 0) {
+        auto int_builder = static_cast<Int32Builder*>(builder);
+        RETURN_NOT_OK(is_null ? int_builder->AppendNull() : int_builder->Append(row * i));
+      } else {
+        auto string_builder = static_cast<StringBuilder*>(builder);
+        RETURN_NOT_OK(is_null ? string_builder->AppendNull()
+                              : string_builder->Append(std::to_string(row + i)));
+      }
+    }
+    return Status::OK();
+  };
+
+  std::shared_ptr<RecordBatch> expected;
+  for (int num_threads : {1, 4}) {
+    std::unique_ptr<RecordBatchBuilder> builder;
+    ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+    builder->set_num_threads(num_threads);
+    ASSERT_EQ(num_threads, builder->num_threads());
+
+    ASSERT_OK(builder->AppendColumns(append));
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(builder->Flush(&batch));
+    ASSERT_EQ(kNumRows, batch->num_rows());
+    if (expected) {
+      ASSERT_BATCHES_EQUAL(*expected, *batch);
+    }
+    expected = batch;
+
+    // The first error is returned
+    ASSERT_RAISES(Invalid, builder->AppendColumns([](int i, ArrayBuilder*) {
+      return i == 3 ? Status::Invalid("column 3") : Status::OK();
+    }));
+  }
+}
+
+TEST_F(TestRecordBatchBuilder, FlushWhenFull) {
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", utf8())});
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+  ASSERT_EQ(0, builder->EstimatedBatchBytes());
+
+  // Each row takes 8 bytes of int64, 4 bytes of offset and 4 bytes of string,
+  // plus the validity bits
+  const int64_t kMaxBytes = 16 * 100;
+  std::vector<int64_t> batch_lengths;
+  for (int64_t row = 0; row < 1000; ++row) {
+    ASSERT_OK(builder->GetFieldAs<Int64Builder>(0)->Append(row));
+    ASSERT_OK(builder->GetFieldAs<StringBuilder>(1)->Append("abcd"));
+
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(builder->FlushWhenFull(kMaxBytes, &batch));
+    if (batch) {
+      batch_lengths.push_back(batch->num_rows());
+      ASSERT_EQ(0, builder->EstimatedBatchBytes());
+    } else {
+      ASSERT_LT(builder->EstimatedBatchBytes(), kMaxBytes);
+    }
+  }
+  // 99 rows with their 2 * 13 validity bytes reach the limit
+  ASSERT_EQ(std::vector<int64_t>(10, 99), batch_lengths);
+}
+
+TEST_F(TestRecordBatchBuilder, ReserveLikeLastBatch) {
+  auto struct_type = struct_({field("s0", int16()), field("s1", utf8())});
+  auto schema = ::arrow::schema(
+      {field("f0", utf8()), field("f1", list(int8())), field("f2", struct_type)});
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK(RecordBatchBuilder::Make(schema, pool_, &builder));
+  builder->SetReserveLikeLastBatch(true);
+
+  auto string_builder = builder->GetFieldAs<StringBuilder>(0);
+  auto list_builder = builder->GetFieldAs<ListBuilder>(1);
+  auto list_values = static_cast<Int8Builder*>(list_builder->value_builder());
+  auto struct_builder = builder->GetFieldAs<StructBuilder>(2);
+  auto struct_ints = static_cast<Int16Builder*>(struct_builder->field_builder(0));
+  auto struct_strings = static_cast<StringBuilder*>(struct_builder->field_builder(1));
+
+  const int kNumRows = 1000;
+  auto AppendBatch = [&]() {
+    for (int row = 0; row < kNumRows; ++row) {
+      ASSERT_OK(string_builder->Append(std::string(row % 10, 'x')));
+      ASSERT_OK(list_builder->Append());
+      for (int i = 0; i < row % 5; ++i) {
+        ASSERT_OK(list_values->Append(static_cast<int8_t>(i)));
+      }
+      ASSERT_OK(struct_builder->Append());
+      ASSERT_OK(struct_ints->Append(static_cast<int16_t>(row)));
+      ASSERT_OK(struct_strings->Append("abc"));
+    }
+  };
+
+  AppendBatch();
+  std::shared_ptr<RecordBatch> first;
+  ASSERT_OK(builder->Flush(&first));
+  ASSERT_EQ(kNumRows, first->num_rows());
+
+  // The next batch of the same shape fits in the reserved capacity
+  std::vector<int64_t> capacities = {string_builder->capacity(),
+                                     string_builder->value_data_capacity(),
+                                     list_builder->capacity(),
+                                     list_values->capacity(),
+                                     struct_builder->capacity(),
+                                     struct_ints->capacity(),
+                                     struct_strings->value_data_capacity()};
+  ASSERT_EQ(kNumRows, string_builder->capacity());
+  ASSERT_EQ(2 * kNumRows, list_values->capacity());
+  AppendBatch();
+  ASSERT_EQ(capacities, std::vector<int64_t>({string_builder->capacity(),
+                                              string_builder->value_data_capacity(),
+                                              list_builder->capacity(),
+                                              list_values->capacity(),
+                                              struct_builder->capacity(),
+                                              struct_ints->capacity(),
+                                              struct_strings->value_data_capacity()}));
+
+  std::shared_ptr<RecordBatch> second;
+  ASSERT_OK(builder->Flush(&second));
+  ASSERT_BATCHES_EQUAL(*first, *second);
+
+  // The batch must match the schema
+  auto other = RecordBatch::Make(::arrow::schema({field("f0", utf8())}), kNumRows,
+                                 {first->column(0)});
+  ASSERT_RAISES(Invalid, builder->ReserveLike(*other));
+  ASSERT_RAISES(Invalid, ReserveLike(*first->column(0), list_builder));
+}
+
 }  // namespace arrow
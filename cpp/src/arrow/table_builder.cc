@@ -29,7 +29,9 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -38,7 +40,11 @@ namespace arrow {
 
 RecordBatchBuilder::RecordBatchBuilder(const std::shared_ptr<Schema>& schema,
                                        MemoryPool* pool, int64_t initial_capacity)
-    : schema_(schema), initial_capacity_(initial_capacity), pool_(pool) {}
+    : schema_(schema),
+      initial_capacity_(initial_capacity),
+      pool_(pool),
+      num_threads_(1),
+      reserve_like_last_batch_(false) {}
 
 Status RecordBatchBuilder::Make(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
                                 std::unique_ptr<RecordBatchBuilder>* builder) {
@@ -53,14 +59,29 @@ Status RecordBatchBuilder::Make(const std::shared_ptr<Schema>& schema, MemoryPoo
   return (*builder)->InitBuilders();
 }
 
+Status RecordBatchBuilder::AppendColumns(
+    const std::function<Status(int, ArrayBuilder*)>& append) {
+  if (num_threads_ <= 1) {
+    for (int i = 0; i < this->num_fields(); ++i) {
+      RETURN_NOT_OK(append(i, raw_field_builders_[i]));
+    }
+    return Status::OK();
+  }
+  return ParallelFor(num_threads_, this->num_fields(),
+                     [&](int i) { return append(i, raw_field_builders_[i]); });
+}
+
 Status RecordBatchBuilder::Flush(bool reset_builders,
                                  std::shared_ptr<RecordBatch>* batch) {
   std::vector<std::shared_ptr<Array>> fields;
   fields.resize(this->num_fields());
 
+  RETURN_NOT_OK(AppendColumns([&fields](int i, ArrayBuilder* builder) {
+    return builder->Finish(&fields[i]);
+  }));
+
   int64_t length = 0;
   for (int i = 0; i < this->num_fields(); ++i) {
-    RETURN_NOT_OK(raw_field_builders_[i]->Finish(&fields[i]));
     if (i > 0 && fields[i]->length() != length) {
       return Status::Invalid("All fields must be same length when calling Flush");
     }
@@ -68,16 +89,84 @@ Status RecordBatchBuilder::Flush(bool reset_builders,
   }
   *batch = RecordBatch::Make(schema_, length, std::move(fields));
   if (reset_builders) {
-    return InitBuilders();
-  } else {
-    return Status::OK();
+    RETURN_NOT_OK(InitBuilders());
+    if (reserve_like_last_batch_) {
+      return ReserveLike(**batch);
+    }
   }
+  return Status::OK();
 }
 
 Status RecordBatchBuilder::Flush(std::shared_ptr<RecordBatch>* batch) {
   return Flush(true, batch);
 }
 
+Status RecordBatchBuilder::FlushWhenFull(int64_t max_bytes,
+                                         std::shared_ptr<RecordBatch>* batch) {
+  if (EstimatedBatchBytes() < max_bytes) {
+    batch->reset();
+    return Status::OK();
+  }
+  return Flush(true, batch);
+}
+
+namespace {
+
+// The bytes appended to the buffers of a builder made by MakeBuilder
+int64_t EstimateBuilderBytes(ArrayBuilder* builder) {
+  const int64_t length = builder->length();
+  int64_t bytes = BitUtil::BytesForBits(length);
+  switch (builder->type()->id()) {
+    case Type::BINARY:
+    case Type::STRING:
+      bytes += length * sizeof(int32_t) +
+               static_cast<BinaryBuilder*>(builder)->value_data_length();
+      break;
+    case Type::LIST:
+      bytes += length * sizeof(int32_t) +
+               EstimateBuilderBytes(static_cast<ListBuilder*>(builder)->value_builder());
+      break;
+    case Type::STRUCT: {
+      auto struct_builder = static_cast<StructBuilder*>(builder);
+      for (int i = 0; i < struct_builder->num_fields(); ++i) {
+        bytes += EstimateBuilderBytes(struct_builder->field_builder(i));
+      }
+    } break;
+    default: {
+      auto fixed_width = dynamic_cast<const FixedWidthType*>(builder->type().get());
+      if (fixed_width != nullptr) {
+        bytes += BitUtil::BytesForBits(length * fixed_width->bit_width());
+      }
+    } break;
+  }
+  return bytes;
+}
+
+}  // namespace
+
+int64_t RecordBatchBuilder::EstimatedBatchBytes() const {
+  int64_t bytes = 0;
+  for (ArrayBuilder* builder : raw_field_builders_) {
+    bytes += EstimateBuilderBytes(builder);
+  }
+  return bytes;
+}
+
+Status RecordBatchBuilder::ReserveLike(const RecordBatch& batch) {
+  if (batch.num_columns() != this->num_fields()) {
+    return Status::Invalid("ReserveLike: the batch does not match the schema");
+  }
+  for (int i = 0; i < this->num_fields(); ++i) {
+    RETURN_NOT_OK(::arrow::ReserveLike(*batch.column(i), raw_field_builders_[i]));
+  }
+  return Status::OK();
+}
+
+void RecordBatchBuilder::set_num_threads(int num_threads) {
+  DCHECK_GT(num_threads, 0) << "The number of threads must be positive";
+  num_threads_ = num_threads;
+}
+
 void RecordBatchBuilder::SetInitialCapacity(int64_t capacity) {
   DCHECK_GT(capacity, 0) << "Initial capacity must be positive";
   initial_capacity_ = capacity;
@@ -19,6 +19,7 @@
 #define ARROW_TABLE_BUILDER_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -68,6 +69,17 @@ class RecordBatchBuilder {
     return static_cast<T*>(raw_field_builders_[i]);
   }
 
+  /// \brief Append to all the field builders, column by column
+  ///
+  /// Meant for converting a block of buffered rows: append(i, builder) should
+  /// append the values of field i of every row to builder. The columns are
+  /// appended in parallel when num_threads() is more than 1, so append must
+  /// be safe to call concurrently for distinct fields.
+  ///
+  /// \param[in] append the function appending one column
+  /// \return the first error returned by append
+  Status AppendColumns(const std::function<Status(int, ArrayBuilder*)>& append);
+
   /// \brief Finish current batch and optionally reset
   /// \param[in] reset_builders the resulting RecordBatch
   /// \param[out] batch the resulting RecordBatch
@@ -79,12 +91,51 @@ class RecordBatchBuilder {
   /// \return Status
   Status Flush(std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Finish current batch and reset, if it reached a byte size
+  ///
+  /// The size is estimated from the lengths of the field builders, see
+  /// EstimatedBatchBytes.
+  ///
+  /// \param[in] max_bytes the byte size at which the batch is flushed
+  /// \param[out] batch the resulting RecordBatch, or null if the current batch
+  /// is smaller than max_bytes
+  /// \return Status
+  Status FlushWhenFull(int64_t max_bytes, std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Estimate the size of the buffers of the current batch
+  ///
+  /// The estimate counts the bytes appended so far to the validity, offset
+  /// and data buffers, not the capacity reserved by the builders.
+  int64_t EstimatedBatchBytes() const;
+
+  /// \brief Reserve the capacity to append a batch of the same shape
+  ///
+  /// See ReserveLike in builder.h
+  ///
+  /// \param[in] batch a batch of the builder's schema
+  /// \return Status
+  Status ReserveLike(const RecordBatch& batch);
+
   /// \brief Set the initial capacity for new builders
   void SetInitialCapacity(int64_t capacity);
 
+  /// \brief Reserve the builders like the last batch when flushing them
+  ///
+  /// When enabled, Flush with reset_builders reserves the capacity of the
+  /// batch it returns for the next one, see ReserveLike.
+  void SetReserveLikeLastBatch(bool reserve) { reserve_like_last_batch_ = reserve; }
+
   /// \brief The initial capacity for builders
   int64_t initial_capacity() const { return initial_capacity_; }
 
+  /// \brief Set the number of threads AppendColumns and Flush may use
+  ///
+  /// \param[in] num_threads a value of 1 (the default) means serial execution
+  void set_num_threads(int num_threads);
+
+  /// \brief The number of threads AppendColumns and Flush may use
+  int num_threads() const { return num_threads_; }
+
   /// \brief The number of fields in the schema
   int num_fields() const { return schema_->num_fields(); }
 
@@ -101,6 +152,8 @@ class RecordBatchBuilder {
   std::shared_ptr<Schema> schema_;
   int64_t initial_capacity_;
   MemoryPool* pool_;
+  int num_threads_;
+  bool reserve_like_last_batch_;
 
   std::vector<std::unique_ptr<ArrayBuilder>> field_builders_;
   std::vector<ArrayBuilder*> raw_field_builders_;
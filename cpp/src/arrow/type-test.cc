@@ -163,6 +163,38 @@ TEST_F(TestSchema, GetFieldIndex) {
   ASSERT_EQ(2, schema->GetFieldIndex(f2->name()));
   ASSERT_EQ(3, schema->GetFieldIndex(f3->name()));
   ASSERT_EQ(-1, schema->GetFieldIndex("not-found"));
+
+  const char* names = "f2f3";
+  ASSERT_EQ(2, schema->GetFieldIndex(names, 2));
+  ASSERT_EQ(3, schema->GetFieldIndex(names + 2, 2));
+  ASSERT_EQ(-1, schema->GetFieldIndex(names, 3));
+  ASSERT_TRUE(f2->Equals(schema->GetFieldByName(names, 2)));
+
+  // The last of several fields with a name is returned
+  auto duplicates = ::arrow::schema({f0, f1, field("f0", utf8())});
+  ASSERT_EQ(2, duplicates->GetFieldIndex("f0"));
+
+  ASSERT_EQ(-1, ::arrow::schema({})->GetFieldIndex("f0"));
+}
+
+TEST_F(TestSchema, GetFieldPath) {
+  auto inner = field("inner", struct_({field("x", int32()), field("y", utf8())}));
+  auto outer = field("outer", struct_({field("a", int8()), inner}));
+  auto schema = ::arrow::schema({field("f0", int32()), outer});
+
+  ASSERT_EQ(std::vector<int>({1}), schema->GetFieldPath({"outer"}));
+  ASSERT_EQ(std::vector<int>({1, 1, 0}), schema->GetFieldPath({"outer", "inner", "x"}));
+  ASSERT_TRUE(schema->GetFieldPath({"outer", "inner", "z"}).empty());
+  ASSERT_TRUE(schema->GetFieldPath({"f0", "x"}).empty());
+  ASSERT_TRUE(schema->GetFieldPath({}).empty());
+
+  ASSERT_TRUE(inner->Equals(schema->GetFieldByPath({"outer", "inner"})));
+  ASSERT_EQ("y", schema->GetFieldByPath({"outer", "inner", "y"})->name());
+  ASSERT_EQ(nullptr, schema->GetFieldByPath({"inner"}));
+
+  const auto& struct_type = static_cast<const StructType&>(*outer->type());
+  ASSERT_EQ(1, struct_type.GetChildIndex("inner"));
+  ASSERT_EQ(-1, struct_type.GetChildIndex("x"));
 }
 
 TEST_F(TestSchema, TestMetadataConstruction) {
@@ -275,6 +307,47 @@ TEST(TestListType, Basics) {
   ASSERT_EQ("list<item: list<item: string>>", lt2.ToString());
 }
 
+TEST(TestLargeTypes, Basics) {
+  ASSERT_EQ(Type::LARGE_STRING, large_utf8()->id());
+  ASSERT_EQ("large_utf8", large_utf8()->name());
+  ASSERT_EQ("large_string", large_utf8()->ToString());
+  ASSERT_EQ(Type::LARGE_BINARY, large_binary()->id());
+  ASSERT_EQ("large_binary", large_binary()->ToString());
+  ASSERT_FALSE(large_utf8()->Equals(utf8()));
+  ASSERT_FALSE(large_utf8()->Equals(large_binary()));
+  ASSERT_FALSE(large_binary()->Equals(binary()));
+
+  auto type = large_list(utf8());
+  ASSERT_EQ(Type::LARGE_LIST, type->id());
+  ASSERT_EQ("large_list", type->name());
+  ASSERT_EQ("large_list<item: string>", type->ToString());
+  ASSERT_TRUE(static_cast<const LargeListType&>(*type).value_type()->Equals(utf8()));
+  ASSERT_TRUE(type->Equals(large_list(utf8())));
+  ASSERT_FALSE(type->Equals(large_list(large_utf8())));
+  ASSERT_FALSE(type->Equals(list(utf8())));
+}
+
+TEST(TestStringViewType, Basics) {
+  ASSERT_EQ(Type::STRING_VIEW, utf8_view()->id());
+  ASSERT_EQ("utf8_view", utf8_view()->name());
+  ASSERT_EQ("string_view", utf8_view()->ToString());
+  ASSERT_TRUE(utf8_view()->Equals(utf8_view()));
+  ASSERT_FALSE(utf8_view()->Equals(utf8()));
+}
+
+TEST(TestRunLengthEncodedType, Basics) {
+  auto type = run_length_encoded(int64());
+  ASSERT_EQ(Type::RUN_LENGTH_ENCODED, type->id());
+  ASSERT_EQ("run_length_encoded", type->name());
+  ASSERT_EQ("run_length_encoded<int64>", type->ToString());
+  ASSERT_TRUE(
+      static_cast<const RunLengthEncodedType&>(*type).value_type()->Equals(int64()));
+
+  ASSERT_TRUE(type->Equals(run_length_encoded(int64())));
+  ASSERT_FALSE(type->Equals(run_length_encoded(int32())));
+  ASSERT_FALSE(type->Equals(list(int64())));
+}
+
 TEST(TestDateTypes, Attrs) {
   auto t1 = date32();
   auto t2 = date64();
@@ -441,4 +514,48 @@ TEST(TypesTest, TestDecimal128Large) {
   ASSERT_EQ(t1.bit_width(), 128);
 }
 
+TEST(TestTypeInterning, Factories) {
+  ASSERT_EQ(fixed_size_binary(4), fixed_size_binary(4));
+  ASSERT_NE(fixed_size_binary(4), fixed_size_binary(8));
+  ASSERT_EQ(timestamp(TimeUnit::MICRO), timestamp(TimeUnit::MICRO, ""));
+  ASSERT_EQ(timestamp(TimeUnit::MICRO, "UTC"), timestamp(TimeUnit::MICRO, "UTC"));
+  ASSERT_NE(timestamp(TimeUnit::MICRO, "UTC"), timestamp(TimeUnit::MICRO));
+  ASSERT_NE(time32(TimeUnit::SECOND), time32(TimeUnit::MILLI));
+  ASSERT_EQ(decimal(12, 2), decimal(12, 2));
+
+  auto list_type = list(utf8());
+  ASSERT_EQ(list_type, list(field("item", utf8())));
+  ASSERT_NE(list_type, list(field("item", utf8(), false)));
+  ASSERT_NE(list_type, large_list(utf8()));
+  ASSERT_EQ(list(list_type), list(list(utf8())));
+
+  auto struct_type = struct_({field("a", int32()), field("b", list_type)});
+  ASSERT_EQ(struct_type, struct_({field("a", int32()), field("b", list(utf8()))}));
+  ASSERT_NE(struct_type, struct_({field("b", int32()), field("a", list_type)}));
+
+  // Types with different metadata are not shared
+  auto metadata = std::make_shared<KeyValueMetadata>(std::vector<std::string>{"k"},
+                                                     std::vector<std::string>{"v"});
+  ASSERT_NE(struct_type,
+            struct_({field("a", int32()), field("b", list_type, true, metadata)}));
+
+  ASSERT_EQ(union_({field("a", int8())}, {3}), union_({field("a", int8())}, {3}));
+  ASSERT_NE(union_({field("a", int8())}, {3}), union_({field("a", int8())}, {4}));
+}
+
+TEST(TestTypeInterning, ExpiredTypes) {
+  std::weak_ptr<DataType> expired = fixed_size_binary(123457);
+  ASSERT_TRUE(expired.expired());
+
+  auto type = fixed_size_binary(123457);
+  ASSERT_EQ(123457, static_cast<const FixedSizeBinaryType&>(*type).byte_width());
+
+  // Enough types to sweep the cache
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(i, static_cast<const FixedSizeBinaryType&>(*fixed_size_binary(i))
+                     .byte_width());
+  }
+  ASSERT_EQ(type, fixed_size_binary(123457));
+}
+
 }  // namespace arrow
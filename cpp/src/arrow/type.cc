@@ -18,8 +18,16 @@
 #include "arrow/type.h"
 
 #include <climits>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -99,8 +107,29 @@ std::string ListType::ToString() const {
   return s.str();
 }
 
+std::string LargeListType::ToString() const {
+  std::stringstream s;
+  s << "large_list<" << value_field()->ToString() << ">";
+  return s.str();
+}
+
+std::string RunLengthEncodedType::ToString() const {
+  std::stringstream s;
+  s << "run_length_encoded<" << value_type()->ToString() << ">";
+  return s.str();
+}
+
 std::string BinaryType::ToString() const { return std::string("binary"); }
 
+std::string LargeBinaryType::ToString() const { return std::string("large_binary"); }
+
+std::string LargeStringType::ToString() const { return std::string("large_string"); }
+
+std::string StringViewType::ToString() const { return std::string("string_view"); }
+
+constexpr int32_t StringViewEntry::kInlineSize;
+constexpr int32_t StringViewEntry::kPrefixSize;
+
 int FixedSizeBinaryType::bit_width() const { return CHAR_BIT * byte_width(); }
 
 std::string FixedSizeBinaryType::ToString() const {
@@ -109,6 +138,33 @@ std::string FixedSizeBinaryType::ToString() const {
   return ss.str();
 }
 
+namespace {
+
+// FNV-1a, for field names looked up without making a std::string
+size_t HashName(const char* name, size_t length) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(name[i])) * 1099511628211ULL;
+  }
+  return static_cast<size_t>(hash);
+}
+
+bool NameEquals(const Field& field, const char* name, size_t length) {
+  const std::string& field_name = field.name();
+  return field_name.size() == length && std::memcmp(field_name.data(), name, length) == 0;
+}
+
+}  // namespace
+
+int StructType::GetChildIndex(const char* name, size_t length) const {
+  for (int i = num_children() - 1; i >= 0; --i) {
+    if (NameEquals(*children_[i], name, length)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
 std::string StructType::ToString() const {
   std::stringstream s;
   s << "struct<";
@@ -239,11 +295,15 @@ std::string NullType::ToString() const { return name(); }
 
 Schema::Schema(const std::vector<std::shared_ptr<Field>>& fields,
                const std::shared_ptr<const KeyValueMetadata>& metadata)
-    : fields_(fields), metadata_(metadata) {}
+    : fields_(fields), metadata_(metadata) {
+  BuildFieldIndex();
+}
 
 Schema::Schema(std::vector<std::shared_ptr<Field>>&& fields,
                const std::shared_ptr<const KeyValueMetadata>& metadata)
-    : fields_(std::move(fields)), metadata_(metadata) {}
+    : fields_(std::move(fields)), metadata_(metadata) {
+  BuildFieldIndex();
+}
 
 bool Schema::Equals(const Schema& other) const {
   if (this == &other) {
@@ -267,18 +327,86 @@ std::shared_ptr<Field> Schema::GetFieldByName(const std::string& name) const {
 }
 
 int64_t Schema::GetFieldIndex(const std::string& name) const {
-  if (fields_.size() > 0 && name_to_index_.size() == 0) {
-    for (size_t i = 0; i < fields_.size(); ++i) {
-      name_to_index_[fields_[i]->name()] = static_cast<int>(i);
+  return GetFieldIndex(name.data(), name.size());
+}
+
+std::shared_ptr<Field> Schema::GetFieldByName(const char* name, size_t length) const {
+  int64_t i = GetFieldIndex(name, length);
+  return i == -1 ? nullptr : fields_[i];
+}
+
+void Schema::BuildFieldIndex() {
+  if (fields_.empty()) {
+    return;
+  }
+  // Keep the table at most half full
+  size_t capacity = 2;
+  while (capacity < 2 * fields_.size()) {
+    capacity *= 2;
+  }
+  field_index_.assign(capacity, -1);
+  const size_t mask = capacity - 1;
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    const std::string& name = fields_[i]->name();
+    size_t slot = HashName(name.data(), name.size()) & mask;
+    while (field_index_[slot] != -1 &&
+           !NameEquals(*fields_[field_index_[slot]], name.data(), name.size())) {
+      slot = (slot + 1) & mask;
     }
+    field_index_[slot] = static_cast<int>(i);
   }
+}
 
-  auto it = name_to_index_.find(name);
-  if (it == name_to_index_.end()) {
+int64_t Schema::GetFieldIndex(const char* name, size_t length) const {
+  if (field_index_.empty()) {
     return -1;
-  } else {
-    return it->second;
   }
+  const size_t mask = field_index_.size() - 1;
+  size_t slot = HashName(name, length) & mask;
+  while (field_index_[slot] != -1) {
+    if (NameEquals(*fields_[field_index_[slot]], name, length)) {
+      return field_index_[slot];
+    }
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+
+std::vector<int> Schema::GetFieldPath(const std::vector<std::string>& names) const {
+  std::vector<int> path;
+  if (names.empty()) {
+    return path;
+  }
+  int64_t index = GetFieldIndex(names[0]);
+  if (index == -1) {
+    return path;
+  }
+  path.push_back(static_cast<int>(index));
+  const DataType* type = fields_[index]->type().get();
+  for (size_t i = 1; i < names.size(); ++i) {
+    if (type->id() != Type::STRUCT) {
+      return {};
+    }
+    const int child = static_cast<const StructType*>(type)->GetChildIndex(names[i]);
+    if (child == -1) {
+      return {};
+    }
+    path.push_back(child);
+    type = type->child(child)->type().get();
+  }
+  return path;
+}
+
+std::shared_ptr<Field> Schema::GetFieldByPath(const std::vector<std::string>& names) const {
+  std::vector<int> path = GetFieldPath(names);
+  if (path.empty()) {
+    return nullptr;
+  }
+  std::shared_ptr<Field> field = fields_[path[0]];
+  for (size_t i = 1; i < path.size(); ++i) {
+    field = field->type()->child(path[i]);
+  }
+  return field;
 }
 
 Status Schema::AddField(int i, const std::shared_ptr<Field>& field,
@@ -356,6 +484,11 @@ ACCEPT_VISITOR(BinaryType);
 ACCEPT_VISITOR(FixedSizeBinaryType);
 ACCEPT_VISITOR(StringType);
 ACCEPT_VISITOR(ListType);
+ACCEPT_VISITOR(LargeBinaryType);
+ACCEPT_VISITOR(LargeStringType);
+ACCEPT_VISITOR(LargeListType);
+ACCEPT_VISITOR(StringViewType);
+ACCEPT_VISITOR(RunLengthEncodedType);
 ACCEPT_VISITOR(StructType);
 ACCEPT_VISITOR(Decimal128Type);
 ACCEPT_VISITOR(UnionType);
@@ -388,45 +521,172 @@ TYPE_FACTORY(float32, FloatType);
 TYPE_FACTORY(float64, DoubleType);
 TYPE_FACTORY(utf8, StringType);
 TYPE_FACTORY(binary, BinaryType);
+TYPE_FACTORY(large_utf8, LargeStringType);
+TYPE_FACTORY(large_binary, LargeBinaryType);
+TYPE_FACTORY(utf8_view, StringViewType);
 TYPE_FACTORY(date64, Date64Type);
 TYPE_FACTORY(date32, Date32Type);
 
+namespace {
+
+// ----------------------------------------------------------------------
+// Interning of parametric types
+//
+// The factories below return canonical instances, so that equal types share
+// a pointer and TypeEquals returns on comparing the pointers. Instances are
+// identified by a key of their parameters, child types being identified by
+// pointer: children made by the factories are canonical themselves, others
+// only make for fewer shared instances. The cache holds weak references, the
+// expired ones being swept as it grows, and is split in shards locked
+// separately.
+
+class TypeCache {
+ public:
+  template <typename Make>
+  std::shared_ptr<DataType> GetOrMake(const std::string& key, Make&& make) {
+    Shard& shard = shards_[std::hash<std::string>()(key) % kNumShards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    std::weak_ptr<DataType>& entry = shard.types[key];
+    std::shared_ptr<DataType> type = entry.lock();
+    if (type == nullptr) {
+      type = make();
+      entry = type;
+      if (shard.types.size() >= shard.sweep_size) {
+        for (auto it = shard.types.begin(); it != shard.types.end();) {
+          it = it->second.expired() ? shard.types.erase(it) : std::next(it);
+        }
+        shard.sweep_size = std::max(kMinSweepSize, 2 * shard.types.size());
+      }
+    }
+    return type;
+  }
+
+ private:
+  static constexpr int kNumShards = 16;
+  static constexpr size_t kMinSweepSize = 64;
+
+  struct Shard {
+    Shard() : sweep_size(kMinSweepSize) {}
+
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<DataType>> types;
+    // The size of the table from which expired entries are swept
+    size_t sweep_size;
+  };
+
+  Shard shards_[kNumShards];
+};
+
+constexpr int TypeCache::kNumShards;
+constexpr size_t TypeCache::kMinSweepSize;
+
+TypeCache* GetTypeCache() {
+  // Never destroyed, as types may be made until the end of the process
+  static TypeCache* cache = new TypeCache();
+  return cache;
+}
+
+class TypeKey {
+ public:
+  explicit TypeKey(Type::type id) { Append(static_cast<int32_t>(id)); }
+
+  template <typename T>
+  TypeKey& Append(T value) {
+    static_assert(std::is_scalar<T>::value, "key parts are copied as bytes");
+    key_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    return *this;
+  }
+
+  TypeKey& Append(const std::string& value) {
+    Append(value.size());
+    key_ += value;
+    return *this;
+  }
+
+  TypeKey& Append(const Field& field) {
+    return Append(field.name())
+        .Append(field.nullable())
+        .Append(field.type().get())
+        .Append(field.metadata().get());
+  }
+
+  const std::string& key() const { return key_; }
+
+ private:
+  std::string key_;
+};
+
+template <typename T, typename... Args>
+std::shared_ptr<DataType> Intern(const TypeKey& key, Args&&... args) {
+  return GetTypeCache()->GetOrMake(
+      key.key(), [&]() { return std::make_shared<T>(std::forward<Args>(args)...); });
+}
+
+}  // namespace
+
 std::shared_ptr<DataType> fixed_size_binary(int32_t byte_width) {
-  return std::make_shared<FixedSizeBinaryType>(byte_width);
+  return Intern<FixedSizeBinaryType>(
+      TypeKey(Type::FIXED_SIZE_BINARY).Append(byte_width), byte_width);
 }
 
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit) {
-  return std::make_shared<TimestampType>(unit);
+  return timestamp(unit, "");
 }
 
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit, const std::string& timezone) {
-  return std::make_shared<TimestampType>(unit, timezone);
+  return Intern<TimestampType>(TypeKey(Type::TIMESTAMP).Append(unit).Append(timezone),
+                               unit, timezone);
 }
 
 std::shared_ptr<DataType> time32(TimeUnit::type unit) {
-  return std::make_shared<Time32Type>(unit);
+  return Intern<Time32Type>(TypeKey(Type::TIME32).Append(unit), unit);
 }
 
 std::shared_ptr<DataType> time64(TimeUnit::type unit) {
-  return std::make_shared<Time64Type>(unit);
+  return Intern<Time64Type>(TypeKey(Type::TIME64).Append(unit), unit);
 }
 
 std::shared_ptr<DataType> list(const std::shared_ptr<DataType>& value_type) {
-  return std::make_shared<ListType>(value_type);
+  return list(std::make_shared<Field>("item", value_type));
 }
 
 std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_field) {
-  return std::make_shared<ListType>(value_field);
+  return Intern<ListType>(TypeKey(Type::LIST).Append(*value_field), value_field);
+}
+
+std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type) {
+  return large_list(std::make_shared<Field>("item", value_type));
+}
+
+std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_field) {
+  return Intern<LargeListType>(TypeKey(Type::LARGE_LIST).Append(*value_field),
+                               value_field);
+}
+
+std::shared_ptr<DataType> run_length_encoded(
+    const std::shared_ptr<DataType>& value_type) {
+  return Intern<RunLengthEncodedType>(
+      TypeKey(Type::RUN_LENGTH_ENCODED).Append(value_type.get()), value_type);
 }
 
 std::shared_ptr<DataType> struct_(const std::vector<std::shared_ptr<Field>>& fields) {
-  return std::make_shared<StructType>(fields);
+  TypeKey key(Type::STRUCT);
+  for (const auto& field : fields) {
+    key.Append(*field);
+  }
+  return Intern<StructType>(key, fields);
 }
 
 std::shared_ptr<DataType> union_(const std::vector<std::shared_ptr<Field>>& child_fields,
                                  const std::vector<uint8_t>& type_codes,
                                  UnionMode::type mode) {
-  return std::make_shared<UnionType>(child_fields, type_codes, mode);
+  TypeKey key(Type::UNION);
+  key.Append(mode);
+  for (const auto& field : child_fields) {
+    key.Append(*field);
+  }
+  key.Append(std::string(type_codes.begin(), type_codes.end()));
+  return Intern<UnionType>(key, child_fields, type_codes, mode);
 }
 
 std::shared_ptr<DataType> union_(const std::vector<std::shared_ptr<Array>>& children,
@@ -445,7 +705,11 @@ std::shared_ptr<DataType> union_(const std::vector<std::shared_ptr<Array>>& chil
 std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type,
                                      const std::shared_ptr<Array>& dict_values,
                                      bool ordered) {
-  return std::make_shared<DictionaryType>(index_type, dict_values, ordered);
+  return Intern<DictionaryType>(TypeKey(Type::DICTIONARY)
+                                    .Append(index_type.get())
+                                    .Append(dict_values.get())
+                                    .Append(ordered),
+                                index_type, dict_values, ordered);
 }
 
 std::shared_ptr<Field> field(const std::string& name,
@@ -455,7 +719,8 @@ std::shared_ptr<Field> field(const std::string& name,
 }
 
 std::shared_ptr<DataType> decimal(int32_t precision, int32_t scale) {
-  return std::make_shared<Decimal128Type>(precision, scale);
+  return Intern<Decimal128Type>(TypeKey(Type::DECIMAL).Append(precision).Append(scale),
+                                precision, scale);
 }
 
 std::string Decimal128Type::ToString() const {
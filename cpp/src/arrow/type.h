@@ -129,7 +129,22 @@ struct Type {
     DICTIONARY,
 
     /// Map, a repeated struct logical type
-    MAP
+    MAP,
+
+    /// Run-length encoded values of another logical type
+    RUN_LENGTH_ENCODED,
+
+    /// UTF8 variable-length string with 64-bit offsets
+    LARGE_STRING,
+
+    /// Variable-length bytes with 64-bit offsets
+    LARGE_BINARY,
+
+    /// A list of some logical data type with 64-bit offsets
+    LARGE_LIST,
+
+    /// UTF8 variable-length string as 16-byte views, short strings inline
+    STRING_VIEW
   };
 };
 
@@ -382,6 +397,7 @@ class ARROW_EXPORT DoubleType
 class ARROW_EXPORT ListType : public NestedType {
  public:
   static constexpr Type::type type_id = Type::LIST;
+  using offset_type = int32_t;
 
   // List can contain any other logical value type
   explicit ListType(const std::shared_ptr<DataType>& value_type)
@@ -401,6 +417,54 @@ class ARROW_EXPORT ListType : public NestedType {
   std::string name() const override { return "list"; }
 };
 
+/// \brief List of some logical data type, with 64-bit offsets
+///
+/// The values of all the lists of an array can exceed 2^31 - 1 elements.
+class ARROW_EXPORT LargeListType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_LIST;
+  using offset_type = int64_t;
+
+  explicit LargeListType(const std::shared_ptr<DataType>& value_type)
+      : LargeListType(std::make_shared<Field>("item", value_type)) {}
+
+  explicit LargeListType(const std::shared_ptr<Field>& value_field)
+      : NestedType(Type::LARGE_LIST) {
+    children_ = {value_field};
+  }
+
+  std::shared_ptr<Field> value_field() const { return children_[0]; }
+
+  std::shared_ptr<DataType> value_type() const { return children_[0]->type(); }
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+
+  std::string name() const override { return "large_list"; }
+};
+
+/// \brief Values of another logical type stored as runs of equal values
+///
+/// The array has the values of the runs as a child array, and the end of
+/// each run, its logical index past its last value, as an int32 buffer. A
+/// null run is a null value. Long runs are stored, and computed on, once.
+class ARROW_EXPORT RunLengthEncodedType : public NestedType {
+ public:
+  static constexpr Type::type type_id = Type::RUN_LENGTH_ENCODED;
+
+  explicit RunLengthEncodedType(const std::shared_ptr<DataType>& value_type)
+      : NestedType(Type::RUN_LENGTH_ENCODED) {
+    children_ = {std::make_shared<Field>("values", value_type)};
+  }
+
+  std::shared_ptr<DataType> value_type() const { return children_[0]->type(); }
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+
+  std::string name() const override { return "run_length_encoded"; }
+};
+
 namespace meta {
 
 /// Additional ListType class that can be instantiated with only compile-time arguments.
@@ -418,6 +482,7 @@ class ARROW_EXPORT ListType : public ::arrow::ListType {
 class ARROW_EXPORT BinaryType : public DataType, public NoExtraMeta {
  public:
   static constexpr Type::type type_id = Type::BINARY;
+  using offset_type = int32_t;
 
   BinaryType() : BinaryType(Type::BINARY) {}
 
@@ -463,6 +528,79 @@ class ARROW_EXPORT StringType : public BinaryType {
   std::string name() const override { return "utf8"; }
 };
 
+/// \brief Variable-length bytes with 64-bit offsets
+///
+/// The data of all the values of an array can exceed 2GB.
+class ARROW_EXPORT LargeBinaryType : public DataType, public NoExtraMeta {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_BINARY;
+  using offset_type = int64_t;
+
+  LargeBinaryType() : LargeBinaryType(Type::LARGE_BINARY) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "large_binary"; }
+
+ protected:
+  // Allow subclasses to change the logical type.
+  explicit LargeBinaryType(Type::type logical_type) : DataType(logical_type) {}
+};
+
+/// \brief UTF-8 encoded strings with 64-bit offsets
+class ARROW_EXPORT LargeStringType : public LargeBinaryType {
+ public:
+  static constexpr Type::type type_id = Type::LARGE_STRING;
+
+  LargeStringType() : LargeBinaryType(Type::LARGE_STRING) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "large_utf8"; }
+};
+
+/// \brief A 16-byte entry of a StringViewArray
+///
+/// The first 4 bytes hold the length of the string. Strings of up to 12 bytes
+/// are stored inline in the 12 bytes left, zero padded. Longer strings keep
+/// their first 4 bytes there as a prefix, followed by the index of the data
+/// buffer holding them and their offset in that buffer. Either way, the length
+/// and the first 4 bytes of any string are found in the first 8 bytes.
+struct StringViewEntry {
+  static constexpr int32_t kInlineSize = 12;
+  static constexpr int32_t kPrefixSize = 4;
+
+  bool is_inline() const { return size <= kInlineSize; }
+
+  int32_t size;
+  union {
+    uint8_t inlined[kInlineSize];
+    struct {
+      uint8_t prefix[kPrefixSize];
+      int32_t buffer_index;
+      int32_t offset;
+    } ref;
+  };
+};
+
+static_assert(sizeof(StringViewEntry) == 16, "StringViewEntry must be 16 bytes");
+
+/// \brief UTF-8 encoded strings stored as StringViewEntry values
+///
+/// Equality and ordering are mostly decided from the length and prefix held
+/// by the entries, without looking up the data buffers.
+class ARROW_EXPORT StringViewType : public DataType, public NoExtraMeta {
+ public:
+  static constexpr Type::type type_id = Type::STRING_VIEW;
+  using view_type = StringViewEntry;
+
+  StringViewType() : DataType(Type::STRING_VIEW) {}
+
+  Status Accept(TypeVisitor* visitor) const override;
+  std::string ToString() const override;
+  std::string name() const override { return "utf8_view"; }
+};
+
 class ARROW_EXPORT StructType : public NestedType {
  public:
   static constexpr Type::type type_id = Type::STRUCT;
@@ -475,6 +613,13 @@ class ARROW_EXPORT StructType : public NestedType {
   Status Accept(TypeVisitor* visitor) const override;
   std::string ToString() const override;
   std::string name() const override { return "struct"; }
+
+  /// \brief Return the index of the child with the given name, or -1 if not
+  /// found. If several children have the name, the last one is returned
+  int GetChildIndex(const char* name, size_t length) const;
+  int GetChildIndex(const std::string& name) const {
+    return GetChildIndex(name.data(), name.size());
+  }
 };
 
 class ARROW_EXPORT DecimalType : public FixedSizeBinaryType {
@@ -744,9 +889,25 @@ class ARROW_EXPORT Schema {
 
   /// Returns null if name not found
   std::shared_ptr<Field> GetFieldByName(const std::string& name) const;
+  std::shared_ptr<Field> GetFieldByName(const char* name, size_t length) const;
 
-  /// Returns -1 if name not found
+  /// Returns -1 if name not found. If several fields have the name, the last
+  /// one is returned
+  ///
+  /// The lookup does not allocate, and is safe to call from several threads.
   int64_t GetFieldIndex(const std::string& name) const;
+  int64_t GetFieldIndex(const char* name, size_t length) const;
+
+  /// \brief Resolve a path of names, the first one naming a field of the
+  /// schema and each following one a child of the struct field before it
+  ///
+  /// \return the index of each field along the path, or an empty vector if
+  /// the path is not found
+  std::vector<int> GetFieldPath(const std::vector<std::string>& names) const;
+
+  /// \brief Return the field at the end of a path of names, or null if not
+  /// found. See GetFieldPath
+  std::shared_ptr<Field> GetFieldByPath(const std::vector<std::string>& names) const;
 
   const std::vector<std::shared_ptr<Field>>& fields() const { return fields_; }
 
@@ -776,8 +937,12 @@ class ARROW_EXPORT Schema {
   int num_fields() const { return static_cast<int>(fields_.size()); }
 
  private:
+  void BuildFieldIndex();
+
   std::vector<std::shared_ptr<Field>> fields_;
-  mutable std::unordered_map<std::string, int> name_to_index_;
+  // Open addressing table of field indices by name, built on construction.
+  // Empty slots hold -1
+  std::vector<int> field_index_;
 
   std::shared_ptr<const KeyValueMetadata> metadata_;
 };
@@ -801,6 +966,18 @@ std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_type);
 ARROW_EXPORT
 std::shared_ptr<DataType> list(const std::shared_ptr<DataType>& value_type);
 
+/// \brief Make an instance of LargeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_type);
+
+/// \brief Make an instance of LargeListType
+ARROW_EXPORT
+std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type);
+
+/// \brief Make an instance of RunLengthEncodedType
+ARROW_EXPORT
+std::shared_ptr<DataType> run_length_encoded(const std::shared_ptr<DataType>& value_type);
+
 /// \brief Make an instance of TimestampType
 ARROW_EXPORT
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit);
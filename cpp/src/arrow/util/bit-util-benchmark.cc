@@ -54,5 +54,58 @@ BENCHMARK(BM_CopyBitmap)
     ->MinTime(1.0)
     ->Unit(benchmark::kMicrosecond);
 
+static void BM_BitmapAnd(benchmark::State& state) {  // NOLINT non-const reference
+  const int kBufferSize = state.range(0);
+
+  std::shared_ptr<Buffer> left, right;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &left));
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &right));
+  test::random_bytes(kBufferSize, 0, left->mutable_data());
+  test::random_bytes(kBufferSize, 1, right->mutable_data());
+
+  // Leave room for the offset
+  const int num_bits = (kBufferSize - 1) * 8;
+
+  std::shared_ptr<Buffer> out;
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(BitmapAnd(default_memory_pool(), left->data(), state.range(1),
+                           right->data(), 0, num_bits, &out));
+  }
+  state.SetBytesProcessed(state.iterations() * kBufferSize * 2);
+}
+
+static void BM_CountSetBits(benchmark::State& state) {  // NOLINT non-const reference
+  const int kBufferSize = state.range(0);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &buffer));
+  test::random_bytes(kBufferSize, 0, buffer->mutable_data());
+
+  const int num_bits = (kBufferSize - 1) * 8;
+
+  int64_t count = 0;
+  while (state.KeepRunning()) {
+    count += CountSetBits(buffer->data(), state.range(1), num_bits);
+  }
+  benchmark::DoNotOptimize(count);
+  state.SetBytesProcessed(state.iterations() * kBufferSize);
+}
+
+BENCHMARK(BM_BitmapAnd)
+    ->Args({100000, 0})
+    ->Args({1000000, 0})
+    ->Args({100000, 4})
+    ->Args({1000000, 4})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_CountSetBits)
+    ->Args({100000, 0})
+    ->Args({1000000, 0})
+    ->Args({100000, 4})
+    ->Args({1000000, 4})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace BitUtil
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include <climits>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "arrow/test-util.h"
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking.h"
 #include "arrow/util/cpu-info.h"
 
 namespace arrow {
@@ -155,6 +157,59 @@ TEST(BitUtilTests, TestCountSetBits) {
 
     ASSERT_EQ(expected, result);
   }
+
+  // Ranges within a word, counted a byte at a time
+  for (int64_t offset : {0, 3, 8, 61}) {
+    for (int64_t length : {0, 1, 7, 8, 13, 40, 63}) {
+      ASSERT_EQ(SlowCountBits(buffer, offset, length),
+                CountSetBits(buffer, offset, length));
+    }
+  }
+}
+
+TEST(BitUtilTests, TestBitBlockCounter) {
+  const int kBufferSize = 100;
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &buffer));
+  uint8_t* bitmap = buffer->mutable_data();
+  test::random_bytes(kBufferSize, 0, bitmap);
+  // Some runs of all set and all unset bits
+  memset(bitmap + 16, 0xFF, 24);
+  memset(bitmap + 48, 0, 24);
+
+  const int64_t num_bits = kBufferSize * 8 - 8;
+  for (int64_t offset : {0, 3, 8, 64, 77}) {
+    for (int64_t length : {num_bits - offset, int64_t(130), int64_t(64), int64_t(5),
+                           int64_t(0)}) {
+      internal::BitBlockCounter counter(bitmap, offset, length);
+      int64_t position = 0;
+      int num_all_set = 0, num_none_set = 0;
+      for (internal::BitBlockCount block = counter.NextBlock(); block.length > 0;
+           block = counter.NextBlock()) {
+        ASSERT_LE(block.length, 64);
+        ASSERT_EQ(SlowCountBits(bitmap, offset + position, block.length),
+                  block.popcount);
+        num_all_set += block.AllSet();
+        num_none_set += block.NoneSet();
+        position += block.length;
+      }
+      ASSERT_EQ(length, position);
+      if (length == num_bits - offset) {
+        ASSERT_GT(num_all_set, 0);
+        ASSERT_GT(num_none_set, 0);
+      }
+    }
+  }
+
+  // A null bitmap is all set
+  internal::BitBlockCounter counter(nullptr, 0, 100);
+  internal::BitBlockCount block = counter.NextBlock();
+  ASSERT_EQ(64, block.length);
+  ASSERT_TRUE(block.AllSet());
+  block = counter.NextBlock();
+  ASSERT_EQ(36, block.length);
+  ASSERT_TRUE(block.AllSet());
+  ASSERT_EQ(0, counter.NextBlock().length);
 }
 
 TEST(BitUtilTests, TestCopyBitmap) {
@@ -183,6 +238,182 @@ TEST(BitUtilTests, TestCopyBitmap) {
   }
 }
 
+TEST(BitUtilTests, TestBitmapOperations) {
+  const int kBufferSize = 100;
+
+  std::shared_ptr<Buffer> left, right;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &left));
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &right));
+  test::random_bytes(kBufferSize, 0, left->mutable_data());
+  test::random_bytes(kBufferSize, 1, right->mutable_data());
+
+  using BitmapOperation =
+      Status (*)(MemoryPool*, const uint8_t*, int64_t, const uint8_t*, int64_t, int64_t,
+                 std::shared_ptr<Buffer>*);
+  struct {
+    BitmapOperation operation;
+    std::function<bool(bool, bool)> expected;
+  } cases[] = {
+      {BitmapAnd, [](bool l, bool r) { return l && r; }},
+      {BitmapOr, [](bool l, bool r) { return l || r; }},
+      {BitmapXor, [](bool l, bool r) { return l != r; }},
+      {BitmapAndNot, [](bool l, bool r) { return l && !r; }},
+  };
+
+  const int64_t num_bits = kBufferSize * 8 - 64;
+  for (const auto& c : cases) {
+    // Aligned and unaligned offsets, and lengths with padding bits
+    for (int64_t left_offset : {0, 8, 3}) {
+      for (int64_t right_offset : {0, 16, 5}) {
+        for (int64_t length : {num_bits, num_bits - 3, int64_t(300), int64_t(5)}) {
+          std::shared_ptr<Buffer> out;
+          ASSERT_OK(c.operation(default_memory_pool(), left->data(), left_offset,
+                                right->data(), right_offset, length, &out));
+          for (int64_t i = 0; i < length; ++i) {
+            ASSERT_EQ(c.expected(BitUtil::GetBit(left->data(), left_offset + i),
+                                 BitUtil::GetBit(right->data(), right_offset + i)),
+                      BitUtil::GetBit(out->data(), i));
+          }
+          for (int64_t i = length; i < BitUtil::BytesForBits(length) * 8; ++i) {
+            ASSERT_FALSE(BitUtil::GetBit(out->data(), i));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestBitmapAndAtOffset) {
+  const int kBufferSize = 40;
+
+  std::shared_ptr<Buffer> left, right;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &left));
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &right));
+  test::random_bytes(kBufferSize, 0, left->mutable_data());
+  test::random_bytes(kBufferSize, 1, right->mutable_data());
+
+  const int64_t length = 200;
+  for (int64_t out_offset : {0, 16, 3, 70}) {
+    std::shared_ptr<Buffer> out;
+    ASSERT_OK(BitmapAnd(default_memory_pool(), left->data(), 5, right->data(), 8, length,
+                        out_offset, &out));
+    for (int64_t i = 0; i < out_offset; ++i) {
+      ASSERT_FALSE(BitUtil::GetBit(out->data(), i));
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const bool expected =
+          BitUtil::GetBit(left->data(), 5 + i) && BitUtil::GetBit(right->data(), 8 + i);
+      ASSERT_EQ(expected, BitUtil::GetBit(out->data(), out_offset + i));
+    }
+  }
+}
+
+TEST(BitUtilTests, TestBitmapEquals) {
+  const int kBufferSize = 100;
+
+  std::shared_ptr<Buffer> left, right;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &left));
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &right));
+  test::random_bytes(kBufferSize, 0, left->mutable_data());
+
+  const int64_t num_bits = kBufferSize * 8 - 16;
+  for (int64_t left_offset : {0, 8, 3}) {
+    for (int64_t right_offset : {0, 16, 5, 13}) {
+      for (int64_t length : {num_bits - 3, int64_t(300), int64_t(64), int64_t(5)}) {
+        // Copy the bits of the left range to the right one
+        test::random_bytes(kBufferSize, 1, right->mutable_data());
+        for (int64_t i = 0; i < length; ++i) {
+          BitUtil::SetBitTo(right->mutable_data(), right_offset + i,
+                            BitUtil::GetBit(left->data(), left_offset + i));
+        }
+        ASSERT_TRUE(BitmapEquals(left->data(), left_offset, right->data(), right_offset,
+                                 length));
+        for (int64_t flipped : {int64_t(0), length / 2, length - 1}) {
+          const bool bit = BitUtil::GetBit(right->data(), right_offset + flipped);
+          BitUtil::SetBitTo(right->mutable_data(), right_offset + flipped, !bit);
+          ASSERT_FALSE(BitmapEquals(left->data(), left_offset, right->data(),
+                                    right_offset, length));
+          BitUtil::SetBitTo(right->mutable_data(), right_offset + flipped, bit);
+        }
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestCopyAndFillBitmap) {
+  const int kBufferSize = 100;
+  // Bits around the destination range must be kept
+  const uint8_t kPattern = 0xA5;
+  auto pattern_bit = [&](int64_t i) { return ((kPattern >> (i % 8)) & 1) != 0; };
+
+  std::shared_ptr<Buffer> source;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kBufferSize, &source));
+  test::random_bytes(kBufferSize, 0, source->mutable_data());
+
+  const int64_t num_bits = kBufferSize * 8 - 64;
+  for (int64_t offset : {0, 8, 3}) {
+    for (int64_t dest_offset : {0, 16, 5}) {
+      for (int64_t length : {num_bits, num_bits - 3, static_cast<int64_t>(0)}) {
+        std::vector<uint8_t> dest(kBufferSize, kPattern);
+        CopyBitmap(source->data(), offset, length, dest.data(), dest_offset);
+        for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+          const bool in_range = i >= dest_offset && i < dest_offset + length;
+          ASSERT_EQ(in_range ? BitUtil::GetBit(source->data(), offset + i - dest_offset)
+                             : pattern_bit(i),
+                    BitUtil::GetBit(dest.data(), i));
+        }
+
+        for (bool value : {true, false}) {
+          std::vector<uint8_t> filled(kBufferSize, kPattern);
+          FillBitmap(filled.data(), dest_offset, length, value);
+          for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+            const bool in_range = i >= dest_offset && i < dest_offset + length;
+            ASSERT_EQ(in_range ? value : pattern_bit(i),
+                      BitUtil::GetBit(filled.data(), i));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestBytesToBitmap) {
+  const int kBufferSize = 40;
+  const uint8_t kPattern = 0xA5;
+  auto pattern_bit = [&](int64_t i) { return ((kPattern >> (i % 8)) & 1) != 0; };
+
+  // Zero and various nonzero bytes, past the 32 bytes one AVX2 step packs
+  std::vector<uint8_t> bytes(kBufferSize * 8 - 16);
+  test::random_bytes(bytes.size(), 0, bytes.data());
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    if (bytes[i] % 3 == 0) {
+      bytes[i] = 0;
+    }
+  }
+  std::vector<bool> bools(bytes.begin(), bytes.end());
+
+  for (int64_t offset : {0, 8, 3, 13}) {
+    for (int64_t length : {0, 1, 7, 9, 31, 33, 65, 200}) {
+      std::vector<uint8_t> bitmap(kBufferSize, kPattern);
+      const int64_t count = BytesToBitmap(bytes.data(), length, bitmap.data(), offset);
+
+      std::vector<uint8_t> bool_bitmap(kBufferSize, kPattern);
+      const std::vector<bool> values(bools.begin(), bools.begin() + length);
+      ASSERT_EQ(count, BoolsToBitmap(values, bool_bitmap.data(), offset));
+      ASSERT_EQ(bitmap, bool_bitmap);
+
+      int64_t expected_count = 0;
+      for (int64_t i = 0; i < kBufferSize * 8; ++i) {
+        const bool in_range = i >= offset && i < offset + length;
+        ASSERT_EQ(in_range ? bytes[i - offset] != 0 : pattern_bit(i),
+                  BitUtil::GetBit(bitmap.data(), i));
+        expected_count += in_range && bytes[i - offset] != 0;
+      }
+      ASSERT_EQ(expected_count, count);
+    }
+  }
+}
+
 TEST(BitUtil, Ceil) {
   EXPECT_EQ(BitUtil::Ceil(0, 1), 0);
   EXPECT_EQ(BitUtil::Ceil(1, 1), 1);
@@ -248,6 +479,14 @@ TEST(BitUtil, TrailingBits) {
   EXPECT_EQ(BitUtil::TrailingBits(1LL << 63, 64), 1LL << 63);
 }
 
+TEST(BitUtil, CountTrailingZeros) {
+  EXPECT_EQ(BitUtil::CountTrailingZeros(static_cast<uint64_t>(1)), 0);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(static_cast<uint64_t>(0x18)), 3);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(static_cast<uint64_t>(1) << 40), 40);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(static_cast<uint64_t>(1) << 63), 63);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(~static_cast<uint64_t>(0)), 0);
+}
+
 TEST(BitUtil, ByteSwap) {
   EXPECT_EQ(BitUtil::ByteSwap(static_cast<uint32_t>(0)), 0);
   EXPECT_EQ(BitUtil::ByteSwap(static_cast<uint32_t>(0x11223344)), 0x44332211);
@@ -334,6 +573,37 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+TEST(BitStreamUtil, Unpack32) {
+  // Enough values for the SIMD kernels, and a few groups of 32 after them
+  const int kNumValues = 32 * 21;
+  std::vector<uint32_t> packed(kNumValues + 1);
+  test::random_bytes(packed.size() * sizeof(uint32_t), 0,
+                     reinterpret_cast<uint8_t*>(packed.data()));
+  const uint8_t* packed_bytes = reinterpret_cast<const uint8_t*>(packed.data());
+
+  for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+    for (int batch_size : {kNumValues, kNumValues - 5, 32, 31}) {
+      std::vector<uint32_t> values(kNumValues, 0xDEADBEEF);
+      const int num_unpacked =
+          internal::unpack32(packed.data(), values.data(), batch_size, num_bits);
+      ASSERT_EQ(batch_size / 32 * 32, num_unpacked);
+      for (int i = 0; i < num_unpacked; ++i) {
+        uint32_t expected = 0;
+        for (int b = 0; b < num_bits; ++b) {
+          if (BitUtil::GetBit(packed_bytes, static_cast<int64_t>(i) * num_bits + b)) {
+            expected |= 1U << b;
+          }
+        }
+        ASSERT_EQ(expected, values[i]) << "num_bits " << num_bits << ", value " << i;
+      }
+      // Nothing is written past the unpacked values
+      for (int i = num_unpacked; i < kNumValues; ++i) {
+        ASSERT_EQ(0xDEADBEEF, values[i]);
+      }
+    }
+  }
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
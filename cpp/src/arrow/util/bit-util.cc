@@ -25,12 +25,18 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
 #include <vector>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -57,7 +63,65 @@ Status BitUtil::BytesToBits(const std::vector<uint8_t>& bytes, MemoryPool* pool,
   return Status::OK();
 }
 
+namespace {
+
+int64_t PopcountWordsDefault(const uint64_t* words, int64_t num_words) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < num_words; ++i) {
+    count += __builtin_popcountll(words[i]);
+  }
+  return count;
+}
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+// Same as above, but with the builtin compiled to the POPCNT instruction rather
+// than to a library call
+ARROW_TARGET_SSE4_2 int64_t PopcountWordsSse42(const uint64_t* words,
+                                               int64_t num_words) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < num_words; ++i) {
+    count += __builtin_popcountll(words[i]);
+  }
+  return count;
+}
+#endif
+
+// Count the bits of a short range, a whole byte at a time where possible
+int64_t CountSetBitsByBytes(const uint8_t* data, int64_t bit_offset, int64_t length) {
+  const int64_t end = bit_offset + length;
+  int64_t count = 0;
+  int64_t i = bit_offset;
+  for (; i < end && i % 8 != 0; ++i) {
+    count += BitUtil::GetBit(data, i);
+  }
+  for (; i + 8 <= end; i += 8) {
+    count += __builtin_popcount(data[i / 8]);
+  }
+  for (; i < end; ++i) {
+    count += BitUtil::GetBit(data, i);
+  }
+  return count;
+}
+
+struct PopcountWordsDynamic {
+  using FunctionType = int64_t (*)(const uint64_t*, int64_t);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+        {internal::DispatchLevel::NONE, PopcountWordsDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {internal::DispatchLevel::SSE4_2, PopcountWordsSse42},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
+  static internal::DynamicDispatch<PopcountWordsDynamic> popcount_words;
+
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
 
   int64_t count = 0;
@@ -67,11 +131,7 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 
   // The number of bits until fast_count_start
   const int64_t initial_bits = std::min(length, fast_count_start - bit_offset);
-  for (int64_t i = bit_offset; i < bit_offset + initial_bits; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
-  }
+  count += CountSetBitsByBytes(data, bit_offset, initial_bits);
 
   const int64_t fast_counts = (length - initial_bits) / pop_len;
 
@@ -79,29 +139,18 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   const uint64_t* u64_data =
       reinterpret_cast<const uint64_t*>(data) + fast_count_start / pop_len;
 
-  const uint64_t* end = u64_data + fast_counts;
-
   // popcount as much as possible with the widest possible count
-  for (auto iter = u64_data; iter < end; ++iter) {
-    count += __builtin_popcountll(*iter);
-  }
+  count += popcount_words.func(u64_data, fast_counts);
 
-  // Account for left over bit (in theory we could fall back to smaller
-  // versions of popcount but the code complexity is likely not worth it)
+  // Account for the left over bits
   const int64_t tail_index = bit_offset + initial_bits + fast_counts * pop_len;
-  for (int64_t i = tail_index; i < bit_offset + length; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
-  }
+  count += CountSetBitsByBytes(data, tail_index, bit_offset + length - tail_index);
 
   return count;
 }
 
 Status GetEmptyBitmap(MemoryPool* pool, int64_t length, std::shared_ptr<Buffer>* result) {
-  RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), result));
-  memset((*result)->mutable_data(), 0, static_cast<size_t>((*result)->size()));
-  return Status::OK();
+  return AllocateZeroedBuffer(pool, BitUtil::BytesForBits(length), result);
 }
 
 Status CopyBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset, int64_t length,
@@ -144,6 +193,349 @@ Status CopyBitmap(MemoryPool* pool, const uint8_t* data, int64_t offset, int64_t
   return Status::OK();
 }
 
+void CopyBitmap(const uint8_t* data, int64_t offset, int64_t length, uint8_t* dest,
+                int64_t dest_offset) {
+  if (offset % 8 == 0 && dest_offset % 8 == 0) {
+    // Whole bytes first, the remaining bits below
+    const int64_t num_bytes = length / 8;
+    std::memcpy(dest + dest_offset / 8, data + offset / 8, num_bytes);
+    offset += num_bytes * 8;
+    dest_offset += num_bytes * 8;
+    length -= num_bytes * 8;
+  }
+  internal::BitmapReader reader(data, offset, length);
+  internal::BitmapWriter writer(dest, dest_offset, length);
+  for (int64_t i = 0; i < length; ++i) {
+    if (reader.IsSet()) {
+      writer.Set();
+    } else {
+      writer.Clear();
+    }
+    reader.Next();
+    writer.Next();
+  }
+  writer.Finish();
+}
+
+void FillBitmap(uint8_t* bitmap, int64_t offset, int64_t length, bool value) {
+  // Bits up to the first byte boundary, whole bytes, then the remaining bits
+  while (length > 0 && offset % 8 != 0) {
+    BitUtil::SetBitTo(bitmap, offset++, value);
+    --length;
+  }
+  const int64_t num_bytes = length / 8;
+  std::memset(bitmap + offset / 8, value ? 0xFF : 0, num_bytes);
+  offset += num_bytes * 8;
+  length -= num_bytes * 8;
+  for (int64_t i = 0; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, offset + i, value);
+  }
+}
+
+namespace {
+
+// The kernels below pack num_bytes / 8 whole bitmap bytes at once, and return
+// the number of bits set
+
+int64_t PackBytesDefault(const uint8_t* bytes, int64_t num_bytes, uint8_t* bitmap) {
+  constexpr uint64_t kLow7 = 0x7F7F7F7F7F7F7F7FULL;
+  int64_t count = 0;
+  for (int64_t i = 0; i < num_bytes / 8; ++i) {
+    uint64_t word;
+    std::memcpy(&word, bytes + i * 8, sizeof(word));
+    // 0x01 in the nonzero bytes, 0x00 in the others
+    word = ((word | ((word & kLow7) + kLow7)) >> 7) & 0x0101010101010101ULL;
+    // Gathers the low bit of byte k into bit k of the top byte
+    const uint8_t bits = static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+    bitmap[i] = bits;
+    count += __builtin_popcount(bits);
+  }
+  return count;
+}
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ARROW_TARGET_SSE4_2 int64_t PackBytesSse42(const uint8_t* bytes, int64_t num_bytes,
+                                           uint8_t* bitmap) {
+  const __m128i zero = _mm_setzero_si128();
+  int64_t count = 0;
+  int64_t i = 0;
+  for (; i + 16 <= num_bytes; i += 16) {
+    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+    const uint16_t bits = static_cast<uint16_t>(
+        ~_mm_movemask_epi8(_mm_cmpeq_epi8(values, zero)));
+    std::memcpy(bitmap + i / 8, &bits, sizeof(bits));
+    count += __builtin_popcount(bits);
+  }
+  return count + PackBytesDefault(bytes + i, num_bytes - i, bitmap + i / 8);
+}
+
+ARROW_TARGET_AVX2 int64_t PackBytesAvx2(const uint8_t* bytes, int64_t num_bytes,
+                                        uint8_t* bitmap) {
+  const __m256i zero = _mm256_setzero_si256();
+  int64_t count = 0;
+  int64_t i = 0;
+  for (; i + 32 <= num_bytes; i += 32) {
+    const __m256i values =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+    const uint32_t bits =
+        ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(values, zero)));
+    std::memcpy(bitmap + i / 8, &bits, sizeof(bits));
+    count += __builtin_popcount(bits);
+  }
+  return count + PackBytesDefault(bytes + i, num_bytes - i, bitmap + i / 8);
+}
+#endif
+
+struct PackBytesDynamic {
+  using FunctionType = int64_t (*)(const uint8_t*, int64_t, uint8_t*);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+        {internal::DispatchLevel::NONE, PackBytesDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {internal::DispatchLevel::SSE4_2, PackBytesSse42},
+        {internal::DispatchLevel::AVX2, PackBytesAvx2},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+int64_t BytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+                      int64_t offset) {
+  static internal::DynamicDispatch<PackBytesDynamic> pack_bytes;
+
+  int64_t count = 0;
+  // Bits up to the first byte boundary, whole bytes, then the remaining bits
+  while (length > 0 && offset % 8 != 0) {
+    BitUtil::SetBitTo(bitmap, offset++, *bytes != 0);
+    count += *bytes++ != 0;
+    --length;
+  }
+  const int64_t num_bytes = BitUtil::RoundDown(length, 8);
+  count += pack_bytes.func(bytes, num_bytes, bitmap + offset / 8);
+  for (int64_t i = num_bytes; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, offset + i, bytes[i] != 0);
+    count += bytes[i] != 0;
+  }
+  return count;
+}
+
+int64_t BoolsToBitmap(const std::vector<bool>& values, uint8_t* bitmap,
+                      int64_t offset) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  int64_t count = 0;
+  int64_t i = 0;
+  for (; i < length && (offset + i) % 8 != 0; ++i) {
+    BitUtil::SetBitTo(bitmap, offset + i, values[i]);
+    count += values[i];
+  }
+  // Whole bitmap bytes
+  uint8_t* out = bitmap + (offset + i) / 8;
+  for (; i + 8 <= length; i += 8) {
+    uint8_t bits = 0;
+    for (int k = 0; k < 8; ++k) {
+      bits = static_cast<uint8_t>(bits | (values[i + k] << k));
+    }
+    *out++ = bits;
+    count += __builtin_popcount(bits);
+  }
+  for (; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, offset + i, values[i]);
+    count += values[i];
+  }
+  return count;
+}
+
+namespace {
+
+// Load the 64 bits of a bitmap starting at any bit offset. The bits past the
+// first byte boundary come from the next 8 bytes, so 9 bytes may be read
+uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  if (shift != 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
+struct BitAnd {
+  uint64_t operator()(uint64_t left, uint64_t right) const { return left & right; }
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+  ARROW_TARGET_AVX2 __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_and_si256(left, right);
+  }
+#endif
+};
+
+struct BitOr {
+  uint64_t operator()(uint64_t left, uint64_t right) const { return left | right; }
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+  ARROW_TARGET_AVX2 __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_or_si256(left, right);
+  }
+#endif
+};
+
+struct BitXor {
+  uint64_t operator()(uint64_t left, uint64_t right) const { return left ^ right; }
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+  ARROW_TARGET_AVX2 __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_xor_si256(left, right);
+  }
+#endif
+};
+
+struct BitAndNot {
+  uint64_t operator()(uint64_t left, uint64_t right) const { return left & ~right; }
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+  ARROW_TARGET_AVX2 __m256i operator()(__m256i left, __m256i right) const {
+    return _mm256_andnot_si256(right, left);
+  }
+#endif
+};
+
+// The kernels below combine num_words whole words of two bitmaps starting at
+// byte boundaries. Bitwise operations do not depend on the byte order, so the
+// words are not swapped
+
+template <typename Op>
+void AlignedBitmapOpDefault(const uint8_t* left, const uint8_t* right, int64_t num_words,
+                            uint8_t* out) {
+  for (int64_t i = 0; i < num_words; ++i) {
+    uint64_t left_word, right_word;
+    std::memcpy(&left_word, left + i * 8, sizeof(left_word));
+    std::memcpy(&right_word, right + i * 8, sizeof(right_word));
+    const uint64_t word = Op()(left_word, right_word);
+    std::memcpy(out + i * 8, &word, sizeof(word));
+  }
+}
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+template <typename Op>
+ARROW_TARGET_AVX2 void AlignedBitmapOpAvx2(const uint8_t* left, const uint8_t* right,
+                                           int64_t num_words, uint8_t* out) {
+  int64_t i = 0;
+  for (; i + 4 <= num_words; i += 4) {
+    const __m256i left_words =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + i * 8));
+    const __m256i right_words =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + i * 8));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 8),
+                        Op()(left_words, right_words));
+  }
+  AlignedBitmapOpDefault<Op>(left + i * 8, right + i * 8, num_words - i, out + i * 8);
+}
+#endif
+
+template <typename Op>
+struct AlignedBitmapOpDynamic {
+  using FunctionType = void (*)(const uint8_t*, const uint8_t*, int64_t, uint8_t*);
+
+  static std::vector<std::pair<internal::DispatchLevel, FunctionType>>
+  implementations() {
+    return {
+        {internal::DispatchLevel::NONE, AlignedBitmapOpDefault<Op>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {internal::DispatchLevel::AVX2, AlignedBitmapOpAvx2<Op>},
+#endif
+    };
+  }
+};
+
+// Combine the bitmaps into dest, starting at its first bit
+template <typename Op>
+void BitmapOpInto(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, uint8_t* dest) {
+  static internal::DynamicDispatch<AlignedBitmapOpDynamic<Op>> aligned_op;
+
+  // The inputs are combined a word at a time, whatever their offsets, then
+  // the bits past the last whole word one at a time
+  const int64_t num_words = length / 64;
+  if (left_offset % 8 == 0 && right_offset % 8 == 0) {
+    aligned_op.func(left + left_offset / 8, right + right_offset / 8, num_words, dest);
+  } else {
+    for (int64_t i = 0; i < num_words; ++i) {
+      const uint64_t word = Op()(LoadBitmapWord(left, left_offset + i * 64),
+                                 LoadBitmapWord(right, right_offset + i * 64));
+      const uint64_t little_endian = BitUtil::ToLittleEndian(word);
+      std::memcpy(dest + i * 8, &little_endian, sizeof(little_endian));
+    }
+  }
+  for (int64_t i = num_words * 64; i < length; ++i) {
+    const uint64_t bit = Op()(BitUtil::GetBit(left, left_offset + i),
+                              BitUtil::GetBit(right, right_offset + i));
+    if (bit & 1) {
+      BitUtil::SetBit(dest, i);
+    }
+  }
+}
+
+template <typename Op>
+Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                const uint8_t* right, int64_t right_offset, int64_t length,
+                int64_t out_offset, std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(GetEmptyBitmap(pool, out_offset + length, &buffer));
+  uint8_t* dest = buffer->mutable_data();
+  if (out_offset % 8 == 0) {
+    BitmapOpInto<Op>(left, left_offset, right, right_offset, length,
+                     dest + out_offset / 8);
+  } else {
+    // Not byte-aligned: combine at offset 0, then shift in place
+    std::shared_ptr<Buffer> scratch;
+    RETURN_NOT_OK(GetEmptyBitmap(pool, length, &scratch));
+    BitmapOpInto<Op>(left, left_offset, right, right_offset, length,
+                     scratch->mutable_data());
+    CopyBitmap(scratch->data(), 0, length, dest, out_offset);
+  }
+  *out = buffer;
+  return Status::OK();
+}
+
+}  // namespace
+
+Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitAnd>(pool, left, left_offset, right, right_offset, length, 0,
+                          out);
+}
+
+Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 int64_t out_offset, std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitAnd>(pool, left, left_offset, right, right_offset, length,
+                          out_offset, out);
+}
+
+Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                const uint8_t* right, int64_t right_offset, int64_t length,
+                std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitOr>(pool, left, left_offset, right, right_offset, length, 0,
+                         out);
+}
+
+Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitXor>(pool, left, left_offset, right, right_offset, length, 0,
+                          out);
+}
+
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    std::shared_ptr<Buffer>* out) {
+  return BitmapOp<BitAndNot>(pool, left, left_offset, right, right_offset, length, 0,
+                             out);
+}
+
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t bit_length) {
   if (left_offset % 8 == 0 && right_offset % 8 == 0) {
@@ -162,8 +554,15 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
     return true;
   }
 
-  // Unaligned slow case
-  for (int64_t i = 0; i < bit_length; ++i) {
+  // Unaligned case, compare the shifted words then the trailing bits
+  int64_t i = 0;
+  for (; i + 64 <= bit_length; i += 64) {
+    if (LoadBitmapWord(left, left_offset + i) !=
+        LoadBitmapWord(right, right_offset + i)) {
+      return false;
+    }
+  }
+  for (; i < bit_length; ++i) {
     if (BitUtil::GetBit(left, left_offset + i) !=
         BitUtil::GetBit(right, right_offset + i)) {
       return false;
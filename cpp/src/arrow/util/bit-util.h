@@ -45,6 +45,7 @@
 #if defined(_MSC_VER)
 #include <intrin.h>
 #pragma intrinsic(_BitScanReverse)
+#pragma intrinsic(_BitScanForward64)
 #define ARROW_BYTE_SWAP64 _byteswap_uint64
 #define ARROW_BYTE_SWAP32 _byteswap_ulong
 #else
@@ -53,6 +54,7 @@
 #endif
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -293,6 +295,25 @@ static inline int64_t CountLeadingZeros(uint32_t value) {
 #endif
 }
 
+/// \brief Count the number of trailing zeros in a non-zero 64 bit integer.
+static inline int CountTrailingZeros(uint64_t value) {
+// DCHECK_NE(value, 0);
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_ctzll(value);
+#elif defined(_MSC_VER)
+  unsigned long index;                                              // NOLINT
+  _BitScanForward64(&index, static_cast<unsigned __int64>(value));  // NOLINT
+  return static_cast<int>(index);
+#else
+  int bitpos = 0;
+  while ((value & 1) == 0) {
+    value >>= 1;
+    ++bitpos;
+  }
+  return bitpos;
+#endif
+}
+
 /// Swaps the byte order (i.e. endianess)
 static inline int64_t ByteSwap(int64_t value) { return ARROW_BYTE_SWAP64(value); }
 static inline uint64_t ByteSwap(uint64_t value) {
@@ -517,6 +538,99 @@ ARROW_EXPORT
 Status CopyBitmap(MemoryPool* pool, const uint8_t* bitmap, int64_t offset, int64_t length,
                   std::shared_ptr<Buffer>* out);
 
+/// Copy a bit range of an existing bitmap into a preallocated bitmap
+///
+/// \param[in] data source data
+/// \param[in] offset bit offset into the source data
+/// \param[in] length number of bits to copy
+/// \param[out] dest destination bitmap. Bits outside of the copied range are
+/// left untouched
+/// \param[in] dest_offset bit offset into the destination bitmap
+ARROW_EXPORT
+void CopyBitmap(const uint8_t* data, int64_t offset, int64_t length, uint8_t* dest,
+                int64_t dest_offset);
+
+/// Set or clear a bit range of a bitmap
+///
+/// \param[out] bitmap the bitmap. Bits outside of the range are left
+/// untouched
+/// \param[in] offset bit offset of the range
+/// \param[in] length number of bits to set or clear
+/// \param[in] value whether to set the bits
+ARROW_EXPORT
+void FillBitmap(uint8_t* bitmap, int64_t offset, int64_t length, bool value);
+
+/// Pack one byte per value into a bit range of a bitmap, as when converting
+/// the valid_bytes of the builders
+///
+/// \param[in] bytes the bytes, each nonzero one setting its bit
+/// \param[in] length number of bytes to pack
+/// \param[out] bitmap the bitmap. Bits outside of the range are left
+/// untouched
+/// \param[in] offset bit offset of the range
+/// \return the number of set bits, i.e. nonzero bytes
+ARROW_EXPORT
+int64_t BytesToBitmap(const uint8_t* bytes, int64_t length, uint8_t* bitmap,
+                      int64_t offset);
+
+/// Same as BytesToBitmap, for all the values of a std::vector<bool>
+ARROW_EXPORT
+int64_t BoolsToBitmap(const std::vector<bool>& values, uint8_t* bitmap, int64_t offset);
+
+/// Compute the bitwise AND of two bitmaps into a new bitmap at offset 0
+///
+/// The bitmaps are combined 64 bits at a time whatever their offsets, and
+/// with SIMD instructions when both offsets are multiples of 8.
+///
+/// \param[in] pool memory pool to allocate memory from
+/// \param[in] left first source bitmap
+/// \param[in] left_offset bit offset into the first bitmap
+/// \param[in] right second source bitmap
+/// \param[in] right_offset bit offset into the second bitmap
+/// \param[in] length number of bits to compute
+/// \param[out] out the resulting bitmap
+///
+/// \return Status message
+ARROW_EXPORT
+Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 std::shared_ptr<Buffer>* out);
+
+/// Compute the bitwise AND of two bitmaps into a new bitmap at the given bit
+/// offset, the bits before it being cleared, as when the result is the
+/// validity of an array with that offset
+///
+/// \see BitmapAnd
+ARROW_EXPORT
+Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 int64_t out_offset, std::shared_ptr<Buffer>* out);
+
+/// Compute the bitwise OR of two bitmaps into a new bitmap at offset 0
+///
+/// \see BitmapAnd
+ARROW_EXPORT
+Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                const uint8_t* right, int64_t right_offset, int64_t length,
+                std::shared_ptr<Buffer>* out);
+
+/// Compute the bitwise XOR of two bitmaps into a new bitmap at offset 0
+///
+/// \see BitmapAnd
+ARROW_EXPORT
+Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                 const uint8_t* right, int64_t right_offset, int64_t length,
+                 std::shared_ptr<Buffer>* out);
+
+/// Compute the bits set in the first bitmap but not in the second one
+/// (left AND NOT right) into a new bitmap at offset 0
+///
+/// \see BitmapAnd
+ARROW_EXPORT
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    std::shared_ptr<Buffer>* out);
+
 /// Compute the number of 1's in the given data array
 ///
 /// \param[in] data a packed LSB-ordered bitmap as a byte array
@@ -531,6 +645,87 @@ ARROW_EXPORT
 bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                   int64_t right_offset, int64_t bit_length);
 
+namespace internal {
+
+/// \brief The number of set bits in a block of a bitmap
+struct BitBlockCount {
+  /// The number of bits in the block, 0 once the bitmap is exhausted
+  int16_t length;
+  /// The number of set bits in the block
+  int16_t popcount;
+
+  bool NoneSet() const { return popcount == 0; }
+  bool AllSet() const { return popcount == length; }
+};
+
+/// \brief Scan a bitmap in blocks of 64 bits
+///
+/// Kernels over nullable values can process the blocks whose bits are all
+/// valid (or all null) with a loop without branches, which the compiler can
+/// vectorize, and only test the bits one by one in the mixed blocks:
+///
+/// \code
+/// BitBlockCounter counter(valid_bits, offset, length);
+/// int64_t position = 0;
+/// for (BitBlockCount block = counter.NextBlock(); block.length > 0;
+///      block = counter.NextBlock()) {
+///   if (block.AllSet()) {
+///     ...  // no nulls in [position, position + block.length)
+///   } else if (!block.NoneSet()) {
+///     ...  // test the bits of [position, position + block.length)
+///   }
+///   position += block.length;
+/// }
+/// \endcode
+///
+/// A null bitmap is treated as all set, like the validity bitmap of an array
+/// without nulls.
+class BitBlockCounter {
+ public:
+  BitBlockCounter(const uint8_t* bitmap, int64_t start_offset, int64_t length)
+      : bitmap_(bitmap), offset_(start_offset), remaining_(length) {}
+
+  /// \brief Return the count of the next block of at most 64 bits
+  BitBlockCount NextBlock() {
+    const int16_t block_length =
+        remaining_ < kBlockSize ? static_cast<int16_t>(remaining_) : kBlockSize;
+    int16_t popcount;
+    if (bitmap_ == NULLPTR) {
+      popcount = block_length;
+    } else if (block_length == kBlockSize) {
+      popcount = static_cast<int16_t>(BitUtil::Popcount(LoadWord()));
+    } else {
+      popcount = static_cast<int16_t>(CountSetBits(bitmap_, offset_, block_length));
+    }
+    offset_ += block_length;
+    remaining_ -= block_length;
+    return BitBlockCount{block_length, popcount};
+  }
+
+  static constexpr int16_t kBlockSize = 64;
+
+ private:
+  // The 64 bits at offset_, which may span 9 bytes when it is not a multiple
+  // of 8. These bits are all within the range, so no byte past it is read.
+  uint64_t LoadWord() const {
+    const uint8_t* bytes = bitmap_ + offset_ / 8;
+    const int shift = static_cast<int>(offset_ % 8);
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    if (shift != 0) {
+      word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+    }
+    return word;
+  }
+
+  const uint8_t* bitmap_;
+  int64_t offset_;
+  int64_t remaining_;
+};
+
+}  // namespace internal
+
 }  // namespace arrow
 
 #endif  // ARROW_UTIL_BIT_UTIL_H
@@ -0,0 +1,251 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bloom-filter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+namespace {
+
+constexpr uint64_t kHashSeed = 0;
+
+// The odd multipliers deriving the bit of each word of a block from the low
+// half of the hash, as in the split block Bloom filters of Parquet
+constexpr uint32_t kSalts[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+inline int64_t BlockIndex(uint64_t hash, int64_t num_blocks) {
+  return static_cast<int64_t>(((hash >> 32) * static_cast<uint64_t>(num_blocks)) >> 32);
+}
+
+// The position of the bit of word j in a block, counting the words as
+// little-endian so that the blocks are the same on every host
+inline int BitInBlock(uint64_t hash, int j) {
+  const uint32_t bit = (static_cast<uint32_t>(hash) * kSalts[j]) >> 26;
+  return j * 64 + static_cast<int>(bit);
+}
+
+int ByteWidth(const DataType& type) {
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == nullptr || type.id() == Type::BOOL) {
+    return -1;
+  }
+  return fixed_width->bit_width() / 8;
+}
+
+template <typename Visit>
+void VisitValid(const ArrayData& data, Visit&& visit) {
+  const uint8_t* validity =
+      data.null_count != 0 && data.buffers[0] ? data.buffers[0]->data() : nullptr;
+  for (int64_t i = 0; i < data.length; ++i) {
+    if (validity == nullptr || BitUtil::GetBit(validity, data.offset + i)) {
+      visit(i);
+    }
+  }
+}
+
+// Call visit(i, hash) for each valid value i of data, whose values are not
+// dictionary-encoded
+template <typename Visit>
+Status VisitPlainHashes(const ArrayData& data, Visit&& visit) {
+  const DataType& type = *data.type;
+  if (data.length == 0 || type.id() == Type::NA) {
+    return Status::OK();
+  }
+  if (type.id() == Type::BOOL) {
+    const uint8_t* bits = data.buffers[1]->data();
+    VisitValid(data, [&](int64_t i) {
+      const uint8_t value = BitUtil::GetBit(bits, data.offset + i) ? 1 : 0;
+      visit(i, HashUtil::MurmurHash2_64(&value, 1, kHashSeed));
+    });
+  } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    const int32_t* offsets =
+        reinterpret_cast<const int32_t*>(data.buffers[1]->data()) + data.offset;
+    const uint8_t* bytes = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+    VisitValid(data, [&](int64_t i) {
+      visit(i, HashUtil::MurmurHash2_64(bytes + offsets[i], offsets[i + 1] - offsets[i],
+                                        kHashSeed));
+    });
+  } else if (type.id() != Type::DICTIONARY && ByteWidth(type) > 0) {
+    const int byte_width = ByteWidth(type);
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+    VisitValid(data, [&](int64_t i) {
+      visit(i, HashUtil::MurmurHash2_64(values + i * byte_width, byte_width, kHashSeed));
+    });
+  } else {
+    std::stringstream ss;
+    ss << "Bloom filters not implemented for " << type.ToString();
+    return Status::NotImplemented(ss.str());
+  }
+  return Status::OK();
+}
+
+template <typename IndexType, typename Visit>
+void VisitIndexHashes(const ArrayData& indices, const std::vector<uint64_t>& hashes,
+                      const std::vector<bool>& valid, Visit&& visit) {
+  const IndexType* values =
+      reinterpret_cast<const IndexType*>(indices.buffers[1]->data()) + indices.offset;
+  VisitValid(indices, [&](int64_t i) {
+    if (valid[values[i]]) {
+      visit(i, hashes[values[i]]);
+    }
+  });
+}
+
+// Call visit(i, hash) for each valid value i of data, dictionary-encoded
+// values being hashed as their dictionary values
+template <typename Visit>
+Status VisitHashes(const ArrayData& data, Visit&& visit) {
+  if (data.type->id() != Type::DICTIONARY) {
+    return VisitPlainHashes(data, std::forward<Visit>(visit));
+  }
+  if (data.length == 0) {
+    return Status::OK();
+  }
+
+  // Each dictionary value is hashed once. Indices of null dictionary values
+  // are skipped as nulls
+  const auto& dict_type = static_cast<const DictionaryType&>(*data.type);
+  const ArrayData& dictionary = *dict_type.dictionary()->data();
+  std::vector<uint64_t> hashes(static_cast<size_t>(dictionary.length), 0);
+  std::vector<bool> valid(static_cast<size_t>(dictionary.length), false);
+  RETURN_NOT_OK(VisitPlainHashes(dictionary, [&](int64_t j, uint64_t hash) {
+    hashes[j] = hash;
+    valid[j] = true;
+  }));
+  switch (dict_type.index_type()->id()) {
+    case Type::INT8:
+      VisitIndexHashes<int8_t>(data, hashes, valid, visit);
+      break;
+    case Type::INT16:
+      VisitIndexHashes<int16_t>(data, hashes, valid, visit);
+      break;
+    case Type::INT32:
+      VisitIndexHashes<int32_t>(data, hashes, valid, visit);
+      break;
+    case Type::INT64:
+      VisitIndexHashes<int64_t>(data, hashes, valid, visit);
+      break;
+    default:
+      return Status::NotImplemented("Dictionary index type " +
+                                    dict_type.index_type()->ToString());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+constexpr int64_t BlockedBloomFilter::kBlockSize;
+constexpr int BlockedBloomFilter::kDefaultBitsPerValue;
+
+BlockedBloomFilter::BlockedBloomFilter(const std::shared_ptr<Buffer>& data)
+    : data_(data),
+      mutable_blocks_(data->is_mutable() ? data->mutable_data() : nullptr),
+      num_blocks_(data->size() / kBlockSize) {}
+
+Status BlockedBloomFilter::Make(int64_t num_values, MemoryPool* pool,
+                                std::shared_ptr<BlockedBloomFilter>* out,
+                                int bits_per_value) {
+  if (num_values < 0 || bits_per_value <= 0) {
+    return Status::Invalid("Bloom filter sizes must be positive");
+  }
+  const int64_t num_bits = std::max<int64_t>(num_values * bits_per_value, 1);
+  const int64_t num_blocks = (num_bits + kBlockSize * 8 - 1) / (kBlockSize * 8);
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, num_blocks * kBlockSize, &data));
+  std::memset(data->mutable_data(), 0, static_cast<size_t>(data->size()));
+  out->reset(new BlockedBloomFilter(data));
+  return Status::OK();
+}
+
+Status BlockedBloomFilter::Open(const std::shared_ptr<Buffer>& data,
+                                std::shared_ptr<BlockedBloomFilter>* out) {
+  if (data->size() == 0 || data->size() % kBlockSize != 0) {
+    std::stringstream ss;
+    ss << "Bloom filter of " << data->size() << " bytes is not made of blocks of "
+       << kBlockSize << " bytes";
+    return Status::Invalid(ss.str());
+  }
+  out->reset(new BlockedBloomFilter(data));
+  return Status::OK();
+}
+
+void BlockedBloomFilter::InsertHash(uint64_t hash) {
+  DCHECK_NE(mutable_blocks_, nullptr);
+  uint8_t* block = mutable_blocks_ + BlockIndex(hash, num_blocks_) * kBlockSize;
+  for (int j = 0; j < 8; ++j) {
+    BitUtil::SetBit(block, BitInBlock(hash, j));
+  }
+}
+
+bool BlockedBloomFilter::FindHash(uint64_t hash) const {
+  const uint8_t* block = data_->data() + BlockIndex(hash, num_blocks_) * kBlockSize;
+  for (int j = 0; j < 8; ++j) {
+    if (!BitUtil::GetBit(block, BitInBlock(hash, j))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status BlockedBloomFilter::Insert(const ArrayData& values) {
+  if (mutable_blocks_ == nullptr) {
+    return Status::Invalid("Cannot insert into a Bloom filter of immutable data");
+  }
+  return VisitHashes(values, [this](int64_t, uint64_t hash) { InsertHash(hash); });
+}
+
+Status BlockedBloomFilter::Find(const ArrayData& values, uint8_t* out) const {
+  std::memset(out, 0, static_cast<size_t>(BitUtil::BytesForBits(values.length)));
+  return VisitHashes(values, [this, out](int64_t i, uint64_t hash) {
+    if (FindHash(hash)) {
+      BitUtil::SetBit(out, i);
+    }
+  });
+}
+
+Status BlockedBloomFilter::Merge(const BlockedBloomFilter& other) {
+  if (other.num_blocks_ != num_blocks_) {
+    std::stringstream ss;
+    ss << "Cannot merge Bloom filters of " << num_blocks_ << " and "
+       << other.num_blocks_ << " blocks";
+    return Status::Invalid(ss.str());
+  }
+  if (mutable_blocks_ == nullptr) {
+    return Status::Invalid("Cannot insert into a Bloom filter of immutable data");
+  }
+  const uint8_t* other_blocks = other.data_->data();
+  for (int64_t i = 0; i < num_blocks_ * kBlockSize; ++i) {
+    mutable_blocks_[i] |= other_blocks[i];
+  }
+  return Status::OK();
+}
+
+}  // namespace arrow
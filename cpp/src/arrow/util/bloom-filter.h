@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_BLOOM_FILTER_H
+#define ARROW_UTIL_BLOOM_FILTER_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class ArrayData;
+class Buffer;
+class MemoryPool;
+
+/// \class BlockedBloomFilter
+/// \brief A Bloom filter made of 64-byte blocks, the size of a cache line
+///
+/// A value is hashed to 64 bits, whose high half selects a block and whose
+/// low half sets or tests one bit in each of the 8 64-bit words of the block,
+/// so that a probe reads a single cache line. With the default of 16 bits
+/// per value, the false positive rate is about 0.1%.
+///
+/// The filter is stored in a buffer of little-endian words, which can be
+/// persisted and opened again without copying. Hashes are computed with
+/// MurmurHash2_64 and do not depend on the host.
+class ARROW_EXPORT BlockedBloomFilter {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+  static constexpr int kDefaultBitsPerValue = 16;
+
+  /// \brief Allocate an empty filter sized for a number of values
+  ///
+  /// \param[in] num_values the expected number of distinct values
+  /// \param[in] pool the memory pool to allocate the blocks from
+  /// \param[out] out the filter, of at least one block
+  /// \param[in] bits_per_value the number of bits to allocate per value
+  /// \return Status
+  static Status Make(int64_t num_values, MemoryPool* pool,
+                     std::shared_ptr<BlockedBloomFilter>* out,
+                     int bits_per_value = kDefaultBitsPerValue);
+
+  /// \brief Open a filter from its blocks, as returned by data()
+  ///
+  /// The buffer is not copied, so only filters of mutable buffers can be
+  /// inserted into.
+  ///
+  /// \return Status, Invalid if the size is not a positive multiple of
+  /// kBlockSize
+  static Status Open(const std::shared_ptr<Buffer>& data,
+                     std::shared_ptr<BlockedBloomFilter>* out);
+
+  /// \brief Add the 64-bit hash of a value
+  void InsertHash(uint64_t hash);
+
+  /// \return false if the value of the hash was definitely not inserted
+  bool FindHash(uint64_t hash) const;
+
+  /// \brief Add the non-null values of an array
+  ///
+  /// Fixed-width values are hashed by their bytes and binary values by their
+  /// data. Dictionary-encoded values are hashed as their dictionary values,
+  /// so that plain and encoded arrays of the same values match.
+  ///
+  /// \return Status, NotImplemented for nested types
+  Status Insert(const ArrayData& values);
+
+  /// \brief Probe the values of an array
+  ///
+  /// \param[in] values the values, hashed as by Insert
+  /// \param[out] out a bitmap of values.length bits, set for the values which
+  /// may have been inserted and cleared for the others and for nulls
+  /// \return Status, NotImplemented for nested types
+  Status Find(const ArrayData& values, uint8_t* out) const;
+
+  /// \brief Add the values inserted into another filter of the same size
+  /// \return Status, Invalid if the sizes differ
+  Status Merge(const BlockedBloomFilter& other);
+
+  /// \return the blocks of the filter
+  const std::shared_ptr<Buffer>& data() const { return data_; }
+
+  int64_t num_blocks() const { return num_blocks_; }
+
+ private:
+  explicit BlockedBloomFilter(const std::shared_ptr<Buffer>& data);
+
+  std::shared_ptr<Buffer> data_;
+  uint8_t* mutable_blocks_;
+  int64_t num_blocks_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(BlockedBloomFilter);
+};
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BLOOM_FILTER_H
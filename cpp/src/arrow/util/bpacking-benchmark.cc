@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/test-util.h"
+#include "arrow/util/bpacking.h"
+
+namespace arrow {
+namespace internal {
+
+constexpr int kNumValues = 32 * 1024;
+
+using UnpackFunction = int (*)(const uint32_t*, uint32_t*, int, int);
+
+static void BenchmarkUnpack32(benchmark::State& state,  // NOLINT non-const reference
+                              UnpackFunction unpack) {
+  const int num_bits = static_cast<int>(state.range(0));
+
+  std::vector<uint32_t> packed(kNumValues);
+  test::random_bytes(packed.size() * sizeof(uint32_t), 0,
+                     reinterpret_cast<uint8_t*>(packed.data()));
+  std::vector<uint32_t> values(kNumValues);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(unpack(packed.data(), values.data(), kNumValues, num_bits));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void BM_Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, unpack32);
+}
+
+static void BM_Unpack32_Scalar(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUnpack32(state, unpack32_default);
+}
+
+BENCHMARK(BM_Unpack32)->DenseRange(1, 32)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Unpack32_Scalar)->DenseRange(1, 32)->Unit(benchmark::kMicrosecond);
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// The SIMD kernels unpack the values in 128-bit lanes of 4 values. Each lane
+// is loaded from the 16 bytes starting at the first byte of its first value,
+// then a byte shuffle moves every value into its own 32-bit word, a variable
+// shift drops the bits of the previous value and a mask those of the next
+// ones. This requires each value to lie within the 4 bytes starting at its
+// first byte, and each lane within its 16 bytes, which holds for most bit
+// widths. The others are left to the scalar routines.
+//
+// The bit offsets of the values repeat every 8 values, which span num_bits
+// bytes, so that the same shuffle and shifts apply to every group of values.
+struct UnpackTables {
+  static constexpr int kLanes = 4;
+  static constexpr int kValues = kLanes * 4;
+
+  UnpackTables() {
+    for (int num_bits = 0; num_bits <= 32; ++num_bits) {
+      supported[num_bits] = num_bits > 0;
+      for (int k = 0; k < kValues; ++k) {
+        const int lane = k / 4;
+        const int bit_offset = k * num_bits;
+        const int first_byte = bit_offset / 8 - lane_offset(num_bits, lane);
+        shifts[num_bits][k] = static_cast<uint32_t>(bit_offset % 8);
+        if (bit_offset % 8 + num_bits > 32 || first_byte + 4 > 16) {
+          supported[num_bits] = false;
+        }
+        for (int b = 0; b < 4; ++b) {
+          shuffle[num_bits][lane * 16 + (k % 4) * 4 + b] =
+              static_cast<uint8_t>(first_byte + b);
+        }
+      }
+    }
+  }
+
+  // The first byte of a lane, relative to that of its group of values
+  static int lane_offset(int num_bits, int lane) { return lane * 4 * num_bits / 8; }
+
+  bool supported[33];
+  uint8_t shuffle[33][kLanes * 16];
+  uint32_t shifts[33][kValues];
+};
+
+const UnpackTables& GetUnpackTables() {
+  static const UnpackTables tables;
+  return tables;
+}
+
+uint32_t ValueMask(int num_bits) {
+  return num_bits == 32 ? ~0U : (1U << num_bits) - 1;
+}
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ARROW_TARGET_AVX2 int Unpack32Avx2(const uint32_t* in, uint32_t* out, int batch_size,
+                                   int num_bits) {
+  const UnpackTables& tables = GetUnpackTables();
+  if (!tables.supported[num_bits]) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  const int num_loops = batch_size / 32;
+  const int64_t in_bytes = static_cast<int64_t>(num_loops) * 4 * num_bits;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(in);
+
+  const __m256i shuffle =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shuffle[num_bits]));
+  const __m256i shifts =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tables.shifts[num_bits]));
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>(ValueMask(num_bits)));
+  const int high_offset = UnpackTables::lane_offset(num_bits, 1);
+
+  // Groups of 8 values. The loads of the last loops could go past the input,
+  // those are unpacked by the scalar routines
+  int loop = 0;
+  for (; loop < num_loops; ++loop) {
+    const uint8_t* group = bytes + static_cast<int64_t>(loop) * 4 * num_bits;
+    if (group - bytes + 3 * num_bits + high_offset + 16 > in_bytes) {
+      break;
+    }
+    for (int g = 0; g < 4; ++g, group += num_bits) {
+      const __m256i data = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(group))),
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + high_offset)), 1);
+      const __m256i values = _mm256_and_si256(
+          _mm256_srlv_epi32(_mm256_shuffle_epi8(data, shuffle), shifts), mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + loop * 32 + g * 8), values);
+    }
+  }
+  unpack32_default(in + loop * num_bits, out + loop * 32, (num_loops - loop) * 32,
+                   num_bits);
+  return num_loops * 32;
+}
+
+ARROW_TARGET_AVX512 int Unpack32Avx512(const uint32_t* in, uint32_t* out,
+                                       int batch_size, int num_bits) {
+  const UnpackTables& tables = GetUnpackTables();
+  if (!tables.supported[num_bits]) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  const int num_loops = batch_size / 32;
+  const int64_t in_bytes = static_cast<int64_t>(num_loops) * 4 * num_bits;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(in);
+
+  const __m512i shuffle =
+      _mm512_loadu_si512(reinterpret_cast<const void*>(tables.shuffle[num_bits]));
+  const __m512i shifts =
+      _mm512_loadu_si512(reinterpret_cast<const void*>(tables.shifts[num_bits]));
+  const __m512i mask = _mm512_set1_epi32(static_cast<int>(ValueMask(num_bits)));
+  const int offset1 = UnpackTables::lane_offset(num_bits, 1);
+  const int offset2 = UnpackTables::lane_offset(num_bits, 2);
+  const int offset3 = UnpackTables::lane_offset(num_bits, 3);
+
+  // Groups of 16 values, see Unpack32Avx2
+  int loop = 0;
+  for (; loop < num_loops; ++loop) {
+    const uint8_t* group = bytes + static_cast<int64_t>(loop) * 4 * num_bits;
+    if (group - bytes + 2 * num_bits + offset3 + 16 > in_bytes) {
+      break;
+    }
+    for (int g = 0; g < 2; ++g, group += 2 * num_bits) {
+      __m512i data = _mm512_castsi128_si512(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(group)));
+      data = _mm512_inserti32x4(
+          data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + offset1)), 1);
+      data = _mm512_inserti32x4(
+          data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + offset2)), 2);
+      data = _mm512_inserti32x4(
+          data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + offset3)), 3);
+      const __m512i values = _mm512_and_si512(
+          _mm512_srlv_epi32(_mm512_shuffle_epi8(data, shuffle), shifts), mask);
+      _mm512_storeu_si512(reinterpret_cast<void*>(out + loop * 32 + g * 16), values);
+    }
+  }
+  unpack32_default(in + loop * num_bits, out + loop * 32, (num_loops - loop) * 32,
+                   num_bits);
+  return num_loops * 32;
+}
+#endif
+
+struct Unpack32Dynamic {
+  using FunctionType = int (*)(const uint32_t*, uint32_t*, int, int);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, unpack32_default},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::AVX2, Unpack32Avx2},
+        {DispatchLevel::AVX512, Unpack32Avx512},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  static DynamicDispatch<Unpack32Dynamic> dispatch;
+  return dispatch.func(in, out, batch_size, num_bits);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -27,7 +27,10 @@
 #ifndef ARROW_UTIL_BPACKING_H
 #define ARROW_UTIL_BPACKING_H
 
+#include <cstdint>
+
 #include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
@@ -3191,7 +3194,9 @@ inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
-inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+/// \brief Scalar version of unpack32
+inline int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size,
+                            int num_bits) {
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
@@ -3302,6 +3307,15 @@ inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_b
   return batch_size;
 }
 
+/// \brief Unpack the batch_size / 32 * 32 first values of num_bits bits each
+///
+/// The values are unpacked with the SIMD kernels of the host when there are
+/// some for num_bits, and otherwise with the unpackN_32 routines above.
+///
+/// \return the number of values unpacked
+ARROW_EXPORT
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compression ratio and speed of each codec on the kinds of buffers making
+// up Arrow arrays. Run with --benchmark_format=json for machine-readable
+// results: the "ratio" counter is the uncompressed size over the compressed
+// one, and bytes_per_second the uncompressed bytes processed
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+
+constexpr int64_t kNumValues = 1 << 20;
+
+enum class BufferKind : int {
+  // Validity bitmap with 5% nulls
+  BITMAP,
+  // int32 offsets of strings of 0 to 20 characters
+  OFFSETS,
+  // int32 dictionary indices, skewed towards the first entries
+  DICTIONARY_INDICES,
+  // float64 random walk, as in time series of measurements
+  FLOAT,
+  // UTF-8 data of words drawn from a small vocabulary
+  UTF8
+};
+
+static const char* kBufferKindNames[] = {"bitmap", "offsets", "dictionary_indices",
+                                         "float", "utf8"};
+
+template <typename T>
+static std::vector<uint8_t> ToBytes(const std::vector<T>& values) {
+  std::vector<uint8_t> bytes(values.size() * sizeof(T));
+  std::memcpy(bytes.data(), values.data(), bytes.size());
+  return bytes;
+}
+
+static std::vector<uint8_t> MakeBuffer(BufferKind kind) {
+  std::default_random_engine rng(42);
+  switch (kind) {
+    case BufferKind::BITMAP: {
+      std::bernoulli_distribution is_valid(0.95);
+      std::vector<uint8_t> bitmap(kNumValues / 8, 0);
+      for (int64_t i = 0; i < kNumValues; ++i) {
+        if (is_valid(rng)) {
+          bitmap[i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+        }
+      }
+      return bitmap;
+    }
+    case BufferKind::OFFSETS: {
+      std::uniform_int_distribution<int32_t> length(0, 20);
+      std::vector<int32_t> offsets(kNumValues + 1, 0);
+      for (int64_t i = 0; i < kNumValues; ++i) {
+        offsets[i + 1] = offsets[i] + length(rng);
+      }
+      return ToBytes(offsets);
+    }
+    case BufferKind::DICTIONARY_INDICES: {
+      std::geometric_distribution<int32_t> index(0.05);
+      std::vector<int32_t> indices(kNumValues);
+      for (auto& value : indices) {
+        value = std::min(index(rng), 999);
+      }
+      return ToBytes(indices);
+    }
+    case BufferKind::FLOAT: {
+      std::normal_distribution<double> step(0, 0.1);
+      std::vector<double> values(kNumValues);
+      double value = 100;
+      for (auto& v : values) {
+        value += step(rng);
+        // Measurements have a limited precision
+        v = std::round(value * 100) / 100;
+      }
+      return ToBytes(values);
+    }
+    case BufferKind::UTF8: {
+      const std::vector<std::string> words = {
+          "arrow", "columnar", "memory", "données", "buffer", "größe",
+          "apache", "record",  "batch",  "東京",    "schema", "null"};
+      std::uniform_int_distribution<size_t> word(0, words.size() - 1);
+      std::vector<uint8_t> data;
+      while (static_cast<int64_t>(data.size()) < kNumValues * 8) {
+        const std::string& w = words[word(rng)];
+        data.insert(data.end(), w.begin(), w.end());
+      }
+      return data;
+    }
+  }
+  return {};
+}
+
+static std::unique_ptr<Codec> MakeCodec(benchmark::State& state,  // NOLINT
+                                        Compression::type type) {
+  std::unique_ptr<Codec> codec;
+  Status st = Codec::Create(type, &codec);
+  if (!st.ok()) {
+    state.SkipWithError(st.message().c_str());
+    return nullptr;
+  }
+  return codec;
+}
+
+static int64_t CompressBuffer(Codec* codec, const std::vector<uint8_t>& data,
+                              std::vector<uint8_t>* compressed) {
+  const int64_t input_len = static_cast<int64_t>(data.size());
+  compressed->resize(codec->MaxCompressedLen(input_len, data.data()));
+  int64_t compressed_len;
+  ABORT_NOT_OK(codec->Compress(input_len, data.data(),
+                               static_cast<int64_t>(compressed->size()),
+                               compressed->data(), &compressed_len));
+  return compressed_len;
+}
+
+static void ReportCase(benchmark::State& state,  // NOLINT non-const reference
+                       int64_t uncompressed_len, int64_t compressed_len) {
+  state.SetLabel(kBufferKindNames[state.range(0)]);
+  state.SetBytesProcessed(state.iterations() * uncompressed_len);
+  state.counters["ratio"] =
+      static_cast<double>(uncompressed_len) / static_cast<double>(compressed_len);
+}
+
+static void BM_Compress(benchmark::State& state,  // NOLINT non-const reference
+                        Compression::type type) {
+  auto codec = MakeCodec(state, type);
+  if (!codec) {
+    return;
+  }
+  const auto data = MakeBuffer(static_cast<BufferKind>(state.range(0)));
+  std::vector<uint8_t> compressed;
+  int64_t compressed_len = 0;
+  while (state.KeepRunning()) {
+    compressed_len = CompressBuffer(codec.get(), data, &compressed);
+  }
+  ReportCase(state, static_cast<int64_t>(data.size()), compressed_len);
+}
+
+static void BM_Decompress(benchmark::State& state,  // NOLINT non-const reference
+                          Compression::type type) {
+  auto codec = MakeCodec(state, type);
+  if (!codec) {
+    return;
+  }
+  const auto data = MakeBuffer(static_cast<BufferKind>(state.range(0)));
+  std::vector<uint8_t> compressed;
+  const int64_t compressed_len = CompressBuffer(codec.get(), data, &compressed);
+  std::vector<uint8_t> decompressed(data.size());
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(codec->Decompress(compressed_len, compressed.data(),
+                                   static_cast<int64_t>(decompressed.size()),
+                                   decompressed.data()));
+  }
+  ReportCase(state, static_cast<int64_t>(data.size()), compressed_len);
+}
+
+#define COMPRESSION_BENCHMARKS(NAME, TYPE)                                     \
+  BENCHMARK_CAPTURE(BM_Compress, NAME, TYPE)                                   \
+      ->DenseRange(0, static_cast<int>(BufferKind::UTF8))                      \
+      ->Unit(benchmark::kMicrosecond);                                         \
+  BENCHMARK_CAPTURE(BM_Decompress, NAME, TYPE)                                 \
+      ->DenseRange(0, static_cast<int>(BufferKind::UTF8))                      \
+      ->Unit(benchmark::kMicrosecond)
+
+COMPRESSION_BENCHMARKS(snappy, Compression::SNAPPY);
+COMPRESSION_BENCHMARKS(gzip, Compression::GZIP);
+COMPRESSION_BENCHMARKS(brotli, Compression::BROTLI);
+COMPRESSION_BENCHMARKS(zstd, Compression::ZSTD);
+COMPRESSION_BENCHMARKS(lz4, Compression::LZ4);
+
+}  // namespace arrow
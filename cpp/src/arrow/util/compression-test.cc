@@ -15,12 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include <zstd.h>
 
 #include "arrow/test-util.h"
 #include "arrow/util/compression.h"
@@ -77,6 +79,90 @@ void CheckCodec() {
   }
 }
 
+// Compress and decompress in small steps, so that the streams have to ask
+// for more output space
+template <Compression::type CODEC>
+void CheckStreamingRoundtrip(const vector<uint8_t>& data) {
+  std::unique_ptr<Codec> codec;
+  ASSERT_OK(Codec::Create(CODEC, &codec));
+
+  std::shared_ptr<Compressor> compressor;
+  ASSERT_OK(codec->MakeCompressor(&compressor));
+
+  const int64_t kStep = 1000;
+  const int64_t kOutputStep = 97;
+  vector<uint8_t> compressed;
+  auto append_output = [&](int64_t bytes_written, const vector<uint8_t>& chunk) {
+    compressed.insert(compressed.end(), chunk.begin(), chunk.begin() + bytes_written);
+  };
+  vector<uint8_t> chunk(kOutputStep);
+
+  int64_t pos = 0;
+  const int64_t data_size = static_cast<int64_t>(data.size());
+  while (pos < data_size) {
+    int64_t bytes_read, bytes_written;
+    ASSERT_OK(compressor->Compress(std::min(kStep, data_size - pos), data.data() + pos,
+                                   kOutputStep, chunk.data(), &bytes_read,
+                                   &bytes_written));
+    append_output(bytes_written, chunk);
+    pos += bytes_read;
+    if (pos == data_size / 2) {
+      bool should_retry = true;
+      while (should_retry) {
+        ASSERT_OK(compressor->Flush(kOutputStep, chunk.data(), &bytes_written,
+                                    &should_retry));
+        append_output(bytes_written, chunk);
+      }
+    }
+  }
+  bool should_retry = true;
+  while (should_retry) {
+    int64_t bytes_written;
+    ASSERT_OK(
+        compressor->End(kOutputStep, chunk.data(), &bytes_written, &should_retry));
+    append_output(bytes_written, chunk);
+  }
+
+  // The one-shot decompressor reads the streaming format
+  vector<uint8_t> decompressed(data.size());
+  ASSERT_OK(codec->Decompress(compressed.size(), compressed.data(), decompressed.size(),
+                              decompressed.data()));
+  ASSERT_EQ(data, decompressed);
+
+  std::shared_ptr<Decompressor> decompressor;
+  ASSERT_OK(codec->MakeDecompressor(&decompressor));
+  decompressed.clear();
+  pos = 0;
+  const int64_t compressed_size = static_cast<int64_t>(compressed.size());
+  while (!decompressor->IsFinished()) {
+    int64_t bytes_read, bytes_written;
+    bool need_more_output;
+    ASSERT_OK(decompressor->Decompress(std::min(kStep, compressed_size - pos),
+                                       compressed.data() + pos, kOutputStep, chunk.data(),
+                                       &bytes_read, &bytes_written, &need_more_output));
+    decompressed.insert(decompressed.end(), chunk.begin(),
+                        chunk.begin() + bytes_written);
+    pos += bytes_read;
+    ASSERT_TRUE(bytes_read > 0 || bytes_written > 0 || decompressor->IsFinished());
+  }
+  ASSERT_EQ(compressed_size, pos);
+  ASSERT_EQ(data, decompressed);
+}
+
+template <Compression::type CODEC>
+void CheckStreamingCodec() {
+  int sizes[] = {0, 10000, 100000};
+  for (int data_size : sizes) {
+    vector<uint8_t> data(data_size);
+    test::random_bytes(data_size, 1234, data.data());
+    // Make the data compressible
+    for (int i = 0; i < data_size; i += 2) {
+      data[i] = 0;
+    }
+    CheckStreamingRoundtrip<CODEC>(data);
+  }
+}
+
 TEST(TestCompressors, Snappy) { CheckCodec<Compression::SNAPPY>(); }
 
 TEST(TestCompressors, Brotli) { CheckCodec<Compression::BROTLI>(); }
@@ -85,6 +171,43 @@ TEST(TestCompressors, GZip) { CheckCodec<Compression::GZIP>(); }
 
 TEST(TestCompressors, ZSTD) { CheckCodec<Compression::ZSTD>(); }
 
+TEST(TestCompressors, ZSTDBlocks) {
+  // Large enough to be compressed as independent blocks in parallel
+  const int data_size = (3 << 22) + 1000;
+  vector<uint8_t> data(data_size);
+  test::random_bytes(data_size, 1234, data.data());
+  for (int i = 0; i < data_size; i += 2) {
+    data[i] = 0;
+  }
+  CheckCodecRoundtrip<Compression::ZSTD>(data);
+
+  std::unique_ptr<Codec> codec;
+  ASSERT_OK(Codec::Create(Compression::ZSTD, &codec));
+  vector<uint8_t> compressed(codec->MaxCompressedLen(data_size, data.data()));
+  int64_t compressed_size;
+  ASSERT_OK(codec->Compress(data_size, data.data(), compressed.size(), compressed.data(),
+                            &compressed_size));
+  ASSERT_LT(compressed_size, data_size);
+
+  // The blocks are readable by any ZSTD decoder
+  vector<uint8_t> decompressed(data_size);
+  ASSERT_EQ(decompressed.size(),
+            ZSTD_decompress(decompressed.data(), decompressed.size(), compressed.data(),
+                            static_cast<size_t>(compressed_size)));
+  ASSERT_EQ(data, decompressed);
+
+  // A corrupt block index is detected
+  compressed[20] ^= 1;
+  ASSERT_RAISES(IOError, codec->Decompress(compressed_size, compressed.data(),
+                                           data_size, decompressed.data()));
+}
+
 TEST(TestCompressors, Lz4) { CheckCodec<Compression::LZ4>(); }
 
+TEST(TestStreamingCompressors, Brotli) { CheckStreamingCodec<Compression::BROTLI>(); }
+
+TEST(TestStreamingCompressors, GZip) { CheckStreamingCodec<Compression::GZIP>(); }
+
+TEST(TestStreamingCompressors, ZSTD) { CheckStreamingCodec<Compression::ZSTD>(); }
+
 }  // namespace arrow
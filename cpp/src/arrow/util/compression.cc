@@ -18,6 +18,7 @@
 #include "arrow/util/compression.h"
 
 #include <memory>
+#include <sstream>
 
 #ifdef ARROW_WITH_BROTLI
 #include "arrow/util/compression_brotli.h"
@@ -40,11 +41,28 @@
 #endif
 
 #include "arrow/status.h"
+#include "arrow/util/macros.h"
 
 namespace arrow {
 
+Compressor::~Compressor() {}
+
+Decompressor::~Decompressor() {}
+
 Codec::~Codec() {}
 
+Status Codec::MakeCompressor(std::shared_ptr<Compressor>* ARROW_ARG_UNUSED(out)) {
+  std::stringstream ss;
+  ss << "Streaming compression not supported by the " << name() << " codec";
+  return Status::NotImplemented(ss.str());
+}
+
+Status Codec::MakeDecompressor(std::shared_ptr<Decompressor>* ARROW_ARG_UNUSED(out)) {
+  std::stringstream ss;
+  ss << "Streaming decompression not supported by the " << name() << " codec";
+  return Status::NotImplemented(ss.str());
+}
+
 Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* result) {
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
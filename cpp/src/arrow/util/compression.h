@@ -30,12 +30,69 @@ struct Compression {
   enum type { UNCOMPRESSED, SNAPPY, GZIP, BROTLI, ZSTD, LZ4, LZO };
 };
 
+/// \brief Streaming compressor interface
+///
+/// Input is passed in pieces of any size; the compressed output is
+/// produced into caller-provided buffers as it becomes available
+class ARROW_EXPORT Compressor {
+ public:
+  virtual ~Compressor();
+
+  /// \brief Compress some input
+  ///
+  /// Not all the input need be consumed. If bytes_read is 0 on return, more
+  /// output space must be provided before calling again
+  virtual Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                          uint8_t* output, int64_t* bytes_read,
+                          int64_t* bytes_written) = 0;
+
+  /// \brief Write out the compressed data for all the input consumed so far
+  ///
+  /// If should_retry is true on return, call again with more output space
+  virtual Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+                       bool* should_retry) = 0;
+
+  /// \brief Finish the compressed stream, writing out its trailer
+  ///
+  /// If should_retry is true on return, call again with more output space.
+  /// The compressor can not be used after the stream is finished
+  virtual Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+                     bool* should_retry) = 0;
+};
+
+/// \brief Streaming decompressor interface
+class ARROW_EXPORT Decompressor {
+ public:
+  virtual ~Decompressor();
+
+  /// \brief Decompress some input
+  ///
+  /// Not all the input need be consumed. If need_more_output is true on
+  /// return, more output space must be provided to make progress
+  virtual Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                            uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                            bool* need_more_output) = 0;
+
+  /// \brief Whether the end of the compressed stream was reached
+  virtual bool IsFinished() = 0;
+};
+
 class ARROW_EXPORT Codec {
  public:
   virtual ~Codec();
 
   static Status Create(Compression::type codec, std::unique_ptr<Codec>* out);
 
+  /// \brief Create a streaming compressor producing the format of this codec
+  ///
+  /// Returns NotImplemented for codecs that only have a block format
+  virtual Status MakeCompressor(std::shared_ptr<Compressor>* out);
+
+  /// \brief Create a streaming decompressor for the format of this codec
+  ///
+  /// Returns NotImplemented for codecs that only have a block format
+  virtual Status MakeDecompressor(std::shared_ptr<Decompressor>* out);
+
   virtual Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
                             uint8_t* output_buffer) = 0;
 
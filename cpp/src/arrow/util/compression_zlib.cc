@@ -17,8 +17,10 @@
 
 #include "arrow/util/compression_zlib.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -46,6 +48,167 @@ static constexpr int GZIP_CODEC = 16;
 // Determine if this is libz or gzip from header.
 static constexpr int DETECT_CODEC = 32;
 
+static int CompressionWindowBits(GZipCodec::Format format) {
+  if (format == GZipCodec::DEFLATE) {
+    return -WINDOW_BITS;
+  } else if (format == GZipCodec::GZIP) {
+    return WINDOW_BITS + GZIP_CODEC;
+  }
+  return WINDOW_BITS;
+}
+
+static int DecompressionWindowBits(GZipCodec::Format format) {
+  return format == GZipCodec::DEFLATE ? -WINDOW_BITS : WINDOW_BITS | DETECT_CODEC;
+}
+
+// zlib counts bytes in uInt, so longer buffers are passed in several calls
+static uInt LimitLength(int64_t length) {
+  return static_cast<uInt>(
+      std::min(length, static_cast<int64_t>(std::numeric_limits<uInt>::max())));
+}
+
+static Status ZlibError(const char* prefix, const z_stream& stream) {
+  std::stringstream ss;
+  ss << prefix;
+  if (stream.msg != NULL) {
+    ss << stream.msg;
+  }
+  return Status::IOError(ss.str());
+}
+
+// ----------------------------------------------------------------------
+// gzip streaming compressor
+
+class GZipCompressor : public Compressor {
+ public:
+  GZipCompressor() : initialized_(false) {}
+
+  ~GZipCompressor() override {
+    if (initialized_) {
+      (void)deflateEnd(&stream_);
+    }
+  }
+
+  Status Init(GZipCodec::Format format) {
+    DCHECK(!initialized_);
+    memset(&stream_, 0, sizeof(stream_));
+    if (deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                     CompressionWindowBits(format), 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+      return ZlibError("zlib deflateInit failed: ", stream_);
+    }
+    initialized_ = true;
+    return Status::OK();
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                  uint8_t* output, int64_t* bytes_read, int64_t* bytes_written) override {
+    const uInt avail_in = LimitLength(input_len);
+    const uInt avail_out = LimitLength(output_len);
+    stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    stream_.avail_in = avail_in;
+    stream_.next_out = reinterpret_cast<Bytef*>(output);
+    stream_.avail_out = avail_out;
+
+    // Z_BUF_ERROR only means that no progress was possible
+    int ret = deflate(&stream_, Z_NO_FLUSH);
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      return ZlibError("zlib compress failed: ", stream_);
+    }
+    *bytes_read = avail_in - stream_.avail_in;
+    *bytes_written = avail_out - stream_.avail_out;
+    return Status::OK();
+  }
+
+  Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+               bool* should_retry) override {
+    return Finish(Z_SYNC_FLUSH, output_len, output, bytes_written, should_retry);
+  }
+
+  Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+             bool* should_retry) override {
+    return Finish(Z_FINISH, output_len, output, bytes_written, should_retry);
+  }
+
+ private:
+  Status Finish(int flush, int64_t output_len, uint8_t* output, int64_t* bytes_written,
+                bool* should_retry) {
+    const uInt avail_out = LimitLength(output_len);
+    stream_.avail_in = 0;
+    stream_.next_out = reinterpret_cast<Bytef*>(output);
+    stream_.avail_out = avail_out;
+
+    int ret = deflate(&stream_, flush);
+    if (ret != Z_OK && ret != Z_BUF_ERROR && ret != Z_STREAM_END) {
+      return ZlibError("zlib flush failed: ", stream_);
+    }
+    *bytes_written = avail_out - stream_.avail_out;
+    if (flush == Z_FINISH) {
+      // Anything but the end of the stream means the output was too small
+      *should_retry = ret != Z_STREAM_END;
+    } else {
+      // A full output buffer may hide more pending output
+      *should_retry = stream_.avail_out == 0;
+    }
+    return Status::OK();
+  }
+
+  z_stream stream_;
+  bool initialized_;
+};
+
+// ----------------------------------------------------------------------
+// gzip streaming decompressor
+
+class GZipDecompressor : public Decompressor {
+ public:
+  GZipDecompressor() : initialized_(false), finished_(false) {}
+
+  ~GZipDecompressor() override {
+    if (initialized_) {
+      (void)inflateEnd(&stream_);
+    }
+  }
+
+  Status Init(GZipCodec::Format format) {
+    DCHECK(!initialized_);
+    memset(&stream_, 0, sizeof(stream_));
+    if (inflateInit2(&stream_, DecompressionWindowBits(format)) != Z_OK) {
+      return ZlibError("zlib inflateInit failed: ", stream_);
+    }
+    initialized_ = true;
+    return Status::OK();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                    uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                    bool* need_more_output) override {
+    const uInt avail_in = LimitLength(input_len);
+    const uInt avail_out = LimitLength(output_len);
+    stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    stream_.avail_in = avail_in;
+    stream_.next_out = reinterpret_cast<Bytef*>(output);
+    stream_.avail_out = avail_out;
+
+    int ret = inflate(&stream_, Z_SYNC_FLUSH);
+    if (ret == Z_DATA_ERROR || ret == Z_STREAM_ERROR || ret == Z_MEM_ERROR ||
+        ret == Z_NEED_DICT) {
+      return ZlibError("zlib inflate failed: ", stream_);
+    }
+    finished_ = ret == Z_STREAM_END;
+    *bytes_read = avail_in - stream_.avail_in;
+    *bytes_written = avail_out - stream_.avail_out;
+    *need_more_output = !finished_ && stream_.avail_out == 0;
+    return Status::OK();
+  }
+
+  bool IsFinished() override { return finished_; }
+
+ private:
+  z_stream stream_;
+  bool initialized_;
+  bool finished_;
+};
+
 class GZipCodec::GZipCodecImpl {
  public:
   explicit GZipCodecImpl(GZipCodec::Format format)
@@ -64,14 +227,9 @@ class GZipCodec::GZipCodecImpl {
 
     int ret;
     // Initialize to run specified format
-    int window_bits = WINDOW_BITS;
-    if (format_ == DEFLATE) {
-      window_bits = -window_bits;
-    } else if (format_ == GZIP) {
-      window_bits += GZIP_CODEC;
-    }
-    if ((ret = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits, 9,
-                            Z_DEFAULT_STRATEGY)) != Z_OK) {
+    if ((ret = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                            CompressionWindowBits(format_), 9, Z_DEFAULT_STRATEGY)) !=
+        Z_OK) {
       std::stringstream ss;
       ss << "zlib deflateInit failed: " << std::string(stream_.msg);
       return Status::IOError(ss.str());
@@ -93,8 +251,7 @@ class GZipCodec::GZipCodecImpl {
     int ret;
 
     // Initialize to run either deflate or zlib/gzip format
-    int window_bits = format_ == DEFLATE ? -WINDOW_BITS : WINDOW_BITS | DETECT_CODEC;
-    if ((ret = inflateInit2(&stream_, window_bits)) != Z_OK) {
+    if ((ret = inflateInit2(&stream_, DecompressionWindowBits(format_))) != Z_OK) {
       std::stringstream ss;
       ss << "zlib inflateInit failed: " << std::string(stream_.msg);
       return Status::IOError(ss.str());
@@ -228,7 +385,9 @@ class GZipCodec::GZipCodecImpl {
   bool decompressor_initialized_;
 };
 
-GZipCodec::GZipCodec(Format format) { impl_.reset(new GZipCodecImpl(format)); }
+GZipCodec::GZipCodec(Format format) : format_(format) {
+  impl_.reset(new GZipCodecImpl(format));
+}
 
 GZipCodec::~GZipCodec() {}
 
@@ -247,6 +406,20 @@ Status GZipCodec::Compress(int64_t input_length, const uint8_t* input,
   return impl_->Compress(input_length, input, output_buffer_len, output, output_length);
 }
 
+Status GZipCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  auto compressor = std::make_shared<GZipCompressor>();
+  RETURN_NOT_OK(compressor->Init(format_));
+  *out = compressor;
+  return Status::OK();
+}
+
+Status GZipCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+  auto decompressor = std::make_shared<GZipDecompressor>();
+  RETURN_NOT_OK(decompressor->Init(format_));
+  *out = decompressor;
+  return Status::OK();
+}
+
 const char* GZipCodec::name() const { return "gzip"; }
 
 }  // namespace arrow
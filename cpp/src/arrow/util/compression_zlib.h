@@ -48,9 +48,15 @@ class ARROW_EXPORT GZipCodec : public Codec {
 
   int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override;
 
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) override;
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
+
   const char* name() const override;
 
  private:
+  Format format_;
+
   // The gzip compressor is stateful
   class GZipCodecImpl;
   std::unique_ptr<GZipCodecImpl> impl_;
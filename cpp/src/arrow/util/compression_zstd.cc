@@ -17,23 +17,179 @@
 
 #include "arrow/util/compression_zstd.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <vector>
 
 #include <zstd.h>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 
 using std::size_t;
 
 namespace arrow {
 
+// Compression level of the compressed output
+static constexpr int kZSTDLevel = 1;
+
+static Status ZSTDError(size_t ret, const char* prefix) {
+  std::stringstream ss;
+  ss << prefix << ZSTD_getErrorName(ret);
+  return Status::IOError(ss.str());
+}
+
+// ----------------------------------------------------------------------
+// ZSTD streaming compressor
+
+class ZSTDCompressor : public Compressor {
+ public:
+  ZSTDCompressor() : stream_(ZSTD_createCStream()) {}
+
+  ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
+
+  Status Init() {
+    if (stream_ == nullptr) {
+      return Status::OutOfMemory("ZSTD init failed");
+    }
+    size_t ret = ZSTD_initCStream(stream_, kZSTDLevel);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD init failed: ");
+    }
+    return Status::OK();
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                  uint8_t* output, int64_t* bytes_read, int64_t* bytes_written) override {
+    ZSTD_inBuffer in_buf{input, static_cast<size_t>(input_len), 0};
+    ZSTD_outBuffer out_buf{output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_compressStream(stream_, &out_buf, &in_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD compress failed: ");
+    }
+    *bytes_read = static_cast<int64_t>(in_buf.pos);
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    return Status::OK();
+  }
+
+  Status Flush(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+               bool* should_retry) override {
+    ZSTD_outBuffer out_buf{output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_flushStream(stream_, &out_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD flush failed: ");
+    }
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    // The return value is the number of bytes left to flush
+    *should_retry = ret > 0;
+    return Status::OK();
+  }
+
+  Status End(int64_t output_len, uint8_t* output, int64_t* bytes_written,
+             bool* should_retry) override {
+    ZSTD_outBuffer out_buf{output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_endStream(stream_, &out_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD end failed: ");
+    }
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    *should_retry = ret > 0;
+    return Status::OK();
+  }
+
+ private:
+  ZSTD_CStream* stream_;
+};
+
+// ----------------------------------------------------------------------
+// ZSTD streaming decompressor
+
+class ZSTDDecompressor : public Decompressor {
+ public:
+  ZSTDDecompressor() : stream_(ZSTD_createDStream()), finished_(false) {}
+
+  ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
+
+  Status Init() {
+    if (stream_ == nullptr) {
+      return Status::OutOfMemory("ZSTD init failed");
+    }
+    size_t ret = ZSTD_initDStream(stream_);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD init failed: ");
+    }
+    return Status::OK();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                    uint8_t* output, int64_t* bytes_read, int64_t* bytes_written,
+                    bool* need_more_output) override {
+    ZSTD_inBuffer in_buf{input, static_cast<size_t>(input_len), 0};
+    ZSTD_outBuffer out_buf{output, static_cast<size_t>(output_len), 0};
+    size_t ret = ZSTD_decompressStream(stream_, &out_buf, &in_buf);
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD decompress failed: ");
+    }
+    // A return value of 0 means a frame was completely decoded
+    finished_ = ret == 0;
+    *bytes_read = static_cast<int64_t>(in_buf.pos);
+    *bytes_written = static_cast<int64_t>(out_buf.pos);
+    *need_more_output = !finished_ && out_buf.pos == out_buf.size;
+    return Status::OK();
+  }
+
+  bool IsFinished() override { return finished_; }
+
+ private:
+  ZSTD_DStream* stream_;
+  bool finished_;
+};
+
 // ----------------------------------------------------------------------
 // ZSTD implementation
 
-Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
-                             uint8_t* output_buffer) {
+// Inputs of at least two blocks are compressed as independent frames on the
+// CPU thread pool. The frames are preceded by a skippable frame indexing them,
+// which other ZSTD decoders ignore before decoding the frames one after another.
+//
+// Index layout, little-endian: skippable frame magic (u32), size of the rest
+// of the index (u32), kBlockIndexTag (u32), block size (u64), then the
+// compressed size of each block (u64)
+static constexpr int64_t kBlockSize = 1 << 22;
+static constexpr uint32_t kSkippableFrameMagic = 0x184D2A5A;
+static constexpr uint32_t kBlockIndexTag = 0x4B4C4241;  // "ABLK"
+static constexpr int64_t kBlockIndexHeaderSize = 20;
+
+static int64_t NumBlocks(int64_t input_len) {
+  return input_len < 2 * kBlockSize ? 1 : (input_len + kBlockSize - 1) / kBlockSize;
+}
+
+static int64_t BlockIndexSize(int64_t num_blocks) {
+  return kBlockIndexHeaderSize + 8 * num_blocks;
+}
+
+template <typename T>
+static T LoadLittleEndian(const uint8_t* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return BitUtil::FromLittleEndian(value);
+}
+
+template <typename T>
+static void StoreLittleEndian(T value, uint8_t* data) {
+  value = BitUtil::ToLittleEndian(value);
+  std::memcpy(data, &value, sizeof(T));
+}
+
+static Status DecompressFrames(int64_t input_len, const uint8_t* input,
+                               int64_t output_len, uint8_t* output_buffer) {
   int64_t decompressed_size =
       ZSTD_decompress(output_buffer, static_cast<size_t>(output_len), input,
                       static_cast<size_t>(input_len));
@@ -43,19 +199,124 @@ Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input, int64_t ou
   return Status::OK();
 }
 
+Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
+                             uint8_t* output_buffer) {
+  if (input_len < kBlockIndexHeaderSize ||
+      LoadLittleEndian<uint32_t>(input) != kSkippableFrameMagic ||
+      LoadLittleEndian<uint32_t>(input + 8) != kBlockIndexTag) {
+    return DecompressFrames(input_len, input, output_len, output_buffer);
+  }
+
+  const int64_t index_size = 8 + LoadLittleEndian<uint32_t>(input + 4);
+  const int64_t block_size = LoadLittleEndian<uint64_t>(input + 12);
+  const int64_t num_blocks = (index_size - kBlockIndexHeaderSize) / 8;
+  if (index_size > input_len || index_size != BlockIndexSize(num_blocks) ||
+      block_size <= 0 || num_blocks != (output_len + block_size - 1) / block_size) {
+    return Status::IOError("Corrupt ZSTD block index.");
+  }
+  std::vector<int64_t> offsets(static_cast<size_t>(num_blocks) + 1, index_size);
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    const int64_t size =
+        LoadLittleEndian<uint64_t>(input + kBlockIndexHeaderSize + 8 * i);
+    if (size < 0 || size > input_len - offsets[i]) {
+      return Status::IOError("Corrupt ZSTD block index.");
+    }
+    offsets[i + 1] = offsets[i] + size;
+  }
+  if (offsets[num_blocks] != input_len) {
+    return Status::IOError("Corrupt ZSTD block index.");
+  }
+
+  return ParallelFor(GetCpuThreadPoolCapacity(), static_cast<int>(num_blocks),
+                     [&](int i) {
+                       const int64_t start = i * block_size;
+                       return DecompressFrames(
+                           offsets[i + 1] - offsets[i], input + offsets[i],
+                           std::min(block_size, output_len - start),
+                           output_buffer + start);
+                     });
+}
+
 int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
                                     const uint8_t* ARROW_ARG_UNUSED(input)) {
-  return ZSTD_compressBound(input_len);
+  const int64_t num_blocks = NumBlocks(input_len);
+  if (num_blocks == 1) {
+    return ZSTD_compressBound(input_len);
+  }
+  const int64_t last_block_size = input_len - (num_blocks - 1) * kBlockSize;
+  return BlockIndexSize(num_blocks) +
+         (num_blocks - 1) * ZSTD_compressBound(kBlockSize) +
+         ZSTD_compressBound(last_block_size);
 }
 
 Status ZSTDCodec::Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer,
                            int64_t* output_length) {
-  *output_length = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len), 1);
-  if (ZSTD_isError(*output_length)) {
-    return Status::IOError("ZSTD compression failure.");
+  const int64_t num_blocks = NumBlocks(input_len);
+  if (num_blocks == 1) {
+    *output_length = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
+                                   input, static_cast<size_t>(input_len), kZSTDLevel);
+    if (ZSTD_isError(*output_length)) {
+      return Status::IOError("ZSTD compression failure.");
+    }
+    return Status::OK();
   }
+
+  // Compress the blocks to scratch space, then copy them after the index once
+  // their sizes are known
+  const int64_t index_size = BlockIndexSize(num_blocks);
+  const int64_t block_bound = ZSTD_compressBound(kBlockSize);
+  std::vector<std::unique_ptr<uint8_t[]>> blocks(static_cast<size_t>(num_blocks));
+  std::vector<int64_t> offsets(static_cast<size_t>(num_blocks) + 1, index_size);
+  const int nthreads = GetCpuThreadPoolCapacity();
+  RETURN_NOT_OK(ParallelFor(nthreads, static_cast<int>(num_blocks), [&](int i) {
+    const int64_t start = i * kBlockSize;
+    blocks[i].reset(new uint8_t[block_bound]);
+    const size_t size = ZSTD_compress(
+        blocks[i].get(), static_cast<size_t>(block_bound), input + start,
+        static_cast<size_t>(std::min(kBlockSize, input_len - start)), kZSTDLevel);
+    if (ZSTD_isError(size)) {
+      return Status::IOError("ZSTD compression failure.");
+    }
+    offsets[i + 1] = static_cast<int64_t>(size);
+    return Status::OK();
+  }));
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  if (offsets[num_blocks] > output_buffer_len) {
+    return Status::IOError("ZSTD compression failure: output buffer too small.");
+  }
+
+  StoreLittleEndian(kSkippableFrameMagic, output_buffer);
+  StoreLittleEndian(static_cast<uint32_t>(index_size - 8), output_buffer + 4);
+  StoreLittleEndian(kBlockIndexTag, output_buffer + 8);
+  StoreLittleEndian(static_cast<uint64_t>(kBlockSize), output_buffer + 12);
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    StoreLittleEndian(static_cast<uint64_t>(offsets[i + 1] - offsets[i]),
+                      output_buffer + kBlockIndexHeaderSize + 8 * i);
+  }
+  RETURN_NOT_OK(ParallelFor(nthreads, static_cast<int>(num_blocks), [&](int i) {
+    std::memcpy(output_buffer + offsets[i], blocks[i].get(),
+                static_cast<size_t>(offsets[i + 1] - offsets[i]));
+    blocks[i].reset();
+    return Status::OK();
+  }));
+  *output_length = offsets[num_blocks];
+  return Status::OK();
+}
+
+Status ZSTDCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  auto compressor = std::make_shared<ZSTDCompressor>();
+  RETURN_NOT_OK(compressor->Init());
+  *out = compressor;
+  return Status::OK();
+}
+
+Status ZSTDCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+  auto decompressor = std::make_shared<ZSTDDecompressor>();
+  RETURN_NOT_OK(decompressor->Init());
+  *out = decompressor;
   return Status::OK();
 }
 
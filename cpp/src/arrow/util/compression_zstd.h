@@ -19,6 +19,7 @@
 #define ARROW_UTIL_COMPRESSION_ZSTD_H
 
 #include <cstdint>
+#include <memory>
 
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
@@ -27,6 +28,10 @@
 namespace arrow {
 
 // ZSTD codec.
+//
+// One-shot compression of large buffers splits them into independent frames,
+// compressed and decompressed in parallel on the CPU thread pool. The output
+// remains readable by any ZSTD decoder.
 class ARROW_EXPORT ZSTDCodec : public Codec {
  public:
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_len,
@@ -37,6 +42,10 @@ class ARROW_EXPORT ZSTDCodec : public Codec {
 
   int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override;
 
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) override;
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
+
   const char* name() const override { return "zstd"; }
 };
 
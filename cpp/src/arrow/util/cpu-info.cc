@@ -73,6 +73,12 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512F},
+    {"avx512cd", CpuInfo::AVX512CD},
+    {"avx512vl", CpuInfo::AVX512VL},
+    {"avx512dq", CpuInfo::AVX512DQ},
+    {"avx512bw", CpuInfo::AVX512BW},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -145,9 +151,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
     return false;
   }
   const int register_ECX_id = 1;
+  const int register_extended_EBX_id = 7;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
   std::bitset<32> features_ECX;
+  std::bitset<32> features_extended_EBX;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -159,6 +167,12 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  // Extended features are reported in EBX of leaf 7
+  if (highest_valid_id >= register_extended_EBX_id) {
+    __cpuidex(cpu_info.data(), register_extended_EBX_id, 0);
+    features_extended_EBX = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -177,6 +191,12 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (features_extended_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  if (features_extended_EBX[16]) *hardware_flags |= CpuInfo::AVX512F;
+  if (features_extended_EBX[17]) *hardware_flags |= CpuInfo::AVX512DQ;
+  if (features_extended_EBX[28]) *hardware_flags |= CpuInfo::AVX512CD;
+  if (features_extended_EBX[30]) *hardware_flags |= CpuInfo::AVX512BW;
+  if (features_extended_EBX[31]) *hardware_flags |= CpuInfo::AVX512VL;
   return true;
 }
 #endif
@@ -38,6 +38,15 @@ class ARROW_EXPORT CpuInfo {
   static const int64_t SSE4_1 = (1 << 2);
   static const int64_t SSE4_2 = (1 << 3);
   static const int64_t POPCNT = (1 << 4);
+  static const int64_t AVX2 = (1 << 5);
+  static const int64_t AVX512F = (1 << 6);
+  static const int64_t AVX512CD = (1 << 7);
+  static const int64_t AVX512VL = (1 << 8);
+  static const int64_t AVX512DQ = (1 << 9);
+  static const int64_t AVX512BW = (1 << 10);
+
+  /// The AVX-512 subsets required for AVX-512 code paths
+  static const int64_t AVX512 = AVX512F | AVX512CD | AVX512VL | AVX512DQ | AVX512BW;
 
   /// Cache enums for L1 (data), L2 and L3
   enum CacheLevel {
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <tuple>
 
@@ -382,4 +383,98 @@ TEST(Decimal128Test, TestNoDecimalPointExponential) {
   ASSERT_EQ(0, scale);
 }
 
+TEST(Decimal128Test, DivisionOf64BitValues) {
+  Decimal128 result, remainder;
+  ASSERT_OK(Decimal128(-21).Divide(5, &result, &remainder));
+  ASSERT_EQ(-4, result);
+  ASSERT_EQ(-1, remainder);
+  ASSERT_OK(Decimal128(21).Divide(-5, &result, &remainder));
+  ASSERT_EQ(-4, result);
+  ASSERT_EQ(1, remainder);
+  ASSERT_RAISES(Invalid, Decimal128(21).Divide(0, &result, &remainder));
+
+  // The quotient does not fit in 64 bits
+  const int64_t min_value = std::numeric_limits<int64_t>::min();
+  ASSERT_OK(Decimal128(min_value).Divide(-1, &result, &remainder));
+  ASSERT_EQ(Decimal128(0, static_cast<uint64_t>(min_value)), result);
+  ASSERT_EQ(0, remainder);
+}
+
+TEST(Decimal128Test, ToStringIntoBuffer) {
+  char buffer[Decimal128::kMaxStringLength];
+  const Decimal128 value("-170141183460469231731687303715884105728");
+  for (int32_t scale : {0, 2, 38, 45, -3}) {
+    const int32_t length = value.ToString(scale, buffer);
+    ASSERT_EQ(value.ToString(scale), std::string(buffer, length));
+  }
+  ASSERT_EQ("-1.70141183460469231731687303715884105728E+41", value.ToString(-3));
+  ASSERT_EQ("0.00", Decimal128(0).ToString(2));
+  ASSERT_EQ("-0.05", Decimal128(-5).ToString(2));
+  ASSERT_EQ("1000000000.000000000", Decimal128("1000000000000000000").ToString(9));
+}
+
+TEST(Decimal128Test, FromStringInPlace) {
+  const std::string text = "12.345|-0.5";
+  Decimal128 value;
+  int32_t precision, scale;
+  ASSERT_OK(Decimal128::FromString(text.data(), 6, &value, &precision, &scale));
+  ASSERT_EQ(12345, value);
+  ASSERT_EQ(5, precision);
+  ASSERT_EQ(3, scale);
+  ASSERT_OK(Decimal128::FromString(text.data() + 7, 4, &value, &precision, &scale));
+  ASSERT_EQ(-5, value);
+  ASSERT_EQ(1, precision);
+  ASSERT_EQ(1, scale);
+
+  ASSERT_OK(Decimal128::FromString("0.", &value, &precision, &scale));
+  ASSERT_EQ(0, value);
+  ASSERT_RAISES(Invalid, Decimal128::FromString("1.5e", &value));
+  ASSERT_RAISES(Invalid, Decimal128::FromString("1e99999999999", &value, nullptr,
+                                                &scale));
+  ASSERT_RAISES(Invalid, Decimal128::FromString("1e50", &value, nullptr, &scale));
+}
+
+TEST(Decimal128Test, Rescale) {
+  Decimal128 out;
+  ASSERT_OK(Decimal128(12345).Rescale(2, 5, &out));
+  ASSERT_EQ(12345000, out);
+  ASSERT_OK(Decimal128(-12300).Rescale(4, 2, &out));
+  ASSERT_EQ(-123, out);
+  ASSERT_RAISES(Invalid, Decimal128(12345).Rescale(4, 2, &out));
+
+  // The result needs more than 64 bits
+  ASSERT_OK(Decimal128(std::numeric_limits<int64_t>::max()).Rescale(0, 2, &out));
+  ASSERT_EQ(Decimal128("922337203685477580700"), out);
+  ASSERT_OK(Decimal128(std::numeric_limits<int64_t>::min()).Rescale(0, 2, &out));
+  ASSERT_EQ(Decimal128("-922337203685477580800"), out);
+}
+
+TEST(Decimal128Test, RealConversions) {
+  Decimal128 out;
+  ASSERT_OK(Decimal128::FromReal(12.345, 10, 2, &out));
+  ASSERT_EQ(1235, out);
+  ASSERT_OK(Decimal128::FromReal(-0.5, 3, 1, &out));
+  ASSERT_EQ(-5, out);
+  ASSERT_OK(Decimal128::FromReal(-1e30, 38, 0, &out));
+  ASSERT_EQ(Decimal128("-1000000000000000019884624838656"), out);
+  ASSERT_RAISES(Invalid, Decimal128::FromReal(1000, 3, 0, &out));
+  ASSERT_RAISES(Invalid,
+                Decimal128::FromReal(std::numeric_limits<double>::quiet_NaN(), 10, 0,
+                                     &out));
+
+  ASSERT_EQ(12.34, Decimal128(1234).ToDouble(2));
+  ASSERT_EQ(-1e30, Decimal128("-1000000000000000019884624838656").ToDouble(0));
+  ASSERT_EQ(5000, Decimal128(5).ToDouble(-3));
+}
+
+TEST(Decimal128Test, FitsInPrecision) {
+  ASSERT_TRUE(Decimal128(999).FitsInPrecision(3));
+  ASSERT_TRUE(Decimal128(-999).FitsInPrecision(3));
+  ASSERT_FALSE(Decimal128(1000).FitsInPrecision(3));
+  ASSERT_FALSE(Decimal128(-1000).FitsInPrecision(3));
+  ASSERT_TRUE(Decimal128("99999999999999999999999999999999999999").FitsInPrecision(38));
+  ASSERT_FALSE(
+      Decimal128("100000000000000000000000000000000000000").FitsInPrecision(38));
+}
+
 }  // namespace arrow
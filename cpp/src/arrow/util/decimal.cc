@@ -19,12 +19,9 @@
 #include <cctype>
 #include <cmath>
 #include <cstring>
-#include <iomanip>
 #include <limits>
 #include <sstream>
 
-#include <boost/regex.hpp>
-
 #include "arrow/util/bit-util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
@@ -32,7 +29,7 @@
 namespace arrow {
 
 static const Decimal128 ScaleMultipliers[] = {
-    Decimal128(0LL),
+    Decimal128(1LL),
     Decimal128(10LL),
     Decimal128(100LL),
     Decimal128(1000LL),
@@ -97,47 +94,63 @@ void Decimal128::ToBytes(uint8_t* out) const {
   reinterpret_cast<int64_t*>(out)[1] = BitUtil::ToLittleEndian(high_bits_);
 }
 
-static constexpr Decimal128 kTenTo36(static_cast<int64_t>(0xC097CE7BC90715),
-                                     0xB34B9F1000000000);
-static constexpr Decimal128 kTenTo18(0xDE0B6B3A7640000);
-
-std::string Decimal128::ToIntegerString() const {
-  Decimal128 remainder;
-  std::stringstream buf;
-  bool need_fill = false;
-
-  // get anything above 10 ** 36 and print it
-  Decimal128 top;
-  Status s = Divide(kTenTo36, &top, &remainder);
-  DCHECK(s.ok()) << s.message();
-
-  if (top != 0) {
-    buf << static_cast<int64_t>(top);
-    remainder.Abs();
-    need_fill = true;
-  }
-
-  // now get anything above 10 ** 18 and print it
-  Decimal128 tail;
-  s = remainder.Divide(kTenTo18, &top, &tail);
-
-  if (need_fill || top != 0) {
-    if (need_fill) {
-      buf << std::setw(18) << std::setfill('0');
-    } else {
-      need_fill = true;
-      tail.Abs();
+constexpr int32_t Decimal128::kMaxStringLength;
+
+/// Divide a magnitude in 32-bit words, the most significant first, by 10**9
+/// in place and return the remainder
+static uint32_t DivideByBillion(uint32_t* words, int num_words) {
+  uint64_t remainder = 0;
+  for (int i = 0; i < num_words; ++i) {
+    remainder = (remainder << 32) | words[i];
+    words[i] = static_cast<uint32_t>(remainder / 1000000000);
+    remainder %= 1000000000;
+  }
+  return static_cast<uint32_t>(remainder);
+}
+
+/// Write the decimal digits of the magnitude of value to out, at most 39,
+/// and return their number. Digits are produced 9 at a time with 64-bit
+/// divisions until the rest fits in 64 bits, rather than with 128-bit
+/// divisions by 10**18.
+static int32_t FormatMagnitude(const Decimal128& value, char* out) {
+  uint64_t high = static_cast<uint64_t>(value.high_bits());
+  uint64_t low = value.low_bits();
+  if (value.high_bits() < 0) {
+    low = ~low + 1;
+    high = ~high + (low == 0 ? 1 : 0);
+  }
+
+  char buffer[40];
+  char* const end = buffer + sizeof(buffer);
+  char* p = end;
+  uint32_t words[4] = {static_cast<uint32_t>(high >> 32), static_cast<uint32_t>(high),
+                       static_cast<uint32_t>(low >> 32), static_cast<uint32_t>(low)};
+  while (words[0] != 0 || words[1] != 0) {
+    uint32_t chunk = DivideByBillion(words, 4);
+    for (int i = 0; i < 9; ++i) {
+      *--p = static_cast<char>('0' + chunk % 10);
+      chunk /= 10;
     }
-
-    buf << static_cast<int64_t>(top);
   }
+  uint64_t rest = (static_cast<uint64_t>(words[2]) << 32) | words[3];
+  do {
+    *--p = static_cast<char>('0' + rest % 10);
+    rest /= 10;
+  } while (rest != 0);
 
-  // finally print the tail, which is less than 10**18
-  if (need_fill) {
-    buf << std::setw(18) << std::setfill('0');
+  const auto length = static_cast<int32_t>(end - p);
+  std::memcpy(out, p, static_cast<size_t>(length));
+  return length;
+}
+
+std::string Decimal128::ToIntegerString() const {
+  char buffer[kMaxStringLength];
+  char* p = buffer;
+  if (high_bits_ < 0) {
+    *p++ = '-';
   }
-  buf << static_cast<int64_t>(tail);
-  return buf.str();
+  p += FormatMagnitude(*this, p);
+  return std::string(buffer, p);
 }
 
 Decimal128::operator int64_t() const {
@@ -148,64 +161,63 @@ Decimal128::operator int64_t() const {
   return static_cast<int64_t>(low_bits_);
 }
 
-static std::string ToStringNegativeScale(const std::string& str,
-                                         int32_t adjusted_exponent, bool is_negative) {
-  std::stringstream buf;
-
-  size_t offset = 0;
-  buf << str[offset++];
-
-  if (is_negative) {
-    buf << str[offset++];
-  }
-
-  buf << '.' << str.substr(offset, std::string::npos) << 'E' << std::showpos
-      << adjusted_exponent;
-  return buf.str();
+std::string Decimal128::ToString(int32_t scale) const {
+  char buffer[kMaxStringLength];
+  return std::string(buffer, static_cast<size_t>(ToString(scale, buffer)));
 }
 
-std::string Decimal128::ToString(int32_t scale) const {
-  const std::string str(ToIntegerString());
+int32_t Decimal128::ToString(int32_t scale, char* out) const {
+  char digits[40];
+  const int32_t num_digits = FormatMagnitude(*this, digits);
 
+  char* p = out;
+  if (high_bits_ < 0) {
+    *p++ = '-';
+  }
   if (scale == 0) {
-    return str;
+    std::memcpy(p, digits, static_cast<size_t>(num_digits));
+    return static_cast<int32_t>(p - out) + num_digits;
   }
 
-  const bool is_negative = *this < 0;
-
-  const auto len = static_cast<int32_t>(str.size());
-  const auto is_negative_offset = static_cast<int32_t>(is_negative);
-  const int32_t adjusted_exponent = -scale + (len - 1 - is_negative_offset);
+  const int64_t adjusted_exponent = -static_cast<int64_t>(scale) + num_digits - 1;
 
   /// Note that the -6 is taken from the Java BigDecimal documentation.
   if (scale < 0 || adjusted_exponent < -6) {
-    return ToStringNegativeScale(str, adjusted_exponent, is_negative);
-  }
-
-  if (is_negative) {
-    if (len - 1 > scale) {
-      const auto n = static_cast<size_t>(len - scale);
-      return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
-    }
-
-    if (len - 1 == scale) {
-      return "-0." + str.substr(1, std::string::npos);
-    }
-
-    std::string result("-0." + std::string(static_cast<size_t>(scale - len + 1), '0'));
-    return result + str.substr(1, std::string::npos);
-  }
-
-  if (len > scale) {
-    const auto n = static_cast<size_t>(len - scale);
-    return str.substr(0, n) + "." + str.substr(n, static_cast<size_t>(scale));
-  }
-
-  if (len == scale) {
-    return "0." + str;
+    *p++ = digits[0];
+    *p++ = '.';
+    std::memcpy(p, digits + 1, static_cast<size_t>(num_digits - 1));
+    p += num_digits - 1;
+    *p++ = 'E';
+    *p++ = adjusted_exponent < 0 ? '-' : '+';
+    char exponent[20];
+    char* const exponent_end = exponent + sizeof(exponent);
+    char* e = exponent_end;
+    uint64_t magnitude = static_cast<uint64_t>(std::abs(adjusted_exponent));
+    do {
+      *--e = static_cast<char>('0' + magnitude % 10);
+      magnitude /= 10;
+    } while (magnitude != 0);
+    std::memcpy(p, e, static_cast<size_t>(exponent_end - e));
+    p += exponent_end - e;
+    return static_cast<int32_t>(p - out);
+  }
+
+  if (num_digits > scale) {
+    const int32_t whole_digits = num_digits - scale;
+    std::memcpy(p, digits, static_cast<size_t>(whole_digits));
+    p += whole_digits;
+    *p++ = '.';
+    std::memcpy(p, digits + whole_digits, static_cast<size_t>(scale));
+    p += scale;
+  } else {
+    *p++ = '0';
+    *p++ = '.';
+    std::memset(p, '0', static_cast<size_t>(scale - num_digits));
+    p += scale - num_digits;
+    std::memcpy(p, digits, static_cast<size_t>(num_digits));
+    p += num_digits;
   }
-
-  return "0." + std::string(static_cast<size_t>(scale - len), '0') + str;
+  return static_cast<int32_t>(p - out);
 }
 
 static constexpr auto kInt64DecimalDigits =
@@ -230,140 +242,155 @@ static constexpr int64_t kPowersOfTen[kInt64DecimalDigits + 1] = {1LL,
                                                                   100000000000000000LL,
                                                                   1000000000000000000LL};
 
-static void StringToInteger(const std::string& str, Decimal128* out) {
-  using std::size_t;
-
-  DCHECK_NE(out, nullptr) << "Decimal128 output variable cannot be nullptr";
-  DCHECK_EQ(*out, 0)
-      << "When converting a string to Decimal128 the initial output must be 0";
-
-  const size_t length = str.length();
-
-  DCHECK_GT(length, 0) << "length of parsed decimal string should be greater than 0";
-
+/// Append decimal digits to the value of out, 18 at a time so that the
+/// digits are accumulated in 64-bit arithmetic
+static void ShiftAndAdd(const char* digits, size_t length, Decimal128* out) {
   for (size_t posn = 0; posn < length;) {
     const size_t group = std::min(kInt64DecimalDigits, length - posn);
-    const int64_t chunk = std::stoll(str.substr(posn, group));
-    const int64_t multiple = kPowersOfTen[group];
-
-    *out *= multiple;
-    *out += chunk;
-
+    int64_t chunk = 0;
+    for (size_t i = 0; i < group; ++i) {
+      chunk = chunk * 10 + (digits[posn + i] - '0');
+    }
+    if (*out == 0) {
+      *out = chunk;
+    } else {
+      *out *= kPowersOfTen[group];
+      *out += chunk;
+    }
     posn += group;
   }
 }
 
-static const boost::regex DECIMAL_REGEX(
-    // sign of the number
-    "(?<SIGN>[-+]?)"
+namespace {
 
-    // digits around the decimal point
-    "(((?<LEFT_DIGITS>\\d+)\\.(?<FIRST_RIGHT_DIGITS>\\d*)|\\.(?<SECOND_RIGHT_DIGITS>\\d+)"
-    ")"
+/// The parts of a decimal string: [-+]digits[.digits][(e|E)[-+]digits], where
+/// either the whole or the fractional digits can be omitted, but not both
+struct DecimalComponents {
+  const char* whole_digits = NULLPTR;
+  size_t whole_digits_length = 0;
+  const char* fractional_digits = NULLPTR;
+  size_t fractional_digits_length = 0;
+  bool is_negative = false;
+  bool has_exponent = false;
+  int32_t exponent = 0;
+};
 
-    // optional exponent
-    "([eE](?<FIRST_EXP_VALUE>[-+]?\\d+))?"
-
-    // otherwise
-    "|"
-
-    // we're just an integer
-    "(?<INTEGER>\\d+)"
+size_t SkipDigits(const char* s, size_t start, size_t length) {
+  while (start < length && s[start] >= '0' && s[start] <= '9') {
+    ++start;
+  }
+  return start;
+}
 
-    // or an integer with an exponent
-    "(?:[eE](?<SECOND_EXP_VALUE>[-+]?\\d+))?)");
+bool ParseDecimalComponents(const char* s, size_t length, DecimalComponents* out) {
+  size_t pos = 0;
+  if (pos < length && (s[pos] == '-' || s[pos] == '+')) {
+    out->is_negative = s[pos] == '-';
+    ++pos;
+  }
 
-static inline bool is_zero_character(char c) { return c == '0'; }
+  out->whole_digits = s + pos;
+  const size_t whole_end = SkipDigits(s, pos, length);
+  out->whole_digits_length = whole_end - pos;
+  pos = whole_end;
 
-Status Decimal128::FromString(const std::string& s, Decimal128* out, int32_t* precision,
-                              int32_t* scale) {
-  if (s.empty()) {
-    return Status::Invalid("Empty string cannot be converted to decimal");
+  if (pos < length && s[pos] == '.') {
+    ++pos;
+    out->fractional_digits = s + pos;
+    const size_t fractional_end = SkipDigits(s, pos, length);
+    out->fractional_digits_length = fractional_end - pos;
+    pos = fractional_end;
+  }
+  if (out->whole_digits_length == 0 && out->fractional_digits_length == 0) {
+    return false;
   }
 
-  // case of all zeros
-  if (std::all_of(s.cbegin(), s.cend(), is_zero_character)) {
-    if (precision != nullptr) {
-      *precision = 0;
+  if (pos < length && (s[pos] == 'e' || s[pos] == 'E')) {
+    ++pos;
+    bool negative_exponent = false;
+    if (pos < length && (s[pos] == '-' || s[pos] == '+')) {
+      negative_exponent = s[pos] == '-';
+      ++pos;
     }
-
-    if (scale != nullptr) {
-      *scale = 0;
+    const size_t exponent_end = SkipDigits(s, pos, length);
+    if (exponent_end == pos) {
+      return false;
     }
-
-    *out = 0;
-    return Status::OK();
-  }
-
-  boost::smatch results;
-  const bool matches = boost::regex_match(s, results, DECIMAL_REGEX);
-
-  if (!matches) {
-    std::stringstream ss;
-    ss << "The string " << s << " is not a valid decimal number";
-    return Status::Invalid(ss.str());
+    int64_t exponent = 0;
+    for (; pos < exponent_end; ++pos) {
+      exponent = exponent * 10 + (s[pos] - '0');
+      if (exponent > std::numeric_limits<int32_t>::max()) {
+        return false;
+      }
+    }
+    out->has_exponent = true;
+    out->exponent = static_cast<int32_t>(negative_exponent ? -exponent : exponent);
   }
+  return pos == length;
+}
 
-  const std::string sign = results["SIGN"];
-  const std::string integer = results["INTEGER"];
-
-  const std::string left_digits = results["LEFT_DIGITS"];
-  const std::string first_right_digits = results["FIRST_RIGHT_DIGITS"];
-
-  const std::string second_right_digits = results["SECOND_RIGHT_DIGITS"];
+}  // namespace
 
-  const std::string first_exp_value = results["FIRST_EXP_VALUE"];
-  const std::string second_exp_value = results["SECOND_EXP_VALUE"];
+Status Decimal128::FromString(const std::string& s, Decimal128* out, int32_t* precision,
+                              int32_t* scale) {
+  return FromString(s.data(), s.size(), out, precision, scale);
+}
 
-  std::string whole_part;
-  std::string fractional_part;
-  std::string exponent_value;
+Status Decimal128::FromString(const char* s, size_t length, Decimal128* out,
+                              int32_t* precision, int32_t* scale) {
+  if (length == 0) {
+    return Status::Invalid("Empty string cannot be converted to decimal");
+  }
 
-  if (!integer.empty()) {
-    whole_part = integer;
-  } else if (!left_digits.empty()) {
-    DCHECK(second_right_digits.empty()) << s << " " << second_right_digits;
-    whole_part = left_digits;
-    fractional_part = first_right_digits;
-  } else {
-    DCHECK(first_right_digits.empty()) << s << " " << first_right_digits;
-    fractional_part = second_right_digits;
+  DecimalComponents dec;
+  if (!ParseDecimalComponents(s, length, &dec)) {
+    std::stringstream ss;
+    ss << "The string " << std::string(s, length) << " is not a valid decimal number";
+    return Status::Invalid(ss.str());
   }
 
   // skip leading zeros before the decimal point
-  std::string::const_iterator without_leading_zeros =
-      std::find_if_not(whole_part.cbegin(), whole_part.cend(), is_zero_character);
-  whole_part = std::string(without_leading_zeros, whole_part.cend());
-
-  if (!first_exp_value.empty()) {
-    exponent_value = first_exp_value;
-  } else {
-    exponent_value = second_exp_value;
+  while (dec.whole_digits_length > 0 && dec.whole_digits[0] == '0') {
+    ++dec.whole_digits;
+    --dec.whole_digits_length;
   }
 
+  const auto num_digits =
+      static_cast<int32_t>(dec.whole_digits_length + dec.fractional_digits_length);
   if (precision != nullptr) {
-    *precision = static_cast<int32_t>(whole_part.size() + fractional_part.size());
+    *precision = num_digits;
   }
 
   if (scale != nullptr) {
-    if (!exponent_value.empty()) {
-      auto adjusted_exponent = static_cast<int32_t>(std::stol(exponent_value));
-      auto len = static_cast<int32_t>(whole_part.size() + fractional_part.size());
-      *scale = -adjusted_exponent + len - 1;
+    if (dec.has_exponent) {
+      const int64_t parsed_scale = -static_cast<int64_t>(dec.exponent) + num_digits - 1;
+      if (parsed_scale < std::numeric_limits<int32_t>::min() ||
+          parsed_scale > std::numeric_limits<int32_t>::max()) {
+        std::stringstream ss;
+        ss << "The exponent of " << std::string(s, length) << " is out of range";
+        return Status::Invalid(ss.str());
+      }
+      *scale = static_cast<int32_t>(parsed_scale);
     } else {
-      *scale = static_cast<int32_t>(fractional_part.size());
+      *scale = static_cast<int32_t>(dec.fractional_digits_length);
     }
   }
 
   if (out != nullptr) {
     *out = 0;
-    StringToInteger(whole_part + fractional_part, out);
-    if (sign == "-") {
+    ShiftAndAdd(dec.whole_digits, dec.whole_digits_length, out);
+    ShiftAndAdd(dec.fractional_digits, dec.fractional_digits_length, out);
+    if (dec.is_negative) {
       out->Negate();
     }
 
     if (scale != nullptr && *scale < 0) {
       const int32_t abs_scale = std::abs(*scale);
+      if (abs_scale > 38) {
+        std::stringstream ss;
+        ss << "The exponent of " << std::string(s, length) << " is out of range";
+        return Status::Invalid(ss.str());
+      }
       *out *= ScaleMultipliers[abs_scale];
 
       if (precision != nullptr) {
@@ -376,6 +403,80 @@ Status Decimal128::FromString(const std::string& s, Decimal128* out, int32_t* pr
   return Status::OK();
 }
 
+/// Return 10 to the power of exponent as a double, exactly up to 10**22
+static double PowerOfTen(int32_t exponent) {
+  static constexpr double kDoublePowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11, 1e12,
+      1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22, 1e23, 1e24, 1e25,
+      1e26, 1e27, 1e28, 1e29, 1e30, 1e31, 1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38};
+  if (exponent >= 0 && exponent <= 38) {
+    return kDoublePowersOfTen[exponent];
+  }
+  return std::pow(10.0, exponent);
+}
+
+static constexpr double kTwoTo63 = 9223372036854775808.0;
+static constexpr double kTwoTo64 = 18446744073709551616.0;
+
+Status Decimal128::FromReal(double real, int32_t precision, int32_t scale,
+                            Decimal128* out) {
+  DCHECK_GE(precision, 1);
+  DCHECK_LE(precision, 38);
+
+  const double scaled =
+      std::round(scale >= 0 ? real * PowerOfTen(scale) : real / PowerOfTen(-scale));
+  if (!(std::abs(scaled) < PowerOfTen(precision))) {
+    std::stringstream ss;
+    ss << "Cannot convert " << real << " to a decimal of precision " << precision
+       << " and scale " << scale;
+    return Status::Invalid(ss.str());
+  }
+
+  // Most values fit in 64 bits
+  if (std::abs(scaled) < kTwoTo63) {
+    *out = static_cast<int64_t>(scaled);
+    return Status::OK();
+  }
+  const double magnitude = std::abs(scaled);
+  const double high = std::floor(magnitude / kTwoTo64);
+  const double low = magnitude - high * kTwoTo64;
+  *out = Decimal128(static_cast<int64_t>(high), static_cast<uint64_t>(low));
+  if (scaled < 0) {
+    out->Negate();
+  }
+  return Status::OK();
+}
+
+double Decimal128::ToDouble(int32_t scale) const {
+  double x;
+  if (FitsInInt64()) {
+    x = static_cast<double>(static_cast<int64_t>(low_bits_));
+  } else {
+    // The magnitude of the minimum value is its bit pattern read as unsigned
+    Decimal128 magnitude(*this);
+    magnitude.Abs();
+    x = static_cast<double>(static_cast<uint64_t>(magnitude.high_bits_)) * kTwoTo64 +
+        static_cast<double>(magnitude.low_bits_);
+    if (high_bits_ < 0) {
+      x = -x;
+    }
+  }
+  return scale >= 0 ? x / PowerOfTen(scale) : x * PowerOfTen(-scale);
+}
+
+bool Decimal128::FitsInPrecision(int32_t precision) const {
+  DCHECK_GE(precision, 1);
+  DCHECK_LE(precision, 38);
+  const Decimal128& bound = ScaleMultipliers[precision];
+  return *this < bound && -bound < *this;
+}
+
+const Decimal128& Decimal128::GetScaleMultiplier(int32_t scale) {
+  DCHECK_GE(scale, 0);
+  DCHECK_LE(scale, 38);
+  return ScaleMultipliers[scale];
+}
+
 Decimal128& Decimal128::Negate() {
   low_bits_ = ~low_bits_ + 1;
   high_bits_ = ~high_bits_;
@@ -647,6 +748,21 @@ static Status SingleDivide(const uint32_t* dividend, int64_t dividend_length,
 
 Status Decimal128::Divide(const Decimal128& divisor, Decimal128* result,
                           Decimal128* remainder) const {
+  // Most values fit in 64 bits, and are divided with a single instruction.
+  // The quotient of the minimum int64_t by -1 does not fit
+  if (FitsInInt64() && divisor.FitsInInt64()) {
+    const auto dividend64 = static_cast<int64_t>(low_bits_);
+    const auto divisor64 = static_cast<int64_t>(divisor.low_bits_);
+    if (divisor64 == 0) {
+      return Status::Invalid("Division by 0 in Decimal128");
+    }
+    if (dividend64 != std::numeric_limits<int64_t>::min() || divisor64 != -1) {
+      *result = dividend64 / divisor64;
+      *remainder = dividend64 % divisor64;
+      return Status::OK();
+    }
+  }
+
   // Split the dividend and divisor into integer pieces so that we can
   // work on them.
   uint32_t dividend_array[5];
@@ -831,7 +947,7 @@ static bool RescaleWouldCauseDataLoss(const Decimal128& value, int32_t delta_sca
   }
 
   *result = value * multiplier;
-  return *result < value;
+  return (value < 0) ? *result > value : *result < value;
 }
 
 Status Decimal128::Rescale(int32_t original_scale, int32_t new_scale,
@@ -845,6 +961,25 @@ Status Decimal128::Rescale(int32_t original_scale, int32_t new_scale,
   DCHECK_GE(abs_delta_scale, 1);
   DCHECK_LE(abs_delta_scale, 38);
 
+  // Rescale values fitting in 64 bits with 64-bit arithmetic when the result
+  // fits too. Others, and the values losing data, take the 128-bit path
+  if (abs_delta_scale <= static_cast<int32_t>(kInt64DecimalDigits) && FitsInInt64()) {
+    const auto value = static_cast<int64_t>(low_bits_);
+    const int64_t multiplier = kPowersOfTen[abs_delta_scale];
+    if (delta_scale < 0) {
+      if (value % multiplier == 0) {
+        *out = value / multiplier;
+        return Status::OK();
+      }
+    } else {
+      const int64_t max_value = std::numeric_limits<int64_t>::max() / multiplier;
+      if (value <= max_value && value >= -max_value) {
+        *out = value * multiplier;
+        return Status::OK();
+      }
+    }
+  }
+
   Decimal128 result(*this);
   const bool rescale_would_cause_data_loss =
       RescaleWouldCauseDataLoss(result, delta_scale, abs_delta_scale, out);
@@ -115,17 +115,49 @@ class ARROW_EXPORT Decimal128 {
   /// scale.
   std::string ToString(int32_t scale) const;
 
+  /// \brief Maximum number of characters written by ToString(scale, out)
+  static constexpr int32_t kMaxStringLength = 64;
+
+  /// \brief Write the ToString(scale) representation of the value to out,
+  /// which must have room for kMaxStringLength characters, without allocating.
+  /// \return the number of characters written
+  int32_t ToString(int32_t scale, char* out) const;
+
   /// \brief Convert the value to an integer string
   std::string ToIntegerString() const;
 
   /// \brief Cast this value to an int64_t.
   explicit operator int64_t() const;
 
+  /// \brief Whether the value is representable as an int64_t
+  bool FitsInInt64() const {
+    return high_bits_ == (static_cast<int64_t>(low_bits_) < 0 ? -1 : 0);
+  }
+
+  /// \brief Whether the value has at most the given number of digits, 1 to 38
+  bool FitsInPrecision(int32_t precision) const;
+
+  /// \brief Convert the value with the given scale to the nearest double
+  double ToDouble(int32_t scale) const;
+
   /// \brief Convert a decimal string to an Decimal128 value, optionally including
   /// precision and scale if they're passed in and not null.
   static Status FromString(const std::string& s, Decimal128* out,
                            int32_t* precision = NULLPTR, int32_t* scale = NULLPTR);
 
+  /// \brief Convert the length characters of s to an Decimal128 value, see
+  /// FromString(const std::string&, ...). The characters are read in place.
+  static Status FromString(const char* s, size_t length, Decimal128* out,
+                           int32_t* precision = NULLPTR, int32_t* scale = NULLPTR);
+
+  /// \brief Convert a double to the nearest Decimal128 value of the given scale,
+  /// failing if it is not finite or has more digits than precision
+  static Status FromReal(double real, int32_t precision, int32_t scale,
+                         Decimal128* out);
+
+  /// \brief Return 10 to the power of scale, 0 to 38
+  static const Decimal128& GetScaleMultiplier(int32_t scale);
+
   /// \brief Convert Decimal128 from one scale to another
   Status Rescale(int32_t original_scale, int32_t new_scale, Decimal128* out) const;
 
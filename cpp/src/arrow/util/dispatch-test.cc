@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/util/cpu-info.h"
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+static int ReturnNone() { return static_cast<int>(DispatchLevel::NONE); }
+static int ReturnSse42() { return static_cast<int>(DispatchLevel::SSE4_2); }
+static int ReturnAvx2() { return static_cast<int>(DispatchLevel::AVX2); }
+static int ReturnAvx512() { return static_cast<int>(DispatchLevel::AVX512); }
+
+struct AllLevelsDynamic {
+  using FunctionType = int (*)();
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, ReturnNone},
+            {DispatchLevel::SSE4_2, ReturnSse42},
+            {DispatchLevel::AVX2, ReturnAvx2},
+            {DispatchLevel::AVX512, ReturnAvx512}};
+  }
+};
+
+struct SomeLevelsDynamic {
+  using FunctionType = int (*)();
+
+  // Deliberately unordered
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::AVX2, ReturnAvx2}, {DispatchLevel::NONE, ReturnNone}};
+  }
+};
+
+TEST(DispatchLevel, HostLevel) {
+  const DispatchLevel level = GetMaxDispatchLevel();
+  ASSERT_LT(level, DispatchLevel::MAX);
+  ASSERT_TRUE(IsDispatchLevelSupported(DispatchLevel::NONE));
+  ASSERT_TRUE(IsDispatchLevelSupported(level));
+  ASSERT_FALSE(IsDispatchLevelSupported(DispatchLevel::MAX));
+  if (level >= DispatchLevel::AVX2) {
+    ASSERT_TRUE(CpuInfo::IsSupported(CpuInfo::AVX2));
+  }
+}
+
+TEST(DynamicDispatch, SelectsBestLevel) {
+  const DispatchLevel level = GetMaxDispatchLevel();
+
+  DynamicDispatch<AllLevelsDynamic> all_levels;
+  ASSERT_EQ(level, all_levels.level());
+  ASSERT_EQ(static_cast<int>(level), all_levels.func());
+
+  DynamicDispatch<SomeLevelsDynamic> some_levels;
+  const DispatchLevel expected =
+      level >= DispatchLevel::AVX2 ? DispatchLevel::AVX2 : DispatchLevel::NONE;
+  ASSERT_EQ(expected, some_levels.level());
+  ASSERT_EQ(static_cast<int>(expected), some_levels.func());
+}
+
+TEST(DynamicDispatch, FollowsCpuFeatures) {
+  if (!CpuInfo::IsSupported(CpuInfo::AVX2)) {
+    return;
+  }
+  const int64_t saved_flags = CpuInfo::hardware_flags();
+
+  CpuInfo::EnableFeature(CpuInfo::AVX2, false);
+  DynamicDispatch<SomeLevelsDynamic> some_levels;
+  ASSERT_EQ(DispatchLevel::NONE, some_levels.level());
+  DynamicDispatch<AllLevelsDynamic> all_levels;
+  ASSERT_LE(all_levels.level(), DispatchLevel::SSE4_2);
+
+  CpuInfo::EnableFeature(CpuInfo::AVX2, true);
+  ASSERT_EQ(saved_flags, CpuInfo::hardware_flags());
+}
+
+}  // namespace internal
+}  // namespace arrow
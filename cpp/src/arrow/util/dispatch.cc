@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/dispatch.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+#include "arrow/util/cpu-info.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+bool HasAllFlags(int64_t flags) { return (CpuInfo::hardware_flags() & flags) == flags; }
+
+DispatchLevel GetHostDispatchLevel() {
+  if (!CpuInfo::initialized()) {
+    CpuInfo::Init();
+  }
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+  if (!HasAllFlags(CpuInfo::SSE4_2 | CpuInfo::POPCNT)) {
+    return DispatchLevel::NONE;
+  }
+  if (!HasAllFlags(CpuInfo::AVX2)) {
+    return DispatchLevel::SSE4_2;
+  }
+  if (!HasAllFlags(CpuInfo::AVX512)) {
+    return DispatchLevel::AVX2;
+  }
+  return DispatchLevel::AVX512;
+#else
+  return DispatchLevel::NONE;
+#endif
+}
+
+DispatchLevel ParseUserDispatchLevel() {
+  const char* value = std::getenv("ARROW_USER_SIMD_LEVEL");
+  if (value == nullptr) {
+    return DispatchLevel::MAX;
+  }
+  std::string level(value);
+  std::transform(level.begin(), level.end(), level.begin(), ::tolower);
+  if (level == "none") {
+    return DispatchLevel::NONE;
+  } else if (level == "sse4_2") {
+    return DispatchLevel::SSE4_2;
+  } else if (level == "avx2") {
+    return DispatchLevel::AVX2;
+  } else if (level == "avx512") {
+    return DispatchLevel::AVX512;
+  }
+  ARROW_LOG(WARNING) << "Invalid value for ARROW_USER_SIMD_LEVEL: " << value;
+  return DispatchLevel::MAX;
+}
+
+}  // namespace
+
+DispatchLevel GetMaxDispatchLevel() {
+  static const DispatchLevel user_level = ParseUserDispatchLevel();
+  return std::min(GetHostDispatchLevel(), user_level);
+}
+
+bool IsDispatchLevelSupported(DispatchLevel level) {
+  return level <= GetMaxDispatchLevel();
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_DISPATCH_H
+#define ARROW_UTIL_DISPATCH_H
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
+
+// Function attributes compiling a single function for a given instruction
+// set, regardless of the flags the translation unit is compiled with. Such
+// functions must only be called after checking the corresponding
+// DispatchLevel is supported.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARROW_HAVE_RUNTIME_DISPATCH
+#define ARROW_TARGET_SSE4_2 __attribute__((target("sse4.2,popcnt")))
+#define ARROW_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define ARROW_TARGET_AVX512 \
+  __attribute__((target("avx512f,avx512cd,avx512vl,avx512dq,avx512bw,popcnt")))
+#endif
+
+namespace arrow {
+namespace internal {
+
+/// \brief Instruction set levels that kernels can provide implementations for
+///
+/// Each level implies the ones before it.
+enum class DispatchLevel : int {
+  NONE = 0,
+  // SSE4.2 and POPCNT
+  SSE4_2,
+  AVX2,
+  // AVX-512 F, CD, VL, DQ and BW
+  AVX512,
+  MAX
+};
+
+/// \brief Return the highest DispatchLevel usable on this host
+///
+/// The level can be lowered by setting the ARROW_USER_SIMD_LEVEL environment
+/// variable to one of "none", "sse4_2", "avx2" or "avx512", which is useful to
+/// test or benchmark the generic code paths.
+ARROW_EXPORT DispatchLevel GetMaxDispatchLevel();
+
+/// \brief Whether implementations for a DispatchLevel may run on this host
+ARROW_EXPORT bool IsDispatchLevelSupported(DispatchLevel level);
+
+/// \class DynamicDispatch
+/// \brief Select the best available implementation of a function
+///
+/// DynamicFunction must define a FunctionType (usually a function pointer
+/// type) and a static implementations() method returning the candidate
+/// (DispatchLevel, FunctionType) pairs, among which a DispatchLevel::NONE one.
+/// The choice is made once, on construction, so that the dispatcher is
+/// typically declared as a function-local static:
+///
+/// \code
+/// struct SumDynamic {
+///   using FunctionType = int64_t (*)(const int32_t*, int64_t);
+///   static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+///     return {{DispatchLevel::NONE, SumGeneric},
+///             {DispatchLevel::AVX2, SumAvx2}};
+///   }
+/// };
+///
+/// int64_t Sum(const int32_t* values, int64_t length) {
+///   static DynamicDispatch<SumDynamic> dispatch;
+///   return dispatch.func(values, length);
+/// }
+/// \endcode
+template <typename DynamicFunction>
+class DynamicDispatch {
+ protected:
+  using FunctionType = typename DynamicFunction::FunctionType;
+  using Implementation = std::pair<DispatchLevel, FunctionType>;
+
+ public:
+  DynamicDispatch() { Resolve(DynamicFunction::implementations()); }
+
+  /// The selected implementation
+  FunctionType func = {};
+
+  /// The DispatchLevel of the selected implementation
+  DispatchLevel level() const { return level_; }
+
+ protected:
+  void Resolve(const std::vector<Implementation>& implementations) {
+    bool found = false;
+    for (const auto& impl : implementations) {
+      if (IsDispatchLevelSupported(impl.first) && (!found || impl.first > level_)) {
+        func = impl.second;
+        level_ = impl.first;
+        found = true;
+      }
+    }
+    DCHECK(found) << "No implementation supported on this host";
+  }
+
+  DispatchLevel level_ = DispatchLevel::NONE;
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_DISPATCH_H
@@ -17,8 +17,19 @@
 
 #include "arrow/util/hash.h"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/hash-util.h"
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+#include <nmmintrin.h>
+#endif
 
 namespace arrow {
 namespace internal {
@@ -34,5 +45,200 @@ Status NewHashTable(int64_t size, MemoryPool* pool, std::shared_ptr<Buffer>* out
   return Status::OK();
 }
 
+namespace {
+
+template <typename T>
+inline T LoadValue(const uint8_t* data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+// Multilinear hashing of 32-bit words, whose high half is strongly universal
+// (see Lemire and Kaser, "Strongly universal string hashing is fast"). Unlike
+// CRC32 it only involves multiplications and additions, which vectorize.
+constexpr uint64_t kMultiplyShiftAdd = 0x705495c62df1424aULL;
+constexpr uint64_t kMultiplyShiftMultiplier1 = 0x47b6137a44974d91ULL;
+constexpr uint64_t kMultiplyShiftMultiplier2 = 0x8824ad5ba2b7289cULL;
+
+inline uint32_t MultiplyShift(uint32_t value) {
+  return static_cast<uint32_t>((kMultiplyShiftAdd + kMultiplyShiftMultiplier1 * value) >>
+                               32);
+}
+
+inline uint32_t MultiplyShift(uint64_t value) {
+  return static_cast<uint32_t>(
+      (kMultiplyShiftAdd + kMultiplyShiftMultiplier1 * static_cast<uint32_t>(value) +
+       kMultiplyShiftMultiplier2 * (value >> 32)) >>
+      32);
+}
+
+inline uint32_t MurmurHashBytes(const uint8_t* data, int64_t length) {
+  return static_cast<uint32_t>(
+      HashUtil::MurmurHash2_64(data, static_cast<int>(length), 0));
+}
+
+#define MULTIPLY_SHIFT_LOOP(SUFFIX, TARGET_ATTR)                                         \
+  template <typename T, typename Word>                                                   \
+  TARGET_ATTR void MultiplyShiftValues##SUFFIX(const uint8_t* values, int64_t length,    \
+                                               uint32_t* out) {                          \
+    for (int64_t i = 0; i < length; ++i) {                                               \
+      out[i] = MultiplyShift(static_cast<Word>(LoadValue<T>(values + i * sizeof(T)))); \
+    }                                                                                    \
+  }                                                                                      \
+                                                                                         \
+  TARGET_ATTR void MultiplyShiftFixedWidth##SUFFIX(const uint8_t* values,                \
+                                                   int32_t byte_width, int64_t length,   \
+                                                   uint32_t* out) {                      \
+    switch (byte_width) {                                                                \
+      case 1:                                                                            \
+        return MultiplyShiftValues##SUFFIX<uint8_t, uint32_t>(values, length, out);      \
+      case 2:                                                                            \
+        return MultiplyShiftValues##SUFFIX<uint16_t, uint32_t>(values, length, out);     \
+      case 4:                                                                            \
+        return MultiplyShiftValues##SUFFIX<uint32_t, uint32_t>(values, length, out);     \
+      case 8:                                                                            \
+        return MultiplyShiftValues##SUFFIX<uint64_t, uint64_t>(values, length, out);     \
+      default:                                                                           \
+        break;                                                                           \
+    }                                                                                    \
+    for (int64_t i = 0; i < length; ++i) {                                               \
+      out[i] = MurmurHashBytes(values + i * byte_width, byte_width);                     \
+    }                                                                                    \
+  }
+
+MULTIPLY_SHIFT_LOOP(Default, )
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+MULTIPLY_SHIFT_LOOP(Avx2, ARROW_TARGET_AVX2)
+#endif
+
+#undef MULTIPLY_SHIFT_LOOP
+
+void HashBinaryDefault(const int32_t* offsets, const uint8_t* data, int64_t length,
+                       uint32_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = MurmurHashBytes(data + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+}
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+
+// The lower half of CRC32 hashes has poor uniformity, so the halves are swapped
+// for callers using the lower bits as a hash table index
+ARROW_TARGET_SSE4_2 inline uint32_t FinishCrc(uint64_t crc) {
+  const uint32_t hash = static_cast<uint32_t>(crc);
+  return (hash << 16) | (hash >> 16);
+}
+
+ARROW_TARGET_SSE4_2 inline uint32_t CrcHashBytes(const uint8_t* data, int64_t length) {
+  // Seed with the length, as leading zero bytes do not change a zero CRC
+  uint64_t crc = static_cast<uint32_t>(length);
+  for (; length >= 8; data += 8, length -= 8) {
+    crc = _mm_crc32_u64(crc, LoadValue<uint64_t>(data));
+  }
+  if (length >= 4) {
+    crc = _mm_crc32_u32(static_cast<uint32_t>(crc), LoadValue<uint32_t>(data));
+    data += 4;
+    length -= 4;
+  }
+  for (; length > 0; ++data, --length) {
+    crc = _mm_crc32_u8(static_cast<uint32_t>(crc), *data);
+  }
+  return FinishCrc(crc);
+}
+
+ARROW_TARGET_SSE4_2 void CrcFixedWidth(const uint8_t* values, int32_t byte_width,
+                                       int64_t length, uint32_t* out) {
+  switch (byte_width) {
+    case 1:
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = FinishCrc(_mm_crc32_u8(0, values[i]));
+      }
+      return;
+    case 2:
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = FinishCrc(_mm_crc32_u16(0, LoadValue<uint16_t>(values + i * 2)));
+      }
+      return;
+    case 4:
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = FinishCrc(_mm_crc32_u32(0, LoadValue<uint32_t>(values + i * 4)));
+      }
+      return;
+    case 8:
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = FinishCrc(_mm_crc32_u64(0, LoadValue<uint64_t>(values + i * 8)));
+      }
+      return;
+    default:
+      break;
+  }
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = CrcHashBytes(values + i * byte_width, byte_width);
+  }
+}
+
+ARROW_TARGET_SSE4_2 void CrcBinary(const int32_t* offsets, const uint8_t* data,
+                                   int64_t length, uint32_t* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = CrcHashBytes(data + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+}
+
+// Vectorized multiply-shift hashing only beats CRC32 on values of up to 32 bits,
+// since AVX2 lacks a 64-bit multiplication
+ARROW_TARGET_AVX2 void HashFixedWidthAvx2(const uint8_t* values, int32_t byte_width,
+                                          int64_t length, uint32_t* out) {
+  if (byte_width <= 4) {
+    MultiplyShiftFixedWidthAvx2(values, byte_width, length, out);
+  } else {
+    CrcFixedWidth(values, byte_width, length, out);
+  }
+}
+
+#endif  // ARROW_HAVE_RUNTIME_DISPATCH
+
+struct HashFixedWidthDynamic {
+  using FunctionType = void (*)(const uint8_t*, int32_t, int64_t, uint32_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, MultiplyShiftFixedWidthDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, CrcFixedWidth},
+        {DispatchLevel::AVX2, HashFixedWidthAvx2},
+#endif
+    };
+  }
+};
+
+struct HashBinaryDynamic {
+  using FunctionType = void (*)(const int32_t*, const uint8_t*, int64_t, uint32_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, HashBinaryDefault},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::SSE4_2, CrcBinary},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+void HashFixedWidthValues(const uint8_t* values, int32_t byte_width, int64_t length,
+                          uint32_t* out) {
+  static DynamicDispatch<HashFixedWidthDynamic> dispatch;
+  dispatch.func(values, byte_width, length, out);
+}
+
+void HashBinaryValues(const int32_t* offsets, const uint8_t* data, int64_t length,
+                      uint32_t* out) {
+  static DynamicDispatch<HashBinaryDynamic> dispatch;
+  dispatch.func(offsets, data, length, out);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -22,6 +22,8 @@
 #include <limits>
 #include <memory>
 
+#include "arrow/util/visibility.h"
+
 namespace arrow {
 
 class Buffer;
@@ -79,6 +81,22 @@ namespace internal {
 
 Status NewHashTable(int64_t size, MemoryPool* pool, std::shared_ptr<Buffer>* out);
 
+/// \brief Compute the hashes of a block of fixed-width values
+///
+/// The hash function is selected once per process according to the host CPU
+/// (CRC32 with SSE4.2, multiply-shift hashing vectorized with AVX2 for values
+/// of up to 4 bytes, generic code otherwise), so hashes must not be persisted
+/// or compared across processes.
+ARROW_EXPORT void HashFixedWidthValues(const uint8_t* values, int32_t byte_width,
+                                       int64_t length, uint32_t* out);
+
+/// \brief Compute the hashes of a block of variable-length binary values,
+/// delimited by length + 1 offsets into data
+///
+/// The same caveats as for HashFixedWidthValues apply.
+ARROW_EXPORT void HashBinaryValues(const int32_t* offsets, const uint8_t* data,
+                                   int64_t length, uint32_t* out);
+
 }  // namespace internal
 }  // namespace arrow
 
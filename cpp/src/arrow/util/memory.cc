@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/memory.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ARROW_HAVE_STREAMING_STORES
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Copy with non-temporal stores where supported, then fence them so that they
+// are visible to the thread waiting for the copy
+void StreamingMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes) {
+#ifdef ARROW_HAVE_STREAMING_STORES
+  // Stores must be aligned on 16 bytes
+  const int64_t head =
+      std::min<int64_t>(nbytes, (16 - reinterpret_cast<uintptr_t>(dst) % 16) % 16);
+  memcpy(dst, src, head);
+  int64_t i = head;
+  for (; i + 64 <= nbytes; i += 64) {
+    const __m128i* in = reinterpret_cast<const __m128i*>(src + i);
+    __m128i* out = reinterpret_cast<__m128i*>(dst + i);
+    const __m128i a = _mm_loadu_si128(in);
+    const __m128i b = _mm_loadu_si128(in + 1);
+    const __m128i c = _mm_loadu_si128(in + 2);
+    const __m128i d = _mm_loadu_si128(in + 3);
+    _mm_stream_si128(out, a);
+    _mm_stream_si128(out + 1, b);
+    _mm_stream_si128(out + 2, c);
+    _mm_stream_si128(out + 3, d);
+  }
+  memcpy(dst + i, src + i, nbytes - i);
+  _mm_sfence();
+#else
+  memcpy(dst, src, nbytes);
+#endif
+}
+
+void CopyChunk(uint8_t* dst, const uint8_t* src, int64_t nbytes, bool non_temporal) {
+  if (non_temporal) {
+    StreamingMemcopy(dst, src, nbytes);
+  } else {
+    memcpy(dst, src, nbytes);
+  }
+}
+
+}  // namespace
+
+void ParallelMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes, int num_threads,
+                     int64_t block_size) {
+  DCHECK_GT(block_size, 0);
+  DCHECK_EQ(block_size & (block_size - 1), 0) << "block size must be a power of two";
+  const bool non_temporal = nbytes >= kNonTemporalMemcopyThreshold;
+  if (num_threads <= 1 || nbytes < 2 * num_threads * block_size) {
+    CopyChunk(dst, src, nbytes, non_temporal);
+    return;
+  }
+
+  uint8_t* left = pointer_logical_and(dst + block_size - 1, ~(block_size - 1));
+  uint8_t* right = pointer_logical_and(dst + nbytes, ~(block_size - 1));
+  const int64_t num_blocks = (right - left) / block_size;
+
+  // Now we divide the blocks between the threads. The data layout is
+  // | prefix | num_threads * chunk_size | suffix |, each thread getting a
+  // chunk of k blocks, with chunk_size = k * block_size.
+  const int64_t chunk_size = (num_blocks / num_threads) * block_size;
+  const int64_t prefix = left - dst;
+  const int64_t suffix = nbytes - prefix - num_threads * chunk_size;
+
+  // Handle leftovers on the calling thread, then copy the chunks
+  // using the shared CPU thread pool
+  memcpy(dst, src, prefix);
+  CopyChunk(dst + nbytes - suffix, src + nbytes - suffix, suffix, non_temporal);
+
+  ARROW_UNUSED(ParallelFor(num_threads, num_threads, [=](int i) {
+    const int64_t offset = prefix + i * chunk_size;
+    CopyChunk(dst + offset, src + offset, chunk_size, non_temporal);
+    return Status::OK();
+  }));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -18,54 +18,33 @@
 #ifndef ARROW_UTIL_MEMORY_H
 #define ARROW_UTIL_MEMORY_H
 
-#include <thread>
-#include <vector>
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
 
-uint8_t* pointer_logical_and(const uint8_t* address, uintptr_t bits) {
+inline uint8_t* pointer_logical_and(const uint8_t* address, uintptr_t bits) {
   uintptr_t value = reinterpret_cast<uintptr_t>(address);
   return reinterpret_cast<uint8_t*>(value & bits);
 }
 
-// A helper function for doing memcpy with multiple threads. This is required
-// to saturate the memory bandwidth of modern cpus.
-void parallel_memcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes,
-                      uintptr_t block_size, int num_threads) {
-  std::vector<std::thread> threadpool(num_threads);
-  uint8_t* left = pointer_logical_and(src + block_size - 1, ~(block_size - 1));
-  uint8_t* right = pointer_logical_and(src + nbytes, ~(block_size - 1));
-  int64_t num_blocks = (right - left) / block_size;
-
-  // Update right address
-  right = right - (num_blocks % num_threads) * block_size;
-
-  // Now we divide these blocks between available threads. The remainder is
-  // handled on the main thread.
-  int64_t chunk_size = (right - left) / num_threads;
-  int64_t prefix = left - src;
-  int64_t suffix = src + nbytes - right;
-  // Now the data layout is | prefix | k * num_threads * block_size | suffix |.
-  // We have chunk_size = k * block_size, therefore the data layout is
-  // | prefix | num_threads * chunk_size | suffix |.
-  // Each thread gets a "chunk" of k blocks.
-
-  // Start all threads first and handle leftovers while threads run.
-  for (int i = 0; i < num_threads; i++) {
-    threadpool[i] = std::thread(memcpy, dst + prefix + i * chunk_size,
-                                left + i * chunk_size, chunk_size);
-  }
-
-  memcpy(dst, src, prefix);
-  memcpy(dst + prefix + num_threads * chunk_size, right, suffix);
-
-  for (auto& t : threadpool) {
-    if (t.joinable()) {
-      t.join();
-    }
-  }
-}
+/// Copies of at least this many bytes, too large to stay in the CPU caches,
+/// are made with non-temporal stores where supported
+constexpr int64_t kNonTemporalMemcopyThreshold = 1 << 22;
+
+/// \brief Copy nbytes from src to dst, which must not overlap, with up to
+/// num_threads threads of the shared CPU thread pool, the calling one included
+///
+/// Several threads are needed to saturate the memory bandwidth of modern
+/// CPUs. The destination is split into chunks aligned on block_size bytes, a
+/// power of two. Copies of at least kNonTemporalMemcopyThreshold bytes use
+/// non-temporal stores on x86, which write around the caches rather than
+/// evicting the working set of the caller for data that would not fit anyway
+ARROW_EXPORT
+void ParallelMemcopy(uint8_t* dst, const uint8_t* src, int64_t nbytes, int num_threads,
+                     int64_t block_size = 64);
 
 }  // namespace internal
 }  // namespace arrow
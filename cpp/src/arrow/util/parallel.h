@@ -18,51 +18,93 @@
 #ifndef ARROW_UTIL_PARALLEL_H
 #define ARROW_UTIL_PARALLEL_H
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <thread>
-#include <vector>
+#include <utility>
 
 #include "arrow/status.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
-template <class FUNCTION>
-Status ParallelFor(int nthreads, int num_tasks, FUNCTION&& func) {
-  std::vector<std::thread> thread_pool;
-  thread_pool.reserve(nthreads);
-  std::atomic<int> task_counter(0);
+namespace detail {
+
+// State shared between the caller of ParallelFor and its workers. Workers
+// that only get scheduled after all tasks have been claimed exit without
+// touching the caller's stack, so it is held through a shared_ptr
+struct ParallelForState {
+  explicit ParallelForState(int num_tasks)
+      : num_tasks(num_tasks), next_task(0), error_occurred(false), finished_tasks(0) {}
 
-  std::mutex error_mtx;
-  bool error_occurred = false;
+  const int num_tasks;
+  std::atomic<int> next_task;
+  std::atomic<bool> error_occurred;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  int finished_tasks;
   Status error;
+};
 
-  for (int thread_id = 0; thread_id < nthreads; ++thread_id) {
-    thread_pool.emplace_back(
-        [&num_tasks, &task_counter, &error, &error_occurred, &error_mtx, &func]() {
-          int task_id;
-          while (!error_occurred) {
-            task_id = task_counter.fetch_add(1);
-            if (task_id >= num_tasks) {
-              break;
-            }
-            Status s = func(task_id);
-            if (!s.ok()) {
-              std::lock_guard<std::mutex> lock(error_mtx);
-              error_occurred = true;
-              error = s;
-              break;
-            }
-          }
-        });
+inline void ParallelForWorker(ParallelForState* state,
+                              const std::function<Status(int)>* func) {
+  while (true) {
+    const int task_id = state->next_task.fetch_add(1);
+    if (task_id >= state->num_tasks) {
+      break;
+    }
+    // After an error, the remaining tasks are claimed but skipped
+    Status s;
+    if (!state->error_occurred.load()) {
+      s = (*func)(task_id);
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (!s.ok() && !state->error_occurred.load()) {
+      state->error_occurred.store(true);
+      state->error = s;
+    }
+    if (++state->finished_tasks == state->num_tasks) {
+      state->cv.notify_all();
+    }
   }
-  for (auto&& thread : thread_pool) {
-    thread.join();
+}
+
+}  // namespace detail
+
+/// \brief Run func(0) ... func(num_tasks - 1) using up to nthreads threads
+///
+/// Work is dispatched to the process-wide CPU thread pool; the calling
+/// thread participates as well, so nested calls from within pool tasks
+/// cannot deadlock. Returns the first error encountered, in which case tasks
+/// not yet started are skipped
+template <class FUNCTION>
+Status ParallelFor(int nthreads, int num_tasks, FUNCTION&& func) {
+  if (num_tasks <= 0) {
+    return Status::OK();
   }
-  if (error_occurred) {
-    return error;
+  const std::function<Status(int)> task_func(std::forward<FUNCTION>(func));
+  auto state = std::make_shared<detail::ParallelForState>(num_tasks);
+
+  const int num_helpers = std::min(nthreads, num_tasks) - 1;
+  auto pool = internal::GetCpuThreadPool();
+  const std::function<Status(int)>* func_ptr = &task_func;
+  for (int i = 0; i < num_helpers; ++i) {
+    Status s = pool->Spawn(
+        [state, func_ptr]() { detail::ParallelForWorker(state.get(), func_ptr); });
+    if (!s.ok()) {
+      // The pool is shutting down, the remaining tasks run on this thread
+      break;
+    }
   }
-  return Status::OK();
+  detail::ParallelForWorker(state.get(), func_ptr);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->cv.wait(lock, [&state] { return state->finished_tasks == state->num_tasks; });
+  return state->error;
 }
 
 }  // namespace arrow
@@ -0,0 +1,374 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Parsers of numbers and timestamps from text
+//
+// The parsers read the bytes of each value in place, without copying them
+// into std::string, and do not depend on the C locale
+
+#ifndef ARROW_UTIL_PARSING_H
+#define ARROW_UTIL_PARSING_H
+
+#include <algorithm>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+
+#include "arrow/type.h"
+
+namespace arrow {
+namespace internal {
+
+inline bool IsDigit(char c) { return static_cast<uint8_t>(c - '0') < 10; }
+
+// Decimal integer with an optional sign, failing on overflow
+template <typename T>
+bool ParseInteger(const char* s, int32_t length, T* out) {
+  int32_t i = 0;
+  bool negative = false;
+  if (length > 0 && (s[0] == '-' || s[0] == '+')) {
+    negative = s[0] == '-';
+    ++i;
+  }
+  if (i == length || (negative && !std::is_signed<T>::value)) {
+    return false;
+  }
+  const uint64_t limit =
+      static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+  uint64_t value = 0;
+  for (; i < length; ++i) {
+    const uint64_t digit = static_cast<uint8_t>(s[i] - '0');
+    if (digit > 9 || value > (limit - digit) / 10) {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  *out = static_cast<T>(negative ? ~value + 1 : value);
+  return true;
+}
+
+// Mantissas and powers of ten below these bounds are exact in T, so that
+// their product or quotient is correctly rounded
+template <typename T>
+struct ExactFloatBounds {};
+
+template <>
+struct ExactFloatBounds<float> {
+  static constexpr uint64_t kMaxMantissa = static_cast<uint64_t>(1) << 24;
+  static constexpr int kMaxPowerOfTen = 10;
+};
+
+template <>
+struct ExactFloatBounds<double> {
+  static constexpr uint64_t kMaxMantissa = static_cast<uint64_t>(1) << 53;
+  static constexpr int kMaxPowerOfTen = 22;
+};
+
+inline bool EqualsIgnoreCase(const char* s, int32_t length, const char* literal) {
+  const int32_t literal_length = static_cast<int32_t>(std::strlen(literal));
+  if (length != literal_length) {
+    return false;
+  }
+  for (int32_t i = 0; i < length; ++i) {
+    if ((s[i] | 0x20) != literal[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// "nan", "inf" or "infinity" with an optional sign, in any case
+template <typename T>
+bool ParseSpecialFloat(const char* s, int32_t length, T* out) {
+  bool negative = false;
+  if (length > 0 && (s[0] == '-' || s[0] == '+')) {
+    negative = s[0] == '-';
+    ++s;
+    --length;
+  }
+  if (EqualsIgnoreCase(s, length, "nan")) {
+    *out = std::numeric_limits<T>::quiet_NaN();
+  } else if (EqualsIgnoreCase(s, length, "inf") ||
+             EqualsIgnoreCase(s, length, "infinity")) {
+    *out = negative ? -std::numeric_limits<T>::infinity()
+                    : std::numeric_limits<T>::infinity();
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// strtod in the C locale, whatever the global locale
+template <typename T>
+struct StrtodClassic {};
+
+#ifdef _WIN32
+inline _locale_t GetClassicLocale() {
+  static _locale_t locale = _create_locale(LC_NUMERIC, "C");
+  return locale;
+}
+
+template <>
+struct StrtodClassic<float> {
+  static float Parse(const char* s) { return _strtof_l(s, nullptr, GetClassicLocale()); }
+};
+
+template <>
+struct StrtodClassic<double> {
+  static double Parse(const char* s) { return _strtod_l(s, nullptr, GetClassicLocale()); }
+};
+#else
+inline locale_t GetClassicLocale() {
+  static locale_t locale = newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(0));
+  return locale;
+}
+
+template <>
+struct StrtodClassic<float> {
+  static float Parse(const char* s) { return strtof_l(s, nullptr, GetClassicLocale()); }
+};
+
+template <>
+struct StrtodClassic<double> {
+  static double Parse(const char* s) { return strtod_l(s, nullptr, GetClassicLocale()); }
+};
+#endif
+
+// Decimal floating point number, e.g. "-1.5e10". Values with few enough
+// significant digits are converted exactly with a single multiplication or
+// division; the other ones are left to strtod. Out of range values fail
+template <typename T>
+bool ParseFloat(const char* s, int32_t length, T* out) {
+  using Bounds = ExactFloatBounds<T>;
+  static const double kPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                        1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                        1e18, 1e19, 1e20, 1e21, 1e22};
+
+  int32_t i = 0;
+  bool negative = false;
+  if (length > 0 && (s[0] == '-' || s[0] == '+')) {
+    negative = s[0] == '-';
+    ++i;
+  }
+
+  uint64_t mantissa = 0;
+  int num_digits = 0;
+  int exponent = 0;
+  bool has_digits = false;
+  bool truncated = false;
+  auto add_digit = [&](char c, bool in_fraction) {
+    has_digits = true;
+    if (mantissa == 0 && c == '0') {
+      exponent -= in_fraction;
+    } else if (num_digits < 19) {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+      ++num_digits;
+      exponent -= in_fraction;
+    } else {
+      truncated = true;
+      exponent += !in_fraction;
+    }
+  };
+  for (; i < length && IsDigit(s[i]); ++i) {
+    add_digit(s[i], false);
+  }
+  if (i < length && s[i] == '.') {
+    for (++i; i < length && IsDigit(s[i]); ++i) {
+      add_digit(s[i], true);
+    }
+  }
+  if (has_digits && i < length && (s[i] == 'e' || s[i] == 'E')) {
+    ++i;
+    bool negative_exponent = false;
+    if (i < length && (s[i] == '-' || s[i] == '+')) {
+      negative_exponent = s[i] == '-';
+      ++i;
+    }
+    if (i == length) {
+      return false;
+    }
+    int explicit_exponent = 0;
+    for (; i < length && IsDigit(s[i]); ++i) {
+      // Large enough exponents all overflow or underflow alike
+      explicit_exponent = std::min(explicit_exponent * 10 + (s[i] - '0'), 100000);
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+  if (!has_digits || i != length) {
+    return ParseSpecialFloat(s, length, out);
+  }
+
+  if (mantissa == 0) {
+    *out = negative ? -static_cast<T>(0) : static_cast<T>(0);
+    return true;
+  }
+  if (!truncated && mantissa <= Bounds::kMaxMantissa &&
+      exponent >= -Bounds::kMaxPowerOfTen && exponent <= Bounds::kMaxPowerOfTen) {
+    T value = static_cast<T>(mantissa);
+    const T power = static_cast<T>(kPowersOfTen[exponent < 0 ? -exponent : exponent]);
+    value = exponent < 0 ? value / power : value * power;
+    *out = negative ? -value : value;
+    return true;
+  }
+
+  // strtod needs a null-terminated string
+  char buffer[64];
+  std::string long_value;
+  const char* terminated = buffer;
+  if (length < static_cast<int32_t>(sizeof(buffer))) {
+    std::memcpy(buffer, s, length);
+    buffer[length] = '\0';
+  } else {
+    long_value.assign(s, length);
+    terminated = long_value.c_str();
+  }
+  errno = 0;
+  const T value = StrtodClassic<T>::Parse(terminated);
+  if (errno == ERANGE && std::isinf(value)) {
+    return false;
+  }
+  *out = value;
+  return true;
+}
+
+inline bool ParseFixedDigits(const char* s, int num_digits, int* out) {
+  int value = 0;
+  for (int i = 0; i < num_digits; ++i) {
+    if (!IsDigit(s[i])) {
+      return false;
+    }
+    value = value * 10 + (s[i] - '0');
+  }
+  *out = value;
+  return true;
+}
+
+inline bool IsLeapYear(int year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+inline int DaysInMonth(int year, int month) {
+  static const int kDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return month == 2 && IsLeapYear(year) ? 29 : kDays[month - 1];
+}
+
+// Number of days between 1970-01-01 and a date of the proleptic Gregorian
+// calendar
+inline int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t year_of_era = year - era * 400;
+  const int64_t month_of_year = month > 2 ? month - 3 : month + 9;
+  const int64_t day_of_year = (153 * month_of_year + 2) / 5 + day - 1;
+  const int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+// ISO 8601 timestamp "YYYY-MM-DD[(T| )hh:mm[:ss[.fraction]]][Z]" in UTC, the
+// fraction having at most the precision of unit
+inline bool ParseTimestamp(const char* s, int32_t length, TimeUnit::type unit,
+                           int64_t* out) {
+  int year, month, day;
+  if (length < 10 || s[4] != '-' || s[7] != '-' || !ParseFixedDigits(s, 4, &year) ||
+      !ParseFixedDigits(s + 5, 2, &month) || !ParseFixedDigits(s + 8, 2, &day) ||
+      month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month)) {
+    return false;
+  }
+
+  int precision = 0;
+  switch (unit) {
+    case TimeUnit::SECOND:
+      precision = 0;
+      break;
+    case TimeUnit::MILLI:
+      precision = 3;
+      break;
+    case TimeUnit::MICRO:
+      precision = 6;
+      break;
+    case TimeUnit::NANO:
+      precision = 9;
+      break;
+  }
+  int64_t units_per_second = 1;
+  for (int k = 0; k < precision; ++k) {
+    units_per_second *= 10;
+  }
+
+  int32_t i = 10;
+  int hours = 0, minutes = 0, seconds = 0;
+  int64_t fraction = 0;
+  if (i < length && (s[i] == 'T' || s[i] == ' ')) {
+    if (length < i + 6 || s[i + 3] != ':' || !ParseFixedDigits(s + i + 1, 2, &hours) ||
+        !ParseFixedDigits(s + i + 4, 2, &minutes)) {
+      return false;
+    }
+    i += 6;
+    if (i < length && s[i] == ':') {
+      if (length < i + 3 || !ParseFixedDigits(s + i + 1, 2, &seconds)) {
+        return false;
+      }
+      i += 3;
+      if (i < length && s[i] == '.') {
+        int num_digits = 0;
+        for (++i; i < length && IsDigit(s[i]); ++i, ++num_digits) {
+          if (num_digits == precision) {
+            return false;
+          }
+          fraction = fraction * 10 + (s[i] - '0');
+        }
+        if (num_digits == 0) {
+          return false;
+        }
+        for (; num_digits < precision; ++num_digits) {
+          fraction *= 10;
+        }
+      }
+    }
+    if (hours > 23 || minutes > 59 || seconds > 59) {
+      return false;
+    }
+  }
+  if (i < length && s[i] == 'Z') {
+    ++i;
+  }
+  if (i != length) {
+    return false;
+  }
+
+  const int64_t total_seconds =
+      DaysFromCivil(year, month, day) * 86400 + hours * 3600 + minutes * 60 + seconds;
+  *out = total_seconds * units_per_second + fraction;
+  return true;
+}
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_PARSING_H
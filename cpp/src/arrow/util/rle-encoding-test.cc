@@ -464,4 +464,115 @@ TEST(BitRle, Overflow) {
   }
 }
 
+// Dictionary indices with long repeated runs and stretches of literals
+vector<int> MakeDictionaryIndices(int num_values, int dictionary_size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> index_dist(0, dictionary_size - 1);
+  std::uniform_int_distribution<int> run_dist(1, 200);
+  vector<int> indices;
+  while (static_cast<int>(indices.size()) < num_values) {
+    const int run_length = run_dist(gen);
+    const bool repeated = run_length % 2 == 0;
+    const int index = index_dist(gen);
+    for (int i = 0; i < run_length; ++i) {
+      indices.push_back(repeated ? index : index_dist(gen));
+    }
+  }
+  indices.resize(num_values);
+  return indices;
+}
+
+template <typename T>
+void CheckGetBatchWithDict() {
+  const int kDictionarySize = 100;
+  const int bit_width = BitUtil::NumRequiredBits(kDictionarySize - 1);
+  vector<T> dictionary(kDictionarySize);
+  for (int i = 0; i < kDictionarySize; ++i) {
+    dictionary[i] = static_cast<T>(i * 3 + 1);
+  }
+
+  // Dense values
+  {
+    const int kNumValues = 5000;
+    const vector<int> indices = MakeDictionaryIndices(kNumValues, kDictionarySize, 42);
+    vector<uint8_t> buffer(RleEncoder::MaxBufferSize(bit_width, kNumValues));
+    RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), bit_width);
+    for (int index : indices) {
+      ASSERT_TRUE(encoder.Put(index));
+    }
+    const int encoded_len = encoder.Flush();
+
+    RleDecoder decoder(buffer.data(), encoded_len, bit_width);
+    vector<T> values(kNumValues);
+    // In several batches, so that they end in the middle of runs
+    int values_read = 0;
+    for (int batch_size : {1, 777, 1500, kNumValues}) {
+      batch_size = std::min(batch_size, kNumValues - values_read);
+      ASSERT_EQ(batch_size, decoder.GetBatchWithDict(dictionary.data(),
+                                                     values.data() + values_read,
+                                                     batch_size));
+      values_read += batch_size;
+    }
+    for (int i = 0; i < kNumValues; ++i) {
+      ASSERT_EQ(dictionary[indices[i]], values[i]) << "value " << i;
+    }
+  }
+
+  // Values spaced around nulls, with blocks of nulls and blocks without any
+  {
+    const int kNumSlots = 6000;
+    std::mt19937 gen(7);
+    vector<uint8_t> valid_bits(BitUtil::BytesForBits(kNumSlots) + 1, 0);
+    int null_count = 0;
+    for (int i = 0; i < kNumSlots; ++i) {
+      const int stretch = (i / 500) % 3;
+      const bool is_valid = stretch == 0 ? true : (stretch == 1 ? false : gen() % 3 != 0);
+      if (is_valid) {
+        BitUtil::SetBit(valid_bits.data(), i + 3);
+      } else {
+        ++null_count;
+      }
+    }
+    const int num_values = kNumSlots - null_count;
+    const vector<int> indices = MakeDictionaryIndices(num_values, kDictionarySize, 43);
+    vector<uint8_t> buffer(RleEncoder::MaxBufferSize(bit_width, num_values));
+    RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), bit_width);
+    for (int index : indices) {
+      ASSERT_TRUE(encoder.Put(index));
+    }
+    const int encoded_len = encoder.Flush();
+
+    RleDecoder decoder(buffer.data(), encoded_len, bit_width);
+    vector<T> values(kNumSlots);
+    int slots_read = 0;
+    for (int batch_size : {1, 1234, 2000, kNumSlots}) {
+      batch_size = std::min(batch_size, kNumSlots - slots_read);
+      int batch_nulls = 0;
+      for (int i = slots_read; i < slots_read + batch_size; ++i) {
+        batch_nulls += !BitUtil::GetBit(valid_bits.data(), i + 3);
+      }
+      ASSERT_EQ(batch_size, decoder.GetBatchWithDictSpaced(
+                                dictionary.data(), values.data() + slots_read,
+                                batch_size, batch_nulls, valid_bits.data(),
+                                slots_read + 3));
+      slots_read += batch_size;
+    }
+    int value_index = 0;
+    for (int i = 0; i < kNumSlots; ++i) {
+      if (BitUtil::GetBit(valid_bits.data(), i + 3)) {
+        ASSERT_EQ(dictionary[indices[value_index++]], values[i]) << "slot " << i;
+      }
+    }
+    ASSERT_EQ(num_values, value_index);
+  }
+}
+
+TEST(Rle, GetBatchWithDict) {
+  CheckGetBatchWithDict<int16_t>();
+  CheckGetBatchWithDict<int32_t>();
+  CheckGetBatchWithDict<float>();
+  CheckGetBatchWithDict<int64_t>();
+  CheckGetBatchWithDict<double>();
+}
+
 }  // namespace arrow
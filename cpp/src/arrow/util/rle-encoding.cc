@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/rle-encoding.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <typename T>
+void GatherDefault(const T* dictionary, const int* indices, int length, T* out) {
+  for (int i = 0; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ARROW_TARGET_AVX2 void Gather32Avx2(const uint32_t* dictionary, const int* indices,
+                                    int length, uint32_t* out) {
+  const int* base = reinterpret_cast<const int*>(dictionary);
+  int i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi32(base, index, 4));
+  }
+  GatherDefault(dictionary, indices + i, length - i, out + i);
+}
+
+ARROW_TARGET_AVX2 void Gather64Avx2(const uint64_t* dictionary, const int* indices,
+                                    int length, uint64_t* out) {
+  const long long* base = reinterpret_cast<const long long*>(dictionary);  // NOLINT
+  int i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi64(base, index, 8));
+  }
+  GatherDefault(dictionary, indices + i, length - i, out + i);
+}
+#endif
+
+struct Gather32Dynamic {
+  using FunctionType = void (*)(const uint32_t*, const int*, int, uint32_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, GatherDefault<uint32_t>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::AVX2, Gather32Avx2},
+#endif
+    };
+  }
+};
+
+struct Gather64Dynamic {
+  using FunctionType = void (*)(const uint64_t*, const int*, int, uint64_t*);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, GatherDefault<uint64_t>},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::AVX2, Gather64Avx2},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+void GatherDictionary32(const uint32_t* dictionary, const int* indices, int length,
+                        uint32_t* out) {
+  static DynamicDispatch<Gather32Dynamic> dispatch;
+  dispatch.func(dictionary, indices, length, out);
+}
+
+void GatherDictionary64(const uint64_t* dictionary, const int* indices, int length,
+                        uint64_t* out) {
+  static DynamicDispatch<Gather64Dynamic> dispatch;
+  dispatch.func(dictionary, indices, length, out);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -23,13 +23,55 @@
 
 #include <math.h>
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
 
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 
+namespace internal {
+
+/// \brief Look up out[i] = dictionary[indices[i]] for 32-bit values, with
+/// SIMD gathers when the host supports them
+ARROW_EXPORT
+void GatherDictionary32(const uint32_t* dictionary, const int* indices, int length,
+                        uint32_t* out);
+
+/// \brief Same as GatherDictionary32, for 64-bit values
+ARROW_EXPORT
+void GatherDictionary64(const uint64_t* dictionary, const int* indices, int length,
+                        uint64_t* out);
+
+/// \brief Look up out[i] = dictionary[indices[i]] for i < length
+template <typename T>
+inline typename std::enable_if<!std::is_arithmetic<T>::value ||
+                               (sizeof(T) != 4 && sizeof(T) != 8)>::type
+GatherDictionary(const T* dictionary, const int* indices, int length, T* out) {
+  for (int i = 0; i < length; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value && sizeof(T) == 4>::type
+GatherDictionary(const T* dictionary, const int* indices, int length, T* out) {
+  GatherDictionary32(reinterpret_cast<const uint32_t*>(dictionary), indices, length,
+                     reinterpret_cast<uint32_t*>(out));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value && sizeof(T) == 8>::type
+GatherDictionary(const T* dictionary, const int* indices, int length, T* out) {
+  GatherDictionary64(reinterpret_cast<const uint64_t*>(dictionary), indices, length,
+                     reinterpret_cast<uint64_t*>(out));
+}
+
+}  // namespace internal
+
 /// Utility classes to do run length encoding (RLE) for fixed bit width values.  If runs
 /// are sufficiently long, RLE is used, otherwise, the values are just bit-packed
 /// (literal encoding).
@@ -331,9 +373,8 @@ inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batc
       literal_batch = std::min(literal_batch, buffer_size);
       int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
       DCHECK_EQ(actual_read, literal_batch);
-      for (int i = 0; i < literal_batch; ++i) {
-        values[values_read + i] = dictionary[indices[i]];
-      }
+      internal::GatherDictionary(dictionary, indices, literal_batch,
+                                 values + values_read);
       literal_count_ -= literal_batch;
       values_read += literal_batch;
     } else {
@@ -353,68 +394,98 @@ inline int RleDecoder::GetBatchWithDictSpaced(const T* dictionary, T* values,
   int values_read = 0;
   int remaining_nulls = null_count;
 
-  internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, batch_size);
+  // The validity bitmap is scanned in blocks, so that whole blocks of valid or
+  // null values are consumed at once, and only the blocks mixing them are
+  // scanned bit by bit. values_read is at block_position in the current block.
+  internal::BitBlockCounter block_counter(valid_bits, valid_bits_offset, batch_size);
+  internal::BitBlockCount block = block_counter.NextBlock();
+  int block_position = 0;
+  auto next_block_if_done = [&]() {
+    if (block_position == block.length) {
+      block = block_counter.NextBlock();
+      block_position = 0;
+    }
+  };
+  auto skip_null_block = [&]() {
+    values_read += block.length;
+    remaining_nulls -= block.length;
+    block_position = block.length;
+  };
 
   while (values_read < batch_size) {
-    bool is_valid = bit_reader.IsSet();
-    bit_reader.Next();
+    next_block_if_done();
+    if (block_position == 0 && block.NoneSet()) {
+      skip_null_block();
+      continue;
+    }
+    if (!BitUtil::GetBit(valid_bits, valid_bits_offset + values_read)) {
+      values_read++;
+      remaining_nulls--;
+      block_position++;
+      continue;
+    }
 
-    if (is_valid) {
-      if ((repeat_count_ == 0) && (literal_count_ == 0)) {
-        if (!NextCounts<T>()) return values_read;
-      }
-      if (repeat_count_ > 0) {
-        T value = dictionary[current_value_];
-        // The current index is already valid, we don't need to check that again
-        int repeat_batch = 1;
-        repeat_count_--;
-
-        while (repeat_count_ > 0 && (values_read + repeat_batch) < batch_size) {
-          if (bit_reader.IsSet()) {
+    if ((repeat_count_ == 0) && (literal_count_ == 0)) {
+      if (!NextCounts<T>()) return values_read;
+    }
+    if (repeat_count_ > 0) {
+      // Fill the repeated valid values and the nulls among them
+      const int repeat_start = values_read;
+      while (repeat_count_ > 0 && values_read < batch_size) {
+        next_block_if_done();
+        if (block_position == 0 && block.popcount <= static_cast<int>(repeat_count_)) {
+          repeat_count_ -= block.popcount;
+          remaining_nulls -= block.length - block.popcount;
+          values_read += block.length;
+          block_position = block.length;
+        } else {
+          if (BitUtil::GetBit(valid_bits, valid_bits_offset + values_read)) {
             repeat_count_--;
           } else {
             remaining_nulls--;
           }
-          repeat_batch++;
-
-          bit_reader.Next();
+          values_read++;
+          block_position++;
         }
-        std::fill(values + values_read, values + values_read + repeat_batch, value);
-        values_read += repeat_batch;
-      } else if (literal_count_ > 0) {
-        int literal_batch = std::min(batch_size - values_read - remaining_nulls,
-                                     static_cast<int>(literal_count_));
-
-        // Decode the literals
-        constexpr int kBufferSize = 1024;
-        int indices[kBufferSize];
-        literal_batch = std::min(literal_batch, kBufferSize);
-        int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
-        DCHECK_EQ(actual_read, literal_batch);
-
-        int skipped = 0;
-        int literals_read = 1;
-        values[values_read] = dictionary[indices[0]];
-
-        // Read the first bitset to the end
-        while (literals_read < literal_batch) {
-          if (bit_reader.IsSet()) {
-            values[values_read + literals_read + skipped] =
-                dictionary[indices[literals_read]];
-            literals_read++;
+      }
+      std::fill(values + repeat_start, values + values_read,
+                dictionary[current_value_]);
+    } else if (literal_count_ > 0) {
+      int literal_batch = std::min(batch_size - values_read - remaining_nulls,
+                                   static_cast<int>(literal_count_));
+
+      // Decode the literals
+      constexpr int kBufferSize = 1024;
+      int indices[kBufferSize];
+      literal_batch = std::min(literal_batch, kBufferSize);
+      int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
+      DCHECK_EQ(actual_read, literal_batch);
+
+      // Look up whole blocks of valid values at once, and scatter the other
+      // values around the nulls
+      int literals_read = 0;
+      while (literals_read < literal_batch) {
+        next_block_if_done();
+        if (block_position == 0 && block.AllSet() &&
+            block.length <= literal_batch - literals_read) {
+          internal::GatherDictionary(dictionary, indices + literals_read, block.length,
+                                     values + values_read);
+          literals_read += block.length;
+          values_read += block.length;
+          block_position = block.length;
+        } else if (block_position == 0 && block.NoneSet()) {
+          skip_null_block();
+        } else {
+          if (BitUtil::GetBit(valid_bits, valid_bits_offset + values_read)) {
+            values[values_read] = dictionary[indices[literals_read++]];
           } else {
-            skipped++;
+            remaining_nulls--;
           }
-
-          bit_reader.Next();
+          values_read++;
+          block_position++;
         }
-        literal_count_ -= literal_batch;
-        values_read += literal_batch + skipped;
-        remaining_nulls -= skipped;
       }
-    } else {
-      values_read++;
-      remaining_nulls--;
+      literal_count_ -= literal_batch;
     }
   }
 
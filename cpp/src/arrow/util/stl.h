@@ -18,6 +18,7 @@
 #ifndef ARROW_UTIL_STL_H
 #define ARROW_UTIL_STL_H
 
+#include <utility>
 #include <vector>
 
 #include "arrow/util/logging.h"
@@ -56,6 +57,19 @@ inline std::vector<T> AddVectorElement(const std::vector<T>& values, size_t inde
   return out;
 }
 
+/// \brief Make a vector of the given values, moving those passed as rvalues
+///
+/// Unlike an initializer list, whose elements are always copied into the
+/// vector, this costs no reference count update for moved smart pointers.
+template <typename T, typename... Args>
+inline std::vector<T> MakeVector(Args&&... args) {
+  std::vector<T> out;
+  out.reserve(sizeof...(Args));
+  using expand = int[];
+  static_cast<void>(expand{0, (out.emplace_back(std::forward<Args>(args)), 0)...});
+  return out;
+}
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_STRING_VIEW_UTIL_H
+#define ARROW_UTIL_STRING_VIEW_UTIL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/type.h"
+
+namespace arrow {
+namespace internal {
+
+// Helpers for StringViewEntry values. The data buffers of an array are passed
+// as an array of raw pointers, indexed by the buffer index of the entries.
+
+/// \brief Return a pointer to the bytes of the string
+static inline const uint8_t* StringViewData(const StringViewEntry& view,
+                                            const uint8_t* const* data_buffers) {
+  return view.is_inline() ? view.inlined
+                          : data_buffers[view.ref.buffer_index] + view.ref.offset;
+}
+
+/// \brief Return the length and prefix of the string as a single word, equal
+/// for two entries iff their strings have equal lengths and prefixes
+static inline uint64_t StringViewSizeAndPrefix(const StringViewEntry& view) {
+  uint64_t word;
+  std::memcpy(&word, &view, sizeof(word));
+  return word;
+}
+
+/// \brief Return whether two entries hold the same string
+///
+/// Strings of different lengths or prefixes are told apart from the entries
+/// alone. Otherwise, the bytes past the prefix are compared, from the entries
+/// themselves for inline strings.
+static inline bool StringViewEquals(const StringViewEntry& left,
+                                    const uint8_t* const* left_buffers,
+                                    const StringViewEntry& right,
+                                    const uint8_t* const* right_buffers) {
+  if (StringViewSizeAndPrefix(left) != StringViewSizeAndPrefix(right)) {
+    return false;
+  }
+  if (left.size <= StringViewEntry::kPrefixSize) {
+    return true;
+  }
+  constexpr int32_t kPrefixSize = StringViewEntry::kPrefixSize;
+  return std::memcmp(StringViewData(left, left_buffers) + kPrefixSize,
+                     StringViewData(right, right_buffers) + kPrefixSize,
+                     left.size - kPrefixSize) == 0;
+}
+
+/// \brief Compare two strings lexicographically by their bytes
+///
+/// \return a negative value, zero or a positive value as left sorts before,
+/// equal to or after right
+static inline int StringViewCompare(const StringViewEntry& left,
+                                    const uint8_t* const* left_buffers,
+                                    const StringViewEntry& right,
+                                    const uint8_t* const* right_buffers) {
+  constexpr int32_t kPrefixSize = StringViewEntry::kPrefixSize;
+  const int32_t min_size = std::min(left.size, right.size);
+  int cmp = std::memcmp(left.inlined, right.inlined, std::min(min_size, kPrefixSize));
+  if (cmp == 0 && min_size > kPrefixSize) {
+    cmp = std::memcmp(StringViewData(left, left_buffers) + kPrefixSize,
+                      StringViewData(right, right_buffers) + kPrefixSize,
+                      min_size - kPrefixSize);
+  }
+  if (cmp != 0) {
+    return cmp;
+  }
+  return left.size < right.size ? -1 : (left.size > right.size ? 1 : 0);
+}
+
+/// \brief Make the entry of a string, whose bytes are at the given offset of
+/// the given data buffer if not inlined
+static inline StringViewEntry MakeStringView(const uint8_t* value, int32_t length,
+                                             int32_t buffer_index, int32_t offset) {
+  StringViewEntry view;
+  std::memset(&view, 0, sizeof(view));
+  view.size = length;
+  if (view.is_inline()) {
+    std::memcpy(view.inlined, value, length);
+  } else {
+    std::memcpy(view.ref.prefix, value, StringViewEntry::kPrefixSize);
+    view.ref.buffer_index = buffer_index;
+    view.ref.offset = offset;
+  }
+  return view;
+}
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_STRING_VIEW_UTIL_H
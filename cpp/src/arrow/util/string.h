@@ -27,10 +27,10 @@ namespace arrow {
 
 static const char* kAsciiTable = "0123456789ABCDEF";
 
-static inline std::string HexEncode(const uint8_t* data, int32_t length) {
+static inline std::string HexEncode(const uint8_t* data, int64_t length) {
   std::string hex_string;
   hex_string.reserve(length * 2);
-  for (int32_t j = 0; j < length; ++j) {
+  for (int64_t j = 0; j < length; ++j) {
     // Convert to 2 base16 digits
     hex_string.push_back(kAsciiTable[data[j] >> 4]);
     hex_string.push_back(kAsciiTable[data[j] & 15]);
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/task-scheduler.h"
+
+namespace arrow {
+
+static std::shared_ptr<TaskScheduler> MakeScheduler(int num_workers) {
+  std::shared_ptr<TaskScheduler> scheduler;
+  Status st = TaskScheduler::Make(num_workers, &scheduler);
+  EXPECT_OK(st);
+  return scheduler;
+}
+
+TEST(TaskScheduler, Make) {
+  std::shared_ptr<TaskScheduler> scheduler;
+  ASSERT_RAISES(Invalid, TaskScheduler::Make(0, &scheduler));
+  ASSERT_OK(TaskScheduler::Make(3, &scheduler));
+  ASSERT_EQ(3, scheduler->num_workers());
+}
+
+TEST(TaskScheduler, SpawnRunsBeforeDestruction) {
+  std::atomic<int> counter(0);
+  {
+    auto scheduler = MakeScheduler(2);
+    for (int i = 0; i < 100; ++i) {
+      scheduler->Spawn([&counter]() { counter.fetch_add(1); });
+    }
+  }
+  ASSERT_EQ(100, counter.load());
+}
+
+TEST(TaskGroup, Basics) {
+  auto scheduler = MakeScheduler(4);
+
+  std::vector<int> results(1000, 0);
+  TaskGroup group(scheduler.get());
+  for (int i = 0; i < 1000; ++i) {
+    group.Append([&results, i]() {
+      results[i] = i + 1;
+      return Status::OK();
+    });
+  }
+  ASSERT_OK(group.Finish());
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(i + 1, results[i]);
+  }
+}
+
+TEST(TaskGroup, Error) {
+  auto scheduler = MakeScheduler(2);
+
+  TaskGroup group(scheduler.get());
+  for (int i = 0; i < 100; ++i) {
+    group.Append([i]() {
+      if (i == 3) {
+        return Status::IOError("task failed");
+      }
+      return Status::OK();
+    });
+  }
+  Status st = group.Finish();
+  ASSERT_RAISES(IOError, st);
+  ASSERT_EQ("task failed", st.message());
+}
+
+TEST(TaskGroup, NestedStaysOnWorkers) {
+  // Three levels of nested groups on a two-worker scheduler: waiting groups
+  // help executing tasks, so this neither deadlocks nor uses more threads
+  // than the workers plus the calling thread
+  const int num_workers = 2;
+  auto scheduler = MakeScheduler(num_workers);
+
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+  std::atomic<int> leaves(0);
+
+  auto leaf = [&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      thread_ids.insert(std::this_thread::get_id());
+    }
+    leaves.fetch_add(1);
+    return Status::OK();
+  };
+  auto middle = [&]() {
+    TaskGroup group(scheduler.get());
+    for (int k = 0; k < 8; ++k) {
+      group.Append(leaf);
+    }
+    return group.Finish();
+  };
+  auto top = [&]() {
+    TaskGroup group(scheduler.get());
+    for (int j = 0; j < 8; ++j) {
+      group.Append(middle);
+    }
+    return group.Finish();
+  };
+
+  TaskGroup group(scheduler.get());
+  for (int i = 0; i < 8; ++i) {
+    group.Append(top);
+  }
+  ASSERT_OK(group.Finish());
+
+  ASSERT_EQ(8 * 8 * 8, leaves.load());
+  ASSERT_LE(thread_ids.size(), static_cast<size_t>(num_workers + 1));
+}
+
+}  // namespace arrow
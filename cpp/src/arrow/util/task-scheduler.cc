@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/task-scheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// TaskScheduler implementation
+
+class TaskScheduler::TaskSchedulerImpl {
+ public:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+    std::thread thread;
+  };
+
+  TaskSchedulerImpl() : num_pending_(0), steal_counter_(0), shutdown_(false) {}
+
+  ~TaskSchedulerImpl() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      shutdown_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker->thread.join();
+    }
+  }
+
+  void Start(int num_workers) {
+    for (int i = 0; i < num_workers; ++i) {
+      workers_.emplace_back(new Worker());
+    }
+    for (int i = 0; i < num_workers; ++i) {
+      workers_[i]->thread = std::thread([this, i] { WorkerLoop(i); });
+    }
+  }
+
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+  void Spawn(std::function<void()> task) {
+    Worker* local = LocalWorker();
+    if (local != nullptr) {
+      std::lock_guard<std::mutex> lock(local->mutex);
+      local->tasks.push_back(std::move(task));
+    } else {
+      std::lock_guard<std::mutex> lock(global_mutex_);
+      global_tasks_.push_back(std::move(task));
+    }
+    num_pending_.fetch_add(1);
+    {
+      // Take the lock so that a worker about to sleep cannot miss the wakeup
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    sleep_cv_.notify_one();
+  }
+
+  bool RunPendingTask() {
+    std::function<void()> task;
+    if (!TakeTask(&task)) {
+      return false;
+    }
+    num_pending_.fetch_sub(1);
+    task();
+    return true;
+  }
+
+ private:
+  // The worker owned by the calling thread, if it belongs to this scheduler
+  Worker* LocalWorker() const {
+    return current_scheduler_ == this ? current_worker_ : nullptr;
+  }
+
+  bool TakeTask(std::function<void()>* out) {
+    // 1. Newest task of our own deque
+    Worker* local = LocalWorker();
+    if (local != nullptr) {
+      std::lock_guard<std::mutex> lock(local->mutex);
+      if (!local->tasks.empty()) {
+        *out = std::move(local->tasks.back());
+        local->tasks.pop_back();
+        return true;
+      }
+    }
+    // 2. Oldest task submitted from outside the scheduler
+    {
+      std::lock_guard<std::mutex> lock(global_mutex_);
+      if (!global_tasks_.empty()) {
+        *out = std::move(global_tasks_.front());
+        global_tasks_.pop_front();
+        return true;
+      }
+    }
+    // 3. Steal the oldest task of another worker, starting from a rotating
+    // victim to spread contention
+    const int num_workers = this->num_workers();
+    const int start = static_cast<int>(steal_counter_.fetch_add(1) % num_workers);
+    for (int k = 0; k < num_workers; ++k) {
+      Worker* victim = workers_[(start + k) % num_workers].get();
+      if (victim == local) {
+        continue;
+      }
+      std::lock_guard<std::mutex> lock(victim->mutex);
+      if (!victim->tasks.empty()) {
+        *out = std::move(victim->tasks.front());
+        victim->tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void WorkerLoop(int index) {
+    current_scheduler_ = this;
+    current_worker_ = workers_[index].get();
+    while (true) {
+      if (RunPendingTask()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleep_cv_.wait(lock, [this] { return shutdown_ || num_pending_.load() > 0; });
+      if (shutdown_ && num_pending_.load() == 0) {
+        break;
+      }
+    }
+    current_scheduler_ = nullptr;
+    current_worker_ = nullptr;
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  std::mutex global_mutex_;
+  std::deque<std::function<void()>> global_tasks_;
+
+  // Number of tasks enqueued but not yet taken by any thread
+  std::atomic<int64_t> num_pending_;
+  std::atomic<uint32_t> steal_counter_;
+
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  bool shutdown_;
+
+  static thread_local TaskSchedulerImpl* current_scheduler_;
+  static thread_local Worker* current_worker_;
+};
+
+thread_local TaskScheduler::TaskSchedulerImpl*
+    TaskScheduler::TaskSchedulerImpl::current_scheduler_ = nullptr;
+thread_local TaskScheduler::TaskSchedulerImpl::Worker*
+    TaskScheduler::TaskSchedulerImpl::current_worker_ = nullptr;
+
+TaskScheduler::TaskScheduler() : impl_(new TaskSchedulerImpl()) {}
+
+TaskScheduler::~TaskScheduler() {}
+
+Status TaskScheduler::Make(int num_workers, std::shared_ptr<TaskScheduler>* out) {
+  if (num_workers <= 0) {
+    return Status::Invalid("TaskScheduler needs at least one worker");
+  }
+  std::shared_ptr<TaskScheduler> scheduler(new TaskScheduler());
+  scheduler->impl_->Start(num_workers);
+  *out = std::move(scheduler);
+  return Status::OK();
+}
+
+int TaskScheduler::num_workers() const { return impl_->num_workers(); }
+
+void TaskScheduler::Spawn(std::function<void()> task) { impl_->Spawn(std::move(task)); }
+
+bool TaskScheduler::RunPendingTask() { return impl_->RunPendingTask(); }
+
+// ----------------------------------------------------------------------
+// TaskGroup implementation
+
+struct TaskGroup::State {
+  State() : num_outstanding(0), error_occurred(false) {}
+
+  std::atomic<int64_t> num_outstanding;
+  std::atomic<bool> error_occurred;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  Status error;
+};
+
+TaskGroup::TaskGroup(TaskScheduler* scheduler)
+    : scheduler_(scheduler), state_(std::make_shared<State>()) {
+  DCHECK_NE(scheduler, nullptr);
+}
+
+TaskGroup::~TaskGroup() { ARROW_UNUSED(Finish()); }
+
+void TaskGroup::Append(std::function<Status()> task) {
+  state_->num_outstanding.fetch_add(1);
+  std::shared_ptr<State> state = state_;
+  scheduler_->Spawn([state, task]() {
+    if (!state->error_occurred.load()) {
+      Status s = task();
+      if (!s.ok()) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->error_occurred.load()) {
+          state->error = s;
+          state->error_occurred.store(true);
+        }
+      }
+    }
+    if (state->num_outstanding.fetch_sub(1) == 1) {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->cv.notify_all();
+    }
+  });
+}
+
+Status TaskGroup::Finish() {
+  while (state_->num_outstanding.load() > 0) {
+    // Help running tasks, which may belong to this group or to another one
+    if (scheduler_->RunPendingTask()) {
+      continue;
+    }
+    // Our remaining tasks are running on other threads. Wake up periodically
+    // in case they spawn work we can help with
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->cv.wait_for(lock, std::chrono::microseconds(200),
+                        [this] { return state_->num_outstanding.load() == 0; });
+  }
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->error;
+}
+
+}  // namespace arrow
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_TASK_SCHEDULER_H
+#define ARROW_UTIL_TASK_SCHEDULER_H
+
+#include <functional>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \class TaskScheduler
+/// \brief A work-stealing scheduler for nested parallelism
+///
+/// Each worker thread owns a task deque. Tasks spawned from a worker are
+/// pushed onto its own deque and popped in LIFO order, while idle workers
+/// steal the oldest tasks from other workers. Tasks spawned from outside the
+/// scheduler go to a shared injection queue. Together with TaskGroup, whose
+/// Finish() executes pending tasks instead of blocking, nested task groups
+/// (e.g. table-level, column-level, then chunk-level work) run on a fixed
+/// number of threads without oversubscription or deadlock.
+class ARROW_EXPORT TaskScheduler {
+ public:
+  /// \brief Create a scheduler with the given number of worker threads
+  static Status Make(int num_workers, std::shared_ptr<TaskScheduler>* out);
+
+  /// \brief Run all pending tasks, then stop and join the worker threads
+  ~TaskScheduler();
+
+  int num_workers() const;
+
+  /// \brief Enqueue a task for asynchronous execution
+  void Spawn(std::function<void()> task);
+
+  /// \brief Execute one pending task on the calling thread, if any
+  /// \return true if a task was run
+  bool RunPendingTask();
+
+ private:
+  TaskScheduler();
+
+  class TaskSchedulerImpl;
+  std::unique_ptr<TaskSchedulerImpl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TaskScheduler);
+};
+
+/// \class TaskGroup
+/// \brief A set of Status-returning tasks executed by a TaskScheduler
+///
+/// Tasks appended after an error has been recorded are skipped.
+class ARROW_EXPORT TaskGroup {
+ public:
+  explicit TaskGroup(TaskScheduler* scheduler);
+
+  /// \brief Wait for outstanding tasks if Finish() was not called
+  ~TaskGroup();
+
+  /// \brief Schedule a task as part of this group
+  void Append(std::function<Status()> task);
+
+  /// \brief Wait for all tasks of the group, executing pending tasks of the
+  /// scheduler on the calling thread in the meantime
+  /// \return the first error returned by a task of the group
+  Status Finish();
+
+ private:
+  struct State;
+
+  TaskScheduler* scheduler_;
+  std::shared_ptr<State> state_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TaskGroup);
+};
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_TASK_SCHEDULER_H
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/test-util.h"
+#include "arrow/util/memory.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace internal {
+
+static std::shared_ptr<ThreadPool> MakePool(int threads) {
+  std::shared_ptr<ThreadPool> pool;
+  Status st = ThreadPool::Make(threads, &pool);
+  EXPECT_OK(st);
+  return pool;
+}
+
+TEST(ThreadPool, Submit) {
+  auto pool = MakePool(3);
+
+  std::vector<std::future<int>> futures(10);
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool->Submit(&futures[i], [](int x, int y) { return x * y; }, i, 2));
+  }
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(i * 2, futures[i].get());
+  }
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(ThreadPool, Spawn) {
+  auto pool = MakePool(4);
+
+  std::atomic<int> counter(0);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(pool->Spawn([&counter]() { counter.fetch_add(1); }));
+  }
+  // Shutdown(wait=true) runs all pending tasks
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(100, counter.load());
+
+  // Further use is forbidden
+  ASSERT_RAISES(Invalid, pool->Spawn([]() {}));
+  ASSERT_RAISES(Invalid, pool->SetCapacity(2));
+  ASSERT_RAISES(Invalid, pool->Shutdown());
+}
+
+TEST(ThreadPool, QuickShutdown) {
+  auto pool = MakePool(1);
+
+  std::atomic<int> counter(0);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(pool->Spawn([&counter]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      counter.fetch_add(1);
+    }));
+  }
+  ASSERT_OK(pool->Shutdown(false /* wait */));
+  ASSERT_LT(counter.load(), 100);
+}
+
+TEST(ThreadPool, SetCapacity) {
+  auto pool = MakePool(3);
+  ASSERT_EQ(3, pool->GetCapacity());
+
+  ASSERT_RAISES(Invalid, pool->SetCapacity(0));
+  ASSERT_OK(pool->SetCapacity(5));
+  ASSERT_EQ(5, pool->GetCapacity());
+
+  std::atomic<int> counter(0);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_OK(pool->Spawn([&counter]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      counter.fetch_add(1);
+    }));
+  }
+  ASSERT_OK(pool->SetCapacity(1));
+  ASSERT_EQ(1, pool->GetCapacity());
+
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(20, counter.load());
+}
+
+TEST(ThreadPool, CpuThreadPool) {
+  const int capacity = GetCpuThreadPoolCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(ThreadPool::DefaultCapacity(), capacity);
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity + 1));
+  ASSERT_EQ(capacity + 1, GetCpuThreadPoolCapacity());
+  ASSERT_OK(SetCpuThreadPoolCapacity(capacity));
+}
+
+TEST(ThreadPool, IOThreadPool) {
+  ASSERT_EQ(kDefaultIOThreadPoolCapacity, GetIOThreadPoolCapacity());
+  ASSERT_NE(GetCpuThreadPool(), GetIOThreadPool());
+
+  ASSERT_OK(SetIOThreadPoolCapacity(2));
+  ASSERT_EQ(2, GetIOThreadPoolCapacity());
+  ASSERT_OK(SetIOThreadPoolCapacity(kDefaultIOThreadPoolCapacity));
+}
+
+}  // namespace internal
+
+TEST(ParallelFor, Basics) {
+  const int num_tasks = 1000;
+  std::vector<int> results(num_tasks, 0);
+
+  ASSERT_OK(ParallelFor(4, num_tasks, [&results](int i) {
+    results[i] = i * i;
+    return Status::OK();
+  }));
+  for (int i = 0; i < num_tasks; ++i) {
+    ASSERT_EQ(i * i, results[i]);
+  }
+}
+
+TEST(ParallelFor, Error) {
+  std::atomic<int> num_run(0);
+  Status st = ParallelFor(4, 1000, [&num_run](int i) {
+    num_run.fetch_add(1);
+    if (i == 10) {
+      return Status::IOError("task failed");
+    }
+    return Status::OK();
+  });
+  ASSERT_RAISES(IOError, st);
+  ASSERT_EQ("task failed", st.message());
+  ASSERT_LT(num_run.load(), 1000);
+}
+
+TEST(ParallelFor, Nested) {
+  // Nested calls must not deadlock even when there are more outer tasks
+  // than threads in the pool
+  const int num_outer = 2 * GetCpuThreadPoolCapacity() + 1;
+  std::atomic<int> counter(0);
+  ASSERT_OK(ParallelFor(num_outer, num_outer, [&counter](int i) {
+    return ParallelFor(4, 10, [&counter](int j) {
+      counter.fetch_add(1);
+      return Status::OK();
+    });
+  }));
+  ASSERT_EQ(num_outer * 10, counter.load());
+}
+
+TEST(ParallelMemcopy, Basics) {
+  const int64_t nbytes = (1 << 20) + 13;
+  std::vector<uint8_t> src(nbytes), dst(nbytes, 0);
+  for (int64_t i = 0; i < nbytes; ++i) {
+    src[i] = static_cast<uint8_t>(i * 7);
+  }
+  internal::ParallelMemcopy(dst.data(), src.data() + 3, nbytes - 3, 4);
+  ASSERT_EQ(0, memcmp(dst.data(), src.data() + 3, nbytes - 3));
+}
+
+TEST(ParallelMemcopy, NonTemporal) {
+  const int64_t nbytes = internal::kNonTemporalMemcopyThreshold + 1001;
+  std::vector<uint8_t> src(nbytes);
+  for (int64_t i = 0; i < nbytes; ++i) {
+    src[i] = static_cast<uint8_t>(i * 13);
+  }
+  for (int num_threads : {1, 3}) {
+    for (int64_t offset : {0, 5}) {
+      std::vector<uint8_t> dst(nbytes, 0);
+      internal::ParallelMemcopy(dst.data() + offset, src.data(), nbytes - offset,
+                                num_threads, 4096);
+      ASSERT_EQ(0, memcmp(dst.data() + offset, src.data(), nbytes - offset));
+    }
+  }
+}
+
+}  // namespace arrow
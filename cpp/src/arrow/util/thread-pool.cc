@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/thread-pool.h"
+
+#include <algorithm>
+#include <string>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+ThreadPool::ThreadPool()
+    : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+
+ThreadPool::~ThreadPool() { ARROW_UNUSED(Shutdown(false /* wait */)); }
+
+Status ThreadPool::SetCapacity(int threads) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (please_shutdown_) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  if (threads <= 0) {
+    return Status::Invalid("ThreadPool capacity must be > 0");
+  }
+  CollectFinishedWorkersUnlocked();
+
+  desired_capacity_ = threads;
+  const int required = std::min(static_cast<int>(pending_tasks_.size()),
+                                threads - static_cast<int>(workers_.size()));
+  if (required > 0) {
+    LaunchWorkersUnlocked(required);
+  } else if (required < 0) {
+    // Excess threads are running, wake them so that they stop
+    cv_.notify_all();
+  }
+  return Status::OK();
+}
+
+int ThreadPool::GetCapacity() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return desired_capacity_;
+}
+
+Status ThreadPool::Shutdown(bool wait) {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  if (please_shutdown_) {
+    return Status::Invalid("Shutdown() already called");
+  }
+  please_shutdown_ = true;
+  quick_shutdown_ = !wait;
+  cv_.notify_all();
+  cv_shutdown_.wait(lock, [this] { return workers_.empty(); });
+  if (!quick_shutdown_) {
+    DCHECK(pending_tasks_.empty());
+  } else {
+    pending_tasks_.clear();
+  }
+  CollectFinishedWorkersUnlocked();
+  return Status::OK();
+}
+
+void ThreadPool::CollectFinishedWorkersUnlocked() {
+  for (auto& thread : finished_workers_) {
+    // Make sure OS thread has exited
+    thread.join();
+  }
+  finished_workers_.clear();
+}
+
+void ThreadPool::LaunchWorkersUnlocked(int threads) {
+  for (int i = 0; i < threads; i++) {
+    workers_.emplace_back();
+    auto it = --(workers_.end());
+    *it = std::thread([this, it] { WorkerLoop(it); });
+  }
+}
+
+bool ThreadPool::ShouldWorkerQuitUnlocked(std::list<std::thread>::iterator* it) {
+  if (static_cast<int>(workers_.size()) > desired_capacity_) {
+    finished_workers_.push_back(std::move(**it));
+    workers_.erase(*it);
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::WorkerLoop(std::list<std::thread>::iterator it) {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  // Since we hold the lock, `it` now points to the correct thread object
+  // (LaunchWorkersUnlocked has exited)
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+
+  // Whether this worker already moved itself to the finished list
+  bool seceded = false;
+  while (!seceded) {
+    // By the time this thread is started, some tasks may have been pushed
+    // or shutdown could even have been requested.  So we only wait on the
+    // condition variable at the end of the loop.
+
+    // Execute pending tasks if any
+    while (!pending_tasks_.empty() && !quick_shutdown_) {
+      // If too many threads, secede from the pool.  We check this
+      // opportunistically at each loop iteration since it releases the lock
+      // below.
+      if (ShouldWorkerQuitUnlocked(&it)) {
+        seceded = true;
+        break;
+      }
+      {
+        std::function<void()> task = std::move(pending_tasks_.front());
+        pending_tasks_.pop_front();
+        lock.unlock();
+        task();
+      }
+      lock.lock();
+    }
+    if (seceded || please_shutdown_) {
+      break;
+    }
+    // Now the queue is empty
+    if (ShouldWorkerQuitUnlocked(&it)) {
+      seceded = true;
+      break;
+    }
+    // Wait for next wakeup
+    cv_.wait(lock);
+  }
+
+  if (!seceded) {
+    // Move our thread object to the trashcan of finished workers so that
+    // it can be explicitly joined before the ThreadPool is destroyed
+    finished_workers_.push_back(std::move(*it));
+    workers_.erase(it);
+  }
+  if (please_shutdown_ && workers_.empty()) {
+    // Notify the function waiting in Shutdown()
+    cv_shutdown_.notify_one();
+  }
+}
+
+Status ThreadPool::SpawnReal(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    CollectFinishedWorkersUnlocked();
+    if (static_cast<int>(workers_.size()) < desired_capacity_) {
+      // We can still spin up more workers so spin up a new worker
+      LaunchWorkersUnlocked(/*threads=*/1);
+    }
+    pending_tasks_.push_back(std::move(task));
+  }
+  cv_.notify_one();
+  return Status::OK();
+}
+
+Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
+int ThreadPool::DefaultCapacity() {
+  int capacity = static_cast<int>(std::thread::hardware_concurrency());
+  if (capacity == 0) {
+    capacity = 4;
+  }
+  return capacity;
+}
+
+// Helper for the singleton pattern
+std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+  std::shared_ptr<ThreadPool> pool;
+  DCHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  return pool;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  std::shared_ptr<ThreadPool> pool;
+  DCHECK_OK(ThreadPool::Make(kDefaultIOThreadPoolCapacity, &pool));
+  return pool;
+}
+
+ThreadPool* GetCpuThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
+  return singleton.get();
+}
+
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
+}  // namespace internal
+
+int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
+
+Status SetCpuThreadPoolCapacity(int threads) {
+  return internal::GetCpuThreadPool()->SetCapacity(threads);
+}
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
+}  // namespace arrow
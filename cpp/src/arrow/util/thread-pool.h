@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_THREAD_POOL_H
+#define ARROW_UTIL_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+/// \brief Get the capacity of the global thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various CPU-bound tasks.  This is an ideal number,
+/// not necessarily the exact number of threads at a given point in time.
+ARROW_EXPORT int GetCpuThreadPoolCapacity();
+
+/// \brief Set the capacity of the global thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various CPU-bound tasks.
+ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
+
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking reads, such as RandomAccessFile::ReadAsync.
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// More threads allow more requests to high-latency storage to be in
+/// flight at the same time.
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
+namespace internal {
+
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+/// \class ThreadPool
+/// \brief A resizable pool of worker threads executing submitted tasks in
+/// FIFO order
+class ARROW_EXPORT ThreadPool {
+ public:
+  /// \brief Construct a thread pool with the given number of worker threads
+  static Status Make(int threads, std::shared_ptr<ThreadPool>* out);
+
+  /// \brief Destroy the thread pool, discarding any pending tasks
+  ~ThreadPool();
+
+  /// \brief Return the desired number of worker threads
+  ///
+  /// The actual number of workers may lag a bit behind after the capacity
+  /// is decreased, since running tasks are never interrupted
+  int GetCapacity();
+
+  /// \brief Dynamically change the number of worker threads
+  ///
+  /// New threads are spawned immediately; when decreasing the capacity,
+  /// excess workers exit after finishing their current task
+  Status SetCapacity(int threads);
+
+  /// \brief Stop the worker threads and join them
+  /// \param[in] wait if true, run all pending tasks before stopping;
+  /// otherwise pending tasks are discarded
+  Status Shutdown(bool wait = true);
+
+  /// \brief Run a function asynchronously, without a way to wait for it
+  template <typename Function>
+  Status Spawn(Function&& func) {
+    return SpawnReal(std::forward<Function>(func));
+  }
+
+  /// \brief Run a function asynchronously and return a future for its result
+  template <typename Function, typename... Args,
+            typename Result = typename std::result_of<Function && (Args && ...)>::type>
+  Status Submit(std::future<Result>* out, Function&& func, Args&&... args) {
+    // std::function requires a copyable callable, so the task is held
+    // through a shared_ptr
+    auto task = std::make_shared<std::packaged_task<Result()>>(
+        std::bind(std::forward<Function>(func), std::forward<Args>(args)...));
+    *out = task->get_future();
+    return SpawnReal([task]() { (*task)(); });
+  }
+
+  /// \brief Return the number of cores usable by default
+  static int DefaultCapacity();
+
+ protected:
+  friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
+  ThreadPool();
+
+  Status SpawnReal(std::function<void()> task);
+
+  // Collect finished worker threads, making sure the OS threads have exited
+  void CollectFinishedWorkersUnlocked();
+  // Launch a given number of additional workers
+  void LaunchWorkersUnlocked(int threads);
+  // The body of a worker thread
+  void WorkerLoop(std::list<std::thread>::iterator it);
+  // Whether the calling worker should exit, in which case it is moved to
+  // the list of finished workers
+  bool ShouldWorkerQuitUnlocked(std::list<std::thread>::iterator* it);
+
+  static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable cv_shutdown_;
+
+  std::list<std::thread> workers_;
+  // Trashcan for finished threads
+  std::vector<std::thread> finished_workers_;
+  std::deque<std::function<void()>> pending_tasks_;
+
+  // Desired number of threads
+  int desired_capacity_;
+  // Are we shutting down?
+  bool please_shutdown_;
+  bool quick_shutdown_;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
+};
+
+/// \brief Return the process-global thread pool for CPU-bound tasks
+///
+/// The pool is created the first time this function is called, with
+/// ThreadPool::DefaultCapacity() threads
+ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+
+/// \brief Return the process-global thread pool for blocking I/O
+///
+/// The pool is created the first time this function is called, with
+/// kDefaultIOThreadPoolCapacity threads. Its workers mostly wait on the
+/// storage, so they do not take capacity from the CPU thread pool
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_THREAD_POOL_H
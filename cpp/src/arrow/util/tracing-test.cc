@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "arrow/test-util.h"
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace internal {
+
+static int CountOccurrences(const std::string& s, const std::string& pattern) {
+  int count = 0;
+  for (size_t pos = s.find(pattern); pos != std::string::npos;
+       pos = s.find(pattern, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+static std::string GetTrace() {
+  std::stringstream ss;
+  EXPECT_OK(WriteChromeTrace(&ss));
+  return ss.str();
+}
+
+TEST(Tracing, Spans) {
+  { TraceSpan span("test", "before"); }
+
+  StartTracing();
+  ASSERT_TRUE(IsTracing());
+  {
+    TraceSpan outer("test", "outer");
+    { TraceSpan inner("test", "inner\"quoted\""); }
+  }
+  std::thread([] { TraceSpan span("test", "other thread"); }).join();
+  StopTracing();
+  ASSERT_FALSE(IsTracing());
+  { TraceSpan span("test", "after"); }
+
+  const std::string trace = GetTrace();
+  ASSERT_EQ(0, trace.find("{\"traceEvents\":["));
+  ASSERT_EQ(3, CountOccurrences(trace, "\"ph\":\"X\""));
+  ASSERT_NE(std::string::npos, trace.find("{\"name\":\"outer\",\"cat\":\"test\""));
+  ASSERT_NE(std::string::npos, trace.find("\"name\":\"inner\\\"quoted\\\"\""));
+  ASSERT_NE(std::string::npos, trace.find("\"name\":\"other thread\""));
+  ASSERT_EQ(std::string::npos, trace.find("before"));
+  ASSERT_EQ(std::string::npos, trace.find("after"));
+  // The inner span ends before the outer one, which is recorded after it
+  ASSERT_LT(trace.find("inner"), trace.find("outer"));
+}
+
+TEST(Tracing, RingBuffer) {
+  StartTracing(4);
+  for (int i = 0; i < 10; ++i) {
+    TraceSpan span("test", i < 6 ? "old" : "new");
+  }
+  StopTracing();
+  std::string trace = GetTrace();
+  ASSERT_EQ(4, CountOccurrences(trace, "\"ph\":\"X\""));
+  ASSERT_EQ(4, CountOccurrences(trace, "\"new\""));
+
+  // Restarting discards the spans
+  StartTracing();
+  StopTracing();
+  trace = GetTrace();
+  ASSERT_EQ(0, CountOccurrences(trace, "\"ph\":\"X\""));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace arrow {
+
+namespace {
+
+struct TraceEvent {
+  const char* category;
+  const char* name;
+  int64_t start_ns;
+  int64_t end_ns;
+};
+
+// The spans of one thread. The lock is only contended while the trace is
+// written or tracing restarted
+struct ThreadTraceBuffer {
+  explicit ThreadTraceBuffer(int64_t id) : thread_id(id), num_recorded(0) {}
+
+  std::mutex mutex;
+  int64_t thread_id;
+  // Ring of the latest spans, num_recorded counting the overwritten ones
+  std::vector<TraceEvent> events;
+  int64_t num_recorded;
+};
+
+// The buffers of all threads which recorded spans, kept after the threads
+// exit so that the spans of finished tasks are written too
+class TraceRegistry {
+ public:
+  TraceRegistry()
+      : enabled_(false),
+        capacity_(kDefaultTraceCapacity),
+        origin_ns_(SteadyClockNanos()) {}
+
+  static TraceRegistry* Get() {
+    static TraceRegistry registry;
+    return &registry;
+  }
+
+  void Start(int64_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_.store(false);
+    capacity_.store(std::max<int64_t>(capacity, 1));
+    for (const auto& buffer : buffers_) {
+      std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+      buffer->events.clear();
+      buffer->events.shrink_to_fit();
+      buffer->num_recorded = 0;
+    }
+    origin_ns_.store(SteadyClockNanos());
+    enabled_.store(true);
+  }
+
+  void Stop() { enabled_.store(false); }
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  int64_t Now() const {
+    return SteadyClockNanos() - origin_ns_.load(std::memory_order_relaxed);
+  }
+
+  void Record(const TraceEvent& event) {
+    static thread_local std::shared_ptr<ThreadTraceBuffer> buffer;
+    if (ARROW_PREDICT_FALSE(!buffer)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffer = std::make_shared<ThreadTraceBuffer>(
+          static_cast<int64_t>(buffers_.size()) + 1);
+      buffers_.push_back(buffer);
+    }
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    if (buffer->events.empty()) {
+      buffer->events.resize(static_cast<size_t>(capacity_.load()));
+    }
+    const int64_t capacity = static_cast<int64_t>(buffer->events.size());
+    buffer->events[buffer->num_recorded % capacity] = event;
+    ++buffer->num_recorded;
+  }
+
+  Status WriteChromeTrace(std::ostream* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : buffers_) {
+      std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+      const int64_t capacity = static_cast<int64_t>(buffer->events.size());
+      const int64_t begin = std::max<int64_t>(buffer->num_recorded - capacity, 0);
+      for (int64_t i = begin; i < buffer->num_recorded; ++i) {
+        const TraceEvent& event = buffer->events[i % capacity];
+        *out << (first ? "\n" : ",\n");
+        first = false;
+        WriteEvent(event, buffer->thread_id, out);
+      }
+    }
+    *out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    if (!*out) {
+      return Status::IOError("Failed to write the trace");
+    }
+    return Status::OK();
+  }
+
+ private:
+  static int64_t SteadyClockNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  static void WriteString(const char* s, std::ostream* out) {
+    *out << '"';
+    for (; *s != '\0'; ++s) {
+      if (*s == '"' || *s == '\\') {
+        *out << '\\';
+      }
+      *out << *s;
+    }
+    *out << '"';
+  }
+
+  // Complete events, with times in microseconds
+  static void WriteMicros(int64_t ns, std::ostream* out) {
+    const int64_t fraction = ns % 1000;
+    *out << ns / 1000 << '.' << fraction / 100 << (fraction / 10) % 10 << fraction % 10;
+  }
+
+  static void WriteEvent(const TraceEvent& event, int64_t thread_id,
+                         std::ostream* out) {
+    *out << "{\"name\":";
+    WriteString(event.name, out);
+    *out << ",\"cat\":";
+    WriteString(event.category, out);
+    *out << ",\"ph\":\"X\",\"ts\":";
+    WriteMicros(event.start_ns, out);
+    *out << ",\"dur\":";
+    WriteMicros(event.end_ns - event.start_ns, out);
+    *out << ",\"pid\":0,\"tid\":" << thread_id << "}";
+  }
+
+  std::mutex mutex_;
+  std::atomic<bool> enabled_;
+  std::atomic<int64_t> capacity_;
+  std::atomic<int64_t> origin_ns_;
+  std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers_;
+};
+
+}  // namespace
+
+void StartTracing(int64_t events_per_thread) {
+  TraceRegistry::Get()->Start(events_per_thread);
+}
+
+void StopTracing() { TraceRegistry::Get()->Stop(); }
+
+bool IsTracing() { return TraceRegistry::Get()->enabled(); }
+
+Status WriteChromeTrace(std::ostream* out) {
+  return TraceRegistry::Get()->WriteChromeTrace(out);
+}
+
+namespace internal {
+
+void RecordTraceSpan(const char* category, const char* name, int64_t start_ns,
+                     int64_t end_ns) {
+  TraceRegistry* registry = TraceRegistry::Get();
+  // Spans left open when tracing is restarted may end before they start
+  if (registry->enabled() && start_ns <= end_ns) {
+    registry->Record({category, name, start_ns, end_ns});
+  }
+}
+
+int64_t TraceClockNanos() { return TraceRegistry::Get()->Now(); }
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_TRACING_H
+#define ARROW_UTIL_TRACING_H
+
+#include <cstdint>
+#include <ostream>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+static constexpr int64_t kDefaultTraceCapacity = 1 << 16;
+
+/// \brief Start recording the spans of the instrumented functions
+///
+/// Spans are only instrumented when Arrow is built with ARROW_TRACING=ON, in
+/// which case reads of files, IPC decoding and encoding, compute kernels and
+/// conversions to pandas are traced. Each thread records its spans in a ring
+/// buffer of its own, keeping its latest events_per_thread spans. The spans
+/// recorded since the previous call are discarded.
+ARROW_EXPORT void StartTracing(int64_t events_per_thread = kDefaultTraceCapacity);
+
+/// \brief Stop recording spans, keeping those recorded so far
+ARROW_EXPORT void StopTracing();
+
+/// \brief Return whether spans are being recorded
+ARROW_EXPORT bool IsTracing();
+
+/// \brief Write the spans recorded so far in the Chrome trace event format
+///
+/// The output can be loaded in chrome://tracing or Perfetto. Spans still
+/// being recorded by other threads may be missing, so tracing is best
+/// stopped first.
+ARROW_EXPORT Status WriteChromeTrace(std::ostream* out);
+
+namespace internal {
+
+/// \brief Record a span of the calling thread, nanosecond times being those
+/// of TraceClockNanos
+///
+/// The category and name must be string literals, as they are only copied
+/// when the trace is written.
+ARROW_EXPORT void RecordTraceSpan(const char* category, const char* name,
+                                  int64_t start_ns, int64_t end_ns);
+
+/// \brief Return the time elapsed since tracing started, in nanoseconds
+ARROW_EXPORT int64_t TraceClockNanos();
+
+/// \brief Record a span for the lifetime of the scope, if tracing was started
+/// when it was entered
+class ARROW_EXPORT TraceSpan {
+ public:
+  TraceSpan(const char* category, const char* name)
+      : category_(category), name_(name), start_ns_(-1) {
+    if (ARROW_PREDICT_FALSE(IsTracing())) {
+      start_ns_ = TraceClockNanos();
+    }
+  }
+  ~TraceSpan() {
+    if (ARROW_PREDICT_FALSE(start_ns_ >= 0)) {
+      RecordTraceSpan(category_, name_, start_ns_, TraceClockNanos());
+    }
+  }
+
+ private:
+  const char* category_;
+  const char* name_;
+  int64_t start_ns_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TraceSpan);
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#define ARROW_TRACE_CONCAT_IMPL(x, y) x##y
+#define ARROW_TRACE_CONCAT(x, y) ARROW_TRACE_CONCAT_IMPL(x, y)
+
+/// \brief Trace the rest of the enclosing scope as a span of the category,
+/// both being string literals. Compiled out unless ARROW_WITH_TRACING is
+/// defined
+#ifdef ARROW_WITH_TRACING
+#define ARROW_TRACE_SPAN(category, name)                                  \
+  ::arrow::internal::TraceSpan ARROW_TRACE_CONCAT(arrow_trace_span_, __LINE__)( \
+      category, name)
+#else
+#define ARROW_TRACE_SPAN(category, name)
+#endif
+
+#endif  // ARROW_UTIL_TRACING_H
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace internal {
+
+static bool IsValid(const std::string& s) {
+  return ValidateUTF8(reinterpret_cast<const uint8_t*>(s.data()),
+                      static_cast<int64_t>(s.size()));
+}
+
+TEST(ValidateUTF8, WellFormed) {
+  ASSERT_TRUE(IsValid(""));
+  ASSERT_TRUE(IsValid("abc"));
+  ASSERT_TRUE(IsValid("\xc3\xa9t\xc3\xa9"));  // U+00E9 t U+00E9
+  ASSERT_TRUE(IsValid("\xe2\x82\xac"));  // U+20AC
+  ASSERT_TRUE(IsValid("\xed\x9f\xbf"));  // U+D7FF
+  ASSERT_TRUE(IsValid("\xf0\x9f\x98\x80"));  // U+1F600
+  ASSERT_TRUE(IsValid("\xf4\x8f\xbf\xbf"));  // U+10FFFF
+  ASSERT_TRUE(IsValid(std::string("a\0b", 3)));
+}
+
+TEST(ValidateUTF8, IllFormed) {
+  ASSERT_FALSE(IsValid("\x80"));  // Lone continuation byte
+  ASSERT_FALSE(IsValid("\xc3"));  // Truncated
+  ASSERT_FALSE(IsValid("\xe2\x82"));
+  ASSERT_FALSE(IsValid("\xc0\xaf"));  // Overlong
+  ASSERT_FALSE(IsValid("\xe0\x80\xaf"));
+  ASSERT_FALSE(IsValid("\xf0\x80\x80\xaf"));
+  ASSERT_FALSE(IsValid("\xed\xa0\x80"));  // Surrogate
+  ASSERT_FALSE(IsValid("\xf4\x90\x80\x80"));  // Above U+10FFFF
+  ASSERT_FALSE(IsValid("\xf5\x80\x80\x80"));
+  ASSERT_FALSE(IsValid("\xff"));
+  ASSERT_FALSE(IsValid("\xe2\x28\xa1"));  // Bad continuation
+}
+
+TEST(ValidateUTF8, Blocks) {
+  // Errors are found wherever they are relative to the ASCII blocks
+  const std::string ascii(100, 'x');
+  ASSERT_TRUE(IsValid(ascii));
+  for (size_t position = 0; position <= ascii.size(); ++position) {
+    std::string valid = ascii;
+    valid.insert(position, "\xc3\xa9");
+    ASSERT_TRUE(IsValid(valid)) << position;
+
+    std::string invalid = ascii;
+    invalid.insert(position, "\xc3");
+    ASSERT_FALSE(IsValid(invalid)) << position;
+  }
+
+  // A sequence straddling two blocks
+  std::string straddling(31, 'x');
+  straddling += "\xf0\x9f\x98\x80";
+  straddling += std::string(40, 'y');
+  ASSERT_TRUE(IsValid(straddling));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/utf8.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Number of bytes tested at once for ASCII, the width of an AVX2 register
+constexpr int64_t kASCIIBlockSize = 32;
+
+inline bool IsASCIIBlock(const uint8_t* data) {
+  uint8_t bits = 0;
+  for (int64_t i = 0; i < kASCIIBlockSize; ++i) {
+    bits |= data[i];
+  }
+  return bits < 0x80;
+}
+
+// The length of the well-formed multibyte sequence at the start of data, of
+// size bytes, or 0 if it is ill-formed (Unicode table 3-7)
+inline int64_t MultibyteSequenceLength(const uint8_t* data, int64_t size) {
+  const uint8_t lead = data[0];
+  int64_t length;
+  uint8_t low = 0x80, high = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+    low = lead == 0xE0 ? 0xA0 : 0x80;
+    high = lead == 0xED ? 0x9F : 0xBF;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    low = lead == 0xF0 ? 0x90 : 0x80;
+    high = lead == 0xF4 ? 0x8F : 0xBF;
+  } else {
+    return 0;
+  }
+  if (size < length || data[1] < low || data[1] > high) {
+    return 0;
+  }
+  for (int64_t i = 2; i < length; ++i) {
+    if (IsUTF8CharacterStart(data[i])) {
+      return 0;
+    }
+  }
+  return length;
+}
+
+#define ARROW_UTF8_LOOPS(NAME, TARGET)                                           \
+  TARGET bool ValidateUTF8##NAME(const uint8_t* data, int64_t size) {            \
+    int64_t i = 0;                                                               \
+    while (i < size) {                                                           \
+      if (i + kASCIIBlockSize <= size && IsASCIIBlock(data + i)) {               \
+        i += kASCIIBlockSize;                                                    \
+        continue;                                                                \
+      }                                                                          \
+      /* Decode the block, or the tail, one character at a time */               \
+      const int64_t block_end = std::min(i + kASCIIBlockSize, size);             \
+      while (i < block_end) {                                                    \
+        if (data[i] < 0x80) {                                                    \
+          ++i;                                                                   \
+          continue;                                                              \
+        }                                                                        \
+        const int64_t length = MultibyteSequenceLength(data + i, size - i);      \
+        if (length == 0) {                                                       \
+          return false;                                                          \
+        }                                                                        \
+        i += length;                                                             \
+      }                                                                          \
+    }                                                                            \
+    return true;                                                                 \
+  }
+
+ARROW_UTF8_LOOPS(Default, )
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+ARROW_UTF8_LOOPS(Avx2, ARROW_TARGET_AVX2)
+#endif
+
+#undef ARROW_UTF8_LOOPS
+
+struct ValidateUTF8Dynamic {
+  using FunctionType = bool (*)(const uint8_t*, int64_t);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+        {DispatchLevel::NONE, ValidateUTF8Default},
+#ifdef ARROW_HAVE_RUNTIME_DISPATCH
+        {DispatchLevel::AVX2, ValidateUTF8Avx2},
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+bool ValidateUTF8(const uint8_t* data, int64_t size) {
+  static DynamicDispatch<ValidateUTF8Dynamic> dispatch;
+  return dispatch.func(data, size);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_UTF8_H
+#define ARROW_UTIL_UTF8_H
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Whether a range of bytes is well-formed UTF-8
+///
+/// Runs of ASCII are skipped a block at a time, with AVX2 when available,
+/// and only multibyte sequences are decoded one by one. Overlong encodings,
+/// surrogates and code points above U+10FFFF are rejected.
+ARROW_EXPORT bool ValidateUTF8(const uint8_t* data, int64_t size);
+
+/// \brief Whether a byte starts a character, rather than continuing one
+inline bool IsUTF8CharacterStart(uint8_t byte) { return (byte & 0xC0) != 0x80; }
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_UTF8_H
@@ -53,9 +53,14 @@ ARRAY_VISITOR_DEFAULT(Time64Array);
 ARRAY_VISITOR_DEFAULT(TimestampArray);
 ARRAY_VISITOR_DEFAULT(IntervalArray);
 ARRAY_VISITOR_DEFAULT(ListArray);
+ARRAY_VISITOR_DEFAULT(LargeStringArray);
+ARRAY_VISITOR_DEFAULT(LargeBinaryArray);
+ARRAY_VISITOR_DEFAULT(LargeListArray);
+ARRAY_VISITOR_DEFAULT(StringViewArray);
 ARRAY_VISITOR_DEFAULT(StructArray);
 ARRAY_VISITOR_DEFAULT(UnionArray);
 ARRAY_VISITOR_DEFAULT(DictionaryArray);
+ARRAY_VISITOR_DEFAULT(RunLengthEncodedArray);
 ARRAY_VISITOR_DEFAULT(Decimal128Array);
 
 #undef ARRAY_VISITOR_DEFAULT
@@ -92,9 +97,14 @@ TYPE_VISITOR_DEFAULT(TimestampType);
 TYPE_VISITOR_DEFAULT(IntervalType);
 TYPE_VISITOR_DEFAULT(Decimal128Type);
 TYPE_VISITOR_DEFAULT(ListType);
+TYPE_VISITOR_DEFAULT(LargeStringType);
+TYPE_VISITOR_DEFAULT(LargeBinaryType);
+TYPE_VISITOR_DEFAULT(LargeListType);
+TYPE_VISITOR_DEFAULT(StringViewType);
 TYPE_VISITOR_DEFAULT(StructType);
 TYPE_VISITOR_DEFAULT(UnionType);
 TYPE_VISITOR_DEFAULT(DictionaryType);
+TYPE_VISITOR_DEFAULT(RunLengthEncodedType);
 
 #undef TYPE_VISITOR_DEFAULT
 
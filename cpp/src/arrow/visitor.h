@@ -52,9 +52,14 @@ class ARROW_EXPORT ArrayVisitor {
   virtual Status Visit(const IntervalArray& array);
   virtual Status Visit(const Decimal128Array& array);
   virtual Status Visit(const ListArray& array);
+  virtual Status Visit(const LargeStringArray& array);
+  virtual Status Visit(const LargeBinaryArray& array);
+  virtual Status Visit(const LargeListArray& array);
+  virtual Status Visit(const StringViewArray& array);
   virtual Status Visit(const StructArray& array);
   virtual Status Visit(const UnionArray& array);
   virtual Status Visit(const DictionaryArray& type);
+  virtual Status Visit(const RunLengthEncodedArray& array);
 };
 
 class ARROW_EXPORT TypeVisitor {
@@ -85,9 +90,14 @@ class ARROW_EXPORT TypeVisitor {
   virtual Status Visit(const IntervalType& type);
   virtual Status Visit(const Decimal128Type& type);
   virtual Status Visit(const ListType& type);
+  virtual Status Visit(const LargeStringType& type);
+  virtual Status Visit(const LargeBinaryType& type);
+  virtual Status Visit(const LargeListType& type);
+  virtual Status Visit(const StringViewType& type);
   virtual Status Visit(const StructType& type);
   virtual Status Visit(const UnionType& type);
   virtual Status Visit(const DictionaryType& type);
+  virtual Status Visit(const RunLengthEncodedType& type);
 };
 
 }  // namespace arrow
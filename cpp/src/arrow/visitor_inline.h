@@ -60,6 +60,11 @@ inline Status VisitTypeInline(const DataType& type, VISITOR* visitor) {
     TYPE_VISIT_INLINE(StructType);
     TYPE_VISIT_INLINE(UnionType);
     TYPE_VISIT_INLINE(DictionaryType);
+    TYPE_VISIT_INLINE(RunLengthEncodedType);
+    TYPE_VISIT_INLINE(LargeStringType);
+    TYPE_VISIT_INLINE(LargeBinaryType);
+    TYPE_VISIT_INLINE(LargeListType);
+    TYPE_VISIT_INLINE(StringViewType);
     default:
       break;
   }
@@ -102,6 +107,11 @@ inline Status VisitArrayInline(const Array& array, VISITOR* visitor) {
     ARRAY_VISIT_INLINE(StructType);
     ARRAY_VISIT_INLINE(UnionType);
     ARRAY_VISIT_INLINE(DictionaryType);
+    ARRAY_VISIT_INLINE(RunLengthEncodedType);
+    ARRAY_VISIT_INLINE(LargeStringType);
+    ARRAY_VISIT_INLINE(LargeBinaryType);
+    ARRAY_VISIT_INLINE(LargeListType);
+    ARRAY_VISIT_INLINE(StringViewType);
     default:
       break;
   }
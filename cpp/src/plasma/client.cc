@@ -24,8 +24,10 @@
 #endif
 
 #include <assert.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <strings.h>
@@ -37,17 +39,30 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <chrono>
+#include <list>
 #include <mutex>
-#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/memory.h"
+#include "arrow/util/parallel.h"
 #include "plasma/common.h"
+#include "plasma/digest.h"
 #include "plasma/fling.h"
 #include "plasma/io.h"
 #include "plasma/malloc.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
+#include "plasma/ring.h"
 
 #ifdef PLASMA_GPU
 #include "arrow/gpu/cuda_api.h"
@@ -58,28 +73,30 @@ using arrow::gpu::CudaContext;
 using arrow::gpu::CudaDeviceManager;
 #endif
 
-#define XXH_STATIC_LINKING_ONLY
-#include "thirdparty/xxhash.h"
-
-#define XXH64_DEFAULT_SEED 0
-
 namespace plasma {
 
 using arrow::MutableBuffer;
 
-// Number of threads used for memcopy and hash computations.
-constexpr int64_t kThreadPoolSize = 8;
-constexpr int64_t kBytesInMB = 1 << 20;
-static std::vector<std::thread> threadpool_(kThreadPoolSize);
+// Number of threads of the shared CPU thread pool used for memcopy and hash
+// computations.
+constexpr int kThreadPoolSize = 8;
+
+// Upper bound of the size of a get reply, so that get requests are only sent on
+// the rings when their reply fits in the ring of replies.
+constexpr int64_t kGetReplyOverhead = 1024;
+constexpr int64_t kGetReplyBytesPerObject = 256;
 
 struct ObjectInUseEntry {
   /// A count of the number of times this client has called PlasmaClient::Create
   /// or
   /// PlasmaClient::Get on this object ID minus the number of calls to
   /// PlasmaClient::Release.
-  /// When this count reaches zero, we remove the entry from the ObjectsInUse
+  /// When this count reaches zero, the object is added to the release history,
+  /// and once it leaves the history we remove the entry from the ObjectsInUse
   /// and decrement a count in the relevant ClientMmapTableEntry.
   int count;
+  /// The position of the object in the release history while count is zero.
+  std::list<ObjectID>::iterator release_history_position;
   /// Cached information to read the object.
   PlasmaObject object;
   /// A flag representing whether the object has been sealed.
@@ -101,7 +118,7 @@ static std::unordered_map<ObjectID, GpuProcessHandle*, UniqueIDHasher> gpu_objec
 static std::mutex gpu_mutex;
 #endif
 
-PlasmaClient::PlasmaClient() {
+PlasmaClient::PlasmaClient() : async_get_fd_(-1) {
 #ifdef PLASMA_GPU
   CudaDeviceManager::GetInstance(&manager_);
 #endif
@@ -173,7 +190,13 @@ void PlasmaClient::increment_object_count(const ObjectID& object_id, PlasmaObjec
     }
   } else {
     object_entry = elem->second.get();
-    ARROW_CHECK(object_entry->count > 0);
+    if (object_entry->count == 0) {
+      // The object was released but is still held from the store, so it is
+      // reused without telling the store.
+      release_history_.erase(object_entry->release_history_position);
+      released_object_bytes_ -=
+          object_entry->object.data_size + object_entry->object.metadata_size;
+    }
   }
   // Increment the count of the number of instances of this object that are
   // being used by this client. The corresponding decrement should happen in
@@ -212,7 +235,9 @@ Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
     // from the transfer.
     if (metadata != NULL) {
       // Copy the metadata to the buffer.
-      memcpy((*data)->mutable_data() + object.data_size, metadata, metadata_size);
+      arrow::internal::ParallelMemcopy((*data)->mutable_data() + object.data_size,
+                                       metadata, metadata_size, kThreadPoolSize,
+                                       BLOCK_SIZE);
     }
   } else {
 #ifdef PLASMA_GPU
@@ -247,6 +272,52 @@ Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
   return Status::OK();
 }
 
+Status PlasmaClient::CreateMany(const ObjectID* object_ids, int64_t num_objects,
+                                const int64_t* data_sizes, uint8_t** metadata,
+                                const int64_t* metadata_sizes,
+                                std::shared_ptr<Buffer>* data) {
+  ARROW_LOG(DEBUG) << "called plasma_create_many on conn " << store_conn_ << " for "
+                   << num_objects << " objects";
+  RETURN_NOT_OK(SendCreateManyRequest(store_conn_, object_ids, num_objects, data_sizes,
+                                      metadata_sizes));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType_PlasmaCreateManyReply, &buffer));
+  std::vector<ObjectID> received_object_ids;
+  std::vector<PlasmaObject> objects;
+  std::vector<int> store_fds;
+  std::vector<int64_t> mmap_sizes;
+  // If the reply included an error, then none of the objects was created and
+  // the store will not send file descriptors.
+  RETURN_NOT_OK(ReadCreateManyReply(buffer.data(), buffer.size(), &received_object_ids,
+                                    &objects, &store_fds, &mmap_sizes));
+  for (size_t i = 0; i < store_fds.size(); i++) {
+    int fd = recv_fd(store_conn_);
+    ARROW_CHECK(fd >= 0) << "recv not successful";
+    lookup_or_mmap(fd, store_fds[i], mmap_sizes[i]);
+  }
+
+  ARROW_CHECK(static_cast<int64_t>(objects.size()) == num_objects);
+  for (int64_t i = 0; i < num_objects; ++i) {
+    PlasmaObject* object = &objects[i];
+    ARROW_CHECK(object->data_size == data_sizes[i]);
+    ARROW_CHECK(object->metadata_size == metadata_sizes[i]);
+    // The metadata should come right after the data.
+    ARROW_CHECK(object->metadata_offset == object->data_offset + data_sizes[i]);
+    uint8_t* pointer = lookup_mmapped_file(object->store_fd) + object->data_offset;
+    data[i] = std::make_shared<MutableBuffer>(pointer, data_sizes[i]);
+    if (metadata != NULL && metadata[i] != NULL) {
+      // Copy the metadata to the buffer.
+      arrow::internal::ParallelMemcopy(pointer + data_sizes[i], metadata[i],
+                                       metadata_sizes[i], kThreadPoolSize, BLOCK_SIZE);
+    }
+    // As in Create, one reference is for the caller and one is released by
+    // Seal.
+    increment_object_count(object_ids[i], object, false);
+    increment_object_count(object_ids[i], object, false);
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
                          int64_t timeout_ms, ObjectBuffer* object_buffers) {
   // Fill out the info for the objects that are already in use locally.
@@ -299,17 +370,47 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
   }
 
   // If we get here, then the objects aren't all currently in use by this
-  // client, so we need to send a request to the plasma store.
-  RETURN_NOT_OK(SendGetRequest(store_conn_, object_ids, num_objects, timeout_ms));
+  // client, so we need to send a request to the plasma store for the missing
+  // ones. The store does not send again the descriptors of the files we have
+  // mapped.
+  std::vector<ObjectID> missing_object_ids;
+  std::unordered_set<ObjectID, UniqueIDHasher> missing_object_set;
+  for (int64_t i = 0; i < num_objects; ++i) {
+    if (object_buffers[i].data_size == -1 &&
+        missing_object_set.insert(object_ids[i]).second) {
+      missing_object_ids.push_back(object_ids[i]);
+    }
+  }
+  const int64_t num_missing = static_cast<int64_t>(missing_object_ids.size());
+  std::vector<int> mapped_fds;
+  for (const auto& entry : mmap_table_) {
+    mapped_fds.push_back(entry.first);
+  }
   std::vector<uint8_t> buffer;
-  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType_PlasmaGetReply, &buffer));
-  std::vector<ObjectID> received_object_ids(num_objects);
-  std::vector<PlasmaObject> object_data(num_objects);
+  if (request_ring_ &&
+      reply_ring_->Fits(kGetReplyOverhead + num_missing * kGetReplyBytesPerObject) &&
+      SendGetRequest(request_ring_.get(), missing_object_ids.data(), num_missing,
+                     timeout_ms, mapped_fds)
+          .ok()) {
+    RETURN_NOT_OK(PlasmaReceive(reply_ring_.get(), store_conn_,
+                                MessageType_PlasmaGetReply, &buffer));
+  } else {
+    RETURN_NOT_OK(SendGetRequest(store_conn_, missing_object_ids.data(), num_missing,
+                                 timeout_ms, mapped_fds));
+    RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType_PlasmaGetReply, &buffer));
+  }
+  std::vector<ObjectID> received_object_ids(num_missing);
+  std::vector<PlasmaObject> object_data(num_missing);
   PlasmaObject* object;
   std::vector<int> store_fds;
   std::vector<int64_t> mmap_sizes;
   RETURN_NOT_OK(ReadGetReply(buffer.data(), buffer.size(), received_object_ids.data(),
-                             object_data.data(), num_objects, store_fds, mmap_sizes));
+                             object_data.data(), num_missing, store_fds, mmap_sizes));
+  std::unordered_map<ObjectID, PlasmaObject*, UniqueIDHasher> received_objects;
+  for (int64_t i = 0; i < num_missing; ++i) {
+    DCHECK(received_object_ids[i] == missing_object_ids[i]);
+    received_objects[received_object_ids[i]] = &object_data[i];
+  }
 
   // We mmap all of the file descriptors here so that we can avoid look them up
   // in the subsequent loop based on just the store file descriptor and without
@@ -321,16 +422,12 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
   }
 
   for (int i = 0; i < num_objects; ++i) {
-    DCHECK(received_object_ids[i] == object_ids[i]);
-    object = &object_data[i];
     if (object_buffers[i].data_size != -1) {
-      // If the object was already in use by the client, then the store should
-      // have returned it.
-      DCHECK_NE(object->data_size, -1);
       // We've already filled out the information for this object, so we can
       // just continue.
       continue;
     }
+    object = received_objects[object_ids[i]];
     // If we are here, the object was not currently in use, so we need to
     // process the reply from the object store.
     if (object->data_size != -1) {
@@ -372,7 +469,7 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
       // client is using. A call to PlasmaClient::Release is required to
       // decrement this
       // count. Cache the reference to the object.
-      increment_object_count(received_object_ids[i], object, true);
+      increment_object_count(object_ids[i], object, true);
     } else {
       // The object was not retrieved. Make sure we already put a -1 here to
       // indicate that the object was not retrieved. The caller is not
@@ -384,6 +481,102 @@ Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
   return Status::OK();
 }
 
+Status PlasmaClient::GetAsync(const ObjectID* object_ids, int64_t num_objects) {
+  if (async_get_fd_ < 0) {
+    // Subscribe before looking for the objects, so that no seal is missed.
+    RETURN_NOT_OK(Subscribe(&async_get_fd_));
+  }
+  pending_objects_.insert(object_ids, object_ids + num_objects);
+  // Take the objects that are already there. This also reads back those that
+  // were spilled, which are then notified when they are sealed again.
+  std::vector<ObjectBuffer> object_buffers(num_objects);
+  RETURN_NOT_OK(Get(object_ids, num_objects, 0, object_buffers.data()));
+  for (int64_t i = 0; i < num_objects; ++i) {
+    if (object_buffers[i].data_size == -1) {
+      continue;
+    }
+    if (pending_objects_.erase(object_ids[i]) == 0) {
+      // The same object was requested twice in this call.
+      RETURN_NOT_OK(Release(object_ids[i]));
+      continue;
+    }
+    ready_objects_.emplace_back(object_ids[i], object_buffers[i]);
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::ProcessAsyncGetNotifications() {
+  std::vector<ObjectID> sealed_object_ids;
+  std::vector<ObjectID> object_ids;
+  std::vector<int64_t> data_sizes;
+  std::vector<int64_t> metadata_sizes;
+  struct pollfd poll_fd = {async_get_fd_, POLLIN, 0};
+  while (!notifications_[async_get_fd_].empty() || poll(&poll_fd, 1, 0) > 0) {
+    RETURN_NOT_OK(
+        GetNotifications(async_get_fd_, &object_ids, &data_sizes, &metadata_sizes));
+    for (size_t i = 0; i < object_ids.size(); ++i) {
+      if (data_sizes[i] != -1 && pending_objects_.count(object_ids[i]) != 0) {
+        sealed_object_ids.push_back(object_ids[i]);
+      }
+    }
+  }
+  if (sealed_object_ids.empty()) {
+    return Status::OK();
+  }
+  const int64_t num_objects = static_cast<int64_t>(sealed_object_ids.size());
+  std::vector<ObjectBuffer> object_buffers(num_objects);
+  RETURN_NOT_OK(Get(sealed_object_ids.data(), num_objects, 0, object_buffers.data()));
+  for (int64_t i = 0; i < num_objects; ++i) {
+    // An object may be notified before it is sealed, or be evicted again
+    // before we get it, then it stays pending.
+    if (object_buffers[i].data_size == -1) {
+      continue;
+    }
+    if (pending_objects_.erase(sealed_object_ids[i]) == 0) {
+      RETURN_NOT_OK(Release(sealed_object_ids[i]));
+      continue;
+    }
+    ready_objects_.emplace_back(sealed_object_ids[i], object_buffers[i]);
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::WaitAny(int64_t timeout_ms, std::vector<ObjectID>* object_ids,
+                             std::vector<ObjectBuffer>* object_buffers) {
+  object_ids->clear();
+  object_buffers->clear();
+  if (async_get_fd_ < 0) {
+    return Status::Invalid("No objects were requested with GetAsync");
+  }
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout_ms);
+  RETURN_NOT_OK(ProcessAsyncGetNotifications());
+  while (ready_objects_.empty() && !pending_objects_.empty()) {
+    int poll_timeout_ms = -1;
+    if (timeout_ms != -1) {
+      const auto remaining =
+          std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+      if (remaining.count() <= 0) {
+        break;
+      }
+      poll_timeout_ms = static_cast<int>(remaining.count());
+    }
+    struct pollfd poll_fd = {async_get_fd_, POLLIN, 0};
+    if (poll(&poll_fd, 1, poll_timeout_ms) < 0 && errno != EINTR) {
+      return Status::IOError("Failed to poll the notifications of sealed objects");
+    }
+    RETURN_NOT_OK(ProcessAsyncGetNotifications());
+  }
+  for (auto& ready_object : ready_objects_) {
+    object_ids->push_back(ready_object.first);
+    object_buffers->push_back(std::move(ready_object.second));
+  }
+  ready_objects_.clear();
+  return Status::OK();
+}
+
+int PlasmaClient::async_get_fd() const { return async_get_fd_; }
+
 Status PlasmaClient::UnmapObject(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end());
@@ -419,54 +612,82 @@ Status PlasmaClient::UnmapObject(const ObjectID& object_id) {
   return Status::OK();
 }
 
-/// This is a helper method for implementing plasma_release. We maintain a
-/// buffer
-/// of release calls and only perform them once the buffer becomes full (as
-/// judged by the aggregate sizes of the objects). There may be multiple release
-/// calls for the same object ID in the buffer. In this case, the first release
-/// calls will not do anything. The client will only send a message to the store
-/// releasing the object when the client is truly done with the object.
+/// This is a helper method for implementing plasma_release. Objects that the
+/// client no longer uses are kept in the release history, and only released
+/// to the store once they leave it (as judged by the number and aggregate
+/// sizes of the objects in it). The object ID is taken by value as it is
+/// usually the one at the end of the history, which is removed here.
 ///
-/// @param object_id The object ID to attempt to release.
-Status PlasmaClient::PerformRelease(const ObjectID& object_id) {
-  // Decrement the count of the number of instances of this object that are
-  // being used by this client. The corresponding increment should have happened
-  // in PlasmaClient::Get.
+/// @param object_id The object ID to release.
+/// @param released The object ID is appended here, as the store must be told
+///        that the client no longer needs the object.
+Status PlasmaClient::PerformRelease(ObjectID object_id,
+                                    std::vector<ObjectID>* released) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end());
-  object_entry->second->count -= 1;
-  ARROW_CHECK(object_entry->second->count >= 0);
-  // Check if the client is no longer using this object.
-  if (object_entry->second->count == 0) {
-    // Tell the store that the client no longer needs the object.
-    RETURN_NOT_OK(UnmapObject(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+  ARROW_CHECK(object_entry->second->count == 0);
+  release_history_.erase(object_entry->second->release_history_position);
+  released_object_bytes_ -=
+      object_entry->second->object.data_size + object_entry->second->object.metadata_size;
+  // The store will be told that the client no longer needs the object.
+  RETURN_NOT_OK(UnmapObject(object_id));
+  released->push_back(object_id);
+  return Status::OK();
+}
+
+Status PlasmaClient::SendReleases(const std::vector<ObjectID>& object_ids) {
+  if (object_ids.size() == 1) {
+    if (!request_ring_ ||
+        SendReleaseRequest(request_ring_.get(), object_ids[0]).IsOutOfMemory()) {
+      return SendReleaseRequest(store_conn_, object_ids[0]);
+    }
+  } else if (object_ids.size() > 1) {
+    if (!request_ring_ || SendReleaseManyRequest(request_ring_.get(), object_ids.data(),
+                                                 object_ids.size())
+                              .IsOutOfMemory()) {
+      return SendReleaseManyRequest(store_conn_, object_ids.data(), object_ids.size());
+    }
   }
   return Status::OK();
 }
 
 Status PlasmaClient::Release(const ObjectID& object_id) {
+  return ReleaseMany(&object_id, 1);
+}
+
+Status PlasmaClient::ReleaseMany(const ObjectID* object_ids, int64_t num_objects) {
   // If the client is already disconnected, ignore release requests.
   if (store_conn_ < 0) {
     return Status::OK();
   }
-  // Add the new object to the release history.
-  release_history_.push_front(object_id);
-  // If there are too many bytes in use by the client or if there are too many
-  // pending release calls, and there are at least some pending release calls in
-  // the release_history list, then release some objects.
+  // Decrement the count of the number of instances of this object that are
+  // being used by this client. The corresponding increment should have happened
+  // in PlasmaClient::Get. Objects that are no longer used are added to the
+  // release history.
+  for (int64_t i = 0; i < num_objects; ++i) {
+    auto object_entry = objects_in_use_.find(object_ids[i]);
+    ARROW_CHECK(object_entry != objects_in_use_.end());
+    ObjectInUseEntry* entry = object_entry->second.get();
+    ARROW_CHECK(entry->count > 0);
+    if (--entry->count == 0) {
+      release_history_.push_front(object_ids[i]);
+      entry->release_history_position = release_history_.begin();
+      released_object_bytes_ += entry->object.data_size + entry->object.metadata_size;
+    }
+  }
+  // If there are too many bytes held by the release history or too many
+  // objects in it, then release the least recently used ones.
 
   // TODO(wap) Evicition policy only works on host memory, and thus objects
   //           on the GPU cannot be released currently.
-  while ((in_use_object_bytes_ > std::min(kL3CacheSizeBytes, store_capacity_ / 100) ||
+  std::vector<ObjectID> released;
+  while ((released_object_bytes_ > std::min(kL3CacheSizeBytes, store_capacity_ / 100) ||
           release_history_.size() > config_.release_delay) &&
          release_history_.size() > 0) {
-    // Perform a release for the object ID for the first pending release.
-    RETURN_NOT_OK(PerformRelease(release_history_.back()));
-    // Remove the last entry from the release history.
-    release_history_.pop_back();
+    RETURN_NOT_OK(PerformRelease(release_history_.back(), &released));
   }
-  return Status::OK();
+  // Tell the store about all the objects released with a single message.
+  return SendReleases(released);
 }
 
 Status PlasmaClient::FlushReleaseHistory() {
@@ -474,13 +695,11 @@ Status PlasmaClient::FlushReleaseHistory() {
   if (store_conn_ < 0) {
     return Status::OK();
   }
+  std::vector<ObjectID> released;
   while (release_history_.size() > 0) {
-    // Perform a release for the object ID for the first pending release.
-    RETURN_NOT_OK(PerformRelease(release_history_.back()));
-    // Remove the last entry from the release history.
-    release_history_.pop_back();
+    RETURN_NOT_OK(PerformRelease(release_history_.back(), &released));
   }
-  return Status::OK();
+  return SendReleases(released);
 }
 
 // This method is used to query whether the plasma store contains an object.
@@ -502,72 +721,32 @@ Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return Status::OK();
 }
 
-static void ComputeBlockHash(const unsigned char* data, int64_t nbytes, uint64_t* hash) {
-  XXH64_state_t hash_state;
-  XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
-  XXH64_update(&hash_state, data, nbytes);
-  *hash = XXH64_digest(&hash_state);
-}
-
-static inline bool compute_object_hash_parallel(XXH64_state_t* hash_state,
-                                                const unsigned char* data,
-                                                int64_t nbytes) {
-  // Note that this function will likely be faster if the address of data is
-  // aligned on a 64-byte boundary.
-  const int num_threads = kThreadPoolSize;
-  uint64_t threadhash[num_threads + 1];
-  const uint64_t data_address = reinterpret_cast<uint64_t>(data);
-  const uint64_t num_blocks = nbytes / BLOCK_SIZE;
-  const uint64_t chunk_size = (num_blocks / num_threads) * BLOCK_SIZE;
-  const uint64_t right_address = data_address + chunk_size * num_threads;
-  const uint64_t suffix = (data_address + nbytes) - right_address;
-  // Now the data layout is | k * num_threads * block_size | suffix | ==
-  // | num_threads * chunk_size | suffix |, where chunk_size = k * block_size.
-  // Each thread gets a "chunk" of k blocks, except the suffix thread.
-
-  for (int i = 0; i < num_threads; i++) {
-    threadpool_[i] = std::thread(
-        ComputeBlockHash, reinterpret_cast<uint8_t*>(data_address) + i * chunk_size,
-        chunk_size, &threadhash[i]);
-  }
-  ComputeBlockHash(reinterpret_cast<uint8_t*>(right_address), suffix,
-                   &threadhash[num_threads]);
-
-  // Join the threads.
-  for (auto& t : threadpool_) {
-    if (t.joinable()) {
-      t.join();
-    }
-  }
-
-  XXH64_update(hash_state, reinterpret_cast<unsigned char*>(threadhash),
-               sizeof(threadhash));
-  return true;
-}
-
-static uint64_t compute_object_hash(const ObjectBuffer& obj_buffer) {
-  XXH64_state_t hash_state;
-  if (obj_buffer.device_num != 0) {
+void PlasmaClient::ComputeDigest(const PlasmaObject& object, uint8_t* digest) {
+  if (object.device_num != 0) {
     // TODO(wap): Create cuda program to hash data on gpu.
-    return 0;
+    memset(digest, 0, kDigestSize);
+    return;
   }
-  XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
-  if (obj_buffer.data_size >= kBytesInMB) {
-    compute_object_hash_parallel(
-        &hash_state, reinterpret_cast<const unsigned char*>(obj_buffer.data->data()),
-        obj_buffer.data_size);
-  } else {
-    XXH64_update(&hash_state,
-                 reinterpret_cast<const unsigned char*>(obj_buffer.data->data()),
-                 obj_buffer.data_size);
-  }
-  XXH64_update(&hash_state,
-               reinterpret_cast<const unsigned char*>(obj_buffer.metadata->data()),
-               obj_buffer.metadata_size);
-  return XXH64_digest(&hash_state);
+  // The metadata comes right after the data.
+  const uint8_t* data = lookup_mmapped_file(object.store_fd) + object.data_offset;
+  ComputeObjectDigest(data, object.data_size, data + object.data_size,
+                      object.metadata_size, kThreadPoolSize, digest);
 }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) {
+  // Make sure this client has a reference to the object before sending the
+  // request to Plasma.
+  auto object_entry = objects_in_use_.find(object_id);
+  ARROW_CHECK(object_entry != objects_in_use_.end())
+      << "Plasma client called seal an object without a reference to it";
+  ARROW_CHECK(!object_entry->second->is_sealed)
+      << "Plasma client called seal an already sealed object";
+  unsigned char digest[kDigestSize];
+  ComputeDigest(object_entry->second->object, &digest[0]);
+  return Seal(object_id, &digest[0]);
+}
+
+Status PlasmaClient::Seal(const ObjectID& object_id, const uint8_t* digest) {
   // Make sure this client has a reference to the object before sending the
   // request to Plasma.
   auto object_entry = objects_in_use_.find(object_id);
@@ -577,9 +756,14 @@ Status PlasmaClient::Seal(const ObjectID& object_id) {
       << "Plasma client called seal an already sealed object";
   object_entry->second->is_sealed = true;
   /// Send the seal request to Plasma.
-  static unsigned char digest[kDigestSize];
-  RETURN_NOT_OK(Hash(object_id, &digest[0]));
-  RETURN_NOT_OK(SendSealRequest(store_conn_, object_id, &digest[0]));
+  unsigned char object_digest[kDigestSize] = {0};
+  if (digest != nullptr) {
+    memcpy(object_digest, digest, kDigestSize);
+  }
+  if (!request_ring_ ||
+      SendSealRequest(request_ring_.get(), object_id, object_digest).IsOutOfMemory()) {
+    RETURN_NOT_OK(SendSealRequest(store_conn_, object_id, object_digest));
+  }
   // We call PlasmaClient::Release to decrement the number of instances of this
   // object
   // that are currently being used by this client. The corresponding increment
@@ -588,6 +772,27 @@ Status PlasmaClient::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::SealMany(const ObjectID* object_ids, int64_t num_objects) {
+  std::vector<unsigned char> digests(num_objects * kDigestSize);
+  for (int64_t i = 0; i < num_objects; ++i) {
+    auto object_entry = objects_in_use_.find(object_ids[i]);
+    ARROW_CHECK(object_entry != objects_in_use_.end())
+        << "Plasma client called seal an object without a reference to it";
+    ARROW_CHECK(!object_entry->second->is_sealed)
+        << "Plasma client called seal an already sealed object";
+    object_entry->second->is_sealed = true;
+    ComputeDigest(object_entry->second->object, &digests[i * kDigestSize]);
+  }
+  if (!request_ring_ ||
+      SendSealManyRequest(request_ring_.get(), object_ids, num_objects, digests.data())
+          .IsOutOfMemory()) {
+    RETURN_NOT_OK(
+        SendSealManyRequest(store_conn_, object_ids, num_objects, digests.data()));
+  }
+  // Drop the references taken by Create or CreateMany, as Seal does.
+  return ReleaseMany(object_ids, num_objects);
+}
+
 Status PlasmaClient::Abort(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end())
@@ -634,6 +839,15 @@ Status PlasmaClient::Delete(const ObjectID& object_id) {
   }
 }
 
+Status PlasmaClient::Pin(const ObjectID& object_id, bool pinned) {
+  RETURN_NOT_OK(SendPinRequest(store_conn_, object_id, pinned));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType_PlasmaPinReply, &buffer));
+  ObjectID object_id2;
+  DCHECK_GT(buffer.size(), 0);
+  return ReadPinReply(buffer.data(), buffer.size(), &object_id2);
+}
+
 Status PlasmaClient::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   // Send a request to the store to evict objects.
   RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
@@ -644,6 +858,14 @@ Status PlasmaClient::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   return ReadEvictReply(buffer.data(), buffer.size(), num_bytes_evicted);
 }
 
+Status PlasmaClient::Metrics(StoreMetrics* metrics) {
+  RETURN_NOT_OK(SendMetricsRequest(store_conn_));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType_PlasmaMetricsReply, &buffer));
+  DCHECK_GT(buffer.size(), 0);
+  return ReadMetricsReply(buffer.data(), buffer.size(), metrics);
+}
+
 Status PlasmaClient::Hash(const ObjectID& object_id, uint8_t* digest) {
   // Get the plasma object data. We pass in a timeout of 0 to indicate that
   // the operation should timeout immediately.
@@ -654,12 +876,140 @@ Status PlasmaClient::Hash(const ObjectID& object_id, uint8_t* digest) {
     return Status::PlasmaObjectNonexistent("Object not found");
   }
   // Compute the hash.
-  uint64_t hash = compute_object_hash(object_buffer);
-  memcpy(digest, &hash, sizeof(hash));
+  if (object_buffer.device_num != 0) {
+    // TODO(wap): Create cuda program to hash data on gpu.
+    memset(digest, 0, kDigestSize);
+  } else {
+    ComputeObjectDigest(object_buffer.data->data(), object_buffer.data_size,
+                        object_buffer.metadata->data(), object_buffer.metadata_size,
+                        kThreadPoolSize, digest);
+  }
   // Release the plasma object.
   return Release(object_id);
 }
 
+namespace {
+
+/// The buffer of an object that was gotten by a client, which releases the
+/// object once the buffer and the slices of it are destroyed.
+class PlasmaBuffer : public Buffer {
+ public:
+  PlasmaBuffer(PlasmaClient* client, const ObjectID& object_id,
+               const std::shared_ptr<Buffer>& buffer)
+      : Buffer(buffer, 0, buffer->size()), client_(client), object_id_(object_id) {}
+
+  ~PlasmaBuffer() override {
+    Status s = client_->Release(object_id_);
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to release object " << object_id_.hex() << ": "
+                         << s.ToString();
+    }
+  }
+
+ private:
+  PlasmaClient* client_;
+  ObjectID object_id_;
+};
+
+Status WriteStream(
+    arrow::io::OutputStream* sink, const std::shared_ptr<arrow::Schema>& schema,
+    const std::function<Status(arrow::ipc::RecordBatchWriter*)>& write_batches) {
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+  RETURN_NOT_OK(arrow::ipc::RecordBatchStreamWriter::Open(sink, schema, &writer));
+  RETURN_NOT_OK(write_batches(writer.get()));
+  return writer->Close();
+}
+
+}  // namespace
+
+Status PlasmaClient::PutStream(
+    const ObjectID& object_id, const std::shared_ptr<arrow::Schema>& schema,
+    const std::function<Status(arrow::ipc::RecordBatchWriter*)>& write_batches) {
+  arrow::io::MockOutputStream mock_stream;
+  RETURN_NOT_OK(WriteStream(&mock_stream, schema, write_batches));
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(
+      Create(object_id, mock_stream.GetExtentBytesWritten(), nullptr, 0, &data));
+  // The bodies of the batches are copied with several threads.
+  arrow::io::FixedSizeBufferWriter stream(data);
+  stream.set_memcopy_threads(kThreadPoolSize);
+  Status s = WriteStream(&stream, schema, write_batches);
+  if (!s.ok()) {
+    RETURN_NOT_OK(Abort(object_id));
+    return s;
+  }
+  return Seal(object_id);
+}
+
+Status PlasmaClient::PutRecordBatch(const ObjectID& object_id,
+                                    const arrow::RecordBatch& batch) {
+  return PutStream(object_id, batch.schema(),
+                   [&batch](arrow::ipc::RecordBatchWriter* writer) {
+                     return writer->WriteRecordBatch(batch);
+                   });
+}
+
+Status PlasmaClient::PutTable(const ObjectID& object_id, const arrow::Table& table) {
+  return PutStream(object_id, table.schema(),
+                   [&table](arrow::ipc::RecordBatchWriter* writer) {
+                     return writer->WriteTable(table);
+                   });
+}
+
+Status PlasmaClient::GetStream(const ObjectID& object_id, int64_t timeout_ms,
+                               std::shared_ptr<arrow::RecordBatchReader>* out) {
+  out->reset();
+  ObjectBuffer object_buffer;
+  RETURN_NOT_OK(Get(&object_id, 1, timeout_ms, &object_buffer));
+  if (object_buffer.data_size == -1) {
+    return Status::OK();
+  }
+  if (object_buffer.device_num != 0) {
+    RETURN_NOT_OK(Release(object_id));
+    return Status::NotImplemented("Reading record batches from GPU objects");
+  }
+  // From now on, the object is released with the last reference to its buffer.
+  std::shared_ptr<Buffer> data =
+      std::make_shared<PlasmaBuffer>(this, object_id, object_buffer.data);
+  auto stream = std::make_shared<arrow::io::BufferReader>(data);
+  return arrow::ipc::RecordBatchStreamReader::Open(stream, out);
+}
+
+Status PlasmaClient::GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                                    std::shared_ptr<arrow::RecordBatch>* out) {
+  out->reset();
+  std::shared_ptr<arrow::RecordBatchReader> reader;
+  RETURN_NOT_OK(GetStream(object_id, timeout_ms, &reader));
+  if (!reader) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(reader->ReadNext(out));
+  if (!*out) {
+    return Status::Invalid("Object " + object_id.hex() + " holds no record batch");
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::GetTable(const ObjectID& object_id, int64_t timeout_ms,
+                              std::shared_ptr<arrow::Table>* out) {
+  out->reset();
+  std::shared_ptr<arrow::RecordBatchReader> reader;
+  RETURN_NOT_OK(GetStream(object_id, timeout_ms, &reader));
+  if (!reader) {
+    return Status::OK();
+  }
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  return arrow::Table::FromRecordBatches(reader->schema(), batches, out);
+}
+
 Status PlasmaClient::Subscribe(int* fd) {
   int sock[2];
   // Create a non-blocking socket pair. This will only be used to send
@@ -680,23 +1030,60 @@ Status PlasmaClient::Subscribe(int* fd) {
   return Status::OK();
 }
 
+Status PlasmaClient::ReadNotifications(int fd) {
+  uint8_t* message = read_message_async(fd);
+  if (message == NULL) {
+    return Status::IOError("Failed to read object notifications from Plasma socket");
+  }
+  auto batch = flatbuffers::GetRoot<ObjectInfoBatch>(message);
+  auto& notifications = notifications_[fd];
+  for (const auto object_info : *batch->object_info()) {
+    ARROW_CHECK(object_info->object_id()->size() == sizeof(ObjectID));
+    Notification notification;
+    memcpy(&notification.object_id, object_info->object_id()->data(), sizeof(ObjectID));
+    if (object_info->is_deletion()) {
+      notification.data_size = -1;
+      notification.metadata_size = -1;
+    } else {
+      notification.data_size = object_info->data_size();
+      notification.metadata_size = object_info->metadata_size();
+    }
+    notifications.push_back(notification);
+  }
+  free(message);
+  return Status::OK();
+}
+
 Status PlasmaClient::GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                                      int64_t* metadata_size) {
-  uint8_t* notification = read_message_async(fd);
-  if (notification == NULL) {
-    return Status::IOError("Failed to read object notification from Plasma socket");
-  }
-  auto object_info = flatbuffers::GetRoot<ObjectInfo>(notification);
-  ARROW_CHECK(object_info->object_id()->size() == sizeof(ObjectID));
-  memcpy(object_id, object_info->object_id()->data(), sizeof(ObjectID));
-  if (object_info->is_deletion()) {
-    *data_size = -1;
-    *metadata_size = -1;
-  } else {
-    *data_size = object_info->data_size();
-    *metadata_size = object_info->metadata_size();
+  // Batches are never empty, but skip any just in case.
+  while (notifications_[fd].empty()) {
+    RETURN_NOT_OK(ReadNotifications(fd));
+  }
+  auto& notifications = notifications_[fd];
+  *object_id = notifications.front().object_id;
+  *data_size = notifications.front().data_size;
+  *metadata_size = notifications.front().metadata_size;
+  notifications.pop_front();
+  return Status::OK();
+}
+
+Status PlasmaClient::GetNotifications(int fd, std::vector<ObjectID>* object_ids,
+                                      std::vector<int64_t>* data_sizes,
+                                      std::vector<int64_t>* metadata_sizes) {
+  object_ids->clear();
+  data_sizes->clear();
+  metadata_sizes->clear();
+  while (notifications_[fd].empty()) {
+    RETURN_NOT_OK(ReadNotifications(fd));
+  }
+  auto& notifications = notifications_[fd];
+  for (const auto& notification : notifications) {
+    object_ids->push_back(notification.object_id);
+    data_sizes->push_back(notification.data_size);
+    metadata_sizes->push_back(notification.metadata_size);
   }
-  delete[] notification;
+  notifications.clear();
   return Status::OK();
 }
 
@@ -712,6 +1099,7 @@ Status PlasmaClient::Connect(const std::string& store_socket_name,
   }
   config_.release_delay = release_delay;
   in_use_object_bytes_ = 0;
+  released_object_bytes_ = 0;
   // Send a ConnectRequest to the store to get its memory capacity.
   RETURN_NOT_OK(SendConnectRequest(store_conn_));
   std::vector<uint8_t> buffer;
@@ -720,6 +1108,27 @@ Status PlasmaClient::Connect(const std::string& store_socket_name,
   return Status::OK();
 }
 
+Status PlasmaClient::ConnectRings(int64_t capacity) {
+  ARROW_CHECK(!request_ring_) << "The rings are already set up";
+  std::unique_ptr<MessageRing> request_ring;
+  std::unique_ptr<MessageRing> reply_ring;
+  RETURN_NOT_OK(MessageRing::Create(capacity, &request_ring));
+  RETURN_NOT_OK(MessageRing::Create(capacity, &reply_ring));
+  RETURN_NOT_OK(SendConnectRingRequest(store_conn_));
+  for (int fd : {request_ring->memory_fd(), request_ring->doorbell_fd(),
+                 reply_ring->memory_fd(), reply_ring->doorbell_fd()}) {
+    if (send_fd(store_conn_, fd) < 0) {
+      return Status::IOError("Failed to send the descriptors of the rings");
+    }
+  }
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType_PlasmaConnectRingReply, &buffer));
+  RETURN_NOT_OK(ReadConnectRingReply(buffer.data(), buffer.size()));
+  request_ring_ = std::move(request_ring);
+  reply_ring_ = std::move(reply_ring);
+  return Status::OK();
+}
+
 Status PlasmaClient::Disconnect() {
   // NOTE: We purposefully do not finish sending release calls for objects in
   // use, so that we don't duplicate PlasmaClient::Release calls (when handling
@@ -729,6 +1138,14 @@ Status PlasmaClient::Disconnect() {
   // that were in use by us when handling the SIGPIPE.
   close(store_conn_);
   store_conn_ = -1;
+  request_ring_.reset();
+  reply_ring_.reset();
+  if (async_get_fd_ >= 0) {
+    close(async_get_fd_);
+    async_get_fd_ = -1;
+  }
+  pending_objects_.clear();
+  ready_objects_.clear();
   if (manager_conn_ >= 0) {
     close(manager_conn_);
     manager_conn_ = -1;
@@ -737,7 +1154,8 @@ Status PlasmaClient::Disconnect() {
 }
 
 Status PlasmaClient::Transfer(const char* address, int port, const ObjectID& object_id) {
-  return SendDataRequest(manager_conn_, object_id, address, port);
+  return SendDataRequest(manager_conn_ >= 0 ? manager_conn_ : store_conn_, object_id,
+                         address, port);
 }
 
 Status PlasmaClient::Fetch(int num_object_ids, const ObjectID* object_ids) {
@@ -22,14 +22,24 @@
 #include <time.h>
 
 #include <deque>
+#include <functional>
+#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 #include "plasma/common.h"
+#include "plasma/digest.h"
+#include "plasma/metrics.h"
+#include "plasma/object_map.h"
+#include "plasma/ring.h"
 #ifdef PLASMA_GPU
 #include "arrow/gpu/cuda_api.h"
 #endif
@@ -37,6 +47,13 @@
 using arrow::Buffer;
 using arrow::Status;
 
+namespace arrow {
+class RecordBatchReader;
+namespace ipc {
+class RecordBatchWriter;
+}  // namespace ipc
+}  // namespace arrow
+
 namespace plasma {
 
 #define PLASMA_DEFAULT_RELEASE_DELAY 64
@@ -102,6 +119,16 @@ class ARROW_EXPORT PlasmaClient {
                  const std::string& manager_socket_name, int release_delay,
                  int num_retries = -1);
 
+  /// Set up shared-memory rings with the store, on which Get, Seal and Release
+  /// requests are then exchanged instead of on the socket. Requests and
+  /// replies then only need system calls when the other side is waiting, to
+  /// wake it up, and Get calls spin briefly for the reply before waiting.
+  /// Only supported on Linux.
+  ///
+  /// \param capacity The number of bytes of messages each ring can hold.
+  /// \return The return status.
+  Status ConnectRings(int64_t capacity = kDefaultRingCapacity);
+
   /// Create an object in the Plasma Store. Any metadata for this object must be
   /// be passed in when the object is created.
   ///
@@ -123,6 +150,22 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Create(const ObjectID& object_id, int64_t data_size, uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
+
+  /// Create several objects in host memory with a single round trip to the
+  /// Plasma Store. Either all of the objects are created, or none of them.
+  ///
+  /// \param object_ids The IDs to use for the newly created objects.
+  /// \param num_objects The number of objects to create.
+  /// \param data_sizes The sizes in bytes of the objects' data.
+  /// \param metadata The objects' metadata. If an object has no metadata, its
+  ///        pointer should be NULL. If no object has metadata, this can be NULL.
+  /// \param metadata_sizes The sizes in bytes of the objects' metadata.
+  /// \param data The addresses of the newly created objects will be written
+  ///        here.
+  /// \return The return status.
+  Status CreateMany(const ObjectID* object_ids, int64_t num_objects,
+                    const int64_t* data_sizes, uint8_t** metadata,
+                    const int64_t* metadata_sizes, std::shared_ptr<Buffer>* data);
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout
@@ -141,6 +184,37 @@ class ARROW_EXPORT PlasmaClient {
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
+  /// Start getting some objects without waiting for them. The objects are
+  /// returned by WaitAny once they are sealed, the objects already in the store
+  /// by the next call to WaitAny. A single thread can so wait for many objects
+  /// at once, and overlap the wait with other work.
+  ///
+  /// \param object_ids The IDs of the objects to get.
+  /// \param num_objects The number of object IDs to get.
+  /// \return The return status.
+  Status GetAsync(const ObjectID* object_ids, int64_t num_objects);
+
+  /// Wait until at least one of the objects requested with GetAsync is
+  /// retrieved, or the timeout expires. The caller is responsible for releasing
+  /// the objects returned, as for Get.
+  ///
+  /// \param timeout_ms The amount of time in milliseconds to wait. If this value
+  ///        is -1, then no timeout is set, and if it is 0 this does not block.
+  /// \param object_ids Out parameter, the IDs of the objects retrieved, empty if
+  ///        the timeout expired.
+  /// \param object_buffers Out parameter, the objects retrieved.
+  /// \return The return status.
+  Status WaitAny(int64_t timeout_ms, std::vector<ObjectID>* object_ids,
+                 std::vector<ObjectBuffer>* object_buffers);
+
+  /// Get the file descriptor that is readable when objects requested with
+  /// GetAsync may be ready, so that the caller can poll it in its own event
+  /// loop and then call WaitAny with a timeout of 0. The objects that GetAsync
+  /// found in the store are not signaled on it.
+  ///
+  /// \return The file descriptor, or -1 if GetAsync was not called yet.
+  int async_get_fd() const;
+
   /// Tell Plasma that the client no longer needs the object. This should be
   /// called
   /// after Get when the client is done with the object. After this call,
@@ -151,6 +225,14 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Release(const ObjectID& object_id);
 
+  /// Release several objects, telling Plasma about the ones that are no
+  /// longer used with a single message.
+  ///
+  /// \param object_ids The IDs of the objects that are no longer needed.
+  /// \param num_objects The number of objects to release.
+  /// \return The return status.
+  Status ReleaseMany(const ObjectID* object_ids, int64_t num_objects);
+
   /// Check if the object store contains a particular object and the object has
   /// been sealed. The result will be stored in has_object.
   ///
@@ -180,6 +262,24 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal an object with a digest computed by the caller, for instance with an
+  /// ObjectDigester while writing the object, so that the object is not read
+  /// again to hash it.
+  ///
+  /// \param object_id The ID of the object to seal.
+  /// \param digest The kDigestSize bytes of the digest of the object, or null
+  ///        to skip hashing the object. Copies of such an object cannot be
+  ///        checked against it.
+  /// \return The return status.
+  Status Seal(const ObjectID& object_id, const uint8_t* digest);
+
+  /// Seal several objects in the object store with a single message.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \param num_objects The number of objects to seal.
+  /// \return The return status.
+  Status SealMany(const ObjectID* object_ids, int64_t num_objects);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -191,6 +291,15 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Delete(const ObjectID& object_id);
 
+  /// Ask the object store not to evict a sealed object, for instance one that
+  /// is reused often but would be evicted to make room for objects used once,
+  /// or to evict it again. A pinned object can still be deleted.
+  ///
+  /// \param object_id The ID of the object to pin or unpin.
+  /// \param pinned Whether the object must not be evicted.
+  /// \return The return status.
+  Status Pin(const ObjectID& object_id, bool pinned = true);
+
   /// Delete objects until we have freed up num_bytes bytes or there are no more
   /// released objects that can be deleted.
   ///
@@ -200,6 +309,53 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
 
+  /// Get the metrics of the object store: its memory usage, how many objects
+  /// it evicted and how long it took to handle the requests.
+  ///
+  /// \param metrics Out parameter for the metrics.
+  /// \return The return status.
+  Status Metrics(StoreMetrics* metrics);
+
+  /// Write a record batch into a new object, in the Arrow IPC stream format
+  /// along with its schema, and seal the object.
+  ///
+  /// \param object_id The ID of the object to create.
+  /// \param batch The record batch to write.
+  /// \return The return status.
+  Status PutRecordBatch(const ObjectID& object_id, const arrow::RecordBatch& batch);
+
+  /// Write a table into a new object, as a stream of record batches, and seal
+  /// the object.
+  ///
+  /// \param object_id The ID of the object to create.
+  /// \param table The table to write.
+  /// \return The return status.
+  Status PutTable(const ObjectID& object_id, const arrow::Table& table);
+
+  /// Get the record batch of an object written by PutRecordBatch. The data
+  /// is not copied: the buffers of the batch point into the object, which
+  /// this client keeps using until all of them are destroyed. They must be
+  /// destroyed before the client is.
+  ///
+  /// \param object_id The ID of the object to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait for the
+  ///        object. If this value is -1, then no timeout is set.
+  /// \param out The record batch, null if the object was not retrieved.
+  /// \return The return status.
+  Status GetRecordBatch(const ObjectID& object_id, int64_t timeout_ms,
+                        std::shared_ptr<arrow::RecordBatch>* out);
+
+  /// Get the table of an object written by PutTable or PutRecordBatch,
+  /// without copying it, see GetRecordBatch.
+  ///
+  /// \param object_id The ID of the object to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait for the
+  ///        object. If this value is -1, then no timeout is set.
+  /// \param out The table, null if the object was not retrieved.
+  /// \return The return status.
+  Status GetTable(const ObjectID& object_id, int64_t timeout_ms,
+                  std::shared_ptr<arrow::Table>* out);
+
   /// Compute the hash of an object in the object store.
   ///
   /// \param object_id The ID of the object we want to hash.
@@ -228,6 +384,23 @@ class ARROW_EXPORT PlasmaClient {
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
 
+  /// Receive the object notifications available for this client if Subscribe
+  /// has been called. The store sends the notifications in batches: this
+  /// returns those of the next batch, or the rest of the batch partly returned
+  /// by GetNotification, in the order the objects were sealed or deleted.
+  ///
+  /// \param fd The file descriptor we are reading the notifications from.
+  /// \param object_ids Out parameter, the object IDs of the objects that were
+  ///        sealed or deleted.
+  /// \param data_sizes Out parameter, the data sizes of the objects, -1 for
+  ///        deleted ones.
+  /// \param metadata_sizes Out parameter, the metadata sizes of the objects,
+  ///        -1 for deleted ones.
+  /// \return The return status.
+  Status GetNotifications(int fd, std::vector<ObjectID>* object_ids,
+                          std::vector<int64_t>* data_sizes,
+                          std::vector<int64_t>* metadata_sizes);
+
   /// Disconnect from the local plasma instance, including the local store and
   /// manager.
   ///
@@ -295,10 +468,14 @@ class ARROW_EXPORT PlasmaClient {
   Status Wait(int64_t num_object_requests, ObjectRequest* object_requests,
               int num_ready_objects, int64_t timeout_ms, int* num_objects_ready);
 
-  /// Transfer local object to a different plasma manager.
+  /// Transfer local object to a different plasma manager. Without a manager,
+  /// the store sends the object with its transfer service to the transfer
+  /// service of another store. The transfer happens in the background, the
+  /// object is available in the other store once it is sealed there.
   ///
-  /// \param addr IP address of the plasma manager we are transfering to.
-  /// \param port Port of the plasma manager we are transfering to.
+  /// \param addr IP address of the plasma manager or store we are transfering to.
+  /// \param port Port of the plasma manager or of the transfer service of the
+  ///        store we are transfering to.
   /// \param object_id ObjectID of the object we are transfering.
   /// \return The return status.
   Status Transfer(const char* addr, int port, const ObjectID& object_id);
@@ -338,17 +515,61 @@ class ARROW_EXPORT PlasmaClient {
   /// store.
   Status FlushReleaseHistory();
 
-  Status PerformRelease(const ObjectID& object_id);
+  Status PerformRelease(ObjectID object_id, std::vector<ObjectID>* released);
+
+  /// Tell the store that the client no longer needs these objects.
+  Status SendReleases(const std::vector<ObjectID>& object_ids);
 
   uint8_t* lookup_or_mmap(int fd, int store_fd_val, int64_t map_size);
 
   uint8_t* lookup_mmapped_file(int store_fd_val);
 
+  /// Create an object holding an Arrow IPC stream and seal it.
+  ///
+  /// @param object_id The ID of the object to create.
+  /// @param schema The schema of the stream.
+  /// @param write_batches Write the record batches of the stream. It is
+  ///        called twice, to size the object and then to fill it.
+  Status PutStream(
+      const ObjectID& object_id, const std::shared_ptr<arrow::Schema>& schema,
+      const std::function<Status(arrow::ipc::RecordBatchWriter*)>& write_batches);
+
+  /// Open a reader of the Arrow IPC stream held by an object, without copying
+  /// it. The object is used by this client until the reader and the batches
+  /// read are destroyed.
+  ///
+  /// @param object_id The ID of the object to read.
+  /// @param timeout_ms The amount of time in milliseconds to wait for the object.
+  /// @param out The reader, null if the object was not retrieved.
+  Status GetStream(const ObjectID& object_id, int64_t timeout_ms,
+                   std::shared_ptr<arrow::RecordBatchReader>* out);
+
+  /// Hash an object that is mapped by this client.
+  void ComputeDigest(const PlasmaObject& object, uint8_t* digest);
+
   void increment_object_count(const ObjectID& object_id, PlasmaObject* object,
                               bool is_sealed);
 
+  /// Get the objects requested with GetAsync that are sealed, according to
+  /// the notifications available, and move them to ready_objects_.
+  Status ProcessAsyncGetNotifications();
+
+  struct Notification {
+    ObjectID object_id;
+    int64_t data_size;
+    int64_t metadata_size;
+  };
+
+  /// Read the next batch of notifications from a subscription socket into
+  /// notifications_.
+  Status ReadNotifications(int fd);
+
   /// File descriptor of the Unix domain socket that connects to the store.
   int store_conn_;
+  /// Shared-memory rings of the requests to the store and of its replies, if
+  /// they were set up with ConnectRings.
+  std::unique_ptr<MessageRing> request_ring_;
+  std::unique_ptr<MessageRing> reply_ring_;
   /// File descriptor of the Unix domain socket that connects to the manager.
   int manager_conn_;
   /// Table of dlmalloc buffer files that have been memory mapped so far. This
@@ -357,17 +578,16 @@ class ARROW_EXPORT PlasmaClient {
   std::unordered_map<int, ClientMmapTableEntry> mmap_table_;
   /// A hash table of the object IDs that are currently being used by this
   /// client.
-  std::unordered_map<ObjectID, std::unique_ptr<ObjectInUseEntry>, UniqueIDHasher>
-      objects_in_use_;
-  /// Object IDs of the last few release calls. This is a deque and
-  /// is used to delay releasing objects to see if they can be reused by
-  /// subsequent tasks so we do not unneccessarily invalidate cpu caches.
-  /// TODO(pcm): replace this with a proper lru cache using the size of the L3
-  /// cache.
-  std::deque<ObjectID> release_history_;
+  ObjectMap<std::unique_ptr<ObjectInUseEntry>> objects_in_use_;
+  /// Object IDs of the objects that are no longer used by this client, most
+  /// recently released first. They are only released to the store when they
+  /// leave this LRU cache, so that getting them again does not need to ask
+  /// the store and we do not unneccessarily invalidate cpu caches.
+  std::list<ObjectID> release_history_;
   /// The number of bytes in the combined objects that are held in the release
-  /// history doubly-linked list. If this is too large then the client starts
-  /// releasing objects.
+  /// history. If this is too large then the client starts releasing objects.
+  int64_t released_object_bytes_;
+  /// The number of bytes in the combined objects in objects_in_use_.
   int64_t in_use_object_bytes_;
   /// Configuration options for the plasma client.
   PlasmaClientConfig config_;
@@ -375,6 +595,17 @@ class ARROW_EXPORT PlasmaClient {
   /// information to make sure that it does not delay in releasing so much
   /// memory that the store is unable to evict enough objects to free up space.
   int64_t store_capacity_;
+  /// The subscription to the sealed objects used by GetAsync, -1 until it is
+  /// first called.
+  int async_get_fd_;
+  /// The IDs of the objects requested with GetAsync that are not retrieved yet.
+  std::unordered_set<ObjectID, UniqueIDHasher> pending_objects_;
+  /// The objects requested with GetAsync that are retrieved and not yet
+  /// returned by WaitAny.
+  std::vector<std::pair<ObjectID, ObjectBuffer>> ready_objects_;
+  /// The notifications read from each subscription socket and not returned
+  /// yet.
+  std::unordered_map<int, std::deque<Notification>> notifications_;
 #ifdef PLASMA_GPU
   /// Cuda Device Manager.
   arrow::gpu::CudaDeviceManager* manager_;
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/digest.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "plasma/common.h"
+
+#define XXH_STATIC_LINKING_ONLY
+#include "thirdparty/xxhash.h"
+
+#define XXH64_DEFAULT_SEED 0
+
+namespace plasma {
+
+namespace {
+
+uint64_t HashBlock(const uint8_t* data, int64_t nbytes) {
+  return XXH64(data, nbytes, XXH64_DEFAULT_SEED);
+}
+
+// Hash the hashes of the blocks of the data, then the metadata.
+void FinishDigest(XXH64_state_t* hash_state, const std::vector<uint64_t>& block_hashes,
+                  const uint8_t* metadata, int64_t metadata_size, uint8_t* digest) {
+  if (!block_hashes.empty()) {
+    XXH64_update(hash_state, block_hashes.data(), block_hashes.size() * sizeof(uint64_t));
+  }
+  XXH64_update(hash_state, metadata, metadata_size);
+  const uint64_t hash = XXH64_digest(hash_state);
+  static_assert(sizeof(hash) == kDigestSize, "digests are 64-bit hashes");
+  memcpy(digest, &hash, sizeof(hash));
+}
+
+}  // namespace
+
+void ComputeObjectDigest(const uint8_t* data, int64_t data_size, const uint8_t* metadata,
+                         int64_t metadata_size, int num_threads, uint8_t* digest) {
+  XXH64_state_t hash_state;
+  XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
+  std::vector<uint64_t> block_hashes;
+  if (data_size < kDigestBlockSize) {
+    XXH64_update(&hash_state, data, data_size);
+  } else {
+    const int64_t num_blocks = (data_size + kDigestBlockSize - 1) / kDigestBlockSize;
+    block_hashes.resize(num_blocks);
+    ARROW_UNUSED(arrow::ParallelFor(
+        num_threads, static_cast<int>(num_blocks), [&](int i) {
+          const int64_t offset = i * kDigestBlockSize;
+          block_hashes[i] =
+              HashBlock(data + offset, std::min(kDigestBlockSize, data_size - offset));
+          return arrow::Status::OK();
+        }));
+  }
+  FinishDigest(&hash_state, block_hashes, metadata, metadata_size, digest);
+}
+
+struct ObjectDigester::Impl {
+  explicit Impl(int64_t data_size)
+      : data_size(data_size), bytes_hashed(0), block_bytes(0) {
+    XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
+    XXH64_reset(&block_state, XXH64_DEFAULT_SEED);
+  }
+
+  const int64_t data_size;
+  int64_t bytes_hashed;
+  /// The hash of the whole data of small objects, or of the blocks otherwise
+  XXH64_state_t hash_state;
+  /// The hash of the current block, if it was only partially passed
+  XXH64_state_t block_state;
+  int64_t block_bytes;
+  std::vector<uint64_t> block_hashes;
+};
+
+ObjectDigester::ObjectDigester(int64_t data_size) : impl_(new Impl(data_size)) {}
+
+ObjectDigester::~ObjectDigester() {}
+
+void ObjectDigester::Update(const uint8_t* data, int64_t nbytes) {
+  Impl* impl = impl_.get();
+  ARROW_CHECK(impl->bytes_hashed + nbytes <= impl->data_size)
+      << "More data than the size of the object";
+  impl->bytes_hashed += nbytes;
+  if (impl->data_size < kDigestBlockSize) {
+    XXH64_update(&impl->hash_state, data, nbytes);
+    return;
+  }
+  while (nbytes > 0) {
+    if (impl->block_bytes == 0 && nbytes >= kDigestBlockSize) {
+      // Whole blocks are hashed directly.
+      impl->block_hashes.push_back(HashBlock(data, kDigestBlockSize));
+      data += kDigestBlockSize;
+      nbytes -= kDigestBlockSize;
+      continue;
+    }
+    const int64_t chunk = std::min(nbytes, kDigestBlockSize - impl->block_bytes);
+    XXH64_update(&impl->block_state, data, chunk);
+    impl->block_bytes += chunk;
+    data += chunk;
+    nbytes -= chunk;
+    if (impl->block_bytes == kDigestBlockSize) {
+      impl->block_hashes.push_back(XXH64_digest(&impl->block_state));
+      XXH64_reset(&impl->block_state, XXH64_DEFAULT_SEED);
+      impl->block_bytes = 0;
+    }
+  }
+}
+
+void ObjectDigester::Finish(const uint8_t* metadata, int64_t metadata_size,
+                            uint8_t* digest) {
+  Impl* impl = impl_.get();
+  ARROW_CHECK(impl->bytes_hashed == impl->data_size)
+      << "Only " << impl->bytes_hashed << " bytes of data out of " << impl->data_size
+      << " were hashed";
+  if (impl->block_bytes > 0) {
+    // The last block is shorter.
+    impl->block_hashes.push_back(XXH64_digest(&impl->block_state));
+    impl->block_bytes = 0;
+  }
+  FinishDigest(&impl->hash_state, impl->block_hashes, metadata, metadata_size, digest);
+}
+
+}  // namespace plasma
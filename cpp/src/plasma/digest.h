@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_DIGEST_H
+#define PLASMA_DIGEST_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace plasma {
+
+/// The data of objects of at least this size is hashed in blocks of this size,
+/// whose hashes are then hashed together with the metadata. Smaller objects
+/// are hashed in one go.
+constexpr int64_t kDigestBlockSize = 1 << 20;
+
+/// Compute the digest of an object, hashing its blocks in parallel.
+///
+/// @param data The data of the object.
+/// @param data_size The size of the data.
+/// @param metadata The metadata of the object.
+/// @param metadata_size The size of the metadata.
+/// @param num_threads The number of threads hashing the blocks.
+/// @param digest The kDigestSize bytes of the digest.
+ARROW_EXPORT void ComputeObjectDigest(const uint8_t* data, int64_t data_size,
+                                      const uint8_t* metadata, int64_t metadata_size,
+                                      int num_threads, uint8_t* digest);
+
+/// Compute the digest of an object while its data is written, giving the same
+/// digest as ComputeObjectDigest. The data is hashed as soon as it is passed,
+/// while it is still in the CPU caches, so that sealing the object does not
+/// need to read it again.
+class ARROW_EXPORT ObjectDigester {
+ public:
+  /// @param data_size The size of the data of the object.
+  explicit ObjectDigester(int64_t data_size);
+
+  ~ObjectDigester();
+
+  /// Hash the next bytes of the data, in order.
+  void Update(const uint8_t* data, int64_t nbytes);
+
+  /// Hash the metadata once all of the data was passed to Update, and get the
+  /// digest.
+  ///
+  /// @param metadata The metadata of the object.
+  /// @param metadata_size The size of the metadata.
+  /// @param digest The kDigestSize bytes of the digest.
+  void Finish(const uint8_t* metadata, int64_t metadata_size, uint8_t* digest);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_DIGEST_H
@@ -20,6 +20,11 @@
 #include <utility>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "arrow/util/logging.h"
 
 namespace plasma {
 
@@ -35,7 +40,22 @@ int EventLoop::TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* con
 
 constexpr int kInitialEventLoopSize = 1024;
 
-EventLoop::EventLoop() { loop_ = aeCreateEventLoop(kInitialEventLoopSize); }
+EventLoop::EventLoop() : thread_id_(std::thread::id()) {
+  loop_ = aeCreateEventLoop(kInitialEventLoopSize);
+  ARROW_CHECK(pipe(wakeup_fds_) == 0);
+  for (int fd : wakeup_fds_) {
+    ARROW_CHECK(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0);
+    ARROW_CHECK(fcntl(fd, F_SETFD, FD_CLOEXEC) == 0);
+  }
+  ARROW_CHECK(AddFileEvent(wakeup_fds_[0], kEventLoopRead,
+                           [this](int events) { RunPostedTasks(); }));
+}
+
+EventLoop::~EventLoop() {
+  aeDeleteEventLoop(loop_);
+  close(wakeup_fds_[0]);
+  close(wakeup_fds_[1]);
+}
 
 bool EventLoop::AddFileEvent(int fd, int events, const FileCallback& callback) {
   if (file_callbacks_.find(fd) != file_callbacks_.end()) {
@@ -66,11 +86,48 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
-void EventLoop::Start() { aeMain(loop_); }
+void EventLoop::Start() {
+  thread_id_ = std::this_thread::get_id();
+  aeMain(loop_);
+}
 
 void EventLoop::Stop() {
   aeStop(loop_);
-  aeDeleteEventLoop(loop_);
+  Wakeup();
+}
+
+void EventLoop::Post(const std::function<void()>& task) {
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    tasks_.push_back(task);
+  }
+  Wakeup();
+}
+
+bool EventLoop::IsLoopThread() const {
+  return thread_id_.load() == std::this_thread::get_id();
+}
+
+void EventLoop::Wakeup() {
+  // If the pipe is full, the loop has yet to wake up anyway
+  char byte = 0;
+  if (write(wakeup_fds_[1], &byte, 1) < 0 && errno != EAGAIN) {
+    ARROW_LOG(WARNING) << "Failed to wake up the event loop: " << strerror(errno);
+  }
+}
+
+void EventLoop::RunPostedTasks() {
+  char bytes[64];
+  while (read(wakeup_fds_[0], bytes, sizeof(bytes)) > 0) {
+  }
+  std::vector<std::function<void()>> tasks;
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex_);
+    tasks.swap(tasks_);
+  }
+  for (const auto& task : tasks) {
+    task();
+  }
 }
 
 int64_t EventLoop::AddTimer(int64_t timeout, const TimerCallback& callback) {
@@ -18,9 +18,13 @@
 #ifndef PLASMA_EVENTS
 #define PLASMA_EVENTS
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 extern "C" {
 #include "ae/ae.h"
@@ -55,6 +59,8 @@ class EventLoop {
 
   EventLoop();
 
+  ~EventLoop();
+
   /// Add a new file event handler to the event loop.
   ///
   /// @param fd The file descriptor we are listening to.
@@ -85,10 +91,22 @@ class EventLoop {
   /// \brief Run the event loop.
   void Start();
 
-  /// \brief Stop the event loop
+  /// \brief Stop the event loop. Can be called from any thread, and from a
+  /// signal handler
   void Stop();
 
+  /// \brief Run a task on the thread running the event loop, waking it up.
+  /// Tasks run in the order they were posted. Thread-safe
+  void Post(const std::function<void()>& task);
+
+  /// \brief Whether the calling thread is the one running the event loop
+  bool IsLoopThread() const;
+
  private:
+  void Wakeup();
+
+  void RunPostedTasks();
+
   static void FileEventCallback(aeEventLoop* loop, int fd, void* context, int events);
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
@@ -96,6 +114,12 @@ class EventLoop {
   aeEventLoop* loop_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
+  /// Thread running the loop, once started
+  std::atomic<std::thread::id> thread_id_;
+  /// Pipe written to wake up the loop
+  int wakeup_fds_[2];
+  std::mutex tasks_mutex_;
+  std::vector<std::function<void()>> tasks_;
 };
 
 }  // namespace plasma
@@ -48,16 +48,91 @@ int64_t LRUCache::choose_objects_to_evict(int64_t num_bytes_required,
   return bytes_evicted;
 }
 
-EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info)
-    : memory_used_(0), store_info_(store_info) {}
+void LFUCache::add(const ObjectID& key, int64_t size) {
+  ARROW_CHECK(item_map_.find(key) == item_map_.end());
+  Priority priority(++uses_[key], next_sequence_number_++);
+  items_.emplace(priority, std::make_pair(key, size));
+  item_map_.emplace(key, priority);
+}
+
+void LFUCache::remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it != item_map_.end());
+  items_.erase(it->second);
+  item_map_.erase(it);
+}
+
+void LFUCache::forget(const ObjectID& key) { uses_.erase(key); }
+
+int64_t LFUCache::choose_objects_to_evict(int64_t num_bytes_required,
+                                          std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  for (auto it = items_.begin(); bytes_evicted < num_bytes_required && it != items_.end();
+       ++it) {
+    objects_to_evict->push_back(it->second.first);
+    bytes_evicted += it->second.second;
+  }
+  return bytes_evicted;
+}
+
+void GreedyDualSizeCache::add(const ObjectID& key, int64_t size) {
+  ARROW_CHECK(item_map_.find(key) == item_map_.end());
+  const double frequency = static_cast<double>(++uses_[key]);
+  Priority priority(inflation_ + frequency / std::max<int64_t>(size, 1),
+                    next_sequence_number_++);
+  items_.emplace(priority, std::make_pair(key, size));
+  item_map_.emplace(key, priority);
+}
+
+void GreedyDualSizeCache::remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it != item_map_.end());
+  items_.erase(it->second);
+  item_map_.erase(it);
+}
+
+void GreedyDualSizeCache::forget(const ObjectID& key) { uses_.erase(key); }
+
+int64_t GreedyDualSizeCache::choose_objects_to_evict(
+    int64_t num_bytes_required, std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  for (auto it = items_.begin(); bytes_evicted < num_bytes_required && it != items_.end();
+       ++it) {
+    objects_to_evict->push_back(it->second.first);
+    bytes_evicted += it->second.second;
+    // The chosen objects are evicted, which ages the remaining ones.
+    inflation_ = it->first.first;
+  }
+  return bytes_evicted;
+}
+
+Status MakeEvictionCache(const std::string& name, std::unique_ptr<EvictionCache>* out) {
+  if (name == "lru") {
+    out->reset(new LRUCache());
+  } else if (name == "lfu") {
+    out->reset(new LFUCache());
+  } else if (name == "gds") {
+    out->reset(new GreedyDualSizeCache());
+  } else {
+    return Status::Invalid("Unknown eviction policy " + name);
+  }
+  return Status::OK();
+}
+
+EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info,
+                               std::unique_ptr<EvictionCache> cache)
+    : memory_used_(0),
+      store_info_(store_info),
+      cache_(cache ? std::move(cache) : std::unique_ptr<EvictionCache>(new LRUCache())) {}
 
 int64_t EvictionPolicy::choose_objects_to_evict(int64_t num_bytes_required,
                                                 std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted =
-      cache_.choose_objects_to_evict(num_bytes_required, objects_to_evict);
-  /* Update the LRU cache. */
+      cache_->choose_objects_to_evict(num_bytes_required, objects_to_evict);
+  /* Update the cache. */
   for (auto& object_id : *objects_to_evict) {
-    cache_.remove(object_id);
+    cache_->remove(object_id);
+    cache_->forget(object_id);
   }
   /* Update the number of bytes used. */
   memory_used_ -= bytes_evicted;
@@ -67,7 +142,7 @@ int64_t EvictionPolicy::choose_objects_to_evict(int64_t num_bytes_required,
 
 void EvictionPolicy::object_created(const ObjectID& object_id) {
   auto entry = store_info_->objects[object_id].get();
-  cache_.add(object_id, entry->info.data_size + entry->info.metadata_size);
+  cache_->add(object_id, entry->info.data_size + entry->info.metadata_size);
   int64_t size = entry->info.data_size + entry->info.metadata_size;
   memory_used_ += size;
   ARROW_CHECK(memory_used_ <= store_info_->memory_capacity);
@@ -91,20 +166,28 @@ bool EvictionPolicy::require_space(int64_t size,
 
 void EvictionPolicy::begin_object_access(const ObjectID& object_id,
                                          std::vector<ObjectID>* objects_to_evict) {
-  /* If the object is in the LRU cache, remove it. */
-  cache_.remove(object_id);
+  /* If the object is in the cache, remove it. Pinned objects are not. */
+  if (pinned_objects_.find(object_id) == pinned_objects_.end()) {
+    cache_->remove(object_id);
+  }
 }
 
 void EvictionPolicy::end_object_access(const ObjectID& object_id,
                                        std::vector<ObjectID>* objects_to_evict) {
+  if (pinned_objects_.find(object_id) != pinned_objects_.end()) {
+    return;
+  }
   auto entry = store_info_->objects[object_id].get();
-  /* Add the object to the LRU cache.*/
-  cache_.add(object_id, entry->info.data_size + entry->info.metadata_size);
+  /* Add the object to the cache.*/
+  cache_->add(object_id, entry->info.data_size + entry->info.metadata_size);
 }
 
 void EvictionPolicy::remove_object(const ObjectID& object_id) {
-  /* If the object is in the LRU cache, remove it. */
-  cache_.remove(object_id);
+  /* If the object is in the cache, remove it. */
+  if (pinned_objects_.erase(object_id) == 0) {
+    cache_->remove(object_id);
+  }
+  cache_->forget(object_id);
 
   auto entry = store_info_->objects[object_id].get();
   int64_t size = entry->info.data_size + entry->info.metadata_size;
@@ -112,4 +195,19 @@ void EvictionPolicy::remove_object(const ObjectID& object_id) {
   memory_used_ -= size;
 }
 
+void EvictionPolicy::set_pinned(const ObjectID& object_id, bool pinned) {
+  auto entry = store_info_->objects[object_id].get();
+  // Objects that are not used by any client are in the cache unless pinned.
+  const bool unused = entry->clients.empty();
+  if (pinned) {
+    if (pinned_objects_.insert(object_id).second && unused) {
+      cache_->remove(object_id);
+    }
+  } else {
+    if (pinned_objects_.erase(object_id) == 1 && unused) {
+      cache_->add(object_id, entry->info.data_size + entry->info.metadata_size);
+    }
+  }
+}
+
 }  // namespace plasma
@@ -19,31 +19,63 @@
 #define PLASMA_EVICTION_POLICY_H
 
 #include <list>
+#include <map>
+#include <memory>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/status.h"
 #include "plasma/common.h"
 #include "plasma/plasma.h"
 
 namespace plasma {
 
+using arrow::Status;
+
 // ==== The eviction policy ====
 //
 // This file contains declaration for all functions and data structures that
 // need to be provided if you want to implement a new eviction algorithm for the
 // Plasma store.
 
-class LRUCache {
+/// The order in which the objects that are not used by any client are
+/// evicted. Implement this interface to add an eviction algorithm.
+class EvictionCache {
+ public:
+  virtual ~EvictionCache() = default;
+
+  /// Make an object a candidate for eviction, when it is created or when it
+  /// is no longer used.
+  virtual void add(const ObjectID& key, int64_t size) = 0;
+
+  /// Stop considering an object for eviction, because it is used again or is
+  /// about to be deleted.
+  virtual void remove(const ObjectID& key) = 0;
+
+  /// Forget the history of an object that was deleted from the store.
+  virtual void forget(const ObjectID& key) {}
+
+  /// Choose objects to evict, without removing them from the cache.
+  ///
+  /// @return The total size of the chosen objects.
+  virtual int64_t choose_objects_to_evict(int64_t num_bytes_required,
+                                          std::vector<ObjectID>* objects_to_evict) = 0;
+};
+
+/// Evict the least recently used object first.
+class LRUCache : public EvictionCache {
  public:
   LRUCache() {}
 
-  void add(const ObjectID& key, int64_t size);
+  void add(const ObjectID& key, int64_t size) override;
 
-  void remove(const ObjectID& key);
+  void remove(const ObjectID& key) override;
 
   int64_t choose_objects_to_evict(int64_t num_bytes_required,
-                                  std::vector<ObjectID>* objects_to_evict);
+                                  std::vector<ObjectID>* objects_to_evict) override;
 
  private:
   /// A doubly-linked list containing the items in the cache and
@@ -55,6 +87,72 @@ class LRUCache {
   std::unordered_map<ObjectID, ItemList::iterator, UniqueIDHasher> item_map_;
 };
 
+/// Evict the object that was used the fewest times first, the least
+/// recently used one among those used as often. An object is counted as used
+/// each time it becomes a candidate for eviction.
+class LFUCache : public EvictionCache {
+ public:
+  LFUCache() : next_sequence_number_(0) {}
+
+  void add(const ObjectID& key, int64_t size) override;
+
+  void remove(const ObjectID& key) override;
+
+  void forget(const ObjectID& key) override;
+
+  int64_t choose_objects_to_evict(int64_t num_bytes_required,
+                                  std::vector<ObjectID>* objects_to_evict) override;
+
+ private:
+  /// The number of uses, then the order of insertion.
+  typedef std::pair<int64_t, int64_t> Priority;
+  /// The items in the cache and their sizes in eviction order.
+  std::map<Priority, std::pair<ObjectID, int64_t>> items_;
+  /// The priority of the objects in the cache.
+  std::unordered_map<ObjectID, Priority, UniqueIDHasher> item_map_;
+  /// The number of uses of the objects in the store.
+  std::unordered_map<ObjectID, int64_t, UniqueIDHasher> uses_;
+  int64_t next_sequence_number_;
+};
+
+/// The GreedyDual-Size-Frequency algorithm: evict first the object with the
+/// lowest priority, which is the number of uses of the object divided by its
+/// size, plus the priority of the last evicted object so that objects that
+/// are no longer used eventually age out. Many small objects are kept rather
+/// than a large one used as often, but a large object used often is kept
+/// rather than objects used once.
+class GreedyDualSizeCache : public EvictionCache {
+ public:
+  GreedyDualSizeCache() : inflation_(0), next_sequence_number_(0) {}
+
+  void add(const ObjectID& key, int64_t size) override;
+
+  void remove(const ObjectID& key) override;
+
+  void forget(const ObjectID& key) override;
+
+  int64_t choose_objects_to_evict(int64_t num_bytes_required,
+                                  std::vector<ObjectID>* objects_to_evict) override;
+
+ private:
+  /// The priority, then the order of insertion.
+  typedef std::pair<double, int64_t> Priority;
+  std::map<Priority, std::pair<ObjectID, int64_t>> items_;
+  std::unordered_map<ObjectID, Priority, UniqueIDHasher> item_map_;
+  std::unordered_map<ObjectID, int64_t, UniqueIDHasher> uses_;
+  /// The priority of the last evicted object.
+  double inflation_;
+  int64_t next_sequence_number_;
+};
+
+/// Create an eviction cache from the name of its algorithm: "lru", "lfu" or
+/// "gds" for GreedyDual-Size-Frequency.
+///
+/// @param name The name of the algorithm.
+/// @param out The created cache.
+/// @return The return status.
+Status MakeEvictionCache(const std::string& name, std::unique_ptr<EvictionCache>* out);
+
 /// The eviction policy.
 class EvictionPolicy {
  public:
@@ -62,7 +160,9 @@ class EvictionPolicy {
   ///
   /// @param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
-  explicit EvictionPolicy(PlasmaStoreInfo* store_info);
+  /// @param cache The order in which objects are evicted, LRU if null.
+  explicit EvictionPolicy(PlasmaStoreInfo* store_info,
+                          std::unique_ptr<EvictionCache> cache = nullptr);
 
   /// This method will be called whenever an object is first created in order to
   /// add it to the LRU cache. This is done so that the first time, the Plasma
@@ -125,13 +225,26 @@ class EvictionPolicy {
   /// @param object_id The ID of the object that is now being used.
   void remove_object(const ObjectID& object_id);
 
+  /// This method will be called when a client asks the Plasma store to never
+  /// evict an object, or to evict it again. A pinned object can still be
+  /// deleted explicitly.
+  ///
+  /// @param object_id The ID of the object, which must be in the store.
+  /// @param pinned Whether the object must not be evicted.
+  void set_pinned(const ObjectID& object_id, bool pinned);
+
+  /// The amount of memory (in bytes) used by the objects in the store.
+  int64_t memory_used() const { return memory_used_; }
+
  private:
   /// The amount of memory (in bytes) currently being used.
   int64_t memory_used_;
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
-  /// Datastructure for the LRU cache.
-  LRUCache cache_;
+  /// The order in which unused objects are evicted.
+  std::unique_ptr<EvictionCache> cache_;
+  /// The objects that must not be evicted.
+  std::unordered_set<ObjectID, UniqueIDHasher> pinned_objects_;
 };
 
 }  // namespace plasma
@@ -26,6 +26,8 @@
 #include <unistd.h>
 
 #include <cerrno>
+#include <list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -69,6 +71,10 @@ namespace {
 /// and size.
 std::unordered_map<void*, mmap_record> mmap_records;
 
+/// Whether the pages of new segments are faulted in, and locked in memory.
+bool prefault_segments = false;
+bool lock_segments = false;
+
 }  // namespace
 
 constexpr int GRANULARITY_MULTIPLIER = 2;
@@ -136,8 +142,15 @@ void* fake_mmap(size_t size) {
   ARROW_CHECK(fd >= 0) << "Failed to create buffer during mmap";
   // MAP_POPULATE can be used to pre-populate the page tables for this memory region
   // which avoids work when accessing the pages later. However it causes long pauses
-  // when mmapping the files. Only supported on Linux.
-  void* pointer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // when mmapping the files, so it is only used if asked for with
+  // set_malloc_prefault. Only supported on Linux.
+  int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+  if (prefault_segments) {
+    flags |= MAP_POPULATE;
+  }
+#endif
+  void* pointer = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
   if (pointer == MAP_FAILED) {
     ARROW_LOG(ERROR) << "mmap failed with error: " << std::strerror(errno);
     if (errno == ENOMEM && plasma::plasma_config->hugepages_enabled) {
@@ -147,6 +160,21 @@ void* fake_mmap(size_t size) {
     return pointer;
   }
 
+#ifndef MAP_POPULATE
+  if (prefault_segments) {
+    // Write to each page, which is zero since the file is new.
+    const int64_t page_size = sysconf(_SC_PAGESIZE);
+    for (size_t offset = 0; offset < size; offset += page_size) {
+      reinterpret_cast<volatile uint8_t*>(pointer)[offset] = 0;
+    }
+  }
+#endif
+  if (lock_segments && mlock(pointer, size) != 0) {
+    ARROW_LOG(WARNING) << "mlock failed with error: " << std::strerror(errno)
+                       << ", the memory of the store may be swapped out"
+                       << " (RLIMIT_MEMLOCK may be too low)";
+  }
+
   // Increase dlmalloc's allocation granularity directly.
   mparams.granularity *= GRANULARITY_MULTIPLIER;
 
@@ -208,3 +236,154 @@ int64_t get_mmap_size(int fd) {
 }
 
 void set_malloc_granularity(int value) { change_mparam(M_GRANULARITY, value); }
+
+void set_malloc_prefault(bool prefault, bool lock) {
+  prefault_segments = prefault;
+  lock_segments = lock;
+}
+
+void get_malloc_usage(int64_t* footprint, int64_t* allocated, int64_t* free_chunks) {
+  struct mallinfo info = dlmallinfo();
+  *footprint = static_cast<int64_t>(dlmalloc_footprint());
+  *allocated = static_cast<int64_t>(info.uordblks);
+  *free_chunks = static_cast<int64_t>(info.ordblks);
+}
+
+namespace {
+
+/// Slabs are chunks of dlmalloc of this size, aligned to it so that the slab
+/// of an object is found by rounding its address down.
+constexpr int64_t kSlabSize = 64 * 1024;
+
+constexpr int kNumSlabClasses = 6;
+
+static_assert((BLOCK_SIZE << (kNumSlabClasses - 1)) == kMaxSlabObjectSize,
+              "the largest slab class must hold kMaxSlabObjectSize bytes");
+
+struct Slab {
+  uint8_t* base;
+  int size_class;
+  /// The indices of the free slots of the slab, the next one to hand out last.
+  std::vector<uint32_t> free_slots;
+  /// Whether the slab is in the list of slabs with free slots of its class,
+  /// and where.
+  bool available;
+  std::list<Slab*>::iterator available_position;
+};
+
+struct SlabClass {
+  SlabClass() : num_slabs(0), num_objects(0) {}
+
+  /// The slabs of the class with free slots, the one to allocate from first.
+  std::list<Slab*> available;
+  int64_t num_slabs;
+  int64_t num_objects;
+};
+
+/// The slabs by base address.
+std::unordered_map<uintptr_t, std::unique_ptr<Slab>> slabs;
+
+SlabClass slab_classes[kNumSlabClasses];
+
+inline int64_t slab_object_size(int size_class) { return BLOCK_SIZE << size_class; }
+
+inline int64_t slab_num_slots(int size_class) {
+  return kSlabSize / slab_object_size(size_class);
+}
+
+// The smallest class holding objects of the given size, or -1 for large objects.
+int slab_class_of(size_t size) {
+  for (int size_class = 0; size_class < kNumSlabClasses; ++size_class) {
+    if (static_cast<int64_t>(size) <= slab_object_size(size_class)) {
+      return size_class;
+    }
+  }
+  return -1;
+}
+
+Slab* add_slab(int size_class) {
+  void* base = dlmemalign(kSlabSize, kSlabSize);
+  if (base == NULL) {
+    return NULL;
+  }
+  std::unique_ptr<Slab> slab(new Slab());
+  slab->base = reinterpret_cast<uint8_t*>(base);
+  slab->size_class = size_class;
+  const int64_t num_slots = slab_num_slots(size_class);
+  slab->free_slots.reserve(num_slots);
+  for (int64_t slot = num_slots - 1; slot >= 0; --slot) {
+    slab->free_slots.push_back(static_cast<uint32_t>(slot));
+  }
+  SlabClass& slab_class = slab_classes[size_class];
+  slab->available = true;
+  slab->available_position =
+      slab_class.available.insert(slab_class.available.end(), slab.get());
+  ++slab_class.num_slabs;
+  Slab* result = slab.get();
+  slabs[reinterpret_cast<uintptr_t>(base)] = std::move(slab);
+  return result;
+}
+
+}  // namespace
+
+void* plasma_malloc(size_t size) {
+  const int size_class = slab_class_of(size);
+  if (size_class < 0) {
+    return dlmemalign(BLOCK_SIZE, size);
+  }
+  SlabClass& slab_class = slab_classes[size_class];
+  if (slab_class.available.empty() && add_slab(size_class) == NULL) {
+    // There is no room for a new slab, but there may be for the object.
+    return dlmemalign(BLOCK_SIZE, size);
+  }
+  Slab* slab = slab_class.available.front();
+  const uint32_t slot = slab->free_slots.back();
+  slab->free_slots.pop_back();
+  if (slab->free_slots.empty()) {
+    slab_class.available.erase(slab->available_position);
+    slab->available = false;
+  }
+  ++slab_class.num_objects;
+  return slab->base + slot * slab_object_size(size_class);
+}
+
+void plasma_free(void* pointer) {
+  const uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+  auto it = slabs.find(address & ~static_cast<uintptr_t>(kSlabSize - 1));
+  if (it == slabs.end()) {
+    dlfree(pointer);
+    return;
+  }
+  Slab* slab = it->second.get();
+  SlabClass& slab_class = slab_classes[slab->size_class];
+  const int64_t offset = reinterpret_cast<uint8_t*>(pointer) - slab->base;
+  slab->free_slots.push_back(
+      static_cast<uint32_t>(offset / slab_object_size(slab->size_class)));
+  --slab_class.num_objects;
+  if (!slab->available) {
+    slab->available = true;
+    slab->available_position =
+        slab_class.available.insert(slab_class.available.begin(), slab);
+  } else if (static_cast<int64_t>(slab->free_slots.size()) ==
+                 slab_num_slots(slab->size_class) &&
+             slab_class.available.size() > 1) {
+    // Give empty slabs back to dlmalloc for the large objects, but keep one
+    // slab per class with free slots so that allocating and freeing a single
+    // object does not allocate and free a slab each time.
+    slab_class.available.erase(slab->available_position);
+    --slab_class.num_slabs;
+    dlfree(slab->base);
+    slabs.erase(it);
+  }
+}
+
+int get_num_slab_classes() { return kNumSlabClasses; }
+
+void get_slab_usage(int size_class, int64_t* object_size, int64_t* num_slabs,
+                    int64_t* num_slots, int64_t* num_objects) {
+  const SlabClass& slab_class = slab_classes[size_class];
+  *object_size = slab_object_size(size_class);
+  *num_slabs = slab_class.num_slabs;
+  *num_slots = slab_class.num_slabs * slab_num_slots(size_class);
+  *num_objects = slab_class.num_objects;
+}
@@ -37,4 +37,51 @@ int64_t get_mmap_size(int fd);
 
 void set_malloc_granularity(int value);
 
+/// Fault in the pages of the memory-mapped files when they are mapped, so
+/// that writing to new objects does not page-fault. This makes mapping slow,
+/// it is meant for a store that maps all of its memory at startup.
+///
+/// @param prefault Whether to fault in the pages of the files mapped from now on.
+/// @param lock Whether to also lock those pages in memory with mlock.
+void set_malloc_prefault(bool prefault, bool lock);
+
+/// Get how the memory mapped by the allocator is used.
+///
+/// @param footprint The memory mapped by the allocator.
+/// @param allocated The memory in chunks handed out by the allocator.
+/// @param free_chunks The number of free chunks.
+void get_malloc_usage(int64_t* footprint, int64_t* allocated, int64_t* free_chunks);
+
+/// Allocate the memory of an object, aligned to BLOCK_SIZE. Objects of up to
+/// kMaxSlabObjectSize bytes are allocated from slabs of objects of the same
+/// size class, carved out of the memory-mapped files, so that many small
+/// objects do not fragment the memory of the large ones. Larger objects are
+/// allocated with dlmalloc.
+///
+/// @param size The size of the object.
+/// @return The memory of the object, or NULL if there is not enough memory.
+void* plasma_malloc(size_t size);
+
+/// Free the memory of an object allocated with plasma_malloc.
+///
+/// @param pointer The memory of the object.
+void plasma_free(void* pointer);
+
+/// The size of the largest objects allocated from slabs.
+constexpr int64_t kMaxSlabObjectSize = 2048;
+
+/// The number of size classes of the slab allocator, of 64 bytes to
+/// kMaxSlabObjectSize doubling from one class to the next.
+int get_num_slab_classes();
+
+/// Get how the slabs of a size class are used.
+///
+/// @param size_class The size class, from 0 to get_num_slab_classes() - 1.
+/// @param object_size The memory handed out for each object of the class.
+/// @param num_slabs The number of slabs of the class.
+/// @param num_slots The number of objects the slabs of the class can hold.
+/// @param num_objects The number of objects allocated from the slabs.
+void get_slab_usage(int size_class, int64_t* object_size, int64_t* num_slabs,
+                    int64_t* num_slots, int64_t* num_objects);
+
 #endif  // MALLOC_H
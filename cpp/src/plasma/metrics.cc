@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "plasma/plasma_generated.h"
+
+namespace plasma {
+
+LatencyHistogram::LatencyHistogram() : count(0), total_us(0), max_us(0) {
+  buckets.fill(0);
+}
+
+void LatencyHistogram::Record(int64_t latency_us) {
+  int bucket = 0;
+  while (bucket < kNumBuckets - 1 && latency_us >= (int64_t(1) << bucket)) {
+    ++bucket;
+  }
+  ++buckets[bucket];
+  ++count;
+  total_us += latency_us;
+  max_us = std::max(max_us, latency_us);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+  for (int i = 0; i < kNumBuckets; ++i) {
+    buckets[i] += other.buckets[i];
+  }
+  count += other.count;
+  total_us += other.total_us;
+  max_us = std::max(max_us, other.max_us);
+}
+
+int64_t LatencyHistogram::Quantile(double quantile) const {
+  const int64_t rank =
+      std::max(int64_t(1), static_cast<int64_t>(std::ceil(quantile * count)));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      // The longest latency is a tighter bound for the last buckets.
+      return std::min(int64_t(1) << i, max_us);
+    }
+  }
+  return max_us;
+}
+
+SlabClassMetrics::SlabClassMetrics()
+    : object_size(0), num_slabs(0), num_slots(0), num_objects(0) {}
+
+StoreMetrics::StoreMetrics()
+    : memory_capacity(0),
+      memory_used(0),
+      malloc_footprint(0),
+      malloc_allocated(0),
+      malloc_free_chunks(0),
+      num_objects(0),
+      num_clients(0),
+      num_pending_get_requests(0),
+      num_objects_evicted(0),
+      num_bytes_evicted(0),
+      num_objects_spilled(0),
+      num_bytes_spilled(0),
+      num_objects_restored(0) {}
+
+std::string StoreMetrics::ToString() const {
+  std::stringstream ss;
+  ss << "memory_capacity: " << memory_capacity << "\n"
+     << "memory_used: " << memory_used << "\n"
+     << "malloc_footprint: " << malloc_footprint << "\n"
+     << "malloc_allocated: " << malloc_allocated << "\n"
+     << "malloc_free_chunks: " << malloc_free_chunks << "\n"
+     << "num_objects: " << num_objects << "\n"
+     << "num_clients: " << num_clients << "\n"
+     << "num_pending_get_requests: " << num_pending_get_requests << "\n"
+     << "num_objects_evicted: " << num_objects_evicted << "\n"
+     << "num_bytes_evicted: " << num_bytes_evicted << "\n"
+     << "num_objects_spilled: " << num_objects_spilled << "\n"
+     << "num_bytes_spilled: " << num_bytes_spilled << "\n"
+     << "num_objects_restored: " << num_objects_restored << "\n";
+  for (const auto& entry : request_latencies) {
+    const LatencyHistogram& latencies = entry.second;
+    if (entry.first >= MessageType_MIN && entry.first <= MessageType_MAX) {
+      ss << EnumNameMessageType(static_cast<MessageType>(entry.first));
+    } else {
+      ss << "MessageType " << entry.first;
+    }
+    ss << ": count " << latencies.count << ", mean "
+       << (latencies.count > 0 ? latencies.total_us / latencies.count : 0)
+       << "us, p50 " << latencies.Quantile(0.5) << "us, p99 "
+       << latencies.Quantile(0.99) << "us, max " << latencies.max_us << "us\n";
+  }
+  for (const auto& slab_class : slab_classes) {
+    ss << "slab_class " << slab_class.object_size << ": slabs " << slab_class.num_slabs
+       << ", objects " << slab_class.num_objects << "/" << slab_class.num_slots << "\n";
+  }
+  return ss.str();
+}
+
+}  // namespace plasma
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_METRICS_H
+#define PLASMA_METRICS_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace plasma {
+
+/// Histogram of latencies in microseconds. Bucket 0 counts the latencies
+/// below 1us, and bucket i > 0 those from 2^(i-1)us up to 2^i us, the last
+/// bucket also counting all longer ones.
+struct ARROW_EXPORT LatencyHistogram {
+  static constexpr int kNumBuckets = 32;
+
+  LatencyHistogram();
+
+  /// Add a latency to the histogram.
+  void Record(int64_t latency_us);
+
+  /// Add the latencies of another histogram to this one.
+  void Merge(const LatencyHistogram& other);
+
+  /// Estimate a quantile of the latencies, as the upper bound of its bucket.
+  ///
+  /// @param quantile The quantile, between 0 and 1.
+  /// @return The latency in microseconds, or 0 if there are none.
+  int64_t Quantile(double quantile) const;
+
+  /// Number of latencies recorded.
+  int64_t count;
+  /// Sum of the latencies recorded.
+  int64_t total_us;
+  /// Longest latency recorded.
+  int64_t max_us;
+  /// Number of latencies in each bucket.
+  std::array<int64_t, kNumBuckets> buckets;
+};
+
+/// Occupancy of a size class of the slab allocator of small objects.
+struct ARROW_EXPORT SlabClassMetrics {
+  SlabClassMetrics();
+
+  /// The memory handed out for each object of the class.
+  int64_t object_size;
+  /// The number of slabs of the class.
+  int64_t num_slabs;
+  /// The number of objects the slabs can hold.
+  int64_t num_slots;
+  /// The number of objects in the slabs.
+  int64_t num_objects;
+};
+
+/// A snapshot of the state of the Plasma store and of what it did since it
+/// started, see PlasmaClient::Metrics.
+struct ARROW_EXPORT StoreMetrics {
+  StoreMetrics();
+
+  /// Format the metrics for humans, one per line.
+  std::string ToString() const;
+
+  /// The amount of memory the store may allocate for objects.
+  int64_t memory_capacity;
+  /// The size of the data and metadata of the objects in the store.
+  int64_t memory_used;
+  /// The memory mapped by the allocator.
+  int64_t malloc_footprint;
+  /// The memory in chunks the allocator handed out, which includes
+  /// alignment and allocator overhead.
+  int64_t malloc_allocated;
+  /// The number of free chunks of the allocator. Many free chunks for
+  /// the free memory mean that the free memory is fragmented.
+  int64_t malloc_free_chunks;
+  /// The number of objects in the store, sealed or not.
+  int64_t num_objects;
+  /// The number of connected clients.
+  int64_t num_clients;
+  /// The number of get requests waiting for objects.
+  int64_t num_pending_get_requests;
+  /// The number of objects evicted and their size, including those spilled.
+  int64_t num_objects_evicted;
+  int64_t num_bytes_evicted;
+  /// The number of evicted objects written to the spill store and their size.
+  int64_t num_objects_spilled;
+  int64_t num_bytes_spilled;
+  /// The number of spilled objects read back into memory.
+  int64_t num_objects_restored;
+  /// The time the store spent handling the requests, by message type. The
+  /// time get requests wait for objects is not included.
+  std::map<int64_t, LatencyHistogram> request_latencies;
+  /// The occupancy of the size classes of the slab allocator, from the
+  /// smallest objects to the largest.
+  std::vector<SlabClassMetrics> slab_classes;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_METRICS_H
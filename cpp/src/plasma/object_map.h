@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_OBJECT_MAP_H
+#define PLASMA_OBJECT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "plasma/common.h"
+
+namespace plasma {
+
+/// A hash table from object IDs to values, with open addressing and linear
+/// probing in a single array, so that a lookup does not chase pointers through
+/// the nodes of an std::unordered_map. Object IDs are random, so their first
+/// bytes are used as the hash.
+///
+/// It has the subset of the interface of std::unordered_map that Plasma uses.
+/// Inserting may move the values, and erasing may move the other values, so
+/// iterators and references are invalidated by both.
+template <typename T>
+class ObjectMap {
+ public:
+  using value_type = std::pair<ObjectID, T>;
+
+ private:
+  struct Slot {
+    Slot() : occupied(false) {}
+    bool occupied;
+    value_type value;
+  };
+
+  template <typename SlotType, typename Value>
+  class Iterator {
+   public:
+    Iterator(SlotType* slot, SlotType* end) : slot_(slot), end_(end) { SkipEmpty(); }
+
+    Value& operator*() const { return slot_->value; }
+    Value* operator->() const { return &slot_->value; }
+
+    Iterator& operator++() {
+      ++slot_;
+      SkipEmpty();
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const { return slot_ == other.slot_; }
+    bool operator!=(const Iterator& other) const { return slot_ != other.slot_; }
+
+   private:
+    friend class ObjectMap;
+
+    void SkipEmpty() {
+      while (slot_ != end_ && !slot_->occupied) {
+        ++slot_;
+      }
+    }
+
+    SlotType* slot_;
+    SlotType* end_;
+  };
+
+ public:
+  using iterator = Iterator<Slot, value_type>;
+  using const_iterator = Iterator<const Slot, const value_type>;
+
+  ObjectMap() : size_(0) {}
+
+  iterator begin() { return iterator(slots_.data(), slots_end()); }
+  iterator end() { return iterator(slots_end(), slots_end()); }
+  const_iterator begin() const { return const_iterator(slots_.data(), slots_end()); }
+  const_iterator end() const { return const_iterator(slots_end(), slots_end()); }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  iterator find(const ObjectID& object_id) {
+    Slot* slot = find_slot(object_id);
+    return slot->occupied ? iterator(slot, slots_end()) : end();
+  }
+
+  const_iterator find(const ObjectID& object_id) const {
+    const Slot* slot = const_cast<ObjectMap*>(this)->find_slot(object_id);
+    return slot->occupied ? const_iterator(slot, slots_end()) : end();
+  }
+
+  size_t count(const ObjectID& object_id) const {
+    return find(object_id) != end() ? 1 : 0;
+  }
+
+  /// Get the value of an object ID, inserting a default value if there is none.
+  T& operator[](const ObjectID& object_id) {
+    Slot* slot = find_slot(object_id);
+    if (slot->occupied) {
+      return slot->value.second;
+    }
+    // Keep the load factor below 3/4, so that the probe sequences stay short.
+    if (4 * (size_ + 1) > 3 * slots_.size()) {
+      Grow();
+      slot = find_slot(object_id);
+    }
+    slot->occupied = true;
+    slot->value.first = object_id;
+    ++size_;
+    return slot->value.second;
+  }
+
+  size_t erase(const ObjectID& object_id) {
+    iterator it = find(object_id);
+    if (it == end()) {
+      return 0;
+    }
+    erase(it);
+    return 1;
+  }
+
+  void erase(iterator it) {
+    const size_t mask = slots_.size() - 1;
+    size_t hole = it.slot_ - slots_.data();
+    slots_[hole].value.second = T();
+    // Shift the following values of the probe sequence back into the hole, so
+    // that lookups do not stop at it, unless they are already at their ideal
+    // position, which is between the hole and them.
+    for (size_t index = (hole + 1) & mask; slots_[index].occupied;
+         index = (index + 1) & mask) {
+      const size_t ideal = ideal_index(slots_[index].value.first);
+      const bool stays = hole <= index ? (hole < ideal && ideal <= index)
+                                       : (hole < ideal || ideal <= index);
+      if (!stays) {
+        slots_[hole].value = std::move(slots_[index].value);
+        slots_[index].value.second = T();
+        hole = index;
+      }
+    }
+    slots_[hole].occupied = false;
+    --size_;
+  }
+
+  void clear() {
+    slots_.clear();
+    size_ = 0;
+  }
+
+ private:
+  Slot* slots_end() { return slots_.data() + slots_.size(); }
+  const Slot* slots_end() const { return slots_.data() + slots_.size(); }
+
+  size_t ideal_index(const ObjectID& object_id) const {
+    return UniqueIDHasher()(object_id) & (slots_.size() - 1);
+  }
+
+  /// Find the slot of an object ID, or the empty slot where it would go.
+  Slot* find_slot(const ObjectID& object_id) {
+    if (slots_.empty()) {
+      // Lookups in an empty map end at this empty slot.
+      static Slot empty_slot;
+      return &empty_slot;
+    }
+    const size_t mask = slots_.size() - 1;
+    size_t index = ideal_index(object_id);
+    while (slots_[index].occupied && !(slots_[index].value.first == object_id)) {
+      index = (index + 1) & mask;
+    }
+    return &slots_[index];
+  }
+
+  void Grow() {
+    std::vector<Slot> old_slots(std::max(slots_.size() * 2, static_cast<size_t>(16)));
+    old_slots.swap(slots_);
+    for (auto& old_slot : old_slots) {
+      if (old_slot.occupied) {
+        Slot* slot = find_slot(old_slot.value.first);
+        slot->occupied = true;
+        slot->value = std::move(old_slot.value);
+      }
+    }
+  }
+
+  /// The slots, a power of two of them.
+  std::vector<Slot> slots_;
+  size_t size_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_OBJECT_MAP_H
@@ -21,6 +21,8 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "plasma/common.h"
 #include "plasma/protocol.h"
 
@@ -43,22 +45,26 @@ int warn_if_sigpipe(int status, int client_sock) {
 }
 
 /**
- * This will create a new ObjectInfo buffer. The first sizeof(int64_t) bytes
- * of this buffer are the length of the remaining message and the
- * remaining message is a serialized version of the object info.
+ * Serialize a batch of object infos into one message. The first
+ * sizeof(int64_t) bytes of the message are the length of the remaining
+ * message and the remaining message is a serialized ObjectInfoBatch.
  *
- * @param object_info The object info to be serialized
- * @return The object info buffer. It is the caller's responsibility to free
- *         this buffer with "delete" after it has been used.
+ * @param object_infos The object infos to be serialized, in order.
+ * @param message Out parameter, the framed message.
  */
-uint8_t* create_object_info_buffer(ObjectInfoT* object_info) {
+void create_object_info_batch(const std::vector<ObjectInfoT>& object_infos,
+                              std::vector<uint8_t>* message) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = CreateObjectInfo(fbb, object_info);
-  fbb.Finish(message);
-  uint8_t* notification = new uint8_t[sizeof(int64_t) + fbb.GetSize()];
-  *(reinterpret_cast<int64_t*>(notification)) = fbb.GetSize();
-  memcpy(notification + sizeof(int64_t), fbb.GetBufferPointer(), fbb.GetSize());
-  return notification;
+  std::vector<flatbuffers::Offset<ObjectInfo>> offsets;
+  offsets.reserve(object_infos.size());
+  for (const auto& object_info : object_infos) {
+    offsets.push_back(CreateObjectInfo(fbb, &object_info));
+  }
+  fbb.Finish(CreateObjectInfoBatch(fbb, fbb.CreateVector(offsets)));
+  const int64_t size = fbb.GetSize();
+  message->resize(sizeof(int64_t) + size);
+  memcpy(message->data(), &size, sizeof(int64_t));
+  memcpy(message->data() + sizeof(int64_t), fbb.GetBufferPointer(), size);
 }
 
 ObjectTableEntry* get_object_table_entry(PlasmaStoreInfo* store_info,
@@ -31,6 +31,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "plasma/compat.h"
 
@@ -38,6 +39,7 @@
 #include "arrow/util/logging.h"
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
+#include "plasma/object_map.h"
 
 #ifdef PLASMA_GPU
 #include "arrow/gpu/cuda_api.h"
@@ -128,6 +130,9 @@ struct ObjectTableEntry {
 #ifdef PLASMA_GPU
   /// IPC GPU handle to share with clients.
   std::shared_ptr<CudaIpcMemHandle> ipc_handle;
+  /// The device memory of the object. It is not freed when the buffer is
+  /// destroyed, since it was exported, but when the object is.
+  std::shared_ptr<arrow::gpu::CudaBuffer> gpu_buffer;
 #endif
   /// Set of clients currently using this object.
   std::unordered_set<Client*> clients;
@@ -140,7 +145,7 @@ struct ObjectTableEntry {
 /// The plasma store information that is exposed to the eviction policy.
 struct PlasmaStoreInfo {
   /// Objects that are in the Plasma store.
-  std::unordered_map<ObjectID, std::unique_ptr<ObjectTableEntry>, UniqueIDHasher> objects;
+  ObjectMap<std::unique_ptr<ObjectTableEntry>> objects;
   /// The amount of memory (in bytes) that we allow to be allocated in the
   /// store.
   int64_t memory_capacity;
@@ -179,7 +184,8 @@ ObjectTableEntry* get_object_table_entry(PlasmaStoreInfo* store_info,
 /// @return The errno set.
 int warn_if_sigpipe(int status, int client_sock);
 
-uint8_t* create_object_info_buffer(ObjectInfoT* object_info);
+void create_object_info_batch(const std::vector<ObjectInfoT>& object_infos,
+                              std::vector<uint8_t>* message);
 
 }  // namespace plasma
 
@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Print the metrics of a running Plasma store, whose socket is passed in via
+// the -s option, for instance to check on a store that is slow.
+
+#include <getopt.h>
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "arrow/util/logging.h"
+#include "plasma/client.h"
+
+int main(int argc, char* argv[]) {
+  char* socket_name = NULL;
+  int c;
+  while ((c = getopt(argc, argv, "s:")) != -1) {
+    switch (c) {
+      case 's':
+        socket_name = optarg;
+        break;
+      default:
+        exit(-1);
+    }
+  }
+  if (!socket_name) {
+    ARROW_LOG(FATAL) << "please specify the socket of the store with -s switch";
+  }
+  plasma::PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(socket_name, "", 0));
+  plasma::StoreMetrics metrics;
+  ARROW_CHECK_OK(client.Metrics(&metrics));
+  std::cout << metrics.ToString();
+  ARROW_CHECK_OK(client.Disconnect());
+  return 0;
+}
@@ -22,6 +22,7 @@
 
 #include "plasma/common.h"
 #include "plasma/io.h"
+#include "plasma/ring.h"
 
 #ifdef ARROW_GPU
 #include "arrow/gpu/cuda_api.h"
@@ -49,6 +50,15 @@ Status PlasmaReceive(int sock, int64_t message_type, std::vector<uint8_t>* buffe
   return Status::OK();
 }
 
+Status PlasmaReceive(MessageRing* ring, int peer_fd, int64_t message_type,
+                     std::vector<uint8_t>* buffer) {
+  int64_t type;
+  RETURN_NOT_OK(ring->Receive(peer_fd, &type, buffer));
+  ARROW_CHECK(type == message_type)
+      << "type = " << type << ", message_type = " << message_type;
+  return Status::OK();
+}
+
 template <typename Message>
 Status PlasmaSend(int sock, int64_t message_type, flatbuffers::FlatBufferBuilder* fbb,
                   const Message& message) {
@@ -56,6 +66,19 @@ Status PlasmaSend(int sock, int64_t message_type, flatbuffers::FlatBufferBuilder
   return WriteMessage(sock, message_type, fbb->GetSize(), fbb->GetBufferPointer());
 }
 
+template <typename Message>
+Status PlasmaSend(MessageRing* ring, int64_t message_type,
+                  flatbuffers::FlatBufferBuilder* fbb, const Message& message) {
+  fbb->Finish(message);
+  if (!ring->Write(message_type, fbb->GetSize(), fbb->GetBufferPointer())) {
+    return Status::OutOfMemory("Not enough room in ring for message");
+  }
+  return Status::OK();
+}
+
+// The messages which can be sent on the shared-memory rings as well as on the
+// sockets are built by templates, instantiated for both destinations.
+
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
@@ -135,6 +158,84 @@ Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
   return plasma_error_status(message->error());
 }
 
+Status SendCreateManyRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
+                             const int64_t* data_sizes, const int64_t* metadata_sizes) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<uint64_t> data_size_vector(data_sizes, data_sizes + num_objects);
+  std::vector<uint64_t> metadata_size_vector(metadata_sizes,
+                                             metadata_sizes + num_objects);
+  auto message = CreatePlasmaCreateManyRequest(
+      fbb, to_flatbuffer(&fbb, object_ids, num_objects),
+      fbb.CreateVector(data_size_vector), fbb.CreateVector(metadata_size_vector));
+  return PlasmaSend(sock, MessageType_PlasmaCreateManyRequest, &fbb, message);
+}
+
+Status ReadCreateManyRequest(uint8_t* data, size_t size,
+                             std::vector<ObjectID>* object_ids,
+                             std::vector<int64_t>* data_sizes,
+                             std::vector<int64_t>* metadata_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaCreateManyRequest>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  const uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->data_sizes()->size() == num_objects);
+  ARROW_CHECK(message->metadata_sizes()->size() == num_objects);
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    data_sizes->push_back(message->data_sizes()->Get(i));
+    metadata_sizes->push_back(message->metadata_sizes()->Get(i));
+  }
+  return Status::OK();
+}
+
+Status SendCreateManyReply(int sock, const std::vector<ObjectID>& object_ids,
+                           const std::vector<PlasmaObject>& objects, int error,
+                           const std::vector<int>& store_fds,
+                           const std::vector<int64_t>& mmap_sizes) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<PlasmaObjectSpec> object_specs;
+  for (const PlasmaObject& object : objects) {
+    object_specs.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
+                                            object.data_size, object.metadata_offset,
+                                            object.metadata_size, object.device_num));
+  }
+  auto message = CreatePlasmaCreateManyReply(
+      fbb, to_flatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStructs(object_specs), static_cast<PlasmaError>(error),
+      fbb.CreateVector(store_fds), fbb.CreateVector(mmap_sizes));
+  return PlasmaSend(sock, MessageType_PlasmaCreateManyReply, &fbb, message);
+}
+
+Status ReadCreateManyReply(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids,
+                           std::vector<PlasmaObject>* objects,
+                           std::vector<int>* store_fds,
+                           std::vector<int64_t>* mmap_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaCreateManyReply>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  for (uoffset_t i = 0; i < message->plasma_objects()->size(); ++i) {
+    const PlasmaObjectSpec* spec = message->plasma_objects()->Get(i);
+    PlasmaObject object;
+    memset(&object, 0, sizeof(object));
+    object.store_fd = spec->segment_index();
+    object.data_offset = spec->data_offset();
+    object.data_size = spec->data_size();
+    object.metadata_offset = spec->metadata_offset();
+    object.metadata_size = spec->metadata_size();
+    object.device_num = spec->device_num();
+    objects->push_back(object);
+  }
+  for (uoffset_t i = 0; i < message->store_fds()->size(); ++i) {
+    store_fds->push_back(message->store_fds()->Get(i));
+    mmap_sizes->push_back(message->mmap_sizes()->Get(i));
+  }
+  return plasma_error_status(message->error());
+}
+
 Status SendAbortRequest(int sock, ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = CreatePlasmaAbortRequest(fbb, fbb.CreateString(object_id.binary()));
@@ -165,12 +266,22 @@ Status ReadAbortReply(uint8_t* data, size_t size, ObjectID* object_id) {
 
 // Seal messages.
 
-Status SendSealRequest(int sock, ObjectID object_id, unsigned char* digest) {
+template <typename Destination>
+Status SendSealRequestImpl(Destination destination, ObjectID object_id,
+                           unsigned char* digest) {
   flatbuffers::FlatBufferBuilder fbb;
   auto digest_string = fbb.CreateString(reinterpret_cast<char*>(digest), kDigestSize);
   auto message =
       CreatePlasmaSealRequest(fbb, fbb.CreateString(object_id.binary()), digest_string);
-  return PlasmaSend(sock, MessageType_PlasmaSealRequest, &fbb, message);
+  return PlasmaSend(destination, MessageType_PlasmaSealRequest, &fbb, message);
+}
+
+Status SendSealRequest(int sock, ObjectID object_id, unsigned char* digest) {
+  return SendSealRequestImpl(sock, object_id, digest);
+}
+
+Status SendSealRequest(MessageRing* ring, ObjectID object_id, unsigned char* digest) {
+  return SendSealRequestImpl(ring, object_id, digest);
 }
 
 Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
@@ -184,6 +295,47 @@ Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
   return Status::OK();
 }
 
+template <typename Destination>
+Status SendSealManyRequestImpl(Destination destination, const ObjectID* object_ids,
+                               int64_t num_objects, const unsigned char* digests) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> digest_strings;
+  for (int64_t i = 0; i < num_objects; ++i) {
+    digest_strings.push_back(fbb.CreateString(
+        reinterpret_cast<const char*>(digests + i * kDigestSize), kDigestSize));
+  }
+  auto message =
+      CreatePlasmaSealManyRequest(fbb, to_flatbuffer(&fbb, object_ids, num_objects),
+                                  fbb.CreateVector(digest_strings));
+  return PlasmaSend(destination, MessageType_PlasmaSealManyRequest, &fbb, message);
+}
+
+Status SendSealManyRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
+                           const unsigned char* digests) {
+  return SendSealManyRequestImpl(sock, object_ids, num_objects, digests);
+}
+
+Status SendSealManyRequest(MessageRing* ring, const ObjectID* object_ids,
+                           int64_t num_objects, const unsigned char* digests) {
+  return SendSealManyRequestImpl(ring, object_ids, num_objects, digests);
+}
+
+Status ReadSealManyRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                           std::vector<unsigned char>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaSealManyRequest>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  const uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->digests()->size() == num_objects);
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    auto digest = message->digests()->Get(i);
+    ARROW_CHECK(digest->size() == kDigestSize);
+    digests->insert(digests->end(), digest->data(), digest->data() + kDigestSize);
+  }
+  return Status::OK();
+}
+
 Status SendSealReply(int sock, ObjectID object_id, int error) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = CreatePlasmaSealReply(fbb, fbb.CreateString(object_id.binary()),
@@ -201,10 +353,19 @@ Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id) {
 
 // Release messages.
 
-Status SendReleaseRequest(int sock, ObjectID object_id) {
+template <typename Destination>
+Status SendReleaseRequestImpl(Destination destination, ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = CreatePlasmaReleaseRequest(fbb, fbb.CreateString(object_id.binary()));
-  return PlasmaSend(sock, MessageType_PlasmaReleaseRequest, &fbb, message);
+  return PlasmaSend(destination, MessageType_PlasmaReleaseRequest, &fbb, message);
+}
+
+Status SendReleaseRequest(int sock, ObjectID object_id) {
+  return SendReleaseRequestImpl(sock, object_id);
+}
+
+Status SendReleaseRequest(MessageRing* ring, ObjectID object_id) {
+  return SendReleaseRequestImpl(ring, object_id);
 }
 
 Status ReadReleaseRequest(uint8_t* data, size_t size, ObjectID* object_id) {
@@ -215,6 +376,36 @@ Status ReadReleaseRequest(uint8_t* data, size_t size, ObjectID* object_id) {
   return Status::OK();
 }
 
+template <typename Destination>
+Status SendReleaseManyRequestImpl(Destination destination, const ObjectID* object_ids,
+                                  int64_t num_objects) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message =
+      CreatePlasmaReleaseManyRequest(fbb, to_flatbuffer(&fbb, object_ids, num_objects));
+  return PlasmaSend(destination, MessageType_PlasmaReleaseManyRequest, &fbb, message);
+}
+
+Status SendReleaseManyRequest(int sock, const ObjectID* object_ids,
+                              int64_t num_objects) {
+  return SendReleaseManyRequestImpl(sock, object_ids, num_objects);
+}
+
+Status SendReleaseManyRequest(MessageRing* ring, const ObjectID* object_ids,
+                              int64_t num_objects) {
+  return SendReleaseManyRequestImpl(ring, object_ids, num_objects);
+}
+
+Status ReadReleaseManyRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaReleaseManyRequest>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  return Status::OK();
+}
+
 Status SendReleaseReply(int sock, ObjectID object_id, int error) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = CreatePlasmaReleaseReply(fbb, fbb.CreateString(object_id.binary()),
@@ -261,6 +452,39 @@ Status ReadDeleteReply(uint8_t* data, size_t size, ObjectID* object_id) {
   return plasma_error_status(message->error());
 }
 
+// Pin messages.
+
+Status SendPinRequest(int sock, ObjectID object_id, bool pinned) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message =
+      CreatePlasmaPinRequest(fbb, fbb.CreateString(object_id.binary()), pinned);
+  return PlasmaSend(sock, MessageType_PlasmaPinRequest, &fbb, message);
+}
+
+Status ReadPinRequest(uint8_t* data, size_t size, ObjectID* object_id, bool* pinned) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaPinRequest>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  *object_id = ObjectID::from_binary(message->object_id()->str());
+  *pinned = message->pinned();
+  return Status::OK();
+}
+
+Status SendPinReply(int sock, ObjectID object_id, int error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = CreatePlasmaPinReply(fbb, fbb.CreateString(object_id.binary()),
+                                      static_cast<PlasmaError>(error));
+  return PlasmaSend(sock, MessageType_PlasmaPinReply, &fbb, message);
+}
+
+Status ReadPinReply(uint8_t* data, size_t size, ObjectID* object_id) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaPinReply>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  *object_id = ObjectID::from_binary(message->object_id()->str());
+  return plasma_error_status(message->error());
+}
+
 // Satus messages.
 
 Status SendStatusRequest(int sock, const ObjectID* object_ids, int64_t num_objects) {
@@ -368,6 +592,122 @@ Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity) {
   return Status::OK();
 }
 
+Status SendConnectRingRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = CreatePlasmaConnectRingRequest(fbb);
+  return PlasmaSend(sock, MessageType_PlasmaConnectRingRequest, &fbb, message);
+}
+
+Status ReadConnectRingRequest(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaConnectRingRequest>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  return Status::OK();
+}
+
+Status SendConnectRingReply(int sock, int error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = CreatePlasmaConnectRingReply(fbb, static_cast<PlasmaError>(error));
+  return PlasmaSend(sock, MessageType_PlasmaConnectRingReply, &fbb, message);
+}
+
+Status ReadConnectRingReply(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaConnectRingReply>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  return plasma_error_status(message->error());
+}
+
+// Metrics messages.
+
+Status SendMetricsRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = CreatePlasmaMetricsRequest(fbb);
+  return PlasmaSend(sock, MessageType_PlasmaMetricsRequest, &fbb, message);
+}
+
+Status ReadMetricsRequest(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaMetricsRequest>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  return Status::OK();
+}
+
+Status SendMetricsReply(int sock, const StoreMetrics& metrics) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<int64_t> types, counts, total_us, max_us, buckets;
+  for (const auto& entry : metrics.request_latencies) {
+    types.push_back(entry.first);
+    counts.push_back(entry.second.count);
+    total_us.push_back(entry.second.total_us);
+    max_us.push_back(entry.second.max_us);
+    buckets.insert(buckets.end(), entry.second.buckets.begin(),
+                   entry.second.buckets.end());
+  }
+  std::vector<int64_t> slab_object_sizes, slab_num_slabs, slab_num_slots,
+      slab_num_objects;
+  for (const auto& slab_class : metrics.slab_classes) {
+    slab_object_sizes.push_back(slab_class.object_size);
+    slab_num_slabs.push_back(slab_class.num_slabs);
+    slab_num_slots.push_back(slab_class.num_slots);
+    slab_num_objects.push_back(slab_class.num_objects);
+  }
+  auto message = CreatePlasmaMetricsReply(
+      fbb, metrics.memory_capacity, metrics.memory_used, metrics.malloc_footprint,
+      metrics.malloc_allocated, metrics.malloc_free_chunks, metrics.num_objects,
+      metrics.num_clients, metrics.num_pending_get_requests, metrics.num_objects_evicted,
+      metrics.num_bytes_evicted, metrics.num_objects_spilled, metrics.num_bytes_spilled,
+      metrics.num_objects_restored, fbb.CreateVector(types), fbb.CreateVector(counts),
+      fbb.CreateVector(total_us), fbb.CreateVector(max_us), fbb.CreateVector(buckets),
+      fbb.CreateVector(slab_object_sizes), fbb.CreateVector(slab_num_slabs),
+      fbb.CreateVector(slab_num_slots), fbb.CreateVector(slab_num_objects));
+  return PlasmaSend(sock, MessageType_PlasmaMetricsReply, &fbb, message);
+}
+
+Status ReadMetricsReply(uint8_t* data, size_t size, StoreMetrics* metrics) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<PlasmaMetricsReply>(data);
+  DCHECK(verify_flatbuffer(message, data, size));
+  metrics->memory_capacity = message->memory_capacity();
+  metrics->memory_used = message->memory_used();
+  metrics->malloc_footprint = message->malloc_footprint();
+  metrics->malloc_allocated = message->malloc_allocated();
+  metrics->malloc_free_chunks = message->malloc_free_chunks();
+  metrics->num_objects = message->num_objects();
+  metrics->num_clients = message->num_clients();
+  metrics->num_pending_get_requests = message->num_pending_get_requests();
+  metrics->num_objects_evicted = message->num_objects_evicted();
+  metrics->num_bytes_evicted = message->num_bytes_evicted();
+  metrics->num_objects_spilled = message->num_objects_spilled();
+  metrics->num_bytes_spilled = message->num_bytes_spilled();
+  metrics->num_objects_restored = message->num_objects_restored();
+  metrics->request_latencies.clear();
+  const uoffset_t num_types = message->request_types()->size();
+  ARROW_CHECK(message->request_buckets()->size() ==
+              num_types * LatencyHistogram::kNumBuckets);
+  for (uoffset_t i = 0; i < num_types; ++i) {
+    LatencyHistogram& latencies =
+        metrics->request_latencies[message->request_types()->Get(i)];
+    latencies.count = message->request_counts()->Get(i);
+    latencies.total_us = message->request_total_us()->Get(i);
+    latencies.max_us = message->request_max_us()->Get(i);
+    for (int j = 0; j < LatencyHistogram::kNumBuckets; ++j) {
+      latencies.buckets[j] =
+          message->request_buckets()->Get(i * LatencyHistogram::kNumBuckets + j);
+    }
+  }
+  const uoffset_t num_slab_classes = message->slab_object_sizes()->size();
+  metrics->slab_classes.resize(num_slab_classes);
+  for (uoffset_t i = 0; i < num_slab_classes; ++i) {
+    SlabClassMetrics& slab_class = metrics->slab_classes[i];
+    slab_class.object_size = message->slab_object_sizes()->Get(i);
+    slab_class.num_slabs = message->slab_num_slabs()->Get(i);
+    slab_class.num_slots = message->slab_num_slots()->Get(i);
+    slab_class.num_objects = message->slab_num_objects()->Get(i);
+  }
+  return Status::OK();
+}
+
 // Evict messages.
 
 Status SendEvictRequest(int sock, int64_t num_bytes) {
@@ -400,16 +740,28 @@ Status ReadEvictReply(uint8_t* data, size_t size, int64_t& num_bytes) {
 
 // Get messages.
 
-Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms) {
+template <typename Destination>
+Status SendGetRequestImpl(Destination destination, const ObjectID* object_ids,
+                          int64_t num_objects, int64_t timeout_ms,
+                          const std::vector<int>& mapped_fds) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = CreatePlasmaGetRequest(fbb, to_flatbuffer(&fbb, object_ids, num_objects),
-                                        timeout_ms);
-  return PlasmaSend(sock, MessageType_PlasmaGetRequest, &fbb, message);
+                                        timeout_ms, fbb.CreateVector(mapped_fds));
+  return PlasmaSend(destination, MessageType_PlasmaGetRequest, &fbb, message);
+}
+
+Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
+                      int64_t timeout_ms, const std::vector<int>& mapped_fds) {
+  return SendGetRequestImpl(sock, object_ids, num_objects, timeout_ms, mapped_fds);
+}
+
+Status SendGetRequest(MessageRing* ring, const ObjectID* object_ids, int64_t num_objects,
+                      int64_t timeout_ms, const std::vector<int>& mapped_fds) {
+  return SendGetRequestImpl(ring, object_ids, num_objects, timeout_ms, mapped_fds);
 }
 
 Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms) {
+                      int64_t* timeout_ms, std::vector<int>* mapped_fds) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<PlasmaGetRequest>(data);
   DCHECK(verify_flatbuffer(message, data, size));
@@ -418,11 +770,18 @@ Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_
     object_ids.push_back(ObjectID::from_binary(object_id));
   }
   *timeout_ms = message->timeout_ms();
+  // The field is absent from the requests of older clients.
+  if (mapped_fds != nullptr && message->mapped_fds() != nullptr) {
+    for (uoffset_t i = 0; i < message->mapped_fds()->size(); ++i) {
+      mapped_fds->push_back(message->mapped_fds()->Get(i));
+    }
+  }
   return Status::OK();
 }
 
-Status SendGetReply(
-    int sock, ObjectID object_ids[],
+template <typename Destination>
+Status SendGetReplyImpl(
+    Destination destination, ObjectID object_ids[],
     std::unordered_map<ObjectID, PlasmaObject, UniqueIDHasher>& plasma_objects,
     int64_t num_objects, const std::vector<int>& store_fds,
     const std::vector<int64_t>& mmap_sizes) {
@@ -448,7 +807,25 @@ Status SendGetReply(
       fbb, to_flatbuffer(&fbb, object_ids, num_objects),
       fbb.CreateVectorOfStructs(objects.data(), num_objects), fbb.CreateVector(store_fds),
       fbb.CreateVector(mmap_sizes), fbb.CreateVector(handles));
-  return PlasmaSend(sock, MessageType_PlasmaGetReply, &fbb, message);
+  return PlasmaSend(destination, MessageType_PlasmaGetReply, &fbb, message);
+}
+
+Status SendGetReply(
+    int sock, ObjectID object_ids[],
+    std::unordered_map<ObjectID, PlasmaObject, UniqueIDHasher>& plasma_objects,
+    int64_t num_objects, const std::vector<int>& store_fds,
+    const std::vector<int64_t>& mmap_sizes) {
+  return SendGetReplyImpl(sock, object_ids, plasma_objects, num_objects, store_fds,
+                          mmap_sizes);
+}
+
+Status SendGetReply(
+    MessageRing* ring, ObjectID object_ids[],
+    std::unordered_map<ObjectID, PlasmaObject, UniqueIDHasher>& plasma_objects,
+    int64_t num_objects, const std::vector<int>& store_fds,
+    const std::vector<int64_t>& mmap_sizes) {
+  return SendGetReplyImpl(ring, object_ids, plasma_objects, num_objects, store_fds,
+                          mmap_sizes);
 }
 
 Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
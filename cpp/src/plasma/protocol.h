@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "plasma/metrics.h"
 #include "plasma/plasma.h"
 #include "plasma/plasma_generated.h"
 
@@ -30,6 +31,8 @@ namespace plasma {
 
 using arrow::Status;
 
+class MessageRing;
+
 template <class T>
 bool verify_flatbuffer(T* object, uint8_t* data, size_t size) {
   flatbuffers::Verifier verifier(data, size);
@@ -40,6 +43,15 @@ bool verify_flatbuffer(T* object, uint8_t* data, size_t size) {
 
 Status PlasmaReceive(int sock, int64_t message_type, std::vector<uint8_t>* buffer);
 
+/// Receive a message from a shared-memory ring, failing if the socket to the
+/// sender is closed meanwhile.
+Status PlasmaReceive(MessageRing* ring, int peer_fd, int64_t message_type,
+                     std::vector<uint8_t>* buffer);
+
+// The Get, Seal and Release requests and the Get replies can also be sent on a
+// shared-memory ring, which fails with Status::OutOfMemory when the ring does
+// not have enough room for the message.
+
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
@@ -54,6 +66,25 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object, int e
 Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
                        PlasmaObject* object, int* store_fd, int64_t* mmap_size);
 
+Status SendCreateManyRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
+                             const int64_t* data_sizes, const int64_t* metadata_sizes);
+
+Status ReadCreateManyRequest(uint8_t* data, size_t size,
+                             std::vector<ObjectID>* object_ids,
+                             std::vector<int64_t>* data_sizes,
+                             std::vector<int64_t>* metadata_sizes);
+
+Status SendCreateManyReply(int sock, const std::vector<ObjectID>& object_ids,
+                           const std::vector<PlasmaObject>& objects, int error,
+                           const std::vector<int>& store_fds,
+                           const std::vector<int64_t>& mmap_sizes);
+
+Status ReadCreateManyReply(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids,
+                           std::vector<PlasmaObject>* objects,
+                           std::vector<int>* store_fds,
+                           std::vector<int64_t>* mmap_sizes);
+
 Status SendAbortRequest(int sock, ObjectID object_id);
 
 Status ReadAbortRequest(uint8_t* data, size_t size, ObjectID* object_id);
@@ -66,20 +97,38 @@ Status ReadAbortReply(uint8_t* data, size_t size, ObjectID* object_id);
 
 Status SendSealRequest(int sock, ObjectID object_id, unsigned char* digest);
 
+Status SendSealRequest(MessageRing* ring, ObjectID object_id, unsigned char* digest);
+
 Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
                        unsigned char* digest);
 
+/// The digests are concatenated, kDigestSize bytes each.
+Status SendSealManyRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
+                           const unsigned char* digests);
+
+Status SendSealManyRequest(MessageRing* ring, const ObjectID* object_ids,
+                           int64_t num_objects, const unsigned char* digests);
+
+Status ReadSealManyRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                           std::vector<unsigned char>* digests);
+
 Status SendSealReply(int sock, ObjectID object_id, int error);
 
 Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
 
 /* Plasma Get message functions. */
 
+/// \param mapped_fds The store files mapped by the client, whose descriptors
+///   the store need not send with the reply.
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms);
+                      int64_t timeout_ms,
+                      const std::vector<int>& mapped_fds = std::vector<int>());
+
+Status SendGetRequest(MessageRing* ring, const ObjectID* object_ids, int64_t num_objects,
+                      int64_t timeout_ms, const std::vector<int>& mapped_fds);
 
 Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms);
+                      int64_t* timeout_ms, std::vector<int>* mapped_fds = nullptr);
 
 Status SendGetReply(
     int sock, ObjectID object_ids[],
@@ -87,6 +136,12 @@ Status SendGetReply(
     int64_t num_objects, const std::vector<int>& store_fds,
     const std::vector<int64_t>& mmap_sizes);
 
+Status SendGetReply(
+    MessageRing* ring, ObjectID object_ids[],
+    std::unordered_map<ObjectID, PlasmaObject, UniqueIDHasher>& plasma_objects,
+    int64_t num_objects, const std::vector<int>& store_fds,
+    const std::vector<int64_t>& mmap_sizes);
+
 Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
                     PlasmaObject plasma_objects[], int64_t num_objects,
                     std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes);
@@ -95,8 +150,19 @@ Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
 
 Status SendReleaseRequest(int sock, ObjectID object_id);
 
+Status SendReleaseRequest(MessageRing* ring, ObjectID object_id);
+
 Status ReadReleaseRequest(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendReleaseManyRequest(int sock, const ObjectID* object_ids,
+                              int64_t num_objects);
+
+Status SendReleaseManyRequest(MessageRing* ring, const ObjectID* object_ids,
+                              int64_t num_objects);
+
+Status ReadReleaseManyRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids);
+
 Status SendReleaseReply(int sock, ObjectID object_id, int error);
 
 Status ReadReleaseReply(uint8_t* data, size_t size, ObjectID* object_id);
@@ -111,6 +177,16 @@ Status SendDeleteReply(int sock, ObjectID object_id, int error);
 
 Status ReadDeleteReply(uint8_t* data, size_t size, ObjectID* object_id);
 
+/* Plasma Pin message functions. */
+
+Status SendPinRequest(int sock, ObjectID object_id, bool pinned);
+
+Status ReadPinRequest(uint8_t* data, size_t size, ObjectID* object_id, bool* pinned);
+
+Status SendPinReply(int sock, ObjectID object_id, int error);
+
+Status ReadPinReply(uint8_t* data, size_t size, ObjectID* object_id);
+
 /* Satus messages. */
 
 Status SendStatusRequest(int sock, const ObjectID* object_ids, int64_t num_objects);
@@ -147,6 +223,26 @@ Status SendConnectReply(int sock, int64_t memory_capacity);
 
 Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity);
 
+/// The descriptors of the rings are sent after the request with send_fd, see
+/// PlasmaConnectRingRequest in plasma.fbs.
+Status SendConnectRingRequest(int sock);
+
+Status ReadConnectRingRequest(uint8_t* data, size_t size);
+
+Status SendConnectRingReply(int sock, int error);
+
+Status ReadConnectRingReply(uint8_t* data, size_t size);
+
+/* Plasma Metrics message functions. */
+
+Status SendMetricsRequest(int sock);
+
+Status ReadMetricsRequest(uint8_t* data, size_t size);
+
+Status SendMetricsReply(int sock, const StoreMetrics& metrics);
+
+Status ReadMetricsReply(uint8_t* data, size_t size, StoreMetrics* metrics);
+
 /* Plasma Evict message functions (no reply so far). */
 
 Status SendEvictRequest(int sock, int64_t num_bytes);
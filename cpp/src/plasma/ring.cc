@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/ring.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace plasma {
+
+/// The state shared by the producer and the consumer, at the start of the
+/// shared memory. The positions only grow, the ring wrapping around them.
+struct RingHeader {
+  /// Number of bytes ever written, advanced by the producer
+  std::atomic<int64_t> head;
+  char head_padding[64 - sizeof(std::atomic<int64_t>)];
+  /// Number of bytes ever read, advanced by the consumer
+  std::atomic<int64_t> tail;
+  char tail_padding[64 - sizeof(std::atomic<int64_t>)];
+  /// Whether the consumer waits on the doorbell
+  std::atomic<int32_t> consumer_waiting;
+};
+
+namespace {
+
+/// Size of the header, keeping the messages on their own cache lines
+constexpr int64_t kRingHeaderSize = 256;
+
+/// Messages are preceded by their type and length
+constexpr int64_t kFrameHeaderSize = 2 * sizeof(int64_t);
+
+/// How long Receive spins before waiting on the doorbell. Replies of the
+/// store to a client usually come well within this time
+constexpr std::chrono::microseconds kRingSpinTime(50);
+
+static_assert(sizeof(RingHeader) <= kRingHeaderSize, "RingHeader is too large");
+
+}  // namespace
+
+MessageRing::MessageRing(int memory_fd, int doorbell_fd, RingHeader* header,
+                         int64_t capacity)
+    : memory_fd_(memory_fd),
+      doorbell_fd_(doorbell_fd),
+      header_(header),
+      data_(reinterpret_cast<uint8_t*>(header) + kRingHeaderSize),
+      capacity_(capacity) {}
+
+MessageRing::~MessageRing() {
+  munmap(header_, kRingHeaderSize + capacity_);
+  close(memory_fd_);
+  close(doorbell_fd_);
+}
+
+Status MessageRing::Create(int64_t capacity, std::unique_ptr<MessageRing>* out) {
+#ifdef __linux__
+  if (capacity <= kFrameHeaderSize) {
+    return Status::Invalid("Ring capacity is too small");
+  }
+  std::string file_template = "/dev/shm/plasma-ringXXXXXX";
+  std::vector<char> file_name(file_template.begin(), file_template.end());
+  file_name.push_back('\0');
+  int memory_fd = mkstemp(&file_name[0]);
+  if (memory_fd < 0) {
+    return Status::IOError(std::string("Failed to create ring file: ") + strerror(errno));
+  }
+  // Immediately unlink the file so we do not leave traces in the system.
+  unlink(&file_name[0]);
+  if (ftruncate(memory_fd, static_cast<off_t>(kRingHeaderSize + capacity)) != 0) {
+    close(memory_fd);
+    return Status::IOError(std::string("Failed to size ring file: ") + strerror(errno));
+  }
+  int doorbell_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (doorbell_fd < 0) {
+    close(memory_fd);
+    return Status::IOError(std::string("Failed to create ring doorbell: ") +
+                           strerror(errno));
+  }
+  // The file is zero-filled, which initializes the header.
+  return Open(memory_fd, doorbell_fd, out);
+#else
+  ARROW_UNUSED(capacity);
+  ARROW_UNUSED(out);
+  return Status::NotImplemented("Shared-memory rings are only supported on Linux");
+#endif
+}
+
+Status MessageRing::Open(int memory_fd, int doorbell_fd,
+                         std::unique_ptr<MessageRing>* out) {
+  struct stat file_stat;
+  if (fstat(memory_fd, &file_stat) != 0 || file_stat.st_size <= kRingHeaderSize) {
+    close(memory_fd);
+    close(doorbell_fd);
+    return Status::IOError("Invalid ring file");
+  }
+  void* pointer = mmap(NULL, file_stat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       memory_fd, 0);
+  if (pointer == MAP_FAILED) {
+    close(memory_fd);
+    close(doorbell_fd);
+    return Status::IOError(std::string("Failed to map ring file: ") + strerror(errno));
+  }
+  out->reset(new MessageRing(memory_fd, doorbell_fd,
+                             reinterpret_cast<RingHeader*>(pointer),
+                             file_stat.st_size - kRingHeaderSize));
+  return Status::OK();
+}
+
+void MessageRing::CopyIn(int64_t position, const uint8_t* bytes, int64_t length) {
+  const int64_t offset = position % capacity_;
+  const int64_t first = std::min(length, capacity_ - offset);
+  memcpy(data_ + offset, bytes, first);
+  memcpy(data_, bytes + first, length - first);
+}
+
+void MessageRing::CopyOut(int64_t position, uint8_t* bytes, int64_t length) const {
+  const int64_t offset = position % capacity_;
+  const int64_t first = std::min(length, capacity_ - offset);
+  memcpy(bytes, data_ + offset, first);
+  memcpy(bytes + first, data_, length - first);
+}
+
+void MessageRing::RingDoorbell() {
+  uint64_t one = 1;
+  if (write(doorbell_fd_, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+    ARROW_LOG(WARNING) << "Failed to ring doorbell: " << strerror(errno);
+  }
+}
+
+bool MessageRing::Fits(int64_t length) const {
+  return kFrameHeaderSize + length <= capacity_;
+}
+
+bool MessageRing::Write(int64_t type, int64_t length, const uint8_t* bytes) {
+  const int64_t head = header_->head.load(std::memory_order_relaxed);
+  const int64_t tail = header_->tail.load(std::memory_order_acquire);
+  if (kFrameHeaderSize + length > capacity_ - (head - tail)) {
+    return false;
+  }
+  const int64_t frame_header[2] = {type, length};
+  CopyIn(head, reinterpret_cast<const uint8_t*>(frame_header), kFrameHeaderSize);
+  CopyIn(head + kFrameHeaderSize, bytes, length);
+  header_->head.store(head + kFrameHeaderSize + length, std::memory_order_release);
+  // Pairs with the fence in EndRead and Receive: either the consumer sees the
+  // message, or we see that it waits.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (header_->consumer_waiting.load(std::memory_order_relaxed)) {
+    RingDoorbell();
+  }
+  return true;
+}
+
+bool MessageRing::Read(int64_t* type, std::vector<uint8_t>* buffer) {
+  const int64_t tail = header_->tail.load(std::memory_order_relaxed);
+  const int64_t head = header_->head.load(std::memory_order_acquire);
+  if (head == tail) {
+    return false;
+  }
+  int64_t frame_header[2];
+  CopyOut(tail, reinterpret_cast<uint8_t*>(frame_header), kFrameHeaderSize);
+  *type = frame_header[0];
+  const int64_t length = frame_header[1];
+  ARROW_CHECK(length >= 0 && kFrameHeaderSize + length <= head - tail)
+      << "Corrupt ring message of length " << length;
+  if (static_cast<size_t>(length) > buffer->size()) {
+    buffer->resize(length);
+  }
+  CopyOut(tail + kFrameHeaderSize, buffer->data(), length);
+  header_->tail.store(tail + kFrameHeaderSize + length, std::memory_order_release);
+  return true;
+}
+
+Status MessageRing::Receive(int peer_fd, int64_t* type, std::vector<uint8_t>* buffer) {
+  const auto deadline = std::chrono::steady_clock::now() + kRingSpinTime;
+  for (int i = 1; i % 64 != 0 || std::chrono::steady_clock::now() < deadline; ++i) {
+    if (Read(type, buffer)) {
+      return Status::OK();
+    }
+  }
+  while (true) {
+    header_->consumer_waiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (Read(type, buffer)) {
+      header_->consumer_waiting.store(0, std::memory_order_relaxed);
+      return Status::OK();
+    }
+    struct pollfd fds[2] = {{doorbell_fd_, POLLIN, 0}, {peer_fd, POLLIN, 0}};
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError(std::string("Failed to wait on ring: ") + strerror(errno));
+    }
+    header_->consumer_waiting.store(0, std::memory_order_relaxed);
+    uint64_t count;
+    if (read(doorbell_fd_, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+      return Status::IOError(std::string("Failed to clear ring doorbell: ") +
+                             strerror(errno));
+    }
+    if (Read(type, buffer)) {
+      return Status::OK();
+    }
+    if (fds[1].revents != 0) {
+      // Nothing else is sent on the socket while a reply is awaited on the ring.
+      return Status::IOError("Connection closed while waiting on ring");
+    }
+  }
+}
+
+void MessageRing::BeginRead() {
+  header_->consumer_waiting.store(0, std::memory_order_relaxed);
+  uint64_t count;
+  if (read(doorbell_fd_, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+    ARROW_LOG(WARNING) << "Failed to clear ring doorbell: " << strerror(errno);
+  }
+}
+
+bool MessageRing::EndRead() {
+  header_->consumer_waiting.store(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (header_->head.load(std::memory_order_relaxed) !=
+      header_->tail.load(std::memory_order_relaxed)) {
+    header_->consumer_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace plasma
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_RING_H
+#define PLASMA_RING_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+
+namespace plasma {
+
+using arrow::Status;
+
+struct RingHeader;
+
+/// Default capacity in bytes of the rings between a client and the store.
+constexpr int64_t kDefaultRingCapacity = 1 << 20;
+
+/// A queue of messages in shared memory, with a single producer and a single
+/// consumer in possibly different processes. The consumer can wait for
+/// messages on a doorbell, an eventfd which the producer only writes to when
+/// the consumer waits, so that neither side makes system calls while the
+/// consumer is busy reading.
+///
+/// The messages are framed like those sent on the Plasma sockets, with a type
+/// and a length. Only supported on Linux.
+class MessageRing {
+ public:
+  ~MessageRing();
+
+  /// Create a ring in a new shared memory file.
+  ///
+  /// @param capacity The number of bytes of messages the ring can hold.
+  /// @param out The created ring.
+  /// @return The return status.
+  static Status Create(int64_t capacity, std::unique_ptr<MessageRing>* out);
+
+  /// Map a ring created by another process, taking ownership of its file
+  /// descriptors.
+  ///
+  /// @param memory_fd The shared memory file of the ring.
+  /// @param doorbell_fd The doorbell of the ring.
+  /// @param out The opened ring.
+  /// @return The return status.
+  static Status Open(int memory_fd, int doorbell_fd, std::unique_ptr<MessageRing>* out);
+
+  /// The shared memory file, to be sent to the other process.
+  int memory_fd() const { return memory_fd_; }
+
+  /// The doorbell, to be sent to the other process, or added to an event loop
+  /// by a consumer.
+  int doorbell_fd() const { return doorbell_fd_; }
+
+  /// Append a message, ringing the doorbell if the consumer waits. Called by
+  /// the producer only.
+  ///
+  /// @return false if there is not enough room in the ring for the message,
+  ///   which must then be sent by other means.
+  bool Write(int64_t type, int64_t length, const uint8_t* bytes);
+
+  /// Whether a message of this length can ever be written to the ring.
+  bool Fits(int64_t length) const;
+
+  /// Take the next message, if any. Called by the consumer only. As with
+  /// ReadMessage, the buffer is only grown to the length of the message.
+  ///
+  /// @return false if the ring is empty.
+  bool Read(int64_t* type, std::vector<uint8_t>* buffer);
+
+  /// Take the next message, spinning for a while before waiting on the
+  /// doorbell. Called by the consumer only.
+  ///
+  /// @param peer_fd A socket to the producer, which fails the wait when it is
+  ///   closed.
+  /// @return The return status.
+  Status Receive(int peer_fd, int64_t* type, std::vector<uint8_t>* buffer);
+
+  /// Tell the producer that the consumer is reading, so that it does not ring
+  /// the doorbell, and clear the doorbell. For consumers driven by an event
+  /// loop watching the doorbell, which call EndRead once to start waiting.
+  void BeginRead();
+
+  /// Tell the producer that the consumer waits on the doorbell.
+  ///
+  /// @return false if a message was written meanwhile, in which case the
+  ///   consumer is still reading and must read it.
+  bool EndRead();
+
+ private:
+  MessageRing(int memory_fd, int doorbell_fd, RingHeader* header, int64_t capacity);
+
+  /// Copy bytes to or from the ring at a position, wrapping around its end.
+  void CopyIn(int64_t position, const uint8_t* bytes, int64_t length);
+  void CopyOut(int64_t position, uint8_t* bytes, int64_t length) const;
+
+  void RingDoorbell();
+
+  int memory_fd_;
+  int doorbell_fd_;
+  RingHeader* header_;
+  /// The messages, following the header in the shared memory
+  uint8_t* data_;
+  /// Read from the file size, as the header can be written by the other process
+  int64_t capacity_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_RING_H
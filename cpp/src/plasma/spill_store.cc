@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/spill_store.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+#include "plasma/io.h"
+
+namespace plasma {
+
+SpillStore::SpillStore(const std::string& directory)
+    : directory_(directory), pending_reads_(0) {}
+
+SpillStore::~SpillStore() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    reads_done_.wait(lock, [this]() { return pending_reads_ == 0; });
+  }
+  DIR* dir = opendir(directory_.c_str());
+  if (dir != NULL) {
+    struct dirent* file;
+    while ((file = readdir(dir)) != NULL) {
+      if (strcmp(file->d_name, ".") != 0 && strcmp(file->d_name, "..") != 0) {
+        unlink((directory_ + "/" + file->d_name).c_str());
+      }
+    }
+    closedir(dir);
+  }
+  rmdir(directory_.c_str());
+}
+
+Status SpillStore::Open(const std::string& directory, std::unique_ptr<SpillStore>* out) {
+  std::string path_template = directory + "/plasma-spillXXXXXX";
+  std::vector<char> path(path_template.begin(), path_template.end());
+  path.push_back('\0');
+  if (mkdtemp(&path[0]) == NULL) {
+    return Status::IOError("Failed to create spill directory in " + directory + ": " +
+                           strerror(errno));
+  }
+  out->reset(new SpillStore(&path[0]));
+  return Status::OK();
+}
+
+std::string SpillStore::object_path(const ObjectID& object_id) const {
+  return directory_ + "/" + object_id.hex();
+}
+
+Status SpillStore::Write(const ObjectID& object_id, const uint8_t* data, int64_t size) {
+  int fd = open(object_path(object_id).c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0) {
+    return Status::IOError(std::string("Failed to create spill file: ") +
+                           strerror(errno));
+  }
+  Status s = WriteBytes(fd, const_cast<uint8_t*>(data), size);
+  close(fd);
+  if (!s.ok()) {
+    Remove(object_id);
+  }
+  return s;
+}
+
+Status SpillStore::Read(const ObjectID& object_id, uint8_t* data, int64_t size) {
+  int fd = open(object_path(object_id).c_str(), O_RDONLY);
+  if (fd < 0) {
+    return Status::IOError(std::string("Failed to open spill file: ") + strerror(errno));
+  }
+  Status s = ReadBytes(fd, data, size);
+  close(fd);
+  return s;
+}
+
+Status SpillStore::ReadAsync(const ObjectID& object_id, uint8_t* data, int64_t size,
+                             std::function<void(const Status&)> done) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    ++pending_reads_;
+  }
+  Status s = arrow::internal::GetIOThreadPool()->Spawn([=]() {
+    done(Read(object_id, data, size));
+    std::lock_guard<std::mutex> guard(mutex_);
+    --pending_reads_;
+    reads_done_.notify_all();
+  });
+  if (!s.ok()) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    --pending_reads_;
+  }
+  return s;
+}
+
+void SpillStore::Remove(const ObjectID& object_id) {
+  unlink(object_path(object_id).c_str());
+}
+
+}  // namespace plasma
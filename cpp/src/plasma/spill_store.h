@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_SPILL_STORE_H
+#define PLASMA_SPILL_STORE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "arrow/status.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+using arrow::Status;
+
+/// A directory where the Plasma store writes the objects it evicts, one file
+/// per object, so that they can be restored instead of recomputed. The files
+/// are written without syncing them, leaving it to the operating system to
+/// write them back to the disk in the background.
+class SpillStore {
+ public:
+  /// Wait for the pending reads, and remove the files.
+  ~SpillStore();
+
+  /// Create a spill store in a new subdirectory of a directory, for instance
+  /// on a local SSD.
+  ///
+  /// @param directory The directory, which must exist.
+  /// @param out The created spill store.
+  /// @return The return status.
+  static Status Open(const std::string& directory, std::unique_ptr<SpillStore>* out);
+
+  /// Write the data and metadata of an object, replacing an earlier copy.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param data The data followed by the metadata of the object.
+  /// @param size The size of the data and metadata.
+  /// @return The return status.
+  Status Write(const ObjectID& object_id, const uint8_t* data, int64_t size);
+
+  /// Read the data and metadata of an object.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param data The memory where to read the object.
+  /// @param size The size of the data and metadata.
+  /// @return The return status.
+  Status Read(const ObjectID& object_id, uint8_t* data, int64_t size);
+
+  /// Read an object on the IO thread pool, then call done there with the
+  /// status of the read. The memory must remain valid until then.
+  Status ReadAsync(const ObjectID& object_id, uint8_t* data, int64_t size,
+                   std::function<void(const Status&)> done);
+
+  /// Remove the copy of an object.
+  void Remove(const ObjectID& object_id);
+
+ private:
+  explicit SpillStore(const std::string& directory);
+
+  std::string object_path(const ObjectID& object_id) const;
+
+  /// The subdirectory owned by this spill store.
+  std::string directory_;
+  /// Protects pending_reads_.
+  std::mutex mutex_;
+  std::condition_variable reads_done_;
+  int pending_reads_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_SPILL_STORE_H
@@ -18,10 +18,11 @@
 // PLASMA STORE: This is a simple object store server process
 //
 // It accepts incoming client connections on a unix domain socket
-// (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
-// connection and can create objects, wait for objects and seal
-// objects through that connection.
+// (name passed in via the -s option of the executable) and serves the
+// clients with one event loop thread, or with as many as passed in via
+// the -t option, each serving a share of the connections. Each client
+// establishes a connection and can create objects, wait for objects and
+// seal objects through that connection.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
@@ -40,12 +41,16 @@
 #include <sys/socket.h>
 #include <sys/statvfs.h>
 #include <sys/types.h>
+#include <pthread.h>
 #include <sys/un.h>
 #include <unistd.h>
 
-#include <deque>
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -91,6 +96,11 @@ struct GetRequest {
   /// The number of object requests in this wait request that are already
   /// satisfied.
   int64_t num_satisfied;
+  /// The store files that the client has mapped already, whose descriptors are
+  /// not sent with the reply.
+  std::unordered_set<int> mapped_fds;
+  /// Whether the reply goes on the reply ring of the client.
+  bool reply_on_ring;
 };
 
 GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
@@ -98,17 +108,32 @@ GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
       timer(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
-      num_satisfied(0) {
+      num_satisfied(0),
+      reply_on_ring(false) {
   std::unordered_set<ObjectID, UniqueIDHasher> unique_ids(object_ids.begin(),
                                                           object_ids.end());
   num_objects_to_wait_for = unique_ids.size();
 }
 
-Client::Client(int fd) : fd(fd) {}
+Client::Client(int fd, EventLoop* loop) : fd(fd), loop(loop) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, int64_t system_memory, std::string directory,
                          bool hugepages_enabled)
-    : loop_(loop), eviction_policy_(&store_info_) {
+    : PlasmaStore(std::vector<EventLoop*>{loop}, system_memory, directory,
+                  hugepages_enabled) {}
+
+PlasmaStore::PlasmaStore(const std::vector<EventLoop*>& loops, int64_t system_memory,
+                         std::string directory, bool hugepages_enabled,
+                         std::unique_ptr<EvictionCache> eviction_cache,
+                         std::unique_ptr<SpillStore> spill_store)
+    : loops_(loops),
+      next_loop_(0),
+      eviction_policy_(&store_info_, std::move(eviction_cache)),
+      restore_client_(-1, loops[0]),
+      receive_client_(-1, loops[0]),
+      num_pending_get_requests_(0),
+      spill_store_(std::move(spill_store)) {
+  ARROW_CHECK(!loops_.empty());
   store_info_.memory_capacity = system_memory;
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
@@ -119,15 +144,7 @@ PlasmaStore::PlasmaStore(EventLoop* loop, int64_t system_memory, std::string dir
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
 PlasmaStore::~PlasmaStore() {
-  for (const auto& element : pending_notifications_) {
-    auto object_notifications = element.second.object_notifications;
-    for (size_t i = 0; i < object_notifications.size(); ++i) {
-      uint8_t* notification = reinterpret_cast<uint8_t*>(object_notifications.at(i));
-      uint8_t* data = notification;
-      // TODO(pcm): Get rid of this delete.
-      delete[] data;
-    }
-  }
+  transfer_service_.reset();
 }
 
 const PlasmaStoreInfo* PlasmaStore::get_plasma_store_info() { return &store_info_; }
@@ -141,7 +158,8 @@ void PlasmaStore::add_client_to_object_clients(ObjectTableEntry* entry, Client*
   }
   // If there are no other clients using this object, notify the eviction policy
   // that the object is being used.
-  if (entry->clients.size() == 0) {
+  // Objects on GPUs are not managed by the eviction policy.
+  if (entry->clients.size() == 0 && entry->device_num == 0) {
     // Tell the eviction policy that this object is being used.
     std::vector<ObjectID> objects_to_evict;
     eviction_policy_.begin_object_access(entry->object_id, &objects_to_evict);
@@ -156,50 +174,65 @@ int PlasmaStore::create_object(const ObjectID& object_id, int64_t data_size,
                                int64_t metadata_size, int device_num, Client* client,
                                PlasmaObject* result) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
-  if (store_info_.objects.count(object_id) != 0) {
+  if (store_info_.objects.count(object_id) != 0 ||
+      spilled_objects_.count(object_id) != 0) {
     // There is already an object with the same ID in the Plasma Store, so
     // ignore this requst.
     return PlasmaError_ObjectExists;
   }
-  // Try to evict objects until there is enough space.
-  uint8_t* pointer;
+  uint8_t* pointer = NULL;
 #ifdef PLASMA_GPU
   std::shared_ptr<CudaBuffer> gpu_handle;
-  std::shared_ptr<CudaContext> context_;
   if (device_num != 0) {
-    manager_->GetContext(device_num - 1, &context_);
+    // Device memory is not managed by the eviction policy, objects are only
+    // created while it lasts.
+    std::shared_ptr<CudaContext> context;
+    Status s = manager_->GetContext(device_num - 1, &context);
+    if (s.ok()) {
+      s = context->Allocate(data_size + metadata_size, &gpu_handle);
+    }
+    if (s.ok()) {
+      s = gpu_handle->ExportForIpc(&result->ipc_handle);
+      if (!s.ok()) {
+        ARROW_UNUSED(context->Free(gpu_handle->mutable_data(), gpu_handle->size()));
+      }
+    }
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to allocate object " << object_id.hex()
+                         << " on device " << device_num << ": " << s.ToString();
+      return PlasmaError_OutOfMemory;
+    }
+  }
+#else
+  if (device_num != 0) {
+    ARROW_LOG(WARNING) << "Cannot create object " << object_id.hex() << " on device "
+                       << device_num << ", the store was built without GPU support";
+    return PlasmaError_OutOfMemory;
   }
 #endif
-  while (true) {
-    // Allocate space for the new object. We use dlmemalign instead of dlmalloc
-    // in order to align the allocated region to a 64-byte boundary. This is not
-    // strictly necessary, but it is an optimization that could speed up the
+  // Try to evict objects until there is enough space.
+  while (device_num == 0) {
+    // Allocate space for the new object, from a slab if it is small. The
+    // allocated region is aligned to a 64-byte boundary. This is not strictly
+    // necessary, but it is an optimization that could speed up the
     // computation of a hash of the data (see compute_object_hash_parallel in
     // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
     // it is not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
-    if (device_num == 0) {
-      pointer =
-          reinterpret_cast<uint8_t*>(dlmemalign(BLOCK_SIZE, data_size + metadata_size));
-      if (pointer == NULL) {
-        // Tell the eviction policy how much space we need to create this object.
-        std::vector<ObjectID> objects_to_evict;
-        bool success =
-            eviction_policy_.require_space(data_size + metadata_size, &objects_to_evict);
-        delete_objects(objects_to_evict);
-        // Return an error to the client if not enough space could be freed to
-        // create the object.
-        if (!success) {
-          return PlasmaError_OutOfMemory;
-        }
-      } else {
-        break;
+    pointer = reinterpret_cast<uint8_t*>(plasma_malloc(data_size + metadata_size));
+    if (pointer == NULL) {
+      // Tell the eviction policy how much space we need to create this object.
+      std::vector<ObjectID> objects_to_evict;
+      bool success =
+          eviction_policy_.require_space(data_size + metadata_size, &objects_to_evict);
+      delete_objects(objects_to_evict);
+      // Return an error to the client if not enough space could be freed to
+      // create the object.
+      if (!success) {
+        return PlasmaError_OutOfMemory;
       }
     } else {
-#ifdef PLASMA_GPU
-      context_->Allocate(data_size + metadata_size, &gpu_handle);
       break;
-#endif
     }
   }
   int fd = -1;
@@ -223,8 +256,8 @@ int PlasmaStore::create_object(const ObjectID& object_id, int64_t data_size,
   entry->device_num = device_num;
 #ifdef PLASMA_GPU
   if (device_num != 0) {
-    gpu_handle->ExportForIpc(&entry->ipc_handle);
-    result->ipc_handle = entry->ipc_handle;
+    entry->ipc_handle = result->ipc_handle;
+    entry->gpu_buffer = gpu_handle;
   }
 #endif
   store_info_.objects[object_id] = std::move(entry);
@@ -237,12 +270,34 @@ int PlasmaStore::create_object(const ObjectID& object_id, int64_t data_size,
   // Notify the eviction policy that this object was created. This must be done
   // immediately before the call to add_client_to_object_clients so that the
   // eviction policy does not have an opportunity to evict the object.
-  eviction_policy_.object_created(object_id);
+  if (device_num == 0) {
+    eviction_policy_.object_created(object_id);
+  }
   // Record that this client is using this object.
   add_client_to_object_clients(store_info_.objects[object_id].get(), client);
   return PlasmaError_OK;
 }
 
+int PlasmaStore::create_objects(const std::vector<ObjectID>& object_ids,
+                                const std::vector<int64_t>& data_sizes,
+                                const std::vector<int64_t>& metadata_sizes,
+                                Client* client, std::vector<PlasmaObject>* results) {
+  results->clear();
+  results->resize(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    int error_code = create_object(object_ids[i], data_sizes[i], metadata_sizes[i], 0,
+                                   client, &(*results)[i]);
+    if (error_code != PlasmaError_OK) {
+      for (size_t j = 0; j < i; ++j) {
+        ARROW_CHECK(abort_object(object_ids[j], client) == 1);
+      }
+      results->clear();
+      return error_code;
+    }
+  }
+  return PlasmaError_OK;
+}
+
 void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
   DCHECK(object != NULL);
   DCHECK(entry != NULL);
@@ -268,7 +323,8 @@ void PlasmaStore::return_from_get(GetRequest* get_req) {
   for (const auto& object_id : get_req->object_ids) {
     PlasmaObject& object = get_req->objects[object_id];
     int fd = object.store_fd;
-    if (object.data_size != -1 && fds_to_send.count(fd) == 0 && fd != -1) {
+    if (object.data_size != -1 && fds_to_send.count(fd) == 0 && fd != -1 &&
+        get_req->mapped_fds.count(fd) == 0) {
       fds_to_send.insert(fd);
       store_fds.push_back(fd);
       mmap_sizes.push_back(get_mmap_size(fd));
@@ -276,9 +332,19 @@ void PlasmaStore::return_from_get(GetRequest* get_req) {
   }
 
   // Send the get reply to the client.
-  Status s = SendGetReply(get_req->client->fd, &get_req->object_ids[0], get_req->objects,
-                          get_req->object_ids.size(), store_fds, mmap_sizes);
-  warn_if_sigpipe(s.ok() ? 0 : -1, get_req->client->fd);
+  Status s;
+  if (get_req->reply_on_ring) {
+    // The client only sends requests whose reply fits in the ring, and waits
+    // for the reply before sending another one.
+    s = SendGetReply(get_req->client->reply_ring.get(), &get_req->object_ids[0],
+                     get_req->objects, get_req->object_ids.size(), store_fds,
+                     mmap_sizes);
+    ARROW_CHECK(s.ok()) << "Get reply does not fit in ring: " << s;
+  } else {
+    s = SendGetReply(get_req->client->fd, &get_req->object_ids[0], get_req->objects,
+                     get_req->object_ids.size(), store_fds, mmap_sizes);
+    warn_if_sigpipe(s.ok() ? 0 : -1, get_req->client->fd);
+  }
   // If we successfully sent the get reply message to the client, then also send
   // the file descriptors.
   if (s.ok()) {
@@ -303,6 +369,16 @@ void PlasmaStore::return_from_get(GetRequest* get_req) {
     }
   }
 
+  // Remove the get request.
+  remove_get_request(get_req);
+  if (get_req->timer != -1) {
+    ARROW_CHECK(get_req->client->loop->RemoveTimer(get_req->timer) == AE_OK);
+  }
+  delete get_req;
+  --num_pending_get_requests_;
+}
+
+void PlasmaStore::remove_get_request(GetRequest* get_req) {
   // Remove the get request from each of the relevant object_get_requests hash
   // tables if it is present there. It should only be present there if the get
   // request timed out.
@@ -314,11 +390,6 @@ void PlasmaStore::return_from_get(GetRequest* get_req) {
       get_requests.erase(it);
     }
   }
-  // Remove the get request.
-  if (get_req->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_req->timer) == AE_OK);
-  }
-  delete get_req;
 }
 
 void PlasmaStore::update_object_get_requests(const ObjectID& object_id) {
@@ -338,7 +409,18 @@ void PlasmaStore::update_object_get_requests(const ObjectID& object_id) {
 
     // If this get request is done, reply to the client.
     if (get_req->num_satisfied == get_req->num_objects_to_wait_for) {
-      return_from_get(get_req);
+      EventLoop* loop = get_req->client->loop;
+      if (loop->IsLoopThread()) {
+        return_from_get(get_req);
+      } else {
+        // The client is served by another event loop. Stop tracking the
+        // request right away, and reply from that loop.
+        remove_get_request(get_req);
+        loop->Post([this, get_req]() {
+          std::lock_guard<std::mutex> guard(mutex_);
+          return_from_get(get_req);
+        });
+      }
     } else {
       // The call to return_from_get will remove the current element in the
       // array, so we only increment the counter in the else branch.
@@ -354,9 +436,14 @@ void PlasmaStore::update_object_get_requests(const ObjectID& object_id) {
 
 void PlasmaStore::process_get_request(Client* client,
                                       const std::vector<ObjectID>& object_ids,
-                                      int64_t timeout_ms) {
+                                      int64_t timeout_ms,
+                                      const std::vector<int>& mapped_fds,
+                                      bool reply_on_ring) {
   // Create a get request for this object.
   GetRequest* get_req = new GetRequest(client, object_ids);
+  ++num_pending_get_requests_;
+  get_req->mapped_fds.insert(mapped_fds.begin(), mapped_fds.end());
+  get_req->reply_on_ring = reply_on_ring;
 
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
@@ -376,6 +463,10 @@ void PlasmaStore::process_get_request(Client* client,
       get_req->objects[object_id].data_size = -1;
       // Add the get request to the relevant data structures.
       object_get_requests_[object_id].push_back(get_req);
+      // If the object was evicted to the spill store, read it back.
+      if (entry == NULL && spilled_objects_.count(object_id) != 0) {
+        restore_object(object_id);
+      }
     }
   }
 
@@ -386,10 +477,18 @@ void PlasmaStore::process_get_request(Client* client,
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
-      return_from_get(get_req);
-      return kEventLoopTimerDone;
-    });
+    get_req->timer =
+        client->loop->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
+          std::lock_guard<std::mutex> guard(mutex_);
+          if (get_req->num_satisfied == get_req->num_objects_to_wait_for) {
+            // The reply was already posted to this loop by the event loop that
+            // sealed the last object.
+            get_req->timer = -1;
+          } else {
+            return_from_get(get_req);
+          }
+          return kEventLoopTimerDone;
+        });
   }
 }
 
@@ -400,7 +499,7 @@ int PlasmaStore::remove_client_from_object_clients(ObjectTableEntry* entry,
     entry->clients.erase(it);
     // If no more clients are using this object, notify the eviction policy
     // that the object is no longer being used.
-    if (entry->clients.size() == 0) {
+    if (entry->clients.size() == 0 && entry->device_num == 0) {
       // Tell the eviction policy that this object is no longer being used.
       std::vector<ObjectID> objects_to_evict;
       eviction_policy_.end_object_access(entry->object_id, &objects_to_evict);
@@ -424,7 +523,13 @@ void PlasmaStore::release_object(const ObjectID& object_id, Client* client) {
 // Check if an object is present.
 int PlasmaStore::contains_object(const ObjectID& object_id) {
   auto entry = get_object_table_entry(&store_info_, object_id);
-  return entry && (entry->state == PLASMA_SEALED) ? OBJECT_FOUND : OBJECT_NOT_FOUND;
+  if (entry == NULL) {
+    // Spilled objects are restored when they are requested.
+    return spilled_objects_.count(object_id) != 0 ? OBJECT_FOUND : OBJECT_NOT_FOUND;
+  }
+  return entry->state == PLASMA_SEALED || entry->clients.count(&restore_client_) != 0
+             ? OBJECT_FOUND
+             : OBJECT_NOT_FOUND;
 }
 
 // Seal an object that has been created in the hash table.
@@ -456,8 +561,7 @@ int PlasmaStore::abort_object(const ObjectID& object_id, Client* client) {
     return 0;
   } else {
     // The client requesting the abort is the creator. Free the object.
-    dlfree(entry->pointer);
-    store_info_.objects.erase(object_id);
+    erase_object(object_id);
     return 1;
   }
 }
@@ -468,8 +572,18 @@ int PlasmaStore::delete_object(ObjectID& object_id) {
   // error. Maybe we should also support deleting objects that have been
   // created but not sealed.
   if (entry == NULL) {
-    // To delete an object it must be in the object table.
-    return PlasmaError_ObjectNonexistent;
+    auto spilled = spilled_objects_.find(object_id);
+    if (spilled == spilled_objects_.end()) {
+      // To delete an object it must be in the object table or spilled.
+      return PlasmaError_ObjectNonexistent;
+    }
+    spill_store_->Remove(object_id);
+    spilled_objects_.erase(spilled);
+    ObjectInfoT notification;
+    notification.object_id = object_id.binary();
+    notification.is_deletion = true;
+    push_notification(&notification);
+    return PlasmaError_OK;
   }
 
   if (entry->state != PLASMA_SEALED) {
@@ -482,10 +596,10 @@ int PlasmaStore::delete_object(ObjectID& object_id) {
     return PlasmaError_ObjectInUse;
   }
 
-  eviction_policy_.remove_object(object_id);
-
-  dlfree(entry->pointer);
-  store_info_.objects.erase(object_id);
+  if (entry->device_num == 0) {
+    eviction_policy_.remove_object(object_id);
+  }
+  erase_object(object_id);
   // Inform all subscribers that the object has been deleted.
   ObjectInfoT notification;
   notification.object_id = object_id.binary();
@@ -495,6 +609,21 @@ int PlasmaStore::delete_object(ObjectID& object_id) {
   return PlasmaError_OK;
 }
 
+int PlasmaStore::pin_object(const ObjectID& object_id, bool pinned) {
+  auto entry = get_object_table_entry(&store_info_, object_id);
+  if (entry == NULL) {
+    return PlasmaError_ObjectNonexistent;
+  }
+  if (entry->state != PLASMA_SEALED) {
+    return PlasmaError_ObjectNotSealed;
+  }
+  // Objects on GPUs are never evicted.
+  if (entry->device_num == 0) {
+    eviction_policy_.set_pinned(object_id, pinned);
+  }
+  return PlasmaError_OK;
+}
+
 void PlasmaStore::delete_objects(const std::vector<ObjectID>& object_ids) {
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "deleting object " << object_id.hex();
@@ -507,8 +636,24 @@ void PlasmaStore::delete_objects(const std::vector<ObjectID>& object_ids) {
         << "To delete an object it must have been sealed.";
     ARROW_CHECK(entry->clients.size() == 0)
         << "To delete an object, there must be no clients currently using it.";
-    dlfree(entry->pointer);
-    store_info_.objects.erase(object_id);
+    const int64_t object_size = entry->info.data_size + entry->info.metadata_size;
+    ++metrics_.num_objects_evicted;
+    metrics_.num_bytes_evicted += object_size;
+    if (spill_store_ && entry->device_num == 0) {
+      // Keep a copy of the object, which remains available to the clients.
+      Status s = spill_store_->Write(object_id, entry->pointer, object_size);
+      if (s.ok()) {
+        ++metrics_.num_objects_spilled;
+        metrics_.num_bytes_spilled += object_size;
+        spilled_objects_[object_id] = {entry->info.data_size, entry->info.metadata_size,
+                                       entry->info.digest};
+        erase_object(object_id);
+        continue;
+      }
+      ARROW_LOG(WARNING) << "Failed to spill object " << object_id.hex()
+                         << ", deleting it: " << s.ToString();
+    }
+    erase_object(object_id);
     // Inform all subscribers that the object has been deleted.
     ObjectInfoT notification;
     notification.object_id = object_id.binary();
@@ -517,20 +662,175 @@ void PlasmaStore::delete_objects(const std::vector<ObjectID>& object_ids) {
   }
 }
 
+void PlasmaStore::erase_object(const ObjectID& object_id) {
+  auto it = store_info_.objects.find(object_id);
+  ObjectTableEntry* entry = it->second.get();
+  if (entry->device_num == 0) {
+    plasma_free(entry->pointer);
+  } else {
+#ifdef PLASMA_GPU
+    // The buffer was exported for IPC, so it does not free the memory itself.
+    const auto& buffer = entry->gpu_buffer;
+    Status s = buffer->context()->Free(buffer->mutable_data(), buffer->size());
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to free object " << object_id.hex()
+                         << " on device " << entry->device_num << ": " << s.ToString();
+    }
+#endif
+  }
+  store_info_.objects.erase(it);
+}
+
+void PlasmaStore::restore_object(const ObjectID& object_id) {
+  auto spilled = spilled_objects_.find(object_id);
+  SpilledObject info = spilled->second;
+  spilled_objects_.erase(spilled);
+  // Allocate the object, held by the restore client while it is read.
+  PlasmaObject object;
+  int error_code = create_object(object_id, info.data_size, info.metadata_size, 0,
+                                 &restore_client_, &object);
+  if (error_code != PlasmaError_OK) {
+    ARROW_LOG(WARNING) << "Not enough memory to restore object " << object_id.hex();
+    spilled_objects_[object_id] = info;
+    return;
+  }
+  auto entry = get_object_table_entry(&store_info_, object_id);
+  entry->info.digest = info.digest;
+  Status s = spill_store_->ReadAsync(
+      object_id, entry->pointer, info.data_size + info.metadata_size,
+      [this, object_id](const Status& status) {
+        loops_[0]->Post([this, object_id, status]() {
+          std::lock_guard<std::mutex> guard(mutex_);
+          finish_restore(object_id, status);
+        });
+      });
+  if (!s.ok()) {
+    finish_restore(object_id, s);
+  }
+}
+
+void PlasmaStore::finish_restore(const ObjectID& object_id, const Status& status) {
+  auto entry = get_object_table_entry(&store_info_, object_id);
+  ARROW_CHECK(entry != NULL && entry->state == PLASMA_CREATED);
+  if (!status.ok()) {
+    // Keep the copy, the object may be read at the next get request.
+    ARROW_LOG(WARNING) << "Failed to restore object " << object_id.hex() << ": "
+                       << status.ToString();
+    spilled_objects_[object_id] = {entry->info.data_size, entry->info.metadata_size,
+                                   entry->info.digest};
+    ARROW_CHECK(abort_object(object_id, &restore_client_) == 1);
+    return;
+  }
+  spill_store_->Remove(object_id);
+  ++metrics_.num_objects_restored;
+  entry->state = PLASMA_SEALED;
+  // Subscribers were not told that the object was evicted, but they are told
+  // again that it is sealed, since clients waiting for it with GetAsync only
+  // asked for it once.
+  push_notification(&entry->info);
+  update_object_get_requests(object_id);
+  remove_client_from_object_clients(entry, &restore_client_);
+}
+
+Status PlasmaStore::start_transfer_service(int port, int num_streams) {
+  return TransferService::Listen(port, num_streams, this, &transfer_service_);
+}
+
+void PlasmaStore::transfer_object(const ObjectID& object_id, const std::string& address,
+                                  int port) {
+  if (!transfer_service_) {
+    ARROW_LOG(WARNING) << "Cannot transfer object " << object_id.hex()
+                       << ", the transfer service was not started";
+    return;
+  }
+  auto entry = get_object_table_entry(&store_info_, object_id);
+  if (entry == NULL || entry->state != PLASMA_SEALED || entry->device_num != 0) {
+    ARROW_LOG(WARNING) << "Cannot transfer object " << object_id.hex()
+                       << ", it is not a sealed object in host memory";
+    return;
+  }
+  // Each transfer holds the object, so that it is not evicted while it is sent,
+  // even if it is transferred several times at once.
+  auto sender = std::make_shared<Client>(-1, loops_[0]);
+  add_client_to_object_clients(entry, sender.get());
+  transfer_service_->SendAsync(
+      address, port, object_id, entry->info.digest, entry->pointer,
+      entry->info.data_size, entry->info.metadata_size,
+      [this, object_id, address, sender](const Status& status) {
+        if (!status.ok()) {
+          ARROW_LOG(WARNING) << "Failed to transfer object " << object_id.hex()
+                             << " to " << address << ": " << status.ToString();
+        }
+        loops_[0]->Post([this, object_id, sender]() {
+          std::lock_guard<std::mutex> guard(mutex_);
+          auto entry = get_object_table_entry(&store_info_, object_id);
+          remove_client_from_object_clients(entry, sender.get());
+        });
+      });
+}
+
+Status PlasmaStore::BeginReceive(const ObjectID& object_id, int64_t data_size,
+                                 int64_t metadata_size, uint8_t** pointer) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  PlasmaObject object;
+  int error_code = create_object(object_id, data_size, metadata_size, 0,
+                                 &receive_client_, &object);
+  if (error_code == PlasmaError_ObjectExists) {
+    return Status::Invalid("Object " + object_id.hex() + " already exists");
+  } else if (error_code != PlasmaError_OK) {
+    return Status::OutOfMemory("Not enough memory to receive object " +
+                               object_id.hex());
+  }
+  *pointer = get_object_table_entry(&store_info_, object_id)->pointer;
+  return Status::OK();
+}
+
+void PlasmaStore::FinishReceive(const ObjectID& object_id, const std::string& digest,
+                                const Status& status) {
+  loops_[0]->Post([this, object_id, digest, status]() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Failed to receive object " << object_id.hex() << ": "
+                         << status.ToString();
+      ARROW_CHECK(abort_object(object_id, &receive_client_) == 1);
+      return;
+    }
+    unsigned char object_digest[kDigestSize];
+    memcpy(&object_digest[0], digest.data(), kDigestSize);
+    seal_object(object_id, &object_digest[0]);
+    auto entry = get_object_table_entry(&store_info_, object_id);
+    remove_client_from_object_clients(entry, &receive_client_);
+  });
+}
+
 void PlasmaStore::connect_client(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
-  Client* client = new Client(client_fd);
-  connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  // Assign the connections to the event loops in turn.
+  EventLoop* loop = loops_[next_loop_];
+  next_loop_ = (next_loop_ + 1) % loops_.size();
+
+  Client* client = new Client(client_fd, loop);
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  }
 
   // Add a callback to handle events on this socket.
   // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = process_message(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
-  });
+  auto add_file_event = [this, client]() {
+    client->loop->AddFileEvent(client->fd, kEventLoopRead, [this, client](int events) {
+      Status s = process_message(client);
+      if (!s.ok()) {
+        ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+      }
+    });
+  };
+  if (loop->IsLoopThread()) {
+    add_file_event();
+  } else {
+    loop->Post(add_file_event);
+  }
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
 
@@ -538,7 +838,10 @@ void PlasmaStore::disconnect_client(int client_fd) {
   ARROW_CHECK(client_fd > 0);
   auto it = connected_clients_.find(client_fd);
   ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  it->second->loop->RemoveFileEvent(client_fd);
+  if (it->second->request_ring) {
+    it->second->loop->RemoveFileEvent(it->second->request_ring->doorbell_fd());
+  }
   // Close the socket.
   close(client_fd);
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
@@ -568,79 +871,96 @@ void PlasmaStore::disconnect_client(int client_fd) {
   connected_clients_.erase(it);
 }
 
-/// Send notifications about sealed objects to the subscribers. This is called
-/// in seal_object. If the socket's send buffer is full, the notification will
-/// be
+/// Send notifications about sealed objects to the subscribers. The
+/// notifications queued since the last message are sent as one message. If
+/// the socket's send buffer is full, the rest of the message will be
 /// buffered, and this will be called again when the send buffer has room.
 ///
-/// @param client_fd The client to send the notification to.
+/// @param client_fd The client to send the notifications to.
 void PlasmaStore::send_notifications(int client_fd) {
   auto it = pending_notifications_.find(client_fd);
+  if (it == pending_notifications_.end()) {
+    // The subscriber hung up before a posted send ran.
+    return;
+  }
+  NotificationQueue* queue = &it->second;
+  EventLoop* loop = queue->loop;
 
-  int num_processed = 0;
   bool closed = false;
-  // Loop over the array of pending notifications and send as many of them as
-  // possible.
-  for (size_t i = 0; i < it->second.object_notifications.size(); ++i) {
-    uint8_t* notification =
-        reinterpret_cast<uint8_t*>(it->second.object_notifications.at(i));
-    // Decode the length, which is the first bytes of the message.
-    int64_t size = *(reinterpret_cast<int64_t*>(notification));
-
-    // Attempt to send a notification about this object ID.
-    ssize_t nbytes = send(client_fd, notification, sizeof(int64_t) + size, 0);
+  while (true) {
+    if (queue->bytes_sent == queue->message.size()) {
+      if (queue->object_notifications.empty()) {
+        break;
+      }
+      create_object_info_batch(queue->object_notifications, &queue->message);
+      queue->object_notifications.clear();
+      queue->bytes_sent = 0;
+    }
+    // Attempt to send the rest of the message.
+    ssize_t nbytes = send(client_fd, queue->message.data() + queue->bytes_sent,
+                          queue->message.size() - queue->bytes_sent, 0);
     if (nbytes >= 0) {
-      ARROW_CHECK(nbytes == static_cast<ssize_t>(sizeof(int64_t)) + size);
-    } else if (nbytes == -1 &&
-               (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
-      ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
-                          "notification and will send it later.";
+      queue->bytes_sent += nbytes;
+    } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+      ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching these "
+                          "notifications and will send them later.";
       // Add a callback to the event loop to send queued notifications whenever
       // there is room in the socket's send buffer. Callbacks can be added
       // more than once here and will be overwritten. The callback is removed
-      // at the end of the method.
+      // once everything is sent.
       // TODO(pcm): Introduce status codes and check in case the file descriptor
       // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
+      loop->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
+        std::lock_guard<std::mutex> guard(mutex_);
         send_notifications(client_fd);
       });
-      break;
+      return;
     } else {
-      ARROW_LOG(WARNING) << "Failed to send notification to client on fd " << client_fd;
+      ARROW_LOG(WARNING) << "Failed to send notifications to client on fd "
+                         << client_fd;
       if (errno == EPIPE) {
         closed = true;
         break;
       }
+      // Drop the message.
+      queue->bytes_sent = queue->message.size();
     }
-    num_processed += 1;
-    // The corresponding malloc happened in create_object_info_buffer
-    // within push_notification.
-    delete[] notification;
   }
-  // Remove the sent notifications from the array.
-  it->second.object_notifications.erase(
-      it->second.object_notifications.begin(),
-      it->second.object_notifications.begin() + num_processed);
 
   // Stop sending notifications if the pipe was broken.
   if (closed) {
+    loop->RemoveFileEvent(client_fd);
     close(client_fd);
-    pending_notifications_.erase(client_fd);
+    pending_notifications_.erase(it);
+    return;
   }
 
-  // If we have sent all notifications, remove the fd from the event loop.
-  if (it->second.object_notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+  // We have sent all notifications, remove the fd from the event loop.
+  loop->RemoveFileEvent(client_fd);
+}
+
+void PlasmaStore::schedule_notifications(int client_fd, NotificationQueue* queue) {
+  if (queue->send_scheduled) {
+    return;
   }
+  // The notifications pushed until the loop serving the subscriber runs the
+  // posted send are batched into one message, in the order the objects were
+  // sealed or deleted.
+  queue->send_scheduled = true;
+  queue->loop->Post([this, client_fd]() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = pending_notifications_.find(client_fd);
+    if (it != pending_notifications_.end()) {
+      it->second.send_scheduled = false;
+      send_notifications(client_fd);
+    }
+  });
 }
 
 void PlasmaStore::push_notification(ObjectInfoT* object_info) {
   for (auto& element : pending_notifications_) {
-    uint8_t* notification = create_object_info_buffer(object_info);
-    element.second.object_notifications.push_back(notification);
-    send_notifications(element.first);
-    // The notification gets freed in send_notifications when the notification
-    // is sent over the socket.
+    element.second.object_notifications.push_back(*object_info);
+    schedule_notifications(element.first, &element.second);
   }
 }
 
@@ -660,8 +980,7 @@ void PlasmaStore::subscribe_to_updates(Client* client) {
   // Create a new array to buffer notifications that can't be sent to the
   // subscriber yet because the socket send buffer is full. TODO(rkn): the queue
   // never gets freed.
-  // TODO(pcm): Is the following neccessary?
-  pending_notifications_[fd];
+  pending_notifications_[fd].loop = client->loop;
 
   // Push notifications to the new subscriber about existing objects.
   for (const auto& entry : store_info_.objects) {
@@ -671,17 +990,132 @@ void PlasmaStore::subscribe_to_updates(Client* client) {
 }
 
 Status PlasmaStore::process_message(Client* client) {
+  if (client->request_ring) {
+    // The client may have queued requests in its ring before sending this one,
+    // which must be processed first.
+    int64_t type;
+    while (client->request_ring->Read(&type, &client->input_buffer)) {
+      RETURN_NOT_OK(process_request(client, type, true));
+    }
+  }
   int64_t type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &client->input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
+  return process_request(client, type, false);
+}
+
+Status PlasmaStore::process_ring_messages(Client* client) {
+  MessageRing* ring = client->request_ring.get();
+  ring->BeginRead();
+  do {
+    int64_t type;
+    while (ring->Read(&type, &client->input_buffer)) {
+      RETURN_NOT_OK(process_request(client, type, true));
+    }
+  } while (!ring->EndRead());
+  return Status::OK();
+}
+
+Status PlasmaStore::connect_ring(Client* client) {
+  RETURN_NOT_OK(ReadConnectRingRequest(client->input_buffer.data(),
+                                       client->input_buffer.size()));
+  ARROW_CHECK(!client->request_ring) << "The client already set up its rings";
+  int fds[4];
+  for (int i = 0; i < 4; ++i) {
+    fds[i] = recv_fd(client->fd);
+    if (fds[i] < 0) {
+      for (int j = 0; j < i; ++j) {
+        close(fds[j]);
+      }
+      // The client hung up, which is handled with its next message.
+      ARROW_LOG(WARNING) << "Failed to receive the rings of client " << client->fd;
+      return Status::OK();
+    }
+  }
+  Status s = MessageRing::Open(fds[0], fds[1], &client->request_ring);
+  if (s.ok()) {
+    s = MessageRing::Open(fds[2], fds[3], &client->reply_ring);
+  } else {
+    close(fds[2]);
+    close(fds[3]);
+  }
+  if (!s.ok()) {
+    ARROW_LOG(WARNING) << "Failed to open the rings of client " << client->fd << ": "
+                       << s;
+    client->request_ring.reset();
+    client->reply_ring.reset();
+    HANDLE_SIGPIPE(SendConnectRingReply(client->fd, PlasmaError_OutOfMemory),
+                   client->fd);
+    return Status::OK();
+  }
+  client->loop->AddFileEvent(client->request_ring->doorbell_fd(), kEventLoopRead,
+                             [this, client](int events) {
+                               Status s = process_ring_messages(client);
+                               if (!s.ok()) {
+                                 ARROW_LOG(FATAL) << "Failed to process ring: " << s;
+                               }
+                             });
+  HANDLE_SIGPIPE(SendConnectRingReply(client->fd, PlasmaError_OK), client->fd);
+  // Start waiting on the doorbell.
+  return process_ring_messages(client);
+}
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+void PlasmaStore::get_metrics(StoreMetrics* metrics) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    *metrics = metrics_;
+    metrics->memory_capacity = store_info_.memory_capacity;
+    metrics->memory_used = eviction_policy_.memory_used();
+    get_malloc_usage(&metrics->malloc_footprint, &metrics->malloc_allocated,
+                     &metrics->malloc_free_chunks);
+    metrics->num_objects = store_info_.objects.size();
+    metrics->num_clients = connected_clients_.size();
+    metrics->num_pending_get_requests = num_pending_get_requests_;
+    metrics->slab_classes.resize(get_num_slab_classes());
+    for (int i = 0; i < get_num_slab_classes(); ++i) {
+      SlabClassMetrics& slab_class = metrics->slab_classes[i];
+      get_slab_usage(i, &slab_class.object_size, &slab_class.num_slabs,
+                     &slab_class.num_slots, &slab_class.num_objects);
+    }
+  }
+  std::lock_guard<std::mutex> guard(latency_mutex_);
+  metrics->request_latencies = request_latencies_;
+}
+
+Status PlasmaStore::process_request(Client* client, int64_t type, bool from_ring) {
+  const auto start = std::chrono::steady_clock::now();
+  Status s = handle_request(client, type, from_ring);
+  const int64_t latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+  if (type != DISCONNECT_CLIENT) {
+    std::lock_guard<std::mutex> guard(latency_mutex_);
+    request_latencies_[type].Record(latency_us);
+  }
+  return s;
+}
+
+Status PlasmaStore::handle_request(Client* client, int64_t type, bool from_ring) {
+  if (from_ring) {
+    ARROW_CHECK(type == MessageType_PlasmaGetRequest ||
+                type == MessageType_PlasmaSealRequest ||
+                type == MessageType_PlasmaSealManyRequest ||
+                type == MessageType_PlasmaReleaseRequest ||
+                type == MessageType_PlasmaReleaseManyRequest)
+        << "Invalid request on ring: " << type;
+  }
+  uint8_t* input = client->input_buffer.data();
+  size_t input_size = client->input_buffer.size();
   ObjectID object_id;
   PlasmaObject object;
   // TODO(pcm): Get rid of the following.
   memset(&object, 0, sizeof(object));
 
+  // Requests are parsed, and replies that only depend on the result of the
+  // request sent, without holding the store lock, so that clients served by
+  // different event loops only contend on the store state itself.
+  std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+
   // Process the different types of requests.
   switch (type) {
     case MessageType_PlasmaCreateRequest: {
@@ -690,12 +1124,14 @@ Status PlasmaStore::process_message(Client* client) {
       int device_num;
       RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &data_size,
                                       &metadata_size, &device_num));
+      lock.lock();
       int error_code =
           create_object(object_id, data_size, metadata_size, device_num, client, &object);
       int64_t mmap_size = 0;
       if (error_code == PlasmaError_OK && device_num == 0) {
         mmap_size = get_mmap_size(object.store_fd);
       }
+      lock.unlock();
       HANDLE_SIGPIPE(
           SendCreateReply(client->fd, object_id, &object, error_code, mmap_size),
           client->fd);
@@ -703,60 +1139,143 @@ Status PlasmaStore::process_message(Client* client) {
         warn_if_sigpipe(send_fd(client->fd, object.store_fd), client->fd);
       }
     } break;
+    case MessageType_PlasmaCreateManyRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<int64_t> data_sizes;
+      std::vector<int64_t> metadata_sizes;
+      RETURN_NOT_OK(ReadCreateManyRequest(input, input_size, &object_ids, &data_sizes,
+                                          &metadata_sizes));
+      std::vector<PlasmaObject> objects;
+      std::vector<int> store_fds;
+      std::vector<int64_t> mmap_sizes;
+      lock.lock();
+      int error_code =
+          create_objects(object_ids, data_sizes, metadata_sizes, client, &objects);
+      for (const auto& created : objects) {
+        if (std::find(store_fds.begin(), store_fds.end(), created.store_fd) ==
+            store_fds.end()) {
+          store_fds.push_back(created.store_fd);
+          mmap_sizes.push_back(get_mmap_size(created.store_fd));
+        }
+      }
+      lock.unlock();
+      HANDLE_SIGPIPE(SendCreateManyReply(client->fd, object_ids, objects, error_code,
+                                         store_fds, mmap_sizes),
+                     client->fd);
+      for (int store_fd : store_fds) {
+        warn_if_sigpipe(send_fd(client->fd, store_fd), client->fd);
+      }
+    } break;
     case MessageType_PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
+      lock.lock();
       ARROW_CHECK(abort_object(object_id, client) == 1) << "To abort an object, the only "
                                                            "client currently using it "
                                                            "must be the creator.";
+      lock.unlock();
       HANDLE_SIGPIPE(SendAbortReply(client->fd, object_id), client->fd);
     } break;
     case MessageType_PlasmaGetRequest: {
       std::vector<ObjectID> object_ids_to_get;
       int64_t timeout_ms;
-      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms));
-      process_get_request(client, object_ids_to_get, timeout_ms);
+      std::vector<int> mapped_fds;
+      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms,
+                                   &mapped_fds));
+      lock.lock();
+      process_get_request(client, object_ids_to_get, timeout_ms, mapped_fds, from_ring);
     } break;
     case MessageType_PlasmaReleaseRequest: {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
+      lock.lock();
       release_object(object_id, client);
     } break;
+    case MessageType_PlasmaReleaseManyRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadReleaseManyRequest(input, input_size, &object_ids));
+      lock.lock();
+      for (const auto& id : object_ids) {
+        release_object(id, client);
+      }
+    } break;
     case MessageType_PlasmaDeleteRequest: {
       RETURN_NOT_OK(ReadDeleteRequest(input, input_size, &object_id));
+      lock.lock();
       int error_code = delete_object(object_id);
+      lock.unlock();
       HANDLE_SIGPIPE(SendDeleteReply(client->fd, object_id, error_code), client->fd);
     } break;
+    case MessageType_PlasmaPinRequest: {
+      bool pinned;
+      RETURN_NOT_OK(ReadPinRequest(input, input_size, &object_id, &pinned));
+      lock.lock();
+      int error_code = pin_object(object_id, pinned);
+      lock.unlock();
+      HANDLE_SIGPIPE(SendPinReply(client->fd, object_id, error_code), client->fd);
+    } break;
     case MessageType_PlasmaContainsRequest: {
       RETURN_NOT_OK(ReadContainsRequest(input, input_size, &object_id));
-      if (contains_object(object_id) == OBJECT_FOUND) {
-        HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 1), client->fd);
-      } else {
-        HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 0), client->fd);
-      }
+      lock.lock();
+      const bool has_object = contains_object(object_id) == OBJECT_FOUND;
+      lock.unlock();
+      HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, has_object ? 1 : 0),
+                     client->fd);
     } break;
     case MessageType_PlasmaSealRequest: {
       unsigned char digest[kDigestSize];
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest[0]));
+      lock.lock();
       seal_object(object_id, &digest[0]);
     } break;
+    case MessageType_PlasmaSealManyRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<unsigned char> digests;
+      RETURN_NOT_OK(ReadSealManyRequest(input, input_size, &object_ids, &digests));
+      lock.lock();
+      for (size_t i = 0; i < object_ids.size(); ++i) {
+        seal_object(object_ids[i], &digests[i * kDigestSize]);
+      }
+    } break;
     case MessageType_PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
       std::vector<ObjectID> objects_to_evict;
+      lock.lock();
       int64_t num_bytes_evicted =
           eviction_policy_.choose_objects_to_evict(num_bytes, &objects_to_evict);
       delete_objects(objects_to_evict);
+      lock.unlock();
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case MessageType_PlasmaSubscribeRequest:
+      lock.lock();
       subscribe_to_updates(client);
       break;
     case MessageType_PlasmaConnectRequest: {
       HANDLE_SIGPIPE(SendConnectReply(client->fd, store_info_.memory_capacity),
                      client->fd);
     } break;
+    case MessageType_PlasmaConnectRingRequest:
+      RETURN_NOT_OK(connect_ring(client));
+      break;
+    case MessageType_PlasmaMetricsRequest: {
+      RETURN_NOT_OK(ReadMetricsRequest(input, input_size));
+      StoreMetrics metrics;
+      get_metrics(&metrics);
+      HANDLE_SIGPIPE(SendMetricsReply(client->fd, metrics), client->fd);
+    } break;
+    case MessageType_PlasmaDataRequest: {
+      char* address;
+      int port;
+      RETURN_NOT_OK(ReadDataRequest(input, input_size, &object_id, &address, &port));
+      std::string address_string(address);
+      free(address);
+      lock.lock();
+      transfer_object(object_id, address_string, port);
+    } break;
     case DISCONNECT_CLIENT:
       ARROW_LOG(DEBUG) << "Disconnecting client on fd " << client->fd;
+      lock.lock();
       disconnect_client(client->fd);
       break;
     default:
@@ -771,12 +1290,22 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, int64_t system_memory, std::string directory,
-             bool hugepages_enabled, bool use_one_memory_mapped_file) {
-    // Create the event loop.
-    loop_.reset(new EventLoop);
-    store_.reset(
-        new PlasmaStore(loop_.get(), system_memory, directory, hugepages_enabled));
+             bool hugepages_enabled, bool use_one_memory_mapped_file,
+             int num_event_loops, std::unique_ptr<EvictionCache> eviction_cache,
+             std::unique_ptr<SpillStore> spill_store, int transfer_port,
+             int transfer_streams) {
+    // Create the event loops.
+    std::vector<EventLoop*> loops;
+    for (int i = 0; i < num_event_loops; ++i) {
+      loops_.emplace_back(new EventLoop);
+      loops.push_back(loops_.back().get());
+    }
+    store_.reset(new PlasmaStore(loops, system_memory, directory, hugepages_enabled,
+                                 std::move(eviction_cache), std::move(spill_store)));
     plasma_config = store_->get_plasma_store_info();
+    if (transfer_port >= 0) {
+      ARROW_CHECK_OK(store_->start_transfer_service(transfer_port, transfer_streams));
+    }
 
     // If the store is configured to use a single memory-mapped file, then we
     // achieve that by mallocing and freeing a single large amount of space.
@@ -791,20 +1320,41 @@ class PlasmaStoreRunner {
     // TODO(pcm): Check return value.
     ARROW_CHECK(socket >= 0);
 
-    loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
+    // The additional event loops run on their own threads, which leave
+    // SIGTERM to the main one.
+    for (size_t i = 1; i < loops_.size(); ++i) {
+      EventLoop* loop = loops_[i].get();
+      threads_.emplace_back([loop]() {
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, NULL);
+        loop->Start();
+      });
+    }
+
+    // The first event loop accepts the connections.
+    loops_[0]->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->connect_client(socket);
     });
-    loop_->Start();
+    loops_[0]->Start();
   }
 
   void Shutdown() {
-    loop_->Stop();
-    loop_ = nullptr;
+    for (auto& loop : loops_) {
+      loop->Stop();
+    }
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
     store_ = nullptr;
+    loops_.clear();
   }
 
  private:
-  std::unique_ptr<EventLoop> loop_;
+  std::vector<std::unique_ptr<EventLoop>> loops_;
+  std::vector<std::thread> threads_;
   std::unique_ptr<PlasmaStore> store_;
 };
 
@@ -821,7 +1371,10 @@ void HandleSignal(int signal) {
 }
 
 void start_server(char* socket_name, int64_t system_memory, std::string plasma_directory,
-                  bool hugepages_enabled, bool use_one_memory_mapped_file) {
+                  bool hugepages_enabled, bool use_one_memory_mapped_file,
+                  int num_event_loops, std::unique_ptr<EvictionCache> eviction_cache,
+                  std::unique_ptr<SpillStore> spill_store, int transfer_port,
+                  int transfer_streams) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
@@ -829,7 +1382,8 @@ void start_server(char* socket_name, int64_t system_memory, std::string plasma_d
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
   g_runner->Start(socket_name, system_memory, plasma_directory, hugepages_enabled,
-                  use_one_memory_mapped_file);
+                  use_one_memory_mapped_file, num_event_loops, std::move(eviction_cache),
+                  std::move(spill_store), transfer_port, transfer_streams);
 }
 
 }  // namespace plasma
@@ -841,9 +1395,23 @@ int main(int argc, char* argv[]) {
   bool hugepages_enabled = false;
   // True if a single large memory-mapped file should be created at startup.
   bool use_one_memory_mapped_file = false;
+  // True if the pages of the memory-mapped files should be faulted in when
+  // they are mapped, and whether they should also be locked in memory.
+  bool prefault_memory = false;
+  bool lock_memory = false;
   int64_t system_memory = -1;
+  // Number of event loop threads serving the clients.
+  int num_event_loops = 1;
+  // The order in which objects are evicted.
+  std::unique_ptr<plasma::EvictionCache> eviction_cache;
+  // Directory where evicted objects are spilled, if any.
+  std::string spill_directory;
+  // TCP port on which objects are received from other stores, if any, and the
+  // number of parallel connections an object is sent on.
+  int transfer_port = -1;
+  int transfer_streams = 4;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:hf")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:hfplt:e:x:P:S:")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
@@ -866,6 +1434,43 @@ int main(int argc, char* argv[]) {
       case 'f':
         use_one_memory_mapped_file = true;
         break;
+      case 'p':
+        prefault_memory = true;
+        break;
+      case 'l':
+        lock_memory = true;
+        break;
+      case 't': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_event_loops, &extra);
+        ARROW_CHECK(scanned == 1 && num_event_loops > 0)
+            << "the number of event loop threads must be a positive integer";
+        break;
+      }
+      case 'e': {
+        plasma::Status status = plasma::MakeEvictionCache(optarg, &eviction_cache);
+        if (!status.ok()) {
+          ARROW_LOG(FATAL) << status.ToString() << ", please use -e with lru, lfu or gds";
+        }
+        break;
+      }
+      case 'x':
+        spill_directory = std::string(optarg);
+        break;
+      case 'P': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &transfer_port, &extra);
+        ARROW_CHECK(scanned == 1 && transfer_port >= 0 && transfer_port < 65536)
+            << "the transfer port must be a valid TCP port";
+        break;
+      }
+      case 'S': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &transfer_streams, &extra);
+        ARROW_CHECK(scanned == 1 && transfer_streams > 0)
+            << "the number of transfer streams must be a positive integer";
+        break;
+      }
       default:
         exit(-1);
     }
@@ -918,7 +1523,22 @@ int main(int argc, char* argv[]) {
   // Make it so dlmalloc fails if we try to request more memory than is
   // available.
   plasma::dlmalloc_set_footprint_limit((size_t)system_memory);
+  if (prefault_memory || lock_memory) {
+    // Fault in all of the memory at startup, rather than when objects are
+    // first written, which is only worth it if it is mapped at once.
+    ARROW_LOG(INFO) << "Faulting in " << (lock_memory ? "and locking " : "")
+                    << "the memory of the store";
+    use_one_memory_mapped_file = true;
+    set_malloc_prefault(true, lock_memory);
+  }
+  std::unique_ptr<plasma::SpillStore> spill_store;
+  if (!spill_directory.empty()) {
+    ARROW_LOG(INFO) << "Spilling evicted objects to " << spill_directory;
+    ARROW_CHECK_OK(plasma::SpillStore::Open(spill_directory, &spill_store));
+  }
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
   plasma::start_server(socket_name, system_memory, plasma_directory, hugepages_enabled,
-                       use_one_memory_mapped_file);
+                       use_one_memory_mapped_file, num_event_loops,
+                       std::move(eviction_cache), std::move(spill_store), transfer_port,
+                       transfer_streams);
 }
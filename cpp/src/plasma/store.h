@@ -18,8 +18,9 @@
 #ifndef PLASMA_STORE_H
 #define PLASMA_STORE_H
 
-#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -27,33 +28,72 @@
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/eviction_policy.h"
+#include "plasma/metrics.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
+#include "plasma/ring.h"
+#include "plasma/spill_store.h"
+#include "plasma/transfer.h"
 
 namespace plasma {
 
 struct GetRequest;
 
 struct NotificationQueue {
-  /// The object notifications for clients. We notify the client about the
-  /// objects in the order that the objects were sealed or deleted.
-  std::deque<uint8_t*> object_notifications;
+  NotificationQueue() : bytes_sent(0), loop(NULL), send_scheduled(false) {}
+
+  /// The object notifications for clients that are not part of a message yet.
+  /// We notify the client about the objects in the order that the objects
+  /// were sealed or deleted.
+  std::vector<ObjectInfoT> object_notifications;
+  /// The message being sent, holding a batch of notifications.
+  std::vector<uint8_t> message;
+  /// The number of bytes of the message already sent.
+  size_t bytes_sent;
+  /// The event loop serving the subscriber.
+  EventLoop* loop;
+  /// Whether sending the notifications is already posted to the event loop.
+  bool send_scheduled;
 };
 
 /// Contains all information that is associated with a Plasma store client.
 struct Client {
-  explicit Client(int fd);
+  Client(int fd, EventLoop* loop);
 
   /// The file descriptor used to communicate with the client.
   int fd;
+  /// The event loop serving the client. Replies and timers of the client are
+  /// handled on its thread.
+  EventLoop* loop;
+  /// Input buffer. This is allocated only once to avoid mallocs for every
+  /// call to process_message.
+  std::vector<uint8_t> input_buffer;
+  /// Shared-memory rings of the requests of the client and of the replies to
+  /// them, if the client set them up. Both are only used from the event loop
+  /// of the client.
+  std::unique_ptr<MessageRing> request_ring;
+  std::unique_ptr<MessageRing> reply_ring;
 };
 
-class PlasmaStore {
+class PlasmaStore : public TransferTarget {
  public:
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, int64_t system_memory, std::string directory,
               bool hugetlbfs_enabled);
 
+  /// Create a store serving clients with several event loops, each running
+  /// on its own thread. The first loop accepts the connections, which are
+  /// assigned to the loops in turn.
+  ///
+  /// @param eviction_cache The order in which objects are evicted, LRU if
+  ///   null. See MakeEvictionCache.
+  /// @param spill_store Where evicted objects are written, to be restored
+  ///   when they are requested again. If null, evicted objects are deleted.
+  PlasmaStore(const std::vector<EventLoop*>& loops, int64_t system_memory,
+              std::string directory, bool hugetlbfs_enabled,
+              std::unique_ptr<EvictionCache> eviction_cache = nullptr,
+              std::unique_ptr<SpillStore> spill_store = nullptr);
+
   ~PlasmaStore();
 
   /// Get a const pointer to the internal PlasmaStoreInfo object.
@@ -83,6 +123,22 @@ class PlasmaStore {
   int create_object(const ObjectID& object_id, int64_t data_size, int64_t metadata_size,
                     int device_num, Client* client, PlasmaObject* result);
 
+  /// Create several objects in host memory. Either all of the objects are
+  /// created, or none of them: if one of them cannot be created, those already
+  /// created are aborted.
+  ///
+  /// @param object_ids Object IDs of the objects to be created.
+  /// @param data_sizes Sizes in bytes of the objects to be created.
+  /// @param metadata_sizes Sizes in bytes of the objects' metadata.
+  /// @param client The client that created the objects.
+  /// @param results The objects that have been created.
+  /// @return The error code of the first object that could not be created, as
+  ///   for create_object, or PlasmaError_OK.
+  int create_objects(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<int64_t>& metadata_sizes, Client* client,
+                     std::vector<PlasmaObject>* results);
+
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
   ///
@@ -101,6 +157,16 @@ class PlasmaStore {
   ///  - PlasmaError_ObjectInUse, if the object is in use.
   int delete_object(ObjectID& object_id);
 
+  /// Keep a sealed object from being evicted, or let it be evicted again.
+  ///
+  /// @param object_id Object ID of the object to be pinned or unpinned.
+  /// @param pinned Whether the object must not be evicted.
+  /// @return One of the following error codes:
+  ///  - PlasmaError_OK, if the object was pinned or unpinned successfully.
+  ///  - PlasmaError_ObjectNonexistent, if the object isn't in the store.
+  ///  - PlasmaError_ObjectNotSealed, if the object isn't sealed.
+  int pin_object(const ObjectID& object_id, bool pinned);
+
   /// Delete objects that have been created in the hash table. This should only
   /// be called on objects that are returned by the eviction policy to evict.
   ///
@@ -118,8 +184,11 @@ class PlasmaStore {
   /// @param client The client making this request.
   /// @param object_ids Object IDs of the objects to be gotten.
   /// @param timeout_ms The timeout for the get request in milliseconds.
+  /// @param mapped_fds The store files that the client has mapped already.
+  /// @param reply_on_ring Whether to reply on the reply ring of the client.
   void process_get_request(Client* client, const std::vector<ObjectID>& object_ids,
-                           int64_t timeout_ms);
+                           int64_t timeout_ms, const std::vector<int>& mapped_fds,
+                           bool reply_on_ring);
 
   /// Seal an object. The object is now immutable and can be accessed with get.
   ///
@@ -159,29 +228,94 @@ class PlasmaStore {
 
   void send_notifications(int client_fd);
 
+  /// Get a snapshot of the state of the store and of what it did since it
+  /// started.
+  ///
+  /// @param metrics The metrics of the store.
+  void get_metrics(StoreMetrics* metrics);
+
   Status process_message(Client* client);
 
+  /// Receive objects from other stores on a TCP port, and send them the
+  /// objects the clients transfer, see PlasmaClient::Transfer.
+  ///
+  /// @param port The port, or 0 for any free port.
+  /// @param num_streams The number of parallel connections an object is sent
+  ///        on.
+  /// @return The return status.
+  Status start_transfer_service(int port, int num_streams);
+
+  /// Allocate an object received from another store, see TransferTarget.
+  Status BeginReceive(const ObjectID& object_id, int64_t data_size,
+                      int64_t metadata_size, uint8_t** pointer) override;
+
+  /// Seal or abort an object received from another store, see TransferTarget.
+  void FinishReceive(const ObjectID& object_id, const std::string& digest,
+                     const Status& status) override;
+
+  /// Process the requests queued in the request ring of a client.
+  Status process_ring_messages(Client* client);
+
  private:
+  /// Process the request of a client in its input buffer, and record the
+  /// time it took.
+  ///
+  /// @param from_ring Whether the request was read from the request ring.
+  Status process_request(Client* client, int64_t type, bool from_ring);
+
+  /// Handle the request of a client in its input buffer, see process_request.
+  Status handle_request(Client* client, int64_t type, bool from_ring);
+
+  /// Set up the shared-memory rings of a client, whose descriptors follow
+  /// its request on the socket.
+  Status connect_ring(Client* client);
+
   void push_notification(ObjectInfoT* object_notification);
 
+  /// Send the pending notifications of a subscriber from its event loop, as
+  /// one message per iteration of the loop.
+  void schedule_notifications(int client_fd, NotificationQueue* queue);
+
   void add_client_to_object_clients(ObjectTableEntry* entry, Client* client);
 
+  /// Reply to a get request. Must be called from the event loop of the
+  /// requesting client.
   void return_from_get(GetRequest* get_req);
 
+  void remove_get_request(GetRequest* get_req);
+
   void update_object_get_requests(const ObjectID& object_id);
 
   int remove_client_from_object_clients(ObjectTableEntry* entry, Client* client);
 
-  /// Event loop of the plasma store.
-  EventLoop* loop_;
+  /// Free the memory of an object, on the host or on its GPU, and remove it
+  /// from the object table.
+  void erase_object(const ObjectID& object_id);
+
+  /// Start reading a spilled object back into memory, off the event loops.
+  /// The pending get requests are satisfied once it is read.
+  void restore_object(const ObjectID& object_id);
+
+  /// Seal a restored object, or abort it if it could not be read.
+  void finish_restore(const ObjectID& object_id, const Status& status);
+
+  /// Start sending a sealed object to the transfer service of another store.
+  void transfer_object(const ObjectID& object_id, const std::string& address,
+                       int port);
+
+  /// Event loops of the plasma store.
+  std::vector<EventLoop*> loops_;
+  /// The event loop the next client connection is assigned to.
+  size_t next_loop_;
+  /// Guards the state below, including the object table and the memory
+  /// allocator, which the event loops share. Requests are read, and most
+  /// replies sent, without holding it.
+  std::mutex mutex_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
   /// The state that is managed by the eviction policy.
   EvictionPolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>, UniqueIDHasher>
@@ -197,6 +331,36 @@ class PlasmaStore {
 #ifdef PLASMA_GPU
   arrow::gpu::CudaDeviceManager* manager_;
 #endif
+  /// The sizes and digest of an object that was written to the spill store.
+  struct SpilledObject {
+    int64_t data_size;
+    int64_t metadata_size;
+    std::string digest;
+  };
+  /// The objects that were evicted to the spill store, and are not being
+  /// restored.
+  std::unordered_map<ObjectID, SpilledObject, UniqueIDHasher> spilled_objects_;
+  /// Holds the objects being restored, so that they are not evicted.
+  Client restore_client_;
+  /// Holds the objects being received from other stores.
+  Client receive_client_;
+  /// The counters of the store metrics. Only the eviction and restore
+  /// counters are kept up to date, the other metrics are filled in by
+  /// get_metrics.
+  StoreMetrics metrics_;
+  /// The number of get requests that were not replied to yet.
+  int64_t num_pending_get_requests_;
+  /// Guards request_latencies_, which is updated after the store lock is
+  /// released.
+  std::mutex latency_mutex_;
+  /// The time spent handling the requests, by message type.
+  std::map<int64_t, LatencyHistogram> request_latencies_;
+  /// Declared last, so that it waits for the pending reads before the rest
+  /// of the store is destroyed.
+  std::unique_ptr<SpillStore> spill_store_;
+  /// Sends and receives objects, if it was started. It is destroyed first, so
+  /// that the transfers in progress end before the rest of the store.
+  std::unique_ptr<TransferService> transfer_service_;
 };
 
 }  // namespace plasma
@@ -18,12 +18,17 @@
 #include <assert.h>
 #include <signal.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 #include <random>
+#include <thread>
 
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "plasma/client.h"
 #include "plasma/common.h"
 #include "plasma/plasma.h"
@@ -48,12 +53,14 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command = plasma_directory +
                                  "/plasma_store -m 1000000000 -s /tmp/store" +
-                                 store_index + " 1> /dev/null 2> /dev/null &";
+                                 store_index + store_arguments() +
+                                 " 1> /dev/null 2> /dev/null &";
     system(plasma_command.c_str());
+    store_socket_name_ = "/tmp/store" + store_index;
     ARROW_CHECK_OK(
-        client_.Connect("/tmp/store" + store_index, "", PLASMA_DEFAULT_RELEASE_DELAY));
+        client_.Connect(store_socket_name_, "", PLASMA_DEFAULT_RELEASE_DELAY));
     ARROW_CHECK_OK(
-        client2_.Connect("/tmp/store" + store_index, "", PLASMA_DEFAULT_RELEASE_DELAY));
+        client2_.Connect(store_socket_name_, "", PLASMA_DEFAULT_RELEASE_DELAY));
   }
   virtual void Finish() {
     ARROW_CHECK_OK(client_.Disconnect());
@@ -62,10 +69,66 @@ class TestPlasmaStore : public ::testing::Test {
   }
 
  protected:
+  // Additional command line arguments of the store.
+  virtual std::string store_arguments() { return ""; }
+
+  std::string store_socket_name_;
   PlasmaClient client_;
   PlasmaClient client2_;
 };
 
+// The clients are served by different event loop threads of the store.
+class TestPlasmaStoreMultipleEventLoops : public TestPlasmaStore {
+ protected:
+  std::string store_arguments() override { return " -t 2"; }
+};
+
+// Get, Seal and Release requests go on shared-memory rings.
+class TestPlasmaStoreWithRings : public TestPlasmaStore {
+ public:
+  void SetUp() {
+    TestPlasmaStore::SetUp();
+    ARROW_CHECK_OK(client_.ConnectRings());
+    ARROW_CHECK_OK(client2_.ConnectRings());
+  }
+};
+
+// Objects are transferred to a second store.
+class TestPlasmaStoreWithTransfer : public TestPlasmaStore {
+ public:
+  void SetUp() {
+    std::mt19937 rng;
+    rng.seed(std::random_device()());
+    transfer_port_ = 20000 + static_cast<int>(rng() % 20000);
+    TestPlasmaStore::SetUp();
+    std::string plasma_directory =
+        test_executable.substr(0, test_executable.find_last_of("/"));
+    receiver_socket_name_ = store_socket_name_ + "-receiver";
+    std::string plasma_command = plasma_directory +
+                                 "/plasma_store -m 1000000000 -s " +
+                                 receiver_socket_name_ + " -P " +
+                                 std::to_string(transfer_port_ + 1) +
+                                 " 1> /dev/null 2> /dev/null &";
+    system(plasma_command.c_str());
+    ARROW_CHECK_OK(receiver_.Connect(receiver_socket_name_, "", 0));
+  }
+
+ protected:
+  std::string store_arguments() override {
+    return " -P " + std::to_string(transfer_port_);
+  }
+
+  int transfer_port_;
+  std::string receiver_socket_name_;
+  PlasmaClient receiver_;
+};
+
+// Evicted objects are written to a spill directory.
+class TestPlasmaStoreWithSpilling : public TestPlasmaStore {
+ protected:
+  std::string store_arguments() override { return " -x /tmp"; }
+};
+
 TEST_F(TestPlasmaStore, DeleteTest) {
   ObjectID object_id = ObjectID::from_random();
 
@@ -91,6 +154,107 @@ TEST_F(TestPlasmaStore, DeleteTest) {
   ARROW_CHECK_OK(client_.Delete(object_id));
 }
 
+TEST_F(TestPlasmaStore, PinTest) {
+  // Objects are released at once by a client without release delay.
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0));
+  ObjectID pinned_id = ObjectID::from_random();
+  ObjectID object_id = ObjectID::from_random();
+  ASSERT_TRUE(client.Pin(pinned_id).IsPlasmaObjectNonexistent());
+
+  int64_t data_size = 100;
+  std::shared_ptr<Buffer> data;
+  for (const auto& id : {pinned_id, object_id}) {
+    ARROW_CHECK_OK(client.Create(id, data_size, nullptr, 0, &data));
+    ARROW_CHECK_OK(client.Seal(id));
+    ARROW_CHECK_OK(client.Release(id));
+  }
+
+  // Only the object that is not pinned is evicted.
+  ARROW_CHECK_OK(client.Pin(pinned_id));
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client.Evict(1000000000, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, data_size);
+  bool has_object;
+  ARROW_CHECK_OK(client.Contains(pinned_id, &has_object));
+  ASSERT_TRUE(has_object);
+  ARROW_CHECK_OK(client.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+
+  ARROW_CHECK_OK(client.Pin(pinned_id, false));
+  ARROW_CHECK_OK(client.Evict(1000000000, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, data_size);
+  ARROW_CHECK_OK(client.Contains(pinned_id, &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+TEST_F(TestPlasmaStore, MetricsTest) {
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0));
+  ObjectID object_id = ObjectID::from_random();
+  int64_t data_size = 100;
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client.Create(object_id, data_size, nullptr, 0, &data));
+  ARROW_CHECK_OK(client.Seal(object_id));
+  ARROW_CHECK_OK(client.Release(object_id));
+
+  StoreMetrics metrics;
+  ARROW_CHECK_OK(client.Metrics(&metrics));
+  ASSERT_EQ(1000000000, metrics.memory_capacity);
+  ASSERT_EQ(data_size, metrics.memory_used);
+  ASSERT_GE(metrics.malloc_allocated, data_size);
+  ASSERT_EQ(1, metrics.num_objects);
+  ASSERT_EQ(3, metrics.num_clients);
+  ASSERT_EQ(1, metrics.request_latencies[MessageType_PlasmaCreateRequest].count);
+  // The object was allocated from a slab of 128-byte objects.
+  ASSERT_EQ(6u, metrics.slab_classes.size());
+  ASSERT_EQ(128, metrics.slab_classes[1].object_size);
+  ASSERT_EQ(1, metrics.slab_classes[1].num_slabs);
+  ASSERT_EQ(512, metrics.slab_classes[1].num_slots);
+  ASSERT_EQ(1, metrics.slab_classes[1].num_objects);
+
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client.Evict(1000000000, num_bytes_evicted));
+  ARROW_CHECK_OK(client.Metrics(&metrics));
+  ASSERT_EQ(0, metrics.memory_used);
+  ASSERT_EQ(0, metrics.num_objects);
+  ASSERT_EQ(1, metrics.num_objects_evicted);
+  ASSERT_EQ(data_size, metrics.num_bytes_evicted);
+  ASSERT_EQ(0, metrics.num_objects_spilled);
+  ASSERT_EQ(0, metrics.slab_classes[1].num_objects);
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+TEST_F(TestPlasmaStore, ReleaseHistoryTest) {
+  ObjectID object_id = ObjectID::from_random();
+  ObjectID missing_id = ObjectID::from_random();
+  int64_t data_size = 100;
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(object_id, data_size, nullptr, 0, &data));
+  ARROW_CHECK_OK(client_.Seal(object_id));
+
+  // The released object is still held from the store, so it is not evicted.
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client2_.Evict(1000000000, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, 0);
+
+  // Only the missing object is requested from the store.
+  ObjectID object_ids[3] = {object_id, missing_id, object_id};
+  ObjectBuffer object_buffers[3];
+  ARROW_CHECK_OK(client_.Get(object_ids, 3, 0, object_buffers));
+  ASSERT_EQ(object_buffers[0].data_size, data_size);
+  ASSERT_EQ(object_buffers[1].data_size, -1);
+  ASSERT_EQ(object_buffers[2].data_size, data_size);
+  ARROW_CHECK_OK(client_.Release(object_id));
+  ARROW_CHECK_OK(client_.Release(object_id));
+  ARROW_CHECK_OK(client2_.Evict(1000000000, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, 0);
+
+  // Deleting the object releases it to the store first.
+  ARROW_CHECK_OK(client_.Delete(object_id));
+}
+
 TEST_F(TestPlasmaStore, ContainsTest) {
   ObjectID object_id = ObjectID::from_random();
 
@@ -144,6 +308,67 @@ TEST_F(TestPlasmaStore, GetTest) {
   }
 }
 
+TEST_F(TestPlasmaStore, SealWithDigestTest) {
+  ObjectID object_id = ObjectID::from_random();
+  int64_t data_size = 3 * kDigestBlockSize / 2;
+  uint8_t metadata[] = {5};
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(object_id, data_size, metadata, sizeof(metadata), &data));
+
+  // Hash the data while writing it, in two pieces.
+  ObjectDigester digester(data_size);
+  uint8_t* bytes = data->mutable_data();
+  for (int64_t offset : {int64_t(0), data_size / 3}) {
+    const int64_t nbytes = offset == 0 ? data_size / 3 : data_size - offset;
+    memset(bytes + offset, static_cast<int>(offset % 256) + 1, nbytes);
+    digester.Update(bytes + offset, nbytes);
+  }
+  uint8_t digest[kDigestSize];
+  digester.Finish(metadata, sizeof(metadata), digest);
+  ARROW_CHECK_OK(client_.Seal(object_id, digest));
+
+  // The digest matches the one computed from the stored object.
+  uint8_t stored_digest[kDigestSize];
+  ARROW_CHECK_OK(client_.Hash(object_id, stored_digest));
+  ASSERT_EQ(0, memcmp(digest, stored_digest, kDigestSize));
+}
+
+TEST_F(TestPlasmaStore, RecordBatchTest) {
+  // Objects are released at once by a client without release delay.
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0));
+  ObjectID object_id = ObjectID::from_random();
+  std::shared_ptr<arrow::RecordBatch> batch;
+  ARROW_CHECK_OK(client.GetRecordBatch(object_id, 0, &batch));
+  ASSERT_EQ(nullptr, batch);
+
+  arrow::Int64Builder builder;
+  for (int64_t i = 0; i < 1000; ++i) {
+    ARROW_CHECK_OK(builder.Append(i));
+  }
+  std::shared_ptr<arrow::Array> array;
+  ARROW_CHECK_OK(builder.Finish(&array));
+  auto schema = arrow::schema({arrow::field("x", arrow::int64())});
+  auto batch1 = arrow::RecordBatch::Make(schema, array->length(), {array});
+  ARROW_CHECK_OK(client.PutRecordBatch(object_id, *batch1));
+
+  // The batch points into the object, which cannot be deleted while it is used.
+  ARROW_CHECK_OK(client.GetRecordBatch(object_id, -1, &batch));
+  ASSERT_TRUE(batch1->Equals(*batch));
+  ASSERT_FALSE(client.Delete(object_id).ok());
+  batch.reset();
+  ARROW_CHECK_OK(client.Delete(object_id));
+
+  // A table is written as a stream of batches.
+  ObjectID table_id = ObjectID::from_random();
+  std::shared_ptr<arrow::Table> table1, table2;
+  ARROW_CHECK_OK(arrow::Table::FromRecordBatches({batch1, batch1}, &table1));
+  ARROW_CHECK_OK(client.PutTable(table_id, *table1));
+  ARROW_CHECK_OK(client2_.GetTable(table_id, -1, &table2));
+  ASSERT_TRUE(table1->Equals(*table2));
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
 TEST_F(TestPlasmaStore, MultipleGetTest) {
   ObjectID object_id1 = ObjectID::from_random();
   ObjectID object_id2 = ObjectID::from_random();
@@ -167,6 +392,79 @@ TEST_F(TestPlasmaStore, MultipleGetTest) {
   ASSERT_EQ(object_buffer[1].data->data()[0], 2);
 }
 
+TEST_F(TestPlasmaStore, AsyncGetTest) {
+  ObjectID object_id1 = ObjectID::from_random();
+  ObjectID object_id2 = ObjectID::from_random();
+  ObjectID object_ids[2] = {object_id1, object_id2};
+  int64_t data_size = 4;
+  uint8_t metadata[] = {5};
+  int64_t metadata_size = sizeof(metadata);
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client2_.Create(object_id1, data_size, metadata, metadata_size, &data));
+  data->mutable_data()[0] = 1;
+  ARROW_CHECK_OK(client2_.Seal(object_id1));
+
+  // The object already in the store is ready right away.
+  ARROW_CHECK_OK(client_.GetAsync(object_ids, 2));
+  ASSERT_GE(client_.async_get_fd(), 0);
+  std::vector<ObjectID> ready_ids;
+  std::vector<ObjectBuffer> ready_buffers;
+  ARROW_CHECK_OK(client_.WaitAny(0, &ready_ids, &ready_buffers));
+  ASSERT_EQ(ready_ids.size(), 1);
+  ASSERT_EQ(ready_ids[0], object_id1);
+  ASSERT_EQ(ready_buffers[0].data->data()[0], 1);
+
+  // The other one is not there yet.
+  ARROW_CHECK_OK(client_.WaitAny(10, &ready_ids, &ready_buffers));
+  ASSERT_TRUE(ready_ids.empty());
+
+  // It is returned once it is sealed.
+  ARROW_CHECK_OK(client2_.Create(object_id2, data_size, metadata, metadata_size, &data));
+  data->mutable_data()[0] = 2;
+  ARROW_CHECK_OK(client2_.Seal(object_id2));
+  ARROW_CHECK_OK(client_.WaitAny(-1, &ready_ids, &ready_buffers));
+  ASSERT_EQ(ready_ids.size(), 1);
+  ASSERT_EQ(ready_ids[0], object_id2);
+  ASSERT_EQ(ready_buffers[0].data_size, data_size);
+  ASSERT_EQ(ready_buffers[0].data->data()[0], 2);
+}
+
+TEST_F(TestPlasmaStore, CreateManyTest) {
+  ObjectID object_ids[3] = {ObjectID::from_random(), ObjectID::from_random(),
+                            ObjectID::from_random()};
+  int64_t data_sizes[3] = {4, 100, 0};
+  uint8_t metadata1[] = {5};
+  uint8_t* metadata[3] = {metadata1, NULL, NULL};
+  int64_t metadata_sizes[3] = {sizeof(metadata1), 0, 0};
+  std::shared_ptr<Buffer> data[3];
+  ARROW_CHECK_OK(
+      client_.CreateMany(object_ids, 3, data_sizes, metadata, metadata_sizes, data));
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(data_sizes[i], data[i]->size());
+    if (data_sizes[i] > 0) {
+      data[i]->mutable_data()[0] = static_cast<uint8_t>(i + 1);
+    }
+  }
+  ARROW_CHECK_OK(client_.SealMany(object_ids, 3));
+
+  ObjectBuffer object_buffers[3];
+  ARROW_CHECK_OK(client_.Get(object_ids, 3, -1, object_buffers));
+  ASSERT_EQ(1, object_buffers[0].data->data()[0]);
+  ASSERT_EQ(5, object_buffers[0].metadata->data()[0]);
+  ASSERT_EQ(2, object_buffers[1].data->data()[0]);
+  ASSERT_EQ(0, object_buffers[2].data_size);
+  ARROW_CHECK_OK(client_.ReleaseMany(object_ids, 3));
+
+  // Creating the batch again fails without creating any of its new objects.
+  ObjectID new_object_ids[2] = {ObjectID::from_random(), object_ids[1]};
+  Status s = client_.CreateMany(new_object_ids, 2, data_sizes, NULL, metadata_sizes,
+                                data);
+  ASSERT_TRUE(s.IsPlasmaObjectExists());
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(new_object_ids[0], &has_object));
+  ASSERT_FALSE(has_object);
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = ObjectID::from_random();
   ObjectBuffer object_buffer;
@@ -381,6 +679,244 @@ TEST_F(TestPlasmaStore, MultipleClientGPUTest) {
 
 #endif
 
+TEST_F(TestPlasmaStoreMultipleEventLoops, GetTest) {
+  ObjectID object_id = ObjectID::from_random();
+  ObjectBuffer object_buffer;
+
+  // A timed out get is answered by the event loop of the client.
+  ARROW_CHECK_OK(client_.Get(&object_id, 1, 100, &object_buffer));
+  ASSERT_EQ(object_buffer.data_size, -1);
+
+  // A get waiting for an object is answered once the other client, served
+  // by another event loop, seals it.
+  int64_t data_size = 4;
+  uint8_t metadata[] = {5};
+  int64_t metadata_size = sizeof(metadata);
+  std::thread creator([&]() {
+    usleep(100000);
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(
+        client2_.Create(object_id, data_size, metadata, metadata_size, &data));
+    for (int64_t i = 0; i < data_size; i++) {
+      data->mutable_data()[i] = static_cast<uint8_t>(i);
+    }
+    ARROW_CHECK_OK(client2_.Seal(object_id));
+  });
+  ARROW_CHECK_OK(client_.Get(&object_id, 1, -1, &object_buffer));
+  creator.join();
+  ASSERT_EQ(object_buffer.data_size, data_size);
+  for (int64_t i = 0; i < data_size; i++) {
+    ASSERT_EQ(object_buffer.data->data()[i], i);
+  }
+}
+
+TEST_F(TestPlasmaStoreMultipleEventLoops, NotificationTest) {
+  int fd;
+  ARROW_CHECK_OK(client_.Subscribe(&fd));
+  // Wait for the subscription to be processed.
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(ObjectID::from_random(), &has_object));
+
+  // Notifications of objects sealed and deleted through another event loop
+  // arrive in order.
+  std::vector<ObjectID> object_ids;
+  int64_t data_size = 100;
+  uint8_t metadata[] = {5};
+  int64_t metadata_size = sizeof(metadata);
+  for (int i = 0; i < 10; i++) {
+    ObjectID object_id = ObjectID::from_random();
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(
+        client2_.Create(object_id, data_size, metadata, metadata_size, &data));
+    ARROW_CHECK_OK(client2_.Seal(object_id));
+    ARROW_CHECK_OK(client2_.Release(object_id));
+    ARROW_CHECK_OK(client2_.Delete(object_id));
+    object_ids.push_back(object_id);
+  }
+  for (const auto& object_id : object_ids) {
+    ObjectID notified_id;
+    int64_t notified_data_size;
+    int64_t notified_metadata_size;
+    ARROW_CHECK_OK(client_.GetNotification(fd, &notified_id, &notified_data_size,
+                                           &notified_metadata_size));
+    ASSERT_EQ(notified_id, object_id);
+    ASSERT_EQ(notified_data_size, data_size);
+    ARROW_CHECK_OK(client_.GetNotification(fd, &notified_id, &notified_data_size,
+                                           &notified_metadata_size));
+    ASSERT_EQ(notified_id, object_id);
+    ASSERT_EQ(notified_data_size, -1);
+  }
+}
+
+TEST_F(TestPlasmaStoreMultipleEventLoops, BatchedNotificationTest) {
+  int fd;
+  ARROW_CHECK_OK(client_.Subscribe(&fd));
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(ObjectID::from_random(), &has_object));
+
+  std::vector<ObjectID> object_ids;
+  int64_t data_size = 100;
+  for (int i = 0; i < 10; i++) {
+    ObjectID object_id = ObjectID::from_random();
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(client2_.Create(object_id, data_size, NULL, 0, &data));
+    ARROW_CHECK_OK(client2_.Seal(object_id));
+    object_ids.push_back(object_id);
+  }
+  // The notifications may arrive in several batches, and a batch partly read
+  // by GetNotification is returned by GetNotifications.
+  ObjectID notified_id;
+  int64_t notified_data_size;
+  int64_t notified_metadata_size;
+  ARROW_CHECK_OK(client_.GetNotification(fd, &notified_id, &notified_data_size,
+                                         &notified_metadata_size));
+  ASSERT_EQ(notified_id, object_ids[0]);
+  std::vector<ObjectID> notified_ids;
+  std::vector<int64_t> data_sizes;
+  std::vector<int64_t> metadata_sizes;
+  for (size_t i = 1; i < object_ids.size(); i += notified_ids.size()) {
+    ARROW_CHECK_OK(
+        client_.GetNotifications(fd, &notified_ids, &data_sizes, &metadata_sizes));
+    ASSERT_GT(notified_ids.size(), 0u);
+    ASSERT_LE(i + notified_ids.size(), object_ids.size());
+    for (size_t j = 0; j < notified_ids.size(); j++) {
+      ASSERT_EQ(notified_ids[j], object_ids[i + j]);
+      ASSERT_EQ(data_sizes[j], data_size);
+      ASSERT_EQ(metadata_sizes[j], 0);
+    }
+  }
+}
+
+TEST_F(TestPlasmaStoreWithRings, GetTest) {
+  ObjectID object_ids[2] = {ObjectID::from_random(), ObjectID::from_random()};
+  ObjectBuffer object_buffer;
+
+  // A timed out get is answered on the ring.
+  ARROW_CHECK_OK(client2_.Get(&object_ids[0], 1, 100, &object_buffer));
+  ASSERT_EQ(object_buffer.data_size, -1);
+
+  // A get waiting for an object is answered once the other client seals it.
+  int64_t data_size = 4;
+  uint8_t metadata[] = {5};
+  int64_t metadata_size = sizeof(metadata);
+  std::thread creator([&]() {
+    usleep(100000);
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(
+        client_.Create(object_ids[0], data_size, metadata, metadata_size, &data));
+    data->mutable_data()[0] = 42;
+    ARROW_CHECK_OK(client_.Seal(object_ids[0]));
+  });
+  ARROW_CHECK_OK(client2_.Get(&object_ids[0], 1, -1, &object_buffer));
+  creator.join();
+  ASSERT_EQ(object_buffer.data_size, data_size);
+  ASSERT_EQ(object_buffer.data->data()[0], 42);
+  ASSERT_EQ(object_buffer.metadata->data()[0], 5);
+
+  // The file of the second object is mapped already.
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(
+      client_.Create(object_ids[1], data_size, metadata, metadata_size, &data));
+  data->mutable_data()[0] = 43;
+  ARROW_CHECK_OK(client_.Seal(object_ids[1]));
+  ObjectBuffer object_buffers[2];
+  ARROW_CHECK_OK(client2_.Get(object_ids, 2, -1, object_buffers));
+  ASSERT_EQ(object_buffers[0].data->data()[0], 42);
+  ASSERT_EQ(object_buffers[1].data->data()[0], 43);
+}
+
+TEST_F(TestPlasmaStoreWithRings, ReleaseTest) {
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 10; ++i) {
+    object_ids.push_back(ObjectID::from_random());
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(client_.Create(object_ids.back(), 100, NULL, 0, &data));
+    ARROW_CHECK_OK(client_.Seal(object_ids.back()));
+    ARROW_CHECK_OK(client_.Release(object_ids.back()));
+  }
+  // Delete flushes the releases on the ring, which the store processes before
+  // the delete request on the socket.
+  for (const auto& object_id : object_ids) {
+    ARROW_CHECK_OK(client_.Delete(object_id));
+    bool has_object;
+    ARROW_CHECK_OK(client2_.Contains(object_id, &has_object));
+    ASSERT_FALSE(has_object);
+  }
+}
+
+TEST_F(TestPlasmaStoreWithTransfer, TransferTest) {
+  ObjectID object_id = ObjectID::from_random();
+  int64_t data_size = 3 << 20;
+  uint8_t metadata[] = {5};
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(object_id, data_size, metadata, sizeof(metadata), &data));
+  for (int64_t i = 0; i < data_size; i++) {
+    data->mutable_data()[i] = static_cast<uint8_t>(i);
+  }
+  ARROW_CHECK_OK(client_.Seal(object_id));
+  ARROW_CHECK_OK(client_.Transfer("127.0.0.1", transfer_port_ + 1, object_id));
+
+  // The object is sealed in the other store once it is received.
+  ObjectBuffer object_buffer;
+  ARROW_CHECK_OK(receiver_.Get(&object_id, 1, 10000, &object_buffer));
+  ASSERT_EQ(object_buffer.data_size, data_size);
+  for (int64_t i = 0; i < data_size; i++) {
+    ASSERT_EQ(object_buffer.data->data()[i], static_cast<uint8_t>(i));
+  }
+  ASSERT_EQ(object_buffer.metadata->data()[0], metadata[0]);
+  ARROW_CHECK_OK(receiver_.Release(object_id));
+  ARROW_CHECK_OK(receiver_.Disconnect());
+}
+
+TEST_F(TestPlasmaStoreWithSpilling, RestoreTest) {
+  // Objects are released at once by a client without release delay.
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0));
+  ObjectID object_id = ObjectID::from_random();
+  int64_t data_size = 100;
+  uint8_t metadata[] = {5};
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client.Create(object_id, data_size, metadata, sizeof(metadata), &data));
+  for (int64_t i = 0; i < data_size; i++) {
+    data->mutable_data()[i] = static_cast<uint8_t>(i);
+  }
+  ARROW_CHECK_OK(client.Seal(object_id));
+  ARROW_CHECK_OK(client.Release(object_id));
+
+  // The evicted object is still in the store, and restored when it is read.
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client.Evict(1000000000, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, data_size + 1);
+  bool has_object;
+  ARROW_CHECK_OK(client.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+  ObjectBuffer object_buffer;
+  ARROW_CHECK_OK(client.Get(&object_id, 1, -1, &object_buffer));
+  ASSERT_EQ(object_buffer.data_size, data_size);
+  for (int64_t i = 0; i < data_size; i++) {
+    ASSERT_EQ(object_buffer.data->data()[i], static_cast<uint8_t>(i));
+  }
+  ASSERT_EQ(object_buffer.metadata->data()[0], metadata[0]);
+  ARROW_CHECK_OK(client.Release(object_id));
+
+  // An asynchronous get completes once the object is restored.
+  ARROW_CHECK_OK(client.Evict(1000000000, num_bytes_evicted));
+  ARROW_CHECK_OK(client.GetAsync(&object_id, 1));
+  std::vector<ObjectID> ready_ids;
+  std::vector<ObjectBuffer> ready_buffers;
+  ARROW_CHECK_OK(client.WaitAny(-1, &ready_ids, &ready_buffers));
+  ASSERT_EQ(ready_ids.size(), 1);
+  ASSERT_EQ(ready_buffers[0].data->data()[1], 1);
+  ARROW_CHECK_OK(client.Release(object_id));
+
+  // Spilled objects can be deleted.
+  ARROW_CHECK_OK(client.Evict(1000000000, num_bytes_evicted));
+  ARROW_CHECK_OK(client.Delete(object_id));
+  ARROW_CHECK_OK(client.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <random>
+#include <vector>
+
+#include "plasma/common.h"
+#include "plasma/digest.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+std::vector<uint8_t> RandomBytes(int64_t size) {
+  std::mt19937 rng(static_cast<uint32_t>(size));
+  std::vector<uint8_t> bytes(size);
+  for (auto& byte : bytes) {
+    byte = static_cast<uint8_t>(rng());
+  }
+  return bytes;
+}
+
+std::vector<uint8_t> Digest(const std::vector<uint8_t>& data,
+                            const std::vector<uint8_t>& metadata) {
+  std::vector<uint8_t> digest(kDigestSize);
+  ComputeObjectDigest(data.data(), data.size(), metadata.data(), metadata.size(), 4,
+                      digest.data());
+  return digest;
+}
+
+TEST(ObjectDigest, IncrementalMatchesParallel) {
+  std::vector<uint8_t> metadata = {1, 2, 3};
+  for (int64_t size : {int64_t(0), int64_t(1000), kDigestBlockSize - 1,
+                       kDigestBlockSize, 3 * kDigestBlockSize + 12345}) {
+    std::vector<uint8_t> data = RandomBytes(size);
+    // Pass the data in pieces that do not line up with the blocks.
+    for (int64_t piece : {int64_t(1) << 16, kDigestBlockSize + 7, size}) {
+      ObjectDigester digester(size);
+      for (int64_t offset = 0; offset < size; offset += piece) {
+        digester.Update(data.data() + offset, std::min(piece, size - offset));
+      }
+      std::vector<uint8_t> digest(kDigestSize);
+      digester.Finish(metadata.data(), metadata.size(), digest.data());
+      ASSERT_EQ(Digest(data, metadata), digest) << size << " " << piece;
+    }
+  }
+}
+
+TEST(ObjectDigest, DependsOnContents) {
+  std::vector<uint8_t> data = RandomBytes(2 * kDigestBlockSize);
+  std::vector<uint8_t> metadata = {1};
+  std::vector<uint8_t> digest = Digest(data, metadata);
+  data[kDigestBlockSize + 1] ^= 1;
+  ASSERT_NE(digest, Digest(data, metadata));
+  data[kDigestBlockSize + 1] ^= 1;
+  metadata[0] = 2;
+  ASSERT_NE(digest, Digest(data, metadata));
+}
+
+}  // namespace plasma
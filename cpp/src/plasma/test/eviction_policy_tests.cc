@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include "plasma/eviction_policy.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+std::vector<ObjectID> ChooseObjects(EvictionCache* cache, int64_t num_bytes) {
+  std::vector<ObjectID> objects_to_evict;
+  cache->choose_objects_to_evict(num_bytes, &objects_to_evict);
+  return objects_to_evict;
+}
+
+TEST(EvictionCache, LRU) {
+  std::unique_ptr<EvictionCache> cache;
+  ASSERT_TRUE(MakeEvictionCache("lru", &cache).ok());
+  ObjectID a = ObjectID::from_random();
+  ObjectID b = ObjectID::from_random();
+  cache->add(a, 10);
+  cache->add(b, 10);
+  // Using a again makes b the least recently used.
+  cache->remove(a);
+  cache->add(a, 10);
+  ASSERT_EQ(std::vector<ObjectID>({b}), ChooseObjects(cache.get(), 10));
+  ASSERT_EQ(std::vector<ObjectID>({b, a}), ChooseObjects(cache.get(), 11));
+}
+
+TEST(EvictionCache, LFU) {
+  std::unique_ptr<EvictionCache> cache;
+  ASSERT_TRUE(MakeEvictionCache("lfu", &cache).ok());
+  ObjectID a = ObjectID::from_random();
+  ObjectID b = ObjectID::from_random();
+  ObjectID c = ObjectID::from_random();
+  cache->add(a, 10);
+  cache->remove(a);
+  cache->add(a, 10);
+  cache->add(b, 10);
+  cache->add(c, 10);
+  // b and c were used once, b less recently than c.
+  ASSERT_EQ(std::vector<ObjectID>({b, c, a}), ChooseObjects(cache.get(), 30));
+  // Deleted objects start over.
+  cache->remove(a);
+  cache->forget(a);
+  cache->add(a, 10);
+  ASSERT_EQ(std::vector<ObjectID>({b, c, a}), ChooseObjects(cache.get(), 30));
+  cache->remove(b);
+  cache->add(b, 10);
+  ASSERT_EQ(std::vector<ObjectID>({c, a, b}), ChooseObjects(cache.get(), 30));
+}
+
+TEST(EvictionCache, GreedyDualSize) {
+  std::unique_ptr<EvictionCache> cache;
+  ASSERT_TRUE(MakeEvictionCache("gds", &cache).ok());
+  ObjectID large = ObjectID::from_random();
+  ObjectID small = ObjectID::from_random();
+  // A large object is evicted before a small one used as often.
+  cache->add(large, 1000);
+  cache->add(small, 10);
+  ASSERT_EQ(std::vector<ObjectID>({large}), ChooseObjects(cache.get(), 10));
+  // But not before small objects used once if it is used often.
+  for (int i = 0; i < 200; ++i) {
+    cache->remove(large);
+    cache->add(large, 1000);
+  }
+  ASSERT_EQ(std::vector<ObjectID>({small}), ChooseObjects(cache.get(), 10));
+  // Objects that are no longer used eventually age out.
+  cache->remove(small);
+  cache->forget(small);
+  bool large_evicted = false;
+  for (int i = 0; i < 100 && !large_evicted; ++i) {
+    cache->add(ObjectID::from_random(), 10);
+    std::vector<ObjectID> evicted = ChooseObjects(cache.get(), 10);
+    large_evicted = evicted[0] == large;
+    cache->remove(evicted[0]);
+    cache->forget(evicted[0]);
+  }
+  ASSERT_TRUE(large_evicted);
+}
+
+TEST(EvictionCache, UnknownPolicy) {
+  std::unique_ptr<EvictionCache> cache;
+  ASSERT_TRUE(MakeEvictionCache("fifo", &cache).IsInvalid());
+}
+
+}  // namespace plasma
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/metrics.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+TEST(LatencyHistogram, Buckets) {
+  LatencyHistogram latencies;
+  ASSERT_EQ(0, latencies.Quantile(0.5));
+  latencies.Record(0);
+  latencies.Record(1);
+  latencies.Record(3);
+  latencies.Record(4);
+  latencies.Record(int64_t(1) << 40);
+  ASSERT_EQ(5, latencies.count);
+  ASSERT_EQ(8 + (int64_t(1) << 40), latencies.total_us);
+  ASSERT_EQ(int64_t(1) << 40, latencies.max_us);
+  ASSERT_EQ(1, latencies.buckets[0]);
+  ASSERT_EQ(1, latencies.buckets[1]);
+  ASSERT_EQ(1, latencies.buckets[2]);
+  ASSERT_EQ(1, latencies.buckets[3]);
+  // Latencies beyond the last bucket are counted in it.
+  ASSERT_EQ(1, latencies.buckets[LatencyHistogram::kNumBuckets - 1]);
+}
+
+TEST(LatencyHistogram, Quantile) {
+  LatencyHistogram latencies;
+  for (int i = 0; i < 99; ++i) {
+    latencies.Record(10);
+  }
+  latencies.Record(1000);
+  // The quantiles are the upper bounds of their buckets.
+  ASSERT_EQ(16, latencies.Quantile(0.5));
+  ASSERT_EQ(16, latencies.Quantile(0.99));
+  ASSERT_EQ(1000, latencies.Quantile(1));
+
+  LatencyHistogram other;
+  other.Record(2000);
+  other.Record(2000);
+  latencies.Merge(other);
+  ASSERT_EQ(102, latencies.count);
+  ASSERT_EQ(2000, latencies.max_us);
+  ASSERT_EQ(2000, latencies.Quantile(0.99));
+}
+
+}  // namespace plasma
@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "plasma/object_map.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+// An object ID whose hash is the given one, so that tests can make them collide.
+ObjectID IDWithHash(size_t hash) {
+  ObjectID object_id = ObjectID::from_random();
+  std::memcpy(object_id.mutable_data(), &hash, sizeof(hash));
+  return object_id;
+}
+
+TEST(ObjectMap, InsertFindErase) {
+  ObjectMap<std::unique_ptr<int>> map;
+  ObjectID object_id = ObjectID::from_random();
+  ASSERT_TRUE(map.empty());
+  ASSERT_TRUE(map.find(object_id) == map.end());
+  ASSERT_EQ(map.erase(object_id), 0);
+
+  map[object_id].reset(new int(7));
+  ASSERT_EQ(map.size(), 1);
+  ASSERT_EQ(map.count(object_id), 1);
+  auto it = map.find(object_id);
+  ASSERT_TRUE(it != map.end());
+  ASSERT_TRUE(it->first == object_id);
+  ASSERT_EQ(*it->second, 7);
+
+  map.erase(it);
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.count(object_id), 0);
+}
+
+TEST(ObjectMap, Collisions) {
+  // All of these IDs start at the same slot, and those after them at the next.
+  ObjectMap<int> map;
+  std::vector<ObjectID> colliding;
+  for (int i = 0; i < 5; ++i) {
+    colliding.push_back(IDWithHash(3));
+    map[colliding.back()] = i;
+  }
+  ObjectID next = IDWithHash(4);
+  map[next] = 5;
+
+  // Erasing from the middle of the probe sequence keeps the others reachable.
+  ASSERT_EQ(map.erase(colliding[1]), 1);
+  ASSERT_EQ(map.erase(colliding[3]), 1);
+  ASSERT_EQ(map.size(), 4);
+  ASSERT_EQ(map.count(colliding[1]), 0);
+  ASSERT_EQ(map.count(colliding[3]), 0);
+  ASSERT_EQ(map[colliding[0]], 0);
+  ASSERT_EQ(map[colliding[2]], 2);
+  ASSERT_EQ(map[colliding[4]], 4);
+  ASSERT_EQ(map[next], 5);
+  ASSERT_EQ(map.size(), 4);
+}
+
+TEST(ObjectMap, MatchesUnorderedMap) {
+  ObjectMap<int> map;
+  std::unordered_map<ObjectID, int, UniqueIDHasher> expected;
+  std::vector<ObjectID> ids;
+  std::mt19937 generator(42);
+  // Few distinct hashes, so that the probe sequences are long and wrap around.
+  std::uniform_int_distribution<size_t> hashes(0, 1023);
+  for (int i = 0; i < 5000; ++i) {
+    if (ids.empty() || generator() % 3 != 0) {
+      ObjectID object_id = IDWithHash(hashes(generator));
+      ids.push_back(object_id);
+      map[object_id] = i;
+      expected[object_id] = i;
+    } else {
+      size_t index = generator() % ids.size();
+      ASSERT_EQ(map.erase(ids[index]), expected.erase(ids[index]));
+      ids[index] = ids.back();
+      ids.pop_back();
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  for (const auto& entry : expected) {
+    auto it = map.find(entry.first);
+    ASSERT_TRUE(it != map.end());
+    ASSERT_EQ(it->second, entry.second);
+  }
+  size_t num_iterated = 0;
+  for (const auto& entry : map) {
+    ASSERT_EQ(expected.at(entry.first), entry.second);
+    ++num_iterated;
+  }
+  ASSERT_EQ(num_iterated, expected.size());
+
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_TRUE(map.begin() == map.end());
+  ASSERT_EQ(map.count(ids.front()), 0);
+}
+
+}  // namespace plasma
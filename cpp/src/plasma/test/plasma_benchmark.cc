@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Latency and throughput of the Plasma store, measured against a store
+// started by the benchmark. The latencies are reported as the p50_us and
+// p99_us counters, averaged over the client threads, and the throughput as
+// ops_per_s, summed over them.
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "plasma/client.h"
+#include "plasma/common.h"
+
+#include "benchmark/benchmark.h"
+
+namespace plasma {
+
+using Clock = std::chrono::steady_clock;
+
+// The memory of the store, which the eviction benchmark fills up.
+constexpr int64_t kStoreMemory = 1 << 30;
+
+std::string store_socket_name;  // NOLINT
+
+// Latencies of the operations of a benchmark thread.
+class LatencyRecorder {
+ public:
+  void Record(Clock::time_point start) {
+    latencies_ns_.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+            .count());
+  }
+
+  void Report(benchmark::State& state) {  // NOLINT non-const reference
+    if (latencies_ns_.empty()) {
+      return;
+    }
+    std::sort(latencies_ns_.begin(), latencies_ns_.end());
+    auto quantile = [this](double q) {
+      size_t index =
+          static_cast<size_t>(q * static_cast<double>(latencies_ns_.size() - 1));
+      return static_cast<double>(latencies_ns_[index]) / 1000;
+    };
+    state.counters["p50_us"] =
+        benchmark::Counter(quantile(0.5), benchmark::Counter::kAvgThreads);
+    state.counters["p99_us"] =
+        benchmark::Counter(quantile(0.99), benchmark::Counter::kAvgThreads);
+    state.counters["ops_per_s"] = benchmark::Counter(
+        static_cast<double>(latencies_ns_.size()), benchmark::Counter::kIsRate);
+  }
+
+ private:
+  std::vector<int64_t> latencies_ns_;
+};
+
+std::unique_ptr<PlasmaClient> ConnectClient(int release_delay) {
+  std::unique_ptr<PlasmaClient> client(new PlasmaClient());
+  ARROW_CHECK_OK(client->Connect(store_socket_name, "", release_delay));
+  return client;
+}
+
+void CreateObject(PlasmaClient* client, const ObjectID& object_id, int64_t size) {
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client->Create(object_id, size, NULL, 0, &data));
+  ARROW_CHECK_OK(client->Seal(object_id));
+}
+
+// Create and seal an object, then delete it.
+static void BM_CreateSeal(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t size = state.range(0);
+  auto client = ConnectClient(0);
+  LatencyRecorder latencies;
+  while (state.KeepRunning()) {
+    ObjectID object_id = ObjectID::from_random();
+    Clock::time_point start = Clock::now();
+    CreateObject(client.get(), object_id, size);
+    latencies.Record(start);
+    ARROW_CHECK_OK(client->Release(object_id));
+    ARROW_CHECK_OK(client->Delete(object_id));
+  }
+  latencies.Report(state);
+  ARROW_CHECK_OK(client->Disconnect());
+}
+
+// Get and release an object of the store, which the client does not cache.
+static void BM_GetRelease(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t size = state.range(0);
+  auto client = ConnectClient(0);
+  ObjectID object_id = ObjectID::from_random();
+  CreateObject(client.get(), object_id, size);
+  ARROW_CHECK_OK(client->Release(object_id));
+  LatencyRecorder latencies;
+  while (state.KeepRunning()) {
+    Clock::time_point start = Clock::now();
+    ObjectBuffer object_buffer;
+    ARROW_CHECK_OK(client->Get(&object_id, 1, -1, &object_buffer));
+    ARROW_CHECK_OK(client->Release(object_id));
+    latencies.Record(start);
+  }
+  latencies.Report(state);
+  ARROW_CHECK_OK(client->Delete(object_id));
+  ARROW_CHECK_OK(client->Disconnect());
+}
+
+// Time from sealing an object to a subscriber receiving the notification.
+static void BM_Notification(benchmark::State& state) {  // NOLINT non-const reference
+  auto client = ConnectClient(0);
+  auto subscriber = ConnectClient(0);
+  int fd;
+  ARROW_CHECK_OK(subscriber->Subscribe(&fd));
+  // Drain the notifications of the objects already in the store.
+  ObjectID object_id = ObjectID::from_random();
+  CreateObject(client.get(), object_id, 1);
+  ObjectID notified_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  do {
+    ARROW_CHECK_OK(subscriber->GetNotification(fd, &notified_id, &data_size,
+                                               &metadata_size));
+  } while (!(notified_id == object_id));
+  ARROW_CHECK_OK(client->Release(object_id));
+  ARROW_CHECK_OK(client->Delete(object_id));
+  LatencyRecorder latencies;
+  while (state.KeepRunning()) {
+    object_id = ObjectID::from_random();
+    std::shared_ptr<Buffer> data;
+    ARROW_CHECK_OK(client->Create(object_id, 1, NULL, 0, &data));
+    Clock::time_point start = Clock::now();
+    ARROW_CHECK_OK(client->Seal(object_id));
+    do {
+      ARROW_CHECK_OK(subscriber->GetNotification(fd, &notified_id, &data_size,
+                                                 &metadata_size));
+    } while (!(notified_id == object_id && data_size != -1));
+    latencies.Record(start);
+    ARROW_CHECK_OK(client->Release(object_id));
+    ARROW_CHECK_OK(client->Delete(object_id));
+  }
+  latencies.Report(state);
+  ARROW_CHECK_OK(subscriber->Disconnect());
+  ARROW_CHECK_OK(client->Disconnect());
+}
+
+// Create objects without deleting them, so that once the store is full every
+// creation evicts earlier objects.
+static void BM_CreateEvict(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t size = state.range(0);
+  auto client = ConnectClient(0);
+  // Fill the store first.
+  for (int64_t i = 0; i < kStoreMemory / size; ++i) {
+    ObjectID object_id = ObjectID::from_random();
+    CreateObject(client.get(), object_id, size);
+    ARROW_CHECK_OK(client->Release(object_id));
+  }
+  LatencyRecorder latencies;
+  while (state.KeepRunning()) {
+    ObjectID object_id = ObjectID::from_random();
+    Clock::time_point start = Clock::now();
+    CreateObject(client.get(), object_id, size);
+    latencies.Record(start);
+    ARROW_CHECK_OK(client->Release(object_id));
+  }
+  latencies.Report(state);
+  ARROW_CHECK_OK(client->Disconnect());
+}
+
+BENCHMARK(BM_CreateSeal)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 25)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK(BM_GetRelease)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 25)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK(BM_Notification)->UseRealTime();
+
+BENCHMARK(BM_CreateEvict)
+    ->RangeMultiplier(32)
+    ->Range(1 << 15, 1 << 25)
+    ->ThreadRange(1, 4)
+    ->UseRealTime();
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  // Start a store next to the benchmark executable.
+  std::string executable(argv[0]);
+  std::string store_executable =
+      executable.substr(0, executable.find_last_of("/") + 1) + "plasma_store";
+  plasma::store_socket_name = "/tmp/plasma_benchmark" + std::to_string(getpid());
+  pid_t store_pid = fork();
+  if (store_pid == 0) {
+    execl(store_executable.c_str(), store_executable.c_str(), "-s",
+          plasma::store_socket_name.c_str(), "-m",
+          std::to_string(plasma::kStoreMemory).c_str(), NULL);
+    ARROW_LOG(FATAL) << "Failed to start " << store_executable;
+  }
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  kill(store_pid, SIGTERM);
+  waitpid(store_pid, NULL, 0);
+  return 0;
+}
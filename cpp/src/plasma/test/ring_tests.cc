@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "plasma/ring.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+#ifdef __linux__
+
+// The other end of a ring, mapping the same memory as another process would.
+void OpenOtherEnd(const MessageRing& ring, std::unique_ptr<MessageRing>* out) {
+  ARROW_CHECK_OK(MessageRing::Open(dup(ring.memory_fd()), dup(ring.doorbell_fd()), out));
+}
+
+TEST(MessageRing, WriteRead) {
+  std::unique_ptr<MessageRing> producer, consumer;
+  ARROW_CHECK_OK(MessageRing::Create(100, &producer));
+  OpenOtherEnd(*producer, &consumer);
+
+  int64_t type;
+  std::vector<uint8_t> buffer;
+  ASSERT_FALSE(consumer->Read(&type, &buffer));
+
+  // Messages wrap around the end of the ring.
+  std::vector<uint8_t> message(30);
+  for (int i = 0; i < 10; ++i) {
+    message[0] = static_cast<uint8_t>(i);
+    ASSERT_TRUE(producer->Write(i, message.size(), message.data()));
+    ASSERT_TRUE(producer->Write(i + 1, 0, nullptr));
+    ASSERT_TRUE(consumer->Read(&type, &buffer));
+    ASSERT_EQ(i, type);
+    ASSERT_EQ(i, buffer[0]);
+    ASSERT_TRUE(consumer->Read(&type, &buffer));
+    ASSERT_EQ(i + 1, type);
+  }
+  ASSERT_FALSE(consumer->Read(&type, &buffer));
+
+  // Messages are only written if there is room for them.
+  ASSERT_TRUE(producer->Write(1, message.size(), message.data()));
+  ASSERT_TRUE(producer->Write(2, message.size(), message.data()));
+  ASSERT_FALSE(producer->Write(3, message.size(), message.data()));
+  ASSERT_TRUE(consumer->Read(&type, &buffer));
+  ASSERT_TRUE(producer->Write(3, message.size(), message.data()));
+  ASSERT_FALSE(producer->Fits(100));
+}
+
+TEST(MessageRing, ReceiveWaitsOnDoorbell) {
+  std::unique_ptr<MessageRing> producer, consumer;
+  ARROW_CHECK_OK(MessageRing::Create(1 << 16, &producer));
+  OpenOtherEnd(*producer, &consumer);
+  int sockets[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sockets));
+
+  const int num_messages = 1000;
+  std::thread writer([&]() {
+    for (int64_t i = 0; i < num_messages; ++i) {
+      if (i % 100 == 0) {
+        // Let the reader wait on the doorbell.
+        usleep(10000);
+      }
+      while (!producer->Write(i, sizeof(i), reinterpret_cast<uint8_t*>(&i))) {
+      }
+    }
+  });
+  int64_t type;
+  std::vector<uint8_t> buffer;
+  for (int64_t i = 0; i < num_messages; ++i) {
+    ARROW_CHECK_OK(consumer->Receive(sockets[0], &type, &buffer));
+    ASSERT_EQ(i, type);
+    ASSERT_EQ(i, *reinterpret_cast<int64_t*>(buffer.data()));
+  }
+  writer.join();
+
+  // Waiting fails once the peer hangs up.
+  close(sockets[1]);
+  ASSERT_TRUE(consumer->Receive(sockets[0], &type, &buffer).IsIOError());
+  close(sockets[0]);
+}
+
+TEST(MessageRing, EventDrivenConsumer) {
+  std::unique_ptr<MessageRing> producer, consumer;
+  ARROW_CHECK_OK(MessageRing::Create(1 << 10, &producer));
+  OpenOtherEnd(*producer, &consumer);
+  uint8_t byte = 0;
+
+  // The doorbell is only rung while the consumer waits.
+  ASSERT_TRUE(consumer->EndRead());
+  ASSERT_TRUE(producer->Write(1, 1, &byte));
+  consumer->BeginRead();
+  ASSERT_TRUE(producer->Write(2, 1, &byte));
+  uint64_t count;
+  ASSERT_EQ(-1, read(consumer->doorbell_fd(), &count, sizeof(count)));
+
+  int64_t type;
+  std::vector<uint8_t> buffer;
+  ASSERT_TRUE(consumer->Read(&type, &buffer));
+  ASSERT_EQ(1, type);
+  // A message written meanwhile must be read before waiting.
+  ASSERT_FALSE(consumer->EndRead());
+  ASSERT_TRUE(consumer->Read(&type, &buffer));
+  ASSERT_EQ(2, type);
+  ASSERT_TRUE(consumer->EndRead());
+  ASSERT_TRUE(producer->Write(3, 1, &byte));
+  ASSERT_EQ(sizeof(count), read(consumer->doorbell_fd(), &count, sizeof(count)));
+}
+
+#endif
+
+}  // namespace plasma
@@ -115,6 +115,65 @@ TEST(PlasmaSerialization, CreateReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, CreateManyRequest) {
+  int fd = create_temp_file();
+  ObjectID object_ids1[2] = {ObjectID::from_random(), ObjectID::from_random()};
+  int64_t data_sizes1[2] = {42, 1000};
+  int64_t metadata_sizes1[2] = {11, 0};
+  ARROW_CHECK_OK(
+      SendCreateManyRequest(fd, object_ids1, 2, data_sizes1, metadata_sizes1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType_PlasmaCreateManyRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<int64_t> data_sizes2;
+  std::vector<int64_t> metadata_sizes2;
+  ARROW_CHECK_OK(ReadCreateManyRequest(data.data(), data.size(), &object_ids2,
+                                       &data_sizes2, &metadata_sizes2));
+  ASSERT_EQ(2, object_ids2.size());
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(object_ids1[i], object_ids2[i]);
+    ASSERT_EQ(data_sizes1[i], data_sizes2[i]);
+    ASSERT_EQ(metadata_sizes1[i], metadata_sizes2[i]);
+  }
+  close(fd);
+}
+
+TEST(PlasmaSerialization, CreateManyReply) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {ObjectID::from_random(), ObjectID::from_random()};
+  std::vector<PlasmaObject> objects1 = {random_plasma_object(), random_plasma_object()};
+  std::vector<int> store_fds1 = {objects1[0].store_fd};
+  std::vector<int64_t> mmap_sizes1 = {1000000};
+  ARROW_CHECK_OK(SendCreateManyReply(fd, object_ids1, objects1, PlasmaError_OK,
+                                     store_fds1, mmap_sizes1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType_PlasmaCreateManyReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<PlasmaObject> objects2;
+  std::vector<int> store_fds2;
+  std::vector<int64_t> mmap_sizes2;
+  ARROW_CHECK_OK(ReadCreateManyReply(data.data(), data.size(), &object_ids2, &objects2,
+                                     &store_fds2, &mmap_sizes2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(store_fds1, store_fds2);
+  ASSERT_EQ(mmap_sizes1, mmap_sizes2);
+  ASSERT_EQ(2, objects2.size());
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(memcmp(&objects1[i], &objects2[i], sizeof(PlasmaObject)), 0);
+  }
+  close(fd);
+
+  // On error, no object is sent back
+  fd = create_temp_file();
+  ARROW_CHECK_OK(SendCreateManyReply(fd, object_ids1, {}, PlasmaError_ObjectExists, {},
+                                     {}));
+  data = read_message_from_file(fd, MessageType_PlasmaCreateManyReply);
+  Status s = ReadCreateManyReply(data.data(), data.size(), &object_ids2, &objects2,
+                                 &store_fds2, &mmap_sizes2);
+  ASSERT_TRUE(s.IsPlasmaObjectExists());
+  close(fd);
+}
+
 TEST(PlasmaSerialization, SealRequest) {
   int fd = create_temp_file();
   ObjectID object_id1 = ObjectID::from_random();
@@ -130,6 +189,26 @@ TEST(PlasmaSerialization, SealRequest) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, SealManyRequest) {
+  int fd = create_temp_file();
+  ObjectID object_ids1[2] = {ObjectID::from_random(), ObjectID::from_random()};
+  unsigned char digests1[2 * kDigestSize];
+  memset(&digests1[0], 7, kDigestSize);
+  memset(&digests1[kDigestSize], 9, kDigestSize);
+  ARROW_CHECK_OK(SendSealManyRequest(fd, object_ids1, 2, &digests1[0]));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType_PlasmaSealManyRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<unsigned char> digests2;
+  ARROW_CHECK_OK(ReadSealManyRequest(data.data(), data.size(), &object_ids2, &digests2));
+  ASSERT_EQ(2, object_ids2.size());
+  ASSERT_EQ(object_ids1[0], object_ids2[0]);
+  ASSERT_EQ(object_ids1[1], object_ids2[1]);
+  ASSERT_EQ(2 * kDigestSize, digests2.size());
+  ASSERT_EQ(memcmp(&digests1[0], digests2.data(), 2 * kDigestSize), 0);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, SealReply) {
   int fd = create_temp_file();
   ObjectID object_id1 = ObjectID::from_random();
@@ -160,6 +239,22 @@ TEST(PlasmaSerialization, GetRequest) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, GetRequestMappedFds) {
+  int fd = create_temp_file();
+  ObjectID object_id = ObjectID::from_random();
+  std::vector<int> mapped_fds = {3, 7};
+  ARROW_CHECK_OK(SendGetRequest(fd, &object_id, 1, -1, mapped_fds));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType_PlasmaGetRequest);
+  std::vector<ObjectID> object_ids_return;
+  int64_t timeout_ms_return;
+  std::vector<int> mapped_fds_return;
+  ARROW_CHECK_OK(ReadGetRequest(data.data(), data.size(), object_ids_return,
+                                &timeout_ms_return, &mapped_fds_return));
+  ASSERT_EQ(object_id, object_ids_return[0]);
+  ASSERT_EQ(mapped_fds, mapped_fds_return);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, GetReply) {
   int fd = create_temp_file();
   ObjectID object_ids[2];
@@ -207,6 +302,22 @@ TEST(PlasmaSerialization, ReleaseRequest) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, ReleaseManyRequest) {
+  int fd = create_temp_file();
+  ObjectID object_ids1[3] = {ObjectID::from_random(), ObjectID::from_random(),
+                             ObjectID::from_random()};
+  ARROW_CHECK_OK(SendReleaseManyRequest(fd, object_ids1, 3));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType_PlasmaReleaseManyRequest);
+  std::vector<ObjectID> object_ids2;
+  ARROW_CHECK_OK(ReadReleaseManyRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(3, object_ids2.size());
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(object_ids1[i], object_ids2[i]);
+  }
+  close(fd);
+}
+
 TEST(PlasmaSerialization, ReleaseReply) {
   int fd = create_temp_file();
   ObjectID object_id1 = ObjectID::from_random();
@@ -243,6 +354,31 @@ TEST(PlasmaSerialization, DeleteReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, PinRequest) {
+  int fd = create_temp_file();
+  ObjectID object_id1 = ObjectID::from_random();
+  ARROW_CHECK_OK(SendPinRequest(fd, object_id1, true));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType_PlasmaPinRequest);
+  ObjectID object_id2;
+  bool pinned;
+  ARROW_CHECK_OK(ReadPinRequest(data.data(), data.size(), &object_id2, &pinned));
+  ASSERT_EQ(object_id1, object_id2);
+  ASSERT_TRUE(pinned);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, PinReply) {
+  int fd = create_temp_file();
+  ObjectID object_id1 = ObjectID::from_random();
+  ARROW_CHECK_OK(SendPinReply(fd, object_id1, PlasmaError_ObjectNonexistent));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType_PlasmaPinReply);
+  ObjectID object_id2;
+  Status s = ReadPinReply(data.data(), data.size(), &object_id2);
+  ASSERT_EQ(object_id1, object_id2);
+  ASSERT_TRUE(s.IsPlasmaObjectNonexistent());
+  close(fd);
+}
+
 TEST(PlasmaSerialization, StatusRequest) {
   int fd = create_temp_file();
   constexpr int64_t num_objects = 2;
@@ -302,6 +438,30 @@ TEST(PlasmaSerialization, EvictReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, MetricsReply) {
+  int fd = create_temp_file();
+  StoreMetrics metrics1;
+  metrics1.memory_capacity = 1000;
+  metrics1.malloc_free_chunks = 3;
+  metrics1.num_bytes_spilled = 100;
+  metrics1.request_latencies[MessageType_PlasmaGetRequest].Record(5);
+  metrics1.request_latencies[MessageType_PlasmaGetRequest].Record(300);
+  metrics1.request_latencies[MessageType_PlasmaSealRequest].Record(1);
+  ARROW_CHECK_OK(SendMetricsReply(fd, metrics1));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType_PlasmaMetricsReply);
+  StoreMetrics metrics2;
+  ARROW_CHECK_OK(ReadMetricsReply(data.data(), data.size(), &metrics2));
+  ASSERT_EQ(metrics1.ToString(), metrics2.ToString());
+  const LatencyHistogram& latencies =
+      metrics2.request_latencies[MessageType_PlasmaGetRequest];
+  ASSERT_EQ(2, latencies.count);
+  ASSERT_EQ(305, latencies.total_us);
+  ASSERT_EQ(300, latencies.max_us);
+  ASSERT_EQ(metrics1.request_latencies[MessageType_PlasmaGetRequest].buckets,
+            latencies.buckets);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, FetchRequest) {
   int fd = create_temp_file();
   ObjectID object_ids[2];
@@ -414,4 +574,22 @@ TEST(PlasmaSerialization, DataReply) {
   ASSERT_EQ(metadata_size1, metadata_size2);
 }
 
+TEST(PlasmaSerialization, ConnectRingRequest) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendConnectRingRequest(fd));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType_PlasmaConnectRingRequest);
+  ARROW_CHECK_OK(ReadConnectRingRequest(data.data(), data.size()));
+  close(fd);
+}
+
+TEST(PlasmaSerialization, ConnectRingReply) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendConnectRingReply(fd, PlasmaError_OK));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType_PlasmaConnectRingReply);
+  ARROW_CHECK_OK(ReadConnectRingReply(data.data(), data.size()));
+  close(fd);
+}
+
 }  // namespace plasma
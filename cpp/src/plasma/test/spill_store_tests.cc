@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "plasma/spill_store.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+TEST(SpillStore, WriteRead) {
+  std::unique_ptr<SpillStore> spill_store;
+  ASSERT_TRUE(SpillStore::Open("/tmp", &spill_store).ok());
+  ObjectID object_id = ObjectID::from_random();
+  std::vector<uint8_t> data(1000);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  ASSERT_TRUE(spill_store->Write(object_id, data.data(), data.size()).ok());
+
+  std::vector<uint8_t> read(data.size());
+  ASSERT_TRUE(spill_store->Read(object_id, read.data(), read.size()).ok());
+  ASSERT_EQ(data, read);
+
+  // Reads happen on another thread.
+  std::fill(read.begin(), read.end(), 0);
+  std::promise<Status> done;
+  ASSERT_TRUE(spill_store
+                  ->ReadAsync(object_id, read.data(), read.size(),
+                              [&done](const Status& s) { done.set_value(s); })
+                  .ok());
+  ASSERT_TRUE(done.get_future().get().ok());
+  ASSERT_EQ(data, read);
+
+  spill_store->Remove(object_id);
+  ASSERT_TRUE(spill_store->Read(object_id, read.data(), read.size()).IsIOError());
+}
+
+TEST(SpillStore, InvalidDirectory) {
+  std::unique_ptr<SpillStore> spill_store;
+  ASSERT_TRUE(SpillStore::Open("/nonexistent/directory", &spill_store).IsIOError());
+}
+
+}  // namespace plasma
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "plasma/transfer.h"
+
+#include "gtest/gtest.h"
+
+namespace plasma {
+
+// Receives objects in memory.
+class MemoryTarget : public TransferTarget {
+ public:
+  MemoryTarget() : num_begun(0), fail_begin(false) {}
+
+  Status BeginReceive(const ObjectID& object_id, int64_t data_size,
+                      int64_t metadata_size, uint8_t** pointer) override {
+    std::lock_guard<std::mutex> guard(mutex);
+    ++num_begun;
+    if (fail_begin) {
+      return Status::OutOfMemory("Not enough memory");
+    }
+    data.resize(data_size + metadata_size);
+    *pointer = data.data();
+    return Status::OK();
+  }
+
+  void FinishReceive(const ObjectID& object_id, const std::string& digest,
+                     const Status& status) override {
+    received_digest = digest;
+    finished.set_value(status);
+  }
+
+  std::mutex mutex;
+  int num_begun;
+  bool fail_begin;
+  std::vector<uint8_t> data;
+  std::string received_digest;
+  std::promise<Status> finished;
+};
+
+TEST(TransferService, SendReceive) {
+  MemoryTarget target;
+  std::unique_ptr<TransferService> service;
+  ASSERT_TRUE(TransferService::Listen(0, 4, &target, &service).ok());
+  ASSERT_GT(service->port(), 0);
+
+  // The object is large enough to be sent on several connections.
+  ObjectID object_id = ObjectID::from_random();
+  const int64_t data_size = 3 << 20;
+  const int64_t metadata_size = 7;
+  std::vector<uint8_t> object(data_size + metadata_size);
+  for (size_t i = 0; i < object.size(); ++i) {
+    object[i] = static_cast<uint8_t>(i * 7);
+  }
+  const std::string digest = "digest!!";
+  std::promise<Status> sent;
+  service->SendAsync("localhost", service->port(), object_id, digest, object.data(),
+                     data_size, metadata_size,
+                     [&sent](const Status& s) { sent.set_value(s); });
+  ASSERT_TRUE(sent.get_future().get().ok());
+  ASSERT_TRUE(target.finished.get_future().get().ok());
+  ASSERT_EQ(target.num_begun, 1);
+  ASSERT_EQ(target.received_digest, digest);
+  ASSERT_EQ(target.data, object);
+}
+
+TEST(TransferService, ReceiveFailure) {
+  MemoryTarget target;
+  target.fail_begin = true;
+  std::unique_ptr<TransferService> service;
+  ASSERT_TRUE(TransferService::Listen(0, 2, &target, &service).ok());
+  ObjectID object_id = ObjectID::from_random();
+  std::vector<uint8_t> object(100);
+  Status s = service->Send("localhost", service->port(), object_id, "", object.data(),
+                           object.size(), 0);
+  ASSERT_TRUE(s.IsIOError());
+}
+
+TEST(TransferService, ConnectFailure) {
+  MemoryTarget target;
+  std::unique_ptr<TransferService> service;
+  ASSERT_TRUE(TransferService::Listen(0, 2, &target, &service).ok());
+  std::unique_ptr<TransferService> closed;
+  ASSERT_TRUE(TransferService::Listen(0, 2, &target, &closed).ok());
+  const int closed_port = closed->port();
+  closed.reset();
+  std::vector<uint8_t> object(100);
+  Status s = service->Send("localhost", closed_port, ObjectID::from_random(), "",
+                           object.data(), object.size(), 0);
+  ASSERT_TRUE(s.IsIOError());
+}
+
+}  // namespace plasma
@@ -0,0 +1,410 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/transfer.h"
+
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "arrow/util/logging.h"
+#include "plasma/io.h"
+
+namespace plasma {
+
+namespace {
+
+// Objects are only split over several connections in ranges of at least this
+// size, below which the connection setup costs more than it saves.
+constexpr int64_t kMinStreamSize = 1 << 20;
+
+// Sent at the start of each connection, followed by the range of the object.
+// The receiver replies with a status code of 0 once it read the range.
+struct StreamHeader {
+  ObjectID object_id;
+  char digest[kDigestSize];
+  int64_t data_size;
+  int64_t metadata_size;
+  int64_t offset;
+  int64_t length;
+  int64_t num_streams;
+};
+
+void SetNoDelay(int fd) {
+  // The header and the reply are small, and must not wait for more data.
+  int flag = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+Status ListenTcp(int port, int* fd, int* bound_port) {
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  if (sock < 0) {
+    return Status::IOError(std::string("Failed to create socket: ") + strerror(errno));
+  }
+  int on = 1;
+  setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(static_cast<uint16_t>(port));
+  socklen_t address_size = sizeof(address);
+  if (bind(sock, reinterpret_cast<struct sockaddr*>(&address), address_size) != 0 ||
+      listen(sock, 128) != 0 ||
+      getsockname(sock, reinterpret_cast<struct sockaddr*>(&address), &address_size) !=
+          0) {
+    Status s = Status::IOError("Failed to listen on port " + std::to_string(port) +
+                               ": " + strerror(errno));
+    close(sock);
+    return s;
+  }
+  *fd = sock;
+  *bound_port = ntohs(address.sin_port);
+  return Status::OK();
+}
+
+Status ConnectTcp(const std::string& host, int port, int* fd) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* addresses;
+  int error = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses);
+  if (error != 0) {
+    return Status::IOError("Failed to resolve " + host + ": " + gai_strerror(error));
+  }
+  int sock = -1;
+  for (struct addrinfo* address = addresses; address != NULL;
+       address = address->ai_next) {
+    sock = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (sock < 0) {
+      continue;
+    }
+    if (connect(sock, address->ai_addr, address->ai_addrlen) == 0) {
+      break;
+    }
+    close(sock);
+    sock = -1;
+  }
+  freeaddrinfo(addresses);
+  if (sock < 0) {
+    return Status::IOError("Failed to connect to " + host + ":" + std::to_string(port) +
+                           ": " + strerror(errno));
+  }
+  SetNoDelay(sock);
+  *fd = sock;
+  return Status::OK();
+}
+
+Status SendStream(int fd, const StreamHeader& header, const uint8_t* data) {
+  StreamHeader copy = header;
+  RETURN_NOT_OK(WriteBytes(fd, reinterpret_cast<uint8_t*>(&copy), sizeof(copy)));
+  RETURN_NOT_OK(WriteBytes(fd, const_cast<uint8_t*>(data) + header.offset,
+                           static_cast<size_t>(header.length)));
+  int64_t code;
+  RETURN_NOT_OK(ReadBytes(fd, reinterpret_cast<uint8_t*>(&code), sizeof(code)));
+  if (code != 0) {
+    return Status::IOError("The other store failed to receive object " +
+                           header.object_id.hex());
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+struct TransferService::Receive {
+  /// Where the object is written, null if it could not be allocated.
+  uint8_t* pointer;
+  std::string digest;
+  /// The number of connections the object is sent on, and of those that ended.
+  int64_t num_streams;
+  int64_t num_streams_ended;
+  /// The number of connections writing to the object.
+  int num_streams_writing;
+  /// The first error of the receive.
+  Status status;
+  /// Whether the target was told about the end of the receive.
+  bool finished;
+};
+
+TransferService::TransferService(int listen_fd, int port, int num_streams,
+                                 TransferTarget* target)
+    : listen_fd_(listen_fd),
+      port_(port),
+      num_streams_(num_streams),
+      target_(target),
+      stopping_(false) {}
+
+TransferService::~TransferService() {
+  {
+    std::lock_guard<std::mutex> guard(threads_mutex_);
+    stopping_ = true;
+    // Interrupt the accept and the transfers in progress.
+    shutdown(listen_fd_, SHUT_RDWR);
+    for (int fd : connections_) {
+      shutdown(fd, SHUT_RDWR);
+    }
+  }
+  while (true) {
+    std::list<std::thread> threads;
+    {
+      std::lock_guard<std::mutex> guard(threads_mutex_);
+      threads.swap(threads_);
+    }
+    if (threads.empty()) {
+      break;
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  close(listen_fd_);
+}
+
+Status TransferService::Listen(int port, int num_streams, TransferTarget* target,
+                               std::unique_ptr<TransferService>* out) {
+  if (num_streams < 1) {
+    return Status::Invalid("The number of streams must be positive");
+  }
+  int fd = -1;
+  int bound_port = 0;
+  RETURN_NOT_OK(ListenTcp(port, &fd, &bound_port));
+  out->reset(new TransferService(fd, bound_port, num_streams, target));
+  TransferService* service = out->get();
+  service->StartThread([service]() { service->AcceptConnections(); });
+  return Status::OK();
+}
+
+int TransferService::port() const { return port_; }
+
+void TransferService::StartThread(std::function<void()> task) {
+  std::lock_guard<std::mutex> guard(threads_mutex_);
+  for (const auto& id : finished_threads_) {
+    auto it = std::find_if(
+        threads_.begin(), threads_.end(),
+        [&id](const std::thread& thread) { return thread.get_id() == id; });
+    if (it != threads_.end()) {
+      it->join();
+      threads_.erase(it);
+    }
+  }
+  finished_threads_.clear();
+  threads_.emplace_back([this, task]() {
+    task();
+    std::lock_guard<std::mutex> guard(threads_mutex_);
+    finished_threads_.push_back(std::this_thread::get_id());
+  });
+}
+
+bool TransferService::AddConnection(int fd) {
+  std::lock_guard<std::mutex> guard(threads_mutex_);
+  if (stopping_) {
+    return false;
+  }
+  connections_.insert(fd);
+  return true;
+}
+
+void TransferService::CloseConnection(int fd) {
+  std::lock_guard<std::mutex> guard(threads_mutex_);
+  connections_.erase(fd);
+  close(fd);
+}
+
+void TransferService::AcceptConnections() {
+  while (!stopping_) {
+    int fd = accept(listen_fd_, NULL, NULL);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      if (!stopping_) {
+        ARROW_LOG(ERROR) << "Failed to accept object transfers: " << strerror(errno);
+      }
+      break;
+    }
+    if (!AddConnection(fd)) {
+      close(fd);
+      break;
+    }
+    SetNoDelay(fd);
+    StartThread([this, fd]() { ReceiveStream(fd); });
+  }
+}
+
+void TransferService::ReceiveStream(int fd) {
+  StreamHeader header;
+  Status s = ReadBytes(fd, reinterpret_cast<uint8_t*>(&header), sizeof(header));
+  if (s.ok() && (header.data_size < 0 || header.metadata_size < 0 ||
+                 header.num_streams < 1 || header.offset < 0 || header.length < 0 ||
+                 header.offset + header.length >
+                     header.data_size + header.metadata_size)) {
+    s = Status::Invalid("Received an invalid object range");
+  }
+  if (!s.ok()) {
+    ARROW_LOG(WARNING) << "Failed to receive an object: " << s.ToString();
+    CloseConnection(fd);
+    return;
+  }
+  const ObjectID& object_id = header.object_id;
+  uint8_t* pointer = NULL;
+  {
+    // The first connection of an object allocates it.
+    std::lock_guard<std::mutex> guard(receives_mutex_);
+    auto& receive = receives_[object_id];
+    if (!receive) {
+      receive.reset(new Receive());
+      receive->pointer = NULL;
+      receive->digest = std::string(header.digest, kDigestSize);
+      receive->num_streams = header.num_streams;
+      receive->num_streams_ended = 0;
+      receive->num_streams_writing = 0;
+      receive->status = target_->BeginReceive(object_id, header.data_size,
+                                              header.metadata_size, &receive->pointer);
+      // There is nothing to abort if the object could not be allocated.
+      receive->finished = !receive->status.ok();
+    }
+    if (receive->status.ok()) {
+      ++receive->num_streams_writing;
+      pointer = receive->pointer;
+    } else {
+      s = receive->status;
+    }
+  }
+  const bool writing = pointer != NULL;
+  if (writing) {
+    s = ReadBytes(fd, pointer + header.offset, static_cast<size_t>(header.length));
+  }
+  EndStream(object_id, writing, s);
+  int64_t code = s.ok() ? 0 : 1;
+  ARROW_UNUSED(WriteBytes(fd, reinterpret_cast<uint8_t*>(&code), sizeof(code)));
+  CloseConnection(fd);
+}
+
+void TransferService::EndStream(const ObjectID& object_id, bool writing,
+                                const Status& status) {
+  bool finish = false;
+  Status finish_status;
+  std::string digest;
+  {
+    std::lock_guard<std::mutex> guard(receives_mutex_);
+    auto it = receives_.find(object_id);
+    Receive* receive = it->second.get();
+    if (writing) {
+      --receive->num_streams_writing;
+    }
+    ++receive->num_streams_ended;
+    if (!status.ok() && receive->status.ok()) {
+      receive->status = status;
+    }
+    // A failed object is only aborted once no connection writes to it.
+    if (!receive->finished && receive->num_streams_writing == 0 &&
+        (!receive->status.ok() || receive->num_streams_ended == receive->num_streams)) {
+      receive->finished = true;
+      finish = true;
+      finish_status = receive->status;
+      digest = receive->digest;
+    }
+    if (receive->num_streams_ended >= receive->num_streams) {
+      receives_.erase(it);
+    }
+  }
+  if (finish) {
+    target_->FinishReceive(object_id, digest, finish_status);
+  }
+}
+
+Status TransferService::Send(const std::string& address, int port,
+                             const ObjectID& object_id, const std::string& digest,
+                             const uint8_t* data, int64_t data_size,
+                             int64_t metadata_size) {
+  const int64_t object_size = data_size + metadata_size;
+  const int64_t num_streams = std::max(
+      static_cast<int64_t>(1),
+      std::min(static_cast<int64_t>(num_streams_), object_size / kMinStreamSize));
+  // Connect all the streams first, so that the receiver does not wait for
+  // streams that never come.
+  std::vector<int> fds;
+  Status s;
+  for (int64_t i = 0; i < num_streams && s.ok(); ++i) {
+    int fd;
+    s = ConnectTcp(address, port, &fd);
+    if (s.ok()) {
+      if (AddConnection(fd)) {
+        fds.push_back(fd);
+      } else {
+        close(fd);
+        s = Status::IOError("The transfer service is stopping");
+      }
+    }
+  }
+  if (s.ok()) {
+    StreamHeader header;
+    header.object_id = object_id;
+    memset(header.digest, 0, kDigestSize);
+    memcpy(header.digest, digest.data(), std::min(digest.size(), sizeof(header.digest)));
+    header.data_size = data_size;
+    header.metadata_size = metadata_size;
+    header.num_streams = num_streams;
+    // The first stream is sent on this thread.
+    std::vector<Status> statuses(num_streams);
+    std::vector<std::thread> threads;
+    for (int64_t i = num_streams - 1; i >= 0; --i) {
+      header.offset = object_size * i / num_streams;
+      header.length = object_size * (i + 1) / num_streams - header.offset;
+      const int fd = fds[i];
+      if (i == 0) {
+        statuses[i] = SendStream(fd, header, data);
+      } else {
+        threads.emplace_back([fd, header, data, i, &statuses]() {
+          statuses[i] = SendStream(fd, header, data);
+        });
+      }
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const auto& status : statuses) {
+      if (!status.ok()) {
+        s = status;
+        break;
+      }
+    }
+  }
+  for (int fd : fds) {
+    CloseConnection(fd);
+  }
+  return s;
+}
+
+void TransferService::SendAsync(const std::string& address, int port,
+                                const ObjectID& object_id, const std::string& digest,
+                                const uint8_t* data, int64_t data_size,
+                                int64_t metadata_size,
+                                std::function<void(const Status&)> done) {
+  StartThread([=]() {
+    done(Send(address, port, object_id, digest, data, data_size, metadata_size));
+  });
+}
+
+}  // namespace plasma
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_TRANSFER_H
+#define PLASMA_TRANSFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "arrow/status.h"
+#include "plasma/common.h"
+
+namespace plasma {
+
+using arrow::Status;
+
+/// Where a transfer service writes the objects it receives, implemented by
+/// the store. The methods are called from the threads of the service.
+class TransferTarget {
+ public:
+  virtual ~TransferTarget() = default;
+
+  /// Allocate an object that is being received.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param data_size The size of the data of the object.
+  /// @param metadata_size The size of the metadata of the object.
+  /// @param pointer Out parameter, the memory where the data followed by the
+  ///        metadata are written. It must remain valid until FinishReceive.
+  /// @return The return status.
+  virtual Status BeginReceive(const ObjectID& object_id, int64_t data_size,
+                              int64_t metadata_size, uint8_t** pointer) = 0;
+
+  /// Seal an object once it is received, or abort it if it could not be.
+  ///
+  /// @param object_id The ID of the object.
+  /// @param digest The digest of the object in the sending store.
+  /// @param status Whether the whole object was received.
+  virtual void FinishReceive(const ObjectID& object_id, const std::string& digest,
+                             const Status& status) = 0;
+};
+
+/// Sends the objects of a Plasma store to the transfer services of other
+/// stores, and receives theirs, over TCP. An object is split in contiguous
+/// ranges sent on parallel connections, and is read from and written to the
+/// memory of the stores without intermediate copies. The receiving store can
+/// only read the object once it is complete.
+///
+/// The stores must have the same byte order.
+class TransferService {
+ public:
+  /// Stop receiving, and wait for the transfers in progress to end.
+  ~TransferService();
+
+  /// Start a transfer service, listening for objects on a TCP port.
+  ///
+  /// @param port The port, or 0 for any free port.
+  /// @param num_streams The number of parallel connections used to send an
+  ///        object. Smaller objects use fewer.
+  /// @param target Where the objects received are written. It must outlive
+  ///        the service.
+  /// @param out The transfer service.
+  /// @return The return status.
+  static Status Listen(int port, int num_streams, TransferTarget* target,
+                       std::unique_ptr<TransferService>* out);
+
+  /// The port the service listens on.
+  int port() const;
+
+  /// Send an object to the transfer service of another store.
+  ///
+  /// @param address The host name or IP address of the other store.
+  /// @param port The port of the transfer service of the other store.
+  /// @param object_id The ID of the object.
+  /// @param digest The digest of the object.
+  /// @param data The data followed by the metadata of the object.
+  /// @param data_size The size of the data of the object.
+  /// @param metadata_size The size of the metadata of the object.
+  /// @return The return status, OK once the object is received by the other
+  ///         store.
+  Status Send(const std::string& address, int port, const ObjectID& object_id,
+              const std::string& digest, const uint8_t* data, int64_t data_size,
+              int64_t metadata_size);
+
+  /// Send an object on a thread of the service, then call done there with the
+  /// status of the transfer. The memory must remain valid until then.
+  void SendAsync(const std::string& address, int port, const ObjectID& object_id,
+                 const std::string& digest, const uint8_t* data, int64_t data_size,
+                 int64_t metadata_size, std::function<void(const Status&)> done);
+
+ private:
+  struct Receive;
+
+  TransferService(int listen_fd, int port, int num_streams, TransferTarget* target);
+
+  /// Run a task on a new thread, joined by the destructor.
+  void StartThread(std::function<void()> task);
+
+  /// Accept the connections of the senders until the service is destroyed.
+  void AcceptConnections();
+
+  /// Receive a range of an object on a connection.
+  void ReceiveStream(int fd);
+
+  /// Mark the end of a connection of a receive, and finish it if it was the
+  /// last one.
+  void EndStream(const ObjectID& object_id, bool started, const Status& status);
+
+  /// Track an open connection, so that the destructor can interrupt it.
+  /// Returns false if the service is being destroyed.
+  bool AddConnection(int fd);
+  void CloseConnection(int fd);
+
+  int listen_fd_;
+  int port_;
+  int num_streams_;
+  TransferTarget* target_;
+  std::atomic<bool> stopping_;
+  /// Guards the threads and connections below.
+  std::mutex threads_mutex_;
+  std::list<std::thread> threads_;
+  /// The threads that ended, and can be joined.
+  std::vector<std::thread::id> finished_threads_;
+  std::unordered_set<int> connections_;
+  /// Guards receives_.
+  std::mutex receives_mutex_;
+  /// The objects being received, until all of their connections ended.
+  std::unordered_map<ObjectID, std::unique_ptr<Receive>, UniqueIDHasher> receives_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_TRANSFER_H
@@ -286,6 +286,31 @@ class InferPyListToArray(object):
         assert arr.type == self.ty
 
 
+class InferPromotedPyListToArray(object):
+    """
+    Benchmark pa.array(list of values) with type inference, where the values
+    at the end of the list need a wider type than those before them
+    """
+    size = 10 ** 5
+    types = ('int64', 'float64', 'binary')
+
+    param_names = ['type']
+    params = [types]
+
+    def setup(self, type_name):
+        gen = BuiltinsGenerator()
+        narrow_type_name = {'int64': 'bool', 'float64': 'int64',
+                            'binary': 'unicode'}[type_name]
+        self.ty = getattr(pa, type_name)()
+        _, self.data = gen.get_type_and_builtins(self.size, narrow_type_name)
+        _, wide = gen.get_type_and_builtins(10, type_name)
+        self.data[-10:] = wide
+
+    def time_infer(self, *args):
+        arr = pa.array(self.data)
+        assert arr.type == self.ty
+
+
 class ConvertArrayToPyList(object):
     """
     Benchmark pa.array.to_pylist()
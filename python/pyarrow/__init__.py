@@ -90,9 +90,10 @@ from pyarrow.lib import TimestampType
 from pyarrow.lib import (Buffer, ResizableBuffer, foreign_buffer, py_buffer,
                          compress, decompress, allocate_buffer)
 
-from pyarrow.lib import (MemoryPool, total_allocated_bytes,
+from pyarrow.lib import (MemoryPool, ChildMemoryPool, total_allocated_bytes,
                          set_memory_pool, default_memory_pool,
-                         log_memory_allocations)
+                         system_memory_pool, jemalloc_memory_pool,
+                         thread_caching_memory_pool, log_memory_allocations)
 
 from pyarrow.lib import (HdfsFile, NativeFile, PythonFile,
                          FixedSizeBufferWriter,
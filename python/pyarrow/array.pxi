@@ -491,7 +491,8 @@ cdef class Array:
 
     def to_pandas(self, c_bool strings_to_categorical=False,
                   c_bool zero_copy_only=False,
-                  c_bool integer_object_nulls=False):
+                  c_bool integer_object_nulls=False,
+                  c_bool deduplicate_objects=False):
         """
         Convert to an array object suitable for use in pandas
 
@@ -504,6 +505,10 @@ cdef class Array:
             the underlying data
         integer_object_nulls : boolean, default False
             Cast integers with nulls to objects
+        deduplicate_objects : boolean, default False
+            Share one Python object between the equal values of string and
+            binary columns, which saves memory for columns with few distinct
+            values
 
         See also
         --------
@@ -518,7 +523,8 @@ cdef class Array:
         options = PandasOptions(
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
-            integer_object_nulls=integer_object_nulls)
+            integer_object_nulls=integer_object_nulls,
+            deduplicate_objects=deduplicate_objects)
         with nogil:
             check_status(ConvertArrayToPandas(options, self.sp_array,
                                               self, &out))
@@ -672,7 +678,29 @@ cdef class BooleanArray(Array):
 
 
 cdef class NumericArray(Array):
-    pass
+
+    def to_numpy(self):
+        """
+        Return a NumPy view of the values of this array, without copying them.
+
+        Only integer and floating point arrays without nulls are supported. The
+        view keeps the memory of the array alive.
+
+        Returns
+        -------
+        numpy.ndarray
+        """
+        cdef:
+            PyObject* out
+            CArrayData* data = self.ap.data().get()
+
+        if self.null_count > 0:
+            raise ArrowInvalid('Cannot view an array with nulls as a NumPy '
+                               'array without copying')
+        with nogil:
+            check_status(BufferToNdarray(data.buffers[1], deref(data.type),
+                                         data.offset, data.length, &out))
+        return PyObject_to_object(out)
 
 
 cdef class IntegerArray(NumericArray):
@@ -176,10 +176,16 @@ cdef extern from "arrow/api.h" namespace "arrow" nogil:
 
     cdef cppclass CMemoryPool" arrow::MemoryPool":
         int64_t bytes_allocated()
+        int64_t max_memory()
 
     cdef cppclass CLoggingMemoryPool" arrow::LoggingMemoryPool"(CMemoryPool):
         CLoggingMemoryPool(CMemoryPool*)
 
+    cdef cppclass CChildMemoryPool" arrow::ChildMemoryPool"(CMemoryPool):
+        CChildMemoryPool(CMemoryPool* parent, int64_t limit)
+        int64_t limit()
+        int64_t num_allocations()
+
     cdef cppclass CBuffer" arrow::Buffer":
         CBuffer(const uint8_t* data, int64_t size)
         const uint8_t* data()
@@ -905,6 +911,10 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
     CStatus TensorToNdarray(const shared_ptr[CTensor]& tensor, object base,
                             PyObject** out)
 
+    CStatus BufferToNdarray(const shared_ptr[CBuffer]& buffer,
+                            const CDataType& type, int64_t offset,
+                            int64_t length, PyObject** out)
+
     CStatus ConvertArrayToPandas(PandasOptions options,
                                  const shared_ptr[CArray]& arr,
                                  object py_ref, PyObject** out)
@@ -920,12 +930,21 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         int nthreads, CMemoryPool* pool,
         PyObject** out)
 
+    CStatus ConvertTableToPandas(
+        PandasOptions options,
+        const unordered_set[c_string]& categorical_columns,
+        shared_ptr[CTable]* table,
+        int nthreads, CMemoryPool* pool,
+        PyObject** out)
+
     void c_set_default_memory_pool \
         " arrow::py::set_default_memory_pool"(CMemoryPool* pool)\
 
     CMemoryPool* c_get_memory_pool \
         " arrow::py::get_memory_pool"()
 
+    CStatus GetMemoryPoolByName(const c_string& name, CMemoryPool** out)
+
     cdef cppclass PyBuffer(CBuffer):
         @staticmethod
         CStatus FromPyObject(object obj, shared_ptr[CBuffer]* out)
@@ -945,6 +964,8 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         c_bool strings_to_categorical
         c_bool zero_copy_only
         c_bool integer_object_nulls
+        c_bool deduplicate_objects
+        c_bool self_destruct
 
 cdef extern from "arrow/python/api.h" namespace 'arrow::py' nogil:
 
@@ -27,6 +27,14 @@ cdef class MemoryPool:
     def bytes_allocated(self):
         return self.pool.bytes_allocated()
 
+    def max_memory(self):
+        """
+        Return the peak number of bytes allocated through this pool, or None
+        if the pool does not track it
+        """
+        cdef int64_t max_memory = self.pool.max_memory()
+        return None if max_memory == -1 else max_memory
+
 
 cdef CMemoryPool* maybe_unbox_memory_pool(MemoryPool memory_pool):
     if memory_pool is None:
@@ -44,6 +52,51 @@ cdef class LoggingMemoryPool(MemoryPool):
         self.init(self.logging_pool.get())
 
 
+cdef class ChildMemoryPool(MemoryPool):
+    """
+    A pool forwarding to a parent pool while tracking its own allocations,
+    e.g. to attribute memory to the conversions it is passed to
+
+    Parameters
+    ----------
+    parent : MemoryPool, default None
+        The pool the memory is allocated from, default_memory_pool() if None
+    limit : int, default None
+        Maximum number of bytes allocated through this pool at any time;
+        allocations over it fail with ArrowMemoryError
+    """
+    cdef:
+        unique_ptr[CChildMemoryPool] child_pool
+        MemoryPool parent
+
+    def __cinit__(self, MemoryPool parent=None, limit=None):
+        self.parent = parent
+        self.child_pool.reset(new CChildMemoryPool(
+            maybe_unbox_memory_pool(parent), -1 if limit is None else limit))
+        self.init(self.child_pool.get())
+
+    @property
+    def limit(self):
+        cdef int64_t limit = self.child_pool.get().limit()
+        return None if limit == -1 else limit
+
+    def num_allocations(self):
+        """
+        Return the number of allocations made through this pool, not counting
+        reallocations
+        """
+        return self.child_pool.get().num_allocations()
+
+
+cdef MemoryPool _memory_pool_by_name(name):
+    cdef:
+        MemoryPool pool = MemoryPool()
+        CMemoryPool* c_pool
+    check_status(GetMemoryPoolByName(tobytes(name), &c_pool))
+    pool.init(c_pool)
+    return pool
+
+
 def default_memory_pool():
     cdef:
         MemoryPool pool = MemoryPool()
@@ -51,6 +104,29 @@ def default_memory_pool():
     return pool
 
 
+def system_memory_pool():
+    """
+    Return the process-wide pool allocating from the system allocator, or
+    from jemalloc if Arrow was built with it
+    """
+    return _memory_pool_by_name('system')
+
+
+def jemalloc_memory_pool():
+    """
+    Return the process-wide pool allocating from jemalloc. Raises
+    ArrowNotImplementedError if Arrow was built without jemalloc
+    """
+    return _memory_pool_by_name('jemalloc')
+
+
+def thread_caching_memory_pool():
+    """
+    Return the process-wide pool caching small freed blocks per thread
+    """
+    return _memory_pool_by_name('thread_caching')
+
+
 def set_memory_pool(MemoryPool pool):
     c_set_default_memory_pool(pool.pool)
 
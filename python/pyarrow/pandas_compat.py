@@ -499,6 +499,7 @@ def table_to_blockmanager(options, table, memory_pool, nthreads=1,
     column_indexes = []
     index_arrays = []
     index_names = []
+    original_table = table
     schema = table.schema
     row_count = table.num_rows
     metadata = schema.metadata
@@ -565,6 +566,15 @@ def table_to_blockmanager(options, table, memory_pool, nthreads=1,
                 block_table.schema.get_field_index(raw_name)
             )
 
+    column_strings = [x.name for x in block_table.schema]
+
+    if options['self_destruct']:
+        # Only block_table may reference the columns, so that they are freed
+        # as they are converted
+        for other_table in (original_table, table):
+            if other_table is not block_table:
+                other_table._release()
+
     blocks = _table_to_blocks(options, block_table, nthreads, memory_pool,
                               categories)
 
@@ -576,7 +586,6 @@ def table_to_blockmanager(options, table, memory_pool, nthreads=1,
     else:
         index = pd.RangeIndex(row_count)
 
-    column_strings = [x.name for x in block_table.itercolumns()]
     if columns:
         columns_name_dict = {
             c.get('field_name', _column_name_to_strings(c['name'])): c['name']
@@ -318,7 +318,8 @@ cdef class Column:
     def to_pandas(self,
                   c_bool strings_to_categorical=False,
                   c_bool zero_copy_only=False,
-                  c_bool integer_object_nulls=False):
+                  c_bool integer_object_nulls=False,
+                  c_bool deduplicate_objects=False):
         """
         Convert the arrow::Column to a pandas.Series
 
@@ -333,7 +334,8 @@ cdef class Column:
         options = PandasOptions(
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
-            integer_object_nulls=integer_object_nulls)
+            integer_object_nulls=integer_object_nulls,
+            deduplicate_objects=deduplicate_objects)
 
         with nogil:
             check_status(libarrow.ConvertColumnToPandas(options,
@@ -800,11 +802,16 @@ def table_to_blocks(PandasOptions options, Table table, int nthreads,
     if categories is not None:
         categorical_columns = {tobytes(cat) for cat in categories}
 
+    if options.self_destruct:
+        # Leave c_table with the only reference to the C++ table, which the
+        # conversion takes over to release its columns as they are converted
+        table._release()
+
     pool = maybe_unbox_memory_pool(memory_pool)
     with nogil:
         check_status(
             libarrow.ConvertTableToPandas(
-                options, categorical_columns, c_table, nthreads, pool,
+                options, categorical_columns, &c_table, nthreads, pool,
                 &result_obj
             )
         )
@@ -832,6 +839,14 @@ cdef class Table:
         self.sp_table = table
         self.table = table.get()
 
+    def _release(self):
+        """
+        Release the underlying C++ table, after which this object cannot be
+        used anymore
+        """
+        self.sp_table.reset()
+        self.table = NULL
+
     cdef int _check_nullptr(self) except -1:
         if self.table == nullptr:
             raise ReferenceError(
@@ -1077,7 +1092,8 @@ cdef class Table:
 
     def to_pandas(self, nthreads=None, strings_to_categorical=False,
                   memory_pool=None, zero_copy_only=False, categories=None,
-                  integer_object_nulls=False):
+                  integer_object_nulls=False, deduplicate_objects=False,
+                  self_destruct=False):
         """
         Convert the arrow::Table to a pandas DataFrame
 
@@ -1098,6 +1114,14 @@ cdef class Table:
             List of columns that should be returned as pandas.Categorical
         integer_object_nulls : boolean, default False
             Cast integers with nulls to objects
+        deduplicate_objects : boolean, default False
+            Share one Python object between the equal values of string and
+            binary columns, which saves memory for columns with few distinct
+            values
+        self_destruct : boolean, default False
+            Release the columns of the table as they are converted, so that
+            the memory of a column is freed once it is converted, unless
+            something else references it. The table cannot be used afterwards
 
         Returns
         -------
@@ -1109,7 +1133,9 @@ cdef class Table:
         options = PandasOptions(
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
-            integer_object_nulls=integer_object_nulls)
+            integer_object_nulls=integer_object_nulls,
+            deduplicate_objects=deduplicate_objects,
+            self_destruct=self_destruct)
         self._check_nullptr()
         if nthreads is None:
             nthreads = cpu_count()
@@ -1117,6 +1143,33 @@ cdef class Table:
                                              nthreads, categories)
         return pd.DataFrame(mgr)
 
+    def iter_pandas(self, chunksize, **kwargs):
+        """
+        Convert the arrow::Table to a sequence of pandas DataFrames, each of at
+        most chunksize rows. The DataFrames are converted one at a time, so
+        that only one of them needs to be in memory
+
+        Parameters
+        ----------
+        chunksize : int
+            Maximum number of rows of a DataFrame. DataFrames may be smaller
+            depending on the chunk layout of the columns
+        kwargs : dict
+            Options of to_pandas
+
+        Returns
+        -------
+        iterator of pandas.DataFrame
+        """
+        offset = 0
+        for batch in self.to_batches(chunksize):
+            df = Table.from_batches([batch]).to_pandas(**kwargs)
+            if isinstance(df.index, pd.RangeIndex):
+                # Number the rows as in the whole table
+                df.index = pd.RangeIndex(offset, offset + len(df))
+            offset += batch.num_rows
+            yield df
+
     def to_pydict(self):
         """
         Converted the arrow::Table to an OrderedDict
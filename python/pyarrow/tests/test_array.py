@@ -110,6 +110,36 @@ def test_to_pandas_zero_copy():
         np_arr.sum()
 
 
+@pytest.mark.parametrize('dtype', ['i1', 'u2', 'i4', 'u8', 'f2', 'f4', 'f8'])
+def test_to_numpy_zero_copy(dtype):
+    import gc
+
+    values = np.arange(10, dtype=dtype)
+    arr = pa.array(values)
+    np_arr = arr.to_numpy()
+    assert np_arr.dtype == values.dtype
+    np.testing.assert_array_equal(np_arr, values)
+    assert isinstance(np_arr.base, pa.Buffer)
+    assert np.shares_memory(np_arr, np.frombuffer(arr.buffers()[1],
+                                                  dtype=dtype))
+
+    # Slices are viewed at their offset, and keep the memory alive
+    np_arr = arr.slice(3, 5).to_numpy()
+    arr = None
+    gc.collect()
+    np.testing.assert_array_equal(np_arr, values[3:8])
+
+    assert len(pa.array([], type=pa.from_numpy_dtype(values.dtype))
+               .to_numpy()) == 0
+
+
+def test_to_numpy_unsupported():
+    with pytest.raises(pa.ArrowInvalid):
+        pa.array([1, None, 3]).to_numpy()
+    with pytest.raises(NotImplementedError):
+        pa.array([1, 2], type=pa.timestamp('ms')).to_numpy()
+
+
 def test_array_getitem():
     arr = pa.array(range(10, 15))
     lst = arr.to_pylist()
@@ -697,6 +727,25 @@ def test_array_from_numpy_unicode():
     assert arrow_arr.equals(expected)
 
 
+def test_array_from_numpy_unicode_multibyte():
+    values = [u'a', u'\xe9t\xe9', u'\u20ac', u'\U0001f600x', u'']
+    for dtype in ['<U2', '>U2']:
+        # Enough values to be transcoded by several tasks
+        arr = np.array(values * 50000, dtype=dtype)
+        mask = np.array([False, False, True, False, False] * 50000)
+        arrow_arr = pa.array(arr, mask=mask)
+        expected = pa.array([v if not m else None
+                             for v, m in zip(arr.tolist(), mask)],
+                            type='utf8')
+        assert arrow_arr.equals(expected)
+
+    # Lone surrogates are not valid UTF-32
+    arr = np.frombuffer(np.array([0xd800], dtype='<u4').tobytes(),
+                        dtype='<U1')
+    with pytest.raises(pa.ArrowInvalid):
+        pa.array(arr)
+
+
 def test_buffers_primitive():
     a = pa.array([1, 2, None, 4], type=pa.int16())
     buffers = a.buffers()
@@ -235,6 +235,22 @@ def test_sequence_double():
     assert arr.to_pylist() == data
 
 
+@pytest.mark.parametrize(('data', 'type', 'expected'), [
+    ([None, True, False], pa.bool_(), [None, True, False]),
+    ([True, None, 2, 3], pa.int64(), [1, None, 2, 3]),
+    ([1, 2, None, 2.5], pa.float64(), [1.0, 2.0, None, 2.5]),
+    ([float('nan'), 1, False], pa.int64(), [None, 1, 0]),
+    ([False, 1, 2.5], pa.float64(), [0.0, 1.0, 2.5]),
+    ([u'a', None, b'b'], pa.binary(), [b'a', None, b'b']),
+    ([2 ** 64, 1.5], pa.float64(), [2.0 ** 64, 1.5]),
+])
+def test_sequence_promoted_types(data, type, expected):
+    # The type of the values seen first is widened by the values seen later
+    arr = pa.array(data)
+    assert arr.type == type
+    assert arr.to_pylist() == expected
+
+
 @pytest.mark.parametrize("seq", [_as_list, _as_tuple, _as_dict_values])
 @pytest.mark.parametrize("np_scalar", [np.float16, np.float32, np.float64])
 def test_sequence_numpy_double(seq, np_scalar):
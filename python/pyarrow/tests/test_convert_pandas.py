@@ -1082,6 +1082,28 @@ class TestConvertStringLikeTypes(object):
         table = pa.Table.from_pandas(df)
         assert table[0].data.num_chunks == 2
 
+    @pytest.mark.parametrize('typ', [pa.string(), pa.binary()])
+    def test_deduplicate_objects(self, typ):
+        values = [u'foo', None, u'bar', u'', u'foo', u'bar', u'']
+        if typ == pa.binary():
+            values = [v.encode('utf-8') if v is not None else None
+                      for v in values]
+        # Equal values of different chunks are deduplicated too
+        arr = pa.chunked_array([pa.array(values[:3], type=typ),
+                                pa.array(values[3:], type=typ)])
+        table = pa.Table.from_arrays([arr], ['strings'])
+
+        result = table.to_pandas(deduplicate_objects=True)['strings']
+        assert list(result) == values
+        assert result[0] is result[4]
+        assert result[2] is result[5]
+        assert result[3] is result[6]
+
+        result = table.column(0).to_pandas(deduplicate_objects=True)
+        assert result[0] is result[4]
+        result = pa.array(values, type=typ).to_pandas(deduplicate_objects=True)
+        assert result[0] is result[4]
+
     def test_fixed_size_bytes(self):
         values = [b'foo', None, b'bar', None, None, b'hey']
         df = pd.DataFrame({'strings': values})
@@ -1262,6 +1284,31 @@ class TestConvertDecimalTypes(object):
         expected = [decimal.Decimal('0.01000'), decimal.Decimal('0.00100')]
         assert array.to_pylist() == expected
 
+    def test_decimal_with_exponents_and_nan(self):
+        data = [
+            decimal.Decimal('1.5E+3'),
+            decimal.Decimal('-2.25E-4'),
+            decimal.Decimal('NaN'),
+            decimal.Decimal('-12345678901234567890.123'),
+            decimal.Decimal('-0.00'),
+        ]
+        series = pd.Series(data)
+        array = pa.array(series)
+        assert array.type == pa.decimal128(23, 6)
+        assert array.null_count == 1
+        assert array.to_pylist() == data[:2] + [None] + data[3:]
+
+        array = pa.array(series[:3], type=pa.decimal128(10, 6))
+        assert array.to_pylist() == data[:2] + [None]
+
+        with pytest.raises(pa.ArrowInvalid):
+            pa.array(series, type=pa.decimal128(10, 6))
+
+    def test_decimal_infinity_fails(self):
+        series = pd.Series([decimal.Decimal('Infinity')])
+        with pytest.raises(pa.ArrowInvalid):
+            pa.array(series, type=pa.decimal128(10, 2))
+
 
 class TestListTypes(object):
     """
@@ -1666,18 +1713,63 @@ class TestZeroCopyConversion(object):
         with pytest.raises(pa.ArrowException):
             pa.array(arr).to_pandas(zero_copy_only=True)
 
-    def test_zero_copy_failure_on_timestamp_types(self):
-        arr = np.array(['2007-07-13'], dtype='datetime64[ns]')
+    @pytest.mark.parametrize('unit', ['s', 'ms', 'us', 'ns'])
+    def test_zero_copy_timestamps(self, unit):
+        arr = np.array(['2007-07-13', '2010-08-13'],
+                       dtype='datetime64[%s]' % unit)
+
+        result = pa.array(arr).to_pandas(zero_copy_only=True)
+        npt.assert_array_equal(result, arr)
+
+    def test_zero_copy_failure_on_timestamps_with_nulls(self):
+        arr = np.array(['2007-07-13', 'NaT'], dtype='datetime64[ns]')
 
         with pytest.raises(pa.ArrowException):
             pa.array(arr).to_pandas(zero_copy_only=True)
 
+    def test_zero_copy_timestamps_with_timezone(self):
+        values = np.array(['2007-07-13T01:23:34.123456789',
+                           '2010-08-13T05:46:57.437699912'],
+                          dtype='datetime64[ns]')
+        arr = pa.array(values, type=pa.timestamp('ns', tz='US/Eastern'))
+        table = pa.Table.from_arrays([arr], ['datetime64'])
+        result = table.to_pandas()
+        expected = pd.DataFrame({
+            'datetime64': pd.Series(values).dt.tz_localize('UTC')
+                                           .dt.tz_convert('US/Eastern')
+        })
+        tm.assert_frame_equal(result, expected)
+
 
 class TestConvertMisc(object):
     """
     Miscellaneous conversion tests.
     """
 
+    @pytest.mark.parametrize('preserve_index', [False, True])
+    def test_self_destruct(self, preserve_index):
+        df = pd.DataFrame({'ints': np.arange(1000),
+                           'floats': np.random.randn(1000),
+                           'strings': [str(i) for i in range(1000)]},
+                          index=np.arange(1000, 2000),
+                          columns=['ints', 'floats', 'strings'])
+        if not preserve_index:
+            df = df.reset_index(drop=True)
+        table = pa.Table.from_pandas(df, preserve_index=preserve_index)
+        result = table.to_pandas(self_destruct=True, nthreads=2)
+        tm.assert_frame_equal(result, df)
+        with pytest.raises(ReferenceError):
+            table.num_rows
+
+    def test_iter_pandas(self):
+        df = pd.DataFrame({'ints': np.arange(1000),
+                           'strings': [str(i) for i in range(1000)]},
+                          columns=['ints', 'strings'])
+        table = pa.Table.from_pandas(df, preserve_index=False)
+        chunks = list(table.iter_pandas(300))
+        assert [len(chunk) for chunk in chunks] == [300, 300, 300, 100]
+        tm.assert_frame_equal(pd.concat(chunks), df)
+
     type_pairs = [
         (np.int8, pa.int8()),
         (np.int16, pa.int16()),
@@ -0,0 +1,62 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+
+import pytest
+
+import pyarrow as pa
+
+
+def test_child_memory_pool():
+    pool = pa.ChildMemoryPool()
+    assert pool.limit is None
+    assert pool.bytes_allocated() == 0
+    assert pool.num_allocations() == 0
+
+    arr = pa.array(list(range(1000)), memory_pool=pool)
+    assert pool.bytes_allocated() >= arr.nbytes
+    assert pool.max_memory() >= pool.bytes_allocated()
+    assert pool.num_allocations() > 0
+
+    del arr
+    assert pool.bytes_allocated() == 0
+    assert pool.max_memory() > 0
+
+
+def test_child_memory_pool_limit():
+    pool = pa.ChildMemoryPool(pa.default_memory_pool(), limit=1024)
+    assert pool.limit == 1024
+    with pytest.raises(pa.ArrowMemoryError):
+        pa.array(list(range(1000)), memory_pool=pool)
+    assert pool.bytes_allocated() == 0
+
+
+def test_memory_pools_by_name():
+    for pool in [pa.default_memory_pool(), pa.system_memory_pool(),
+                 pa.thread_caching_memory_pool()]:
+        before = pool.bytes_allocated()
+        arr = pa.array([1, 2, 3], memory_pool=pool)
+        assert pool.bytes_allocated() > before
+        del arr
+        assert pool.bytes_allocated() == before
+
+    try:
+        pool = pa.jemalloc_memory_pool()
+    except pa.ArrowNotImplementedError:
+        pass
+    else:
+        assert pool.bytes_allocated() >= 0
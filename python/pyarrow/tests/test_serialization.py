@@ -306,6 +306,24 @@ def test_custom_serialization(large_buffer):
         serialization_roundtrip(obj, large_buffer)
 
 
+def test_homogeneous_serialization(large_buffer):
+    n = 100000
+    objects = [[float(i) for i in range(n)],
+               list(range(n)),
+               [str(i) for i in range(n)],
+               {str(i): i for i in range(1000)},
+               [[1.0, 2.0], [3.0]],
+               [1.0, None, 2.0],
+               [1, 2.0, "3"],
+               [], {}]
+    for obj in objects:
+        serialization_roundtrip(obj, large_buffer)
+
+    # Uniform elements are written without type ids and offsets.
+    size = pa.serialize([float(i) for i in range(n)]).to_buffer().size
+    assert size < n * 8 + 4096
+
+
 def test_default_dict_serialization(large_buffer):
     pytest.importorskip("cloudpickle")
 